@@ -0,0 +1,439 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Micro-benchmarks for the Aurora namespace.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/ustring.h"
+#include "src/common/memreadstream.h"
+#include "src/common/memwritestream.h"
+#include "src/common/writefile.h"
+#include "src/common/filepath.h"
+
+#include "src/aurora/types.h"
+#include "src/aurora/gff3file.h"
+#include "src/aurora/gff3writer.h"
+#include "src/aurora/gff4file.h"
+#include "src/aurora/2dafile.h"
+#include "src/aurora/erfwriter.h"
+#include "src/aurora/resman.h"
+
+#include "src/aurora/nwscript/ncsfile.h"
+#include "src/aurora/nwscript/variable.h"
+
+#include "benchmarks/benchmark.h"
+
+// --- GFF3 ---
+
+static const size_t kGFFStructCount = 1000;
+
+/** Create a GFF3 with a list of structs, each looking a bit like an item. */
+static void createGFF3(Common::MemoryWriteStreamDynamic &stream) {
+	Aurora::GFF3Writer writer(MKTAG('U', 'T', 'I', ' '));
+
+	Aurora::GFF3WriterStructPtr top = writer.getTopLevel();
+	top->addExoString("Comment", "Benchmark");
+
+	Aurora::GFF3WriterListPtr list = top->addList("ItemList");
+	for (size_t i = 0; i < kGFFStructCount; i++) {
+		Aurora::GFF3WriterStructPtr item = list->addStruct("", i);
+
+		item->addResRef   ("TemplateResRef", Common::UString::format("item%04u", (uint) i));
+		item->addExoString("Tag"           , Common::UString::format("ITEM_TAG_%u", (uint) i));
+		item->addUint32   ("BaseItem"      , i % 113);
+		item->addUint32   ("Cost"          , i * 7);
+		item->addUint16   ("StackSize"     , 1);
+		item->addByte     ("Identified"    , 1);
+		item->addFloat    ("XPosition"     , i * 0.5f);
+		item->addFloat    ("YPosition"     , i * 0.25f);
+	}
+
+	writer.write(stream);
+}
+
+BENCHMARK(GFF3File, parse) {
+	Common::MemoryWriteStreamDynamic data(true);
+	createGFF3(data);
+
+	state.setBytesPerIteration(data.size());
+
+	while (state.keepRunning()) {
+		Aurora::GFF3File gff3(new Common::MemoryReadStream(data.getData(), data.size()));
+		Benchmark::doNotOptimize(gff3.getTopLevel());
+	}
+}
+
+BENCHMARK(GFF3File, readFields) {
+	Common::MemoryWriteStreamDynamic data(true);
+	createGFF3(data);
+
+	Aurora::GFF3File gff3(new Common::MemoryReadStream(data.getData(), data.size()));
+
+	state.setItemsPerIteration(kGFFStructCount * 4);
+
+	while (state.keepRunning()) {
+		const Aurora::GFF3List &list = gff3.getTopLevel().getList("ItemList");
+
+		uint64_t sum = 0;
+		for (Aurora::GFF3List::const_iterator i = list.begin(); i != list.end(); ++i) {
+			sum += (*i)->getUint("BaseItem");
+			sum += (*i)->getUint("Cost");
+			sum += (*i)->getString("Tag").size();
+			sum += (uint64_t) (*i)->getDouble("XPosition");
+		}
+
+		Benchmark::doNotOptimize(sum);
+	}
+}
+
+// --- GFF4 ---
+
+static const uint32_t kGFF4FieldList = 1;
+static const uint32_t kGFF4FieldBase = 100;
+static const uint32_t kGFF4FieldCount = 4;
+
+/** Create a GFF4 V4.0 with a list of structs with a few integer and float fields. */
+static void createGFF4(Common::MemoryWriteStreamDynamic &stream) {
+	static const uint32_t kHeaderSize         = 28;
+	static const uint32_t kStructTemplateSize = 16;
+	static const uint32_t kFieldSize          = 12;
+	static const uint32_t kItemSize           = kGFF4FieldCount * 4;
+
+	const uint32_t fieldStart = kHeaderSize + 2 * kStructTemplateSize;
+	const uint32_t dataStart  = fieldStart + (1 + kGFF4FieldCount) * kFieldSize;
+
+	stream.writeUint32BE(MKTAG('G', 'F', 'F', ' '));
+	stream.writeUint32BE(MKTAG('V', '4', '.', '0'));
+	stream.writeUint32BE(MKTAG('P', 'C', ' ', ' '));
+	stream.writeUint32BE(MKTAG('B', 'N', 'C', 'H'));
+	stream.writeUint32BE(MKTAG('V', '0', '.', '1'));
+	stream.writeUint32LE(2);
+	stream.writeUint32LE(dataStart);
+
+	// Struct templates: the top-level struct with a list, and the list items
+	stream.writeUint32BE(MKTAG('T', 'O', 'P', ' '));
+	stream.writeUint32LE(1);
+	stream.writeUint32LE(fieldStart);
+	stream.writeUint32LE(4);
+
+	stream.writeUint32BE(MKTAG('I', 'T', 'E', 'M'));
+	stream.writeUint32LE(kGFF4FieldCount);
+	stream.writeUint32LE(fieldStart + kFieldSize);
+	stream.writeUint32LE(kItemSize);
+
+	// A list (0x8000) of structs (0x4000) of template 1
+	stream.writeUint32LE(kGFF4FieldList);
+	stream.writeUint32LE((0xC000 << 16) | 1);
+	stream.writeUint32LE(0);
+
+	for (uint32_t i = 0; i < kGFF4FieldCount; i++) {
+		const uint32_t type = ((i % 2) == 0) ? Aurora::GFF4Struct::kFieldTypeUint32 : Aurora::GFF4Struct::kFieldTypeFloat32;
+
+		stream.writeUint32LE(kGFF4FieldBase + i);
+		stream.writeUint32LE(type);
+		stream.writeUint32LE(i * 4);
+	}
+
+	// The top-level struct, pointing to the list directly behind it
+	stream.writeUint32LE(4);
+
+	stream.writeUint32LE(kGFFStructCount);
+	for (uint32_t i = 0; i < kGFFStructCount; i++) {
+		for (uint32_t j = 0; j < kGFF4FieldCount; j++) {
+			if ((j % 2) == 0)
+				stream.writeUint32LE(i * kGFF4FieldCount + j);
+			else
+				stream.writeIEEEFloatLE(i * 0.5f);
+		}
+	}
+}
+
+BENCHMARK(GFF4File, parse) {
+	Common::MemoryWriteStreamDynamic data(true);
+	createGFF4(data);
+
+	state.setBytesPerIteration(data.size());
+
+	while (state.keepRunning()) {
+		Aurora::GFF4File gff4(new Common::MemoryReadStream(data.getData(), data.size()));
+		Benchmark::doNotOptimize(gff4.getTopLevel());
+	}
+}
+
+BENCHMARK(GFF4File, readFields) {
+	Common::MemoryWriteStreamDynamic data(true);
+	createGFF4(data);
+
+	Aurora::GFF4File gff4(new Common::MemoryReadStream(data.getData(), data.size()));
+
+	state.setItemsPerIteration(kGFFStructCount * kGFF4FieldCount);
+
+	while (state.keepRunning()) {
+		const Aurora::GFF4List &list = gff4.getTopLevel().getList(kGFF4FieldList);
+
+		uint64_t sum = 0;
+		for (Aurora::GFF4List::const_iterator i = list.begin(); i != list.end(); ++i) {
+			sum += (*i)->getUint(kGFF4FieldBase + 0);
+			sum += (uint64_t) (*i)->getDouble(kGFF4FieldBase + 1);
+			sum += (*i)->getUint(kGFF4FieldBase + 2);
+			sum += (uint64_t) (*i)->getDouble(kGFF4FieldBase + 3);
+		}
+
+		Benchmark::doNotOptimize(sum);
+	}
+}
+
+// --- 2DA ---
+
+static const size_t kTwoDARowCount = 1000;
+
+/** Create an ASCII 2DA looking a bit like baseitems.2da. */
+static Common::UString createTwoDA() {
+	Common::UString twoDA = "2DA V2.0\n\n   Label Name ModelType WeaponSize Cost Weight ItemClass Stacking\n";
+
+	for (size_t i = 0; i < kTwoDARowCount; i++) {
+		const Common::UString name = ((i % 10) == 3) ? Common::UString("****") : Common::UString::format("%u", (uint) (i * 3));
+
+		twoDA += Common::UString::format("%u item_%u %s %u %u %u.%u it_class_%u %u\n",
+		                                 (uint) i, (uint) i, name.c_str(), (uint) (i % 4), (uint) (i % 5),
+		                                 (uint) (i * 11), (uint) (i % 10), (uint) i, (uint) (1 + (i % 50)));
+	}
+
+	return twoDA;
+}
+
+BENCHMARK(TwoDAFile, parseASCII) {
+	const Common::UString twoDA = createTwoDA();
+
+	state.setBytesPerIteration(twoDA.size());
+
+	while (state.keepRunning()) {
+		Common::MemoryReadStream stream(twoDA.c_str(), twoDA.size());
+
+		Aurora::TwoDAFile file(stream);
+		Benchmark::doNotOptimize(file.getRowCount());
+	}
+}
+
+BENCHMARK(TwoDAFile, parseBinary) {
+	Common::MemoryWriteStreamDynamic binary(true);
+	{
+		const Common::UString twoDA = createTwoDA();
+		Common::MemoryReadStream stream(twoDA.c_str(), twoDA.size());
+
+		Aurora::TwoDAFile(stream).writeBinary(binary);
+	}
+
+	state.setBytesPerIteration(binary.size());
+
+	while (state.keepRunning()) {
+		Common::MemoryReadStream stream(binary.getData(), binary.size());
+
+		Aurora::TwoDAFile file(stream);
+		Benchmark::doNotOptimize(file.getRowCount());
+	}
+}
+
+BENCHMARK(TwoDAFile, getIntByName) {
+	const Common::UString twoDA = createTwoDA();
+	Common::MemoryReadStream stream(twoDA.c_str(), twoDA.size());
+
+	const Aurora::TwoDAFile file(stream);
+	const Common::UString column("Cost");
+
+	state.setItemsPerIteration(file.getRowCount());
+
+	while (state.keepRunning()) {
+		int64_t sum = 0;
+		for (size_t i = 0; i < file.getRowCount(); i++)
+			sum += file.getRow(i).getInt(column);
+
+		Benchmark::doNotOptimize(sum);
+	}
+}
+
+BENCHMARK(TwoDAFile, getIntByHandle) {
+	const Common::UString twoDA = createTwoDA();
+	Common::MemoryReadStream stream(twoDA.c_str(), twoDA.size());
+
+	const Aurora::TwoDAFile file(stream);
+	const Aurora::TwoDAColumnHandle column = file.getColumnHandle("Cost");
+
+	state.setItemsPerIteration(file.getRowCount());
+
+	while (state.keepRunning()) {
+		int64_t sum = 0;
+		for (size_t i = 0; i < file.getRowCount(); i++)
+			sum += file.getRow(i).getInt(column);
+
+		Benchmark::doNotOptimize(sum);
+	}
+}
+
+BENCHMARK(TwoDAFile, getRowByValue) {
+	const Common::UString twoDA = createTwoDA();
+	Common::MemoryReadStream stream(twoDA.c_str(), twoDA.size());
+
+	const Aurora::TwoDAFile file(stream);
+	const Aurora::TwoDAColumnHandle column = file.getColumnHandle("Cost");
+
+	static const size_t kLookupCount = 64;
+
+	std::vector<Common::UString> labels;
+	for (size_t i = 0; i < kLookupCount; i++)
+		labels.push_back(Common::UString::format("item_%u", (uint) ((i * 997) % kTwoDARowCount)));
+
+	state.setItemsPerIteration(kLookupCount);
+
+	while (state.keepRunning()) {
+		int64_t sum = 0;
+		for (size_t i = 0; i < kLookupCount; i++)
+			sum += file.getRow("Label", labels[i]).getInt(column);
+
+		Benchmark::doNotOptimize(sum);
+	}
+}
+
+// --- ResourceManager ---
+
+static const size_t kResourceCount = 1000;
+
+/** A temporary data directory with an ERF archive in it, indexed by the resource manager. */
+class TemporaryArchive {
+public:
+	TemporaryArchive() {
+		_path = boost::filesystem::temp_directory_path() /
+		        boost::filesystem::unique_path("%%%%_%%%%_%%%%_%%%%.xoreos");
+
+		boost::filesystem::create_directory(_path);
+
+		const std::vector<byte> text = Benchmark::createText(kResourceCount * 64);
+
+		{
+			Common::WriteFile file(Common::FilePath::normalize((_path / "benchmark.erf").generic_string()));
+			Aurora::ERFWriter erf(MKTAG('E', 'R', 'F', ' '), kResourceCount, file);
+
+			for (size_t i = 0; i < kResourceCount; i++) {
+				Common::MemoryReadStream resource(text.data() + i * 64, 64);
+
+				erf.add(Common::UString::format("resource%04u", (uint) i), Aurora::kFileTypeTXT, resource);
+			}
+		}
+
+		ResMan.registerDataBase(_path.generic_string());
+		ResMan.indexArchive("benchmark.erf", 100);
+	}
+
+	~TemporaryArchive() {
+		ResMan.clear();
+
+		boost::system::error_code error;
+		boost::filesystem::remove_all(_path, error);
+	}
+
+private:
+	boost::filesystem::path _path;
+};
+
+BENCHMARK(ResourceManager, getResource) {
+	TemporaryArchive archive;
+
+	std::vector<Common::UString> names;
+	for (size_t i = 0; i < kResourceCount; i++)
+		names.push_back(Common::UString::format("resource%04u", (uint) ((i * 997) % kResourceCount)));
+
+	state.setItemsPerIteration(kResourceCount);
+
+	while (state.keepRunning()) {
+		size_t sum = 0;
+		for (size_t i = 0; i < kResourceCount; i++) {
+			std::unique_ptr<Common::SeekableReadStream> resource(ResMan.getResource(names[i], Aurora::kFileTypeTXT));
+			if (!resource)
+				throw Common::Exception("Missing resource \"%s\"", names[i].c_str());
+
+			sum += resource->size();
+		}
+
+		Benchmark::doNotOptimize(sum);
+	}
+}
+
+BENCHMARK(ResourceManager, hasResource) {
+	TemporaryArchive archive;
+
+	std::vector<Common::UString> names;
+	for (size_t i = 0; i < kResourceCount; i++)
+		names.push_back(Common::UString::format("resource%04u", (uint) ((i * 997) % kResourceCount)));
+
+	state.setItemsPerIteration(kResourceCount);
+
+	while (state.keepRunning()) {
+		size_t sum = 0;
+		for (size_t i = 0; i < kResourceCount; i++)
+			sum += ResMan.hasResource(names[i], Aurora::kFileTypeTXT);
+
+		Benchmark::doNotOptimize(sum);
+	}
+}
+
+// --- NWScript ---
+
+// int i = 10000; while (i) i--; return i;
+static const byte kNCSLoop[] = {
+	'N', 'C', 'S', ' ', 'V', '1', '.', '0', 0x42, 0x00, 0x00, 0x00, 0x3D,
+	0x02, 0x03,                                           // RSADDI
+	0x04, 0x03, 0x00, 0x00, 0x27, 0x10,                   // CONSTI 10000
+	0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x04,       // CPDOWNSP -8, 4
+	0x1B, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,                   // MOVSP -4
+	0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x04,       // CPTOPSP -4, 4
+	0x1F, 0x00, 0x00, 0x00, 0x00, 0x12,                   // JZ +18
+	0x23, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,                   // DECISP -4
+	0x1D, 0x00, 0xFF, 0xFF, 0xFF, 0xEC                    // JMP -20
+};
+
+BENCHMARK(NCSFile, runLoop) {
+	Aurora::NWScript::NCSFile ncs(new Common::MemoryReadStream(kNCSLoop));
+
+	// 4 instructions of setup, 4 per iteration and 2 for the final check
+	state.setItemsPerIteration(4 + 10000 * 4 + 2);
+
+	while (state.keepRunning()) {
+		const Aurora::NWScript::Variable &result = ncs.run((Aurora::NWScript::Object *) 0);
+		if (result.getInt() != 0)
+			throw Common::Exception("Unexpected script result %d", result.getInt());
+	}
+}
+
+BENCHMARK(NCSFile, load) {
+	state.setBytesPerIteration(sizeof(kNCSLoop));
+
+	while (state.keepRunning()) {
+		Aurora::NWScript::NCSFile ncs(new Common::MemoryReadStream(kNCSLoop));
+		Benchmark::doNotOptimize(ncs.getName());
+	}
+}
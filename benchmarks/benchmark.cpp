@@ -0,0 +1,298 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A small micro-benchmark framework.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <exception>
+
+#include "src/common/util.h"
+
+#include "benchmarks/benchmark.h"
+
+namespace Benchmark {
+
+State::State(uint64_t iterations) : _iterations(iterations), _left(iterations),
+	_bytesPerIteration(0), _itemsPerIteration(0), _running(false), _elapsed(Clock::duration::zero()) {
+
+}
+
+void State::start() {
+	_running   = true;
+	_startTime = Clock::now();
+}
+
+void State::stop() {
+	if (!_running)
+		return;
+
+	_elapsed += Clock::now() - _startTime;
+	_running  = false;
+}
+
+void State::pauseTiming() {
+	stop();
+}
+
+void State::resumeTiming() {
+	start();
+}
+
+void State::setBytesPerIteration(uint64_t bytes) {
+	_bytesPerIteration = bytes;
+}
+
+void State::setItemsPerIteration(uint64_t items) {
+	_itemsPerIteration = items;
+}
+
+uint64_t State::getIterations() const {
+	return _iterations;
+}
+
+uint64_t State::getBytesPerIteration() const {
+	return _bytesPerIteration;
+}
+
+uint64_t State::getItemsPerIteration() const {
+	return _itemsPerIteration;
+}
+
+double State::getElapsed() const {
+	return std::chrono::duration<double, std::nano>(_elapsed).count();
+}
+
+
+/** A simple linear congruential generator, so that the data is the same on all platforms. */
+static uint32_t nextRandom(uint32_t &state) {
+	state = state * 1664525 + 1013904223;
+
+	return state >> 8;
+}
+
+void fillRandom(byte *data, size_t size, uint32_t seed) {
+	uint32_t state = seed;
+
+	for (size_t i = 0; i < size; i++)
+		data[i] = nextRandom(state) & 0xFF;
+}
+
+std::vector<byte> createText(size_t size, uint32_t seed) {
+	static const char * const kWords[] = {
+		"the", "of", "and", "a", "to", "in", "is", "you", "that", "it", "he", "was", "for", "on",
+		"are", "as", "with", "his", "they", "at", "be", "this", "have", "from", "or", "one",
+		"had", "by", "word", "but", "not", "what", "all", "were", "we", "when", "your", "can",
+		"said", "there", "use", "an", "each", "which", "she", "do", "how", "their", "if", "will",
+		"dragon", "sword", "tavern", "merchant", "journal", "quest", "companion", "spell"
+	};
+
+	uint32_t state = seed;
+
+	std::vector<byte> text;
+	text.reserve(size + 16);
+
+	while (text.size() < size) {
+		const char *word = kWords[nextRandom(state) % ARRAYSIZE(kWords)];
+		text.insert(text.end(), word, word + std::strlen(word));
+
+		text.push_back(((nextRandom(state) % 12) == 0) ? '\n' : ' ');
+	}
+
+	text.resize(size);
+	return text;
+}
+
+
+struct Entry {
+	const char *name;
+	Function function;
+};
+
+static std::vector<Entry> &getEntries() {
+	static std::vector<Entry> entries;
+
+	return entries;
+}
+
+Registrar::Registrar(const char *name, Function function) {
+	getEntries().push_back({ name, function });
+}
+
+
+struct Options {
+	std::string filter;  ///< Only run benchmarks with this in their name.
+	double minTime;      ///< Minimum time of a single measured run, in nanoseconds.
+	size_t repetitions;  ///< Number of measured runs.
+	bool list;           ///< Only list the benchmarks.
+
+	Options() : minTime(0.2e9), repetitions(5), list(false) { }
+};
+
+static bool parseOption(const char *arg, const char *name, const char *&value) {
+	const size_t length = std::strlen(name);
+	if (std::strncmp(arg, name, length) || (arg[length] != '='))
+		return false;
+
+	value = arg + length + 1;
+	return true;
+}
+
+static bool parseOptions(int argc, char **argv, Options &options) {
+	for (int i = 1; i < argc; i++) {
+		const char *value = 0;
+
+		if        (!std::strcmp(argv[i], "--list")) {
+			options.list = true;
+		} else if (parseOption(argv[i], "--filter", value)) {
+			options.filter = value;
+		} else if (parseOption(argv[i], "--min-time", value)) {
+			options.minTime = std::atof(value) * 1e9;
+		} else if (parseOption(argv[i], "--repetitions", value)) {
+			options.repetitions = std::strtoul(value, 0, 10);
+		} else {
+			std::fprintf(stderr, "Usage: %s [--list] [--filter=<text>] [--min-time=<seconds>] [--repetitions=<count>]\n", argv[0]);
+			return false;
+		}
+	}
+
+	options.repetitions = MAX<size_t>(options.repetitions, 1);
+	options.minTime     = MAX(options.minTime, 1e6);
+
+	return true;
+}
+
+static std::string escapeJSON(const char *str) {
+	std::string escaped;
+
+	for (; *str; str++) {
+		if        ((*str == '"') || (*str == '\\')) {
+			escaped += '\\';
+			escaped += *str;
+		} else if ((unsigned char) *str < 0x20) {
+			char code[8];
+			std::snprintf(code, sizeof(code), "\\u%04x", (uint)(unsigned char) *str);
+			escaped += code;
+		} else
+			escaped += *str;
+	}
+
+	return escaped;
+}
+
+/** Run the benchmark with more and more iterations, until a run takes at least minTime. */
+static uint64_t calibrate(const Entry &entry, double minTime) {
+	static const uint64_t kMaxIterations = UINT64_C(1000000000);
+
+	uint64_t iterations = 1;
+	while (iterations < kMaxIterations) {
+		State state(iterations);
+		entry.function(state);
+
+		const double elapsed = state.getElapsed();
+		if (elapsed >= minTime)
+			break;
+
+		// Aim a bit beyond the minimum time, but never grow by more than 100 times at once
+		double factor = 100.0;
+		if (elapsed > 0.0)
+			factor = MIN(factor, (minTime * 1.4) / elapsed);
+
+		iterations = MIN(kMaxIterations, MAX(iterations * 2, (uint64_t) (iterations * factor)));
+	}
+
+	return iterations;
+}
+
+static void runEntry(const Entry &entry, const Options &options) {
+	const uint64_t iterations = calibrate(entry, options.minTime);
+
+	std::vector<double> times;
+	times.reserve(options.repetitions);
+
+	uint64_t bytes = 0, items = 0;
+	for (size_t i = 0; i < options.repetitions; i++) {
+		State state(iterations);
+		entry.function(state);
+
+		times.push_back(state.getElapsed() / iterations);
+
+		bytes = state.getBytesPerIteration();
+		items = state.getItemsPerIteration();
+	}
+
+	std::sort(times.begin(), times.end());
+
+	const double median = times[times.size() / 2];
+
+	std::printf("{\"name\": \"%s\", \"iterations\": %llu, \"repetitions\": %u, "
+	            "\"ns_per_iteration\": %.3f, \"ns_per_iteration_min\": %.3f, \"ns_per_iteration_max\": %.3f",
+	            escapeJSON(entry.name).c_str(), (unsigned long long) iterations, (uint) options.repetitions,
+	            median, times.front(), times.back());
+
+	if ((bytes > 0) && (median > 0.0))
+		std::printf(", \"bytes_per_second\": %.0f", (bytes * 1e9) / median);
+	if ((items > 0) && (median > 0.0))
+		std::printf(", \"items_per_second\": %.0f", (items * 1e9) / median);
+
+	std::printf("}\n");
+	std::fflush(stdout);
+}
+
+int runAll(int argc, char **argv) {
+	Options options;
+	if (!parseOptions(argc, argv, options))
+		return 2;
+
+	int result = 0;
+
+	for (std::vector<Entry>::const_iterator e = getEntries().begin(); e != getEntries().end(); ++e) {
+		if (!options.filter.empty() && !std::strstr(e->name, options.filter.c_str()))
+			continue;
+
+		if (options.list) {
+			std::printf("%s\n", e->name);
+			continue;
+		}
+
+		try {
+			runEntry(*e, options);
+		} catch (std::exception &x) {
+			std::printf("{\"name\": \"%s\", \"error\": \"%s\"}\n", escapeJSON(e->name).c_str(), escapeJSON(x.what()).c_str());
+			std::fflush(stdout);
+
+			result = 1;
+		}
+	}
+
+	return result;
+}
+
+} // End of namespace Benchmark
+
+int main(int argc, char **argv) {
+	return Benchmark::runAll(argc, argv);
+}
@@ -0,0 +1,142 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A small micro-benchmark framework.
+ *
+ *  A benchmark is a function that does its setup, and then runs the code
+ *  to be measured in a loop:
+ *
+ *  BENCHMARK(UString, format) {
+ *  	Common::UString str;
+ *
+ *  	while (state.keepRunning())
+ *  		Benchmark::doNotOptimize(str = Common::UString::format("%d", 23));
+ *  }
+ *
+ *  Only the loop is timed. The benchmark is called again with more and
+ *  more iterations until a run takes long enough to be measured reliably,
+ *  and then repeated a few times. The results are written to stdout as
+ *  JSON, one object per line and benchmark, so that they can be collected
+ *  and compared between commits.
+ */
+
+#ifndef BENCHMARKS_BENCHMARK_H
+#define BENCHMARKS_BENCHMARK_H
+
+#include <chrono>
+#include <vector>
+
+#include "src/common/types.h"
+
+namespace Benchmark {
+
+/** The state of a benchmark while it runs, controlling the timed loop. */
+class State {
+public:
+	State(uint64_t iterations);
+
+	/** Run another iteration of the timed loop?
+	 *
+	 *  The timer starts with the first call and stops when
+	 *  the requested number of iterations has been run.
+	 */
+	bool keepRunning() {
+		if (_left > 0) {
+			if (_left-- == _iterations)
+				start();
+
+			return true;
+		}
+
+		stop();
+		return false;
+	}
+
+	/** Stop the timer, to exclude setup work done within the loop. */
+	void pauseTiming();
+	/** Restart the timer after pauseTiming(). */
+	void resumeTiming();
+
+	/** Set how many bytes a single iteration processes. */
+	void setBytesPerIteration(uint64_t bytes);
+	/** Set how many items (symbols, samples, lookups, ...) a single iteration processes. */
+	void setItemsPerIteration(uint64_t items);
+
+	uint64_t getIterations() const;
+	uint64_t getBytesPerIteration() const;
+	uint64_t getItemsPerIteration() const;
+
+	/** Return the time spent in the timed loop, in nanoseconds. */
+	double getElapsed() const;
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	uint64_t _iterations;
+	uint64_t _left;
+
+	uint64_t _bytesPerIteration;
+	uint64_t _itemsPerIteration;
+
+	bool _running;
+	Clock::time_point _startTime;
+	Clock::duration _elapsed;
+
+	void start();
+	void stop();
+};
+
+typedef void (*Function)(State &state);
+
+/** Registers a benchmark function when constructed. */
+class Registrar {
+public:
+	Registrar(const char *name, Function function);
+};
+
+/** Fill a buffer with reproducible pseudo-random bytes. */
+void fillRandom(byte *data, size_t size, uint32_t seed = 0);
+/** Create reproducible pseudo-random, but compressible, English-like text. */
+std::vector<byte> createText(size_t size, uint32_t seed = 0);
+
+/** Run all registered benchmarks, as controlled by the command line. */
+int runAll(int argc, char **argv);
+
+/** Make sure the compiler can't optimize away the computation of a value. */
+template<typename T>
+inline void doNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static volatile const void *sink;
+	sink = &value;
+#endif
+}
+
+} // End of namespace Benchmark
+
+/** Define and register a benchmark function, named "group.name". */
+#define BENCHMARK(group, name) \
+	static void benchmark_##group##_##name(Benchmark::State &state); \
+	static const Benchmark::Registrar benchmarkRegistrar_##group##_##name(#group "." #name, benchmark_##group##_##name); \
+	static void benchmark_##group##_##name(Benchmark::State &state)
+
+#endif // BENCHMARKS_BENCHMARK_H
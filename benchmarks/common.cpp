@@ -0,0 +1,365 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Micro-benchmarks for the Common namespace.
+ */
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#ifdef HAVE_CONFIG_H
+	#include "config.h"
+#endif
+
+#ifdef ENABLE_LZMA
+	#include <lzma.h>
+#endif
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/ustring.h"
+#include "src/common/memreadstream.h"
+#include "src/common/bitstream.h"
+#include "src/common/huffman.h"
+#include "src/common/deflate.h"
+#include "src/common/lzma.h"
+#include "src/common/maths.h"
+#include "src/common/fft.h"
+#include "src/common/rdft.h"
+#include "src/common/mdct.h"
+
+#include "benchmarks/benchmark.h"
+
+// --- UString ---
+
+static const char *kUTF8Text =
+	"Ein Mann, der von einer Sache nichts versteht, sollte \xC3\xBC" "ber sie schweigen. "
+	"\xD0\x9C\xD0\xB0\xD1\x81\xD1\x82\xD0\xB5\xD1\x80 \xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E "
+	"The lone and level sands stretch far away.";
+
+BENCHMARK(UString, constructASCII) {
+	const std::vector<byte> text = Benchmark::createText(256);
+	const std::string str(text.begin(), text.end());
+
+	state.setBytesPerIteration(str.size());
+
+	while (state.keepRunning()) {
+		Common::UString ustr(str);
+		Benchmark::doNotOptimize(ustr);
+	}
+}
+
+BENCHMARK(UString, constructUTF8) {
+	const std::string str(kUTF8Text);
+
+	state.setBytesPerIteration(str.size());
+
+	while (state.keepRunning()) {
+		Common::UString ustr(str);
+		Benchmark::doNotOptimize(ustr);
+	}
+}
+
+BENCHMARK(UString, iterate) {
+	const Common::UString str(kUTF8Text);
+
+	state.setBytesPerIteration(str.size());
+
+	while (state.keepRunning()) {
+		uint32_t sum = 0;
+		for (Common::UString::iterator c = str.begin(); c != str.end(); ++c)
+			sum += *c;
+
+		Benchmark::doNotOptimize(sum);
+	}
+}
+
+BENCHMARK(UString, append) {
+	while (state.keepRunning()) {
+		Common::UString str;
+		for (uint32_t i = 0; i < 64; i++) {
+			str += "data/";
+			str += (uint32_t) ('a' + (i % 26));
+		}
+
+		Benchmark::doNotOptimize(str);
+	}
+}
+
+BENCHMARK(UString, format) {
+	while (state.keepRunning()) {
+		Common::UString str = Common::UString::format("%s_%03d.%s", "module", 23, "are");
+		Benchmark::doNotOptimize(str);
+	}
+}
+
+BENCHMARK(UString, equalsIgnoreCase) {
+	const Common::UString str1("Data/Models/Creatures/c_dragon_head.mdl");
+	const Common::UString str2("data/models/creatures/C_DRAGON_HEAD.MDL");
+
+	while (state.keepRunning()) {
+		bool equal = str1.equalsIgnoreCase(str2);
+		Benchmark::doNotOptimize(equal);
+	}
+}
+
+BENCHMARK(UString, toLower) {
+	const Common::UString str("Data/Models/Creatures/C_Dragon_Head.MDL");
+
+	while (state.keepRunning()) {
+		Common::UString lower = str.toLower();
+		Benchmark::doNotOptimize(lower);
+	}
+}
+
+BENCHMARK(UString, split) {
+	const std::vector<byte> text = Benchmark::createText(4096);
+	const Common::UString str(reinterpret_cast<const char *>(text.data()), text.size());
+
+	state.setBytesPerIteration(text.size());
+
+	std::vector<Common::UString> words;
+	while (state.keepRunning()) {
+		words.clear();
+
+		size_t count = Common::UString::split(str, ' ', words);
+		Benchmark::doNotOptimize(count);
+	}
+}
+
+// --- Compression ---
+
+static const size_t kCompressionSize = 1024 * 1024;
+
+BENCHMARK(Deflate, decompress) {
+	const std::vector<byte> text = Benchmark::createText(kCompressionSize);
+
+	// Compress in a single frame, the text compresses to far less than its own size
+	size_t compressedSize = 0;
+	std::unique_ptr<byte[]> compressed(Common::compressDeflate(text.data(), text.size(), compressedSize,
+	                                                           Common::kWindowBitsMaxRaw, text.size()));
+
+	state.setBytesPerIteration(text.size());
+
+	while (state.keepRunning()) {
+		std::unique_ptr<byte[]> decompressed(Common::decompressDeflate(compressed.get(), compressedSize,
+		                                                               text.size(), Common::kWindowBitsMaxRaw));
+		Benchmark::doNotOptimize(decompressed[0]);
+	}
+}
+
+#ifdef ENABLE_LZMA
+BENCHMARK(LZMA, decompress) {
+	const std::vector<byte> text = Benchmark::createText(kCompressionSize);
+
+	lzma_options_lzma options;
+	if (lzma_lzma_preset(&options, 6))
+		throw Common::Exception("Failed to get the LZMA preset");
+
+	lzma_filter filters[2] = {
+		{ LZMA_FILTER_LZMA1, &options },
+		{ LZMA_VLI_UNKNOWN , 0 }
+	};
+
+	// The properties, as read by decompressLZMA1(), followed by the raw LZMA1 data
+	std::vector<byte> compressed(text.size() + text.size() / 2 + 4096);
+
+	uint32_t propsSize = 0;
+	if ((lzma_properties_size(&propsSize, &filters[0]) != LZMA_OK) ||
+	    (lzma_properties_encode(&filters[0], compressed.data()) != LZMA_OK))
+		throw Common::Exception("Failed to encode the LZMA1 properties");
+
+	size_t compressedSize = propsSize;
+	if (lzma_raw_buffer_encode(filters, 0, text.data(), text.size(),
+	                           compressed.data(), &compressedSize, compressed.size()) != LZMA_OK)
+		throw Common::Exception("Failed to compress LZMA1 data");
+
+	state.setBytesPerIteration(text.size());
+
+	while (state.keepRunning()) {
+		std::unique_ptr<byte[]> decompressed(Common::decompressLZMA1(compressed.data(), compressedSize, text.size()));
+		Benchmark::doNotOptimize(decompressed[0]);
+	}
+}
+#endif
+
+// --- BitStream / Huffman ---
+
+static const size_t kBitStreamSize = 64 * 1024;
+
+BENCHMARK(BitStream, getBits8MSB) {
+	std::vector<byte> data(kBitStreamSize);
+	Benchmark::fillRandom(data.data(), data.size());
+
+	// 64 values of 1 to 16 bits each, 544 bits in total
+	static const size_t kValueCount = 64;
+	static const size_t kValueBits  = 544;
+
+	const size_t groups = (data.size() * 8) / kValueBits;
+
+	state.setItemsPerIteration(groups * kValueCount);
+
+	while (state.keepRunning()) {
+		Common::MemoryReadStream stream(data.data(), data.size());
+		Common::BitStream8MSB bits(stream);
+
+		uint32_t sum = 0;
+		for (size_t i = 0; i < groups; i++)
+			for (size_t j = 0; j < kValueCount; j++)
+				sum += bits.getBits((j % 16) + 1);
+
+		Benchmark::doNotOptimize(sum);
+	}
+}
+
+BENCHMARK(BitStream, getBitsMemory32LELSB) {
+	std::vector<byte> data(kBitStreamSize);
+	Benchmark::fillRandom(data.data(), data.size());
+
+	static const size_t kValueCount = 64;
+	static const size_t kValueBits  = 544;
+
+	const size_t groups = (data.size() * 8) / kValueBits;
+
+	state.setItemsPerIteration(groups * kValueCount);
+
+	while (state.keepRunning()) {
+		Common::MemoryBitStream32LELSB bits(data.data(), data.size());
+
+		uint32_t sum = 0;
+		for (size_t i = 0; i < groups; i++)
+			for (size_t j = 0; j < kValueCount; j++)
+				sum += bits.getBits((j % 16) + 1);
+
+		Benchmark::doNotOptimize(sum);
+	}
+}
+
+BENCHMARK(Huffman, getSymbol) {
+	// A complete prefix code: 0, 10, 110, ..., 1111110, 1111111
+	static const uint32_t kCodes  [] = { 0x00, 0x02, 0x06, 0x0E, 0x1E, 0x3E, 0x7E, 0x7F };
+	static const uint8_t  kLengths[] = {    1,    2,    3,    4,    5,    6,    7,    7 };
+
+	std::vector<byte> data(kBitStreamSize);
+	Benchmark::fillRandom(data.data(), data.size());
+
+	// Enough symbols to never run out of data, even if they were all of the maximum length
+	const size_t symbolCount = (data.size() * 8) / 7;
+
+	Common::Huffman huffman(7, ARRAYSIZE(kCodes), kCodes, kLengths);
+
+	state.setItemsPerIteration(symbolCount);
+
+	while (state.keepRunning()) {
+		Common::MemoryReadStream stream(data.data(), data.size());
+		Common::BitStream8MSB bits(stream);
+
+		uint32_t sum = 0;
+		for (size_t i = 0; i < symbolCount; i++)
+			sum += huffman.getSymbol(bits);
+
+		Benchmark::doNotOptimize(sum);
+	}
+}
+
+// --- FFT / RDFT / MDCT ---
+
+static void fillSignal(float *data, size_t size) {
+	for (size_t i = 0; i < size; i++)
+		data[i] = std::sin(i * 0.05f) + 0.5f * std::cos(i * 0.37f);
+}
+
+BENCHMARK(FFT, calc1024) {
+	static const int kBits = 10;
+
+	Common::FFT fft(kBits, false);
+
+	std::vector<Common::Complex> signal(1 << kBits), data(1 << kBits);
+	for (size_t i = 0; i < signal.size(); i++) {
+		signal[i].re = std::sin(i * 0.05f);
+		signal[i].im = std::cos(i * 0.37f);
+	}
+
+	state.setItemsPerIteration(data.size());
+
+	while (state.keepRunning()) {
+		data = signal;
+
+		fft.permute(data.data());
+		fft.calc(data.data());
+
+		Benchmark::doNotOptimize(data[1].re);
+	}
+}
+
+BENCHMARK(RDFT, calc1024) {
+	static const int kBits = 10;
+
+	Common::RDFT rdft(kBits, Common::RDFT::DFT_R2C);
+
+	std::vector<float> signal(1 << kBits), data(1 << kBits);
+	fillSignal(signal.data(), signal.size());
+
+	state.setItemsPerIteration(data.size());
+
+	while (state.keepRunning()) {
+		data = signal;
+
+		rdft.calc(data.data());
+
+		Benchmark::doNotOptimize(data[1]);
+	}
+}
+
+BENCHMARK(MDCT, calcMDCT2048) {
+	static const int kBits = 11;
+
+	Common::MDCT mdct(kBits, false, 1.0);
+
+	std::vector<float> input(1 << kBits), output((1 << kBits) / 2);
+	fillSignal(input.data(), input.size());
+
+	state.setItemsPerIteration(input.size());
+
+	while (state.keepRunning()) {
+		mdct.calcMDCT(output.data(), input.data());
+
+		Benchmark::doNotOptimize(output[1]);
+	}
+}
+
+BENCHMARK(MDCT, calcIMDCT2048) {
+	static const int kBits = 11;
+
+	Common::MDCT mdct(kBits, true, 1.0);
+
+	std::vector<float> input((1 << kBits) / 2), output(1 << kBits);
+	fillSignal(input.data(), input.size());
+
+	state.setItemsPerIteration(output.size());
+
+	while (state.keepRunning()) {
+		mdct.calcIMDCT(output.data(), input.data());
+
+		Benchmark::doNotOptimize(output[1]);
+	}
+}
@@ -0,0 +1,191 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Micro-benchmarks for the Engines namespace.
+ */
+
+#include <vector>
+#include <memory>
+
+#include "external/glm/vec3.hpp"
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+
+#include "src/engines/aurora/pathfinding.h"
+#include "src/engines/aurora/astar.h"
+
+#include "benchmarks/benchmark.h"
+
+/** A walkmesh laid out in a grid of squares of size 1, each split into two triangles. */
+class GridWalkmesh : public Engines::Pathfinding {
+public:
+	/** Create the grid. If serpentine, put in walls that force paths to wind through the whole grid. */
+	GridWalkmesh(uint32_t width, uint32_t height, bool serpentine) :
+		Engines::Pathfinding(std::vector<bool>({ true, false }), 3), _width(width), _height(height) {
+
+		_verticesCount = (width + 1) * (height + 1);
+		_facesCount    = width * height * 2;
+
+		_vertices.reserve(_verticesCount * 3);
+		for (uint32_t y = 0; y <= height; y++) {
+			for (uint32_t x = 0; x <= width; x++) {
+				_vertices.push_back(x);
+				_vertices.push_back(y);
+				_vertices.push_back(0.f);
+			}
+		}
+
+		_faces.reserve(_facesCount * 3);
+		_adjFaces.reserve(_facesCount * 3);
+		_faceProperty.reserve(_facesCount);
+
+		for (uint32_t y = 0; y < height; y++) {
+			for (uint32_t x = 0; x < width; x++) {
+				const uint32_t v00 =  y      * (width + 1) + x;
+				const uint32_t v10 =  y      * (width + 1) + x + 1;
+				const uint32_t v11 = (y + 1) * (width + 1) + x + 1;
+				const uint32_t v01 = (y + 1) * (width + 1) + x;
+
+				/* Counter-clockwise, edge n goes from vertex n to vertex n + 1.
+				 * The lower right triangle borders the square below and to the
+				 * right, the upper left one the square above and to the left. */
+
+				_faces.push_back(v00);
+				_faces.push_back(v10);
+				_faces.push_back(v11);
+
+				_adjFaces.push_back((y > 0)            ? getFace(x, y - 1, 1) : UINT32_MAX);
+				_adjFaces.push_back((x < (width - 1))  ? getFace(x + 1, y, 1) : UINT32_MAX);
+				_adjFaces.push_back(getFace(x, y, 1));
+
+				_faces.push_back(v00);
+				_faces.push_back(v11);
+				_faces.push_back(v01);
+
+				_adjFaces.push_back(getFace(x, y, 0));
+				_adjFaces.push_back((y < (height - 1)) ? getFace(x, y + 1, 0) : UINT32_MAX);
+				_adjFaces.push_back((x > 0)            ? getFace(x - 1, y, 0) : UINT32_MAX);
+
+				const uint32_t property = (serpentine && isWall(x, y)) ? 1 : 0;
+
+				_faceProperty.push_back(property);
+				_faceProperty.push_back(property);
+			}
+		}
+
+		_aStar = std::make_unique<Engines::AStar>(this);
+	}
+
+	bool findFacePath(float startX, float startY, float endX, float endY, std::vector<uint32_t> &facePath) {
+		return _aStar->findPath(startX, startY, endX, endY, facePath, 0.f, UINT32_MAX);
+	}
+
+	void smoothFacePath(float startX, float startY, float endX, float endY,
+	                    std::vector<uint32_t> &facePath, std::vector<glm::vec3> &path) {
+
+		path.clear();
+		funnelPath(startX, startY, endX, endY, facePath, path, _funnel);
+	}
+
+protected:
+	uint32_t findFace(float x, float y, bool onlyWalkable) {
+		if ((x < 0.f) || (y < 0.f) || (x >= _width) || (y >= _height))
+			return UINT32_MAX;
+
+		const uint32_t cellX = x;
+		const uint32_t cellY = y;
+
+		const uint32_t face = getFace(cellX, cellY, ((y - cellY) <= (x - cellX)) ? 0 : 1);
+		if (onlyWalkable && !faceWalkable(face))
+			return UINT32_MAX;
+
+		return face;
+	}
+
+private:
+	static const uint32_t kWallDistance = 8;
+
+	uint32_t _width;
+	uint32_t _height;
+
+	std::unique_ptr<Engines::AStar> _aStar;
+	Engines::FunnelBuffer _funnel;
+
+	uint32_t getFace(uint32_t x, uint32_t y, uint32_t triangle) const {
+		return (y * _width + x) * 2 + triangle;
+	}
+
+	/** Every few columns, there's a wall, with a gap alternating between the bottom and the top. */
+	bool isWall(uint32_t x, uint32_t y) const {
+		if ((x % kWallDistance) != (kWallDistance / 2))
+			return false;
+
+		const bool gapAtTop = ((x / kWallDistance) % 2) == 0;
+
+		return gapAtTop ? (y < (_height - 2)) : (y >= 2);
+	}
+};
+
+static void benchmarkAStar(Benchmark::State &state, uint32_t size, bool serpentine) {
+	GridWalkmesh walkmesh(size, size, serpentine);
+
+	const float endPos = size - 0.5f;
+
+	std::vector<uint32_t> facePath;
+	if (!walkmesh.findFacePath(0.5f, 0.5f, endPos, endPos, facePath))
+		throw Common::Exception("No path found");
+
+	state.setItemsPerIteration(facePath.size());
+
+	while (state.keepRunning()) {
+		bool found = walkmesh.findFacePath(0.5f, 0.5f, endPos, endPos, facePath);
+		Benchmark::doNotOptimize(found);
+	}
+}
+
+BENCHMARK(AStar, findPathOpen64) {
+	benchmarkAStar(state, 64, false);
+}
+
+BENCHMARK(AStar, findPathSerpentine64) {
+	benchmarkAStar(state, 64, true);
+}
+
+BENCHMARK(AStar, findPathSerpentine256) {
+	benchmarkAStar(state, 256, true);
+}
+
+BENCHMARK(Pathfinding, funnelPathSerpentine64) {
+	GridWalkmesh walkmesh(64, 64, true);
+
+	std::vector<uint32_t> facePath;
+	if (!walkmesh.findFacePath(0.5f, 0.5f, 63.5f, 63.5f, facePath))
+		throw Common::Exception("No path found");
+
+	state.setItemsPerIteration(facePath.size());
+
+	std::vector<glm::vec3> path;
+	while (state.keepRunning()) {
+		walkmesh.smoothFacePath(0.5f, 0.5f, 63.5f, 63.5f, facePath, path);
+		Benchmark::doNotOptimize(path[0]);
+	}
+}
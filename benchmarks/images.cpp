@@ -0,0 +1,65 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Micro-benchmarks for the image decoders in the Graphics namespace.
+ */
+
+#include <vector>
+
+#include "src/graphics/images/s3tc.h"
+
+#include "benchmarks/benchmark.h"
+
+typedef void (*DXTDecompressor)(byte *dest, const byte *src, size_t srcSize,
+                                uint32_t width, uint32_t height, uint32_t pitch);
+
+/** Decompress random S3TC blocks into an RGBA8 image. */
+static void benchmarkDXT(Benchmark::State &state, DXTDecompressor decompress,
+                         size_t blockSize, uint32_t width, uint32_t height) {
+
+	std::vector<byte> src((width / 4) * (height / 4) * blockSize);
+	Benchmark::fillRandom(src.data(), src.size());
+
+	std::vector<byte> dest(width * height * 4);
+
+	state.setItemsPerIteration(width * height);
+
+	while (state.keepRunning()) {
+		decompress(dest.data(), src.data(), src.size(), width, height, width * 4);
+		Benchmark::doNotOptimize(dest[0]);
+	}
+}
+
+BENCHMARK(S3TC, decompressDXT1_512) {
+	benchmarkDXT(state, &Graphics::decompressDXT1,  8, 512, 512);
+}
+
+BENCHMARK(S3TC, decompressDXT3_512) {
+	benchmarkDXT(state, &Graphics::decompressDXT3, 16, 512, 512);
+}
+
+BENCHMARK(S3TC, decompressDXT5_512) {
+	benchmarkDXT(state, &Graphics::decompressDXT5, 16, 512, 512);
+}
+
+BENCHMARK(S3TC, decompressDXT5_64) {
+	benchmarkDXT(state, &Graphics::decompressDXT5, 16,  64,  64);
+}
@@ -0,0 +1,69 @@
+# xoreos - A reimplementation of BioWare's Aurora engine
+#
+# xoreos is the legal property of its developers, whose names
+# can be found in the AUTHORS file distributed with this source
+# distribution.
+#
+# xoreos is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 3
+# of the License, or (at your option) any later version.
+#
+# xoreos is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+
+
+# Micro-benchmarks.
+#
+# They're not built by default. "make benchmarks" builds them, and
+# "make run-benchmarks" also runs them all, writing their results as
+# JSON lines to stdout.
+
+benchmark_LIBS = \
+    tests/version/libversion.la \
+    $(LDADD)
+
+noinst_HEADERS += \
+    benchmarks/benchmark.h \
+    $(EMPTY)
+
+BENCHMARKS =
+
+BENCHMARKS                       += benchmarks/bench_common
+benchmarks_bench_common_SOURCES   = benchmarks/benchmark.cpp benchmarks/common.cpp
+benchmarks_bench_common_LDADD     = src/common/libcommon.la $(benchmark_LIBS)
+benchmarks_bench_common_CXXFLAGS  = $(AM_CXXFLAGS)
+
+BENCHMARKS                       += benchmarks/bench_aurora
+benchmarks_bench_aurora_SOURCES   = benchmarks/benchmark.cpp benchmarks/aurora.cpp
+benchmarks_bench_aurora_LDADD     = src/aurora/libaurora.la src/common/libcommon.la $(benchmark_LIBS)
+benchmarks_bench_aurora_CXXFLAGS  = $(AM_CXXFLAGS)
+
+BENCHMARKS                       += benchmarks/bench_images
+benchmarks_bench_images_SOURCES   = benchmarks/benchmark.cpp benchmarks/images.cpp
+benchmarks_bench_images_LDADD     = src/graphics/libgraphics.la src/aurora/libaurora.la \
+                                    src/common/libcommon.la $(benchmark_LIBS)
+benchmarks_bench_images_CXXFLAGS  = $(AM_CXXFLAGS)
+
+BENCHMARKS                       += benchmarks/bench_engines
+benchmarks_bench_engines_SOURCES  = benchmarks/benchmark.cpp benchmarks/engines.cpp
+benchmarks_bench_engines_LDADD    = src/engines/libengines.la src/graphics/libgraphics.la \
+                                    src/aurora/libaurora.la src/common/libcommon.la \
+                                    src/events/libevents.la external/imgui/libimgui.la \
+                                    $(benchmark_LIBS)
+benchmarks_bench_engines_CXXFLAGS = $(AM_CXXFLAGS)
+
+EXTRA_PROGRAMS += $(BENCHMARKS)
+CLEANFILES     += $(BENCHMARKS)
+
+.PHONY: benchmarks run-benchmarks
+
+benchmarks: $(BENCHMARKS)
+
+run-benchmarks: benchmarks
+	@for benchmark in $(BENCHMARKS); do ./$$benchmark || exit 1; done
@@ -92,3 +92,5 @@ include external/rules.mk
 include src/rules.mk
 
 include tests/rules.mk
+
+include benchmarks/rules.mk
@@ -27,8 +27,10 @@
  */
 
 #include <cassert>
+#include <cstring>
 
 #include <utility>
+#include <map>
 
 #include "src/common/util.h"
 #include "src/common/error.h"
@@ -49,91 +51,83 @@ static const uint32_t k2DAIDTab  = MKTAG('2', 'D', 'A', '\t');
 static const uint32_t kVersion2a = MKTAG('V', '2', '.', '0');
 static const uint32_t kVersion2b = MKTAG('V', '2', '.', 'b');
 
+static const uint32_t kSnapshotID      = MKTAG('X', '2', 'D', 'A');
+static const uint32_t kVersionSnapshot = MKTAG('V', '1', '.', '0');
+
 namespace Aurora {
 
-TwoDARow::TwoDARow(TwoDAFile &parent) : _parent(&parent) {
+const uint32_t TwoDAFile::kCellEmpty;
+
+TwoDARow::TwoDARow(TwoDAFile &parent, size_t row) : _parent(&parent), _row(row) {
 }
 
 TwoDARow::~TwoDARow() {
 }
 
 const Common::UString &TwoDARow::getString(size_t column) const {
-	const Common::UString &cell = getCell(column);
-	if (cell.empty() || (cell == "****"))
+	const uint32_t cell = _parent->getCellIndex(_row, column);
+	if (cell == TwoDAFile::kCellEmpty)
 		return _parent->_defaultString;
 
-	return cell;
+	return _parent->_strings[cell];
 }
 
 const Common::UString &TwoDARow::getString(const Common::UString &column) const {
-	const Common::UString &cell = getCell(_parent->headerToColumn(column));
-	if (cell.empty() || (cell == "****"))
-		return _parent->_defaultString;
+	return getString(_parent->headerToColumn(column));
+}
 
-	return cell;
+const Common::UString &TwoDARow::getString(TwoDAColumnHandle column) const {
+	return getString(column.getColumn());
 }
 
 int32_t TwoDARow::getInt(size_t column) const {
-	const Common::UString &cell = getCell(column);
-	if (cell.empty() || (cell == "****"))
-		return _parent->_defaultInt;
-
-	return _parent->parseInt(cell);
+	return _parent->getCellInt(_row, column);
 }
 
 int32_t TwoDARow::getInt(const Common::UString &column) const {
-	const Common::UString &cell = getCell(_parent->headerToColumn(column));
-	if (cell.empty() || (cell == "****"))
-		return _parent->_defaultInt;
+	return getInt(_parent->headerToColumn(column));
+}
 
-	return _parent->parseInt(cell);
+int32_t TwoDARow::getInt(TwoDAColumnHandle column) const {
+	return getInt(column.getColumn());
 }
 
 float TwoDARow::getFloat(size_t column) const {
-	const Common::UString &cell = getCell(column);
-	if (cell.empty() || (cell == "****"))
-		return _parent->_defaultFloat;
-
-	return _parent->parseFloat(cell);
+	return _parent->getCellFloat(_row, column);
 }
 
 float TwoDARow::getFloat(const Common::UString &column) const {
-	const Common::UString &cell = getCell(_parent->headerToColumn(column));
-	if (cell.empty() || (cell == "****"))
-		return _parent->_defaultFloat;
+	return getFloat(_parent->headerToColumn(column));
+}
 
-	return _parent->parseFloat(cell);
+float TwoDARow::getFloat(TwoDAColumnHandle column) const {
+	return getFloat(column.getColumn());
 }
 
 bool TwoDARow::empty(size_t column) const {
-	const Common::UString &cell = getCell(column);
-	if (cell.empty() || (cell == "****"))
-		return true;
-
-	return false;
+	return _parent->getCellIndex(_row, column) == TwoDAFile::kCellEmpty;
 }
 
 bool TwoDARow::empty(const Common::UString &column) const {
 	return empty(_parent->headerToColumn(column));
 }
 
-static const Common::UString kEmpty;
-const Common::UString &TwoDARow::getCell(size_t n) const {
-	if (n >= _data.size())
-		return kEmpty;
-
-	return _data[n];
+bool TwoDARow::empty(TwoDAColumnHandle column) const {
+	return empty(column.getColumn());
 }
 
 
 TwoDAFile::TwoDAFile(Common::SeekableReadStream &twoda) :
-	_defaultInt(0), _defaultFloat(0.0f), _emptyRow(*this) {
+	_defaultInt(0), _defaultFloat(0.0f), _emptyRow(*this, SIZE_MAX) {
 
 	load(twoda);
 }
 
+TwoDAFile::TwoDAFile() : _defaultInt(0), _defaultFloat(0.0f), _emptyRow(*this, SIZE_MAX) {
+}
+
 TwoDAFile::TwoDAFile(const GDAFile &gda) :
-	_defaultInt(0), _defaultFloat(0.0f), _emptyRow(*this) {
+	_defaultInt(0), _defaultFloat(0.0f), _emptyRow(*this, SIZE_MAX) {
 
 	load(gda);
 }
@@ -160,6 +154,8 @@ void TwoDAFile::load(Common::SeekableReadStream &twoda) {
 		else if (_version == kVersion2b)
 			read2b(twoda); // Binary
 
+		_stringIndices.clear();
+
 		// Create the map to quickly translate headers to column indices
 		createHeaderMap();
 
@@ -170,6 +166,29 @@ void TwoDAFile::load(Common::SeekableReadStream &twoda) {
 
 }
 
+std::unique_ptr<TwoDAFile> TwoDAFile::loadSnapshot(Common::SeekableReadStream &snapshot) {
+	std::unique_ptr<TwoDAFile> twoda(new TwoDAFile);
+
+	twoda->readHeader(snapshot);
+
+	if (twoda->_id != kSnapshotID)
+		throw Common::Exception("Not a 2DA snapshot (%s)", Common::debugTag(twoda->_id).c_str());
+
+	if (twoda->_version != kVersionSnapshot)
+		throw Common::Exception("Unsupported 2DA snapshot version %s", Common::debugTag(twoda->_version).c_str());
+
+	try {
+		twoda->readSnapshot(snapshot);
+		twoda->createHeaderMap();
+
+	} catch (Common::Exception &e) {
+		e.add("Failed reading 2DA snapshot");
+		throw;
+	}
+
+	return twoda;
+}
+
 void TwoDAFile::read2a(Common::SeekableReadStream &twoda) {
 	Common::StreamTokenizer tokenize(Common::StreamTokenizer::kRuleIgnoreAll);
 
@@ -232,8 +251,10 @@ void TwoDAFile::readRows2a(Common::SeekableReadStream &twoda,
 
 	const size_t columnCount = _headers.size();
 
+	size_t rowCount = 0;
+	std::vector<Common::UString> row;
+
 	while (!twoda.eos()) {
-		std::unique_ptr<TwoDARow> row(new TwoDARow(*this));
 
 		/* Skip the first token, which is the row index, possibly indented.
 		 * The row index is implicit in the data and its use in the 2DA
@@ -243,7 +264,7 @@ void TwoDAFile::readRows2a(Common::SeekableReadStream &twoda,
 		tokenize.skipToken(twoda);
 
 		// Read all the cells in the row
-		size_t count = tokenize.getTokens(twoda, row->_data, columnCount, columnCount, "****");
+		size_t count = tokenize.getTokens(twoda, row, columnCount, columnCount, "****");
 
 		// And move to the next line
 		tokenize.nextChunk(twoda);
@@ -252,8 +273,13 @@ void TwoDAFile::readRows2a(Common::SeekableReadStream &twoda,
 		if (count == 0)
 			continue;
 
-		_rows.emplace_back(std::move(row));
+		for (std::vector<Common::UString>::const_iterator c = row.begin(); c != row.end(); ++c)
+			addCell(*c);
+
+		rowCount++;
 	}
+
+	createRows(rowCount);
 }
 
 void TwoDAFile::readHeaders2b(Common::SeekableReadStream &twoda) {
@@ -281,7 +307,7 @@ void TwoDAFile::skipRowNames2b(Common::SeekableReadStream &twoda) {
 	 */
 
 	const uint32_t rowCount = twoda.readUint32LE();
-	_rows.resize(rowCount);
+	createRows(rowCount);
 
 	Common::StreamTokenizer tokenize(Common::StreamTokenizer::kRuleHeed);
 
@@ -317,26 +343,185 @@ void TwoDAFile::readRows2b(Common::SeekableReadStream &twoda) {
 
 	const size_t dataOffset = twoda.pos();
 
-	for (size_t i = 0; i < rowCount; i++) {
-		_rows[i].reset(new TwoDARow(*this));
+	// Each offset only needs to be read once
+	std::map<uint32_t, uint32_t> offsetStrings;
 
-		_rows[i]->_data.resize(columnCount);
+	_cells.reserve(cellCount);
+	for (size_t i = 0; i < cellCount; i++) {
+		std::pair<std::map<uint32_t, uint32_t>::iterator, bool> offsetString =
+			offsetStrings.insert(std::make_pair(offsets[i], kCellEmpty));
 
-		for (size_t j = 0; j < columnCount; j++) {
-			const size_t offset = dataOffset + offsets[i * columnCount + j];
+		if (offsetString.second) {
+			twoda.seek(dataOffset + offsets[i]);
+
+			addCell(tokenize.getToken(twoda));
+			offsetString.first->second = _cells.back();
+		} else
+			_cells.push_back(offsetString.first->second);
+	}
+}
 
-			twoda.seek(offset);
+/** Read a length-prefixed string out of a 2DA snapshot. */
+static Common::UString readSnapshotString(Common::SeekableReadStream &twoda) {
+	const uint32_t length = twoda.readUint32LE();
+	if (length > (twoda.size() - twoda.pos()))
+		throw Common::Exception(Common::kReadError);
 
-			_rows[i]->_data[j] = tokenize.getToken(twoda);
-			if (_rows[i]->_data[j].empty())
-				_rows[i]->_data[j] = "****";
-		}
+	if (length == 0)
+		return Common::UString();
+
+	std::unique_ptr<char[]> data = std::make_unique<char[]>(length);
+	if (twoda.read(data.get(), length) != length)
+		throw Common::Exception(Common::kReadError);
+
+	return Common::UString(data.get(), length);
+}
+
+/** Write a length-prefixed string into a 2DA snapshot. */
+static void writeSnapshotString(Common::WriteStream &out, const Common::UString &str) {
+	const size_t length = std::strlen(str.c_str());
+
+	out.writeUint32LE((uint32_t) length);
+	out.write(str.c_str(), length);
+}
+
+void TwoDAFile::readSnapshot(Common::SeekableReadStream &twoda) {
+	/* A snapshot is just our own string pool and cells, dumped as they are.
+	 * There's nothing to tokenize and nothing to deduplicate. */
+
+	_defaultString = readSnapshotString(twoda);
+
+	_defaultInt   = parseInt(_defaultString);
+	_defaultFloat = parseFloat(_defaultString);
+
+	// Every string takes up at least its length, and every cell its index
+	const uint32_t columnCount = twoda.readUint32LE();
+	if (columnCount > ((twoda.size() - twoda.pos()) / 4))
+		throw Common::Exception(Common::kReadError);
+
+	_headers.reserve(columnCount);
+	for (uint32_t i = 0; i < columnCount; i++)
+		_headers.push_back(readSnapshotString(twoda));
+
+	const uint32_t rowCount = twoda.readUint32LE();
+
+	const uint32_t stringCount = twoda.readUint32LE();
+	if (stringCount > ((twoda.size() - twoda.pos()) / 4))
+		throw Common::Exception(Common::kReadError);
+
+	_strings.reserve(stringCount);
+	for (uint32_t i = 0; i < stringCount; i++)
+		_strings.push_back(readSnapshotString(twoda));
+
+	const uint64_t cellCount = (uint64_t) columnCount * rowCount;
+	if (cellCount > ((twoda.size() - twoda.pos()) / 4))
+		throw Common::Exception(Common::kReadError);
+
+	_cells.resize(cellCount);
+	for (size_t i = 0; i < cellCount; i++) {
+		_cells[i] = twoda.readUint32LE();
+
+		if ((_cells[i] != kCellEmpty) && (_cells[i] >= stringCount))
+			throw Common::Exception("Invalid 2DA snapshot cell %u", _cells[i]);
 	}
+
+	createRows(rowCount);
 }
 
 void TwoDAFile::createHeaderMap() {
-	for (size_t i = 0; i < _headers.size(); i++)
-		_headerMap.insert(std::make_pair(_headers[i], i));
+	_headerMap.reserve(_headers.size());
+
+	// For duplicate headers, the first one wins
+	for (size_t i = 0; i < _headers.size(); i++) {
+		const Common::IStringKey key(_headers[i]);
+
+		if (!_headerMap.contains(key))
+			_headerMap[key] = i;
+	}
+}
+
+void TwoDAFile::addCell(const Common::UString &cell) {
+	if (_strings.empty()) {
+		_strings.push_back("****");
+		_stringIndices["****"] = kCellEmpty;
+	}
+
+	if (cell.empty()) {
+		_cells.push_back(kCellEmpty);
+		return;
+	}
+
+	uint32_t &index = _stringIndices[cell];
+	if (_stringIndices.size() > _strings.size()) {
+		index = _strings.size();
+		_strings.push_back(cell);
+	}
+
+	_cells.push_back(index);
+}
+
+void TwoDAFile::createRows(size_t rowCount) {
+	_rows.resize(rowCount);
+	for (size_t i = 0; i < rowCount; i++)
+		_rows[i].reset(new TwoDARow(*this, i));
+
+	_intColumns.resize(_headers.size());
+	_floatColumns.resize(_headers.size());
+}
+
+uint32_t TwoDAFile::getCellIndex(size_t row, size_t column) const {
+	const size_t columnCount = _headers.size();
+	if ((row >= _rows.size()) || (column >= columnCount))
+		return kCellEmpty;
+
+	const size_t cell = row * columnCount + column;
+	if (cell >= _cells.size())
+		return kCellEmpty;
+
+	return _cells[cell];
+}
+
+static const Common::UString kEmpty;
+const Common::UString &TwoDAFile::getCellString(size_t row, size_t column) const {
+	const uint32_t cell = getCellIndex(row, column);
+	if (cell >= _strings.size())
+		return kEmpty;
+
+	return _strings[cell];
+}
+
+int32_t TwoDAFile::getCellInt(size_t row, size_t column) const {
+	if ((row >= _rows.size()) || (column >= _headers.size()))
+		return _defaultInt;
+
+	std::vector<int32_t> &values = _intColumns[column];
+	if (values.empty()) {
+		values.resize(_rows.size());
+
+		for (size_t i = 0; i < _rows.size(); i++) {
+			const uint32_t cell = getCellIndex(i, column);
+			values[i] = (cell == kCellEmpty) ? _defaultInt : parseInt(_strings[cell]);
+		}
+	}
+
+	return values[row];
+}
+
+float TwoDAFile::getCellFloat(size_t row, size_t column) const {
+	if ((row >= _rows.size()) || (column >= _headers.size()))
+		return _defaultFloat;
+
+	std::vector<float> &values = _floatColumns[column];
+	if (values.empty()) {
+		values.resize(_rows.size());
+
+		for (size_t i = 0; i < _rows.size(); i++) {
+			const uint32_t cell = getCellIndex(i, column);
+			values[i] = (cell == kCellEmpty) ? _defaultFloat : parseFloat(_strings[cell]);
+		}
+	}
+
+	return values[row];
 }
 
 void TwoDAFile::load(const GDAFile &gda) {
@@ -352,31 +537,30 @@ void TwoDAFile::load(const GDAFile &gda) {
 			_headers[i] = headerString ? headerString : Common::UString::format("[%u]", headers[i].hash);
 		}
 
-		_rows.resize(gda.getRowCount());
+		_cells.reserve(gda.getRowCount() * gda.getColumnCount());
 		for (size_t i = 0; i < gda.getRowCount(); i++) {
 			const GFF4Struct *row = gda.getRow(i);
 
-			_rows[i].reset(new TwoDARow(*this));
-			_rows[i]->_data.resize(gda.getColumnCount());
-
 			for (size_t j = 0; j < gda.getColumnCount(); j++) {
+				Common::UString cell;
+
 				if (row) {
 					switch (headers[j].type) {
 						case GDAFile::kTypeString:
 						case GDAFile::kTypeResource:
-							_rows[i]->_data[j] = row->getString(headers[j].field);
+							cell = row->getString(headers[j].field);
 							break;
 
 						case GDAFile::kTypeInt:
-							_rows[i]->_data[j] = Common::UString::format("%d", (int) row->getSint(headers[j].field));
+							cell = Common::UString::format("%d", (int) row->getSint(headers[j].field));
 							break;
 
 						case GDAFile::kTypeFloat:
-							_rows[i]->_data[j] = Common::UString::format("%f", row->getDouble(headers[j].field));
+							cell = Common::UString::format("%f", row->getDouble(headers[j].field));
 							break;
 
 						case GDAFile::kTypeBool:
-							_rows[i]->_data[j] = Common::UString::format("%u", (uint) row->getUint(headers[j].field));
+							cell = Common::UString::format("%u", (uint) row->getUint(headers[j].field));
 							break;
 
 						default:
@@ -384,17 +568,19 @@ void TwoDAFile::load(const GDAFile &gda) {
 					}
 				}
 
-				if (_rows[i]->_data[j].empty())
-					_rows[i]->_data[j] = "****";
-
+				addCell(cell);
 			}
 		}
 
+		createRows(gda.getRowCount());
+
 	} catch (Common::Exception &e) {
 		e.add("Failed reading GDA file");
 		throw;
 	}
 
+	_stringIndices.clear();
+
 	createHeaderMap();
 }
 
@@ -410,13 +596,42 @@ const std::vector<Common::UString> &TwoDAFile::getHeaders() const {
 	return _headers;
 }
 
+static size_t getStringsSize(const std::vector<Common::UString> &strings) {
+	size_t size = strings.capacity() * sizeof(Common::UString);
+	for (std::vector<Common::UString>::const_iterator s = strings.begin(); s != strings.end(); ++s)
+		size += std::strlen(s->c_str());
+
+	return size;
+}
+
+size_t TwoDAFile::getMemorySize() const {
+	size_t size = sizeof(TwoDAFile);
+
+	size += getStringsSize(_headers);
+	size += getStringsSize(_strings);
+
+	size += _rows.capacity() * (sizeof(std::unique_ptr<TwoDARow>) + sizeof(TwoDARow));
+	size += _cells.capacity() * sizeof(uint32_t);
+
+	for (size_t i = 0; i < _intColumns.size(); i++)
+		size += _intColumns[i].capacity() * sizeof(int32_t);
+	for (size_t i = 0; i < _floatColumns.size(); i++)
+		size += _floatColumns[i].capacity() * sizeof(float);
+
+	return size;
+}
+
 size_t TwoDAFile::headerToColumn(const Common::UString &header) const {
-	HeaderMap::const_iterator column = _headerMap.find(header);
-	if (column == _headerMap.end())
+	const size_t *column = _headerMap.find(header);
+	if (!column)
 		// No such header
 		return kFieldIDInvalid;
 
-	return column->second;
+	return *column;
+}
+
+TwoDAColumnHandle TwoDAFile::getColumnHandle(const Common::UString &header) const {
+	return TwoDAColumnHandle(headerToColumn(header));
 }
 
 const TwoDARow &TwoDAFile::getRow(size_t row) const {
@@ -461,9 +676,11 @@ void TwoDAFile::writeASCII(Common::WriteStream &out) const {
 		colLength[i + 1] = _headers[i].size();
 
 	for (size_t i = 0; i < _rows.size(); i++) {
-		for (size_t j = 0; j < _rows[i]->_data.size(); j++) {
-			const bool   needQuote = _rows[i]->_data[j].contains(' ');
-			const size_t length    = needQuote ? _rows[i]->_data[j].size() + 2 : _rows[i]->_data[j].size();
+		for (size_t j = 0; j < _headers.size(); j++) {
+			const Common::UString &cell = getCellString(i, j);
+
+			const bool   needQuote = cell.contains(' ');
+			const size_t length    = needQuote ? cell.size() + 2 : cell.size();
 
 			colLength[j + 1] = MAX<size_t>(colLength[j + 1], length);
 		}
@@ -483,14 +700,15 @@ void TwoDAFile::writeASCII(Common::WriteStream &out) const {
 	for (size_t i = 0; i < _rows.size(); i++) {
 		out.writeString(Common::UString::format("%*u", (int)colLength[0], (uint)i));
 
-		for (size_t j = 0; j < _rows[i]->_data.size(); j++) {
-			const bool needQuote = _rows[i]->_data[j].contains(' ');
+		for (size_t j = 0; j < _headers.size(); j++) {
+			const Common::UString &cell = getCellString(i, j);
+			const bool needQuote = cell.contains(' ');
 
 			Common::UString cellString;
 			if (needQuote)
-				cellString = Common::UString::format("\"%s\"", _rows[i]->_data[j].c_str());
+				cellString = Common::UString::format("\"%s\"", cell.c_str());
 			else
-				cellString = _rows[i]->_data[j];
+				cellString = cell;
 
 			out.writeString(Common::UString::format(" %-*s", (int)colLength[j + 1], cellString.c_str()));
 
@@ -620,6 +838,27 @@ bool TwoDAFile::writeBinary(const Common::UString &fileName) const {
 	return true;
 }
 
+void TwoDAFile::writeSnapshot(Common::WriteStream &out) const {
+	out.writeUint32BE(kSnapshotID);
+	out.writeUint32BE(kVersionSnapshot);
+
+	writeSnapshotString(out, _defaultString);
+
+	out.writeUint32LE((uint32_t) _headers.size());
+	for (std::vector<Common::UString>::const_iterator h = _headers.begin(); h != _headers.end(); ++h)
+		writeSnapshotString(out, *h);
+
+	out.writeUint32LE((uint32_t) _rows.size());
+
+	out.writeUint32LE((uint32_t) _strings.size());
+	for (std::vector<Common::UString>::const_iterator s = _strings.begin(); s != _strings.end(); ++s)
+		writeSnapshotString(out, *s);
+
+	const size_t cellCount = _headers.size() * _rows.size();
+	for (size_t i = 0; i < cellCount; i++)
+		out.writeUint32LE((i < _cells.size()) ? _cells[i] : kCellEmpty);
+}
+
 void TwoDAFile::writeCSV(Common::WriteStream &out) const {
 	// Write column headers
 
@@ -642,19 +881,20 @@ void TwoDAFile::writeCSV(Common::WriteStream &out) const {
 	// Write array
 
 	for (size_t i = 0; i < _rows.size(); i++) {
-		for (size_t j = 0; j < _rows[i]->_data.size(); j++) {
-			const bool needQuote = _rows[i]->_data[j].contains(',');
+		for (size_t j = 0; j < _headers.size(); j++) {
+			const Common::UString &cell = getCellString(i, j);
+			const bool needQuote = cell.contains(',');
 
 			if (needQuote)
 				out.writeByte('"');
 
-			if (_rows[i]->_data[j] != "****")
-				out.writeString(_rows[i]->_data[j]);
+			if (cell != "****")
+				out.writeString(cell);
 
 			if (needQuote)
 				out.writeByte('"');
 
-			if (j < (_rows[i]->_data.size() - 1))
+			if (j < (_headers.size() - 1))
 				out.writeByte(',');
 		}
 
@@ -27,13 +27,15 @@
 
 #include <memory>
 #include <vector>
-#include <map>
 
 #include <boost/noncopyable.hpp>
 
 #include "src/common/types.h"
 #include "src/common/ustring.h"
+#include "src/common/flathashmap.h"
+#include "src/common/istringkey.h"
 
+#include "src/aurora/types.h"
 #include "src/aurora/aurorafile.h"
 
 namespace Common {
@@ -47,6 +49,34 @@ namespace Aurora {
 class TwoDAFile;
 class GDAFile;
 
+/** A column within a 2DA file, resolved from its header.
+ *
+ *  Finding a column by its header string means a case-insensitive
+ *  lookup. Code that reads the same column over and over again can
+ *  get a handle to the column once, with TwoDAFile::getColumnHandle(),
+ *  and then read the cells with it directly.
+ *
+ *  A handle is only valid for the 2DA it was created from.
+ */
+class TwoDAColumnHandle {
+public:
+	/** Create an invalid handle. */
+	TwoDAColumnHandle() : _column(kFieldIDInvalid) { }
+
+	/** Does this handle refer to an existing column? */
+	bool isValid() const { return _column != kFieldIDInvalid; }
+
+	/** Return the index of the column. */
+	size_t getColumn() const { return _column; }
+
+private:
+	size_t _column;
+
+	explicit TwoDAColumnHandle(size_t column) : _column(column) { }
+
+	friend class TwoDAFile;
+};
+
 /** A row within a 2DA file.
  *
  *  Each row inside a 2DA file contains several cells with string
@@ -66,30 +96,36 @@ public:
 	const Common::UString &getString(size_t column) const;
 	/** Return the contents of a cell as a string. */
 	const Common::UString &getString(const Common::UString &column) const;
+	/** Return the contents of a cell as a string. */
+	const Common::UString &getString(TwoDAColumnHandle column) const;
 
 	/** Return the contents of a cell as an int. */
 	int32_t getInt(size_t column) const;
 	/** Return the contents of a cell as an int. */
 	int32_t getInt(const Common::UString &column) const;
+	/** Return the contents of a cell as an int. */
+	int32_t getInt(TwoDAColumnHandle column) const;
 
 	/** Return the contents of a cell as a float. */
 	float getFloat(size_t column) const;
 	/** Return the contents of a cell as a float. */
 	float getFloat(const Common::UString &column) const;
+	/** Return the contents of a cell as a float. */
+	float getFloat(TwoDAColumnHandle column) const;
 
 	/** Check if the cell is empty. */
 	bool empty(size_t column) const;
 	/** Check if the cell is empty. */
 	bool empty(const Common::UString &column) const;
+	/** Check if the cell is empty. */
+	bool empty(TwoDAColumnHandle column) const;
 
 private:
 	TwoDAFile *_parent; ///< The parent 2DA.
 
-	std::vector<Common::UString> _data;
-
-	TwoDARow(TwoDAFile &parent);
+	size_t _row; ///< The index of this row, or SIZE_MAX for the empty row.
 
-	const Common::UString &getCell(size_t n) const;
+	TwoDARow(TwoDAFile &parent, size_t row);
 
 	friend class TwoDAFile;
 };
@@ -117,6 +153,11 @@ private:
  *  be read and modified with a simple text editor. The binary
  *  version cannot.
  *
+ *  Internally, all unique cell strings are stored once, in a string
+ *  pool, and the cells themselves are just indices into that pool.
+ *  The int and float values of a column are parsed when the column is
+ *  first read as int or float, and then kept around.
+ *
  *  See also classes TwoDARow and TwoDARegistry.
  */
 class TwoDAFile : boost::noncopyable, public AuroraFile {
@@ -125,6 +166,13 @@ public:
 	TwoDAFile(const GDAFile &gda);
 	~TwoDAFile();
 
+	/** Read a snapshot written by writeSnapshot().
+	 *
+	 *  Snapshots are trusted more than game resources, so the normal
+	 *  constructor refuses them, and only our own cache reads them.
+	 */
+	static std::unique_ptr<TwoDAFile> loadSnapshot(Common::SeekableReadStream &snapshot);
+
 	/** Return the number of rows in the array. */
 	size_t getRowCount() const;
 
@@ -134,9 +182,15 @@ public:
 	/** Return the columns' headers. */
 	const std::vector<Common::UString> &getHeaders() const;
 
+	/** Return the approximate number of bytes the loaded array takes up in memory. */
+	size_t getMemorySize() const;
+
 	/** Translate a column header to a column index. */
 	size_t headerToColumn(const Common::UString &header) const;
 
+	/** Translate a column header to a column handle, for repeated cell lookups. */
+	TwoDAColumnHandle getColumnHandle(const Common::UString &header) const;
+
 	/** Get a row. */
 	const TwoDARow &getRow(size_t row) const;
 
@@ -154,6 +208,13 @@ public:
 	/** Write the 2DA data into an V2.b binary 2DA. */
 	bool writeBinary(const Common::UString &fileName) const;
 
+	/** Write the 2DA data into a snapshot of our own, which loads without any parsing.
+	 *
+	 *  A snapshot can only be read back with loadSnapshot(). It's only meant
+	 *  for caching, not as a file format to give to anybody else.
+	 */
+	void writeSnapshot(Common::WriteStream &out) const;
+
 	/** Write the 2DA data into a CSV stream. */
 	void writeCSV(Common::WriteStream &out) const;
 	/** Write the 2DA data into a CSV file. */
@@ -161,7 +222,13 @@ public:
 	// '---
 
 private:
-	typedef std::map<Common::UString, size_t, Common::UString::iless> HeaderMap;
+	typedef Common::FlatHashMap<Common::IStringKey, size_t, Common::IStringKey::Hash> HeaderMap;
+
+	typedef Common::FlatHashMap<Common::UString, uint32_t,
+	                            Common::hashUStringCaseSensitive, Common::equalsUStringSensitive> StringIndexMap;
+
+	/** The index of the empty cell string, "****", in the string pool. */
+	static const uint32_t kCellEmpty = 0;
 
 	Common::UString _defaultString; ///< The default string to return should a cell not exist.
 	int32_t         _defaultInt;    ///< The default int to return should a cell not exist.
@@ -173,10 +240,26 @@ private:
 	TwoDARow _emptyRow;
 	std::vector<std::unique_ptr<TwoDARow>> _rows;
 
+	/** All unique cell strings. */
+	std::vector<Common::UString> _strings;
+	/** All cells, row after row, as indices into the string pool. */
+	std::vector<uint32_t> _cells;
+
+	/** The parsed int values of all cells, column by column. Filled on first access. */
+	mutable std::vector<std::vector<int32_t>> _intColumns;
+	/** The parsed float values of all cells, column by column. Filled on first access. */
+	mutable std::vector<std::vector<float>> _floatColumns;
+
+	/** Cell string -> index into the string pool. Only used while loading. */
+	StringIndexMap _stringIndices;
+
+	TwoDAFile();
+
 	// Loading helpers
 	void load(Common::SeekableReadStream &twoda);
 	void read2a(Common::SeekableReadStream &twoda);
 	void read2b(Common::SeekableReadStream &twoda);
+	void readSnapshot(Common::SeekableReadStream &twoda);
 
 	// ASCII loading helpers
 	void readDefault2a(Common::SeekableReadStream &twoda, Common::StreamTokenizer &tokenize);
@@ -193,6 +276,16 @@ private:
 
 	void createHeaderMap();
 
+	// Cell storage helpers
+	void addCell(const Common::UString &cell);
+	void createRows(size_t rowCount);
+
+	uint32_t getCellIndex(size_t row, size_t column) const;
+	const Common::UString &getCellString(size_t row, size_t column) const;
+
+	int32_t getCellInt  (size_t row, size_t column) const;
+	float   getCellFloat(size_t row, size_t column) const;
+
 	static int32_t parseInt(const Common::UString &str);
 	static float parseFloat(const Common::UString &str);
 
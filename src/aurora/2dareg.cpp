@@ -22,8 +22,16 @@
  *  The global 2DA registry.
  */
 
+#include <algorithm>
+
 #include "src/common/error.h"
 #include "src/common/readstream.h"
+#include "src/common/writefile.h"
+#include "src/common/mappedfile.h"
+#include "src/common/filepath.h"
+#include "src/common/hash.h"
+#include "src/common/threadpool.h"
+#include "src/common/configvalue.h"
 
 #include "src/aurora/2dareg.h"
 #include "src/aurora/types.h"
@@ -33,6 +41,8 @@
 
 DECLARE_SINGLETON(Aurora::TwoDARegistry)
 
+static const Common::ConfigValue<bool> kConfigCache("twodacache", false);
+
 namespace Aurora {
 
 TwoDARegistry::TwoDARegistry() {
@@ -58,6 +68,28 @@ const TwoDAFile &TwoDARegistry::get2DA(const Common::UString &name) {
 	return *(_twodas[name] = std::move(new2DA));
 }
 
+void TwoDARegistry::warm2DAs(const std::vector<Common::UString> &names) {
+	std::vector<Common::UString> missing;
+	for (std::vector<Common::UString>::const_iterator n = names.begin(); n != names.end(); ++n)
+		if ((_twodas.find(*n) == _twodas.end()) && (std::find(missing.begin(), missing.end(), *n) == missing.end()))
+			missing.push_back(*n);
+
+	std::vector<std::unique_ptr<TwoDAFile>> loaded(missing.size());
+
+	ThreadPoolMan.parallelFor(missing.size(), [&](size_t i) {
+		try {
+			loaded[i] = load2DA(missing[i]);
+		} catch (...) {
+			// Whoever actually needs this 2DA will get the error again
+			Common::exceptionDispatcherWarning();
+		}
+	});
+
+	for (size_t i = 0; i < missing.size(); i++)
+		if (loaded[i])
+			_twodas[missing[i]] = std::move(loaded[i]);
+}
+
 const GDAFile &TwoDARegistry::getGDA(const Common::UString &name) {
 	GDAMap::const_iterator gda = _gdas.find(name);
 	if (gda != _gdas.end())
@@ -128,6 +160,11 @@ void TwoDARegistry::removeGDA(const Common::UString &name) {
 	_gdas.erase(gda);
 }
 
+void TwoDARegistry::getMemoryUsage(Common::MemoryUsageList &usage) const {
+	for (TwoDAMap::const_iterator twoda = _twodas.begin(); twoda != _twodas.end(); ++twoda)
+		usage.add(twoda->first, twoda->second->getMemorySize());
+}
+
 std::unique_ptr<TwoDAFile> TwoDARegistry::load2DA(const Common::UString &name) {
 	std::unique_ptr<Common::SeekableReadStream> twodaFile;
 	std::unique_ptr<TwoDAFile> twoda;
@@ -137,7 +174,10 @@ std::unique_ptr<TwoDAFile> TwoDARegistry::load2DA(const Common::UString &name) {
 		if (!twodaFile)
 			throw Common::Exception("No such 2DA");
 
-		twoda = std::make_unique<TwoDAFile>(*twodaFile);
+		if (kConfigCache.get())
+			twoda = loadCached2DA(*twodaFile);
+		else
+			twoda = std::make_unique<TwoDAFile>(*twodaFile);
 
 	} catch (Common::Exception &e) {
 		e.add("Failed loading 2DA \"%s\"", name.c_str());
@@ -147,6 +187,37 @@ std::unique_ptr<TwoDAFile> TwoDARegistry::load2DA(const Common::UString &name) {
 	return twoda;
 }
 
+std::unique_ptr<TwoDAFile> TwoDARegistry::loadCached2DA(Common::SeekableReadStream &twoda) {
+	const uint64_t key = Common::hashStreamFNV64(twoda);
+
+	const Common::UString fileName = Common::FilePath::getUserDataDirectory() + "/2dacache/" +
+	                                 Common::formatHash(key) + ".x2d";
+
+	if (Common::FilePath::isRegularFile(fileName)) {
+		try {
+			Common::MappedReadStream cache(fileName);
+
+			return TwoDAFile::loadSnapshot(cache);
+
+		} catch (...) {
+			// We'll parse the 2DA again and overwrite the broken file
+			Common::exceptionDispatcherWarning("Failed reading 2DA snapshot \"%s\"", fileName.c_str());
+		}
+	}
+
+	std::unique_ptr<TwoDAFile> result = std::make_unique<TwoDAFile>(twoda);
+
+	try {
+		Common::writeFileAtomically(fileName, [&result](Common::WriteStream &cache) {
+			result->writeSnapshot(cache);
+		});
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed writing 2DA snapshot \"%s\"", fileName.c_str());
+	}
+
+	return result;
+}
+
 std::unique_ptr<GDAFile> TwoDARegistry::loadGDA(const Common::UString &name) {
 	std::unique_ptr<Common::SeekableReadStream> gdaFile;
 	std::unique_ptr<GDAFile> gda;
@@ -27,9 +27,15 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "src/common/singleton.h"
 #include "src/common/ustring.h"
+#include "src/common/memoryusage.h"
+
+namespace Common {
+	class SeekableReadStream;
+}
 
 namespace Aurora {
 
@@ -56,6 +62,12 @@ class GDAFile;
  *
  *  All 2DA and GDA files are directly and automatically loaded from
  *  the ResourceManager.
+ *
+ *  When enabled with the "twodacache" config option, every loaded 2DA
+ *  is also stored as a snapshot in the user data directory, keyed by
+ *  a hash of the 2DA's data. The next time the same 2DA is loaded, the
+ *  snapshot is read out of a memory-mapped file instead of parsing the
+ *  2DA again.
  */
 class TwoDARegistry : public Common::Singleton<TwoDARegistry> {
 public:
@@ -67,6 +79,13 @@ public:
 	/** Get a certain 2DA, loading it if necessary. */
 	const TwoDAFile &get2DA(const Common::UString &name);
 
+	/** Load these 2DAs in parallel, unless they're already loaded.
+	 *
+	 *  Meant for loading the 2DAs a game is going to need anyway up front.
+	 *  2DAs that fail to load are skipped; get2DA() throws for them later.
+	 */
+	void warm2DAs(const std::vector<Common::UString> &names);
+
 	/** Get a certain GDA, loading it if necessary. */
 	const GDAFile &getGDA(const Common::UString &name);
 
@@ -85,6 +104,9 @@ public:
 	/** Remove a certain GDA from the registry. */
 	void removeGDA(const Common::UString &name);
 
+	/** Collect how much memory each loaded 2DA takes up. */
+	void getMemoryUsage(Common::MemoryUsageList &usage) const;
+
 private:
 	typedef std::map<Common::UString, std::unique_ptr<TwoDAFile>> TwoDAMap;
 	typedef std::map<Common::UString, std::unique_ptr<GDAFile>> GDAMap;
@@ -93,6 +115,7 @@ private:
 	GDAMap   _gdas;
 
 	std::unique_ptr<TwoDAFile> load2DA(const Common::UString &name);
+	std::unique_ptr<TwoDAFile> loadCached2DA(Common::SeekableReadStream &twoda);
 	std::unique_ptr<GDAFile>   loadGDA(const Common::UString &name);
 	std::unique_ptr<GDAFile>   loadMGDA(Common::UString prefix);
 };
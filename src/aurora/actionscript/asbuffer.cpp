@@ -23,6 +23,9 @@
  */
 
 #include <cassert>
+#include <cstring>
+
+#include <algorithm>
 
 #include "src/common/bitstream.h"
 #include "src/common/memreadstream.h"
@@ -87,37 +90,376 @@ enum Opcodes {
 	kActionIf              = 0x9D
 };
 
-ASBuffer::ASBuffer(Common::SeekableReadStream *as) :
-		_currentLength(0), _seeked(0), _script(as) {
+/** Marks an instruction that failed to decode. Executing it throws. */
+static const uint16_t kActionDecodeError = 0x100;
+
+/** A branch that doesn't land on the start of an instruction. */
+static const size_t kInvalidTarget = SIZE_MAX;
+
+/** A value pushed by an ActionPush. */
+struct PushValue {
+	enum Kind {
+		kKindLiteral,  ///< A value that's known while decoding.
+		kKindRegister, ///< The contents of a register.
+		kKindConstant  ///< An entry of the current constant pool.
+	};
+
+	Kind kind;
+	/** The register number or constant pool index. */
+	uint16_t index;
+	/** The value of a literal. */
+	Variable value;
+
+	PushValue(Kind k, uint16_t i, const Variable &v = Variable()) : kind(k), index(i), value(v) {
+	}
+};
+
+/** A function defined by an ActionDefineFunction or ActionDefineFunction2. */
+struct FunctionDefinition {
+	Common::UString name;
+
+	std::vector<uint8_t> parameterIds;
+	uint8_t registerCount;
+
+	bool preloadThisFlag;
+	bool preloadSuperFlag;
+	bool preloadRootFlag;
+	bool preloadGlobalFlag;
+
+	/** The decoded body of the function. */
+	ProgramPtr program;
+
+	FunctionDefinition() : registerCount(0), preloadThisFlag(false), preloadSuperFlag(false),
+		preloadRootFlag(false), preloadGlobalFlag(false) {
+	}
+};
+
+struct ASBuffer::Instruction {
+	uint16_t opcode;
+
+	/** A register number, or the flags of an ActionGetURL2. */
+	uint16_t operand;
+
+	/** The instruction index a branch leads to, or kInvalidTarget. */
+	size_t target;
+
+	/** The values pushed by an ActionPush. */
+	std::vector<PushValue> values;
+	/** The constants defined by an ActionConstantPool. */
+	ConstantPoolPtr constants;
+	/** The function defined by an ActionDefineFunction or ActionDefineFunction2. */
+	std::shared_ptr<const FunctionDefinition> function;
+
+	/** Why this instruction failed to decode. */
+	Common::UString error;
+
+	Instruction(uint16_t op = 0) : opcode(op), operand(0), target(kInvalidTarget) {
+	}
+};
+
+struct Program {
+	std::vector<ASBuffer::Instruction> instructions;
+};
+
+static Common::UString readString(Common::SeekableReadStream &script) {
+	Common::UString string;
+
+	uint32_t character = script.readChar();
+	while (character != 0) {
+		string += character;
+		character = script.readChar();
+	}
+	return string;
+}
+
+static ProgramPtr decodeProgram(Common::SeekableReadStream &script);
+
+static void decodePush(Common::SeekableReadStream &script, size_t end, ASBuffer::Instruction &instruction) {
+	while (script.pos() < end) {
+		const byte type = script.readByte();
+
+		switch (type) {
+			case 0:
+				instruction.values.push_back(PushValue(PushValue::kKindLiteral, 0, readString(script)));
+				break;
+
+			case 1:
+				instruction.values.push_back(PushValue(PushValue::kKindLiteral, 0,
+				                                       static_cast<double>(script.readIEEEFloatLE())));
+				break;
+
+			case 2:
+				instruction.values.push_back(PushValue(PushValue::kKindLiteral, 0, Variable::Null()));
+				break;
+
+			case 3:
+				instruction.values.push_back(PushValue(PushValue::kKindLiteral, 0, Variable()));
+				break;
+
+			case 4:
+				instruction.values.push_back(PushValue(PushValue::kKindRegister, script.readByte()));
+				break;
+
+			case 5:
+				instruction.values.push_back(PushValue(PushValue::kKindLiteral, 0, script.readByte() != 0));
+				break;
+
+			case 6: {
+				// Double values are weird encoded.
+				uint32_t value[2];
+				value[1] = script.readUint32LE();
+				value[0] = script.readUint32LE();
+
+				double doubleValue;
+				memcpy(&doubleValue, value, 8);
+
+				instruction.values.push_back(PushValue(PushValue::kKindLiteral, 0, doubleValue));
+				break;
+			}
+
+			case 7:
+				instruction.values.push_back(PushValue(PushValue::kKindLiteral, 0,
+				                                       static_cast<int>(script.readSint32LE())));
+				break;
+
+			// constant pool index 8bit
+			case 8:
+				instruction.values.push_back(PushValue(PushValue::kKindConstant, script.readByte()));
+				break;
+
+			// constant pool index 16bit
+			case 9:
+				instruction.values.push_back(PushValue(PushValue::kKindConstant, script.readUint16LE()));
+				break;
+
+			default:
+				throw Common::Exception("invalid type byte in actionscript");
+		}
+	}
+}
+
+static void decodeConstantPool(Common::SeekableReadStream &script, ASBuffer::Instruction &instruction) {
+	const uint16_t count = script.readUint16LE();
+
+	std::shared_ptr<std::vector<Common::UString>> constants = std::make_shared<std::vector<Common::UString>>(count);
+	for (size_t i = 0; i < count; ++i)
+		(*constants)[i] = readString(script);
+
+	instruction.constants = constants;
+}
+
+static size_t decodeFunctionBody(Common::SeekableReadStream &script, FunctionDefinition &function) {
+	const uint16_t codeSize = script.readUint16LE();
+
+	std::unique_ptr<Common::SeekableReadStream> body(script.readStream(codeSize));
+	function.program = decodeProgram(*body);
+
+	return codeSize;
+}
+
+static size_t decodeDefineFunction2(Common::SeekableReadStream &script, ASBuffer::Instruction &instruction) {
+	std::shared_ptr<FunctionDefinition> function = std::make_shared<FunctionDefinition>();
+
+	function->name = readString(script);
+	const uint16_t numParams = script.readUint16LE();
+	function->registerCount = script.readByte();
+
+	Common::BitStream8MSB bitstream(&script);
+
+	const bool preloadParentFlag = bitstream.getBit() != 0;
+	function->preloadRootFlag = bitstream.getBit() != 0;
+	const bool suppressSuperFlag = bitstream.getBit() != 0;
+	function->preloadSuperFlag = bitstream.getBit() != 0;
+	const bool suppressArgumentsFlag = bitstream.getBit() != 0;
+	const bool preloadArgumentsFlag = bitstream.getBit() != 0;
+	const bool suppressThisFlag = bitstream.getBit() != 0;
+	function->preloadThisFlag = bitstream.getBit() != 0;
+
+	unsigned int reserved = bitstream.getBits(7);
+	assert(reserved == 0);
+
+	function->preloadGlobalFlag = bitstream.getBit() != 0;
+
+	function->parameterIds.resize(numParams);
+	for (size_t i = 0; i < numParams; ++i) {
+		function->parameterIds[i] = script.readByte();
+		readString(script);
+	}
+
+	const size_t codeSize = decodeFunctionBody(script, *function);
+
+	debugC(
+			kDebugActionScript,
+			2,
+			"Decoded actionDefineFunction2 \"%s\" %u %u %s %s %s %s %s %s %s %s %s",
+			function->name.c_str(),
+			numParams,
+			function->registerCount,
+			preloadParentFlag ? "true" : "false",
+			function->preloadRootFlag ? "true" : "false",
+			suppressSuperFlag ? "true" : "false",
+			function->preloadSuperFlag ? "true" : "false",
+			suppressArgumentsFlag ? "true" : "false",
+			preloadArgumentsFlag ? "true" : "false",
+			suppressThisFlag ? "true" : "false",
+			function->preloadThisFlag ? "true" : "false",
+			function->preloadGlobalFlag ? "true" : "false"
+	);
+
+	instruction.function = function;
+	return codeSize;
+}
+
+static size_t decodeDefineFunction(Common::SeekableReadStream &script, ASBuffer::Instruction &instruction) {
+	std::shared_ptr<FunctionDefinition> function = std::make_shared<FunctionDefinition>();
+
+	function->name = readString(script);
+
+	const uint16_t numParams = script.readUint16LE();
+	for (size_t i = 0; i < numParams; ++i)
+		readString(script);
+
+	const size_t codeSize = decodeFunctionBody(script, *function);
+
+	instruction.function = function;
+	return codeSize;
+}
+
+static void decodeGetURL2(Common::SeekableReadStream &script, ASBuffer::Instruction &instruction) {
+	Common::BitStream8MSB bitstream(&script);
+
+	instruction.operand = bitstream.getBits(8);
+	assert(((instruction.operand >> 2) & 0x0F) == 0);
+}
+
+/** Decode one instruction, returning the byte offset of its branch destination, if any. */
+static ptrdiff_t decodeInstruction(Common::SeekableReadStream &script, ASBuffer::Instruction &instruction,
+                                   bool &isBranch) {
+
+	const byte opcode = script.readByte();
+
+	size_t length = 0;
+	if (opcode >= 0x80)
+		length = script.readUint16LE();
+
+	instruction.opcode = opcode;
+
+	const size_t startPos = script.pos();
+
+	// Function definitions are followed by their body, which isn't part of the tag length
+	size_t extra = 0;
+
+	ptrdiff_t branch = 0;
+	isBranch = false;
+
+	switch (opcode) {
+		case kActionStoreRegister:   instruction.operand = script.readByte(); break;
+		case kActionConstantPool:    decodeConstantPool(script, instruction); break;
+		case kActionDefineFunction2: extra = decodeDefineFunction2(script, instruction); break;
+		case kActionPush:            decodePush(script, startPos + length, instruction); break;
+		case kActionGetURL2:         decodeGetURL2(script, instruction); break;
+		case kActionDefineFunction:  extra = decodeDefineFunction(script, instruction); break;
+
+		case kActionJump:
+		case kActionIf:
+			branch   = script.readSint16LE();
+			isBranch = true;
+			break;
+
+		default:
+			script.skip(length);
+			break;
+	}
+
+	if (script.pos() - startPos != length + extra)
+		throw Common::Exception("Invalid tag");
+
+	return branch;
+}
+
+static ProgramPtr decodeProgram(Common::SeekableReadStream &script) {
+	std::shared_ptr<Program> program = std::make_shared<Program>();
+	std::vector<ASBuffer::Instruction> &instructions = program->instructions;
+
+	// Byte offset of every instruction, plus the end of the decoded code
+	std::vector<size_t> offsets;
+
+	// Byte offsets the branches lead to, by instruction index
+	std::vector<std::pair<size_t, ptrdiff_t>> branches;
+
+	while (script.pos() < script.size()) {
+		offsets.push_back(script.pos());
+		instructions.push_back(ASBuffer::Instruction());
+
+		try {
+			bool isBranch = false;
+			const ptrdiff_t branch = decodeInstruction(script, instructions.back(), isBranch);
+
+			if (isBranch)
+				branches.push_back(std::make_pair(instructions.size() - 1, script.pos() + branch));
+
+		} catch (Common::Exception &e) {
+			// Only fail once execution actually reaches the broken code
+			instructions.back() = ASBuffer::Instruction(kActionDecodeError);
+			instructions.back().error = e.what();
+			break;
+		}
+	}
+
+	offsets.push_back(script.pos());
 
+	for (std::vector<std::pair<size_t, ptrdiff_t>>::const_iterator b = branches.begin(); b != branches.end(); ++b) {
+		if (b->second < 0)
+			continue;
+
+		std::vector<size_t>::const_iterator target =
+			std::lower_bound(offsets.begin(), offsets.end(), static_cast<size_t>(b->second));
+
+		if ((target != offsets.end()) && (*target == static_cast<size_t>(b->second)))
+			instructions[b->first].target = target - offsets.begin();
+	}
+
+	return program;
+}
+
+ASBuffer::ASBuffer(Common::SeekableReadStream *as) : _script(as) {
 	assert(as);
 }
 
+ASBuffer::ASBuffer(const ProgramPtr &program) : _script(0), _program(program) {
+	assert(program);
+}
+
 void ASBuffer::run(AVM &avm) {
-	_script->seek(0);
+	if (!_program) {
+		_script->seek(0);
+		_program = decodeProgram(*_script);
+		_script = 0;
+	}
+
 	execute(avm);
 }
 
 void ASBuffer::setConstantPool(std::vector<Common::UString> constantPool) {
+	_constants = std::make_shared<const std::vector<Common::UString>>(std::move(constantPool));
+}
+
+void ASBuffer::setConstantPool(const ConstantPoolPtr &constantPool) {
 	_constants = constantPool;
 }
 
 void ASBuffer::execute(AVM &avm) {
-	byte opcode;
-	debugC(kDebugActionScript, 1, "--- Start Actionscript ---");
-	do {
-		_seeked = 0;
-		opcode = _script->readByte();
+	const std::vector<Instruction> &instructions = _program->instructions;
 
-		size_t length = 0;
-		if (opcode >= 0x80)
-			length = _script->readUint16LE();
+	debugC(kDebugActionScript, 1, "--- Start Actionscript ---");
 
-		_currentLength = length;
+	size_t ip = 0;
+	while (ip < instructions.size()) {
+		const Instruction &instruction = instructions[ip];
 
-		size_t startPos = _script->pos();
+		bool branched = false;
 
-		switch (opcode) {
+		switch (instruction.opcode) {
 			case kActionStop:            actionStop(avm); break;
 			case kActionToggleQuality:   actionToggleQuality(); break;
 			case kActionSubtract:        actionSubtract(); break;
@@ -149,23 +491,32 @@ void ASBuffer::execute(AVM &avm) {
 			case kActionGreater:         actionGreater(); break;
 			case kActionExtends:         actionExtends(); break;
 			case kActionGetURL:          actionGetURL(avm); break;
-			case kActionStoreRegister:   actionStoreRegister(avm); break;
-			case kActionDefineFunction2: actionDefineFunction2(); break;
-			case kActionConstantPool:    actionConstantPool(); break;
-			case kActionPush:            actionPush(avm); break;
-			case kActionJump:            actionJump(); break;
-			case kActionGetURL2:         actionGetURL2(avm); break;
-			case kActionDefineFunction:  actionDefineFunction(); break;
-			case kActionIf:              actionIf(); break;
+			case kActionStoreRegister:   actionStoreRegister(avm, instruction); break;
+			case kActionDefineFunction2: actionDefineFunction2(instruction); break;
+			case kActionConstantPool:    actionConstantPool(instruction); break;
+			case kActionPush:            actionPush(avm, instruction); break;
+			case kActionJump:            branched = actionJump(instruction); break;
+			case kActionGetURL2:         actionGetURL2(avm, instruction); break;
+			case kActionDefineFunction:  actionDefineFunction(instruction); break;
+			case kActionIf:              branched = actionIf(instruction); break;
+			case kActionDecodeError:
+				throw Common::Exception("%s", instruction.error.c_str());
 			default:
-				_script->seek(length, Common::SeekableReadStream::kOriginCurrent);
-				if (opcode != 0)
+				if (instruction.opcode != 0)
 					warning("Unknown opcode");
 		}
 
-		if (_script->pos() - startPos != static_cast<size_t>(length + _seeked))
-			throw Common::Exception("Invalid tag");
-	} while (opcode != 0 && _script->pos() != _script->size() && avm.getReturnValue().isUndefined());
+		if (instruction.opcode == 0 || !avm.getReturnValue().isUndefined())
+			break;
+
+		if (branched) {
+			if (instruction.target == kInvalidTarget)
+				throw Common::Exception("Invalid branch target");
+
+			ip = instruction.target;
+		} else
+			++ip;
+	}
 
 	debugC(kDebugActionScript, 1, "--- End Actionscript ---");
 }
@@ -611,198 +962,75 @@ void ASBuffer::actionGetURL(AVM &avm) {
 	debugC(kDebugActionScript, 1, "actionGetURL \"%s\" \"%s\"", urlString.c_str(), targetString.c_str());
 }
 
-void ASBuffer::actionStoreRegister(AVM &avm) {
-	byte registerNumber = _script->readByte();
+void ASBuffer::actionStoreRegister(AVM &avm, const Instruction &instruction) {
+	const byte registerNumber = instruction.operand;
 	avm.storeRegister(_stack.top(), registerNumber);
 
 	debugC(kDebugActionScript, 1, "actionStoreRegister %i", registerNumber);
 }
 
-void ASBuffer::actionConstantPool() {
-	uint16_t count = _script->readUint16LE();
-	_constants.resize(count);
-	for (int i = 0; i < count; ++i) {
-		Common::UString constant = readString();
-		_constants[i] = constant;
-	}
+void ASBuffer::actionConstantPool(const Instruction &instruction) {
+	_constants = instruction.constants;
 
 	debugC(kDebugActionScript, 1, "actionConstantPool");
 }
 
-void ASBuffer::actionDefineFunction2() {
-	Common::UString functionName = readString();
-	int numParams = _script->readUint16LE();
-	int registerCount = _script->readByte();
-
-	Common::BitStream8MSB bitstream(_script);
-
-	bool preloadParentFlag = bitstream.getBit() != 0;
-	bool preloadRootFlag = bitstream.getBit() != 0;
-	bool suppressSuperFlag = bitstream.getBit() != 0;
-	bool preloadSuperFlag = bitstream.getBit() != 0;
-	bool suppressArgumentsFlag = bitstream.getBit() != 0;
-	bool preloadArgumentsFlag = bitstream.getBit() != 0;
-	bool suppressThisFlag = bitstream.getBit() != 0;
-	bool preloadThisFlag = bitstream.getBit() != 0;
-
-	unsigned int reserved = bitstream.getBits(7);
-	assert(reserved == 0);
-
-	bool preloadGlobalFlag = bitstream.getBit() != 0;
-
-	std::vector<uint8_t> parameterIds(numParams);
-	for (int i = 0; i < numParams; ++i) {
-		parameterIds[i] = _script->readByte();
-		readString();
-	}
-
-	unsigned short codeSize = _script->readUint16LE();
-	_seeked = codeSize;
+void ASBuffer::actionDefineFunction2(const Instruction &instruction) {
+	const FunctionDefinition &function = *instruction.function;
 
 	_stack.push(
 			ObjectPtr(
 					new ScriptedFunction(
-							_script->readStream(codeSize),
+							function.program,
 							_constants,
-							parameterIds,
-							registerCount,
-							preloadThisFlag,
-							preloadSuperFlag,
-							preloadRootFlag,
-							preloadGlobalFlag
+							function.parameterIds,
+							function.registerCount,
+							function.preloadThisFlag,
+							function.preloadSuperFlag,
+							function.preloadRootFlag,
+							function.preloadGlobalFlag
 					)
 			)
 	);
 
-	debugC(
-			kDebugActionScript,
-			1,
-			"actionDefineFunction2 \"%s\" %d %d %s %s %s %s %s %s %s %s %s",
-			functionName.c_str(),
-			numParams,
-			registerCount,
-			preloadParentFlag ? "true" : "false",
-			preloadRootFlag ? "true" : "false",
-			suppressSuperFlag ? "true" : "false",
-			preloadSuperFlag ? "true" : "false",
-			suppressArgumentsFlag ? "true" : "false",
-			preloadArgumentsFlag ? "true" : "false",
-			suppressThisFlag ? "true" : "false",
-			preloadThisFlag ? "true" : "false",
-			preloadGlobalFlag ? "true" : "false"
-	);
+	debugC(kDebugActionScript, 1, "actionDefineFunction2 \"%s\"", function.name.c_str());
 }
 
-void ASBuffer::actionPush(AVM &avm) {
-	unsigned short length = _currentLength;
-
-	while (length != 0) {
-		byte type = _script->readByte();
-		length -= 1;
-
-		switch (type) {
-			case 0: {
-				Common::UString string = readString();
-				_stack.push(string);
-				debugC(kDebugActionScript, 1, "actionPush \"%s\"", string.c_str());
-				length -= string.size() + 1;
+void ASBuffer::actionPush(AVM &avm, const Instruction &instruction) {
+	for (std::vector<PushValue>::const_iterator v = instruction.values.begin(); v != instruction.values.end(); ++v) {
+		switch (v->kind) {
+			case PushValue::kKindLiteral:
+				_stack.push(v->value);
+				debugC(kDebugActionScript, 1, "actionPush literal");
 				break;
-			}
-			case 1: {
-				float floatValue = _script->readIEEEFloatLE();
-				_stack.push(floatValue);
-				debugC(kDebugActionScript, 1, "actionPush %f", floatValue);
-				length -= 4;
-				break;
-			}
-			case 2: {
-				// null
-				debugC(kDebugActionScript, 1, "actionPush null");
-				_stack.push(Variable::Null());
-				break;
-			}
-			case 3: {
-				// undefined
-				debugC(kDebugActionScript, 1, "actionPush undefined");
-				_stack.push(Variable());
-				break;
-			}
-			case 4: {
-				byte registerNumber = _script->readByte();
-				debugC(kDebugActionScript, 1, "actionPush register%d", registerNumber);
-				_stack.push(avm.getRegister(registerNumber));
-				length -= 1;
-				break;
-			}
-			case 5: {
-				bool boolValue = (_script->readByte() != 0);
-				debugC(kDebugActionScript, 1, "actionPush %s", boolValue ? "true" : "false");
-				_stack.push(boolValue);
-				length -= 1;
+
+			case PushValue::kKindRegister:
+				_stack.push(avm.getRegister(v->index));
+				debugC(kDebugActionScript, 1, "actionPush register%d", v->index);
 				break;
-			}
-			case 6: {
-				// Double values are weird encoded.
-				uint32_t value[2];
-				value[1] = _script->readUint32LE();
-				value[0] = _script->readUint32LE();
 
-				double doubleValue;
-				memcpy(&doubleValue, value, 8);
+			case PushValue::kKindConstant:
+				if (!_constants || (v->index >= _constants->size()))
+					throw Common::Exception("actionPush: invalid constant pool index %u", v->index);
 
-				_stack.push(doubleValue);
-				debugC(kDebugActionScript, 1, "actionPush %f", doubleValue);
-				length -= 8;
-				break;
-			}
-			case 7: {
-				int intValue = _script->readSint32LE();
-				_stack.push(intValue);
-				debugC(kDebugActionScript, 1, "actionPush %d", intValue);
-				length -= 4;
-				break;
-			}
-				// constant pool index 8bit
-			case 8: {
-				byte byteValue = _script->readByte();
-				_stack.push(_constants[byteValue]);
-				debugC(kDebugActionScript, 1, "actionPush \"%s\"", _constants[byteValue].c_str());
-				length -= 1;
-				break;
-			}
-				// constant pool index 16bit
-			case 9: {
-				unsigned short shortValue = _script->readUint16LE();
-				_stack.push(_constants[shortValue]);
-				debugC(kDebugActionScript, 1, "actionPush \"%s\"", _constants[shortValue].c_str());
-				length -= 2;
+				_stack.push((*_constants)[v->index]);
+				debugC(kDebugActionScript, 1, "actionPush \"%s\"", (*_constants)[v->index].c_str());
 				break;
-			}
-			default:
-				throw Common::Exception("invalid type byte in actionscript");
 		}
 	}
 }
 
-void ASBuffer::actionJump() {
-	int16_t offset = _script->readSint16LE();
+bool ASBuffer::actionJump(const Instruction &UNUSED(instruction)) {
+	debugC(kDebugActionScript, 1, "actionJump");
 
-	_script->seek(offset, Common::SeekableReadStream::kOriginCurrent);
-	_seeked = offset;
-
-	debugC(kDebugActionScript, 1, "actionJump %d", offset);
+	return true;
 }
 
-void ASBuffer::actionGetURL2(AVM &avm) {
-	Common::BitStream8MSB bitstream(_script);
-
-	byte sendVarsMethodId = bitstream.getBits(2);
+void ASBuffer::actionGetURL2(AVM &avm, const Instruction &instruction) {
+	const byte sendVarsMethodId = (instruction.operand >> 6) & 0x03;
 
-	byte reserved = bitstream.getBits(4);
-	assert(reserved == 0);
-
-	byte loadTargetFlag = bitstream.getBit();
-	byte loadVariablesFlag = bitstream.getBit();
+	const byte loadTargetFlag = (instruction.operand >> 1) & 0x01;
+	const byte loadVariablesFlag = instruction.operand & 0x01;
 
 	Common::UString sendVarsMethod;
 	switch (sendVarsMethodId) {
@@ -833,50 +1061,28 @@ void ASBuffer::actionGetURL2(AVM &avm) {
 	);
 }
 
-void ASBuffer::actionDefineFunction() {
-	Common::UString functionName = readString();
-
-	uint16_t numParams = _script->readUint16LE();
-	for (int i = 0; i < numParams; ++i) {
-		Common::UString param = readString();
-	}
-
-	uint16_t codeSize = _script->readUint16LE();
-	_stack.push(ObjectPtr(new ScriptedFunction(_script->readStream(codeSize), _constants, std::vector<uint8_t>(), 0, false, false, false, false)));
+void ASBuffer::actionDefineFunction(const Instruction &instruction) {
+	const FunctionDefinition &function = *instruction.function;
 
-	_seeked = codeSize;
+	_stack.push(ObjectPtr(new ScriptedFunction(function.program, _constants, std::vector<uint8_t>(), 0, false, false, false, false)));
 
 	debugC(
 			kDebugActionScript,
 			1,
 			"actionDefineFunction %s",
-			functionName.c_str()
+			function.name.c_str()
 	);
 }
 
-void ASBuffer::actionIf() {
-	short branchOffset = _script->readSint16LE();
-
+bool ASBuffer::actionIf(const Instruction &UNUSED(instruction)) {
 	Variable variable = _stack.top();
 	_stack.pop();
 
-	if (variable.asBoolean()) {
-		_script->seek(branchOffset, Common::SeekableReadStream::kOriginCurrent);
-		_seeked = branchOffset;
-	}
+	const bool branch = variable.asBoolean();
 
-	debugC(kDebugActionScript, 1, "actionIf %i", branchOffset);
-}
+	debugC(kDebugActionScript, 1, "actionIf %s", branch ? "true" : "false");
 
-Common::UString ASBuffer::readString() {
-	Common::UString string;
-
-	uint32_t character = _script->readChar();
-	while (character != 0) {
-		string += character;
-		character = _script->readChar();
-	}
-	return string;
+	return branch;
 }
 
 } // End of namespace ActionScript
@@ -28,6 +28,7 @@
 #include <cstddef>
 
 #include <stack>
+#include <vector>
 #include <memory>
 
 #include <boost/any.hpp>
@@ -43,13 +44,31 @@ namespace ActionScript {
 
 class Variable;
 
+/** A constant pool, as defined by an ActionConstantPool. */
+typedef std::shared_ptr<const std::vector<Common::UString>> ConstantPoolPtr;
+
+/** A decoded sequence of actionscript byte code. */
+struct Program;
+typedef std::shared_ptr<const Program> ProgramPtr;
+
+/** An actionscript byte code interpreter.
+ *
+ *  The byte code is decoded into a list of instructions the first time it
+ *  is run. Later runs, and every function defined by the code, execute the
+ *  decoded instructions without reading the byte code again.
+ */
 class ASBuffer {
 public:
+	/** A decoded instruction. */
+	struct Instruction;
+
 	ASBuffer(Common::SeekableReadStream *as);
+	ASBuffer(const ProgramPtr &program);
 
 	void run(AVM &avm);
 
 	void setConstantPool(std::vector<Common::UString> constantPool);
+	void setConstantPool(const ConstantPoolPtr &constantPool);
 
 private:
 	void execute(AVM &avm);
@@ -85,29 +104,26 @@ private:
 	void actionGreater();
 	void actionExtends();
 	void actionGetURL(AVM &avm);
-	void actionStoreRegister(AVM &avm);
-	void actionConstantPool();
-	void actionDefineFunction2();
-	void actionPush(AVM &avm);
-	void actionJump();
-	void actionGetURL2(AVM &avm);
-	void actionDefineFunction();
-	void actionIf();
-
-	// Utility methods and variables
-	Common::UString readString();
-
-	size_t _currentLength;
-	ptrdiff_t _seeked;
+	void actionStoreRegister(AVM &avm, const Instruction &instruction);
+	void actionConstantPool(const Instruction &instruction);
+	void actionDefineFunction2(const Instruction &instruction);
+	void actionPush(AVM &avm, const Instruction &instruction);
+	bool actionJump(const Instruction &instruction);
+	void actionGetURL2(AVM &avm, const Instruction &instruction);
+	void actionDefineFunction(const Instruction &instruction);
+	bool actionIf(const Instruction &instruction);
 
 	// Constant pool
-	std::vector<Common::UString> _constants;
+	ConstantPoolPtr _constants;
 
 	// Execution stack
 	std::stack<Variable> _stack;
 
-	// The script data
+	// The script data, until it has been decoded
 	Common::SeekableReadStream *_script;
+
+	// The decoded script
+	ProgramPtr _program;
 };
 
 } // End of namespace ActionScript
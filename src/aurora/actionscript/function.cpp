@@ -62,19 +62,15 @@ bool Function::getPreloadGlobalFlag() {
 	return _preloadGlobalFlag;
 }
 
-ScriptedFunction::ScriptedFunction(Common::SeekableReadStream *as, std::vector<Common::UString> constants,
+ScriptedFunction::ScriptedFunction(const ProgramPtr &program, const ConstantPoolPtr &constants,
                                    std::vector<uint8_t> parameterIds, uint8_t numRegisters,
                                    bool preloadThisFlag, bool preloadSuperFlag, bool preloadRootFlag,
                                    bool preloadGlobalFlag) :
 	Function(parameterIds, numRegisters, preloadThisFlag, preloadSuperFlag, preloadRootFlag, preloadGlobalFlag),
-	_stream(as), _buffer(as) {
+	_buffer(program) {
 	_buffer.setConstantPool(constants);
 }
 
-ScriptedFunction::~ScriptedFunction() {
-	delete _stream;
-}
-
 Variable ScriptedFunction::operator()(AVM &avm) {
 	_buffer.run(avm);
 	return avm.getReturnValue();
@@ -76,8 +76,8 @@ private:
 class ScriptedFunction : public Function {
 public:
 	ScriptedFunction(
-			Common::SeekableReadStream *as,
-			std::vector<Common::UString> constantPool,
+			const ProgramPtr &program,
+			const ConstantPoolPtr &constantPool,
 			std::vector<uint8_t> parameterIds,
 			uint8_t numRegisters,
 			bool preloadThisFlag,
@@ -85,12 +85,10 @@ public:
 			bool preloadRootFlag,
 			bool preloadGlobalFlag
 	);
-	~ScriptedFunction();
 
 	Variable operator()(AVM &avm);
 
 private:
-	Common::SeekableReadStream *_stream;
 	ASBuffer _buffer;
 };
 
@@ -34,6 +34,8 @@ namespace Aurora {
 
 namespace ActionScript {
 
+static const Common::UString kConstructor("constructor");
+
 Object::Object() {
 }
 
@@ -46,18 +48,21 @@ Object::~Object() {
 
 std::vector<Common::UString> Object::getSlots() const {
 	std::vector<Common::UString> slots;
-	for (std::map<Common::UString, Variable>::const_iterator iter = _members.begin(); iter != _members.end() ; iter++) {
+	for (MemberMap::const_iterator iter = _members.begin(); iter != _members.end() ; iter++) {
 		slots.push_back(iter->first);
 	}
 	return slots;
 }
 
 bool Object::hasMember(const Common::UString &id) const {
-	std::map<Common::UString, Variable>::const_iterator iter = _members.find("constructor");
-	if (iter != _members.end())
-		if (iter->second.asObject()->hasMember(id))
-			return true;
-	return _members.find(id) != _members.end();
+	if (_members.find(id) != _members.end())
+		return true;
+
+	MemberMap::const_iterator constructor = _members.find(kConstructor);
+	if (constructor != _members.end())
+		return constructor->second.asObject()->hasMember(id);
+
+	return false;
 }
 
 Variable Object::getMember(const Variable &id) {
@@ -66,15 +71,20 @@ Variable Object::getMember(const Variable &id) {
 
 	const Common::UString idString = id.asString();
 
-	std::map<Common::UString, Variable>::iterator iter = _members.find("constructor");
-	if (hasMember(idString) && iter != _members.end() && iter->second.asObject()->hasMember(idString))
-		return iter->second.asObject()->getMember(id);
-	else if (_members.find(idString) != _members.end())
-		return _members[idString];
-	else {
-		_members.insert(std::make_pair(idString, ObjectPtr(new Object)));
-		return _members[idString];
+	// Members of the constructor take precedence
+	MemberMap::iterator constructor = _members.find(kConstructor);
+	if (constructor != _members.end()) {
+		ObjectPtr constructorObject = constructor->second.asObject();
+		if (constructorObject->hasMember(idString))
+			return constructorObject->getMember(id);
 	}
+
+	// Find our own member, or the place to create it as an empty object
+	MemberMap::iterator iter = _members.lower_bound(idString);
+	if ((iter == _members.end()) || (iter->first != idString))
+		iter = _members.emplace_hint(iter, idString, ObjectPtr(new Object));
+
+	return iter->second;
 }
 
 void Object::setMember(const Variable &id, const Variable &value) {
@@ -61,7 +61,9 @@ public:
 	Variable call(const Common::UString &function, AVM &avm, const std::vector<Variable> &arguments = std::vector<Variable>());
 
 private:
-	std::map<Common::UString, Variable> _members;
+	typedef std::map<Common::UString, Variable> MemberMap;
+
+	MemberMap _members;
 };
 
 } // End of namespace ActionScript
@@ -41,6 +41,14 @@ uint32_t Archive::getResourceSize(uint32_t UNUSED(index)) const {
 	return 0xFFFFFFFF;
 }
 
+bool Archive::isResourceCompressed(uint32_t UNUSED(index)) const {
+	return false;
+}
+
+bool Archive::isThreadSafe() const {
+	return false;
+}
+
 Common::HashAlgo Archive::getNameHashAlgo() const {
 	return Common::kHashNone;
 }
@@ -73,13 +73,19 @@ public:
 	 */
 	virtual Common::SeekableReadStream *getResource(uint32_t index, bool tryNoCopy = false) const = 0;
 
+	/** Does getting this resource need costly decompression or decryption? */
+	virtual bool isResourceCompressed(uint32_t index) const;
+
+	/** Can getResource() be called from several threads at once? */
+	virtual bool isThreadSafe() const;
+
 	/** Return with which algorithm the name is hashed. */
 	virtual Common::HashAlgo getNameHashAlgo() const;
 
 	/** Return the index of the resource matching the hash, or 0xFFFFFFFF if not found. */
 	uint32_t findResource(uint64_t hash) const;
 	/** Return the index of the resource matching the name and type, or 0xFFFFFFFF if not found. */
-	uint32_t findResource(const Common::UString &name, FileType type) const;
+	virtual uint32_t findResource(const Common::UString &name, FileType type) const;
 };
 
 } // End of namespace Aurora
@@ -32,6 +32,7 @@
 #include "src/common/strutil.h"
 #include "src/common/error.h"
 #include "src/common/memreadstream.h"
+#include "src/common/mappedfile.h"
 
 #include "src/aurora/biffile.h"
 #include "src/aurora/keyfile.h"
@@ -141,12 +142,15 @@ uint32_t BIFFile::getResourceSize(uint32_t index) const {
 Common::SeekableReadStream *BIFFile::getResource(uint32_t index, bool tryNoCopy) const {
 	const IResource &res = getIResource(index);
 
-	if (tryNoCopy)
-		return new Common::SeekableSubReadStream(_bif.get(), res.offset, res.offset + res.size);
+	if (tryNoCopy) {
+		Common::SeekableReadStream *view = Common::MappedReadStream::viewStream(*_bif, res.offset, res.size);
+		if (view)
+			return view;
 
-	_bif->seek(res.offset);
+		return new Common::SeekableSubReadStream(_bif.get(), res.offset, res.offset + res.size);
+	}
 
-	return _bif->readStream(res.size);
+	return Common::MappedReadStream::readView(*_bif, res.offset, res.size);
 }
 
 } // End of namespace Aurora
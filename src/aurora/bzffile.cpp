@@ -142,6 +142,11 @@ uint32_t BZFFile::getResourceSize(uint32_t index) const {
 	return getIResource(index).size;
 }
 
+bool BZFFile::isResourceCompressed(uint32_t UNUSED(index)) const {
+	// All resources within a BZF are LZMA-compressed
+	return true;
+}
+
 Common::SeekableReadStream *BZFFile::getResource(uint32_t index, bool UNUSED(tryNoCopy)) const {
 	const IResource &res = getIResource(index);
 
@@ -67,6 +67,9 @@ public:
 	/** Return a stream of the resource's contents. */
 	Common::SeekableReadStream *getResource(uint32_t index, bool tryNoCopy = false) const;
 
+	/** Does getting this resource need costly decompression or decryption? */
+	bool isResourceCompressed(uint32_t index) const;
+
 	/** Merge information from the KEY into the data file.
 	 *
 	 *  Without this step, this data file archive does not contain any
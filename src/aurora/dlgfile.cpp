@@ -33,6 +33,7 @@
 #include "src/common/readstream.h"
 
 #include "src/aurora/gff3file.h"
+#include "src/aurora/resman.h"
 #include "src/aurora/dlgfile.h"
 
 #include "src/aurora/nwscript/types.h"
@@ -44,19 +45,19 @@ static const uint32_t kDLGID = MKTAG('D', 'L', 'G', ' ');
 namespace Aurora {
 
 DLGFile::DLGFile(Common::SeekableReadStream *dlg, NWScript::Object *owner, bool repairNWNPremium) :
-	_owner(owner), _ended(true) {
+	_owner(owner), _firstStart(0), _startCount(0), _currentEntry(kInvalidLine),
+	_step(0), _scriptGeneration(0), _ended(true) {
 
 	assert(dlg);
 
 	GFF3File gff(dlg, kDLGID, repairNWNPremium);
 
 	load(gff.getTopLevel());
-
-	_currentEntry = _entriesNPC.end();
 }
 
 DLGFile::DLGFile(const Common::UString &dlg, NWScript::Object *owner, bool repairNWNPremium) :
-	_owner(owner), _ended(true) {
+	_owner(owner), _firstStart(0), _startCount(0), _currentEntry(kInvalidLine),
+	_step(0), _scriptGeneration(0), _ended(true) {
 
 	GFF3File gff(dlg, kFileTypeDLG, kDLGID, repairNWNPremium);
 
@@ -86,14 +87,17 @@ bool DLGFile::hasEnded() const {
 void DLGFile::startConversation() {
 	abortConversation();
 
-	_currentEntry = _entriesNPC.end();
+	_currentEntry = kInvalidLine;
 	_currentReplies.clear();
 
-	if (evaluateEntries(_entriesStart, _currentEntry)) {
-		evaluateReplies(_currentEntry->replies, _currentReplies);
+	nextStep();
+
+	if (evaluateEntries(_firstStart, _startCount)) {
+		const Entry &entry = _entriesNPC[_currentEntry];
 
-		runScript(_currentEntry->script1);
-		runScript(_currentEntry->script2);
+		evaluateReplies(entry.firstReply, entry.replyCount);
+
+		runEntryScripts(entry);
 	}
 
 	_ended = false;
@@ -105,7 +109,7 @@ void DLGFile::abortConversation() {
 
 	runScript(_convAbort);
 
-	_currentEntry = _entriesNPC.end();
+	_currentEntry = kInvalidLine;
 	_currentReplies.clear();
 
 	_ended = true;
@@ -115,7 +119,7 @@ void DLGFile::pickReply(uint32_t id) {
 	if (_ended || (id == kInvalidLine))
 		return;
 
-	if ((id == kEndLine) || ((_currentEntry == _entriesNPC.end()))) {
+	if ((id == kEndLine) || (_currentEntry == kInvalidLine)) {
 		runScript(_convEnd);
 
 		_ended = true;
@@ -124,17 +128,21 @@ void DLGFile::pickReply(uint32_t id) {
 
 	assert(id < _entriesPC.size());
 
-	_currentEntry = _entriesPC.begin() + id;
+	const Entry &reply = _entriesPC[id];
+
 	_currentReplies.clear();
 
-	runScript(_currentEntry->script1);
-	runScript(_currentEntry->script2);
+	runEntryScripts(reply);
 
-	if (evaluateEntries(_currentEntry->replies, _currentEntry)) {
-		evaluateReplies(_currentEntry->replies, _currentReplies);
+	// The reply's scripts might have changed what the conditions see
+	nextStep();
 
-		runScript(_currentEntry->script1);
-		runScript(_currentEntry->script2);
+	if (evaluateEntries(reply.firstReply, reply.replyCount)) {
+		const Entry &entry = _entriesNPC[_currentEntry];
+
+		evaluateReplies(entry.firstReply, entry.replyCount);
+
+		runEntryScripts(entry);
 	} else {
 		runScript(_convEnd);
 		_ended = true;
@@ -142,10 +150,10 @@ void DLGFile::pickReply(uint32_t id) {
 }
 
 const DLGFile::Line *DLGFile::getCurrentEntry() const {
-	if (_currentEntry == _entriesNPC.end())
+	if (_currentEntry == kInvalidLine)
 		return 0;
 
-	return &_currentEntry->line;
+	return &_entriesNPC[_currentEntry].line;
 }
 
 const std::vector<const DLGFile::Line *> &DLGFile::getCurrentReplies() const {
@@ -153,29 +161,32 @@ const std::vector<const DLGFile::Line *> &DLGFile::getCurrentReplies() const {
 }
 
 const DLGFile::Line *DLGFile::getOneLiner() const {
-	for (std::vector<Link>::const_iterator e = _entriesStart.begin();
-	     e != _entriesStart.end(); ++e) {
-
-		std::vector<Entry>::const_iterator line = _entriesNPC.begin() + e->index;
-		if (!line->replies.empty() || !runScript(line->script1) || !runScript(line->script2))
+	for (uint32_t i = _firstStart; i < (_firstStart + _startCount); i++) {
+		const Entry &line = _entriesNPC[_links[i].index];
+		if ((line.replyCount > 0) || !runScript(line.script1) || !runScript(line.script2))
 			continue;
 
-		return &line->line;
+		return &line.line;
 	}
 
 	return 0;
 }
 
 void DLGFile::load(const GFF3Struct &dlg) {
+	ScriptMap scripts;
+
 	// General properties
 
 	_delayEntry = dlg.getUint("DelayEntry", 0);
 	_delayReply = dlg.getUint("DelayReply", 0);
 
-	_convAbort.name = dlg.getString("EndConverAbort");
-	_convAbort.negate = false;
-	_convEnd.name   = dlg.getString("EndConversation");
-	_convEnd.negate = false;
+	Script convAbort, convEnd;
+
+	convAbort.name = dlg.getString("EndConverAbort");
+	convEnd.name   = dlg.getString("EndConversation");
+
+	_convAbort = addScript(convAbort, scripts);
+	_convEnd   = addScript(convEnd  , scripts);
 
 	_noZoomIn = !dlg.getBool("PreventZoomIn", true);
 
@@ -184,24 +195,27 @@ void DLGFile::load(const GFF3Struct &dlg) {
 	const GFF3List &entries = dlg.getList("EntryList");
 	_entriesNPC.reserve(entries.size());
 
-	readEntries(entries, _entriesNPC, false);
+	readEntries(entries, _entriesNPC, false, scripts);
 
 	// PC lines ("replies")
 
 	const GFF3List &replies = dlg.getList("ReplyList");
 	_entriesPC.reserve(replies.size());
 
-	readEntries(replies, _entriesPC, true);
+	readEntries(replies, _entriesPC, true, scripts);
 
 	// Starting lines (greetings)
 
 	const GFF3List &starters = dlg.getList("StartingList");
-	_entriesStart.reserve(starters.size());
 
-	readLinks(starters, _entriesStart);
+	_firstStart = _links.size();
+	readLinks(starters, scripts);
+	_startCount = _links.size() - _firstStart;
+
+	_conditions.resize(_scripts.size());
 }
 
-void DLGFile::readEntries(const GFF3List &list, std::vector<Entry> &entries, bool isPC) {
+void DLGFile::readEntries(const GFF3List &list, std::vector<Entry> &entries, bool isPC, ScriptMap &scripts) {
 	for (GFF3List::const_iterator e = list.begin(); e != list.end(); ++e) {
 		entries.push_back(Entry());
 
@@ -211,31 +225,37 @@ void DLGFile::readEntries(const GFF3List &list, std::vector<Entry> &entries, boo
 
 		entry.line.id = entries.size() - 1;
 
-		readEntry(**e, entry);
+		readEntry(**e, entry, scripts);
 	}
 }
 
-void DLGFile::readLinks(const GFF3List &list, std::vector<Link> &links) {
+void DLGFile::readLinks(const GFF3List &list, ScriptMap &scripts) {
 	for (GFF3List::const_iterator l = list.begin(); l != list.end(); ++l) {
-		links.push_back(Link());
+		Link link;
+		readLink(**l, link, scripts);
 
-		readLink(**l, links.back());
+		_links.push_back(link);
 	}
 }
 
-void DLGFile::readEntry(const GFF3Struct &gff, Entry &entry) {
-	entry.script1.name = gff.getString("Script");
-	entry.script2.name = gff.getString("Script2");
+void DLGFile::readEntry(const GFF3Struct &gff, Entry &entry, ScriptMap &scripts) {
+	Script script1, script2;
+
+	script1.name = gff.getString("Script");
+	script2.name = gff.getString("Script2");
 
-	entry.script1.parameters.resize(5);
-	entry.script2.parameters.resize(5);
+	script1.parameters.resize(5);
+	script2.parameters.resize(5);
 	for (int i = 0; i < 5; ++i) {
-		entry.script1.parameters[i] = gff.getSint("ActionParam" + Common::composeString(i + 1));
-		entry.script2.parameters[i] = gff.getSint("ActionParam" + Common::composeString(i + 1) + "b");
+		script1.parameters[i] = gff.getSint("ActionParam" + Common::composeString(i + 1));
+		script2.parameters[i] = gff.getSint("ActionParam" + Common::composeString(i + 1) + "b");
 	}
 
-	entry.script1.parameterString = gff.getString("ActionParamStrA");
-	entry.script2.parameterString = gff.getString("ActionParamStrB");
+	script1.parameterString = gff.getString("ActionParamStrA");
+	script2.parameterString = gff.getString("ActionParamStrB");
+
+	entry.script1 = addScript(script1, scripts);
+	entry.script2 = addScript(script2, scripts);
 
 	entry.line.speaker = gff.getString("Speaker");
 
@@ -257,94 +277,200 @@ void DLGFile::readEntry(const GFF3Struct &gff, Entry &entry) {
 	else if (gff.hasField("EntriesList"))
 		replies = &gff.getList("EntriesList");
 
-	if (replies) {
-		entry.replies.reserve(replies->size());
+	// The links of each entry are stored in one consecutive block
+	entry.firstReply = _links.size();
 
-		readLinks(*replies, entry.replies);
-	}
+	if (replies)
+		readLinks(*replies, scripts);
 
-	entry.line.isEnd = entry.replies.empty();
+	entry.replyCount = _links.size() - entry.firstReply;
+
+	entry.line.isEnd = entry.replyCount == 0;
 }
 
-void DLGFile::readLink(const GFF3Struct &gff, Link &link) {
+void DLGFile::readLink(const GFF3Struct &gff, Link &link, ScriptMap &scripts) {
+	Script active1, active2;
+
 	link.index  = gff.getUint("Index", 0xFFFFFFFF);
-	link.active1.name = gff.getString("Active");
-	link.active2.name = gff.getString("Active2");
+	active1.name = gff.getString("Active");
+	active2.name = gff.getString("Active2");
 
-	link.active1.parameters.resize(5);
-	link.active2.parameters.resize(5);
+	active1.parameters.resize(5);
+	active2.parameters.resize(5);
 	for (int i = 0; i < 5; ++i) {
-		link.active1.parameters[i] = gff.getSint("Param" + Common::composeString(i + 1));
-		link.active2.parameters[i] = gff.getSint("Param" + Common::composeString(i + 1) + "b");
+		active1.parameters[i] = gff.getSint("Param" + Common::composeString(i + 1));
+		active2.parameters[i] = gff.getSint("Param" + Common::composeString(i + 1) + "b");
 	}
 
-	link.active1.parameterString = gff.getString("ParamStrA");
-	link.active2.parameterString = gff.getString("ParamStrB");
+	active1.parameterString = gff.getString("ParamStrA");
+	active2.parameterString = gff.getString("ParamStrB");
+
+	link.active1.script = addScript(active1, scripts);
+	link.active2.script = addScript(active2, scripts);
 
 	link.active1.negate = gff.getBool("Not", false);
 	link.active2.negate = gff.getBool("Not2", false);
 }
 
-bool DLGFile::evaluateEntries(const std::vector<Link> &entries,
-                              std::vector<Entry>::iterator &active) {
+uint32_t DLGFile::addScript(Script &script, ScriptMap &scripts) {
+	if (script.name.empty())
+		return kNoScript;
+
+	Common::UString key = script.name;
+	for (std::vector<int>::const_iterator p = script.parameters.begin(); p != script.parameters.end(); ++p)
+		key += "," + Common::composeString(*p);
+
+	key += "\n" + script.parameterString;
+
+	std::pair<ScriptMap::iterator, bool> result =
+		scripts.insert(std::make_pair(key, static_cast<uint32_t>(_scripts.size())));
+
+	if (result.second)
+		_scripts.push_back(std::move(script));
+
+	return result.first->second;
+}
 
-	active = _entriesNPC.end();
+void DLGFile::nextStep() {
+	_step++;
 
-	for (std::vector<Link>::const_iterator e = entries.begin(); e != entries.end(); ++e) {
-		if (!runScript(e->active1) || !runScript(e->active2))
+	// Newly indexed resources might have replaced the scripts
+	const uint32_t generation = ResMan.getGeneration();
+	if (generation == _scriptGeneration)
+		return;
+
+	_conditions.clear();
+	_conditions.resize(_scripts.size());
+
+	_scriptGeneration = generation;
+}
+
+bool DLGFile::evaluateEntries(uint32_t first, uint32_t count) {
+	_currentEntry = kInvalidLine;
+
+	for (uint32_t i = first; i < (first + count); i++) {
+		const Link &link = _links[i];
+		if (!evaluateLink(link))
 			continue;
 
-		assert(e->index < _entriesNPC.size());
+		assert(link.index < _entriesNPC.size());
 
-		active = _entriesNPC.begin() + e->index;
+		_currentEntry = link.index;
 		break;
 	}
 
-	return active != _entriesNPC.end();
+	return _currentEntry != kInvalidLine;
 }
 
-bool DLGFile::evaluateReplies(const std::vector<Link> &entries,
-                              std::vector<const Line *> &active) {
-
-	active.clear();
+void DLGFile::evaluateReplies(uint32_t first, uint32_t count) {
+	_currentReplies.clear();
 
-	active.reserve(entries.size());
-	for (std::vector<Link>::const_iterator e = entries.begin(); e != entries.end(); ++e) {
-		if (!runScript(e->active1) || !runScript(e->active2))
+	_currentReplies.reserve(count);
+	for (uint32_t i = first; i < (first + count); i++) {
+		const Link &link = _links[i];
+		if (!evaluateLink(link))
 			continue;
 
-		assert(e->index < _entriesPC.size());
+		assert(link.index < _entriesPC.size());
 
-		active.push_back(&_entriesPC[e->index].line);
+		_currentReplies.push_back(&_entriesPC[link.index].line);
 	}
+}
 
-	return !active.empty();
+bool DLGFile::evaluateLink(const Link &link) {
+	return evaluateCondition(link.active1) && evaluateCondition(link.active2);
 }
 
-bool DLGFile::runScript(const Script &script) const {
-	if (script.name.empty())
+bool DLGFile::evaluateCondition(const Condition &condition) {
+	if (condition.script == kNoScript)
+		return true;
+
+	Script &script = _scripts[condition.script];
+	if (script.step != _step) {
+		script.result = runCondition(condition.script);
+		script.step   = _step;
+	}
+
+	switch (script.result) {
+		case kResultTrue:
+			return !condition.negate;
+
+		case kResultFalse:
+			return condition.negate;
+
+		case kResultPass:
+			return true;
+
+		default:
+			break;
+	}
+
+	return false;
+}
+
+void DLGFile::runEntryScripts(const Entry &entry) {
+	runScript(entry.script1);
+	runScript(entry.script2);
+}
+
+bool DLGFile::runScript(uint32_t script) const {
+	if (script == kNoScript)
 		return true;
 
+	const Script &s = _scripts[script];
+
 	try {
-		NWScript::NCSFile ncs(script.name);
+		NWScript::NCSFile ncs(s.name);
 
-		ncs.setParameters(script.parameters);
-		ncs.setParameterString(script.parameterString);
+		ncs.setParameters(s.parameters);
+		ncs.setParameterString(s.parameterString);
 
 		const NWScript::Variable &retVal = ncs.run(_owner);
 		if (retVal.getType() == NWScript::kTypeInt)
-			return script.negate ? (retVal.getInt() == 0) : (retVal.getInt() != 0);
+			return retVal.getInt() != 0;
 		if (retVal.getType() == NWScript::kTypeFloat)
-			return script.negate ? (retVal.getFloat() == 0.0f) : (retVal.getFloat() != 0.0f);
+			return retVal.getFloat() != 0.0f;
 
 		return true;
 
 	} catch (...) {
-		Common::exceptionDispatcherWarning("Failed running dialog script \"%s\"", script.name.c_str());
+		Common::exceptionDispatcherWarning("Failed running dialog script \"%s\"", s.name.c_str());
 		return false;
 	}
 
 	return true;
 }
 
+DLGFile::ScriptResult DLGFile::runCondition(uint32_t script) {
+	const Script &s = _scripts[script];
+	std::unique_ptr<NWScript::NCSFile> &ncs = _conditions[script];
+
+	try {
+		// Keep the script around, so that later steps don't need to load it again
+		if (!ncs) {
+			ncs = std::make_unique<NWScript::NCSFile>(s.name);
+
+			ncs->setParameters(s.parameters);
+			ncs->setParameterString(s.parameterString);
+		}
+
+		// Every run starts with a fresh environment, like with a newly loaded script
+		ncs->getEnvironment().clearVariables();
+
+		const NWScript::Variable &retVal = ncs->run(_owner);
+		if (retVal.getType() == NWScript::kTypeInt)
+			return (retVal.getInt() != 0) ? kResultTrue : kResultFalse;
+		if (retVal.getType() == NWScript::kTypeFloat)
+			return (retVal.getFloat() != 0.0f) ? kResultTrue : kResultFalse;
+
+		return kResultPass;
+
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed running dialog script \"%s\"", s.name.c_str());
+		return kResultFail;
+	}
+
+	return kResultPass;
+}
+
 } // End of namespace Aurora
@@ -26,6 +26,8 @@
 #define AURORA_DLGFILE_H
 
 #include <vector>
+#include <map>
+#include <memory>
 
 #include <boost/noncopyable.hpp>
 
@@ -43,6 +45,7 @@ namespace Aurora {
 
 namespace NWScript {
 	class Object;
+	class NCSFile;
 }
 
 // TODO: KotOR:
@@ -106,67 +109,118 @@ public:
 	const Line *getOneLiner() const;
 
 private:
-	/** A script used by an entry or a link. */
+	static const uint32_t kNoScript = 0xFFFFFFFF;
+
+	/** The outcome of running a condition script, before negation. */
+	enum ScriptResult {
+		kResultTrue,    ///< Returned a non-zero number.
+		kResultFalse,   ///< Returned zero.
+		kResultPass,    ///< Returned something other than a number.
+		kResultFail     ///< Failed to run.
+	};
+
+	/** A script used by entries or links.
+	 *
+	 *  Every distinct combination of script and parameters is only stored once.
+	 */
 	struct Script {
 		Common::UString name;            ///< Name of the script.
 		std::vector<int> parameters;     ///< Parameter to call the script with.
 		Common::UString parameterString; ///< String parameter to call the script with.
-		bool negate;                     ///< Negation of the scripts result.
+
+		uint32_t step;       ///< The dialog step the result is from.
+		ScriptResult result; ///< The result of the last run as a condition.
+
+		Script() : step(0), result(kResultFail) { }
+	};
+
+	/** A condition script of a link. */
+	struct Condition {
+		uint32_t script; ///< Index into the scripts, or kNoScript.
+		bool negate;     ///< Negation of the scripts result.
 	};
 
 	/** A link to a reply. */
 	struct Link {
-		uint32_t index;          ///< Index into the entries/replies.
-		Script active1, active2; ///< Scripts that determine if this link is active.
+		uint32_t index;              ///< Index into the entries/replies.
+		Condition active1, active2;  ///< Scripts that determine if this link is active.
 	};
 
 	/** A dialog entry. */
 	struct Entry {
 		bool isPC; ///< Is this a PC or NPC line?
 
-		Script script1, script2; ///< Scripts to run when speaking this entry.
+		uint32_t script1, script2; ///< Scripts to run when speaking this entry.
 
 		Line line; ///< The line's contents.
 
-		std::vector<Link> replies; ///< Reply lines.
+		uint32_t firstReply; ///< Index of the first reply link.
+		uint32_t replyCount; ///< Number of reply links.
 	};
 
+	/** Maps the script name and parameters onto the index of the script. */
+	typedef std::map<Common::UString, uint32_t> ScriptMap;
+
 
 	NWScript::Object *_owner;
 
 	uint32_t _delayEntry; ///< Number of seconds to wait before showing each entry.
 	uint32_t _delayReply; ///< Number of seconds to wait before showing each reply.
 
-	Script _convAbort; ///< Script to run when the conversation was aborted.
-	Script _convEnd;   ///< Script to run when the conversation ended normally.
+	uint32_t _convAbort; ///< Script to run when the conversation was aborted.
+	uint32_t _convEnd;   ///< Script to run when the conversation ended normally.
 
 	bool _noZoomIn; ///< Starting the conversation does not zoom the camera onto the speaker.
 
+	std::vector<Script> _scripts; ///< All scripts used in this conversation.
+	std::vector<Link>   _links;   ///< All links, the ones of each entry in one block.
+
+	/** The loaded condition scripts, kept to be run again in later steps. */
+	std::vector< std::unique_ptr<NWScript::NCSFile> > _conditions;
+
 	std::vector<Entry> _entriesNPC; ///< NPC dialog lines ("entries").
 	std::vector<Entry> _entriesPC;  ///< PC dialog lines ("replies").
 
-	std::vector<Link> _entriesStart; ///< NPC starting lines (greetings).
+	uint32_t _firstStart; ///< Index of the first NPC starting line (greeting) link.
+	uint32_t _startCount; ///< Number of NPC starting line links.
 
-	std::vector<Entry>::iterator _currentEntry; ///< The current entry.
-	std::vector<const Line *> _currentReplies;  ///< The current replies.
+	uint32_t _currentEntry;                    ///< Index of the current NPC entry.
+	std::vector<const Line *> _currentReplies; ///< The current replies.
+
+	/** The current dialog step. Condition results are only reused within one step. */
+	uint32_t _step;
+	/** The resource generation the condition scripts were loaded in. */
+	uint32_t _scriptGeneration;
 
 	bool _ended; ///< Has the conversation ended?
 
 
 	void load(const GFF3Struct &dlg);
 
-	void readEntries(const GFF3List &list, std::vector<Entry> &entries, bool isPC);
-	void readLinks(const GFF3List &list, std::vector<Link> &links);
+	void readEntries(const GFF3List &list, std::vector<Entry> &entries, bool isPC, ScriptMap &scripts);
+	void readLinks(const GFF3List &list, ScriptMap &scripts);
+
+	void readEntry(const GFF3Struct &gff, Entry &entry, ScriptMap &scripts);
+	void readLink(const GFF3Struct &gff, Link &link, ScriptMap &scripts);
+
+	/** Add a script, returning the index of an identical one if it already exists. */
+	uint32_t addScript(Script &script, ScriptMap &scripts);
+
+	/** Start a new dialog step, forgetting all condition results. */
+	void nextStep();
+
+	bool evaluateEntries(uint32_t first, uint32_t count);
+	void evaluateReplies(uint32_t first, uint32_t count);
 
-	void readEntry(const GFF3Struct &gff, Entry &entry);
-	void readLink(const GFF3Struct &gff, Link &link);
+	/** Is this link active? */
+	bool evaluateLink(const Link &link);
+	/** Evaluate a condition, reusing the result from earlier in this step. */
+	bool evaluateCondition(const Condition &condition);
 
-	bool evaluateEntries(const std::vector<Link> &entries,
-	                     std::vector<Entry>::iterator &active);
-	bool evaluateReplies(const std::vector<Link> &entries,
-	                     std::vector<const Line *> &active);
+	bool runScript(uint32_t script) const;
+	ScriptResult runCondition(uint32_t script);
 
-	bool runScript(const Script &script) const;
+	void runEntryScripts(const Entry &entry);
 };
 
 } // End of namespace Aurora
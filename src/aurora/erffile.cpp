@@ -29,6 +29,7 @@
 #include <cassert>
 
 #include "src/common/memreadstream.h"
+#include "src/common/mappedfile.h"
 #include "src/common/readfile.h"
 #include "src/common/util.h"
 #include "src/common/strutil.h"
@@ -200,20 +201,21 @@ void ERFFile::verifyPasswordDigest() {
 			passwordNumber >>= 8;
 		}
 
+		_blowfish = std::make_unique<Common::Blowfish>(_password);
 		return;
 	}
 
 	if (_header.encryption == kEncryptionBlowfishDA2) {
+		_blowfish = std::make_unique<Common::Blowfish>(_password);
+
 		// The digest is the MD5 sum of an [0-255] array encrypted by the password
 		byte buffer[256];
 		for (size_t i = 0; i < sizeof(buffer); i++)
 			buffer[i] = i;
 
-		Common::MemoryReadStream bufferStream(buffer);
-		std::unique_ptr<Common::SeekableReadStream>
-			bufferEncrypted(Common::encryptBlowfishEBC(bufferStream, _password));
+		_blowfish->encryptECB(buffer, buffer, sizeof(buffer));
 
-		if (!Common::compareMD5Digest(*bufferEncrypted, _header.passwordDigest))
+		if (!Common::compareMD5Digest(buffer, sizeof(buffer), _header.passwordDigest))
 			throw Common::Exception("Password digest does not match");
 
 		return;
@@ -709,20 +711,30 @@ uint32_t ERFFile::getResourceSize(uint32_t index) const {
 	return getIResource(index).unpackedSize;
 }
 
+bool ERFFile::isResourceCompressed(uint32_t UNUSED(index)) const {
+	return (_header.encryption != kEncryptionNone) || (_header.compression != kCompressionNone);
+}
+
 Common::SeekableReadStream *ERFFile::getResource(uint32_t index, bool tryNoCopy) const {
 	const IResource &res = getIResource(index);
 
-	if (tryNoCopy && (_header.encryption == kEncryptionNone) && (_header.compression == kCompressionNone))
-		return new Common::SeekableSubReadStream(_erf.get(), res.offset, res.offset + res.packedSize);
-
-	_erf->seek(res.offset);
+	// Read, directly out of the memory mapping if we can
+	Common::MemoryReadStream *stream = Common::MappedReadStream::viewStream(*_erf, res.offset, res.packedSize);
+	if (!stream) {
+		if (tryNoCopy && (_header.encryption == kEncryptionNone) && (_header.compression == kCompressionNone))
+			return new Common::SeekableSubReadStream(_erf.get(), res.offset, res.offset + res.packedSize);
 
-	// Read
-	Common::MemoryReadStream *stream = _erf->readStream(res.packedSize);
+		_erf->seek(res.offset);
+		stream = _erf->readStream(res.packedSize);
+	}
 
 	// Decrypt
-	if (_header.encryption != kEncryptionNone)
-		stream = decrypt(stream, _header.encryption, _password);
+	if (_header.encryption != kEncryptionNone) {
+		assert(_blowfish);
+
+		std::unique_ptr<Common::MemoryReadStream> cryptStream(stream);
+		stream = Common::decryptBlowfishEBC(*cryptStream, *_blowfish);
+	}
 
 	// Decompress
 	return decompress(stream, res.unpackedSize);
@@ -38,6 +38,7 @@
 
 namespace Common {
 	class SeekableReadStream;
+	class Blowfish;
 }
 
 namespace Aurora {
@@ -129,6 +130,9 @@ public:
 	/** Return a stream of the resource's contents. */
 	Common::SeekableReadStream *getResource(uint32_t index, bool tryNoCopy = false) const;
 
+	/** Does getting this resource need costly decompression or decryption? */
+	bool isResourceCompressed(uint32_t index) const;
+
 	/** Return the year the ERF was built. */
 	uint32_t getBuildYear() const;
 	/** Return the day of year the ERF was built. */
@@ -221,6 +225,8 @@ private:
 
 	/** The password we were given, if any. */
 	std::vector<byte> _password;
+	/** The Blowfish cipher for the password, expanded once for all resources. */
+	std::unique_ptr<Common::Blowfish> _blowfish;
 
 	void load();
 
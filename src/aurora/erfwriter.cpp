@@ -26,6 +26,7 @@
 
 #include <memory>
 
+#include "src/common/error.h"
 #include "src/common/deflate.h"
 #include "src/common/memwritestream.h"
 
@@ -55,20 +56,48 @@ ERFWriter::ERFWriter(uint32_t id, uint32_t fileCount, Common::SeekableWriteStrea
 		default:
 			throw Common::Exception("Unsupported ERF version");
 	}
+
+	_tables.resize(_offsetToResourceData - _tablesOffset, 0);
 }
 
-void ERFWriter::add(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream) {
-	if (_currentFileCount == _fileCount)
-		throw Common::Exception("More files added than expected");
+ERFWriter::~ERFWriter() {
+	try {
+		flush();
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed to finish writing the ERF archive");
+
+		// The compression tasks still reference their entries
+		for (const auto &entry : _pending) {
+			try {
+				ThreadPoolMan.wait(entry->task);
+			} catch (...) {
+			}
+		}
+	}
+}
 
+static FileType getERFFileType(FileType resType) {
 	// Files without a type are put into ERF archives as the generic RES type
 	if (resType == kFileTypeNone)
-		resType = kFileTypeRES;
+		return kFileTypeRES;
 
 	/* Files with types above this line are not found in ERF archives.
 	 * They have no real numerical type ID usable for ERF archives. */
 	if (resType >= kFileTypeMAXArchive)
-		resType = kFileTypeRES;
+		return kFileTypeRES;
+
+	return resType;
+}
+
+void ERFWriter::add(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream) {
+	if ((_currentFileCount + _pending.size()) == _fileCount)
+		throw Common::Exception("More files added than expected");
+
+	// Keep the entries in the order they were added
+	while (!_pending.empty())
+		writePending();
+
+	resType = getERFFileType(resType);
 
 	switch (_version) {
 		case kERFVersion10:
@@ -83,6 +112,77 @@ void ERFWriter::add(const Common::UString &resRef, FileType resType, Common::See
 			addV22(resRef, resType, stream);
 			break;
 	}
+
+	finishEntry();
+}
+
+void ERFWriter::addAsync(const Common::UString &resRef, FileType resType, Common::SeekableReadStream *stream) {
+	std::unique_ptr<Common::SeekableReadStream> data(stream);
+
+	// Only compression is worth spreading over threads
+	if ((_version != kERFVersion22) || (_compression == kCompressionNone)) {
+		add(resRef, resType, *data);
+		return;
+	}
+
+	if ((_currentFileCount + _pending.size()) == _fileCount)
+		throw Common::Exception("More files added than expected");
+
+	_pending.emplace_back(std::make_unique<PendingEntry>());
+
+	PendingEntry &entry = *_pending.back();
+	entry.resRef  = resRef;
+	entry.resType = getERFFileType(resType);
+	entry.data    = std::move(data);
+
+	entry.task = ThreadPoolMan.submit([this, &entry]() {
+		entry.compressed.reset(compress(*entry.data));
+	});
+
+	// Bound the memory used by entries waiting to be written
+	const size_t maxPending = 2 * ThreadPoolMan.getThreadCount();
+	while (_pending.size() > maxPending)
+		writePending();
+
+	if ((_currentFileCount + _pending.size()) == _fileCount)
+		flush();
+}
+
+void ERFWriter::flush() {
+	while (!_pending.empty())
+		writePending();
+
+	if (_tablesDirty)
+		writeTables();
+}
+
+void ERFWriter::writePending() {
+	std::unique_ptr<PendingEntry> entry = std::move(_pending.front());
+	_pending.pop_front();
+
+	ThreadPoolMan.wait(entry->task);
+
+	writeV22(entry->resRef, entry->resType, entry->data->size(), *entry->compressed);
+	finishEntry();
+}
+
+void ERFWriter::finishEntry() {
+	_currentFileCount += 1;
+	_tablesDirty = true;
+
+	if (_currentFileCount == _fileCount)
+		writeTables();
+}
+
+void ERFWriter::writeTables() {
+	if (!_tables.empty()) {
+		_stream.seek(_tablesOffset);
+		_stream.write(_tables.data(), _tables.size());
+	}
+
+	_stream.seek(_offsetToResourceData);
+
+	_tablesDirty = false;
 }
 
 void ERFWriter::initV10(uint32_t id, LocString description) {
@@ -124,6 +224,7 @@ void ERFWriter::initV10(uint32_t id, LocString description) {
 	description.writeLocString(_stream);
 
 	// Write the empty key list
+	_tablesOffset = _keyTableOffset;
 	_stream.writeZeros(_fileCount * 24);
 
 	// The offset to the resource table plus the size of the source table
@@ -151,6 +252,7 @@ void ERFWriter::initV20() {
 
 	// The offset to the resource table.
 	_resourceTableOffset = _stream.pos();
+	_tablesOffset = _resourceTableOffset;
 
 	// Write empty table of contents.
 	_stream.writeZeros(72 * _fileCount);
@@ -161,27 +263,25 @@ void ERFWriter::initV20() {
 
 void ERFWriter::addV10(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream) {
 	// Write the key table entry
-	_stream.seek(_keyTableOffset + _currentFileCount * 24);
+	Common::MemoryWriteStream key(_tables.data() + _currentFileCount * 24, 24);
 
-	_stream.write(resRef.c_str(), MIN<size_t>(resRef.size(), 16));
-	_stream.writeZeros(16 - MIN<size_t>(resRef.size(), 16));
-	_stream.writeUint32LE(_currentFileCount);
-	_stream.writeUint16LE(resType);
-	_stream.writeUint16LE(0); // Unused
+	key.write(resRef.c_str(), MIN<size_t>(resRef.size(), 16));
+	key.writeZeros(16 - MIN<size_t>(resRef.size(), 16));
+	key.writeUint32LE(_currentFileCount);
+	key.writeUint16LE(resType);
+	key.writeUint16LE(0); // Unused
 
 	// Write the actual resource data
-	_stream.seek(_offsetToResourceData);
 	const size_t size = _stream.writeStream(stream);
 
 	// Write the resource table entry
-	_stream.seek(_resourceTableOffset + _currentFileCount * 8);
+	Common::MemoryWriteStream resource(_tables.data() + (_resourceTableOffset - _tablesOffset) + _currentFileCount * 8, 8);
 
-	_stream.writeUint32LE(_offsetToResourceData);
-	_stream.writeUint32LE(size);
+	resource.writeUint32LE(_offsetToResourceData);
+	resource.writeUint32LE(size);
 
-	// Advance data offset and file count
+	// Advance data offset
 	_offsetToResourceData += size;
-	_currentFileCount += 1;
 }
 
 void ERFWriter::initV22(ERFWriter::Compression compression) {
@@ -225,6 +325,7 @@ void ERFWriter::initV22(ERFWriter::Compression compression) {
 
 	// The offset to the resource table.
 	_resourceTableOffset = _stream.pos();
+	_tablesOffset = _resourceTableOffset;
 
 	// Write empty table of contents.
 	_stream.writeZeros(76 * _fileCount);
@@ -235,60 +336,67 @@ void ERFWriter::initV22(ERFWriter::Compression compression) {
 
 void ERFWriter::addV20(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream) {
 	// Write the resource data
-	_stream.seek(_offsetToResourceData);
 	const size_t size = _stream.writeStream(stream);
 
 	// Write the resource table entry.
-	_stream.seek(_resourceTableOffset + _currentFileCount * 72);
+	Common::MemoryWriteStream resource(_tables.data() + _currentFileCount * 72, 72);
 
-	Common::writeStringFixed(_stream, TypeMan.addFileType(resRef, resType), Common::kEncodingUTF16LE, 64);
-	_stream.writeUint32LE(_offsetToResourceData);
-	_stream.writeUint32LE(size);
+	Common::writeStringFixed(resource, TypeMan.addFileType(resRef, resType), Common::kEncodingUTF16LE, 64);
+	resource.writeUint32LE(_offsetToResourceData);
+	resource.writeUint32LE(size);
 
-	// Advance offset and file count.
+	// Advance offset
 	_offsetToResourceData += size;
-	_currentFileCount += 1;
 }
 
 void ERFWriter::addV22(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream) {
-	// Write the resource data
-	_stream.seek(_offsetToResourceData);
+	const size_t uncompressedSize = stream.size();
 
-	size_t uncompressedSize = stream.size();
-	size_t size = 0;
+	if (_compression == kCompressionNone) {
+		writeV22(resRef, resType, uncompressedSize, stream);
+		return;
+	}
+
+	std::unique_ptr<Common::SeekableReadStream> compressedStream(compress(stream));
+	writeV22(resRef, resType, uncompressedSize, *compressedStream);
+}
 
+Common::SeekableReadStream *ERFWriter::compress(Common::SeekableReadStream &stream) const {
 	switch (_compression) {
-		case kCompressionNone: {
-			size = _stream.writeStream(stream);
-			break;
-		}
-		case kCompressionBiowareZlib: {
-			std::unique_ptr<Common::SeekableReadStream> compressedStream(
-					Common::compressDeflate(stream, uncompressedSize, Common::kWindowBitsMaxRaw));
-			_stream.writeByte(static_cast<uint>(Common::kWindowBitsMax) << 4);
-			size = _stream.writeStream(*compressedStream);
-			size += 1;
-			break;
-		}
-		case kCompressionHeaderlessZlib: {
-			std::unique_ptr<Common::SeekableReadStream> compressedStream(
-					Common::compressDeflate(stream, uncompressedSize, Common::kWindowBitsMaxRaw));
-			size = _stream.writeStream(*compressedStream);
+		case kCompressionBiowareZlib:
+		case kCompressionHeaderlessZlib:
+			return Common::compressDeflate(stream, stream.size(), Common::kWindowBitsMaxRaw);
+
+		default:
 			break;
-		}
 	}
 
+	throw Common::Exception("Invalid ERF compression %d", (int)_compression);
+}
+
+void ERFWriter::writeV22(const Common::UString &resRef, FileType resType, size_t uncompressedSize,
+                         Common::SeekableReadStream &data) {
+
+	// Write the resource data
+	size_t size = 0;
+
+	if (_compression == kCompressionBiowareZlib) {
+		_stream.writeByte(static_cast<uint>(Common::kWindowBitsMax) << 4);
+		size += 1;
+	}
+
+	size += _stream.writeStream(data);
+
 	// Write the resource table entry.
-	_stream.seek(_resourceTableOffset + _currentFileCount * 76);
+	Common::MemoryWriteStream resource(_tables.data() + _currentFileCount * 76, 76);
 
-	Common::writeStringFixed(_stream, TypeMan.addFileType(resRef, resType), Common::kEncodingUTF16LE, 64);
-	_stream.writeUint32LE(_offsetToResourceData);
-	_stream.writeUint32LE(size);
-	_stream.writeUint32LE(uncompressedSize);
+	Common::writeStringFixed(resource, TypeMan.addFileType(resRef, resType), Common::kEncodingUTF16LE, 64);
+	resource.writeUint32LE(_offsetToResourceData);
+	resource.writeUint32LE(size);
+	resource.writeUint32LE(uncompressedSize);
 
-	// Advance offset and file count.
+	// Advance offset
 	_offsetToResourceData += size;
-	_currentFileCount += 1;
 }
 
 } // End of namespace Aurora
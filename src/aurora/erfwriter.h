@@ -25,8 +25,13 @@
 #ifndef AURORA_ERFWRITER_H
 #define AURORA_ERFWRITER_H
 
+#include <vector>
+#include <deque>
+#include <memory>
+
 #include "src/common/writestream.h"
 #include "src/common/readstream.h"
+#include "src/common/threadpool.h"
 
 #include "src/aurora/locstring.h"
 
@@ -59,12 +64,38 @@ public:
 	ERFWriter(uint32_t id, uint32_t fileCount, Common::SeekableWriteStream &stream,
 	          Version version = kERFVersion10, Compression compression = kCompressionNone,
 	          LocString description = LocString());
-	~ERFWriter() = default;
+	/** Write out all entries still queued, and the tables. */
+	~ERFWriter();
 
 	/** Add a new stream to this archive to be packed. */
 	void add(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream);
+	/** Add a new stream to this archive to be packed, taking over its ownership.
+	 *
+	 *  If the entries need to be compressed, this happens on the thread pool,
+	 *  while more entries are added. Entries are still written in the order
+	 *  they were added, and only a few are held in memory at any time.
+	 */
+	void addAsync(const Common::UString &resRef, FileType resType, Common::SeekableReadStream *stream);
+
+	/** Write all queued entries and the key and resource tables.
+	 *
+	 *  This happens automatically once the last of the expected files was added.
+	 */
+	void flush();
 
 private:
+	/** An entry added with addAsync() that's not written yet. */
+	struct PendingEntry {
+		Common::UString resRef;
+		FileType resType;
+
+		std::unique_ptr<Common::SeekableReadStream> data;       ///< The uncompressed data.
+		std::unique_ptr<Common::SeekableReadStream> compressed; ///< The compressed data, once the task finished.
+
+		Common::ThreadPool::TaskHandle task;
+	};
+
+
 	void initV10(uint32_t id, LocString description);
 	void initV20();
 	void initV22(Compression compression);
@@ -73,6 +104,19 @@ private:
 	void addV20(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream);
 	void addV22(const Common::UString &resRef, FileType resType, Common::SeekableReadStream &stream);
 
+	/** Compress a stream according to the archive's compression. */
+	Common::SeekableReadStream *compress(Common::SeekableReadStream &stream) const;
+	/** Write the (already compressed) data of a V2.2 entry. */
+	void writeV22(const Common::UString &resRef, FileType resType, size_t uncompressedSize,
+	              Common::SeekableReadStream &data);
+
+	/** Write the oldest entry queued by addAsync(). */
+	void writePending();
+	/** Advance to the next entry, writing the tables after the last one. */
+	void finishEntry();
+	/** Write the tables collected in memory into their reserved place in the stream. */
+	void writeTables();
+
 	Common::SeekableWriteStream &_stream;
 
 	const Version _version;
@@ -83,6 +127,15 @@ private:
 	uint32_t _offsetToResourceData { 0 };
 	uint32_t _keyTableOffset { 0 };
 	uint32_t _resourceTableOffset { 0 };
+
+	/** The key and resource tables, written in one go once all files are in. */
+	std::vector<byte> _tables;
+	/** Offset of the tables within the stream. */
+	uint32_t _tablesOffset { 0 };
+	/** Were entries added since the tables were last written? */
+	bool _tablesDirty { false };
+
+	std::deque<std::unique_ptr<PendingEntry>> _pending;
 };
 
 } // End of namespace Aurora
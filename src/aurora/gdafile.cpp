@@ -147,6 +147,14 @@ size_t GDAFile::findColumn(uint32_t hash) const {
 	return kInvalidColumn;
 }
 
+GDAFile::ColumnHandle GDAFile::getColumnHandle(const Common::UString &name) const {
+	return ColumnHandle(findColumn(name));
+}
+
+GDAFile::ColumnHandle GDAFile::getColumnHandle(uint32_t hash) const {
+	return ColumnHandle(findColumn(hash));
+}
+
 const GFF4Struct *GDAFile::getRowColumn(size_t row, uint32_t hash, size_t &column) const {
 	const GFF4Struct *gdaRow = getRow(row);
 	if (!gdaRow || ((column = findColumn(hash)) == kInvalidColumn))
@@ -163,6 +171,14 @@ const GFF4Struct *GDAFile::getRowColumn(size_t row, const Common::UString &name,
 	return gdaRow;
 }
 
+const GFF4Struct *GDAFile::getRowColumn(size_t row, ColumnHandle handle, size_t &column) const {
+	const GFF4Struct *gdaRow = getRow(row);
+	if (!gdaRow || ((column = handle._column) == kInvalidColumn))
+		return 0;
+
+	return gdaRow;
+}
+
 Common::UString GDAFile::getString(size_t row, uint32_t columnHash, const Common::UString &def) const {
 	size_t gdaColumn;
 	const GFF4Struct *gdaRow = getRowColumn(row, columnHash, gdaColumn);
@@ -182,6 +198,15 @@ Common::UString GDAFile::getString(size_t row, const Common::UString &columnName
 	return gdaRow->getString(gdaColumn, def);
 }
 
+Common::UString GDAFile::getString(size_t row, ColumnHandle column, const Common::UString &def) const {
+	size_t gdaColumn;
+	const GFF4Struct *gdaRow = getRowColumn(row, column, gdaColumn);
+	if (!gdaRow)
+		return def;
+
+	return gdaRow->getString(gdaColumn, def);
+}
+
 int32_t GDAFile::getInt(size_t row, uint32_t columnHash, int32_t def) const {
 	size_t gdaColumn;
 	const GFF4Struct *gdaRow = getRowColumn(row, columnHash, gdaColumn);
@@ -200,6 +225,15 @@ int32_t GDAFile::getInt(size_t row, const Common::UString &columnName, int32_t d
 	return gdaRow->getSint(gdaColumn, def);
 }
 
+int32_t GDAFile::getInt(size_t row, ColumnHandle column, int32_t def) const {
+	size_t gdaColumn;
+	const GFF4Struct *gdaRow = getRowColumn(row, column, gdaColumn);
+	if (!gdaRow)
+		return def;
+
+	return gdaRow->getSint(gdaColumn, def);
+}
+
 float GDAFile::getFloat(size_t row, uint32_t columnHash, float def) const {
 	size_t gdaColumn;
 	const GFF4Struct *gdaRow = getRowColumn(row, columnHash, gdaColumn);
@@ -218,6 +252,15 @@ float GDAFile::getFloat(size_t row, const Common::UString &columnName, float def
 	return gdaRow->getDouble(gdaColumn, def);
 }
 
+float GDAFile::getFloat(size_t row, ColumnHandle column, float def) const {
+	size_t gdaColumn;
+	const GFF4Struct *gdaRow = getRowColumn(row, column, gdaColumn);
+	if (!gdaRow)
+		return def;
+
+	return gdaRow->getDouble(gdaColumn, def);
+}
+
 GDAFile::Type GDAFile::identifyType(const Columns &columns, const Row &rows, size_t column) const {
 	if (!columns || (column >= columns->size()) || !(*columns)[column])
 		return kTypeEmpty;
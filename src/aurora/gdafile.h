@@ -83,6 +83,26 @@ public:
 	};
 	typedef std::vector<Header> Headers;
 
+	/** A column, resolved from its name or hash, for repeated cell lookups.
+	 *
+	 *  A handle is only valid for the GDA it was created from.
+	 */
+	class ColumnHandle {
+	public:
+		/** Create an invalid handle. */
+		ColumnHandle() : _column(kInvalidColumn) { }
+
+		/** Does this handle refer to an existing column? */
+		bool isValid() const { return _column != kInvalidColumn; }
+
+	private:
+		size_t _column;
+
+		explicit ColumnHandle(size_t column) : _column(column) { }
+
+		friend class GDAFile;
+	};
+
 
 	/** Take over this stream and read a GDA file out of it. */
 	GDAFile(Common::SeekableReadStream *gda);
@@ -121,15 +141,23 @@ public:
 	/** Find a column by its hash. */
 	size_t findColumn(uint32_t hash) const;
 
+	/** Return a handle to a column, found by its name. */
+	ColumnHandle getColumnHandle(const Common::UString &name) const;
+	/** Return a handle to a column, found by its hash. */
+	ColumnHandle getColumnHandle(uint32_t hash) const;
+
 	Common::UString getString(size_t row, uint32_t columnHash, const Common::UString &def = "") const;
 	Common::UString getString(size_t row, const Common::UString &columnName,
 	                          const Common::UString &def = "") const;
+	Common::UString getString(size_t row, ColumnHandle column, const Common::UString &def = "") const;
 
 	int32_t getInt(size_t row, uint32_t columnHash, int32_t def = 0) const;
 	int32_t getInt(size_t row, const Common::UString &columnName, int32_t def = 0) const;
+	int32_t getInt(size_t row, ColumnHandle column, int32_t def = 0) const;
 
 	float getFloat(size_t row, uint32_t columnHash, float def = 0.0f) const;
 	float getFloat(size_t row, const Common::UString &columnName, float def = 0.0f) const;
+	float getFloat(size_t row, ColumnHandle column, float def = 0.0f) const;
 
 
 private:
@@ -164,6 +192,7 @@ private:
 
 	const GFF4Struct *getRowColumn(size_t row, uint32_t hash, size_t &column) const;
 	const GFF4Struct *getRowColumn(size_t row, const Common::UString &name, size_t &column) const;
+	const GFF4Struct *getRowColumn(size_t row, ColumnHandle handle, size_t &column) const;
 };
 
 } // End of namespace Aurora
@@ -27,7 +27,11 @@
  */
 
 #include <cassert>
+#include <cstring>
 
+#include <algorithm>
+
+#include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/memreadstream.h"
 #include "src/common/encoding.h"
@@ -44,6 +48,8 @@ static const uint32_t kVersion33 = MKTAG('V', '3', '.', '3'); // Found in The Wi
 
 namespace Aurora {
 
+const uint32_t GFF3File::kLabelInvalid;
+
 GFF3File::Header::Header() {
 }
 
@@ -64,7 +70,8 @@ void GFF3File::Header::read(Common::SeekableReadStream &gff3) {
 
 
 GFF3File::GFF3File(Common::SeekableReadStream *gff3, uint32_t id, bool repairNWNPremium) :
-	_stream(gff3), _repairNWNPremium(repairNWNPremium), _offsetCorrection(0) {
+	_stream(gff3), _data(0), _dataSize(0), _repairNWNPremium(repairNWNPremium), _offsetCorrection(0),
+	_hasLabels(false), _uniqueLabels(true) {
 
 	assert(_stream);
 
@@ -72,7 +79,8 @@ GFF3File::GFF3File(Common::SeekableReadStream *gff3, uint32_t id, bool repairNWN
 }
 
 GFF3File::GFF3File(const Common::UString &gff3, FileType type, uint32_t id, bool repairNWNPremium) :
-	_repairNWNPremium(repairNWNPremium), _offsetCorrection(0) {
+	_data(0), _dataSize(0), _repairNWNPremium(repairNWNPremium), _offsetCorrection(0),
+	_hasLabels(false), _uniqueLabels(true) {
 
 	_stream.reset(ResMan.getResource(gff3, type));
 	if (!_stream)
@@ -97,6 +105,7 @@ const GFF3Struct &GFF3File::getTopLevel() const {
 void GFF3File::load(uint32_t id) {
 	try {
 
+		loadData();
 		loadHeader(id);
 		loadStructs();
 		loadLists();
@@ -107,6 +116,30 @@ void GFF3File::load(uint32_t id) {
 	}
 }
 
+void GFF3File::loadData() {
+	/* We want the whole GFF3 in one buffer we can look at directly.
+	 * Memory streams (including memory-mapped ones) already are one,
+	 * everything else is read into memory once. */
+
+	const Common::MemoryReadStream *memStream = dynamic_cast<const Common::MemoryReadStream *>(_stream.get());
+	if (!memStream || !memStream->getData()) {
+		const size_t size = _stream->size();
+		std::unique_ptr<byte[]> data = std::make_unique<byte[]>(size);
+
+		_stream->seek(0);
+		if (_stream->read(data.get(), size) != size)
+			throw Common::Exception(Common::kReadError);
+
+		_stream = std::make_unique<Common::MemoryReadStream>(data.release(), size, true);
+		memStream = static_cast<const Common::MemoryReadStream *>(_stream.get());
+	}
+
+	_data     = memStream->getData();
+	_dataSize = memStream->size();
+
+	_stream->seek(0);
+}
+
 void GFF3File::loadHeader(uint32_t id) {
 	if (_repairNWNPremium) {
 		/* The GFF3 files in the encrypted premium module archive for Neverwinter
@@ -282,6 +315,66 @@ Common::SeekableReadStream &GFF3File::getFieldData() const {
 	return getStream(_header.fieldDataOffset);
 }
 
+void GFF3File::readLabels() const {
+	static const uint32_t kLabelSize = 16;
+
+	if (_hasLabels)
+		return;
+
+	if (_header.labelCount > ((_dataSize - _header.labelOffset) / kLabelSize))
+		throw Common::Exception("GFF3: Label table out of range (%u)", _header.labelCount);
+
+	std::vector<Common::UString> labels;
+	labels.reserve(_header.labelCount);
+
+	LabelMap labelIndices;
+	labelIndices.reserve(_header.labelCount);
+
+	bool uniqueLabels = true;
+
+	const byte *label = _data + _header.labelOffset;
+	for (uint32_t i = 0; i < _header.labelCount; i++, label += kLabelSize) {
+		labels.push_back(Common::UString(reinterpret_cast<const char *>(label),
+		                 std::find(label, label + kLabelSize, '\0') - label));
+
+		uint32_t &index = labelIndices[labels.back()];
+		if (labelIndices.size() == labels.size())
+			index = i;
+		else
+			uniqueLabels = false;
+	}
+
+	_labels.swap(labels);
+	std::swap(_labelIndices, labelIndices);
+
+	_uniqueLabels = uniqueLabels;
+	_hasLabels    = true;
+}
+
+const Common::UString &GFF3File::getLabel(uint32_t i) const {
+	readLabels();
+
+	if (i >= _labels.size())
+		throw Common::Exception("GFF3: Label index out of range (%u >= %u)", i, (uint) _labels.size());
+
+	return _labels[i];
+}
+
+uint32_t GFF3File::findLabel(const Common::UString &label) const {
+	readLabels();
+
+	const uint32_t *index = _labelIndices.find(label);
+	return index ? *index : kLabelInvalid;
+}
+
+const byte *GFF3File::getRaw(size_t offset, size_t size) const {
+	if ((offset > _dataSize) || (size > (_dataSize - offset)))
+		throw Common::Exception("GFF3: Data out of range (%u + %u > %u)",
+		                        (uint) offset, (uint) size, (uint) _dataSize);
+
+	return _data + offset;
+}
+
 
 GFF3Struct::Field::Field() : type(kFieldTypeNone), data(0), extended(false) {
 }
@@ -301,7 +394,9 @@ GFF3Struct::Field::Field(FieldType t, uint32_t d) : type(t), data(d) {
 }
 
 
-GFF3Struct::GFF3Struct(const GFF3File &parent, uint32_t offset) : _parent(&parent) {
+GFF3Struct::GFF3Struct(const GFF3File &parent, uint32_t offset) : _parent(&parent),
+	_uniqueFieldCount(0), _hasFieldNames(false) {
+
 	load(offset);
 }
 
@@ -312,71 +407,76 @@ uint32_t GFF3Struct::getID() const {
 // --- Loader ---
 
 void GFF3Struct::load(uint32_t offset) {
-	Common::SeekableReadStream &data = _parent->getStream(offset);
+	static const uint32_t kStructSize = 12;
+
+	const byte *data = _parent->getRaw(offset, kStructSize);
+
+	_id         = READ_LE_UINT32(data + 0);
+	_fieldIndex = READ_LE_UINT32(data + 4);
+	_fieldCount = READ_LE_UINT32(data + 8);
 
-	_id         = data.readUint32LE();
-	_fieldIndex = data.readUint32LE();
-	_fieldCount = data.readUint32LE();
+	/* Only make sure the field list is within range. The fields themselves
+	 * are decoded only when they're accessed, see getField(). */
 
-	// Read the field(s)
-	if      (_fieldCount == 1)
-		readField (data, _fieldIndex);
-	else if (_fieldCount > 1)
-		readFields(data, _fieldIndex, _fieldCount);
+	if (_fieldCount == 1) {
+		if (_fieldIndex >= _parent->_header.fieldCount)
+			throw Common::Exception("GFF3: Field index out of range (%d/%d)",
+			                        _fieldIndex, _parent->_header.fieldCount);
+
+	} else if (_fieldCount > 1) {
+		if ((_fieldIndex > _parent->_header.fieldIndicesCount) ||
+		    (_fieldCount > ((_parent->_header.fieldIndicesCount - _fieldIndex) / 4)))
+			throw Common::Exception("GFF3: Field indices index out of range (%d+%d/%d)",
+			                        _fieldIndex, _fieldCount, _parent->_header.fieldIndicesCount);
+
+		_parent->getRaw(_parent->_header.fieldIndicesOffset + (size_t) _fieldIndex, _fieldCount * 4);
+	}
 }
 
-void GFF3Struct::readField(Common::SeekableReadStream &data, uint32_t index) {
-	// Sanity check
-	if (index > _parent->_header.fieldCount)
-		throw Common::Exception("GFF3: Field index out of range (%d/%d)",
-				index, _parent->_header.fieldCount);
+void GFF3Struct::readFieldNames() const {
+	if (_hasFieldNames)
+		return;
 
-	// Seek
-	data.seek(_parent->_header.fieldOffset + index * 12);
+	std::vector<Common::UString> fieldNames;
+	fieldNames.reserve(_fieldCount);
 
-	// Read the field data
-	const uint32_t fieldType  = data.readUint32LE();
-	const uint32_t fieldLabel = data.readUint32LE();
-	const uint32_t fieldData  = data.readUint32LE();
+	for (uint32_t i = 0; i < _fieldCount; i++)
+		fieldNames.push_back(_parent->getLabel(READ_LE_UINT32(getRawField(i) + 4)));
 
-	// Read the name
-	Common::UString fieldName = readLabel(data, fieldLabel);
+	// Fields with the same label shadow each other
+	std::vector<Common::UString> uniqueNames(fieldNames);
+	std::sort(uniqueNames.begin(), uniqueNames.end());
 
-	// And add the field to the map and name list
-	_fields[fieldName] = Field((FieldType) fieldType, fieldData);
+	_uniqueFieldCount = std::unique(uniqueNames.begin(), uniqueNames.end()) - uniqueNames.begin();
 
-	_fieldNames.push_back(fieldName);
+	_fieldNames.swap(fieldNames);
+	_hasFieldNames = true;
 }
 
-void GFF3Struct::readFields(Common::SeekableReadStream &data, uint32_t index, uint32_t count) {
-	// Sanity check
-	if (index > _parent->_header.fieldIndicesCount)
-		throw Common::Exception("GFF3: Field indices index out of range (%d/%d)",
-		                        index , _parent->_header.fieldIndicesCount);
+// --- Raw field access ---
 
-	// Seek
-	data.seek(_parent->_header.fieldIndicesOffset + index);
+const byte *GFF3Struct::getRawField(uint32_t n) const {
+	static const uint32_t kFieldSize = 12;
 
-	// Read the field indices
-	std::vector<uint32_t> indices;
-	readIndices(data, indices, count);
+	assert(n < _fieldCount);
 
-	// Read the fields
-	for (std::vector<uint32_t>::const_iterator i = indices.begin(); i != indices.end(); ++i)
-		readField(data, *i);
-}
+	uint32_t index = _fieldIndex;
+	if (_fieldCount > 1)
+		index = READ_LE_UINT32(_parent->_data + _parent->_header.fieldIndicesOffset + _fieldIndex + n * 4);
 
-void GFF3Struct::readIndices(Common::SeekableReadStream &data,
-                             std::vector<uint32_t> &indices, uint32_t count) const {
-	indices.reserve(count);
-	while (count-- > 0)
-		indices.push_back(data.readUint32LE());
+	if (index >= _parent->_header.fieldCount)
+		throw Common::Exception("GFF3: Field index out of range (%d/%d)",
+		                        index, _parent->_header.fieldCount);
+
+	return _parent->getRaw(_parent->_header.fieldOffset + (size_t) index * kFieldSize, kFieldSize);
 }
 
-Common::UString GFF3Struct::readLabel(Common::SeekableReadStream &data, uint32_t index) const {
-	data.seek(_parent->_header.labelOffset + index * 16);
+const byte *GFF3Struct::getRawLabel(const byte *rawField) const {
+	static const uint32_t kLabelSize = 16;
+
+	const uint32_t label = READ_LE_UINT32(rawField + 4);
 
-	return Common::readStringFixed(data, Common::kEncodingASCII, 16);
+	return _parent->getRaw(_parent->_header.labelOffset + (size_t) label * kLabelSize, kLabelSize);
 }
 
 Common::SeekableReadStream &GFF3Struct::getData(const Field &field) const {
@@ -391,71 +491,130 @@ Common::SeekableReadStream &GFF3Struct::getData(const Field &field) const {
 // --- Field properties ---
 
 size_t GFF3Struct::getFieldCount() const {
-	return _fields.size();
+	readFieldNames();
+
+	return _uniqueFieldCount;
 }
 
 bool GFF3Struct::hasField(const Common::UString &field) const {
-	return getField(field) != 0;
+	Field f;
+	return getField(field, f);
 }
 
 const std::vector<Common::UString> &GFF3Struct::getFieldNames() const {
+	readFieldNames();
+
 	return _fieldNames;
 }
 
 GFF3Struct::FieldType GFF3Struct::getFieldType(const Common::UString &field) const {
-	const Field *f = getField(field);
-	if (!f)
+	Field f;
+	if (!getField(field, f))
 		return kFieldTypeNone;
 
-	return f->type;
+	return f.type;
 }
 
 // --- Field value reader helpers ---
 
-const GFF3Struct::Field *GFF3Struct::getField(const Common::UString &name) const {
-	FieldMap::const_iterator field = _fields.find(name);
-	if (field == _fields.end())
+bool GFF3Struct::getField(const Common::UString &name, Field &field) const {
+	return getField(name, findLabel(name), field);
+}
+
+uint32_t GFF3Struct::findLabel(const Common::UString &name) const {
+	_parent->readLabels();
+	if (!_parent->_uniqueLabels)
+		return GFF3File::kLabelInvalid;
+
+	return _parent->findLabel(name);
+}
+
+bool GFF3Struct::getField(const Common::UString &name, uint32_t label, Field &field) const {
+	const byte *rawField = 0;
+
+	if (_parent->_uniqueLabels) {
+		/* Each label exists only once in the label table, so we can just compare label
+		 * indices. We're going backwards, because of fields with the same label, the
+		 * last one has always won. */
+
+		if (label == GFF3File::kLabelInvalid)
+			return false;
+
+		for (uint32_t i = _fieldCount; i-- > 0; ) {
+			const byte *f = getRawField(i);
+
+			if (READ_LE_UINT32(f + 4) == label) {
+				rawField = f;
+				break;
+			}
+		}
+
+	} else
+		rawField = findRawFieldByName(name);
+
+	if (!rawField)
+		return false;
+
+	field = Field((FieldType) READ_LE_UINT32(rawField), READ_LE_UINT32(rawField + 8));
+	return true;
+}
+
+const byte *GFF3Struct::findRawFieldByName(const Common::UString &name) const {
+	const size_t length = std::strlen(name.c_str());
+	if (length > 16)
 		return 0;
 
-	return &field->second;
+	for (uint32_t i = _fieldCount; i-- > 0; ) {
+		const byte *rawField = getRawField(i);
+		const byte *label    = getRawLabel(rawField);
+
+		if ((std::memcmp(label, name.c_str(), length) == 0) && ((length == 16) || (label[length] == '\0')))
+			return rawField;
+	}
+
+	return 0;
 }
 
 char GFF3Struct::getChar(const Common::UString &field, char def) const {
-	const Field *f = getField(field);
-	if (!f)
+	Field f;
+	if (!getField(field, f))
 		return def;
-	if (f->type != kFieldTypeChar)
+	if (f.type != kFieldTypeChar)
 		throw Common::Exception("GFF3: Field is not a char type");
 
-	return (char) f->data;
+	return (char) f.data;
 }
 
 uint64_t GFF3Struct::getUint(const Common::UString &field, uint64_t def) const {
-	const Field *f = getField(field);
-	if (!f)
+	Field f;
+	if (!getField(field, f))
 		return def;
 
+	return getUint(f);
+}
+
+uint64_t GFF3Struct::getUint(const Field &f) const {
 	// Int types
-	if (f->type == kFieldTypeByte)
-		return (uint64_t) ((uint8_t ) f->data);
-	if (f->type == kFieldTypeUint16)
-		return (uint64_t) ((uint16_t) f->data);
-	if (f->type == kFieldTypeUint32)
-		return (uint64_t) ((uint32_t) f->data);
-	if (f->type == kFieldTypeChar)
-		return (uint64_t) ((int64_t) ((int8_t ) ((uint8_t ) f->data)));
-	if (f->type == kFieldTypeSint16)
-		return (uint64_t) ((int64_t) ((int16_t) ((uint16_t) f->data)));
-	if (f->type == kFieldTypeSint32)
-		return (uint64_t) ((int64_t) ((int32_t) ((uint32_t) f->data)));
-	if (f->type == kFieldTypeUint64)
-		return (uint64_t) getData(*f).readUint64LE();
-	if (f->type == kFieldTypeSint64)
-		return ( int64_t) getData(*f).readUint64LE();
+	if (f.type == kFieldTypeByte)
+		return (uint64_t) ((uint8_t ) f.data);
+	if (f.type == kFieldTypeUint16)
+		return (uint64_t) ((uint16_t) f.data);
+	if (f.type == kFieldTypeUint32)
+		return (uint64_t) ((uint32_t) f.data);
+	if (f.type == kFieldTypeChar)
+		return (uint64_t) ((int64_t) ((int8_t ) ((uint8_t ) f.data)));
+	if (f.type == kFieldTypeSint16)
+		return (uint64_t) ((int64_t) ((int16_t) ((uint16_t) f.data)));
+	if (f.type == kFieldTypeSint32)
+		return (uint64_t) ((int64_t) ((int32_t) ((uint32_t) f.data)));
+	if (f.type == kFieldTypeUint64)
+		return (uint64_t) getData(f).readUint64LE();
+	if (f.type == kFieldTypeSint64)
+		return ( int64_t) getData(f).readUint64LE();
 
 	// StrRef, a numerical reference to a string in a talk table
-	if (f->type == kFieldTypeStrRef) {
-		Common::SeekableReadStream &data = getData(*f);
+	if (f.type == kFieldTypeStrRef) {
+		Common::SeekableReadStream &data = getData(f);
 
 		const uint32_t size = data.readUint32LE();
 		if (size != 4)
@@ -468,31 +627,35 @@ uint64_t GFF3Struct::getUint(const Common::UString &field, uint64_t def) const {
 }
 
 int64_t GFF3Struct::getSint(const Common::UString &field, int64_t def) const {
-	const Field *f = getField(field);
-	if (!f)
+	Field f;
+	if (!getField(field, f))
 		return def;
 
+	return getSint(f);
+}
+
+int64_t GFF3Struct::getSint(const Field &f) const {
 	// Int types
-	if (f->type == kFieldTypeByte)
-		return (int64_t) ((int8_t ) ((uint8_t ) f->data));
-	if (f->type == kFieldTypeUint16)
-		return (int64_t) ((int16_t) ((uint16_t) f->data));
-	if (f->type == kFieldTypeUint32)
-		return (int64_t) ((int32_t) ((uint32_t) f->data));
-	if (f->type == kFieldTypeChar)
-		return (int64_t) ((int8_t ) ((uint8_t ) f->data));
-	if (f->type == kFieldTypeSint16)
-		return (int64_t) ((int16_t) ((uint16_t) f->data));
-	if (f->type == kFieldTypeSint32)
-		return (int64_t) ((int32_t) ((uint32_t) f->data));
-	if (f->type == kFieldTypeUint64)
-		return (int64_t) getData(*f).readUint64LE();
-	if (f->type == kFieldTypeSint64)
-		return (int64_t) getData(*f).readUint64LE();
+	if (f.type == kFieldTypeByte)
+		return (int64_t) ((int8_t ) ((uint8_t ) f.data));
+	if (f.type == kFieldTypeUint16)
+		return (int64_t) ((int16_t) ((uint16_t) f.data));
+	if (f.type == kFieldTypeUint32)
+		return (int64_t) ((int32_t) ((uint32_t) f.data));
+	if (f.type == kFieldTypeChar)
+		return (int64_t) ((int8_t ) ((uint8_t ) f.data));
+	if (f.type == kFieldTypeSint16)
+		return (int64_t) ((int16_t) ((uint16_t) f.data));
+	if (f.type == kFieldTypeSint32)
+		return (int64_t) ((int32_t) ((uint32_t) f.data));
+	if (f.type == kFieldTypeUint64)
+		return (int64_t) getData(f).readUint64LE();
+	if (f.type == kFieldTypeSint64)
+		return (int64_t) getData(f).readUint64LE();
 
 	// StrRef, a numerical reference to a string in a talk table
-	if (f->type == kFieldTypeStrRef) {
-		Common::SeekableReadStream &data = getData(*f);
+	if (f.type == kFieldTypeStrRef) {
+		Common::SeekableReadStream &data = getData(f);
 
 		const uint32_t size = data.readUint32LE();
 		if (size != 4)
@@ -509,14 +672,18 @@ bool GFF3Struct::getBool(const Common::UString &field, bool def) const {
 }
 
 double GFF3Struct::getDouble(const Common::UString &field, double def) const {
-	const Field *f = getField(field);
-	if (!f)
+	Field f;
+	if (!getField(field, f))
 		return def;
 
-	if (f->type == kFieldTypeFloat)
-		return convertIEEEFloat(f->data);
-	if (f->type == kFieldTypeDouble)
-		return getData(*f).readIEEEDoubleLE();
+	return getDouble(f);
+}
+
+double GFF3Struct::getDouble(const Field &f) const {
+	if (f.type == kFieldTypeFloat)
+		return convertIEEEFloat(f.data);
+	if (f.type == kFieldTypeDouble)
+		return getData(f).readIEEEDoubleLE();
 
 	throw Common::Exception("GFF3: Field is not a double type");
 }
@@ -524,34 +691,34 @@ double GFF3Struct::getDouble(const Common::UString &field, double def) const {
 Common::UString GFF3Struct::getString(const Common::UString &field,
                                       const Common::UString &def) const {
 
-	const Field *f = getField(field);
-	if (!f)
+	Field f;
+	if (!getField(field, f))
 		return def;
 
 	// Direct string
-	if (f->type == kFieldTypeExoString) {
-		Common::SeekableReadStream &data = getData(*f);
+	if (f.type == kFieldTypeExoString) {
+		Common::SeekableReadStream &data = getData(f);
 
 		const uint32_t length = data.readUint32LE();
 		return Common::readStringFixed(data, Common::kEncodingASCII, length);
 	}
 
 	// ResRef, resource reference, a shorter string
-	if (f->type == kFieldTypeResRef) {
+	if (f.type == kFieldTypeResRef) {
 		/* In most games, this field has a limit of 16 characters, because
 		 * resource filenames were limited to 16 characters (without extension)
 		 * inside the archives. In Dragon Age: Origins and Dragon Age II,
 		 * however, this limit has been lifted, and a full 255 characters
 		 * are available in ResRef string fields. */
 
-		Common::SeekableReadStream &data = getData(*f);
+		Common::SeekableReadStream &data = getData(f);
 
 		const uint32_t length = data.readByte();
 		return Common::readStringFixed(data, Common::kEncodingASCII, length);
 	}
 
 	// LocString, a localized string
-	if (f->type == kFieldTypeLocString) {
+	if (f.type == kFieldTypeLocString) {
 		LocString locString;
 		getLocString(field, locString);
 
@@ -559,33 +726,33 @@ Common::UString GFF3Struct::getString(const Common::UString &field,
 	}
 
 	// Unsigned integer type, compose a string representation
-	if ((f->type == kFieldTypeByte  ) ||
-	    (f->type == kFieldTypeUint16) ||
-	    (f->type == kFieldTypeUint32) ||
-	    (f->type == kFieldTypeUint64) ||
-	    (f->type == kFieldTypeStrRef)) {
+	if ((f.type == kFieldTypeByte  ) ||
+	    (f.type == kFieldTypeUint16) ||
+	    (f.type == kFieldTypeUint32) ||
+	    (f.type == kFieldTypeUint64) ||
+	    (f.type == kFieldTypeStrRef)) {
 
 		return Common::composeString(getUint(field));
 	}
 
 	// Signed integer type, compose a string representation
-	if ((f->type == kFieldTypeChar  ) ||
-	    (f->type == kFieldTypeSint16) ||
-	    (f->type == kFieldTypeSint32) ||
-	    (f->type == kFieldTypeSint64)) {
+	if ((f.type == kFieldTypeChar  ) ||
+	    (f.type == kFieldTypeSint16) ||
+	    (f.type == kFieldTypeSint32) ||
+	    (f.type == kFieldTypeSint64)) {
 
 		return Common::composeString(getSint(field));
 	}
 
 	// Floating point type, compose a string representation
-	if ((f->type == kFieldTypeFloat) ||
-	    (f->type == kFieldTypeDouble)) {
+	if ((f.type == kFieldTypeFloat) ||
+	    (f.type == kFieldTypeDouble)) {
 
 		return Common::composeString(getDouble(field));
 	}
 
 	// Vector, consisting of 3 floats
-	if (f->type == kFieldTypeVector) {
+	if (f.type == kFieldTypeVector) {
 		float x = 0.0, y = 0.0, z = 0.0;
 
 		getVector(field, x, y, z);
@@ -595,7 +762,7 @@ Common::UString GFF3Struct::getString(const Common::UString &field,
 	}
 
 	// Orientation, consisting of 4 floats
-	if (f->type == kFieldTypeOrientation) {
+	if (f.type == kFieldTypeOrientation) {
 		float a = 0.0, b = 0.0, c = 0.0, d = 0.0;
 
 		getOrientation(field, a, b, c, d);
@@ -609,15 +776,15 @@ Common::UString GFF3Struct::getString(const Common::UString &field,
 }
 
 bool GFF3Struct::getLocString(const Common::UString &field, LocString &str) const {
-	const Field *f = getField(field);
-	if (!f || (f->type != kFieldTypeLocString))
+	Field f;
+	if (!getField(field, f) || (f.type != kFieldTypeLocString))
 		return false;
 
 	LocString locString;
 
 	try {
 
-		Common::SeekableReadStream &data = getData(*f);
+		Common::SeekableReadStream &data = getData(f);
 
 		const uint32_t size = data.readUint32LE();
 		Common::SeekableSubReadStream locStringData(&data, data.pos(), data.pos() + size);
@@ -633,20 +800,20 @@ bool GFF3Struct::getLocString(const Common::UString &field, LocString &str) cons
 }
 
 Common::SeekableReadStream *GFF3Struct::getData(const Common::UString &field) const {
-	const Field *f = getField(field);
-	if (!f)
+	Field f;
+	if (!getField(field, f))
 		return 0;
-	if ((f->type != kFieldTypeVoid) &&
-	    (f->type != kFieldTypeExoString) &&
-	    (f->type != kFieldTypeResRef))
+	if ((f.type != kFieldTypeVoid) &&
+	    (f.type != kFieldTypeExoString) &&
+	    (f.type != kFieldTypeResRef))
 		throw Common::Exception("GFF3: Field is not a data type");
 
-	Common::SeekableReadStream &data = getData(*f);
+	Common::SeekableReadStream &data = getData(f);
 
 	uint32_t size = 0;
-	if      ((f->type == kFieldTypeVoid) || (f->type == kFieldTypeExoString))
+	if      ((f.type == kFieldTypeVoid) || (f.type == kFieldTypeExoString))
 		size = data.readUint32LE();
-	else if ( f->type == kFieldTypeResRef)
+	else if ( f.type == kFieldTypeResRef)
 		size = data.readByte();
 	else
 		throw Common::Exception("GFF3: Field is not a data type");
@@ -657,13 +824,13 @@ Common::SeekableReadStream *GFF3Struct::getData(const Common::UString &field) co
 void GFF3Struct::getVector(const Common::UString &field,
                            float &x, float &y, float &z) const {
 
-	const Field *f = getField(field);
-	if (!f)
+	Field f;
+	if (!getField(field, f))
 		return;
-	if (f->type != kFieldTypeVector)
+	if (f.type != kFieldTypeVector)
 		throw Common::Exception("GFF3: Field is not a vector type");
 
-	Common::SeekableReadStream &data = getData(*f);
+	Common::SeekableReadStream &data = getData(f);
 
 	x = data.readIEEEFloatLE();
 	y = data.readIEEEFloatLE();
@@ -673,13 +840,13 @@ void GFF3Struct::getVector(const Common::UString &field,
 void GFF3Struct::getOrientation(const Common::UString &field,
                                 float &a, float &b, float &c, float &d) const {
 
-	const Field *f = getField(field);
-	if (!f)
+	Field f;
+	if (!getField(field, f))
 		return;
-	if (f->type != kFieldTypeOrientation)
+	if (f.type != kFieldTypeOrientation)
 		throw Common::Exception("GFF3: Field is not an orientation type");
 
-	Common::SeekableReadStream &data = getData(*f);
+	Common::SeekableReadStream &data = getData(f);
 
 	a = data.readIEEEFloatLE();
 	b = data.readIEEEFloatLE();
@@ -690,13 +857,13 @@ void GFF3Struct::getOrientation(const Common::UString &field,
 void GFF3Struct::getVector(const Common::UString &field,
                            double &x, double &y, double &z) const {
 
-	const Field *f = getField(field);
-	if (!f)
+	Field f;
+	if (!getField(field, f))
 		return;
-	if (f->type != kFieldTypeVector)
+	if (f.type != kFieldTypeVector)
 		throw Common::Exception("GFF3: Field is not a vector type");
 
-	Common::SeekableReadStream &data = getData(*f);
+	Common::SeekableReadStream &data = getData(f);
 
 	x = data.readIEEEFloatLE();
 	y = data.readIEEEFloatLE();
@@ -706,13 +873,13 @@ void GFF3Struct::getVector(const Common::UString &field,
 void GFF3Struct::getOrientation(const Common::UString &field,
                                 double &a, double &b, double &c, double &d) const {
 
-	const Field *f = getField(field);
-	if (!f)
+	Field f;
+	if (!getField(field, f))
 		return;
-	if (f->type != kFieldTypeOrientation)
+	if (f.type != kFieldTypeOrientation)
 		throw Common::Exception("GFF3: Field is not an orientation type");
 
-	Common::SeekableReadStream &data = getData(*f);
+	Common::SeekableReadStream &data = getData(f);
 
 	a = data.readIEEEFloatLE();
 	b = data.readIEEEFloatLE();
@@ -723,27 +890,94 @@ void GFF3Struct::getOrientation(const Common::UString &field,
 // --- Struct reader ---
 
 const GFF3Struct &GFF3Struct::getStruct(const Common::UString &field) const {
-	const Field *f = getField(field);
-	if (!f)
+	Field f;
+	if (!getField(field, f))
 		throw Common::Exception("GFF3: No such field");
-	if (f->type != kFieldTypeStruct)
+	if (f.type != kFieldTypeStruct)
 		throw Common::Exception("GFF3: Field is not a struct type");
 
 	// Direct index into the struct array
-	return _parent->getStruct(f->data);
+	return _parent->getStruct(f.data);
 }
 
 // --- Struct list reader ---
 
 const GFF3List &GFF3Struct::getList(const Common::UString &field) const {
-	const Field *f = getField(field);
-	if (!f)
+	Field f;
+	if (!getField(field, f))
 		throw Common::Exception("GFF3: No such field");
-	if (f->type != kFieldTypeList)
+	if (f.type != kFieldTypeList)
 		throw Common::Exception("GFF3: Field is not a list type");
 
 	// Byte offset into the list area, all 32bit values.
-	return _parent->getList(f->data / 4);
+	return _parent->getList(f.data / 4);
+}
+
+// --- Fields out of every struct in a list ---
+
+const GFF3List *GFF3Struct::getListFields(const Common::UString &list, const Common::UString &field,
+                                          uint32_t &label) const {
+
+	Field f;
+	if (!getField(list, f))
+		return 0;
+	if (f.type != kFieldTypeList)
+		throw Common::Exception("GFF3: Field is not a list type");
+
+	label = findLabel(field);
+
+	return &_parent->getList(f.data / 4);
+}
+
+bool GFF3Struct::getListUint(const Common::UString &list, const Common::UString &field,
+                             std::vector<uint32_t> &values, uint32_t def) const {
+
+	uint32_t label;
+	const GFF3List *structs = getListFields(list, field, label);
+	if (!structs)
+		return false;
+
+	values.resize(structs->size());
+	for (size_t i = 0; i < structs->size(); i++) {
+		Field f;
+		values[i] = (*structs)[i]->getField(field, label, f) ? (*structs)[i]->getUint(f) : def;
+	}
+
+	return true;
+}
+
+bool GFF3Struct::getListSint(const Common::UString &list, const Common::UString &field,
+                             std::vector<int32_t> &values, int32_t def) const {
+
+	uint32_t label;
+	const GFF3List *structs = getListFields(list, field, label);
+	if (!structs)
+		return false;
+
+	values.resize(structs->size());
+	for (size_t i = 0; i < structs->size(); i++) {
+		Field f;
+		values[i] = (*structs)[i]->getField(field, label, f) ? (*structs)[i]->getSint(f) : def;
+	}
+
+	return true;
+}
+
+bool GFF3Struct::getListFloat(const Common::UString &list, const Common::UString &field,
+                              std::vector<float> &values, float def) const {
+
+	uint32_t label;
+	const GFF3List *structs = getListFields(list, field, label);
+	if (!structs)
+		return false;
+
+	values.resize(structs->size());
+	for (size_t i = 0; i < structs->size(); i++) {
+		Field f;
+		values[i] = (*structs)[i]->getField(field, label, f) ? (*structs)[i]->getDouble(f) : def;
+	}
+
+	return true;
 }
 
 } // End of namespace Aurora
@@ -26,13 +26,13 @@
 #define AURORA_GFF3FILE_H
 
 #include <vector>
-#include <map>
 #include <memory>
 
 #include <boost/noncopyable.hpp>
 
 #include "src/common/types.h"
 #include "src/common/ustring.h"
+#include "src/common/flathashmap.h"
 
 #include "src/aurora/types.h"
 #include "src/aurora/aurorafile.h"
@@ -78,6 +78,16 @@ class GFF3Struct;
  *  LocStrings is different. Since xoreos has more flexible handling of
  *  language IDs anyway, this doesn't concern us.
  *
+ *  The fields of a struct are not decoded when the GFF3 is loaded. Instead,
+ *  GFF3File keeps the whole file in one contiguous buffer (directly using
+ *  the buffer of a memory or memory-mapped stream, if possible), and each
+ *  GFF3Struct looks up its fields straight from that buffer when they are
+ *  accessed. Fields that are never accessed are never decoded.
+ *
+ *  The field labels are decoded only once per file, into a label table
+ *  shared by all structs. Looking up a field then only means finding the
+ *  index of its label once, and comparing label indices within the struct.
+ *
  *  See also: GFF4File in gff4file.h for the later V4.0/V4.1 versions of
  *  the GFF format.
  */
@@ -120,9 +130,18 @@ private:
 	typedef std::vector<std::unique_ptr<GFF3Struct>> StructArray;
 	typedef std::vector<GFF3List> ListArray;
 
+	typedef Common::FlatHashMap<Common::UString, uint32_t,
+	                            Common::hashUStringCaseSensitive, Common::equalsUStringSensitive> LabelMap;
+
+	static const uint32_t kLabelInvalid = 0xFFFFFFFF;
+
 
 	std::unique_ptr<Common::SeekableReadStream> _stream;
 
+	/** The whole GFF3, as one contiguous buffer owned by _stream. */
+	const byte *_data;
+	size_t      _dataSize;
+
 	Header _header; ///< The GFF3's header.
 
 	/** Should we try to read GFF3 files found in Neverwinter Nights premium modules? */
@@ -136,9 +155,18 @@ private:
 	/** To convert list offsets found in GFF3 to real indices. */
 	std::vector<uint32_t> _listOffsetToIndex;
 
+	/** All field labels, read when a field is first looked up. */
+	mutable std::vector<Common::UString> _labels;
+	/** Field label -> index into the label table. */
+	mutable LabelMap _labelIndices;
+
+	mutable bool _hasLabels;    ///< Has the label table been read yet?
+	mutable bool _uniqueLabels; ///< Is every label in the label table unique?
+
 
 	// .--- Loading helpers
 	void load(uint32_t id);
+	void loadData();
 	void loadHeader(uint32_t id);
 	void loadStructs();
 	void loadLists();
@@ -150,10 +178,20 @@ private:
 	/** Return the GFF3 stream seeked to the start of the field data. */
 	Common::SeekableReadStream &getFieldData() const;
 
+	/** Return a pointer to size bytes of the GFF3 at offset, throwing if they're out of range. */
+	const byte *getRaw(size_t offset, size_t size) const;
+
 	/** Return a struct within the GFF3. */
 	const GFF3Struct &getStruct(uint32_t i) const;
 	/** Return a list within the GFF3. */
 	const GFF3List   &getList  (uint32_t i) const;
+
+	/** Read the label table, if that hasn't happened yet. */
+	void readLabels() const;
+	/** Return the label with this index. */
+	const Common::UString &getLabel(uint32_t i) const;
+	/** Return the index of this label, or kLabelInvalid if there's no such label. */
+	uint32_t findLabel(const Common::UString &label) const;
 	// '---
 
 	friend class GFF3Struct;
@@ -240,6 +278,24 @@ public:
 	const GFF3List   &getList  (const Common::UString &field) const;
 	// '---
 
+	// .--- Read one field out of every struct in a list
+	/** Read the same integer field out of every struct in a list, in one go.
+	 *
+	 *  The field's label is only looked up once for the whole list. Structs
+	 *  in the list that don't have the field get the default value.
+	 *
+	 *  @return false if there's no such list.
+	 */
+	bool getListUint(const Common::UString &list, const Common::UString &field,
+	                 std::vector<uint32_t> &values, uint32_t def = 0) const;
+	/** Read the same integer field out of every struct in a list, in one go. */
+	bool getListSint(const Common::UString &list, const Common::UString &field,
+	                 std::vector< int32_t> &values,  int32_t def = 0) const;
+	/** Read the same floating point field out of every struct in a list, in one go. */
+	bool getListFloat(const Common::UString &list, const Common::UString &field,
+	                  std::vector<float> &values, float def = 0.0f) const;
+	// '---
+
 private:
 	/** A field in the GFF3 struct. */
 	struct Field {
@@ -251,19 +307,18 @@ private:
 		Field(FieldType t, uint32_t d);
 	};
 
-	typedef std::map<Common::UString, Field> FieldMap;
-
-
 	const GFF3File *_parent; ///< The parent GFF3.
 
 	uint32_t _id;         ///< The struct's ID.
 	uint32_t _fieldIndex; ///< Field / Field indices index.
 	uint32_t _fieldCount; ///< Field count.
 
-	FieldMap _fields; ///< The fields, indexed by their label.
-
-	/** The names of all fields in this struct. */
-	std::vector<Common::UString> _fieldNames;
+	/** The names of all fields in this struct, once they have been requested. */
+	mutable std::vector<Common::UString> _fieldNames;
+	/** The number of uniquely named fields, once the field names have been requested. */
+	mutable size_t _uniqueFieldCount;
+	/** Have the field names been read yet? */
+	mutable bool _hasFieldNames;
 
 
 	// .--- Loader
@@ -271,19 +326,37 @@ private:
 
 	void load(uint32_t offset);
 
-	void readField  (Common::SeekableReadStream &data, uint32_t index);
-	void readFields (Common::SeekableReadStream &data, uint32_t index, uint32_t count);
-	void readIndices(Common::SeekableReadStream &data,
-	                 std::vector<uint32_t> &indices, uint32_t count) const;
+	/** Read the names of all fields, if that hasn't happened yet. */
+	void readFieldNames() const;
+	// '---
+
+	// .--- Raw field access
+	/** Return the raw field definition of the nth field in this struct. */
+	const byte *getRawField(uint32_t n) const;
+	/** Return the raw, 16 byte label of a raw field definition. */
+	const byte *getRawLabel(const byte *rawField) const;
 
-	Common::UString readLabel(Common::SeekableReadStream &data, uint32_t index) const;
+	/** Find a field by comparing labels, when the label table has duplicate labels. */
+	const byte *findRawFieldByName(const Common::UString &name) const;
 	// '---
 
 	// .--- Field and field data accessors
-	/** Returns the field with this tag. */
-	const Field *getField(const Common::UString &name) const;
+	/** Find and decode the field with this tag. Returns false if there's no such field. */
+	bool getField(const Common::UString &name, Field &field) const;
+	/** Find and decode the field with this tag, whose label index was already looked up. */
+	bool getField(const Common::UString &name, uint32_t label, Field &field) const;
+	/** Look up the label index of a field name, if the GFF3's labels are unique. */
+	uint32_t findLabel(const Common::UString &name) const;
 	/** Returns the extended field data for this field. */
 	Common::SeekableReadStream &getData(const Field &field) const;
+
+	uint64_t getUint  (const Field &field) const;
+	 int64_t getSint  (const Field &field) const;
+	double   getDouble(const Field &field) const;
+
+	/** Return a list and the label index of a field to read out of all its structs. */
+	const GFF3List *getListFields(const Common::UString &list, const Common::UString &field,
+	                              uint32_t &label) const;
 	// '---
 
 	friend class GFF3File;
@@ -25,19 +25,16 @@
 #ifndef AURORA_GFF3WRITER_H
 #define AURORA_GFF3WRITER_H
 
-#include <list>
-#include <functional>
+#include <vector>
+#include <unordered_map>
 
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
-#include <boost/variant.hpp>
 
-#ifdef BOOST_COMP_CLANG
-	#define GLM_LANG_STL11_FORCED // Fix clang glm c++11 bug
-#endif // BOOST_COMP_CLANG
 #include "external/glm/glm.hpp"
-#include "external/glm/gtx/hash.hpp"
 
+#include "src/common/types.h"
+#include "src/common/ustring.h"
 #include "src/common/readstream.h"
 #include "src/common/memwritestream.h"
 
@@ -64,95 +61,22 @@ public:
 	void write(Common::WriteStream &stream);
 
 private:
-	struct Vector4 {
-		glm::vec4 vec;
-
-		Vector4(glm::vec4 vector) : vec(vector) {
-		}
-
-		bool operator==(const Vector4 &v)  const {
-			return vec == v.vec;
-		}
-
-		bool operator<(const Vector4 &v) const {
-			std::hash<glm::vec4> h;
-			return h(vec) < h(v.vec);
-		}
-	};
-
-	/** A special struct type for representing void data. */
-	struct VoidData {
-		std::unique_ptr<Common::SeekableReadStream> data;
-
-		VoidData() { }
-
-		VoidData(Common::SeekableReadStream *stream);
-
-		VoidData(const VoidData &voidData) { *this = voidData; }
-
-		VoidData &operator=(const VoidData &rhs);
-
-		bool operator==(const VoidData &rhs) const {
-			return data.get() == rhs.data.get();
-		}
-
-		bool operator<(const VoidData &rhs) const {
-			return std::less<Common::SeekableReadStream*>{}(data.get(), rhs.data.get());
-		}
-	};
-
-	/** A variant containing all possible types of GFF data. */
-	typedef boost::variant<
-		uint32_t,
-		uint64_t,
-		int32_t,
-		int64_t,
-		float,
-		double,
-		Vector4,
-		Common::UString,
-		LocString,
-		VoidData
-	> ValueData;
-
-	class ValueDataLess : public boost::static_visitor<bool> {
-	public:
-		template<typename T, typename U> bool operator()(const T &UNUSED(v1), const U &UNUSED(v2)) const { return false; }
-
-		template<typename T> bool operator()(const T &v1, const T &v2) const { return v1 < v2; }
-	};
-
-	/** A value holds a type and data. */
-	struct Value {
+	/** A field, as it will be written into the field array. */
+	struct Field {
 		GFF3Struct::FieldType type;
-		ValueData data;
-		bool isRaw { false };
-
-		/** Equality operator for std::find. */
-		bool operator==(const Value &rhs) const {
-			return type == rhs.type &&
-			       data == rhs.data;
-		}
-
-		/** Relational operator for map find. */
-		bool operator<(const Value &rhs) const {
-			if (type != rhs.type) {
-				return type < rhs.type;
-			} else if (data.which() != rhs.data.which()) {
-				return data.which() < rhs.data.which();
-			} else {
-				return boost::apply_visitor(ValueDataLess(), data, rhs.data);
-			}
-		}
+		uint32_t labelIndex;
+		/** The value itself, the struct or list index, or the offset into the field data. */
+		uint32_t data;
 	};
 
-	/** An implementation for a field. */
-	struct Field : boost::noncopyable {
-		uint32_t labelIndex;
-		Value value;
+	/** An already written, unique run of field data. */
+	struct FieldDataEntry {
+		uint32_t offset;
+		uint32_t size;
 	};
 
-	typedef boost::shared_ptr<Field> FieldPtr;
+	typedef std::unordered_map<Common::UString, uint32_t, Common::hashUStringCaseSensitive> LabelIndices;
+	typedef std::unordered_multimap<uint64_t, FieldDataEntry> FieldDataEntries;
 
 	uint32_t _id;
 	uint32_t _version;
@@ -161,17 +85,36 @@ private:
 	std::vector<GFF3WriterListPtr> _lists;
 
 	std::vector<Common::UString> _labels;
-	std::vector<FieldPtr> _fields;
+	LabelIndices _labelIndices;
+
+	std::vector<Field> _fields;
+
+	/** The unique field data of all complex fields, in written order. */
+	Common::MemoryWriteStreamDynamic _fieldData;
+	/** Field data already written, by the hash of their contents. */
+	FieldDataEntries _fieldDataEntries;
+	/** Scratch stream the data of a complex field is serialized into. */
+	Common::MemoryWriteStreamDynamic _fieldDataScratch;
+
+	/** The assembled GFF, reused between writes. */
+	std::vector<byte> _buffer;
 
 	friend class GFF3WriterList;
 	friend class GFF3WriterStruct;
 
 	/** Adds a label to the writer and returns the corresponding index. */
 	uint32_t addLabel(const Common::UString &label);
-	/** Get the actual size of the field. */
-	static uint32_t getFieldDataSize(Value field);
 
-	size_t createField(GFF3Struct::FieldType type, const Common::UString &label);
+	/** Create a field whose value is stored in the field itself. */
+	size_t createField(GFF3Struct::FieldType type, const Common::UString &label, uint32_t data);
+
+	/** Start serializing the data of a complex field. */
+	Common::SeekableWriteStream &beginFieldData();
+	/** Create a complex field out of the data serialized since beginFieldData().
+	 *
+	 *  Data identical to an already existing field's data is shared.
+	 */
+	size_t createDataField(GFF3Struct::FieldType type, const Common::UString &label);
 };
 
 /** A GFF3 list containing GFF3 structs. */
@@ -254,7 +197,13 @@ public:
 	void addLocString(const Common::UString &label, const LocString &value);
 
 private:
-	GFF3Writer::FieldPtr createField(GFF3Struct::FieldType type, const Common::UString &label);
+	/** Add a field whose value is stored in the field itself. */
+	void addField(GFF3Struct::FieldType type, const Common::UString &label, uint32_t data);
+	/** Add a field out of the data serialized into the parent's field data scratch. */
+	void addDataField(GFF3Struct::FieldType type, const Common::UString &label);
+	/** Add a field out of a raw stream, prefixed by its size. */
+	void addRawDataField(GFF3Struct::FieldType type, const Common::UString &label,
+	                     Common::SeekableReadStream *value, bool byteSize);
 
 	uint32_t _id;
 	GFF3Writer *_parent;
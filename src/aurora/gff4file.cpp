@@ -28,10 +28,14 @@
 
 #include <cassert>
 
+#include <algorithm>
+
 #include "external/glm/gtc/type_ptr.hpp"
 
 #include "src/common/error.h"
+#include "src/common/util.h"
 #include "src/common/readstream.h"
+#include "src/common/memreadstream.h"
 #include "src/common/encoding.h"
 #include "src/common/strutil.h"
 
@@ -77,7 +81,7 @@ bool GFF4File::Header::isBigEndian() const {
 
 
 GFF4File::GFF4File(Common::SeekableReadStream *gff4, uint32_t type) :
-	_origStream(gff4), _topLevelStruct(0) {
+	_origStream(gff4), _bigEndian(false), _data(0), _dataSize(0), _topLevelStruct(0) {
 
 	assert(_origStream);
 
@@ -85,7 +89,7 @@ GFF4File::GFF4File(Common::SeekableReadStream *gff4, uint32_t type) :
 }
 
 GFF4File::GFF4File(const Common::UString &gff4, FileType fileType, uint32_t type) :
-	_topLevelStruct(0) {
+	_bigEndian(false), _data(0), _dataSize(0), _topLevelStruct(0) {
 
 	_origStream.reset(ResMan.getResource(gff4, fileType));
 	if (!_origStream)
@@ -99,8 +103,11 @@ GFF4File::~GFF4File() {
 }
 
 void GFF4File::clear() {
-	_origStream.reset();
 	_stream.reset();
+	_origStream.reset();
+
+	_data     = 0;
+	_dataSize = 0;
 
 	for (StructMap::iterator s = _structs.begin(); s != _structs.end(); ++s)
 		delete s->second;
@@ -166,7 +173,22 @@ void GFF4File::loadHeader(uint32_t type) {
 
 	_header.read(*_origStream, _version);
 
+	_bigEndian = _header.isBigEndian();
+
 	const size_t pos = _origStream->pos();
+
+	// Keep the whole file in memory, so that fields can be read directly out of it
+	Common::MemoryReadStream *memStream = dynamic_cast<Common::MemoryReadStream *>(_origStream.get());
+	if (!memStream) {
+		_origStream->seek(0);
+
+		memStream = _origStream->readStream(_origStream->size());
+		_origStream.reset(memStream);
+	}
+
+	_data     = memStream->getData();
+	_dataSize = memStream->size();
+
 	_stream = std::make_unique<Common::SeekableSubReadStreamEndian>(_origStream.get(), 0, _origStream->size(), _header.isBigEndian(), false);
 	_stream->seek(pos);
 
@@ -233,6 +255,8 @@ void GFF4File::loadStructs() {
 
 			field.offset = _stream->readUint32();
 		}
+
+		compileLookup(strct);
 	}
 
 	/* And load the top level struct, which itself recurses into field structs.
@@ -241,6 +265,33 @@ void GFF4File::loadStructs() {
 	_topLevelStruct->_refCount++;
 }
 
+void GFF4File::compileLookup(StructTemplate &strct) {
+	/* Sort the template's field labels once, so that every struct made from
+	 * this template can find its fields with a binary search. Should a label
+	 * appear twice, the last field with it wins. */
+
+	FieldLookup sorted;
+	sorted.reserve(strct.fields.size());
+
+	for (size_t i = 0; i < strct.fields.size(); i++)
+		sorted.push_back(std::make_pair(strct.fields[i].label, (uint32_t) i));
+
+	std::stable_sort(sorted.begin(), sorted.end(),
+	                 [](const std::pair<uint32_t, uint32_t> &a, const std::pair<uint32_t, uint32_t> &b) {
+		return a.first < b.first;
+	});
+
+	strct.lookup.clear();
+	strct.lookup.reserve(sorted.size());
+
+	for (FieldLookup::const_iterator l = sorted.begin(); l != sorted.end(); ++l) {
+		if (!strct.lookup.empty() && (strct.lookup.back().first == l->first))
+			strct.lookup.back() = *l;
+		else
+			strct.lookup.push_back(*l);
+	}
+}
+
 void GFF4File::loadStrings() {
 	/* Load the global, shared string table.
 	 *
@@ -290,14 +341,42 @@ GFF4Struct *GFF4File::findStruct(uint64_t id) {
 	return s->second;
 }
 
-Common::SeekableSubReadStreamEndian &GFF4File::getStream(uint32_t offset) const {
-	_stream->seek(offset);
+uint32_t GFF4File::getDataOffset() const {
+	return _header.dataOffset;
+}
 
-	return *_stream;
+const byte *GFF4File::getData(uint32_t offset, size_t size) const {
+	if ((offset > _dataSize) || ((_dataSize - offset) < size))
+		throw Common::Exception("GFF4: Data out of range (%u + %u > %u)",
+		                        offset, (uint) size, (uint) _dataSize);
+
+	return _data + offset;
 }
 
-uint32_t GFF4File::getDataOffset() const {
-	return _header.dataOffset;
+size_t GFF4File::getDataSize() const {
+	return _dataSize;
+}
+
+uint8_t GFF4File::readUint8(uint32_t offset) const {
+	return *getData(offset, 1);
+}
+
+uint16_t GFF4File::readUint16(uint32_t offset) const {
+	const byte *data = getData(offset, 2);
+
+	return _bigEndian ? READ_BE_UINT16(data) : READ_LE_UINT16(data);
+}
+
+uint32_t GFF4File::readUint32(uint32_t offset) const {
+	const byte *data = getData(offset, 4);
+
+	return _bigEndian ? READ_BE_UINT32(data) : READ_LE_UINT32(data);
+}
+
+uint64_t GFF4File::readUint64(uint32_t offset) const {
+	const byte *data = getData(offset, 8);
+
+	return _bigEndian ? READ_BE_UINT64(data) : READ_LE_UINT64(data);
 }
 
 const GFF4File::StructTemplate &GFF4File::getStructTemplate(uint32_t i) const {
@@ -363,7 +442,7 @@ GFF4Struct::Field::Field(uint32_t l, uint16_t t, uint16_t f, uint32_t o, bool g)
 
 
 GFF4Struct::GFF4Struct(GFF4File &parent, uint32_t offset, const GFF4File::StructTemplate &tmplt) :
-	_parent(&parent), _label(tmplt.label), _refCount(0), _fieldCount(0) {
+	_parent(&parent), _label(tmplt.label), _refCount(0), _fieldCount(0), _fieldLookup(&tmplt.lookup) {
 
 	// Constructor for a real struct, from a template
 
@@ -379,7 +458,7 @@ GFF4Struct::GFF4Struct(GFF4File &parent, uint32_t offset, const GFF4File::Struct
 }
 
 GFF4Struct::GFF4Struct(GFF4File &parent, const Field &genericParent) :
-	_parent(&parent), _label(0), _refCount(0), _fieldCount(0) {
+	_parent(&parent), _label(0), _refCount(0), _fieldCount(0), _fieldLookup(&_genericLookup) {
 
 	// Constructor for a generic, converted into a struct
 
@@ -417,7 +496,13 @@ void GFF4Struct::load(GFF4File &parent, uint32_t offset, const GFF4File::StructT
 	 * Go through all the fields in the template and create field
 	 * instances within this struct instance. If the field is itself
 	 * a struct, recursively create a new struct instance for it. If
-	 * the field is a generic, create a struct for it as well. */
+	 * the field is a generic, create a struct for it as well.
+	 *
+	 * The fields are kept in the order of the template, so that the
+	 * template's field lookup table finds them. */
+
+	_fields.resize(tmplt.fields.size());
+	_fieldLabels.reserve(tmplt.fields.size());
 
 	for (size_t i = 0; i < tmplt.fields.size(); i++) {
 		const GFF4File::StructTemplate::Field &field = tmplt.fields[i];
@@ -430,7 +515,7 @@ void GFF4Struct::load(GFF4File &parent, uint32_t offset, const GFF4File::StructT
 			fieldOffset = 0xFFFFFFFF;
 
 		// Load the field and its struct(s), if any
-		Field &f = _fields[field.label] = Field(field.label, field.type, field.flags, fieldOffset);
+		Field &f = _fields[i] = Field(field.label, field.type, field.flags, fieldOffset);
 		if (f.type == kFieldTypeStruct)
 			loadStructs(parent, f);
 		if (f.type == kFieldTypeGeneric)
@@ -440,7 +525,7 @@ void GFF4Struct::load(GFF4File &parent, uint32_t offset, const GFF4File::StructT
 			throw Common::Exception("GFF4: TODO: ASCII string field in a file with shared strings");
 	}
 
-	_fieldCount = _fields.size();
+	_fieldCount = tmplt.lookup.size();
 }
 
 void GFF4Struct::loadStructs(GFF4File &parent, Field &field) {
@@ -464,11 +549,10 @@ void GFF4Struct::loadStructs(GFF4File &parent, Field &field) {
 
 	const GFF4File::StructTemplate &tmplt = parent.getStructTemplate(field.structIndex);
 
-	Common::SeekableSubReadStreamEndian &data = parent.getStream(field.offset);
+	uint32_t structStart = field.offset;
 
-	const uint32_t structCount = getListCount(data, field);
+	const uint32_t structCount = getListCount(structStart, field);
 	const uint32_t structSize  = field.isReference ? 4 : tmplt.size;
-	const uint32_t structStart = data.pos();
 
 	field.structs.resize(structCount, 0);
 	for (uint32_t i = 0; i < structCount; i++) {
@@ -511,27 +595,28 @@ void GFF4Struct::load(GFF4File &parent, const Field &genericParent) {
 
 	static const uint32_t kGenericSize = 8;
 
-	Common::SeekableSubReadStreamEndian &data = parent.getStream(genericParent.offset);
-
-	const uint32_t genericCount = genericParent.isList ? data.readUint32() : 1;
-	const uint32_t genericStart = data.pos();
+	const uint32_t genericCount = genericParent.isList ? parent.readUint32(genericParent.offset) : 1;
+	const uint32_t genericStart = genericParent.offset + (genericParent.isList ? 4 : 0);
 
 	for (uint32_t i = 0; i < genericCount; i++) {
-		data.seek(genericStart + i * kGenericSize);
-
-		const uint32_t typeAndFlags = data.readUint32();
+		const uint32_t typeAndFlags = parent.readUint32(genericStart + i * kGenericSize);
 		const uint16_t fieldType  = (typeAndFlags & 0x0000FFFF);
 		const uint16_t fieldFlags = (typeAndFlags & 0xFFFF0000) >> 16;
 
-		const uint32_t fieldOffset = getDataOffset(genericParent.isReference, data.pos());
+		const uint32_t fieldOffset = getDataOffset(genericParent.isReference, genericStart + i * kGenericSize + 4);
 
 		if (fieldOffset == 0xFFFFFFFF)
 			continue;
 
 		_fieldLabels.push_back(i);
 
+		// Generic elements are labelled by their index, so they're already sorted
+		_genericLookup.push_back(std::make_pair(i, (uint32_t) _fields.size()));
+
 		// Load the field and its struct(s), if any
-		Field &f = _fields[i] = Field(i, fieldType, fieldFlags, fieldOffset, true);
+		_fields.push_back(Field(i, fieldType, fieldFlags, fieldOffset, true));
+
+		Field &f = _fields.back();
 		if (f.type == kFieldTypeStruct)
 			loadStructs(parent, f);
 		if (f.type == kFieldTypeGeneric)
@@ -599,20 +684,23 @@ bool GFF4Struct::getFieldProperties(uint32_t field, FieldType &type, uint32_t &l
 // --- Field value reader helpers ---
 
 const GFF4Struct::Field *GFF4Struct::getField(uint32_t field) const {
-	FieldMap::const_iterator f = _fields.find(field);
-	if (f == _fields.end())
+	GFF4File::FieldLookup::const_iterator l =
+		std::lower_bound(_fieldLookup->begin(), _fieldLookup->end(), field,
+		                 [](const std::pair<uint32_t, uint32_t> &a, uint32_t b) {
+			return a.first < b;
+		});
+
+	if ((l == _fieldLookup->end()) || (l->first != field))
 		return 0;
 
-	return &f->second;
+	return &_fields[l->second];
 }
 
 uint32_t GFF4Struct::getDataOffset(bool isReference, uint32_t offset) const {
 	if (!isReference || (offset == 0xFFFFFFFF))
 		return offset;
 
-	Common::SeekableSubReadStreamEndian &data = _parent->getStream(offset);
-
-	offset = data.readUint32();
+	offset = _parent->readUint32(offset);
 	if (offset == 0xFFFFFFFF)
 		return offset;
 
@@ -626,19 +714,13 @@ uint32_t GFF4Struct::getDataOffset(const Field &field) const {
 	return getDataOffset(field.isReference, field.offset);
 }
 
-Common::SeekableSubReadStreamEndian *GFF4Struct::getData(const Field &field) const {
-	const uint32_t offset = getDataOffset(field);
-	if (offset == 0xFFFFFFFF)
-		return 0;
-
-	return &_parent->getStream(offset);
-}
-
-Common::SeekableSubReadStreamEndian *GFF4Struct::getField(uint32_t fieldID, const Field *&field) const {
+bool GFF4Struct::getFieldData(uint32_t fieldID, const Field *&field, uint32_t &offset) const {
 	if (!(field = getField(fieldID)))
-		return 0;
+		return false;
+
+	offset = getDataOffset(*field);
 
-	return getData(*field);
+	return offset != 0xFFFFFFFF;
 }
 
 uint32_t GFF4Struct::getVectorMatrixLength(const Field &field, uint32_t minLength, uint32_t maxLength) const {
@@ -662,17 +744,22 @@ uint32_t GFF4Struct::getVectorMatrixLength(const Field &field, uint32_t minLengt
 	return length;
 }
 
-uint32_t GFF4Struct::getListCount(Common::SeekableSubReadStreamEndian &data, const Field &field) const {
+uint32_t GFF4Struct::getListCount(uint32_t &offset, const Field &field) const {
 	if (!field.isList)
 		return 1;
 
-	const uint32_t listOffset = data.readUint32();
+	const uint32_t listOffset = _parent->readUint32(offset);
+	offset += 4;
+
 	if (listOffset == 0xFFFFFFFF)
 		return 0;
 
-	data.seek(_parent->getDataOffset() + listOffset);
+	offset = _parent->getDataOffset() + listOffset;
+
+	const uint32_t count = _parent->readUint32(offset);
+	offset += 4;
 
-	return data.readUint32();
+	return count;
 }
 
 uint32_t GFF4Struct::getFieldSize(FieldType type) const {
@@ -726,159 +813,169 @@ uint32_t GFF4Struct::getFieldSize(FieldType type) const {
 
 // --- Low-level value readers ---
 
-uint64_t GFF4Struct::getUint(Common::SeekableSubReadStreamEndian &data, FieldType type) const {
+uint64_t GFF4Struct::readUint(uint32_t &offset, FieldType type) const {
+	const uint32_t size = getFieldSize(type);
+
+	uint64_t value;
 	switch (type) {
 		case kFieldTypeUint8:
-			return (uint64_t) data.readByte();
+			value = (uint64_t) _parent->readUint8(offset);
+			break;
 
 		case kFieldTypeSint8:
-			return (uint64_t) ((int64_t) data.readSByte());
+			value = (uint64_t) ((int64_t) ((int8_t) _parent->readUint8(offset)));
+			break;
 
 		case kFieldTypeUint16:
-			return (uint64_t) data.readUint16();
+			value = (uint64_t) _parent->readUint16(offset);
+			break;
 
 		case kFieldTypeSint16:
-			return (uint64_t) ((int64_t) data.readSint16());
+			value = (uint64_t) ((int64_t) ((int16_t) _parent->readUint16(offset)));
+			break;
 
 		case kFieldTypeUint32:
-			return (uint64_t) data.readUint32();
+			value = (uint64_t) _parent->readUint32(offset);
+			break;
 
 		case kFieldTypeSint32:
-			return (uint64_t) ((int64_t) data.readSint32());
+			value = (uint64_t) ((int64_t) ((int32_t) _parent->readUint32(offset)));
+			break;
 
 		case kFieldTypeUint64:
-			return (uint64_t) data.readUint64();
-
 		case kFieldTypeSint64:
-			return (uint64_t) ((int64_t) data.readSint64());
+			value = _parent->readUint64(offset);
+			break;
 
 		default:
-			break;
+			throw Common::Exception("GFF4: Field is not an int type");
 	}
 
-	throw Common::Exception("GFF4: Field is not an int type");
+	offset += size;
+	return value;
 }
 
-int64_t GFF4Struct::getSint(Common::SeekableSubReadStreamEndian &data, FieldType type) const {
+int64_t GFF4Struct::readSint(uint32_t &offset, FieldType type) const {
+	const uint32_t size = getFieldSize(type);
+
+	int64_t value;
 	switch (type) {
 		case kFieldTypeUint8:
-			return (int64_t) ((uint64_t) data.readByte());
+			value = (int64_t) ((uint64_t) _parent->readUint8(offset));
+			break;
 
 		case kFieldTypeSint8:
-			return (int64_t) data.readSByte();
+			value = (int64_t) ((int8_t) _parent->readUint8(offset));
+			break;
 
 		case kFieldTypeUint16:
-			return (int64_t) ((uint64_t) data.readUint16());
+			value = (int64_t) ((uint64_t) _parent->readUint16(offset));
+			break;
 
 		case kFieldTypeSint16:
-			return (int64_t) data.readSint16();
+			value = (int64_t) ((int16_t) _parent->readUint16(offset));
+			break;
 
 		case kFieldTypeUint32:
-			return (int64_t) ((uint64_t) data.readUint32());
+			value = (int64_t) ((uint64_t) _parent->readUint32(offset));
+			break;
 
 		case kFieldTypeSint32:
-			return (int64_t) data.readSint32();
+			value = (int64_t) ((int32_t) _parent->readUint32(offset));
+			break;
 
 		case kFieldTypeUint64:
-			return (int64_t) ((uint64_t) data.readUint64());
-
 		case kFieldTypeSint64:
-			return (int64_t) data.readSint64();
+			value = (int64_t) _parent->readUint64(offset);
+			break;
 
 		default:
-			break;
+			throw Common::Exception("GFF4: Field is not an int type");
 	}
 
-	throw Common::Exception("GFF4: Field is not an int type");
+	offset += size;
+	return value;
 }
 
-double GFF4Struct::getDouble(Common::SeekableSubReadStreamEndian &data, FieldType type) const {
+double GFF4Struct::readDouble(uint32_t &offset, FieldType type) const {
+	double value;
 	switch (type) {
 		case kFieldTypeFloat32:
-			return (double) data.readIEEEFloat();
+			value = (double) convertIEEEFloat(_parent->readUint32(offset));
+			offset += 4;
+			break;
 
 		case kFieldTypeFloat64:
-			return (double) data.readIEEEDouble();
+			value = convertIEEEDouble(_parent->readUint64(offset));
+			offset += 8;
+			break;
 
 		case kFieldTypeNDSFixed:
-			return readNintendoFixedPoint(data.readUint32(), true, 19, 12);
+			value = readNintendoFixedPoint(_parent->readUint32(offset), true, 19, 12);
+			offset += 4;
+			break;
 
 		default:
-			break;
+			throw Common::Exception("GFF4: Field is not a float type");
 	}
 
-	throw Common::Exception("GFF4: Field is not a float type");
+	return value;
 }
 
-float GFF4Struct::getFloat(Common::SeekableSubReadStreamEndian &data, FieldType type) const {
-	switch (type) {
-		case kFieldTypeFloat32:
-			return (float) data.readIEEEFloat();
-
-		case kFieldTypeFloat64:
-			return (float) data.readIEEEDouble();
-
-		case kFieldTypeNDSFixed:
-			return (float) readNintendoFixedPoint(data.readUint32(), true, 19, 12);
+float GFF4Struct::readFloat(uint32_t &offset, FieldType type) const {
+	if (type == kFieldTypeFloat32) {
+		const float value = convertIEEEFloat(_parent->readUint32(offset));
+		offset += 4;
 
-		default:
-			break;
+		return value;
 	}
 
-	throw Common::Exception("GFF4: Field is not a float type");
+	return (float) readDouble(offset, type);
 }
 
-Common::UString GFF4Struct::getString(Common::SeekableSubReadStreamEndian &data, Common::Encoding encoding) const {
+Common::UString GFF4Struct::readString(uint32_t offset, Common::Encoding encoding) const {
 	/* When the string is encoded in UTF-8, then length field specifies the length in bytes.
 	 * Otherwise, it's the length in characters. */
 	const size_t lengthMult = encoding == Common::kEncodingUTF8 ? 1 : Common::getBytesPerCodepoint(encoding);
 
-	const size_t offset = data.pos();
+	const uint32_t length = _parent->readUint32(offset);
 
-	const uint32_t length = data.readUint32();
-	const size_t   size   = length * lengthMult;
+	// Just like reading out of a stream, a string running past the end is cut short
+	const size_t start = offset + 4;
+	const size_t size  = MIN<size_t>(length * lengthMult, _parent->getDataSize() - start);
 
 	try {
-		return Common::readStringFixed(data, encoding, size);
+		return Common::readString(_parent->getData(start, size), size, encoding);
 	} catch (...) {
 	}
 
 	return Common::UString::format("GFF4: Invalid string encoding (0x%08X)", (uint) offset);
 }
 
-Common::UString GFF4Struct::getString(Common::SeekableSubReadStreamEndian &data, Common::Encoding encoding,
-                                      uint32_t offset) const {
-
-	const uint32_t pos = data.seek(offset);
-
-	Common::UString str = getString(data, encoding);
-
-	data.seek(pos);
-
-	return str;
-}
+Common::UString GFF4Struct::readString(uint32_t &offset, const Field &field, Common::Encoding encoding) const {
+	if (field.type == kFieldTypeString) {
+		if (_parent->hasSharedStrings()) {
+			const uint32_t index = _parent->readUint32(offset);
+			offset += 4;
 
-Common::UString GFF4Struct::getString(Common::SeekableSubReadStreamEndian &data, const Field &field,
-                                      Common::Encoding encoding) const {
+			return _parent->getSharedString(index);
+		}
 
-	if (field.type == kFieldTypeString) {
-		if (_parent->hasSharedStrings())
-			return _parent->getSharedString(data.readUint32());
+		// Strings in generics are stored in place
+		if (field.isGeneric)
+			return readString(offset, encoding);
 
-		uint32_t offset = data.pos();
-		if (!field.isGeneric) {
-			offset = data.readUint32();
-			if (offset == 0xFFFFFFFF)
-				return "";
+		uint32_t strOffset = _parent->readUint32(offset);
+		offset += 4;
 
-			offset += _parent->getDataOffset();
-		}
+		if (strOffset == 0xFFFFFFFF)
+			return "";
 
-		return getString(data, encoding, offset);
+		return readString(_parent->getDataOffset() + strOffset, encoding);
 	}
 
 	if (field.type == kFieldTypeASCIIString)
-		return getString(data, Common::kEncodingASCII, data.pos());
+		return readString(offset, Common::kEncodingASCII);
 
 	throw Common::Exception("GFF4: Field is not a string type");
 }
@@ -887,26 +984,26 @@ Common::UString GFF4Struct::getString(Common::SeekableSubReadStreamEndian &data,
 
 uint64_t GFF4Struct::getUint(uint32_t field, uint64_t def) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return def;
 
 	if (f->isList)
 		throw Common::Exception("GFF4: Tried reading list as singular value");
 
-	return getUint(*data, f->type);
+	return readUint(offset, f->type);
 }
 
 int64_t GFF4Struct::getSint(uint32_t field, int64_t def) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return def;
 
 	if (f->isList)
 		throw Common::Exception("GFF4: Tried reading list as singular value");
 
-	return getSint(*data, f->type);
+	return readSint(offset, f->type);
 }
 
 bool GFF4Struct::getBool(uint32_t field, bool def) const {
@@ -915,40 +1012,40 @@ bool GFF4Struct::getBool(uint32_t field, bool def) const {
 
 double GFF4Struct::getDouble(uint32_t field, double def) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return def;
 
 	if (f->isList)
 		throw Common::Exception("GFF4: Tried reading list as singular value");
 
-	return getDouble(*data, f->type);
+	return readDouble(offset, f->type);
 }
 
 float GFF4Struct::getFloat(uint32_t field, float def) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return def;
 
 	if (f->isList)
 		throw Common::Exception("GFF4: Tried reading list as singular value");
 
-	return getFloat(*data, f->type);
+	return readFloat(offset, f->type);
 }
 
 Common::UString GFF4Struct::getString(uint32_t field, Common::Encoding encoding,
                                       const Common::UString &def) const {
 
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return def;
 
 	if (f->isList)
 		throw Common::Exception("GFF4: Tried reading list as singular value");
 
-	return getString(*data, *f, encoding);
+	return readString(offset, *f, encoding);
 }
 
 Common::UString GFF4Struct::getString(uint32_t field, const Common::UString &def) const {
@@ -959,8 +1056,8 @@ bool GFF4Struct::getTalkString(uint32_t field, Common::Encoding encoding,
                                uint32_t &strRef, Common::UString &str) const {
 
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
 	if (f->type != kFieldTypeTlkString)
@@ -968,16 +1065,16 @@ bool GFF4Struct::getTalkString(uint32_t field, Common::Encoding encoding,
 	if (f->isList)
 		throw Common::Exception("GFF4: Tried reading list as singular value");
 
-	strRef = getUint(*data, kFieldTypeUint32);
+	strRef = readUint(offset, kFieldTypeUint32);
 
-	const uint32_t offset = getUint(*data, kFieldTypeUint32);
+	const uint32_t strOffset = readUint(offset, kFieldTypeUint32);
 
 	str.clear();
-	if (offset != 0xFFFFFFFF) {
+	if (strOffset != 0xFFFFFFFF) {
 		if (_parent->hasSharedStrings())
-			str = _parent->getSharedString(offset);
-		else if (offset != 0)
-			str = getString(*data, encoding, _parent->getDataOffset() + offset);
+			str = _parent->getSharedString(strOffset);
+		else if (strOffset != 0)
+			str = readString(_parent->getDataOffset() + strOffset, encoding);
 	}
 
 	return true;
@@ -989,8 +1086,8 @@ bool GFF4Struct::getTalkString(uint32_t field, uint32_t &strRef, Common::UString
 
 bool GFF4Struct::getVector3(uint32_t field, double &v1, double &v2, double &v3) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
 	if (f->isList)
@@ -998,17 +1095,17 @@ bool GFF4Struct::getVector3(uint32_t field, double &v1, double &v2, double &v3)
 
 	getVectorMatrixLength(*f, 3, 3);
 
-	v1 = getDouble(*data, kFieldTypeFloat32);
-	v2 = getDouble(*data, kFieldTypeFloat32);
-	v3 = getDouble(*data, kFieldTypeFloat32);
+	v1 = readDouble(offset, kFieldTypeFloat32);
+	v2 = readDouble(offset, kFieldTypeFloat32);
+	v3 = readDouble(offset, kFieldTypeFloat32);
 
 	return true;
 }
 
 bool GFF4Struct::getVector3(uint32_t field, float &v1, float &v2, float &v3) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
 	if (f->isList)
@@ -1016,17 +1113,17 @@ bool GFF4Struct::getVector3(uint32_t field, float &v1, float &v2, float &v3) con
 
 	getVectorMatrixLength(*f, 3, 3);
 
-	v1 = getFloat(*data, kFieldTypeFloat32);
-	v2 = getFloat(*data, kFieldTypeFloat32);
-	v3 = getFloat(*data, kFieldTypeFloat32);
+	v1 = readFloat(offset, kFieldTypeFloat32);
+	v2 = readFloat(offset, kFieldTypeFloat32);
+	v3 = readFloat(offset, kFieldTypeFloat32);
 
 	return true;
 }
 
 bool GFF4Struct::getVector4(uint32_t field, double &v1, double &v2, double &v3, double &v4) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
 	if (f->isList)
@@ -1034,18 +1131,18 @@ bool GFF4Struct::getVector4(uint32_t field, double &v1, double &v2, double &v3,
 
 	getVectorMatrixLength(*f, 4, 4);
 
-	v1 = getDouble(*data, kFieldTypeFloat32);
-	v2 = getDouble(*data, kFieldTypeFloat32);
-	v3 = getDouble(*data, kFieldTypeFloat32);
-	v4 = getDouble(*data, kFieldTypeFloat32);
+	v1 = readDouble(offset, kFieldTypeFloat32);
+	v2 = readDouble(offset, kFieldTypeFloat32);
+	v3 = readDouble(offset, kFieldTypeFloat32);
+	v4 = readDouble(offset, kFieldTypeFloat32);
 
 	return true;
 }
 
 bool GFF4Struct::getVector4(uint32_t field, float &v1, float &v2, float &v3, float &v4) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
 	if (f->isList)
@@ -1053,18 +1150,18 @@ bool GFF4Struct::getVector4(uint32_t field, float &v1, float &v2, float &v3, flo
 
 	getVectorMatrixLength(*f, 4, 4);
 
-	v1 = getFloat(*data, kFieldTypeFloat32);
-	v2 = getFloat(*data, kFieldTypeFloat32);
-	v3 = getFloat(*data, kFieldTypeFloat32);
-	v4 = getFloat(*data, kFieldTypeFloat32);
+	v1 = readFloat(offset, kFieldTypeFloat32);
+	v2 = readFloat(offset, kFieldTypeFloat32);
+	v3 = readFloat(offset, kFieldTypeFloat32);
+	v4 = readFloat(offset, kFieldTypeFloat32);
 
 	return true;
 }
 
 bool GFF4Struct::getMatrix4x4(uint32_t field, double (&m)[16]) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
 	if (f->isList)
@@ -1072,15 +1169,15 @@ bool GFF4Struct::getMatrix4x4(uint32_t field, double (&m)[16]) const {
 
 	const uint32_t length = getVectorMatrixLength(*f, 16, 16);
 	for (uint32_t i = 0; i < length; i++)
-		m[i] = getDouble(*data, kFieldTypeFloat32);
+		m[i] = readDouble(offset, kFieldTypeFloat32);
 
 	return true;
 }
 
 bool GFF4Struct::getMatrix4x4(uint32_t field, float (&m)[16]) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
 	if (f->isList)
@@ -1088,7 +1185,7 @@ bool GFF4Struct::getMatrix4x4(uint32_t field, float (&m)[16]) const {
 
 	const uint32_t length = getVectorMatrixLength(*f, 16, 16);
 	for (uint32_t i = 0; i < length; i++)
-		m[i] = getFloat(*data, kFieldTypeFloat32);
+		m[i] = readFloat(offset, kFieldTypeFloat32);
 
 	return true;
 }
@@ -1104,8 +1201,8 @@ bool GFF4Struct::getMatrix4x4(uint32_t field, glm::mat4 &m) const {
 
 bool GFF4Struct::getVectorMatrix(uint32_t field, std::vector<double> &vectorMatrix) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
 	if (f->isList)
@@ -1115,15 +1212,15 @@ bool GFF4Struct::getVectorMatrix(uint32_t field, std::vector<double> &vectorMatr
 
 	vectorMatrix.resize(length);
 	for (uint32_t i = 0; i < length; i++)
-		vectorMatrix[i] = getDouble(*data, kFieldTypeFloat32);
+		vectorMatrix[i] = readDouble(offset, kFieldTypeFloat32);
 
 	return true;
 }
 
 bool GFF4Struct::getVectorMatrix(uint32_t field, std::vector<float> &vectorMatrix) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
 	if (f->isList)
@@ -1133,84 +1230,187 @@ bool GFF4Struct::getVectorMatrix(uint32_t field, std::vector<float> &vectorMatri
 
 	vectorMatrix.resize(length);
 	for (uint32_t i = 0; i < length; i++)
-		vectorMatrix[i] = getFloat(*data, kFieldTypeFloat32);
+		vectorMatrix[i] = readFloat(offset, kFieldTypeFloat32);
 
 	return true;
 }
 
+// --- Array readers ---
+
+template<typename T>
+void GFF4Struct::readIntArray(uint32_t offset, FieldType type, uint32_t count, T *values) const {
+	/* Check that the whole array is there once, then convert the values
+	 * straight out of the GFF4 data. Signed values are sign-extended. */
+
+	if (count == 0)
+		return;
+
+	const uint32_t size = getFieldSize(type);
+	if ((type > kFieldTypeSint64) || (size == 0))
+		throw Common::Exception("GFF4: Field is not an int type");
+
+	const byte *data = _parent->getData(offset, (size_t) count * size);
+	const bool bigEndian = _parent->isBigEndian();
+
+	switch (type) {
+		case kFieldTypeUint8:
+			for (uint32_t i = 0; i < count; i++)
+				values[i] = (T) data[i];
+			break;
+
+		case kFieldTypeSint8:
+			for (uint32_t i = 0; i < count; i++)
+				values[i] = (T) ((int8_t) data[i]);
+			break;
+
+		case kFieldTypeUint16:
+			for (uint32_t i = 0; i < count; i++, data += 2)
+				values[i] = (T) (bigEndian ? READ_BE_UINT16(data) : READ_LE_UINT16(data));
+			break;
+
+		case kFieldTypeSint16:
+			for (uint32_t i = 0; i < count; i++, data += 2)
+				values[i] = (T) ((int16_t) (bigEndian ? READ_BE_UINT16(data) : READ_LE_UINT16(data)));
+			break;
+
+		case kFieldTypeUint32:
+			for (uint32_t i = 0; i < count; i++, data += 4)
+				values[i] = (T) (bigEndian ? READ_BE_UINT32(data) : READ_LE_UINT32(data));
+			break;
+
+		case kFieldTypeSint32:
+			for (uint32_t i = 0; i < count; i++, data += 4)
+				values[i] = (T) ((int32_t) (bigEndian ? READ_BE_UINT32(data) : READ_LE_UINT32(data)));
+			break;
+
+		default:
+			for (uint32_t i = 0; i < count; i++, data += 8)
+				values[i] = (T) (bigEndian ? READ_BE_UINT64(data) : READ_LE_UINT64(data));
+			break;
+	}
+}
+
+template<typename T>
+void GFF4Struct::readFloatArray(uint32_t offset, FieldType type, uint32_t count, T *values) const {
+	if (count == 0)
+		return;
+
+	const bool bigEndian = _parent->isBigEndian();
+
+	switch (type) {
+		case kFieldTypeFloat32: {
+				const byte *data = _parent->getData(offset, (size_t) count * 4);
+
+				for (uint32_t i = 0; i < count; i++, data += 4)
+					values[i] = (T) convertIEEEFloat(bigEndian ? READ_BE_UINT32(data) : READ_LE_UINT32(data));
+			}
+			break;
+
+		case kFieldTypeFloat64: {
+				const byte *data = _parent->getData(offset, (size_t) count * 8);
+
+				for (uint32_t i = 0; i < count; i++, data += 8)
+					values[i] = (T) convertIEEEDouble(bigEndian ? READ_BE_UINT64(data) : READ_LE_UINT64(data));
+			}
+			break;
+
+		case kFieldTypeNDSFixed: {
+				const byte *data = _parent->getData(offset, (size_t) count * 4);
+
+				for (uint32_t i = 0; i < count; i++, data += 4)
+					values[i] = (T) readNintendoFixedPoint(bigEndian ? READ_BE_UINT32(data) : READ_LE_UINT32(data),
+					                                       true, 19, 12);
+			}
+			break;
+
+		default:
+			throw Common::Exception("GFF4: Field is not a float type");
+	}
+}
+
 // --- List value readers ---
 
 bool GFF4Struct::getUint(uint32_t field, std::vector<uint64_t> &list) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
-	const uint32_t count = getListCount(*data, *f);
+	const uint32_t count = getListCount(offset, *f);
 
 	list.resize(count);
-	for (uint32_t i = 0; i < count; i++)
-		list[i] = getUint(*data, f->type);
+	readIntArray(offset, f->type, count, list.data());
+
+	return true;
+}
+
+bool GFF4Struct::getUint(uint32_t field, std::vector<uint32_t> &list) const {
+	const Field *f;
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
+		return false;
+
+	const uint32_t count = getListCount(offset, *f);
+
+	list.resize(count);
+	readIntArray(offset, f->type, count, list.data());
 
 	return true;
 }
 
 bool GFF4Struct::getSint(uint32_t field, std::vector<int64_t> &list) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
-	const uint32_t count = getListCount(*data, *f);
+	const uint32_t count = getListCount(offset, *f);
 
 	list.resize(count);
-	for (uint32_t i = 0; i < count; i++)
-		list[i] = getSint(*data, f->type);
+	readIntArray(offset, f->type, count, list.data());
 
 	return true;
 }
 
 bool GFF4Struct::getBool(uint32_t field, std::vector<bool> &list) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
-	const uint32_t count = getListCount(*data, *f);
+	const uint32_t count = getListCount(offset, *f);
 
 	list.resize(count);
 	for (uint32_t i = 0; i < count; i++)
-		list[i] = getUint(*data, f->type) != 0;
+		list[i] = readUint(offset, f->type) != 0;
 
 	return true;
 }
 
 bool GFF4Struct::getDouble(uint32_t field, std::vector<double> &list) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
-	const uint32_t count = getListCount(*data, *f);
+	const uint32_t count = getListCount(offset, *f);
 
 	list.resize(count);
-	for (uint32_t i = 0; i < count; i++)
-		list[i] = getDouble(*data, f->type);
+	readFloatArray(offset, f->type, count, list.data());
 
 	return true;
 }
 
 bool GFF4Struct::getFloat(uint32_t field, std::vector<float> &list) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
-	const uint32_t count = getListCount(*data, *f);
+	const uint32_t count = getListCount(offset, *f);
 
 	list.resize(count);
-	for (uint32_t i = 0; i < count; i++)
-		list[i] = getFloat(*data, f->type);
+	readFloatArray(offset, f->type, count, list.data());
 
 	return true;
 }
@@ -1219,8 +1419,8 @@ bool GFF4Struct::getString(uint32_t field, Common::Encoding encoding,
                            std::vector<Common::UString> &list) const {
 
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data) {
+	uint32_t offset;
+	if (!getFieldData(field, f, offset)) {
 		if (f && !f->isList) {
 			list.push_back("");
 			return true;
@@ -1229,11 +1429,11 @@ bool GFF4Struct::getString(uint32_t field, Common::Encoding encoding,
 		return false;
 	}
 
-	const uint32_t count = getListCount(*data, *f);
+	const uint32_t count = getListCount(offset, *f);
 
 	list.resize(count);
 	for (uint32_t i = 0; i < count; i++)
-		list[i] = getString(*data, *f, encoding);
+		list[i] = readString(offset, *f, encoding);
 
 	return true;
 }
@@ -1247,31 +1447,28 @@ bool GFF4Struct::getTalkString(uint32_t field, Common::Encoding encoding,
 
 
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
 	if (f->type != kFieldTypeTlkString)
 		throw Common::Exception("GFF4: Field is not of TalkString type");
 
-	const uint32_t count = getListCount(*data, *f);
+	const uint32_t count = getListCount(offset, *f);
 
 	strRefs.resize(count);
 	strs.resize(count);
 
-	std::vector<uint32_t> offsets;
-	offsets.resize(count);
-
 	for (uint32_t i = 0; i < count; i++) {
-		strRefs[i] = getUint(*data, kFieldTypeUint32);
+		strRefs[i] = readUint(offset, kFieldTypeUint32);
 
-		const uint32_t offset = getUint(*data, kFieldTypeUint32);
+		const uint32_t strOffset = readUint(offset, kFieldTypeUint32);
 
-		if (offset != 0xFFFFFFFF) {
+		if (strOffset != 0xFFFFFFFF) {
 			if (_parent->hasSharedStrings())
-				strs[i] = _parent->getSharedString(offset);
-			else if (offset != 0)
-				strs[i] = getString(*data, encoding, _parent->getDataOffset() + offset);
+				strs[i] = _parent->getSharedString(strOffset);
+			else if (strOffset != 0)
+				strs[i] = readString(_parent->getDataOffset() + strOffset, encoding);
 		}
 	}
 
@@ -1286,19 +1483,17 @@ bool GFF4Struct::getTalkString(uint32_t field,
 
 bool GFF4Struct::getVectorMatrix(uint32_t field, std::vector< std::vector<double> > &list) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
 	const uint32_t length = getVectorMatrixLength(*f, 0, 16);
-	const uint32_t count  = getListCount(*data, *f);
+	const uint32_t count  = getListCount(offset, *f);
 
 	list.resize(count);
-	for (uint32_t i = 0; i < count; i++) {
-
+	for (uint32_t i = 0; i < count; i++, offset += length * 4) {
 		list[i].resize(length);
-		for (uint32_t j = 0; j < length; j++)
-			list[i][j] = getDouble(*data, kFieldTypeFloat32);
+		readFloatArray(offset, kFieldTypeFloat32, length, list[i].data());
 	}
 
 	return true;
@@ -1306,39 +1501,53 @@ bool GFF4Struct::getVectorMatrix(uint32_t field, std::vector< std::vector<double
 
 bool GFF4Struct::getVectorMatrix(uint32_t field, std::vector< std::vector<float> > &list) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
 	const uint32_t length = getVectorMatrixLength(*f, 0, 16);
-	const uint32_t count  = getListCount(*data, *f);
+	const uint32_t count  = getListCount(offset, *f);
 
 	list.resize(count);
-	for (uint32_t i = 0; i < count; i++) {
-
+	for (uint32_t i = 0; i < count; i++, offset += length * 4) {
 		list[i].resize(length);
-		for (uint32_t j = 0; j < length; j++)
-			list[i][j] = getFloat(*data, kFieldTypeFloat32);
+		readFloatArray(offset, kFieldTypeFloat32, length, list[i].data());
 	}
 
 	return true;
 }
 
+bool GFF4Struct::getVectorMatrix(uint32_t field, std::vector<float> &list, uint32_t &length) const {
+	const Field *f;
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
+		return false;
+
+	length = getVectorMatrixLength(*f, 0, 16);
+
+	const uint32_t count = getListCount(offset, *f);
+
+	list.resize((size_t) count * length);
+	readFloatArray(offset, kFieldTypeFloat32, count * length, list.data());
+
+	return true;
+}
+
 bool GFF4Struct::getMatrix4x4(uint32_t field, std::vector<glm::mat4> &list) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return false;
 
 	const uint32_t length = getVectorMatrixLength(*f, 0, 16);
-	const uint32_t count  = getListCount(*data, *f);
+	const uint32_t count  = getListCount(offset, *f);
 
 	list.resize(count);
 	for (uint32_t i = 0; i < count; i++) {
 		float m[16];
 
 		for (uint32_t j = 0; j < length; j++)
-			m[j] = getFloat(*data, kFieldTypeFloat32);
+			m[j] = readFloat(offset, kFieldTypeFloat32);
 
 		list[i] = glm::make_mat4(m);
 	}
@@ -1397,25 +1606,26 @@ const GFF4List &GFF4Struct::getList(uint32_t field) const {
 
 Common::SeekableReadStream *GFF4Struct::getData(uint32_t field) const {
 	const Field *f;
-	Common::SeekableSubReadStreamEndian *data = getField(field, f);
-	if (!data)
+	uint32_t offset;
+	if (!getFieldData(field, f, offset))
 		return 0;
 
-	const uint32_t count = getListCount(*data, *f);
+	const uint32_t count = getListCount(offset, *f);
 	const uint32_t size  = getFieldSize(f->type);
 
 	if ((size == 0) || (count == 0))
 		return 0;
 
 	const size_t dataSize  = count * size;
-	const size_t dataBegin = data->pos();
-	const size_t dataEnd   = data->pos() + dataSize;
+	const size_t dataBegin = offset;
+	const size_t totalSize = _parent->getDataSize();
 
-	if ((dataBegin >= data->size()) || ((data->size() - dataBegin) < dataSize))
+	if ((dataBegin >= totalSize) || ((totalSize - dataBegin) < dataSize))
 		throw Common::Exception("Invalid data offset (%u, %u, %u)",
-		                        (uint) dataBegin, (uint) dataSize, (uint) data->size());
+		                        (uint) dataBegin, (uint) dataSize, (uint) totalSize);
 
-	return new Common::SeekableSubReadStream(data, dataBegin, dataEnd);
+	// Point right into the GFF4 data, without copying it
+	return new Common::MemoryReadStream(_parent->getData(dataBegin, dataSize), dataSize);
 }
 
 } // End of namespace Aurora
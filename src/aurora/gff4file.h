@@ -138,6 +138,9 @@ private:
 		bool isBigEndian() const;
 	};
 
+	/** Field labels, sorted, each with the index of the field it belongs to. */
+	typedef std::vector< std::pair<uint32_t, uint32_t> > FieldLookup;
+
 	/** A template of a struct, used when loading a struct. */
 	struct StructTemplate {
 		struct Field {
@@ -152,6 +155,9 @@ private:
 		uint32_t size;
 
 		std::vector<Field> fields;
+
+		/** Where to find each field in structs of this template, by label. */
+		FieldLookup lookup;
 	};
 
 	typedef std::vector<StructTemplate> StructTemplates;
@@ -165,6 +171,14 @@ private:
 
 	/** This GFF4's header. */
 	Header          _header;
+	/** Is this GFF4's data big endian? */
+	bool            _bigEndian;
+
+	/** The whole GFF4 file, kept in memory to read fields directly out of it. */
+	const byte *_data;
+	/** The size of the GFF4 file in bytes. */
+	size_t      _dataSize;
+
 	/** All struct templates in this GFF4. */
 	StructTemplates _structTemplates;
 
@@ -183,6 +197,8 @@ private:
 	void loadStructs();
 	void loadStrings();
 
+	static void compileLookup(StructTemplate &strct);
+
 	void clear();
 	// '---
 
@@ -191,10 +207,19 @@ private:
 	void unregisterStruct(uint64_t id);
 	GFF4Struct *findStruct(uint64_t id);
 
-	Common::SeekableSubReadStreamEndian &getStream(uint32_t offset) const;
 	const StructTemplate &getStructTemplate(uint32_t i) const;
 	uint32_t getDataOffset() const;
 
+	/** Return size bytes of the GFF4 data at this offset, throwing if they're out of range. */
+	const byte *getData(uint32_t offset, size_t size) const;
+	/** Return the size of the GFF4 data. */
+	size_t getDataSize() const;
+
+	uint8_t  readUint8 (uint32_t offset) const;
+	uint16_t readUint16(uint32_t offset) const;
+	uint32_t readUint32(uint32_t offset) const;
+	uint64_t readUint64(uint32_t offset) const;
+
 	bool hasSharedStrings() const;
 	Common::UString getSharedString(uint32_t i) const;
 	// '---
@@ -310,6 +335,8 @@ public:
 
 	// .--- Lists of values
 	bool getUint(uint32_t field, std::vector<uint64_t> &list) const;
+	/** Return a list of integers as 32-bit values, cutting off what doesn't fit. */
+	bool getUint(uint32_t field, std::vector<uint32_t> &list) const;
 	bool getSint(uint32_t field, std::vector< int64_t> &list) const;
 	bool getBool(uint32_t field, std::vector<bool  > &list) const;
 
@@ -334,6 +361,11 @@ public:
 	bool getVectorMatrix(uint32_t field, std::vector< std::vector<double> > &list) const;
 	/** Return field vector or a matrix types as std::vectors of floats. */
 	bool getVectorMatrix(uint32_t field, std::vector< std::vector<float > > &list) const;
+	/** Return field vector or a matrix types as one flat array of floats, one after the other.
+	 *
+	 *  @param length Set to the number of floats in each vector or matrix.
+	 */
+	bool getVectorMatrix(uint32_t field, std::vector<float> &list, uint32_t &length) const;
 
 	bool getMatrix4x4(uint32_t field, std::vector<glm::mat4> &list) const;
 	// '---
@@ -345,7 +377,8 @@ public:
 	// '---
 
 	// .--- Raw data
-	/** Return the raw data of the field as a Seekable(Sub)ReadStream. Dangerous. */
+	/** Return the raw data of the field as a SeekableReadStream, directly over the GFF4 data.
+	 *  The stream is only valid as long as the GFF4File exists. */
 	Common::SeekableReadStream *getData(uint32_t field) const;
 	// '---
 
@@ -368,7 +401,7 @@ private:
 		~Field() = default;
 	};
 
-	typedef std::map<uint32_t, Field> FieldMap;
+	typedef std::vector<Field> Fields;
 
 
 	const GFF4File *_parent;
@@ -380,7 +413,13 @@ private:
 
 	size_t _fieldCount;
 
-	FieldMap _fields;
+	/** All fields, in the order of the struct template. */
+	Fields _fields;
+
+	/** Where to find each field, by label. Shared with all structs of the same template. */
+	const GFF4File::FieldLookup *_fieldLookup;
+	/** The field lookup of a generic, which has no template. */
+	GFF4File::FieldLookup _genericLookup;
 
 	/** The labels of all fields in this struct. */
 	std::vector<uint32_t> _fieldLabels;
@@ -408,25 +447,35 @@ private:
 	uint32_t getDataOffset(bool isReference, uint32_t offset) const;
 	uint32_t getDataOffset(const Field &field) const;
 
-	Common::SeekableSubReadStreamEndian *getData(const Field &field) const;
-	Common::SeekableSubReadStreamEndian *getField(uint32_t fieldID, const Field *&field) const;
+	/** Find a field and the offset of its data.
+	 *
+	 *  @return true if the field has data. field is 0 if it doesn't exist.
+	 */
+	bool getFieldData(uint32_t fieldID, const Field *&field, uint32_t &offset) const;
 	// '---
 
 	// .--- Field reader helpers
-	uint32_t getListCount(Common::SeekableSubReadStreamEndian &data, const Field &field) const;
+	/* These read directly out of the GFF4 data in memory, advancing the
+	 * offset past what they read, just like a stream would. */
+
+	uint32_t getListCount(uint32_t &offset, const Field &field) const;
 	uint32_t getFieldSize(FieldType type) const;
 
-	uint64_t getUint(Common::SeekableSubReadStreamEndian &data, FieldType type) const;
-	 int64_t getSint(Common::SeekableSubReadStreamEndian &data, FieldType type) const;
+	uint64_t readUint(uint32_t &offset, FieldType type) const;
+	 int64_t readSint(uint32_t &offset, FieldType type) const;
+
+	double readDouble(uint32_t &offset, FieldType type) const;
+	float  readFloat (uint32_t &offset, FieldType type) const;
 
-	double getDouble(Common::SeekableSubReadStreamEndian &data, FieldType type) const;
-	float  getFloat (Common::SeekableSubReadStreamEndian &data, FieldType type) const;
+	Common::UString readString(uint32_t offset, Common::Encoding encoding) const;
+	Common::UString readString(uint32_t &offset, const Field &field, Common::Encoding encoding) const;
 
-	Common::UString getString(Common::SeekableSubReadStreamEndian &data, Common::Encoding encoding) const;
-	Common::UString getString(Common::SeekableSubReadStreamEndian &data, Common::Encoding encoding,
-	                          uint32_t offset) const;
-	Common::UString getString(Common::SeekableSubReadStreamEndian &data, const Field &field,
-	                          Common::Encoding encoding) const;
+	/** Read count integers of this type at offset into values, all at once. */
+	template<typename T>
+	void readIntArray(uint32_t offset, FieldType type, uint32_t count, T *values) const;
+	/** Read count floating point values of this type at offset into values, all at once. */
+	template<typename T>
+	void readFloatArray(uint32_t offset, FieldType type, uint32_t count, T *values) const;
 
 	uint32_t getVectorMatrixLength(const Field &field, uint32_t minLength, uint32_t maxLength) const;
 	// '---
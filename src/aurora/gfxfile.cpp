@@ -213,8 +213,8 @@ uint16_t GFXFile::getExportedAssetId(const Common::UString &id) {
 	return iter->second;
 }
 
-GFXCharacter GFXFile::getCharacter(uint16_t id) {
-	std::map<uint16_t, GFXCharacter>::iterator iter = _characters.find(id);
+const GFXCharacter &GFXFile::getCharacter(uint16_t id) const {
+	std::map<uint16_t, GFXCharacter>::const_iterator iter = _characters.find(id);
 	if (iter == _characters.end())
 		throw Common::Exception("Character entry %i not found", id);
 
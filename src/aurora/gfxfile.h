@@ -361,10 +361,10 @@ public:
 	/** Get the corresponding character id for an exported asset. */
 	uint16_t getExportedAssetId(const Common::UString &id);
 	/** Get a character by id. */
-	GFXCharacter getCharacter(uint16_t id);
+	const GFXCharacter &getCharacter(uint16_t id) const;
 
 	/** Get all root controls. */
-	std::vector<GFXControl> getControls() { return _controlTags; };
+	const std::vector<GFXControl> &getControls() const { return _controlTags; };
 
 private:
 	/** The standard header of every tag. */
@@ -28,6 +28,7 @@
 #include "src/common/error.h"
 #include "src/common/filepath.h"
 #include "src/common/memreadstream.h"
+#include "src/common/mappedfile.h"
 #include "src/common/encoding.h"
 #include "src/common/hash.h"
 
@@ -57,8 +58,11 @@ void HERFFile::load(Common::SeekableReadStream &herf) {
 
 	try {
 
-		searchDictionary(herf, resCount);
-		readResList(herf);
+		// Parse the whole resource table in memory, instead of seeking around the HERF
+		std::unique_ptr<Common::MemoryReadStream> resTable(Common::MappedReadStream::readView(herf, 8, resCount * 12));
+
+		searchDictionary(*resTable, resCount);
+		readResList(herf, *resTable);
 
 	} catch (Common::Exception &e) {
 		e.add("Failed reading HERF file");
@@ -66,51 +70,50 @@ void HERFFile::load(Common::SeekableReadStream &herf) {
 	}
 }
 
-void HERFFile::searchDictionary(Common::SeekableReadStream &herf, uint32_t resCount) {
+void HERFFile::searchDictionary(Common::SeekableReadStream &resTable, uint32_t resCount) {
 	const uint32_t dictHash = Common::hashStringDJB2("erf.dict");
 
-	const size_t pos = herf.pos();
+	resTable.seek(0);
 
 	for (uint32_t i = 0; i < resCount; i++) {
-		uint32_t hash = herf.readUint32LE();
+		uint32_t hash = resTable.readUint32LE();
 		if (hash == dictHash) {
-			_dictSize   = herf.readUint32LE();
-			_dictOffset = herf.readUint32LE();
+			_dictSize   = resTable.readUint32LE();
+			_dictOffset = resTable.readUint32LE();
 			break;
 		}
 
-		herf.skip(8);
+		resTable.skip(8);
 	}
 
-	herf.seek(pos);
+	resTable.seek(0);
 }
 
 void HERFFile::readDictionary(Common::SeekableReadStream &herf, std::map<uint32_t, Common::UString> &dict) {
 	if (_dictOffset == 0xFFFFFFFF)
 		return;
 
-	size_t pos = herf.pos();
+	if ((_dictOffset > herf.size()) || (_dictSize > (herf.size() - _dictOffset)))
+		throw Common::Exception("HERF dictionary goes beyond end of file");
 
-	herf.seek(_dictOffset);
+	std::unique_ptr<Common::MemoryReadStream> dictData(Common::MappedReadStream::readView(herf, _dictOffset, _dictSize));
 
-	uint32_t magic = herf.readUint32LE();
+	uint32_t magic = dictData->readUint32LE();
 	if (magic != 0x00F1A5C0)
 		throw Common::Exception("Invalid HERF dictionary (0x%08X)", magic);
 
-	uint32_t hashCount = herf.readUint32LE();
+	uint32_t hashCount = dictData->readUint32LE();
 
 	for (uint32_t i = 0; i < hashCount; i++) {
-		if ((size_t)herf.pos() >= (_dictOffset + _dictSize))
+		if ((dictData->size() - dictData->pos()) < (4 + 128))
 			break;
 
-		uint32_t hash = herf.readUint32LE();
-		dict[hash] = Common::readStringFixed(herf, Common::kEncodingASCII, 128).toLower();
+		uint32_t hash = dictData->readUint32LE();
+		dict[hash] = Common::readStringFixed(*dictData, Common::kEncodingASCII, 128).toLower();
 	}
-
-	herf.seek(pos);
 }
 
-void HERFFile::readResList(Common::SeekableReadStream &herf) {
+void HERFFile::readResList(Common::SeekableReadStream &herf, Common::SeekableReadStream &resTable) {
 	std::map<uint32_t, Common::UString> dict;
 	readDictionary(herf, dict);
 
@@ -120,10 +123,10 @@ void HERFFile::readResList(Common::SeekableReadStream &herf) {
 	for (; (res != _resources.end()) && (iRes != _iResources.end()); ++index, ++res, ++iRes) {
 		res->index = index;
 
-		res->hash = herf.readUint32LE();
+		res->hash = resTable.readUint32LE();
 
-		iRes->size   = herf.readUint32LE();
-		iRes->offset = herf.readUint32LE();
+		iRes->size   = resTable.readUint32LE();
+		iRes->offset = resTable.readUint32LE();
 
 		if (iRes->offset >= (uint32_t)herf.size())
 			throw Common::Exception("HERFFile::readResList(): Resource goes beyond end of file");
@@ -159,6 +162,11 @@ uint32_t HERFFile::getResourceSize(uint32_t index) const {
 Common::SeekableReadStream *HERFFile::getResource(uint32_t index, bool tryNoCopy) const {
 	const IResource &res = getIResource(index);
 
+	// A HERF within a memory-mapped ROM can hand out views into the mapping
+	Common::SeekableReadStream *view = Common::MappedReadStream::viewStream(*_herf, res.offset, res.size);
+	if (view)
+		return view;
+
 	if (tryNoCopy)
 		return new Common::SeekableSubReadStream(_herf.get(), res.offset, res.offset + res.size);
 
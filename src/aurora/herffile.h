@@ -89,9 +89,9 @@ private:
 	uint32_t _dictSize;   ///< The size of the dict file (if available).
 
 	void load(Common::SeekableReadStream &herf);
-	void searchDictionary(Common::SeekableReadStream &herf, uint32_t resCount);
+	void searchDictionary(Common::SeekableReadStream &resTable, uint32_t resCount);
 	void readDictionary(Common::SeekableReadStream &herf, std::map<uint32_t, Common::UString> &dict);
-	void readResList(Common::SeekableReadStream &herf);
+	void readResList(Common::SeekableReadStream &herf, Common::SeekableReadStream &resTable);
 
 	void readNames();
 
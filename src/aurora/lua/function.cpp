@@ -37,21 +37,27 @@ namespace Aurora {
 
 namespace Lua {
 
-FunctionRef::FunctionRef() : _luaState(0), _ref(LUA_REFNIL) {
+FunctionRef::FunctionRef() : _luaState(0), _ref(LUA_REFNIL), _signatureVerified(false) {
 
 }
 
-FunctionRef::FunctionRef(const Stack &stack, int index) : _luaState(&stack.getLuaState()), _ref(LUA_REFNIL) {
+FunctionRef::FunctionRef(const Stack &stack, int index) : _luaState(&stack.getLuaState()), _ref(LUA_REFNIL),
+	_signatureVerified(false) {
+
 	lua_pushvalue(_luaState, index);
 	_ref = lua_ref(_luaState, true);
 }
 
-FunctionRef::FunctionRef(lua_State &state, int index) : _luaState(&state), _ref(LUA_REFNIL) {
+FunctionRef::FunctionRef(lua_State &state, int index) : _luaState(&state), _ref(LUA_REFNIL),
+	_signatureVerified(false) {
+
 	lua_pushvalue(_luaState, index);
 	_ref = lua_ref(_luaState, true);
 }
 
-FunctionRef::FunctionRef(const FunctionRef &fn) : _luaState(fn._luaState), _ref(LUA_REFNIL) {
+FunctionRef::FunctionRef(const FunctionRef &fn) : _luaState(fn._luaState), _ref(LUA_REFNIL),
+	_signature(fn._signature), _signatureVerified(fn._signatureVerified) {
+
 	assert(fn._luaState && fn._ref != LUA_REFNIL);
 
 	lua_getref(_luaState, fn._ref);
@@ -78,6 +84,9 @@ const FunctionRef& FunctionRef::operator=(const FunctionRef &fn) {
 	_luaState = fn._luaState;
 	_ref = lua_ref(_luaState, true);
 
+	_signature         = fn._signature;
+	_signatureVerified = fn._signatureVerified;
+
 	if (oldState && oldRef != LUA_REFNIL) {
 		lua_unref(oldState, oldRef);
 	}
@@ -85,6 +94,9 @@ const FunctionRef& FunctionRef::operator=(const FunctionRef &fn) {
 }
 
 Variables FunctionRef::call(const Variables &params) const {
+	if (matchesSignature(params))
+		return callFast(params);
+
 	StackGuard guard(*_luaState);
 
 	const int savedTop = lua_gettop(_luaState);
@@ -98,7 +110,55 @@ Variables FunctionRef::call(const Variables &params) const {
 	}
 
 	const int retsCount = stack.getSize() - savedTop;
-	return stack.getVariablesFromTop(retsCount);
+	Variables rets = stack.getVariablesFromTop(retsCount);
+
+	setSignature(params);
+	return rets;
+}
+
+Variables FunctionRef::callFast(const Variables &params) const {
+	const int savedTop = lua_gettop(_luaState);
+	lua_getref(_luaState, _ref);
+
+	Stack stack(*_luaState);
+	stack.pushVariables(params);
+
+	if (lua_pcall(_luaState, params.size(), LUA_MULTRET, 0) != 0) {
+		const Common::UString message = lua_tostring(_luaState, -1);
+		lua_settop(_luaState, savedTop);
+
+		throw Common::Exception("Failed to call Lua function:\n\t%s", message.c_str());
+	}
+
+	Variables rets;
+	try {
+		rets = stack.getVariablesFromTop(lua_gettop(_luaState) - savedTop);
+	} catch (...) {
+		lua_settop(_luaState, savedTop);
+		throw;
+	}
+
+	lua_settop(_luaState, savedTop);
+	return rets;
+}
+
+bool FunctionRef::matchesSignature(const Variables &params) const {
+	if (!_signatureVerified || (_signature.size() != params.size()))
+		return false;
+
+	for (size_t i = 0; i < params.size(); ++i)
+		if (params[i].getType() != _signature[i])
+			return false;
+
+	return true;
+}
+
+void FunctionRef::setSignature(const Variables &params) const {
+	_signature.resize(params.size());
+	for (size_t i = 0; i < params.size(); ++i)
+		_signature[i] = params[i].getType();
+
+	_signatureVerified = true;
 }
 
 Variables FunctionRef::call() const {
@@ -25,6 +25,8 @@
 #ifndef AURORA_LUA_FUNCTION_H
 #define AURORA_LUA_FUNCTION_H
 
+#include <vector>
+
 #include "src/aurora/lua/types.h"
 
 namespace Aurora {
@@ -42,6 +44,12 @@ public:
 
 	const FunctionRef &operator=(const FunctionRef &fn);
 
+	/** Call the function.
+	 *
+	 *  Once a call has succeeded, the types of its arguments are remembered.
+	 *  Later calls with the same argument types take a fast path that
+	 *  restores the stack directly instead of through a StackGuard.
+	 */
 	Variables call(const Variables &params) const;
 
 	Variables call() const;
@@ -57,7 +65,17 @@ private:
 	lua_State *_luaState;
 	int _ref;
 
+	/** The argument types of the last successful call. */
+	mutable std::vector<Type> _signature;
+	/** Has _signature been verified by a successful call? */
+	mutable bool _signatureVerified;
+
 	void pushSelf() const;
+
+	bool matchesSignature(const Variables &params) const;
+	void setSignature(const Variables &params) const;
+
+	Variables callFast(const Variables &params) const;
 };
 
 } // End of namespace Lua
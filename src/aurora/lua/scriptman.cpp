@@ -32,6 +32,8 @@
 
 #include "src/common/error.h"
 #include "src/common/util.h"
+#include "src/common/configvalue.h"
+#include "src/common/profiler.h"
 
 #include "src/aurora/resman.h"
 #include "src/aurora/util.h"
@@ -49,7 +51,16 @@ namespace Aurora {
 
 namespace Lua {
 
-ScriptManager::ScriptManager() : _luaState(0), _regNestingLevel(0) {
+/** Collect once memory use grew to this percentage of what was in use after the last collection. */
+static const Common::ConfigValue<int> kConfigGCPause("luagcpause", 200);
+/** Let Lua collect by itself once memory use grew to this percentage. */
+static const Common::ConfigValue<int> kConfigGCLimit("luagclimit", 400);
+
+/** Never collect when less than this many Kbytes are in use. */
+static const int kGCMinThreshold = 1024;
+
+ScriptManager::ScriptManager() : _luaState(0), _regNestingLevel(0), _callNestingLevel(0),
+	_functionCacheStale(false), _gcLiveSize(0), _gcCost(0.0), _gcThreshold(0) {
 
 }
 
@@ -75,6 +86,7 @@ void ScriptManager::deinit() {
 		_objectLuaInstances.clear();
 	}
 
+	clearFunctionCache();
 	closeLuaState();
 }
 
@@ -89,6 +101,8 @@ void ScriptManager::executeFile(const Common::UString &path) {
 		return;
 	}
 
+	clearFunctionCache();
+
 	std::unique_ptr<Common::SeekableReadStream> stream(ResMan.getResource(path, kFileTypeLUC));
 	if (!stream) {
 		const Common::UString fileName = TypeMan.setFileType(path, kFileTypeLUC);
@@ -109,6 +123,8 @@ void ScriptManager::executeFile(const Common::UString &path) {
 void ScriptManager::executeString(const Common::UString &code) {
 	assert(_luaState && _regNestingLevel == 0);
 
+	clearFunctionCache();
+
 	const int execResult = lua_dostring(_luaState, code.c_str());
 	if (execResult != 0) {
 		throw Common::Exception("Failed to execute Lua code: %s", code.c_str());
@@ -119,25 +135,29 @@ Variables ScriptManager::callFunction(const Common::UString &name, const Variabl
 	assert(!name.empty());
 	assert(_luaState && _regNestingLevel == 0);
 
-	std::vector<Common::UString> parts;
-	Common::UString::split(name, '.', parts);
-	if (parts.empty()) {
-		error("Lua call \"%s\" failed: bad name", name.c_str());
-		return Variables();
-	}
+	const FunctionRef &function = getFunction(name);
 
-	const Common::UString funcName = parts.back();
-	parts.pop_back();
+	// The called function might execute Lua code itself, which invalidates
+	// the cache. Keep the cache entries alive until the outermost call returns.
+	++_callNestingLevel;
 
-	if (parts.empty()) {
-		return getGlobalFunction(funcName).call(params);
+	Variables rets;
+	try {
+		rets = function.call(params);
+	} catch (...) {
+		leaveFunctionCall();
+		throw;
 	}
 
-	TableRef table = getGlobalTable(parts[0]);
-	for (uint32_t i = 1; i < parts.size(); ++i) {
-		table = table.getTableAt(parts[i]);
-	}
-	return table.getFunctionAt(funcName).call(params);
+	leaveFunctionCall();
+	return rets;
+}
+
+void ScriptManager::leaveFunctionCall() {
+	assert(_callNestingLevel > 0);
+
+	if ((--_callNestingLevel == 0) && _functionCacheStale)
+		clearFunctionCache();
 }
 
 Variables ScriptManager::callFunction(const Common::UString &name) {
@@ -161,6 +181,55 @@ FunctionRef ScriptManager::getGlobalFunction(const Common::UString &name) const
 	return getGlobalVariable(name).getFunction();
 }
 
+const FunctionRef &ScriptManager::getFunction(const Common::UString &name) {
+	assert(!name.empty());
+	assert(_luaState);
+
+	FunctionCache::iterator cached = _functionCache.find(name);
+	if ((cached != _functionCache.end()) && !_functionCacheStale)
+		return cached->second;
+
+	const FunctionRef function = findFunction(name);
+
+	// While the cache is stale, the old entry might still be running. Assigning
+	// only changes the reference, the entry itself stays valid.
+	if (cached != _functionCache.end()) {
+		cached->second = function;
+		return cached->second;
+	}
+
+	return _functionCache.insert(std::make_pair(name, function)).first->second;
+}
+
+FunctionRef ScriptManager::findFunction(const Common::UString &name) const {
+	std::vector<Common::UString> parts;
+	Common::UString::split(name, '.', parts);
+	if (parts.empty())
+		throw Common::Exception("Lua call \"%s\" failed: bad name", name.c_str());
+
+	const Common::UString funcName = parts.back();
+	parts.pop_back();
+
+	if (parts.empty())
+		return getGlobalFunction(funcName);
+
+	TableRef table = getGlobalTable(parts[0]);
+	for (uint32_t i = 1; i < parts.size(); ++i) {
+		table = table.getTableAt(parts[i]);
+	}
+	return table.getFunctionAt(funcName);
+}
+
+void ScriptManager::clearFunctionCache() {
+	if (_callNestingLevel > 0) {
+		_functionCacheStale = true;
+		return;
+	}
+
+	_functionCache.clear();
+	_functionCacheStale = false;
+}
+
 void ScriptManager::addIgnoredFile(const Common::UString &path) {
 	_ignoredFiles.insert(path);
 }
@@ -263,6 +332,71 @@ int ScriptManager::getUsedMemoryAmount() const {
 	return lua_getgccount(_luaState);
 }
 
+int ScriptManager::getGCSoftThreshold() const {
+	return MAX<int>((int64_t) _gcLiveSize * MAX<int>(kConfigGCPause, 100) / 100, kGCMinThreshold);
+}
+
+int ScriptManager::getGCHardThreshold() const {
+	const int pause = MAX<int>(kConfigGCPause, 100);
+	const int limit = MAX<int>(kConfigGCLimit, pause);
+
+	return MAX<int>((int64_t) getGCSoftThreshold() * limit / pause, getGCSoftThreshold() + 1);
+}
+
+void ScriptManager::setGCThreshold() {
+	lua_setgcthreshold(_luaState, getGCHardThreshold());
+
+	_gcThreshold = lua_getgcthreshold(_luaState);
+}
+
+void ScriptManager::collectGarbage(uint32_t budget) {
+	if (!_luaState)
+		return;
+
+	/* If Lua collected by itself in the meantime, it set its threshold
+	 * to twice the memory that was still in use afterwards. */
+	if (lua_getgcthreshold(_luaState) != _gcThreshold) {
+		_gcLiveSize = lua_getgcthreshold(_luaState) / 2;
+
+		setGCThreshold();
+	}
+
+	const int used = lua_getgccount(_luaState);
+
+	const int softThreshold = getGCSoftThreshold();
+	if (used < softThreshold)
+		return;
+
+	// Put off a collection that won't fit, but not for too long
+	const double estimate = (_gcCost * used) / 1000.0;
+	if ((estimate > budget) && (used < (softThreshold + (getGCHardThreshold() - softThreshold) / 2)))
+		return;
+
+	collectAllGarbage();
+}
+
+void ScriptManager::collectAllGarbage() {
+	if (!_luaState)
+		return;
+
+	PROFILE_ZONE("Lua::ScriptManager::collectAllGarbage");
+
+	const int used = lua_getgccount(_luaState);
+
+	const uint64_t start = Common::Profiler::getTime();
+
+	// A threshold of 0 makes Lua collect immediately
+	lua_setgcthreshold(_luaState, 0);
+
+	const uint64_t end = Common::Profiler::getTime();
+
+	_gcLiveSize = lua_getgccount(_luaState);
+	_gcCost     = (double) (end - start) / MAX(used, 1);
+
+	// Move Lua's own threshold out of the way of ours
+	setGCThreshold();
+}
+
 void ScriptManager::setLuaInstanceForObject(void *object, const TableRef &luaInstance) {
 	assert(object);
 	// TODO: Commented out to make stubs work
@@ -313,6 +447,11 @@ void ScriptManager::openLuaState() {
 	tolua_open(_luaState);
 
 	lua_atpanic(_luaState, &ScriptManager::atPanic);
+
+	_gcLiveSize = lua_getgccount(_luaState);
+	_gcCost     = 0.0;
+
+	setGCThreshold();
 }
 
 void ScriptManager::closeLuaState() {
@@ -28,8 +28,9 @@
 #include <cassert>
 
 #include <set>
-#include <map>
+#include <unordered_map>
 
+#include "src/common/types.h"
 #include "src/common/singleton.h"
 #include "src/common/ustring.h"
 
@@ -61,6 +62,9 @@ public:
 	/** Call a Lua function.
 	 *  A "dot" syntax is used to call class methods or table functions.
 	 *  For example, callFunction("module.Class.method", params).
+	 *
+	 *  The resolved function is cached by name until the next call to
+	 *  executeFile() or executeString(), or until clearFunctionCache().
 	 */
 	Variables callFunction(const Common::UString &name, const Variables &params);
 	Variables callFunction(const Common::UString &name);
@@ -69,6 +73,13 @@ public:
 	TableRef getGlobalTable(const Common::UString &name) const;
 	FunctionRef getGlobalFunction(const Common::UString &name) const;
 
+	/** Return a reference to a Lua function, using the "dot" syntax of callFunction().
+	 *  The reference is cached, so that repeated lookups don't walk the tables again.
+	 */
+	const FunctionRef &getFunction(const Common::UString &name);
+	/** Forget all cached function references. */
+	void clearFunctionCache();
+
 	/** Add a file to the ignore list. */
 	void addIgnoredFile(const Common::UString &path);
 	/** Remove a file from the ignore list. */
@@ -106,6 +117,24 @@ public:
 	/** Return the amount of memory in use by Lua (in Kbytes). */
 	int getUsedMemoryAmount() const;
 
+	/** Collect Lua's garbage, if that's due and fits into the time budget.
+	 *
+	 *  Meant to be called once per frame by the game loop. Our Lua can only
+	 *  collect all garbage in one go, so the budget only decides when a
+	 *  collection happens, not how long it takes.
+	 *
+	 *  A collection is due once the memory in use grows past "luagcpause"
+	 *  percent of what was in use after the last one. If the last collection
+	 *  suggests the next one won't fit into the budget, it is put off, up to
+	 *  halfway to Lua's own threshold at "luagclimit" percent. Past that,
+	 *  Lua collects by itself in the middle of running scripts.
+	 *
+	 *  @param budget The time, in milliseconds, the collection may take.
+	 */
+	void collectGarbage(uint32_t budget);
+	/** Collect all of Lua's garbage right now. */
+	void collectAllGarbage();
+
 	void setLuaInstanceForObject(void *object, const TableRef& luaInstance);
 	void unsetLuaInstanceForObject(void *object);
 	const TableRef &getLuaInstanceForObject(void *object) const;
@@ -113,7 +142,8 @@ public:
 	void injectNewIndexMetaEventIntoTable(const TableRef& table);
 
 private:
-	typedef std::map<void *, TableRef> ObjectLuaInstanceMap;
+	typedef std::unordered_map<void *, TableRef> ObjectLuaInstanceMap;
+	typedef std::unordered_map<Common::UString, FunctionRef, Common::hashUStringCaseSensitive> FunctionCache;
 
 	/** The Lua state. */
 	lua_State *_luaState;
@@ -123,17 +153,42 @@ private:
 	std::set<Common::UString> _ignoredFiles;
 
 	ObjectLuaInstanceMap _objectLuaInstances;
+	/** Functions resolved by callFunction(), by their full "dotted" name. */
+	FunctionCache _functionCache;
+	/** The nesting level of callFunction(). */
+	int _callNestingLevel;
+	/** Was the function cache cleared while a cached function was still running? */
+	bool _functionCacheStale;
+
+	/** Memory in use by Lua right after the last garbage collection, in Kbytes. */
+	int _gcLiveSize;
+	/** How long the last garbage collection took, in microseconds per Kbyte in use. */
+	double _gcCost;
+	/** The threshold, in Kbytes, we last gave to Lua. */
+	int _gcThreshold;
 
 	/** Open and setup a new Lua state. */
 	void openLuaState();
 	/** Close the current Lua state. */
 	void closeLuaState();
 
+	/** Return the memory use, in Kbytes, at which collectGarbage() wants to collect. */
+	int getGCSoftThreshold() const;
+	/** Return the memory use, in Kbytes, at which Lua collects by itself. */
+	int getGCHardThreshold() const;
+	/** Give Lua our hard threshold. */
+	void setGCThreshold();
+
 	/** Check whether a class with the given name was declared.
 	 *  Throw an exception if the check failed.
 	 */
 	void requireDeclaredClass(const Common::UString &name) const;
 
+	/** Look up a function by its "dotted" name, without consulting the cache. */
+	FunctionRef findFunction(const Common::UString &name) const;
+	/** Leave a callFunction(), clearing the function cache if that was deferred. */
+	void leaveFunctionCall();
+
 	void registerDefaultBindings();
 	void executeDefaultCode();
 
@@ -31,6 +31,7 @@
 #include "src/common/error.h"
 #include "src/common/memreadstream.h"
 #include "src/common/readfile.h"
+#include "src/common/mappedfile.h"
 #include "src/common/encoding.h"
 
 #include "src/aurora/ndsrom.h"
@@ -77,17 +78,22 @@ void NDSFile::load(Common::SeekableReadStream &nds) {
 }
 
 void NDSFile::readNames(Common::SeekableReadStream &nds, uint32_t offset, uint32_t length) {
-	nds.seek(offset + 8);
+	if (length <= 8)
+		return;
+
+	// Parse the whole name table in memory, instead of reading it byte by byte
+	std::unique_ptr<Common::MemoryReadStream> names(Common::MappedReadStream::readView(nds, offset, length));
+	names->seek(8);
 
 	uint32_t index = 0;
-	while (((size_t)nds.pos()) < (size_t)(offset + length)) {
+	while (((size_t)names->pos()) < (size_t)length) {
 		Resource res;
 
-		byte nameLength = nds.readByte();
-		if ((nameLength == 0) || ((size_t)nds.pos() >= (size_t)(offset + length)))
+		byte nameLength = names->readByte();
+		if ((nameLength == 0) || ((size_t)names->pos() >= (size_t)length))
 			break;
 
-		Common::UString name = Common::readStringFixed(nds, Common::kEncodingASCII, nameLength).toLower();
+		Common::UString name = Common::readStringFixed(*names, Common::kEncodingASCII, nameLength).toLower();
 
 		res.name  = TypeMan.setFileType(name, kFileTypeNone);
 		res.type  = TypeMan.getFileType(name);
@@ -98,12 +104,15 @@ void NDSFile::readNames(Common::SeekableReadStream &nds, uint32_t offset, uint32
 }
 
 void NDSFile::readFAT(Common::SeekableReadStream &nds, uint32_t offset) {
-	nds.seek(offset);
-
 	_iResources.resize(_resources.size());
+	if (_iResources.empty())
+		return;
+
+	std::unique_ptr<Common::MemoryReadStream> fat(Common::MappedReadStream::readView(nds, offset, _iResources.size() * 8));
+
 	for (IResourceList::iterator res = _iResources.begin(); res != _iResources.end(); ++res) {
-		res->offset = nds.readUint32LE();
-		res->size   = nds.readUint32LE() - res->offset; // Value is the end offset
+		res->offset = fat->readUint32LE();
+		res->size   = fat->readUint32LE() - res->offset; // Value is the end offset
 	}
 }
 
@@ -168,8 +177,14 @@ Common::SeekableReadStream *NDSFile::getResource(uint32_t index, bool tryNoCopy)
 
 	_nds->seek(res.offset);
 
-	if (tryNoCopy)
+	if (tryNoCopy) {
+		// A memory-mapped ROM can hand out views into the mapping
+		Common::SeekableReadStream *view = Common::MappedReadStream::viewStream(*_nds, res.offset, res.size);
+		if (view)
+			return view;
+
 		return new Common::SeekableSubReadStream(_nds.get(), res.offset, res.offset + res.size);
+	}
 
 	_nds->seek(res.offset);
 
@@ -340,6 +340,10 @@ Common::SeekableReadStream *NSBTXFile::getResource(uint32_t index, bool UNUSED(t
 	return new Common::MemoryReadStream(stream.getData(), stream.size(), true);
 }
 
+bool NSBTXFile::isResourceCompressed(uint32_t UNUSED(index)) const {
+	return true;
+}
+
 void NSBTXFile::load(Common::SeekableSubReadStreamEndian &nsbtx) {
 	try {
 
@@ -57,6 +57,9 @@ public:
 	/** Return a stream of the resource's contents. */
 	Common::SeekableReadStream *getResource(uint32_t index, bool tryNoCopy = false) const;
 
+	/** Textures are converted when they're requested, which is costly. */
+	bool isResourceCompressed(uint32_t index) const;
+
 private:
 	enum Format {
 		kFormatNoTexture     = 0, ///< Empty.
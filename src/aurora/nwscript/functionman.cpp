@@ -27,6 +27,7 @@
 #include "src/common/debug.h"
 
 #include "src/aurora/nwscript/functionman.h"
+#include "src/aurora/nwscript/profiler.h"
 
 DECLARE_SINGLETON(Aurora::NWScript::FunctionManager)
 
@@ -34,8 +35,8 @@ namespace Aurora {
 
 namespace NWScript {
 
-FunctionManager::FunctionEntry::FunctionEntry(const Common::UString &name) :
-	empty(true), ctx(name) {
+FunctionManager::FunctionEntry::FunctionEntry(const Common::UString &name, uint32_t i) :
+	id(i), ctx(name) {
 }
 
 
@@ -63,7 +64,7 @@ void FunctionManager::registerFunction(const Common::UString &name, uint32_t id,
 
 	std::pair<FunctionMap::iterator, bool> result;
 
-	result = _functionMap.insert(std::make_pair(name, FunctionEntry(name)));
+	result = _functionMap.insert(std::make_pair(name, FunctionEntry(name, id)));
 	if (!result.second)
 		throw Common::Exception("Failed to register NWScript function \"%s\"", name.c_str());
 
@@ -72,12 +73,11 @@ void FunctionManager::registerFunction(const Common::UString &name, uint32_t id,
 	f.func = func;
 	f.ctx.setSignature(signature);
 	f.ctx.setDefaults(defaults);
-	f.empty = false;
 
 	if (_functionArray.size() <= id)
-		_functionArray.resize(id + 1);
+		_functionArray.resize(id + 1, 0);
 
-	_functionArray[id] = f;
+	_functionArray[id] = &f;
 }
 
 FunctionContext FunctionManager::createContext(const Common::UString &function) const {
@@ -85,17 +85,7 @@ FunctionContext FunctionManager::createContext(const Common::UString &function)
 }
 
 void FunctionManager::call(const Common::UString &function, FunctionContext &ctx) const {
-	debugCN(Common::kDebugEngineScripts, 5, "%s %s(%s)", formatType(ctx.getReturn().getType()).c_str(),
-	        ctx.getName().c_str(), formatParams(ctx).c_str());
-
-	find(function).func(ctx);
-
-	const Common::UString r = formatReturn(ctx);
-	debugC(Common::kDebugEngineScripts, 5, "%s%s", r.empty() ? "" : " => ", r.c_str());
-
-	if (DebugMan.getVerbosityLevel(Common::kDebugEngineScripts) < 5)
-		debugC(Common::kDebugEngineScripts, 2, "%s %s(%s)%s%s", formatType(ctx.getReturn().getType()).c_str(),
-		       ctx.getName().c_str(), formatParams(ctx).c_str(), r.empty() ? "" : " => ", r.c_str());
+	call(find(function), ctx);
 }
 
 FunctionContext FunctionManager::createContext(uint32_t function) const {
@@ -103,32 +93,71 @@ FunctionContext FunctionManager::createContext(uint32_t function) const {
 }
 
 void FunctionManager::call(uint32_t function, FunctionContext &ctx) const {
-	debugCN(Common::kDebugEngineScripts, 5, "%s %s(%s)", formatType(ctx.getReturn().getType()).c_str(),
-	        ctx.getName().c_str(), formatParams(ctx).c_str());
+	call(find(function), ctx);
+}
+
+std::unique_ptr<FunctionContext> FunctionManager::acquireContext(uint32_t function) {
+	find(function);
+	FunctionEntry &f = *_functionArray[function];
+
+	if (f.pool.empty())
+		return std::make_unique<FunctionContext>(f.ctx);
+
+	std::unique_ptr<FunctionContext> ctx = std::move(f.pool.back());
+	f.pool.pop_back();
+
+	// Assigning over the used context reuses its already allocated parameters
+	*ctx = f.ctx;
+
+	return ctx;
+}
+
+void FunctionManager::releaseContext(uint32_t function, std::unique_ptr<FunctionContext> ctx) {
+	if (!ctx || (function >= _functionArray.size()) || !_functionArray[function])
+		return;
+
+	_functionArray[function]->pool.push_back(std::move(ctx));
+}
+
+void FunctionManager::call(const FunctionEntry &function, FunctionContext &ctx) {
+	const bool profile = ScriptProfiler.isEnabled();
+	const uint64_t start = profile ? Profiler::getTime() : 0;
+
+	// Only format the parameters and return value when they're actually printed
+	if (!Common::DebugManager::isChannelEnabled(Common::kDebugEngineScripts, 2)) {
+		function.func(ctx);
+
+	} else {
+		debugCN(Common::kDebugEngineScripts, 5, "%s %s(%s)", formatType(ctx.getReturn().getType()).c_str(),
+		        ctx.getName().c_str(), formatParams(ctx).c_str());
+
+		function.func(ctx);
 
-	find(function).func(ctx);
+		const Common::UString r = formatReturn(ctx);
+		debugC(Common::kDebugEngineScripts, 5, "%s%s", r.empty() ? "" : " => ", r.c_str());
 
-	const Common::UString r = formatReturn(ctx);
-	debugC(Common::kDebugEngineScripts, 5, "%s%s", r.empty() ? "" : " => ", r.c_str());
+		if (DebugMan.getVerbosityLevel(Common::kDebugEngineScripts) < 5)
+			debugC(Common::kDebugEngineScripts, 2, "%s %s(%s)%s%s", formatType(ctx.getReturn().getType()).c_str(),
+			       ctx.getName().c_str(), formatParams(ctx).c_str(), r.empty() ? "" : " => ", r.c_str());
+	}
 
-	if (DebugMan.getVerbosityLevel(Common::kDebugEngineScripts) < 5)
-		debugC(Common::kDebugEngineScripts, 2, "%s %s(%s)%s%s", formatType(ctx.getReturn().getType()).c_str(),
-		       ctx.getName().c_str(), formatParams(ctx).c_str(), r.empty() ? "" : " => ", r.c_str());
+	if (profile)
+		ScriptProfiler.addFunction(function.id, ctx.getName(), Profiler::getTime() - start);
 }
 
 const FunctionManager::FunctionEntry &FunctionManager::find(const Common::UString &function) const {
 	FunctionMap::const_iterator f = _functionMap.find(function);
-	if ((f == _functionMap.end()) || f->second.empty)
+	if (f == _functionMap.end())
 		throw Common::Exception("No such NWScript function \"%s\"", function.c_str());
 
 	return f->second;
 }
 
 const FunctionManager::FunctionEntry &FunctionManager::find(uint32_t function) const {
-	if ((function >= _functionArray.size()) || _functionArray[function].empty)
+	if ((function >= _functionArray.size()) || !_functionArray[function])
 		throw Common::Exception("No such NWScript function %d", function);
 
-	return _functionArray[function];
+	return *_functionArray[function];
 }
 
 } // End of namespace NWScript
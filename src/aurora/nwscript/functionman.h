@@ -27,6 +27,7 @@
 
 #include <vector>
 #include <map>
+#include <memory>
 
 #include "src/common/ustring.h"
 #include "src/common/singleton.h"
@@ -57,24 +58,42 @@ public:
 	FunctionContext createContext(uint32_t function) const;
 	void call(uint32_t function, FunctionContext &ctx) const;
 
+	/** Borrow a context for calling this function.
+	 *
+	 *  The context is in the same state as one created by createContext(),
+	 *  but is taken from a pool of contexts previously used for the same
+	 *  function, so that the parameters don't need to be allocated anew.
+	 *  Once the call is done, the context should be given back with
+	 *  releaseContext().
+	 */
+	std::unique_ptr<FunctionContext> acquireContext(uint32_t function);
+	/** Give a context borrowed with acquireContext() back to the pool. */
+	void releaseContext(uint32_t function, std::unique_ptr<FunctionContext> ctx);
+
 private:
 	struct FunctionEntry {
-		bool empty;
+		uint32_t id;
 
 		Function func;
 		FunctionContext ctx;
 
-		FunctionEntry(const Common::UString &name = "");
+		/** Previously used contexts of this function, ready for reuse. */
+		std::vector<std::unique_ptr<FunctionContext>> pool;
+
+		FunctionEntry(const Common::UString &name = "", uint32_t i = 0);
 	};
 
 	typedef std::map<Common::UString, FunctionEntry> FunctionMap;
-	typedef std::vector<FunctionEntry> FunctionArray;
+	/** Entries of the function map, indexed by function ID. */
+	typedef std::vector<FunctionEntry *> FunctionArray;
 
 	FunctionMap _functionMap;
 	FunctionArray _functionArray;
 
 	const FunctionEntry &find(const Common::UString &function) const;
 	const FunctionEntry &find(uint32_t function) const;
+
+	static void call(const FunctionEntry &function, FunctionContext &ctx);
 };
 
 } // End of namespace NWScript
@@ -30,7 +30,12 @@
 
 #include <cassert>
 
-#include <boost/make_shared.hpp>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <boost/noncopyable.hpp>
 
 #include "src/common/util.h"
 #include "src/common/error.h"
@@ -39,12 +44,15 @@
 #include "src/common/readstream.h"
 #include "src/common/encoding.h"
 #include "src/common/debug.h"
+#include "src/common/flathashmap.h"
+#include "src/common/profiler.h"
 
 #include "src/aurora/resman.h"
 
 #include "src/aurora/nwscript/ncsfile.h"
 #include "src/aurora/nwscript/object.h"
 #include "src/aurora/nwscript/functionman.h"
+#include "src/aurora/nwscript/profiler.h"
 
 using Common::kDebugScripts;
 
@@ -89,7 +97,8 @@ Variable NCSStack::pop() {
 	if (_stackPtr == -1)
 		throw Common::Exception("NCSStack: Stack underflow");
 
-	return at(_stackPtr--);
+	// The slot is dead after popping, so we can move the variable out of it
+	return std::move(at(_stackPtr--));
 }
 
 void NCSStack::push(const Variable &obj) {
@@ -104,6 +113,18 @@ void NCSStack::push(const Variable &obj) {
 	_stackPtr++;
 }
 
+void NCSStack::push(Variable &&obj) {
+	if (_stackPtr == 0x7FFFFFFF)
+		throw Common::Exception("NCSStack: Stack overflow");
+
+	if (_stackPtr == (int32_t)size() - 1)
+		push_back(std::move(obj));
+	else
+		at(_stackPtr + 1) = std::move(obj);
+
+	_stackPtr++;
+}
+
 Variable &NCSStack::getRelSP(int32_t pos) {
 	if ((pos > -4) || ((pos % 4) != 0))
 		throw Common::Exception("NCSStack::get(): Illegal position %d", pos);
@@ -174,7 +195,7 @@ void NCSStack::setBasePtr(int32_t pos) {
 }
 
 void NCSStack::print() const {
-	if (!DebugMan.isEnabled(kDebugScripts, 3))
+	if (!Common::DebugManager::isChannelEnabled(kDebugScripts, 3))
 		return;
 
 	debugC(kDebugScripts, 3, ".--- %d ---.", _stackPtr);
@@ -276,18 +297,126 @@ void NCSFile::setupOpcodes() {
 
 #undef OPCODE
 
-NCSFile::NCSFile(Common::SeekableReadStream *ncs) : _script(ncs) {
-	assert(_script);
+const size_t NCSFile::kInvalidIndex;
+
+NCSFile::Instruction::Instruction() : address(0), opcode(0), type(kInstTypeNone), proc(0),
+	argFloat(0.0f), index(kInvalidIndex) {
+
+	args[0] = args[1] = args[2] = 0;
+}
+
+
+/** The decoded bytecode of a script.
+ *
+ *  A program is never changed after it has been decoded, so it can be
+ *  shared by any number of NCSFile instances, each running the script
+ *  with their own stack.
+ */
+struct NCSFile::Program {
+	std::vector<Instruction> instructions;
+	std::vector<Common::UString> strings; ///< The values of all string CONSTs.
+
+	/** Find the index of the instruction at this offset. */
+	size_t findInstruction(uint32_t address) const;
+};
+
+size_t NCSFile::Program::findInstruction(uint32_t address) const {
+	std::vector<Instruction>::const_iterator i =
+		std::lower_bound(instructions.begin(), instructions.end(), address,
+		                 [](const Instruction &instr, uint32_t addr) { return instr.address < addr; });
+
+	if ((i == instructions.end()) || (i->address != address))
+		return kInvalidIndex;
+
+	return i - instructions.begin();
+}
+
+
+/** A cache of the programs of scripts loaded by name.
+ *
+ *  Every program remembers the resource manager generation it was loaded
+ *  in. If the resources changed since then, the script might have been
+ *  replaced, so the program is loaded anew.
+ *
+ *  All methods are thread-safe.
+ */
+class NCSFile::ProgramCache : boost::noncopyable {
+public:
+	/** Return the cached program of this script, or 0 if it's not cached or outdated. */
+	std::shared_ptr<const Program> find(const Common::UString &name, uint32_t generation) {
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		const Entry *entry = _entries.find(name);
+		if (!entry || (entry->generation != generation))
+			return std::shared_ptr<const Program>();
+
+		return entry->program;
+	}
+
+	void add(const Common::UString &name, uint32_t generation, const std::shared_ptr<const Program> &program) {
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		Entry &entry = _entries[name];
+
+		entry.generation = generation;
+		entry.program    = program;
+	}
+
+private:
+	struct Entry {
+		uint32_t generation;
+		std::shared_ptr<const Program> program;
+
+		Entry() : generation(0) { }
+	};
+
+	typedef Common::FlatHashMap<Common::UString, Entry,
+	                            Common::hashUStringCaseInsensitive, Common::equalsUStringInsensitive> EntryMap;
+
+	EntryMap _entries;
+
+	std::mutex _mutex;
+};
+
+NCSFile::ProgramCache &NCSFile::getProgramCache() {
+	static ProgramCache cache;
 
-	load();
+	return cache;
 }
 
-NCSFile::NCSFile(const Common::UString &ncs) : _name(ncs) {
-	_script.reset(ResMan.getResource(ncs, kFileTypeNCS));
-	if (!_script)
+
+NCSFile::NCSFile(Common::SeekableReadStream *ncs) : _pc(0),
+	_instructionBudget(0), _instructionCount(0), _suspended(false) {
+
+	std::unique_ptr<Common::SeekableReadStream> script(ncs);
+	assert(script);
+
+	load(*script);
+}
+
+NCSFile::NCSFile(const Common::UString &ncs) : _name(ncs), _pc(0),
+	_instructionBudget(0), _instructionCount(0), _suspended(false) {
+
+	const uint32_t generation = ResMan.getGeneration();
+
+	_program = getProgramCache().find(ncs, generation);
+	if (_program) {
+		// Only valid scripts are ever cached
+		_id      = kNCSTag;
+		_version = kVersion10;
+
+		setupOpcodes();
+		reset();
+		return;
+	}
+
+	std::unique_ptr<Common::SeekableReadStream> script(ResMan.getResource(ncs, kFileTypeNCS));
+	if (!script)
 		throw Common::Exception("No such NCS \"%s\"", ncs.c_str());
 
-	load();
+	load(*script);
+
+	getProgramCache().add(ncs, generation, _program);
 }
 
 NCSFile::~NCSFile() {
@@ -332,8 +461,8 @@ ScriptState NCSFile::getEmptyState() {
 	return state;
 }
 
-void NCSFile::load() {
-	readHeader(*_script);
+void NCSFile::load(Common::SeekableReadStream &ncs) {
+	readHeader(ncs);
 
 	if (_id != kNCSTag)
 		throw Common::Exception("Try to load non-NCS file");
@@ -341,21 +470,184 @@ void NCSFile::load() {
 	if (_version != kVersion10)
 		throw Common::Exception("Unsupported NCS file version %08X", _version);
 
-	byte lengthOpcode = _script->readByte();
+	byte lengthOpcode = ncs.readByte();
 	if (lengthOpcode != 0x42)
 		throw Common::Exception("Script size opcode != 0x42 (0x%02X)", lengthOpcode);
 
-	uint32_t length = _script->readUint32BE();
-	if (length > ((uint32_t) _script->size()))
-		throw Common::Exception("Script size %u > stream size %u", length, (uint)_script->size());
-	if (length < ((uint32_t) _script->size()))
-		warning("TODO: NCSFile::load(): Script size %u < stream size %u", length, (uint)_script->size());
+	uint32_t length = ncs.readUint32BE();
+	if (length > ((uint32_t) ncs.size()))
+		throw Common::Exception("Script size %u > stream size %u", length, (uint)ncs.size());
+	if (length < ((uint32_t) ncs.size()))
+		warning("TODO: NCSFile::load(): Script size %u < stream size %u", length, (uint)ncs.size());
 
 	setupOpcodes();
 
+	std::shared_ptr<Program> program = std::make_shared<Program>();
+	decode(ncs, *program);
+
+	_program = program;
+
 	reset();
 }
 
+void NCSFile::decode(Common::SeekableReadStream &ncs, Program &program) {
+	/* Decode the bytecode in one linear sweep, from the first instruction
+	 * right after the header up to the end of the stream.
+	 *
+	 * If we find an instruction we can't decode, we stop there. Since the
+	 * script might never actually reach that instruction, we only complain
+	 * if it's executed. */
+
+	const size_t size = ncs.size();
+
+	ncs.seek(13); // 8 byte header + 5 byte program size dummy op
+
+	bool complete = true;
+	while ((size - ncs.pos()) >= 2) {
+		Instruction instr;
+
+		instr.address = ncs.pos();
+		instr.opcode  = ncs.readByte();
+		instr.type    = (InstructionType) ncs.readByte();
+
+		if ((instr.opcode >= _opcodeListSize) || (!_opcodes[instr.opcode].proc)) {
+			instr.proc = &NCSFile::o_invalid;
+
+			program.instructions.push_back(instr);
+			complete = false;
+			break;
+		}
+
+		instr.proc = _opcodes[instr.opcode].proc;
+
+		bool canContinue = true;
+		try {
+			canContinue = decodeArguments(ncs, program, instr);
+		} catch (...) {
+			instr.proc  = &NCSFile::o_invalid;
+			canContinue = false;
+		}
+
+		program.instructions.push_back(instr);
+
+		if (!canContinue) {
+			complete = false;
+			break;
+		}
+	}
+
+	resolveJumps(program, complete ? ncs.pos() : UINT32_MAX);
+}
+
+bool NCSFile::decodeArguments(Common::SeekableReadStream &ncs, Program &program, Instruction &instr) {
+	switch (instr.opcode) {
+		case 0x01: // CPDOWNSP
+		case 0x03: // CPTOPSP
+		case 0x26: // CPDOWNBP
+		case 0x27: // CPTOPBP
+		case 0x30: // WRITEARRAY
+		case 0x32: // READARRAY
+		case 0x37: // GETREF
+		case 0x39: // GETREFARRAY
+			instr.args[0] = ncs.readSint32BE();
+			instr.args[1] = ncs.readSint16BE();
+			break;
+
+		case 0x04: // CONST
+			switch (instr.type) {
+				case kInstTypeInt:
+					instr.args[0] = ncs.readSint32BE();
+					break;
+
+				case kInstTypeFloat:
+					instr.argFloat = ncs.readIEEEFloatBE();
+					break;
+
+				case kInstTypeString:
+				case kInstTypeResource:
+					instr.index = program.strings.size();
+					program.strings.push_back(Common::readStringFixed(ncs, Common::kEncodingASCII, ncs.readUint16BE()));
+					break;
+
+				case kInstTypeObject:
+					instr.args[0] = (int32_t) ncs.readUint32BE();
+					break;
+
+				default:
+					// We don't know how long this instruction is. o_const() will complain
+					return false;
+			}
+			break;
+
+		case 0x05: // ACTION
+			instr.args[0] = ncs.readUint16BE();
+			instr.args[1] = ncs.readByte();
+			break;
+
+		case 0x0B: // EQ
+		case 0x0C: // NEQ
+			// Comparisons between two structs (or two vectors) come with the size of the type
+			if (instr.type == kInstTypeStructStruct)
+				instr.args[0] = ncs.readUint16BE();
+			break;
+
+		case 0x1B: // MOVSP
+		case 0x1D: // JMP
+		case 0x1E: // JSR
+		case 0x1F: // JZ
+		case 0x23: // DECSP
+		case 0x24: // INCSP
+		case 0x25: // JNZ
+		case 0x28: // DECBP
+		case 0x29: // INCBP
+			instr.args[0] = ncs.readSint32BE();
+			break;
+
+		case 0x21: // DESTRUCT
+			instr.args[0] = ncs.readSint16BE();
+			instr.args[1] = ncs.readSint16BE();
+			instr.args[2] = ncs.readSint16BE();
+			break;
+
+		case 0x2C: // STORESTATE
+			instr.args[0] = (int32_t) ncs.readUint32BE();
+			instr.args[1] = (int32_t) ncs.readUint32BE();
+			break;
+
+		default:
+			break;
+	}
+
+	return true;
+}
+
+void NCSFile::resolveJumps(Program &program, uint32_t end) {
+	for (std::vector<Instruction>::iterator i = program.instructions.begin(); i != program.instructions.end(); ++i) {
+		if ((i->opcode != 0x1D) && (i->opcode != 0x1E) && (i->opcode != 0x1F) && (i->opcode != 0x25))
+			continue;
+
+		if (i->proc == &NCSFile::o_invalid)
+			continue;
+
+		// Jump offsets are relative to the start of the jump instruction
+		const uint32_t target = i->address + (uint32_t) i->args[0];
+
+		// Jumping right behind the last instruction ends the script
+		if (target == end)
+			i->index = program.instructions.size();
+		else
+			i->index = program.findInstruction(target);
+	}
+}
+
+size_t NCSFile::getInstruction(uint32_t address) const {
+	const size_t index = _program->findInstruction(address);
+	if (index == kInvalidIndex)
+		throw Common::Exception("NCSFile: No instruction at offset %u", address);
+
+	return index;
+}
+
 void NCSFile::reset() {
 	_stack.reset();
 
@@ -365,7 +657,22 @@ void NCSFile::reset() {
 	_storedState.setType(kTypeVoid);
 	_return.setType(kTypeVoid);
 
-	_script->seek(13); // 8 byte header + 5 byte program size dummy op
+	_pc = 0;
+
+	_instructionCount = 0;
+	_suspended        = false;
+}
+
+void NCSFile::setInstructionBudget(size_t budget) {
+	_instructionBudget = budget;
+}
+
+bool NCSFile::isSuspended() const {
+	return _suspended;
+}
+
+const ScriptState &NCSFile::getContinuation() const {
+	return _continuation;
 }
 
 const Variable &NCSFile::run(Object *owner, Object *triggerer) {
@@ -386,7 +693,12 @@ const Variable &NCSFile::run(const ScriptState &state, const ObjectReference own
 
 	reset();
 
-	_script->seek(state.offset);
+	if (!_program->instructions.empty())
+		_pc = getInstruction(state.offset);
+
+	// Restore the subroutine calls of a suspended script
+	for (std::vector<uint32_t>::const_iterator r = state.returnOffsets.begin(); r != state.returnOffsets.end(); ++r)
+		_returnOffsets.push((*r == UINT32_MAX) ? _program->instructions.size() : getInstruction(*r));
 
 	// Push global variables
 	std::vector<class Variable>::const_reverse_iterator var;
@@ -403,12 +715,41 @@ const Variable &NCSFile::run(const ScriptState &state, const ObjectReference own
 }
 
 const Variable &NCSFile::execute(const ObjectReference owner, const ObjectReference triggerer) {
+	PROFILE_ZONE("NCSFile::execute");
+
+	Common::DebugManager::addMetric(Common::kMetricScriptsExecuted);
+	PROFILE_NOTE("script", _name);
+
 	_owner     = owner;
 	_triggerer = triggerer;
 
-	while (executeStep())
+	// Only check once whether we need to produce debug output
+	const bool debug = Common::DebugManager::isChannelEnabled(kDebugScripts, 1);
+
+	const bool profile = ScriptProfiler.isEnabled();
+	const uint64_t start = profile ? Profiler::getTime() : 0;
+
+	while (executeStep(debug))
 		;
 
+	if (profile)
+		ScriptProfiler.addScript(_name, _instructionCount, Profiler::getTime() - start);
+
+	if (_suspended) {
+		saveContinuation();
+
+		debugC(kDebugScripts, 1, "=> Script \"%s\" suspended after %u instructions",
+		       _name.c_str(), (uint)_instructionCount);
+
+		_stack.reset();
+		_return.setType(kTypeVoid);
+
+		_owner     = 0;
+		_triggerer = 0;
+
+		return _return;
+	}
+
 	if (!_stack.empty())
 		_return = _stack.top();
 
@@ -422,44 +763,100 @@ const Variable &NCSFile::execute(const ObjectReference owner, const ObjectRefere
 	return _return;
 }
 
-bool NCSFile::executeStep() {
-	byte opcode, type;
-
-	try {
-		opcode = _script->readByte();
-		type   = _script->readByte();
-	} catch (...) {
+bool NCSFile::executeStep(bool debug) {
+	const std::vector<Instruction> &instructions = _program->instructions;
+	if (_pc >= instructions.size())
 		return false;
+
+	const Instruction &instr = instructions[_pc++];
+	_instructionCount++;
+
+	if (debug && (instr.proc != &NCSFile::o_invalid))
+		debugC(kDebugScripts, 1, "NWScript opcode %s [0x%02X]", _opcodes[instr.opcode].desc, instr.opcode);
+
+	(this->*(instr.proc))(instr);
+
+	if (debug) {
+		int32_t returnAddress = -1;
+		if (!_returnOffsets.empty() && (_returnOffsets.top() < instructions.size()))
+			returnAddress = instructions[_returnOffsets.top()].address;
+
+		_stack.print();
+		debugC(kDebugScripts, 2, "[RETURN: %d]", returnAddress);
 	}
 
-	if ((opcode >= _opcodeListSize) || (!_opcodes[opcode].proc))
-		throw Common::Exception("NCSFile::executeStep(): Illegal instruction 0x%02x", opcode);
+	return !_suspended;
+}
+
+void NCSFile::jump(const Instruction &instr) {
+	if (instr.index == kInvalidIndex)
+		throw Common::Exception("NCSFile::jump(): Invalid jump target %u",
+		                        (uint)(instr.address + (uint32_t) instr.args[0]));
 
-	debugC(kDebugScripts, 1, "NWScript opcode %s [0x%02X]", _opcodes[opcode].desc, opcode);
+	const size_t current = _pc - 1;
 
-	(this->*(_opcodes[opcode].proc))((InstructionType)type);
+	_pc = instr.index;
 
-	_stack.print();
-	debugC(kDebugScripts, 2, "[RETURN: %d]",
-	       _returnOffsets.empty() ? -1 : _returnOffsets.top());
+	// Only suspend at backward jumps, so that straight-line code always runs through
+	if (_instructionBudget && (_instructionCount >= _instructionBudget) && (_pc <= current))
+		_suspended = canSuspend();
+}
+
+bool NCSFile::canSuspend() {
+	/* A pending STORESTATE and references into the stack can't be carried
+	 * over into a continuation. Neither can a stack that's been unwound
+	 * below the base pointer. */
+
+	if (_storedState.getType() != kTypeVoid)
+		return false;
+
+	if (_stack.getStackPtr() > _stack.getBasePtr())
+		return false;
+
+	for (int32_t posSP = -4; posSP >= _stack.getStackPtr(); posSP -= 4)
+		if (_stack.getRelSP(posSP).getType() == kTypeReference)
+			return false;
 
 	return true;
 }
 
-void NCSFile::decompile() {
-	uint32_t oldScriptPos = _script->pos();
-	_script->seek(13); // 8 byte header + 5 byte program size dummy op
+void NCSFile::saveContinuation() {
+	const std::vector<Instruction> &instructions = _program->instructions;
 
-	// TODO
+	_continuation = ScriptState();
+	_continuation.offset = instructions[_pc].address;
+
+	// Everything up to the base pointer becomes the globals, everything above it the locals
+	uint32_t sizeBP = _stack.getBasePtr() / -4;
+	uint32_t sizeSP = (_stack.getBasePtr() - _stack.getStackPtr()) / 4;
 
-	_script->seek(oldScriptPos);
+	for (int32_t posBP = -4; sizeBP > 0; sizeBP--, posBP -= 4)
+		_continuation.globals.push_back(_stack.getRelBP(posBP));
+
+	for (int32_t posSP = -4; sizeSP > 0; sizeSP--, posSP -= 4)
+		_continuation.locals.push_back(_stack.getRelSP(posSP));
+
+	std::stack<size_t> returnOffsets = _returnOffsets;
+	while (!returnOffsets.empty()) {
+		const size_t returnOffset = returnOffsets.top();
+		returnOffsets.pop();
+
+		_continuation.returnOffsets.push_back((returnOffset < instructions.size()) ?
+		                                      instructions[returnOffset].address : UINT32_MAX);
+	}
+
+	std::reverse(_continuation.returnOffsets.begin(), _continuation.returnOffsets.end());
+}
+
+void NCSFile::decompile() {
+	// TODO
 }
 
 // OPCODES!
 
 /** RSADD: push an empty variable onto the stack. */
-void NCSFile::o_rsadd(InstructionType type) {
-	switch (type) {
+void NCSFile::o_rsadd(const Instruction &instr) {
+	switch (instr.type) {
 		case kInstTypeInt:
 			_stack.push(kTypeInt);
 			break;
@@ -495,24 +892,24 @@ void NCSFile::o_rsadd(InstructionType type) {
 			_stack.push(kTypeArray);
 			break;
 		default:
-			throw Common::Exception("NCSFile::o_rsadd(): Illegal type %d", type);
+			throw Common::Exception("NCSFile::o_rsadd(): Illegal type %d", instr.type);
 	}
 }
 
 /** CONST: push a constant (predetermined value) variable onto the stack. */
-void NCSFile::o_const(InstructionType type) {
-	switch (type) {
+void NCSFile::o_const(const Instruction &instr) {
+	switch (instr.type) {
 		case kInstTypeInt:
-			_stack.push(_script->readSint32BE());
+			_stack.push(instr.args[0]);
 			break;
 
 		case kInstTypeFloat:
-			_stack.push(_script->readIEEEFloatBE());
+			_stack.push(instr.argFloat);
 			break;
 
 		case kInstTypeString:
 		case kInstTypeResource: {
-			_stack.push(Common::readStringFixed(*_script, Common::kEncodingASCII, _script->readUint16BE()));
+			_stack.push(_program->strings[instr.index]);
 			break;
 		}
 
@@ -525,7 +922,7 @@ void NCSFile::o_const(InstructionType type) {
 			 * magic values. They *should* all have the same effect, though.
 			 */
 
-			uint32_t objectID = _script->readUint32BE();
+			uint32_t objectID = (uint32_t) instr.args[0];
 
 			if      (objectID == kScriptObjectSelf)
 				_stack.push(_owner);
@@ -542,7 +939,7 @@ void NCSFile::o_const(InstructionType type) {
 		}
 
 		default:
-			throw Common::Exception("NCSFile::o_const(): Illegal type %d", type);
+			throw Common::Exception("NCSFile::o_const(): Illegal type %d", instr.type);
 	}
 }
 
@@ -620,7 +1017,8 @@ void NCSFile::callEngine(Aurora::NWScript::FunctionContext &ctx,
 		case kTypeObject:
 		case kTypeEngineType:
 		case kTypeArray:
-			_stack.push(retVal);
+			// The context is reset before it's used again, so we can take the value
+			_stack.push(std::move(retVal));
 			break;
 
 		case kTypeVector: {
@@ -643,28 +1041,32 @@ void NCSFile::callEngine(Aurora::NWScript::FunctionContext &ctx,
 }
 
 /** ACTION: call a game-specific engine function. */
-void NCSFile::o_action(InstructionType type) {
-	if (type != kInstTypeNone)
-		throw Common::Exception("NCSFile::o_action(): Illegal type %d", type);
+void NCSFile::o_action(const Instruction &instr) {
+	if (instr.type != kInstTypeNone)
+		throw Common::Exception("NCSFile::o_action(): Illegal type %d", instr.type);
 
-	uint16_t routineNumber = _script->readUint16BE();
-	uint8_t  argCount      = _script->readByte();
+	uint16_t routineNumber = instr.args[0];
+	uint8_t  argCount      = instr.args[1];
 
-	Aurora::NWScript::FunctionContext ctx = FunctionMan.createContext(routineNumber);
+	std::unique_ptr<Aurora::NWScript::FunctionContext> ctx = FunctionMan.acquireContext(routineNumber);
 
 	try {
-		callEngine(ctx, routineNumber, argCount);
+		callEngine(*ctx, routineNumber, argCount);
 	} catch (Common::Exception &e) {
 		e.add("Failed running engine function \"%s\" (%d)",
-		      ctx.getName().c_str(), routineNumber);
+		      ctx->getName().c_str(), routineNumber);
+
+		FunctionMan.releaseContext(routineNumber, std::move(ctx));
 		throw;
 	}
+
+	FunctionMan.releaseContext(routineNumber, std::move(ctx));
 }
 
 /** LOGAND: perform a logical boolean AND (&&). */
-void NCSFile::o_logand(InstructionType type) {
-	if (type != kInstTypeIntInt)
-		throw Common::Exception("NCSFile::o_logand(): Illegal type %d", type);
+void NCSFile::o_logand(const Instruction &instr) {
+	if (instr.type != kInstTypeIntInt)
+		throw Common::Exception("NCSFile::o_logand(): Illegal type %d", instr.type);
 
 	int32_t arg1 = _stack.pop().getInt();
 	int32_t arg2 = _stack.pop().getInt();
@@ -672,9 +1074,9 @@ void NCSFile::o_logand(InstructionType type) {
 }
 
 /** LOGOR: perform a logical boolean OR (||). */
-void NCSFile::o_logor(InstructionType type) {
-	if (type != kInstTypeIntInt)
-		throw Common::Exception("NCSFile::o_logor(): Illegal type %d", type);
+void NCSFile::o_logor(const Instruction &instr) {
+	if (instr.type != kInstTypeIntInt)
+		throw Common::Exception("NCSFile::o_logor(): Illegal type %d", instr.type);
 
 	int32_t arg1 = _stack.pop().getInt();
 	int32_t arg2 = _stack.pop().getInt();
@@ -682,9 +1084,9 @@ void NCSFile::o_logor(InstructionType type) {
 }
 
 /** INCOR: perform a bit-wise inclusive OR (|). */
-void NCSFile::o_incor(InstructionType type) {
-	if (type != kInstTypeIntInt)
-		throw Common::Exception("NCSFile::o_incor(): Illegal type %d", type);
+void NCSFile::o_incor(const Instruction &instr) {
+	if (instr.type != kInstTypeIntInt)
+		throw Common::Exception("NCSFile::o_incor(): Illegal type %d", instr.type);
 
 	int32_t arg1 = _stack.pop().getInt();
 	int32_t arg2 = _stack.pop().getInt();
@@ -692,9 +1094,9 @@ void NCSFile::o_incor(InstructionType type) {
 }
 
 /** EXCOR: perform a bit-wise exclusive OR (^). */
-void NCSFile::o_excor(InstructionType type) {
-	if (type != kInstTypeIntInt)
-		throw Common::Exception("NCSFile::o_excor(): Illegal type %d", type);
+void NCSFile::o_excor(const Instruction &instr) {
+	if (instr.type != kInstTypeIntInt)
+		throw Common::Exception("NCSFile::o_excor(): Illegal type %d", instr.type);
 
 	int32_t arg1 = _stack.pop().getInt();
 	int32_t arg2 = _stack.pop().getInt();
@@ -702,9 +1104,9 @@ void NCSFile::o_excor(InstructionType type) {
 }
 
 /** BOOLAND: perform a bit-wise AND (&). */
-void NCSFile::o_booland(InstructionType type) {
-	if (type != kInstTypeIntInt)
-		throw Common::Exception("NCSFile::o_booland(): Illegal type %d", type);
+void NCSFile::o_booland(const Instruction &instr) {
+	if (instr.type != kInstTypeIntInt)
+		throw Common::Exception("NCSFile::o_booland(): Illegal type %d", instr.type);
 
 	int32_t arg1 = _stack.pop().getInt();
 	int32_t arg2 = _stack.pop().getInt();
@@ -712,13 +1114,13 @@ void NCSFile::o_booland(InstructionType type) {
 }
 
 /** EQ: compare the top-most stack elements for equality (==). */
-void NCSFile::o_eq(InstructionType type) {
+void NCSFile::o_eq(const Instruction &instr) {
 	size_t n = 1;
 
-	if (type == kInstTypeStructStruct) {
+	if (instr.type == kInstTypeStructStruct) {
 		// Comparisons between two structs (or two vectors) come with the size of the type
 
-		const size_t size = _script->readUint16BE();
+		const size_t size = instr.args[0];
 
 		if ((size % 4) != 0)
 			throw Common::Exception("NCSFile::o_eq(): size %% 4 != 0");
@@ -741,13 +1143,13 @@ void NCSFile::o_eq(InstructionType type) {
 }
 
 /** NEQ: compare the top-most stack elements for inequality (!=). */
-void NCSFile::o_neq(InstructionType type) {
+void NCSFile::o_neq(const Instruction &instr) {
 	size_t n = 1;
 
-	if (type == kInstTypeStructStruct) {
+	if (instr.type == kInstTypeStructStruct) {
 		// Comparisons between two structs (or two vectors) come with the size of the type
 
-		const size_t size = _script->readUint16BE();
+		const size_t size = instr.args[0];
 
 		if ((size % 4) != 0)
 			throw Common::Exception("NCSFile::o_neq(): size %% 4 != 0");
@@ -770,8 +1172,8 @@ void NCSFile::o_neq(InstructionType type) {
 }
 
 /** GEQ: compare the top-most stack elements, greater-or-equal (>=). */
-void NCSFile::o_geq(InstructionType type) {
-	switch (type) {
+void NCSFile::o_geq(const Instruction &instr) {
+	switch (instr.type) {
 		case kInstTypeIntInt:
 			{
 				int32_t arg1 = _stack.pop().getInt();
@@ -789,13 +1191,13 @@ void NCSFile::o_geq(InstructionType type) {
 			break;
 
 		default:
-			throw Common::Exception("NCSFile::o_geq(): Illegal type %d", type);
+			throw Common::Exception("NCSFile::o_geq(): Illegal type %d", instr.type);
 	}
 }
 
 /** GT: compare the top-most stack elements, greater (>). */
-void NCSFile::o_gt(InstructionType type) {
-	switch (type) {
+void NCSFile::o_gt(const Instruction &instr) {
+	switch (instr.type) {
 		case kInstTypeIntInt:
 			{
 				int32_t arg1 = _stack.pop().getInt();
@@ -813,13 +1215,13 @@ void NCSFile::o_gt(InstructionType type) {
 			break;
 
 		default:
-			throw Common::Exception("NCSFile::o_gt(): Illegal type %d", type);
+			throw Common::Exception("NCSFile::o_gt(): Illegal type %d", instr.type);
 	}
 }
 
 /** LT: compare the top-most stack elements, less (<). */
-void NCSFile::o_lt(InstructionType type) {
-	switch (type) {
+void NCSFile::o_lt(const Instruction &instr) {
+	switch (instr.type) {
 		case kInstTypeIntInt:
 			{
 				int32_t arg1 = _stack.pop().getInt();
@@ -837,13 +1239,13 @@ void NCSFile::o_lt(InstructionType type) {
 			break;
 
 		default:
-			throw Common::Exception("NCSFile::o_lt(): Illegal type %d", type);
+			throw Common::Exception("NCSFile::o_lt(): Illegal type %d", instr.type);
 	}
 }
 
 /** LEQ: compare the top-most stack elements, less-or-equal (<=). */
-void NCSFile::o_leq(InstructionType type) {
-	switch (type) {
+void NCSFile::o_leq(const Instruction &instr) {
+	switch (instr.type) {
 		case kInstTypeIntInt:
 			{
 				int32_t arg1 = _stack.pop().getInt();
@@ -861,14 +1263,14 @@ void NCSFile::o_leq(InstructionType type) {
 			break;
 
 		default:
-			throw Common::Exception("NCSFile::o_leq(): Illegal type %d", type);
+			throw Common::Exception("NCSFile::o_leq(): Illegal type %d", instr.type);
 	}
 }
 
 /** SHLEFT: shift the top-most stack element to the left (<<). */
-void NCSFile::o_shleft(InstructionType type) {
-	if (type != kInstTypeIntInt)
-		throw Common::Exception("NCSFile::o_shleft(): Illegal type %d", type);
+void NCSFile::o_shleft(const Instruction &instr) {
+	if (instr.type != kInstTypeIntInt)
+		throw Common::Exception("NCSFile::o_shleft(): Illegal type %d", instr.type);
 
 	int32_t arg1 = _stack.pop().getInt();
 	int32_t arg2 = _stack.pop().getInt();
@@ -876,15 +1278,15 @@ void NCSFile::o_shleft(InstructionType type) {
 }
 
 /** SHRIGHT: signed-shift the top-most stack element to the right (>>>). */
-void NCSFile::o_shright(InstructionType type) {
+void NCSFile::o_shright(const Instruction &instr) {
 	/* According to Skywing's NWNScriptLib
 	 * (<https://github.com/SkywingvL/nwn2dev-public/blob/master/NWNScriptLib/NWScriptVM.cpp#L2233>):
 	 * "The operation implemented here is actually a complex sequence that, if
 	 *  the amount to be shifted is negative, involves both a front-loaded and
 	 *  end-loaded negate built on top of a signed shift." */
 
-	if (type != kInstTypeIntInt)
-		throw Common::Exception("NCSFile::o_shright(): Illegal type %d", type);
+	if (instr.type != kInstTypeIntInt)
+		throw Common::Exception("NCSFile::o_shright(): Illegal type %d", instr.type);
 
 	int32_t arg1 = _stack.pop().getInt();
 	int32_t arg2 = _stack.pop().getInt();
@@ -897,14 +1299,14 @@ void NCSFile::o_shright(InstructionType type) {
 }
 
 /** USHRIGHT: shift the top-most stack element to the right (>>). */
-void NCSFile::o_ushright(InstructionType type) {
+void NCSFile::o_ushright(const Instruction &instr) {
 	/* According to Skywing's NWNScriptLib
 	 * (<https://github.com/SkywingvL/nwn2dev-public/blob/master/NWNScriptLib/NWScriptVM.cpp#L2272>):
 	 * "While this operator may have originally been intended to implement
 	 *  an unsigned shift, it actually performs an arithmetic (signed) shift." */
 
-	if (type != kInstTypeIntInt)
-		throw Common::Exception("NCSFile::o_ushright(): Illegal type %d", type);
+	if (instr.type != kInstTypeIntInt)
+		throw Common::Exception("NCSFile::o_ushright(): Illegal type %d", instr.type);
 
 	int32_t arg1 = _stack.pop().getInt();
 	int32_t arg2 = _stack.pop().getInt();
@@ -912,9 +1314,9 @@ void NCSFile::o_ushright(InstructionType type) {
 }
 
 /** MOD: calculate the remainder (modulo) of an integer division (%). */
-void NCSFile::o_mod(InstructionType type) {
-	if (type != kInstTypeIntInt)
-		throw Common::Exception("NCSFile::o_mod(): Illegal type %d", type);
+void NCSFile::o_mod(const Instruction &instr) {
+	if (instr.type != kInstTypeIntInt)
+		throw Common::Exception("NCSFile::o_mod(): Illegal type %d", instr.type);
 
 	int32_t arg1 = _stack.pop().getInt();
 	int32_t arg2 = _stack.pop().getInt();
@@ -928,8 +1330,8 @@ void NCSFile::o_mod(InstructionType type) {
 }
 
 /** NEQ: negate the top-most stack element (unary -). */
-void NCSFile::o_neg(InstructionType type) {
-	switch (type) {
+void NCSFile::o_neg(const Instruction &instr) {
+	switch (instr.type) {
 		case kInstTypeInt:
 			_stack.push(-_stack.pop().getInt());
 			break;
@@ -939,101 +1341,96 @@ void NCSFile::o_neg(InstructionType type) {
 			break;
 
 		default:
-			throw Common::Exception("NCSFile::o_neg(): Illegal type %d", type);
+			throw Common::Exception("NCSFile::o_neg(): Illegal type %d", instr.type);
 	}
 }
 
 /** COMP: calculate the 1-complement of the top-most stack element (~). */
-void NCSFile::o_comp(InstructionType type) {
-	if (type != kInstTypeInt)
-		throw Common::Exception("NCSFile::o_comp(): Illegal type %d", type);
+void NCSFile::o_comp(const Instruction &instr) {
+	if (instr.type != kInstTypeInt)
+		throw Common::Exception("NCSFile::o_comp(): Illegal type %d", instr.type);
 
 	_stack.push(~_stack.pop().getInt());
 }
 
 /** MOVSP: pop elements off the stack. */
-void NCSFile::o_movsp(InstructionType type) {
-	if (type != kInstTypeNone)
-		throw Common::Exception("NCSFile::o_movsp(): Illegal type %d", type);
+void NCSFile::o_movsp(const Instruction &instr) {
+	if (instr.type != kInstTypeNone)
+		throw Common::Exception("NCSFile::o_movsp(): Illegal type %d", instr.type);
 
-	_stack.setStackPtr(_stack.getStackPtr() - _script->readSint32BE());
+	_stack.setStackPtr(_stack.getStackPtr() - instr.args[0]);
 }
 
 /** JMP: jump directly to a different script offset. */
-void NCSFile::o_jmp(InstructionType type) {
-	if (type != kInstTypeNone)
-		throw Common::Exception("NCSFile::o_jmp(): Illegal type %d", type);
+void NCSFile::o_jmp(const Instruction &instr) {
+	if (instr.type != kInstTypeNone)
+		throw Common::Exception("NCSFile::o_jmp(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE();
-	_script->skip(offset - 6);
+	jump(instr);
 }
 
 /** JZ: jump conditionally if the top-most stack element is 0. */
-void NCSFile::o_jz(InstructionType type) {
-	if (type != kInstTypeNone)
-		throw Common::Exception("NCSFile::o_jz(): Illegal type %d", type);
-
-	int32_t offset = _script->readSint32BE();
+void NCSFile::o_jz(const Instruction &instr) {
+	if (instr.type != kInstTypeNone)
+		throw Common::Exception("NCSFile::o_jz(): Illegal type %d", instr.type);
 
 	if (!_stack.pop().getInt())
-		_script->skip(offset - 6);
+		jump(instr);
 }
 
 /** NOT: boolean-negate the top-most stack element (!). */
-void NCSFile::o_not(InstructionType type) {
-	if (type != kInstTypeInt)
-		throw Common::Exception("NCSFile::o_not(): Illegal type %d", type);
+void NCSFile::o_not(const Instruction &instr) {
+	if (instr.type != kInstTypeInt)
+		throw Common::Exception("NCSFile::o_not(): Illegal type %d", instr.type);
 
 	_stack.push(!_stack.pop().getInt());
 }
 
 /** DECSP: decrement the value of a stack element (--). */
-void NCSFile::o_decsp(InstructionType type) {
-	if (type != kInstTypeInt)
-		throw Common::Exception("NCSFile::o_decsp(): Illegal type %d", type);
+void NCSFile::o_decsp(const Instruction &instr) {
+	if (instr.type != kInstTypeInt)
+		throw Common::Exception("NCSFile::o_decsp(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE();
+	int32_t offset = instr.args[0];
 
 	_stack.setRelSP(offset, _stack.getRelSP(offset).getInt() - 1);
 }
 
 /** INCSP: increment the value of a stack element (++). */
-void NCSFile::o_incsp(InstructionType type) {
-	if (type != kInstTypeInt)
-		throw Common::Exception("NCSFile::o_incsp(): Illegal type %d", type);
+void NCSFile::o_incsp(const Instruction &instr) {
+	if (instr.type != kInstTypeInt)
+		throw Common::Exception("NCSFile::o_incsp(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE();
+	int32_t offset = instr.args[0];
 
 	_stack.setRelSP(offset, _stack.getRelSP(offset).getInt() + 1);
 }
 
 /** JNZ: jump conditionally if the top-most stack element is not 0. */
-void NCSFile::o_jnz(InstructionType type) {
-	if (type != kInstTypeNone)
-		throw Common::Exception("NCSFile::o_jnz(): Illegal type %d", type);
-
-	int32_t offset = _script->readSint32BE();
+void NCSFile::o_jnz(const Instruction &instr) {
+	if (instr.type != kInstTypeNone)
+		throw Common::Exception("NCSFile::o_jnz(): Illegal type %d", instr.type);
 
 	if (_stack.pop().getInt())
-		_script->skip(offset - 6);
+		jump(instr);
 }
 
 /** DECBP: decrement the value of a base-pointer stack element (--). */
-void NCSFile::o_decbp(InstructionType type) {
-	if (type != kInstTypeInt)
-		throw Common::Exception("NCSFile::o_decbp(): Illegal type %d", type);
+void NCSFile::o_decbp(const Instruction &instr) {
+	if (instr.type != kInstTypeInt)
+		throw Common::Exception("NCSFile::o_decbp(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE();
+	int32_t offset = instr.args[0];
 
 	_stack.setRelBP(offset, _stack.getRelBP(offset).getInt() - 1);
 }
 
 /** INCBP: increment the value of a base-pointer stack element (++). */
-void NCSFile::o_incbp(InstructionType type) {
-	if (type != kInstTypeInt)
-		throw Common::Exception("NCSFile::o_incbp(): Illegal type %d", type);
+void NCSFile::o_incbp(const Instruction &instr) {
+	if (instr.type != kInstTypeInt)
+		throw Common::Exception("NCSFile::o_incbp(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE();
+	int32_t offset = instr.args[0];
 
 	_stack.setRelBP(offset, _stack.getRelBP(offset).getInt() + 1);
 }
@@ -1042,9 +1439,9 @@ void NCSFile::o_incbp(InstructionType type) {
  *
  *  Used to create an anchor point to access global variables.
  */
-void NCSFile::o_savebp(InstructionType type) {
-	if (type != kInstTypeNone)
-		throw Common::Exception("NCSFile::o_savebp(): Illegal type %d", type);
+void NCSFile::o_savebp(const Instruction &instr) {
+	if (instr.type != kInstTypeNone)
+		throw Common::Exception("NCSFile::o_savebp(): Illegal type %d", instr.type);
 
 	_stack.push(_stack.getBasePtr());
 	_stack.setBasePtr(_stack.getStackPtr());
@@ -1054,25 +1451,25 @@ void NCSFile::o_savebp(InstructionType type) {
  *
  *  Destroy the global variables anchor point after use.
  */
-void NCSFile::o_restorebp(InstructionType type) {
-	if (type != kInstTypeNone)
-		throw Common::Exception("NCSFile::o_restorebp(): Illegal type %d", type);
+void NCSFile::o_restorebp(const Instruction &instr) {
+	if (instr.type != kInstTypeNone)
+		throw Common::Exception("NCSFile::o_restorebp(): Illegal type %d", instr.type);
 
 	_stack.setBasePtr(_stack.pop().getInt());
 }
 
 /** NOP: no operation. */
-void NCSFile::o_nop(InstructionType UNUSED(type)) {
+void NCSFile::o_nop(const Instruction &UNUSED(instr)) {
 	// Nothing! Yay!
 }
 
 /** CPDOWNSP: copy a value into an existing stack element. */
-void NCSFile::o_cpdownsp(InstructionType type) {
-	if (type != kInstTypeDirect)
-		throw Common::Exception("NCSFile::o_cpdownsp(): Illegal type %d", type);
+void NCSFile::o_cpdownsp(const Instruction &instr) {
+	if (instr.type != kInstTypeDirect)
+		throw Common::Exception("NCSFile::o_cpdownsp(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE();
-	int16_t size   = _script->readSint16BE();
+	int32_t offset = instr.args[0];
+	int16_t size   = instr.args[1];
 
 	if ((size % 4) != 0)
 		throw Common::Exception("NCSFile::o_cpdownsp(): Illegal size %d", size);
@@ -1088,12 +1485,12 @@ void NCSFile::o_cpdownsp(InstructionType type) {
 }
 
 /** CPTOPSP: push a copy of a stack element on top of the stack. */
-void NCSFile::o_cptopsp(InstructionType type) {
-	if (type != kInstTypeDirect)
-		throw Common::Exception("NCSFile::o_cptopsp(): Illegal type %d", type);
+void NCSFile::o_cptopsp(const Instruction &instr) {
+	if (instr.type != kInstTypeDirect)
+		throw Common::Exception("NCSFile::o_cptopsp(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE();
-	int16_t size   = _script->readSint16BE();
+	int32_t offset = instr.args[0];
+	int16_t size   = instr.args[1];
 
 	if ((size % 4) != 0)
 		throw Common::Exception("NCSFile::o_cptopsp(): Illegal size %d", size);
@@ -1106,8 +1503,8 @@ void NCSFile::o_cptopsp(InstructionType type) {
 }
 
 /** ADD: add the top-most stack elements (+). */
-void NCSFile::o_add(InstructionType type) {
-	switch (type) {
+void NCSFile::o_add(const Instruction &instr) {
+	switch (instr.type) {
 		case kInstTypeIntInt: {
 			Variable op2 = _stack.pop();
 			Variable op1 = _stack.pop();
@@ -1163,13 +1560,13 @@ void NCSFile::o_add(InstructionType type) {
 		}
 
 		default:
-			throw Common::Exception("NCSFile::o_add(): Illegal type %d", type);
+			throw Common::Exception("NCSFile::o_add(): Illegal type %d", instr.type);
 	}
 }
 
 /** SUB: subtract the top-most stack elements (-). */
-void NCSFile::o_sub(InstructionType type) {
-	switch (type) {
+void NCSFile::o_sub(const Instruction &instr) {
+	switch (instr.type) {
 		case kInstTypeIntInt: {
 			Variable op2 = _stack.pop();
 			Variable op1 = _stack.pop();
@@ -1217,13 +1614,13 @@ void NCSFile::o_sub(InstructionType type) {
 		}
 
 		default:
-			throw Common::Exception("NCSFile::o_sub(): Illegal type %d", type);
+			throw Common::Exception("NCSFile::o_sub(): Illegal type %d", instr.type);
 	}
 }
 
 /** MUL: multiply the top-most stack elements (*). */
-void NCSFile::o_mul(InstructionType type) {
-	switch (type) {
+void NCSFile::o_mul(const Instruction &instr) {
+	switch (instr.type) {
 		case kInstTypeIntInt: {
 			Variable op2 = _stack.pop();
 			Variable op1 = _stack.pop();
@@ -1281,13 +1678,13 @@ void NCSFile::o_mul(InstructionType type) {
 		}
 
 		default:
-			throw Common::Exception("NCSFile::o_mul(): Illegal type %d", type);
+			throw Common::Exception("NCSFile::o_mul(): Illegal type %d", instr.type);
 	}
 }
 
 /** DIV: divide the top-most stack elements (/). */
-void NCSFile::o_div(InstructionType type) {
-	switch (type) {
+void NCSFile::o_div(const Instruction &instr) {
+	switch (instr.type) {
 		case kInstTypeIntInt: {
 			Variable op2 = _stack.pop();
 			Variable op1 = _stack.pop();
@@ -1366,13 +1763,13 @@ void NCSFile::o_div(InstructionType type) {
 		}
 
 		default:
-			throw Common::Exception("NCSFile::o_div(): Illegal type %d", type);
+			throw Common::Exception("NCSFile::o_div(): Illegal type %d", instr.type);
 	}
 }
 
 /** STORESTATEALL: unused, obsolete opcode. Hopefully. */
-void NCSFile::o_storestateall(InstructionType type) {
-	uint8_t  offset = (uint8_t) type;
+void NCSFile::o_storestateall(const Instruction &instr) {
+	uint8_t  offset = (uint8_t) instr.type;
 
 	// TODO: NCSFile::o_storestateall(): See o_storestate.
 	//       Supposedly obsolete. Whether it's used anywhere remains to be seen.
@@ -1380,37 +1777,35 @@ void NCSFile::o_storestateall(InstructionType type) {
 }
 
 /** JSR: call a subroutine. */
-void NCSFile::o_jsr(InstructionType type) {
-	if (type != kInstTypeNone)
-		throw Common::Exception("NCSFile::o_jsr(): Illegal type %d", type);
+void NCSFile::o_jsr(const Instruction &instr) {
+	if (instr.type != kInstTypeNone)
+		throw Common::Exception("NCSFile::o_jsr(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE();
+	// Push the position of the next instruction
+	_returnOffsets.push(_pc);
 
-	// Push the current script position
-	_returnOffsets.push(_script->pos());
-
-	_script->skip(offset - 6);
+	jump(instr);
 }
 
 /** RETN: return from a subroutine call. */
-void NCSFile::o_retn(InstructionType UNUSED(type)) {
-	uint32_t returnAddress = _script->size();
+void NCSFile::o_retn(const Instruction &UNUSED(instr)) {
+	size_t returnAddress = _program->instructions.size();
 	if (!_returnOffsets.empty()) {
 		returnAddress = _returnOffsets.top();
 		_returnOffsets.pop();
 	}
 
-	_script->seek(returnAddress);
+	_pc = returnAddress;
 }
 
 /** DESTRUCT: remove elements from the stack.
  *
  *  Used to isolate struct elements.
  */
-void NCSFile::o_destruct(InstructionType UNUSED(type)) {
-	int16_t stackSize        = _script->readSint16BE();
-	int16_t dontRemoveOffset = _script->readSint16BE();
-	int16_t dontRemoveSize   = _script->readSint16BE();
+void NCSFile::o_destruct(const Instruction &instr) {
+	int16_t stackSize        = instr.args[0];
+	int16_t dontRemoveOffset = instr.args[1];
+	int16_t dontRemoveSize   = instr.args[2];
 
 	if ((stackSize % 4) != 0)
 		throw Common::Exception("NCSFile::o_destruct(): Illegal stack size %d", stackSize);
@@ -1441,12 +1836,12 @@ void NCSFile::o_destruct(InstructionType UNUSED(type)) {
  *
  *  Used to write into a global variable.
  */
-void NCSFile::o_cpdownbp(InstructionType type) {
-	if (type != kInstTypeDirect)
-		throw Common::Exception("NCSFile::o_cpdownbp(): Illegal type %d", type);
+void NCSFile::o_cpdownbp(const Instruction &instr) {
+	if (instr.type != kInstTypeDirect)
+		throw Common::Exception("NCSFile::o_cpdownbp(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE() - 4;
-	int16_t size   = _script->readSint16BE();
+	int32_t offset = instr.args[0] - 4;
+	int16_t size   = instr.args[1];
 
 	if ((size % 4) != 0)
 		throw Common::Exception("NCSFile::o_cpdownbp(): Illegal size %d", size);
@@ -1465,12 +1860,12 @@ void NCSFile::o_cpdownbp(InstructionType type) {
  *
  *  Used to read from a global variable.
  */
-void NCSFile::o_cptopbp(InstructionType type) {
-	if (type != kInstTypeDirect)
-		throw Common::Exception("NCSFile::o_cptopbp(): Illegal type %d", type);
+void NCSFile::o_cptopbp(const Instruction &instr) {
+	if (instr.type != kInstTypeDirect)
+		throw Common::Exception("NCSFile::o_cptopbp(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE() - 4;
-	int16_t size   = _script->readSint16BE();
+	int32_t offset = instr.args[0] - 4;
+	int16_t size   = instr.args[1];
 
 	if ((size % 4) != 0)
 		throw Common::Exception("NCSFile::o_cptopbp(): Illegal size %d", size);
@@ -1488,10 +1883,10 @@ void NCSFile::o_cptopbp(InstructionType type) {
  *  Used to create the "action" variables when calling an engine function that
  *  assigns a function to an object, or delays a function, or similar.
  */
-void NCSFile::o_storestate(InstructionType type) {
-	uint8_t  offset = (uint8_t) type;
-	uint32_t sizeBP = _script->readUint32BE();
-	uint32_t sizeSP = _script->readUint32BE();
+void NCSFile::o_storestate(const Instruction &instr) {
+	uint8_t  offset = (uint8_t) instr.type;
+	uint32_t sizeBP = (uint32_t) instr.args[0];
+	uint32_t sizeSP = (uint32_t) instr.args[1];
 
 	if ((sizeBP % 4) != 0)
 		throw Common::Exception("NCSFile::o_storestate(): Illegal BP size %d", sizeBP);
@@ -1501,7 +1896,7 @@ void NCSFile::o_storestate(InstructionType type) {
 	_storedState.setType(kTypeScriptState);
 	ScriptState &state = _storedState.getScriptState();
 
-	state.offset = _script->pos() - 10 + offset;
+	state.offset = instr.address + offset;
 
 	sizeBP /= 4;
 	sizeSP /= 4;
@@ -1524,12 +1919,12 @@ void NCSFile::o_storestate(InstructionType type) {
  *
  *  The index is popped off the stack, but the value written remains.
  */
-void NCSFile::o_writearray(InstructionType type) {
-	if (type != kInstTypeDirect)
-		throw Common::Exception("NCSFile::o_writearray(): Illegal type %d", type);
+void NCSFile::o_writearray(const Instruction &instr) {
+	if (instr.type != kInstTypeDirect)
+		throw Common::Exception("NCSFile::o_writearray(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE();
-	int16_t size   = _script->readSint16BE();
+	int32_t offset = instr.args[0];
+	int16_t size   = instr.args[1];
 
 	if (size != 4)
 		throw Common::Exception("NCSFile::o_writearray(): Invalid size %d", size);
@@ -1544,7 +1939,7 @@ void NCSFile::o_writearray(InstructionType type) {
 		throw Common::Exception("NCSFile::o_writearray(): Invalid index %d", index);
 
 	arrayVar.growArray(valueVar.getType(), index + 1);
-	arrayVar.getArray()[index] = boost::make_shared<Variable>(Variable(valueVar));
+	arrayVar.getArray()[index] = valueVar;
 }
 
 /** READARRAY: push the value of an array element onto of the stack.
@@ -1559,12 +1954,12 @@ void NCSFile::o_writearray(InstructionType type) {
  *  The index is popped off the stack, and the value read out of the
  *  array is pushed on top.
  */
-void NCSFile::o_readarray(InstructionType type) {
-	if (type != kInstTypeDirect)
-		throw Common::Exception("NCSFile::o_readarray(): Illegal type %d", type);
+void NCSFile::o_readarray(const Instruction &instr) {
+	if (instr.type != kInstTypeDirect)
+		throw Common::Exception("NCSFile::o_readarray(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE();
-	int16_t size   = _script->readSint16BE();
+	int32_t offset = instr.args[0];
+	int16_t size   = instr.args[1];
 
 	if (size != 4)
 		throw Common::Exception("NCSFile::o_readarray(): Invalid size %d", size);
@@ -1578,7 +1973,7 @@ void NCSFile::o_readarray(InstructionType type) {
 		throw Common::Exception("NCSFile::o_readarray(): Index out of range (%d, %u)",
 		                        index, (uint) array.size());
 
-	_stack.push(*array[index]);
+	_stack.push(array[index]);
 }
 
 /** GETREF: push the reference to a stack element onto the stack.
@@ -1591,12 +1986,12 @@ void NCSFile::o_readarray(InstructionType type) {
  *  The offset to the variable to create a reference to is passed
  *  as a direct argument to the instruction.
  */
-void NCSFile::o_getref(InstructionType type) {
-	if (type != kInstTypeDirect)
-		throw Common::Exception("NCSFile::o_getref(): Illegal type %d", type);
+void NCSFile::o_getref(const Instruction &instr) {
+	if (instr.type != kInstTypeDirect)
+		throw Common::Exception("NCSFile::o_getref(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE();
-	int16_t size   = _script->readSint16BE();
+	int32_t offset = instr.args[0];
+	int16_t size   = instr.args[1];
 
 	if (size != 4)
 		throw Common::Exception("NCSFile::o_getref(): Invalid size %d", size);
@@ -1622,12 +2017,12 @@ void NCSFile::o_getref(InstructionType type) {
  *  The index is popped off the stack, and the reference to the
  *  variable inside the array is pushed on top.
  */
-void NCSFile::o_getrefarray(InstructionType type) {
-	if (type != kInstTypeDirect)
-		throw Common::Exception("NCSFile::o_getrefarray(): Illegal type %d", type);
+void NCSFile::o_getrefarray(const Instruction &instr) {
+	if (instr.type != kInstTypeDirect)
+		throw Common::Exception("NCSFile::o_getrefarray(): Illegal type %d", instr.type);
 
-	int32_t offset = _script->readSint32BE();
-	int16_t size   = _script->readSint16BE();
+	int32_t offset = instr.args[0];
+	int16_t size   = instr.args[1];
 
 	if (size != 4)
 		throw Common::Exception("NCSFile::o_getrefarray(): Invalid size %d", size);
@@ -1642,7 +2037,16 @@ void NCSFile::o_getrefarray(InstructionType type) {
 		                        index, (uint) array.size());
 
 	_stack.push(Variable(kTypeReference));
-	_stack.top().setReference(&*array[index]);
+	_stack.top().setReference(&array[index]);
+}
+
+/** Placeholder for an instruction that couldn't be decoded. */
+void NCSFile::o_invalid(const Instruction &instr) {
+	if ((instr.opcode >= _opcodeListSize) || (!_opcodes[instr.opcode].proc))
+		throw Common::Exception("NCSFile::executeStep(): Illegal instruction 0x%02x", instr.opcode);
+
+	throw Common::Exception("NCSFile::executeStep(): Truncated instruction 0x%02x at offset %u",
+	                        instr.opcode, instr.address);
 }
 
 } // End of namespace NWScript
@@ -60,6 +60,7 @@ public:
 	Variable &top();
 	Variable pop();
 	void push(const Variable &obj);
+	void push(Variable &&obj);
 
 	Variable &getRelSP(int32_t pos);
 	void setRelSP(int32_t pos, const Variable &obj);
@@ -80,7 +81,7 @@ private:
 	int32_t _basePtr;
 };
 
-#define DECLARE_OPCODE(x) void x(InstructionType type)
+#define DECLARE_OPCODE(x) void x(const Instruction &instr)
 
 /** An NCS, BioWare's NWN Compile Script. */
 class NCSFile : public AuroraFile {
@@ -113,6 +114,23 @@ public:
 	                    const ObjectReference owner = ObjectReference(),
 	                    const ObjectReference triggerer = ObjectReference());
 
+	/** Limit the number of instructions one run of the script may execute.
+	 *
+	 *  Once the budget is used up, the script is suspended at the next
+	 *  backward jump (i.e. the next iteration of a loop) where it's safe
+	 *  to do so, and run() returns early with a void value. The script can
+	 *  then be continued later by running it with the state returned by
+	 *  getContinuation().
+	 *
+	 *  A budget of 0, the default, lets the script run to completion.
+	 */
+	void setInstructionBudget(size_t budget);
+
+	/** Was the last run of the script suspended before it finished? */
+	bool isSuspended() const;
+	/** Return the state to continue a suspended script from. */
+	const ScriptState &getContinuation() const;
+
 	// KotOR2's parameter handling
 
 	/** Set the parameters of the script. */
@@ -176,13 +194,56 @@ private:
 		kInstTypeFloatVector            = 60
 	};
 
+	struct Instruction;
+
+	typedef void (NCSFile::*OpcodeProc)(const Instruction &instr);
+	struct Opcode {
+		OpcodeProc proc;
+		const char *desc;
+	};
+
+	/** A decoded instruction.
+	 *
+	 *  The whole bytecode is decoded once, when the script is loaded.
+	 *  Jump targets are resolved into indices into the instruction list.
+	 */
+	struct Instruction {
+		uint32_t address; ///< Offset of the instruction within the script.
+
+		byte opcode;
+		InstructionType type;
+
+		/** The function handling this instruction. */
+		OpcodeProc proc;
+
+		/** The integer direct arguments, in the order they appear in the bytecode. */
+		int32_t args[3];
+		/** The direct argument of a float CONST. */
+		float argFloat;
+
+		/** The index of the jump target, or the index of the string of a string CONST. */
+		size_t index;
+
+		Instruction();
+	};
+
+	static const size_t kInvalidIndex = SIZE_MAX;
+
 	Common::UString _name;
 
 	std::vector<int> _parameters;
 	Common::UString _parameterString;
 
 	NCSStack _stack;
-	std::unique_ptr<Common::SeekableReadStream> _script;
+
+	struct Program;
+	class ProgramCache;
+
+	/** The decoded script, shared between all instances running the same script. */
+	std::shared_ptr<const Program> _program;
+
+	/** The index of the next instruction to execute. */
+	size_t _pc;
 
 	Variable _return;
 
@@ -191,20 +252,37 @@ private:
 
 	VariableContainer _env;
 
-	std::stack<uint32_t> _returnOffsets;
+	std::stack<size_t> _returnOffsets;
 
 	Variable _storedState;
 
-	typedef void (NCSFile::*OpcodeProc)(InstructionType type);
-	struct Opcode {
-		OpcodeProc proc;
-		const char *desc;
-	};
+	size_t _instructionBudget; ///< Maximum number of instructions to execute per run.
+	size_t _instructionCount;  ///< Number of instructions executed in this run.
+
+	bool _suspended;
+	ScriptState _continuation;
+
 	const Opcode *_opcodes;
 	size_t _opcodeListSize;
 	void setupOpcodes();
 
-	void load();
+	/** Return the cache of decoded scripts loaded by name. */
+	static ProgramCache &getProgramCache();
+
+	void load(Common::SeekableReadStream &ncs);
+
+	/** Decode the whole bytecode into a program. */
+	void decode(Common::SeekableReadStream &ncs, Program &program);
+	/** Decode the direct arguments of an instruction.
+	 *
+	 *  @return false if decoding can't continue past this instruction.
+	 */
+	bool decodeArguments(Common::SeekableReadStream &ncs, Program &program, Instruction &instr);
+	/** Resolve the targets of all jumps. */
+	static void resolveJumps(Program &program, uint32_t end);
+
+	/** Find the index of the instruction at this offset, throwing if there is none. */
+	size_t getInstruction(uint32_t address) const;
 
 	/** Reset the script for another execution. */
 	void reset();
@@ -213,7 +291,15 @@ private:
 	                        const ObjectReference triggerer = ObjectReference());
 
 	/** Execute one script step. */
-	bool executeStep();
+	bool executeStep(bool debug);
+
+	/** Follow a jump instruction. */
+	void jump(const Instruction &instr);
+
+	/** Can the script be suspended at the current instruction? */
+	bool canSuspend();
+	/** Save the current state of the script as its continuation. */
+	void saveContinuation();
 
 	void decompile(); // TODO
 
@@ -269,6 +355,8 @@ private:
 	DECLARE_OPCODE(o_readarray);
 	DECLARE_OPCODE(o_getref);
 	DECLARE_OPCODE(o_getrefarray);
+
+	DECLARE_OPCODE(o_invalid);
 };
 
 #undef DECLARE_OPCODE
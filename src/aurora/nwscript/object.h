@@ -36,7 +36,7 @@ namespace NWScript {
 
 class Object : public VariableContainer {
 public:
-	Object() : _id(kObjectIDInvalid) {
+	Object() : _id(kObjectIDInvalid), _slot(0xFFFFFFFF), _generation(0) {
 	}
 
 	virtual ~Object() {
@@ -54,6 +54,13 @@ protected:
 	uint32_t _id;
 
 	Common::UString _tag;
+
+private:
+	uint32_t _slot;       ///< The object's slot in the ObjectManager.
+	uint32_t _generation; ///< The generation of that slot.
+
+	friend class ObjectManager;
+	friend class ObjectReference;
 };
 
 } // End of namespace NWScript
@@ -43,66 +43,140 @@ ObjectContainer::~ObjectContainer() {
 }
 
 void ObjectContainer::clearObjects() {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	lock();
 
-	_objects.clear();
-	_objectsByID.clear();
-	_objectsByTag.clear();
+	eraseObjects();
+
+	unlock();
 }
 
 void ObjectContainer::addObject(Object &object) {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	lock();
 
-	assert(std::find(_objects.begin(), _objects.end(), &object) == _objects.end());
+	insertObject(object);
 
-	_objects.push_back(&object);
-	_objectsByID.insert(std::make_pair(object.getID(), &object));
-	_objectsByTag.insert(std::make_pair(object.getTag(), &object));
+	unlock();
 }
 
 void ObjectContainer::removeObject(Object &object) {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	lock();
 
-	_objects.remove(&object);
-	_objectsByID.erase(object.getID());
+	eraseObject(object);
+
+	unlock();
+}
+
+void ObjectContainer::insertObject(Object &object) {
+	assert(std::find(_objects.begin(), _objects.end(), &object) == _objects.end());
 
-	std::pair<ObjectTagMap::iterator, ObjectTagMap::iterator> tag =
-		_objectsByTag.equal_range(object.getTag());
+	_objects.push_back(&object);
+	_objectsByID[object.getID()] = &object;
+
+	const Common::UString &tag = object.getTag();
 
-	for (ObjectTagMap::iterator o = tag.first; o != tag.second; ++o) {
-		if (o->second == &object) {
-			_objectsByTag.erase(o);
-			break;
+	std::vector<TagBucket> &buckets = _objectsByTag[Common::hashUStringCaseSensitive()(tag)];
+	for (std::vector<TagBucket>::iterator b = buckets.begin(); b != buckets.end(); ++b) {
+		if (b->tag.equals(tag)) {
+			b->objects.push_back(&object);
+			return;
 		}
 	}
+
+	buckets.push_back(TagBucket());
+	buckets.back().tag = tag;
+	buckets.back().objects.push_back(&object);
 }
 
-Object *ObjectContainer::getObjectByID(uint32_t id) const {
-	ObjectIDMap::const_iterator o = _objectsByID.find(id);
-	if (o != _objectsByID.end())
-		return o->second;
+void ObjectContainer::eraseObject(Object &object) {
+	_objects.remove(&object);
+
+	Object **byID = _objectsByID.find(object.getID());
+	if (byID && (*byID == &object))
+		_objectsByID.erase(object.getID());
+
+	const Common::UString &tag = object.getTag();
+	const size_t hash = Common::hashUStringCaseSensitive()(tag);
+
+	std::vector<TagBucket> *buckets = _objectsByTag.find(hash);
+	if (!buckets)
+		return;
+
+	for (std::vector<TagBucket>::iterator b = buckets->begin(); b != buckets->end(); ++b) {
+		if (!b->tag.equals(tag))
+			continue;
+
+		std::vector<Object *>::iterator o = std::find(b->objects.begin(), b->objects.end(), &object);
+		if (o != b->objects.end())
+			b->objects.erase(o);
+
+		if (b->objects.empty())
+			buckets->erase(b);
+
+		break;
+	}
+
+	if (buckets->empty())
+		_objectsByTag.erase(hash);
+}
+
+void ObjectContainer::eraseObjects() {
+	_objects.clear();
+	_objectsByID.clear();
+	_objectsByTag.clear();
+}
+
+const std::vector<Object *> *ObjectContainer::findTag(const Common::UString &tag) const {
+	const std::vector<TagBucket> *buckets = _objectsByTag.find(Common::hashUStringCaseSensitive()(tag));
+	if (!buckets)
+		return 0;
+
+	for (std::vector<TagBucket>::const_iterator b = buckets->begin(); b != buckets->end(); ++b)
+		if (b->tag.equals(tag))
+			return &b->objects;
 
 	return 0;
 }
 
+Object *ObjectContainer::getObjectByID(uint32_t id) const {
+	std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+
+	Object * const *object = _objectsByID.find(id);
+
+	return object ? *object : 0;
+}
+
 Object *ObjectContainer::getFirstObject() const {
-	SearchList ctx(_objects);
+	std::shared_lock<std::shared_timed_mutex> lock(_mutex);
 
-	return ctx.get();
+	return _objects.empty() ? 0 : _objects.front();
 }
 
 Object *ObjectContainer::getFirstObjectByTag(const Common::UString &tag) const {
-	SearchTagMap ctx(_objectsByTag, tag);
+	std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+
+	const std::vector<Object *> *objects = findTag(tag);
 
-	return ctx.get();
+	return objects ? objects->front() : 0;
+}
+
+ObjectRange ObjectContainer::getObjectsByTag(const Common::UString &tag) const {
+	std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+
+	const std::vector<Object *> *objects = findTag(tag);
+	if (!objects)
+		return ObjectRange();
+
+	return ObjectRange(objects->data(), objects->data() + objects->size());
 }
 
 ObjectSearch *ObjectContainer::findObjects() const {
+	std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+
 	return new SearchList(_objects);
 }
 
 ObjectSearch *ObjectContainer::findObjectsByTag(const Common::UString &tag) const {
-	return new SearchTagMap(_objectsByTag, tag);
+	return new SearchObjectRange(getObjectsByTag(tag));
 }
 
 void ObjectContainer::lock() {
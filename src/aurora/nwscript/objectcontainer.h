@@ -26,9 +26,10 @@
 #define AURORA_NWSCRIPT_OBJECTCONTAINER_H
 
 #include <list>
-#include <map>
+#include <vector>
 
 #include "src/common/mutex.h"
+#include "src/common/flathashmap.h"
 
 #include "src/aurora/nwscript/object.h"
 
@@ -89,12 +90,45 @@ public:
 	Object *getObject(const iterator &t) { return *t; }
 };
 
-class SearchTagMap : public SearchRange< std::multimap<Common::UString, Object *> > {
+/** A range of objects, iterated over in place.
+ *
+ *  Unlike an ObjectSearch, a range doesn't need to be allocated, and
+ *  can simply live on the stack. Like an ObjectSearch, it is only valid
+ *  until the container is modified.
+ */
+class ObjectRange {
+public:
+	ObjectRange() : _current(0), _end(0) { }
+	ObjectRange(Object * const *begin, Object * const *end) : _current(begin), _end(end) { }
+
+	bool empty() const { return _current == _end; }
+
+	/** Return the current object in the range. */
+	Object *get() const {
+		return (_current == _end) ? 0 : *_current;
+	}
+
+	/** Move to the next object in the range and return the previous one. */
+	Object *next() {
+		return (_current == _end) ? 0 : *_current++;
+	}
+
+private:
+	Object * const *_current;
+	Object * const *_end;
+};
+
+/** An ObjectSearch over an ObjectRange, for callers that need a search context. */
+class SearchObjectRange : public ObjectSearch {
 public:
-	SearchTagMap(const type &m, const Common::UString &tag) : SearchRange<type>(m.equal_range(tag)) { }
-	~SearchTagMap() { }
+	SearchObjectRange(const ObjectRange &range) : _range(range) { }
+	~SearchObjectRange() { }
+
+	Object *get()  { return _range.get(); }
+	Object *next() { return _range.next(); }
 
-	Object *getObject(const iterator &t) { return t->second; };
+private:
+	ObjectRange _range;
 };
 
 class ObjectContainer {
@@ -117,6 +151,9 @@ public:
 	/** Return the first object with this tag. */
 	Object *getFirstObjectByTag(const Common::UString &tag) const;
 
+	/** Return all objects with this tag, in the order they were added. */
+	ObjectRange getObjectsByTag(const Common::UString &tag) const;
+
 	/** Return a search context to iterate over all objects. */
 	ObjectSearch *findObjects() const;
 	/** Return a search context to iterate over all objects with this tag. */
@@ -124,20 +161,46 @@ public:
 
 
 protected:
+	/** Lock the container for modification.
+	 *
+	 *  While the container is locked, lookups from other threads wait.
+	 *  Lookups themselves only share the lock among each other.
+	 */
 	void lock();
 	void unlock();
 
+	/** Add an object. The container needs to be locked. */
+	void insertObject(Object &object);
+	/** Remove an object. The container needs to be locked. */
+	void eraseObject(Object &object);
+	/** Remove all objects. The container needs to be locked. */
+	void eraseObjects();
+
 
 private:
-	typedef std::map<uint32_t, Object *> ObjectIDMap;
+	/** All objects whose tags share one hash. */
+	struct TagBucket {
+		Common::UString tag;
+		std::vector<Object *> objects;
+	};
+
+	/** The tag hashes are already well distributed; don't hash them again. */
+	struct HashIdentity {
+		size_t operator()(size_t hash) const { return hash; }
+	};
+
+	typedef Common::FlatHashMap<uint32_t, Object *> ObjectIDMap;
+	typedef Common::FlatHashMap<size_t, std::vector<TagBucket>, HashIdentity> ObjectTagMap;
 	typedef SearchList::type ObjectList;
-	typedef SearchTagMap::type ObjectTagMap;
 
-	std::recursive_mutex _mutex;
+	mutable std::shared_timed_mutex _mutex;
+
+	ObjectList   _objects;      ///< All objects, in the order they were added.
+	ObjectIDMap  _objectsByID;  ///< All objects, indexed by ID.
+	ObjectTagMap _objectsByTag; ///< All objects, indexed by the hash of their tag.
 
-	ObjectList   _objects;
-	ObjectIDMap  _objectsByID;
-	ObjectTagMap _objectsByTag;
+	/** Find the objects with this tag. The container needs to be locked. */
+	const std::vector<Object *> *findTag(const Common::UString &tag) const;
 };
 
 } // End of namespace NWScript
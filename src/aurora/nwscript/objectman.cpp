@@ -22,6 +22,8 @@
   *  NWScript object manager.
   */
 
+#include "src/common/error.h"
+
 #include "src/aurora/nwscript/objectman.h"
 #include "src/aurora/nwscript/object.h"
 
@@ -31,28 +33,114 @@ namespace Aurora {
 
 namespace NWScript {
 
+const uint32_t ObjectManager::kSlotInvalid;
+
+ObjectManager::Slot::Slot() : generation(0), object(0) {
+}
+
+
+ObjectManager::ObjectManager() : _slotCount(0) {
+	for (size_t i = 0; i < kMaxChunks; i++)
+		_chunks[i].store(0, std::memory_order_relaxed);
+}
+
+ObjectManager::~ObjectManager() {
+	for (size_t i = 0; i < kMaxChunks; i++)
+		delete[] _chunks[i].load(std::memory_order_relaxed);
+}
+
+ObjectManager::Slot *ObjectManager::getSlot(uint32_t slot) const {
+	if (slot >= (kChunkSize * kMaxChunks))
+		return 0;
+
+	Slot *chunk = _chunks[slot / kChunkSize].load(std::memory_order_acquire);
+	if (!chunk)
+		return 0;
+
+	return &chunk[slot % kChunkSize];
+}
+
+uint32_t ObjectManager::allocateSlot() {
+	if (!_freeSlots.empty()) {
+		const uint32_t slot = _freeSlots.back();
+		_freeSlots.pop_back();
+
+		return slot;
+	}
+
+	if (_slotCount >= (kChunkSize * kMaxChunks))
+		throw Common::Exception("ObjectManager: Too many objects");
+
+	// Allocate a new chunk once we reach its first slot
+	const size_t chunk = _slotCount / kChunkSize;
+	if (!_chunks[chunk].load(std::memory_order_relaxed))
+		_chunks[chunk].store(new Slot[kChunkSize], std::memory_order_release);
+
+	return _slotCount++;
+}
+
 void ObjectManager::registerObject(Object *object) {
 	std::lock_guard<std::recursive_mutex> lock(_objMutex);
 
 	uint32_t id = object->getID();
-	if (_objects.find(id) == _objects.end())
-		_objects.insert(std::make_pair(id, object));
+	if (_slots.contains(id))
+		return;
+
+	const uint32_t slotIndex = allocateSlot();
+	Slot &slot = *getSlot(slotIndex);
+
+	slot.object.store(object, std::memory_order_release);
+
+	_slots[id] = slotIndex;
+
+	object->_slot       = slotIndex;
+	object->_generation = slot.generation.load(std::memory_order_relaxed);
 }
 
 void ObjectManager::unregisterObject(Object *object) {
 	std::lock_guard<std::recursive_mutex> lock(_objMutex);
 
-	_objects.erase(object->getID());
+	const uint32_t *slotIndex = _slots.find(object->getID());
+	if (!slotIndex)
+		return;
+
+	Slot &slot = *getSlot(*slotIndex);
+	if (slot.object.load(std::memory_order_relaxed) != object)
+		return;
+
+	// Invalidate all references to this object before clearing the slot
+	slot.generation.fetch_add(1, std::memory_order_acq_rel);
+	slot.object.store(0, std::memory_order_release);
+
+	_freeSlots.push_back(*slotIndex);
+	_slots.erase(object->getID());
+
+	object->_slot       = kSlotInvalid;
+	object->_generation = 0;
 }
 
 Object *ObjectManager::findObject(uint32_t id) {
 	std::lock_guard<std::recursive_mutex> lock(_objMutex);
 
-	std::map<uint32_t, Object *>::iterator it = _objects.find(id);
-	if (it == _objects.end())
+	const uint32_t *slotIndex = _slots.find(id);
+	if (!slotIndex)
+		return 0;
+
+	return getSlot(*slotIndex)->object.load(std::memory_order_acquire);
+}
+
+Object *ObjectManager::findObject(uint32_t slotIndex, uint32_t generation) const {
+	const Slot *slot = getSlot(slotIndex);
+	if (!slot || (slot->generation.load(std::memory_order_acquire) != generation))
+		return 0;
+
+	Object *object = slot->object.load(std::memory_order_acquire);
+
+	// Make sure the slot wasn't reused while we were looking
+	if (slot->generation.load(std::memory_order_acquire) != generation)
 		return 0;
 
-	return it->second;
+	return object;
 }
 
 } // End of namespace NWScript
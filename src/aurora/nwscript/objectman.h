@@ -25,11 +25,13 @@
 #ifndef AURORA_NWSCRIPT_OBJECTMAN_H
 #define AURORA_NWSCRIPT_OBJECTMAN_H
 
-#include <map>
+#include <atomic>
+#include <vector>
 
 #include "src/common/singleton.h"
 #include "src/common/types.h"
 #include "src/common/mutex.h"
+#include "src/common/flathashmap.h"
 
 namespace Aurora {
 
@@ -37,16 +39,59 @@ namespace NWScript {
 
 class Object;
 
+/** The registry of all objects scripts can reference.
+ *
+ *  Every registered object occupies a slot, and every slot carries a
+ *  generation counter that's increased whenever its object is removed.
+ *  An ObjectReference remembers the slot and generation of its object,
+ *  so resolving it is a lock-free lookup into the slot array. A stale
+ *  reference, to an object that's since been unregistered, is detected
+ *  by its generation not matching anymore.
+ *
+ *  Slots are allocated in fixed-size chunks that never move, so readers
+ *  can look into them while other threads register objects.
+ */
 class ObjectManager : public Common::Singleton<ObjectManager> {
 public:
+	static const uint32_t kSlotInvalid = 0xFFFFFFFF;
+
+	ObjectManager();
+	~ObjectManager();
+
 	void registerObject(Object *object);
 	void unregisterObject(Object *object);
 
+	/** Find an object by its ID. */
 	Object *findObject(uint32_t id);
+	/** Find an object by its slot, if that slot still holds the same generation. */
+	Object *findObject(uint32_t slot, uint32_t generation) const;
 
 private:
+	static const size_t kChunkSize = 1024;
+	static const size_t kMaxChunks = 1024;
+
+	struct Slot {
+		std::atomic<uint32_t> generation;
+		std::atomic<Object *> object;
+
+		Slot();
+	};
+
 	std::recursive_mutex _objMutex;
-	std::map<uint32_t, Object *> _objects;
+
+	/** The slot array, in separately allocated chunks. */
+	std::atomic<Slot *> _chunks[kMaxChunks];
+	/** The number of slots ever used. */
+	uint32_t _slotCount;
+
+	/** Previously used slots that are free again. */
+	std::vector<uint32_t> _freeSlots;
+
+	/** The slot of each registered object ID. */
+	Common::FlatHashMap<uint32_t, uint32_t> _slots;
+
+	Slot *getSlot(uint32_t slot) const;
+	uint32_t allocateSlot();
 };
 
 } // End of namespace NWScript
@@ -30,7 +30,14 @@ namespace Aurora {
 
 namespace NWScript {
 
-ObjectReference::ObjectReference(const Object *object) : _id(object ? object->getID() : kObjectIDInvalid) {
+ObjectReference::ObjectReference(const Object *object) {
+	set(object);
+}
+
+void ObjectReference::set(const Object *object) {
+	_id         = object ? object->getID()     : kObjectIDInvalid;
+	_slot       = object ? object->_slot       : ObjectManager::kSlotInvalid;
+	_generation = object ? object->_generation : 0;
 }
 
 uint32_t ObjectReference::getId() const {
@@ -41,11 +48,15 @@ Object *ObjectReference::operator*() const {
 	if (_id == kObjectIDInvalid)
 		return 0;
 
-	return ObjectMan.findObject(_id);
+	// References taken before the object was registered don't know its slot
+	if (_slot == ObjectManager::kSlotInvalid)
+		return ObjectMan.findObject(_id);
+
+	return ObjectMan.findObject(_slot, _generation);
 }
 
 ObjectReference &ObjectReference::operator=(const Object *object) {
-	_id = object ? object->getID() : kObjectIDInvalid;
+	set(object);
 	return *this;
 }
 
@@ -53,6 +53,12 @@ public:
 
 private:
 	uint32_t _id { kObjectIDInvalid };
+
+	/** The object's slot and its generation in the ObjectManager, for quick resolving. */
+	uint32_t _slot { 0xFFFFFFFF };
+	uint32_t _generation { 0 };
+
+	void set(const Object *object);
 };
 
 } // End of namespace NWScript
@@ -0,0 +1,148 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+/** @file
+ *  NWScript execution profiler.
+ */
+
+#include <algorithm>
+#include <chrono>
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/strutil.h"
+#include "src/common/writefile.h"
+
+#include "src/aurora/nwscript/profiler.h"
+
+DECLARE_SINGLETON(Aurora::NWScript::Profiler)
+
+namespace Aurora {
+
+namespace NWScript {
+
+static bool compareTime(const Profiler::Entry &a, const Profiler::Entry &b) {
+	if (a.time != b.time)
+		return a.time > b.time;
+
+	return a.calls > b.calls;
+}
+
+
+Profiler::Entry::Entry() : id(UINT32_MAX), calls(0), instructions(0), time(0) {
+}
+
+
+Profiler::Profiler() : _enabled(false) {
+}
+
+Profiler::~Profiler() {
+}
+
+bool Profiler::isEnabled() const {
+	return _enabled;
+}
+
+void Profiler::setEnabled(bool enabled) {
+	_enabled = enabled;
+}
+
+void Profiler::clear() {
+	_scripts.clear();
+	_functions.clear();
+}
+
+uint64_t Profiler::getTime() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Profiler::addScript(const Common::UString &name, uint64_t instructions, uint64_t time) {
+	Entry &entry = _scripts[name];
+
+	if (entry.name.empty())
+		entry.name = name;
+
+	entry.calls        += 1;
+	entry.instructions += instructions;
+	entry.time         += time;
+}
+
+void Profiler::addFunction(uint32_t id, const Common::UString &name, uint64_t time) {
+	Entry &entry = _functions[id];
+
+	if (entry.id != id) {
+		entry.id   = id;
+		entry.name = name;
+	}
+
+	entry.calls += 1;
+	entry.time  += time;
+}
+
+Profiler::Entries Profiler::getScripts() const {
+	Entries entries;
+	entries.reserve(_scripts.size());
+
+	for (ScriptMap::const_iterator s = _scripts.begin(); s != _scripts.end(); ++s)
+		entries.push_back(s->second);
+
+	std::stable_sort(entries.begin(), entries.end(), compareTime);
+	return entries;
+}
+
+Profiler::Entries Profiler::getFunctions() const {
+	Entries entries;
+	entries.reserve(_functions.size());
+
+	for (FunctionMap::const_iterator f = _functions.begin(); f != _functions.end(); ++f)
+		entries.push_back(f->second);
+
+	std::stable_sort(entries.begin(), entries.end(), compareTime);
+	return entries;
+}
+
+void Profiler::dumpCSV(const Common::UString &fileName) const {
+	Common::WriteFile file;
+
+	if (!file.open(fileName))
+		throw Common::Exception(Common::kOpenError);
+
+	file.writeString("Type,ID,Name,Calls,Instructions,Time (us)\n");
+
+	const Entries scripts = getScripts();
+	for (Entries::const_iterator s = scripts.begin(); s != scripts.end(); ++s)
+		file.writeString(Common::UString::format("script,,%s,%s,%s,%s\n", s->name.c_str(),
+		                 Common::composeString(s->calls).c_str(),
+		                 Common::composeString(s->instructions).c_str(),
+		                 Common::composeString(s->time).c_str()));
+
+	const Entries functions = getFunctions();
+	for (Entries::const_iterator f = functions.begin(); f != functions.end(); ++f)
+		file.writeString(Common::UString::format("function,%u,%s,%s,,%s\n", f->id, f->name.c_str(),
+		                 Common::composeString(f->calls).c_str(),
+		                 Common::composeString(f->time).c_str()));
+
+	file.flush();
+	file.close();
+}
+
+} // End of namespace NWScript
+
+} // End of namespace Aurora
@@ -0,0 +1,106 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+/** @file
+ *  NWScript execution profiler.
+ */
+
+#ifndef AURORA_NWSCRIPT_PROFILER_H
+#define AURORA_NWSCRIPT_PROFILER_H
+
+#include <vector>
+#include <map>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+#include "src/common/singleton.h"
+
+namespace Aurora {
+
+namespace NWScript {
+
+/** Collects execution statistics of scripts and engine functions.
+ *
+ *  When enabled, every run of a script records the number of executed
+ *  instructions and the wall time spent, and every engine function call
+ *  records its wall time. Times are inclusive: a script's time contains
+ *  the time of the engine functions it called, and an engine function's
+ *  time contains the time of any scripts it ran in turn.
+ */
+class Profiler : public Common::Singleton<Profiler> {
+public:
+	/** The accumulated statistics of one script or engine function. */
+	struct Entry {
+		Common::UString name;
+
+		/** The engine function ID, or UINT32_MAX for scripts. */
+		uint32_t id;
+
+		uint64_t calls;        ///< Number of times it was run.
+		uint64_t instructions; ///< Number of script instructions executed.
+		uint64_t time;         ///< Wall time spent, in microseconds.
+
+		Entry();
+	};
+
+	typedef std::vector<Entry> Entries;
+
+	Profiler();
+	~Profiler();
+
+	bool isEnabled() const;
+	void setEnabled(bool enabled);
+
+	/** Forget all collected statistics. */
+	void clear();
+
+	/** Return the current time, in microseconds. */
+	static uint64_t getTime();
+
+	/** Record one run of a script. */
+	void addScript(const Common::UString &name, uint64_t instructions, uint64_t time);
+	/** Record one call of an engine function. */
+	void addFunction(uint32_t id, const Common::UString &name, uint64_t time);
+
+	/** Return the statistics of all run scripts, sorted by time spent. */
+	Entries getScripts() const;
+	/** Return the statistics of all called engine functions, sorted by time spent. */
+	Entries getFunctions() const;
+
+	/** Write all statistics into a CSV file. */
+	void dumpCSV(const Common::UString &fileName) const;
+
+private:
+	typedef std::map<Common::UString, Entry> ScriptMap;
+	typedef std::map<uint32_t, Entry> FunctionMap;
+
+	bool _enabled;
+
+	ScriptMap   _scripts;
+	FunctionMap _functions;
+};
+
+} // End of namespace NWScript
+
+} // End of namespace Aurora
+
+/** Shortcut for accessing the NWScript profiler. */
+#define ScriptProfiler Aurora::NWScript::Profiler::instance()
+
+#endif // AURORA_NWSCRIPT_PROFILER_H
@@ -35,6 +35,7 @@ src_aurora_nwscript_libnwscript_la_SOURCES += \
     src/aurora/nwscript/ncsfile.h \
     src/aurora/nwscript/objectref.h \
     src/aurora/nwscript/objectman.h \
+    src/aurora/nwscript/profiler.h \
     $(EMPTY)
 
 src_aurora_nwscript_libnwscript_la_SOURCES += \
@@ -47,4 +48,5 @@ src_aurora_nwscript_libnwscript_la_SOURCES += \
     src/aurora/nwscript/ncsfile.cpp \
     src/aurora/nwscript/objectref.cpp \
     src/aurora/nwscript/objectman.cpp \
+    src/aurora/nwscript/profiler.cpp \
     $(EMPTY)
@@ -78,10 +78,7 @@ void formatVariable(Common::UString &str, const Variable &var) {
 					if (i != 0)
 						str += ", ";
 
-					if (!array[i].get())
-						str += "/";
-					else
-						formatVariable(str, *array[i]);
+					formatVariable(str, array[i]);
 				}
 				str += "}";
 			}
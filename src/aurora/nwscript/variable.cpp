@@ -24,6 +24,9 @@
 
 #include <cassert>
 
+#include <new>
+#include <utility>
+
 #include <boost/make_shared.hpp>
 
 #include "src/common/error.h"
@@ -41,34 +44,24 @@ Variable::Variable(Type type) : _type(kTypeVoid) {
 	setType(type);
 }
 
-Variable::Variable(int32_t value) : _type(kTypeVoid) {
-	setType(kTypeInt);
-
-	*this = value;
+Variable::Variable(int32_t value) : _type(kTypeInt) {
+	_value._int = value;
 }
 
-Variable::Variable(float value) : _type(kTypeVoid) {
-	setType(kTypeFloat);
-
-	*this = value;
+Variable::Variable(float value) : _type(kTypeFloat) {
+	_value._float = value;
 }
 
-Variable::Variable(const Common::UString &value) : _type(kTypeVoid) {
-	setType(kTypeString);
-
-	*this = value;
+Variable::Variable(const Common::UString &value) : _type(kTypeString) {
+	new (&_value._string) Common::UString(value);
 }
 
-Variable::Variable(Object *value) : _type(kTypeVoid) {
-	setType(kTypeObject);
-
-	*this = value;
+Variable::Variable(Object *value) : _type(kTypeObject) {
+	new (&_value._object) ObjectReference(value);
 }
 
-Variable::Variable(const ObjectReference &value) : _type(kTypeVoid) {
-	setType(kTypeObject);
-
-	*this = value;
+Variable::Variable(const ObjectReference &value) : _type(kTypeObject) {
+	new (&_value._object) ObjectReference(value);
 }
 
 Variable::Variable(const EngineType *value) : _type(kTypeVoid) {
@@ -83,16 +76,20 @@ Variable::Variable(const EngineType &value) : _type(kTypeVoid) {
 	*this = value;
 }
 
-Variable::Variable(float x, float y, float z) : _type(kTypeVoid) {
-	setType(kTypeVector);
-
-	setVector(x, y, z);
+Variable::Variable(float x, float y, float z) : _type(kTypeVector) {
+	_value._vector[0] = x;
+	_value._vector[1] = y;
+	_value._vector[2] = z;
 }
 
 Variable::Variable(const Variable &var) : _type(kTypeVoid) {
 	*this = var;
 }
 
+Variable::Variable(Variable &&var) noexcept : _type(kTypeVoid) {
+	moveFrom(var);
+}
+
 Variable::~Variable() {
 	try {
 		setType(kTypeVoid);
@@ -101,26 +98,40 @@ Variable::~Variable() {
 }
 
 void Variable::setType(Type type) {
-	_array.reset();
+	switch (_type) {
+		case kTypeString:
+			_value._string.~UString();
+			break;
 
-	if      (_type == kTypeString)
-		delete _value._string;
-	else if (_type == kTypeObject)
-		delete _value._object;
-	else if (_type == kTypeEngineType)
-		delete _value._engineType;
-	else if (_type == kTypeScriptState)
-		delete _value._scriptState;
+		case kTypeObject:
+			_value._object.~ObjectReference();
+			break;
 
-	_type = type;
+		case kTypeArray:
+			_value._array.~shared_ptr();
+			break;
 
-	switch (_type) {
+		case kTypeEngineType:
+			delete _value._engineType;
+			break;
+
+		case kTypeScriptState:
+			delete _value._scriptState;
+			break;
+
+		default:
+			break;
+	}
+
+	_type = kTypeVoid;
+
+	switch (type) {
 		case kTypeVoid:
 		case kTypeAny:
 			break;
 
 		case kTypeArray:
-			_array = boost::make_shared<Array>();
+			new (&_value._array) boost::shared_ptr<Array>(boost::make_shared<Array>());
 			break;
 
 		case kTypeInt:
@@ -132,11 +143,11 @@ void Variable::setType(Type type) {
 			break;
 
 		case kTypeString:
-			_value._string = new Common::UString;
+			new (&_value._string) Common::UString;
 			break;
 
 		case kTypeObject:
-			_value._object = new ObjectReference;
+			new (&_value._object) ObjectReference;
 			break;
 
 		case kTypeVector:
@@ -161,26 +172,130 @@ void Variable::setType(Type type) {
 			throw Common::Exception("Variable::setType(): Invalid type %d", type);
 			break;
 	}
+
+	_type = type;
+}
+
+void Variable::moveFrom(Variable &var) {
+	switch (var._type) {
+		case kTypeString:
+			new (&_value._string) Common::UString(std::move(var._value._string));
+			break;
+
+		case kTypeObject:
+			new (&_value._object) ObjectReference(var._value._object);
+			break;
+
+		case kTypeArray:
+			new (&_value._array) boost::shared_ptr<Array>(std::move(var._value._array));
+			break;
+
+		case kTypeInt:
+			_value._int = var._value._int;
+			break;
+
+		case kTypeFloat:
+			_value._float = var._value._float;
+			break;
+
+		case kTypeVector:
+			_value._vector[0] = var._value._vector[0];
+			_value._vector[1] = var._value._vector[1];
+			_value._vector[2] = var._value._vector[2];
+			break;
+
+		case kTypeEngineType:
+			_value._engineType = var._value._engineType;
+			var._value._engineType = 0;
+			break;
+
+		case kTypeScriptState:
+			_value._scriptState = var._value._scriptState;
+			var._value._scriptState = 0;
+			break;
+
+		case kTypeReference:
+			_value._reference = var._value._reference;
+			break;
+
+		default:
+			break;
+	}
+
+	_type = var._type;
+
+	var.setType(kTypeVoid);
 }
 
 Variable &Variable::operator=(const Variable &var) {
 	if (&var == this)
 		return *this;
 
-	setType(var._type);
-
-	if      (_type == kTypeString)
-		*_value._string = *var._value._string;
-	else if (_type == kTypeObject)
-		*_value._object = *var._value._object;
-	else if (_type == kTypeEngineType)
-		*this = var._value._engineType;
-	else if (_type == kTypeScriptState)
-		*_value._scriptState = *var._value._scriptState;
-	else if (_type == kTypeArray)
-		_array = var._array;
-	else
-		_value = var._value;
+	// Reuse the existing string, to keep its buffer
+	if ((_type == kTypeString) && (var._type == kTypeString)) {
+		_value._string = var._value._string;
+		return *this;
+	}
+
+	if ((var._type == kTypeEngineType) || (var._type == kTypeScriptState)) {
+		setType(var._type);
+
+		if (_type == kTypeEngineType)
+			*this = var._value._engineType;
+		else
+			*_value._scriptState = *var._value._scriptState;
+
+		return *this;
+	}
+
+	setType(kTypeVoid);
+
+	switch (var._type) {
+		case kTypeString:
+			new (&_value._string) Common::UString(var._value._string);
+			break;
+
+		case kTypeObject:
+			new (&_value._object) ObjectReference(var._value._object);
+			break;
+
+		case kTypeArray:
+			new (&_value._array) boost::shared_ptr<Array>(var._value._array);
+			break;
+
+		case kTypeInt:
+			_value._int = var._value._int;
+			break;
+
+		case kTypeFloat:
+			_value._float = var._value._float;
+			break;
+
+		case kTypeVector:
+			_value._vector[0] = var._value._vector[0];
+			_value._vector[1] = var._value._vector[1];
+			_value._vector[2] = var._value._vector[2];
+			break;
+
+		case kTypeReference:
+			_value._reference = var._value._reference;
+			break;
+
+		default:
+			break;
+	}
+
+	_type = var._type;
+
+	return *this;
+}
+
+Variable &Variable::operator=(Variable &&var) noexcept {
+	if (&var == this)
+		return *this;
+
+	setType(kTypeVoid);
+	moveFrom(var);
 
 	return *this;
 }
@@ -207,7 +322,7 @@ Variable &Variable::operator=(const Common::UString &value) {
 	if (_type != kTypeString)
 		throw Common::Exception("Can't assign a string value to a non-string variable");
 
-	*_value._string = value;
+	_value._string = value;
 
 	return *this;
 }
@@ -216,7 +331,7 @@ Variable &Variable::operator=(Object *value) {
 	if (_type != kTypeObject)
 		throw Common::Exception("Can't assign an object value to a non-object variable");
 
-	*_value._object = value;
+	_value._object = value;
 
 	return *this;
 }
@@ -225,7 +340,7 @@ Variable &Variable::operator=(const ObjectReference &value) {
 	if (_type != kTypeObject)
 		throw Common::Exception("Can't assign an object value to a non-object variable");
 
-	*_value._object = value;
+	_value._object = value;
 
 	return *this;
 }
@@ -267,10 +382,10 @@ bool Variable::operator==(const Variable &var) const {
 			return _value._float == var._value._float;
 
 		case kTypeString:
-			return *_value._string == *var._value._string;
+			return _value._string == var._value._string;
 
 		case kTypeObject:
-			return *_value._object == *var._value._object;
+			return _value._object.getId() == var._value._object.getId();
 
 		case kTypeVector:
 			return _value._vector[0] == var._value._vector[0] &&
@@ -278,7 +393,7 @@ bool Variable::operator==(const Variable &var) const {
 			       _value._vector[2] == var._value._vector[2];
 
 		case kTypeArray:
-			return _array.get() && var._array.get() && *_array == *var._array;
+			return _value._array.get() && var._value._array.get() && *_value._array == *var._value._array;
 
 		default:
 			break;
@@ -313,21 +428,21 @@ const Common::UString &Variable::getString() const {
 	if (_type != kTypeString)
 		throw Common::Exception("Can't get a string value from a non-string variable");
 
-	return *_value._string;
+	return _value._string;
 }
 
 Common::UString &Variable::getString() {
 	if (_type != kTypeString)
 		throw Common::Exception("Can't get a string value from a non-string variable");
 
-	return *_value._string;
+	return _value._string;
 }
 
 Object *Variable::getObject() const {
 	if (_type != kTypeObject)
 		throw Common::Exception("Can't get an object value from a non-object variable");
 
-	return **_value._object;
+	return *_value._object;
 }
 
 EngineType *Variable::getEngineType() const {
@@ -359,41 +474,42 @@ const Variable::Array &Variable::getArray() const {
 	if (_type != kTypeArray)
 		throw Common::Exception("Can't get an array value from a non-array variable");
 
-	assert(_array.get());
+	assert(_value._array.get());
 
-	return *_array;
+	return *_value._array;
 }
 
 Variable::Array &Variable::getArray() {
 	if (_type != kTypeArray)
 		throw Common::Exception("Can't get an array value from a non-array variable");
 
-	assert(_array.get());
+	assert(_value._array.get());
 
-	return *_array;
+	return *_value._array;
 }
 
 size_t Variable::getArraySize() const {
 	if (_type != kTypeArray)
 		throw Common::Exception("Can't get an array size from a non-array variable");
 
-	assert(_array.get());
+	assert(_value._array.get());
 
-	return _array->size();
+	return _value._array->size();
 }
 
 void Variable::growArray(Type type, size_t size) {
 	if (_type != kTypeArray)
 		throw Common::Exception("Can't grow a non-array variable");
 
-	assert(_array.get());
+	assert(_value._array.get());
+
+	Array &array = *_value._array;
 
-	if (!_array->empty() && (*_array)[0].get() && (*_array)[0]->getType() != type)
-		throw Common::Exception("Array type mismatch (%d vs %d)", (*_array)[0]->getType(), type);
+	if (!array.empty() && (array[0].getType() != type))
+		throw Common::Exception("Array type mismatch (%d vs %d)", array[0].getType(), type);
 
-	_array->reserve(size);
-	while (_array->size() < size)
-		_array->push_back(boost::make_shared<Variable>(Variable(type)));
+	while (array.size() < size)
+		array.emplace_back(type);
 }
 
 ScriptState &Variable::getScriptState() {
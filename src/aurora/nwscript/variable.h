@@ -26,18 +26,17 @@
 #define AURORA_NWSCRIPT_VARIABLE_H
 
 #include <vector>
+#include <deque>
 
 #include <boost/shared_ptr.hpp>
 
 #include "src/common/types.h"
+#include "src/common/ustring.h"
 
 #include "src/aurora/types.h"
 
 #include "src/aurora/nwscript/types.h"
-
-namespace Common {
-	class UString;
-}
+#include "src/aurora/nwscript/objectref.h"
 
 namespace Aurora {
 
@@ -45,17 +44,30 @@ namespace NWScript {
 
 class Object;
 class EngineType;
-class ObjectReference;
 
 struct ScriptState {
 	uint32_t offset;
 	std::vector<class Variable> globals;
 	std::vector<class Variable> locals;
+
+	/** The return addresses of the subroutines a suspended script was in, innermost last. */
+	std::vector<uint32_t> returnOffsets;
 };
 
+/** An NWScript variable.
+ *
+ *  Ints, floats, vectors, strings and objects are held directly within
+ *  the variable, so creating, copying and moving these doesn't allocate
+ *  (short of strings longer than the small string buffer). Arrays are
+ *  shared between copies of the variable.
+ */
 class Variable {
 public:
-	typedef std::vector< boost::shared_ptr<Variable> > Array;
+	/** The elements of an array.
+	 *
+	 *  A deque, so that references to elements stay valid when the array grows.
+	 */
+	typedef std::deque<Variable> Array;
 
 	Variable(Type type = kTypeVoid);
 	Variable(int32_t value);
@@ -67,11 +79,13 @@ public:
 	Variable(const EngineType &value);
 	Variable(float x, float y, float z);
 	Variable(const Variable &var);
+	Variable(Variable &&var) noexcept;
 	~Variable();
 
 	void setType(Type type);
 
 	Variable &operator=(const Variable &var);
+	Variable &operator=(Variable &&var) noexcept;
 
 	Variable &operator=(int32_t value);
 	Variable &operator=(float value);
@@ -112,18 +126,24 @@ public:
 private:
 	Type _type;
 
-	union {
+	/** The value of the variable. Only the member matching _type is alive. */
+	union Value {
 		int32_t _int;
 		float _float;
-		Common::UString *_string;
-		ObjectReference *_object;
 		float _vector[3];
+		Common::UString _string;
+		ObjectReference _object;
+		boost::shared_ptr<Array> _array;
 		ScriptState *_scriptState;
 		EngineType *_engineType;
 		Variable *_reference;
+
+		Value() : _int(0) { }
+		~Value() { }
 	} _value;
 
-	boost::shared_ptr<Array> _array;
+	/** Take over the value of another variable, leaving it void. */
+	void moveFrom(Variable &var);
 };
 
 } // End of namespace NWScript
@@ -165,7 +165,7 @@ uint32_t OBBFile::getResourceSize(uint32_t index) const {
 	return getIResource(index).uncompressedSize;
 }
 
-Common::SeekableReadStream *OBBFile::getResource(uint32_t index, bool UNUSED(tryNoCopy)) const {
+Common::SeekableReadStream *OBBFile::getResource(uint32_t index, bool tryNoCopy) const {
 	/* Decompress a single file.
 	 *
 	 * Files in OBB virtual filesystems are split up in zlib compressed chunks.
@@ -191,6 +191,14 @@ Common::SeekableReadStream *OBBFile::getResource(uint32_t index, bool UNUSED(try
 
 	const IResource &res = getIResource(index);
 
+	/* When we may hand out a stream reading from the OBB itself, decompress
+	 * lazily instead. This is used for archives within the OBB, which only
+	 * ever read small parts of themselves, and the decompression can restart
+	 * from any chunk that was already reached. */
+	if (tryNoCopy)
+		return Common::decompressDeflateStream(new Common::SeekableSubReadStream(_obb.get(), res.offset, _obb->size()),
+		                                       res.uncompressedSize, Common::kWindowBitsMax, true);
+
 	_obb->seek(res.offset);
 
 	std::unique_ptr<byte[]> data = std::make_unique<byte[]>(res.uncompressedSize);
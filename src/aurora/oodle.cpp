@@ -31,8 +31,9 @@
 #include <algorithm>
 #include <numeric>
 
+#include "src/common/util.h"
+#include "src/common/error.h"
 #include "src/common/memreadstream.h"
-#include "src/common/writefile.h"
 #include "src/common/bitstream.h"
 
 #include "src/aurora/oodle.h"
@@ -45,9 +46,13 @@ struct Decoder {
 	uint32_t numer { 0 };
 	uint32_t denom { 0x80 };
 	uint32_t nextDenom { 0 };
-	uint8_t *stream;
+	const uint8_t *stream;
+	const uint8_t *end;
 
-	Decoder(uint8_t *stream);
+	Decoder(const uint8_t *stream, const uint8_t *end);
+
+	/** Read a byte of the compressed data, or 0 past its end. */
+	uint8_t getByte(size_t offset) const;
 
 	uint16_t decode(uint16_t max);
 	uint16_t commit(uint16_t max, uint16_t val, uint16_t err);
@@ -93,7 +98,12 @@ struct Dictionary {
 
 	Dictionary(Parameters &params);
 
-	uint32_t decompressBlock(Decoder &dec, uint8_t *dbuf);
+	/** Decode one literal or backreference to dbuf.
+	 *
+	 *  start and end are the bounds of the whole output buffer.
+	 *  @return The number of bytes written.
+	 */
+	uint32_t decompressBlock(Decoder &dec, uint8_t *dbuf, const uint8_t *start, const uint8_t *end);
 };
 
 struct Parameters {
@@ -104,15 +114,19 @@ struct Parameters {
 	uint8_t sizesCount[4];
 };
 
-Decoder::Decoder(uint8_t *s) : stream(s) {
-	numer = stream[0] >> 1;
+Decoder::Decoder(const uint8_t *s, const uint8_t *e) : stream(s), end(e) {
+	numer = getByte(0) >> 1;
+}
+
+uint8_t Decoder::getByte(size_t offset) const {
+	return ((stream + offset) < end) ? stream[offset] : 0;
 }
 
 uint16_t Decoder::decode(uint16_t max) {
 	for (; denom <= 0x800000; denom <<= 8) {
 		numer <<= 8;
-		numer  |= (stream[0] << 7) & 0x80;
-		numer  |= (stream[1] >> 1) & 0x7F;
+		numer  |= (getByte(0) << 7) & 0x80;
+		numer  |= (getByte(1) >> 1) & 0x7F;
 		stream++;
 	}
 
@@ -272,7 +286,7 @@ Dictionary::Dictionary(Parameters &params) :
 	sizeWindows.emplace_back(64, params.sizesCount[0]);
 }
 
-uint32_t Dictionary::decompressBlock(Decoder &dec, uint8_t *dbuf) {
+uint32_t Dictionary::decompressBlock(Decoder &dec, uint8_t *dbuf, const uint8_t *start, const uint8_t *end) {
 	auto d1 = sizeWindows[backrefSize].tryDecode(dec);
 
 	if (d1.first)
@@ -299,18 +313,31 @@ uint32_t Dictionary::decompressBlock(Decoder &dec, uint8_t *dbuf) {
 
 		auto backref_offset = (d4.second << 10) + (d5.second << 2) + d3.second + 1u;
 
+		if (backref_offset > (size_t)(dbuf - start))
+			throw Common::Exception("Oodle1 backreference before the start of the data");
+
+		// The last backreference might reach over the end of the data
+		backref_size = std::min<size_t>(backref_size, end - dbuf);
+
 		decodedSize += backref_size;
 
-		size_t repeat = backref_size / backref_offset;
-		size_t remain = backref_size % backref_offset;
-		for (size_t i = 0; i < repeat; ++i) {
-			std::memcpy(dbuf + i * backref_offset, dbuf - backref_offset, backref_offset);
+		/* Copy the first period of the referenced data. If the reference
+		 * overlaps the data it produces, the bytes written so far are
+		 * already a whole number of periods, so copying them onto the
+		 * end doubles the run with each step. */
+		size_t copied = std::min<size_t>(backref_offset, backref_size);
+		std::memcpy(dbuf, dbuf - backref_offset, copied);
+
+		while (copied < backref_size) {
+			const size_t n = std::min<size_t>(copied, backref_size - copied);
+			std::memcpy(dbuf + copied, dbuf, n);
+
+			copied += n;
 		}
-		std::memcpy(dbuf + repeat * backref_offset, dbuf - backref_offset, remain);
 
 		return backref_size;
 	} else {
-		auto i  = (uintptr_t) dbuf % 4;
+		auto i  = (dbuf - start) % 4;
 		auto d2 = decodedWindows[i].tryDecode(dec);
 		if (d2.first)
 			d2.second = (*d2.first = dec.decodeAndCommit(decodedValueMax));
@@ -322,11 +349,11 @@ uint32_t Dictionary::decompressBlock(Decoder &dec, uint8_t *dbuf) {
 	}
 }
 
-void decompress(uint32_t csize, uint8_t *cbuf, uint32_t step1, uint32_t step2, uint32_t dsize, uint8_t *dbuf) {
-	if (csize == 0)
+static void decompress(size_t csize, const uint8_t *cbuf, uint32_t step1, uint32_t step2, size_t dsize, uint8_t *dbuf) {
+	if (csize == 0) {
+		std::memset(dbuf, 0, dsize);
 		return;
-
-	std::memset(cbuf + csize, 0, (4 - csize) % 4);
+	}
 
 	Common::MemoryReadStream stream(cbuf, csize);
 
@@ -343,27 +370,38 @@ void decompress(uint32_t csize, uint8_t *cbuf, uint32_t step1, uint32_t step2, u
 		stream.read(param.sizesCount, 4);
 	}
 
-	Decoder  dec   = Decoder(cbuf + stream.pos());
-	uint32_t steps[] = { step1, step2, dsize };
+	/* The three sections share one arithmetic decoder state, and later
+	 * sections can reference data of earlier ones, so they can't be
+	 * decoded independently of each other. */
+	Decoder  dec     = Decoder(cbuf + stream.pos(), cbuf + csize);
+	size_t   steps[] = { MIN<size_t>(step1, dsize), MIN<size_t>(step2, dsize), dsize };
 	uint8_t *dptr    = dbuf;
+	uint8_t *dend    = dbuf + dsize;
 
 	for (size_t i = 0; i < 3; ++i) {
 		std::unique_ptr<Dictionary> dic = std::make_unique<Dictionary>(params[i]);
 
 		while (dptr < dbuf + steps[i]) {
-			dptr += dic->decompressBlock(dec, dptr);
+			dptr += dic->decompressBlock(dec, dptr, dbuf, dend);
 		}
 	}
 }
 
-Common::ReadStream *decompressOodle1(byte *data, size_t compressedSize, size_t decompressedSize, uint32_t stop0, uint32_t stop1) {
-	std::unique_ptr<byte[]> decompressedData = std::make_unique<byte[]>(decompressedSize);
+void decompressOodle1(const byte *data, size_t compressedSize, byte *output, size_t decompressedSize,
+                      uint32_t stop0, uint32_t stop1) {
+
+	decompress(compressedSize, data, stop0, stop1, decompressedSize, output);
+}
+
+Common::ReadStream *decompressOodle1(const byte *data, size_t compressedSize, size_t decompressedSize,
+                                     uint32_t stop0, uint32_t stop1) {
 
-	std::memset(decompressedData.get(), 0, decompressedSize);
+	// Every byte of the output is written by the decoder, no need to clear it first
+	std::unique_ptr<byte[]> decompressedData(new byte[decompressedSize]);
 
-	decompress(compressedSize, data, stop0, stop1, decompressedSize, decompressedData.get());
+	decompressOodle1(data, compressedSize, decompressedData.get(), decompressedSize, stop0, stop1);
 
-	return new Common::MemoryReadStream(decompressedData.release(), decompressedSize);
+	return new Common::MemoryReadStream(decompressedData.release(), decompressedSize, true);
 }
 
 } // End of namespace Aurora
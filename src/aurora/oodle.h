@@ -40,7 +40,20 @@ namespace Aurora {
  *  @param stop1 The stop1 value
  *  @return A stream of the decompressed data
  */
-Common::ReadStream *decompressOodle1(byte *data, size_t compressedSize, size_t decompressedSize, uint32_t stop0, uint32_t stop1);
+Common::ReadStream *decompressOodle1(const byte *data, size_t compressedSize, size_t decompressedSize,
+                                     uint32_t stop0, uint32_t stop1);
+
+/** Decompress a chunk of oodle1 compressed data into an existing buffer.
+ *
+ *  @param data The incoming compressed oodle1 data
+ *  @param compressedSize The size of the compressed data
+ *  @param output The buffer to decompress into, decompressedSize bytes large
+ *  @param decompressedSize The decompressed size of the data
+ *  @param stop0 The stop0 value
+ *  @param stop1 The stop1 value
+ */
+void decompressOodle1(const byte *data, size_t compressedSize, byte *output, size_t decompressedSize,
+                      uint32_t stop0, uint32_t stop1);
 
 } // End of namespace Aurora
 
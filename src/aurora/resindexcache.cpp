@@ -0,0 +1,239 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A persistent cache of archive indices.
+ */
+
+#include <cstring>
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/readstream.h"
+#include "src/common/writestream.h"
+#include "src/common/encoding.h"
+#include "src/common/filepath.h"
+
+#include "src/aurora/resindexcache.h"
+
+static const uint32_t kCacheID      = MKTAG('X', 'R', 'I', 'C');
+static const uint32_t kCacheVersion = MKTAG('V', '1', '.', '0');
+
+namespace Aurora {
+
+static Common::UString readString(Common::SeekableReadStream &stream) {
+	const uint32_t length = stream.readUint32LE();
+	if (length > (stream.size() - stream.pos()))
+		throw Common::Exception("String too long (%u)", length);
+
+	return Common::readStringFixed(stream, Common::kEncodingUTF8, length);
+}
+
+static void writeString(Common::WriteStream &stream, const Common::UString &string) {
+	const uint32_t length = std::strlen(string.c_str());
+
+	stream.writeUint32LE(length);
+	stream.write(string.c_str(), length);
+}
+
+
+ResourceIndexCache::ArchiveIndex::ArchiveIndex() : size(0), modificationTime(0),
+	type(kArchiveMAX), hashAlgo(Common::kHashNone) {
+
+}
+
+
+ResourceIndexCache::ResourceIndexCache() : _dirty(false) {
+}
+
+ResourceIndexCache::~ResourceIndexCache() {
+}
+
+void ResourceIndexCache::clear() {
+	_dirty = !_entries.empty();
+
+	_entries.clear();
+}
+
+bool ResourceIndexCache::isDirty() const {
+	return _dirty;
+}
+
+bool ResourceIndexCache::read(Common::SeekableReadStream &stream) {
+	_entries.clear();
+	_dirty = false;
+
+	try {
+		if (stream.readUint32BE() != kCacheID)
+			throw Common::Exception("Not a resource index cache");
+
+		if (stream.readUint32BE() != kCacheVersion)
+			throw Common::Exception("Unsupported resource index cache version");
+
+		const uint32_t entryCount = stream.readUint32LE();
+
+		for (uint32_t i = 0; i < entryCount; i++) {
+			Entry entry;
+
+			readArchive(stream, entry.archive);
+
+			const uint32_t dataFileCount = stream.readUint32LE();
+			if (dataFileCount > (stream.size() - stream.pos()))
+				throw Common::Exception("Too many data files (%u)", dataFileCount);
+
+			entry.dataFiles.resize(dataFileCount);
+			for (uint32_t j = 0; j < dataFileCount; j++)
+				readArchive(stream, entry.dataFiles[j]);
+
+			_entries[entry.archive.path] = entry;
+		}
+
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed to read the resource index cache");
+
+		_entries.clear();
+		return false;
+	}
+
+	return true;
+}
+
+void ResourceIndexCache::write(Common::WriteStream &stream) {
+	stream.writeUint32BE(kCacheID);
+	stream.writeUint32BE(kCacheVersion);
+
+	stream.writeUint32LE(_entries.size());
+
+	for (EntryMap::const_iterator e = _entries.begin(); e != _entries.end(); ++e) {
+		writeArchive(stream, e->second.archive);
+
+		stream.writeUint32LE(e->second.dataFiles.size());
+		for (std::vector<ArchiveIndex>::const_iterator d = e->second.dataFiles.begin();
+		     d != e->second.dataFiles.end(); ++d)
+			writeArchive(stream, *d);
+	}
+
+	_dirty = false;
+}
+
+const ResourceIndexCache::Entry *ResourceIndexCache::find(const Common::UString &path, ArchiveType type) {
+	EntryMap::iterator e = _entries.find(path);
+	if ((e == _entries.end()) || (e->second.archive.type != type))
+		return 0;
+
+	bool upToDate = isUpToDate(e->second.archive);
+	for (std::vector<ArchiveIndex>::const_iterator d = e->second.dataFiles.begin();
+	     upToDate && (d != e->second.dataFiles.end()); ++d)
+		upToDate = isUpToDate(*d);
+
+	if (!upToDate) {
+		_entries.erase(e);
+		_dirty = true;
+
+		return 0;
+	}
+
+	return &e->second;
+}
+
+void ResourceIndexCache::add(const Entry &entry) {
+	_entries[entry.archive.path] = entry;
+	_dirty = true;
+}
+
+bool ResourceIndexCache::stat(ArchiveIndex &archive) {
+	const size_t size = Common::FilePath::getFileSize(archive.path);
+	if (size == Common::kFileInvalid)
+		return false;
+
+	archive.size             = size;
+	archive.modificationTime = Common::FilePath::getModificationTime(archive.path);
+
+	return archive.modificationTime != 0;
+}
+
+bool ResourceIndexCache::fill(ArchiveIndex &index, const Archive &archive, ArchiveType type) {
+	index.type      = type;
+	index.hashAlgo  = archive.getNameHashAlgo();
+	index.resources = archive.getResources();
+
+	return stat(index);
+}
+
+bool ResourceIndexCache::isUpToDate(const ArchiveIndex &archive) {
+	ArchiveIndex current;
+	current.path = archive.path;
+
+	if (!Common::FilePath::isRegularFile(current.path) || !stat(current))
+		return false;
+
+	return (current.size == archive.size) && (current.modificationTime == archive.modificationTime);
+}
+
+void ResourceIndexCache::readArchive(Common::SeekableReadStream &stream, ArchiveIndex &archive) {
+	archive.name = readString(stream);
+	archive.path = readString(stream);
+
+	archive.size             = stream.readUint64LE();
+	archive.modificationTime = stream.readUint64LE();
+
+	archive.type     = (ArchiveType) stream.readUint32LE();
+	archive.hashAlgo = (Common::HashAlgo) stream.readUint32LE();
+
+	if (((size_t) archive.type) >= kArchiveMAX)
+		throw Common::Exception("Invalid archive type %u", (uint) archive.type);
+
+	const uint32_t resCount = stream.readUint32LE();
+	if (resCount > (stream.size() - stream.pos()))
+		throw Common::Exception("Too many resources (%u)", resCount);
+
+	for (uint32_t i = 0; i < resCount; i++) {
+		archive.resources.push_back(Archive::Resource());
+		Archive::Resource &res = archive.resources.back();
+
+		res.name  = readString(stream);
+		res.hash  = stream.readUint64LE();
+		res.type  = (FileType) stream.readSint32LE();
+		res.index = stream.readUint32LE();
+	}
+}
+
+void ResourceIndexCache::writeArchive(Common::WriteStream &stream, const ArchiveIndex &archive) {
+	writeString(stream, archive.name);
+	writeString(stream, archive.path);
+
+	stream.writeUint64LE(archive.size);
+	stream.writeUint64LE(archive.modificationTime);
+
+	stream.writeUint32LE((uint32_t) archive.type);
+	stream.writeUint32LE((uint32_t) archive.hashAlgo);
+
+	stream.writeUint32LE(archive.resources.size());
+
+	for (Archive::ResourceList::const_iterator r = archive.resources.begin(); r != archive.resources.end(); ++r) {
+		writeString(stream, r->name);
+
+		stream.writeUint64LE(r->hash);
+		stream.writeSint32LE((int32_t) r->type);
+		stream.writeUint32LE(r->index);
+	}
+}
+
+} // End of namespace Aurora
@@ -0,0 +1,147 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A persistent cache of archive indices.
+ */
+
+#ifndef AURORA_RESINDEXCACHE_H
+#define AURORA_RESINDEXCACHE_H
+
+#include <vector>
+#include <map>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+#include "src/common/hash.h"
+
+#include "src/aurora/types.h"
+#include "src/aurora/archive.h"
+
+namespace Common {
+	class SeekableReadStream;
+	class WriteStream;
+}
+
+namespace Aurora {
+
+/** A persistent cache of archive indices.
+ *
+ *  For every archive file on disk, this remembers the resource list
+ *  the archive produced when it was last indexed, together with the
+ *  size and modification time of the file at that point. As long as
+ *  neither changed, the archive's resources can be declared without
+ *  opening and parsing the archive itself.
+ *
+ *  KEY files carry the indices of all their BIFs along, since the
+ *  BIF resource lists are only valid in combination with the KEY.
+ */
+class ResourceIndexCache : boost::noncopyable {
+public:
+	/** The cached index of one archive file. */
+	struct ArchiveIndex {
+		Common::UString name; ///< The name the archive was referenced by.
+		Common::UString path; ///< The archive's path on disk.
+
+		uint64_t size;             ///< The archive's size when it was indexed.
+		uint64_t modificationTime; ///< The archive's modification time when it was indexed.
+
+		ArchiveType      type;     ///< The type of the archive.
+		Common::HashAlgo hashAlgo; ///< The algorithm the resource names within are hashed with.
+
+		Archive::ResourceList resources; ///< The archive's resources.
+
+		ArchiveIndex();
+	};
+
+	/** A cache entry, describing one indexed archive file. */
+	struct Entry {
+		ArchiveIndex archive; ///< The archive itself.
+
+		/** If the archive is a KEY, the indices of its BIFs. */
+		std::vector<ArchiveIndex> dataFiles;
+	};
+
+	ResourceIndexCache();
+	~ResourceIndexCache();
+
+	void clear();
+
+	/** Were there any changes since the cache was last loaded or saved? */
+	bool isDirty() const;
+
+	/** Read the cache from a stream.
+	 *
+	 *  If the stream doesn't contain a valid cache, the cache is left empty.
+	 *
+	 *  @param  stream The stream to read.
+	 *  @return true if a valid cache was read, false otherwise.
+	 */
+	bool read(Common::SeekableReadStream &stream);
+
+	/** Write the cache to a stream, and mark it as not dirty. */
+	void write(Common::WriteStream &stream);
+
+	/** Return the still up-to-date entry for this archive file.
+	 *
+	 *  If the archive file (or one of its data files) changed since it
+	 *  was added to the cache, the entry is dropped. An entry for the
+	 *  same file opened as a different archive type is kept, but not
+	 *  returned.
+	 *
+	 *  @param  path The path to the archive file.
+	 *  @param  type The type the archive file is opened as.
+	 *  @return The entry, or 0 if there's no up-to-date entry.
+	 */
+	const Entry *find(const Common::UString &path, ArchiveType type);
+
+	/** Add an entry to the cache, replacing any existing one for the same path. */
+	void add(const Entry &entry);
+
+	/** Fill in the size and modification time of an archive index from its file.
+	 *
+	 *  @return false if the file doesn't exist or its size couldn't be read.
+	 */
+	static bool stat(ArchiveIndex &archive);
+
+	/** Fill in everything but the name and path from an opened archive.
+	 *
+	 *  @return false if the file doesn't exist or its size couldn't be read.
+	 */
+	static bool fill(ArchiveIndex &index, const Archive &archive, ArchiveType type);
+
+private:
+	typedef std::map<Common::UString, Entry> EntryMap;
+
+	EntryMap _entries;
+
+	bool _dirty;
+
+	static bool isUpToDate(const ArchiveIndex &archive);
+
+	static void readArchive(Common::SeekableReadStream &stream, ArchiveIndex &archive);
+	static void writeArchive(Common::WriteStream &stream, const ArchiveIndex &archive);
+};
+
+} // End of namespace Aurora
+
+#endif // AURORA_RESINDEXCACHE_H
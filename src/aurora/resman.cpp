@@ -25,15 +25,26 @@
 #include <cassert>
 
 #include <memory>
+#include <algorithm>
+#include <exception>
 
 #include <boost/scope_exit.hpp>
 
 #include "src/common/util.h"
+#include "src/common/strutil.h"
+#include "src/common/debug.h"
 #include "src/common/error.h"
 #include "src/common/readstream.h"
+#include "src/common/memreadstream.h"
+#include "src/common/encoding.h"
 #include "src/common/filepath.h"
 #include "src/common/readfile.h"
+#include "src/common/pooledreadfile.h"
+#include "src/common/mappedfile.h"
 #include "src/common/writefile.h"
+#include "src/common/profiler.h"
+#include "src/common/threadpool.h"
+#include "src/common/endianness.h"
 
 #include "src/aurora/resman.h"
 #include "src/aurora/util.h"
@@ -43,6 +54,7 @@
 #include "src/aurora/biffile.h"
 #include "src/aurora/bzffile.h"
 #include "src/aurora/erffile.h"
+#include "src/aurora/erfwriter.h"
 #include "src/aurora/rimfile.h"
 #include "src/aurora/ndsrom.h"
 #include "src/aurora/zipfile.h"
@@ -50,10 +62,16 @@
 #include "src/aurora/herffile.h"
 #include "src/aurora/nsbtxfile.h"
 #include "src/aurora/smallfile.h"
+#include "src/aurora/resindexcache.h"
 
 // Check for hash collisions (if possible)
 #define CHECK_HASH_COLLISION 1
 
+/** The longest resource name an ERF V1.0, and so a prebaked archive, can hold. */
+static const size_t kPrebakeNameLength = 16;
+/** The name of the resource holding the fingerprint of a prebaked archive, of type TXT. */
+static const char * const kPrebakeFingerprint = "xoreosprebake";
+
 DECLARE_SINGLETON(Aurora::ResourceManager)
 
 namespace Aurora {
@@ -72,8 +90,8 @@ ResourceManager::KnownArchive::KnownArchive(ArchiveType t, const Common::UString
 ResourceManager::OpenedArchive::OpenedArchive() : archive(0), known(0), parent(0) {
 }
 
-void ResourceManager::OpenedArchive::set(KnownArchive &kA, Archive &a) {
-	archive = &a;
+void ResourceManager::OpenedArchive::set(KnownArchive &kA, Archive *a) {
+	archive = a;
 	known   = &kA;
 
 	if (known->opened)
@@ -108,7 +126,7 @@ bool ResourceManager::Resource::operator<(const Resource &right) const {
 
 
 ResourceManager::ResourceManager() : _hasSmall(false),
-	_hashAlgo(Common::kHashFNV64) {
+	_hashAlgo(Common::kHashFNV64), _generation(0), _mapArchives(false), _tracing(false) {
 
 	// These file types are archives
 
@@ -173,10 +191,19 @@ ResourceManager::ResourceManager() : _hasSmall(false),
 }
 
 ResourceManager::~ResourceManager() {
+	try {
+		saveIndexCache();
+	} catch (...) {
+	}
+
+	_prefetcher.stop();
+
 	clearResources();
 }
 
 void ResourceManager::clear() {
+	saveIndexCache();
+
 	_typeAliases.clear();
 
 	_hasSmall = false;
@@ -187,6 +214,8 @@ void ResourceManager::clear() {
 }
 
 void ResourceManager::clearResources() {
+	cancelPrefetches();
+
 	_cursorRemap.clear();
 
 	_baseDir.clear();
@@ -195,13 +224,23 @@ void ResourceManager::clearResources() {
 	for (size_t i = 0; i < kArchiveMAX; i++)
 		_knownArchives[i].clear();
 
+	dumpResourceCacheStatistics();
+	_resourceCache.clear();
+
 	for (OpenedArchives::iterator a = _openedArchives.begin(); a != _openedArchives.end(); ++a)
 		delete a->archive;
 	_openedArchives.clear();
 
+	Common::PooledReadFile::clearPool();
+
 	_resources.clear();
 
+	_freeResources.clear();
+	_resourcePool.clear();
+
 	_changes.clear();
+
+	_generation++;
 }
 
 void ResourceManager::setRIMsAreERFs(bool rimsAreERFs) {
@@ -295,11 +334,61 @@ bool ResourceManager::hasArchive(const Common::UString &file) {
 	return findArchive(file) != 0;
 }
 
+size_t ResourceManager::warmArchive(const Common::UString &file, size_t budget) {
+	const KnownArchive *knownArchive = findArchive(file);
+	if (!knownArchive || !knownArchive->resource || (knownArchive->resource->source != kSourceFile))
+		return 0;
+
+	Common::ReadFile archive;
+	if (!archive.open(knownArchive->resource->path) || (archive.size() == 0) || (archive.size() > budget))
+		return 0;
+
+	archive.setNeeded(true);
+
+	return archive.size();
+}
+
+void ResourceManager::coolArchive(const Common::UString &file) {
+	const KnownArchive *knownArchive = findArchive(file);
+	if (!knownArchive || !knownArchive->resource || (knownArchive->resource->source != kSourceFile))
+		return;
+
+	Common::ReadFile archive;
+	if (archive.open(knownArchive->resource->path))
+		archive.setNeeded(false);
+}
+
 Common::SeekableReadStream *ResourceManager::openArchiveStream(const KnownArchive &archive) const {
 	if (!archive.resource)
 		throw Common::Exception("Archive without resource reference");
 
-	return getResource(*archive.resource, true);
+	if (_mapArchives && (archive.resource->source == kSourceFile) &&
+	    ((archive.type == kArchiveBIF) || (archive.type == kArchiveERF) || (archive.type == kArchiveRIM) ||
+	     (archive.type == kArchiveNDS) || (archive.type == kArchiveZIP))) {
+
+		try {
+			Common::MappedReadStream *mapped = new Common::MappedReadStream(archive.resource->path);
+			mapped->advise(Common::kFileAccessRandom);
+
+			return mapped;
+		} catch (...) {
+			Common::exceptionDispatcherWarning("Failed to memory-map \"%s\"", archive.resource->path.c_str());
+		}
+	}
+
+	/* All archives but KEY files are kept around and read from one resource at
+	 * a time. There can be hundreds of them, so they share their file handles. */
+	if ((archive.resource->source == kSourceFile) && !archive.resource->isSmall && (archive.type != kArchiveKEY))
+		return new Common::PooledReadFile(archive.resource->path);
+
+	Common::SeekableReadStream *stream = readResource(*archive.resource, true);
+
+	// KEY files are read through once, front to back
+	Common::ReadFile *file = dynamic_cast<Common::ReadFile *>(stream);
+	if (file)
+		file->setAccessHint((archive.type == kArchiveKEY) ? Common::kFileAccessSequential : Common::kFileAccessRandom);
+
+	return stream;
 }
 
 void ResourceManager::indexArchive(const Common::UString &file, uint32_t priority,
@@ -316,48 +405,78 @@ void ResourceManager::indexArchive(const Common::UString &file, uint32_t priorit
 	if (changeID)
 		change = newChangeSet(*changeID);
 
-	Common::SeekableReadStream *archiveStream = openArchiveStream(*knownArchive);
+	// Encrypted archives are never cached, since the cache would leak their contents
+	if (password.empty() && indexCachedArchive(*knownArchive, priority, change))
+		return;
 
-	std::unique_ptr<Archive> archive;
-	switch (knownArchive->type) {
-		case kArchiveKEY:
-			indexKEY(archiveStream, priority, change);
-			break;
+	if (knownArchive->type == kArchiveKEY) {
+		indexKEY(*knownArchive, openArchiveStream(*knownArchive), priority, change);
+		return;
+	}
 
+	std::unique_ptr<Archive> archive(openArchive(*knownArchive, password));
+
+	if (password.empty())
+		cacheArchive(*knownArchive, *archive);
+
+	indexArchive(*knownArchive, archive.release(), priority, change);
+}
+
+Archive *ResourceManager::openArchive(const KnownArchive &knownArchive,
+                                      const std::vector<byte> &password) const {
+
+	if (knownArchive.type == kArchiveBIF)
+		return openKEYDataFile(knownArchive);
+
+	Common::SeekableReadStream *archiveStream = openArchiveStream(knownArchive);
+
+	switch (knownArchive.type) {
 		case kArchiveNDS:
-			archive = std::make_unique<NDSFile>(archiveStream);
-			break;
+			return new NDSFile(archiveStream);
 
 		case kArchiveHERF:
-			archive = std::make_unique<HERFFile>(archiveStream);
-			break;
+			return new HERFFile(archiveStream);
 
 		case kArchiveERF:
-			archive = std::make_unique<ERFFile>(archiveStream, password);
-			break;
+			return new ERFFile(archiveStream, password);
 
 		case kArchiveRIM:
-			archive = std::make_unique<RIMFile>(archiveStream);
-			break;
+			return new RIMFile(archiveStream);
 
 		case kArchiveZIP:
-			archive = std::make_unique<ZIPFile>(archiveStream);
-			break;
+			return new ZIPFile(archiveStream);
 
 		case kArchiveEXE:
-			archive = std::make_unique<PEFile>(archiveStream, _cursorRemap);
-			break;
+			return new PEFile(archiveStream, _cursorRemap);
 
 		case kArchiveNSBTX:
-			archive = std::make_unique<NSBTXFile>(archiveStream);
-			break;
+			return new NSBTXFile(archiveStream);
 
 		default:
-			throw Common::Exception("Invalid archive type %d", knownArchive->type);
+			break;
 	}
 
-	if (archive)
-		indexArchive(*knownArchive, archive.release(), priority, change);
+	delete archiveStream;
+	throw Common::Exception("Invalid archive type %d", knownArchive.type);
+}
+
+KEYDataFile *ResourceManager::openKEYDataFile(const KnownArchive &knownArchive) const {
+	if (Common::FilePath::getExtension(knownArchive.name).equalsIgnoreCase(".bzf"))
+		return new BZFFile(openArchiveStream(knownArchive));
+
+	return new BIFFile(openArchiveStream(knownArchive));
+}
+
+Archive &ResourceManager::getArchive(OpenedArchive &archive) const {
+	std::lock_guard<std::mutex> lock(_archiveMutex);
+
+	if (!archive.archive) {
+		assert(archive.known);
+
+		archive.archive = openArchive(*archive.known, std::vector<byte>());
+	}
+
+	return *archive.archive;
 }
 
 void ResourceManager::indexArchive(const Common::UString &file, uint32_t priority, Common::ChangeID *changeID) {
@@ -366,6 +485,141 @@ void ResourceManager::indexArchive(const Common::UString &file, uint32_t priorit
 	indexArchive(file, priority, password, changeID);
 }
 
+ResourceManager::BatchArchive::BatchArchive(const Common::UString &f, uint32_t p, Common::ChangeID *c) :
+	file(f), priority(p), changeID(c) {
+
+}
+
+ResourceManager::BatchArchive::BatchArchive(const Common::UString &f, uint32_t p,
+                                            const std::vector<byte> &pw, Common::ChangeID *c) :
+	file(f), priority(p), password(pw), changeID(c) {
+
+}
+
+/** An archive of a batch, parsed ahead of indexing it. */
+struct ResourceManager::ParsedArchive : boost::noncopyable {
+	const BatchArchive *batch;
+
+	/** The archive, if it can be parsed ahead. */
+	KnownArchive *known;
+
+	/** The parsed archive, if it's not a KEY. */
+	std::unique_ptr<Archive> archive;
+
+	/** The BIFs of a KEY, and their parsed data files. */
+	std::vector<KnownArchive *> dataFiles;
+	std::vector<KEYDataFile *> keyData;
+
+	/** The exception thrown while parsing the archive. */
+	std::exception_ptr error;
+
+	ParsedArchive(const BatchArchive &b) : batch(&b), known(0) {
+	}
+
+	~ParsedArchive() {
+		for (std::vector<KEYDataFile *>::iterator k = keyData.begin(); k != keyData.end(); ++k)
+			delete *k;
+	}
+};
+
+void ResourceManager::indexArchives(const std::vector<BatchArchive> &archives) {
+	std::vector<std::unique_ptr<ParsedArchive> > parsed;
+	std::vector<ParsedArchive *> toParse;
+
+	// Find the archives we can parse right now
+	parsed.reserve(archives.size());
+	for (std::vector<BatchArchive>::const_iterator a = archives.begin(); a != archives.end(); ++a) {
+		parsed.push_back(std::make_unique<ParsedArchive>(*a));
+
+		KnownArchive *knownArchive = findArchive(a->file);
+		if (!canParseArchive(knownArchive, a->password))
+			continue;
+
+		parsed.back()->known = knownArchive;
+		toParse.push_back(parsed.back().get());
+	}
+
+	/* Parse them on the thread pool. This includes checking the passwords of
+	 * encrypted archives and decrypting their headers, so those are batched too. */
+	ThreadPoolMan.parallelFor(toParse.size(), [this, &toParse](size_t i) {
+		parseArchive(*toParse[i]);
+	});
+
+	// And index them, in order
+	for (std::vector<std::unique_ptr<ParsedArchive> >::iterator p = parsed.begin(); p != parsed.end(); ++p) {
+		const BatchArchive &batch = *(*p)->batch;
+
+		if (!(*p)->known) {
+			indexArchive(batch.file, batch.priority, batch.password, batch.changeID);
+			continue;
+		}
+
+		try {
+			indexParsedArchive(**p);
+		} catch (Common::Exception &e) {
+			e.add("Failed to index archive \"%s\"", batch.file.c_str());
+			throw;
+		}
+	}
+}
+
+bool ResourceManager::canParseArchive(KnownArchive *knownArchive, const std::vector<byte> &password) {
+	// indexArchive() will throw the right errors for these
+	if (!knownArchive || (knownArchive->type == kArchiveBIF))
+		return false;
+
+	// Archives within other archives share their parent's stream, so we can't read them concurrently
+	if (!knownArchive->resource || (knownArchive->resource->source != kSourceFile))
+		return false;
+
+	// The cache is way faster anyway
+	std::vector<KnownArchive *> dataFiles;
+	if (password.empty() && findCachedArchive(*knownArchive, dataFiles))
+		return false;
+
+	return true;
+}
+
+void ResourceManager::parseArchive(ParsedArchive &parsed) {
+	try {
+		if (parsed.known->type == kArchiveKEY)
+			openKEYBIFs(openArchiveStream(*parsed.known), parsed.dataFiles, parsed.keyData);
+		else
+			parsed.archive.reset(openArchive(*parsed.known, parsed.batch->password));
+	} catch (...) {
+		parsed.error = std::current_exception();
+	}
+}
+
+void ResourceManager::indexParsedArchive(ParsedArchive &parsed) {
+	if (parsed.error)
+		std::rethrow_exception(parsed.error);
+
+	Change *change = 0;
+	if (parsed.batch->changeID)
+		change = newChangeSet(*parsed.batch->changeID);
+
+	KnownArchive &knownArchive = *parsed.known;
+
+	if (knownArchive.type == kArchiveKEY) {
+		cacheKEY(knownArchive, parsed.dataFiles, parsed.keyData);
+
+		for (size_t i = 0; i < parsed.keyData.size(); i++) {
+			KEYDataFile *keyData = parsed.keyData[i];
+			parsed.keyData[i] = 0;
+
+			indexArchive(*parsed.dataFiles[i], keyData, parsed.batch->priority, change);
+		}
+
+		return;
+	}
+
+	if (parsed.batch->password.empty())
+		cacheArchive(knownArchive, *parsed.archive);
+
+	indexArchive(knownArchive, parsed.archive.release(), parsed.batch->priority, change);
+}
+
 uint32_t ResourceManager::openKEYBIFs(Common::SeekableReadStream *keyStream,
                                     std::vector<KnownArchive *> &archives,
                                     std::vector<KEYDataFile *> &keyData) {
@@ -393,11 +647,7 @@ uint32_t ResourceManager::openKEYBIFs(Common::SeekableReadStream *keyStream,
 		if (!archives[i])
 			throw Common::Exception("BIF \"%s\" not found", keyBIFs[i].c_str());
 
-		if (Common::FilePath::getExtension(archives[i]->name).equalsIgnoreCase(".bzf"))
-			keyData[i] = new BZFFile(openArchiveStream(*archives[i]));
-		else
-			keyData[i] = new BIFFile(openArchiveStream(*archives[i]));
-
+		keyData[i] = openKEYDataFile(*archives[i]);
 		keyData[i]->mergeKEY(key, i);
 	}
 
@@ -405,12 +655,16 @@ uint32_t ResourceManager::openKEYBIFs(Common::SeekableReadStream *keyStream,
 	return archives.size();
 }
 
-void ResourceManager::indexKEY(Common::SeekableReadStream *stream, uint32_t priority, Change *change) {
+void ResourceManager::indexKEY(KnownArchive &knownArchive, Common::SeekableReadStream *stream,
+                               uint32_t priority, Change *change) {
+
 	std::vector<KnownArchive *> archives;
 	std::vector<KEYDataFile *> keyData;
 
 	const uint32_t count = openKEYBIFs(stream, archives, keyData);
 
+	cacheKEY(knownArchive, archives, keyData);
+
 	for (uint32_t i = 0; i < count; i++)
 		indexArchive(*archives[i], keyData[i], priority, change);
 }
@@ -419,12 +673,22 @@ void ResourceManager::indexArchive(KnownArchive &knownArchive, Archive *archive,
                                    uint32_t priority, Change *change) {
 
 	const Common::HashAlgo hashAlgo = archive->getNameHashAlgo();
-	if ((hashAlgo != Common::kHashNone) && (hashAlgo != _hashAlgo))
+	if ((hashAlgo != Common::kHashNone) && (hashAlgo != _hashAlgo)) {
+		delete archive;
+
 		throw Common::Exception("ResourceManager::indexArchive(): Archive uses a different name hashing "
 		                        "algorithm than we do (%d vs. %d)", (int) hashAlgo, (int) _hashAlgo);
+	}
 
+	OpenedArchive &opened = addOpenedArchive(knownArchive, archive, change);
+
+	indexArchive(opened, archive->getResources(), hashAlgo, priority, change);
+}
+
+ResourceManager::OpenedArchive &ResourceManager::addOpenedArchive(KnownArchive &knownArchive,
+                                                                  Archive *archive, Change *change) {
 	bool couldSet = false;
-	_openedArchives.push_back(OpenedArchive());
+	_openedArchives.emplace_back();
 
 	BOOST_SCOPE_EXIT( (&couldSet) (&_openedArchives) (&archive) ) {
 		if (!couldSet) {
@@ -433,20 +697,25 @@ void ResourceManager::indexArchive(KnownArchive &knownArchive, Archive *archive,
 		}
 	} BOOST_SCOPE_EXIT_END
 
-	_openedArchives.back().set(knownArchive, *archive);
+	_openedArchives.back().set(knownArchive, archive);
 	couldSet = true;
 
 	// Add the information of the new archive to the change set
 	if (change)
 		change->_change->openedArchives.push_back(--_openedArchives.end());
 
-	const Archive::ResourceList &resources = archive->getResources();
+	return _openedArchives.back();
+}
+
+void ResourceManager::indexArchive(OpenedArchive &archive, const Archive::ResourceList &resources,
+                                   Common::HashAlgo hashAlgo, uint32_t priority, Change *change) {
+
 	for (Archive::ResourceList::const_iterator resource = resources.begin(); resource != resources.end(); ++resource) {
 		// Build the resource record
 		Resource res;
 		res.priority     = priority;
 		res.source       = kSourceArchive;
-		res.archive      = &_openedArchives.back();
+		res.archive      = &archive;
 		res.archiveIndex = resource->index;
 		res.name         = resource->name;
 		res.type         = resource->type;
@@ -472,6 +741,462 @@ void ResourceManager::indexArchive(KnownArchive &knownArchive, Archive *archive,
 	}
 }
 
+void ResourceManager::setIndexCache(const Common::UString &file) {
+	saveIndexCache();
+
+	_indexCache.reset();
+	_indexCacheFile = file;
+
+	if (_indexCacheFile.empty())
+		return;
+
+	_indexCache = std::make_unique<ResourceIndexCache>();
+
+	if (!Common::FilePath::isRegularFile(_indexCacheFile))
+		return;
+
+	try {
+		Common::ReadFile cacheFile(_indexCacheFile);
+
+		_indexCache->read(cacheFile);
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed to open the resource index cache \"%s\"",
+		                                   _indexCacheFile.c_str());
+	}
+}
+
+void ResourceManager::saveIndexCache() {
+	if (!_indexCache || !_indexCache->isDirty() || _indexCacheFile.empty())
+		return;
+
+	try {
+		Common::WriteFile cacheFile(_indexCacheFile);
+
+		_indexCache->write(cacheFile);
+
+		cacheFile.flush();
+		cacheFile.close();
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed to write the resource index cache \"%s\"",
+		                                   _indexCacheFile.c_str());
+	}
+}
+
+void ResourceManager::setMapArchives(bool mapArchives) {
+	_mapArchives = mapArchives;
+}
+
+void ResourceManager::setPrefetchThreads(size_t count) {
+	_prefetcher.start(count);
+}
+
+void ResourceManager::prefetch(const Common::UString &name, FileType type) {
+	const Resource *res = getRes(name, type);
+	if (!res)
+		return;
+
+	_prefetcher.add(res, [this, res]() { return readResource(*res); });
+}
+
+void ResourceManager::prefetch(const Common::UString &name, const std::vector<FileType> &types) {
+	const Resource *res = getRes(name, types);
+	if (!res)
+		return;
+
+	_prefetcher.add(res, [this, res]() { return readResource(*res); });
+}
+
+std::future<Common::SeekableReadStream *> ResourceManager::getResourceAsync(const Common::UString &name,
+                                                                            FileType type) {
+
+	const Resource *res = getRes(name, type);
+	if (!res) {
+		std::promise<Common::SeekableReadStream *> promise;
+		promise.set_value(0);
+
+		return promise.get_future();
+	}
+
+	return _prefetcher.takeFuture(res, [this, res]() { return readResource(*res); });
+}
+
+void ResourceManager::cancelPrefetches() {
+	_prefetcher.cancel();
+}
+
+void ResourceManager::setResourceTraceDirectory(const Common::UString &directory) {
+	endResourceTrace();
+
+	_traceDirectory = directory;
+}
+
+void ResourceManager::beginResourceTrace(const Common::UString &name) {
+	endResourceTrace();
+
+	if (_traceDirectory.empty())
+		return;
+
+	Common::UString fileName;
+	for (Common::UString::iterator c = name.begin(); c != name.end(); ++c)
+		fileName += Common::UString::isAlNum(*c) ? *c : '_';
+
+	_traceFile = _traceDirectory + "/" + fileName.toLower() + ".trace";
+
+	if (Common::FilePath::isRegularFile(_traceFile)) {
+		ResourceTrace previous;
+
+		try {
+			Common::ReadFile traceFile(_traceFile);
+
+			previous.read(traceFile);
+		} catch (...) {
+			Common::exceptionDispatcherWarning("Failed to open the resource trace \"%s\"", _traceFile.c_str());
+		}
+
+		const ResourceTrace::Entries entries = previous.getEntries();
+		for (ResourceTrace::Entries::const_iterator e = entries.begin(); e != entries.end(); ++e)
+			prefetch(e->name, e->type);
+
+		debugC(Common::kDebugResources, 1, "Prefetching %u resources traced in \"%s\"",
+		       (uint)entries.size(), _traceFile.c_str());
+	}
+
+	_trace.clear();
+	_tracing.store(true, std::memory_order_release);
+}
+
+void ResourceManager::endResourceTrace() {
+	if (!_tracing.exchange(false, std::memory_order_acq_rel))
+		return;
+
+	try {
+		Common::WriteFile traceFile(_traceFile);
+
+		_trace.write(traceFile);
+
+		traceFile.flush();
+		traceFile.close();
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed to write the resource trace \"%s\"", _traceFile.c_str());
+	}
+
+	const ResourceTrace::Statistics statistics = _trace.getStatistics();
+	for (ResourceTrace::Statistics::const_iterator a = statistics.begin(); a != statistics.end(); ++a)
+		debugC(Common::kDebugResources, 1, "Traced I/O: %s resources, %s bytes, %s us from \"%s\"",
+		       Common::composeString(a->resources).c_str(), Common::composeString(a->size).c_str(),
+		       Common::composeString(a->time).c_str(), a->archive.c_str());
+
+	_trace.clear();
+}
+
+void ResourceManager::getPrebakeResources(PrebakeList &resources) const {
+	resources.clear();
+
+	for (ResourceMap::const_iterator r = _resources.begin(); r != _resources.end(); ++r) {
+		if (r->value.empty())
+			continue;
+
+		Resource *res = r->value.back();
+		if ((res->priority == 0) || (res->source != kSourceArchive) || !res->archive || !res->archive->known)
+			continue;
+
+		if (res->name.empty() || (res->name.size() > kPrebakeNameLength) || (getArchiveType(res->type) != kArchiveMAX))
+			continue;
+
+		resources.push_back(std::make_pair(r->key, res));
+	}
+
+	std::sort(resources.begin(), resources.end(),
+			[](const PrebakeList::value_type &a, const PrebakeList::value_type &b) { return a.first < b.first; });
+}
+
+uint64_t ResourceManager::getPrebakeFingerprint(const PrebakeList &resources) const {
+	// The archive files on disk the resources are in, with their size and modification time
+	std::map<const OpenedArchive *, uint64_t> archiveHashes;
+
+	uint64_t hash = Common::hashStringFNV64("");
+	for (PrebakeList::const_iterator r = resources.begin(); r != resources.end(); ++r) {
+		const Resource &res = *r->second;
+
+		std::map<const OpenedArchive *, uint64_t>::iterator archiveHash = archiveHashes.find(res.archive);
+		if (archiveHash == archiveHashes.end()) {
+			// Archives within archives are only as unchanged as the file they're in
+			const Resource *file = res.archive->known->resource;
+			while (file && (file->source == kSourceArchive) && file->archive && file->archive->known)
+				file = file->archive->known->resource;
+
+			uint64_t fileHash = Common::hashStringFNV64(res.archive->known->name);
+			if (file && (file->source == kSourceFile)) {
+				fileHash = Common::hashFNV64Value(fileHash, Common::hashStringFNV64(file->path));
+				fileHash = Common::hashFNV64Value(fileHash, (uint64_t) Common::FilePath::getFileSize(file->path));
+				fileHash = Common::hashFNV64Value(fileHash, (uint64_t) Common::FilePath::getModificationTime(file->path));
+			}
+
+			archiveHash = archiveHashes.insert(std::make_pair(res.archive, fileHash)).first;
+		}
+
+		hash = Common::hashFNV64Value(hash, (uint64_t) r->first);
+		hash = Common::hashFNV64Value(hash, (uint64_t) res.priority);
+		hash = Common::hashFNV64Value(hash, (uint64_t) res.archiveIndex);
+		hash = Common::hashFNV64Value(hash, archiveHash->second);
+	}
+
+	return hash;
+}
+
+void ResourceManager::writePrebakedArchive(const Common::UString &file) const {
+	PrebakeList resources;
+	getPrebakeResources(resources);
+
+	const Common::UString fingerprint = Common::formatHash(getPrebakeFingerprint(resources));
+
+	Common::WriteFile stream(file);
+
+	{
+		ERFWriter writer(MKTAG('E', 'R', 'F', ' '), resources.size() + 1, stream);
+
+		Common::MemoryReadStream fingerprintData(reinterpret_cast<const byte *>(fingerprint.c_str()), fingerprint.size());
+		writer.add(kPrebakeFingerprint, kFileTypeTXT, fingerprintData);
+
+		for (PrebakeList::const_iterator r = resources.begin(); r != resources.end(); ++r) {
+			const Resource &res = *r->second;
+
+			std::unique_ptr<Common::SeekableReadStream> data(readResource(res, true));
+			writer.add(res.name, res.type, *data);
+		}
+	}
+
+	stream.flush();
+	stream.close();
+
+	status("Prebaked %u resources into \"%s\"", (uint)resources.size(), file.c_str());
+}
+
+bool ResourceManager::indexPrebakedArchive(const Common::UString &file) {
+	const Common::UString path = Common::FilePath::normalize(file, false);
+	if (!Common::FilePath::isRegularFile(path))
+		return false;
+
+	Common::SeekableReadStream *stream = 0;
+	if (_mapArchives)
+		stream = new Common::MappedReadStream(path);
+	else
+		stream = new Common::ReadFile(path);
+
+	std::unique_ptr<Archive> archive(new ERFFile(stream));
+
+	PrebakeList resources;
+	getPrebakeResources(resources);
+
+	/* The archive holds the fingerprint, followed by the resources in the
+	 * same order we collected them in. Make sure both still match up. */
+	const Archive::ResourceList &archiveResources = archive->getResources();
+
+	bool upToDate = (archiveResources.size() == (resources.size() + 1)) &&
+	                (archiveResources.front().type == kFileTypeTXT) &&
+	                archiveResources.front().name.equalsIgnoreCase(kPrebakeFingerprint);
+
+	if (upToDate) {
+		std::unique_ptr<Common::SeekableReadStream> data(archive->getResource(archiveResources.front().index));
+
+		upToDate = Common::readString(*data, Common::kEncodingASCII) ==
+		           Common::formatHash(getPrebakeFingerprint(resources));
+	}
+
+	Archive::ResourceList::const_iterator archiveResource = archiveResources.begin();
+	for (PrebakeList::const_iterator r = resources.begin(); upToDate && (r != resources.end()); ++r) {
+		++archiveResource;
+
+		upToDate = (archiveResource->type == r->second->type) &&
+		           archiveResource->name.equalsIgnoreCase(r->second->name);
+	}
+
+	if (!upToDate) {
+		warning("The prebaked archive \"%s\" is outdated", path.c_str());
+		return false;
+	}
+
+	// Make the archive known, as a resource that's never returned itself
+	addResource(path, 0, 0);
+
+	KnownArchive *knownArchive = findArchive(path);
+	if (!knownArchive)
+		throw Common::Exception("Failed to register the prebaked archive \"%s\"", path.c_str());
+
+	OpenedArchive &opened = addOpenedArchive(*knownArchive, archive.release(), 0);
+
+	archiveResource = archiveResources.begin();
+	for (PrebakeList::const_iterator r = resources.begin(); r != resources.end(); ++r) {
+		++archiveResource;
+
+		Resource &res = *r->second;
+
+		res.archive      = &opened;
+		res.archiveIndex = archiveResource->index;
+		res.isSmall      = false;
+	}
+
+	_generation++;
+
+	return true;
+}
+
+void ResourceManager::setResourceCacheSize(size_t size) {
+	_resourceCache.setMaxSize(size);
+}
+
+void ResourceManager::dumpResourceCacheStatistics() const {
+	if (_resourceCache.getMaxSize() == 0)
+		return;
+
+	debugC(Common::kDebugResources, 1, "Resource cache: %s hits, %s misses, %s/%s bytes used",
+	       Common::composeString(_resourceCache.getHits()).c_str(),
+	       Common::composeString(_resourceCache.getMisses()).c_str(),
+	       Common::composeString(_resourceCache.getSize()).c_str(),
+	       Common::composeString(_resourceCache.getMaxSize()).c_str());
+}
+
+void ResourceManager::getResourceCacheStatistics(uint64_t &hits, uint64_t &misses,
+                                                 size_t &size, size_t &maxSize) const {
+
+	hits    = _resourceCache.getHits();
+	misses  = _resourceCache.getMisses();
+	size    = _resourceCache.getSize();
+	maxSize = _resourceCache.getMaxSize();
+}
+
+void ResourceManager::getMemoryUsage(Common::MemoryUsageList &usage) const {
+	size_t indexSize = _resourcePool.size() * sizeof(Resource) +
+	                   _resources.size() * (sizeof(uint64_t) + sizeof(ResourceList));
+
+	// Archives are opened lazily, so don't let them change under us
+	std::lock_guard<std::mutex> lock(_archiveMutex);
+
+	for (ResourceMap::const_iterator r = _resources.begin(); r != _resources.end(); ++r) {
+		indexSize += r->value.capacity() * sizeof(Resource *);
+
+		for (ResourceList::const_iterator res = r->value.begin(); res != r->value.end(); ++res) {
+			if (((*res)->source != kSourceArchive) || !(*res)->archive || !(*res)->archive->archive)
+				continue;
+
+			const size_t size = _resourceCache.getSize(*(*res)->archive->archive, (*res)->archiveIndex);
+			if (size > 0)
+				usage.add(TypeMan.setFileType((*res)->name, (*res)->type), size);
+		}
+	}
+
+	usage.add("<resource index>", indexSize);
+}
+
+bool ResourceManager::getCachePath(const KnownArchive &knownArchive, Common::UString &path) const {
+	// We can only cache archives that are direct files
+	if (!knownArchive.resource || (knownArchive.resource->source != kSourceFile))
+		return false;
+
+	// The contents of an EXE depend on the cursor remapping
+	if (knownArchive.type == kArchiveEXE)
+		return false;
+
+	path = knownArchive.resource->path;
+	return true;
+}
+
+const ResourceIndexCache::Entry *ResourceManager::findCachedArchive(KnownArchive &knownArchive,
+                                                                    std::vector<KnownArchive *> &dataFiles) {
+	Common::UString path;
+	if (!_indexCache || !getCachePath(knownArchive, path))
+		return 0;
+
+	const ResourceIndexCache::Entry *entry = _indexCache->find(path, knownArchive.type);
+	if (!entry)
+		return 0;
+
+	// Make sure we can find all the BIFs, and that they're still the same files
+	dataFiles.clear();
+	for (std::vector<ResourceIndexCache::ArchiveIndex>::const_iterator d = entry->dataFiles.begin();
+	     d != entry->dataFiles.end(); ++d) {
+
+		KnownArchive *dataFile = findArchive(d->name, _knownArchives[kArchiveBIF]);
+
+		Common::UString dataFilePath;
+		if (!dataFile || dataFile->opened || !getCachePath(*dataFile, dataFilePath) || (dataFilePath != d->path))
+			return 0;
+
+		dataFiles.push_back(dataFile);
+	}
+
+	const ResourceIndexCache::ArchiveIndex &archive = entry->archive;
+	if ((archive.hashAlgo != Common::kHashNone) && (archive.hashAlgo != _hashAlgo))
+		return 0;
+
+	return entry;
+}
+
+bool ResourceManager::indexCachedArchive(KnownArchive &knownArchive, uint32_t priority, Change *change) {
+	std::vector<KnownArchive *> dataFiles;
+
+	const ResourceIndexCache::Entry *entry = findCachedArchive(knownArchive, dataFiles);
+	if (!entry)
+		return false;
+
+	const ResourceIndexCache::ArchiveIndex &archive = entry->archive;
+
+	if (knownArchive.type == kArchiveKEY) {
+		for (size_t i = 0; i < dataFiles.size(); i++) {
+			const ResourceIndexCache::ArchiveIndex &dataFile = entry->dataFiles[i];
+
+			OpenedArchive &opened = addOpenedArchive(*dataFiles[i], 0, change);
+			indexArchive(opened, dataFile.resources, dataFile.hashAlgo, priority, change);
+		}
+
+		return true;
+	}
+
+	OpenedArchive &opened = addOpenedArchive(knownArchive, 0, change);
+	indexArchive(opened, archive.resources, archive.hashAlgo, priority, change);
+
+	return true;
+}
+
+void ResourceManager::cacheArchive(const KnownArchive &knownArchive, const Archive &archive) {
+	ResourceIndexCache::Entry entry;
+	if (!_indexCache || !getCachePath(knownArchive, entry.archive.path))
+		return;
+
+	entry.archive.name = knownArchive.name;
+	if (!ResourceIndexCache::fill(entry.archive, archive, knownArchive.type))
+		return;
+
+	_indexCache->add(entry);
+}
+
+void ResourceManager::cacheKEY(const KnownArchive &knownArchive, const std::vector<KnownArchive *> &archives,
+                               const std::vector<KEYDataFile *> &keyData) {
+
+	ResourceIndexCache::Entry entry;
+	if (!_indexCache || !getCachePath(knownArchive, entry.archive.path))
+		return;
+
+	entry.archive.name = knownArchive.name;
+	entry.archive.type = knownArchive.type;
+	if (!ResourceIndexCache::stat(entry.archive))
+		return;
+
+	entry.dataFiles.resize(archives.size());
+	for (size_t i = 0; i < archives.size(); i++) {
+		ResourceIndexCache::ArchiveIndex &dataFile = entry.dataFiles[i];
+
+		dataFile.name = archives[i]->name;
+		if (!getCachePath(*archives[i], dataFile.path))
+			return;
+
+		if (!ResourceIndexCache::fill(dataFile, *keyData[i], kArchiveBIF))
+			return;
+	}
+
+	_indexCache->add(entry);
+}
+
 bool ResourceManager::hasResourceDir(const Common::UString &dir) {
 	if (_baseDir.empty())
 		return false;
@@ -533,6 +1258,9 @@ void ResourceManager::undo(Common::ChangeID &changeID) {
 	if (!change || (change->_change == _changes.end()))
 		return;
 
+	// The prefetched resources might be in the archives we're about to remove
+	cancelPrefetches();
+
 	// Removing all changes in the opened archives list
 	for (OpenedArchiveChanges::iterator oaChange = change->_change->openedArchives.begin();
 	     oaChange != change->_change->openedArchives.end(); ++oaChange) {
@@ -562,6 +1290,9 @@ void ResourceManager::undo(Common::ChangeID &changeID) {
 				throw Common::Exception("Couldn't find archive in the parent's children list");
 		}
 
+		if ((*oaChange)->archive)
+			_resourceCache.removeArchive(*(*oaChange)->archive);
+
 		delete (*oaChange)->archive;
 		_openedArchives.erase(*oaChange);
 	}
@@ -584,20 +1315,29 @@ void ResourceManager::undo(Common::ChangeID &changeID) {
 	for (ResourceChanges::iterator resChange = change->_change->resources.begin();
 	     resChange != change->_change->resources.end(); ++resChange) {
 
+		Resource *res = resChange->res;
+
 		// If the resource still has an archive attached, it was added by a
 		// declareResources() call and needs to be removed manually
-		if (resChange->resIt->selfArchive.first) {
-			if (resChange->resIt->selfArchive.second->opened)
+		if (res->selfArchive.first) {
+			if (res->selfArchive.second->opened)
 				throw Common::Exception("Attempted to deindex an archive resource that's still opened");
 
-			resChange->resIt->selfArchive.first->erase(resChange->resIt->selfArchive.second);
+			res->selfArchive.first->erase(res->selfArchive.second);
 		}
 
 		// Remove the resource, and the name list too if it's empty
-		resChange->hashIt->second.erase(resChange->resIt);
+		ResourceList *resList = _resources.find(resChange->hash);
+		if (resList) {
+			ResourceList::iterator r = std::find(resList->begin(), resList->end(), res);
+			if (r != resList->end())
+				resList->erase(r);
+
+			if (resList->empty())
+				_resources.erase(resChange->hash);
+		}
 
-		if (resChange->hashIt->second.empty())
-			_resources.erase(resChange->hashIt);
+		freeResource(res);
 	}
 
 	// Now we can remove the change set from our list of change sets
@@ -605,26 +1345,32 @@ void ResourceManager::undo(Common::ChangeID &changeID) {
 
 	// And finally set the change ID to a defined empty state
 	changeID.clear();
+
+	_generation++;
 }
 
 void ResourceManager::addTypeAlias(FileType alias, FileType realType) {
 	_typeAliases[alias] = realType;
+
+	_generation++;
 }
 
 void ResourceManager::blacklist(const Common::UString &name, FileType type) {
-	ResourceMap::iterator resList = _resources.find(getHash(name, type));
-	if (resList == _resources.end())
+	ResourceList *resList = _resources.find(getHash(name, type));
+	if (!resList)
 		return;
 
-	for (ResourceList::iterator res = resList->second.begin(); res != resList->second.end(); ++res)
-		res->priority = 0;
+	for (ResourceList::iterator res = resList->begin(); res != resList->end(); ++res)
+		(*res)->priority = 0;
+
+	_generation++;
 }
 
 void ResourceManager::declareResource(const Common::UString &name, FileType type) {
 	bool isSmall = false;
 
-	ResourceMap::iterator resList = _resources.find(getHash(name, type));
-	if (resList == _resources.end()) {
+	ResourceList *resList = _resources.find(getHash(name, type));
+	if (!resList) {
 		if (_hasSmall) {
 			Common::UString smallName = TypeMan.addFileType(TypeMan.setFileType(name, type), kFileTypeSMALL);
 
@@ -632,23 +1378,29 @@ void ResourceManager::declareResource(const Common::UString &name, FileType type
 			isSmall = true;
 		}
 
-		if (resList == _resources.end())
+		if (!resList)
 			return;
 	}
 
-	for (ResourceList::iterator r = resList->second.begin(); r != resList->second.end(); ++r) {
-		r->name    = name;
-		r->type    = type;
-		r->isSmall = isSmall;
+	for (ResourceList::iterator r = resList->begin(); r != resList->end(); ++r) {
+		(*r)->name    = name;
+		(*r)->type    = type;
+		(*r)->isSmall = isSmall;
 
-		checkResourceIsArchive(*r, 0);
+		checkResourceIsArchive(**r, 0);
 	}
+
+	_generation++;
 }
 
 void ResourceManager::declareResource(const Common::UString &name) {
 	declareResource(TypeMan.setFileType(name, kFileTypeNone), TypeMan.getFileType(name));
 }
 
+uint32_t ResourceManager::getGeneration() const {
+	return _generation;
+}
+
 bool ResourceManager::hasResource(const Common::UString &name, FileType type) const {
 	std::vector<FileType> types;
 
@@ -704,10 +1456,10 @@ Common::UString ResourceManager::findResourceFile(const Common::UString &name,
 
 uint32_t ResourceManager::getResourceSize(const Resource &res) const {
 	if (res.source == kSourceArchive) {
-		if ((res.archive == 0) || (res.archive->archive == 0) || (res.archiveIndex == 0xFFFFFFFF))
+		if ((res.archive == 0) || (res.archiveIndex == 0xFFFFFFFF))
 			return 0xFFFFFFFF;
 
-		return res.archive->archive->getResourceSize(res.archiveIndex);
+		return getArchive(*res.archive).getResourceSize(res.archiveIndex);
 	}
 
 	if (res.source == kSourceFile)
@@ -717,10 +1469,49 @@ uint32_t ResourceManager::getResourceSize(const Resource &res) const {
 }
 
 Common::SeekableReadStream *ResourceManager::getArchiveResource(const Resource &res, bool tryNoCopy) const {
-	if ((res.archive == 0) || (res.archive->archive == 0) || (res.archiveIndex == 0xFFFFFFFF))
+	if ((res.archive == 0) || (res.archiveIndex == 0xFFFFFFFF))
 		throw Common::Exception("Archive resource has no archive");
 
-	return res.archive->archive->getResource(res.archiveIndex, tryNoCopy);
+	const Archive &archive = getArchive(*res.archive);
+
+	// Archives that can be read concurrently, like mapped ZIPs, let prefetching decompress in parallel
+	std::unique_lock<std::mutex> lock(res.archive->mutex, std::defer_lock);
+	const bool needsLock = !archive.isThreadSafe();
+
+	const bool compressed = archive.isResourceCompressed(res.archiveIndex);
+	if (!compressed || (_resourceCache.getMaxSize() == 0)) {
+		if (needsLock)
+			lock.lock();
+
+		Common::SeekableReadStream *stream = archive.getResource(res.archiveIndex, tryNoCopy);
+
+		if (needsLock)
+			lock.unlock();
+
+		if (compressed)
+			Common::DebugManager::addMetric(Common::kMetricBytesDecompressed, stream->size());
+
+		return stream;
+	}
+
+	Common::SeekableReadStream *stream = _resourceCache.get(archive, res.archiveIndex);
+	if (stream)
+		return stream;
+
+	debugC(Common::kDebugResources, 3, "Resource cache miss: \"%s\"",
+	       TypeMan.setFileType(res.name, res.type).c_str());
+
+	if (needsLock)
+		lock.lock();
+
+	stream = archive.getResource(res.archiveIndex);
+
+	if (needsLock)
+		lock.unlock();
+
+	Common::DebugManager::addMetric(Common::kMetricBytesDecompressed, stream->size());
+
+	return _resourceCache.add(archive, res.archiveIndex, stream);
 }
 
 Common::SeekableReadStream *ResourceManager::getResource(const Common::UString &name, FileType type) const {
@@ -762,6 +1553,43 @@ Common::SeekableReadStream *ResourceManager::getResource(uint64_t hash, FileType
 }
 
 Common::SeekableReadStream *ResourceManager::getResource(const Resource &res, bool tryNoCopy) const {
+	PROFILE_ZONE("ResourceManager::getResource");
+
+	const bool tracing = _tracing.load(std::memory_order_acquire);
+	const uint64_t start = tracing ? Common::Profiler::getTime() : 0;
+
+	Common::SeekableReadStream *stream = 0;
+	if (!_prefetcher.take(&res, stream) || !stream)
+		stream = readResource(res, tryNoCopy);
+
+	if (tracing)
+		traceResource(res, stream, Common::Profiler::getTime() - start);
+
+	Common::DebugManager::addMetric(Common::kMetricResourcesFetched);
+	PROFILE_NOTE("resource", TypeMan.setFileType(res.name, res.type));
+
+	return stream;
+}
+
+void ResourceManager::traceResource(const Resource &res, const Common::SeekableReadStream *stream,
+                                    uint64_t time) const {
+
+	ResourceTrace::Entry entry;
+
+	entry.name = res.name;
+	entry.type = res.type;
+	entry.size = stream ? stream->size() : 0;
+	entry.time = MIN<uint64_t>(time, 0xFFFFFFFF);
+
+	if ((res.source == kSourceArchive) && res.archive && res.archive->known)
+		entry.archive = res.archive->known->name;
+	else
+		entry.archive = res.path;
+
+	_trace.add(entry);
+}
+
+Common::SeekableReadStream *ResourceManager::readResource(const Resource &res, bool tryNoCopy) const {
 	Common::SeekableReadStream *stream = 0;
 
 	switch (res.source) {
@@ -803,12 +1631,12 @@ void ResourceManager::getAvailableResources(FileType type,
 		std::list<ResourceID> &list) const {
 
 	for (ResourceMap::const_iterator r = _resources.begin(); r != _resources.end(); ++r) {
-		if (!r->second.empty() && (r->second.front().type == type)) {
+		if (!r->value.empty() && (r->value.front()->type == type)) {
 			list.push_back(ResourceID());
 
-			list.back().name = r->second.front().name;
-			list.back().type = r->second.front().type;
-			list.back().hash = r->first;
+			list.back().name = r->value.front()->name;
+			list.back().type = r->value.front()->type;
+			list.back().hash = r->key;
 		}
 	}
 }
@@ -818,12 +1646,12 @@ void ResourceManager::getAvailableResources(const std::vector<FileType> &types,
 
 	for (ResourceMap::const_iterator r = _resources.begin(); r != _resources.end(); ++r) {
 		for (std::vector<FileType>::const_iterator t = types.begin(); t != types.end(); ++t) {
-			if (!r->second.empty() && (r->second.front().type == *t)) {
+			if (!r->value.empty() && (r->value.front()->type == *t)) {
 				list.push_back(ResourceID());
 
-				list.back().name = r->second.front().name;
-				list.back().type = r->second.front().type;
-				list.back().hash = r->first;
+				list.back().name = r->value.front()->name;
+				list.back().type = r->value.front()->type;
+				list.back().hash = r->key;
 			}
 		}
 
@@ -902,17 +1730,17 @@ inline uint64_t ResourceManager::getHash(const Common::UString &name) const {
 	return Common::hashString(name.toLower(), _hashAlgo);
 }
 
-void ResourceManager::checkHashCollision(const Resource &resource, ResourceMap::const_iterator resList) {
-	if (resource.name.empty() || resList->second.empty())
+void ResourceManager::checkHashCollision(const Resource &resource, const ResourceList &resList) {
+	if (resource.name.empty() || resList.empty())
 		return;
 
 	Common::UString newName = TypeMan.setFileType(resource.name, resource.type).toLower();
 
-	for (ResourceList::const_iterator r = resList->second.begin(); r != resList->second.end(); ++r) {
-		if (r->name.empty())
+	for (ResourceList::const_iterator r = resList.begin(); r != resList.end(); ++r) {
+		if ((*r)->name.empty())
 			continue;
 
-		Common::UString oldName = TypeMan.setFileType(r->name, r->type).toLower();
+		Common::UString oldName = TypeMan.setFileType((*r)->name, (*r)->type).toLower();
 		if (oldName != newName) {
 			warning("ResourceManager: Found hash collision: %s (\"%s\" and \"%s\")",
 					Common::formatHash(getHash(oldName)).c_str(), oldName.c_str(), newName.c_str());
@@ -953,36 +1781,50 @@ bool ResourceManager::checkResourceIsArchive(Resource &resource, Change *change)
 }
 
 void ResourceManager::addResource(Resource &resource, uint64_t hash, Change *change) {
-	ResourceMap::iterator resList = _resources.find(hash);
-	if (resList == _resources.end()) {
-		// We don't have a resource with this name yet, create a new resource list for it
-
-		std::pair<ResourceMap::iterator, bool> result;
-
-		result = _resources.insert(std::make_pair(hash, ResourceList()));
-
-		resList = result.first;
-	}
+	// Creates a new resource list if we don't have a resource with this name yet
+	ResourceList &resList = _resources[hash];
 
 #ifdef CHECK_HASH_COLLISION
 	checkHashCollision(resource, resList);
 #endif
 
-	// Add the resource to the list
-	resList->second.push_back(resource);
-	Resource *res = &resList->second.back();
+	Resource *res = allocResource(resource);
 
 	checkResourceIsArchive(*res, change);
 
 	// Remember the resource in the change set
 	if (change) {
 		change->_change->resources.push_back(ResourceChange());
-		change->_change->resources.back().hashIt = resList;
-		change->_change->resources.back().resIt  = --resList->second.end();
+		change->_change->resources.back().hash = hash;
+		change->_change->resources.back().res  = res;
+	}
+
+	// Insert the resource sorted by priority, after all resources of the same priority
+	ResourceList::iterator pos = std::upper_bound(resList.begin(), resList.end(), res,
+			[](const Resource *a, const Resource *b) { return *a < *b; });
+
+	resList.insert(pos, res);
+
+	_generation++;
+}
+
+ResourceManager::Resource *ResourceManager::allocResource(const Resource &resource) {
+	if (!_freeResources.empty()) {
+		Resource *res = _freeResources.back();
+		_freeResources.pop_back();
+
+		*res = resource;
+		return res;
 	}
 
-	// Resort the list by priority
-	resList->second.sort();
+	_resourcePool.push_back(resource);
+	return &_resourcePool.back();
+}
+
+void ResourceManager::freeResource(Resource *resource) {
+	*resource = Resource();
+
+	_freeResources.push_back(resource);
 }
 
 void ResourceManager::addResource(const Common::UString &path, Change *change, uint32_t priority) {
@@ -1016,11 +1858,11 @@ void ResourceManager::addResources(const Common::FileList &files, Change *change
 }
 
 const ResourceManager::Resource *ResourceManager::getRes(uint64_t hash) const {
-	ResourceMap::const_iterator r = _resources.find(hash);
-	if ((r == _resources.end()) || r->second.empty() || (r->second.back().priority == 0))
+	const ResourceList *r = _resources.find(hash);
+	if (!r || r->empty() || (r->back()->priority == 0))
 		return 0;
 
-	return &r->second.back();
+	return r->back();
 }
 
 const ResourceManager::Resource *ResourceManager::getRes(const Common::UString &name,
@@ -1060,15 +1902,22 @@ void ResourceManager::dumpResourcesList(const Common::UString &fileName) const {
 	file.writeString("                Name                 |        Hash        |     Size    \n");
 	file.writeString("-------------------------------------|--------------------|-------------\n");
 
-	for (ResourceMap::const_iterator r = _resources.begin(); r != _resources.end(); ++r) {
-		if (r->second.empty())
-			continue;
+	// Sort by hash, to keep the list stable
+	std::vector<uint64_t> hashes;
+	hashes.reserve(_resources.size());
+
+	for (ResourceMap::const_iterator r = _resources.begin(); r != _resources.end(); ++r)
+		if (!r->value.empty())
+			hashes.push_back(r->key);
+
+	std::sort(hashes.begin(), hashes.end());
 
-		const Resource &res = r->second.back();
+	for (std::vector<uint64_t>::const_iterator h = hashes.begin(); h != hashes.end(); ++h) {
+		const Resource &res = *_resources.find(*h)->back();
 
 		const Common::UString &name = res.name;
 		const Common::UString   ext = TypeMan.setFileType("", res.type);
-		const uint64_t         hash = r->first;
+		const uint64_t         hash = *h;
 		const uint32_t         size = getResourceSize(res);
 
 		const Common::UString line =
@@ -27,8 +27,11 @@
 
 #include <list>
 #include <vector>
+#include <deque>
 #include <map>
 #include <set>
+#include <memory>
+#include <atomic>
 
 #include "src/common/types.h"
 #include "src/common/ustring.h"
@@ -36,8 +39,16 @@
 #include "src/common/filelist.h"
 #include "src/common/hash.h"
 #include "src/common/changeid.h"
+#include "src/common/flathashmap.h"
+#include "src/common/mutex.h"
+#include "src/common/memoryusage.h"
 
 #include "src/aurora/types.h"
+#include "src/aurora/archive.h"
+#include "src/aurora/resindexcache.h"
+#include "src/aurora/resourcecache.h"
+#include "src/aurora/resourceprefetcher.h"
+#include "src/aurora/resourcetrace.h"
 
 namespace Common {
 	class SeekableReadStream;
@@ -45,7 +56,6 @@ namespace Common {
 
 namespace Aurora {
 
-class Archive;
 class KEYFile;
 class KEYDataFile;
 
@@ -87,6 +97,134 @@ public:
 	void addTypeAlias(FileType alias, FileType realType);
 	// '---
 
+	// .--- Index cache
+	/** Use a persistent cache of archive indices.
+	 *
+	 *  Archives found in the cache that haven't changed since they were
+	 *  last indexed are neither opened nor parsed while indexing. Instead,
+	 *  their resources are declared directly from the cache, and the
+	 *  archives themselves are only opened once a resource is requested.
+	 *
+	 *  @param file The file to read the cache from and later save it to.
+	 *              If empty, the cache is disabled.
+	 */
+	void setIndexCache(const Common::UString &file);
+
+	/** Write the index cache back to its file, if anything changed. */
+	void saveIndexCache();
+	// '---
+
+	// .--- Memory mapping
+	/** Memory-map BIF, ERF, RIM and Nintendo DS ROM files found on disk when opening them.
+	 *
+	 *  Uncompressed resources within memory-mapped archives are returned
+	 *  as views straight into the mapping, without copying their data.
+	 *  Only archives opened after this call are affected.
+	 */
+	void setMapArchives(bool mapArchives);
+	// '---
+
+	// .--- Resource cache
+	/** Set the maximum size of the cache of decompressed resources, in bytes.
+	 *
+	 *  Resources that need to be decompressed or decrypted when they're
+	 *  read out of their archive are kept in this cache, so that repeated
+	 *  requests for them don't have to decompress them again.
+	 *
+	 *  A size of 0 disables the cache.
+	 */
+	void setResourceCacheSize(size_t size);
+
+	/** Print the resource cache statistics to the GResources debug channel. */
+	void dumpResourceCacheStatistics() const;
+	/** Return the resource cache statistics. Sizes are in bytes. */
+	void getResourceCacheStatistics(uint64_t &hits, uint64_t &misses, size_t &size, size_t &maxSize) const;
+
+	/** Collect how much memory each cached resource and the index of all known resources take up. */
+	void getMemoryUsage(Common::MemoryUsageList &usage) const;
+	// '---
+
+	// .--- Prefetching
+	/** Set the number of threads loading prefetched resources. 0 disables prefetching. */
+	void setPrefetchThreads(size_t count);
+
+	/** Start loading a resource in the background.
+	 *
+	 *  A later getResource() call for the same resource then returns the
+	 *  prefetched stream, waiting for it to finish loading if necessary.
+	 *
+	 *  All prefetches are cancelled when resources are removed.
+	 */
+	void prefetch(const Common::UString &name, FileType type);
+
+	/** Start loading a resource in the background, searching for several types. */
+	void prefetch(const Common::UString &name, const std::vector<FileType> &types);
+
+	/** Load a resource in the background, returning a future of its stream.
+	 *
+	 *  If the resource doesn't exist, the future holds 0.
+	 */
+	std::future<Common::SeekableReadStream *> getResourceAsync(const Common::UString &name, FileType type);
+
+	/** Cancel all prefetches that weren't claimed yet. */
+	void cancelPrefetches();
+	// '---
+
+	// .--- Resource traces
+	/** Record the resources requested while loading, and prefetch them on later loads.
+	 *
+	 *  @param directory The directory to save the traces in. If empty, traces are disabled.
+	 */
+	void setResourceTraceDirectory(const Common::UString &directory);
+
+	/** Start tracing the resources requested from now on.
+	 *
+	 *  If a trace of an earlier load with the same name exists, all the
+	 *  resources it lists are prefetched, in the order they were requested
+	 *  back then. This also opens the archives they're in, which haven't
+	 *  been opened yet if they were indexed from the index cache.
+	 *
+	 *  @param name A name identifying what's being loaded, unique within the game.
+	 */
+	void beginResourceTrace(const Common::UString &name);
+
+	/** Stop tracing and save the trace.
+	 *
+	 *  Which archives the resources came from, and how much time was spent
+	 *  reading from each of them, is printed to the GResources debug channel.
+	 */
+	void endResourceTrace();
+	// '---
+
+	// .--- Prebaked archive
+	/** Write the resources currently found within archives into one uncompressed ERF.
+	 *
+	 *  Only the resource that wins out for each name is written, already
+	 *  decompressed. Resources that are direct files, that are archives
+	 *  themselves or whose names don't fit into an ERF V1.0 are left out.
+	 *
+	 *  The ERF also holds a fingerprint of the written resources and of
+	 *  the archive files they came from.
+	 */
+	void writePrebakedArchive(const Common::UString &file) const;
+
+	/** Read the resources held by an archive written by writePrebakedArchive() from it.
+	 *
+	 *  The archive is only used if the currently indexed resources still
+	 *  have the same fingerprint, meaning the same resources were indexed
+	 *  from the same, unchanged archive files as when it was written.
+	 *
+	 *  The known resources are then pointed at the archive in place, so
+	 *  that no new entries are added to the resource index. They keep
+	 *  their priorities, and everything indexed afterwards overrides them
+	 *  just the same. The archive stays until the resources are cleared.
+	 *
+	 *  @param  file The prebaked archive file.
+	 *  @return true if the archive was indexed, false if it doesn't exist or is outdated.
+	 */
+	bool indexPrebakedArchive(const Common::UString &file);
+	// '---
+
 	// .--- Data base
 	/** Register a path to be the data base.
 	 *
@@ -139,6 +277,44 @@ public:
 	 */
 	void indexArchive(const Common::UString &file, uint32_t priority, const std::vector<byte> &password,
 	                  Common::ChangeID *changeID = 0);
+
+	/** An archive file to index as part of a batch. */
+	struct BatchArchive {
+		Common::UString file;       ///< The name of the archive file to index.
+		uint32_t priority;          ///< The priority of the archive's resources.
+		std::vector<byte> password; ///< The password to decrypt the archive with, if necessary.
+		Common::ChangeID *changeID; ///< If given, record the changes done for this archive.
+
+		BatchArchive(const Common::UString &f, uint32_t p, Common::ChangeID *c = 0);
+		BatchArchive(const Common::UString &f, uint32_t p, const std::vector<byte> &pw, Common::ChangeID *c = 0);
+	};
+
+	/** Add all the resources of several archives to the resource manager.
+	 *
+	 *  This has the same effect as calling indexArchive() on each archive
+	 *  in order, but the archive files are opened and parsed in parallel.
+	 *  Only adding their resources happens one archive after the other.
+	 *
+	 *  Archives within other archives, and archives that are only found
+	 *  after indexing an earlier archive in the batch, are not parsed in
+	 *  parallel, but they still work.
+	 */
+	void indexArchives(const std::vector<BatchArchive> &archives);
+
+	/** Start reading an archive file into the operating system's file cache.
+	 *
+	 *  The reading happens in the background, so indexing the archive and
+	 *  reading its resources later on doesn't have to wait for the disk.
+	 *  Only archives that are files of their own on disk can be warmed.
+	 *
+	 *  @param  file The name of the archive file.
+	 *  @param  budget Only warm the archive if its file isn't bigger than this.
+	 *  @return The size of the archive file, or 0 if it wasn't warmed.
+	 */
+	size_t warmArchive(const Common::UString &file, size_t budget);
+
+	/** Tell the operating system that an archive file warmed before isn't needed after all. */
+	void coolArchive(const Common::UString &file);
 	// '---
 
 	// .--- Directories and files
@@ -208,6 +384,14 @@ public:
 	// '---
 
 	// .--- Resources
+	/** Return the current generation of the resource index.
+	 *
+	 *  The generation changes whenever resources are added, removed or
+	 *  otherwise changed, so that data derived from a resource can be
+	 *  cached until the resource might have been replaced.
+	 */
+	uint32_t getGeneration() const;
+
 	/** Does a specific resource exist?
 	 *
 	 *  @param  hash The hash of the name and extension of the resource.
@@ -366,7 +550,11 @@ private:
 	};
 
 	struct OpenedArchive {
-		/** The actual archive. */
+		/** The actual archive.
+		 *
+		 *  For archives indexed from the index cache, this is 0 until
+		 *  the archive is needed for the first time.
+		 */
 		Archive *archive;
 
 		/** The information we know about this archive. */
@@ -377,9 +565,12 @@ private:
 		/** If this archive contains other archives, these are the opened "children" archives. */
 		std::list<OpenedArchive *> children;
 
+		/** Mutex protecting reading resources out of the archive. */
+		std::mutex mutex;
+
 		OpenedArchive();
 
-		void set(KnownArchive &kA, Archive &a);
+		void set(KnownArchive &kA, Archive *a);
 	};
 
 	/** List of all known archive files. */
@@ -425,10 +616,18 @@ private:
 		bool operator<(const Resource &right) const;
 	};
 
-	/** List of resources, sorted by priority. */
-	typedef std::list<Resource> ResourceList;
+	/** Storage for all resource records, keeping their addresses stable. */
+	typedef std::deque<Resource> ResourcePool;
+	/** List of resources of the same name, sorted by priority. */
+	typedef std::vector<Resource *> ResourceList;
+
+	/** Identity hash for names that are already hashed. */
+	struct NameHash {
+		size_t operator()(uint64_t hash) const { return static_cast<size_t>(hash); }
+	};
+
 	/** Map over resources, indexed by their hashed name. */
-	typedef std::map<uint64_t, ResourceList> ResourceMap;
+	typedef Common::FlatHashMap<uint64_t, ResourceList, NameHash> ResourceMap;
 	// '---
 
 	// .--- Changes
@@ -438,8 +637,8 @@ private:
 	typedef OpenedArchives::iterator OpenedArchiveChange;
 	/** A change produced by indexing archive resources. */
 	struct ResourceChange {
-		ResourceMap::iterator  hashIt;
-		ResourceList::iterator resIt;
+		uint64_t  hash;
+		Resource *res;
 	};
 
 	typedef std::list<KnownArchiveChange>  KnownArchiveChanges;
@@ -491,9 +690,36 @@ private:
 	/** The current type aliases, changing one type to another. */
 	std::map<FileType, FileType> _typeAliases;
 
+	ResourcePool  _resourcePool;  ///< Storage for all resources, known and freed.
+	ResourceList  _freeResources; ///< Resources in the pool that are free for reuse.
+
 	ResourceMap   _resources; ///< All currently known resources.
 	ChangeSetList _changes;   ///< Changes produced by indexing the currently known resources.
 
+	std::atomic<uint32_t> _generation; ///< Changes whenever the known resources change. Read from any thread.
+
+	Common::UString _indexCacheFile; ///< The file the index cache is saved to.
+	std::unique_ptr<ResourceIndexCache> _indexCache; ///< Cache of archive indices.
+
+	bool _mapArchives; ///< Memory-map archive files?
+
+	/** Cache of decompressed resources. */
+	mutable ResourceCache _resourceCache;
+
+	/** Workers loading prefetched resources. */
+	mutable ResourcePrefetcher _prefetcher;
+
+	Common::UString _traceDirectory; ///< The directory resource traces are saved in.
+	Common::UString _traceFile;      ///< The file the current trace will be saved to.
+
+	/** The resources requested since the current trace began. */
+	mutable ResourceTrace _trace;
+	/** Are we recording a trace right now? */
+	std::atomic<bool> _tracing;
+
+	/** Mutex protecting the lazy opening of archives. */
+	mutable std::mutex _archiveMutex;
+
 	FileTypeSet  _archiveTypeTypes [kArchiveMAX];  ///< All valid archive types file types.
 	FileTypeList _resourceTypeTypes[kResourceMAX]; ///< All valid resource type file types.
 
@@ -506,14 +732,52 @@ private:
 	// '---
 
 	// .--- Indexing archives
-	void indexKEY(Common::SeekableReadStream *stream, uint32_t priority, Change *change);
+	void indexKEY(KnownArchive &knownArchive, Common::SeekableReadStream *stream,
+	              uint32_t priority, Change *change);
 	uint32_t openKEYBIFs(Common::SeekableReadStream *keyStream,
 	                   std::vector<KnownArchive *> &archives, std::vector<KEYDataFile *> &keyData);
 
 	void indexArchive(KnownArchive &knownArchive, Archive *archive,
 	                  uint32_t priority, Change *change);
+	void indexArchive(OpenedArchive &archive, const Archive::ResourceList &resources,
+	                  Common::HashAlgo hashAlgo, uint32_t priority, Change *change);
+
+	OpenedArchive &addOpenedArchive(KnownArchive &knownArchive, Archive *archive, Change *change);
 
 	Common::SeekableReadStream *openArchiveStream(const KnownArchive &archive) const;
+
+	KEYDataFile *openKEYDataFile(const KnownArchive &knownArchive) const;
+	Archive *openArchive(const KnownArchive &knownArchive, const std::vector<byte> &password) const;
+
+	/** Return the archive, opening it first if necessary. */
+	Archive &getArchive(OpenedArchive &archive) const;
+	// '---
+
+	// .--- Batch indexing
+	struct ParsedArchive;
+
+	/** Can this archive be parsed separately from indexing it? */
+	bool canParseArchive(KnownArchive *knownArchive, const std::vector<byte> &password);
+	/** Open and parse an archive, without indexing it.
+	 *
+	 *  This only reads the list of known archives, so several archives
+	 *  can be parsed concurrently, as long as nothing is indexed meanwhile.
+	 */
+	void parseArchive(ParsedArchive &parsed);
+	/** Index an archive that has been parsed before. */
+	void indexParsedArchive(ParsedArchive &parsed);
+	// '---
+
+	// .--- Index cache
+	bool getCachePath(const KnownArchive &knownArchive, Common::UString &path) const;
+
+	bool indexCachedArchive(KnownArchive &knownArchive, uint32_t priority, Change *change);
+	const ResourceIndexCache::Entry *findCachedArchive(KnownArchive &knownArchive,
+	                                                   std::vector<KnownArchive *> &dataFiles);
+
+	void cacheArchive(const KnownArchive &knownArchive, const Archive &archive);
+	void cacheKEY(const KnownArchive &knownArchive, const std::vector<KnownArchive *> &archives,
+	              const std::vector<KEYDataFile *> &keyData);
 	// '---
 
 	// .--- Adding resources
@@ -524,6 +788,9 @@ private:
 	void addResource(const Common::UString &path, Change *change, uint32_t priority);
 
 	void addResources(const Common::FileList &files, Change *change, uint32_t priority);
+
+	Resource *allocResource(const Resource &resource);
+	void freeResource(Resource *resource);
 	// '---
 
 	// .--- Finding and getting resources
@@ -532,12 +799,27 @@ private:
 	const Resource *getRes(const Common::UString &name, FileType type) const;
 
 	Common::SeekableReadStream *getResource(const Resource &res, bool tryNoCopy = false) const;
+	/** Read the resource, bypassing the prefetcher. */
+	Common::SeekableReadStream *readResource(const Resource &res, bool tryNoCopy = false) const;
 
 	Common::SeekableReadStream *getArchiveResource(const Resource &res, bool tryNoCopy = false) const;
 
+	/** Record a resource request into the current trace. */
+	void traceResource(const Resource &res, const Common::SeekableReadStream *stream, uint64_t time) const;
+
 	uint32_t getResourceSize(const Resource &res) const;
 	// '---
 
+	// .--- Prebaked archive
+	/** The resources that go into a prebaked archive, with their hashes. */
+	typedef std::vector<std::pair<uint64_t, Resource *>> PrebakeList;
+
+	/** Collect the resources that go into a prebaked archive, sorted by hash. */
+	void getPrebakeResources(PrebakeList &resources) const;
+	/** Fingerprint the resources of a prebaked archive and the archive files they're in. */
+	uint64_t getPrebakeFingerprint(const PrebakeList &resources) const;
+	// '---
+
 	// .--- Resource utility methods
 	bool normalizeType(Resource &resource);
 
@@ -548,7 +830,7 @@ private:
 	inline uint64_t getHash(const Common::UString &name, FileType type) const;
 	inline uint64_t getHash(const Common::UString &name) const;
 
-	void checkHashCollision(const Resource &resource, ResourceMap::const_iterator resList);
+	void checkHashCollision(const Resource &resource, const ResourceList &resList);
 
 	Change *newChangeSet(Common::ChangeID &changeID);
 	// '---
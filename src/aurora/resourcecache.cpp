@@ -0,0 +1,203 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A size-bounded LRU cache of decompressed resources.
+ */
+
+#include <memory>
+
+#include "src/common/error.h"
+#include "src/common/readstream.h"
+#include "src/common/memreadstream.h"
+#include "src/common/debugman.h"
+
+#include "src/aurora/resourcecache.h"
+
+namespace Aurora {
+
+/** A read stream over data shared with the resource cache. */
+class SharedResourceStream : public Common::MemoryReadStream {
+public:
+	SharedResourceStream(const std::shared_ptr<const byte> &data, size_t size) :
+		Common::MemoryReadStream(data.get(), size), _data(data) {
+
+	}
+
+	~SharedResourceStream() {
+	}
+
+private:
+	std::shared_ptr<const byte> _data;
+};
+
+
+ResourceCache::ResourceCache(size_t maxSize) : _size(0), _maxSize(maxSize), _hits(0), _misses(0) {
+}
+
+ResourceCache::~ResourceCache() {
+}
+
+void ResourceCache::clear() {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_entries.clear();
+	_entryMap.clear();
+
+	_size = 0;
+	Common::DebugManager::setMetric(Common::kMetricResourceCacheSize, _size);
+}
+
+void ResourceCache::setMaxSize(size_t maxSize) {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_maxSize = maxSize;
+
+	evict(_maxSize);
+}
+
+size_t ResourceCache::getMaxSize() const {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return _maxSize;
+}
+
+size_t ResourceCache::getSize() const {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return _size;
+}
+
+uint64_t ResourceCache::getHits() const {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return _hits;
+}
+
+uint64_t ResourceCache::getMisses() const {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return _misses;
+}
+
+size_t ResourceCache::getSize(const Archive &archive, uint32_t index) const {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	const EntryList::iterator *entry = _entryMap.find(Key(&archive, index));
+	if (!entry)
+		return 0;
+
+	return (*entry)->size;
+}
+
+Common::SeekableReadStream *ResourceCache::get(const Archive &archive, uint32_t index) {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	EntryList::iterator *entry = _entryMap.find(Key(&archive, index));
+	if (!entry) {
+		_misses++;
+		return 0;
+	}
+
+	_hits++;
+
+	// Move the resource to the front of the list
+	_entries.splice(_entries.begin(), _entries, *entry);
+
+	return createStream(**entry);
+}
+
+Common::SeekableReadStream *ResourceCache::add(const Archive &archive, uint32_t index,
+                                               Common::SeekableReadStream *stream) {
+
+	std::unique_ptr<Common::SeekableReadStream> resStream(stream);
+
+	Entry entry;
+
+	entry.key  = Key(&archive, index);
+	entry.size = resStream->size();
+
+	byte *data = new byte[entry.size];
+	entry.data.reset(data, std::default_delete<byte[]>());
+
+	resStream->seek(0);
+	if (resStream->read(data, entry.size) != entry.size)
+		throw Common::Exception(Common::kReadError);
+
+	resStream.reset();
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (entry.size > _maxSize)
+		return createStream(entry);
+
+	EntryList::iterator *old = _entryMap.find(entry.key);
+	if (old) {
+		_size -= (*old)->size;
+		_entries.erase(*old);
+	}
+
+	evict(_maxSize - entry.size);
+
+	_entries.push_front(entry);
+	_entryMap[entry.key] = _entries.begin();
+
+	_size += entry.size;
+	Common::DebugManager::setMetric(Common::kMetricResourceCacheSize, _size);
+
+	return createStream(entry);
+}
+
+void ResourceCache::removeArchive(const Archive &archive) {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (EntryList::iterator e = _entries.begin(); e != _entries.end(); ) {
+		if (e->key.archive != &archive) {
+			++e;
+			continue;
+		}
+
+		_size -= e->size;
+		_entryMap.erase(e->key);
+
+		e = _entries.erase(e);
+	}
+
+	Common::DebugManager::setMetric(Common::kMetricResourceCacheSize, _size);
+}
+
+void ResourceCache::evict(size_t maxSize) {
+	while (!_entries.empty() && (_size > maxSize)) {
+		const Entry &entry = _entries.back();
+
+		_size -= entry.size;
+		_entryMap.erase(entry.key);
+
+		_entries.pop_back();
+	}
+
+	Common::DebugManager::setMetric(Common::kMetricResourceCacheSize, _size);
+}
+
+Common::SeekableReadStream *ResourceCache::createStream(const Entry &entry) {
+	return new SharedResourceStream(entry.data, entry.size);
+}
+
+} // End of namespace Aurora
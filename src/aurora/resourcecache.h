@@ -0,0 +1,138 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A size-bounded LRU cache of decompressed resources.
+ */
+
+#ifndef AURORA_RESOURCECACHE_H
+#define AURORA_RESOURCECACHE_H
+
+#include <cstddef>
+
+#include <list>
+#include <memory>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/mutex.h"
+#include "src/common/flathashmap.h"
+
+namespace Common {
+	class SeekableReadStream;
+}
+
+namespace Aurora {
+
+class Archive;
+
+/** A size-bounded, least-recently-used cache of decompressed archive resources.
+ *
+ *  The cached data is shared between all streams handed out for it, so
+ *  evicting a resource from the cache is safe even while streams of it
+ *  are still in use.
+ *
+ *  All methods are thread-safe.
+ */
+class ResourceCache : boost::noncopyable {
+public:
+	ResourceCache(size_t maxSize = 0);
+	~ResourceCache();
+
+	/** Remove all resources from the cache. */
+	void clear();
+
+	/** Set the maximum number of bytes the cache may hold. 0 disables the cache. */
+	void setMaxSize(size_t maxSize);
+
+	size_t getMaxSize() const;
+	/** Return the number of bytes currently in the cache. */
+	size_t getSize() const;
+
+	uint64_t getHits() const;
+	uint64_t getMisses() const;
+
+	/** Return the number of bytes a resource takes up in the cache, or 0 if it is not cached. */
+	size_t getSize(const Archive &archive, uint32_t index) const;
+
+	/** Return a new stream of a cached resource, or 0 if the resource is not cached. */
+	Common::SeekableReadStream *get(const Archive &archive, uint32_t index);
+
+	/** Add a resource to the cache.
+	 *
+	 *  The stream is read completely and then deleted. If the resource
+	 *  is too big for the cache, it is not cached.
+	 *
+	 *  @return A new stream of the resource.
+	 */
+	Common::SeekableReadStream *add(const Archive &archive, uint32_t index, Common::SeekableReadStream *stream);
+
+	/** Remove all resources of this archive from the cache. */
+	void removeArchive(const Archive &archive);
+
+private:
+	struct Key {
+		const Archive *archive;
+		uint32_t index;
+
+		Key(const Archive *a = 0, uint32_t i = 0) : archive(a), index(i) { }
+
+		bool operator==(const Key &right) const {
+			return (archive == right.archive) && (index == right.index);
+		}
+	};
+
+	struct KeyHash {
+		size_t operator()(const Key &key) const {
+			return reinterpret_cast<uintptr_t>(key.archive) ^ (static_cast<size_t>(key.index) << 1);
+		}
+	};
+
+	struct Entry {
+		Key key;
+
+		std::shared_ptr<const byte> data;
+		size_t size;
+	};
+
+	/** All cached resources, most recently used first. */
+	typedef std::list<Entry> EntryList;
+	typedef Common::FlatHashMap<Key, EntryList::iterator, KeyHash> EntryMap;
+
+	EntryList _entries;
+	EntryMap  _entryMap;
+
+	size_t _size;
+	size_t _maxSize;
+
+	uint64_t _hits;
+	uint64_t _misses;
+
+	mutable std::mutex _mutex;
+
+	void evict(size_t maxSize);
+
+	static Common::SeekableReadStream *createStream(const Entry &entry);
+};
+
+} // End of namespace Aurora
+
+#endif // AURORA_RESOURCECACHE_H
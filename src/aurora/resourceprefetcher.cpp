@@ -0,0 +1,261 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Loading resources in the background.
+ */
+
+#include <chrono>
+#include <algorithm>
+
+#include "src/common/error.h"
+#include "src/common/strutil.h"
+#include "src/common/readstream.h"
+
+#include "src/aurora/resourceprefetcher.h"
+
+namespace Aurora {
+
+ResourcePrefetcher::Worker::Worker(ResourcePrefetcher &prefetcher) : _prefetcher(&prefetcher) {
+}
+
+ResourcePrefetcher::Worker::~Worker() {
+	destroyThread();
+}
+
+void ResourcePrefetcher::Worker::threadMethod() {
+	while (!_killThread.load(std::memory_order_relaxed))
+		if (!_prefetcher->workOnce())
+			break;
+}
+
+
+ResourcePrefetcher::Job::Job(const void *k, const Loader &l) : key(k), loader(l),
+	state(kJobQueued), future(promise.get_future()), taken(false) {
+
+}
+
+
+ResourcePrefetcher::ResourcePrefetcher() : _running(0), _stop(false) {
+}
+
+ResourcePrefetcher::~ResourcePrefetcher() {
+	stop();
+}
+
+void ResourcePrefetcher::start(size_t threadCount) {
+	stop();
+
+	for (size_t i = 0; i < threadCount; i++) {
+		_workers.push_back(std::make_unique<Worker>(*this));
+
+		if (!_workers.back()->createThread("ResPrefetch" + Common::composeString(i)))
+			throw Common::Exception("Failed to create resource prefetching thread");
+	}
+}
+
+void ResourcePrefetcher::stop() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stop = true;
+	}
+
+	_queueCondition.notify_all();
+	_workers.clear();
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stop = false;
+	}
+
+	cancel();
+}
+
+size_t ResourcePrefetcher::getThreadCount() const {
+	return _workers.size();
+}
+
+void ResourcePrefetcher::add(const void *key, const Loader &loader) {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		// Without workers, there's no background to load in
+		if (_workers.empty() || (_jobs.find(key) != _jobs.end()))
+			return;
+
+		std::shared_ptr<Job> job = std::make_shared<Job>(key, loader);
+
+		_jobs.insert(std::make_pair(key, job));
+		_queue.push_back(job);
+	}
+
+	_queueCondition.notify_one();
+}
+
+bool ResourcePrefetcher::take(const void *key, Common::SeekableReadStream *&stream) {
+	std::shared_ptr<Job> job;
+	bool runHere = false;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		JobMap::iterator j = _jobs.find(key);
+		if (j == _jobs.end())
+			return false;
+
+		job = j->second;
+		_jobs.erase(j);
+
+		job->taken = true;
+
+		// Nobody started on this job yet, so we just do it ourselves
+		if (job->state == kJobQueued) {
+			_queue.erase(std::find(_queue.begin(), _queue.end(), job));
+
+			job->state = kJobRunning;
+			_running++;
+
+			runHere = true;
+		}
+	}
+
+	if (runHere)
+		finish(*job);
+
+	stream = job->future.get();
+	return true;
+}
+
+std::future<Common::SeekableReadStream *> ResourcePrefetcher::takeFuture(const void *key, const Loader &loader) {
+	std::shared_ptr<Job> job;
+	bool runHere = false;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		JobMap::iterator j = _jobs.find(key);
+		if (j != _jobs.end()) {
+			job = j->second;
+			_jobs.erase(j);
+		} else {
+			job = std::make_shared<Job>(key, loader);
+
+			if (_workers.empty()) {
+				job->state = kJobRunning;
+				_running++;
+
+				runHere = true;
+			} else
+				_queue.push_back(job);
+		}
+
+		job->taken = true;
+	}
+
+	if (runHere)
+		finish(*job);
+	else
+		_queueCondition.notify_one();
+
+	return std::move(job->future);
+}
+
+void ResourcePrefetcher::cancel() {
+	JobMap jobs;
+	JobQueue queue;
+
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		jobs.swap(_jobs);
+		queue.swap(_queue);
+
+		// Wait for all running jobs to finish
+		while (_running > 0)
+			_jobCondition.wait(lock);
+	}
+
+	// Jobs that were never started won't be, so break the promises of those we handed out
+	for (JobQueue::iterator q = queue.begin(); q != queue.end(); ++q) {
+		if (!(*q)->taken)
+			continue;
+
+		try {
+			throw Common::Exception("Prefetching the resource was cancelled");
+		} catch (...) {
+			(*q)->promise.set_exception(std::current_exception());
+		}
+	}
+
+	// Delete all results nobody has claimed
+	for (JobMap::iterator j = jobs.begin(); j != jobs.end(); ++j) {
+		if (j->second->state != kJobFinished)
+			continue;
+
+		try {
+			delete j->second->future.get();
+		} catch (...) {
+		}
+	}
+}
+
+bool ResourcePrefetcher::workOnce() {
+	std::shared_ptr<Job> job;
+
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		if (_queue.empty() && !_stop)
+			_queueCondition.wait_for(lock, std::chrono::milliseconds(100));
+
+		if (_stop)
+			return false;
+		if (_queue.empty())
+			return true;
+
+		job = _queue.front();
+		_queue.pop_front();
+
+		job->state = kJobRunning;
+		_running++;
+	}
+
+	finish(*job);
+	return true;
+}
+
+void ResourcePrefetcher::finish(Job &job) {
+	try {
+		job.promise.set_value(job.loader());
+	} catch (...) {
+		job.promise.set_exception(std::current_exception());
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		job.state = kJobFinished;
+		_running--;
+	}
+
+	_jobCondition.notify_all();
+}
+
+} // End of namespace Aurora
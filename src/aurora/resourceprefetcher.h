@@ -0,0 +1,157 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Loading resources in the background.
+ */
+
+#ifndef AURORA_RESOURCEPREFETCHER_H
+#define AURORA_RESOURCEPREFETCHER_H
+
+#include <cstddef>
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
+#include <functional>
+#include <future>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/mutex.h"
+#include "src/common/thread.h"
+
+namespace Common {
+	class SeekableReadStream;
+}
+
+namespace Aurora {
+
+/** A pool of worker threads loading resources in the background.
+ *
+ *  Each prefetch job is identified by an opaque key. Once a job is
+ *  queued, its result can be taken out of the prefetcher by that key,
+ *  either blocking or as a future. Taking a job that hasn't started
+ *  yet runs it right there on the calling thread, instead of waiting
+ *  for a worker to pick it up.
+ *
+ *  All methods except start() and stop() are thread-safe.
+ */
+class ResourcePrefetcher : boost::noncopyable {
+public:
+	typedef std::function<Common::SeekableReadStream *()> Loader;
+
+	ResourcePrefetcher();
+	~ResourcePrefetcher();
+
+	/** Start this many worker threads, stopping the current ones first. */
+	void start(size_t threadCount);
+	/** Stop all worker threads, and cancel all jobs. */
+	void stop();
+
+	/** Return the number of worker threads. */
+	size_t getThreadCount() const;
+
+	/** Queue a job, unless one with the same key is already queued or finished. */
+	void add(const void *key, const Loader &loader);
+
+	/** Take the result of a job out of the prefetcher.
+	 *
+	 *  If the job hasn't finished yet, wait for it. If the job threw, rethrow.
+	 *
+	 *  @param  key The key of the job.
+	 *  @param  stream The stream the job produced (can be 0). Ownership is transferred.
+	 *  @return true if such a job existed, false otherwise.
+	 */
+	bool take(const void *key, Common::SeekableReadStream *&stream);
+
+	/** Take the result of a job out of the prefetcher, as a future.
+	 *
+	 *  If no such job exists, one is queued first.
+	 */
+	std::future<Common::SeekableReadStream *> takeFuture(const void *key, const Loader &loader);
+
+	/** Cancel all jobs.
+	 *
+	 *  Queued jobs are dropped, running jobs are waited for, and all
+	 *  unclaimed results are deleted. Futures handed out before stay valid.
+	 */
+	void cancel();
+
+private:
+	class Worker : public Common::Thread {
+	public:
+		Worker(ResourcePrefetcher &prefetcher);
+		~Worker();
+
+	private:
+		ResourcePrefetcher *_prefetcher;
+
+		void threadMethod();
+	};
+
+	enum JobState {
+		kJobQueued,
+		kJobRunning,
+		kJobFinished
+	};
+
+	struct Job {
+		const void *key;
+		Loader loader;
+
+		JobState state;
+
+		/** The job's result, until somebody takes it. */
+		std::promise<Common::SeekableReadStream *> promise;
+		std::future<Common::SeekableReadStream *> future;
+
+		/** Has the future been handed out? */
+		bool taken;
+
+		Job(const void *k, const Loader &l);
+	};
+
+	typedef std::map<const void *, std::shared_ptr<Job> > JobMap;
+	typedef std::deque<std::shared_ptr<Job> > JobQueue;
+
+	JobMap   _jobs;
+	JobQueue _queue;
+
+	size_t _running; ///< Number of jobs currently running.
+	bool   _stop;    ///< Should the workers stop?
+
+	std::vector<std::unique_ptr<Worker> > _workers;
+
+	mutable std::mutex _mutex;
+	std::condition_variable _queueCondition; ///< Signaled when a job was queued.
+	std::condition_variable _jobCondition;   ///< Signaled when a running job finished.
+
+	/** Wait a bit for a job to be queued, and run it. Return false if the workers should stop. */
+	bool workOnce();
+	/** Run a job that has already been marked as running. */
+	void finish(Job &job);
+};
+
+} // End of namespace Aurora
+
+#endif // AURORA_RESOURCEPREFETCHER_H
@@ -0,0 +1,185 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A trace of the resources requested while loading.
+ */
+
+#include <cstring>
+
+#include <algorithm>
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/readstream.h"
+#include "src/common/writestream.h"
+#include "src/common/encoding.h"
+
+#include "src/aurora/resourcetrace.h"
+
+static const uint32_t kTraceID      = MKTAG('X', 'R', 'T', 'R');
+static const uint32_t kTraceVersion = MKTAG('V', '1', '.', '0');
+
+namespace Aurora {
+
+static Common::UString readString(Common::SeekableReadStream &stream) {
+	const uint32_t length = stream.readUint32LE();
+	if (length > (stream.size() - stream.pos()))
+		throw Common::Exception("String too long (%u)", length);
+
+	return Common::readStringFixed(stream, Common::kEncodingUTF8, length);
+}
+
+static void writeString(Common::WriteStream &stream, const Common::UString &string) {
+	const uint32_t length = std::strlen(string.c_str());
+
+	stream.writeUint32LE(length);
+	stream.write(string.c_str(), length);
+}
+
+static bool compareTime(const ResourceTrace::ArchiveStatistics &a, const ResourceTrace::ArchiveStatistics &b) {
+	if (a.time != b.time)
+		return a.time > b.time;
+
+	return a.size > b.size;
+}
+
+
+ResourceTrace::Entry::Entry() : type(kFileTypeNone), size(0), time(0) {
+}
+
+
+ResourceTrace::ResourceTrace() {
+}
+
+ResourceTrace::~ResourceTrace() {
+}
+
+void ResourceTrace::clear() {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_entries.clear();
+	_known.clear();
+}
+
+void ResourceTrace::add(const Entry &entry) {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (!_known.insert(std::make_pair(entry.name, entry.type)).second)
+		return;
+
+	_entries.push_back(entry);
+}
+
+ResourceTrace::Entries ResourceTrace::getEntries() const {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return _entries;
+}
+
+ResourceTrace::Statistics ResourceTrace::getStatistics() const {
+	std::map<Common::UString, ArchiveStatistics> archives;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		for (Entries::const_iterator e = _entries.begin(); e != _entries.end(); ++e) {
+			ArchiveStatistics &archive = archives[e->archive];
+
+			archive.archive    = e->archive;
+			archive.resources += 1;
+			archive.size      += e->size;
+			archive.time      += e->time;
+		}
+	}
+
+	Statistics statistics;
+	statistics.reserve(archives.size());
+
+	for (std::map<Common::UString, ArchiveStatistics>::const_iterator a = archives.begin(); a != archives.end(); ++a)
+		statistics.push_back(a->second);
+
+	std::stable_sort(statistics.begin(), statistics.end(), compareTime);
+	return statistics;
+}
+
+bool ResourceTrace::read(Common::SeekableReadStream &stream) {
+	Entries entries;
+	std::set<std::pair<Common::UString, FileType> > known;
+
+	try {
+		if (stream.readUint32BE() != kTraceID)
+			throw Common::Exception("Not a resource trace");
+
+		if (stream.readUint32BE() != kTraceVersion)
+			throw Common::Exception("Unsupported resource trace version");
+
+		const uint32_t entryCount = stream.readUint32LE();
+		if (entryCount > (stream.size() - stream.pos()))
+			throw Common::Exception("Too many resources (%u)", entryCount);
+
+		entries.resize(entryCount);
+		for (uint32_t i = 0; i < entryCount; i++) {
+			Entry &entry = entries[i];
+
+			entry.name    = readString(stream);
+			entry.type    = (FileType) stream.readSint32LE();
+			entry.size    = stream.readUint32LE();
+			entry.time    = stream.readUint32LE();
+			entry.archive = readString(stream);
+
+			known.insert(std::make_pair(entry.name, entry.type));
+		}
+
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed to read the resource trace");
+
+		clear();
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_entries.swap(entries);
+	_known.swap(known);
+
+	return true;
+}
+
+void ResourceTrace::write(Common::WriteStream &stream) const {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	stream.writeUint32BE(kTraceID);
+	stream.writeUint32BE(kTraceVersion);
+
+	stream.writeUint32LE(_entries.size());
+
+	for (Entries::const_iterator e = _entries.begin(); e != _entries.end(); ++e) {
+		writeString(stream, e->name);
+
+		stream.writeSint32LE((int32_t) e->type);
+		stream.writeUint32LE(e->size);
+		stream.writeUint32LE(e->time);
+
+		writeString(stream, e->archive);
+	}
+}
+
+} // End of namespace Aurora
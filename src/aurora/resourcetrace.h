@@ -0,0 +1,122 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A trace of the resources requested while loading.
+ */
+
+#ifndef AURORA_RESOURCETRACE_H
+#define AURORA_RESOURCETRACE_H
+
+#include <vector>
+#include <set>
+#include <map>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+#include "src/common/mutex.h"
+
+#include "src/aurora/types.h"
+
+namespace Common {
+	class SeekableReadStream;
+	class WriteStream;
+}
+
+namespace Aurora {
+
+/** The ordered list of resources requested while loading something, like an area.
+ *
+ *  For every requested resource, the trace remembers its size, how long
+ *  it took to get it and the archive it came out of. Only the first
+ *  request of each resource is recorded, in the order they happened.
+ *
+ *  A trace saved during one load can be replayed by later loads of the
+ *  same thing, to prefetch all the resources it will need in the order
+ *  it will need them.
+ *
+ *  Recording is thread-safe.
+ */
+class ResourceTrace : boost::noncopyable {
+public:
+	/** One requested resource. */
+	struct Entry {
+		Common::UString name; ///< The resource's name.
+		FileType        type; ///< The resource's type.
+
+		uint32_t size; ///< The resource's size in bytes.
+		uint32_t time; ///< The time it took to get the resource, in microseconds.
+
+		Common::UString archive; ///< The archive (or file) the resource came from.
+
+		Entry();
+	};
+
+	/** The accumulated I/O of one archive. */
+	struct ArchiveStatistics {
+		Common::UString archive;
+
+		uint32_t resources; ///< Number of resources read.
+		uint64_t size;      ///< Bytes read.
+		uint64_t time;      ///< Time spent, in microseconds.
+	};
+
+	typedef std::vector<Entry> Entries;
+	typedef std::vector<ArchiveStatistics> Statistics;
+
+	ResourceTrace();
+	~ResourceTrace();
+
+	void clear();
+
+	/** Record a request of a resource. Later requests of the same resource are ignored. */
+	void add(const Entry &entry);
+
+	/** Return all recorded requests, in order. */
+	Entries getEntries() const;
+
+	/** Return the I/O of each archive, sorted by the time spent in it. */
+	Statistics getStatistics() const;
+
+	/** Read a trace from a stream, replacing the current one.
+	 *
+	 *  If the stream doesn't contain a valid trace, the trace is left empty.
+	 *
+	 *  @return true if a valid trace was read, false otherwise.
+	 */
+	bool read(Common::SeekableReadStream &stream);
+
+	/** Write the trace to a stream. */
+	void write(Common::WriteStream &stream) const;
+
+private:
+	Entries _entries;
+
+	/** The resources already recorded. */
+	std::set<std::pair<Common::UString, FileType> > _known;
+
+	mutable std::mutex _mutex;
+};
+
+} // End of namespace Aurora
+
+#endif // AURORA_RESOURCETRACE_H
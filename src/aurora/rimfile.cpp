@@ -27,6 +27,7 @@
 #include "src/common/util.h"
 #include "src/common/strutil.h"
 #include "src/common/memreadstream.h"
+#include "src/common/mappedfile.h"
 #include "src/common/error.h"
 #include "src/common/encoding.h"
 
@@ -108,6 +109,10 @@ uint32_t RIMFile::getResourceSize(uint32_t index) const {
 Common::SeekableReadStream *RIMFile::getResource(uint32_t index, bool tryNoCopy) const {
 	const IResource &res = getIResource(index);
 
+	Common::SeekableReadStream *view = Common::MappedReadStream::viewStream(*_rim, res.offset, res.size);
+	if (view)
+		return view;
+
 	if (tryNoCopy)
 		return new Common::SeekableSubReadStream(_rim.get(), res.offset, res.offset + res.size);
 
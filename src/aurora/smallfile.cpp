@@ -23,12 +23,15 @@
  */
 
 #include <cassert>
+#include <cstring>
 
 #include <memory>
 
+#include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/memreadstream.h"
-#include "src/common/memwritestream.h"
+#include "src/common/writestream.h"
+#include "src/common/mappedfile.h"
 
 #include "src/aurora/smallfile.h"
 
@@ -48,8 +51,12 @@ static void writeSmallHeader(Common::WriteStream &small, uint32_t type, uint32_t
 	small.writeUint32LE((size << 8) | type);
 }
 
-static void decompress00(Common::ReadStream &small, Common::WriteStream &out, uint32_t size) {
-	out.writeStream(small, size);
+static size_t decompress00(const byte *small, size_t smallSize, byte *out, uint32_t size) {
+	if (smallSize < size)
+		throw Common::Exception(Common::kReadError);
+
+	std::memcpy(out, small, size);
+	return size;
 }
 
 static void compress00(Common::ReadStream &in, Common::WriteStream &small, uint32_t size) {
@@ -63,62 +70,61 @@ static void compress00(Common::ReadStream &in, Common::WriteStream &small, uint3
  * See <https://github.com/gravgun/dsdecmp/blob/master/CSharp/DSDecmp/Formats/Nitro/LZ10.cs#L121>
  * and <https://code.google.com/p/dsdecmp/>.
  */
-static void decompress10(Common::ReadStream &small, Common::WriteStream &out, uint32_t size) {
-	byte     buffer[0x10000];
-	uint32_t bufferPos = 0;
-
-	uint16_t flags = 0xFF00;
+static size_t decompress10(const byte *small, size_t smallSize, byte *out, uint32_t size) {
+	const byte *in    = small;
+	const byte *inEnd = small + smallSize;
 
 	uint32_t outSize = 0;
 	while (outSize < size) {
-		// Only our canaries left => Read flags for the next 8 blocks
-		if (flags == 0xFF00)
-			flags = (small.readByte() << 8) | 0x00FF;
+		// Read flags for the next 8 blocks
+		if (in >= inEnd)
+			throw Common::Exception(Common::kReadError);
 
-		if (flags & 0x8000) {
-			// Copy from buffer
+		byte flags = *in++;
 
-			const byte data1 = small.readByte();
-			const byte data2 = small.readByte();
+		for (size_t block = 0; (block < 8) && (outSize < size); block++, flags <<= 1) {
+			if (!(flags & 0x80)) {
+				// Literal byte
 
-			// Copy how many bytes from where (relative) in the buffer?
-			const uint8_t  length = (data1 >> 4) + 3;
-			const uint16_t offset = (((data1 & 0x0F) << 8) | data2) + 1;
+				if (in >= inEnd)
+					throw Common::Exception(Common::kReadError);
 
-			// Direct offset. Add size of the buffer once, to protect from overroll
-			uint32_t copyOffset = bufferPos + sizeof(buffer) - offset;
+				out[outSize++] = *in++;
+				continue;
+			}
 
-			// Copy length bytes (and store each back into the buffer)
-			for (uint8_t i = 0; i < length; i++, copyOffset++) {
-				if ((copyOffset % sizeof(buffer)) >= outSize)
-					throw Common::Exception("Tried to copy past the buffer");
+			// Copy from earlier in the output
 
-				const byte data = buffer[copyOffset % sizeof(buffer)];
+			if ((inEnd - in) < 2)
+				throw Common::Exception(Common::kReadError);
 
-				out.writeByte(data);
-				outSize++;
+			// Copy how many bytes from where (relative) in the output?
+			const uint32_t length = (in[0] >> 4) + 3;
+			const uint32_t offset = (((in[0] & 0x0F) << 8) | in[1]) + 1;
 
-				buffer[bufferPos] = data;
-				bufferPos = (bufferPos + 1) % sizeof(buffer);
-			}
+			in += 2;
 
-		} else {
-			// Read literal byte
+			if (offset > outSize)
+				throw Common::Exception("Tried to copy past the buffer");
+			if (length > (size - outSize))
+				throw Common::Exception("Invalid \"small\" data");
 
-			const byte data = small.readByte();
+			byte *dest = out + outSize;
+			const byte *src = dest - offset;
 
-			out.writeByte(data);
-			outSize++;
+			if (offset >= length) {
+				std::memcpy(dest, src, length);
+			} else {
+				// The copy overlaps itself, repeating the last offset bytes
+				for (uint32_t i = 0; i < length; i++)
+					dest[i] = src[i];
+			}
 
-			buffer[bufferPos] = data;
-			bufferPos = (bufferPos + 1) % sizeof(buffer);
+			outSize += length;
 		}
-
-		flags <<= 1;
 	}
 
-	if (outSize != size)
-		throw Common::Exception("Invalid \"small\" data");
+	return in - small;
 }
 
 /** Determine the maximum size of an LZSS-compressed block.
@@ -244,28 +250,71 @@ static void compress10(Common::ReadStream &in, Common::WriteStream &small, uint3
 			throw Common::Exception(Common::kWriteError);
 }
 
-static void decompress(Common::ReadStream &small, Common::WriteStream &out,
-                       uint32_t type, uint32_t size) {
-
+/** Decompress a whole small file, sans header, from memory into memory.
+ *
+ *  @return The number of compressed bytes used.
+ */
+static size_t decompress(const byte *small, size_t smallSize, byte *out, uint32_t type, uint32_t size) {
 	if      (type == 0x00)
-		decompress00(small, out, size);
+		return decompress00(small, smallSize, out, size);
 	else if (type == 0x10)
-		decompress10(small, out, size);
-	else
-		throw Common::Exception("Unsupported type 0x%08X", (uint) type);
+		return decompress10(small, smallSize, out, size);
+
+	throw Common::Exception("Unsupported type 0x%08X", (uint) type);
 }
 
-void Small::decompress(Common::ReadStream &small, Common::WriteStream &out) {
-	uint32_t type, size;
-	readSmallHeader(small, type, size);
+/** Decompress the small data following the header in this stream into a new buffer.
+ *
+ *  If the stream is already in memory, the data is decompressed straight out of
+ *  it. Otherwise, the most compressed data there could be for this size is read
+ *  in one go. In both cases, a seekable stream is left positioned right after
+ *  the compressed data.
+ */
+static byte *decompress(Common::ReadStream &small, uint32_t type, uint32_t size) {
+	std::unique_ptr<byte[]> out = std::make_unique<byte[]>(size);
 
 	try {
-		::Aurora::decompress(small, out, type, size);
+		Common::MemoryReadStream *memory = dynamic_cast<Common::MemoryReadStream *>(&small);
+		if (memory) {
+			const size_t pos = memory->pos();
+
+			const size_t used = decompress(memory->getData() + pos, memory->size() - pos, out.get(), type, size);
+			memory->seek(pos + used);
+
+			return out.release();
+		}
+
+		// In the worst case, every block is a literal, with a flags byte for every 8 of them
+		size_t maxSmallSize = size + (size + 7) / 8;
+
+		Common::SeekableReadStream *seekable = dynamic_cast<Common::SeekableReadStream *>(&small);
+		const size_t pos = seekable ? seekable->pos() : 0;
+		if (seekable)
+			maxSmallSize = MIN<size_t>(maxSmallSize, seekable->size() - pos);
+
+		std::unique_ptr<byte[]> in = std::make_unique<byte[]>(maxSmallSize);
+		const size_t smallSize = small.read(in.get(), maxSmallSize);
+
+		const size_t used = decompress(in.get(), smallSize, out.get(), type, size);
+		if (seekable)
+			seekable->seek(pos + used);
+
 	} catch (Common::Exception &e) {
 		e.add("Failed to decompress \"small\" file");
 		throw e;
 	}
 
+	return out.release();
+}
+
+void Small::decompress(Common::ReadStream &small, Common::WriteStream &out) {
+	uint32_t type, size;
+	readSmallHeader(small, type, size);
+
+	std::unique_ptr<byte[]> data(::Aurora::decompress(small, type, size));
+
+	if (out.write(data.get(), size) != size)
+		throw Common::Exception(Common::kWriteError);
 }
 
 Common::SeekableReadStream *Small::decompress(Common::SeekableReadStream *small) {
@@ -278,40 +327,24 @@ Common::SeekableReadStream *Small::decompress(Common::SeekableReadStream *small)
 
 	const size_t pos = in->pos();
 
-	if (type == 0x00)
-		// Uncompressed. Just return a sub stream for the raw data
-		return new Common::SeekableSubReadStream(in.release(), pos, pos + size, true);
-
-	Common::MemoryWriteStreamDynamic out(true, size);
+	if (type == 0x00) {
+		// Uncompressed. Just return a view or sub stream for the raw data
+		Common::SeekableReadStream *view = Common::MappedReadStream::viewStream(*in, pos, size);
+		if (view)
+			return view;
 
-	try {
-		::Aurora::decompress(*in, out, type, size);
-	} catch (Common::Exception &e) {
-		e.add("Failed to decompress \"small\" file");
-		throw e;
+		return new Common::SeekableSubReadStream(in.release(), pos, pos + size, true);
 	}
 
-	out.setDisposable(false);
-	return new Common::MemoryReadStream(out.getData(), out.size(), true);
+	return new Common::MemoryReadStream(::Aurora::decompress(*in, type, size), size, true);
 }
 
 Common::SeekableReadStream *Small::decompress(Common::ReadStream &small) {
 	uint32_t type, size;
 	readSmallHeader(small, type, size);
 
-	Common::MemoryWriteStreamDynamic out(true, size);
-
-	try {
-		::Aurora::decompress(small, out, type, size);
-	} catch (Common::Exception &e) {
-		e.add("Failed to decompress \"small\" file");
-		throw e;
-	}
-
-	out.setDisposable(false);
-	return new Common::MemoryReadStream(out.getData(), out.size(), true);
+	return new Common::MemoryReadStream(::Aurora::decompress(small, type, size), size, true);
 }
-
 Common::SeekableReadStream *Small::decompress(Common::ReadStream *small) {
 	std::unique_ptr<Common::ReadStream> in(small);
 
@@ -91,7 +91,7 @@ void TalkManager::addTable(const Common::UString &nameMale, const Common::UStrin
 
 	const uint32_t id = Common::generateIDNumber();
 
-	tables->push_back(Table(tableMale, tableFemale, priority, id));
+	tables->push_back(Table(tableMale, tableFemale, nameMale, nameFemale, priority, id));
 	tables->sort();
 
 	if (changeID)
@@ -175,6 +175,23 @@ const TalkTable *TalkManager::find(const Tables &tables, uint32_t strRef, Langua
 	return 0;
 }
 
+static void addTableUsage(Common::MemoryUsageList &usage, const TalkTable *table, const Common::UString &name) {
+	if (table)
+		usage.add(name, table->getMemorySize());
+}
+
+void TalkManager::getMemoryUsage(Common::MemoryUsageList &usage) const {
+	for (Tables::const_iterator t = _tablesMain.begin(); t != _tablesMain.end(); ++t) {
+		addTableUsage(usage, t->tableMale  , t->nameMale);
+		addTableUsage(usage, t->tableFemale, t->nameFemale);
+	}
+
+	for (Tables::const_iterator t = _tablesAlt.begin(); t != _tablesAlt.end(); ++t) {
+		addTableUsage(usage, t->tableMale  , t->nameMale);
+		addTableUsage(usage, t->tableFemale, t->nameFemale);
+	}
+}
+
 const TalkTable *TalkManager::find(uint32_t strRef, LanguageGender gender) const {
 	bool isAlt = (strRef & 0xFF000000) != 0;
 
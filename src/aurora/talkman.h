@@ -31,6 +31,7 @@
 #include "src/common/ustring.h"
 #include "src/common/singleton.h"
 #include "src/common/changeid.h"
+#include "src/common/memoryusage.h"
 
 #include "src/aurora/language.h"
 
@@ -63,6 +64,9 @@ public:
 	const Common::UString &getString     (uint32_t strRef, LanguageGender gender = kLanguageGenderCurrent);
 	const Common::UString &getSoundResRef(uint32_t strRef, LanguageGender gender = kLanguageGenderCurrent);
 
+	/** Collect how much memory each loaded talk table takes up. */
+	void getMemoryUsage(Common::MemoryUsageList &usage) const;
+
 private:
 	struct Table {
 		uint32_t id;
@@ -71,8 +75,12 @@ private:
 		TalkTable *tableMale;
 		TalkTable *tableFemale;
 
-		Table(TalkTable *tM, TalkTable *tF, uint32_t p, uint32_t i) :
-			id(i), priority(p), tableMale(tM), tableFemale(tF) { }
+		Common::UString nameMale;
+		Common::UString nameFemale;
+
+		Table(TalkTable *tM, TalkTable *tF, const Common::UString &nM, const Common::UString &nF,
+		      uint32_t p, uint32_t i) :
+			id(i), priority(p), tableMale(tM), tableFemale(tF), nameMale(nM), nameFemale(nF) { }
 
 		bool operator<(const Table &right) const { return priority < right.priority; }
 	};
@@ -60,6 +60,9 @@ public:
 
 	virtual uint32_t getSoundID(uint32_t strRef) const = 0;
 
+	/** Return the approximate number of bytes the talk table takes up in memory. */
+	virtual size_t getMemorySize() const = 0;
+
 	/** Take over this stream and read a talk table (of either format) out of it. */
 	static TalkTable *load(Common::SeekableReadStream *tlk, Common::Encoding encoding);
 
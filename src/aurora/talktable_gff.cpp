@@ -28,6 +28,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstring>
 
 #include "src/common/util.h"
 #include "src/common/error.h"
@@ -75,6 +76,16 @@ uint32_t TalkTable_GFF::getSoundID(uint32_t UNUSED(strRef)) const {
 	return kFieldIDInvalid;
 }
 
+size_t TalkTable_GFF::getMemorySize() const {
+	// The GFF4 itself isn't included, only the entries and their decoded strings
+	size_t size = sizeof(TalkTable_GFF);
+
+	for (Entries::const_iterator e = _entries.begin(); e != _entries.end(); ++e)
+		size += sizeof(Entries::value_type) + sizeof(Entry) + std::strlen(e->second->text.c_str());
+
+	return size;
+}
+
 void TalkTable_GFF::load(Common::SeekableReadStream *tlk) {
 	assert(tlk);
 
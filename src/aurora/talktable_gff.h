@@ -69,6 +69,8 @@ public:
 
 	uint32_t getSoundID(uint32_t strRef) const;
 
+	size_t getMemorySize() const;
+
 
 private:
 	struct Entry {
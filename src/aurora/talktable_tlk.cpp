@@ -27,6 +27,10 @@
  */
 
 #include <cassert>
+#include <cstring>
+
+#include <map>
+#include <new>
 
 #include "src/common/util.h"
 #include "src/common/strutil.h"
@@ -44,14 +48,25 @@ static const uint32_t kVersion4 = MKTAG('V', '4', '.', '0');
 namespace Aurora {
 
 TalkTable_TLK::TalkTable_TLK(Common::SeekableReadStream *tlk, Common::Encoding encoding) :
-	TalkTable(encoding), _tlk(tlk) {
+	TalkTable(encoding), _tlk(tlk), _tlkData(0) {
 
 	assert(_tlk);
 
+	// Streams in memory can be read from several threads at once without seeking
+	Common::MemoryReadStream *memTLK = dynamic_cast<Common::MemoryReadStream *>(_tlk.get());
+	if (memTLK)
+		_tlkData = memTLK->getData();
+
 	load();
 }
 
 TalkTable_TLK::~TalkTable_TLK() {
+	// The strings live in the arena, so they need to be destroyed by hand
+	for (size_t i = 0; i < _entries.size(); i++) {
+		const Common::UString *str = _strings[i].load(std::memory_order_relaxed);
+		if (str)
+			str->~UString();
+	}
 }
 
 void TalkTable_TLK::load() {
@@ -69,6 +84,12 @@ void TalkTable_TLK::load() {
 		uint32_t stringCount = _tlk->readUint32LE();
 		_entries.resize(stringCount);
 
+		_strings = std::make_unique<std::atomic<const Common::UString *>[]>(stringCount);
+		for (uint32_t i = 0; i < stringCount; i++)
+			_strings[i].store(0, std::memory_order_relaxed);
+
+		_soundResRefs.push_back("");
+
 		// V4 added this field; it's right after the header in V3
 		uint32_t tableOffset = 20;
 		if (_version == kVersion4)
@@ -92,47 +113,99 @@ void TalkTable_TLK::load() {
 }
 
 void TalkTable_TLK::readEntryTableV3(uint32_t stringsOffset) {
+	// Most entries share a handful of sound ResRefs, or have none at all
+	std::map<Common::UString, uint32_t> soundResRefs;
+	soundResRefs.insert(std::make_pair(_soundResRefs[0], 0));
+
 	for (Entries::iterator entry = _entries.begin(); entry != _entries.end(); ++entry) {
-		entry->flags          = _tlk->readUint32LE();
-		entry->soundResRef    = Common::readStringFixed(*_tlk, Common::kEncodingASCII, 16);
-		entry->volumeVariance = _tlk->readUint32LE();
-		entry->pitchVariance  = _tlk->readUint32LE();
-		entry->offset         = _tlk->readUint32LE() + stringsOffset;
-		entry->length         = _tlk->readUint32LE();
-		entry->soundLength    = _tlk->readIEEEFloatLE();
-		entry->soundID        = kFieldIDInvalid;
+		entry->flags = _tlk->readUint32LE();
+
+		const Common::UString soundResRef = Common::readStringFixed(*_tlk, Common::kEncodingASCII, 16);
+
+		std::pair<std::map<Common::UString, uint32_t>::iterator, bool> sound =
+			soundResRefs.insert(std::make_pair(soundResRef, _soundResRefs.size()));
+		if (sound.second)
+			_soundResRefs.push_back(soundResRef);
+
+		entry->soundResRef = sound.first->second;
+
+		_tlk->skip(8); // Volume variance + pitch variance, unused
+
+		entry->offset      = _tlk->readUint32LE() + stringsOffset;
+		entry->length      = _tlk->readUint32LE();
+		entry->soundLength = _tlk->readIEEEFloatLE();
+		entry->soundID     = kFieldIDInvalid;
 	}
 }
 
 void TalkTable_TLK::readEntryTableV4() {
 	for (Entries::iterator entry = _entries.begin(); entry != _entries.end(); ++entry) {
-		entry->soundID = _tlk->readUint32LE();
-		entry->offset  = _tlk->readUint32LE();
-		entry->length  = _tlk->readUint16LE();
-		entry->flags   = kFlagTextPresent;
+		entry->soundID     = _tlk->readUint32LE();
+		entry->offset      = _tlk->readUint32LE();
+		entry->length      = _tlk->readUint16LE();
+		entry->flags       = kFlagTextPresent;
+		entry->soundResRef = 0;
+		entry->soundLength = 0.0f;
 	}
 }
 
-void TalkTable_TLK::readString(Entry &entry) const {
-	if (!entry.text.empty() || (entry.length == 0) || !(entry.flags & kFlagTextPresent))
-		// We already have the string
-		return;
+static const Common::UString kEmptyString = "";
+const Common::UString &TalkTable_TLK::readString(uint32_t strRef) const {
+	const Common::UString *str = _strings[strRef].load(std::memory_order_acquire);
+	if (str)
+		return *str;
 
-	assert(_tlk);
+	const Entry &entry = _entries[strRef];
+	if ((entry.length == 0) || !(entry.flags & kFlagTextPresent))
+		return kEmptyString;
+
+	std::lock_guard<std::mutex> lock(_decodeMutex[strRef % kDecodeShards]);
+
+	// Another thread might have decoded it while we waited
+	str = _strings[strRef].load(std::memory_order_acquire);
+	if (str)
+		return *str;
+
+	str = new (_stringArena.allocate(sizeof(Common::UString), alignof(Common::UString)))
+		Common::UString(decodeString(entry));
+
+	_strings[strRef].store(str, std::memory_order_release);
+
+	return *str;
+}
 
-	_tlk->seek(entry.offset);
+Common::UString TalkTable_TLK::decodeString(const Entry &entry) const {
+	std::unique_ptr<Common::MemoryReadStream> data;
 
-	uint32_t length = MIN<size_t>(entry.length, _tlk->size() - _tlk->pos());
-	if (length == 0)
-		return;
+	if (_tlkData) {
+		if (entry.offset >= _tlk->size())
+			return "";
+
+		const uint32_t length = MIN<size_t>(entry.length, _tlk->size() - entry.offset);
+
+		data = std::make_unique<Common::MemoryReadStream>(_tlkData + entry.offset, length);
+
+	} else {
+		std::lock_guard<std::mutex> lock(_tlkMutex);
+
+		_tlk->seek(entry.offset);
+
+		const uint32_t length = MIN<size_t>(entry.length, _tlk->size() - _tlk->pos());
+		if (length == 0)
+			return "";
+
+		data.reset(_tlk->readStream(length));
+	}
+
+	if (data->size() == 0)
+		return "";
 
-	std::unique_ptr<Common::MemoryReadStream> data(_tlk->readStream(length));
 	std::unique_ptr<Common::MemoryReadStream> parsed(LangMan.preParseColorCodes(*data));
 
 	if (_encoding != Common::kEncodingInvalid)
-		entry.text = Common::readString(*parsed, _encoding);
-	else
-		entry.text = "[???]";
+		return Common::readString(*parsed, _encoding);
+
+	return "[???]";
 }
 
 uint32_t TalkTable_TLK::getLanguageID() const {
@@ -143,21 +216,18 @@ bool TalkTable_TLK::hasEntry(uint32_t strRef) const {
 	return strRef < _entries.size();
 }
 
-static const Common::UString kEmptyString = "";
 const Common::UString &TalkTable_TLK::getString(uint32_t strRef) const {
 	if (strRef >= _entries.size())
 		return kEmptyString;
 
-	readString(_entries[strRef]);
-
-	return _entries[strRef].text;
+	return readString(strRef);
 }
 
 const Common::UString &TalkTable_TLK::getSoundResRef(uint32_t strRef) const {
 	if (strRef >= _entries.size())
 		return kEmptyString;
 
-	return _entries[strRef].soundResRef;
+	return _soundResRefs[_entries[strRef].soundResRef];
 }
 
 uint32_t TalkTable_TLK::getSoundID(uint32_t strRef) const {
@@ -167,6 +237,31 @@ uint32_t TalkTable_TLK::getSoundID(uint32_t strRef) const {
 	return _entries[strRef].soundID;
 }
 
+size_t TalkTable_TLK::getMemorySize() const {
+	size_t size = sizeof(TalkTable_TLK);
+
+	// A TLK in memory is decoded straight from its data, so that stays around
+	if (_tlkData)
+		size += _tlk->size();
+
+	size += _entries.capacity() * sizeof(Entry);
+
+	size += _soundResRefs.capacity() * sizeof(Common::UString);
+	for (std::vector<Common::UString>::const_iterator s = _soundResRefs.begin(); s != _soundResRefs.end(); ++s)
+		size += std::strlen(s->c_str());
+
+	size += _entries.size() * sizeof(std::atomic<const Common::UString *>);
+	size += _stringArena.getCapacity();
+
+	for (size_t i = 0; i < _entries.size(); i++) {
+		const Common::UString *str = _strings[i].load(std::memory_order_acquire);
+		if (str)
+			size += std::strlen(str->c_str());
+	}
+
+	return size;
+}
+
 uint32_t TalkTable_TLK::getLanguageID(Common::SeekableReadStream &tlk) {
 	uint32_t id, version;
 	bool utf16le;
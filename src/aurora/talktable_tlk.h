@@ -27,9 +27,12 @@
 
 #include <vector>
 #include <memory>
+#include <atomic>
 
 #include "src/common/types.h"
 #include "src/common/ustring.h"
+#include "src/common/mutex.h"
+#include "src/common/framearena.h"
 
 #include "src/aurora/aurorafile.h"
 #include "src/aurora/talktable.h"
@@ -49,6 +52,13 @@ namespace Aurora {
  *  - V3.0, used by Neverwinter Nights, Neverwinter Nights 2, Knight of
  *    the Old Republic, Knight of the Old Republic II and The Witcher
  *  - V4.0, used by Jade Empire
+ *
+ *  Strings are only decoded when they're first asked for. Looking up
+ *  strings is safe from several threads at once: already decoded strings
+ *  are found without taking a lock, and decoding one only locks a shard
+ *  of the entries. If the TLK is in memory (or memory-mapped), the strings
+ *  are decoded straight from it; otherwise, reading from the stream is
+ *  serialized.
  */
 class TalkTable_TLK : public AuroraFile, public TalkTable {
 public:
@@ -66,6 +76,8 @@ public:
 
 	uint32_t getSoundID(uint32_t strRef) const;
 
+	size_t getMemorySize() const;
+
 	static uint32_t getLanguageID(Common::SeekableReadStream &tlk);
 	static uint32_t getLanguageID(const Common::UString &file);
 
@@ -80,16 +92,13 @@ private:
 
 	/** A talk resource entry. */
 	struct Entry {
-		Common::UString text;
 		uint32_t offset;
 		uint32_t length;
 
 		// V3
 		uint32_t flags;
-		Common::UString soundResRef;
-		uint32_t volumeVariance; // Unused
-		uint32_t pitchVariance; // Unused
-		float soundLength; // In seconds
+		uint32_t soundResRef; ///< Index into _soundResRefs.
+		float soundLength;    ///< In seconds.
 
 		// V4
 		uint32_t soundID;
@@ -97,19 +106,38 @@ private:
 
 	typedef std::vector<Entry> Entries;
 
+	/** The number of shards the entries are split into for decoding. */
+	static const size_t kDecodeShards = 16;
+
 
 	std::unique_ptr<Common::SeekableReadStream> _tlk;
 
+	/** The TLK's data, if the whole stream is in memory. */
+	const byte *_tlkData;
+
 	uint32_t _languageID;
 
-	mutable Entries _entries;
+	Entries _entries;
+
+	/** All distinct sound ResRefs. The first one is empty. */
+	std::vector<Common::UString> _soundResRefs;
+
+	/** The decoded string of each entry, or 0 if not decoded yet. */
+	std::unique_ptr<std::atomic<const Common::UString *>[]> _strings;
+
+	/** Holds all decoded strings. */
+	mutable Common::FrameArena _stringArena;
+
+	mutable std::mutex _decodeMutex[kDecodeShards]; ///< Guards decoding a shard's entries.
+	mutable std::mutex _tlkMutex;                   ///< Guards reading from _tlk.
 
 	void load();
 
 	void readEntryTableV3(uint32_t stringsOffset);
 	void readEntryTableV4();
 
-	void readString(Entry &entry) const;
+	const Common::UString &readString(uint32_t strRef) const;
+	Common::UString decodeString(const Entry &entry) const;
 };
 
 } // End of namespace Aurora
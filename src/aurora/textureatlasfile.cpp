@@ -65,29 +65,37 @@ void TextureAtlasFile::getAtlasTexture(const Common::UString &texture,
 }
 
 void TextureAtlasFile::load(Common::SeekableReadStream &stream) {
-	Common::XMLParser parser(stream);
+	/* Atlas files can be big, so we walk through them instead of building
+	 * the whole tree. <AtlasData> contains <AtlasTexture> elements, which
+	 * in turn contain the <SourceTexture> elements we're interested in. */
+	Common::XMLReader reader(stream);
 
-	const Common::XMLNode &node = parser.getRoot();
+	Common::UString atlasTexture;
 
-	if(node.getName() != "AtlasData")
-		throw Common::Exception("Invalid tag, <AtlasData> expected, <%s> found", node.getName().c_str());
+	while (reader.next()) {
+		if (reader.getType() != Common::XMLReader::kNodeElementStart)
+			continue;
 
-	const Common::XMLNode::Children &atlasTextures = node.getChildren();
-	for (Common::XMLNode::Children::const_iterator a = atlasTextures.begin(); a != atlasTextures.end(); ++a) {
-		if ((*a)->getName() != "AtlasTexture")
-			throw Common::Exception("Invalid tag, <AtlasTexture> expected, <%s> found", (*a)->getName().c_str());
+		const Common::UString &name = reader.getName();
 
-		Common::UString atlasTexture = (*a)->getProperty("Name");
+		if (reader.getDepth() == 0) {
+			if (name != "AtlasData")
+				throw Common::Exception("Invalid tag, <AtlasData> expected, <%s> found", name.c_str());
 
-		const Common::XMLNode::Children &sourceTextures = (*a)->getChildren();
-		for (Common::XMLNode::Children::const_iterator s = sourceTextures.begin();
-		     s != sourceTextures.end(); ++s) {
-			if ((*s)->getName() != "SourceTexture")
-				throw Common::Exception("Invalid tag, <SourceTexture> expected, <%s> found", (*s)->getName().c_str());
+		} else if (reader.getDepth() == 1) {
+			if (name != "AtlasTexture")
+				throw Common::Exception("Invalid tag, <AtlasTexture> expected, <%s> found", name.c_str());
 
-			const Common::UString sourceTexture = (*s)->getProperty("Name");
-			const Common::UString offsetAndScale = (*s)->getProperty("OffsetAndScale");
-			const Common::UString offsetAndScaleV2 = (*s)->getProperty("OffsetAndScale_V2");
+			atlasTexture = reader.getProperty("Name");
+			atlasTexture.erase(atlasTexture.findFirst(".dds"), atlasTexture.end());
+
+		} else if (reader.getDepth() == 2) {
+			if (name != "SourceTexture")
+				throw Common::Exception("Invalid tag, <SourceTexture> expected, <%s> found", name.c_str());
+
+			const Common::UString sourceTexture = reader.getProperty("Name");
+			const Common::UString offsetAndScale = reader.getProperty("OffsetAndScale");
+			const Common::UString offsetAndScaleV2 = reader.getProperty("OffsetAndScale_V2");
 
 			assert(offsetAndScale == offsetAndScaleV2);
 
@@ -96,8 +104,6 @@ void TextureAtlasFile::load(Common::SeekableReadStream &stream) {
 			if (values.size() != 4)
 				throw Common::Exception("Invalid OffsetAndScale attribute");
 
-			atlasTexture.erase(atlasTexture.findFirst(".dds"), atlasTexture.end());
-
 			AtlasTexture texture;
 			texture.textureFile = atlasTexture;
 			Common::parseString(values[0], texture.x);
@@ -106,6 +112,9 @@ void TextureAtlasFile::load(Common::SeekableReadStream &stream) {
 			Common::parseString(values[3], texture.h);
 
 			_atlasTextures[sourceTexture] = texture;
+
+			// Nothing else of interest in here
+			reader.skip();
 		}
 	}
 }
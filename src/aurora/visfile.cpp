@@ -123,4 +123,43 @@ const std::vector<Common::UString> &VISFile::getVisibilityArray(const Common::US
 	return vRoom->second;
 }
 
+void VISFile::compileVisibility(const std::vector<Common::UString> &rooms, std::vector<RoomSet> &visibility) const {
+	std::multimap<Common::UString, size_t> indices;
+	for (size_t i = 0; i < rooms.size(); i++)
+		indices.insert(std::make_pair(rooms[i].toLower(), i));
+
+	visibility.resize(rooms.size());
+
+	for (size_t i = 0; i < rooms.size(); i++) {
+		clearRoomSet(visibility[i], rooms.size());
+		addRoom(visibility[i], i);
+
+		const std::vector<Common::UString> &visible = getVisibilityArray(rooms[i]);
+		for (std::vector<Common::UString>::const_iterator v = visible.begin(); v != visible.end(); ++v) {
+			// Several rooms can share the same model
+			auto range = indices.equal_range(v->toLower());
+			for (auto index = range.first; index != range.second; ++index)
+				addRoom(visibility[i], index->second);
+		}
+	}
+}
+
+void VISFile::clearRoomSet(RoomSet &set, size_t roomCount) {
+	set.assign((roomCount + 63) / 64, 0);
+}
+
+void VISFile::addRoom(RoomSet &set, size_t room) {
+	if ((room / 64) >= set.size())
+		set.resize((room / 64) + 1, 0);
+
+	set[room / 64] |= UINT64_C(1) << (room % 64);
+}
+
+bool VISFile::hasRoom(const RoomSet &set, size_t room) {
+	if ((room / 64) >= set.size())
+		return false;
+
+	return (set[room / 64] & (UINT64_C(1) << (room % 64))) != 0;
+}
+
 } // End of namespace Aurora
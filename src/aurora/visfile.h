@@ -51,6 +51,9 @@ namespace Aurora {
  */
 class VISFile {
 public:
+	/** A set of rooms, as a bitset over room indices. */
+	typedef std::vector<uint64_t> RoomSet;
+
 	VISFile();
 	~VISFile();
 
@@ -69,6 +72,21 @@ public:
 	 */
 	const std::vector<Common::UString> &getVisibilityArray(const Common::UString &room) const;
 
+	/** Compile the visibility into one set of rooms for each of the given rooms.
+	 *
+	 *  Room indices are positions within the rooms list. The set of each room
+	 *  contains the room itself and all rooms visible from it. Visible rooms
+	 *  that aren't in the list are ignored.
+	 */
+	void compileVisibility(const std::vector<Common::UString> &rooms, std::vector<RoomSet> &visibility) const;
+
+	/** Create an empty set with room for this many rooms. */
+	static void clearRoomSet(RoomSet &set, size_t roomCount);
+	/** Add a room to the set. */
+	static void addRoom(RoomSet &set, size_t room);
+	/** Is the room in the set? */
+	static bool hasRoom(const RoomSet &set, size_t room);
+
 private:
 	std::map<Common::UString, std::vector<Common::UString> > _map;
 };
@@ -48,17 +48,14 @@ Common::SeekableReadStream *XMLFixer::fixXMLStream(Common::SeekableReadStream &i
 		if (!isValidXMLHeader(in))
 			throw Common::Exception("Input stream does not have an XML header");
 
-		// Convert input stream to a list of elements
-		const ElementList elements = readXMLStream(in);
-
 		// Write a standard header
 		out.writeString("<?xml version=\"1.0\" encoding=\"utf-8\"?>\n");
 		out.writeString("<Root>\n");
 
 		int buttonCount = 0;
 
-		// Fix each element and write to the output stream
-		for (const Common::UString &element : elements) {
+		// Fix each element as it's read and write it to the output stream
+		readXMLStream(in, [&out, &buttonCount](const Common::UString &element) {
 			Common::UString fixedElement = fixXMLElement(element);
 
 			buttonCount = updateUIButtonCount(fixedElement, buttonCount);
@@ -70,8 +67,9 @@ Common::SeekableReadStream *XMLFixer::fixXMLStream(Common::SeekableReadStream &i
 			}
 
 			// Write to output stream with an end of line marker
-			out.writeString(fixedElement + "\n");
-		}
+			out.writeString(fixedElement);
+			out.writeByte('\n');
+		});
 
 		// Close the root element
 		out.writeString("</Root>\n");
@@ -348,8 +346,8 @@ Common::UString XMLFixer::stripEndQuotes(Common::UString value) {
 	return value;
 }
 
-/** Convert the input stream to a vector of elements. */
-XMLFixer::ElementList XMLFixer::readXMLStream(Common::SeekableReadStream &in) {
+/** Split the input stream into elements, handing each to elementFunc as soon as it's complete. */
+void XMLFixer::readXMLStream(Common::SeekableReadStream &in, const ElementFunc &elementFunc) {
 	static const Common::UString kStartComment = "<!--";
 	static const Common::UString kEndComment   = "-->";
 
@@ -358,7 +356,6 @@ XMLFixer::ElementList XMLFixer::readXMLStream(Common::SeekableReadStream &in) {
 	bool inComment = false;
 
 	Common::UString buffer;
-	ElementList elements;
 
 	// Cycle through the remaining input stream
 	while (!in.eos()) {
@@ -437,14 +434,12 @@ XMLFixer::ElementList XMLFixer::readXMLStream(Common::SeekableReadStream &in) {
 		}
 
 		if (!line.empty())
-			elements.push_back(line);
+			elementFunc(line);
 
 		// Initialize for the next line
 		inComment = false;
 		priorTag = false;
 	}
-
-	return elements;
 }
 
 /** Check for a valid header. */
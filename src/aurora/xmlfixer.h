@@ -25,7 +25,7 @@
 #ifndef AURORA_XMLFIX_H
 #define AURORA_XMLFIX_H
 
-#include <vector>
+#include <functional>
 
 #include "src/common/ustring.h"
 
@@ -45,9 +45,9 @@ public:
 	static Common::SeekableReadStream *fixXMLStream(Common::SeekableReadStream &in);
 
 private:
-	typedef std::vector<Common::UString> ElementList;
+	typedef std::function<void(const Common::UString &)> ElementFunc;
 
-	static ElementList readXMLStream(Common::SeekableReadStream &in);
+	static void readXMLStream(Common::SeekableReadStream &in, const ElementFunc &elementFunc);
 
 	static bool endsWithTagCloser(const Common::UString &line);
 
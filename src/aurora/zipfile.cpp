@@ -55,6 +55,22 @@ Common::SeekableReadStream *ZIPFile::getResource(uint32_t index, bool tryNoCopy)
 	return _zipFile->getFile(index, tryNoCopy);
 }
 
+bool ZIPFile::isResourceCompressed(uint32_t index) const {
+	return _zipFile->isFileCompressed(index);
+}
+
+bool ZIPFile::isThreadSafe() const {
+	return _zipFile->isMapped();
+}
+
+uint32_t ZIPFile::findResource(const Common::UString &name, FileType type) const {
+	ResourceIndices::const_iterator index = _indices.find(TypeMan.setFileType(name, type));
+	if (index == _indices.end())
+		return 0xFFFFFFFF;
+
+	return index->second;
+}
+
 void ZIPFile::load() {
 	const Common::ZipFile::FileList &files = _zipFile->getFiles();
 	for (Common::ZipFile::FileList::const_iterator file = files.begin(); file != files.end(); ++file) {
@@ -65,6 +81,9 @@ void ZIPFile::load() {
 		res.index = file->index;
 
 		_resources.push_back(res);
+
+		// Like a search through the list, the first of several equally named files wins
+		_indices.insert(std::make_pair(TypeMan.setFileType(res.name, res.type), res.index));
 	}
 }
 
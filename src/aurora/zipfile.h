@@ -26,8 +26,10 @@
 #define AURORA_ZIPFILE_H
 
 #include <memory>
+#include <unordered_map>
 
 #include "src/common/types.h"
+#include "src/common/ustring.h"
 
 #include "src/aurora/types.h"
 #include "src/aurora/archive.h"
@@ -55,13 +57,29 @@ public:
 	/** Return a stream of the resource's contents. */
 	Common::SeekableReadStream *getResource(uint32_t index, bool tryNoCopy = false) const;
 
+	/** Does getting this resource need to inflate it? */
+	bool isResourceCompressed(uint32_t index) const;
+
+	/** Is the ZIP memory-mapped, so resources can be read concurrently? */
+	bool isThreadSafe() const;
+
+	using Archive::findResource;
+
+	/** Return the index of the resource matching the name and type, or 0xFFFFFFFF if not found. */
+	uint32_t findResource(const Common::UString &name, FileType type) const;
+
 private:
+	typedef std::unordered_map<Common::UString, uint32_t, Common::hashUStringCaseSensitive> ResourceIndices;
+
 	/** The actual zip file. */
 	std::unique_ptr<Common::ZipFile> _zipFile;
 
 	/** External list of resource names and types. */
 	ResourceList _resources;
 
+	/** The indices of all resources, by name with extension. */
+	ResourceIndices _indices;
+
 	void load();
 };
 
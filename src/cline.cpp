@@ -61,12 +61,20 @@ static void displayUsage(const Common::UString &name) {
 	std::printf("          --nologfile=BOOL    Don't write a log file.\n");
 	std::printf("          --consolelog=FILE   Write all debug console output into this file too.\n");
 	std::printf("          --noconsolelog=BOOL Don't write a debug console log file.\n");
+	std::printf("          --benchmark-load=MOD[:AREA]\n");
+	std::printf("                              Load module MOD (and its area AREA) without showing\n");
+	std::printf("                              anything, print the load times as JSON and exit.\n");
+	std::printf("          --prebake           Write all of the game's resources found in archives\n");
+	std::printf("                              into one prebaked archive, used on later starts,\n");
+	std::printf("                              and exit.\n");
 	std::printf("\n");
 	std::printf("FILE: Absolute or relative path to a file.\n");
 	std::printf("DIR:  Absolute or relative path to a directory.\n");
 	std::printf("SIZE: A positive integer.\n");
 	std::printf("BOOL: \"true\", \"yes\", \"y\", \"on\" and \"1\" are true, everything else is false.\n");
 	std::printf("VOL:  A double ranging from 0.0 (min) - 1.0 (max).\n");
+	std::printf("MOD:  A module name, as shown by the \"listmodules\" console command.\n");
+	std::printf("AREA: An area name, as shown by the \"listareas\" console command.\n");
 	std::printf("LANG: A language identifier. Full name, ISO 639-1 or ISO 639-2 language code;\n");
 	std::printf("      or IETF language tag with ISO 639-1 and ISO 3166-1 country code.\n");
 	std::printf("      Examples: en, de_de, hun, Czech, zh-tw, zh_cn, zh-cht, zh-chs.\n");
@@ -237,6 +245,11 @@ bool parseCommandline(const std::vector<Common::UString> &argv, Common::UString
 				key.clear();
 			}
 
+			if (key == "prebake") {
+				setOption(key, "true");
+				key.clear();
+			}
+
 			continue;
 		}
 
@@ -58,6 +58,14 @@ bool AABBNode::hasParent() const {
 	return _parent != 0;
 }
 
+const AABBNode *AABBNode::getLeftChild() const {
+	return _leftChild;
+}
+
+const AABBNode *AABBNode::getRightChild() const {
+	return _rightChild;
+}
+
 void AABBNode::setChildren(AABBNode *leftChild, AABBNode *rightChild) {
 	if (leftChild == 0 || rightChild == 0)
 		error("AABB must have two or no child");
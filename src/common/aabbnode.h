@@ -47,6 +47,10 @@ public:
 	bool hasChildren() const;
 	//* Has the AABB a parent? */
 	bool hasParent() const;
+	/** Get the left child, or 0 if the AABB has no children. */
+	const AABBNode *getLeftChild() const;
+	/** Get the right child, or 0 if the AABB has no children. */
+	const AABBNode *getRightChild() const;
 	/** Set left and right children to the AABB. */
 	void setChildren(AABBNode *leftChild, AABBNode *rightChild);
 	/** Set a parent to the node. */
@@ -87,6 +91,8 @@ private:
 	AABBNode *_leftChild;  ///< Left child.
 	AABBNode *_rightChild; ///< Right child.
 	int32_t _property;       ///< An arbitrary value of the AABB.
+
+	friend class AABBTree;
 };
 
 } // End of namespace Common
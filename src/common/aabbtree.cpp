@@ -0,0 +1,154 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A flattened tree of axis-aligned bounding boxes.
+ */
+
+#include <algorithm>
+
+#include "src/common/aabbnode.h"
+#include "src/common/aabbtree.h"
+
+namespace Common {
+
+AABBTree::AABBTree() {
+}
+
+AABBTree::AABBTree(const AABBNode &root) {
+	build(root);
+}
+
+void AABBTree::build(const AABBNode &root) {
+	clear();
+
+	addNode(root);
+}
+
+void AABBTree::build(const glm::vec3 *min, const glm::vec3 *max, size_t count) {
+	clear();
+
+	if (count == 0)
+		return;
+
+	std::vector<uint32_t> indices(count);
+	for (size_t i = 0; i < count; i++)
+		indices[i] = i;
+
+	addNode(min, max, indices.data(), count);
+}
+
+void AABBTree::clear() {
+	_minX.clear();
+	_minY.clear();
+	_minZ.clear();
+	_maxX.clear();
+	_maxY.clear();
+	_maxZ.clear();
+
+	_skip.clear();
+	_property.clear();
+}
+
+bool AABBTree::empty() const {
+	return _skip.empty();
+}
+
+size_t AABBTree::size() const {
+	return _skip.size();
+}
+
+size_t AABBTree::pushNode(const glm::vec3 &min, const glm::vec3 &max, int32_t property) {
+	const size_t index = _skip.size();
+
+	_minX.push_back(min[0]);
+	_minY.push_back(min[1]);
+	_minZ.push_back(min[2]);
+	_maxX.push_back(max[0]);
+	_maxY.push_back(max[1]);
+	_maxZ.push_back(max[2]);
+
+	_property.push_back(property);
+	_skip.push_back(0);
+
+	return index;
+}
+
+void AABBTree::addNode(const AABBNode &node) {
+	glm::vec3 min, max;
+	node.getMin(min[0], min[1], min[2]);
+	node.getMax(max[0], max[1], max[2]);
+
+	const size_t index = pushNode(min, max, node.getProperty());
+
+	if (node.hasChildren()) {
+		addNode(*node._leftChild);
+		addNode(*node._rightChild);
+	}
+
+	_skip[index] = _skip.size();
+}
+
+void AABBTree::addNode(const glm::vec3 *min, const glm::vec3 *max, uint32_t *indices, size_t count) {
+	if (count == 1) {
+		const size_t index = pushNode(min[indices[0]], max[indices[0]], indices[0]);
+
+		_skip[index] = _skip.size();
+		return;
+	}
+
+	glm::vec3 boundsMin = min[indices[0]], boundsMax = max[indices[0]];
+	glm::vec3 centerMin = (min[indices[0]] + max[indices[0]]), centerMax = centerMin;
+	for (size_t i = 1; i < count; i++) {
+		const glm::vec3 &bMin = min[indices[i]];
+		const glm::vec3 &bMax = max[indices[i]];
+		const glm::vec3 center = bMin + bMax;
+
+		for (int j = 0; j < 3; j++) {
+			boundsMin[j] = MIN(boundsMin[j], bMin[j]);
+			boundsMax[j] = MAX(boundsMax[j], bMax[j]);
+			centerMin[j] = MIN(centerMin[j], center[j]);
+			centerMax[j] = MAX(centerMax[j], center[j]);
+		}
+	}
+
+	const size_t index = pushNode(boundsMin, boundsMax, -1);
+
+	// Split along the axis the box centers are spread out the most
+	const glm::vec3 spread = centerMax - centerMin;
+
+	int axis = 0;
+	if (spread[1] > spread[axis])
+		axis = 1;
+	if (spread[2] > spread[axis])
+		axis = 2;
+
+	const size_t half = count / 2;
+	std::nth_element(indices, indices + half, indices + count, [min, max, axis](uint32_t a, uint32_t b) {
+		return (min[a][axis] + max[a][axis]) < (min[b][axis] + max[b][axis]);
+	});
+
+	addNode(min, max, indices, half);
+	addNode(min, max, indices + half, count - half);
+
+	_skip[index] = _skip.size();
+}
+
+} // End of namespace Common
@@ -0,0 +1,187 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A flattened tree of axis-aligned bounding boxes.
+ */
+
+#ifndef COMMON_AABBTREE_H
+#define COMMON_AABBTREE_H
+
+#include <utility>
+#include <vector>
+
+#include "external/glm/vec2.hpp"
+#include "external/glm/vec3.hpp"
+
+#include "src/common/types.h"
+#include "src/common/util.h"
+#include "src/common/geometry.h"
+
+namespace Common {
+
+class AABBNode;
+
+/** A read-only, flattened copy of an AABBNode tree.
+ *
+ *  The nodes are stored depth-first in contiguous arrays, one array per
+ *  bound component. Each node knows the index of the node following its
+ *  whole subtree, so a query is a single forward sweep over the arrays:
+ *  on a hit, step to the next node (the first child), on a miss, jump
+ *  over the subtree. No stack and no allocation is needed.
+ *
+ *  Queries call a visitor with the property of each leaf they touch.
+ *  The visitor returns true to stop the query early, and the query then
+ *  returns true as well.
+ *
+ *  The tree is a snapshot; it has to be rebuilt whenever the AABBNode
+ *  tree it was created from changes.
+ */
+class AABBTree {
+public:
+	AABBTree();
+	AABBTree(const AABBNode &root);
+
+	/** Flatten an AABBNode tree, replacing the current contents. */
+	void build(const AABBNode &root);
+	/** Build a tree over a set of boxes, replacing the current contents.
+	 *
+	 *  The boxes are split recursively at the median of their centers along
+	 *  the longest axis. The property of each leaf is the index of its box.
+	 */
+	void build(const glm::vec3 *min, const glm::vec3 *max, size_t count);
+	void clear();
+
+	bool empty() const;
+	/** Return the number of nodes, leaves and branches. */
+	size_t size() const;
+
+	/** Visit all leaves. */
+	template<typename Visitor>
+	bool visitLeaves(Visitor visitor) const {
+		return traverse([](size_t) { return true; }, visitor);
+	}
+
+	/** Visit the leaves containing a given point in the XY plane. */
+	template<typename Visitor>
+	bool visitPoint(float x, float y, Visitor visitor) const {
+		return traverse([this, x, y](size_t i) {
+			return (x >= _minX[i]) && (x <= _maxX[i]) && (y >= _minY[i]) && (y <= _maxY[i]);
+		}, visitor);
+	}
+
+	/** Visit the leaves that a given segment goes through. */
+	template<typename Visitor>
+	bool visitSegment(const glm::vec3 &start, const glm::vec3 &end, Visitor visitor) const {
+		const glm::vec3 dir = end - start;
+
+		return traverse([this, &start, &dir](size_t i) {
+			float tMin = 0.f, tMax = 1.f;
+
+			return clipSlab(start[0], dir[0], _minX[i], _maxX[i], tMin, tMax) &&
+			       clipSlab(start[1], dir[1], _minY[i], _maxY[i], tMin, tMax) &&
+			       clipSlab(start[2], dir[2], _minZ[i], _maxZ[i], tMin, tMax);
+		}, visitor);
+	}
+
+	/** Visit the leaves that a given segment goes through in the XY plane. */
+	template<typename Visitor>
+	bool visitSegment2D(const glm::vec3 &start, const glm::vec3 &end, Visitor visitor) const {
+		return traverse([this, &start, &end](size_t i) {
+			return intersectBoxSegment2D(glm::vec2(_minX[i], _minY[i]), glm::vec2(_maxX[i], _maxY[i]), start, end);
+		}, visitor);
+	}
+
+	/** Visit the leaves that intersect a given axis-aligned box. */
+	template<typename Visitor>
+	bool visitAABox(const glm::vec3 &min, const glm::vec3 &max, Visitor visitor) const {
+		return traverse([this, &min, &max](size_t i) {
+			return (min[0] <= _maxX[i]) && (max[0] >= _minX[i]) &&
+			       (min[1] <= _maxY[i]) && (max[1] >= _minY[i]) &&
+			       (min[2] <= _maxZ[i]) && (max[2] >= _minZ[i]);
+		}, visitor);
+	}
+
+	/** Visit the leaves that intersect a given axis-aligned box in the XY plane. */
+	template<typename Visitor>
+	bool visitAABox(const glm::vec2 &min, const glm::vec2 &max, Visitor visitor) const {
+		return traverse([this, &min, &max](size_t i) {
+			return (min[0] <= _maxX[i]) && (max[0] >= _minX[i]) &&
+			       (min[1] <= _maxY[i]) && (max[1] >= _minY[i]);
+		}, visitor);
+	}
+
+private:
+	std::vector<float> _minX;
+	std::vector<float> _minY;
+	std::vector<float> _minZ;
+	std::vector<float> _maxX;
+	std::vector<float> _maxY;
+	std::vector<float> _maxZ;
+
+	std::vector<uint32_t> _skip;     ///< Index of the node following this node's subtree.
+	std::vector<int32_t>  _property; ///< The property of each node.
+
+	void addNode(const AABBNode &node);
+	void addNode(const glm::vec3 *min, const glm::vec3 *max, uint32_t *indices, size_t count);
+
+	size_t pushNode(const glm::vec3 &min, const glm::vec3 &max, int32_t property);
+
+	template<typename Test, typename Visitor>
+	bool traverse(Test test, Visitor &visitor) const {
+		const size_t count = _skip.size();
+
+		size_t i = 0;
+		while (i < count) {
+			if (!test(i)) {
+				i = _skip[i];
+				continue;
+			}
+
+			// A leaf is the only node whose subtree ends right after itself
+			if ((_skip[i] == (i + 1)) && visitor(_property[i]))
+				return true;
+
+			++i;
+		}
+
+		return false;
+	}
+
+	/** Clip the parameter range of a segment against one slab of a box. */
+	static bool clipSlab(float start, float dir, float min, float max, float &tMin, float &tMax) {
+		if (dir == 0.f)
+			return (start >= min) && (start <= max);
+
+		float t1 = (min - start) / dir;
+		float t2 = (max - start) / dir;
+		if (t1 > t2)
+			std::swap(t1, t2);
+
+		tMin = MAX(tMin, t1);
+		tMax = MIN(tMax, t2);
+
+		return tMin <= tMax;
+	}
+};
+
+} // End of namespace Common
+
+#endif // COMMON_AABBTREE_H
@@ -30,9 +30,12 @@
 #include <boost/noncopyable.hpp>
 
 #include "src/common/types.h"
+#include "src/common/util.h"
+#include "src/common/endianness.h"
 #include "src/common/disposableptr.h"
 #include "src/common/error.h"
 #include "src/common/readstream.h"
+#include "src/common/memreader.h"
 
 namespace Common {
 
@@ -63,9 +66,18 @@ public:
 	/** Read a multi-bit value from the bit stream. */
 	virtual uint32_t getBits(size_t n) = 0;
 
+	/** Read a multi-bit value from the bit stream, without moving the stream position.
+	 *
+	 *  Bits past the end of the stream read as 0.
+	 */
+	virtual uint32_t peekBits(size_t n) = 0;
+
 	/** Add a bit to the n-bit value x, making it an (n+1)-bit value. */
 	virtual void addBit(uint32_t &x, size_t n) = 0;
 
+	/** Are the bits handed out in the order of MSB to LSB? */
+	virtual bool isMSBFirst() const = 0;
+
 protected:
 	BitStream() {
 	}
@@ -182,22 +194,51 @@ public:
 		if (n > 32)
 			throw Exception("Too many bits requested to be read");
 
-		// Read the number of bits
+		// Take as many bits as possible out of the current value at once
 		uint32_t v = 0;
+		size_t shift = 0;
 
-		if (isMSB2LSB) {
-			while (n-- > 0)
-				v = (v << 1) | getBit();
-		} else {
-			for (uint32_t i = 0; i < n; i++)
-				v = (v >> 1) | (((uint32_t) getBit()) << 31);
+		while (n > 0) {
+			if (_inValue == 0)
+				readValue();
+
+			const size_t count = MIN<size_t>(n, valueBits - _inValue);
+
+			if (isMSB2LSB) {
+				v = (uint32_t) ((((uint64_t) v) << count) | (_value >> (64 - count)));
+				_value <<= count;
+			} else {
+				v |= ((uint32_t) (_value & ((UINT64_C(1) << count) - 1))) << shift;
+				_value >>= count;
+				shift += count;
+			}
 
-			v >>= (32 - n);
+			_inValue = (_inValue + count) % valueBits;
+			n -= count;
 		}
 
 		return v;
 	}
 
+	/** Read a multi-bit value from the bit stream, without moving the stream position. */
+	uint32_t peekBits(size_t n) {
+		const size_t   streamPos = _stream->pos();
+		const uint64_t value     = _value;
+		const uint8_t  inValue   = _inValue;
+
+		const size_t available = MIN<size_t>(n, size() - pos());
+
+		uint32_t v = getBits(available);
+		if (isMSB2LSB && (available < n))
+			v <<= n - available;
+
+		_stream->seek(streamPos);
+		_value   = value;
+		_inValue = inValue;
+
+		return v;
+	}
+
 	/** Add a bit to the n-bit value x, making it an (n+1)-bit value. */
 	void addBit(uint32_t &x, size_t n) {
 		if (n >= 32)
@@ -209,6 +250,10 @@ public:
 			x = (x & ~(1 << n)) | (getBit() << n);
 	}
 
+	bool isMSBFirst() const {
+		return isMSB2LSB;
+	}
+
 	/** Rewind the bit stream back to the start. */
 	void rewind() {
 		_stream->seek(0);
@@ -219,8 +264,12 @@ public:
 
 	/** Skip the specified amount of bits. */
 	void skip(size_t n) {
-		while (n-- > 0)
-			getBit();
+		while (n > 0) {
+			const size_t count = MIN<size_t>(n, 32);
+
+			getBits(count);
+			n -= count;
+		}
 	}
 
 	/** Return the stream position in bits. */
@@ -242,6 +291,319 @@ public:
 	}
 };
 
+/**
+ * A bit stream reading directly out of memory.
+ *
+ * Hands out the bits in the same order as a BitStreamImpl with the same
+ * memory layout parameters, but instead of reading one value at a time
+ * through the data stream, it refills a 64-bit cache straight from memory.
+ *
+ * When created from a data stream, the stream's data is used directly if
+ * it's a MemoryReadStream, and read into memory first otherwise (see
+ * MemoryReader). Either way, the position of the data stream itself is
+ * not changed by reading bits.
+ */
+template<int valueBits, bool isLE, bool isMSB2LSB>
+class MemoryBitStreamImpl : boost::noncopyable, public BitStream {
+private:
+	/** Are the bits handed out in plain byte order, whatever the size of the values? */
+	static const bool kByteOrder = (valueBits == 8) || (isLE != isMSB2LSB);
+
+	DisposablePtr<SeekableReadStream> _stream; ///< The input stream, if any.
+	MemoryReader _reader;                      ///< The input data.
+
+	const byte *_data; ///< The input data.
+	size_t _size;      ///< The size of the input data in bytes, in whole values.
+	size_t _dataPos;   ///< The position of the next byte to move into the cache.
+
+	uint64_t _cache;     ///< The cached bits, in the order they're handed out.
+	size_t   _cacheBits; ///< Number of bits in the cache.
+
+	/** Read a data value. */
+	static inline uint64_t readData(const byte *data) {
+		if (isLE) {
+			if (valueBits ==  8)
+				return *data;
+			if (valueBits == 16)
+				return READ_LE_UINT16(data);
+			if (valueBits == 32)
+				return READ_LE_UINT32(data);
+			if (valueBits == 64)
+				return READ_LE_UINT64(data);
+		} else {
+			if (valueBits ==  8)
+				return *data;
+			if (valueBits == 16)
+				return READ_BE_UINT16(data);
+			if (valueBits == 32)
+				return READ_BE_UINT32(data);
+			if (valueBits == 64)
+				return (((uint64_t) READ_BE_UINT32(data)) << 32) | READ_BE_UINT32(data + 4);
+		}
+
+		assert(false);
+		return 0;
+	}
+
+	/** Fill up the cache with as many whole values as fit. */
+	inline void refill() {
+		if (kByteOrder) {
+			// The values are in byte order, so we can move in single bytes
+			if (_cacheBits > 56)
+				return;
+
+			if ((_size - _dataPos) >= 8) {
+				// Move as many bytes as fit with one 64-bit read
+				const size_t count = (64 - _cacheBits) >> 3;
+				const size_t bits  = count * 8;
+
+				if (isMSB2LSB) {
+					uint64_t value = (((uint64_t) READ_BE_UINT32(_data + _dataPos)) << 32) |
+					                 READ_BE_UINT32(_data + _dataPos + 4);
+					if (bits < 64)
+						value &= ~(~UINT64_C(0) >> bits);
+
+					_cache |= value >> _cacheBits;
+				} else {
+					uint64_t value = READ_LE_UINT64(_data + _dataPos);
+					if (bits < 64)
+						value &= (UINT64_C(1) << bits) - 1;
+
+					_cache |= value << _cacheBits;
+				}
+
+				_dataPos   += count;
+				_cacheBits += bits;
+				return;
+			}
+
+			while ((_cacheBits <= 56) && (_dataPos < _size)) {
+				if (isMSB2LSB)
+					_cache |= ((uint64_t) _data[_dataPos]) << (56 - _cacheBits);
+				else
+					_cache |= ((uint64_t) _data[_dataPos]) << _cacheBits;
+
+				_dataPos   += 1;
+				_cacheBits += 8;
+			}
+
+			return;
+		}
+
+		while ((_cacheBits <= (size_t) (64 - valueBits)) && ((_size - _dataPos) >= (valueBits >> 3))) {
+			const uint64_t value = readData(_data + _dataPos);
+
+			if (isMSB2LSB)
+				_cache |= (value << (64 - valueBits)) >> _cacheBits;
+			else
+				_cache |= value << _cacheBits;
+
+			_dataPos   += valueBits >> 3;
+			_cacheBits += valueBits;
+		}
+	}
+
+	/** Take n bits, 0 < n <= 32, out of the cache. */
+	inline uint32_t takeBits(size_t n) {
+		assert((n > 0) && (n <= 32) && (n <= _cacheBits));
+
+		uint32_t v;
+		if (isMSB2LSB) {
+			v = (uint32_t) (_cache >> (64 - n));
+			_cache <<= n;
+		} else {
+			v = (uint32_t) (_cache & ((UINT64_C(1) << n) - 1));
+			_cache >>= n;
+		}
+
+		_cacheBits -= n;
+		return v;
+	}
+
+	void init() {
+		if ((valueBits != 8) && (valueBits != 16) && (valueBits != 32) && (valueBits != 64))
+			throw Exception("BitStream: Invalid memory layout %d, %d, %d", valueBits, isLE, isMSB2LSB);
+
+		_data    = _reader.getData();
+		_size    = _reader.size() & ~((size_t) ((valueBits >> 3) - 1));
+		_dataPos = MIN(_reader.pos(), _size);
+
+		_cache     = 0;
+		_cacheBits = 0;
+	}
+
+public:
+	/** Create a bit stream reading from this block of memory, which is not copied. */
+	MemoryBitStreamImpl(const byte *data, size_t size) : _stream(0, false), _reader(data, size) {
+		init();
+	}
+
+	/** Create a bit stream using this input data stream and optionally delete it on destruction. */
+	MemoryBitStreamImpl(SeekableReadStream *stream, bool disposeAfterUse = false) :
+		_stream(stream, disposeAfterUse), _reader(*stream) {
+
+		init();
+	}
+
+	/** Create a bit stream using this input data stream. */
+	MemoryBitStreamImpl(SeekableReadStream &stream) : _stream(&stream, false), _reader(stream) {
+		init();
+	}
+
+	~MemoryBitStreamImpl() {
+	}
+
+	/** Read a bit from the bit stream. */
+	uint32_t getBit() {
+		if (_cacheBits == 0) {
+			refill();
+
+			if (_cacheBits == 0)
+				throw Exception("BitStream::getBit(): End of bit stream reached");
+		}
+
+		return takeBits(1);
+	}
+
+	/** Read a multi-bit value from the bit stream. */
+	uint32_t getBits(size_t n) {
+		if (n == 0)
+			return 0;
+
+		if (n > 32)
+			throw Exception("Too many bits requested to be read");
+
+		if (_cacheBits < n)
+			refill();
+
+		if (_cacheBits >= n)
+			return takeBits(n);
+
+		// Only 64-bit values, or the end of the stream, can leave the cache too short
+		if ((size() - pos()) < n)
+			throw Exception("BitStream::getBits(): End of bit stream reached");
+
+		const size_t first = _cacheBits;
+		const uint32_t v = (first > 0) ? takeBits(first) : 0;
+
+		refill();
+
+		if (isMSB2LSB)
+			return (uint32_t) ((((uint64_t) v) << (n - first)) | takeBits(n - first));
+
+		return v | (takeBits(n - first) << first);
+	}
+
+	/** Read a multi-bit value from the bit stream, without moving the stream position. */
+	uint32_t peekBits(size_t n) {
+		if (n == 0)
+			return 0;
+
+		if (n > 32)
+			throw Exception("Too many bits requested to be read");
+
+		if (_cacheBits < n)
+			refill();
+
+		if (_cacheBits >= n) {
+			if (isMSB2LSB)
+				return (uint32_t) (_cache >> (64 - n));
+
+			return (uint32_t) (_cache & ((UINT64_C(1) << n) - 1));
+		}
+
+		// Near the end of the stream, or when straddling 64-bit values
+		const uint64_t cache     = _cache;
+		const size_t   cacheBits = _cacheBits;
+		const size_t   dataPos   = _dataPos;
+
+		const size_t available = MIN<size_t>(n, size() - pos());
+
+		uint32_t v = getBits(available);
+		if (isMSB2LSB && (available < n))
+			v <<= n - available;
+
+		_cache     = cache;
+		_cacheBits = cacheBits;
+		_dataPos   = dataPos;
+
+		return v;
+	}
+
+	/** Add a bit to the n-bit value x, making it an (n+1)-bit value. */
+	void addBit(uint32_t &x, size_t n) {
+		if (n >= 32)
+			throw Exception("Too many bits requested to be read");
+
+		if (isMSB2LSB)
+			x = (x << 1) | getBit();
+		else
+			x = (x & ~(1 << n)) | (getBit() << n);
+	}
+
+	bool isMSBFirst() const {
+		return isMSB2LSB;
+	}
+
+	/** Rewind the bit stream back to the start. */
+	void rewind() {
+		_dataPos = 0;
+
+		_cache     = 0;
+		_cacheBits = 0;
+	}
+
+	/** Skip the specified amount of bits. */
+	void skip(size_t n) {
+		if (n > (size() - pos()))
+			throw Exception("BitStream::skip(): End of bit stream reached");
+
+		if (n <= _cacheBits) {
+			if (n == 64)
+				_cache = 0;
+			else if (isMSB2LSB)
+				_cache <<= n;
+			else
+				_cache >>= n;
+
+			_cacheBits -= n;
+			return;
+		}
+
+		// Drop the cache and skip whole values (or bytes) directly
+		n -= _cacheBits;
+
+		_cache     = 0;
+		_cacheBits = 0;
+
+		const size_t skipBits = kByteOrder ? 8 : valueBits;
+
+		_dataPos += (n / skipBits) * (skipBits >> 3);
+		n        %= skipBits;
+
+		while (n > 0) {
+			const size_t count = MIN<size_t>(n, 32);
+
+			getBits(count);
+			n -= count;
+		}
+	}
+
+	/** Return the stream position in bits. */
+	size_t pos() const {
+		return _dataPos * 8 - _cacheBits;
+	}
+
+	/** Return the stream size in bits. */
+	size_t size() const {
+		return _size * 8;
+	}
+
+	bool eos() const {
+		return pos() >= size();
+	}
+};
+
 // typedefs for various memory layouts.
 
 /** 8-bit data, MSB to LSB. */
@@ -276,6 +638,38 @@ typedef BitStreamImpl<64, false, true > BitStream64BEMSB;
 /** 64-bit big-endian data, LSB to MSB. */
 typedef BitStreamImpl<64, false, false> BitStream64BELSB;
 
+/** 8-bit data in memory, MSB to LSB. */
+typedef MemoryBitStreamImpl<8, false, true > MemoryBitStream8MSB;
+/** 8-bit data in memory, LSB to MSB. */
+typedef MemoryBitStreamImpl<8, false, false> MemoryBitStream8LSB;
+
+/** 16-bit little-endian data in memory, MSB to LSB. */
+typedef MemoryBitStreamImpl<16, true , true > MemoryBitStream16LEMSB;
+/** 16-bit little-endian data in memory, LSB to MSB. */
+typedef MemoryBitStreamImpl<16, true , false> MemoryBitStream16LELSB;
+/** 16-bit big-endian data in memory, MSB to LSB. */
+typedef MemoryBitStreamImpl<16, false, true > MemoryBitStream16BEMSB;
+/** 16-bit big-endian data in memory, LSB to MSB. */
+typedef MemoryBitStreamImpl<16, false, false> MemoryBitStream16BELSB;
+
+/** 32-bit little-endian data in memory, MSB to LSB. */
+typedef MemoryBitStreamImpl<32, true , true > MemoryBitStream32LEMSB;
+/** 32-bit little-endian data in memory, LSB to MSB. */
+typedef MemoryBitStreamImpl<32, true , false> MemoryBitStream32LELSB;
+/** 32-bit big-endian data in memory, MSB to LSB. */
+typedef MemoryBitStreamImpl<32, false, true > MemoryBitStream32BEMSB;
+/** 32-bit big-endian data in memory, LSB to MSB. */
+typedef MemoryBitStreamImpl<32, false, false> MemoryBitStream32BELSB;
+
+/** 64-bit little-endian data in memory, MSB to LSB. */
+typedef MemoryBitStreamImpl<64, true , true > MemoryBitStream64LEMSB;
+/** 64-bit little-endian data in memory, LSB to MSB. */
+typedef MemoryBitStreamImpl<64, true , false> MemoryBitStream64LELSB;
+/** 64-bit big-endian data in memory, MSB to LSB. */
+typedef MemoryBitStreamImpl<64, false, true > MemoryBitStream64BEMSB;
+/** 64-bit big-endian data in memory, LSB to MSB. */
+typedef MemoryBitStreamImpl<64, false, false> MemoryBitStream64BELSB;
+
 } // End of namespace Common
 
 #endif // COMMON_BITSTREAM_H
@@ -22,7 +22,7 @@
  *  Encryption / decryption using Bruce Schneier's Blowfish algorithm.
  */
 
-#include <cassert>
+#include <cstring>
 
 #include <memory>
 
@@ -233,46 +233,50 @@ static const uint32_t S[4][256] = {
 	}
 };
 
-static uint32_t F(const BlowfishContext &ctx, uint32_t x) {
-	const uint16_t d = (uint16_t)(x & 0xFF);
-	x >>= 8;
-	const uint16_t c = (uint16_t)(x & 0xFF);
-	x >>= 8;
-	const uint16_t b = (uint16_t)(x & 0xFF);
-	x >>= 8;
-	const uint16_t a = (uint16_t)(x & 0xFF);
-
-	return ((ctx.S[0][a] + ctx.S[1][b]) ^ ctx.S[2][c]) + ctx.S[3][d];
+static inline uint32_t F(const BlowfishContext &ctx, uint32_t x) {
+	return ((ctx.S[0][x >> 24] + ctx.S[1][(x >> 16) & 0xFF]) ^ ctx.S[2][(x >> 8) & 0xFF]) + ctx.S[3][x & 0xFF];
 }
 
-static void blowfishEnc(BlowfishContext &ctx, uint32_t &xl, uint32_t &xr) {
-	for (size_t i = 0; i < kRoundCount; i++) {
-		xl = xl ^ ctx.P[i];
-		xr = F(ctx, xl) ^ xr;
-
-		std::swap(xl, xr);
-	}
-
-	std::swap(xl, xr);
-
-	xr = xr ^ ctx.P[kRoundCount];
-	xl = xl ^ ctx.P[kRoundCount + 1];
+/* One Blowfish round, with the swapping of the halves folded into the
+ * order of the arguments. The 16 rounds are fully unrolled below. */
+#define BLOWFISH_ROUND(a, b, n) a ^= F(ctx, b) ^ ctx.P[n]
+
+static inline void blowfishEnc(const BlowfishContext &ctx, uint32_t &xl, uint32_t &xr) {
+	uint32_t l = xl ^ ctx.P[0];
+	uint32_t r = xr;
+
+	BLOWFISH_ROUND(r, l,  1); BLOWFISH_ROUND(l, r,  2);
+	BLOWFISH_ROUND(r, l,  3); BLOWFISH_ROUND(l, r,  4);
+	BLOWFISH_ROUND(r, l,  5); BLOWFISH_ROUND(l, r,  6);
+	BLOWFISH_ROUND(r, l,  7); BLOWFISH_ROUND(l, r,  8);
+	BLOWFISH_ROUND(r, l,  9); BLOWFISH_ROUND(l, r, 10);
+	BLOWFISH_ROUND(r, l, 11); BLOWFISH_ROUND(l, r, 12);
+	BLOWFISH_ROUND(r, l, 13); BLOWFISH_ROUND(l, r, 14);
+	BLOWFISH_ROUND(r, l, 15); BLOWFISH_ROUND(l, r, 16);
+
+	xl = r ^ ctx.P[kRoundCount + 1];
+	xr = l;
 }
 
-static void blowfishDec(BlowfishContext &ctx, uint32_t &xl, uint32_t &xr) {
-	for (size_t i = kRoundCount + 1; i > 1; i--) {
-		xl = xl ^ ctx.P[i];
-		xr = F(ctx, xl) ^ xr;
-
-		std::swap(xl, xr);
-	}
-
-	std::swap(xl, xr);
-
-	xr = xr ^ ctx.P[1];
-	xl = xl ^ ctx.P[0];
+static inline void blowfishDec(const BlowfishContext &ctx, uint32_t &xl, uint32_t &xr) {
+	uint32_t l = xl ^ ctx.P[kRoundCount + 1];
+	uint32_t r = xr;
+
+	BLOWFISH_ROUND(r, l, 16); BLOWFISH_ROUND(l, r, 15);
+	BLOWFISH_ROUND(r, l, 14); BLOWFISH_ROUND(l, r, 13);
+	BLOWFISH_ROUND(r, l, 12); BLOWFISH_ROUND(l, r, 11);
+	BLOWFISH_ROUND(r, l, 10); BLOWFISH_ROUND(l, r,  9);
+	BLOWFISH_ROUND(r, l,  8); BLOWFISH_ROUND(l, r,  7);
+	BLOWFISH_ROUND(r, l,  6); BLOWFISH_ROUND(l, r,  5);
+	BLOWFISH_ROUND(r, l,  4); BLOWFISH_ROUND(l, r,  3);
+	BLOWFISH_ROUND(r, l,  2); BLOWFISH_ROUND(l, r,  1);
+
+	xl = r ^ ctx.P[0];
+	xr = l;
 }
 
+#undef BLOWFISH_ROUND
+
 static void blowfishSetKey(BlowfishContext &ctx, const byte *key, size_t keyLength) {
 	if ((keyLength < kMinKeyLength) || (keyLength > kMaxKeyLength))
 		throw Exception("Invalid Blowfish key length %u", (uint) keyLength);
@@ -315,68 +319,148 @@ static void blowfishSetKey(BlowfishContext &ctx, const byte *key, size_t keyLeng
 	}
 }
 
-static void blowfishECB(BlowfishContext &ctx, Mode mode, const byte *input, byte *output) {
-	uint32_t X0 = READ_BE_UINT32(input);
-	uint32_t X1 = READ_BE_UINT32(input + 4);
+static void blowfishECB(const BlowfishContext &ctx, Mode mode, const byte *input, byte *output, size_t size) {
+	/* The blocks are independent of each other, so the CPU is free to work
+	 * on several of them at once. */
+
+	for (; size >= kBlockSize; size -= kBlockSize, input += kBlockSize, output += kBlockSize) {
+		uint32_t X0 = READ_BE_UINT32(input);
+		uint32_t X1 = READ_BE_UINT32(input + 4);
 
-	switch (mode) {
-		case kModeDecrypt:
+		if (mode == kModeEncrypt)
+			blowfishEnc(ctx, X0, X1);
+		else
 			blowfishDec(ctx, X0, X1);
-			break;
-		case kModeEncrypt:
+
+		WRITE_BE_UINT32(output    , X0);
+		WRITE_BE_UINT32(output + 4, X1);
+	}
+}
+
+static void blowfishCBC(const BlowfishContext &ctx, Mode mode, const byte *input, byte *output, size_t size,
+                        byte *iv) {
+
+	uint32_t IV0 = READ_BE_UINT32(iv);
+	uint32_t IV1 = READ_BE_UINT32(iv + 4);
+
+	for (; size >= kBlockSize; size -= kBlockSize, input += kBlockSize, output += kBlockSize) {
+		uint32_t X0 = READ_BE_UINT32(input);
+		uint32_t X1 = READ_BE_UINT32(input + 4);
+
+		if (mode == kModeEncrypt) {
+			X0 ^= IV0;
+			X1 ^= IV1;
+
 			blowfishEnc(ctx, X0, X1);
-			break;
 
-		default:
-			assert(false);
+			IV0 = X0;
+			IV1 = X1;
+
+		} else {
+			const uint32_t C0 = X0;
+			const uint32_t C1 = X1;
+
+			blowfishDec(ctx, X0, X1);
+
+			X0 ^= IV0;
+			X1 ^= IV1;
+
+			IV0 = C0;
+			IV1 = C1;
+		}
+
+		WRITE_BE_UINT32(output    , X0);
+		WRITE_BE_UINT32(output + 4, X1);
 	}
 
-	WRITE_BE_UINT32(output    , X0);
-	WRITE_BE_UINT32(output + 4, X1);
+	WRITE_BE_UINT32(iv    , IV0);
+	WRITE_BE_UINT32(iv + 4, IV1);
 }
 // '--- Blowfish, based on the implementation from mbed TLS ---'
 
-MemoryReadStream *blowfishEBC(SeekableReadStream &input, const std::vector<byte> &key, Mode mode) {
-	BlowfishContext ctx;
 
-	blowfishSetKey(ctx, &key[0], key.size());
+Blowfish::Blowfish(const std::vector<byte> &key) : _ctx(std::make_unique<BlowfishContext>()) {
+	if (key.empty())
+		throw Exception("Invalid Blowfish key length 0");
+
+	blowfishSetKey(*_ctx, &key[0], key.size());
+}
+
+Blowfish::~Blowfish() {
+}
+
+static void checkBlockSize(size_t size) {
+	if ((size % kBlockSize) != 0)
+		throw Exception("Blowfish operates on blocks of 8 bytes (%u)", (uint) size);
+}
+
+void Blowfish::encryptECB(const byte *input, byte *output, size_t size) const {
+	checkBlockSize(size);
+
+	blowfishECB(*_ctx, kModeEncrypt, input, output, size);
+}
+
+void Blowfish::decryptECB(const byte *input, byte *output, size_t size) const {
+	checkBlockSize(size);
+
+	blowfishECB(*_ctx, kModeDecrypt, input, output, size);
+}
+
+void Blowfish::encryptCBC(const byte *input, byte *output, size_t size, byte *iv) const {
+	checkBlockSize(size);
+
+	blowfishCBC(*_ctx, kModeEncrypt, input, output, size, iv);
+}
 
-	size_t inputSize = input.size() - input.pos();
+void Blowfish::decryptCBC(const byte *input, byte *output, size_t size, byte *iv) const {
+	checkBlockSize(size);
+
+	blowfishCBC(*_ctx, kModeDecrypt, input, output, size, iv);
+}
+
+
+static MemoryReadStream *blowfishEBC(SeekableReadStream &input, const Blowfish &blowfish, Mode mode) {
+	const size_t inputSize = input.size() - input.pos();
 
 	// Round up to the next multiple of the block size
 	const size_t outputSize = ((inputSize + kBlockSize - 1) / kBlockSize) * kBlockSize;
 
 	std::unique_ptr<byte[]> output = std::make_unique<byte[]>(outputSize);
 
-	byte buffer[kBlockSize];
-	byte *data = output.get();
-	while (inputSize > 0) {
-		const size_t toRead = MIN<size_t>(inputSize, kBlockSize);
+	// Read everything at once, pad it with zeroes and then work on it in place
+	if (input.read(output.get(), inputSize) != inputSize)
+		throw Exception(kReadError);
 
-		if (input.read(buffer, toRead) != toRead)
-			throw Exception(kReadError);
+	std::memset(output.get() + inputSize, 0, outputSize - inputSize);
 
-		if (toRead < kBlockSize)
-			std::memset(buffer + toRead, 0, kBlockSize - toRead);
-
-		blowfishECB(ctx, mode, buffer, data);
-
-		data      += toRead;
-		inputSize -= toRead;
-	}
+	if (mode == kModeEncrypt)
+		blowfish.encryptECB(output.get(), output.get(), outputSize);
+	else
+		blowfish.decryptECB(output.get(), output.get(), outputSize);
 
 	return new MemoryReadStream(output.release(), outputSize, true);
 }
 
 MemoryReadStream *encryptBlowfishEBC(SeekableReadStream &input, const std::vector<byte> &key) {
-	return blowfishEBC(input, key, kModeEncrypt);
+	return blowfishEBC(input, Blowfish(key), kModeEncrypt);
 }
 
 MemoryReadStream *decryptBlowfishEBC(SeekableReadStream &input, const std::vector<byte> &key) {
 	if ((input.size() % 8) != 0)
 		throw Exception("Blowfish operates on blocks of 8 bytes (%u)", (uint) input.size());
 
-	return blowfishEBC(input, key, kModeDecrypt);
+	return blowfishEBC(input, Blowfish(key), kModeDecrypt);
+}
+
+MemoryReadStream *encryptBlowfishEBC(SeekableReadStream &input, const Blowfish &blowfish) {
+	return blowfishEBC(input, blowfish, kModeEncrypt);
+}
+
+MemoryReadStream *decryptBlowfishEBC(SeekableReadStream &input, const Blowfish &blowfish) {
+	if ((input.size() % 8) != 0)
+		throw Exception("Blowfish operates on blocks of 8 bytes (%u)", (uint) input.size());
+
+	return blowfishEBC(input, blowfish, kModeDecrypt);
 }
 
 } // End of namespace Common
@@ -26,6 +26,9 @@
 #define COMMON_BLOWFISH_H
 
 #include <vector>
+#include <memory>
+
+#include <boost/noncopyable.hpp>
 
 #include "src/common/types.h"
 
@@ -34,11 +37,46 @@ namespace Common {
 class SeekableReadStream;
 class MemoryReadStream;
 
+struct BlowfishContext;
+
+/** A Blowfish cipher with an already expanded key.
+ *
+ *  Expanding a key is costly, so a cipher should be kept around for
+ *  as long as its key is used. Encrypting and decrypting doesn't change
+ *  the cipher, so one cipher can be used by several threads at once.
+ *
+ *  All functions work on whole blocks of 8 bytes. input and output may
+ *  point to the same buffer.
+ */
+class Blowfish : boost::noncopyable {
+public:
+	Blowfish(const std::vector<byte> &key);
+	~Blowfish();
+
+	/** Encrypt size bytes in ECB mode. */
+	void encryptECB(const byte *input, byte *output, size_t size) const;
+	/** Decrypt size bytes in ECB mode. */
+	void decryptECB(const byte *input, byte *output, size_t size) const;
+
+	/** Encrypt size bytes in CBC mode, updating the 8-byte initialization vector to continue the chain. */
+	void encryptCBC(const byte *input, byte *output, size_t size, byte *iv) const;
+	/** Decrypt size bytes in CBC mode, updating the 8-byte initialization vector to continue the chain. */
+	void decryptCBC(const byte *input, byte *output, size_t size, byte *iv) const;
+
+private:
+	std::unique_ptr<BlowfishContext> _ctx;
+};
+
 /** Encrypt the stream with the Blowfish algorithm in EBC mode. */
 MemoryReadStream *encryptBlowfishEBC(SeekableReadStream &input, const std::vector<byte> &key);
 /** Decrypt the stream with the Blowfish algorithm in EBC mode. */
 MemoryReadStream *decryptBlowfishEBC(SeekableReadStream &input, const std::vector<byte> &key);
 
+/** Encrypt the stream with this Blowfish cipher in EBC mode. */
+MemoryReadStream *encryptBlowfishEBC(SeekableReadStream &input, const Blowfish &blowfish);
+/** Decrypt the stream with this Blowfish cipher in EBC mode. */
+MemoryReadStream *decryptBlowfishEBC(SeekableReadStream &input, const Blowfish &blowfish);
+
 } // End of namespace Common
 
 #endif // COMMON_BLOWFISH_H
@@ -25,6 +25,7 @@
  */
 
 #include <cassert>
+#include <atomic>
 
 #include "src/common/configman.h"
 #include "src/common/strutil.h"
@@ -39,9 +40,14 @@ namespace Common {
 
 const char *ConfigManager::kDomainApp = "xoreos";
 
+/** Increased with every change to any domain, of any config manager instance. */
+static std::atomic<uint32_t> _generation(1);
+
 ConfigManager::ConfigManager() : _changed(false), _domainApp(0), _domainGame(0) {
 	_domainDefaultApp = std::make_unique<ConfigDomain>("appDefault");
 	_domainCommandline = std::make_unique<ConfigDomain>("commandline");
+
+	increaseGeneration();
 }
 
 ConfigManager::~ConfigManager() {
@@ -62,10 +68,14 @@ void ConfigManager::clear() {
 	_domainDefaultApp = std::make_unique<ConfigDomain>("appDefault");
 
 	_config.reset();
+
+	increaseGeneration();
 }
 
 void ConfigManager::clearCommandline() {
 	_domainCommandline = std::make_unique<ConfigDomain>("commandline");
+
+	increaseGeneration();
 }
 
 bool ConfigManager::fileExists() const {
@@ -76,6 +86,10 @@ bool ConfigManager::changed() const {
 	return _changed;
 }
 
+uint32_t ConfigManager::getGeneration() const {
+	return _generation.load(std::memory_order_acquire);
+}
+
 bool ConfigManager::load() {
 	clear();
 
@@ -109,6 +123,8 @@ void ConfigManager::load(SeekableReadStream &stream) {
 
 	// Get the application domain
 	_domainApp = _config->addDomain(kDomainApp);
+
+	increaseGeneration();
 }
 
 bool ConfigManager::save() {
@@ -156,6 +172,8 @@ void ConfigManager::create() {
 	_config = std::make_unique<ConfigFile>();
 
 	_domainApp = _config->addDomain(kDomainApp);
+
+	increaseGeneration();
 }
 
 UString ConfigManager::findGame(const UString &path) {
@@ -244,6 +262,8 @@ bool ConfigManager::setGame(const UString &gameID) {
 	_domainGameTemp.reset();
 	_domainGame = 0;
 
+	increaseGeneration();
+
 	if (gameID.empty())
 		// No ID specified, work done
 		return true;
@@ -383,7 +403,8 @@ double ConfigManager::getDouble(const UString &key, double def) const {
 
 void ConfigManager::setKey(const UString &key, const UString &value, bool update) {
 	// Commandline options always get overwritten
-	_domainCommandline->removeKey(key);
+	if (_domainCommandline->removeKey(key))
+		increaseGeneration();
 
 	if (update) {
 		// Don't do anything if we only want to update a value and there's no change
@@ -463,6 +484,8 @@ void ConfigManager::setDefaults() {
 
 	// Resetting to defaults => We've got changes
 	_changed = true;
+
+	increaseGeneration();
 }
 
 bool ConfigManager::hasDefaultKey(const UString &key) const {
@@ -522,6 +545,10 @@ UString ConfigManager::getDefaultConfigFile() {
 	return FilePath::getConfigDirectory() + "/xoreos.conf";
 }
 
+void ConfigManager::increaseGeneration() {
+	_generation.fetch_add(1, std::memory_order_release);
+}
+
 bool ConfigManager::hasKey(const ConfigDomain *domain, const UString &key) const {
 	return domain && domain->hasKey(key);
 }
@@ -535,6 +562,8 @@ bool ConfigManager::setKey(ConfigDomain *domain, const UString &key, const UStri
 		return false;
 
 	domain->setKey(key, value);
+	increaseGeneration();
+
 	return true;
 }
 
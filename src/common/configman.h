@@ -71,6 +71,13 @@ public:
 	/** Was at least on setting changed? */
 	bool changed() const;
 
+	/** Return a number that changes whenever any config value might have changed.
+	 *
+	 *  Used by ConfigValue to know when to look up its key again. The number
+	 *  also changes when the config manager is destroyed and created anew.
+	 */
+	uint32_t getGeneration() const;
+
 	/** Load from the default config file. */
 	bool load();
 	/** Load from a generic read stream. */
@@ -166,6 +173,8 @@ private:
 	UString createGameID(const UString &path);
 
 	// Helpers
+	void increaseGeneration();
+
 	bool hasKey(const ConfigDomain *domain, const UString &key) const;
 	bool getKey(const ConfigDomain *domain, const UString &key, UString &value) const;
 	bool setKey(ConfigDomain *domain, const UString &key, const UString &value);
@@ -0,0 +1,101 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A cached handle to a config value.
+ */
+
+#ifndef COMMON_CONFIGVALUE_H
+#define COMMON_CONFIGVALUE_H
+
+#include <atomic>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+#include "src/common/mutex.h"
+#include "src/common/configman.h"
+
+namespace Common {
+
+/** A config value of a specific type, looked up once and then cached.
+ *
+ *  Looking up a key in the config manager walks through all config domains,
+ *  comparing strings. A ConfigValue only does that on the first read, and
+ *  again after anything in the config manager changed. In between, reading
+ *  the value only compares the config manager's generation counter.
+ *
+ *  Like the config manager itself, a ConfigValue can be read from several
+ *  threads, as long as nobody changes the config at the same time.
+ */
+template<typename T>
+class ConfigValue : boost::noncopyable {
+public:
+	ConfigValue(const UString &key, const T &def) : _key(key), _default(def), _value(def), _generation(0) {
+	}
+
+	/** Return the current value of the config key, or the default if it isn't set. */
+	T get() const {
+		const uint32_t generation = ConfigMan.getGeneration();
+
+		if (_generation.load(std::memory_order_acquire) != generation)
+			update(generation);
+
+		return _value;
+	}
+
+	operator T() const {
+		return get();
+	}
+
+	const UString &getKey() const {
+		return _key;
+	}
+
+private:
+	const UString _key;
+	const T _default;
+
+	mutable T _value;
+	mutable std::atomic<uint32_t> _generation; ///< The config generation _value was read in.
+
+	mutable std::mutex _mutex;
+
+	void update(uint32_t generation) const {
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		// Somebody else might have been faster
+		if (_generation.load(std::memory_order_relaxed) == generation)
+			return;
+
+		_value = read(_key, _default);
+		_generation.store(generation, std::memory_order_release);
+	}
+
+	static bool    read(const UString &key, bool           def) { return ConfigMan.getBool  (key, def); }
+	static int     read(const UString &key, int            def) { return ConfigMan.getInt   (key, def); }
+	static double  read(const UString &key, double         def) { return ConfigMan.getDouble(key, def); }
+	static UString read(const UString &key, const UString &def) { return ConfigMan.getString(key, def); }
+};
+
+} // End of namespace Common
+
+#endif // COMMON_CONFIGVALUE_H
@@ -19,7 +19,7 @@
  */
 
 /** @file
- *  Static cosine tables.
+ *  Cosine tables, computed on first use.
  */
 
 #ifndef COMMON_COSINETABLES_H
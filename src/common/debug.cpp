@@ -31,30 +31,7 @@
 #include "src/common/debug.h"
 #include "src/common/debugman.h"
 
-void debugC(Common::DebugChannel channel, uint32_t level, const char *s, ...) {
-	if (!DebugMan.isEnabled(channel, level))
-		return;
-
-	char buf[STRINGBUFLEN];
-	va_list va;
-
-	va_start(va, s);
-	vsnprintf(buf, STRINGBUFLEN, s, va);
-	va_end(va);
-
-#ifndef DISABLE_TEXT_CONSOLE
-	std::fputs(buf, stderr);
-	std::fputs("\n", stderr);
-#endif
-
-	DebugMan.logString(buf);
-	DebugMan.logString("\n");
-}
-
-void debugCN(Common::DebugChannel channel, uint32_t level, const char *s, ...) {
-	if (!DebugMan.isEnabled(channel, level))
-		return;
-
+void debugOutput(bool newline, const char *s, ...) {
 	char buf[STRINGBUFLEN];
 	va_list va;
 
@@ -64,7 +41,11 @@ void debugCN(Common::DebugChannel channel, uint32_t level, const char *s, ...) {
 
 #ifndef DISABLE_TEXT_CONSOLE
 	std::fputs(buf, stderr);
+	if (newline)
+		std::fputs("\n", stderr);
 #endif
 
 	DebugMan.logString(buf);
+	if (newline)
+		DebugMan.logString("\n");
 }
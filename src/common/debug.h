@@ -39,8 +39,16 @@
  *  The debug message is printed to both stderr and the global log file
  *  (if a global log file has been opened). See Common::DebugManager for
  *  details.
+ *
+ *  This is a macro: when the channel isn't enabled at this level, the
+ *  message arguments aren't even evaluated. Messages above the level
+ *  XOREOS_DEBUG_MAX_LEVEL are removed completely.
  */
-void debugC(Common::DebugChannel channel, uint32_t level, const char *s, ...) GCC_PRINTF(3, 4);
+#define debugC(channel, level, ...) \
+	do { \
+		if (Common::DebugManager::isChannelEnabled((channel), (level))) \
+			debugOutput(true, __VA_ARGS__); \
+	} while (0)
 
 /** Print a debug message, but only if the current debug level is at least
  *  the specified level for the specified channel.
@@ -50,7 +58,21 @@ void debugC(Common::DebugChannel channel, uint32_t level, const char *s, ...) GC
  *  The debug message is printed to both stderr and the global log file
  *  (if a global log file has been opened). See Common::DebugManager for
  *  details.
+ *
+ *  Like debugC(), this doesn't evaluate the message arguments when the
+ *  channel isn't enabled at this level.
+ */
+#define debugCN(channel, level, ...) \
+	do { \
+		if (Common::DebugManager::isChannelEnabled((channel), (level))) \
+			debugOutput(false, __VA_ARGS__); \
+	} while (0)
+
+/** Unconditionally print a debug message, optionally appending a newline.
+ *
+ *  Used by debugC() and debugCN(), once they decided the message should
+ *  be shown.
  */
-void debugCN(Common::DebugChannel channel, uint32_t level, const char *s, ...) GCC_PRINTF(3, 4);
+void debugOutput(bool newline, const char *s, ...) GCC_PRINTF(2, 3);
 
 #endif // COMMON_DEBUG_H
@@ -39,7 +39,7 @@ DECLARE_SINGLETON(Common::DebugManager)
 namespace Common {
 
 static const char * const kDebugNames[kDebugChannelCount] = {
-	"GGraphics", "GSound", "GVideo", "GEvents", "GScripts",
+	"GGraphics", "GSound", "GVideo", "GEvents", "GScripts", "GResources",
 	"GGLAPI", "GGLWindow", "GGLShader", "GGL3rd", "GGLApp", "GGLOther",
 	"EGraphics", "ESound", "EVideo", "EEvents", "ELogic", "EScripts", "EActionScript"
 };
@@ -50,6 +50,7 @@ static const char * const kDebugDescriptions[kDebugChannelCount] = {
 	"Global video (movies) debug channel",
 	"Global events debug channel",
 	"Global scripts debug channel",
+	"Global resource management debug channel",
 	"OpenGL debug message generated by the GL",
 	"OpenGL debug message generated by the windowing system",
 	"OpenGL debug message generated by the shader compiler",
@@ -69,11 +70,25 @@ static const char * const kDebugGLTypes[kDebugGLTypeMAX] = {
 	"Error", "Deprecated", "Undefined", "Portability", "Performance", "Other"
 };
 
-DebugManager::DebugManager() : _logFileStartLine(false), _changedConfig(false) {
+static const char * const kMetricNames[kMetricCount] = {
+	"ResourcesFetched", "BytesDecompressed", "TexturesUploaded", "TextureBinds", "ScriptsExecuted",
+	"PathNodesExpanded", "SoundBuffersRefilled", "VideoFramesDropped",
+	"SoundChannels", "SoundVirtualChannels", "ResourceCacheSize"
+};
+
+/** The first metric that's a gauge instead of a counter. */
+static const DebugMetric kFirstMetricGauge = kMetricSoundChannels;
+
+std::atomic<uint32_t> DebugManager::_levels[kDebugChannelCount];
+
+std::atomic<bool>     DebugManager::_metricsEnabled(false);
+std::atomic<uint64_t> DebugManager::_metrics[kMetricCount];
+
+DebugManager::DebugManager() : _changedConfig(false), _metricsLogInterval(0) {
 	for (size_t i = 0; i < kDebugChannelCount; i++) {
 		_channels[i].name        = kDebugNames[i];
 		_channels[i].description = kDebugDescriptions[i];
-		_channels[i].level       = 0;
+		_levels[i] = 0;
 
 		for (size_t j = 0; j < kDebugGLTypeMAX; j++)
 			_channels[i].glTypeIDs[j] = 0;
@@ -82,6 +97,8 @@ DebugManager::DebugManager() : _logFileStartLine(false), _changedConfig(false) {
 	}
 
 	_channelMap["all"] = kDebugChannelAll;
+
+	clearMetrics();
 }
 
 DebugManager::~DebugManager() {
@@ -109,7 +126,7 @@ void DebugManager::setVerbosityLevel(DebugChannel channel, uint32_t level) {
 	if (channel >= kDebugChannelCount)
 		return;
 
-	_channels[channel].level = MIN<uint32_t>(level, kMaxVerbosityLevel);
+	_levels[channel] = MIN<uint32_t>(level, kMaxVerbosityLevel);
 
 	for (size_t i = 0; i < kDebugGLTypeMAX; i++)
 		_channels[channel].glTypeIDs[i] = 0;
@@ -129,7 +146,7 @@ uint32_t DebugManager::getVerbosityLevel(DebugChannel channel) const {
 	if (channel >= kDebugChannelCount)
 		return 0;
 
-	return _channels[channel].level;
+	return _levels[channel];
 }
 
 uint32_t DebugManager::getVerbosityLevel(const UString &channel) const {
@@ -141,7 +158,7 @@ uint32_t DebugManager::getVerbosityLevel(const UString &channel) const {
 }
 
 bool DebugManager::isEnabled(DebugChannel channel, uint32_t level) const {
-	return getVerbosityLevel(channel) >= MIN<uint32_t>(level, kMaxVerbosityLevel);
+	return isChannelEnabled(channel, level);
 }
 
 bool DebugManager::isEnabled(const UString &channel, uint32_t level) const {
@@ -183,13 +200,13 @@ void DebugManager::setConfigToVerbosityLevels() {
 	UString debug;
 
 	for (size_t i = 0; i < kDebugChannelCount; i++) {
-		if (_channels[i].level == 0)
+		if (_levels[i] == 0)
 			continue;
 
 		if (!debug.empty())
 			debug += ',';
 
-		debug += _channels[i].name + ":" + composeString(_channels[i].level);
+		debug += _channels[i].name + ":" + composeString(_levels[i].load());
 	}
 
 	ConfigMan.setString("debug", debug, true);
@@ -220,8 +237,6 @@ void DebugManager::logDebugGL(DebugChannel channel, uint32_t level, DebugGLType
 bool DebugManager::openLogFile(const UString &file) {
 	closeLogFile();
 
-	_logFileStartLine = true;
-
 	// Create the directories in the path, if necessary
 	UString path = FilePath::canonicalize(file);
 
@@ -237,6 +252,12 @@ bool DebugManager::openLogFile(const UString &file) {
 	logString(Version::getProjectNameVersionFull());
 	logString("\n");
 
+	// The lines themselves only carry the time since the log was opened
+	try {
+		logString("Log opened at " + DateTime(DateTime::kUTC).formatDateTimeISO('T', '-', ':') + "\n");
+	} catch (...) {
+	}
+
 	return true;
 }
 
@@ -245,34 +266,24 @@ void DebugManager::closeLogFile() {
 }
 
 void DebugManager::logString(const UString &str) {
-	if (!_logFile.isOpen())
+	if (!_logFile.isOpen() || str.empty())
 		return;
 
-	// If we're at the start of a new line, write the timestamp
-	if (_logFileStartLine) {
-		UString tstamp;
+	// The line the current thread is still writing
+	static thread_local UString line;
 
-		try {
-			tstamp = "[" + DateTime(DateTime::kUTC).formatDateTimeISO('T', '-', ':') + "] ";
-		} catch (...) {
-			tstamp = "[0000-00-00T00:00:00] ";
-		}
-
-		_logFile.writeString(tstamp);
-	}
-
-	_logFile.writeString(str);
+	line += str;
 
-	// Find out whether we just started a new line. If this fails, force one
+	// Find out whether we just finished a line. If this fails, force one
 	try {
-		_logFileStartLine = !str.empty() && (*--str.end() == '\n');
+		if (*--str.end() != '\n')
+			return;
 	} catch (...) {
-		_logFile.writeString("\n");
-		_logFileStartLine = true;
+		line += "\n";
 	}
 
-	if (_logFileStartLine)
-		_logFile.flush();
+	_logFile.write(line);
+	line.clear();
 }
 
 void DebugManager::logCommandLine(const std::vector<UString> &argv) {
@@ -284,6 +295,70 @@ void DebugManager::logCommandLine(const std::vector<UString> &argv) {
 	logString("\n");
 }
 
+void DebugManager::setMetricsEnabled(bool enabled) {
+	_metricsEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool DebugManager::isMetricsEnabled() const {
+	return _metricsEnabled.load(std::memory_order_relaxed);
+}
+
+void DebugManager::clearMetrics() {
+	for (size_t i = 0; i < kMetricCount; i++) {
+		_metrics[i] = 0;
+		_metricsLogged[i] = 0;
+	}
+
+	_metricsLogTime = std::chrono::steady_clock::now();
+}
+
+void DebugManager::setMetricsLogInterval(uint32_t seconds) {
+	_metricsLogInterval = seconds;
+	_metricsLogTime     = std::chrono::steady_clock::now();
+}
+
+void DebugManager::updateMetrics() {
+	if ((_metricsLogInterval == 0) || !isMetricsEnabled() || !_logFile.isOpen())
+		return;
+
+	const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	const std::chrono::duration<double> elapsed = now - _metricsLogTime;
+
+	if (elapsed.count() < _metricsLogInterval)
+		return;
+
+	logMetrics(elapsed.count());
+
+	_metricsLogTime = now;
+}
+
+void DebugManager::logMetrics(double seconds) {
+	UString line = "Metrics:";
+
+	for (size_t i = 0; i < kMetricCount; i++) {
+		const uint64_t value = getMetric((DebugMetric) i);
+
+		line += UString::format(" %s=%s", kMetricNames[i], composeString(value).c_str());
+		if (!isMetricGauge((DebugMetric) i))
+			line += UString::format(" (%.1f/s)", (value - _metricsLogged[i]) / seconds);
+
+		_metricsLogged[i] = value;
+	}
+
+	logString(line + "\n");
+}
+
+const char *DebugManager::getMetricName(DebugMetric metric) {
+	if (metric >= kMetricCount)
+		return "";
+
+	return kMetricNames[metric];
+}
+
+bool DebugManager::isMetricGauge(DebugMetric metric) {
+	return metric >= kFirstMetricGauge;
+}
+
 UString DebugManager::getDefaultLogFile() {
 	// By default, put the log file into the user data directory
 	return FilePath::getUserDataDirectory() + "/xoreos.log";
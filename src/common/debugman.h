@@ -29,11 +29,23 @@
 
 #include <vector>
 #include <map>
+#include <atomic>
+#include <chrono>
 
+#include "src/common/system.h"
 #include "src/common/types.h"
 #include "src/common/ustring.h"
 #include "src/common/singleton.h"
-#include "src/common/writefile.h"
+#include "src/common/logwriter.h"
+
+/** The most verbose debug message level that's compiled in at all.
+ *
+ *  Debug messages above this level are removed by the compiler, and can't
+ *  be enabled at runtime. Defaults to all levels.
+ */
+#ifndef XOREOS_DEBUG_MAX_LEVEL
+	#define XOREOS_DEBUG_MAX_LEVEL 9
+#endif
 
 namespace Common {
 
@@ -44,6 +56,7 @@ enum DebugChannel {
 	kDebugVideo   , ///< "GVideo", global, non-engine video (movies).
 	kDebugEvents  , ///< "GEvents", global, non-engine events.
 	kDebugScripts , ///< "GScripts", global, non-engine scripts.
+	kDebugResources, ///< "GResources", global resource management.
 
 	kDebugGLAPI   , ///< "GGLAPI", OpenGL debug message generated by the GL.
 	kDebugGLWindow, ///< "GGLWindow", OpenGL debug message generated by the windowing system.
@@ -77,6 +90,22 @@ enum DebugGLType {
 	kDebugGLTypeMAX ///< For range checks.
 };
 
+/** All metrics, counting what happens in hot paths. */
+enum DebugMetric {
+	kMetricResourcesFetched     , ///< "ResourcesFetched", counter of resources read out of the ResourceManager.
+	kMetricBytesDecompressed    , ///< "BytesDecompressed", counter of bytes of compressed resources unpacked.
+	kMetricTexturesUploaded     , ///< "TexturesUploaded", counter of textures (fully) uploaded to the GPU.
+	kMetricTextureBinds         , ///< "TextureBinds", counter of textures bound by the TextureManager.
+	kMetricScriptsExecuted      , ///< "ScriptsExecuted", counter of NWScript runs.
+	kMetricPathNodesExpanded    , ///< "PathNodesExpanded", counter of A* nodes taken off the open list.
+	kMetricSoundBuffersRefilled , ///< "SoundBuffersRefilled", counter of OpenAL buffers filled with samples.
+	kMetricVideoFramesDropped   , ///< "VideoFramesDropped", counter of late video frames never shown.
+	kMetricSoundChannels        , ///< "SoundChannels", gauge of the sound channels in use.
+	kMetricSoundVirtualChannels , ///< "SoundVirtualChannels", gauge of the sound channels without an OpenAL source.
+	kMetricResourceCacheSize    , ///< "ResourceCacheSize", gauge of the bytes in the resource cache.
+	kMetricCount                  ///< Total number of metrics.
+};
+
 /** The debug manager, managing debug channels.
  *
  *  A debug channel separates debug messages into groups, so debug output
@@ -104,6 +133,13 @@ enum DebugGLType {
  *  exceeds the current level of C1, which is 3. Likewise, the level of
  *  message 3, 1, exceeds the current level of C2. In fact, with a
  *  current level of 0, no messages will be shown for C2 at all, ever.
+ *
+ *  Additionally, the debug manager holds a fixed set of metrics: counters
+ *  that only ever go up, like the number of scripts executed, and gauges
+ *  that hold a current value, like the number of sound channels in use.
+ *  While metrics are disabled, updating them costs a single relaxed atomic
+ *  load. While enabled, their values can be written to the log file at
+ *  regular intervals.
  */
 class DebugManager : public Singleton<DebugManager> {
 public:
@@ -130,6 +166,22 @@ public:
 	/** Is this channel name enabled for this verbosity level? */
 	bool isEnabled(const UString &channel, uint32_t level) const;
 
+	/** Is this channel ID enabled for this verbosity level?
+	 *
+	 *  Same as isEnabled(), but doesn't need the debug manager instance.
+	 *  It only reads one atomic, so it's cheap enough to be checked before
+	 *  each debug message, even in hot paths.
+	 */
+	static bool isChannelEnabled(DebugChannel channel, uint32_t level) {
+		if (level > kMaxVerbosityLevel)
+			level = kMaxVerbosityLevel;
+
+		if ((level > XOREOS_DEBUG_MAX_LEVEL) || (channel >= kDebugChannelCount))
+			return false;
+
+		return _levels[channel].load(std::memory_order_relaxed) >= level;
+	}
+
 	/** Sync verbosity levels from the ConfigManager.
 	 *
 	 *  This reads the current value of the "debug" config option from
@@ -152,12 +204,19 @@ public:
 	 *
 	 *  For ease of debugging and build identification, the xoreos version
 	 *  string will be the first line written to the file.
+	 *
+	 *  The file is written by a background thread, so logging doesn't
+	 *  stall the threads that produce the output.
 	 */
 	bool openLogFile(const UString &file);
 	/** Close the current log file. */
 	void closeLogFile();
 
-	/** Log that string to the current log file. */
+	/** Log that string to the current log file.
+	 *
+	 *  Each thread collects its output until it finished a line, and only
+	 *  then hands the whole line to the log file.
+	 */
 	void logString(const UString &str);
 
 	/** Write the whole command line to the current log file. */
@@ -166,27 +225,76 @@ public:
 	/** Return the OS-specific default path of the log file. */
 	static UString getDefaultLogFile();
 
+	// .--- Metrics
+	/** Enable or disable updating metrics. */
+	void setMetricsEnabled(bool enabled);
+	bool isMetricsEnabled() const;
+
+	/** Reset all metrics to 0. */
+	void clearMetrics();
+
+	/** Write the metrics to the log file every this many seconds. 0 disables it. */
+	void setMetricsLogInterval(uint32_t seconds);
+
+	/** Write the metrics to the log file, if it's time for that. Called once per frame. */
+	void updateMetrics();
+
+	/** Return the name of a metric. */
+	static const char *getMetricName(DebugMetric metric);
+	/** Is this metric a gauge, holding a current value, instead of a counter? */
+	static bool isMetricGauge(DebugMetric metric);
+
+	/** Return the current value of a metric. */
+	static uint64_t getMetric(DebugMetric metric) {
+		return _metrics[metric].load(std::memory_order_relaxed);
+	}
+
+	/** Add to a counter, if metrics are enabled. Can be called from any thread. */
+	static void addMetric(DebugMetric metric, uint64_t n = 1) {
+		if (_metricsEnabled.load(std::memory_order_relaxed))
+			_metrics[metric].fetch_add(n, std::memory_order_relaxed);
+	}
+
+	/** Set the value of a gauge, if metrics are enabled. Can be called from any thread. */
+	static void setMetric(DebugMetric metric, uint64_t value) {
+		if (_metricsEnabled.load(std::memory_order_relaxed))
+			_metrics[metric].store(value, std::memory_order_relaxed);
+	}
+	// '---
+
 private:
 	/** A debug channel. */
 	struct Channel {
 		UString name;        ///< The channel's name.
 		UString description; ///< The channel's description.
 
-		uint32_t level; ///< The current level at which this debug channel is enabled.
-
 		/** Information about the last OpenGL message ID for this channel's types. */
 		uint32_t glTypeIDs[kDebugGLTypeMAX];
 	};
 
 	typedef std::map<UString, DebugChannel, UString::iless> ChannelMap;
 
+	/** The current level at which each debug channel is enabled. */
+	static std::atomic<uint32_t> _levels[kDebugChannelCount];
+
 	Channel    _channels[kDebugChannelCount]; ///< All debug channels.
 	ChannelMap _channelMap;                   ///< Debug channels indexed by name.
 
-	WriteFile _logFile;
-	bool _logFileStartLine;
+	LogWriter _logFile;
 
 	bool _changedConfig;
+
+	/** Are metrics currently updated? */
+	static std::atomic<bool> _metricsEnabled;
+	/** The current value of each metric. */
+	static std::atomic<uint64_t> _metrics[kMetricCount];
+
+	uint32_t _metricsLogInterval; ///< Seconds between writing the metrics to the log file.
+
+	std::chrono::steady_clock::time_point _metricsLogTime; ///< When the metrics were last logged.
+	uint64_t _metricsLogged[kMetricCount];                 ///< The metrics as they were last logged.
+
+	void logMetrics(double seconds);
 };
 
 } // End of namespace Common
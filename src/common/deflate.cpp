@@ -22,6 +22,7 @@
  *  Compress (deflate) and decompress (inflate) using zlib's DEFLATE algorithm.
  */
 
+#include <cassert>
 #include <cstddef>
 
 #include <vector>
@@ -29,11 +30,15 @@
 
 #include <zlib.h>
 
+#include <boost/noncopyable.hpp>
 #include <boost/scope_exit.hpp>
 
 #include "src/common/deflate.h"
 #include "src/common/error.h"
+#include "src/common/util.h"
+#include "src/common/disposableptr.h"
 #include "src/common/memreadstream.h"
+#include "src/common/threadpool.h"
 
 namespace Common {
 
@@ -85,10 +90,9 @@ static void initDeflateZStream(z_stream &strm, int windowBits, size_t size, cons
 		throw Exception("Could not initialize zlib deflate: %s (%d)", zError(zResult), zResult);
 }
 
-byte *decompressDeflate(const byte *data, size_t inputSize,
-                        size_t outputSize, int windowBits) {
-
-	std::unique_ptr<byte[]> decompressedData = std::make_unique<byte[]>(outputSize);
+/** Decompress the whole input into an output buffer of exactly the right size. */
+static void decompressDeflateInto(const byte *data, size_t inputSize,
+                                  byte *output, size_t outputSize, int windowBits) {
 
 	z_stream strm;
 	BOOST_SCOPE_EXIT( (&strm) ) {
@@ -99,7 +103,7 @@ byte *decompressDeflate(const byte *data, size_t inputSize,
 
 	// Set the output data pointer and size
 	strm.avail_out = outputSize;
-	strm.next_out  = decompressedData.get();
+	strm.next_out  = output;
 
 	// Decompress. Z_FINISH, because we want to decompress the whole thing in one go.
 	int zResult = inflate(&strm, Z_FINISH);
@@ -114,6 +118,14 @@ byte *decompressDeflate(const byte *data, size_t inputSize,
 
 		throw Exception("Failed to inflate: %s (%d)", zError(zResult), zResult);
 	}
+}
+
+byte *decompressDeflate(const byte *data, size_t inputSize,
+                        size_t outputSize, int windowBits) {
+
+	std::unique_ptr<byte[]> decompressedData = std::make_unique<byte[]>(outputSize);
+
+	decompressDeflateInto(data, inputSize, decompressedData.get(), outputSize, windowBits);
 
 	return decompressedData.release();
 }
@@ -222,6 +234,198 @@ size_t decompressDeflateChunk(SeekableReadStream &input, int windowBits,
 	return strm.total_out;
 }
 
+/** A stream decompressing DEFLATE data lazily, as it's read. */
+class InflateReadStream : boost::noncopyable, public SeekableReadStream {
+public:
+	InflateReadStream(SeekableReadStream *input, bool disposeAfterUse,
+	                  size_t outputSize, int windowBits, bool chunked) :
+		_input(input, disposeAfterUse), _chunked(chunked), _size(outputSize), _pos(0), _eos(false),
+		_inputPos(input->pos()), _inputBuffer(std::make_unique<byte[]>(kBufferSize)) {
+
+		initInflateZStream(_strm, windowBits, 0, 0);
+
+		const RestartPoint start = { _inputPos, 0 };
+		_restartPoints.push_back(start);
+	}
+
+	~InflateReadStream() {
+		inflateEnd(&_strm);
+	}
+
+	size_t read(void *dataPtr, size_t dataSize) {
+		if (dataSize > (_size - _pos)) {
+			dataSize = _size - _pos;
+			_eos = true;
+		}
+
+		decompress(static_cast<byte *>(dataPtr), dataSize);
+
+		return dataSize;
+	}
+
+	bool eos() const {
+		return _eos;
+	}
+
+	size_t pos() const {
+		return _pos;
+	}
+
+	size_t size() const {
+		return _size;
+	}
+
+	size_t seek(ptrdiff_t offset, Origin whence = kOriginBegin) {
+		const size_t oldPos = _pos;
+		const size_t newPos = evalSeek(offset, whence, _pos, 0, size());
+		if (newPos > _size)
+			throw Exception(kSeekError);
+
+		// Find the closest place before the new position we can restart from
+		std::vector<RestartPoint>::const_iterator point = _restartPoints.begin();
+		while (((point + 1) != _restartPoints.end()) && ((point + 1)->outputPos <= newPos))
+			++point;
+
+		if ((newPos < _pos) || (point->outputPos > _pos))
+			restart(*point);
+
+		// Decompress and throw away everything up to the new position
+		std::unique_ptr<byte[]> skipBuffer;
+		while (_pos < newPos) {
+			if (!skipBuffer)
+				skipBuffer = std::make_unique<byte[]>(kBufferSize);
+
+			decompress(skipBuffer.get(), MIN<size_t>(newPos - _pos, kBufferSize));
+		}
+
+		_eos = false;
+
+		return oldPos;
+	}
+
+private:
+	static const size_t kBufferSize = 4096;
+
+	/** A place where the decompression can start from scratch. */
+	struct RestartPoint {
+		size_t inputPos;  ///< The position within the input stream.
+		size_t outputPos; ///< The position within the decompressed data.
+	};
+
+	DisposablePtr<SeekableReadStream> _input;
+
+	const bool _chunked;
+
+	const size_t _size;
+	size_t _pos;
+
+	bool _eos;
+
+	z_stream _strm;
+
+	size_t _inputPos; ///< Position in the input stream after the data in the input buffer.
+	std::unique_ptr<byte[]> _inputBuffer;
+
+	std::vector<RestartPoint> _restartPoints; ///< The starts of all chunks reached so far.
+
+	void restart(const RestartPoint &point) {
+		const int zResult = inflateReset(&_strm);
+		if (zResult != Z_OK)
+			throw Exception("Could not reset zlib inflate: %s (%d)", zError(zResult), zResult);
+
+		setZStreamInput(_strm, 0, 0);
+
+		_inputPos = point.inputPos;
+		_pos      = point.outputPos;
+	}
+
+	/** Decompress the next size bytes into output. */
+	void decompress(byte *output, size_t size) {
+		_strm.avail_out = size;
+		_strm.next_out  = output;
+
+		while (_strm.avail_out > 0) {
+			if (_strm.avail_in == 0) {
+				_input->seek(_inputPos);
+
+				const size_t inputSize = MIN<size_t>(_input->size() - _inputPos, kBufferSize);
+				if (inputSize == 0)
+					throw Exception("Failed to inflate: input buffer empty, stream not ended");
+
+				if (_input->read(_inputBuffer.get(), inputSize) != inputSize)
+					throw Exception(kReadError);
+
+				_inputPos += inputSize;
+				setZStreamInput(_strm, inputSize, _inputBuffer.get());
+			}
+
+			const size_t availOut = _strm.avail_out;
+
+			const int zResult = inflate(&_strm, Z_SYNC_FLUSH);
+
+			_pos += availOut - _strm.avail_out;
+
+			if (zResult == Z_STREAM_END) {
+				if (!_chunked) {
+					if (_strm.avail_out != 0)
+						throw Exception("Failed to inflate: output buffer not completely filled");
+
+					break;
+				}
+
+				// The next chunk starts right here
+				const RestartPoint point = { _inputPos - _strm.avail_in, _pos };
+				if (point.outputPos > _restartPoints.back().outputPos)
+					_restartPoints.push_back(point);
+
+				restart(point);
+				continue;
+			}
+
+			if (zResult != Z_OK)
+				throw Exception("Failed to inflate: %s (%d)", zError(zResult), zResult);
+		}
+	}
+};
+
+const size_t InflateReadStream::kBufferSize;
+
+SeekableReadStream *decompressDeflateStream(SeekableReadStream *input, size_t outputSize, int windowBits,
+                                            bool chunked, bool disposeAfterUse) {
+
+	assert(input);
+
+	try {
+		return new InflateReadStream(input, disposeAfterUse, outputSize, windowBits, chunked);
+	} catch (...) {
+		if (disposeAfterUse)
+			delete input;
+
+		throw;
+	}
+}
+
+byte *decompressDeflateChunks(const byte *data, size_t inputSize, const std::vector<DeflateChunk> &chunks,
+                              size_t outputSize, int windowBits) {
+
+	for (std::vector<DeflateChunk>::const_iterator c = chunks.begin(); c != chunks.end(); ++c)
+		if ((c->inputOffset  > inputSize ) || (c->inputSize  > (inputSize  - c->inputOffset)) ||
+		    (c->outputOffset > outputSize) || (c->outputSize > (outputSize - c->outputOffset)))
+			throw Exception("Deflate chunk out of bounds");
+
+	std::unique_ptr<byte[]> decompressedData = std::make_unique<byte[]>(outputSize);
+
+	byte *output = decompressedData.get();
+	ThreadPoolMan.parallelFor(chunks.size(), [&chunks, data, output, windowBits](size_t i) {
+		const DeflateChunk &chunk = chunks[i];
+
+		decompressDeflateInto(data + chunk.inputOffset, chunk.inputSize,
+		                      output + chunk.outputOffset, chunk.outputSize, windowBits);
+	});
+
+	return decompressedData.release();
+}
+
 byte *compressDeflate(const byte *data, size_t inputSize, size_t &outputSize, int windowBits, unsigned int frameSize) {
 	z_stream strm;
 	BOOST_SCOPE_EXIT( (&strm) ) {
@@ -25,16 +25,12 @@
 #ifndef COMMON_DEFLATE_H
 #define COMMON_DEFLATE_H
 
+#include <vector>
+
 #include "src/common/types.h"
 
 namespace Common {
 
-/* TODO (should be need it):
- * - Compression
- * - Decompress dynamically, without needing to know the size
- *   of the decompressed data beforehand
- */
-
 class ReadStream;
 class SeekableReadStream;
 
@@ -117,6 +113,58 @@ SeekableReadStream *decompressDeflateWithoutOutputSize(ReadStream &input, size_t
 size_t decompressDeflateChunk(SeekableReadStream &input, int windowBits, byte *output, size_t outputSize,
                               unsigned int frameSize = 4096);
 
+/** Decompress (inflate) using zlib's DEFLATE algorithm, lazily while reading.
+ *
+ *  Instead of decompressing everything up front, the returned stream only
+ *  decompresses as much as was read or seeked over. Seeking backwards
+ *  restarts the decompression.
+ *
+ *  If the input is chunked, it consists of several individually compressed
+ *  chunks, one directly after the other, like for decompressDeflateChunk().
+ *  Then, the starts of all chunks reached are remembered, and seeking
+ *  restarts the decompression at the closest chunk instead.
+ *
+ *  The input stream is only read when reading from the returned stream, and
+ *  it's always seeked to the correct position first. It may be shared with
+ *  other users, but it needs to outlive the returned stream.
+ *
+ *  @param  input           The compressed input data, from its current position to its end.
+ *  @param  outputSize      The size of the decompressed output data.
+ *  @param  windowBits      The base two logarithm of the window size (the size of
+ *                          the history buffer). See the zlib documentation on
+ *                          inflateInit2() for details.
+ *  @param  chunked         Is the input made up of individually compressed chunks?
+ *  @param  disposeAfterUse Should the input stream be deleted together with the returned stream?
+ *  @return A stream of the decompressed data.
+ */
+SeekableReadStream *decompressDeflateStream(SeekableReadStream *input, size_t outputSize, int windowBits,
+                                            bool chunked = false, bool disposeAfterUse = true);
+
+/** A chunk of DEFLATE compressed data, which can be decompressed independently. */
+struct DeflateChunk {
+	size_t inputOffset;  ///< Offset of the compressed chunk within the input data.
+	size_t inputSize;    ///< Size of the compressed chunk.
+	size_t outputOffset; ///< Offset of the decompressed chunk within the output data.
+	size_t outputSize;   ///< Size of the decompressed chunk.
+};
+
+/** Decompress (inflate) independent chunks using zlib's DEFLATE algorithm, concurrently.
+ *
+ *  The chunks are spread over the thread pool. Each chunk needs to decompress
+ *  to exactly its output size.
+ *
+ *  @param  data       The compressed input data.
+ *  @param  inputSize  The size of the input data in bytes.
+ *  @param  chunks     The chunks within the input and output data.
+ *  @param  outputSize The size of the decompressed output data.
+ *  @param  windowBits The base two logarithm of the window size (the size of
+ *                     the history buffer). See the zlib documentation on
+ *                     inflateInit2() for details.
+ *  @return The decompressed data.
+ */
+byte *decompressDeflateChunks(const byte *data, size_t inputSize, const std::vector<DeflateChunk> &chunks,
+                              size_t outputSize, int windowBits);
+
 /** Compress (deflate) using zlib's DEFLATE algorithm.
  *
  *  @param input      The input data to compress.
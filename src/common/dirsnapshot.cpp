@@ -0,0 +1,166 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A cached, indexed listing of a directory's contents.
+ */
+
+#include <ctime>
+
+#include <map>
+
+#include <boost/filesystem.hpp>
+
+#include "src/common/dirsnapshot.h"
+#include "src/common/filepath.h"
+#include "src/common/mutex.h"
+
+namespace Common {
+
+typedef std::map<UString, std::shared_ptr<const DirectorySnapshot> > SnapshotCache;
+
+static std::mutex _snapshotMutex;
+static SnapshotCache _snapshots;
+
+/** Return the modification time of a directory, or 0 if it isn't one. */
+static uint64_t getDirectoryTime(const UString &directory) {
+	boost::system::error_code ec;
+
+	const boost::filesystem::path dirPath(directory.c_str());
+	if (!boost::filesystem::is_directory(dirPath, ec) || ec)
+		return 0;
+
+	const std::time_t time = boost::filesystem::last_write_time(dirPath, ec);
+	if (ec || (time <= 0))
+		return 0;
+
+	return (uint64_t) time;
+}
+
+
+DirectorySnapshot::DirectorySnapshot(const UString &path) : _path(path),
+	_modificationTime(0), _snapshotTime(0) {
+
+}
+
+std::shared_ptr<const DirectorySnapshot> DirectorySnapshot::get(const UString &directory) {
+	const UString path = FilePath::canonicalize(directory, false);
+
+	const uint64_t modificationTime = getDirectoryTime(path);
+	if (modificationTime == 0)
+		return std::shared_ptr<const DirectorySnapshot>();
+
+	{
+		std::lock_guard<std::mutex> lock(_snapshotMutex);
+
+		SnapshotCache::const_iterator s = _snapshots.find(path);
+		if ((s != _snapshots.end()) && s->second->isCurrent(modificationTime))
+			return s->second;
+	}
+
+	// List the directory without holding the lock, so other directories can be looked at meanwhile
+	std::shared_ptr<DirectorySnapshot> snapshot(new DirectorySnapshot(path));
+	if (!snapshot->read())
+		return std::shared_ptr<const DirectorySnapshot>();
+
+	std::lock_guard<std::mutex> lock(_snapshotMutex);
+
+	_snapshots[path] = snapshot;
+	return snapshot;
+}
+
+void DirectorySnapshot::clearCache() {
+	std::lock_guard<std::mutex> lock(_snapshotMutex);
+
+	_snapshots.clear();
+}
+
+const UString &DirectorySnapshot::getPath() const {
+	return _path;
+}
+
+const DirectorySnapshot::Entries &DirectorySnapshot::getEntries() const {
+	return _entries;
+}
+
+const DirectorySnapshot::Entry *DirectorySnapshot::find(const UString &name, bool caseInsensitive) const {
+	return find(name, caseInsensitive, false);
+}
+
+const DirectorySnapshot::Entry *DirectorySnapshot::findDirectory(const UString &name, bool caseInsensitive) const {
+	return find(name, caseInsensitive, true);
+}
+
+const DirectorySnapshot::Entry *DirectorySnapshot::find(const UString &name, bool caseInsensitive,
+                                                        bool directoriesOnly) const {
+	std::pair<NameIndex::const_iterator, NameIndex::const_iterator> range = _index.equal_range(name);
+
+	const Entry *found = 0;
+	size_t foundIndex = SIZE_MAX;
+
+	for (NameIndex::const_iterator i = range.first; i != range.second; ++i) {
+		if (i->second >= foundIndex)
+			continue;
+
+		if (directoriesOnly && !_entries[i->second].isDirectory)
+			continue;
+
+		if (!caseInsensitive && !_entries[i->second].name.equals(name))
+			continue;
+
+		found      = &_entries[i->second];
+		foundIndex = i->second;
+	}
+
+	return found;
+}
+
+bool DirectorySnapshot::isCurrent(uint64_t modificationTime) const {
+	return (modificationTime == _modificationTime) && (_modificationTime < _snapshotTime);
+}
+
+bool DirectorySnapshot::read() {
+	/* Take the time before listing the directory, so that a change happening
+	 * while we're reading it will always invalidate the snapshot. */
+	_snapshotTime     = (uint64_t) std::time(0);
+	_modificationTime = getDirectoryTime(_path);
+	if (_modificationTime == 0)
+		return false;
+
+	try {
+		boost::filesystem::directory_iterator itEnd;
+		for (boost::filesystem::directory_iterator itDir(_path.c_str()); itDir != itEnd; ++itDir) {
+			Entry entry;
+
+			entry.name        = itDir->path().filename().generic_string();
+			entry.path        = FilePath::canonicalize(itDir->path().generic_string(), false);
+			entry.isDirectory = boost::filesystem::is_directory(itDir->status());
+
+			_index.insert(std::make_pair(entry.name, _entries.size()));
+			_entries.push_back(entry);
+		}
+	} catch (...) {
+		return false;
+	}
+
+	return true;
+}
+
+} // End of namespace Common
@@ -0,0 +1,115 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A cached, indexed listing of a directory's contents.
+ */
+
+#ifndef COMMON_DIRSNAPSHOT_H
+#define COMMON_DIRSNAPSHOT_H
+
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+
+namespace Common {
+
+/** The contents of a single directory, read once and indexed by name.
+ *
+ *  Snapshots are cached process-wide, keyed by the canonical path of the
+ *  directory, so that the game probes, the resource manager and everybody
+ *  else looking into the same directory only list it once. A cached snapshot
+ *  is reused for as long as the modification time of the directory hasn't
+ *  changed.
+ *
+ *  Since modification times only have a resolution of one second, a snapshot
+ *  taken within the same second the directory was last modified can't be
+ *  trusted: the directory might have been changed again right after. Such
+ *  a snapshot is reread on the next request.
+ */
+class DirectorySnapshot {
+public:
+	struct Entry {
+		UString name; ///< The name of the entry within the directory.
+		UString path; ///< The canonical path of the entry.
+
+		bool isDirectory; ///< Is this entry a directory (or a link to one)?
+	};
+
+	typedef std::vector<Entry> Entries;
+
+	/** Return a snapshot of this directory.
+	 *
+	 *  @return The snapshot, or an empty pointer if the path is not a
+	 *          readable directory.
+	 */
+	static std::shared_ptr<const DirectorySnapshot> get(const UString &directory);
+
+	/** Drop all cached snapshots. */
+	static void clearCache();
+
+	/** Return the canonical path of the directory. */
+	const UString &getPath() const;
+
+	/** Return all entries, in the order the filesystem listed them. */
+	const Entries &getEntries() const;
+
+	/** Find an entry by name.
+	 *
+	 *  If several entries match case-insensitively, the first one listed
+	 *  by the filesystem is returned.
+	 *
+	 *  @param  name The name of the entry to look for.
+	 *  @param  caseInsensitive Should the case of the name be ignored?
+	 *  @return The entry, or 0 if no such entry exists.
+	 */
+	const Entry *find(const UString &name, bool caseInsensitive) const;
+	/** Find an entry that's a directory by name. See find(). */
+	const Entry *findDirectory(const UString &name, bool caseInsensitive) const;
+
+private:
+	typedef std::unordered_multimap<UString, size_t,
+	                                hashUStringCaseInsensitive, equalsUStringInsensitive> NameIndex;
+
+	UString _path;
+
+	/** The modification time of the directory when the snapshot was taken. */
+	uint64_t _modificationTime;
+	/** When the snapshot was taken. */
+	uint64_t _snapshotTime;
+
+	Entries _entries;
+	/** Entry indices by case-folded name. */
+	NameIndex _index;
+
+	DirectorySnapshot(const UString &path);
+
+	bool read();
+
+	const Entry *find(const UString &name, bool caseInsensitive, bool directoriesOnly) const;
+	bool isCurrent(uint64_t modificationTime) const;
+};
+
+} // End of namespace Common
+
+#endif // COMMON_DIRSNAPSHOT_H
@@ -29,6 +29,8 @@
 
 #include <vector>
 #include <memory>
+#include <string>
+#include <algorithm>
 
 #include "src/common/encoding.h"
 #include "src/common/error.h"
@@ -56,6 +58,59 @@ static const size_t kTerminatorLength  [kEncodingMAX] = {
 	1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1
 };
 
+/** Marks a byte in a single-byte codepage that has no Unicode mapping. */
+static const uint32_t kInvalidCodepoint = 0xFFFFFFFF;
+
+/** Is this an ASCII-compatible codepage that maps every byte to exactly one codepoint? */
+static bool isSingleByteEncoding(Encoding encoding) {
+	return (encoding == kEncodingLatin9) || (encoding == kEncodingCP1250) ||
+	       (encoding == kEncodingCP1251) || (encoding == kEncodingCP1252);
+}
+
+/** Are all these bytes 7-bit ASCII? Checks a whole machine word at a time. */
+static bool isASCII(const byte *data, size_t n) {
+	static const uint64_t kHighBits = UINT64_C(0x8080808080808080);
+
+	for (; n >= 8; data += 8, n -= 8) {
+		uint64_t word;
+		std::memcpy(&word, data, 8);
+
+		if (word & kHighBits)
+			return false;
+	}
+
+	for (; n > 0; data++, n--)
+		if (*data & 0x80)
+			return false;
+
+	return true;
+}
+
+static void appendUTF8(std::string &str, uint32_t c) {
+	if        (c < 0x80) {
+		str += (char) c;
+	} else if (c < 0x800) {
+		str += (char) (0xC0 |  (c >>  6));
+		str += (char) (0x80 | ( c        & 0x3F));
+	} else if (c < 0x10000) {
+		str += (char) (0xE0 |  (c >> 12));
+		str += (char) (0x80 | ((c >>  6) & 0x3F));
+		str += (char) (0x80 | ( c        & 0x3F));
+	} else {
+		str += (char) (0xF0 |  (c >> 18));
+		str += (char) (0x80 | ((c >> 12) & 0x3F));
+		str += (char) (0x80 | ((c >>  6) & 0x3F));
+		str += (char) (0x80 | ( c        & 0x3F));
+	}
+}
+
+/** Create a UString out of the converted data, which ends at the first 0 just like with iconv(). */
+static UString createUString(std::string &str) {
+	str.resize(std::strlen(str.c_str()));
+
+	return UString(std::move(str));
+}
+
 /** A manager handling string encoding conversions. */
 class ConversionManager : public Singleton<ConversionManager> {
 public:
@@ -72,6 +127,9 @@ public:
 		for (size_t i = 0; i < kEncodingMAX; i++)
 			if ((_contextTo  [i] = iconv_open(kEncodingName[i], "UTF-8")) == ((iconv_t) -1))
 				warning("Failed to initialize UTF-8 -> %s conversion: %s", kEncodingName[i], strerror(errno));
+
+		for (size_t i = 0; i < kEncodingMAX; i++)
+			_hasTable[i] = isSingleByteEncoding((Encoding) i) && buildTable(_contextFrom[i], _table[i]);
 	}
 
 	~ConversionManager() {
@@ -88,6 +146,11 @@ public:
 		    (((size_t) to  ) >= kEncodingMAX))
 			return false;
 
+		if ((from == kEncodingUTF8) && isUTF16(to))
+			return true;
+		if ((to   == kEncodingUTF8) && isUTF16(from))
+			return true;
+
 		if (from == kEncodingUTF8)
 			return _contextTo[to] != ((iconv_t) -1);
 
@@ -101,6 +164,12 @@ public:
 		if (((size_t) encoding) >= kEncodingMAX)
 			throw Exception("Invalid encoding %d", encoding);
 
+		// Only the CJK codepages actually need iconv()
+		if (_hasTable[encoding])
+			return decodeSingleByte(encoding, data, n);
+		if (isUTF16(encoding))
+			return decodeUTF16(data, n, encoding == kEncodingUTF16BE);
+
 		return convert(_contextFrom[encoding], data, n, kEncodingGrowthFrom[encoding], 1);
 	}
 
@@ -111,6 +180,11 @@ public:
 		if (encoding == kEncodingASCII)
 			return clean7bitASCII(str, terminate);
 
+		if (_hasTable[encoding])
+			return encodeSingleByte(encoding, str, terminate);
+		if (isUTF16(encoding))
+			return encodeUTF16(str, encoding == kEncodingUTF16BE, terminate);
+
 		return convert(_contextTo[encoding], str, kEncodingGrowthTo[encoding],
 		               terminate ? kTerminatorLength[encoding] : 0);
 	}
@@ -119,6 +193,183 @@ private:
 	iconv_t _contextFrom[kEncodingMAX];
 	iconv_t _contextTo  [kEncodingMAX];
 
+	/** The codepoints of the bytes 0x80 - 0xFF in each single-byte codepage. */
+	uint32_t _table[kEncodingMAX][128];
+	/** Do we have a codepoint table for this encoding? */
+	bool _hasTable[kEncodingMAX];
+
+	static bool isUTF16(Encoding encoding) {
+		return (encoding == kEncodingUTF16LE) || (encoding == kEncodingUTF16BE);
+	}
+
+	/** Ask iconv() once what each upper-half byte of a single-byte codepage maps to. */
+	static bool buildTable(iconv_t &ctx, uint32_t *table) {
+		if (ctx == ((iconv_t) -1))
+			return false;
+
+		for (size_t i = 0; i < 128; i++) {
+			char in[1] = { (char) (0x80 + i) };
+			char out[8];
+
+			char  *inBuf    = in;
+			char  *outBuf   = out;
+			size_t inBytes  = sizeof(in);
+			size_t outBytes = sizeof(out);
+
+			iconv(ctx, 0, 0, 0, 0);
+
+			if ((iconv(ctx, const_cast<ICONV_CONST char **>(&inBuf), &inBytes, &outBuf, &outBytes) == ((size_t) -1)) ||
+			    (outBytes == sizeof(out))) {
+
+				table[i] = kInvalidCodepoint;
+				continue;
+			}
+
+			const UString c(out, sizeof(out) - outBytes);
+			table[i] = *c.begin();
+		}
+
+		return true;
+	}
+
+	UString decodeSingleByte(Encoding encoding, const byte *data, size_t n) {
+		if (isASCII(data, n)) {
+			const byte *end = reinterpret_cast<const byte *>(std::memchr(data, '\0', n));
+
+			return UString(reinterpret_cast<const char *>(data), end ? (end - data) : n);
+		}
+
+		const uint32_t *table = _table[encoding];
+
+		std::string str;
+		str.reserve(n * 2);
+
+		for (size_t i = 0; i < n; i++) {
+			if (data[i] < 0x80) {
+				str += (char) data[i];
+				continue;
+			}
+
+			const uint32_t c = table[data[i] - 0x80];
+			if (c == kInvalidCodepoint) {
+				warning("Invalid %s byte 0x%02X", kEncodingName[encoding], data[i]);
+				return "[!?!]";
+			}
+
+			appendUTF8(str, c);
+		}
+
+		return createUString(str);
+	}
+
+	UString decodeUTF16(const byte *data, size_t n, bool bigEndian) {
+		if ((n % 2) != 0) {
+			warning("Incomplete UTF-16 string");
+			return "[!?!]";
+		}
+
+		std::string str;
+		str.reserve(n + n / 2);
+
+		for (size_t i = 0; i < n; i += 2) {
+			uint32_t c = bigEndian ? READ_BE_UINT16(data + i) : READ_LE_UINT16(data + i);
+
+			if ((c >= 0xD800) && (c <= 0xDBFF)) {
+				const uint32_t c2 = ((i + 2) < n) ?
+					(bigEndian ? READ_BE_UINT16(data + i + 2) : READ_LE_UINT16(data + i + 2)) : 0;
+
+				if ((c2 < 0xDC00) || (c2 > 0xDFFF)) {
+					warning("Unpaired UTF-16 surrogate 0x%04X", c);
+					return "[!?!]";
+				}
+
+				c  = 0x10000 + ((c - 0xD800) << 10) + (c2 - 0xDC00);
+				i += 2;
+
+			} else if ((c >= 0xDC00) && (c <= 0xDFFF)) {
+				warning("Unpaired UTF-16 surrogate 0x%04X", c);
+				return "[!?!]";
+			}
+
+			appendUTF8(str, c);
+		}
+
+		return createUString(str);
+	}
+
+	MemoryReadStream *encodeSingleByte(Encoding encoding, const UString &str, bool terminate) {
+		const byte  *dataIn = reinterpret_cast<const byte *>(str.c_str());
+		const size_t nIn    = std::strlen(str.c_str());
+
+		std::unique_ptr<byte[]> dataOut = std::make_unique<byte[]>(nIn + (terminate ? 1 : 0));
+
+		size_t size = 0;
+		if (isASCII(dataIn, nIn)) {
+			std::memcpy(dataOut.get(), dataIn, nIn);
+			size = nIn;
+
+		} else {
+			const uint32_t *table = _table[encoding];
+
+			for (UString::iterator c = str.begin(); c != str.end(); ++c) {
+				if (*c < 0x80) {
+					dataOut[size++] = *c;
+					continue;
+				}
+
+				const uint32_t *b = std::find(table, table + 128, *c);
+				if (b == (table + 128)) {
+					warning("U+%04X can't be represented in %s", *c, kEncodingName[encoding]);
+					return 0;
+				}
+
+				dataOut[size++] = 0x80 + (b - table);
+			}
+		}
+
+		if (terminate)
+			dataOut[size++] = '\0';
+
+		return new MemoryReadStream(dataOut.release(), size, true);
+	}
+
+	static void writeUTF16(byte *data, uint16_t c, bool bigEndian) {
+		if (bigEndian)
+			WRITE_BE_UINT16(data, c);
+		else
+			WRITE_LE_UINT16(data, c);
+	}
+
+	MemoryReadStream *encodeUTF16(const UString &str, bool bigEndian, bool terminate) {
+		// No UTF-8 sequence grows to more than twice its size in UTF-16
+		const size_t nIn = std::strlen(str.c_str());
+
+		std::unique_ptr<byte[]> dataOut = std::make_unique<byte[]>(nIn * 2 + (terminate ? 2 : 0));
+
+		size_t size = 0;
+		for (UString::iterator c = str.begin(); c != str.end(); ++c) {
+			if (*c >= 0x10000) {
+				writeUTF16(dataOut.get() + size, 0xD800 + ((*c - 0x10000) >> 10), bigEndian);
+				size += 2;
+
+				writeUTF16(dataOut.get() + size, 0xDC00 + ((*c - 0x10000) & 0x3FF), bigEndian);
+				size += 2;
+
+				continue;
+			}
+
+			writeUTF16(dataOut.get() + size, *c, bigEndian);
+			size += 2;
+		}
+
+		if (terminate) {
+			dataOut[size++] = '\0';
+			dataOut[size++] = '\0';
+		}
+
+		return new MemoryReadStream(dataOut.release(), size, true);
+	}
+
 	byte *doConvert(iconv_t &ctx, byte *data, size_t nIn, size_t nOut, size_t &size) {
 		size_t inBytes  = nIn;
 		size_t outBytes = nOut;
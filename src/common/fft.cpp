@@ -53,6 +53,12 @@
 #include <cassert>
 #include <cstring>
 
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+	#include <arm_neon.h>
+#endif
+
 #include "src/common/maths.h"
 #include "src/common/cosinetables.h"
 #include "src/common/util.h"
@@ -185,11 +191,146 @@ static void name(Complex *z, const float *wre, unsigned int n)\
 	} while (--n);\
 }
 
+#if defined(__SSE2__) || defined(__ARM_NEON)
+
+/* Vectorized version of the pass above, handling two neighbouring complex
+ * values per vector. All inputs are loaded before anything is stored, so
+ * it also replaces pass_big.
+ *
+ * With w = wre[k] + i * wim[-k], the scalar TRANSFORM is
+ *   t12 = a2 * conj(w), t56 = a3 * w
+ *   a0, a2 = a0 +/- (t56 + t12)
+ *   a1, a3 = a1 +/- i * conj(t56 - t12)
+ * Since wim[0] is exactly 0, TRANSFORM_ZERO needs no special case.
+ */
+
+#if defined(__SSE2__)
+
+static inline __m128 loadTwiddleRe(const float *wre) {
+	// [wre[0], wre[0], wre[1], wre[1]]
+	const __m128 w = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double *>(wre)));
+
+	return _mm_unpacklo_ps(w, w);
+}
+
+static inline __m128 loadTwiddleIm(const float *wim) {
+	// [wim[0], wim[0], wim[-1], wim[-1]]
+	const __m128 w = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double *>(wim - 1)));
+
+	return _mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 0, 1, 1));
+}
+
+static void pass_simd(Complex *z, const float *wre, unsigned int n) {
+	const unsigned int o1 = 2 * n;
+	const unsigned int o2 = 4 * n;
+	const unsigned int o3 = 6 * n;
+
+	const float *wim = wre + o1;
+
+	const __m128 signIm = _mm_castsi128_ps(_mm_set_epi32(INT32_MIN, 0, INT32_MIN, 0));
+	const __m128 signRe = _mm_castsi128_ps(_mm_set_epi32(0, INT32_MIN, 0, INT32_MIN));
+
+	for (unsigned int k = 0; k < o1; k += 2) {
+		float * const p0 = &z[k     ].re;
+		float * const p1 = &z[k + o1].re;
+		float * const p2 = &z[k + o2].re;
+		float * const p3 = &z[k + o3].re;
+
+		const __m128 a0 = _mm_loadu_ps(p0);
+		const __m128 a1 = _mm_loadu_ps(p1);
+		const __m128 a2 = _mm_loadu_ps(p2);
+		const __m128 a3 = _mm_loadu_ps(p3);
+
+		const __m128 wr = loadTwiddleRe(wre + k);
+		const __m128 wi = loadTwiddleIm(wim - k);
+
+		const __m128 a2s = _mm_shuffle_ps(a2, a2, _MM_SHUFFLE(2, 3, 0, 1));
+		const __m128 a3s = _mm_shuffle_ps(a3, a3, _MM_SHUFFLE(2, 3, 0, 1));
+
+		// [t1, t2] and [t5, t6]
+		const __m128 t12 = _mm_add_ps(_mm_mul_ps(a2, wr), _mm_xor_ps(_mm_mul_ps(a2s, wi), signIm));
+		const __m128 t56 = _mm_sub_ps(_mm_mul_ps(a3, wr), _mm_xor_ps(_mm_mul_ps(a3s, wi), signIm));
+
+		// [t5 + t1, t6 + t2] and [t2 - t6, t5 - t1]
+		const __m128 sum  = _mm_add_ps(t56, t12);
+		const __m128 diff = _mm_sub_ps(t56, t12);
+		const __m128 rot  = _mm_xor_ps(_mm_shuffle_ps(diff, diff, _MM_SHUFFLE(2, 3, 0, 1)), signRe);
+
+		_mm_storeu_ps(p0, _mm_add_ps(a0, sum));
+		_mm_storeu_ps(p2, _mm_sub_ps(a0, sum));
+		_mm_storeu_ps(p1, _mm_add_ps(a1, rot));
+		_mm_storeu_ps(p3, _mm_sub_ps(a1, rot));
+	}
+}
+
+#elif defined(__ARM_NEON)
+
+static void pass_simd(Complex *z, const float *wre, unsigned int n) {
+	const unsigned int o1 = 2 * n;
+	const unsigned int o2 = 4 * n;
+	const unsigned int o3 = 6 * n;
+
+	const float *wim = wre + o1;
+
+	static const uint32_t kSignIm[4] = { 0, 0x80000000, 0, 0x80000000 };
+	static const uint32_t kSignRe[4] = { 0x80000000, 0, 0x80000000, 0 };
+
+	const uint32x4_t signIm = vld1q_u32(kSignIm);
+	const uint32x4_t signRe = vld1q_u32(kSignRe);
+
+	for (unsigned int k = 0; k < o1; k += 2) {
+		float * const p0 = &z[k     ].re;
+		float * const p1 = &z[k + o1].re;
+		float * const p2 = &z[k + o2].re;
+		float * const p3 = &z[k + o3].re;
+
+		const float32x4_t a0 = vld1q_f32(p0);
+		const float32x4_t a1 = vld1q_f32(p1);
+		const float32x4_t a2 = vld1q_f32(p2);
+		const float32x4_t a3 = vld1q_f32(p3);
+
+		const float32x2_t wr2 = vld1_f32(wre + k);
+		const float32x2_t wi2 = vrev64_f32(vld1_f32(wim - k - 1));
+
+		const float32x4_t wr = vcombine_f32(vdup_lane_f32(wr2, 0), vdup_lane_f32(wr2, 1));
+		const float32x4_t wi = vcombine_f32(vdup_lane_f32(wi2, 0), vdup_lane_f32(wi2, 1));
+
+		const float32x4_t a2wi = vmulq_f32(vrev64q_f32(a2), wi);
+		const float32x4_t a3wi = vmulq_f32(vrev64q_f32(a3), wi);
+
+		// [t1, t2] and [t5, t6]
+		const float32x4_t t12 = vmlaq_f32(vreinterpretq_f32_u32(
+				veorq_u32(vreinterpretq_u32_f32(a2wi), signIm)), a2, wr);
+		const float32x4_t t56 = vmlaq_f32(vreinterpretq_f32_u32(
+				veorq_u32(vreinterpretq_u32_f32(a3wi), signRe)), a3, wr);
+
+		// [t5 + t1, t6 + t2] and [t2 - t6, t5 - t1]
+		const float32x4_t sum  = vaddq_f32(t56, t12);
+		const float32x4_t diff = vsubq_f32(t56, t12);
+		const float32x4_t rot  = vreinterpretq_f32_u32(
+				veorq_u32(vreinterpretq_u32_f32(vrev64q_f32(diff)), signRe));
+
+		vst1q_f32(p0, vaddq_f32(a0, sum));
+		vst1q_f32(p2, vsubq_f32(a0, sum));
+		vst1q_f32(p1, vaddq_f32(a1, rot));
+		vst1q_f32(p3, vsubq_f32(a1, rot));
+	}
+}
+
+#endif
+
+#define pass     pass_simd
+#define pass_big pass_simd
+
+#else
+
 PASS(pass)
 #undef BUTTERFLIES
 #define BUTTERFLIES BUTTERFLIES_BIG
 PASS(pass_big)
 
+#endif // defined(__SSE2__) || defined(__ARM_NEON)
+
 #define DECL_FFT(t,n,n2,n4)\
 static void fft##n(Complex *z)\
 {\
@@ -254,6 +395,7 @@ DECL_FFT(6, 64,32,16)
 DECL_FFT(7, 128,64,32)
 DECL_FFT(8, 256,128,64)
 DECL_FFT(9, 512,256,128)
+#undef pass
 #define pass pass_big
 DECL_FFT(10, 1024,512,256)
 DECL_FFT(11, 2048,1024,512)
@@ -22,18 +22,87 @@
  *  A list of files.
  */
 
-#include <regex>
+#include <cstring>
 
-#include <boost/filesystem.hpp>
+#include <string>
+#include <regex>
 
 #include "src/common/filelist.h"
 #include "src/common/filepath.h"
-
-// boost-filesystem stuff
-using boost::filesystem::directory_iterator;
+#include "src/common/dirsnapshot.h"
 
 namespace Common {
 
+/** Return the literal ASCII characters a regex has to end with.
+ *
+ *  This is used to cheaply sort out most non-matching files before running
+ *  the regex proper. If the regex doesn't end with plain characters, or if
+ *  it contains alternatives that might end differently, "" is returned.
+ */
+static std::string getGlobSuffix(const UString &glob) {
+	const char *str = glob.c_str();
+	if (std::strchr(str, '|'))
+		return "";
+
+	static const char *kSpecial = ".*+?^$()[]{}|\\";
+
+	std::string suffix;
+
+	size_t length = std::strlen(str);
+	while (length > 0) {
+		const char c = str[length - 1];
+		if ((c & 0x80) != 0)
+			break;
+
+		// Count the backslashes in front of this character to see if it's escaped
+		size_t backslashes = 0;
+		while ((backslashes < (length - 1)) && (str[length - 2 - backslashes] == '\\'))
+			backslashes++;
+
+		const bool escaped = (backslashes % 2) == 1;
+		if (escaped) {
+			// Only escaped special characters are literals; \d, \w, ... are classes
+			if (!std::strchr(kSpecial, c))
+				break;
+
+			length -= 2;
+		} else {
+			if (std::strchr(kSpecial, c))
+				break;
+
+			length -= 1;
+		}
+
+		suffix.insert(suffix.begin(), c);
+	}
+
+	return suffix;
+}
+
+/** Does this string end with this ASCII suffix? */
+static bool endsWithSuffix(const UString &str, const std::string &suffix, bool caseInsensitive) {
+	const size_t length = std::strlen(str.c_str());
+	if (length < suffix.size())
+		return false;
+
+	const char *end = str.c_str() + length - suffix.size();
+	for (size_t i = 0; i < suffix.size(); i++) {
+		char c1 = end[i], c2 = suffix[i];
+
+		if (caseInsensitive) {
+			if ((c1 >= 'A') && (c1 <= 'Z'))
+				c1 += 'a' - 'A';
+			if ((c2 >= 'A') && (c2 <= 'Z'))
+				c2 += 'a' - 'A';
+		}
+
+		if (c1 != c2)
+			return false;
+	}
+
+	return true;
+}
+
 FileList::FileList() {
 }
 
@@ -102,47 +171,38 @@ FileList::const_iterator FileList::end() const {
 
 bool FileList::addDirectory(const UString &directory, int recurseDepth) {
 	// Not a directory? Fail.
-	if (!FilePath::isDirectory(directory))
+	std::shared_ptr<const DirectorySnapshot> snapshot = DirectorySnapshot::get(directory);
+	if (!snapshot)
 		return false;
 
-	try {
-		// Iterator over the directory's contents
-		for (directory_iterator itEnd, itDir(directory.c_str()); itDir != itEnd; ++itDir) {
-			const UString path = itDir->path().generic_string();
-
-			if (FilePath::isDirectory(path)) {
-				// It's a directory. Recurse into it if the depth limit wasn't yet reached
-
-				if (recurseDepth != 0)
-					if (!addDirectory(path, (recurseDepth == -1) ? -1 : (recurseDepth - 1)))
-						return false;
+	// Iterator over the directory's contents
+	const DirectorySnapshot::Entries &entries = snapshot->getEntries();
+	for (DirectorySnapshot::Entries::const_iterator e = entries.begin(); e != entries.end(); ++e) {
+		if (e->isDirectory) {
+			// It's a directory. Recurse into it if the depth limit wasn't yet reached
 
-			} else
-				// It's a path, add it to the list
-				_files.push_back(FilePath::canonicalize(path, false));
+			if (recurseDepth != 0)
+				if (!addDirectory(e->path, (recurseDepth == -1) ? -1 : (recurseDepth - 1)))
+					return false;
 
-		}
-	} catch (...) {
-		return false;
+		} else
+			// It's a path, add it to the list
+			_files.push_back(e->path);
 	}
 
 	return true;
 }
 
 bool FileList::addSubDirectories(const UString &directory) {
-	if (!FilePath::isDirectory(directory))
+	std::shared_ptr<const DirectorySnapshot> snapshot = DirectorySnapshot::get(directory);
+	if (!snapshot)
 		return false;
 
-	try {
-		// Iterator over the directory's contents
-		for (directory_iterator itEnd, itDir(directory.c_str()); itDir != itEnd; ++itDir) {
-			const UString path = itDir->path().generic_string();
-			if (FilePath::isDirectory(path))
-				_files.push_back(FilePath::canonicalize(path, false));
-		}
-	} catch (...) {
-		return false;
-	}
+	// Iterator over the directory's contents
+	const DirectorySnapshot::Entries &entries = snapshot->getEntries();
+	for (DirectorySnapshot::Entries::const_iterator e = entries.begin(); e != entries.end(); ++e)
+		if (e->isDirectory)
+			_files.push_back(e->path);
 
 	return true;
 }
@@ -171,11 +231,13 @@ bool FileList::getSubListGlob(const UString &glob, bool caseInsensitive, FileLis
 		type |= std::regex::icase;
 	std::regex expression(glob.c_str(), type);
 
+	const std::string suffix = getGlobSuffix(glob);
+
 	bool foundMatch = false;
 
 	// Iterate through the whole list, adding the matches to the sub list
 	for (Files::const_iterator it = _files.begin(); it != _files.end(); ++it)
-		if (std::regex_match(it->c_str(), expression)) {
+		if (endsWithSuffix(*it, suffix, caseInsensitive) && std::regex_match(it->c_str(), expression)) {
 			subList._files.push_back(*it);
 			foundMatch = true;
 		}
@@ -211,9 +273,11 @@ UString FileList::findFirstGlob(const UString &glob, bool caseInsensitive) const
 		type |= std::regex::icase;
 	std::regex expression(glob.c_str(), type);
 
+	const std::string suffix = getGlobSuffix(glob);
+
 	// Iterate through the whole list, adding the matches to the sub list
 	for (Files::const_iterator it = _files.begin(); it != _files.end(); ++it)
-		if (std::regex_match(it->c_str(), expression))
+		if (endsWithSuffix(*it, suffix, caseInsensitive) && std::regex_match(it->c_str(), expression))
 			return *it;
 
 	return "";
@@ -22,6 +22,8 @@
  *  Utility class for manipulating file paths.
  */
 
+#include <ctime>
+
 #include <list>
 #include <regex>
 
@@ -29,6 +31,7 @@
 #include <boost/filesystem.hpp>
 
 #include "src/common/filepath.h"
+#include "src/common/dirsnapshot.h"
 #include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/encoding.h"
@@ -40,6 +43,7 @@ using boost::filesystem::exists;
 using boost::filesystem::is_regular_file;
 using boost::filesystem::is_directory;
 using boost::filesystem::file_size;
+using boost::filesystem::last_write_time;
 using boost::filesystem::directory_iterator;
 using boost::filesystem::create_directories;
 
@@ -78,6 +82,22 @@ size_t FilePath::getFileSize(const UString &p) {
 	return size;
 }
 
+uint64_t FilePath::getModificationTime(const UString &p) {
+	std::time_t time = (std::time_t) -1;
+
+	try {
+		time = last_write_time(p.c_str());
+	} catch (...) {
+	}
+
+	if ((time == ((std::time_t) -1)) || (time < 0)) {
+		warning("Failed to get modification time of file \"%s\"", p.c_str());
+		return 0;
+	}
+
+	return (uint64_t) time;
+}
+
 UString FilePath::getFile(const UString &p) {
 	path file(p.c_str());
 
@@ -299,21 +319,14 @@ static UString findSubDirectory_internal(const UString &directory, const UString
 			return parent.generic_string();
 		}
 
-		// Iterator over the directory's contents
-		directory_iterator itEnd;
-		for (directory_iterator itDir(dirPath); itDir != itEnd; ++itDir) {
-			if (is_directory(itDir->status())) {
-				// It's a directory. Check if it's the one we're looking for
+		// Look the name up in the directory's cached contents
+		std::shared_ptr<const DirectorySnapshot> snapshot = DirectorySnapshot::get(directory);
+		if (!snapshot)
+			return "";
 
-				if (caseInsensitive) {
-					if (iequals(itDir->path().filename().string(), subDirectory.c_str()))
-						return itDir->path().generic_string();
-				} else {
-					if (equals(itDir->path().filename().string(), subDirectory.c_str()))
-						return itDir->path().generic_string();
-				}
-			}
-		}
+		const DirectorySnapshot::Entry *entry = snapshot->findDirectory(subDirectory, caseInsensitive);
+		if (entry)
+			return (dirPath / entry->name.c_str()).generic_string();
 	} catch (...) {
 	}
 
@@ -0,0 +1,121 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Fixed-rate simulation ticks and frame pacing.
+ */
+
+#include <thread>
+
+#include "src/common/util.h"
+#include "src/common/fixedtimestep.h"
+
+namespace Common {
+
+/** How long before a deadline we stop sleeping and start yielding instead. */
+static const std::chrono::microseconds kSleepMargin(1000);
+
+void sleepUntil(std::chrono::steady_clock::time_point time) {
+	typedef std::chrono::steady_clock Clock;
+
+	if ((time - Clock::now()) > kSleepMargin)
+		std::this_thread::sleep_until(time - kSleepMargin);
+
+	while (Clock::now() < time)
+		std::this_thread::yield();
+}
+
+
+FixedTimestep::FixedTimestep(uint32_t tickLength, size_t maxTicks) :
+		_tickLength(std::chrono::milliseconds(MAX<uint32_t>(tickLength, 1))), _maxTicks(MAX<size_t>(maxTicks, 1)) {
+
+	reset();
+}
+
+void FixedTimestep::reset() {
+	_nextTick = Clock::now() + _tickLength;
+}
+
+size_t FixedTimestep::advance() {
+	const Clock::time_point now = Clock::now();
+	if (now < _nextTick)
+		return 0;
+
+	const size_t ticks = ((now - _nextTick) / _tickLength) + 1;
+	if (ticks > _maxTicks) {
+		// Too far behind to catch up. Drop the backlog
+		_nextTick = now + _tickLength;
+		return _maxTicks;
+	}
+
+	_nextTick += ticks * _tickLength;
+	return ticks;
+}
+
+uint32_t FixedTimestep::getTickLength() const {
+	return std::chrono::duration_cast<std::chrono::milliseconds>(_tickLength).count();
+}
+
+float FixedTimestep::getTickSeconds() const {
+	return std::chrono::duration_cast<std::chrono::duration<float>>(_tickLength).count();
+}
+
+float FixedTimestep::getInterpolation() const {
+	const Clock::duration left = _nextTick - Clock::now();
+	if (left <= Clock::duration::zero())
+		return 1.0f;
+
+	return 1.0f - CLIP(std::chrono::duration<float>(left) / std::chrono::duration<float>(_tickLength), 0.0f, 1.0f);
+}
+
+void FixedTimestep::waitForNextTick() const {
+	sleepUntil(_nextTick);
+}
+
+
+FramePacer::FramePacer(uint32_t fps) : _frameLength(Clock::duration::zero()) {
+	setRate(fps);
+}
+
+void FramePacer::setRate(uint32_t fps) {
+	if (fps == 0)
+		_frameLength = Clock::duration::zero();
+	else
+		_frameLength = std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(1)) / fps;
+
+	_nextFrame = Clock::now();
+}
+
+void FramePacer::wait() {
+	if (_frameLength == Clock::duration::zero())
+		return;
+
+	const Clock::time_point now = Clock::now();
+
+	_nextFrame += _frameLength;
+
+	// If we're more than a frame late, don't try to catch up with the lost frames
+	if (_nextFrame < (now - _frameLength))
+		_nextFrame = now;
+
+	sleepUntil(_nextFrame);
+}
+
+} // End of namespace Common
@@ -0,0 +1,114 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Fixed-rate simulation ticks and frame pacing.
+ */
+
+#ifndef COMMON_FIXEDTIMESTEP_H
+#define COMMON_FIXEDTIMESTEP_H
+
+#include <chrono>
+
+#include "src/common/types.h"
+
+namespace Common {
+
+/** Sleep until that point in time.
+ *
+ *  The OS scheduler only wakes us up with a granularity of about a
+ *  millisecond. So we sleep until shortly before the deadline and only
+ *  yield the remaining fraction of a millisecond away.
+ */
+void sleepUntil(std::chrono::steady_clock::time_point time);
+
+/** Splitting real time into simulation ticks of a fixed length.
+ *
+ *  Every frame, advance() returns how many ticks have become due since
+ *  the last call. The caller then runs its simulation that many times,
+ *  each time with the same, fixed tick length, independent of how long
+ *  the frame took.
+ *
+ *  If the simulation falls behind by more than maxTicks ticks (for
+ *  example, after loading a module), the backlog is dropped instead of
+ *  being run all at once.
+ */
+class FixedTimestep {
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	/** Create a timestep.
+	 *
+	 *  @param tickLength The length of one tick, in milliseconds.
+	 *  @param maxTicks   The maximum number of ticks advance() returns at once.
+	 */
+	FixedTimestep(uint32_t tickLength, size_t maxTicks = 10);
+
+	/** Restart counting ticks from now, dropping all ticks that are due. */
+	void reset();
+
+	/** Return the number of ticks that are due now, and consume them. */
+	size_t advance();
+
+	/** Return the length of one tick, in milliseconds. */
+	uint32_t getTickLength() const;
+	/** Return the length of one tick, in seconds. */
+	float getTickSeconds() const;
+
+	/** Return how far, from 0.0f to 1.0f, the current time has progressed into
+	 *  the next, not yet due tick. Used to interpolate between two ticks. */
+	float getInterpolation() const;
+
+	/** Sleep until the next tick is due. */
+	void waitForNextTick() const;
+
+private:
+	Clock::duration _tickLength;
+	size_t _maxTicks;
+
+	Clock::time_point _nextTick; ///< When the next tick is due.
+};
+
+/** Limiting how many frames are rendered per second.
+ *
+ *  wait() sleeps until the next frame is due. With a rate of 0, frames
+ *  aren't limited and wait() returns immediately.
+ */
+class FramePacer {
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	FramePacer(uint32_t fps = 0);
+
+	/** Set the number of frames per second. 0 disables the limit. */
+	void setRate(uint32_t fps);
+
+	/** Wait until the next frame is due. */
+	void wait();
+
+private:
+	Clock::duration _frameLength;
+
+	Clock::time_point _nextFrame; ///< When the next frame is due.
+};
+
+} // End of namespace Common
+
+#endif // COMMON_FIXEDTIMESTEP_H
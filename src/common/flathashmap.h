@@ -0,0 +1,266 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A flat, open-addressing hash map.
+ */
+
+#ifndef COMMON_FLATHASHMAP_H
+#define COMMON_FLATHASHMAP_H
+
+#include <cstddef>
+
+#include <vector>
+#include <functional>
+#include <utility>
+
+#include "src/common/types.h"
+
+namespace Common {
+
+/** A flat hash map with open addressing and linear probing.
+ *
+ *  All entries live in one contiguous array, which makes lookups
+ *  considerably more cache-friendly than with a node-based map.
+ *  Deletion uses backward shifting, so no tombstones accumulate.
+ *
+ *  Inserting or erasing an entry may move other entries around:
+ *  pointers into the map and iterators are invalidated by both.
+ *
+ *  Key and Value need to be default-constructible and movable.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key> >
+class FlatHashMap {
+public:
+	struct Entry {
+		Key   key;
+		Value value;
+	};
+
+	template<typename E, typename M>
+	class IteratorBase {
+	public:
+		IteratorBase() : _map(0), _index(0) { }
+
+		/** Allow converting an iterator into a const_iterator. */
+		template<typename E2, typename M2>
+		IteratorBase(const IteratorBase<E2, M2> &it) : _map(it._map), _index(it._index) { }
+
+		E &operator*() const { return _map->_entries[_index]; }
+		E *operator->() const { return &_map->_entries[_index]; }
+
+		IteratorBase &operator++() {
+			_index = _map->nextUsed(_index + 1);
+			return *this;
+		}
+
+		bool operator==(const IteratorBase &right) const { return _index == right._index; }
+		bool operator!=(const IteratorBase &right) const { return _index != right._index; }
+
+	private:
+		M *_map;
+		size_t _index;
+
+		IteratorBase(M *map, size_t index) : _map(map), _index(index) { }
+
+		template<typename E2, typename M2> friend class IteratorBase;
+		friend class FlatHashMap;
+	};
+
+	typedef IteratorBase<Entry, FlatHashMap> iterator;
+	typedef IteratorBase<const Entry, const FlatHashMap> const_iterator;
+
+	FlatHashMap() : _size(0), _mask(0) { }
+
+	bool empty() const { return _size == 0; }
+	size_t size() const { return _size; }
+
+	/** Return the number of slots currently allocated. */
+	size_t capacity() const { return _entries.size(); }
+
+	void clear() {
+		_entries.clear();
+		_used.clear();
+
+		_size = 0;
+		_mask = 0;
+	}
+
+	/** Make sure that count entries fit without rehashing. */
+	void reserve(size_t count) {
+		size_t needed = kMinCapacity;
+		while (!fits(count, needed))
+			needed <<= 1;
+
+		if (needed > _entries.size())
+			rehash(needed);
+	}
+
+	iterator begin() { return iterator(this, nextUsed(0)); }
+	iterator end() { return iterator(this, _entries.size()); }
+
+	const_iterator begin() const { return const_iterator(this, nextUsed(0)); }
+	const_iterator end() const { return const_iterator(this, _entries.size()); }
+
+	/** Return a pointer to the value of this key, or 0 if the key doesn't exist. */
+	Value *find(const Key &key) {
+		const size_t index = findIndex(key);
+		return (index == kInvalid) ? 0 : &_entries[index].value;
+	}
+
+	/** Return a pointer to the value of this key, or 0 if the key doesn't exist. */
+	const Value *find(const Key &key) const {
+		const size_t index = findIndex(key);
+		return (index == kInvalid) ? 0 : &_entries[index].value;
+	}
+
+	bool contains(const Key &key) const {
+		return findIndex(key) != kInvalid;
+	}
+
+	/** Return the value of this key, default-constructing it if it doesn't exist yet. */
+	Value &operator[](const Key &key) {
+		if (!fits(_size + 1, _entries.size()))
+			rehash(_entries.empty() ? kMinCapacity : (_entries.size() * 2));
+
+		size_t index = slot(key);
+		while (_used[index]) {
+			if (_equal(_entries[index].key, key))
+				return _entries[index].value;
+
+			index = (index + 1) & _mask;
+		}
+
+		_used[index] = 1;
+		_entries[index].key   = key;
+		_entries[index].value = Value();
+
+		_size++;
+
+		return _entries[index].value;
+	}
+
+	/** Remove this key from the map. Return false if the key didn't exist. */
+	bool erase(const Key &key) {
+		size_t index = findIndex(key);
+		if (index == kInvalid)
+			return false;
+
+		/* Backward-shift deletion: pull every following entry of the same
+		 * probe sequence one slot back, so that lookups never stop early. */
+
+		size_t next = (index + 1) & _mask;
+		while (_used[next]) {
+			const size_t home = slot(_entries[next].key);
+
+			// Can the entry in next move into the hole at index?
+			if (((next - home) & _mask) >= ((next - index) & _mask)) {
+				_entries[index] = std::move(_entries[next]);
+				index = next;
+			}
+
+			next = (next + 1) & _mask;
+		}
+
+		_used[index] = 0;
+		_entries[index].key   = Key();
+		_entries[index].value = Value();
+
+		_size--;
+
+		return true;
+	}
+
+private:
+	static const size_t kMinCapacity = 16;
+	static const size_t kInvalid = SIZE_MAX;
+
+	std::vector<Entry> _entries;
+	std::vector<byte>  _used;
+
+	size_t _size;
+	size_t _mask;
+
+	Hash  _hash;
+	Equal _equal;
+
+	/** Keep the load factor at or below 3/4. */
+	static bool fits(size_t count, size_t capacity) {
+		return (count * 4) <= (capacity * 3);
+	}
+
+	/** Map a key to its home slot.
+	 *
+	 *  The hash is multiplied by 2^64 / phi before masking, so that even poor
+	 *  (or identity) hash functions spread out over the whole table.
+	 */
+	size_t slot(const Key &key) const {
+		const uint64_t h = static_cast<uint64_t>(_hash(key)) * UINT64_C(0x9E3779B97F4A7C15);
+		return static_cast<size_t>(h >> 32) & _mask;
+	}
+
+	size_t findIndex(const Key &key) const {
+		if (_size == 0)
+			return kInvalid;
+
+		size_t index = slot(key);
+		while (_used[index]) {
+			if (_equal(_entries[index].key, key))
+				return index;
+
+			index = (index + 1) & _mask;
+		}
+
+		return kInvalid;
+	}
+
+	size_t nextUsed(size_t index) const {
+		while ((index < _used.size()) && !_used[index])
+			index++;
+
+		return index;
+	}
+
+	void rehash(size_t capacity) {
+		std::vector<Entry> oldEntries(capacity);
+		std::vector<byte>  oldUsed(capacity, 0);
+
+		oldEntries.swap(_entries);
+		oldUsed.swap(_used);
+
+		_mask = capacity - 1;
+
+		for (size_t i = 0; i < oldEntries.size(); i++) {
+			if (!oldUsed[i])
+				continue;
+
+			size_t index = slot(oldEntries[i].key);
+			while (_used[index])
+				index = (index + 1) & _mask;
+
+			_used[index] = 1;
+			_entries[index] = std::move(oldEntries[i]);
+		}
+	}
+};
+
+} // End of namespace Common
+
+#endif // COMMON_FLATHASHMAP_H
@@ -0,0 +1,106 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A linear allocator for short-lived, per-frame data.
+ */
+
+#include "src/common/util.h"
+#include "src/common/framearena.h"
+
+namespace Common {
+
+FrameArena::Block::Block(size_t s) : data(new byte[s]), size(s), used(0) {
+}
+
+
+FrameArena::FrameArena(size_t blockSize) : _blockSize(blockSize), _current(0) {
+}
+
+FrameArena::~FrameArena() {
+}
+
+void *FrameArena::allocate(size_t size, size_t alignment) {
+	size = MAX<size_t>(size, 1);
+
+	while (true) {
+		Block *block = _current.load(std::memory_order_acquire);
+		if (block) {
+			void *data = allocate(*block, size, alignment);
+			if (data)
+				return data;
+		}
+
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		// Another thread already added a fresh block while we were waiting
+		if (_current.load(std::memory_order_relaxed) != block)
+			continue;
+
+		_blocks.emplace_back(std::make_unique<Block>(MAX(_blockSize, size + alignment)));
+		_current.store(_blocks.back().get(), std::memory_order_release);
+	}
+}
+
+void *FrameArena::allocate(Block &block, size_t size, size_t alignment) {
+	const uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+
+	size_t used = block.used.load(std::memory_order_relaxed);
+	while (true) {
+		const size_t start = ((base + used + alignment - 1) & ~(uintptr_t)(alignment - 1)) - base;
+		if ((start + size) > block.size)
+			return 0;
+
+		if (block.used.compare_exchange_weak(used, start + size, std::memory_order_relaxed))
+			return block.data.get() + start;
+	}
+}
+
+void FrameArena::reset() {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	// Merge all blocks, so that the next frame fits into a single one
+	if (_blocks.size() > 1) {
+		size_t size = 0;
+		for (std::vector<std::unique_ptr<Block>>::const_iterator b = _blocks.begin(); b != _blocks.end(); ++b)
+			size += (*b)->size;
+
+		_blocks.clear();
+		_blocks.emplace_back(std::make_unique<Block>(size));
+	}
+
+	if (_blocks.empty())
+		return;
+
+	_blocks.front()->used.store(0, std::memory_order_relaxed);
+	_current.store(_blocks.front().get(), std::memory_order_release);
+}
+
+size_t FrameArena::getCapacity() const {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	size_t size = 0;
+	for (std::vector<std::unique_ptr<Block>>::const_iterator b = _blocks.begin(); b != _blocks.end(); ++b)
+		size += (*b)->size;
+
+	return size;
+}
+
+} // End of namespace Common
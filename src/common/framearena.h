@@ -0,0 +1,133 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A linear allocator for short-lived, per-frame data.
+ */
+
+#ifndef COMMON_FRAMEARENA_H
+#define COMMON_FRAMEARENA_H
+
+#include <cstddef>
+
+#include <vector>
+#include <memory>
+#include <atomic>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/system.h"
+#include "src/common/types.h"
+#include "src/common/mutex.h"
+
+namespace Common {
+
+/** A linear allocator for temporary data that all dies at the same time.
+ *
+ *  Allocating just bumps a pointer, and nothing is ever freed on its own.
+ *  Instead, the whole arena is reset in one go, typically once per frame.
+ *  When the arena runs out of space, it grabs another block from the heap.
+ *  On the next reset, all blocks are merged into a single one big enough
+ *  to hold them all, so that an arena settles on a fixed size and stops
+ *  allocating from the heap after the first few frames.
+ *
+ *  allocate() may be called from several threads at once. reset() may not,
+ *  and nothing allocated from the arena may be in use anymore when it is.
+ */
+class FrameArena : boost::noncopyable {
+public:
+	FrameArena(size_t blockSize = 64 * 1024);
+	~FrameArena();
+
+	/** Allocate size bytes, aligned to alignment, which must be a power of 2. */
+	void *allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+	/** Throw away everything allocated so far. */
+	void reset();
+
+	/** Return the number of bytes allocated from the heap for this arena. */
+	size_t getCapacity() const;
+
+private:
+	struct Block {
+		std::unique_ptr<byte[]> data;
+		size_t size;
+
+		std::atomic<size_t> used;
+
+		Block(size_t s);
+	};
+
+	size_t _blockSize;
+
+	std::vector<std::unique_ptr<Block>> _blocks; ///< All blocks. Guarded by _mutex.
+	std::atomic<Block *> _current;               ///< The block we're allocating from.
+
+	mutable std::mutex _mutex;
+
+	/** Try to allocate from this block. */
+	static void *allocate(Block &block, size_t size, size_t alignment);
+};
+
+/** An STL allocator taking its memory from a FrameArena. */
+template<typename T>
+class FrameAllocator {
+public:
+	typedef T value_type;
+
+	FrameAllocator(FrameArena &arena) : _arena(&arena) {
+	}
+
+	template<typename U>
+	FrameAllocator(const FrameAllocator<U> &allocator) : _arena(allocator._arena) {
+	}
+
+	T *allocate(size_t n) {
+		return static_cast<T *>(_arena->allocate(n * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T *UNUSED(p), size_t UNUSED(n)) {
+		// Freed when the arena is reset
+	}
+
+	template<typename U>
+	bool operator==(const FrameAllocator<U> &allocator) const {
+		return _arena == allocator._arena;
+	}
+
+	template<typename U>
+	bool operator!=(const FrameAllocator<U> &allocator) const {
+		return _arena != allocator._arena;
+	}
+
+private:
+	FrameArena *_arena;
+
+	template<typename U>
+	friend class FrameAllocator;
+};
+
+/** A vector living in a FrameArena. */
+template<typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+} // End of namespace Common
+
+#endif // COMMON_FRAMEARENA_H
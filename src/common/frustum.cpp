@@ -0,0 +1,87 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A view frustum, for visibility culling.
+ */
+
+#include "external/glm/geometric.hpp"
+
+#include "src/common/frustum.h"
+#include "src/common/boundingbox.h"
+
+namespace Common {
+
+Frustum::Frustum() {
+	for (size_t i = 0; i < kPlaneMAX; i++)
+		_planes[i] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+void Frustum::set(const glm::mat4 &viewProjection) {
+	// Gribb & Hartmann, "Fast Extraction of Viewing Frustum Planes from the
+	// World-View-Projection Matrix". glm matrices are column-major.
+
+	const glm::vec4 row0(viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]);
+	const glm::vec4 row1(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]);
+	const glm::vec4 row2(viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]);
+	const glm::vec4 row3(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+
+	_planes[kPlaneLeft  ] = row3 + row0;
+	_planes[kPlaneRight ] = row3 - row0;
+	_planes[kPlaneBottom] = row3 + row1;
+	_planes[kPlaneTop   ] = row3 - row1;
+	_planes[kPlaneNear  ] = row3 + row2;
+	_planes[kPlaneFar   ] = row3 - row2;
+
+	for (size_t i = 0; i < kPlaneMAX; i++) {
+		const float length = glm::length(glm::vec3(_planes[i]));
+		if (length > 0.0f)
+			_planes[i] /= length;
+	}
+}
+
+bool Frustum::isIn(const glm::vec3 &min, const glm::vec3 &max) const {
+	for (size_t i = 0; i < kPlaneMAX; i++) {
+		const glm::vec4 &plane = _planes[i];
+
+		// The corner of the box furthest along the plane normal
+		const glm::vec3 corner(plane.x >= 0.0f ? max.x : min.x,
+		                       plane.y >= 0.0f ? max.y : min.y,
+		                       plane.z >= 0.0f ? max.z : min.z);
+
+		if ((glm::dot(glm::vec3(plane), corner) + plane.w) < 0.0f)
+			return false;
+	}
+
+	return true;
+}
+
+bool Frustum::isIn(const BoundingBox &box) const {
+	if (box.empty())
+		return true;
+
+	glm::vec3 min, max;
+	box.getMin(min.x, min.y, min.z);
+	box.getMax(max.x, max.y, max.z);
+
+	return isIn(min, max);
+}
+
+} // End of namespace Common
@@ -0,0 +1,75 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A view frustum, for visibility culling.
+ */
+
+#ifndef COMMON_FRUSTUM_H
+#define COMMON_FRUSTUM_H
+
+#include "external/glm/vec4.hpp"
+#include "external/glm/mat4x4.hpp"
+
+namespace Common {
+
+class BoundingBox;
+
+/** The six clipping planes of a view volume, in world space. */
+class Frustum {
+public:
+	/** Create a frustum that contains everything. */
+	Frustum();
+
+	/** Extract the frustum planes from a combined projection * modelview matrix. */
+	void set(const glm::mat4 &viewProjection);
+
+	/** Is any part of this axis-aligned box within the frustum?
+	 *
+	 *  The test is conservative: boxes close to a corner of the frustum might
+	 *  be reported as visible even if they're not, but a visible box is never
+	 *  reported as invisible.
+	 */
+	bool isIn(const glm::vec3 &min, const glm::vec3 &max) const;
+
+	/** Is any part of this bounding box within the frustum?
+	 *
+	 *  Empty bounding boxes are always considered visible.
+	 */
+	bool isIn(const BoundingBox &box) const;
+
+private:
+	enum Plane {
+		kPlaneLeft = 0,
+		kPlaneRight,
+		kPlaneBottom,
+		kPlaneTop,
+		kPlaneNear,
+		kPlaneFar,
+		kPlaneMAX
+	};
+
+	/** The planes, as (normal, distance), with the normals pointing inwards. */
+	glm::vec4 _planes[kPlaneMAX];
+};
+
+} // End of namespace Common
+
+#endif // COMMON_FRUSTUM_H
@@ -27,6 +27,10 @@
 
 #include <vector>
 
+#if defined(__SSE__)
+	#include <xmmintrin.h>
+#endif
+
 #include "external/glm/vec2.hpp"
 #include "external/glm/vec3.hpp"
 #include "external/glm/geometric.hpp"
@@ -337,6 +341,294 @@ static inline bool intersectTriangleSegment2D(const glm::vec2 &vA, const glm::ve
 	return false;
 }
 
+/** The number of shapes the batched intersection tests below handle at once. */
+static const size_t kIntersectBatchSize = 4;
+
+/** Intersect the line through origin along direction with a triangle.
+ *
+ *  Like glm::intersectRayTriangle(), this hits both sides of the triangle,
+ *  and anywhere along the line. The distance is in units of direction.
+ */
+static inline bool intersectRayTriangle(const glm::vec3 &origin, const glm::vec3 &direction,
+                                        const glm::vec3 &vertA, const glm::vec3 &vertB,
+                                        const glm::vec3 &vertC, float &distance) {
+	// Moeller-Trumbore.
+	const glm::vec3 edge1 = vertB - vertA;
+	const glm::vec3 edge2 = vertC - vertA;
+
+	const glm::vec3 p = glm::cross(direction, edge2);
+	const float det = glm::dot(edge1, p);
+	if (fabs(det) <= FLT_EPSILON)
+		return false;
+
+	const float invDet = 1.f / det;
+
+	const glm::vec3 s = origin - vertA;
+	const float u = glm::dot(s, p) * invDet;
+	if ((u < 0.f) || (u > 1.f))
+		return false;
+
+	const glm::vec3 q = glm::cross(s, edge1);
+	const float v = glm::dot(direction, q) * invDet;
+	if ((v < 0.f) || ((u + v) > 1.f))
+		return false;
+
+	distance = glm::dot(edge2, q) * invDet;
+	return true;
+}
+
+/** Intersect the line through origin along direction with up to kIntersectBatchSize triangles.
+ *
+ *  Works like intersectRayTriangle() on each triangle.
+ *
+ *  @return A mask with bit i set if triangle i was hit, in which case
+ *          distances[i] holds the distance of the hit.
+ */
+static inline uint32_t intersectRayTriangles(const glm::vec3 &origin, const glm::vec3 &direction,
+                                             const glm::vec3 *vertA, const glm::vec3 *vertB,
+                                             const glm::vec3 *vertC, size_t count,
+                                             float distances[kIntersectBatchSize]) {
+
+#if defined(__SSE__)
+	float ax[4] = { 0.f }, ay[4] = { 0.f }, az[4] = { 0.f };
+	float bx[4] = { 0.f }, by[4] = { 0.f }, bz[4] = { 0.f };
+	float cx[4] = { 0.f }, cy[4] = { 0.f }, cz[4] = { 0.f };
+	for (size_t i = 0; i < count; i++) {
+		ax[i] = vertA[i].x; ay[i] = vertA[i].y; az[i] = vertA[i].z;
+		bx[i] = vertB[i].x; by[i] = vertB[i].y; bz[i] = vertB[i].z;
+		cx[i] = vertC[i].x; cy[i] = vertC[i].y; cz[i] = vertC[i].z;
+	}
+
+	const __m128 vAx = _mm_loadu_ps(ax), vAy = _mm_loadu_ps(ay), vAz = _mm_loadu_ps(az);
+
+	const __m128 e1x = _mm_sub_ps(_mm_loadu_ps(bx), vAx);
+	const __m128 e1y = _mm_sub_ps(_mm_loadu_ps(by), vAy);
+	const __m128 e1z = _mm_sub_ps(_mm_loadu_ps(bz), vAz);
+	const __m128 e2x = _mm_sub_ps(_mm_loadu_ps(cx), vAx);
+	const __m128 e2y = _mm_sub_ps(_mm_loadu_ps(cy), vAy);
+	const __m128 e2z = _mm_sub_ps(_mm_loadu_ps(cz), vAz);
+
+	const __m128 dx = _mm_set1_ps(direction.x);
+	const __m128 dy = _mm_set1_ps(direction.y);
+	const __m128 dz = _mm_set1_ps(direction.z);
+
+	// p = direction x edge2
+	const __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+	const __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+	const __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+
+	const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+	const __m128 absDet = _mm_andnot_ps(_mm_set1_ps(-0.f), det);
+
+	const __m128 one = _mm_set1_ps(1.f);
+	const __m128 zero = _mm_setzero_ps();
+
+	__m128 hit = _mm_cmpgt_ps(absDet, _mm_set1_ps(FLT_EPSILON));
+
+	// Avoid dividing by zero in the lanes that already missed
+	const __m128 invDet = _mm_div_ps(one, _mm_or_ps(_mm_and_ps(hit, det), _mm_andnot_ps(hit, one)));
+
+	const __m128 sx = _mm_sub_ps(_mm_set1_ps(origin.x), vAx);
+	const __m128 sy = _mm_sub_ps(_mm_set1_ps(origin.y), vAy);
+	const __m128 sz = _mm_sub_ps(_mm_set1_ps(origin.z), vAz);
+
+	const __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)), invDet);
+
+	// q = s x edge1
+	const __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+	const __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+	const __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+
+	const __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)), invDet);
+	const __m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), invDet);
+
+	hit = _mm_and_ps(hit, _mm_cmpge_ps(u, zero));
+	hit = _mm_and_ps(hit, _mm_cmpge_ps(v, zero));
+	hit = _mm_and_ps(hit, _mm_cmple_ps(_mm_add_ps(u, v), one));
+
+	_mm_storeu_ps(distances, t);
+
+	return static_cast<uint32_t>(_mm_movemask_ps(hit)) & ((1u << count) - 1);
+#else
+	uint32_t hits = 0;
+	for (size_t i = 0; i < count; i++)
+		if (intersectRayTriangle(origin, direction, vertA[i], vertB[i], vertC[i], distances[i]))
+			hits |= 1u << i;
+
+	return hits;
+#endif
+}
+
+/** Intersect a segment with up to kIntersectBatchSize axis-aligned boxes.
+ *
+ *  @return A mask with bit i set if the segment touches box i.
+ */
+static inline uint32_t intersectSegmentBoxes(const glm::vec3 &start, const glm::vec3 &end,
+                                             const glm::vec3 *min, const glm::vec3 *max, size_t count) {
+
+	const glm::vec3 direction = end - start;
+
+#if defined(__SSE__)
+	__m128 tMin = _mm_setzero_ps();
+	__m128 tMax = _mm_set1_ps(1.f);
+	__m128 hit  = _mm_cmple_ps(tMin, tMax);
+
+	for (int axis = 0; axis < 3; axis++) {
+		float boxMin[4] = { 0.f }, boxMax[4] = { 0.f };
+		for (size_t i = 0; i < count; i++) {
+			boxMin[i] = min[i][axis];
+			boxMax[i] = max[i][axis];
+		}
+
+		const __m128 vMin = _mm_loadu_ps(boxMin);
+		const __m128 vMax = _mm_loadu_ps(boxMax);
+		const __m128 s = _mm_set1_ps(start[axis]);
+
+		if (fabs(direction[axis]) <= FLT_EPSILON) {
+			// Parallel to the slab, so the start has to be within it
+			hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmpge_ps(s, vMin), _mm_cmple_ps(s, vMax)));
+			continue;
+		}
+
+		const __m128 invD = _mm_set1_ps(1.f / direction[axis]);
+		const __m128 t1 = _mm_mul_ps(_mm_sub_ps(vMin, s), invD);
+		const __m128 t2 = _mm_mul_ps(_mm_sub_ps(vMax, s), invD);
+
+		tMin = _mm_max_ps(tMin, _mm_min_ps(t1, t2));
+		tMax = _mm_min_ps(tMax, _mm_max_ps(t1, t2));
+	}
+
+	hit = _mm_and_ps(hit, _mm_cmple_ps(tMin, tMax));
+
+	return static_cast<uint32_t>(_mm_movemask_ps(hit)) & ((1u << count) - 1);
+#else
+	uint32_t hits = 0;
+	for (size_t i = 0; i < count; i++) {
+		float tMin = 0.f, tMax = 1.f;
+
+		bool hit = true;
+		for (int axis = 0; (axis < 3) && hit; axis++) {
+			if (fabs(direction[axis]) <= FLT_EPSILON) {
+				hit = (start[axis] >= min[i][axis]) && (start[axis] <= max[i][axis]);
+				continue;
+			}
+
+			const float t1 = (min[i][axis] - start[axis]) / direction[axis];
+			const float t2 = (max[i][axis] - start[axis]) / direction[axis];
+
+			tMin = MAX(tMin, MIN(t1, t2));
+			tMax = MIN(tMax, MAX(t1, t2));
+		}
+
+		if (hit && (tMin <= tMax))
+			hits |= 1u << i;
+	}
+
+	return hits;
+#endif
+}
+
+/** Intersect a segment with up to kIntersectBatchSize triangles in the XY plane.
+ *
+ *  Uses the separating axis theorem, with the normal of the segment and
+ *  the normals of the triangle edges as axes.
+ *
+ *  @return A mask with bit i set if the segment touches triangle i.
+ */
+static inline uint32_t intersectSegmentTriangles2D(const glm::vec2 &start, const glm::vec2 &end,
+                                                   const glm::vec2 *vertA, const glm::vec2 *vertB,
+                                                   const glm::vec2 *vertC, size_t count) {
+
+#if defined(__SSE__)
+	float ax[4] = { 0.f }, ay[4] = { 0.f };
+	float bx[4] = { 0.f }, by[4] = { 0.f };
+	float cx[4] = { 0.f }, cy[4] = { 0.f };
+	for (size_t i = 0; i < count; i++) {
+		ax[i] = vertA[i].x; ay[i] = vertA[i].y;
+		bx[i] = vertB[i].x; by[i] = vertB[i].y;
+		cx[i] = vertC[i].x; cy[i] = vertC[i].y;
+	}
+
+	const __m128 x[3] = { _mm_loadu_ps(ax), _mm_loadu_ps(bx), _mm_loadu_ps(cx) };
+	const __m128 y[3] = { _mm_loadu_ps(ay), _mm_loadu_ps(by), _mm_loadu_ps(cy) };
+
+	const __m128 sx = _mm_set1_ps(start.x), sy = _mm_set1_ps(start.y);
+	const __m128 ex = _mm_set1_ps(end.x)  , ey = _mm_set1_ps(end.y);
+	const __m128 zero = _mm_setzero_ps();
+
+	// The normal of the segment: all corners on the same side separate
+	const __m128 nx = _mm_set1_ps(start.y - end.y);
+	const __m128 ny = _mm_set1_ps(end.x - start.x);
+
+	__m128 allAbove = _mm_cmpeq_ps(zero, zero);
+	__m128 allBelow = allAbove;
+	for (int c = 0; c < 3; c++) {
+		const __m128 d = _mm_add_ps(_mm_mul_ps(nx, _mm_sub_ps(x[c], sx)), _mm_mul_ps(ny, _mm_sub_ps(y[c], sy)));
+
+		allAbove = _mm_and_ps(allAbove, _mm_cmpgt_ps(d, zero));
+		allBelow = _mm_and_ps(allBelow, _mm_cmplt_ps(d, zero));
+	}
+
+	__m128 separated = _mm_or_ps(allAbove, allBelow);
+
+	// The normals of the triangle edges
+	for (int e = 0; e < 3; e++) {
+		const int n = (e + 1) % 3, o = (e + 2) % 3;
+
+		const __m128 enx = _mm_sub_ps(y[e], y[n]);
+		const __m128 eny = _mm_sub_ps(x[n], x[e]);
+
+		// The edge itself projects to 0, the opposite corner to k
+		const __m128 k  = _mm_add_ps(_mm_mul_ps(enx, _mm_sub_ps(x[o], x[e])), _mm_mul_ps(eny, _mm_sub_ps(y[o], y[e])));
+		const __m128 d1 = _mm_add_ps(_mm_mul_ps(enx, _mm_sub_ps(sx, x[e])), _mm_mul_ps(eny, _mm_sub_ps(sy, y[e])));
+		const __m128 d2 = _mm_add_ps(_mm_mul_ps(enx, _mm_sub_ps(ex, x[e])), _mm_mul_ps(eny, _mm_sub_ps(ey, y[e])));
+
+		const __m128 triMin = _mm_min_ps(zero, k), triMax = _mm_max_ps(zero, k);
+		const __m128 segMin = _mm_min_ps(d1, d2) , segMax = _mm_max_ps(d1, d2);
+
+		separated = _mm_or_ps(separated, _mm_or_ps(_mm_cmplt_ps(segMax, triMin), _mm_cmpgt_ps(segMin, triMax)));
+	}
+
+	return static_cast<uint32_t>(~_mm_movemask_ps(separated)) & ((1u << count) - 1);
+#else
+	uint32_t hits = 0;
+	for (size_t i = 0; i < count; i++) {
+		const glm::vec2 corners[3] = { vertA[i], vertB[i], vertC[i] };
+
+		// The normal of the segment: all corners on the same side separate
+		const glm::vec2 normal(start.y - end.y, end.x - start.x);
+
+		bool allAbove = true, allBelow = true;
+		for (int c = 0; c < 3; c++) {
+			const float d = glm::dot(normal, corners[c] - start);
+
+			allAbove = allAbove && (d > 0.f);
+			allBelow = allBelow && (d < 0.f);
+		}
+
+		bool separated = allAbove || allBelow;
+
+		// The normals of the triangle edges
+		for (int e = 0; (e < 3) && !separated; e++) {
+			const glm::vec2 &vE = corners[e], &vN = corners[(e + 1) % 3], &vO = corners[(e + 2) % 3];
+			const glm::vec2 edgeNormal(vE.y - vN.y, vN.x - vE.x);
+
+			// The edge itself projects to 0, the opposite corner to k
+			const float k  = glm::dot(edgeNormal, vO - vE);
+			const float d1 = glm::dot(edgeNormal, start - vE);
+			const float d2 = glm::dot(edgeNormal, end - vE);
+
+			separated = (MAX(d1, d2) < MIN(0.f, k)) || (MIN(d1, d2) > MAX(0.f, k));
+		}
+
+		if (!separated)
+			hits |= 1u << i;
+	}
+
+	return hits;
+#endif
+}
+
 }
 
 #endif // COMMON_GEOMETRY_H
@@ -103,12 +103,31 @@ static inline uint32_t hashStringFNV32(const UString &string, Encoding encoding)
 // '--- 32bit Fowler-Noll-Vo hash by Glenn Fowler, Landon Curt Noll and Phong Vo ---'
 
 // .--- 64bit Fowler-Noll-Vo hash by Glenn Fowler, Landon Curt Noll and Phong Vo ---.
+/** The value every 64bit FNV hash starts with. */
+static const uint64_t kFNV64OffsetBasis = 0xCBF29CE484222325ULL;
+
 static inline uint64_t hashFNV64(uint64_t hash, uint32_t c) {
 	return (hash * 1099511628211LL) ^ c;
 }
 
+/** Mix all 4 bytes of a value into a 64bit FNV hash, lowest byte first. */
+static inline uint64_t hashFNV64Value(uint64_t hash, uint32_t value) {
+	for (size_t i = 0; i < 4; i++, value >>= 8)
+		hash = hashFNV64(hash, value & 0xFF);
+
+	return hash;
+}
+
+/** Mix all 8 bytes of a value into a 64bit FNV hash, lowest byte first. */
+static inline uint64_t hashFNV64Value(uint64_t hash, uint64_t value) {
+	hash = hashFNV64Value(hash, (uint32_t) (value & 0xFFFFFFFF));
+	hash = hashFNV64Value(hash, (uint32_t) (value >> 32));
+
+	return hash;
+}
+
 static inline uint64_t hashStringFNV64(const UString &string) {
-	uint64_t hash = 0xCBF29CE484222325LL;
+	uint64_t hash = kFNV64OffsetBasis;
 
 	for (UString::iterator it = string.begin(); it != string.end(); ++it)
 		hash = hashFNV64(hash, *it);
@@ -117,7 +136,7 @@ static inline uint64_t hashStringFNV64(const UString &string) {
 }
 
 static inline uint64_t hashStringFNV64(const UString &string, Encoding encoding) {
-	uint64_t hash = 0xCBF29CE484222325LL;
+	uint64_t hash = kFNV64OffsetBasis;
 
 	std::unique_ptr<SeekableReadStream> data(convertString(string, encoding, false));
 	if (!data)
@@ -129,6 +148,24 @@ static inline uint64_t hashStringFNV64(const UString &string, Encoding encoding)
 
 	return hash;
 }
+
+/** Hash the size and the whole contents of a stream. The stream position is kept. */
+static inline uint64_t hashStreamFNV64(SeekableReadStream &stream, uint64_t hash = kFNV64OffsetBasis) {
+	const size_t pos = stream.pos();
+
+	stream.seek(0);
+
+	hash = hashFNV64Value(hash, (uint32_t) stream.size());
+
+	byte buffer[4096];
+	for (size_t n = stream.read(buffer, sizeof(buffer)); n > 0; n = stream.read(buffer, sizeof(buffer)))
+		for (size_t i = 0; i < n; i++)
+			hash = hashFNV64(hash, buffer[i]);
+
+	stream.seek(pos);
+
+	return hash;
+}
 // '--- 64bit Fowler-Noll-Vo hash by Glenn Fowler, Landon Curt Noll and Phong Vo ---'
 
 /* .--- CRC32, based on the implementation by Gary S. Brown ---.
@@ -24,6 +24,9 @@
 
 #include <cassert>
 
+#include <algorithm>
+#include <map>
+
 #include "src/common/huffman.h"
 #include "src/common/util.h"
 #include "src/common/error.h"
@@ -31,9 +34,12 @@
 
 namespace Common {
 
-Huffman::Symbol::Symbol(uint32_t c, uint32_t s) : code(c), symbol(s) {
-}
+const uint8_t Huffman::kTableBits;
 
+/** Return a mask for the lowest n bits. */
+static inline uint32_t lowBits(uint8_t n) {
+	return (n >= 32) ? 0xFFFFFFFF : ((UINT32_C(1) << n) - 1);
+}
 
 Huffman::Huffman(const HuffmanTable &table) {
 	init(table.maxLength, table.codeCount, table.codes, table.lengths, table.symbols);
@@ -59,19 +65,90 @@ void Huffman::init(uint8_t maxLength, size_t codeCount, const uint32_t *codes,
 
 	assert(maxLength <= 32);
 
-	_codes.resize(maxLength);
 	_symbols.resize(codeCount);
+	setSymbols(symbols);
 
+	std::vector<Code> sortedCodes(codeCount);
 	for (size_t i = 0; i < codeCount; i++) {
-		// The symbol. If none were specified, just assume it's identical to the code index
-		uint32_t symbol = symbols ? symbols[i] : i;
+		assert((lengths[i] > 0) && (lengths[i] <= maxLength));
+
+		sortedCodes[i].code   = codes[i] & lowBits(lengths[i]);
+		sortedCodes[i].length = lengths[i];
+		sortedCodes[i].index  = i;
+	}
+
+	/* Enter longer codes first, and later codes before earlier ones. Should codes
+	 * overlap, the shorter and earlier ones then win, like they would when
+	 * searching through the codes by increasing length. */
+	std::sort(sortedCodes.begin(), sortedCodes.end(), [](const Code &a, const Code &b) {
+		if (a.length != b.length)
+			return a.length > b.length;
+
+		return a.index > b.index;
+	});
+
+	_tableBits = MIN(maxLength, kTableBits);
+
+	buildTable(_tables[0], _tableBits, sortedCodes, false);
+	buildTable(_tables[1], _tableBits, sortedCodes, true);
+}
+
+size_t Huffman::buildTable(Table &table, uint8_t tableBits, const std::vector<Code> &codes, bool msbFirst) {
+	const size_t offset = table.size();
+
+	const TableEntry invalid = { 0, 0 };
+	table.resize(offset + (1 << tableBits), invalid);
+
+	// Gather the codes too long for this table by their first bits
+	std::map<uint32_t, std::vector<Code>> subCodes;
+	for (std::vector<Code>::const_iterator c = codes.begin(); c != codes.end(); ++c) {
+		if (c->length <= tableBits)
+			continue;
+
+		Code subCode = *c;
+		subCode.length = c->length - tableBits;
 
-		// Put the code and symbol into the correct list
-		_codes[lengths[i] - 1].push_back(Symbol(codes[i], symbol));
+		uint32_t prefix;
+		if (msbFirst) {
+			prefix       = c->code >> subCode.length;
+			subCode.code = c->code & lowBits(subCode.length);
+		} else {
+			prefix       = c->code & lowBits(tableBits);
+			subCode.code = c->code >> tableBits;
+		}
 
-		// And put the pointer to the symbol/code struct into the symbol list.
-		_symbols[i] = &_codes[lengths[i] - 1].back();
+		subCodes[prefix].push_back(subCode);
 	}
+
+	// Those get sub tables, indexed by the bits following the first
+	for (std::map<uint32_t, std::vector<Code>>::const_iterator s = subCodes.begin(); s != subCodes.end(); ++s) {
+		uint8_t subBits = 0;
+		for (std::vector<Code>::const_iterator c = s->second.begin(); c != s->second.end(); ++c)
+			subBits = MAX(subBits, c->length);
+
+		subBits = MIN(subBits, kTableBits);
+
+		const size_t subOffset = buildTable(table, subBits, s->second, msbFirst);
+
+		table[offset + s->first].value  = subOffset;
+		table[offset + s->first].length = -((int8_t) subBits);
+	}
+
+	// And fill in all entries starting with the codes that fit into this table
+	for (std::vector<Code>::const_iterator c = codes.begin(); c != codes.end(); ++c) {
+		if (c->length > tableBits)
+			continue;
+
+		const size_t fillCount = 1 << (tableBits - c->length);
+		for (size_t i = 0; i < fillCount; i++) {
+			const size_t index = msbFirst ? ((c->code << (tableBits - c->length)) | i) : (c->code | (i << c->length));
+
+			table[offset + index].value  = c->index;
+			table[offset + index].length = c->length;
+		}
+	}
+
+	return offset;
 }
 
 Huffman::~Huffman() {
@@ -79,18 +156,31 @@ Huffman::~Huffman() {
 
 void Huffman::setSymbols(const uint32_t *symbols) {
 	for (size_t i = 0; i < _symbols.size(); i++)
-		_symbols[i]->symbol = symbols ? *symbols++ : i;
+		_symbols[i] = symbols ? *symbols++ : i;
 }
 
 uint32_t Huffman::getSymbol(BitStream &bits) const {
-	uint32_t code = 0;
+	const Table &table = _tables[bits.isMSBFirst() ? 1 : 0];
+
+	size_t  offset    = 0;
+	uint8_t tableBits = _tableBits;
+
+	while (true) {
+		const TableEntry &entry = table[offset + bits.peekBits(tableBits)];
+
+		if (entry.length > 0) {
+			bits.skip(entry.length);
+			return _symbols[entry.value];
+		}
+
+		if (entry.length == 0)
+			break;
 
-	for (size_t i = 0; i < _codes.size(); i++) {
-		bits.addBit(code, i);
+		// The code continues in a sub table
+		bits.skip(tableBits);
 
-		for (CodeList::const_iterator cCode = _codes[i].begin(); cCode != _codes[i].end(); ++cCode)
-			if (code == cCode->code)
-				return cCode->symbol;
+		offset    = entry.value;
+		tableBits = -entry.length;
 	}
 
 	throw Exception("Unknown Huffman code");
@@ -28,7 +28,6 @@
 #include <cstddef>
 
 #include <vector>
-#include <list>
 
 #include "src/common/types.h"
 
@@ -68,25 +67,42 @@ public:
 	uint32_t getSymbol(BitStream &bits) const;
 
 private:
-	struct Symbol {
-		uint32_t code;
-		uint32_t symbol;
+	/** Number of bits looked up at once. */
+	static const uint8_t kTableBits = 9;
+
+	/** A code, as read from the bit stream. */
+	struct Code {
+		uint32_t code;   ///< The code bits.
+		uint8_t  length; ///< The length of the code in bits.
+		size_t   index;  ///< The index of the code.
+	};
 
-		Symbol(uint32_t c, uint32_t s);
+	/** An entry in a decoding table. */
+	struct TableEntry {
+		uint32_t value;  ///< The index of the code, or the offset of a sub table.
+		int8_t   length; ///< The length of the code, 0 if invalid, or -(bits of the sub table).
 	};
 
-	typedef std::list<Symbol>     CodeList;
-	typedef std::vector<CodeList> CodeLists;
-	typedef std::vector<Symbol *> SymbolList;
+	typedef std::vector<TableEntry> Table;
 
-	/** Lists of codes and their symbols, sorted by code length. */
-	CodeLists _codes;
+	/** The symbol of each code. */
+	std::vector<uint32_t> _symbols;
 
-	/** Sorted list of pointers to the symbols. */
-	SymbolList _symbols;
+	/** Bits of the primary decoding table. */
+	uint8_t _tableBits;
+
+	/** Decoding tables for bits read LSB to MSB [0] and MSB to LSB [1].
+	 *
+	 *  Each starts with the primary table, followed by the sub tables for
+	 *  codes longer than the primary table.
+	 */
+	Table _tables[2];
 
 	void init(uint8_t maxLength, size_t codeCount, const uint32_t *codes,
 	          const uint8_t *lengths, const uint32_t *symbols);
+
+	/** Build a decoding table and its sub tables, returning the offset of the table. */
+	static size_t buildTable(Table &table, uint8_t tableBits, const std::vector<Code> &codes, bool msbFirst);
 };
 
 } // End of namespace Common
@@ -0,0 +1,94 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A case-insensitive string key with a precomputed hash.
+ */
+
+#ifndef COMMON_ISTRINGKEY_H
+#define COMMON_ISTRINGKEY_H
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "src/common/ustring.h"
+
+namespace Common {
+
+/** A string used as a case-insensitive key in hash containers.
+ *
+ *  The case-insensitive hash is computed once, when the key is created, so
+ *  looking up the same key in several containers only hashes it once. Keys
+ *  with different hashes are never compared character by character.
+ *
+ *  The string itself keeps its original case.
+ */
+class IStringKey {
+public:
+	/** The hash function to use in containers. */
+	struct Hash {
+		size_t operator()(const IStringKey &key) const {
+			return key._hash;
+		}
+	};
+
+	IStringKey() : _hash(hashUStringCaseInsensitive()(_string)) {
+	}
+
+	IStringKey(const UString &str) : _string(str), _hash(hashUStringCaseInsensitive()(_string)) {
+	}
+
+	IStringKey(UString &&str) : _string(std::move(str)), _hash(hashUStringCaseInsensitive()(_string)) {
+	}
+
+	IStringKey(const char *str) : _string(str), _hash(hashUStringCaseInsensitive()(_string)) {
+	}
+
+	const UString &getString() const {
+		return _string;
+	}
+
+	size_t getHash() const {
+		return _hash;
+	}
+
+	bool operator==(const IStringKey &key) const {
+		return (_hash == key._hash) && _string.equalsIgnoreCase(key._string);
+	}
+
+	bool operator!=(const IStringKey &key) const {
+		return !(*this == key);
+	}
+
+private:
+	UString _string;
+	size_t  _hash;
+};
+
+/** A hash map with case-insensitive string keys. */
+template<typename T>
+using IStringKeyMap = std::unordered_map<IStringKey, T, IStringKey::Hash>;
+
+/** A hash set of case-insensitive strings. */
+typedef std::unordered_set<IStringKey, IStringKey::Hash> IStringKeySet;
+
+} // End of namespace Common
+
+#endif // COMMON_ISTRINGKEY_H
@@ -0,0 +1,136 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Writing a log file in the background.
+ */
+
+#include <cstdio>
+
+#include "src/common/logwriter.h"
+
+namespace Common {
+
+/** How many milliseconds the writer thread waits between writing batches of lines. */
+static const int kWriteInterval = 50;
+/** How many lines can be queued before the threads writing them have to wait. */
+static const size_t kQueueSize = 16384;
+
+LogWriter::LogWriter() : _open(false), _lines(kQueueSize) {
+}
+
+LogWriter::~LogWriter() {
+	close();
+}
+
+bool LogWriter::open(const UString &fileName) {
+	close();
+
+	if (!_file.open(fileName))
+		return false;
+
+	// Throw away lines queued while no log file was open
+	_lines.clear();
+
+	_openTime = Clock::now();
+
+	if (!createThread("LogWriter")) {
+		_file.close();
+		return false;
+	}
+
+	_open.store(true, std::memory_order_release);
+	return true;
+}
+
+void LogWriter::close() {
+	if (!_open.exchange(false, std::memory_order_acq_rel))
+		return;
+
+	destroyThread();
+
+	writeLines();
+
+	_file.close();
+}
+
+bool LogWriter::isOpen() const {
+	return _open.load(std::memory_order_acquire);
+}
+
+void LogWriter::write(const UString &line) {
+	Line l;
+
+	l.time   = Clock::now();
+	l.thread = Thread::getCurrentThreadName();
+	l.text   = line;
+
+	/* If the writer can't keep up, wait for it instead of losing the line.
+	 * Once the log file is closed, nobody will make room anymore. */
+	while (!_lines.push(std::move(l)) && isOpen())
+		std::this_thread::yield();
+}
+
+void LogWriter::threadMethod() {
+	while (!_killThread.load(std::memory_order_relaxed)) {
+		// Only wait for more lines to collect if the queue isn't filling up
+		if (writeLines() < (kQueueSize / 2))
+			std::this_thread::sleep_for(std::chrono::milliseconds(kWriteInterval));
+	}
+}
+
+size_t LogWriter::writeLines() {
+	size_t count = 0;
+
+	try {
+		Line line;
+		while (_lines.pop(line)) {
+			writeLine(line);
+			count++;
+		}
+
+		if (count > 0)
+			_file.flush();
+
+	} catch (...) {
+	}
+
+	return count;
+}
+
+void LogWriter::writeLine(const Line &line) {
+	const uint64_t time =
+		std::chrono::duration_cast<std::chrono::microseconds>(line.time - _openTime).count();
+
+	char stamp[64];
+	std::snprintf(stamp, sizeof(stamp), "[%6u.%06u] ", (uint)(time / 1000000), (uint)(time % 1000000));
+
+	_file.writeString(stamp);
+
+	if (!line.thread.empty()) {
+		_file.writeString("[");
+		_file.writeString(line.thread);
+		_file.writeString("] ");
+	}
+
+	_file.writeString(line.text);
+}
+
+} // End of namespace Common
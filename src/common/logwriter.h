@@ -0,0 +1,94 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Writing a log file in the background.
+ */
+
+#ifndef COMMON_LOGWRITER_H
+#define COMMON_LOGWRITER_H
+
+#include <atomic>
+#include <chrono>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+#include "src/common/thread.h"
+#include "src/common/writefile.h"
+#include "src/common/mpscqueue.h"
+
+namespace Common {
+
+/** A log file that's written by its own thread.
+ *
+ *  Any thread can queue complete lines into a lock-free queue. Every few
+ *  milliseconds, the writer thread takes all queued lines, writes them in
+ *  the order they were queued and flushes the file once.
+ *
+ *  Each line is prefixed with the monotonic time since the log was opened
+ *  and the name of the thread that queued it (as set by
+ *  Thread::setCurrentThreadName()).
+ */
+class LogWriter : public Thread {
+public:
+	LogWriter();
+	~LogWriter();
+
+	/** Open the log file and start the writer thread. */
+	bool open(const UString &fileName);
+	/** Write all lines still queued, stop the writer thread and close the file. */
+	void close();
+
+	bool isOpen() const;
+
+	/** Queue a complete line, including the line break. Can be called from any thread. */
+	void write(const UString &line);
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	struct Line {
+		Clock::time_point time; ///< When the line was queued.
+
+		UString thread; ///< The name of the thread that queued the line.
+		UString text;   ///< The line itself.
+	};
+
+	WriteFile _file;
+	std::atomic<bool> _open;
+
+	Clock::time_point _openTime; ///< When the log file was opened.
+
+	/** All queued lines. */
+	MPSCQueue<Line> _lines;
+
+	void threadMethod();
+
+	/** Write all queued lines and flush the file.
+	 *
+	 *  @return The number of lines written.
+	 */
+	size_t writeLines();
+	void writeLine(const Line &line);
+};
+
+} // End of namespace Common
+
+#endif // COMMON_LOGWRITER_H
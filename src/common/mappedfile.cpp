@@ -0,0 +1,234 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Read-only memory-mapped files.
+ */
+
+#include "src/common/system.h"
+
+#if defined(WIN32)
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+#include <boost/filesystem/path.hpp>
+
+#include "src/common/mappedfile.h"
+#include "src/common/pooledreadfile.h"
+#include "src/common/error.h"
+#include "src/common/ustring.h"
+
+namespace Common {
+
+#if defined(WIN32)
+
+MappedFile::MappedFile(const UString &fileName) : _data(0), _size(0),
+	_file(INVALID_HANDLE_VALUE), _mapping(0) {
+
+	_file = CreateFileW(boost::filesystem::path(fileName.c_str()).c_str(), GENERIC_READ, FILE_SHARE_READ,
+	                    0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+	if (_file == INVALID_HANDLE_VALUE)
+		throw Exception("Can't open file \"%s\"", fileName.c_str());
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(_file, &fileSize) || (fileSize.QuadPart < 0) ||
+	    ((uint64_t) fileSize.QuadPart > (uint64_t) SIZE_MAX)) {
+
+		unmap();
+		throw Exception("Can't get the size of file \"%s\"", fileName.c_str());
+	}
+
+	_size = fileSize.QuadPart;
+
+	// Empty files can't be mapped, but there's nothing to map anyway
+	if (_size == 0)
+		return;
+
+	_mapping = CreateFileMappingW(_file, 0, PAGE_READONLY, 0, 0, 0);
+	if (_mapping)
+		_data = static_cast<const byte *>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+
+	if (!_data) {
+		unmap();
+		throw Exception("Can't map file \"%s\"", fileName.c_str());
+	}
+}
+
+void MappedFile::advise(FileAccessHint UNUSED(hint)) {
+	// Windows doesn't take access hints for existing mappings
+}
+
+void MappedFile::unmap() {
+	if (_data)
+		UnmapViewOfFile(_data);
+	if (_mapping)
+		CloseHandle(_mapping);
+	if (_file != INVALID_HANDLE_VALUE)
+		CloseHandle(_file);
+
+	_data    = 0;
+	_mapping = 0;
+	_file    = INVALID_HANDLE_VALUE;
+}
+
+#else
+
+MappedFile::MappedFile(const UString &fileName) : _data(0), _size(0) {
+	const int fd = open(boost::filesystem::path(fileName.c_str()).c_str(), O_RDONLY);
+	if (fd == -1)
+		throw Exception("Can't open file \"%s\"", fileName.c_str());
+
+	struct stat fileStat;
+	if ((fstat(fd, &fileStat) != 0) || (fileStat.st_size < 0) ||
+	    ((uint64_t) fileStat.st_size > (uint64_t) SIZE_MAX)) {
+
+		close(fd);
+		throw Exception("Can't get the size of file \"%s\"", fileName.c_str());
+	}
+
+	_size = fileStat.st_size;
+
+	// Empty files can't be mapped, but there's nothing to map anyway
+	if (_size == 0) {
+		close(fd);
+		return;
+	}
+
+	void *data = mmap(0, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	// The mapping holds its own reference to the file
+	close(fd);
+
+	if (data == MAP_FAILED)
+		throw Exception("Can't map file \"%s\"", fileName.c_str());
+
+	_data = static_cast<const byte *>(data);
+}
+
+void MappedFile::advise(FileAccessHint hint) {
+	if (!_data)
+		return;
+
+	int advice = MADV_NORMAL;
+	if      (hint == kFileAccessSequential)
+		advice = MADV_SEQUENTIAL;
+	else if (hint == kFileAccessRandom)
+		advice = MADV_RANDOM;
+
+	// Only a hint, so failing is fine
+	madvise(const_cast<byte *>(_data), _size, advice);
+}
+
+void MappedFile::unmap() {
+	if (_data)
+		munmap(const_cast<byte *>(_data), _size);
+
+	_data = 0;
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+	unmap();
+}
+
+const byte *MappedFile::getData() const {
+	return _data;
+}
+
+size_t MappedFile::size() const {
+	return _size;
+}
+
+
+MappedReadStream::MappedReadStream(const UString &fileName) :
+	MappedReadStream(std::make_shared<MappedFile>(fileName)) {
+
+}
+
+MappedReadStream::MappedReadStream(const std::shared_ptr<MappedFile> &file) :
+	MemoryReadStream(file->getData(), file->size()), _file(file) {
+
+}
+
+MappedReadStream::MappedReadStream(const std::shared_ptr<MappedFile> &file, const byte *data, size_t size) :
+	MemoryReadStream(data, size), _file(file) {
+
+}
+
+MappedReadStream::~MappedReadStream() {
+}
+
+void MappedReadStream::advise(FileAccessHint hint) {
+	_file->advise(hint);
+}
+
+MappedReadStream *MappedReadStream::viewStream(size_t offset, size_t size) const {
+	if ((offset > this->size()) || (size > (this->size() - offset)))
+		throw Exception("Mapped view out of range (%u + %u > %u)",
+		                (uint) offset, (uint) size, (uint) this->size());
+
+	return new MappedReadStream(_file, getData() + offset, size);
+}
+
+MappedReadStream *MappedReadStream::viewStream(SeekableReadStream &stream, size_t offset, size_t size) {
+	MappedReadStream *mapped = dynamic_cast<MappedReadStream *>(&stream);
+	if (!mapped)
+		return 0;
+
+	return mapped->viewStream(offset, size);
+}
+
+/** Read a copy of a part of a file with a positional read. */
+template<typename File>
+static MemoryReadStream *readAt(const File &file, size_t offset, size_t size) {
+	std::unique_ptr<byte[]> data(new byte[size]);
+
+	if (file.readAt(offset, data.get(), size) != size)
+		throw Exception(kReadError);
+
+	return new MemoryReadStream(data.release(), size, true);
+}
+
+MemoryReadStream *MappedReadStream::readView(SeekableReadStream &stream, size_t offset, size_t size) {
+	MemoryReadStream *view = viewStream(stream, offset, size);
+	if (view)
+		return view;
+
+	// Positional reads leave the file's stream position, and its readahead buffer, alone
+	const ReadFile *file = dynamic_cast<const ReadFile *>(&stream);
+	if (file)
+		return readAt(*file, offset, size);
+
+	const PooledReadFile *pooledFile = dynamic_cast<const PooledReadFile *>(&stream);
+	if (pooledFile)
+		return readAt(*pooledFile, offset, size);
+
+	stream.seek(offset);
+
+	return stream.readStream(size);
+}
+
+} // End of namespace Common
@@ -0,0 +1,104 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Read-only memory-mapped files.
+ */
+
+#ifndef COMMON_MAPPEDFILE_H
+#define COMMON_MAPPEDFILE_H
+
+#include <cstddef>
+
+#include <memory>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/memreadstream.h"
+#include "src/common/readfile.h"
+
+namespace Common {
+
+class UString;
+
+/** A whole file, mapped read-only into memory. */
+class MappedFile : boost::noncopyable {
+public:
+	MappedFile(const UString &fileName);
+	~MappedFile();
+
+	const byte *getData() const;
+	size_t size() const;
+
+	/** Tell the system how the mapping is going to be accessed. */
+	void advise(FileAccessHint hint);
+
+private:
+	const byte *_data;
+	size_t _size;
+
+#if defined(WIN32)
+	void *_file;
+	void *_mapping;
+#endif
+
+	void unmap();
+};
+
+/** A stream reading out of a memory-mapped file.
+ *
+ *  Views into the same mapping share it, so the mapping stays valid as long
+ *  as any stream into it still exists. Reading a view never copies the data.
+ */
+class MappedReadStream : public MemoryReadStream {
+public:
+	/** Map the whole file. */
+	MappedReadStream(const UString &fileName);
+	~MappedReadStream();
+
+	/** Create a new stream viewing a part of this stream's data. */
+	MappedReadStream *viewStream(size_t offset, size_t size) const;
+
+	/** If this stream is a MappedReadStream, create a view of a part of it.
+	 *
+	 *  @return The new view, or 0 if the stream isn't memory-mapped.
+	 */
+	static MappedReadStream *viewStream(SeekableReadStream &stream, size_t offset, size_t size);
+
+	/** Return a view of a part of the stream if it's memory-mapped, or read a copy of that part otherwise.
+	 *
+	 *  Either way, this is a single read, for parsing tables in memory.
+	 */
+	static MemoryReadStream *readView(SeekableReadStream &stream, size_t offset, size_t size);
+
+	/** Tell the system how the mapped file is going to be accessed. */
+	void advise(FileAccessHint hint);
+
+private:
+	std::shared_ptr<MappedFile> _file;
+
+	MappedReadStream(const std::shared_ptr<MappedFile> &file, const byte *data, size_t size);
+	MappedReadStream(const std::shared_ptr<MappedFile> &file);
+};
+
+} // End of namespace Common
+
+#endif // COMMON_MAPPEDFILE_H
@@ -22,6 +22,7 @@
  *  Mathematical helpers.
  */
 
+#include "src/common/util.h"
 #include "src/common/maths.h"
 
 namespace Common {
@@ -36,4 +37,66 @@ const int8_t intLog2Table256[256] = {
 };
 #endif
 
+static const float kQuaternionQuantizeMax = 32767.0f;
+
+void packQuaternion(float x, float y, float z, float w, uint16_t packed[3]) {
+	float q[4] = { x, y, z, w };
+
+	const float magnitude = sqrtf(x * x + y * y + z * z + w * w);
+	if (magnitude > 0.0f) {
+		for (size_t i = 0; i < 4; i++)
+			q[i] /= magnitude;
+	} else {
+		q[0] = q[1] = q[2] = 0.0f;
+		q[3] = 1.0f;
+	}
+
+	size_t largest = 0;
+	for (size_t i = 1; i < 4; i++)
+		if (ABS(q[i]) > ABS(q[largest]))
+			largest = i;
+
+	// Flip the quaternion so that the largest component is positive
+	const float sign = (q[largest] < 0.0f) ? -1.0f : 1.0f;
+
+	uint16_t components[3];
+	for (size_t i = 0, j = 0; i < 4; i++) {
+		if (i == largest)
+			continue;
+
+		// The other components are all within [-1/sqrt(2), 1/sqrt(2)]
+		const float v = CLIP<float>((sign * q[i]) / M_SQRT1_2, -1.0f, 1.0f);
+
+		components[j++] = (uint16_t) roundf((v * 0.5f + 0.5f) * kQuaternionQuantizeMax);
+	}
+
+	packed[0] = ((largest >> 1) << 15) | components[0];
+	packed[1] = ((largest &  1) << 15) | components[1];
+	packed[2] = components[2];
+}
+
+void unpackQuaternion(const uint16_t packed[3], float &x, float &y, float &z, float &w) {
+	const size_t largest = ((packed[0] >> 15) << 1) | (packed[1] >> 15);
+
+	float q[4];
+	float sum = 0.0f;
+
+	for (size_t i = 0, j = 0; i < 4; i++) {
+		if (i == largest)
+			continue;
+
+		const float v = (packed[j++] & 0x7FFF) / kQuaternionQuantizeMax;
+
+		q[i] = (v * 2.0f - 1.0f) * M_SQRT1_2;
+		sum += q[i] * q[i];
+	}
+
+	q[largest] = sqrtf(MAX(0.0f, 1.0f - sum));
+
+	x = q[0];
+	y = q[1];
+	z = q[2];
+	w = q[3];
+}
+
 } // End of namespace Common
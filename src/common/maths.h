@@ -98,6 +98,18 @@ static inline float deg2rad(float deg) {
 	return deg * M_PI / 180.0f;
 }
 
+/** Pack a rotation quaternion into 48 bits.
+ *
+ *  The quaternion is normalized, and only its three smallest components are
+ *  stored, with 15 bits each. The largest one follows from them, since the
+ *  quaternion has unit length. Its sign is not kept, because q and -q describe
+ *  the same rotation.
+ */
+void packQuaternion(float x, float y, float z, float w, uint16_t packed[3]);
+
+/** Unpack a quaternion packed with packQuaternion(). */
+void unpackQuaternion(const uint16_t packed[3], float &x, float &y, float &z, float &w);
+
 } // End of namespace Common
 
 #endif // COMMON_MATHS_H
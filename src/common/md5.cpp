@@ -24,9 +24,12 @@
 
 #include <cstring>
 
+#include <memory>
+
 #include "src/common/md5.h"
 #include "src/common/ustring.h"
 #include "src/common/readstream.h"
+#include "src/common/memreadstream.h"
 
 namespace Common {
 
@@ -312,15 +315,36 @@ static void md5Final(byte *result, MD5Context &ctx) {
 }
 // '--- MD5, based on the implementation by Alexander Peslyak ---'
 
+/** The size of the chunks streams are read in for hashing. */
+static const size_t kReadBufferSize = 64 * 1024;
+
 
 void hashMD5(ReadStream &stream, std::vector<byte> &digest) {
 	MD5Context ctx;
 
-	byte buf[4096];
+	// Hash data that's already in memory directly, without copying it first
+	MemoryReadStream *memory = dynamic_cast<MemoryReadStream *>(&stream);
+	if (memory) {
+		const size_t pos = memory->pos();
+
+		md5Update(ctx, memory->getData() + pos, memory->size() - pos);
+
+		// Leave the stream at its end, with the EOS flag set, like reading it would
+		byte end;
+		memory->seek(0, SeekableReadStream::kOriginEnd);
+		memory->read(&end, 1);
+	}
+
+	/* Otherwise, read in large chunks. Whole premium modules are hashed this way,
+	 * and smaller reads mostly spend their time in the file system. */
+	std::unique_ptr<byte[]> buf;
 	while (!stream.eos()) {
-		size_t bufRead = stream.read(buf, 4096);
+		if (!buf)
+			buf = std::make_unique<byte[]>(kReadBufferSize);
+
+		const size_t bufRead = stream.read(buf.get(), kReadBufferSize);
 
-		md5Update(ctx, buf, bufRead);
+		md5Update(ctx, buf.get(), bufRead);
 	}
 
 	digest.resize(kMD5Length);
@@ -0,0 +1,72 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Reporting how much memory the items of a subsystem take up.
+ */
+
+#ifndef COMMON_MEMORYUSAGE_H
+#define COMMON_MEMORYUSAGE_H
+
+#include <cstddef>
+
+#include <vector>
+#include <algorithm>
+
+#include "src/common/ustring.h"
+
+namespace Common {
+
+/** How much memory one item of a subsystem takes up. */
+struct MemoryUsage {
+	UString name; ///< A name identifying the item, like its resource name.
+	size_t size;  ///< The approximate number of bytes the item takes up.
+
+	MemoryUsage(const UString &n = "", size_t s = 0) : name(n), size(s) {
+	}
+};
+
+/** The memory usage of all items of a subsystem. */
+class MemoryUsageList : public std::vector<MemoryUsage> {
+public:
+	void add(const UString &name, size_t size) {
+		push_back(MemoryUsage(name, size));
+	}
+
+	/** Return the combined size of all items. */
+	size_t getTotal() const {
+		size_t total = 0;
+		for (const_iterator i = begin(); i != end(); ++i)
+			total += i->size;
+
+		return total;
+	}
+
+	/** Sort the items, largest first. */
+	void sort() {
+		std::stable_sort(begin(), end(), [](const MemoryUsage &a, const MemoryUsage &b) {
+			return a.size > b.size;
+		});
+	}
+};
+
+} // End of namespace Common
+
+#endif // COMMON_MEMORYUSAGE_H
@@ -0,0 +1,54 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A non-virtual reader for data already in memory.
+ */
+
+#include "src/common/memreader.h"
+#include "src/common/readstream.h"
+#include "src/common/memreadstream.h"
+
+namespace Common {
+
+MemoryReader::MemoryReader(SeekableReadStream &stream) : _data(0), _size(0), _pos(0) {
+	const MemoryReadStream *memStream = dynamic_cast<const MemoryReadStream *>(&stream);
+	if (memStream) {
+		_data = memStream->getData();
+		_size = memStream->size();
+		_pos  = memStream->pos();
+		return;
+	}
+
+	const size_t pos = stream.pos();
+
+	_size   = stream.size();
+	_buffer = std::make_unique<byte[]>(_size);
+	_data   = _buffer.get();
+	_pos    = pos;
+
+	stream.seek(0);
+	if (stream.read(_buffer.get(), _size) != _size)
+		throw Exception(kReadError);
+
+	stream.seek(pos);
+}
+
+} // End of namespace Common
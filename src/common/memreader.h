@@ -0,0 +1,276 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A non-virtual reader for data already in memory.
+ */
+
+#ifndef COMMON_MEMREADER_H
+#define COMMON_MEMREADER_H
+
+#include <cassert>
+#include <cstring>
+#include <cstddef>
+
+#include <memory>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/endianness.h"
+#include "src/common/error.h"
+
+namespace Common {
+
+class SeekableReadStream;
+
+/** A cursor reading values out of a contiguous block of memory.
+ *
+ *  Unlike a ReadStream, none of its methods are virtual, so the reads
+ *  can be inlined into tight parsing loops.
+ *
+ *  All reads on the reader itself are bounds-checked and throw kReadError
+ *  when running past the end. For loops reading many values, readBlock()
+ *  checks the size of a whole record once and returns a Block, whose
+ *  reads are not checked again.
+ */
+class MemoryReader : boost::noncopyable {
+public:
+	/** An already bounds-checked part of the reader's memory. */
+	class Block {
+	public:
+		Block(const byte *data, size_t size) : _ptr(data), _end(data + size) {
+		}
+
+		/** The number of bytes left in the block. */
+		size_t size() const {
+			return _end - _ptr;
+		}
+
+		void skip(size_t n) {
+			assert(n <= size());
+			_ptr += n;
+		}
+
+		void read(void *dataPtr, size_t dataSize) {
+			assert(dataSize <= size());
+			std::memcpy(dataPtr, _ptr, dataSize);
+			_ptr += dataSize;
+		}
+
+		byte readByte() {
+			assert(size() >= 1);
+			return *_ptr++;
+		}
+
+		int8_t readSByte() {
+			return static_cast<int8_t>(readByte());
+		}
+
+		uint16_t readUint16LE() {
+			assert(size() >= 2);
+			const uint16_t val = READ_LE_UINT16(_ptr);
+			_ptr += 2;
+			return val;
+		}
+
+		uint16_t readUint16BE() {
+			assert(size() >= 2);
+			const uint16_t val = READ_BE_UINT16(_ptr);
+			_ptr += 2;
+			return val;
+		}
+
+		uint32_t readUint32LE() {
+			assert(size() >= 4);
+			const uint32_t val = READ_LE_UINT32(_ptr);
+			_ptr += 4;
+			return val;
+		}
+
+		uint32_t readUint32BE() {
+			assert(size() >= 4);
+			const uint32_t val = READ_BE_UINT32(_ptr);
+			_ptr += 4;
+			return val;
+		}
+
+		uint64_t readUint64LE() {
+			const uint64_t low = readUint32LE();
+			return (static_cast<uint64_t>(readUint32LE()) << 32) | low;
+		}
+
+		uint64_t readUint64BE() {
+			const uint64_t high = readUint32BE();
+			return (high << 32) | readUint32BE();
+		}
+
+		int16_t readSint16LE() {
+			return static_cast<int16_t>(readUint16LE());
+		}
+
+		int16_t readSint16BE() {
+			return static_cast<int16_t>(readUint16BE());
+		}
+
+		int32_t readSint32LE() {
+			return static_cast<int32_t>(readUint32LE());
+		}
+
+		int32_t readSint32BE() {
+			return static_cast<int32_t>(readUint32BE());
+		}
+
+		int64_t readSint64LE() {
+			return static_cast<int64_t>(readUint64LE());
+		}
+
+		int64_t readSint64BE() {
+			return static_cast<int64_t>(readUint64BE());
+		}
+
+		float readIEEEFloatLE() {
+			return toFloat(readUint32LE());
+		}
+
+		float readIEEEFloatBE() {
+			return toFloat(readUint32BE());
+		}
+
+		double readIEEEDoubleLE() {
+			return toDouble(readUint64LE());
+		}
+
+		double readIEEEDoubleBE() {
+			return toDouble(readUint64BE());
+		}
+
+	private:
+		const byte *_ptr;
+		const byte *_end;
+
+		static float toFloat(uint32_t data) {
+			float value;
+			std::memcpy(&value, &data, sizeof(value));
+			return value;
+		}
+
+		static double toDouble(uint64_t data) {
+			double value;
+			std::memcpy(&value, &data, sizeof(value));
+			return value;
+		}
+	};
+
+	/** Read from a block of memory, which is not copied and must outlive the reader. */
+	MemoryReader(const byte *data, size_t size) : _data(data), _size(size), _pos(0) {
+	}
+
+	/** Read from the whole of a stream, starting at its current position.
+	 *
+	 *  If the stream is a MemoryReadStream, which includes memory-mapped
+	 *  files, its data is read directly and the stream must outlive the
+	 *  reader. Otherwise, the stream is read into memory first.
+	 *
+	 *  The position of the stream itself is not changed.
+	 */
+	MemoryReader(SeekableReadStream &stream);
+
+	const byte *getData() const {
+		return _data;
+	}
+
+	size_t size() const {
+		return _size;
+	}
+
+	size_t pos() const {
+		return _pos;
+	}
+
+	bool eos() const {
+		return _pos >= _size;
+	}
+
+	/** Seek to an absolute position. Throws kSeekError when seeking past the end. */
+	void seek(size_t offset) {
+		if (offset > _size)
+			throw Exception(kSeekError);
+
+		_pos = offset;
+	}
+
+	void skip(size_t n) {
+		if (n > (_size - _pos))
+			throw Exception(kSeekError);
+
+		_pos += n;
+	}
+
+	/** Check that the next n bytes are readable, and return them as a Block.
+	 *
+	 *  Advances the reader past the block. Throws kReadError when not
+	 *  enough data is left.
+	 */
+	Block readBlock(size_t n) {
+		if (n > (_size - _pos))
+			throw Exception(kReadError);
+
+		Block block(_data + _pos, n);
+		_pos += n;
+
+		return block;
+	}
+
+	void read(void *dataPtr, size_t dataSize) {
+		readBlock(dataSize).read(dataPtr, dataSize);
+	}
+
+	byte     readByte()     { return readBlock(1).readByte();     }
+	int8_t   readSByte()    { return readBlock(1).readSByte();    }
+	uint16_t readUint16LE() { return readBlock(2).readUint16LE(); }
+	uint16_t readUint16BE() { return readBlock(2).readUint16BE(); }
+	uint32_t readUint32LE() { return readBlock(4).readUint32LE(); }
+	uint32_t readUint32BE() { return readBlock(4).readUint32BE(); }
+	uint64_t readUint64LE() { return readBlock(8).readUint64LE(); }
+	uint64_t readUint64BE() { return readBlock(8).readUint64BE(); }
+	int16_t  readSint16LE() { return readBlock(2).readSint16LE(); }
+	int16_t  readSint16BE() { return readBlock(2).readSint16BE(); }
+	int32_t  readSint32LE() { return readBlock(4).readSint32LE(); }
+	int32_t  readSint32BE() { return readBlock(4).readSint32BE(); }
+	int64_t  readSint64LE() { return readBlock(8).readSint64LE(); }
+	int64_t  readSint64BE() { return readBlock(8).readSint64BE(); }
+
+	float  readIEEEFloatLE()  { return readBlock(4).readIEEEFloatLE();  }
+	float  readIEEEFloatBE()  { return readBlock(4).readIEEEFloatBE();  }
+	double readIEEEDoubleLE() { return readBlock(8).readIEEEDoubleLE(); }
+	double readIEEEDoubleBE() { return readBlock(8).readIEEEDoubleBE(); }
+
+private:
+	std::unique_ptr<byte[]> _buffer; ///< Our own copy of the data, if we had to read it.
+
+	const byte *_data;
+	size_t _size;
+	size_t _pos;
+};
+
+} // End of namespace Common
+
+#endif // COMMON_MEMREADER_H
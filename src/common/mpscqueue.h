@@ -0,0 +1,161 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A bounded, lock-free queue for many producers and a single consumer.
+ */
+
+#ifndef COMMON_MPSCQUEUE_H
+#define COMMON_MPSCQUEUE_H
+
+#include <cstddef>
+
+#include <memory>
+#include <atomic>
+#include <utility>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+
+namespace Common {
+
+/** A bounded, lock-free FIFO queue for handing items from several
+ *  producer threads to a single consumer thread.
+ *
+ *  All items live in a ring of fixed size, allocated once on construction,
+ *  so pushing and popping never touch the heap. Each slot carries a sequence
+ *  number telling whether it is free to be written or ready to be read.
+ *  Producers claim slots with a compare-and-swap on the tail; the consumer
+ *  owns the head outright.
+ *
+ *  push() may be called from any number of threads at once. pop(), isEmpty()
+ *  and clear() may only be called from one thread at a time.
+ *
+ *  T needs to be default-constructible and movable.
+ */
+template<typename T>
+class MPSCQueue : boost::noncopyable {
+public:
+	/** Create a queue holding at least capacity items. */
+	MPSCQueue(size_t capacity) {
+		size_t size = 2;
+		while (size < capacity)
+			size <<= 1;
+
+		_mask  = size - 1;
+		_slots = std::make_unique<Slot[]>(size);
+
+		for (size_t i = 0; i < size; i++)
+			_slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	/** Return the number of items the queue can hold. */
+	size_t getCapacity() const {
+		return _mask + 1;
+	}
+
+	/** Add an item to the back of the queue.
+	 *
+	 *  @return false if the queue is full, in which case the item is left untouched.
+	 */
+	bool push(T &&item) {
+		size_t pos = _tail.load(std::memory_order_relaxed);
+
+		Slot *slot;
+		while (true) {
+			slot = &_slots[pos & _mask];
+
+			const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+			if (sequence == pos) {
+				// The slot is free. Try to claim it, or retry with the new tail
+				if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			} else if (sequence < pos) {
+				// The slot still holds an item from the last round: we're full
+				return false;
+			} else
+				pos = _tail.load(std::memory_order_relaxed);
+		}
+
+		slot->item = std::move(item);
+		slot->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool push(const T &item) {
+		T copy(item);
+		return push(std::move(copy));
+	}
+
+	/** Take the item from the front of the queue.
+	 *
+	 *  @return false if the queue is empty.
+	 */
+	bool pop(T &item) {
+		Slot &slot = _slots[_head & _mask];
+		if (slot.sequence.load(std::memory_order_acquire) != (_head + 1))
+			return false;
+
+		item = std::move(slot.item);
+		slot.sequence.store(_head + _mask + 1, std::memory_order_release);
+
+		_head++;
+		return true;
+	}
+
+	/** Is there nothing to pop right now? */
+	bool isEmpty() const {
+		return _slots[_head & _mask].sequence.load(std::memory_order_acquire) != (_head + 1);
+	}
+
+	/** Throw away all items that are in the queue right now. */
+	void clear() {
+		T item;
+		while (pop(item))
+			;
+	}
+
+private:
+	struct Slot {
+		std::atomic<size_t> sequence { 0 };
+		T item;
+	};
+
+	/** The size of a cache line, on most of the CPUs we run on. */
+	static const size_t kCacheLineSize = 64;
+
+	std::unique_ptr<Slot[]> _slots;
+	size_t _mask { 0 };
+
+	/* Keep the producers and the consumer from fighting over the same cache line.
+	 * This is explicit padding rather than alignas(), which would make every class
+	 * holding a queue over-aligned, and thus unsafe to create with a plain new. */
+
+	byte _padding0[kCacheLineSize];
+	std::atomic<size_t> _tail { 0 }; ///< Position of the next slot to claim.
+	byte _padding1[kCacheLineSize];
+	size_t _head { 0 };              ///< Position of the next slot to pop. Consumer only.
+	byte _padding2[kCacheLineSize];
+};
+
+} // End of namespace Common
+
+#endif // COMMON_MPSCQUEUE_H
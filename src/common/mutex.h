@@ -27,9 +27,11 @@
 
 #if defined(__MINGW32__ ) && !defined(_GLIBCXX_HAS_GTHREADS)
 	#include "external/mingw-std-threads/mingw.mutex.h"
+	#include "external/mingw-std-threads/mingw.shared_mutex.h"
 	#include "external/mingw-std-threads/mingw.condition_variable.h"
 #else
 	#include <mutex>
+	#include <shared_mutex>
 	#include <condition_variable>
 #endif
 
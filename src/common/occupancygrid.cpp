@@ -0,0 +1,259 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A persistent grid of cells blocked by obstacles in the XY plane.
+ */
+
+#include <cassert>
+#include <cmath>
+
+#include "src/common/util.h"
+#include "src/common/geometry.h"
+#include "src/common/occupancygrid.h"
+
+namespace Common {
+
+OccupancyGrid::OccupancyGrid(float cellSize, uint32_t tileSize, float layerHeight, const FillFunction &fill) :
+	_cellSize(cellSize), _tileSize(tileSize), _layerHeight(layerHeight), _fill(fill),
+	_filling(false), _fillX(0), _fillY(0) {
+
+	// The summed-area tables are 16-bit
+	assert((_cellSize > 0.0f) && (_tileSize > 0) && (_tileSize <= 255) && (_layerHeight > 0.0f));
+}
+
+float OccupancyGrid::getCellSize() const {
+	return _cellSize;
+}
+
+void OccupancyGrid::clear() {
+	_tiles.clear();
+}
+
+void OccupancyGrid::invalidate(const glm::vec2 &min, const glm::vec2 &max) {
+	const int32_t minX = getTileIndex(getCell(min[0]));
+	const int32_t minY = getTileIndex(getCell(min[1]));
+	const int32_t maxX = getTileIndex(getCell(max[0]));
+	const int32_t maxY = getTileIndex(getCell(max[1]));
+
+	if ((minX > maxX) || (minY > maxY))
+		return;
+
+	const uint64_t count = ((uint64_t) (maxX - minX) + 1) * ((uint64_t) (maxY - minY) + 1);
+	if (count <= _tiles.size()) {
+		for (int32_t tileY = minY; tileY <= maxY; tileY++)
+			for (int32_t tileX = minX; tileX <= maxX; tileX++)
+				_tiles.erase(getKey(tileX, tileY));
+
+		return;
+	}
+
+	// The rectangle is larger than what we have, look at the existing tiles instead
+	std::vector<uint64_t> keys;
+	for (FlatHashMap<uint64_t, Tile, TileHash>::const_iterator t = _tiles.begin(); t != _tiles.end(); ++t) {
+		const int32_t tileX = (int32_t) (uint32_t) (t->key >> 32);
+		const int32_t tileY = (int32_t) (uint32_t) (t->key & 0xFFFFFFFF);
+
+		if ((tileX >= minX) && (tileX <= maxX) && (tileY >= minY) && (tileY <= maxY))
+			keys.push_back(t->key);
+	}
+
+	for (std::vector<uint64_t>::const_iterator k = keys.begin(); k != keys.end(); ++k)
+		_tiles.erase(*k);
+}
+
+void OccupancyGrid::addTriangle(const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c, bool allHeights) {
+	assert(_filling);
+	if (!_filling)
+		return;
+
+	if (allHeights) {
+		addTriangle(glm::vec2(a), glm::vec2(b), glm::vec2(c), getFillCells(kAllHeights));
+		return;
+	}
+
+	const int32_t minLayer = (int32_t) std::floor(MIN(a[2], MIN(b[2], c[2])) / _layerHeight);
+	const int32_t maxLayer = (int32_t) std::floor(MAX(a[2], MAX(b[2], c[2])) / _layerHeight);
+
+	for (int32_t layer = minLayer; layer <= maxLayer; layer++)
+		addTriangle(glm::vec2(a), glm::vec2(b), glm::vec2(c), getFillCells(layer));
+}
+
+bool OccupancyGrid::isBlocked(const glm::vec2 &min, const glm::vec2 &max, float minZ, float maxZ) {
+	const int32_t minCellX = getCell(min[0]);
+	const int32_t minCellY = getCell(min[1]);
+	const int32_t maxCellX = getCell(max[0]);
+	const int32_t maxCellY = getCell(max[1]);
+
+	for (int32_t tileY = getTileIndex(minCellY); tileY <= getTileIndex(maxCellY); tileY++) {
+		for (int32_t tileX = getTileIndex(minCellX); tileX <= getTileIndex(maxCellX); tileX++) {
+			const Tile &tile = getTile(tileX, tileY);
+			if (tile.layers.empty())
+				continue;
+
+			const int32_t firstX = tileX * (int32_t) _tileSize;
+			const int32_t firstY = tileY * (int32_t) _tileSize;
+
+			const uint32_t x0 = (uint32_t) MAX<int32_t>(minCellX - firstX, 0);
+			const uint32_t y0 = (uint32_t) MAX<int32_t>(minCellY - firstY, 0);
+			const uint32_t x1 = (uint32_t) MIN<int32_t>(maxCellX - firstX, _tileSize - 1);
+			const uint32_t y1 = (uint32_t) MIN<int32_t>(maxCellY - firstY, _tileSize - 1);
+
+			for (std::vector<Layer>::const_iterator l = tile.layers.begin(); l != tile.layers.end(); ++l) {
+				if (l->layer != kAllHeights) {
+					const float layerMin = l->layer * _layerHeight;
+					const float layerMax = layerMin + _layerHeight;
+
+					if ((layerMax < minZ) || (layerMin > maxZ))
+						continue;
+				}
+
+				if (sum(*l, x0, y0, x1, y1) > 0)
+					return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+int32_t OccupancyGrid::getCell(float coordinate) const {
+	return (int32_t) std::floor(coordinate / _cellSize);
+}
+
+int32_t OccupancyGrid::getTileIndex(int32_t cell) const {
+	const int32_t tileSize = (int32_t) _tileSize;
+
+	// Round towards negative infinity
+	if (cell >= 0)
+		return cell / tileSize;
+
+	return -((-cell - 1) / tileSize) - 1;
+}
+
+uint64_t OccupancyGrid::getKey(int32_t tileX, int32_t tileY) {
+	return (((uint64_t) (uint32_t) tileX) << 32) | (uint64_t) (uint32_t) tileY;
+}
+
+const OccupancyGrid::Tile &OccupancyGrid::getTile(int32_t tileX, int32_t tileY) {
+	const uint64_t key = getKey(tileX, tileY);
+
+	const Tile *tile = _tiles.find(key);
+	if (tile)
+		return *tile;
+
+	Tile newTile;
+	fillTile(tileX, tileY, newTile);
+
+	Tile &inserted = _tiles[key];
+	inserted = std::move(newTile);
+
+	return inserted;
+}
+
+void OccupancyGrid::fillTile(int32_t tileX, int32_t tileY, Tile &tile) {
+	_fillX = tileX * (int32_t) _tileSize;
+	_fillY = tileY * (int32_t) _tileSize;
+
+	_fillCells.clear();
+	_filling = true;
+
+	const glm::vec2 min(_fillX * _cellSize, _fillY * _cellSize);
+	const glm::vec2 max((_fillX + (int32_t) _tileSize) * _cellSize, (_fillY + (int32_t) _tileSize) * _cellSize);
+
+	try {
+		_fill(min, max);
+	} catch (...) {
+		_filling = false;
+		_fillCells.clear();
+		throw;
+	}
+
+	_filling = false;
+
+	// Turn the blocked cells of each layer into a summed-area table
+	const uint32_t width = _tileSize + 1;
+	for (std::vector<std::pair<int32_t, std::vector<byte>>>::const_iterator f = _fillCells.begin();
+	     f != _fillCells.end(); ++f) {
+
+		tile.layers.push_back(Layer());
+
+		Layer &layer = tile.layers.back();
+		layer.layer = f->first;
+		layer.sums.resize(width * width, 0);
+
+		for (uint32_t y = 0; y < _tileSize; y++)
+			for (uint32_t x = 0; x < _tileSize; x++)
+				layer.sums[(y + 1) * width + x + 1] = f->second[y * _tileSize + x] +
+				                                      layer.sums[y * width + x + 1] +
+				                                      layer.sums[(y + 1) * width + x] -
+				                                      layer.sums[y * width + x];
+
+		if (layer.sums.back() == 0)
+			tile.layers.pop_back();
+	}
+
+	_fillCells.clear();
+}
+
+std::vector<byte> &OccupancyGrid::getFillCells(int32_t layer) {
+	for (std::vector<std::pair<int32_t, std::vector<byte>>>::iterator f = _fillCells.begin();
+	     f != _fillCells.end(); ++f)
+		if (f->first == layer)
+			return f->second;
+
+	_fillCells.push_back(std::make_pair(layer, std::vector<byte>(_tileSize * _tileSize, 0)));
+	return _fillCells.back().second;
+}
+
+void OccupancyGrid::addTriangle(const glm::vec2 &a, const glm::vec2 &b, const glm::vec2 &c,
+                                std::vector<byte> &cells) {
+
+	const int32_t x0 = MAX<int32_t>(getCell(MIN(a[0], MIN(b[0], c[0]))) - _fillX, 0);
+	const int32_t y0 = MAX<int32_t>(getCell(MIN(a[1], MIN(b[1], c[1]))) - _fillY, 0);
+	const int32_t x1 = MIN<int32_t>(getCell(MAX(a[0], MAX(b[0], c[0]))) - _fillX, _tileSize - 1);
+	const int32_t y1 = MIN<int32_t>(getCell(MAX(a[1], MAX(b[1], c[1]))) - _fillY, _tileSize - 1);
+
+	for (int32_t y = y0; y <= y1; y++) {
+		for (int32_t x = x0; x <= x1; x++) {
+			if (cells[y * _tileSize + x])
+				continue;
+
+			const glm::vec2 cellMin((_fillX + x) * _cellSize, (_fillY + y) * _cellSize);
+			const glm::vec2 cellMax(cellMin[0] + _cellSize, cellMin[1] + _cellSize);
+
+			if (intersectBoxTriangle2D(cellMin, cellMax, a, b, c))
+				cells[y * _tileSize + x] = 1;
+		}
+	}
+}
+
+uint32_t OccupancyGrid::sum(const Layer &layer, uint32_t minX, uint32_t minY, uint32_t maxX, uint32_t maxY) const {
+	const uint32_t width = _tileSize + 1;
+
+	const int32_t total = (int32_t) layer.sums[(maxY + 1) * width + maxX + 1]
+	                    - (int32_t) layer.sums[(maxY + 1) * width + minX]
+	                    - (int32_t) layer.sums[minY * width + maxX + 1]
+	                    + (int32_t) layer.sums[minY * width + minX];
+
+	return (uint32_t) total;
+}
+
+} // End of namespace Common
@@ -0,0 +1,135 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A persistent grid of cells blocked by obstacles in the XY plane.
+ */
+
+#ifndef COMMON_OCCUPANCYGRID_H
+#define COMMON_OCCUPANCYGRID_H
+
+#include <vector>
+#include <functional>
+
+#include "external/glm/vec2.hpp"
+#include "external/glm/vec3.hpp"
+
+#include "src/common/types.h"
+#include "src/common/flathashmap.h"
+
+namespace Common {
+
+/** A persistent, sparse grid of square cells blocked by obstacle triangles.
+ *
+ *  The grid is split into square tiles of cells. A tile is filled on its
+ *  first query, by calling the fill function with the area the tile covers,
+ *  which in turn adds the triangles there with addTriangle(). After that,
+ *  the tile is kept until it is invalidated, for example because an object
+ *  in it moved.
+ *
+ *  Obstacles are sorted into horizontal layers of a fixed height, so that
+ *  queries only see the obstacles within a given height range. Obstacles
+ *  added for all heights are seen by every query.
+ *
+ *  Each tile keeps summed-area tables of its cells, so testing whether a
+ *  rectangle is blocked only needs a few lookups per tile it touches.
+ */
+class OccupancyGrid {
+public:
+	/** Add the obstacles within the rectangle between min and max. */
+	typedef std::function<void(const glm::vec2 &min, const glm::vec2 &max)> FillFunction;
+
+	OccupancyGrid(float cellSize, uint32_t tileSize, float layerHeight, const FillFunction &fill);
+
+	float getCellSize() const;
+
+	/** Drop all tiles, to be filled again on demand. */
+	void clear();
+	/** Drop all tiles touching a rectangle, to be filled again on demand. */
+	void invalidate(const glm::vec2 &min, const glm::vec2 &max);
+
+	/** Block the cells a triangle touches. Only valid while a tile is being filled.
+	 *
+	 *  @param a, b, c       The corners of the triangle.
+	 *  @param allHeights    Block the cells for queries at all heights, instead
+	 *                       of only those overlapping the triangle's height.
+	 */
+	void addTriangle(const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c, bool allHeights = false);
+
+	/** Is any cell touching the rectangle between min and max blocked
+	 *  by an obstacle overlapping the height range between minZ and maxZ? */
+	bool isBlocked(const glm::vec2 &min, const glm::vec2 &max, float minZ, float maxZ);
+
+private:
+	static const int32_t kAllHeights = INT32_MIN;
+
+	/** The obstacles of one height layer within a tile. */
+	struct Layer {
+		int32_t layer;
+
+		/** Summed-area table of the blocked cells, (tileSize + 1)² entries. */
+		std::vector<uint16_t> sums;
+	};
+
+	struct Tile {
+		std::vector<Layer> layers;
+	};
+
+	struct TileHash {
+		size_t operator()(uint64_t key) const {
+			key ^= key >> 33;
+			key *= UINT64_C(0xFF51AFD7ED558CCD);
+			key ^= key >> 33;
+
+			return (size_t) key;
+		}
+	};
+
+	float _cellSize;
+	uint32_t _tileSize;
+	float _layerHeight;
+
+	FillFunction _fill;
+
+	FlatHashMap<uint64_t, Tile, TileHash> _tiles;
+
+	// While filling a tile
+	bool _filling;
+	int32_t _fillX; ///< First cell of the tile being filled.
+	int32_t _fillY; ///< First cell of the tile being filled.
+	std::vector<std::pair<int32_t, std::vector<byte>>> _fillCells; ///< Blocked cells of each layer.
+
+	int32_t getCell(float coordinate) const;
+	int32_t getTileIndex(int32_t cell) const;
+
+	static uint64_t getKey(int32_t tileX, int32_t tileY);
+
+	const Tile &getTile(int32_t tileX, int32_t tileY);
+	void fillTile(int32_t tileX, int32_t tileY, Tile &tile);
+
+	std::vector<byte> &getFillCells(int32_t layer);
+	void addTriangle(const glm::vec2 &a, const glm::vec2 &b, const glm::vec2 &c, std::vector<byte> &cells);
+
+	uint32_t sum(const Layer &layer, uint32_t minX, uint32_t minY, uint32_t maxX, uint32_t maxY) const;
+};
+
+} // End of namespace Common
+
+#endif // COMMON_OCCUPANCYGRID_H
@@ -0,0 +1,233 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A file read stream sharing its file handle through a bounded pool.
+ */
+
+#include <cassert>
+#include <cstring>
+
+#include <list>
+#include <map>
+
+#include "src/common/pooledreadfile.h"
+#include "src/common/readfile.h"
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/mutex.h"
+
+namespace Common {
+
+/** The number of files kept open by default.
+ *
+ *  Low enough to stay well clear of the usual descriptor limits, even
+ *  with everything else the game opens, and high enough that the BIFs
+ *  of a KEY and the ERFs of a module all fit.
+ */
+static const size_t kPoolSizeDefault = 64;
+
+/** The size of the readahead buffer of each stream.
+ *
+ *  Archives are mostly read in small pieces all over the place, and
+ *  larger reads bypass the buffer anyway.
+ */
+static const size_t kReadAhead = 4 * 1024;
+
+typedef std::list<std::pair<UString, std::shared_ptr<ReadFile> > > FileList;
+typedef std::map<UString, FileList::iterator> FileMap;
+
+static std::mutex _poolMutex;
+
+static size_t _poolSize = kPoolSizeDefault;
+
+/** All open files, the most recently used one first. */
+static FileList _files;
+/** The open files, by file name. */
+static FileMap _fileMap;
+
+/** Close the least recently used files until the pool fits into its size. */
+static void trimPool() {
+	while (!_files.empty() && (_files.size() > MAX<size_t>(_poolSize, 1))) {
+		// Streams currently reading from the file hold their own reference
+		_fileMap.erase(_files.back().first);
+		_files.pop_back();
+	}
+}
+
+/** Return the open file from the pool, opening it if necessary. */
+static std::shared_ptr<ReadFile> getPoolFile(const UString &fileName) {
+	{
+		std::lock_guard<std::mutex> lock(_poolMutex);
+
+		FileMap::iterator f = _fileMap.find(fileName);
+		if (f != _fileMap.end()) {
+			_files.splice(_files.begin(), _files, f->second);
+
+			return f->second->second;
+		}
+	}
+
+	// Open the file without holding the lock, so other files can be read meanwhile
+	std::shared_ptr<ReadFile> file = std::make_shared<ReadFile>(fileName);
+	file->setAccessHint(kFileAccessRandom);
+
+	std::lock_guard<std::mutex> lock(_poolMutex);
+
+	// Somebody else might have been faster
+	FileMap::iterator f = _fileMap.find(fileName);
+	if (f != _fileMap.end()) {
+		_files.splice(_files.begin(), _files, f->second);
+
+		return f->second->second;
+	}
+
+	_files.push_front(std::make_pair(fileName, file));
+	_fileMap[fileName] = _files.begin();
+
+	trimPool();
+
+	return file;
+}
+
+
+PooledReadFile::PooledReadFile(const UString &fileName) : _fileName(fileName), _size(0),
+	_position(0), _eos(false), _bufferStart(0), _bufferLength(0) {
+
+	_size = getFile()->size();
+}
+
+PooledReadFile::~PooledReadFile() {
+}
+
+std::shared_ptr<ReadFile> PooledReadFile::getFile() const {
+	return getPoolFile(_fileName);
+}
+
+size_t PooledReadFile::readAt(size_t offset, void *dataPtr, size_t dataSize) const {
+	if ((offset >= _size) || (dataSize == 0))
+		return 0;
+
+	return getFile()->readAt(offset, dataPtr, dataSize);
+}
+
+bool PooledReadFile::eos() const {
+	return _eos;
+}
+
+size_t PooledReadFile::pos() const {
+	return _position;
+}
+
+size_t PooledReadFile::size() const {
+	return _size;
+}
+
+size_t PooledReadFile::seek(ptrdiff_t offset, Origin whence) {
+	if (((size_t) whence) >= kOriginMAX)
+		throw Exception(kSeekError);
+
+	const size_t oldPos = _position;
+
+	ptrdiff_t newPos = offset;
+	if      (whence == kOriginCurrent)
+		newPos += (ptrdiff_t) _position;
+	else if (whence == kOriginEnd)
+		newPos += (ptrdiff_t) _size;
+
+	if ((newPos < 0) || ((size_t)newPos > _size))
+		throw Exception(kSeekError);
+
+	_position = (size_t) newPos;
+	_eos      = false;
+
+	return oldPos;
+}
+
+size_t PooledReadFile::read(void *dataPtr, size_t dataSize) {
+	assert(dataPtr);
+
+	byte *data = static_cast<byte *>(dataPtr);
+
+	size_t total = 0;
+	while (total < dataSize) {
+		// Whatever's still left in the buffer
+		if ((_position >= _bufferStart) && (_position < (_bufferStart + _bufferLength))) {
+			const size_t n = MIN(dataSize - total, _bufferStart + _bufferLength - _position);
+
+			std::memcpy(data + total, _buffer.get() + (_position - _bufferStart), n);
+
+			_position += n;
+			total     += n;
+			continue;
+		}
+
+		// Big reads go straight into the destination
+		if ((dataSize - total) >= kReadAhead) {
+			const size_t n = readAt(_position, data + total, dataSize - total);
+
+			_position += n;
+			total     += n;
+			break;
+		}
+
+		if (!_buffer)
+			_buffer = std::make_unique<byte[]>(kReadAhead);
+
+		_bufferStart  = _position;
+		_bufferLength = readAt(_position, _buffer.get(), kReadAhead);
+
+		if (_bufferLength == 0)
+			break;
+	}
+
+	if (total < dataSize)
+		_eos = true;
+
+	return total;
+}
+
+void PooledReadFile::setPoolSize(size_t count) {
+	std::lock_guard<std::mutex> lock(_poolMutex);
+
+	_poolSize = count;
+	trimPool();
+}
+
+size_t PooledReadFile::getPoolSize() {
+	std::lock_guard<std::mutex> lock(_poolMutex);
+
+	return _poolSize;
+}
+
+size_t PooledReadFile::getOpenCount() {
+	std::lock_guard<std::mutex> lock(_poolMutex);
+
+	return _files.size();
+}
+
+void PooledReadFile::clearPool() {
+	std::lock_guard<std::mutex> lock(_poolMutex);
+
+	_fileMap.clear();
+	_files.clear();
+}
+
+} // End of namespace Common
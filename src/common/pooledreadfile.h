@@ -0,0 +1,103 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A file read stream sharing its file handle through a bounded pool.
+ */
+
+#ifndef COMMON_POOLEDREADFILE_H
+#define COMMON_POOLEDREADFILE_H
+
+#include <cstddef>
+
+#include <memory>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+#include "src/common/readstream.h"
+
+namespace Common {
+
+class ReadFile;
+
+/** A file read stream that doesn't keep its own file handle open.
+ *
+ *  Instead, all PooledReadFiles share a process-wide pool of open files.
+ *  Every read asks the pool for the handle of the file, which opens it if
+ *  necessary, and reads from it with a positional read. When more files
+ *  than the pool holds are in use, the least recently used one is closed.
+ *
+ *  This way, a game can keep hundreds of archives around without running
+ *  out of file descriptors, and several streams into the same file, in
+ *  several threads, don't fight over a shared file position.
+ *
+ *  A PooledReadFile itself is not thread-safe, apart from readAt().
+ */
+class PooledReadFile : boost::noncopyable, public SeekableReadStream {
+public:
+	/** Open a file. Throws if it doesn't exist or can't be read. */
+	PooledReadFile(const UString &fileName);
+	~PooledReadFile();
+
+	/** Read from a position in the file, without changing the stream's position.
+	 *
+	 *  Safe to call from several threads at once.
+	 *
+	 *  @return The number of bytes read, which is only less than dataSize at the end of the file.
+	 */
+	size_t readAt(size_t offset, void *dataPtr, size_t dataSize) const;
+
+	bool eos() const;
+
+	size_t pos() const;
+	size_t size() const;
+
+	size_t seek(ptrdiff_t offset, Origin whence = kOriginBegin);
+	size_t read(void *dataPtr, size_t dataSize);
+
+	/** Set the number of files the pool keeps open at most. */
+	static void setPoolSize(size_t count);
+	/** Return the number of files the pool keeps open at most. */
+	static size_t getPoolSize();
+	/** Return the number of files the pool currently has open. */
+	static size_t getOpenCount();
+
+	/** Close all files in the pool. Streams reopen their files on their next read. */
+	static void clearPool();
+
+private:
+	UString _fileName;
+
+	size_t _size;     ///< The file's size.
+	size_t _position; ///< The current position within the file.
+	bool _eos;        ///< Did a read reach the end of the file?
+
+	std::unique_ptr<byte[]> _buffer; ///< The readahead buffer.
+	size_t _bufferStart;             ///< The position in the file the buffer holds data from.
+	size_t _bufferLength;            ///< The number of bytes in the buffer.
+
+	std::shared_ptr<ReadFile> getFile() const;
+};
+
+} // End of namespace Common
+
+#endif // COMMON_POOLEDREADFILE_H
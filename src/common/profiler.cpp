@@ -0,0 +1,289 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A hierarchical CPU profiler, recording named zones of time.
+ */
+
+#include <cstring>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+
+#include "src/common/profiler.h"
+#include "src/common/error.h"
+#include "src/common/strutil.h"
+#include "src/common/writefile.h"
+#include "src/common/thread.h"
+#include "src/common/threads.h"
+
+DECLARE_SINGLETON(Common::Profiler)
+
+namespace Common {
+
+static std::atomic<uint32_t> profilerGeneration(0);
+
+thread_local Profiler::ThreadBuffer *Profiler::_threadBuffer     = 0;
+thread_local uint32_t                Profiler::_threadGeneration = 0;
+
+const size_t Profiler::kBufferSize;
+const size_t Profiler::kNoteBufferSize;
+
+struct CompareName {
+	bool operator()(const char *a, const char *b) const {
+		return std::strcmp(a, b) < 0;
+	}
+};
+
+static bool compareTime(const Profiler::Entry &a, const Profiler::Entry &b) {
+	if (a.time != b.time)
+		return a.time > b.time;
+
+	return a.calls > b.calls;
+}
+
+/** Escape a string for use within a JSON string. */
+static UString escapeJSON(const char *str) {
+	UString escaped;
+
+	for (; *str; str++) {
+		if ((*str == '"') || (*str == '\\'))
+			escaped += '\\';
+
+		if ((unsigned char) *str < 0x20)
+			escaped += UString::format("\\u%04X", (unsigned int) *str);
+		else
+			escaped += *str;
+	}
+
+	return escaped;
+}
+
+
+Profiler::ThreadBuffer::ThreadBuffer(uint32_t i, const UString &n, const char *t) :
+	id(i), name(n), track(t), count(0), noteCount(0) {
+}
+
+
+Profiler::Profiler() : _enabled(false), _generation(++profilerGeneration), _startTime(getTime()) {
+}
+
+Profiler::~Profiler() {
+}
+
+void Profiler::setEnabled(bool enabled) {
+	_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Profiler::clear() {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (std::vector<std::unique_ptr<ThreadBuffer>>::iterator t = _threads.begin(); t != _threads.end(); ++t) {
+		std::lock_guard<std::mutex> threadLock((*t)->mutex);
+
+		(*t)->zones.clear();
+		(*t)->evicted.clear();
+		(*t)->count = 0;
+
+		(*t)->notes.clear();
+		(*t)->noteCount = 0;
+	}
+}
+
+uint64_t Profiler::getTime() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Profiler::addZone(const char *name, uint64_t start, uint64_t end) {
+	const Zone zone = { name, start, end - start };
+
+	recordZone(getThreadBuffer(), zone);
+}
+
+void Profiler::addTrackZone(const char *track, const char *name, uint64_t start, uint64_t end) {
+	const Zone zone = { name, start, end - start };
+
+	recordZone(getTrackBuffer(track), zone);
+}
+
+void Profiler::addNote(const char *category, const UString &text) {
+	const Note note = { category, text, getTime() };
+
+	ThreadBuffer &buffer = getThreadBuffer();
+	std::lock_guard<std::mutex> lock(buffer.mutex);
+
+	if (buffer.notes.size() < kNoteBufferSize)
+		buffer.notes.push_back(note);
+	else
+		buffer.notes[buffer.noteCount % kNoteBufferSize] = note;
+
+	buffer.noteCount++;
+}
+
+void Profiler::recordZone(ThreadBuffer &buffer, const Zone &zone) {
+	std::lock_guard<std::mutex> lock(buffer.mutex);
+
+	if (buffer.zones.size() < kBufferSize) {
+		buffer.zones.push_back(zone);
+	} else {
+		Zone &oldest = buffer.zones[buffer.count % kBufferSize];
+
+		Entry &entry = buffer.evicted.insert(std::make_pair(oldest.name, Entry{ oldest.name, 0, 0 })).first->second;
+		entry.calls += 1;
+		entry.time  += oldest.duration;
+
+		oldest = zone;
+	}
+
+	buffer.count++;
+}
+
+Profiler::ThreadBuffer &Profiler::getThreadBuffer() {
+	if (_threadBuffer && (_threadGeneration == _generation))
+		return *_threadBuffer;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	const uint32_t id = _threads.size();
+
+	UString name = Thread::getCurrentThreadName();
+	if (name.empty())
+		name = (initedThreads() && isMainThread()) ? UString("Main") : UString::format("Thread %u", id);
+
+	_threads.emplace_back(std::make_unique<ThreadBuffer>(id, name));
+
+	_threadBuffer     = _threads.back().get();
+	_threadGeneration = _generation;
+
+	return *_threadBuffer;
+}
+
+Profiler::ThreadBuffer &Profiler::getTrackBuffer(const char *track) {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (std::vector<std::unique_ptr<ThreadBuffer>>::iterator t = _threads.begin(); t != _threads.end(); ++t)
+		if ((*t)->track && !std::strcmp((*t)->track, track))
+			return **t;
+
+	_threads.emplace_back(std::make_unique<ThreadBuffer>(_threads.size(), track, track));
+
+	return *_threads.back();
+}
+
+Profiler::Entries Profiler::getEntries() const {
+	std::map<const char *, Entry, CompareName> entries;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (std::vector<std::unique_ptr<ThreadBuffer>>::const_iterator t = _threads.begin(); t != _threads.end(); ++t) {
+		std::lock_guard<std::mutex> threadLock((*t)->mutex);
+
+		for (std::vector<Zone>::const_iterator z = (*t)->zones.begin(); z != (*t)->zones.end(); ++z) {
+			Entry &entry = entries.insert(std::make_pair(z->name, Entry{ z->name, 0, 0 })).first->second;
+
+			entry.calls += 1;
+			entry.time  += z->duration;
+		}
+
+		for (std::unordered_map<const char *, Entry>::const_iterator e = (*t)->evicted.begin(); e != (*t)->evicted.end(); ++e) {
+			Entry &entry = entries.insert(std::make_pair(e->first, Entry{ e->first, 0, 0 })).first->second;
+
+			entry.calls += e->second.calls;
+			entry.time  += e->second.time;
+		}
+	}
+
+	Entries sorted;
+	sorted.reserve(entries.size());
+
+	for (std::map<const char *, Entry, CompareName>::const_iterator e = entries.begin(); e != entries.end(); ++e)
+		sorted.push_back(e->second);
+
+	std::stable_sort(sorted.begin(), sorted.end(), compareTime);
+	return sorted;
+}
+
+void Profiler::writeChromeTrace(WriteStream &stream, uint64_t since) const {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	stream.writeString("{\"traceEvents\":[\n");
+
+	bool first = true;
+	for (std::vector<std::unique_ptr<ThreadBuffer>>::const_iterator t = _threads.begin(); t != _threads.end(); ++t) {
+		std::lock_guard<std::mutex> threadLock((*t)->mutex);
+
+		stream.writeString(UString::format("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+		                                   "\"args\":{\"name\":\"%s\"}}", first ? "" : ",\n",
+		                                   (*t)->id, escapeJSON((*t)->name.c_str()).c_str()));
+		first = false;
+
+		// Oldest zone first
+		const size_t size  = (*t)->zones.size();
+		const size_t start = ((*t)->count > size) ? ((*t)->count % size) : 0;
+
+		for (size_t i = 0; i < size; i++) {
+			const Zone &zone = (*t)->zones[(start + i) % size];
+			if ((zone.start + zone.duration) < since)
+				continue;
+
+			const uint64_t zoneStart = (zone.start >= _startTime) ? (zone.start - _startTime) : 0;
+
+			stream.writeString(UString::format(",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+			                                   "\"ts\":%s,\"dur\":%s}", escapeJSON(zone.name).c_str(), (*t)->id,
+			                                   composeString(zoneStart).c_str(),
+			                                   composeString(zone.duration).c_str()));
+		}
+
+		const size_t noteSize  = (*t)->notes.size();
+		const size_t noteStart = ((*t)->noteCount > noteSize) ? ((*t)->noteCount % noteSize) : 0;
+
+		for (size_t i = 0; i < noteSize; i++) {
+			const Note &note = (*t)->notes[(noteStart + i) % noteSize];
+			if (note.time < since)
+				continue;
+
+			const uint64_t noteTime = (note.time >= _startTime) ? (note.time - _startTime) : 0;
+
+			stream.writeString(UString::format(",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"i\",\"s\":\"t\","
+			                                   "\"pid\":1,\"tid\":%u,\"ts\":%s}",
+			                                   escapeJSON(note.text.c_str()).c_str(),
+			                                   escapeJSON(note.category).c_str(), (*t)->id,
+			                                   composeString(noteTime).c_str()));
+		}
+	}
+
+	stream.writeString("\n],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+void Profiler::dumpChromeTrace(const UString &fileName, uint64_t since) const {
+	WriteFile file;
+
+	if (!file.open(fileName))
+		throw Exception(kOpenError);
+
+	writeChromeTrace(file, since);
+
+	file.flush();
+	file.close();
+}
+
+} // End of namespace Common
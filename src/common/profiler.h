@@ -0,0 +1,222 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A hierarchical CPU profiler, recording named zones of time.
+ */
+
+#ifndef COMMON_PROFILER_H
+#define COMMON_PROFILER_H
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <unordered_map>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+#include "src/common/singleton.h"
+#include "src/common/mutex.h"
+
+namespace Common {
+
+class WriteStream;
+
+/** A hierarchical CPU profiler, recording named zones of time.
+ *
+ *  Code marks a zone by placing a PROFILE_ZONE("name") at the start of a
+ *  scope. When profiling is enabled, the start and duration of that scope
+ *  are recorded. Zones within zones form a hierarchy, which a viewer can
+ *  reconstruct from the times.
+ *
+ *  Every thread records into its own ring buffer, which keeps the most
+ *  recent kBufferSize zones. Zones pushed out of the ring buffer are still
+ *  counted in the accumulated times. When profiling is disabled, a zone only
+ *  costs a relaxed atomic load.
+ *
+ *  Alongside the zones, each thread keeps a smaller ring buffer of notes:
+ *  short texts marking what happened at a certain time, like the name of
+ *  a resource that was loaded or a script that was run.
+ *
+ *  The recorded zones can be exported in the Chrome trace event format, to
+ *  be viewed in chrome://tracing or Perfetto.
+ *
+ *  Like the thread pool, the profiler needs to be instantiated before any
+ *  threads using it are.
+ */
+class Profiler : public Singleton<Profiler> {
+public:
+	/** The number of zones kept per thread. */
+	static const size_t kBufferSize = 65536;
+	/** The number of notes kept per thread. */
+	static const size_t kNoteBufferSize = 4096;
+
+	/** The accumulated times of all recorded zones with the same name. */
+	struct Entry {
+		const char *name;
+
+		uint64_t calls; ///< Number of recorded zones.
+		uint64_t time;  ///< Wall time spent, in microseconds.
+	};
+
+	typedef std::vector<Entry> Entries;
+
+	Profiler();
+	~Profiler();
+
+	bool isEnabled() const {
+		return _enabled.load(std::memory_order_relaxed);
+	}
+
+	void setEnabled(bool enabled);
+
+	/** Forget all recorded zones. */
+	void clear();
+
+	/** Return the current time, in microseconds. */
+	static uint64_t getTime();
+
+	/** Record a zone on the calling thread. The name has to be a string literal. */
+	void addZone(const char *name, uint64_t start, uint64_t end);
+
+	/** Record a zone on a named track instead of the calling thread.
+	 *
+	 *  Used for times that weren't spent by any of our threads, like
+	 *  those measured on the GPU. Both names have to be string literals.
+	 */
+	void addTrackZone(const char *track, const char *name, uint64_t start, uint64_t end);
+
+	/** Record a note on the calling thread.
+	 *
+	 *  The category has to be a string literal. Use PROFILE_NOTE(), which
+	 *  only builds the text when the profiler is enabled.
+	 */
+	void addNote(const char *category, const UString &text);
+
+	/** Return the accumulated times of all recorded zones, sorted by time spent. */
+	Entries getEntries() const;
+
+	/** Write all recorded zones and notes as a Chrome trace event JSON file.
+	 *
+	 *  @param stream The stream to write to.
+	 *  @param since  Leave out zones that ended and notes that were recorded before this time.
+	 */
+	void writeChromeTrace(WriteStream &stream, uint64_t since = 0) const;
+	/** Write all recorded zones and notes as a Chrome trace event JSON file. */
+	void dumpChromeTrace(const UString &fileName, uint64_t since = 0) const;
+
+private:
+	/** A recorded zone. */
+	struct Zone {
+		const char *name;
+		uint64_t start;    ///< In microseconds.
+		uint64_t duration; ///< In microseconds.
+	};
+
+	/** A recorded note. */
+	struct Note {
+		const char *category;
+		UString text;
+		uint64_t time; ///< In microseconds.
+	};
+
+	/** The zones recorded by one thread. */
+	struct ThreadBuffer {
+		/** Guards the zones against readers. Only ever contended while dumping. */
+		mutable std::mutex mutex;
+
+		uint32_t id;
+		UString name;
+
+		const char *track; ///< The name of the track, or 0 for a thread's buffer.
+
+		std::vector<Zone> zones; ///< Ring buffer of zones.
+		size_t count;            ///< Number of zones ever recorded.
+
+		std::vector<Note> notes; ///< Ring buffer of notes.
+		size_t noteCount;        ///< Number of notes ever recorded.
+
+		/** Accumulated times of the zones pushed out of the ring buffer. */
+		std::unordered_map<const char *, Entry> evicted;
+
+		ThreadBuffer(uint32_t i, const UString &n, const char *t = 0);
+	};
+
+	std::atomic<bool> _enabled;
+
+	uint32_t _generation; ///< Tells apart the buffers of earlier profiler instances.
+
+	mutable std::mutex _mutex;
+	std::vector<std::unique_ptr<ThreadBuffer>> _threads; ///< Guarded by _mutex.
+
+	uint64_t _startTime; ///< All zone times are written relative to this.
+
+	static thread_local ThreadBuffer *_threadBuffer;   ///< The calling thread's buffer.
+	static thread_local uint32_t      _threadGeneration; ///< The generation of the calling thread's buffer.
+
+	/** Return the calling thread's buffer, creating it if necessary. */
+	ThreadBuffer &getThreadBuffer();
+	/** Return the buffer of a named track, creating it if necessary. */
+	ThreadBuffer &getTrackBuffer(const char *track);
+
+	static void recordZone(ThreadBuffer &buffer, const Zone &zone);
+};
+
+/** Records a profiler zone lasting for the lifetime of this object. */
+class ProfileZone : boost::noncopyable {
+public:
+	ProfileZone(const char *name) : _name(0), _start(0) {
+		if (Profiler::instance().isEnabled()) {
+			_name  = name;
+			_start = Profiler::getTime();
+		}
+	}
+
+	~ProfileZone() {
+		if (_name)
+			Profiler::instance().addZone(_name, _start, Profiler::getTime());
+	}
+
+private:
+	const char *_name;
+	uint64_t _start;
+};
+
+} // End of namespace Common
+
+#define PROFILE_ZONE_CONCAT2(a, b) a ## b
+#define PROFILE_ZONE_CONCAT(a, b) PROFILE_ZONE_CONCAT2(a, b)
+
+/** Record the time spent in the current scope as a profiler zone. */
+#define PROFILE_ZONE(name) Common::ProfileZone PROFILE_ZONE_CONCAT(profileZone, __LINE__)(name)
+
+/** Record a note on the calling thread, if the profiler is enabled. The text is only built then. */
+#define PROFILE_NOTE(category, text) \
+	do { \
+		if (Common::Profiler::instance().isEnabled()) \
+			Common::Profiler::instance().addNote(category, text); \
+	} while (0)
+
+/** Shortcut for accessing the CPU profiler. */
+#define ProfilerMan Common::Profiler::instance()
+
+#endif // COMMON_PROFILER_H
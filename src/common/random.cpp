@@ -35,11 +35,15 @@ Random::Random() {
 
 int Random::getNext(int min, int max) {
 	std::uniform_int_distribution<int> dist(min, max - 1);
+
+	std::lock_guard<std::mutex> lock(_mutex);
 	return dist(_generator);
 }
 
 float Random::getNext(float min, float max) {
 	std::uniform_real_distribution<float> dist(min, max);
+
+	std::lock_guard<std::mutex> lock(_mutex);
 	return dist(_generator);
 }
 
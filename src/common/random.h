@@ -28,6 +28,7 @@
 #include <random>
 
 #include "src/common/singleton.h"
+#include "src/common/mutex.h"
 
 namespace Common {
 
@@ -43,6 +44,8 @@ public:
 
 private:
 	std::mt19937 _generator;
+	/** Random numbers are drawn from several threads, like the animation workers. */
+	std::mutex _mutex;
 };
 
 } // End of namespace Common
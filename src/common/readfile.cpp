@@ -24,18 +24,37 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstring>
+#include <cerrno>
+
+#if !defined(WIN32)
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
 
 #include "src/common/readfile.h"
+#include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/ustring.h"
 #include "src/common/platform.h"
 
 namespace Common {
 
-ReadFile::ReadFile() : _handle(0), _size(kSizeInvalid) {
+/** The default size of the readahead buffer. */
+static const size_t kReadAheadDefault    = 32 * 1024;
+/** The size of the readahead buffer for files read sequentially. */
+static const size_t kReadAheadSequential = 256 * 1024;
+/** The size of the readahead buffer for files read randomly. */
+static const size_t kReadAheadRandom     = 4 * 1024;
+
+ReadFile::ReadFile() : _handle(0), _size(kSizeInvalid), _position(0), _eos(false),
+	_bufferCapacity(kReadAheadDefault), _bufferStart(0), _bufferLength(0) {
+
 }
 
-ReadFile::ReadFile(const UString &fileName) : _handle(0), _size(kSizeInvalid) {
+ReadFile::ReadFile(const UString &fileName) : _handle(0), _size(kSizeInvalid), _position(0), _eos(false),
+	_bufferCapacity(kReadAheadDefault), _bufferStart(0), _bufferLength(0) {
+
 	if (!open(fileName))
 		throw Exception("Can't open file \"%s\"", fileName.c_str());
 }
@@ -88,24 +107,117 @@ void ReadFile::close() {
 
 	_handle = 0;
 	_size   = kSizeInvalid;
+
+	_position = 0;
+	_eos      = false;
+
+	_bufferStart  = 0;
+	_bufferLength = 0;
 }
 
 bool ReadFile::isOpen() const {
 	return _handle != 0;
 }
 
+void ReadFile::setReadAhead(size_t size) {
+	if (size == _bufferCapacity)
+		return;
+
+	_buffer.reset();
+	_bufferCapacity = size;
+
+	_bufferStart  = 0;
+	_bufferLength = 0;
+}
+
+void ReadFile::setAccessHint(FileAccessHint hint) {
+	switch (hint) {
+		case kFileAccessSequential:
+			setReadAhead(kReadAheadSequential);
+			break;
+
+		case kFileAccessRandom:
+			setReadAhead(kReadAheadRandom);
+			break;
+
+		default:
+			setReadAhead(kReadAheadDefault);
+			break;
+	}
+
+#if defined(POSIX_FADV_NORMAL)
+	if (!_handle)
+		return;
+
+	static const int kHintToAdvice[] = { POSIX_FADV_NORMAL, POSIX_FADV_SEQUENTIAL, POSIX_FADV_RANDOM };
+
+	// Only a hint, so we don't care whether it worked
+	posix_fadvise(fileno(_handle), 0, 0, kHintToAdvice[hint]);
+#endif
+}
+
+void ReadFile::setNeeded(bool needed) {
+#if defined(POSIX_FADV_WILLNEED)
+	if (!_handle)
+		return;
+
+	posix_fadvise(fileno(_handle), 0, 0, needed ? POSIX_FADV_WILLNEED : POSIX_FADV_DONTNEED);
+#else
+	UNUSED(needed);
+#endif
+}
+
+size_t ReadFile::readAt(size_t offset, void *dataPtr, size_t dataSize) const {
+	if (!_handle || (offset >= _size))
+		return 0;
+
+	assert(dataPtr);
+
+	dataSize = MIN(dataSize, _size - offset);
+
+#if defined(WIN32)
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (std::fseek(_handle, offset, SEEK_SET) != 0)
+		return 0;
+
+	return std::fread(dataPtr, 1, dataSize, _handle);
+#else
+	byte *data = static_cast<byte *>(dataPtr);
+	const int fd = fileno(_handle);
+
+	size_t total = 0;
+	while (total < dataSize) {
+		const ssize_t n = pread(fd, data + total, dataSize - total, offset + total);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+
+			break;
+		}
+
+		if (n == 0)
+			break;
+
+		total += n;
+	}
+
+	return total;
+#endif
+}
+
 bool ReadFile::eos() const {
 	if (!_handle)
 		return true;
 
-	return std::feof(_handle) != 0;
+	return _eos;
 }
 
 size_t ReadFile::pos() const {
 	if (!_handle)
 		return kPositionInvalid;
 
-	return (size_t)std::ftell(_handle);
+	return _position;
 }
 
 size_t ReadFile::size() const {
@@ -113,22 +225,26 @@ size_t ReadFile::size() const {
 }
 
 size_t ReadFile::seek(ptrdiff_t offset, Origin whence) {
-	static const int kSeekToWhence[kOriginMAX] = { SEEK_SET, SEEK_CUR, SEEK_END };
 	if (((size_t) whence) >= kOriginMAX)
 		throw Exception(kSeekError);
 
 	if (!_handle)
 		throw Exception(kSeekError);
 
-	size_t oldPos = pos();
+	const size_t oldPos = _position;
 
-	if (std::fseek(_handle, offset, kSeekToWhence[whence]) != 0)
-		throw Exception(kSeekError);
+	ptrdiff_t newPos = offset;
+	if      (whence == kOriginCurrent)
+		newPos += (ptrdiff_t) _position;
+	else if (whence == kOriginEnd)
+		newPos += (ptrdiff_t) _size;
 
-	long p = std::ftell(_handle);
-	if ((p < 0) || ((size_t)p > _size))
+	if ((newPos < 0) || ((size_t)newPos > _size))
 		throw Exception(kSeekError);
 
+	_position = (size_t) newPos;
+	_eos      = false;
+
 	return oldPos;
 }
 
@@ -137,7 +253,45 @@ size_t ReadFile::read(void *dataPtr, size_t dataSize) {
 		return 0;
 
 	assert(dataPtr);
-	return std::fread(dataPtr, 1, dataSize, _handle);
+
+	byte *data = static_cast<byte *>(dataPtr);
+
+	size_t total = 0;
+	while (total < dataSize) {
+		// Whatever's still left in the buffer
+		if ((_position >= _bufferStart) && (_position < (_bufferStart + _bufferLength))) {
+			const size_t n = MIN(dataSize - total, _bufferStart + _bufferLength - _position);
+
+			std::memcpy(data + total, _buffer.get() + (_position - _bufferStart), n);
+
+			_position += n;
+			total     += n;
+			continue;
+		}
+
+		// Big reads go straight into the destination
+		if ((dataSize - total) >= _bufferCapacity) {
+			const size_t n = readAt(_position, data + total, dataSize - total);
+
+			_position += n;
+			total     += n;
+			break;
+		}
+
+		if (!_buffer)
+			_buffer = std::make_unique<byte[]>(_bufferCapacity);
+
+		_bufferStart  = _position;
+		_bufferLength = readAt(_position, _buffer.get(), _bufferCapacity);
+
+		if (_bufferLength == 0)
+			break;
+	}
+
+	if (total < dataSize)
+		_eos = true;
+
+	return total;
 }
 
 } // End of namespace Common
@@ -28,16 +28,33 @@
 #include <cstdio>
 #include <cstddef>
 
+#include <memory>
+
 #include <boost/noncopyable.hpp>
 
 #include "src/common/types.h"
 #include "src/common/readstream.h"
+#include "src/common/mutex.h"
 
 namespace Common {
 
 class UString;
 
-/** A simple streaming file reading class. */
+/** How a file is going to be accessed, as a hint to the operating system. */
+enum FileAccessHint {
+	kFileAccessNormal,     ///< No particular pattern.
+	kFileAccessSequential, ///< Mostly read from start to end.
+	kFileAccessRandom      ///< Mostly read in small pieces all over the file.
+};
+
+/** A simple streaming file reading class.
+ *
+ *  Reads are served from a readahead buffer, which is refilled with a single
+ *  positional read whenever a read leaves it. Reads larger than the buffer
+ *  bypass it. The file's own position is never used, so readAt() can be
+ *  called from several threads at once, even while the stream itself is
+ *  being read.
+ */
 class ReadFile : boost::noncopyable, public SeekableReadStream {
 public:
 	ReadFile();
@@ -60,6 +77,31 @@ public:
 	 */
 	bool isOpen() const;
 
+	/** Set the size of the readahead buffer. 0 disables it. */
+	void setReadAhead(size_t size);
+
+	/** Tell the operating system how the file is going to be read.
+	 *
+	 *  This also sets a matching readahead buffer size.
+	 */
+	void setAccessHint(FileAccessHint hint);
+
+	/** Tell the operating system whether the whole file is going to be needed soon.
+	 *
+	 *  If so, the operating system starts reading the file into its cache in
+	 *  the background. If not, the file's cached data may be dropped. Either
+	 *  way, this outlives the ReadFile object.
+	 */
+	void setNeeded(bool needed);
+
+	/** Read from a position in the file, without changing the stream's position.
+	 *
+	 *  Safe to call from several threads at once.
+	 *
+	 *  @return The number of bytes read, which is only less than dataSize at the end of the file.
+	 */
+	size_t readAt(size_t offset, void *dataPtr, size_t dataSize) const;
+
 	bool eos() const;
 
 	size_t pos() const;
@@ -71,6 +113,19 @@ public:
 protected:
 	std::FILE *_handle; ///< The actual file handle.
 	size_t _size;       ///< The file's size.
+
+	size_t _position; ///< The current position within the file.
+	bool _eos;        ///< Did a read reach the end of the file?
+
+	std::unique_ptr<byte[]> _buffer; ///< The readahead buffer.
+	size_t _bufferCapacity;          ///< The size of the readahead buffer.
+	size_t _bufferStart;             ///< The position in the file the buffer holds data from.
+	size_t _bufferLength;            ///< The number of bytes in the buffer.
+
+#if defined(WIN32)
+	/** Positional reads seek the file first, which needs to be exclusive. */
+	mutable std::mutex _mutex;
+#endif
 };
 
 } // End of namespace Common
@@ -40,6 +40,9 @@ src_common_libcommon_la_SOURCES += \
     src/common/mdct.h \
     src/common/threads.h \
     src/common/thread.h \
+    src/common/threadpool.h \
+    src/common/framearena.h \
+    src/common/profiler.h \
     src/common/ustring.h \
     src/common/hash.h \
     src/common/md5.h \
@@ -51,27 +54,36 @@ src_common_libcommon_la_SOURCES += \
     src/common/encoding.h \
     src/common/platform.h \
     src/common/debugman.h \
+    src/common/logwriter.h \
+    src/common/fixedtimestep.h \
     src/common/debug.h \
     src/common/uuid.h \
     src/common/datetime.h \
     src/common/readstream.h \
     src/common/memreadstream.h \
+    src/common/memreader.h \
     src/common/writestream.h \
     src/common/memwritestream.h \
     src/common/streamtokenizer.h \
     src/common/stringmap.h \
     src/common/readline.h \
     src/common/readfile.h \
+    src/common/mappedfile.h \
+    src/common/pooledreadfile.h \
+    src/common/sharedreadstream.h \
     src/common/writefile.h \
     src/common/filepath.h \
     src/common/filelist.h \
+    src/common/dirsnapshot.h \
     src/common/binsearch.h \
     src/common/bitstream.h \
     src/common/bitstreamwriter.h \
     src/common/huffman.h \
     src/common/boundingbox.h \
+    src/common/frustum.h \
     src/common/configfile.h \
     src/common/configman.h \
+    src/common/configvalue.h \
     src/common/foxpro.h \
     src/common/zipfile.h \
     src/common/pe_exe.h \
@@ -82,10 +94,18 @@ src_common_libcommon_la_SOURCES += \
     src/common/timestamp.h \
     src/common/geometry.h \
     src/common/aabbnode.h \
+    src/common/aabbtree.h \
     src/common/random.h \
     src/common/mutex.h \
     src/common/semaphore.h \
     src/common/serializationstream.h \
+    src/common/flathashmap.h \
+    src/common/mpscqueue.h \
+    src/common/timerwheel.h \
+    src/common/spatialgrid.h \
+    src/common/occupancygrid.h \
+    src/common/istringkey.h \
+    src/common/memoryusage.h \
     $(EMPTY)
 
 src_common_libcommon_la_SOURCES += \
@@ -99,6 +119,9 @@ src_common_libcommon_la_SOURCES += \
     src/common/mdct.cpp \
     src/common/threads.cpp \
     src/common/thread.cpp \
+    src/common/threadpool.cpp \
+    src/common/framearena.cpp \
+    src/common/profiler.cpp \
     src/common/ustring.cpp \
     src/common/md5.cpp \
     src/common/blowfish.cpp \
@@ -109,22 +132,30 @@ src_common_libcommon_la_SOURCES += \
     src/common/encoding.cpp \
     src/common/platform.cpp \
     src/common/debugman.cpp \
+    src/common/logwriter.cpp \
+    src/common/fixedtimestep.cpp \
     src/common/debug.cpp \
     src/common/uuid.cpp \
     src/common/datetime.cpp \
     src/common/readstream.cpp \
     src/common/memreadstream.cpp \
+    src/common/memreader.cpp \
     src/common/writestream.cpp \
     src/common/memwritestream.cpp \
     src/common/streamtokenizer.cpp \
     src/common/stringmap.cpp \
     src/common/readline.cpp \
     src/common/readfile.cpp \
+    src/common/mappedfile.cpp \
+    src/common/pooledreadfile.cpp \
+    src/common/sharedreadstream.cpp \
     src/common/writefile.cpp \
     src/common/filepath.cpp \
     src/common/filelist.cpp \
+    src/common/dirsnapshot.cpp \
     src/common/huffman.cpp \
     src/common/boundingbox.cpp \
+    src/common/frustum.cpp \
     src/common/configfile.cpp \
     src/common/configman.cpp \
     src/common/foxpro.cpp \
@@ -136,6 +167,8 @@ src_common_libcommon_la_SOURCES += \
     src/common/rational.cpp \
     src/common/timestamp.cpp \
     src/common/aabbnode.cpp \
+    src/common/aabbtree.cpp \
+    src/common/occupancygrid.cpp \
     src/common/random.cpp \
     src/common/semaphore.cpp \
     src/common/serializationstream.cpp \
@@ -0,0 +1,186 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A read stream shared between several independent readers.
+ */
+
+#include <cassert>
+#include <cstring>
+
+#include "src/common/sharedreadstream.h"
+#include "src/common/readstream.h"
+#include "src/common/mappedfile.h"
+#include "src/common/error.h"
+#include "src/common/util.h"
+#include "src/common/ustring.h"
+#include "src/common/strutil.h"
+
+namespace Common {
+
+/** A part of a SharedReadStream, read through a small buffer. */
+class SharedSubReadStream : boost::noncopyable, public SeekableReadStream {
+public:
+	SharedSubReadStream(const std::shared_ptr<SharedReadStream> &parent, size_t begin, size_t size) :
+		_parent(parent), _begin(begin), _size(size), _pos(0), _eos(false), _bufferPos(0), _bufferSize(0) {
+
+	}
+
+	~SharedSubReadStream() {
+	}
+
+	size_t read(void *dataPtr, size_t dataSize);
+
+	bool eos() const {
+		return _eos;
+	}
+
+	size_t pos() const {
+		return _pos;
+	}
+
+	size_t size() const {
+		return _size;
+	}
+
+	size_t seek(ptrdiff_t offset, Origin whence = kOriginBegin);
+
+private:
+	/** Reads going through the buffer. Larger reads go to the parent directly. */
+	static const size_t kBufferSize = 4096;
+
+	std::shared_ptr<SharedReadStream> _parent;
+
+	size_t _begin;
+	size_t _size;
+	size_t _pos;
+
+	bool _eos;
+
+	byte _buffer[kBufferSize];
+	size_t _bufferPos;  ///< Position of the buffered data within this stream.
+	size_t _bufferSize; ///< Number of bytes in the buffer.
+};
+
+size_t SharedSubReadStream::read(void *dataPtr, size_t dataSize) {
+	assert(dataPtr);
+
+	// Read at most as many bytes as are still available...
+	if (dataSize > (_size - _pos)) {
+		dataSize = _size - _pos;
+		_eos = true;
+	}
+
+	byte  *data = static_cast<byte *>(dataPtr);
+	size_t done = 0;
+
+	while (done < dataSize) {
+		const size_t left = dataSize - done;
+
+		if ((_pos >= _bufferPos) && (_pos < (_bufferPos + _bufferSize))) {
+			const size_t n = MIN(left, _bufferPos + _bufferSize - _pos);
+
+			std::memcpy(data + done, _buffer + (_pos - _bufferPos), n);
+
+			_pos += n;
+			done += n;
+			continue;
+		}
+
+		if (left >= kBufferSize) {
+			const size_t n = _parent->readAt(_begin + _pos, data + done, left);
+
+			_pos += n;
+			done += n;
+
+			if (n < left)
+				_eos = true;
+
+			break;
+		}
+
+		_bufferPos  = _pos;
+		_bufferSize = _parent->readAt(_begin + _pos, _buffer, MIN(kBufferSize, _size - _pos));
+
+		if (_bufferSize == 0) {
+			_eos = true;
+			break;
+		}
+	}
+
+	return done;
+}
+
+size_t SharedSubReadStream::seek(ptrdiff_t offset, Origin whence) {
+	assert(_pos <= _size);
+
+	const size_t oldPos = _pos;
+	const size_t newPos = evalSeek(offset, whence, _pos, 0, size());
+	if (newPos > _size)
+		throw Exception(kSeekError);
+
+	_pos = newPos;
+
+	// Reset end-of-stream flag on a successful seek
+	_eos = false;
+
+	return oldPos;
+}
+
+
+SharedReadStream::SharedReadStream(SeekableReadStream *stream) : _stream(stream) {
+	assert(_stream);
+
+	_size = _stream->size();
+}
+
+SharedReadStream::~SharedReadStream() {
+}
+
+std::shared_ptr<SharedReadStream> SharedReadStream::create(SeekableReadStream *stream) {
+	return std::shared_ptr<SharedReadStream>(new SharedReadStream(stream));
+}
+
+size_t SharedReadStream::size() const {
+	return _size;
+}
+
+size_t SharedReadStream::readAt(size_t offset, void *dataPtr, size_t dataSize) {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_stream->seek(offset);
+
+	return _stream->read(dataPtr, dataSize);
+}
+
+SeekableReadStream *SharedReadStream::createSubStream(size_t offset, size_t size) {
+	if ((offset > _size) || (size > (_size - offset)))
+		throw Exception("Sub-stream out of range (%s + %s > %s)", composeString(offset).c_str(),
+		                composeString(size).c_str(), composeString(_size).c_str());
+
+	// A memory-mapped stream isn't changed by creating a view
+	SeekableReadStream *view = MappedReadStream::viewStream(*_stream, offset, size);
+	if (view)
+		return view;
+
+	return new SharedSubReadStream(shared_from_this(), offset, size);
+}
+
+} // End of namespace Common
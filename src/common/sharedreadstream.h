@@ -0,0 +1,81 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A read stream shared between several independent readers.
+ */
+
+#ifndef COMMON_SHAREDREADSTREAM_H
+#define COMMON_SHAREDREADSTREAM_H
+
+#include <cstddef>
+
+#include <memory>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/mutex.h"
+
+namespace Common {
+
+class SeekableReadStream;
+
+/** A SeekableReadStream several readers can get parts of.
+ *
+ *  Every part is a sub-stream with its own position. The sub-streams can be
+ *  read from different threads at the same time, and they keep the shared
+ *  stream alive for as long as any of them exists.
+ *
+ *  If the shared stream is memory-mapped, a sub-stream is a view into the
+ *  mapping. Otherwise, it reads through the shared stream, in small blocks,
+ *  and only ever touches its own part of the data.
+ */
+class SharedReadStream : boost::noncopyable, public std::enable_shared_from_this<SharedReadStream> {
+public:
+	/** Create a shared stream, taking over the ownership of this stream. */
+	static std::shared_ptr<SharedReadStream> create(SeekableReadStream *stream);
+
+	~SharedReadStream();
+
+	/** Return the size of the whole stream. */
+	size_t size() const;
+
+	/** Read data from this offset in the stream.
+	 *
+	 *  @return The number of bytes actually read.
+	 */
+	size_t readAt(size_t offset, void *dataPtr, size_t dataSize);
+
+	/** Create a new stream over the part [offset, offset + size) of the stream. */
+	SeekableReadStream *createSubStream(size_t offset, size_t size);
+
+private:
+	std::unique_ptr<SeekableReadStream> _stream;
+	size_t _size;
+
+	std::mutex _mutex;
+
+	SharedReadStream(SeekableReadStream *stream);
+};
+
+} // End of namespace Common
+
+#endif // COMMON_SHAREDREADSTREAM_H
@@ -19,7 +19,7 @@
  */
 
 /** @file
- *  Static sine tables.
+ *  Sine tables, computed on first use.
  */
 
 #ifndef COMMON_SINETABLES_H
@@ -19,7 +19,7 @@
  */
 
 /** @file
- *  Static sine windows.
+ *  Sine windows, computed on first use.
  */
 
 #ifndef COMMON_SINEWINDOWS_H
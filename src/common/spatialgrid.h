@@ -0,0 +1,254 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A uniform grid, for finding things by their position in the XY plane.
+ */
+
+#ifndef COMMON_SPATIALGRID_H
+#define COMMON_SPATIALGRID_H
+
+#include <cmath>
+#include <cstddef>
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+#include "src/common/types.h"
+#include "src/common/flathashmap.h"
+
+namespace Common {
+
+/** A sparse, uniform grid of square cells over the XY plane.
+ *
+ *  Every item covers an axis-aligned rectangle, and is listed in all the
+ *  cells that rectangle touches. Items that are only a point, like
+ *  creatures, are in exactly one cell. Only cells that contain something
+ *  are stored, so the grid has no fixed extent.
+ *
+ *  Queries call a visitor with every item in the cells they touch; the
+ *  visitor still has to check the exact position. The visitor returns true
+ *  to stop the query early, and the query then returns true as well. Items
+ *  covering several cells might be visited more than once by a query that
+ *  spans several cells.
+ *
+ *  Items need to be hashable and comparable, pointers work best.
+ */
+template<typename T>
+class SpatialGrid {
+public:
+	SpatialGrid(float cellSize) : _cellSize(cellSize) { }
+
+	float getCellSize() const { return _cellSize; }
+
+	bool empty() const { return _items.empty(); }
+	/** Return the number of items in the grid. */
+	size_t size() const { return _items.size(); }
+
+	bool contains(const T &item) const { return _items.contains(item); }
+
+	void clear() {
+		_cells.clear();
+		_items.clear();
+	}
+
+	/** Add an item at a point, or move it there if it is in the grid already. */
+	void update(const T &item, float x, float y) {
+		update(item, x, y, x, y);
+	}
+
+	/** Add an item covering a rectangle, or move it there if it is in the grid already. */
+	void update(const T &item, float minX, float minY, float maxX, float maxY) {
+		const CellRange range = getRange(minX, minY, maxX, maxY);
+
+		CellRange *current = _items.find(item);
+		if (current) {
+			if (*current == range)
+				return;
+
+			removeFromCells(item, *current);
+			*current = range;
+		} else
+			_items[item] = range;
+
+		addToCells(item, range);
+	}
+
+	/** Remove an item. Return false if it wasn't in the grid. */
+	bool remove(const T &item) {
+		const CellRange *current = _items.find(item);
+		if (!current)
+			return false;
+
+		removeFromCells(item, *current);
+		_items.erase(item);
+
+		return true;
+	}
+
+	/** Visit the items in the cell containing a point. */
+	template<typename Visitor>
+	bool visitPoint(float x, float y, Visitor visitor) const {
+		const std::vector<T> *cell = _cells.find(getKey(getCell(x), getCell(y)));
+		if (!cell)
+			return false;
+
+		for (typename std::vector<T>::const_iterator i = cell->begin(); i != cell->end(); ++i)
+			if (visitor(*i))
+				return true;
+
+		return false;
+	}
+
+	/** Visit the items in the cells touching a rectangle. */
+	template<typename Visitor>
+	bool visitBox(float minX, float minY, float maxX, float maxY, Visitor visitor) const {
+		const CellRange range = getRange(minX, minY, maxX, maxY);
+
+		const uint64_t cellCount = (uint64_t) (range.maxX - range.minX + 1) * (uint64_t) (range.maxY - range.minY + 1);
+
+		// When the rectangle is huge, it's cheaper to go over the cells that actually exist
+		if (cellCount > _cells.size()) {
+			for (typename CellMap::const_iterator c = _cells.begin(); c != _cells.end(); ++c) {
+				const int32_t cellX = (int32_t) (c->key >> 32);
+				const int32_t cellY = (int32_t) (c->key & 0xFFFFFFFF);
+
+				if ((cellX < range.minX) || (cellX > range.maxX) || (cellY < range.minY) || (cellY > range.maxY))
+					continue;
+
+				for (typename std::vector<T>::const_iterator i = c->value.begin(); i != c->value.end(); ++i)
+					if (visitor(*i))
+						return true;
+			}
+
+			return false;
+		}
+
+		for (int32_t cellY = range.minY; cellY <= range.maxY; cellY++) {
+			for (int32_t cellX = range.minX; cellX <= range.maxX; cellX++) {
+				const std::vector<T> *cell = _cells.find(getKey(cellX, cellY));
+				if (!cell)
+					continue;
+
+				for (typename std::vector<T>::const_iterator i = cell->begin(); i != cell->end(); ++i)
+					if (visitor(*i))
+						return true;
+			}
+		}
+
+		return false;
+	}
+
+	/** Visit the items in the cells touching a circle. */
+	template<typename Visitor>
+	bool visitRange(float x, float y, float radius, Visitor visitor) const {
+		return visitBox(x - radius, y - radius, x + radius, y + radius, visitor);
+	}
+
+private:
+	/** The cells an item is listed in. */
+	struct CellRange {
+		int32_t minX;
+		int32_t minY;
+		int32_t maxX;
+		int32_t maxY;
+
+		CellRange() : minX(0), minY(0), maxX(-1), maxY(-1) { }
+
+		bool operator==(const CellRange &range) const {
+			return (minX == range.minX) && (minY == range.minY) && (maxX == range.maxX) && (maxY == range.maxY);
+		}
+	};
+
+	/** Spread the bits of a cell key or an item hash over the whole word. */
+	static size_t mixBits(uint64_t x) {
+		x ^= x >> 33;
+		x *= UINT64_C(0xFF51AFD7ED558CCD);
+		x ^= x >> 33;
+
+		return (size_t) x;
+	}
+
+	struct CellHash {
+		size_t operator()(uint64_t key) const { return SpatialGrid::mixBits(key); }
+	};
+
+	struct ItemHash {
+		size_t operator()(const T &item) const { return SpatialGrid::mixBits(std::hash<T>()(item)); }
+	};
+
+	typedef FlatHashMap<uint64_t, std::vector<T>, CellHash> CellMap;
+
+	float _cellSize;
+
+	CellMap _cells;
+	FlatHashMap<T, CellRange, ItemHash> _items;
+
+	int32_t getCell(float coordinate) const {
+		return (int32_t) std::floor(coordinate / _cellSize);
+	}
+
+	CellRange getRange(float minX, float minY, float maxX, float maxY) const {
+		CellRange range;
+
+		range.minX = getCell(minX);
+		range.minY = getCell(minY);
+		range.maxX = getCell(maxX);
+		range.maxY = getCell(maxY);
+
+		return range;
+	}
+
+	static uint64_t getKey(int32_t cellX, int32_t cellY) {
+		return (((uint64_t) (uint32_t) cellX) << 32) | (uint64_t) (uint32_t) cellY;
+	}
+
+	void addToCells(const T &item, const CellRange &range) {
+		for (int32_t cellY = range.minY; cellY <= range.maxY; cellY++)
+			for (int32_t cellX = range.minX; cellX <= range.maxX; cellX++)
+				_cells[getKey(cellX, cellY)].push_back(item);
+	}
+
+	void removeFromCells(const T &item, const CellRange &range) {
+		for (int32_t cellY = range.minY; cellY <= range.maxY; cellY++) {
+			for (int32_t cellX = range.minX; cellX <= range.maxX; cellX++) {
+				const uint64_t key = getKey(cellX, cellY);
+
+				std::vector<T> *cell = _cells.find(key);
+				if (!cell)
+					continue;
+
+				typename std::vector<T>::iterator i = std::find(cell->begin(), cell->end(), item);
+				if (i != cell->end()) {
+					*i = cell->back();
+					cell->pop_back();
+				}
+
+				if (cell->empty())
+					_cells.erase(key);
+			}
+		}
+	}
+};
+
+} // End of namespace Common
+
+#endif // COMMON_SPATIALGRID_H
@@ -51,6 +51,8 @@
 
 namespace Common {
 
+static thread_local UString currentThreadName;
+
 Thread::Thread() : _killThread(false), _threadRunning(false) {
 }
 
@@ -71,10 +73,15 @@ bool Thread::createThread(const UString &name) {
 
 	_name = name;
 
+	/* Mark the thread as running before it actually starts. Otherwise, a
+	 * destroyThread() right after this would miss it and never stop it. */
+	_threadRunning.store(true, std::memory_order_seq_cst);
+
 	// Try to create the thread
 	try {
 		_thread = std::thread(threadHelper, static_cast<void *>(this));
 	} catch (const std::system_error &) {
+		_threadRunning.store(false, std::memory_order_seq_cst);
 		return false;
 	}
 
@@ -121,9 +128,6 @@ bool Thread::destroyThread() {
 int Thread::threadHelper(void *obj) {
 	Thread *thread = static_cast<Thread *>(obj);
 
-	// The thread is running.
-	thread->_threadRunning.store(true, std::memory_order_relaxed);
-
 	// Attempt to set the thread name
 	setCurrentThreadName(thread->_name);
 
@@ -170,6 +174,8 @@ void setCurrentThreadNameSEH(const Common::UString &name) {
 #endif
 
 void Thread::setCurrentThreadName(const Common::UString &name) {
+	currentThreadName = name;
+
 #if defined(__linux__)
 	// We need to fit into a 16 byte array
 	char buffer[16];
@@ -238,4 +244,8 @@ void Thread::setCurrentThreadName(const Common::UString &name) {
 #endif
 }
 
+const Common::UString &Thread::getCurrentThreadName() {
+	return currentThreadName;
+}
+
 } // End of namespace Common
@@ -56,6 +56,8 @@ public:
 	 * supports, it is truncated to fit.
 	 */
 	static void setCurrentThreadName(const Common::UString &name);
+	/** Return the name last set with setCurrentThreadName() on this thread. */
+	static const Common::UString &getCurrentThreadName();
 
 protected:
 	std::atomic<bool> _killThread;
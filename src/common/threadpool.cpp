@@ -0,0 +1,353 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A pool of worker threads for splitting up CPU-heavy work.
+ */
+
+#include <algorithm>
+
+#include "src/common/util.h"
+#include "src/common/threadpool.h"
+#include "src/common/thread.h"
+
+DECLARE_SINGLETON(Common::ThreadPool)
+
+namespace Common {
+
+/** The index of the pool thread we're running on, or SIZE_MAX if it isn't one. */
+static thread_local size_t tWorkerIndex = SIZE_MAX;
+
+struct ThreadPool::Task {
+	std::function<void()> func;
+
+	/** The number of unfinished dependencies, plus one while still being submitted. Guarded by _mutex. */
+	size_t unfinished;
+	bool done;                          ///< Has the task finished running? Guarded by _mutex.
+	std::exception_ptr error;           ///< The exception thrown by the task or a dependency. Guarded by _mutex.
+	std::vector<TaskHandle> dependents; ///< The tasks waiting for this one. Guarded by _mutex.
+
+	Task(std::function<void()> &&f) : func(std::move(f)), unfinished(1), done(false) {
+	}
+};
+
+ThreadPool::ThreadPool() : ThreadPool(MAX<size_t>(std::thread::hardware_concurrency(), 1) - 1) {
+}
+
+ThreadPool::ThreadPool(size_t threadCount) : _readyTasks(0), _taskWaiters(0), _quit(false) {
+	for (size_t i = 0; i <= threadCount; i++)
+		_taskQueues.emplace_back(std::make_unique<TaskQueue>());
+
+	for (size_t i = 0; i < threadCount; i++)
+		_threads.emplace_back(&ThreadPool::work, this, i);
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		_quit = true;
+	}
+
+	_wake.notify_all();
+
+	for (std::vector<std::thread>::iterator t = _threads.begin(); t != _threads.end(); ++t)
+		t->join();
+}
+
+size_t ThreadPool::getThreadCount() const {
+	return _threads.size() + 1;
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)> &func) {
+	if (count == 0)
+		return;
+
+	Job job;
+
+	job.func    = &func;
+	job.count   = count;
+	job.next    = 0;
+	job.workers = 0;
+
+	// Not worth waking anybody up for
+	if ((count == 1) || _threads.empty()) {
+		run(job);
+
+		if (job.error)
+			std::rethrow_exception(job.error);
+
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		_jobs.push_back(&job);
+	}
+
+	if (count == 2)
+		_wake.notify_one();
+	else
+		_wake.notify_all();
+
+	run(job);
+
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	// All indices are claimed now, so no new worker will pick this job up
+	std::deque<Job *>::iterator queued = std::find(_jobs.begin(), _jobs.end(), &job);
+	if (queued != _jobs.end())
+		_jobs.erase(queued);
+
+	_finished.wait(lock, [&job]() { return job.workers == 0; });
+
+	if (job.error)
+		std::rethrow_exception(job.error);
+}
+
+void ThreadPool::run(Job &job) {
+	for (size_t i = job.next++; i < job.count; i = job.next++) {
+		try {
+			(*job.func)(i);
+		} catch (...) {
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			if (!job.error)
+				job.error = std::current_exception();
+		}
+	}
+}
+
+void ThreadPool::work(size_t index) {
+	tWorkerIndex = index;
+
+	Thread::setCurrentThreadName(UString::format("Pool %u", (uint) index));
+
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	while (true) {
+		_wake.wait(lock, [this]() { return _quit || !_jobs.empty() || (_readyTasks > 0); });
+		if (_quit)
+			return;
+
+		// Somebody is blocked on a parallelFor(), so that goes first
+		if (_jobs.empty()) {
+			lock.unlock();
+
+			TaskHandle task = takeTask();
+			if (task)
+				execute(task);
+
+			lock.lock();
+			continue;
+		}
+
+		Job &job = *_jobs.front();
+
+		// Everything's been claimed already, the job just hasn't been removed yet
+		if (job.next >= job.count) {
+			_jobs.pop_front();
+			continue;
+		}
+
+		job.workers++;
+
+		lock.unlock();
+		run(job);
+		lock.lock();
+
+		if (--job.workers == 0)
+			_finished.notify_all();
+	}
+}
+
+ThreadPool::TaskHandle ThreadPool::submit(std::function<void()> func,
+                                          const std::vector<TaskHandle> &dependencies) {
+
+	TaskHandle task = std::make_shared<Task>(std::move(func));
+
+	bool ready;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		for (std::vector<TaskHandle>::const_iterator d = dependencies.begin(); d != dependencies.end(); ++d) {
+			if (!*d)
+				continue;
+
+			if ((*d)->done) {
+				if (!task->error)
+					task->error = (*d)->error;
+
+				continue;
+			}
+
+			(*d)->dependents.push_back(task);
+			task->unfinished++;
+		}
+
+		ready = --task->unfinished == 0;
+	}
+
+	if (ready)
+		schedule(task);
+
+	return task;
+}
+
+bool ThreadPool::isDone(const TaskHandle &task) {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return task->done;
+}
+
+void ThreadPool::wait(const TaskHandle &task) {
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	while (!task->done) {
+		lock.unlock();
+
+		// Make ourselves useful instead of just sleeping
+		TaskHandle other = takeTask();
+		if (other) {
+			execute(other);
+
+			lock.lock();
+			continue;
+		}
+
+		lock.lock();
+		if (task->done)
+			break;
+
+		_taskWaiters++;
+		_taskDone.wait(lock, [this, &task]() { return task->done || (_readyTasks > 0); });
+		_taskWaiters--;
+	}
+
+	if (task->error)
+		std::rethrow_exception(task->error);
+}
+
+void ThreadPool::wait(const std::vector<TaskHandle> &tasks) {
+	for (std::vector<TaskHandle>::const_iterator t = tasks.begin(); t != tasks.end(); ++t)
+		wait(*t);
+}
+
+void ThreadPool::schedule(TaskHandle task) {
+	// Nobody would ever pick it up from the queue
+	if (_threads.empty()) {
+		execute(task);
+		return;
+	}
+
+	const size_t index = MIN(tWorkerIndex, _threads.size());
+
+	bool waiters;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		std::lock_guard<std::mutex> queueLock(_taskQueues[index]->mutex);
+
+		_taskQueues[index]->tasks.push_back(std::move(task));
+		_readyTasks++;
+
+		waiters = _taskWaiters > 0;
+	}
+
+	_wake.notify_one();
+	if (waiters)
+		_taskDone.notify_all();
+}
+
+ThreadPool::TaskHandle ThreadPool::takeTask() {
+	if (_readyTasks == 0)
+		return TaskHandle();
+
+	const size_t index = MIN(tWorkerIndex, _threads.size());
+
+	for (size_t i = 0; i < _taskQueues.size(); i++) {
+		TaskQueue &queue = *_taskQueues[(index + i) % _taskQueues.size()];
+
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.tasks.empty())
+			continue;
+
+		TaskHandle task;
+
+		// Our own newest task is likely still warm in the cache. Steal the oldest from others
+		if (i == 0) {
+			task = std::move(queue.tasks.back());
+			queue.tasks.pop_back();
+		} else {
+			task = std::move(queue.tasks.front());
+			queue.tasks.pop_front();
+		}
+
+		_readyTasks--;
+		return task;
+	}
+
+	return TaskHandle();
+}
+
+void ThreadPool::execute(const TaskHandle &task) {
+	// Only dependencies set the error, and they've all finished by now
+	std::exception_ptr error = task->error;
+
+	if (!error) {
+		try {
+			task->func();
+		} catch (...) {
+			error = std::current_exception();
+		}
+	}
+
+	// Release anything the function holds on to
+	task->func = std::function<void()>();
+
+	std::vector<TaskHandle> ready;
+	bool waiters;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		task->error = error;
+		task->done  = true;
+
+		for (std::vector<TaskHandle>::iterator d = task->dependents.begin(); d != task->dependents.end(); ++d) {
+			if (error && !(*d)->error)
+				(*d)->error = error;
+
+			if (--(*d)->unfinished == 0)
+				ready.push_back(*d);
+		}
+
+		task->dependents.clear();
+
+		waiters = _taskWaiters > 0;
+	}
+
+	for (std::vector<TaskHandle>::iterator r = ready.begin(); r != ready.end(); ++r)
+		schedule(*r);
+
+	if (waiters)
+		_taskDone.notify_all();
+}
+
+} // End of namespace Common
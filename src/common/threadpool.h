@@ -0,0 +1,156 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A pool of worker threads for splitting up CPU-heavy work.
+ */
+
+#ifndef COMMON_THREADPOOL_H
+#define COMMON_THREADPOOL_H
+
+#include <cstddef>
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <atomic>
+#include <functional>
+#include <exception>
+
+#if defined(__MINGW32__ ) && !defined(_GLIBCXX_HAS_GTHREADS)
+	#include "external/mingw-std-threads/mingw.thread.h"
+#else
+	#include <thread>
+#endif
+
+#include "src/common/types.h"
+#include "src/common/singleton.h"
+#include "src/common/mutex.h"
+
+namespace Common {
+
+/** A pool of worker threads, shared by everything that wants to split up CPU-heavy work.
+ *
+ *  There's one worker thread less than there are hardware threads, since
+ *  the thread handing out work helps with it. That also means that work
+ *  can itself hand out more work without deadlocking the pool.
+ *
+ *  Besides parallelFor(), single tasks can be submitted, optionally depending
+ *  on the completion of other tasks. Every worker keeps its own queue of ready
+ *  tasks, taking the newest one from its own queue and stealing the oldest
+ *  from the others when it runs dry. Tasks submitted from outside the pool go
+ *  into a shared queue. Without any worker threads, for example on a
+ *  single-core machine, submitted tasks are run right away instead.
+ *
+ *  The pool is not created lazily in a thread-safe way, so it needs to be
+ *  instantiated before any threads using it are.
+ */
+class ThreadPool : public Singleton<ThreadPool> {
+public:
+	ThreadPool();
+	/** Create a pool with exactly this many worker threads, besides the calling one. */
+	explicit ThreadPool(size_t workerCount);
+	~ThreadPool();
+
+	/** Return the number of threads that work on a parallelFor(), including the calling one. */
+	size_t getThreadCount() const;
+
+	/** Call func(i) for all i in [0, count), spread over the pool.
+	 *
+	 *  Returns once all calls have finished. If any of the calls throws,
+	 *  the first exception is rethrown, but all other calls still run.
+	 */
+	void parallelFor(size_t count, const std::function<void(size_t)> &func);
+
+	struct Task;
+
+	/** A reference to a submitted task. */
+	typedef std::shared_ptr<Task> TaskHandle;
+
+	/** Queue func to be run on the pool, once all dependencies have finished.
+	 *
+	 *  If a dependency threw an exception, func is not called, and the
+	 *  exception is passed on to this task instead.
+	 */
+	TaskHandle submit(std::function<void()> func, const std::vector<TaskHandle> &dependencies = {});
+
+	/** Has this task finished running? */
+	bool isDone(const TaskHandle &task);
+
+	/** Wait for a task to finish, running other queued tasks in the meantime.
+	 *
+	 *  If the task threw, the exception is rethrown here.
+	 */
+	void wait(const TaskHandle &task);
+	/** Wait for all of these tasks to finish. */
+	void wait(const std::vector<TaskHandle> &tasks);
+
+private:
+	/** A parallelFor() currently in progress. */
+	struct Job {
+		const std::function<void(size_t)> *func;
+		size_t count;
+
+		std::atomic<size_t> next; ///< The next index to be claimed.
+		size_t workers;           ///< The number of pool threads working on this job. Guarded by _mutex.
+
+		std::exception_ptr error; ///< The first exception thrown. Guarded by _mutex.
+	};
+
+	/** The ready tasks of one thread. */
+	struct TaskQueue {
+		std::mutex mutex;
+		std::deque<TaskHandle> tasks;
+	};
+
+	std::vector<std::thread> _threads;
+
+	std::mutex _mutex;
+	std::condition_variable _wake;     ///< Signalled when new work arrives or the pool shuts down.
+	std::condition_variable _finished; ///< Signalled when a worker finished its part of a job.
+	std::condition_variable _taskDone; ///< Signalled when a task finished or became ready.
+
+	std::deque<Job *> _jobs;
+
+	/** One queue per worker thread, plus a shared one for all other threads. */
+	std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+
+	std::atomic<size_t> _readyTasks; ///< The number of tasks in all queues. Only increased under _mutex.
+	size_t _taskWaiters;             ///< The number of threads sleeping in wait(). Guarded by _mutex.
+
+	bool _quit;
+
+	void work(size_t index);
+	void run(Job &job);
+
+	/** Put a task whose dependencies have all finished into the calling thread's queue. */
+	void schedule(TaskHandle task);
+	/** Take a task from the calling thread's queue, or steal one from another. */
+	TaskHandle takeTask();
+	/** Run a task and release the tasks waiting on it. */
+	void execute(const TaskHandle &task);
+};
+
+} // End of namespace Common
+
+/** Shortcut for accessing the thread pool. */
+#define ThreadPoolMan Common::ThreadPool::instance()
+
+#endif // COMMON_THREADPOOL_H
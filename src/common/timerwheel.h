@@ -0,0 +1,341 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+/** @file
+ *  A hierarchical timer wheel, for scheduling delayed actions.
+ */
+
+#ifndef COMMON_TIMERWHEEL_H
+#define COMMON_TIMERWHEEL_H
+
+#include <vector>
+#include <utility>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+
+namespace Common {
+
+/** A hierarchical timer wheel.
+ *
+ *  Values are scheduled for a timestamp in milliseconds and collected in
+ *  batches once they're due. Scheduling and cancelling are O(1).
+ *
+ *  The wheel has four levels of 256 slots each. The first level has a
+ *  resolution of one millisecond; every following level covers 256 slots
+ *  of the level before it. Values in higher levels are cascaded down as
+ *  the time advances. Empty stretches of time are skipped over.
+ *
+ *  Values due at the same millisecond and scheduled at the same time are
+ *  collected in the order they were scheduled.
+ */
+template<typename T>
+class TimerWheel : boost::noncopyable {
+public:
+	/** A handle to a scheduled value, used for cancelling it. */
+	struct Handle {
+		uint32_t index;
+		uint32_t generation;
+
+		Handle() : index(kInvalid), generation(0) { }
+		Handle(uint32_t i, uint32_t g) : index(i), generation(g) { }
+	};
+
+	TimerWheel() : _current(0), _size(0), _freeList(kInvalid) {
+		clear();
+	}
+
+	bool empty() const { return _size == 0; }
+	size_t size() const { return _size; }
+
+	/** Remove all scheduled values. */
+	void clear() {
+		_nodes.clear();
+		_freeList = kInvalid;
+		_size = 0;
+
+		for (size_t i = 0; i < kLevels; i++) {
+			_count[i] = 0;
+
+			for (size_t j = 0; j < kSlots; j++)
+				_slots[i][j] = List(i);
+		}
+
+		_due = List(kLevels);
+	}
+
+	/** Schedule a value for this timestamp. */
+	Handle schedule(uint32_t timestamp, const T &value) {
+		const uint32_t index = allocateNode();
+
+		Node &node = _nodes[index];
+		node.value     = value;
+		node.timestamp = timestamp;
+
+		// The current millisecond has already been collected
+		if (static_cast<int32_t>(timestamp - _current) <= 0)
+			append(_due, index);
+		else
+			insert(index);
+
+		_size++;
+
+		return Handle(index, node.generation);
+	}
+
+	/** Cancel a scheduled value. Return false if it already fired or was cancelled. */
+	bool cancel(const Handle &handle) {
+		if ((handle.index >= _nodes.size()) || !_nodes[handle.index].list)
+			return false;
+
+		Node &node = _nodes[handle.index];
+		if (node.generation != handle.generation)
+			return false;
+
+		unlink(handle.index);
+		freeNode(handle.index);
+
+		_size--;
+		return true;
+	}
+
+	/** Return the earliest time at which advance() can find values that are due.
+	 *
+	 *  If values need to be cascaded down from higher levels first, this is
+	 *  the time of the cascade, which can be earlier than when the values are
+	 *  actually due. It is never later. Only meaningful if the wheel isn't empty.
+	 */
+	uint32_t getNextTimestamp() const {
+		if (_due.head != kInvalid)
+			return _current;
+
+		// Values in higher levels come down when the first level starts its next round
+		const uint32_t next = (_count[0] == _size) ? (_current + kSlots) : ((_current | kSlotMask) + 1);
+
+		if (_count[0] != 0)
+			for (uint32_t t = _current + 1; static_cast<int32_t>(next - t) > 0; t++)
+				if (_slots[0][t & kSlotMask].head != kInvalid)
+					return t;
+
+		return next;
+	}
+
+	/** Advance the time and append all values that are due by then to due, in timestamp order. */
+	void advance(uint32_t now, std::vector<T> &due) {
+		collect(_due, due);
+
+		while (static_cast<int32_t>(now - _current) > 0) {
+			if (_size == 0) {
+				_current = now;
+				break;
+			}
+
+			skipEmpty(now);
+			if (_current == now)
+				break;
+
+			_current++;
+
+			// Entering a new round of a level pulls the values of the next slot down from the level above
+			for (size_t level = 1; level < kLevels; level++) {
+				if ((_current & ((1U << (kSlotBits * level)) - 1)) != 0)
+					break;
+
+				cascade(level, (_current >> (kSlotBits * level)) & kSlotMask);
+			}
+
+			collect(_slots[0][_current & kSlotMask], due);
+		}
+	}
+
+private:
+	static const uint32_t kInvalid  = 0xFFFFFFFF;
+	static const size_t   kLevels   = 4;
+	static const size_t   kSlotBits = 8;
+	static const size_t   kSlots    = 1 << kSlotBits;
+	static const uint32_t kSlotMask = kSlots - 1;
+
+	/** A doubly-linked list of nodes. */
+	struct List {
+		uint32_t head;
+		uint32_t tail;
+
+		/** The level this list belongs to, or kLevels if it's not part of the wheel. */
+		size_t level;
+
+		List(size_t l = kLevels) : head(kInvalid), tail(kInvalid), level(l) { }
+	};
+
+	struct Node {
+		T value;
+		uint32_t timestamp;
+
+		uint32_t prev;
+		uint32_t next;
+
+		/** The list this node is in, or 0 if the node is unused. */
+		List *list;
+
+		/** Increased on every reuse of the node, to detect stale handles. */
+		uint32_t generation;
+
+		Node() : timestamp(0), prev(kInvalid), next(kInvalid), list(0), generation(0) { }
+	};
+
+	/** The time all values up to which have been collected. */
+	uint32_t _current;
+
+	std::vector<Node> _nodes;
+
+	size_t _size;
+	uint32_t _freeList;
+
+	List _slots[kLevels][kSlots];
+	size_t _count[kLevels];
+
+	/** Values that were already due when scheduled. */
+	List _due;
+
+	uint32_t allocateNode() {
+		if (_freeList == kInvalid) {
+			_nodes.push_back(Node());
+			return _nodes.size() - 1;
+		}
+
+		const uint32_t index = _freeList;
+		_freeList = _nodes[index].next;
+
+		return index;
+	}
+
+	void freeNode(uint32_t index) {
+		Node &node = _nodes[index];
+
+		node.value = T();
+		node.list  = 0;
+		node.prev  = kInvalid;
+		node.next  = _freeList;
+		node.generation++;
+
+		_freeList = index;
+	}
+
+	/** Put a node into the slot of its timestamp, which must not be in the past. */
+	void insert(uint32_t index) {
+		const uint32_t timestamp = _nodes[index].timestamp;
+		const uint32_t delta     = timestamp - _current;
+
+		size_t level = 0;
+		while ((level < (kLevels - 1)) && (delta >= (1U << (kSlotBits * (level + 1)))))
+			level++;
+
+		append(_slots[level][(timestamp >> (kSlotBits * level)) & kSlotMask], index);
+	}
+
+	void append(List &list, uint32_t index) {
+		Node &node = _nodes[index];
+
+		node.list = &list;
+		node.prev = list.tail;
+		node.next = kInvalid;
+
+		if (list.tail != kInvalid)
+			_nodes[list.tail].next = index;
+		else
+			list.head = index;
+
+		list.tail = index;
+
+		if (list.level < kLevels)
+			_count[list.level]++;
+	}
+
+	void unlink(uint32_t index) {
+		Node &node = _nodes[index];
+		List &list = *node.list;
+
+		if (node.prev != kInvalid)
+			_nodes[node.prev].next = node.next;
+		else
+			list.head = node.next;
+
+		if (node.next != kInvalid)
+			_nodes[node.next].prev = node.prev;
+		else
+			list.tail = node.prev;
+
+		if (list.level < kLevels)
+			_count[list.level]--;
+
+		node.list = 0;
+	}
+
+	/** Move all values of this list into due. */
+	void collect(List &list, std::vector<T> &due) {
+		while (list.head != kInvalid) {
+			const uint32_t index = list.head;
+
+			unlink(index);
+
+			due.push_back(std::move(_nodes[index].value));
+			freeNode(index);
+
+			_size--;
+		}
+	}
+
+	/** Redistribute the values of a slot into the lower levels. */
+	void cascade(size_t level, uint32_t slot) {
+		uint32_t index = _slots[level][slot].head;
+		_slots[level][slot] = List(level);
+
+		while (index != kInvalid) {
+			const uint32_t next = _nodes[index].next;
+
+			_count[level]--;
+			insert(index);
+
+			index = next;
+		}
+	}
+
+	/** Jump over stretches of time in which no value can be due, without crossing a cascade. */
+	void skipEmpty(uint32_t now) {
+		for (size_t level = 0; level < (kLevels - 1); level++) {
+			if (_count[level] != 0)
+				break;
+
+			const uint32_t roundEnd = _current | ((1U << (kSlotBits * (level + 1))) - 1);
+			if (static_cast<int32_t>(roundEnd - _current) <= 0)
+				break;
+
+			if (static_cast<int32_t>(now - roundEnd) <= 0) {
+				_current = now;
+				return;
+			}
+
+			_current = roundEnd;
+		}
+	}
+};
+
+} // End of namespace Common
+
+#endif // COMMON_TIMERWHEEL_H
@@ -27,6 +27,8 @@
 #include <cctype>
 #include <cstring>
 
+#include <utility>
+
 #include <boost/algorithm/string/replace.hpp>
 
 #include "src/common/ustring.h"
@@ -35,23 +37,42 @@
 
 namespace Common {
 
+/* Since bytes of ASCII characters never appear within other characters in
+ * UTF-8, and case folding only touches ASCII characters, strings can be folded
+ * and compared byte by byte, without decoding them. Comparing UTF-8 bytes as
+ * unsigned values also orders the strings by their characters. */
+
+static inline byte toLowerASCII(byte c) {
+	return ((c >= 'A') && (c <= 'Z')) ? (c + ('a' - 'A')) : c;
+}
+
+static inline byte toUpperASCII(byte c) {
+	return ((c >= 'a') && (c <= 'z')) ? (c - ('a' - 'A')) : c;
+}
+
 UString::UString() : _size(0) {
 }
 
-UString::UString(const UString &str) {
-	*this = str;
+UString::UString(const UString &str) : _string(str._string), _size(str._size.load(std::memory_order_relaxed)) {
+}
+
+UString::UString(UString &&str) noexcept : _string(std::move(str._string)),
+	_size(str._size.load(std::memory_order_relaxed)) {
+
+	str._string.clear();
+	str._size.store(0, std::memory_order_relaxed);
+}
+
+UString::UString(const std::string &str) : _string(str), _size(kSizeUnknown) {
 }
 
-UString::UString(const std::string &str) {
-	*this = str;
+UString::UString(std::string &&str) : _string(std::move(str)), _size(kSizeUnknown) {
 }
 
-UString::UString(const char *str) {
-	*this = str;
+UString::UString(const char *str) : _string(str), _size(kSizeUnknown) {
 }
 
-UString::UString(const char *str, size_t n) {
-	*this = std::string(str, n);
+UString::UString(const char *str, size_t n) : _string(str, n), _size(kSizeUnknown) {
 }
 
 UString::UString(uint32_t c, size_t n) : _size(0) {
@@ -69,7 +90,20 @@ UString::~UString() {
 
 UString &UString::operator=(const UString &str) {
 	_string = str._string;
-	_size   = str._size;
+	_size.store(str._size.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+	return *this;
+}
+
+UString &UString::operator=(UString &&str) noexcept {
+	if (&str == this)
+		return *this;
+
+	_string = std::move(str._string);
+	_size.store(str._size.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+	str._string.clear();
+	str._size.store(0, std::memory_order_relaxed);
 
 	return *this;
 }
@@ -77,13 +111,15 @@ UString &UString::operator=(const UString &str) {
 UString &UString::operator=(const std::string &str) {
 	_string = str;
 
-	recalculateSize();
+	invalidateSize();
 
 	return *this;
 }
 
 UString &UString::operator=(const char *str) {
-	*this = std::string(str);
+	_string = str;
+
+	invalidateSize();
 
 	return *this;
 }
@@ -138,21 +174,32 @@ UString UString::operator+(uint32_t c) const {
 
 UString &UString::operator+=(const UString &str) {
 	_string += str._string;
-	_size   += str._size;
+
+	const size_t mySize  = _size.load(std::memory_order_relaxed);
+	const size_t strSize = str._size.load(std::memory_order_relaxed);
+
+	if ((mySize != kSizeUnknown) && (strSize != kSizeUnknown))
+		_size.store(mySize + strSize, std::memory_order_relaxed);
+	else
+		invalidateSize();
 
 	return *this;
 }
 
 UString &UString::operator+=(const std::string &str) {
-	UString ustr(str);
+	_string += str;
 
-	return *this += ustr;
+	invalidateSize();
+
+	return *this;
 }
 
 UString &UString::operator+=(const char *str) {
-	UString ustr(str);
+	_string += str;
 
-	return *this += ustr;
+	invalidateSize();
+
+	return *this;
 }
 
 UString &UString::operator+=(uint32_t c) {
@@ -163,69 +210,48 @@ UString &UString::operator+=(uint32_t c) {
 		throw e;
 	}
 
-	_size++;
+	const size_t size = _size.load(std::memory_order_relaxed);
+	if (size != kSizeUnknown)
+		_size.store(size + 1, std::memory_order_relaxed);
 
 	return *this;
 }
 
 int UString::strcmp(const UString &str) const {
-	try {
-		UString::iterator it1 = begin();
-		UString::iterator it2 = str.begin();
-		for (; (it1 != end()) && (it2 != str.end()); ++it1, ++it2) {
-			const uint32_t c1 = *it1;
-			const uint32_t c2 = *it2;
-
-			if (c1 < c2)
-				return -1;
-			if (c1 > c2)
-				return  1;
-		}
-
-		if ((it1 == end()) && (it2 == str.end()))
-			return 0;
+	const int cmp = _string.compare(str._string);
 
-		if (it1 == end())
-			return -1;
-
-	} catch (...) {
-	}
-
-	return 1;
+	return (cmp < 0) ? -1 : ((cmp > 0) ? 1 : 0);
 }
 
 int UString::stricmp(const UString &str) const {
-	try {
-		UString::iterator it1 = begin();
-		UString::iterator it2 = str.begin();
-		for (; (it1 != end()) && (it2 != str.end()); ++it1, ++it2) {
-			const uint32_t c1 = toLower(*it1);
-			const uint32_t c2 = toLower(*it2);
-
-			if (c1 < c2)
-				return -1;
-			if (c1 > c2)
-				return  1;
-		}
+	const byte *s1 = reinterpret_cast<const byte *>(_string.data());
+	const byte *s2 = reinterpret_cast<const byte *>(str._string.data());
 
-		if ((it1 == end()) && (it2 == str.end()))
-			return 0;
+	const size_t size1 = _string.size();
+	const size_t size2 = str._string.size();
 
-		if (it1 == end())
-			return -1;
+	for (size_t i = 0; (i < size1) && (i < size2); i++) {
+		const byte c1 = toLowerASCII(s1[i]);
+		const byte c2 = toLowerASCII(s2[i]);
 
-	} catch (...) {
+		if (c1 < c2)
+			return -1;
+		if (c1 > c2)
+			return  1;
 	}
 
-	return 1;
+	if (size1 == size2)
+		return 0;
+
+	return (size1 < size2) ? -1 : 1;
 }
 
 bool UString::equals(const UString &str) const {
-	return strcmp(str) == 0;
+	return _string == str._string;
 }
 
 bool UString::equalsIgnoreCase(const UString &str) const {
-	return stricmp(str) == 0;
+	return (_string.size() == str._string.size()) && (stricmp(str) == 0);
 }
 
 bool UString::less(const UString &str) const {
@@ -239,16 +265,31 @@ bool UString::lessIgnoreCase(const UString &str) const {
 void UString::swap(UString &str) {
 	_string.swap(str._string);
 
-	std::swap(_size, str._size);
+	const size_t size = _size.load(std::memory_order_relaxed);
+	_size.store(str._size.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	str._size.store(size, std::memory_order_relaxed);
 }
 
 void UString::clear() {
 	_string.clear();
-	_size = 0;
+	_size.store(0, std::memory_order_relaxed);
 }
 
 size_t UString::size() const {
-	return _size;
+	size_t size = _size.load(std::memory_order_relaxed);
+	if (size != kSizeUnknown)
+		return size;
+
+	try {
+		// Calculate the "distance" in characters from the beginning and end
+		size = utf8::distance(_string.begin(), _string.end());
+	} catch (const std::exception &se) {
+		Exception e(se);
+		throw e;
+	}
+
+	_size.store(size, std::memory_order_relaxed);
+	return size;
 }
 
 bool UString::empty() const {
@@ -359,7 +400,7 @@ void UString::truncate(const iterator &it) {
 }
 
 void UString::truncate(size_t n) {
-	if (n >= _size)
+	if (n >= size())
 		return;
 
 	UString temp;
@@ -398,7 +439,7 @@ void UString::trim() {
 			break;
 
 	_string = std::string(itStart.base(), itEnd.base());
-	recalculateSize();
+	invalidateSize();
 }
 
 void UString::trimLeft() {
@@ -413,7 +454,7 @@ void UString::trimLeft() {
 			break;
 
 	_string = std::string(itStart.base(), end().base());
-	recalculateSize();
+	invalidateSize();
 }
 
 void UString::trimRight() {
@@ -438,7 +479,7 @@ void UString::trimRight() {
 	}
 
 	_string = std::string(begin().base(), itEnd.base());
-	recalculateSize();
+	invalidateSize();
 }
 
 void UString::replaceAll(uint32_t what, uint32_t with) {
@@ -477,32 +518,32 @@ void UString::replaceAll(uint32_t what, uint32_t with) {
 
 void UString::replaceAll(const UString &what, const UString &with) {
 	boost::replace_all(_string, what._string, with._string);
+
+	invalidateSize();
 }
 
 void UString::makeLower() {
-	*this = toLower();
+	for (std::string::iterator c = _string.begin(); c != _string.end(); ++c)
+		*c = toLowerASCII(*c);
 }
 
 void UString::makeUpper() {
-	*this = toUpper();
+	for (std::string::iterator c = _string.begin(); c != _string.end(); ++c)
+		*c = toUpperASCII(*c);
 }
 
 UString UString::toLower() const {
-	UString str;
+	UString str(*this);
 
-	str._string.reserve(_string.size());
-	for (iterator it = begin(); it != end(); ++it)
-		str += toLower(*it);
+	str.makeLower();
 
 	return str;
 }
 
 UString UString::toUpper() const {
-	UString str;
+	UString str(*this);
 
-	str._string.reserve(_string.size());
-	for (iterator it = begin(); it != end(); ++it)
-		str += toUpper(*it);
+	str.makeUpper();
 
 	return str;
 }
@@ -762,14 +803,8 @@ size_t UString::split(const UString &text, uint32_t delim, std::vector<UString>
 	return length;
 }
 
-void UString::recalculateSize() {
-	try {
-		// Calculate the "distance" in characters from the beginning and end
-		_size = utf8::distance(_string.begin(), _string.end());
-	} catch (const std::exception &se) {
-		Exception e(se);
-		throw e;
-	}
+void UString::invalidateSize() {
+	_size.store(kSizeUnknown, std::memory_order_relaxed);
 }
 
 // NOTE: If we ever need uppercase<->lowercase mappings for non-ASCII
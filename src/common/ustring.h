@@ -28,6 +28,7 @@
 #include <string>
 #include <sstream>
 #include <vector>
+#include <atomic>
 
 #include "src/common/types.h"
 #include "src/common/system.h"
@@ -65,8 +66,12 @@ public:
 	UString();
 	/** Copy constructor. */
 	UString(const UString &str);
+	/** Move constructor. */
+	UString(UString &&str) noexcept;
 	/** Construct UString from an UTF-8 string. */
 	UString(const std::string &str);
+	/** Construct UString from an UTF-8 string, taking over its data. */
+	UString(std::string &&str);
 	/** Construct UString from an UTF-8 string. */
 	UString(const char *str);
 	/** Construct UString from the first n bytes of an UTF-8 string. */
@@ -78,6 +83,7 @@ public:
 	~UString();
 
 	UString &operator=(const UString &str);
+	UString &operator=(UString &&str) noexcept;
 	UString &operator=(const std::string &str);
 	UString &operator=(const char *str);
 
@@ -198,11 +204,16 @@ public:
 	static uint32_t fromUTF16(uint16_t c);
 
 private:
+	static const size_t kSizeUnknown = SIZE_MAX;
+
 	std::string _string; ///< Internal string holding the actual data.
 
-	size_t _size;
+	/** The number of characters, counted on demand. Only the data is shared
+	 *  between threads, so a race here just counts the same size twice. */
+	mutable std::atomic<size_t> _size;
 
-	void recalculateSize();
+	/** Forget the number of characters, after changing the data. */
+	void invalidateSize();
 };
 
 
@@ -218,12 +229,16 @@ static inline UString operator+(const char *left, const UString &right) {
 
 // Hash functions
 
+/* These hash the UTF-8 bytes instead of the decoded characters. Case folding
+ * only touches ASCII characters, and in UTF-8, bytes of ASCII characters never
+ * appear within other characters, so they can be folded byte by byte. */
+
 struct hashUStringCaseSensitive {
 	size_t operator()(const UString &str) const {
 		size_t seed = 5381;
 
-		for (UString::iterator it = str.begin(); it != str.end(); ++it)
-			seed = ((seed << 5) + seed) + *it;
+		for (const byte *s = reinterpret_cast<const byte *>(str.c_str()); *s; s++)
+			seed = ((seed << 5) + seed) + *s;
 
 		return seed;
 	}
@@ -233,8 +248,8 @@ struct hashUStringCaseInsensitive {
 	size_t operator()(const UString &str) const {
 		size_t seed = 5381;
 
-		for (UString::iterator it = str.begin(); it != str.end(); ++it)
-			seed = ((seed << 5) + seed) + UString::toLower(*it);
+		for (const byte *s = reinterpret_cast<const byte *>(str.c_str()); *s; s++)
+			seed = ((seed << 5) + seed) + (((*s >= 'A') && (*s <= 'Z')) ? (*s + 'a' - 'A') : *s);
 
 		return seed;
 	}
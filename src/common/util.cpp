@@ -101,6 +101,9 @@ void info(const char *s, ...) {
 	DebugMan.logString(buf);
 	DebugMan.logString("!\n");
 
+	// Make sure the log file has everything before we quit
+	DebugMan.closeLogFile();
+
 	std::exit(1);
 }
 
@@ -250,3 +253,51 @@ float readIEEEFloat16(uint16_t value) {
 	return convertIEEEFloat(fS | fE | fM);
 }
 // '--- Convert IEEE float16 to IEEE float32, based on code by James Tursa ---'
+
+uint16_t writeIEEEFloat16(float value) {
+	const uint32_t f = convertIEEEFloat(value);
+
+	const uint16_t vS = (f >> 16) & 0x8000; // float16 sign
+	const uint32_t fE = (f >> 23) & 0xFF;   // float32 exponent
+	const uint32_t fM = f & 0x007FFFFF;     // float32 mantissa
+
+	// Inf / -Inf and NaN
+	if (fE == 0xFF)
+		return vS | 0x7C00 | ((fM != 0) ? 0x0200 : 0x0000);
+
+	// Rebias the exponent
+	const int32_t vE = ((int32_t) fE) - 127 + 15;
+
+	// Too large for a float16: Inf / -Inf
+	if (vE >= 0x1F)
+		return vS | 0x7C00;
+
+	if (vE <= 0) {
+		// Too small even for a denormalized float16: 0.0 / -0.0
+		if (vE < -10)
+			return vS;
+
+		// Denormalized float16, shift the mantissa (with its implicit 1) into place
+		const uint32_t m     = fM | 0x00800000;
+		const uint32_t shift = 14 - vE;
+
+		uint32_t vM = m >> shift;
+
+		// Round to nearest, ties to even
+		const uint32_t rest = m & ((1 << shift) - 1);
+		const uint32_t half = 1 << (shift - 1);
+		if ((rest > half) || ((rest == half) && (vM & 1)))
+			vM++;
+
+		return vS | (uint16_t) vM;
+	}
+
+	uint32_t v = (((uint32_t) vE) << 10) | (fM >> 13);
+
+	// Round to nearest, ties to even. A carry into the exponent is correct, up to Inf
+	const uint32_t rest = fM & 0x1FFF;
+	if ((rest > 0x1000) || ((rest == 0x1000) && (v & 1)))
+		v++;
+
+	return vS | (uint16_t) v;
+}
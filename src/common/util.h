@@ -205,5 +205,7 @@ double readNintendoFixedPoint(uint32_t value, bool sign, uint8_t iBits, uint8_t
 
 /** Read a half-precision 16-bit IEEE float, converting it into a 32-bit iEEE float. */
 float readIEEEFloat16(uint16_t value);
+/** Convert a 32-bit IEEE float into a half-precision 16-bit IEEE float, rounding to nearest even. */
+uint16_t writeIEEEFloat16(float value);
 
 #endif // COMMON_UTIL_H
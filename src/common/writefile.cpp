@@ -25,11 +25,14 @@
 #include <cassert>
 #include <cstddef>
 
+#include <boost/filesystem.hpp>
+
 #include "src/common/writefile.h"
 #include "src/common/error.h"
 #include "src/common/ustring.h"
 #include "src/common/platform.h"
 #include "src/common/filepath.h"
+#include "src/common/uuid.h"
 
 namespace Common {
 
@@ -123,4 +126,30 @@ size_t WriteFile::seek(ptrdiff_t offset, SeekableWriteStream::Origin whence) {
 	return oldPos;
 }
 
+void writeFileAtomically(const UString &fileName, const std::function<void(WriteStream &)> &write) {
+	const UString tempFileName = fileName + "." + generateIDRandomString();
+
+	try {
+		{
+			WriteFile file(tempFileName);
+
+			write(file);
+			file.close();
+		}
+
+		// Replaces an existing file atomically, even if someone else wrote it in the meantime
+		boost::system::error_code ec;
+		boost::filesystem::rename(tempFileName.c_str(), fileName.c_str(), ec);
+		if (ec)
+			throw Exception("Can't rename \"%s\" to \"%s\": %s", tempFileName.c_str(),
+			                fileName.c_str(), ec.message().c_str());
+
+	} catch (...) {
+		boost::system::error_code ec;
+		boost::filesystem::remove(tempFileName.c_str(), ec);
+
+		throw;
+	}
+}
+
 } // End of namespace Common
@@ -28,6 +28,8 @@
 #include <cstdio>
 #include <cstddef>
 
+#include <functional>
+
 #include <boost/noncopyable.hpp>
 
 #include "src/common/types.h"
@@ -79,6 +81,17 @@ protected:
 	size_t _size;
 };
 
+/** Write a file through a temporary file, replacing an existing one in a single step.
+ *
+ *  The data is written into a temporary file next to fileName, which is then
+ *  renamed over it. Anybody reading fileName at the same time sees either the
+ *  old or the complete new file, never a half-written one.
+ *
+ *  If write() throws or the file can't be replaced, the temporary file is
+ *  removed and the exception is passed on.
+ */
+void writeFileAtomically(const UString &fileName, const std::function<void(WriteStream &)> &write);
+
 } // End of namespace Common
 
 #endif // COMMON_WRITEFILE_H
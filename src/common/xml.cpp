@@ -28,6 +28,7 @@
 
 #include <libxml/parser.h>
 #include <libxml/xmlerror.h>
+#include <libxml/xmlreader.h>
 
 #include <boost/scope_exit.hpp>
 
@@ -52,6 +53,16 @@ static void errorFuncUString(void *ctx, const char *msg, ...) {
 	*str += buf;
 }
 
+static void errorFuncReader(void *ctx, const char *msg, xmlParserSeverities UNUSED(severity),
+                            xmlTextReaderLocatorPtr UNUSED(locator)) {
+
+	UString *str = static_cast<UString *>(ctx);
+	assert(str);
+
+	if (msg)
+		*str += msg;
+}
+
 static int readStream(void *context, char *buffer, int len) {
 	ReadStream *stream = static_cast<ReadStream *>(context);
 	if (!stream)
@@ -178,4 +189,184 @@ void XMLNode::load(_xmlNode &node, bool makeLower) {
 	}
 }
 
+
+
+XMLReader::XMLReader(ReadStream &stream, bool makeLower, const UString &fileName) : _reader(0),
+	_makeLower(makeLower), _fileName(fileName), _type(kNodeNone), _depth(0),
+	_isEmpty(false), _onNextNode(false), _hasProperties(false) {
+
+	const int options = XML_PARSE_NOWARNING | XML_PARSE_NOBLANKS | XML_PARSE_NONET |
+	                    XML_PARSE_NSCLEAN   | XML_PARSE_NOCDATA;
+
+	_reader = xmlReaderForIO(readStream, closeStream, static_cast<void *>(&stream),
+	                         _fileName.c_str(), 0, options);
+	if (!_reader)
+		throw Exception("Failed to create an XML reader for \"%s\"", _fileName.c_str());
+
+	xmlTextReaderSetErrorHandler(_reader, errorFuncReader, static_cast<void *>(&_parseError));
+}
+
+XMLReader::~XMLReader() {
+	if (_reader)
+		xmlFreeTextReader(_reader);
+}
+
+void XMLReader::throwParseError() const {
+	Exception e;
+
+	if (!_parseError.empty())
+		e.add("%s", _parseError.c_str());
+
+	e.add("XML document \"%s\" failed to parse", _fileName.c_str());
+	throw e;
+}
+
+bool XMLReader::next() {
+	_hasProperties = false;
+	_properties.clear();
+
+	// An empty element still gets its end
+	if ((_type == kNodeElementStart) && _isEmpty) {
+		_type    = kNodeElementEnd;
+		_isEmpty = false;
+		_content.clear();
+
+		return true;
+	}
+
+	while (true) {
+		int result = 1;
+		if (!_onNextNode)
+			result = xmlTextReaderRead(_reader);
+
+		_onNextNode = false;
+
+		if (result < 0)
+			throwParseError();
+
+		if (result == 0) {
+			_type = kNodeNone;
+			_name.clear();
+			_content.clear();
+
+			return false;
+		}
+
+		const int type = xmlTextReaderNodeType(_reader);
+		if ((type != XML_READER_TYPE_ELEMENT) && (type != XML_READER_TYPE_END_ELEMENT) &&
+		    (type != XML_READER_TYPE_TEXT) && (type != XML_READER_TYPE_CDATA))
+			continue;
+
+		readNode();
+		return true;
+	}
+}
+
+void XMLReader::readNode() {
+	const int type = xmlTextReaderNodeType(_reader);
+
+	_depth   = MAX(xmlTextReaderDepth(_reader), 0);
+	_isEmpty = false;
+
+	_content.clear();
+
+	if ((type == XML_READER_TYPE_TEXT) || (type == XML_READER_TYPE_CDATA)) {
+		const xmlChar *value = xmlTextReaderConstValue(_reader);
+
+		_type    = kNodeText;
+		_content = value ? reinterpret_cast<const char *>(value) : "";
+
+		return;
+	}
+
+	const xmlChar *name = xmlTextReaderConstLocalName(_reader);
+
+	_type = (type == XML_READER_TYPE_ELEMENT) ? kNodeElementStart : kNodeElementEnd;
+	_name = name ? reinterpret_cast<const char *>(name) : "";
+
+	if (_makeLower)
+		_name.makeLower();
+
+	if (_type == kNodeElementStart)
+		_isEmpty = xmlTextReaderIsEmptyElement(_reader) == 1;
+}
+
+void XMLReader::skip() {
+	if (_type != kNodeElementStart)
+		return;
+
+	// An empty element has nothing more to skip, not even its end
+	if (_isEmpty) {
+		_type    = kNodeElementEnd;
+		_isEmpty = false;
+		return;
+	}
+
+	// Move past the element's end, onto its next sibling or the parent's end
+	const int result = xmlTextReaderNext(_reader);
+	if (result < 0)
+		throwParseError();
+
+	_type       = kNodeElementEnd;
+	_onNextNode = result == 1;
+
+	if (result == 1) {
+		// xmlTextReaderNext() doesn't filter out the nodes we're not interested in
+		const int type = xmlTextReaderNodeType(_reader);
+		if ((type != XML_READER_TYPE_ELEMENT) && (type != XML_READER_TYPE_END_ELEMENT) &&
+		    (type != XML_READER_TYPE_TEXT) && (type != XML_READER_TYPE_CDATA))
+			_onNextNode = false;
+	}
+}
+
+XMLReader::NodeType XMLReader::getType() const {
+	return _type;
+}
+
+size_t XMLReader::getDepth() const {
+	return _depth;
+}
+
+const UString &XMLReader::getName() const {
+	return _name;
+}
+
+const UString &XMLReader::getContent() const {
+	return _content;
+}
+
+const XMLNode::Properties &XMLReader::getProperties() const {
+	if (_hasProperties || (_type != kNodeElementStart))
+		return _properties;
+
+	_hasProperties = true;
+
+	while (xmlTextReaderMoveToNextAttribute(_reader) == 1) {
+		const xmlChar *attribName  = xmlTextReaderConstLocalName(_reader);
+		const xmlChar *attribValue = xmlTextReaderConstValue(_reader);
+
+		UString name (attribName  ? reinterpret_cast<const char *>(attribName)  : "");
+		UString value(attribValue ? reinterpret_cast<const char *>(attribValue) : "");
+
+		if (_makeLower)
+			name.makeLower();
+
+		_properties.insert(std::make_pair(name, value));
+	}
+
+	xmlTextReaderMoveToElement(_reader);
+
+	return _properties;
+}
+
+UString XMLReader::getProperty(const UString &name, const UString &def) const {
+	const XMLNode::Properties &properties = getProperties();
+
+	XMLNode::Properties::const_iterator property = properties.find(name);
+	if (property != properties.end())
+		return property->second;
+
+	return def;
+}
+
 } // End of namespace Common
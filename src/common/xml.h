@@ -40,6 +40,7 @@
 #include "src/common/ustring.h"
 
 struct _xmlNode;
+struct _xmlTextReader;
 
 namespace Common {
 
@@ -118,6 +119,88 @@ private:
 	friend class XMLParser;
 };
 
+/** Class to read an XML file out of a ReadStream, one node at a time.
+ *
+ *  In contrast to the XMLParser, no tree of the whole document is ever built,
+ *  neither by us nor by libxml2. Instead, the document is walked through in
+ *  order, element starts, texts and element ends alike, and the caller picks
+ *  out what it needs. Empty elements still produce an element end.
+ *
+ *  Properties of an element are only collected when asked for.
+ */
+class XMLReader : boost::noncopyable {
+public:
+	enum NodeType {
+		kNodeNone,         ///< Not on a node, before the start or after the end of the document.
+		kNodeElementStart, ///< The start of an element.
+		kNodeElementEnd,   ///< The end of an element.
+		kNodeText          ///< Text inside an element.
+	};
+
+	/** Start reading an XML file out of a stream.
+	 *
+	 *  @param stream The stream to read the XML from.
+	 *  @param makeLower Should all tags be converted to lowercase, to ease case-insensitive comparison?
+	 *  @param fileName The file name to tell libxml2. Only used for error reporting.
+	 */
+	XMLReader(ReadStream &stream, bool makeLower = false, const UString &fileName = "stream.xml");
+	~XMLReader();
+
+	/** Move on to the next node.
+	 *
+	 *  Throws if the document fails to parse.
+	 *
+	 *  @return false if the end of the document was reached.
+	 */
+	bool next();
+
+	/** Skip the rest of the current element, including all its children.
+	 *
+	 *  The next call to next() moves to whatever follows the element's end.
+	 */
+	void skip();
+
+	/** Return the type of the current node. */
+	NodeType getType() const;
+
+	/** Return the depth of the current node. The root element is at depth 0. */
+	size_t getDepth() const;
+
+	/** Return the name of the current element. */
+	const UString &getName() const;
+	/** Return the text of the current text node. */
+	const UString &getContent() const;
+
+	/** Return all the properties on the current element. */
+	const XMLNode::Properties &getProperties() const;
+	/** Return a certain property on the current element. */
+	UString getProperty(const UString &name, const UString &def = "") const;
+
+private:
+	_xmlTextReader *_reader;
+
+	bool _makeLower;
+
+	UString _fileName;
+	UString _parseError;
+
+	NodeType _type;
+	size_t _depth;
+
+	UString _name;
+	UString _content;
+
+	bool _isEmpty;    ///< Is the current element empty, i.e. does an element end need to follow?
+	bool _onNextNode; ///< Is libxml2 already on the node next() should return?
+
+	mutable bool _hasProperties;
+	mutable XMLNode::Properties _properties;
+
+	void readNode();
+
+	void throwParseError() const;
+};
+
 } // End of namespace Common
 
 #endif // ENABLE_XML
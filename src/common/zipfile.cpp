@@ -27,17 +27,23 @@
 #include "src/common/zipfile.h"
 #include "src/common/error.h"
 #include "src/common/util.h"
+#include "src/common/endianness.h"
 #include "src/common/strutil.h"
 #include "src/common/encoding.h"
 #include "src/common/memreadstream.h"
+#include "src/common/mappedfile.h"
 #include "src/common/deflate.h"
 
 namespace Common {
 
-ZipFile::ZipFile(SeekableReadStream *zip) : _zip(zip) {
+ZipFile::ZipFile(SeekableReadStream *zip) : _zip(zip), _mapped(0) {
 	assert(_zip);
 
 	load(*_zip);
+
+	_mapped = dynamic_cast<const MappedReadStream *>(_zip.get());
+	if (_mapped)
+		resolveMappedFiles();
 }
 
 ZipFile::~ZipFile() {
@@ -77,9 +83,15 @@ void ZipFile::load(SeekableReadStream &zip) {
 		 File  file;
 		IFile iFile;
 
-		zip.skip(20);
+		zip.skip(6);
+
+		iFile.compMethod = zip.readUint16LE();
+
+		zip.skip(8);
 
-		iFile.size = zip.readUint32LE();
+		iFile.compSize = zip.readUint32LE();
+		iFile.size     = zip.readUint32LE();
+		iFile.dataOffset = SIZE_MAX;
 
 		uint16_t nameLength    = zip.readUint16LE();
 		uint16_t extraLength   = zip.readUint16LE();
@@ -118,6 +130,29 @@ void ZipFile::load(SeekableReadStream &zip) {
 	}
 }
 
+void ZipFile::resolveMappedFiles() {
+	const byte  *data = _mapped->getData();
+	const size_t size = _mapped->size();
+
+	for (IFileList::iterator file = _iFiles.begin(); file != _iFiles.end(); ++file) {
+		if ((file->offset > size) || ((size - file->offset) < 30))
+			throw Exception("ZIP local file header out of range");
+
+		const byte *header = data + file->offset;
+
+		const uint32_t tag = READ_LE_UINT32(header);
+		if (tag != 0x04034B50)
+			throw Exception("Unknown ZIP record %08X", tag);
+
+		const uint16_t nameLength  = READ_LE_UINT16(header + 26);
+		const uint16_t extraLength = READ_LE_UINT16(header + 28);
+
+		file->dataOffset = file->offset + 30 + nameLength + extraLength;
+		if ((file->dataOffset > size) || ((size - file->dataOffset) < file->compSize))
+			throw Exception("ZIP file data out of range");
+	}
+}
+
 const ZipFile::FileList &ZipFile::getFiles() const {
 	return _files;
 }
@@ -158,9 +193,31 @@ size_t ZipFile::getFileSize(uint32_t index) const {
 	return getIFile(index).size;
 }
 
+bool ZipFile::isFileCompressed(uint32_t index) const {
+	return getIFile(index).compMethod != 0;
+}
+
+bool ZipFile::isMapped() const {
+	return _mapped != 0;
+}
+
 SeekableReadStream *ZipFile::getFile(uint32_t index, bool tryNoCopy) const {
 	const IFile &file = getIFile(index);
 
+	if (_mapped) {
+		// Stored files are just views into the mapping
+		if (file.compMethod == 0)
+			return _mapped->viewStream(file.dataOffset, file.compSize);
+
+		if (file.compMethod != 8)
+			throw Exception("Unhandled Zip compression %d", file.compMethod);
+
+		byte *data = decompressDeflate(_mapped->getData() + file.dataOffset, file.compSize,
+		                               file.size, kWindowBitsMaxRaw);
+
+		return new MemoryReadStream(data, file.size, true);
+	}
+
 	uint16_t compMethod;
 	uint32_t compSize;
 	uint32_t realSize;
@@ -38,8 +38,16 @@
 namespace Common {
 
 class SeekableReadStream;
+class MappedReadStream;
 
-/** A class encapsulating ZIP file access. */
+/** A class encapsulating ZIP file access.
+ *
+ *  If the ZIP is read from a MappedReadStream, all file data offsets are
+ *  resolved when opening it. Stored files are then returned as views into
+ *  the mapping and deflated files are inflated straight out of it, without
+ *  touching the ZIP stream. This also makes getFile() safe to call from
+ *  several threads at once.
+ */
 class ZipFile : boost::noncopyable {
 public:
 	/** A file. */
@@ -59,20 +67,34 @@ public:
 	/** Return the size of a file. */
 	size_t getFileSize(uint32_t index) const;
 
+	/** Does getting this file need to inflate it? */
+	bool isFileCompressed(uint32_t index) const;
+
+	/** Is the ZIP memory-mapped, and can getFile() be called concurrently? */
+	bool isMapped() const;
+
 	/** Return a stream of the file's contents. */
 	SeekableReadStream *getFile(uint32_t index, bool tryNoCopy = false) const;
 
 private:
 	/** Internal file information. */
 	struct IFile {
-		uint32_t offset; ///< The offset of the file within the ZIP.
-		uint32_t size;   ///< The file's size.
+		uint32_t offset;     ///< The offset of the file within the ZIP.
+		uint32_t size;       ///< The file's size.
+		uint32_t compSize;   ///< The file's compressed size.
+		uint16_t compMethod; ///< The file's compression method.
+
+		/** The offset of the file's data within a mapped ZIP. */
+		size_t dataOffset;
 	};
 
 	typedef std::vector<IFile> IFileList;
 
 	std::unique_ptr<SeekableReadStream> _zip;
 
+	/** The ZIP stream, if it's memory-mapped. */
+	const MappedReadStream *_mapped;
+
 	/** External list of file names and types. */
 	FileList _files;
 
@@ -80,6 +102,8 @@ private:
 	IFileList _iFiles;
 
 	void load(SeekableReadStream &zip);
+	/** Find the data of all files within the mapping. */
+	void resolveMappedFiles();
 
 	static SeekableReadStream *decompressFile(SeekableReadStream &zip, uint32_t method,
 			uint32_t compSize, uint32_t realSize);
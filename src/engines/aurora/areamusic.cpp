@@ -0,0 +1,149 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  The background music of an area, with prefetched tracks and crossfades.
+ */
+
+#include "src/common/error.h"
+#include "src/common/debug.h"
+
+#include "src/sound/sound.h"
+#include "src/sound/audiostream.h"
+
+#include "src/engines/aurora/areamusic.h"
+
+namespace Engines {
+
+/** How long switching between two tracks takes, in milliseconds. */
+static const uint32_t kCrossfadeTime = 2000;
+
+/** How many tracks can be prefetched at the same time. */
+static const size_t kMaxPrefetched = 3;
+
+AreaMusic::AreaMusic() {
+}
+
+AreaMusic::~AreaMusic() {
+	try {
+		clear();
+	} catch (...) {
+	}
+}
+
+void AreaMusic::prefetch(const Common::UString &music) {
+	if (music.empty() || (music == _current) || (_prefetched.find(music) != _prefetched.end()))
+		return;
+
+	// Make room by dropping one of the older prefetched tracks
+	if (_prefetched.size() >= kMaxPrefetched)
+		_prefetched.erase(_prefetched.begin());
+
+	try {
+		std::unique_ptr<Sound::AudioStream> stream(SoundMan.prefetchSoundResource(music, Aurora::kResourceMusic, true));
+		if (!stream)
+			return;
+
+		debugC(Common::kDebugEngineSound, 1, "Prefetched music \"%s\"", music.c_str());
+
+		_prefetched[music] = std::move(stream);
+
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed to prefetch music \"%s\"", music.c_str());
+	}
+}
+
+Sound::AudioStream *AreaMusic::takeTrack(const Common::UString &music) {
+	Prefetched::iterator p = _prefetched.find(music);
+	if (p == _prefetched.end())
+		return SoundMan.prefetchSoundResource(music, Aurora::kResourceMusic, true);
+
+	Sound::AudioStream *stream = p->second.release();
+	_prefetched.erase(p);
+
+	return stream;
+}
+
+void AreaMusic::play(const Common::UString &music) {
+	if (music.empty()) {
+		stop();
+		return;
+	}
+
+	if ((music == _current) && SoundMan.isPlaying(_channel))
+		return;
+
+	// Anything still fading out from an earlier switch can go now
+	SoundMan.stopChannel(_fadingOut);
+
+	Sound::ChannelHandle channel;
+
+	try {
+		Sound::AudioStream *stream = takeTrack(music);
+		if (!stream) {
+			stop();
+			return;
+		}
+
+		channel = SoundMan.playAudioStream(stream, Sound::kSoundTypeMusic);
+
+		if (SoundMan.isPlaying(_channel)) {
+			// Crossfade from the current track
+
+			SoundMan.setChannelGain(channel, 0.0f);
+			SoundMan.fadeChannel(channel, 1.0f, kCrossfadeTime);
+			SoundMan.fadeChannel(_channel, 0.0f, kCrossfadeTime, true);
+
+			_fadingOut = _channel;
+
+		} else
+			SoundMan.stopChannel(_channel);
+
+		SoundMan.startChannel(channel);
+
+		debugC(Common::kDebugEngineSound, 1, "Playing music \"%s\" in %s",
+		       music.c_str(), SoundMan.formatChannel(channel).c_str());
+
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed to play music \"%s\"", music.c_str());
+	}
+
+	_channel = channel;
+	_current = SoundMan.isValidChannel(_channel) ? music : "";
+}
+
+void AreaMusic::stop() {
+	SoundMan.stopChannel(_fadingOut);
+	SoundMan.stopChannel(_channel);
+
+	_current.clear();
+}
+
+void AreaMusic::clear() {
+	stop();
+
+	_prefetched.clear();
+}
+
+const Common::UString &AreaMusic::getCurrent() const {
+	return _current;
+}
+
+} // End of namespace Engines
@@ -0,0 +1,89 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  The background music of an area, with prefetched tracks and crossfades.
+ */
+
+#ifndef ENGINES_AURORA_AREAMUSIC_H
+#define ENGINES_AURORA_AREAMUSIC_H
+
+#include <map>
+#include <memory>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/ustring.h"
+
+#include "src/sound/types.h"
+
+namespace Sound {
+	class AudioStream;
+}
+
+namespace Engines {
+
+/** The background music of an area.
+ *
+ *  The tracks an area is likely to switch to, like its battle music, can be
+ *  prefetched: they're opened and decoded ahead of time, so that switching
+ *  to them doesn't cause a gap or a decoding spike. Switching from one track
+ *  to another crossfades between the two.
+ */
+class AreaMusic : boost::noncopyable {
+public:
+	AreaMusic();
+	~AreaMusic();
+
+	/** Open a music track and start decoding it, so that it's ready when played. */
+	void prefetch(const Common::UString &music);
+
+	/** Play a music track, crossfading from the one currently playing.
+	 *
+	 *  If this track is already playing, nothing changes.
+	 */
+	void play(const Common::UString &music);
+
+	/** Stop the music immediately. */
+	void stop();
+
+	/** Stop the music and drop all prefetched tracks. */
+	void clear();
+
+	/** Return the name of the track currently playing, or "" if none. */
+	const Common::UString &getCurrent() const;
+
+private:
+	typedef std::map<Common::UString, std::unique_ptr<Sound::AudioStream> > Prefetched;
+
+	Common::UString      _current;   ///< The name of the track currently playing.
+	Sound::ChannelHandle _channel;   ///< The channel of the track currently playing.
+	Sound::ChannelHandle _fadingOut; ///< The channel of the track being faded out.
+
+	/** Tracks opened and being decoded ahead of time. */
+	Prefetched _prefetched;
+
+	/** Take a prefetched track, or open it now if it wasn't. */
+	Sound::AudioStream *takeTrack(const Common::UString &music);
+};
+
+} // End of namespace Engines
+
+#endif // ENGINES_AURORA_AREAMUSIC_H
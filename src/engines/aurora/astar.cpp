@@ -25,23 +25,26 @@
 #include <algorithm>
 
 #include "src/common/util.h"
+#include "src/common/debugman.h"
 
 #include "src/engines/aurora/pathfinding.h"
 #include "src/engines/aurora/astar.h"
 
 namespace Engines {
 
-AStar::AStar(Engines::Pathfinding* pathfinding) : _pathfinding(pathfinding) {
+AStar::AStar(Engines::Pathfinding* pathfinding) : _pathfinding(pathfinding), _search(0) {
 }
 
 AStar::~AStar() {
 }
 
-AStar::Node::Node(): face(UINT32_MAX), x(0.f), y(0.f), parent(UINT32_MAX), G(0.f), H(0.f) {
+AStar::Node::Node(): face(UINT32_MAX), x(0.f), y(0.f), parent(UINT32_MAX), G(0.f), H(0.f),
+	search(0), heapIndex(UINT32_MAX), closed(false) {
 }
 
 AStar::Node::Node(uint32_t faceID, float pX, float pY, uint32_t parentNode):
-face(faceID), x(pX), y(pY), parent(parentNode), G(0.f), H(0.f) {
+face(faceID), x(pX), y(pY), parent(parentNode), G(0.f), H(0.f),
+	search(0), heapIndex(UINT32_MAX), closed(false) {
 }
 
 bool AStar::Node::operator<(const Node &node) const {
@@ -69,38 +72,38 @@ bool AStar::findPath(float startX, float startY, float endX, float endY,
 	}
 
 	// Init nodes and lists.
-	Node startNode = Node(startFace, startX, startY);
-	Node endNode   = Node(endFace, endX, endY);
+	startSearch();
 
+	Node endNode = Node(endFace, endX, endY);
+
+	Node &startNode = getNode(startFace, startX, startY);
 	startNode.G = 0.f;
 	startNode.H = getHeuristic(startNode, endNode);
 	// Get track of the closest node near the end in case of the unavailable path.
-	Node closestToEnd = startNode;
+	uint32_t closestToEnd = startFace;
 
-	std::vector<Node> openList;
-	std::vector<Node> closedList;
-	openList.push_back(startNode);
+	pushOpen(startNode);
 
 	// Searching...
 	for (uint32_t it = 0; it < maxIteration; ++it) {
-		if (openList.empty())
+		if (_openList.empty())
 			break;
 
-		Node current = openList.front();
+		Node &current = popOpen();
+		Common::DebugManager::addMetric(Common::kMetricPathNodesExpanded);
 
 		if (current.face == endNode.face) {
-			reconstructPath(current, closedList, facePath);
+			reconstructPath(current, facePath);
 			return true;
 		}
 
-		openList.erase(openList.begin());
-		closedList.push_back(current);
+		current.closed = true;
 
-		std::vector<uint32_t> adjFaces;
-		_pathfinding->getAdjacentFaces(current.face, current.parent, adjFaces);
-		for (std::vector<uint32_t>::iterator a = adjFaces.begin(); a != adjFaces.end(); ++a) {
+		_pathfinding->getAdjacentFaces(current.face, current.parent, _adjFaces);
+		for (std::vector<uint32_t>::const_iterator a = _adjFaces.begin(); a != _adjFaces.end(); ++a) {
 			// Check if it has been already evaluated.
-			if (hasNode(*a, closedList))
+			const bool isThere = hasNode(*a);
+			if (isThere && _nodes[*a].closed)
 				continue;
 
 			// Check if the creature can go through to the adjacent face.
@@ -112,31 +115,25 @@ bool AStar::findPath(float startX, float startY, float endX, float endY,
 			float gScore = current.G + getGValue(current, *a, x, y);
 
 			// Check if it is a new node.
-			Node *adjNode = getNode(*a, openList);
-			bool isThere = adjNode != 0;
-			if (!isThere) {
-				adjNode = new Node(*a, x, y);
-				adjNode->parent = current.face;
-			} else if (gScore >= adjNode->G) {
+			if (isThere && gScore >= _nodes[*a].G)
 				continue;
-			}
 
 			// adjNode is the best node up to now, update/add.
-			adjNode->parent = current.face;
-			adjNode->G = gScore;
-			adjNode->H = getHeuristic(*adjNode, endNode);
-			if (adjNode->H < closestToEnd.H)
-				closestToEnd = *adjNode;
-			if (!isThere) {
-				openList.push_back(*adjNode);
-				delete adjNode;
-			}
-
-			std::sort(openList.begin(), openList.end());
+			Node &adjNode = getNode(*a, x, y);
+			adjNode.parent = current.face;
+			adjNode.G = gScore;
+			adjNode.H = getHeuristic(adjNode, endNode);
+			if (adjNode.H < _nodes[closestToEnd].H)
+				closestToEnd = adjNode.face;
+
+			if (isThere)
+				siftUp(adjNode.heapIndex);
+			else
+				pushOpen(adjNode);
 		}
 	}
 
-	reconstructPath(closestToEnd, closedList, facePath);
+	reconstructPath(_nodes[closestToEnd], facePath);
 	return false;
 }
 
@@ -150,47 +147,119 @@ float AStar::getHeuristic(Node &node, Node &endNode) const {
 	return getEuclideanDistance(node.x,node.y, endNode.x,endNode.y);
 }
 
-AStar::Node *AStar::getNode(uint32_t face, std::vector<Node> &nodes) const {
-	for (std::vector<Node>::iterator n = nodes.begin(); n != nodes.end(); ++n) {
-		if ((*n).face == face) {
-			return &(*n);
-		}
+float AStar::getEuclideanDistance(float xA, float yA, float xB, float yB) const {
+	return sqrt(pow(xA - xB, 2.f) + pow(yA - yB, 2.f));
+}
+
+void AStar::startSearch() {
+	// The walkmesh might have grown since the last search
+	if (_nodes.size() < _pathfinding->_facesCount)
+		_nodes.resize(_pathfinding->_facesCount);
+
+	// Instead of resetting all nodes, we just ignore the ones from earlier searches
+	if (++_search == 0) {
+		for (std::vector<Node>::iterator n = _nodes.begin(); n != _nodes.end(); ++n)
+			n->search = 0;
+
+		_search = 1;
 	}
 
-	return 0;
+	_openList.clear();
 }
 
-bool AStar::hasNode(uint32_t face, std::vector<Node> &nodes) const {
-	for (std::vector<Node>::iterator n = nodes.begin(); n != nodes.end(); ++n) {
-		if ((*n).face == face) {
-			return true;
-		}
+AStar::Node &AStar::getNode(uint32_t face, float x, float y) {
+	Node &node = _nodes[face];
+
+	if (node.search != _search) {
+		node = Node(face, x, y);
+		node.search = _search;
 	}
 
-	return false;
+	return node;
 }
 
-float AStar::getEuclideanDistance(float xA, float yA, float xB, float yB) const {
-	return sqrt(pow(xA - xB, 2.f) + pow(yA - yB, 2.f));
+bool AStar::hasNode(uint32_t face) const {
+	return _nodes[face].search == _search;
 }
 
-void AStar::reconstructPath(Node &endNode, std::vector<Node> &closedList, std::vector<uint32_t> &path) {
-	Node &cNode = endNode;
-	path.push_back(endNode.face);
-	path.push_back(endNode.parent);
+void AStar::pushOpen(Node &node) {
+	node.heapIndex = _openList.size();
+	_openList.push_back(node.face);
 
-	while (cNode.parent != UINT32_MAX) {
-		for (std::vector<Node>::iterator n = closedList.begin(); n != closedList.end(); ++n) {
-			if (cNode.parent != (*n).face)
-				continue;
+	siftUp(node.heapIndex);
+}
+
+AStar::Node &AStar::popOpen() {
+	Node &top = _nodes[_openList.front()];
+
+	_openList.front() = _openList.back();
+	_nodes[_openList.front()].heapIndex = 0;
+	_openList.pop_back();
+
+	if (!_openList.empty())
+		siftDown(0);
+
+	top.heapIndex = UINT32_MAX;
+	return top;
+}
 
-			cNode = (*n);
-			if (cNode.parent != UINT32_MAX)
-				path.push_back(cNode.parent);
+void AStar::siftUp(uint32_t index) {
+	const uint32_t face = _openList[index];
 
+	while (index > 0) {
+		const uint32_t parent = (index - 1) / kHeapArity;
+		if (!(_nodes[face] < _nodes[_openList[parent]]))
 			break;
-		}
+
+		_openList[index] = _openList[parent];
+		_nodes[_openList[index]].heapIndex = index;
+
+		index = parent;
 	}
+
+	_openList[index] = face;
+	_nodes[face].heapIndex = index;
+}
+
+void AStar::siftDown(uint32_t index) {
+	const uint32_t face = _openList[index];
+	const uint32_t size = _openList.size();
+
+	for (;;) {
+		const uint32_t first = index * kHeapArity + 1;
+		if (first >= size)
+			break;
+
+		// Find the child with the lowest cost
+		const uint32_t last = MIN<uint32_t>(first + kHeapArity, size);
+
+		uint32_t best = first;
+		for (uint32_t child = first + 1; child < last; child++)
+			if (_nodes[_openList[child]] < _nodes[_openList[best]])
+				best = child;
+
+		if (!(_nodes[_openList[best]] < _nodes[face]))
+			break;
+
+		_openList[index] = _openList[best];
+		_nodes[_openList[index]].heapIndex = index;
+
+		index = best;
+	}
+
+	_openList[index] = face;
+	_nodes[face].heapIndex = index;
+}
+
+void AStar::reconstructPath(const Node &endNode, std::vector<uint32_t> &path) const {
+	const Node *cNode = &endNode;
+	path.push_back(cNode->face);
+
+	while (cNode->parent != UINT32_MAX) {
+		cNode = &_nodes[cNode->parent];
+		path.push_back(cNode->face);
+	}
+
 	std::reverse(path.begin(), path.end());
 }
 
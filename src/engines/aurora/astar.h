@@ -70,6 +70,10 @@ protected:
 		float G; //< Cost value (from the starting node to this node).
 		float H; ///< Heuristic value (estimation cost from this node to the ending point).
 
+		uint32_t search;    ///< The search this node was last visited in.
+		uint32_t heapIndex; ///< Position in the open list, UINT32_MAX if not in it.
+		bool closed;        ///< Has this node been evaluated already?
+
 		Node();
 		Node(uint32_t faceID, float pX, float pY, uint32_t parentNode = UINT32_MAX);
 		/** Compare the distance between two nodes. */
@@ -93,16 +97,40 @@ protected:
 	/** Compute the euclidean distance (usual distance) between two points in th XY plan. */
 	float getEuclideanDistance(float xA, float yA, float xB, float yB) const;
 
-	/** Find a node in a vector of nodes. */
-	Node *getNode(uint32_t face, std::vector<Node> &nodes) const;
-	/** Check if a vector of nodes contains a specific node. */
-	bool hasNode(uint32_t face, std::vector<Node> &nodes) const;
-
 	Pathfinding *_pathfinding; ///< Pathfinding object that contains the walkmesh.
 
 private:
-	/** Reconstruct the path of faces from the closed list and the end node. */
-	void reconstructPath(Node &endNode, std::vector<Node> &closedList, std::vector<uint32_t> &path);
+	/** Number of children of a node in the open list heap. */
+	static const uint32_t kHeapArity = 4;
+
+	/** All nodes, indexed by face. Only valid where their search is _search. */
+	std::vector<Node> _nodes;
+	/** The open list, a heap of faces with the lowest G + H on top. */
+	std::vector<uint32_t> _openList;
+	/** Buffer for the adjacent faces of the node being evaluated. */
+	std::vector<uint32_t> _adjFaces;
+
+	/** The number of the current search. */
+	uint32_t _search;
+
+	/** Start a new search, invalidating all nodes. */
+	void startSearch();
+	/** Get the node of a face, resetting it if it's not part of the current search. */
+	Node &getNode(uint32_t face, float x = 0.f, float y = 0.f);
+	/** Was the node of this face visited in the current search? */
+	bool hasNode(uint32_t face) const;
+
+	/** Add a node to the open list. */
+	void pushOpen(Node &node);
+	/** Remove the node with the lowest G + H from the open list. */
+	Node &popOpen();
+	/** Move a node within the open list after its G + H got lower. */
+	void siftUp(uint32_t index);
+	/** Move a node within the open list after the node above it was removed. */
+	void siftDown(uint32_t index);
+
+	/** Reconstruct the path of faces from the end node, following the parents. */
+	void reconstructPath(const Node &endNode, std::vector<uint32_t> &path) const;
 };
 
 } // End of namespace Engines
@@ -36,9 +36,13 @@
 #include "src/common/filepath.h"
 #include "src/common/readline.h"
 #include "src/common/configman.h"
+#include "src/common/profiler.h"
 
 #include "src/aurora/resman.h"
 #include "src/aurora/talkman.h"
+#include "src/aurora/2dareg.h"
+
+#include "src/aurora/nwscript/profiler.h"
 
 #include "src/graphics/graphics.h"
 #include "src/graphics/font.h"
@@ -79,7 +83,8 @@ ConsoleWindow::ConsoleWindow(const Common::UString &font, size_t lines, size_t h
                              int fontHeight) :
 	Graphics::GUIElement(Graphics::GUIElement::kGUIElementConsole),
 	_font(FontMan.get(font, fontHeight)), _historySizeMax(history),
-	_historySizeCurrent(0), _historyStart(0), _cursorPosition(0),
+	_historySizeCurrent(0), _historyCount(0), _history(history), _historyStart(0),
+	_linesTop(0), _linesBottom(0), _linesValid(false), _cursorPosition(0),
 	_overwrite(false), _cursorBlinkState(false), _lastCursorBlink(0) {
 
 	assert(lines >= 2);
@@ -154,10 +159,6 @@ ConsoleWindow::~ConsoleWindow() {
 void ConsoleWindow::show() {
 	GfxMan.lockFrame();
 
-	for (std::vector<Graphics::Aurora::Text *>::iterator l = _lines.begin();
-	     l != _lines.end(); ++l)
-		(*l)->show();
-
 	_highlight->show();
 	_cursor->show();
 	_prompt->show();
@@ -171,10 +172,6 @@ void ConsoleWindow::show() {
 void ConsoleWindow::hide() {
 	GfxMan.lockFrame();
 
-	for (std::vector<Graphics::Aurora::Text *>::iterator l = _lines.begin();
-	     l != _lines.end(); ++l)
-		(*l)->hide();
-
 	_highlight->hide();
 	_cursor->hide();
 	_prompt->hide();
@@ -280,7 +277,9 @@ void ConsoleWindow::setInput(const Common::UString &input, size_t cursorPos,
 void ConsoleWindow::clear() {
 	GfxMan.lockFrame();
 
-	_history.clear();
+	for (std::vector<Common::UString>::iterator h = _history.begin(); h != _history.end(); ++h)
+		h->clear();
+
 	_historySizeCurrent = 0;
 
 	_historyStart = 0;
@@ -288,9 +287,9 @@ void ConsoleWindow::clear() {
 	updateScrollbarLength();
 	updateScrollbarPosition();
 
-	for (std::vector<Graphics::Aurora::Text *>::iterator l = _lines.begin();
-	     l != _lines.end(); ++l)
-		(*l)->setText("");
+	_linesValid = false;
+	redrawLines();
+
 	GfxMan.unlockFrame();
 }
 
@@ -315,10 +314,10 @@ void ConsoleWindow::printLine(const Common::UString &line) {
 		_logFile.flush();
 	}
 
-	_history.push_back(line);
-	if (_historySizeCurrent >= _historySizeMax)
-		_history.pop_front();
-	else
+	_history[_historyCount % _historySizeMax] = line;
+	_historyCount++;
+
+	if (_historySizeCurrent < _historySizeMax)
 		_historySizeCurrent++;
 
 	updateScrollbarLength();
@@ -424,7 +423,7 @@ void ConsoleWindow::highlightClip(size_t &x, size_t &y) const {
 		maxX = _prompt->get().size() + _input->get().size();
 	} else {
 		minX = 0;
-		maxX = _lines[_lines.size() - y]->get().size();
+		maxX = getLine(_lines.size() - y).get().size();
 	}
 
 	x = CLIP(x, minX, maxX);
@@ -472,7 +471,7 @@ void ConsoleWindow::highlightWord(int x, int y) {
 	highlightClip(wX, wY);
 
 	const Common::UString &line = (wY == 0) ? _input->get() :
-	                                          _lines[_lines.size() - wY]->get();
+	                                          getLine(_lines.size() - wY).get();
 	const size_t pos = (wY == 0) ? (wX - _prompt->get().size()) : wX;
 
 	size_t wordStart = findWordStart(line, pos);
@@ -498,7 +497,7 @@ void ConsoleWindow::highlightLine(int x, int y) {
 	highlightClip(_highlightX, _highlightY);
 
 	const Common::UString &line = (_highlightY == 0) ?
-		_input->get() : _lines[_lines.size() - _highlightY]->get();
+		_input->get() : getLine(_lines.size() - _highlightY).get();
 	_highlightLength = line.size();
 
 	updateHighlight();
@@ -528,7 +527,7 @@ Common::UString ConsoleWindow::getHighlight() const {
 		end   = end   - _prompt->get().size();
 		line  = _input->get();
 	} else
-		line = _lines[_lines.size() - _highlightY]->get();
+		line = getLine(_lines.size() - _highlightY).get();
 
 	start = MAX<ptrdiff_t>(0, start);
 	end   = MAX<ptrdiff_t>(0, end  );
@@ -636,6 +635,16 @@ void ConsoleWindow::render(Graphics::RenderPass pass) {
 	glEnd();
 
 	glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+
+	// Lines
+	for (size_t i = 0; i < _lines.size(); i++) {
+		glPushMatrix();
+		glTranslatef(roundf(_x), roundf(getLineY(i)), 0.0f);
+
+		getLine(i).render(pass);
+
+		glPopMatrix();
+	}
 }
 
 void ConsoleWindow::renderImmediate(const glm::mat4 &parentTransform) {
@@ -667,6 +676,9 @@ void ConsoleWindow::renderImmediate(const glm::mat4 &parentTransform) {
 	_shaderRenderableBottomEdge.renderImmediate(bottomEdgeTransform);
 	_shaderRenderableScrollBackground.renderImmediate(scrollBackgroundTransform);
 	_shaderRenderableScrollbar.renderImmediate(scrollbarTransform);
+
+	for (size_t i = 0; i < _lines.size(); i++)
+		getLine(i).renderImmediate(glm::translate(parentTransform, glm::vec3(roundf(_x), roundf(getLineY(i)), 0.0f)));
 }
 
 void ConsoleWindow::notifyResized(int UNUSED(oldWidth), int UNUSED(oldHeight),
@@ -677,10 +689,6 @@ void ConsoleWindow::notifyResized(int UNUSED(oldWidth), int UNUSED(oldHeight),
 	_x = -(newWidth  / 2.0f);
 	_y =  (newHeight / 2.0f) - _height;
 
-	float textY = (newHeight / 2.0f) - _lineHeight;
-	for (size_t i = 0; i < _lines.size(); i++, textY -= _lineHeight)
-		_lines[i]->setPosition(_x, textY, -1001.0f);
-
 	_prompt->setPosition(_x                      , _y, -1001.0f);
 	_input ->setPosition(_x + _prompt->getWidth(), _y, -1001.0f);
 
@@ -726,15 +734,56 @@ void ConsoleWindow::recalcCursor() {
 void ConsoleWindow::redrawLines() {
 	GfxMan.lockFrame();
 
-	std::list<Common::UString>::reverse_iterator h = _history.rbegin();
-	for (size_t i = 0; (i < _historyStart) && (h != _history.rend()); i++, ++h);
+	const int64_t rows   = _lines.size();
+	const int64_t bottom = ((int64_t) _historyCount) - 1 - ((int64_t) _historyStart);
+	const int64_t shift  = bottom - _linesBottom;
+
+	if (!_linesValid || (ABS(shift) >= rows)) {
+		// Nothing we can keep, set all lines
+
+		for (int64_t i = 0; i < rows; i++)
+			setLine(i, bottom - (rows - 1 - i));
 
-	for (int i = _lines.size() - 1; (i >= 0) && (h != _history.rend()); i--, ++h)
-		_lines[i]->setText(*h);
+	} else if (shift > 0) {
+		// Scrolled towards newer lines: rotate the topmost lines to the bottom
+
+		_linesTop = (_linesTop + shift) % rows;
+
+		for (int64_t i = rows - shift; i < rows; i++)
+			setLine(i, bottom - (rows - 1 - i));
+
+	} else if (shift < 0) {
+		// Scrolled towards older lines: rotate the bottommost lines to the top
+
+		_linesTop = (_linesTop + rows + shift) % rows;
+
+		for (int64_t i = 0; i < -shift; i++)
+			setLine(i, bottom - (rows - 1 - i));
+	}
+
+	_linesBottom = bottom;
+	_linesValid  = true;
 
 	GfxMan.unlockFrame();
 }
 
+Graphics::Aurora::Text &ConsoleWindow::getLine(size_t row) const {
+	return *_lines[(_linesTop + row) % _lines.size()];
+}
+
+void ConsoleWindow::setLine(size_t row, int64_t number) {
+	const int64_t oldest = ((int64_t) _historyCount) - ((int64_t) _historySizeCurrent);
+
+	if ((number < 0) || (number < oldest))
+		getLine(row).setText("");
+	else
+		getLine(row).setText(_history[number % _historySizeMax]);
+}
+
+float ConsoleWindow::getLineY(size_t row) const {
+	return _y + _height - (row + 1) * _lineHeight;
+}
+
 void ConsoleWindow::updateScrollbarLength() {
 	float length = 1.0f;
 
@@ -778,6 +827,9 @@ Console::Console(Engine &engine, const Common::UString &font, int fontHeight) :
 			"Usage: quit\nQuit xoreos entirely");
 	registerCommand("dumpreslist", std::bind(&Console::cmdDumpResList, this, std::placeholders::_1),
 			"Usage: dumpreslist <file>\nDump the current list of resources to file");
+	registerCommand("memory"     , std::bind(&Console::cmdMemory     , this, std::placeholders::_1),
+			"Usage: memory [<count>]\n"
+			"Print how much memory each subsystem takes up, and its <count> largest items");
 	registerCommand("dumpres"    , std::bind(&Console::cmdDumpRes    , this, std::placeholders::_1),
 			"Usage: dumpres <resource>\nDump a resource to file");
 	registerCommand("dumptga"    , std::bind(&Console::cmdDumpTGA    , this, std::placeholders::_1),
@@ -802,6 +854,8 @@ Console::Console(Engine &engine, const Common::UString &font, int fontHeight) :
 			"Usage: setoption <option> <value>\nSet the value of a config option for this session");
 	registerCommand("showfps"    , std::bind(&Console::cmdShowFPS    , this, std::placeholders::_1),
 			"Usage: showfps <true/false>\nShow/Hide the frames-per-second display");
+	registerCommand("showperformance", std::bind(&Console::cmdShowPerformance, this, std::placeholders::_1),
+			"Usage: showperformance <true/false>\nShow/Hide the live performance overlay");
 	registerCommand("listlangs"  , std::bind(&Console::cmdListLangs  , this, std::placeholders::_1),
 			"Usage: listlangs\nLists all languages supported by this game version");
 	registerCommand("getlang"    , std::bind(&Console::cmdGetLang    , this, std::placeholders::_1),
@@ -816,6 +870,19 @@ Console::Console(Engine &engine, const Common::UString &font, int fontHeight) :
 	registerCommand("setcamera"  , std::bind(&Console::cmdSetCamera  , this, std::placeholders::_1),
 			"Usage: setcamera <posX> <posY> <posZ> [<orientX> <orientY> <orientZ>]\n"
 			"Set the camera position (and orientation)");
+	registerCommand("scriptprofile", std::bind(&Console::cmdScriptProfile, this, std::placeholders::_1),
+			"Usage: scriptprofile on|off|clear\n       scriptprofile show [<count>]\n"
+			"       scriptprofile dump <file>\n"
+			"Profile scripts and engine functions, and show or dump (as CSV) the results");
+	registerCommand("profile"    , std::bind(&Console::cmdProfile    , this, std::placeholders::_1),
+			"Usage: profile on|off|clear\n       profile show [<count>]\n"
+			"       profile dump <file>\n"
+			"Profile the engine's CPU time, and show or dump (as Chrome trace JSON) the results");
+	registerCommand("flythrough" , std::bind(&Console::cmdFlythrough , this, std::placeholders::_1),
+			"Usage: flythrough record\n       flythrough save <file>\n"
+			"       flythrough replay <file> [<report>]\n       flythrough stop\n"
+			"Record the camera's path, or replay a recorded path and write a JSON\n"
+			"report of the time, draw calls and triangles of every frame");
 
 	_console->print("Console ready...");
 }
@@ -1256,6 +1323,51 @@ void Console::cmdDumpResList(const CommandLine &cl) {
 		printf("Failed dumping list of resources to file \"%s\"", file.c_str());
 }
 
+void Console::printMemoryUsage(const Common::UString &subsystem, Common::MemoryUsageList &usage,
+                               size_t count) {
+
+	usage.sort();
+
+	printf("%-40s %12s KiB", subsystem.c_str(), Common::composeString(usage.getTotal() / 1024).c_str());
+	for (size_t i = 0; i < MIN(count, usage.size()); i++)
+		printf("  %-38s %12s KiB", usage[i].name.c_str(), Common::composeString(usage[i].size / 1024).c_str());
+}
+
+void Console::cmdMemory(const CommandLine &cl) {
+	size_t count = 5;
+	if (!cl.args.empty()) {
+		try {
+			Common::parseString(cl.args, count);
+		} catch (...) {
+			printCommandHelp(cl.cmd);
+			return;
+		}
+	}
+
+	Common::MemoryUsageList texturesCPU, texturesGPU, meshes, twoDAs, talkTables, sounds, resources;
+
+	TextureMan.getMemoryUsage(texturesCPU, texturesGPU);
+	MeshMan.getMemoryUsage(meshes);
+	TwoDAReg.getMemoryUsage(twoDAs);
+	TalkMan.getMemoryUsage(talkTables);
+	SoundMan.getMemoryUsage(sounds);
+	ResMan.getMemoryUsage(resources);
+
+	printMemoryUsage("Textures (system memory)", texturesCPU, count);
+	printMemoryUsage("Textures (GPU memory)"   , texturesGPU, count);
+	printMemoryUsage("Meshes"                  , meshes     , count);
+	printMemoryUsage("2DAs"                    , twoDAs     , count);
+	printMemoryUsage("Talk tables"             , talkTables , count);
+	printMemoryUsage("Sounds"                  , sounds     , count);
+	printMemoryUsage("Resources"               , resources  , count);
+
+	const size_t total = texturesCPU.getTotal() + meshes.getTotal() + twoDAs.getTotal() +
+	                     talkTables.getTotal() + sounds.getTotal() + resources.getTotal();
+
+	printf("%-40s %12s KiB (%s KiB on the GPU)", "Total", Common::composeString(total / 1024).c_str(),
+	       Common::composeString(texturesGPU.getTotal() / 1024).c_str());
+}
+
 void Console::cmdDumpRes(const CommandLine &cl) {
 	if (cl.args.empty()) {
 		printCommandHelp(cl.cmd);
@@ -1368,6 +1480,7 @@ void Console::cmdSetOption(const CommandLine &cl) {
 
 	ConfigMan.setCommandlineKey(args[0], args[1]);
 	_engine->showFPS();
+	_engine->showPerformance();
 
 	printf("\"%s\" = \"%s\"", args[0].c_str(), ConfigMan.getString(args[0]).c_str());
 }
@@ -1382,6 +1495,16 @@ void Console::cmdShowFPS(const CommandLine &cl) {
 	_engine->showFPS();
 }
 
+void Console::cmdShowPerformance(const CommandLine &cl) {
+	if (cl.args.empty()) {
+		printCommandHelp(cl.cmd);
+		return;
+	}
+
+	ConfigMan.setCommandlineKey("showperformance", cl.args);
+	_engine->showPerformance();
+}
+
 void Console::cmdListLangs(const CommandLine &UNUSED(cl)) {
 	std::vector<Aurora::Language> langs;
 	if (_engine->detectLanguages(langs)) {
@@ -1520,6 +1643,168 @@ void Console::cmdSetCamera(const CommandLine &cl) {
 	CameraMan.update();
 }
 
+void Console::cmdScriptProfile(const CommandLine &cl) {
+	std::vector<Common::UString> args;
+	splitArguments(cl.args, args);
+
+	if (args.empty()) {
+		printCommandHelp(cl.cmd);
+		return;
+	}
+
+	if        (args[0] == "on") {
+		ScriptProfiler.setEnabled(true);
+		print("Script profiling enabled");
+
+	} else if (args[0] == "off") {
+		ScriptProfiler.setEnabled(false);
+		print("Script profiling disabled");
+
+	} else if (args[0] == "clear") {
+		ScriptProfiler.clear();
+		print("Script profile cleared");
+
+	} else if (args[0] == "show") {
+		size_t count = 10;
+		if (args.size() > 1) {
+			try {
+				Common::parseString(args[1], count);
+			} catch (...) {
+				printCommandHelp(cl.cmd);
+				return;
+			}
+		}
+
+		const Aurora::NWScript::Profiler::Entries scripts   = ScriptProfiler.getScripts();
+		const Aurora::NWScript::Profiler::Entries functions = ScriptProfiler.getFunctions();
+
+		printf("%-32s %10s %14s %12s", "Script", "Calls", "Instructions", "Time (us)");
+		for (size_t i = 0; i < MIN(count, scripts.size()); i++)
+			printf("%-32s %10s %14s %12s", scripts[i].name.c_str(),
+			       Common::composeString(scripts[i].calls).c_str(),
+			       Common::composeString(scripts[i].instructions).c_str(),
+			       Common::composeString(scripts[i].time).c_str());
+
+		printf("%-32s %10s %14s %12s", "Engine function", "Calls", "ID", "Time (us)");
+		for (size_t i = 0; i < MIN(count, functions.size()); i++)
+			printf("%-32s %10s %14u %12s", functions[i].name.c_str(),
+			       Common::composeString(functions[i].calls).c_str(), functions[i].id,
+			       Common::composeString(functions[i].time).c_str());
+
+	} else if ((args[0] == "dump") && (args.size() > 1)) {
+		Common::UString file = Common::FilePath::getUserDataFile(args[1]);
+
+		try {
+			ScriptProfiler.dumpCSV(file);
+			printf("Dumped script profile to file \"%s\"", file.c_str());
+		} catch (...) {
+			printf("Failed dumping script profile to file \"%s\"", file.c_str());
+		}
+
+	} else
+		printCommandHelp(cl.cmd);
+}
+
+void Console::cmdProfile(const CommandLine &cl) {
+	std::vector<Common::UString> args;
+	splitArguments(cl.args, args);
+
+	if (args.empty()) {
+		printCommandHelp(cl.cmd);
+		return;
+	}
+
+	if        (args[0] == "on") {
+		ProfilerMan.setEnabled(true);
+		print("Profiling enabled");
+
+	} else if (args[0] == "off") {
+		ProfilerMan.setEnabled(false);
+		print("Profiling disabled");
+
+	} else if (args[0] == "clear") {
+		ProfilerMan.clear();
+		print("Profile cleared");
+
+	} else if (args[0] == "show") {
+		size_t count = 10;
+		if (args.size() > 1) {
+			try {
+				Common::parseString(args[1], count);
+			} catch (...) {
+				printCommandHelp(cl.cmd);
+				return;
+			}
+		}
+
+		const Common::Profiler::Entries entries = ProfilerMan.getEntries();
+
+		printf("%-40s %10s %12s", "Zone", "Calls", "Time (us)");
+		for (size_t i = 0; i < MIN(count, entries.size()); i++)
+			printf("%-40s %10s %12s", entries[i].name,
+			       Common::composeString(entries[i].calls).c_str(),
+			       Common::composeString(entries[i].time).c_str());
+
+	} else if ((args[0] == "dump") && (args.size() > 1)) {
+		Common::UString file = Common::FilePath::getUserDataFile(args[1]);
+
+		try {
+			ProfilerMan.dumpChromeTrace(file);
+			printf("Dumped profile to file \"%s\"", file.c_str());
+		} catch (...) {
+			printf("Failed dumping profile to file \"%s\"", file.c_str());
+		}
+
+	} else
+		printCommandHelp(cl.cmd);
+}
+
+void Console::cmdFlythrough(const CommandLine &cl) {
+	std::vector<Common::UString> args;
+	splitArguments(cl.args, args);
+
+	if (args.empty()) {
+		printCommandHelp(cl.cmd);
+		return;
+	}
+
+	if        (args[0] == "record") {
+		try {
+			GfxMan.startFlythroughRecording();
+			print("Recording the camera's flythrough");
+		} catch (...) {
+			print("Failed to start recording");
+		}
+
+	} else if ((args[0] == "save") && (args.size() > 1)) {
+		Common::UString file = Common::FilePath::getUserDataFile(args[1]);
+
+		try {
+			GfxMan.stopFlythroughRecording(file);
+			printf("Saved flythrough to file \"%s\"", file.c_str());
+		} catch (...) {
+			printf("Failed saving flythrough to file \"%s\"", file.c_str());
+		}
+
+	} else if ((args[0] == "replay") && (args.size() > 1)) {
+		Common::UString file   = Common::FilePath::getUserDataFile(args[1]);
+		Common::UString report = Common::FilePath::getUserDataFile((args.size() > 2) ? args[2] : (args[1] + ".json"));
+
+		try {
+			GfxMan.startFlythroughReplay(file, report);
+			printf("Replaying flythrough \"%s\", writing the report to \"%s\"", file.c_str(), report.c_str());
+		} catch (...) {
+			printf("Failed replaying flythrough \"%s\"", file.c_str());
+		}
+
+	} else if (args[0] == "stop") {
+		GfxMan.stopFlythroughReplay();
+		print("Flythrough replay stopped");
+
+	} else
+		printCommandHelp(cl.cmd);
+}
+
 void Console::printFullHelp() {
 	print("Available commands (help <command> for further help on each command):");
 
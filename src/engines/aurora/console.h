@@ -39,6 +39,7 @@
 #include "src/common/error.h"
 #include "src/common/ustring.h"
 #include "src/common/writefile.h"
+#include "src/common/memoryusage.h"
 
 #include "src/events/types.h"
 #include "src/events/notifyable.h"
@@ -136,11 +137,23 @@ private:
 
 	size_t _historySizeMax;
 	size_t _historySizeCurrent;
-	std::list<Common::UString> _history;
+	uint64_t _historyCount; ///< Number of lines ever printed.
+
+	/** Ring buffer of the last printed lines, indexed by line number modulo its size. */
+	std::vector<Common::UString> _history;
 
 	size_t _historyStart;
 
+	/** The visible lines, a ring starting with the topmost line at _linesTop.
+	 *
+	 *  Scrolling rotates the ring, so that only the lines that come into
+	 *  view need to be laid out again. The console draws them itself.
+	 */
 	std::vector<Graphics::Aurora::Text *> _lines;
+
+	size_t  _linesTop;    ///< Index into _lines of the topmost visible line.
+	int64_t _linesBottom; ///< Line number shown by the bottommost visible line.
+	bool    _linesValid;  ///< Do the visible lines show _linesBottom and above?
 	std::unique_ptr<Graphics::Aurora::Text> _input;
 
 
@@ -177,6 +190,13 @@ private:
 	void recalcCursor();
 	void redrawLines();
 
+	/** Return the visible line in this row, counted from the top. */
+	Graphics::Aurora::Text &getLine(size_t row) const;
+	/** Show this line number in this row, counted from the top. */
+	void setLine(size_t row, int64_t number);
+	/** Return the y coordinate of this row, counted from the top. */
+	float getLineY(size_t row) const;
+
 	void printLine(const Common::UString &line);
 
 	bool openLogFile();
@@ -297,6 +317,7 @@ private:
 	void cmdClose      (const CommandLine &cl);
 	void cmdQuit       (const CommandLine &cl);
 	void cmdDumpResList(const CommandLine &cl);
+	void cmdMemory     (const CommandLine &cl);
 	void cmdDumpRes    (const CommandLine &cl);
 	void cmdDumpTGA    (const CommandLine &cl);
 	void cmdDump2DA    (const CommandLine &cl);
@@ -309,18 +330,24 @@ private:
 	void cmdGetOption  (const CommandLine &cl);
 	void cmdSetOption  (const CommandLine &cl);
 	void cmdShowFPS    (const CommandLine &cl);
+	void cmdShowPerformance(const CommandLine &cl);
 	void cmdListLangs  (const CommandLine &cl);
 	void cmdGetLang    (const CommandLine &cl);
 	void cmdSetLang    (const CommandLine &cl);
 	void cmdGetString  (const CommandLine &cl);
 	void cmdGetCamera  (const CommandLine &cl);
 	void cmdSetCamera  (const CommandLine &cl);
+	void cmdScriptProfile(const CommandLine &cl);
+	void cmdProfile      (const CommandLine &cl);
+	void cmdFlythrough   (const CommandLine &cl);
 
 	void updateHelpArguments();
 
 	void printFullHelp();
 	bool printHints(const Common::UString &command);
 
+	void printMemoryUsage(const Common::UString &subsystem, Common::MemoryUsageList &usage, size_t count);
+
 	void execute(const Common::UString &line);
 };
 
@@ -28,7 +28,7 @@
 #include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/boundingbox.h"
-#include "src/common/aabbnode.h"
+#include "src/common/aabbtree.h"
 #include "src/common/geometry.h"
 
 #include "src/graphics/aurora/walkmesh.h"
@@ -57,7 +57,8 @@ float LocalAStar::getGValue(Node &previousNode, uint32_t face, float &x, float &
 }
 
 LocalPathfinding::LocalPathfinding(Pathfinding *globalPathfinding) : Pathfinding(std::vector<bool>(), 4),
-    _globalPathfinding(globalPathfinding) {
+    _globalPathfinding(globalPathfinding),
+    _occupancy(0.1f, 32, 1.6f, [this](const glm::vec2 &min, const glm::vec2 &max) { fillOccupancy(min, max); }) {
 	// Set property 0 to unwalkable.
 	_walkableProperties.push_back(false);
 	// Set property 1 to walkable.
@@ -220,52 +221,29 @@ bool LocalPathfinding::buildWalkmeshAround(std::vector<glm::vec3> &path, float h
 
 	// Build the local mesh.
 	_facesCount = _gridHeight * _gridWidth;
-	_faceProperty.clear();
-	_faceProperty.resize(_facesCount, 1);
+	_faceProperty.resize(_facesCount);
 
 	// Adjust drawing height.
 	const float walkmeshHeight = _globalPathfinding->getHeight(_xCenter, _yCenter, true) + 0.05;
 	_walkmeshDrawing->setAdjustedHeight(0.15);
 
-	// Rasterize unwalkable faces from the walkmesh into the grid.
-	std::vector<Common::AABBNode *> nodes;
-	glm::vec2 minInReal = fromVirtualPlan(glm::vec2(_xMin, _yMin));
-	glm::vec2 maxInReal = fromVirtualPlan(glm::vec2(_xMin + _cellSize * _gridWidth,
-	                                                _yMin + _cellSize * _gridHeight));
-	glm::vec2 lTInReal = fromVirtualPlan(glm::vec2(_xMin, _yMin + _cellSize * _gridHeight));
-	glm::vec2 rBInReal = fromVirtualPlan(glm::vec2(_xMin + _cellSize * _gridWidth, _yMin));
-	_trueMin = glm::vec3(MIN(MIN(MIN(minInReal[0], maxInReal[0]), lTInReal[0]), rBInReal[0]),
-	        MIN(MIN(MIN(minInReal[1], maxInReal[1]), lTInReal[1]), rBInReal[1]),
-	        walkmeshHeight - 0.8f);
-	_trueMax = glm::vec3(MAX(MAX(MAX(minInReal[0], maxInReal[0]), lTInReal[0]), rBInReal[0]),
-	        MAX(MAX(MAX(minInReal[1], maxInReal[1]), lTInReal[1]), rBInReal[1]),
-	        walkmeshHeight + 0.8f);
-	for (uint8_t c = 0; c < 2; ++c) {
-		_trueMin[c] -= halfWidth;
-		_trueMax[c] += halfWidth;
-	}
+	// Look up the unwalkable cells in the occupancy grid, which only needs
+	// filling again where it was invalidated.
+	updateStaticObjects();
 
-	for (size_t n = 0; n < _globalPathfinding->_aabbTrees.size(); ++n) {
-		if (_globalPathfinding->_aabbTrees[n])
-			_globalPathfinding->_aabbTrees[n]->getNodesInAABox(_trueMin, _trueMax, nodes);
-	}
+	const glm::vec2 origin = fromVirtualPlan(glm::vec2(_xMin + _cellSize / 2, _yMin + _cellSize / 2));
+	const glm::vec2 xStep = fromVirtualPlan(glm::vec2(_cellSize, 0.f)) - glm::vec2(_xCenter, _yCenter);
+	const glm::vec2 yStep = fromVirtualPlan(glm::vec2(0.f, _cellSize)) - glm::vec2(_xCenter, _yCenter);
+	const glm::vec2 extent(halfWidth, halfWidth);
 
-	std::vector<glm::vec3> vertices;
-	for (auto n = nodes.begin(); n != nodes.end(); ++n) {
-		const uint32_t face = static_cast<uint32_t>((*n)->getProperty());
-		if (_globalPathfinding->faceWalkable(face))
-			continue;
-
-		_globalPathfinding->getVertices(face, vertices, false);
-		if (!Common::intersectBoxTriangle3D(_trueMin, _trueMax,
-		                                    vertices[0], vertices[1], vertices[2]))
-			continue;
+	for (uint32_t yCell = 0; yCell < _gridHeight; ++yCell) {
+		for (uint32_t xCell = 0; xCell < _gridWidth; ++xCell) {
+			const glm::vec2 center = origin + xStep * static_cast<float>(xCell) + yStep * static_cast<float>(yCell);
+			const bool blocked = _occupancy.isBlocked(center - extent, center + extent,
+			                                          walkmeshHeight - 0.8f, walkmeshHeight + 0.8f);
 
-		// Translate to virtual plan.
-		for (auto &v : vertices) {
-			v = toVirtualPlan(v);
+			_faceProperty[xCell + yCell * _gridWidth] = blocked ? 0 : 1;
 		}
-		rasterizeTriangle(vertices, halfWidth);
 	}
 
 	_verticesCount = (_gridWidth + 1) * (_gridHeight + 1);
@@ -285,42 +263,37 @@ bool LocalPathfinding::buildWalkmeshAround(std::vector<glm::vec3> &path, float h
 		}
 	}
 
-	// Set faces.
-	_faces.resize(_facesCount * 4);
-	for (uint32_t yCell = 0; yCell < _gridHeight; ++yCell) {
-		for (uint32_t xCell = 0; xCell < _gridWidth; ++xCell) {
-			const uint32_t faceID = xCell + yCell * _gridWidth;
-			_faces[4 * faceID] = xCell + (yCell * (_gridWidth + 1));
-			_faces[4 * faceID + 1] = xCell + 1 + (yCell * (_gridWidth + 1));
-			_faces[4 * faceID + 2] = xCell + 1 + ((1 + yCell) * (_gridWidth + 1));
-			_faces[4 * faceID + 3] = xCell + ((1 + yCell) * (_gridWidth + 1));
+	// The faces and adjacencies only depend on the grid size.
+	if (_faces.size() != _facesCount * 4) {
+		// Set faces.
+		_faces.resize(_facesCount * 4);
+		for (uint32_t yCell = 0; yCell < _gridHeight; ++yCell) {
+			for (uint32_t xCell = 0; xCell < _gridWidth; ++xCell) {
+				const uint32_t faceID = xCell + yCell * _gridWidth;
+				_faces[4 * faceID] = xCell + (yCell * (_gridWidth + 1));
+				_faces[4 * faceID + 1] = xCell + 1 + (yCell * (_gridWidth + 1));
+				_faces[4 * faceID + 2] = xCell + 1 + ((1 + yCell) * (_gridWidth + 1));
+				_faces[4 * faceID + 3] = xCell + ((1 + yCell) * (_gridWidth + 1));
+			}
 		}
-	}
 
-	_adjFaces.resize(_facesCount * 4);
-	// Set adjacencies.
-	for (uint32_t yCell = 0; yCell < _gridHeight; ++yCell) {
-		for (uint32_t xCell = 0; xCell < _gridWidth; ++xCell) {
-			const uint32_t faceID = xCell + yCell * _gridWidth;
-			// Bottom face.
-			_adjFaces[faceID * 4] = yCell != 0 ? faceID - _gridWidth : UINT32_MAX;
-			// Right face.
-			_adjFaces[faceID * 4 + 1] = xCell != _gridWidth - 1 ? faceID + 1 : UINT32_MAX;
-			// Top face.
-			_adjFaces[faceID * 4 + 2] = yCell != _gridHeight - 1 ? faceID + _gridWidth : UINT32_MAX;
-			// Left face.
-			_adjFaces[faceID * 4 + 3] = xCell != 0 ? faceID - 1 : UINT32_MAX;
+		_adjFaces.resize(_facesCount * 4);
+		// Set adjacencies.
+		for (uint32_t yCell = 0; yCell < _gridHeight; ++yCell) {
+			for (uint32_t xCell = 0; xCell < _gridWidth; ++xCell) {
+				const uint32_t faceID = xCell + yCell * _gridWidth;
+				// Bottom face.
+				_adjFaces[faceID * 4] = yCell != 0 ? faceID - _gridWidth : UINT32_MAX;
+				// Right face.
+				_adjFaces[faceID * 4 + 1] = xCell != _gridWidth - 1 ? faceID + 1 : UINT32_MAX;
+				// Top face.
+				_adjFaces[faceID * 4 + 2] = yCell != _gridHeight - 1 ? faceID + _gridWidth : UINT32_MAX;
+				// Left face.
+				_adjFaces[faceID * 4 + 3] = xCell != 0 ? faceID - 1 : UINT32_MAX;
+			}
 		}
 	}
 
-	// Add relevant static objects.
-	for (auto &object : _staticObjects) {
-		if (!object->in(_trueMin, _trueMax))
-			continue;
-
-		addObjects(object->getVertices(), object->getFaces(), halfWidth);
-	}
-
 	if (walkmeshVisible) showWalkmesh(true);
 
 	return true;
@@ -652,20 +625,12 @@ uint32_t LocalPathfinding::getDiagonalFace(uint32_t face, uint32_t direction) co
 
 void LocalPathfinding::getVerticesTunnel(std::vector<uint32_t> &facePath, std::vector<glm::vec3> &tunnel,
                                          std::vector<bool> &tunnelLeftRight) {
-	std::vector<glm::vec3> sharedVertices;
-	std::vector<bool> leftRight;
-
-	for (size_t f = 0; f < facePath.size() - 1; ++f) {
-		getSharedVertices(facePath[f], facePath[f + 1], sharedVertices, leftRight);
-		tunnel.insert(tunnel.end(), sharedVertices.begin(), sharedVertices.end());
-		tunnelLeftRight.insert(tunnelLeftRight.end(), leftRight.begin(), leftRight.end());
-	}
+	for (size_t f = 0; f + 1 < facePath.size(); ++f)
+		getSharedVertices(facePath[f], facePath[f + 1], tunnel, tunnelLeftRight);
 }
 
 bool LocalPathfinding::getSharedVertices(uint32_t face1, uint32_t face2,
                                          std::vector<glm::vec3> &verts, std::vector<bool> &leftRight) const {
-	verts.clear();
-	leftRight.clear();
 	uint32_t vert1, vert2;
 
 	const uint32_t row1 = face1 / _gridWidth;
@@ -766,104 +731,77 @@ bool LocalPathfinding::findPathTo(std::vector<glm::vec3> &path) {
 	return pathFound;
 }
 
-void LocalPathfinding::rasterizeTriangle(std::vector<glm::vec3> &vertices, float halfWidth) {
-	// Set positions relative.
-	float y0 = vertices[0][1];
-	float y1 = vertices[1][1];
-	float y2 = vertices[2][1];
-
-	float x0 = vertices[0][0];
-	float x1 = vertices[1][0];
-	float x2 = vertices[2][0];
-
-	glm::vec3 shift0(0.f, 0.f, 0.f);
-	glm::vec3 shift1(0.f, 0.f, 0.f);
-	glm::vec3 shift2(0.f, 0.f, 0.f);
-	if (halfWidth > 0.f) {
-		shift0 = getOrthonormalVec(glm::vec3(x1 - x0, y1 - y0, 0.f), false) * halfWidth;
-		shift1 = getOrthonormalVec(glm::vec3(x2 - x1, y2 - y1, 0.f), false) * halfWidth;
-		shift2 = getOrthonormalVec(glm::vec3(x0 - x2, y0 - y2, 0.f), false) * halfWidth;
+void LocalPathfinding::addStaticObjects(ObjectWalkmesh *objectWalkmesh) {
+	_staticObjects.emplace_back(objectWalkmesh);
+
+	StaticObjectState state;
+	state.faces      = &objectWalkmesh->getFaces();
+	state.facesCount = state.faces->size();
+
+	state.min = glm::vec2(FLT_MAX, FLT_MAX);
+	state.max = glm::vec2(-FLT_MAX, -FLT_MAX);
+
+	const std::vector<float> &vertices = objectWalkmesh->getVertices();
+	for (size_t v = 0; v + 2 < vertices.size(); v += 3) {
+		state.min = glm::min(state.min, glm::vec2(vertices[v], vertices[v + 1]));
+		state.max = glm::max(state.max, glm::vec2(vertices[v], vertices[v + 1]));
 	}
 
-	y0 -= _yMin;
-	y1 -= _yMin;
-	y2 -= _yMin;
-
-	x0 -= _xMin;
-	x1 -= _xMin;
-	x2 -= _xMin;
-
-	// Bounding rectangle
-	const float minX = MIN(x1, MIN(x2, x0)) - halfWidth;
-	const float maxX = MAX(MAX(x1, MAX(x2, x0)) + halfWidth, 0.f);
-	const float minY = MIN(y1, MIN(y2, y0)) - halfWidth;
-	const float maxY = MAX(MAX(y1, MAX(y2, y0)) + halfWidth, 0.f);
-
-	const uint32_t startY = static_cast<uint32_t>(MAX(floorf(minY / _cellSize), 0.f));
-	const uint32_t startX = static_cast<uint32_t>(MAX(floorf(minX / _cellSize), 0.f));
-	const uint32_t endY = static_cast<uint32_t>(MIN(ceilf(maxY / _cellSize), static_cast<float>(_gridHeight)));
-	const uint32_t endX = static_cast<uint32_t>(MIN(ceilf(maxX / _cellSize), static_cast<float>(_gridWidth)));
-
-	const float dy10 = y1 - y0;
-	const float dy21 = y2 - y1;
-	const float dy02 = y0 - y2;
-
-	const float dx10 = x1 - x0;
-	const float dx21 = x2 - x1;
-	const float dx02 = x0 - x2;
-
-	float yStep = _cellSize * startY + _cellSize / 2;
-	float xStep = _cellSize * startX + _cellSize / 2;
-	const float firstXstep = xStep;
-	// Scan through bounding rectangle.
-	for (uint32_t y = startY; y < endY; ++y) {
-		const float yStep0 = yStep - y0 + shift0[1];
-		const float yStep1 = yStep - y1 + shift1[1];
-		const float yStep2 = yStep - y2 + shift2[1];
-
-		xStep = firstXstep;
-		for (uint32_t x = startX; x < endX; ++x) {
-			const float test01 = (xStep - x0 + shift0[0]) * dy10 - yStep0 * dx10;
-			const float test12 = (xStep - x1 + shift1[0]) * dy21 - yStep1 * dx21;
-			const float test20 = (xStep - x2 + shift2[0]) * dy02 - yStep2 * dx02;
-			if (test01 < 0 && test12 < 0 && test20 < 0) {
-				_faceProperty[x + y * _gridWidth] = 0;
-			}
+	_staticObjectStates.push_back(state);
+
+	if (state.facesCount > 0)
+		_occupancy.invalidate(state.min, state.max);
+}
+
+void LocalPathfinding::updateStaticObjects() {
+	auto state = _staticObjectStates.begin();
+	for (auto &object : _staticObjects) {
+		const std::vector<uint32_t> &faces = object->getFaces();
+		if ((&faces != state->faces) || (faces.size() != state->facesCount)) {
+			state->faces      = &faces;
+			state->facesCount = faces.size();
 
-			xStep += _cellSize;
+			if (state->min.x <= state->max.x)
+				_occupancy.invalidate(state->min, state->max);
 		}
-		yStep += _cellSize;
+
+		++state;
 	}
 }
 
-void LocalPathfinding::addObjects(const std::vector<float> &vertices, const std::vector<uint32_t> &faces,
-                                  float halfWidth) {
-	// Local Objects.
-	const uint32_t facesCount = faces.size() / 3;
-	if (facesCount != 0) {
-		for (uint32_t f = 0; f < facesCount; ++f) {
-			std::vector<glm::vec3> vert;
-			for (uint8_t v = 0; v < 3; ++v) {
-				const float xO = vertices[faces[f * 3 + v] * 3];
-				const float yO = vertices[faces[f * 3 + v] * 3 + 1];
-				vert.push_back(glm::vec3(xO, yO, 0.f));
-			}
+void LocalPathfinding::fillOccupancy(const glm::vec2 &min, const glm::vec2 &max) {
+	// Unwalkable faces of the walkmesh, which only block creatures at their height.
+	std::vector<glm::vec3> vertices;
+	auto addFace = [&](int32_t property) {
+		const uint32_t face = static_cast<uint32_t>(property);
+		if (_globalPathfinding->faceWalkable(face))
+			return false;
+
+		_globalPathfinding->getVertices(face, vertices, false);
+		_occupancy.addTriangle(vertices[0], vertices[1], vertices[2]);
+		return false;
+	};
+
+	for (const auto &tree : _globalPathfinding->_flatAABBTrees)
+		tree.visitAABox(min, max, addFace);
+
+	// Static objects, which block creatures at all heights.
+	for (auto &object : _staticObjects) {
+		if (!object->in(min, max))
+			continue;
 
-			for (auto &v : vert)
-				v = toVirtualPlan(v);
+		const std::vector<float> &objVertices = object->getVertices();
+		const std::vector<uint32_t> &objFaces = object->getFaces();
+		for (size_t f = 0; f + 2 < objFaces.size(); f += 3) {
+			glm::vec3 vert[3];
+			for (uint8_t v = 0; v < 3; ++v)
+				vert[v] = glm::vec3(objVertices[objFaces[f + v] * 3], objVertices[objFaces[f + v] * 3 + 1], 0.f);
 
-			const glm::vec2 vertA(vert[0][0], vert[0][1]);
-			const glm::vec2 vertB(vert[1][0], vert[1][1]);
-			const glm::vec2 vertC(vert[2][0], vert[2][1]);
-			rasterizeTriangle(vert, halfWidth);
+			_occupancy.addTriangle(vert[0], vert[1], vert[2], true);
 		}
 	}
 }
 
-void LocalPathfinding::addStaticObjects(ObjectWalkmesh *objectWalkmesh) {
-	_staticObjects.emplace_back(objectWalkmesh);
-}
-
 glm::vec3 LocalPathfinding::toVirtualPlan(const glm::vec3 &vector) const {
 	glm::vec3 virt;
 	glm::vec3 transla = vector - glm::vec3(_xCenter, _yCenter, 0.f);
@@ -28,6 +28,8 @@
 #include <list>
 #include <memory>
 
+#include "src/common/occupancygrid.h"
+
 #include "src/engines/aurora/astar.h"
 #include "src/engines/aurora/pathfinding.h"
 
@@ -67,16 +69,29 @@ protected:
 	void getAdjacentFaces(uint32_t face, uint32_t parent, std::vector<uint32_t> &adjFaces,
 	                      bool onlyWalkable = true) const;
 	void getFacePosition(uint32_t face, float &x, float &y) const;
-	void rasterizeTriangle(std::vector<glm::vec3> &vertices, float halfWidth = 0.f);
-	void addObjects(const std::vector<float> &vertices, const std::vector<uint32_t> &faces,
-	                float halfWidth = 0.f);
 	/** Get the vertices along a path of faces. */
 	virtual void getVerticesTunnel(std::vector<uint32_t> &facePath, std::vector<glm::vec3> &tunnel,
 	                               std::vector<bool> &tunnelLeftRight);
 
 private:
+	/** Append the vertices shared by two faces, and their sides, to the tunnel. */
 	bool getSharedVertices(uint32_t face1, uint32_t face2, std::vector<glm::vec3> &verts,
 	                       std::vector<bool> &leftRight) const;
+
+	/** The state of a static object when its obstacles were last added to the occupancy grid. */
+	struct StaticObjectState {
+		const std::vector<uint32_t> *faces;
+		size_t facesCount;
+
+		glm::vec2 min;
+		glm::vec2 max;
+	};
+
+	/** Add the obstacles within a rectangle to the occupancy grid. */
+	void fillOccupancy(const glm::vec2 &min, const glm::vec2 &max);
+	/** Invalidate the occupancy grid where static objects changed, like opened doors. */
+	void updateStaticObjects();
+
 	glm::vec3 toVirtualPlan(const glm::vec3 &vector) const;
 	glm::vec2 toVirtualPlan(const glm::vec2 &vector) const;
 	glm::vec3 fromVirtualPlan(const glm::vec3 &vector) const;
@@ -89,9 +104,11 @@ private:
 	Pathfinding *_globalPathfinding;
 
 	std::list<std::unique_ptr<ObjectWalkmesh>> _staticObjects;
+	std::vector<StaticObjectState> _staticObjectStates; ///< Parallel to _staticObjects.
+
+	/** Persistent, world-aligned grid of the cells blocked by unwalkable faces and static objects. */
+	Common::OccupancyGrid _occupancy;
 
-	glm::vec3 _trueMin;
-	glm::vec3 _trueMax;
 	uint32_t _gridWidth;
 	uint32_t _gridHeight;
 	uint32_t _endFace;
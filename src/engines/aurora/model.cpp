@@ -24,8 +24,12 @@
 
 #include <cassert>
 
+#include <vector>
+
 #include "src/common/ustring.h"
 #include "src/common/error.h"
+#include "src/common/threadpool.h"
+#include "src/common/profiler.h"
 
 #include "src/engines/aurora/model.h"
 #include "src/engines/aurora/modelloader.h"
@@ -46,6 +50,8 @@ void unregisterModelLoader() {
 
 Graphics::Aurora::Model *loadModelObject(const Common::UString &resref,
                                          const Common::UString &texture) {
+	PROFILE_ZONE("loadModelObject");
+
 	assert(kModelLoader);
 
 	Graphics::Aurora::Model *model = 0;
@@ -85,4 +91,84 @@ void freeModel(Graphics::Aurora::Model *&model) {
 	kModelLoader->free(model);
 }
 
+
+struct PendingModel::State {
+	Common::ThreadPool::TaskHandle task;
+
+	Graphics::Aurora::Model *model;
+
+	State() : model(0) {
+	}
+};
+
+PendingModel::PendingModel() {
+}
+
+PendingModel::PendingModel(PendingModel &&pending) : _state(std::move(pending._state)) {
+}
+
+PendingModel::~PendingModel() {
+	release();
+}
+
+PendingModel &PendingModel::operator=(PendingModel &&pending) {
+	if (this != &pending) {
+		release();
+
+		_state = std::move(pending._state);
+	}
+
+	return *this;
+}
+
+bool PendingModel::empty() const {
+	return !_state;
+}
+
+bool PendingModel::isReady() const {
+	return !_state || ThreadPoolMan.isDone(_state->task);
+}
+
+Graphics::Aurora::Model *PendingModel::take() {
+	if (!_state)
+		return 0;
+
+	// Loading failures are caught inside the task, so this never throws
+	ThreadPoolMan.wait(_state->task);
+
+	Graphics::Aurora::Model *model = _state->model;
+
+	_state.reset();
+	return model;
+}
+
+void PendingModel::release() {
+	Graphics::Aurora::Model *model = take();
+	if (model)
+		freeModel(model);
+}
+
+PendingModel loadModelObjectAsync(const Common::UString &resref, const Common::UString &texture,
+                                  const PendingModel *after) {
+	assert(kModelLoader);
+
+	PendingModel pending;
+	if (resref.empty())
+		return pending;
+
+	pending._state = std::make_unique<PendingModel::State>();
+
+	// The state is only destroyed after waiting for the task
+	PendingModel::State *state = pending._state.get();
+	std::vector<Common::ThreadPool::TaskHandle> dependencies;
+	if (after && after->_state)
+		dependencies.push_back(after->_state->task);
+
+	state->task = ThreadPoolMan.submit([state, resref, texture]() {
+		state->model = loadModelObject(resref, texture);
+	}, dependencies);
+
+	return pending;
+}
+
 } // End of namespace Engines
@@ -25,6 +25,8 @@
 #ifndef ENGINES_AURORA_MODEL_H
 #define ENGINES_AURORA_MODEL_H
 
+#include <memory>
+
 #include "src/graphics/aurora/types.h"
 
 namespace Common {
@@ -44,6 +46,55 @@ Graphics::Aurora::Model *loadModelGUI   (const Common::UString &resref);
 
 void freeModel(Graphics::Aurora::Model *&model);
 
+/** A model that is being loaded on the thread pool.
+ *
+ *  Models are parsed on the pool, while their GL containers are still
+ *  built on the main thread, as always. Loading several models at once
+ *  and taking them afterwards spreads the parsing over all cores.
+ *
+ *  A pending model that is destroyed without being taken waits for the
+ *  load to finish and frees the model again.
+ */
+class PendingModel {
+public:
+	PendingModel();
+	PendingModel(PendingModel &&pending);
+	~PendingModel();
+
+	PendingModel &operator=(PendingModel &&pending);
+
+	/** Is there no model being loaded at all? */
+	bool empty() const;
+	/** Has the model finished loading? */
+	bool isReady() const;
+
+	/** Wait for the model to finish loading and take ownership of it.
+	 *
+	 *  Returns 0 if the model failed to load, like loadModelObject().
+	 */
+	Graphics::Aurora::Model *take();
+
+private:
+	struct State;
+
+	std::unique_ptr<State> _state;
+
+	void release();
+
+	friend PendingModel loadModelObjectAsync(const Common::UString &, const Common::UString &,
+	                                         const PendingModel *);
+};
+
+/** Start loading an object model on the thread pool.
+ *
+ *  If after is given, the load only starts once that model has finished
+ *  loading. Loading more instances of a model after a first one lets them
+ *  share the meshes that one read, instead of all reading them at once.
+ */
+PendingModel loadModelObjectAsync(const Common::UString &resref,
+                                  const Common::UString &texture = "",
+                                  const PendingModel *after = 0);
+
 } // End of namespace Engines
 
 #endif // ENGINES_AURORA_MODEL_H
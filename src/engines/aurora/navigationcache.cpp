@@ -0,0 +1,279 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  An on-disk cache of walkmesh navigation data.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "src/common/error.h"
+#include "src/common/util.h"
+#include "src/common/ustring.h"
+#include "src/common/hash.h"
+#include "src/common/readstream.h"
+#include "src/common/writefile.h"
+#include "src/common/mappedfile.h"
+#include "src/common/filepath.h"
+#include "src/common/configvalue.h"
+#include "src/common/aabbnode.h"
+
+#include "src/aurora/resman.h"
+
+#include "src/engines/aurora/navigationcache.h"
+#include "src/engines/aurora/pathfinding.h"
+
+static const uint32_t kCacheID      = MKTAG('X', 'N', 'V', 'C');
+static const uint32_t kCacheVersion = 1;
+
+/** Hash of a resource that doesn't exist. */
+static const uint64_t kHashMissing = 0;
+
+static const Common::ConfigValue<bool> kConfigEnabled("navigationcache", false);
+
+namespace Engines {
+
+static void readArray(Common::SeekableReadStream &cache, std::vector<uint32_t> &data) {
+	const uint32_t count = cache.readUint32LE();
+	if (count > ((cache.size() - cache.pos()) / 4))
+		throw Common::Exception("Navigation cache file truncated");
+
+	data.resize(count);
+	for (std::vector<uint32_t>::iterator d = data.begin(); d != data.end(); ++d)
+		*d = cache.readUint32LE();
+}
+
+static void readArray(Common::SeekableReadStream &cache, std::vector<float> &data) {
+	const uint32_t count = cache.readUint32LE();
+	if (count > ((cache.size() - cache.pos()) / 4))
+		throw Common::Exception("Navigation cache file truncated");
+
+	data.resize(count);
+	for (std::vector<float>::iterator d = data.begin(); d != data.end(); ++d)
+		*d = cache.readIEEEFloatLE();
+}
+
+static void writeArray(Common::WriteStream &cache, const std::vector<uint32_t> &data) {
+	cache.writeUint32LE(data.size());
+	for (std::vector<uint32_t>::const_iterator d = data.begin(); d != data.end(); ++d)
+		cache.writeUint32LE(*d);
+}
+
+static void writeArray(Common::WriteStream &cache, const std::vector<float> &data) {
+	cache.writeUint32LE(data.size());
+	for (std::vector<float>::const_iterator d = data.begin(); d != data.end(); ++d)
+		cache.writeIEEEFloatLE(*d);
+}
+
+
+bool NavigationCache::isEnabled() {
+	return kConfigEnabled.get();
+}
+
+uint64_t NavigationCache::hash(uint32_t value) {
+	return Common::hashFNV64Value(Common::kFNV64OffsetBasis, value);
+}
+
+uint64_t NavigationCache::hash(uint64_t key, uint32_t value) {
+	return Common::hashFNV64Value(key, value);
+}
+
+uint64_t NavigationCache::hash(uint64_t key, uint64_t value) {
+	return Common::hashFNV64Value(key, value);
+}
+
+uint64_t NavigationCache::hash(uint64_t key, float value) {
+	return hash(key, convertIEEEFloat(value));
+}
+
+uint64_t NavigationCache::hash(uint64_t key, const Common::UString &string) {
+	key = hash(key, (uint32_t) string.size());
+
+	for (Common::UString::iterator c = string.begin(); c != string.end(); ++c)
+		key = hash(key, (uint32_t) *c);
+
+	return key;
+}
+
+uint64_t NavigationCache::hashResource(const Common::UString &name, ::Aurora::FileType type) {
+	std::unique_ptr<Common::SeekableReadStream> stream(ResMan.getResource(name, type));
+	if (!stream)
+		return kHashMissing;
+
+	return Common::hashStreamFNV64(*stream);
+}
+
+Common::UString NavigationCache::getDirectory() {
+	return Common::FilePath::getUserDataDirectory() + "/navigationcache";
+}
+
+Common::UString NavigationCache::getFileName(uint64_t key) {
+	return getDirectory() + "/" + Common::formatHash(key) + ".xnc";
+}
+
+Common::AABBNode *NavigationCache::readTree(Common::SeekableReadStream &cache) {
+	float min[3], max[3];
+	for (size_t i = 0; i < 3; i++)
+		min[i] = cache.readIEEEFloatLE();
+	for (size_t i = 0; i < 3; i++)
+		max[i] = cache.readIEEEFloatLE();
+
+	const int32_t property = cache.readSint32LE();
+	const bool hasChildren = cache.readByte() != 0;
+
+	std::unique_ptr<Common::AABBNode> node = std::make_unique<Common::AABBNode>(min, max, property);
+	if (hasChildren) {
+		std::unique_ptr<Common::AABBNode> leftChild(readTree(cache));
+		std::unique_ptr<Common::AABBNode> rightChild(readTree(cache));
+
+		node->setChildren(leftChild.release(), rightChild.release());
+	}
+
+	return node.release();
+}
+
+void NavigationCache::writeTree(Common::WriteStream &cache, const Common::AABBNode &node) {
+	float min[3], max[3];
+	node.getMin(min[0], min[1], min[2]);
+	node.getMax(max[0], max[1], max[2]);
+
+	for (size_t i = 0; i < 3; i++)
+		cache.writeIEEEFloatLE(min[i]);
+	for (size_t i = 0; i < 3; i++)
+		cache.writeIEEEFloatLE(max[i]);
+
+	cache.writeSint32LE(node.getProperty());
+	cache.writeByte(node.hasChildren() ? 1 : 0);
+
+	if (node.hasChildren()) {
+		writeTree(cache, *node.getLeftChild());
+		writeTree(cache, *node.getRightChild());
+	}
+}
+
+bool NavigationCache::load(uint64_t key, Pathfinding &pathfinding) {
+	if (!isEnabled())
+		return false;
+
+	const Common::UString fileName = getFileName(key);
+	if (!Common::FilePath::isRegularFile(fileName))
+		return false;
+
+	try {
+		Common::MappedReadStream cache(fileName);
+
+		if ((cache.readUint32BE() != kCacheID) || (cache.readUint32LE() != kCacheVersion))
+			throw Common::Exception("Not a navigation cache file");
+
+		if (cache.readUint64LE() != key)
+			throw Common::Exception("Navigation cache key mismatch");
+
+		const uint32_t polygonEdges  = cache.readUint32LE();
+		const uint32_t verticesCount = cache.readUint32LE();
+		const uint32_t facesCount    = cache.readUint32LE();
+
+		if (polygonEdges != pathfinding._polygonEdges)
+			throw Common::Exception("Navigation cache polygon mismatch (%u != %u)",
+			                        polygonEdges, pathfinding._polygonEdges);
+
+		std::vector<float> vertices;
+		std::vector<uint32_t> faces, adjFaces, faceProperty;
+
+		readArray(cache, vertices);
+		readArray(cache, faces);
+		readArray(cache, adjFaces);
+		readArray(cache, faceProperty);
+
+		if ((vertices.size() != (verticesCount * 3)) || ((faces.size() % polygonEdges) != 0))
+			throw Common::Exception("Invalid navigation cache layout");
+
+		const uint32_t treeCount = cache.readUint32LE();
+		if (treeCount > (cache.size() - cache.pos()))
+			throw Common::Exception("Navigation cache file truncated");
+
+		std::vector<std::unique_ptr<Common::AABBNode>> trees;
+		trees.reserve(treeCount);
+
+		for (uint32_t i = 0; i < treeCount; i++)
+			trees.emplace_back((cache.readByte() != 0) ? readTree(cache) : 0);
+
+		pathfinding._verticesCount = verticesCount;
+		pathfinding._facesCount    = facesCount;
+
+		pathfinding._vertices.swap(vertices);
+		pathfinding._faces.swap(faces);
+		pathfinding._adjFaces.swap(adjFaces);
+		pathfinding._faceProperty.swap(faceProperty);
+
+		for (std::vector<Common::AABBNode *>::iterator t = pathfinding._aabbTrees.begin();
+		     t != pathfinding._aabbTrees.end(); ++t)
+			delete *t;
+
+		pathfinding._aabbTrees.clear();
+		for (std::vector<std::unique_ptr<Common::AABBNode>>::iterator t = trees.begin(); t != trees.end(); ++t)
+			pathfinding._aabbTrees.push_back(t->release());
+
+		return true;
+
+	} catch (...) {
+		// We'll build the navigation data again and overwrite the broken file
+		Common::exceptionDispatcherWarning("Failed reading navigation cache file \"%s\"", fileName.c_str());
+	}
+
+	return false;
+}
+
+void NavigationCache::save(uint64_t key, const Pathfinding &pathfinding) {
+	if (!isEnabled())
+		return;
+
+	const Common::UString fileName = getFileName(key);
+
+	try {
+		Common::writeFileAtomically(fileName, [&pathfinding, key](Common::WriteStream &cache) {
+			cache.writeUint32BE(kCacheID);
+			cache.writeUint32LE(kCacheVersion);
+			cache.writeUint64LE(key);
+
+			cache.writeUint32LE(pathfinding._polygonEdges);
+			cache.writeUint32LE(pathfinding._verticesCount);
+			cache.writeUint32LE(pathfinding._facesCount);
+
+			writeArray(cache, pathfinding._vertices);
+			writeArray(cache, pathfinding._faces);
+			writeArray(cache, pathfinding._adjFaces);
+			writeArray(cache, pathfinding._faceProperty);
+
+			cache.writeUint32LE(pathfinding._aabbTrees.size());
+			for (std::vector<Common::AABBNode *>::const_iterator t = pathfinding._aabbTrees.begin();
+			     t != pathfinding._aabbTrees.end(); ++t) {
+
+				cache.writeByte(*t ? 1 : 0);
+				if (*t)
+					writeTree(cache, **t);
+			}
+		});
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed writing navigation cache file \"%s\"", fileName.c_str());
+	}
+}
+
+} // End of namespace Engines
@@ -0,0 +1,89 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  An on-disk cache of walkmesh navigation data.
+ */
+
+#ifndef ENGINES_AURORA_NAVIGATIONCACHE_H
+#define ENGINES_AURORA_NAVIGATIONCACHE_H
+
+#include "src/common/types.h"
+
+#include "src/aurora/types.h"
+
+namespace Common {
+	class SeekableReadStream;
+	class WriteStream;
+	class UString;
+	class AABBNode;
+}
+
+namespace Engines {
+
+class Pathfinding;
+
+/** An on-disk cache of walkmesh navigation data.
+ *
+ *  Before a path can be searched in an area, all its walkmeshes have to
+ *  be parsed and their faces stitched together, which takes a while in
+ *  big areas. When enabled with the "navigationcache" config option, the
+ *  finished vertices, faces, adjacencies and AABB trees are stored in the
+ *  user data directory, keyed by a hash of the source walkmeshes, and read
+ *  back out of a memory-mapped file the next time the area is loaded.
+ */
+class NavigationCache {
+public:
+	/** Is the navigation cache enabled? */
+	static bool isEnabled();
+
+	/** Start a cache key, for navigation data produced by this kind of pathfinding. */
+	static uint64_t hash(uint32_t value);
+	/** Add a value to a cache key. */
+	static uint64_t hash(uint64_t key, uint32_t value);
+	/** Add a value to a cache key. */
+	static uint64_t hash(uint64_t key, uint64_t value);
+	/** Add a value to a cache key. */
+	static uint64_t hash(uint64_t key, float value);
+	/** Add a string to a cache key. */
+	static uint64_t hash(uint64_t key, const Common::UString &string);
+
+	/** Hash the contents of a resource, to be added to a cache key. */
+	static uint64_t hashResource(const Common::UString &name, ::Aurora::FileType type);
+
+	/** Replace the walkmesh of a pathfinding object with the cached one with this key.
+	 *
+	 *  @return true if the walkmesh was found in the cache, false otherwise.
+	 */
+	static bool load(uint64_t key, Pathfinding &pathfinding);
+	/** Store the freshly built walkmesh of a pathfinding object in the cache. */
+	static void save(uint64_t key, const Pathfinding &pathfinding);
+
+private:
+	static Common::UString getDirectory();
+	static Common::UString getFileName(uint64_t key);
+
+	static Common::AABBNode *readTree(Common::SeekableReadStream &cache);
+	static void writeTree(Common::WriteStream &cache, const Common::AABBNode &node);
+};
+
+} // End of namespace Engines
+
+#endif // ENGINES_AURORA_NAVIGATIONCACHE_H
@@ -0,0 +1,513 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Hierarchical abstraction of a walkmesh, for long-distance pathfinding.
+ */
+
+#include <cmath>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <queue>
+
+#include "external/glm/common.hpp"
+#include "external/glm/geometric.hpp"
+
+#include "src/engines/aurora/pathfinding.h"
+#include "src/engines/aurora/pathabstraction.h"
+
+namespace Engines {
+
+/** Slack when deciding whether two border edges touch each other. */
+static const float kPortalGapEpsilon = 0.01f;
+
+PathAbstraction::FaceNode::FaceNode() : x(0.f), y(0.f), G(0.f), parent(UINT32_MAX),
+	search(0), closed(false) {
+}
+
+PathAbstraction::PortalNode::PortalNode() : G(0.f), parent(UINT32_MAX), cluster(UINT32_MAX),
+	search(0), closed(false) {
+}
+
+uint32_t PathAbstraction::Portal::getFace(uint32_t cluster) const {
+	return (clusters[0] == cluster) ? faces[0] : faces[1];
+}
+
+PathAbstraction::PathAbstraction(Pathfinding *pathfinding) : _pathfinding(pathfinding),
+	_faceSearch(0), _portalSearch(0) {
+}
+
+PathAbstraction::PathAbstraction(const PathAbstraction &abstraction) :
+	_pathfinding(abstraction._pathfinding), _faceCluster(abstraction._faceCluster),
+	_clusterPortals(abstraction._clusterPortals), _portals(abstraction._portals),
+	_edges(abstraction._edges), _faceSearch(0), _portalSearch(0) {
+}
+
+PathAbstraction::~PathAbstraction() {
+}
+
+void PathAbstraction::clear() {
+	_faceCluster.clear();
+	_clusterPortals.clear();
+	_portals.clear();
+	_edges.clear();
+
+	_faceNodes.clear();
+	_portalNodes.clear();
+}
+
+bool PathAbstraction::empty() const {
+	return _portals.empty();
+}
+
+void PathAbstraction::build() {
+	clear();
+
+	findClusters();
+	findPortals();
+	computeEdges();
+}
+
+void PathAbstraction::findClusters() {
+	_faceCluster.resize(_pathfinding->_facesCount, UINT32_MAX);
+	_clusterPortals.resize(_pathfinding->_flatAABBTrees.size());
+
+	// Every AABB tree is one cluster, made of the faces in its leaves
+	for (size_t c = 0; c < _pathfinding->_flatAABBTrees.size(); ++c) {
+		_pathfinding->_flatAABBTrees[c].visitLeaves([this, c](int32_t face) {
+			if ((face >= 0) && ((uint32_t) face < _faceCluster.size()))
+				_faceCluster[face] = c;
+
+			return false;
+		});
+	}
+}
+
+void PathAbstraction::findPortals() {
+	struct BorderEdge {
+		uint32_t faces[2];
+		glm::vec3 center;
+		float halfLength;
+	};
+
+	// Collect the walkable edges shared between two clusters, per couple of clusters
+	std::map<std::pair<uint32_t, uint32_t>, std::vector<BorderEdge> > borders;
+	for (uint32_t f = 0; f < _faceCluster.size(); ++f) {
+		const uint32_t cluster = _faceCluster[f];
+		if ((cluster == UINT32_MAX) || !_pathfinding->faceWalkable(f))
+			continue;
+
+		_pathfinding->getAdjacentFaces(f, UINT32_MAX, _adjFaces);
+		for (std::vector<uint32_t>::const_iterator a = _adjFaces.begin(); a != _adjFaces.end(); ++a) {
+			// Only look at each couple once
+			const uint32_t adjCluster = _faceCluster[*a];
+			if ((adjCluster == UINT32_MAX) || (adjCluster <= cluster))
+				continue;
+
+			glm::vec3 vert1, vert2;
+			if (!_pathfinding->getSharedVertices(f, *a, vert1, vert2))
+				continue;
+
+			BorderEdge edge;
+			edge.faces[0]   = f;
+			edge.faces[1]   = *a;
+			edge.center     = (vert1 + vert2) * 0.5f;
+			edge.halfLength = glm::length(vert2 - vert1) * 0.5f;
+
+			borders[std::make_pair(cluster, adjCluster)].push_back(edge);
+		}
+	}
+
+	for (std::map<std::pair<uint32_t, uint32_t>, std::vector<BorderEdge> >::iterator b = borders.begin();
+	     b != borders.end(); ++b) {
+
+		std::vector<BorderEdge> &edges = b->second;
+
+		// Order the edges along the border
+		glm::vec3 min = edges.front().center, max = edges.front().center;
+		for (std::vector<BorderEdge>::const_iterator e = edges.begin(); e != edges.end(); ++e) {
+			min = glm::min(min, e->center);
+			max = glm::max(max, e->center);
+		}
+
+		const int axis = ((max[0] - min[0]) >= (max[1] - min[1])) ? 0 : 1;
+		std::sort(edges.begin(), edges.end(), [axis](const BorderEdge &e1, const BorderEdge &e2) {
+			return e1.center[axis] < e2.center[axis];
+		});
+
+		// Every stretch of edges touching each other makes one portal, placed in its middle
+		size_t runStart = 0;
+		for (size_t e = 1; e <= edges.size(); ++e) {
+			if (e < edges.size()) {
+				const float gap = glm::length(glm::vec2(edges[e].center - edges[e - 1].center));
+				if (gap <= (edges[e].halfLength + edges[e - 1].halfLength + kPortalGapEpsilon))
+					continue;
+			}
+
+			const BorderEdge &middle = edges[(runStart + e - 1) / 2];
+
+			Portal portal;
+			portal.clusters[0] = b->first.first;
+			portal.clusters[1] = b->first.second;
+			portal.faces[0]    = middle.faces[0];
+			portal.faces[1]    = middle.faces[1];
+			portal.x           = middle.center[0];
+			portal.y           = middle.center[1];
+
+			_clusterPortals[portal.clusters[0]].push_back(_portals.size());
+			_clusterPortals[portal.clusters[1]].push_back(_portals.size());
+			_portals.push_back(portal);
+
+			runStart = e;
+		}
+	}
+}
+
+void PathAbstraction::computeEdges() {
+	_edges.resize(_portals.size());
+
+	// For every portal, walk through both its clusters to find the cost to all other portals there
+	std::vector<Edge> costs;
+	for (uint32_t c = 0; c < _clusterPortals.size(); ++c) {
+		const std::vector<uint32_t> &portals = _clusterPortals[c];
+		if (portals.size() < 2)
+			continue;
+
+		for (std::vector<uint32_t>::const_iterator p = portals.begin(); p != portals.end(); ++p) {
+			const Portal &portal = _portals[*p];
+
+			searchCluster(c, portal.getFace(c), portal.x, portal.y);
+			getPortalCosts(c, costs);
+
+			for (std::vector<Edge>::const_iterator e = costs.begin(); e != costs.end(); ++e)
+				if (e->portal != *p)
+					_edges[*p].push_back(*e);
+		}
+	}
+}
+
+bool PathAbstraction::findPath(float startX, float startY, float endX, float endY,
+                               std::vector<uint32_t> &facePath) {
+
+	facePath.clear();
+
+	if (empty())
+		return false;
+
+	const uint32_t startFace = _pathfinding->findFace(startX, startY, false);
+	const uint32_t endFace   = _pathfinding->findFace(endX, endY, false);
+	if ((startFace == UINT32_MAX) || (endFace == UINT32_MAX) || (startFace == endFace))
+		return false;
+
+	if ((startFace >= _faceCluster.size()) || (endFace >= _faceCluster.size()))
+		return false;
+
+	if (!_pathfinding->faceWalkable(startFace) || !_pathfinding->faceWalkable(endFace))
+		return false;
+
+	// Short paths within one cluster are cheap enough to search directly
+	const uint32_t startCluster = _faceCluster[startFace];
+	const uint32_t endCluster   = _faceCluster[endFace];
+	if ((startCluster == UINT32_MAX) || (endCluster == UINT32_MAX) || (startCluster == endCluster))
+		return false;
+
+	std::vector<uint32_t> portals, clusters;
+	if (!findPortalPath(startCluster, startFace, startX, startY,
+	                    endCluster, endFace, endX, endY, portals, clusters))
+		return false;
+
+	// Refine every step between two portals into faces
+	uint32_t face = startFace;
+	float x = startX, y = startY;
+
+	for (size_t i = 0; i < portals.size(); ++i) {
+		const Portal &portal = _portals[portals[i]];
+		const uint32_t target = portal.getFace(clusters[i]);
+
+		if (!searchCluster(clusters[i], face, x, y, target, portal.x, portal.y)) {
+			facePath.clear();
+			return false;
+		}
+
+		appendFacePath(target, facePath);
+
+		const uint32_t nextCluster = ((i + 1) < portals.size()) ? clusters[i + 1] : endCluster;
+
+		face = portal.getFace(nextCluster);
+		x    = portal.x;
+		y    = portal.y;
+	}
+
+	if (!searchCluster(endCluster, face, x, y, endFace, endX, endY)) {
+		facePath.clear();
+		return false;
+	}
+
+	appendFacePath(endFace, facePath);
+	return true;
+}
+
+bool PathAbstraction::findPortalPath(uint32_t startCluster, uint32_t startFace, float startX, float startY,
+                                     uint32_t endCluster, uint32_t endFace, float endX, float endY,
+                                     std::vector<uint32_t> &portals, std::vector<uint32_t> &clusters) {
+
+	portals.clear();
+	clusters.clear();
+
+	// Connect both points to the portals of their cluster
+	std::vector<Edge> startCosts, endCosts;
+
+	searchCluster(startCluster, startFace, startX, startY);
+	getPortalCosts(startCluster, startCosts);
+
+	searchCluster(endCluster, endFace, endX, endY);
+	getPortalCosts(endCluster, endCosts);
+
+	if (startCosts.empty() || endCosts.empty())
+		return false;
+
+	startPortalSearch();
+
+	std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry> > open;
+
+	for (std::vector<Edge>::const_iterator s = startCosts.begin(); s != startCosts.end(); ++s) {
+		PortalNode &node = getPortalNode(s->portal);
+
+		node.G       = s->cost;
+		node.cluster = startCluster;
+
+		const Portal &portal = _portals[s->portal];
+		open.push(QueueEntry(node.G + getDistance(portal.x, portal.y, endX, endY), s->portal));
+	}
+
+	uint32_t bestPortal = UINT32_MAX;
+	float bestCost = 0.f;
+
+	while (!open.empty()) {
+		const QueueEntry entry = open.top();
+		open.pop();
+
+		// Nothing left can beat what we already have
+		if ((bestPortal != UINT32_MAX) && (entry.first >= bestCost))
+			break;
+
+		PortalNode &current = _portalNodes[entry.second];
+		if (current.closed)
+			continue;
+
+		current.closed = true;
+
+		// Can we reach the end point from here?
+		for (std::vector<Edge>::const_iterator e = endCosts.begin(); e != endCosts.end(); ++e) {
+			if (e->portal != entry.second)
+				continue;
+
+			const float cost = current.G + e->cost;
+			if ((bestPortal == UINT32_MAX) || (cost < bestCost)) {
+				bestPortal = entry.second;
+				bestCost   = cost;
+			}
+		}
+
+		const std::vector<Edge> &edges = _edges[entry.second];
+		for (std::vector<Edge>::const_iterator e = edges.begin(); e != edges.end(); ++e) {
+			const bool isThere = _portalNodes[e->portal].search == _portalSearch;
+			if (isThere && _portalNodes[e->portal].closed)
+				continue;
+
+			const float gScore = current.G + e->cost;
+			if (isThere && (gScore >= _portalNodes[e->portal].G))
+				continue;
+
+			PortalNode &adjNode = getPortalNode(e->portal);
+			adjNode.G       = gScore;
+			adjNode.parent  = entry.second;
+			adjNode.cluster = e->cluster;
+
+			const Portal &portal = _portals[e->portal];
+			open.push(QueueEntry(gScore + getDistance(portal.x, portal.y, endX, endY), e->portal));
+		}
+	}
+
+	if (bestPortal == UINT32_MAX)
+		return false;
+
+	for (uint32_t p = bestPortal; p != UINT32_MAX; p = _portalNodes[p].parent) {
+		portals.push_back(p);
+		clusters.push_back(_portalNodes[p].cluster);
+	}
+
+	std::reverse(portals.begin(), portals.end());
+	std::reverse(clusters.begin(), clusters.end());
+
+	return true;
+}
+
+bool PathAbstraction::searchCluster(uint32_t cluster, uint32_t startFace, float startX, float startY,
+                                    uint32_t targetFace, float targetX, float targetY) {
+
+	startFaceSearch();
+
+	const bool hasTarget = targetFace != UINT32_MAX;
+
+	std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry> > open;
+
+	FaceNode &startNode = getFaceNode(startFace);
+	startNode.x = startX;
+	startNode.y = startY;
+
+	open.push(QueueEntry(hasTarget ? getDistance(startX, startY, targetX, targetY) : 0.f, startFace));
+
+	while (!open.empty()) {
+		const uint32_t face = open.top().second;
+		open.pop();
+
+		FaceNode &current = _faceNodes[face];
+		if (current.closed)
+			continue;
+
+		if (face == targetFace)
+			return true;
+
+		current.closed = true;
+
+		_pathfinding->getAdjacentFaces(face, current.parent, _adjFaces);
+		for (std::vector<uint32_t>::const_iterator a = _adjFaces.begin(); a != _adjFaces.end(); ++a) {
+			// Stay inside the cluster
+			if (_faceCluster[*a] != cluster)
+				continue;
+
+			const bool isThere = hasFaceNode(*a);
+			if (isThere && _faceNodes[*a].closed)
+				continue;
+
+			float x, y;
+			_pathfinding->getAdjacencyCenter(face, *a, x, y);
+
+			const float gScore = current.G + getDistance(current.x, current.y, x, y);
+			if (isThere && (gScore >= _faceNodes[*a].G))
+				continue;
+
+			FaceNode &adjNode = getFaceNode(*a);
+			adjNode.x      = x;
+			adjNode.y      = y;
+			adjNode.G      = gScore;
+			adjNode.parent = face;
+
+			open.push(QueueEntry(gScore + (hasTarget ? getDistance(x, y, targetX, targetY) : 0.f), *a));
+		}
+	}
+
+	return !hasTarget;
+}
+
+void PathAbstraction::getPortalCosts(uint32_t cluster, std::vector<Edge> &costs) const {
+	costs.clear();
+
+	const std::vector<uint32_t> &portals = _clusterPortals[cluster];
+	for (std::vector<uint32_t>::const_iterator p = portals.begin(); p != portals.end(); ++p) {
+		const Portal &portal = _portals[*p];
+
+		const uint32_t face = portal.getFace(cluster);
+		if (!hasFaceNode(face))
+			continue;
+
+		const FaceNode &node = _faceNodes[face];
+
+		Edge edge;
+		edge.portal  = *p;
+		edge.cluster = cluster;
+		edge.cost    = node.G + getDistance(node.x, node.y, portal.x, portal.y);
+
+		costs.push_back(edge);
+	}
+}
+
+void PathAbstraction::appendFacePath(uint32_t endFace, std::vector<uint32_t> &facePath) const {
+	const size_t start = facePath.size();
+
+	for (uint32_t face = endFace; face != UINT32_MAX; face = _faceNodes[face].parent)
+		facePath.push_back(face);
+
+	std::reverse(facePath.begin() + start, facePath.end());
+
+	// The previous step ended on the face this one starts at
+	if ((start > 0) && (start < facePath.size()) && (facePath[start - 1] == facePath[start]))
+		facePath.erase(facePath.begin() + start);
+}
+
+void PathAbstraction::startFaceSearch() {
+	if (_faceNodes.size() < _faceCluster.size())
+		_faceNodes.resize(_faceCluster.size());
+
+	// Instead of resetting all nodes, we just ignore the ones from earlier searches
+	if (++_faceSearch == 0) {
+		for (std::vector<FaceNode>::iterator n = _faceNodes.begin(); n != _faceNodes.end(); ++n)
+			n->search = 0;
+
+		_faceSearch = 1;
+	}
+}
+
+void PathAbstraction::startPortalSearch() {
+	if (_portalNodes.size() < _portals.size())
+		_portalNodes.resize(_portals.size());
+
+	if (++_portalSearch == 0) {
+		for (std::vector<PortalNode>::iterator n = _portalNodes.begin(); n != _portalNodes.end(); ++n)
+			n->search = 0;
+
+		_portalSearch = 1;
+	}
+}
+
+bool PathAbstraction::hasFaceNode(uint32_t face) const {
+	return _faceNodes[face].search == _faceSearch;
+}
+
+PathAbstraction::FaceNode &PathAbstraction::getFaceNode(uint32_t face) {
+	FaceNode &node = _faceNodes[face];
+
+	if (node.search != _faceSearch) {
+		node = FaceNode();
+		node.search = _faceSearch;
+	}
+
+	return node;
+}
+
+PathAbstraction::PortalNode &PathAbstraction::getPortalNode(uint32_t portal) {
+	PortalNode &node = _portalNodes[portal];
+
+	if (node.search != _portalSearch) {
+		node = PortalNode();
+		node.search = _portalSearch;
+	}
+
+	return node;
+}
+
+float PathAbstraction::getDistance(float xA, float yA, float xB, float yB) {
+	return sqrtf((xA - xB) * (xA - xB) + (yA - yB) * (yA - yB));
+}
+
+} // End of namespace Engines
@@ -0,0 +1,167 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Hierarchical abstraction of a walkmesh, for long-distance pathfinding.
+ */
+
+#ifndef ENGINES_PATHABSTRACTION_H
+#define ENGINES_PATHABSTRACTION_H
+
+#include <vector>
+
+#include "src/common/types.h"
+
+namespace Engines {
+
+class Pathfinding;
+
+/** A precomputed, coarse view of a walkmesh.
+ *
+ *  Every AABB tree of the walkmesh (a tile, or a room) makes one cluster.
+ *  Where walkable faces of two clusters touch, a portal is placed in the
+ *  middle of each continuous stretch of the shared border. The costs of
+ *  crossing a cluster from one of its portals to each of the others are
+ *  computed once, when the abstraction is built.
+ *
+ *  A long path is then first searched among the portals only, and each
+ *  step is afterwards refined into faces inside a single cluster. This
+ *  keeps the cost of a query mostly independent of the distance.
+ */
+class PathAbstraction {
+public:
+	PathAbstraction(Pathfinding *pathfinding);
+	/** Share a built abstraction, with a search state of its own. */
+	PathAbstraction(const PathAbstraction &abstraction);
+	~PathAbstraction();
+
+	/** (Re)build the clusters, portals and their costs from the walkmesh. */
+	void build();
+	/** Throw away the abstraction. */
+	void clear();
+
+	/** Was an abstraction with at least one portal built? */
+	bool empty() const;
+
+	/** Find a path of faces between two points across clusters.
+	 *
+	 *  Only searches between points in different clusters are handled here.
+	 *  If false is returned, the caller should fall back to a plain search.
+	 *
+	 *  @param startX       The x component of the starting point.
+	 *  @param startY       The y component of the starting point.
+	 *  @param endX         The x component of the ending point.
+	 *  @param endY         The y component of the ending point.
+	 *  @param facePath     The vector where the path will be stored.
+	 *  @return             Return true if a path is found. False otherwise.
+	 */
+	bool findPath(float startX, float startY, float endX, float endY, std::vector<uint32_t> &facePath);
+
+private:
+	/** A crossing between two clusters. */
+	struct Portal {
+		uint32_t clusters[2]; ///< The two clusters the portal connects.
+		uint32_t faces[2];    ///< The face on each side of the portal.
+		float x;              ///< The x position of the portal.
+		float y;              ///< The y position of the portal.
+
+		/** The face of the portal inside a given cluster. */
+		uint32_t getFace(uint32_t cluster) const;
+	};
+
+	/** The cached cost of going from one portal to another, inside one cluster. */
+	struct Edge {
+		uint32_t portal;  ///< The portal this edge leads to.
+		uint32_t cluster; ///< The cluster this edge goes through.
+		float cost;       ///< The length of the walk.
+	};
+
+	/** A face within a cluster-restricted search. */
+	struct FaceNode {
+		float x;         ///< The x position the face is entered at.
+		float y;         ///< The y position the face is entered at.
+		float G;         ///< Cost from the starting point.
+		uint32_t parent; ///< The face we came from, UINT32_MAX for none.
+		uint32_t search; ///< The search this node was last visited in.
+		bool closed;     ///< Has this node been evaluated already?
+
+		FaceNode();
+	};
+
+	/** A portal within the abstract search. */
+	struct PortalNode {
+		float G;          ///< Cost from the starting point.
+		uint32_t parent;  ///< The portal we came from, UINT32_MAX for the start.
+		uint32_t cluster; ///< The cluster we walked through to get here.
+		uint32_t search;  ///< The search this node was last visited in.
+		bool closed;      ///< Has this node been evaluated already?
+
+		PortalNode();
+	};
+
+	typedef std::pair<float, uint32_t> QueueEntry;
+
+	Pathfinding *_pathfinding;
+
+	std::vector<uint32_t> _faceCluster;                ///< The cluster of each face.
+	std::vector<std::vector<uint32_t> > _clusterPortals; ///< The portals of each cluster.
+	std::vector<Portal> _portals;
+	std::vector<std::vector<Edge> > _edges;            ///< The edges leaving each portal.
+
+	std::vector<FaceNode> _faceNodes;
+	std::vector<PortalNode> _portalNodes;
+	uint32_t _faceSearch;
+	uint32_t _portalSearch;
+
+	std::vector<uint32_t> _adjFaces;
+
+	void findClusters();
+	void findPortals();
+	void computeEdges();
+
+	/** Search the faces of a cluster, starting at a point.
+	 *
+	 *  If a target face is given, the search stops as soon as it is reached.
+	 *  Otherwise, the whole cluster is explored.
+	 */
+	bool searchCluster(uint32_t cluster, uint32_t startFace, float startX, float startY,
+	                   uint32_t targetFace = UINT32_MAX, float targetX = 0.f, float targetY = 0.f);
+	/** Cost to reach each portal of the cluster, after an exhaustive searchCluster(). */
+	void getPortalCosts(uint32_t cluster, std::vector<Edge> &costs) const;
+	/** Append the faces found by the last searchCluster(), up to a face. */
+	void appendFacePath(uint32_t endFace, std::vector<uint32_t> &facePath) const;
+
+	/** Find the sequence of portals between two points. */
+	bool findPortalPath(uint32_t startCluster, uint32_t startFace, float startX, float startY,
+	                    uint32_t endCluster, uint32_t endFace, float endX, float endY,
+	                    std::vector<uint32_t> &portals, std::vector<uint32_t> &clusters);
+
+	void startFaceSearch();
+	void startPortalSearch();
+	bool hasFaceNode(uint32_t face) const;
+	FaceNode &getFaceNode(uint32_t face);
+	PortalNode &getPortalNode(uint32_t portal);
+
+	static float getDistance(float xA, float yA, float xB, float yB);
+};
+
+} // End of namespace Engines
+
+#endif // ENGINES_PATHABSTRACTION_H
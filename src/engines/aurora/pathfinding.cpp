@@ -24,8 +24,6 @@
 
 #include <algorithm>
 
-#include "external/glm/gtx/intersect.hpp"
-
 #include "src/common/util.h"
 #include "src/common/maths.h"
 #include "src/common/geometry.h"
@@ -36,6 +34,7 @@
 #include "src/graphics/aurora/line.h"
 
 #include "src/engines/aurora/astar.h"
+#include "src/engines/aurora/pathabstraction.h"
 #include "src/engines/aurora/pathfinding.h"
 
 namespace Engines {
@@ -43,7 +42,11 @@ namespace Engines {
 Pathfinding::Pathfinding(std::vector<bool> walkableProperties, uint32_t polygonEdges) :
                          _polygonEdges(polygonEdges), _verticesCount(0), _facesCount(0),
                          _epsilon(0.f), _pathVisible(false), _walkmeshVisible(false),
-                         _walkableProperties(walkableProperties), _aStarAlgorithm(0) {
+                         _walkableProperties(walkableProperties), _aStarAlgorithm(0),
+                         _pathAbstraction(0) {
+
+	if (_polygonEdges > kMaxPolygonEdges)
+		error("Number of edges not supported");
 
 	_pathDrawing = new Graphics::Aurora::Line();
 	_walkmeshDrawing = new Graphics::Aurora::Walkmesh(this);
@@ -56,6 +59,7 @@ Pathfinding::~Pathfinding() {
 		delete *it;
 
 	delete _aStarAlgorithm;
+	delete _pathAbstraction;
 }
 
 void Pathfinding::showPath(bool visible) {
@@ -88,11 +92,47 @@ bool Pathfinding::findPath(float startX, float startY, float endX, float endY,
 		return false;
 	}
 
-	bool result = _aStarAlgorithm->findPath(startX, startY, endX, endY, facePath, width, nbrIt);
+	bool result = searchPath(*_aStarAlgorithm, _pathAbstraction, startX, startY, endX, endY,
+	                         facePath, width, nbrIt);
 	_walkmeshDrawing->setFaces(facePath);
 	return result;
 }
 
+bool Pathfinding::searchPath(AStar &aStarAlgorithm, PathAbstraction *pathAbstraction,
+                             float startX, float startY, float endX, float endY,
+                             std::vector<uint32_t> &facePath, float width, uint32_t nbrIt) {
+
+	if (!walkable(glm::vec3(startX, startY, 0.f))) {
+		facePath.clear();
+		return false;
+	}
+
+	// Look for long paths on the abstraction first. It doesn't account for the creature's width
+	if (pathAbstraction && (width <= 0.f) &&
+	    pathAbstraction->findPath(startX, startY, endX, endY, facePath))
+		return true;
+
+	return aStarAlgorithm.findPath(startX, startY, endX, endY, facePath, width, nbrIt);
+}
+
+void Pathfinding::flattenAABBTrees() {
+	_flatAABBTrees.clear();
+	_flatAABBTrees.reserve(_aabbTrees.size());
+
+	for (std::vector<Common::AABBNode *>::const_iterator t = _aabbTrees.begin(); t != _aabbTrees.end(); ++t) {
+		_flatAABBTrees.push_back(Common::AABBTree());
+		if (*t)
+			_flatAABBTrees.back().build(**t);
+	}
+}
+
+void Pathfinding::buildPathAbstraction() {
+	if (!_pathAbstraction)
+		_pathAbstraction = new PathAbstraction(this);
+
+	_pathAbstraction->build();
+}
+
 bool Pathfinding::isToTheLeft(glm::vec3 startSegment, glm::vec3 endSegment, glm::vec3 point) const {
 	return glm::cross((endSegment - startSegment), point - startSegment)[2] > 0;
 }
@@ -108,17 +148,38 @@ glm::vec3 Pathfinding::getOrthonormalVec(glm::vec3 segment, bool clockwise) cons
 
 void Pathfinding::smoothPath(float startX, float startY, float endX, float endY,
                              std::vector<uint32_t> &facePath, std::vector<glm::vec3> &path) {
+	funnelPath(startX, startY, endX, endY, facePath, path, _funnelBuffer);
+
+	// Drawing part.
+	std::vector<glm::vec3> pathToDraw;
+	for (std::vector<glm::vec3>::iterator f = path.begin(); f != path.end(); ++f)
+		pathToDraw.push_back(*f);
+
+	for (std::vector<glm::vec3>::iterator it = pathToDraw.begin(); it != pathToDraw.end(); ++it) {
+		(*it)[2] = getHeight((*it)[0], (*it)[1], true);
+	}
+	_pathDrawing->setVertices(pathToDraw);
+}
+
+void Pathfinding::funnelPath(float startX, float startY, float endX, float endY,
+                             std::vector<uint32_t> &facePath, std::vector<glm::vec3> &path,
+                             FunnelBuffer &buffer) {
 	// Use Vector3 for simplicity and vectorial operations.
 	glm::vec3 start(startX, startY, 0.f);
 	glm::vec3 end(endX, endY, 0.f);
 
 	// Vector that will store positions of each vertex of the path of faces.
-	std::vector<glm::vec3> tunnel;
+	std::vector<glm::vec3> &tunnel = buffer.tunnel;
 	// Indicate if the position is to the left or to the right.
-	std::vector<bool> tunnelLeftRight;
+	std::vector<bool> &tunnelLeftRight = buffer.leftRight;
+
+	// Keep the storage of the previous paths.
+	tunnel.clear();
+	tunnelLeftRight.clear();
 
-	// Vector that will store the vertices that we will keep.
-	std::vector<uint32_t> funnelIdx;
+	// The apexes of the funnel are written straight to the path. A vertex
+	// behind the apex is never touched again, so they are already final.
+	path.push_back(start);
 
 	tunnel.push_back(start);
 	tunnelLeftRight.push_back(true);
@@ -152,7 +213,7 @@ void Pathfinding::smoothPath(float startX, float startY, float endX, float endY,
 			// is it the ending point?
 			if (apex != feeler[!tunnelLeftRight[c]] && (close(tunnel[c], tunnel[feeler[!tunnelLeftRight[c]]])
 			    || (glm::cross(v, feelerVector[!tunnelLeftRight[c]])[2] < 0.f) != tunnelLeftRight[c])) {
-				funnelIdx.push_back(apex);
+				path.push_back(tunnel[apex]);
 
 				// Move the apex to the opposite feeler.
 				apex = feeler[!tunnelLeftRight[c]];
@@ -176,22 +237,8 @@ void Pathfinding::smoothPath(float startX, float startY, float endX, float endY,
 		}
 	}
 
-	path.push_back(start);
-	for (size_t point = 0; point < funnelIdx.size(); ++point)
-		path.push_back(tunnel[funnelIdx[point]]);
-
 	// Assume end path is walkable.
 	path.push_back(end);
-
-	// Drawing part.
-	std::vector<glm::vec3> pathToDraw;
-	for (std::vector<glm::vec3>::iterator f = path.begin(); f != path.end(); ++f)
-		pathToDraw.push_back(*f);
-
-	for (std::vector<glm::vec3>::iterator it = pathToDraw.begin(); it != pathToDraw.end(); ++it) {
-		(*it)[2] = getHeight((*it)[0], (*it)[1], true);
-	}
-	_pathDrawing->setVertices(pathToDraw);
 }
 
 void Pathfinding::getVerticesTunnel(std::vector<uint32_t> &facePath, std::vector<glm::vec3> &tunnel,
@@ -199,12 +246,12 @@ void Pathfinding::getVerticesTunnel(std::vector<uint32_t> &facePath, std::vector
 	if (facePath.size() < 2)
 		return;
 
-	std::vector<glm::vec3> cVerts, pVerts;
+	glm::vec3 cVerts[kMaxPolygonEdges], pVerts[kMaxPolygonEdges];
 	int32_t returnPoint = -1;
 
 	for (size_t face = 1; face < facePath.size(); ++face) {
-		getVertices(facePath[face], cVerts, false);
-		getVertices(facePath[face - 1], pVerts, false);
+		getFaceVertices(facePath[face], cVerts, false);
+		getFaceVertices(facePath[face - 1], pVerts, false);
 
 		if (face == 1) {
 			// Find the first left and right by comparing to the next face.
@@ -286,6 +333,10 @@ void Pathfinding::getVertices(uint32_t faceID, std::vector<glm::vec3> &vertices,
 	}
 }
 
+void Pathfinding::getFaceVertices(uint32_t faceID, glm::vec3 *vertices, bool xyPlane) const {
+	for (uint32_t v = 0; v < _polygonEdges; ++v)
+		getVertex(_faces[faceID * _polygonEdges + v], vertices[v], xyPlane);
+}
 
 void Pathfinding::getVertex(uint32_t vertexID, glm::vec3 &vertex, bool xyPlane) const {
 	// Don't take the z component into account.
@@ -298,59 +349,67 @@ bool Pathfinding::walkableAASquare(glm::vec3 center, float halfWidth) {
 	glm::vec2 min(center[0] - halfWidth, center[1] - halfWidth);
 	glm::vec2 max(center[0] + halfWidth, center[1] + halfWidth);
 
-	std::vector<Common::AABBNode *> nodesIn;
-	for (std::vector<Common::AABBNode *>::iterator n = _aabbTrees.begin(); n != _aabbTrees.end(); ++n) {
-		if (*n)
-			(*n)->getNodesInAABox(min, max, nodesIn);
-	}
-
-	std::vector<glm::vec3> vertices;
-	for (std::vector<Common::AABBNode *>::iterator n = nodesIn.begin(); n != nodesIn.end(); ++n) {
-		uint32_t face = (*n)->getProperty();
-		getVertices(face, vertices);
+	glm::vec3 vertices[kMaxPolygonEdges];
+	auto blocked = [&](int32_t property) {
+		const uint32_t face = property;
+		getFaceVertices(face, vertices);
 
 		if (_polygonEdges == 3) {
 			if (!Common::intersectBoxTriangle2D(min, max, vertices[0], vertices[1], vertices[2]))
-				continue;
+				return false;
 		} else if (_polygonEdges == 4) {
-			glm::vec2 vertMin(vertices[0][0], vertices[0][1]);
-			glm::vec2 vertMax(vertices[1][0], vertices[1][1]);
 			if (!Common::intersectBoxes3D(min, max, vertices[0], vertices[1]))
-				continue;
+				return false;
 		}
 
-		if (!faceWalkable(face))
+		return !faceWalkable(face);
+	};
+
+	for (std::vector<Common::AABBTree>::const_iterator t = _flatAABBTrees.begin(); t != _flatAABBTrees.end(); ++t) {
+		if (t->visitAABox(min, max, blocked))
 			return false;
 	}
 	return true;
 }
 
 bool Pathfinding::walkableSegment(glm::vec3 start, glm::vec3 end) {
-	std::vector<Common::AABBNode *> nodesIn;
+	// Only unwalkable faces can block, so test those, in batches of triangles.
+	glm::vec2 vertA[Common::kIntersectBatchSize];
+	glm::vec2 vertB[Common::kIntersectBatchSize];
+	glm::vec2 vertC[Common::kIntersectBatchSize];
+	size_t count = 0;
+
+	auto flush = [&]() {
+		const uint32_t hits = Common::intersectSegmentTriangles2D(start, end, vertA, vertB, vertC, count);
+
+		count = 0;
+		return hits != 0;
+	};
+
+	glm::vec3 vertFace[kMaxPolygonEdges];
+	auto blocked = [&](int32_t property) {
+		const uint32_t face = property;
+		if (faceWalkable(face))
+			return false;
 
-	for (std::vector<Common::AABBNode *>::iterator n = _aabbTrees.begin(); n != _aabbTrees.end(); ++n) {
-		if (*n)
-			(*n)->getNodesInSegment(start, end, nodesIn);
-	}
+		getFaceVertices(face, vertFace);
 
-	std::vector<glm::vec3> vertFace;
-	for (std::vector<Common::AABBNode *>::iterator n = nodesIn.begin(); n != nodesIn.end(); ++n) {
-		uint32_t face = (*n)->getProperty();
-		getVertices(face, vertFace);
+		if (_polygonEdges == 4)
+			return Common::intersectBoxSegment2D(vertFace[0], vertFace[2], start, end);
 
-		if (_polygonEdges == 3) {
-			if (!Common::intersectTriangleSegment2D(vertFace[0], vertFace[1], vertFace[2],
-			                                        start, end))
-				continue;
-		} else if (_polygonEdges == 4) {
-			if (!Common::intersectBoxSegment2D(vertFace[0], vertFace[2], start, end))
-				continue;
-		}
+		vertA[count] = vertFace[0];
+		vertB[count] = vertFace[1];
+		vertC[count] = vertFace[2];
 
-		if (!faceWalkable(face))
+		return (++count == Common::kIntersectBatchSize) && flush();
+	};
+
+	for (std::vector<Common::AABBTree>::const_iterator t = _flatAABBTrees.begin(); t != _flatAABBTrees.end(); ++t) {
+		if (t->visitSegment2D(start, end, blocked))
 			return false;
 	}
-	return true;
+
+	return (count == 0) || !flush();
 }
 
 bool Pathfinding::walkable(glm::vec3 point) {
@@ -382,26 +441,23 @@ float Pathfinding::getHeight(float x, float y, bool onlyWalkable) const {
 }
 
 uint32_t Pathfinding::findFace(float x, float y, bool onlyWalkable) {
-	for (std::vector<Common::AABBNode *>::iterator it = _aabbTrees.begin(); it != _aabbTrees.end(); ++it) {
-		if (*it == 0)
-			continue;
-
-		if (!(*it)->isIn(x, y))
-			continue;
+	uint32_t found = UINT32_MAX;
+	auto matches = [&](int32_t property) {
+		const uint32_t face = property;
+		// Check walkability
+		if (onlyWalkable && !faceWalkable(face))
+			return false;
 
-		std::vector<Common::AABBNode *> nodes;
-		(*it)->getNodes(x, y, nodes);
-		for (uint n = 0; n < nodes.size(); ++n) {
-			uint32_t face = nodes[n]->getProperty();
-			// Check walkability
-			if (onlyWalkable && !faceWalkable(face))
-				continue;
+		if (!inFace(face, glm::vec3(x, y, 0.f)))
+			return false;
 
-			if (!inFace(face, glm::vec3(x, y, 0.f)))
-				continue;
+		found = face;
+		return true;
+	};
 
-			return face;
-		}
+	for (std::vector<Common::AABBTree>::const_iterator t = _flatAABBTrees.begin(); t != _flatAABBTrees.end(); ++t) {
+		if (t->visitPoint(x, y, matches))
+			return found;
 	}
 
 	return UINT32_MAX;
@@ -409,29 +465,55 @@ uint32_t Pathfinding::findFace(float x, float y, bool onlyWalkable) {
 
 bool Pathfinding::findIntersection(float x1, float y1, float z1, float x2, float y2, float z2,
                                    glm::vec3 &intersect, bool onlyWalkable) const {
-	for (size_t it = 0; it < _aabbTrees.size(); ++it) {
-		if (_aabbTrees[it] == 0)
-			continue;
+	const glm::vec3 start(x1, y1, z1);
+	const glm::vec3 end(x2, y2, z2);
+	const glm::vec3 direction = glm::normalize(end - start);
+
+	// Test the candidate faces in batches, keeping the first hit in traversal order.
+	glm::vec3 vertA[Common::kIntersectBatchSize];
+	glm::vec3 vertB[Common::kIntersectBatchSize];
+	glm::vec3 vertC[Common::kIntersectBatchSize];
+	size_t count = 0;
+
+	auto flush = [&]() {
+		float distances[Common::kIntersectBatchSize];
+		const uint32_t hits = Common::intersectRayTriangles(start, direction, vertA, vertB, vertC,
+		                                                    count, distances);
+
+		count = 0;
+		if (hits == 0)
+			return false;
 
-		if (!_aabbTrees[it]->isIn(x1, y1, z1, x2, y2, z2))
-			continue;
+		size_t first = 0;
+		while (!(hits & (1u << first)))
+			first++;
+
+		intersect = start + direction * distances[first];
+		return true;
+	};
+
+	glm::vec3 vertFace[kMaxPolygonEdges];
+	auto matches = [&](int32_t property) {
+		const uint32_t face = property;
+		if (onlyWalkable && !faceWalkable(face))
+			return false;
 
-		std::vector<Common::AABBNode *> nodes;
-		_aabbTrees[it]->getNodes(x1, y1, z1, x2, y2, z2, nodes);
-		for (uint n = 0; n < nodes.size(); ++n) {
-			uint32_t face = nodes[n]->getProperty();
-			if (!inFace(face, glm::vec3(x1, y1, z1), glm::vec3(x2, y2, z2), intersect))
-				continue;
+		getFaceVertices(face, vertFace, false);
 
-			if (onlyWalkable && !faceWalkable(face))
-				continue;
+		vertA[count] = vertFace[0];
+		vertB[count] = vertFace[1];
+		vertC[count] = vertFace[2];
 
+		return (++count == Common::kIntersectBatchSize) && flush();
+	};
+
+	for (std::vector<Common::AABBTree>::const_iterator t = _flatAABBTrees.begin(); t != _flatAABBTrees.end(); ++t) {
+		if (t->visitSegment(start, end, matches))
 			return true;
-		}
 	}
 
 	// Face not found
-	return false;
+	return (count > 0) && flush();
 }
 
 bool Pathfinding::goThrough(uint32_t fromFace, uint32_t toFace, float width) {
@@ -527,8 +609,8 @@ bool Pathfinding::inFace(uint32_t faceID, glm::vec3 point) const {
 	// Ensure we are in the XY plane.
 	point[2] = 0.f;
 
-	std::vector<glm::vec3> vertices;
-	getVertices(faceID, vertices);
+	glm::vec3 vertices[kMaxPolygonEdges];
+	getFaceVertices(faceID, vertices);
 
 	if (_polygonEdges == 3) {
 		return Common::intersectTrianglePoint2D(point, vertices[0], vertices[1], vertices[2]);
@@ -543,29 +625,11 @@ bool Pathfinding::inFace(uint32_t faceID, glm::vec3 point) const {
 	return false;
 }
 
-bool Pathfinding::inFace(uint32_t faceID, glm::vec3 lineStart, glm::vec3 lineEnd, glm::vec3 &intersect) const {
-	std::vector<glm::vec3> vertices;
-	getVertices(faceID, vertices, false);
-
-	glm::vec3 direction = glm::normalize(lineEnd - lineStart);
-	glm::vec2 baryPosition;
-	float distance;
-	if (glm::intersectRayTriangle(lineStart, direction,
-	                              vertices[0], vertices[1], vertices[2],
-	                              baryPosition, distance)) {
-		// Barycentric coordonate to cartesian.
-		intersect = lineStart + direction * distance;
-		return true;
-	}
-
-	return false;
-}
-
 bool Pathfinding::getSharedVertices(uint32_t face1, uint32_t face2, glm::vec3 &vert1, glm::vec3 &vert2) const {
 	for (uint8_t i = 0; i < _polygonEdges; ++i) {
 		if (_adjFaces[face1 * _polygonEdges + i] == face2) {
-			std::vector<glm::vec3> vertices;
-			getVertices(face1, vertices);
+			glm::vec3 vertices[kMaxPolygonEdges];
+			getFaceVertices(face1, vertices);
 			vert1 = vertices[i];
 			vert2 = vertices[(i + 1) % _polygonEdges];
 
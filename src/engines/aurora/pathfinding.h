@@ -28,6 +28,7 @@
 #include "external/glm/vec3.hpp"
 
 #include "src/common/ustring.h"
+#include "src/common/aabbtree.h"
 
 #include "src/graphics/renderable.h"
 
@@ -48,6 +49,17 @@ namespace Engines {
 
 class LocalPathfinding;
 class AStar;
+class PathAbstraction;
+class PathQueue;
+class NavigationCache;
+
+/** Storage for smoothing paths that is kept between paths, so that it doesn't
+ *  need to be allocated anew every time.
+ */
+struct FunnelBuffer {
+	std::vector<glm::vec3> tunnel;    ///< The vertices along the path of faces.
+	std::vector<bool>      leftRight; ///< Is each vertex of the tunnel on the left?
+};
 
 class Pathfinding {
 public:
@@ -59,6 +71,9 @@ public:
 	 *  It will use an A* algorithm to find as fast and as best as possible a path.
 	 *  The algorithm used can be tuned from the bare class Engines::AStar and must be
 	 *  set in the constructor thanks to setAStarAlgorithm() method.
+	 *
+	 *  If a path abstraction has been built (see buildPathAbstraction()), paths
+	 *  between two different clusters of the walkmesh are first searched on it.
 	 */
 	bool findPath(float startX, float startY, float endX, float endY,
 	              std::vector<uint32_t> &facePath, float width = 0.f, uint32_t nbrIt = 10000);
@@ -124,6 +139,33 @@ protected:
 	virtual void findCenter(std::vector<glm::vec3> &vertices, float &centerX, float &centerY) const;
 	/** Are two points close? Use the _epsilon value to evaluate the proximity.*/
 	bool close(glm::vec3 &pointA, glm::vec3 &pointB) const;
+	/** Precompute the clusters and portals used for long-distance paths.
+	 *
+	 *  Must be called again whenever the walkmesh changes.
+	 */
+	void buildPathAbstraction();
+	/** Rebuild the flattened copies of the AABB trees that all walkmesh queries use.
+	 *
+	 *  Must be called again whenever the AABB trees change.
+	 */
+	void flattenAABBTrees();
+
+	/** Search a path of faces with the given search objects, without drawing anything.
+	 *
+	 *  Only reads from the walkmesh, so it can run on several threads at once,
+	 *  as long as each uses its own search objects.
+	 */
+	bool searchPath(AStar &aStarAlgorithm, PathAbstraction *pathAbstraction,
+	                float startX, float startY, float endX, float endY,
+	                std::vector<uint32_t> &facePath, float width, uint32_t nbrIt);
+	/** Compute a smooth line from a path of face, without drawing anything.
+	 *
+	 *  The points are appended to path. The buffer is only used as scratch
+	 *  space, and can be shared by all paths smoothed on the same thread.
+	 */
+	void funnelPath(float startX, float startY, float endX, float endY,
+	                std::vector<uint32_t> &facePath, std::vector<glm::vec3> &path,
+	                FunnelBuffer &buffer);
 
 	uint32_t _polygonEdges;  ///< The number of edge a walkmesh face has.
 	uint32_t _verticesCount; ///< The total number of vertices in the walkmesh.
@@ -137,15 +179,17 @@ protected:
 	std::vector<uint32_t> _faceProperty; ///< The property of each faces. Usually used to state the walkability.
 
 	std::vector<Common::AABBNode *> _aabbTrees; ///< The set of AABB trees in the walkmesh.
+	std::vector<Common::AABBTree> _flatAABBTrees; ///< Flattened copies of the AABB trees.
 	bool _pathVisible;
 	bool _walkmeshVisible;
 
 private:
+	static const uint32_t kMaxPolygonEdges = 4;
+
+	/** Get the vertices of a face into an array of _polygonEdges elements. */
+	void getFaceVertices(uint32_t faceID, glm::vec3 *vertices, bool xyPlane = true) const;
 	/** Is a point in a specific face? */
 	bool inFace(uint32_t faceID, glm::vec3 point) const;
-	/** Is a line in a specific face? */
-	bool inFace(uint32_t faceID, glm::vec3 lineStart, glm::vec3 lineEnd,
-	            glm::vec3 &intersect) const;
 	/** Get the vertices shared by two faces. */
 	bool getSharedVertices(uint32_t face1, uint32_t face2,
 	                       glm::vec3 &vert1, glm::vec3 &vert2) const;
@@ -163,8 +207,14 @@ private:
 
 	std::vector<bool> _walkableProperties; ///< Mapping between surface property and walkability.
 	AStar *_aStarAlgorithm; ///< A* algorithm used.
+	PathAbstraction *_pathAbstraction; ///< Abstraction used for long-distance paths.
+
+	FunnelBuffer _funnelBuffer; ///< Scratch space for smoothPath().
 
 friend class AStar;
+friend class PathAbstraction;
+friend class PathQueue;
+friend class NavigationCache;
 friend class Graphics::Aurora::Walkmesh;
 friend class LocalPathfinding;
 };
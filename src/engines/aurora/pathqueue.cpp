@@ -0,0 +1,224 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Asynchronous path requests, solved in batches on worker threads.
+ */
+
+#include <chrono>
+
+#include "src/common/error.h"
+#include "src/common/threadpool.h"
+
+#include "src/engines/aurora/pathfinding.h"
+#include "src/engines/aurora/astar.h"
+#include "src/engines/aurora/pathabstraction.h"
+#include "src/engines/aurora/pathqueue.h"
+
+namespace Engines {
+
+PathQueue::Result::Result() : found(false) {
+}
+
+PathQueue::Solver::Solver(Pathfinding &pathfinding, const PathAbstraction *abstraction) :
+	aStar(new AStar(&pathfinding)), funnelBuffer(new FunnelBuffer) {
+
+	// The abstraction's portal graph is shared data, but its search state isn't
+	if (abstraction)
+		pathAbstraction.reset(new PathAbstraction(*abstraction));
+}
+
+PathQueue::Solver::~Solver() {
+}
+
+PathQueue::PathQueue(Pathfinding &pathfinding) : _pathfinding(&pathfinding), _nextTicket(0) {
+}
+
+PathQueue::~PathQueue() {
+	try {
+		finishBatch();
+	} catch (...) {
+	}
+}
+
+uint32_t PathQueue::submit(float startX, float startY, float endX, float endY,
+                           float width, uint32_t nbrIt) {
+
+	Request request;
+
+	// Never hand out 0, so that it can be used as "no request"
+	if (++_nextTicket == 0)
+		++_nextTicket;
+
+	request.ticket = _nextTicket;
+	request.startX = startX;
+	request.startY = startY;
+	request.endX   = endX;
+	request.endY   = endY;
+	request.width  = width;
+	request.nbrIt  = nbrIt;
+
+	_pending.push_back(request);
+
+	return request.ticket;
+}
+
+void PathQueue::cancel(uint32_t ticket) {
+	for (std::vector<Request>::iterator r = _pending.begin(); r != _pending.end(); ++r) {
+		if (r->ticket == ticket) {
+			_pending.erase(r);
+			return;
+		}
+	}
+
+	for (std::vector<Request>::const_iterator r = _batch.begin(); r != _batch.end(); ++r) {
+		if (r->ticket == ticket) {
+			_cancelled.insert(ticket);
+			return;
+		}
+	}
+
+	_results.erase(ticket);
+}
+
+void PathQueue::dispatch() {
+	if (_batchDone.valid()) {
+		if (_batchDone.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return;
+
+		finishBatch();
+	}
+
+	startBatch();
+}
+
+bool PathQueue::collect(uint32_t ticket, Result &result) {
+	std::map<uint32_t, Result>::iterator r = _results.find(ticket);
+	if (r == _results.end())
+		return false;
+
+	result = std::move(r->second);
+	_results.erase(r);
+
+	return true;
+}
+
+bool PathQueue::isPending(uint32_t ticket) const {
+	for (std::vector<Request>::const_iterator r = _pending.begin(); r != _pending.end(); ++r)
+		if (r->ticket == ticket)
+			return true;
+
+	for (std::vector<Request>::const_iterator r = _batch.begin(); r != _batch.end(); ++r)
+		if (r->ticket == ticket)
+			return _cancelled.find(ticket) == _cancelled.end();
+
+	return false;
+}
+
+void PathQueue::finish() {
+	finishBatch();
+
+	startBatch();
+	finishBatch();
+}
+
+void PathQueue::startBatch() {
+	if (_pending.empty())
+		return;
+
+	_batch.swap(_pending);
+	_pending.clear();
+
+	_batchResults.clear();
+	_batchResults.resize(_batch.size());
+
+	_batchDone = std::async(std::launch::async, [this]() {
+		solveBatch();
+	});
+}
+
+void PathQueue::finishBatch() {
+	if (!_batchDone.valid())
+		return;
+
+	_batchDone.get();
+
+	for (size_t i = 0; i < _batch.size(); i++) {
+		const uint32_t ticket = _batch[i].ticket;
+		if (_cancelled.erase(ticket) > 0)
+			continue;
+
+		_results[ticket] = std::move(_batchResults[i]);
+	}
+
+	_batch.clear();
+	_batchResults.clear();
+	_cancelled.clear();
+}
+
+void PathQueue::solveBatch() {
+	ThreadPoolMan.parallelFor(_batch.size(), [this](size_t i) {
+		solve(_batch[i], _batchResults[i]);
+	});
+}
+
+void PathQueue::solve(const Request &request, Result &result) {
+	Solver *solver = acquireSolver();
+
+	try {
+		result.found = _pathfinding->searchPath(*solver->aStar, solver->pathAbstraction.get(),
+		                                        request.startX, request.startY, request.endX, request.endY,
+		                                        result.facePath, request.width, request.nbrIt);
+
+		// Only a complete path leads to the end point
+		if (result.found)
+			_pathfinding->funnelPath(request.startX, request.startY, request.endX, request.endY,
+			                         result.facePath, result.path, *solver->funnelBuffer);
+
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed to solve path request %u", request.ticket);
+
+		result = Result();
+	}
+
+	releaseSolver(solver);
+}
+
+PathQueue::Solver *PathQueue::acquireSolver() {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (!_freeSolvers.empty()) {
+		Solver *solver = _freeSolvers.back();
+		_freeSolvers.pop_back();
+
+		return solver;
+	}
+
+	_solvers.emplace_back(new Solver(*_pathfinding, _pathfinding->_pathAbstraction));
+	return _solvers.back().get();
+}
+
+void PathQueue::releaseSolver(Solver *solver) {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_freeSolvers.push_back(solver);
+}
+
+} // End of namespace Engines
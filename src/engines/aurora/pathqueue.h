@@ -0,0 +1,158 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Asynchronous path requests, solved in batches on worker threads.
+ */
+
+#ifndef ENGINES_PATHQUEUE_H
+#define ENGINES_PATHQUEUE_H
+
+#include <vector>
+#include <map>
+#include <set>
+#include <memory>
+#include <future>
+
+#include <boost/noncopyable.hpp>
+
+#include "external/glm/vec3.hpp"
+
+#include "src/common/types.h"
+#include "src/common/mutex.h"
+
+namespace Engines {
+
+class Pathfinding;
+class AStar;
+class PathAbstraction;
+struct FunnelBuffer;
+
+/** A queue of path requests against one walkmesh.
+ *
+ *  Instead of searching a path right away, a creature submits a request and
+ *  gets a ticket back. Once per frame, dispatch() hands all requests submitted
+ *  since the last batch to the thread pool, which solves them in parallel.
+ *  The results can then be collected on a later frame.
+ *
+ *  The workers only ever read from the walkmesh, every one of them with its
+ *  own search state. The walkmesh must not be modified while the queue is
+ *  in use; the destructor waits for the batch in flight.
+ */
+class PathQueue : boost::noncopyable {
+public:
+	/** The outcome of a path request. */
+	struct Result {
+		bool found; ///< Was a complete path found?
+
+		std::vector<uint32_t>  facePath; ///< The faces along the path.
+		std::vector<glm::vec3> path;     ///< The smoothed path, from start to end.
+
+		Result();
+	};
+
+	PathQueue(Pathfinding &pathfinding);
+	~PathQueue();
+
+	/** Submit a path request, and return its ticket.
+	 *
+	 *  @param startX  The x component of the starting point.
+	 *  @param startY  The y component of the starting point.
+	 *  @param endX    The x component of the ending point.
+	 *  @param endY    The y component of the ending point.
+	 *  @param width   The creature's width. Default is no width.
+	 *  @param nbrIt   The maximum number of iterations of the search.
+	 */
+	uint32_t submit(float startX, float startY, float endX, float endY,
+	                float width = 0.f, uint32_t nbrIt = 10000);
+
+	/** Cancel a request. Its result, if any, is thrown away. */
+	void cancel(uint32_t ticket);
+
+	/** Start solving the submitted requests, if the previous batch is done.
+	 *
+	 *  Meant to be called once per frame. Never blocks.
+	 */
+	void dispatch();
+
+	/** Take the result of a request, if it has been solved already. */
+	bool collect(uint32_t ticket, Result &result);
+
+	/** Is the request still waiting to be solved? */
+	bool isPending(uint32_t ticket) const;
+
+	/** Wait until all requests submitted so far have been solved. */
+	void finish();
+
+private:
+	struct Request {
+		uint32_t ticket;
+
+		float startX;
+		float startY;
+		float endX;
+		float endY;
+		float width;
+
+		uint32_t nbrIt;
+	};
+
+	/** The search state of one worker. */
+	struct Solver {
+		std::unique_ptr<AStar> aStar;
+		std::unique_ptr<PathAbstraction> pathAbstraction;
+		std::unique_ptr<FunnelBuffer> funnelBuffer;
+
+		Solver(Pathfinding &pathfinding, const PathAbstraction *abstraction);
+		~Solver();
+	};
+
+	Pathfinding *_pathfinding;
+
+	uint32_t _nextTicket;
+
+	std::vector<Request> _pending; ///< Requests waiting for the next batch.
+	std::vector<Request> _batch;   ///< Requests being solved right now.
+	std::vector<Result>  _batchResults;
+
+	std::future<void> _batchDone;
+
+	mutable std::mutex _mutex;
+
+	std::set<uint32_t> _cancelled;         ///< Cancelled requests of the batch in flight.
+	std::map<uint32_t, Result> _results; ///< Solved requests waiting to be collected.
+
+	std::vector<std::unique_ptr<Solver>> _solvers;
+	std::vector<Solver *> _freeSolvers; ///< Guarded by _mutex.
+
+	/** Hand the pending requests to the thread pool. */
+	void startBatch();
+	/** Wait for the batch in flight and move its results over. */
+	void finishBatch();
+	void solveBatch();
+	void solve(const Request &request, Result &result);
+
+	Solver *acquireSolver();
+	void releaseSolver(Solver *solver);
+};
+
+} // End of namespace Engines
+
+#endif // ENGINES_PATHQUEUE_H
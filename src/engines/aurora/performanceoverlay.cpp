@@ -0,0 +1,292 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  An ImGui overlay showing live performance statistics.
+ */
+
+#include "external/imgui/imgui.h"
+
+#include "src/common/util.h"
+
+#include "src/aurora/resman.h"
+
+#include "src/graphics/graphics.h"
+#include "src/graphics/gputimer.h"
+
+#include "src/graphics/aurora/textureman.h"
+
+#include "src/sound/sound.h"
+
+#include "src/engines/aurora/performanceoverlay.h"
+
+namespace Engines {
+
+static const float kMiB = 1024.0f * 1024.0f;
+
+const size_t   PerformanceOverlay::kFrameHistory;
+const size_t   PerformanceOverlay::kProfilerZones;
+const uint64_t PerformanceOverlay::kProfilerInterval;
+const uint64_t PerformanceOverlay::kMetricsInterval;
+
+PerformanceOverlay::PerformanceOverlay() : _frameTimes(kFrameHistory, 0.0f), _frameIndex(0),
+	_lastFrame(0), _profilerUpdate(0), _metricsUpdate(0) {
+
+	for (size_t i = 0; i < Common::kMetricCount; i++) {
+		_metricValues[i] = 0;
+		_metricRates [i] = 0.0;
+	}
+}
+
+PerformanceOverlay::~PerformanceOverlay() {
+	hide();
+}
+
+void PerformanceOverlay::show() {
+	Graphics::Renderable::show();
+}
+
+void PerformanceOverlay::hide() {
+	Graphics::Renderable::hide();
+}
+
+void PerformanceOverlay::draw() {
+	recordFrameTime();
+
+	ImGui::SetNextWindowPos(ImVec2(10.0f, 30.0f), ImGuiCond_FirstUseEver);
+	ImGui::SetNextWindowSize(ImVec2(420.0f, 0.0f), ImGuiCond_FirstUseEver);
+
+	if (ImGui::Begin("Performance")) {
+		drawFrameTimes();
+		drawRendering();
+		drawGPUTimes();
+		drawTextures();
+		drawSound();
+		drawResources();
+		drawMetrics();
+		drawProfiler();
+	}
+
+	ImGui::End();
+}
+
+void PerformanceOverlay::recordFrameTime() {
+	const uint64_t now = Common::Profiler::getTime();
+
+	if (_lastFrame != 0) {
+		_frameTimes[_frameIndex] = (now - _lastFrame) / 1000.0f;
+		_frameIndex = (_frameIndex + 1) % kFrameHistory;
+	}
+
+	_lastFrame = now;
+}
+
+void PerformanceOverlay::drawFrameTimes() {
+	float minTime = _frameTimes[0], maxTime = _frameTimes[0], sumTime = 0.0f;
+	for (std::vector<float>::const_iterator t = _frameTimes.begin(); t != _frameTimes.end(); ++t) {
+		minTime  = MIN(minTime, *t);
+		maxTime  = MAX(maxTime, *t);
+		sumTime += *t;
+	}
+
+	ImGui::Text("%u fps, frame time %.2f ms (min %.2f, max %.2f)", GfxMan.getFPS(),
+	            sumTime / kFrameHistory, minTime, maxTime);
+
+	// Scale to at least 33ms, so that hitches stand out against a steady frame rate
+	ImGui::PlotHistogram("##FrameTimes", _frameTimes.data(), kFrameHistory, _frameIndex,
+	                     0, 0.0f, MAX(maxTime, 33.3f), ImVec2(-1.0f, 60.0f));
+}
+
+void PerformanceOverlay::drawRendering() {
+	if (!ImGui::CollapsingHeader("Rendering", ImGuiTreeNodeFlags_DefaultOpen))
+		return;
+
+	ImGui::Text("Draw calls: %u", GfxMan.getDrawCallCount());
+	ImGui::Text("Triangles: %u", GfxMan.getTriangleCount());
+	ImGui::Text("World objects: %u drawn, %u culled, %u occluded", GfxMan.getDrawnObjectCount(),
+	            GfxMan.getCulledObjectCount(), GfxMan.getOccludedObjectCount());
+}
+
+void PerformanceOverlay::drawGPUTimes() {
+	if (!ImGui::CollapsingHeader("GPU", ImGuiTreeNodeFlags_DefaultOpen))
+		return;
+
+	const float frameTime = GfxMan.getGPUTime(Graphics::kGPUStageFrame);
+	if (frameTime <= 0.0f) {
+		ImGui::Text("GPU times not available");
+		return;
+	}
+
+	// Compare against the average CPU frame time: if the GPU needs nearly all of it, it's the bottleneck
+	float cpuTime = 0.0f;
+	for (std::vector<float>::const_iterator t = _frameTimes.begin(); t != _frameTimes.end(); ++t)
+		cpuTime += *t;
+	cpuTime /= kFrameHistory;
+
+	ImGui::Text("GPU frame time %.2f ms (%s-bound)", frameTime, (frameTime >= (cpuTime * 0.9f)) ? "GPU" : "CPU");
+
+	ImGui::Columns(2, "GPUStages");
+	for (int i = Graphics::kGPUStageFrame + 1; i < Graphics::kGPUStageMAX; i++) {
+		const Graphics::GPUStage stage = (Graphics::GPUStage) i;
+
+		ImGui::Text("%s", Graphics::GPUTimer::getStageName(stage)); ImGui::NextColumn();
+		ImGui::Text("%.3f ms", GfxMan.getGPUTime(stage));          ImGui::NextColumn();
+	}
+
+	ImGui::Columns(1);
+}
+
+void PerformanceOverlay::drawTextures() {
+	if (!ImGui::CollapsingHeader("Textures", ImGuiTreeNodeFlags_DefaultOpen))
+		return;
+
+	size_t count = 0, residentSize = 0;
+	TextureMan.getResidency(count, residentSize);
+
+	ImGui::Text("Textures: %u", (uint) count);
+
+	const size_t budget = TextureMan.getStreamingBudget();
+	if (budget > 0) {
+		ImGui::Text("GPU memory: %.1f / %.1f MiB", residentSize / kMiB, budget / kMiB);
+		ImGui::ProgressBar(MIN(residentSize / (float) budget, 1.0f));
+	} else
+		ImGui::Text("GPU memory: %.1f MiB", residentSize / kMiB);
+}
+
+void PerformanceOverlay::drawSound() {
+	if (!ImGui::CollapsingHeader("Sound", ImGuiTreeNodeFlags_DefaultOpen))
+		return;
+
+	ImGui::Text("Active channels: %u", (uint) SoundMan.getActiveChannelCount());
+}
+
+void PerformanceOverlay::drawResources() {
+	if (!ImGui::CollapsingHeader("Resources", ImGuiTreeNodeFlags_DefaultOpen))
+		return;
+
+	uint64_t hits = 0, misses = 0;
+	size_t size = 0, maxSize = 0;
+	ResMan.getResourceCacheStatistics(hits, misses, size, maxSize);
+
+	if (maxSize == 0) {
+		ImGui::Text("Resource cache disabled");
+		return;
+	}
+
+	const double requests = (double) (hits + misses);
+
+	ImGui::Text("Cache hits: %.0f, misses: %.0f (%.1f%% hit rate)", (double) hits, (double) misses,
+	            (requests > 0.0) ? ((hits * 100.0) / requests) : 0.0);
+	ImGui::Text("Cache size: %.1f / %.1f MiB", size / kMiB, maxSize / kMiB);
+}
+
+void PerformanceOverlay::drawMetrics() {
+	if (!ImGui::CollapsingHeader("Metrics", ImGuiTreeNodeFlags_DefaultOpen))
+		return;
+
+	bool enabled = DebugMan.isMetricsEnabled();
+	if (ImGui::Checkbox("Enabled##Metrics", &enabled))
+		DebugMan.setMetricsEnabled(enabled);
+
+	ImGui::SameLine();
+	if (ImGui::Button("Clear##Metrics")) {
+		DebugMan.clearMetrics();
+		_metricsUpdate = 0;
+	}
+
+	const uint64_t now = Common::Profiler::getTime();
+	if ((_metricsUpdate == 0) || ((now - _metricsUpdate) >= kMetricsInterval)) {
+		const double seconds = (now - _metricsUpdate) / 1000000.0;
+
+		for (size_t i = 0; i < Common::kMetricCount; i++) {
+			const uint64_t value = Common::DebugManager::getMetric((Common::DebugMetric) i);
+
+			_metricRates [i] = ((_metricsUpdate == 0) || (value < _metricValues[i])) ?
+				0.0 : ((value - _metricValues[i]) / seconds);
+			_metricValues[i] = value;
+		}
+
+		_metricsUpdate = now;
+	}
+
+	ImGui::Columns(3, "Metrics");
+	ImGui::Text("Metric"); ImGui::NextColumn();
+	ImGui::Text("Value");  ImGui::NextColumn();
+	ImGui::Text("Per s");  ImGui::NextColumn();
+	ImGui::Separator();
+
+	for (size_t i = 0; i < Common::kMetricCount; i++) {
+		const Common::DebugMetric metric = (Common::DebugMetric) i;
+
+		ImGui::Text("%s", Common::DebugManager::getMetricName(metric)); ImGui::NextColumn();
+		ImGui::Text("%.0f", (double) Common::DebugManager::getMetric(metric)); ImGui::NextColumn();
+
+		if (Common::DebugManager::isMetricGauge(metric))
+			ImGui::Text("-");
+		else
+			ImGui::Text("%.1f", _metricRates[i]);
+
+		ImGui::NextColumn();
+	}
+
+	ImGui::Columns(1);
+}
+
+void PerformanceOverlay::drawProfiler() {
+	if (!ImGui::CollapsingHeader("Profiler", ImGuiTreeNodeFlags_DefaultOpen))
+		return;
+
+	bool enabled = ProfilerMan.isEnabled();
+	if (ImGui::Checkbox("Enabled", &enabled))
+		ProfilerMan.setEnabled(enabled);
+
+	ImGui::SameLine();
+	if (ImGui::Button("Clear")) {
+		ProfilerMan.clear();
+		_profilerUpdate = 0;
+	}
+
+	// Summing up all recorded zones isn't free, so don't do it every frame
+	const uint64_t now = Common::Profiler::getTime();
+	if ((_profilerUpdate == 0) || ((now - _profilerUpdate) >= kProfilerInterval)) {
+		_profilerEntries = ProfilerMan.getEntries();
+		_profilerUpdate  = now;
+	}
+
+	ImGui::Columns(4, "ProfilerZones");
+	ImGui::Text("Zone");      ImGui::NextColumn();
+	ImGui::Text("Calls");     ImGui::NextColumn();
+	ImGui::Text("Total ms");  ImGui::NextColumn();
+	ImGui::Text("Avg ms");    ImGui::NextColumn();
+	ImGui::Separator();
+
+	for (size_t i = 0; i < MIN(kProfilerZones, _profilerEntries.size()); i++) {
+		const Common::Profiler::Entry &entry = _profilerEntries[i];
+
+		ImGui::Text("%s", entry.name); ImGui::NextColumn();
+		ImGui::Text("%.0f", (double) entry.calls); ImGui::NextColumn();
+		ImGui::Text("%.2f", entry.time / 1000.0); ImGui::NextColumn();
+		ImGui::Text("%.3f", (entry.time / 1000.0) / MAX<uint64_t>(entry.calls, 1)); ImGui::NextColumn();
+	}
+
+	ImGui::Columns(1);
+}
+
+} // End of namespace Engines
@@ -0,0 +1,93 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  An ImGui overlay showing live performance statistics.
+ */
+
+#ifndef ENGINES_AURORA_PERFORMANCEOVERLAY_H
+#define ENGINES_AURORA_PERFORMANCEOVERLAY_H
+
+#include <vector>
+
+#include "src/common/types.h"
+#include "src/common/profiler.h"
+#include "src/common/debugman.h"
+
+#include "src/graphics/imguiwrapper.h"
+
+namespace Engines {
+
+/** An ImGui window showing live performance statistics.
+ *
+ *  Shows a history of frame times, the draw calls and triangles of the last
+ *  frame, the GPU time of each render stage, the textures' GPU memory, the active sound channels, the resource
+ *  cache hit rate, the rates of the debug metrics and the zones recorded by the
+ *  CPU profiler.
+ */
+class PerformanceOverlay : public Graphics::ImGuiWrapper {
+public:
+	PerformanceOverlay();
+	~PerformanceOverlay();
+
+	// The overlay doesn't need any keyboard input
+	void show() override;
+	void hide() override;
+
+protected:
+	void draw() override;
+
+private:
+	/** The number of frames in the frame time history. */
+	static const size_t kFrameHistory = 240;
+	/** The number of profiler zones shown. */
+	static const size_t kProfilerZones = 15;
+	/** Time between updates of the shown profiler zones, in microseconds. */
+	static const uint64_t kProfilerInterval = 500000;
+	/** Time between updates of the metric rates, in microseconds. */
+	static const uint64_t kMetricsInterval = 1000000;
+
+	std::vector<float> _frameTimes; ///< Ring buffer of frame times, in milliseconds.
+	size_t _frameIndex;             ///< The oldest frame time in the ring buffer.
+
+	uint64_t _lastFrame; ///< The time the last frame was drawn, in microseconds.
+
+	Common::Profiler::Entries _profilerEntries; ///< The profiler zones shown.
+	uint64_t _profilerUpdate;                   ///< The time the shown zones were last updated.
+
+	uint64_t _metricValues[Common::kMetricCount]; ///< The metrics at the last rate update.
+	double   _metricRates [Common::kMetricCount]; ///< The per-second rates of the counters.
+	uint64_t _metricsUpdate;                      ///< The time the metric rates were last updated.
+
+	void recordFrameTime();
+
+	void drawFrameTimes();
+	void drawRendering();
+	void drawGPUTimes();
+	void drawTextures();
+	void drawSound();
+	void drawResources();
+	void drawMetrics();
+	void drawProfiler();
+};
+
+} // End of namespace Engines
+
+#endif // ENGINES_AURORA_PERFORMANCEOVERLAY_H
@@ -22,8 +22,12 @@
  *  Generic Aurora engines resource utility functions.
  */
 
+#include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/ustring.h"
+#include "src/common/hash.h"
+#include "src/common/filepath.h"
+#include "src/common/configman.h"
 
 #include "src/aurora/resman.h"
 
@@ -109,6 +113,49 @@ bool indexOptionalArchive(const Common::UString &file, uint32_t priority, Change
 	return indexOptionalArchive(file, priority, password, changes);
 }
 
+void ArchiveBatch::addMandatory(const Common::UString &file, uint32_t priority, Common::ChangeID *changeID) {
+	if (EventMan.quitRequested())
+		return;
+
+	_archives.push_back(Aurora::ResourceManager::BatchArchive(file, priority, changeID));
+}
+
+void ArchiveBatch::addMandatory(const Common::UString &file, uint32_t priority, ChangeList &changes) {
+	changes.push_back(Common::ChangeID());
+	addMandatory(file, priority, &changes.back());
+}
+
+bool ArchiveBatch::addOptional(const Common::UString &file, uint32_t priority, Common::ChangeID *changeID) {
+	if (EventMan.quitRequested())
+		return false;
+
+	if (!ResMan.hasArchive(file))
+		return false;
+
+	_archives.push_back(Aurora::ResourceManager::BatchArchive(file, priority, changeID));
+	return true;
+}
+
+bool ArchiveBatch::addOptional(const Common::UString &file, uint32_t priority, ChangeList &changes) {
+	changes.push_back(Common::ChangeID());
+	if (!addOptional(file, priority, &changes.back())) {
+		changes.pop_back();
+		return false;
+	}
+
+	return true;
+}
+
+void ArchiveBatch::index() {
+	std::vector<Aurora::ResourceManager::BatchArchive> archives;
+	archives.swap(_archives);
+
+	if (EventMan.quitRequested())
+		return;
+
+	ResMan.indexArchives(archives);
+}
+
 void indexMandatoryDirectory(const Common::UString &dir, const char *glob, int depth,
                              uint32_t priority, Common::ChangeID *changeID) {
 
@@ -172,4 +219,39 @@ void deindexResources(ChangeList &changes) {
 	changes.clear();
 }
 
+/** Return the file the prebaked archive of a game target is kept in. */
+static Common::UString getPrebakedArchiveFile(const Common::UString &target) {
+	return Common::FilePath::getUserDataFile(
+		Common::UString::format("prebaked/%08X.erf", Common::hashStringFNV32(target)));
+}
+
+void usePrebakedArchive(const Common::UString &target) {
+	if (EventMan.quitRequested())
+		return;
+
+	const Common::UString file = getPrebakedArchiveFile(target);
+
+	// Prebaking needs to happen at the exact point the archive is used later on
+	if (ConfigMan.getBool("prebake", false)) {
+		try {
+			ResMan.writePrebakedArchive(file);
+		} catch (Common::Exception &e) {
+			e.add("Failed to write the prebaked archive \"%s\"", file.c_str());
+			throw;
+		}
+
+		return;
+	}
+
+	if (!ConfigMan.getBool("prebaked", true))
+		return;
+
+	try {
+		if (ResMan.indexPrebakedArchive(file))
+			status("Using the prebaked archive \"%s\"", file.c_str());
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed to index the prebaked archive \"%s\"", file.c_str());
+	}
+}
+
 } // End of namespace Engines
@@ -28,9 +28,12 @@
 #include <list>
 #include <vector>
 
+#include <boost/noncopyable.hpp>
+
 #include "src/common/changeid.h"
 
 #include "src/aurora/types.h"
+#include "src/aurora/resman.h"
 
 namespace Common {
 	class UString;
@@ -56,6 +59,28 @@ bool indexOptionalArchive(const Common::UString &file, uint32_t priority, const
 bool indexOptionalArchive(const Common::UString &file, uint32_t priority, const std::vector<byte> &password,
                           ChangeList &changes);
 
+/** A batch of archive files to add to the resource manager in one go.
+ *
+ *  The archives are parsed concurrently, and then indexed in the order
+ *  they were added in, just as if they were indexed one after the other.
+ */
+class ArchiveBatch : boost::noncopyable {
+public:
+	/** Add an archive file to the batch. Indexing will error out if it does not exist. */
+	void addMandatory(const Common::UString &file, uint32_t priority, Common::ChangeID *changeID = 0);
+	void addMandatory(const Common::UString &file, uint32_t priority, ChangeList &changes);
+
+	/** Add an archive file to the batch, if it exists. */
+	bool addOptional(const Common::UString &file, uint32_t priority, Common::ChangeID *changeID = 0);
+	bool addOptional(const Common::UString &file, uint32_t priority, ChangeList &changes);
+
+	/** Index all archive files in the batch, and clear it. */
+	void index();
+
+private:
+	std::vector<Aurora::ResourceManager::BatchArchive> _archives;
+};
+
 /** Add a directory to the resource manager, erroring out if it does not exist. */
 void indexMandatoryDirectory(const Common::UString &dir, const char *glob, int depth,
                              uint32_t priority, Common::ChangeID *changeID = 0);
@@ -72,6 +97,16 @@ bool indexOptionalDirectory(const Common::UString &dir, const char *glob, int de
 void deindexResources(Common::ChangeID &changeID);
 void deindexResources(ChangeList &changes);
 
+/** Index the prebaked archive of this game target over the resources indexed so far.
+ *
+ *  This needs to be called right after the game's base resources are
+ *  indexed. The archive is only used if it's still up-to-date.
+ *
+ *  When prebaking, the archive is written from the resources indexed
+ *  so far instead.
+ */
+void usePrebakedArchive(const Common::UString &target);
+
 } // End of namespace Engines
 
 #endif // ENGINES_AURORA_RESOURCES_H
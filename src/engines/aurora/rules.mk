@@ -24,6 +24,7 @@ src_engines_aurora_libaurora_la_SOURCES =
 
 src_engines_aurora_libaurora_la_SOURCES += \
     src/engines/aurora/util.h \
+    src/engines/aurora/areamusic.h \
     src/engines/aurora/resources.h \
     src/engines/aurora/tokenman.h \
     src/engines/aurora/modelloader.h \
@@ -31,17 +32,22 @@ src_engines_aurora_libaurora_la_SOURCES += \
     src/engines/aurora/widget.h \
     src/engines/aurora/gui.h \
     src/engines/aurora/console.h \
+    src/engines/aurora/performanceoverlay.h \
     src/engines/aurora/loadprogress.h \
     src/engines/aurora/flycamera.h \
     src/engines/aurora/trigger.h \
     src/engines/aurora/pathfinding.h \
     src/engines/aurora/astar.h \
+    src/engines/aurora/pathabstraction.h \
+    src/engines/aurora/pathqueue.h \
+    src/engines/aurora/navigationcache.h \
     src/engines/aurora/localpathfinding.h \
     src/engines/aurora/objectwalkmesh.h \
     $(EMPTY)
 
 src_engines_aurora_libaurora_la_SOURCES += \
     src/engines/aurora/util.cpp \
+    src/engines/aurora/areamusic.cpp \
     src/engines/aurora/resources.cpp \
     src/engines/aurora/tokenman.cpp \
     src/engines/aurora/modelloader.cpp \
@@ -49,10 +55,14 @@ src_engines_aurora_libaurora_la_SOURCES += \
     src/engines/aurora/widget.cpp \
     src/engines/aurora/gui.cpp \
     src/engines/aurora/console.cpp \
+    src/engines/aurora/performanceoverlay.cpp \
     src/engines/aurora/loadprogress.cpp \
     src/engines/aurora/flycamera.cpp \
     src/engines/aurora/trigger.cpp \
     src/engines/aurora/pathfinding.cpp \
     src/engines/aurora/astar.cpp \
+    src/engines/aurora/pathabstraction.cpp \
+    src/engines/aurora/pathqueue.cpp \
+    src/engines/aurora/navigationcache.cpp \
     src/engines/aurora/localpathfinding.cpp \
     $(EMPTY)
@@ -22,6 +22,8 @@
  *  Manager for tokens in Aurora engines text strings.
  */
 
+#include <cstring>
+
 #include "src/engines/aurora/tokenman.h"
 
 DECLARE_SINGLETON(Engines::TokenManager)
@@ -39,15 +41,11 @@ void TokenManager::clear() {
 }
 
 void TokenManager::set(const Common::UString &token, const Common::UString &value) {
-	_tokens[token] = value;
+	_tokens[token.c_str()] = value.c_str();
 }
 
 void TokenManager::remove(const Common::UString &token) {
-	TokenMap::iterator t = _tokens.find(token);
-	if (t == _tokens.end())
-		return;
-
-	_tokens.erase(t);
+	_tokens.erase(token.c_str());
 }
 
 void TokenManager::parse(Common::UString &str) const {
@@ -57,24 +55,51 @@ void TokenManager::parse(Common::UString &str) const {
 }
 
 Common::UString TokenManager::parse(const Common::UString &str) const {
-	Common::UString parsed;
+	// '<' and '>' never appear within other UTF-8 characters, so we can scan the raw bytes
+	const char *text = str.c_str();
+	const size_t length = std::strlen(text);
+
+	const char *tokenStart = static_cast<const char *>(std::memchr(text, '<', length));
+	if (!tokenStart || _tokens.empty())
+		return str;
+
+	std::string parsed;
+	parsed.reserve(length);
+
+	std::string token;
 
-	std::vector<Common::UString> tokens;
-	Common::UString::splitTextTokens(str, tokens);
+	const char *end   = text + length;
+	const char *plain = text;
 
-	bool plain = true;
-	for (std::vector<Common::UString>::iterator t = tokens.begin(); t != tokens.end(); ++t) {
+	while (tokenStart) {
+		// Find the end of the token, or the start of a token within this token
+		const char *tokenEnd = tokenStart + 1;
+		while ((tokenEnd < end) && (*tokenEnd != '<') && (*tokenEnd != '>'))
+			tokenEnd++;
 
-		if (!plain) {
-			TokenMap::const_iterator token = _tokens.find(*t);
+		if (tokenEnd == end)
+			// Unterminated token, this is just plain text
+			break;
 
-			parsed += (token == _tokens.end()) ? *t : token->second;
-		} else
-			parsed += *t;
+		if (*tokenEnd == '<') {
+			// The token starts anew here
+			tokenStart = tokenEnd;
+			continue;
+		}
 
-		plain = !plain;
+		parsed.append(plain, tokenStart - plain);
+
+		token.assign(tokenStart, tokenEnd + 1 - tokenStart);
+
+		TokenMap::const_iterator t = _tokens.find(token);
+		parsed.append((t == _tokens.end()) ? token : t->second);
+
+		plain      = tokenEnd + 1;
+		tokenStart = static_cast<const char *>(std::memchr(plain, '<', end - plain));
 	}
 
+	parsed.append(plain, end - plain);
+
 	return parsed;
 }
 
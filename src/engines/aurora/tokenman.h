@@ -25,7 +25,8 @@
 #ifndef ENGINES_AURORA_TOKENMAN_H
 #define ENGINES_AURORA_TOKENMAN_H
 
-#include <map>
+#include <string>
+#include <unordered_map>
 
 #include "src/common/ustring.h"
 #include "src/common/singleton.h"
@@ -46,13 +47,21 @@ public:
 	/** Remove the value of a token. */
 	void remove(const Common::UString &token);
 
-	/** Parse a string for tokens, replacing them with their values. */
+	/** Parse a string for tokens, replacing them with their values.
+	 *
+	 *  A token is anything between '<' and the next '>' that doesn't contain
+	 *  another '<'. Tokens without a value are left as they are. The string
+	 *  is scanned only once, so the cost doesn't depend on the number of
+	 *  tokens that have values.
+	 */
 	void parse(Common::UString &str) const;
 	/** Parse a string for tokens, replacing them with their values. */
 	Common::UString parse(const Common::UString &str) const;
 
 private:
-	typedef std::map<Common::UString, Common::UString> TokenMap;
+	/** The token values, keyed and stored as raw UTF-8, so that parsing doesn't
+	 *  have to convert every token it finds into a UString. */
+	typedef std::unordered_map<std::string, std::string> TokenMap;
 
 	TokenMap _tokens;
 };
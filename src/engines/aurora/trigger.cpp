@@ -86,6 +86,10 @@ bool Trigger::contains(float x, float y) const {
 	return (count % 2) ? true : false;
 }
 
+const Common::BoundingBox &Trigger::getBoundingBox() const {
+	return _boundingbox;
+}
+
 void Trigger::calculateDistance() {
 
 }
@@ -41,6 +41,8 @@ public:
 
 	void setVisible(bool visible);
 	bool contains(float x, float y) const;
+	/** Return the bounding box of the trigger's geometry. */
+	const Common::BoundingBox &getBoundingBox() const;
 
 	// .--- Renderable
 	void calculateDistance();
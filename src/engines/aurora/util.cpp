@@ -89,12 +89,10 @@ Sound::ChannelHandle playSound(const Common::UString &sound, Sound::SoundType so
 	Sound::ChannelHandle channel;
 
 	try {
-		Common::SeekableReadStream *soundStream = ResMan.getResource(resType, sound);
-		if (!soundStream)
+		channel = SoundMan.playSoundResource(sound, resType, soundType, loop);
+		if (!SoundMan.isValidChannel(channel))
 			return channel;
 
-		channel = SoundMan.playSoundFile(soundStream, soundType, loop);
-
 		debugC(Common::kDebugEngineSound, 1, "Playing sound \"%s\" in %s",
 		       sound.c_str(), SoundMan.formatChannel(channel).c_str());
 
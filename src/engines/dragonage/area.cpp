@@ -25,6 +25,7 @@
 #include "src/common/util.h"
 #include "src/common/strutil.h"
 #include "src/common/error.h"
+#include "src/common/configman.h"
 
 #include "src/aurora/resman.h"
 #include "src/aurora/rimfile.h"
@@ -33,6 +34,7 @@
 
 #include "src/graphics/graphics.h"
 #include "src/graphics/renderable.h"
+#include "src/graphics/camera.h"
 
 #include "src/graphics/aurora/cursorman.h"
 
@@ -56,6 +58,10 @@ static const uint32_t kVersion40 = MKTAG('V', '4', '.', '0');
 
 static const uint32_t kROOMID    = MKTAG('R', 'O', 'O', 'M');
 
+/** Rooms only get unloaded once they're this much further away than the distance they're loaded at.
+ *  This way, walking along the border doesn't load and unload the same rooms over and over. */
+static const float kRoomUnloadFactor = 1.5f;
+
 using ::Aurora::GFF3File;
 using ::Aurora::GFF3Struct;
 using ::Aurora::GFF3List;
@@ -70,6 +76,8 @@ Area::Area(Campaign &campaign, const Common::UString &resRef,
            const Common::UString &env, const Common::UString &rim) :
 	Object(kObjectTypeArea), _campaign(&campaign), _resRef(resRef), _environmentID(0xFFFFFFFF), _activeObject(0), _highlightAll(0) {
 
+	_roomDistance = MAX(0, ConfigMan.getInt("roomdistance", 100));
+
 	try {
 
 		load(resRef, env, rim);
@@ -198,6 +206,9 @@ void Area::loadCreatures(const Aurora::GFF3List &list) {
 void Area::show() {
 	_eventQueue.clear();
 
+	// Make sure the rooms around the entry location are there right away
+	updateRooms(true);
+
 	GfxMan.lockFrame();
 
 	for (auto &room : _rooms)
@@ -221,6 +232,19 @@ void Area::hide() {
 	GfxMan.unlockFrame();
 }
 
+void Area::updateRooms(bool wait) {
+	const float *camera = CameraMan.getPosition();
+
+	for (auto &room : _rooms) {
+		const float distance = (_roomDistance > 0.0f) ? room->getDistance(camera[0], camera[1], camera[2]) : 0.0f;
+
+		if      (distance <= _roomDistance)
+			room->loadModels(wait);
+		else if (distance > (_roomDistance * kRoomUnloadFactor))
+			room->unloadModels();
+	}
+}
+
 Common::UString Area::getName(const Common::UString &resRef, const Common::UString &rimFile) {
 	if (!rimFile.empty()) {
 
@@ -305,6 +329,8 @@ void Area::processEventQueue() {
 
 	_eventQueue.clear();
 
+	updateRooms(false);
+
 	if (hasMove)
 		checkActive();
 }
@@ -113,6 +113,9 @@ private:
 
 	Rooms _rooms;
 
+	/** Rooms within this distance of the camera have their models loaded. 0 keeps all rooms loaded. */
+	float _roomDistance;
+
 	ChangeList _resources;
 	std::list<Events::Event> _eventQueue;
 
@@ -131,6 +134,13 @@ private:
 	void loadEnvironment(const Common::UString &resRef);
 	void loadARE(const Common::UString &resRef);
 
+	/** Load the models of rooms close to the camera and free those of distant ones.
+	 *
+	 *  If wait is true, wait for close rooms still loading. Otherwise, they're
+	 *  only shown in a later call, once they finished loading in the background.
+	 */
+	void updateRooms(bool wait);
+
 	void loadObject(std::unique_ptr<DragonAge::Object> &&object);
 	void loadWaypoints (const Aurora::GFF3List &list);
 	void loadPlaceables(const Aurora::GFF3List &list);
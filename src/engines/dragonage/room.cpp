@@ -22,9 +22,13 @@
  *  A room in a Dragon Age: Origins area.
  */
 
+#include <cfloat>
+#include <map>
+
 #include "external/glm/mat4x4.hpp"
 #include "external/glm/gtc/matrix_transform.hpp"
 #include "external/glm/gtx/matrix_interpolation.hpp"
+#include "external/glm/geometric.hpp"
 
 #include "src/common/util.h"
 #include "src/common/strutil.h"
@@ -57,7 +61,11 @@ using ::Aurora::GFF4List;
 
 using namespace ::Aurora::GFF4FieldNamesEnum;
 
-Room::Room(const Aurora::GFF4Struct &room) {
+Room::Room(const Aurora::GFF4Struct &room) : _id(-1), _visible(false), _loaded(false), _radius(0.0f) {
+	_center[0] = 0.0f;
+	_center[1] = 0.0f;
+	_center[2] = 0.0f;
+
 	try {
 		load(room);
 	} catch (...) {
@@ -68,6 +76,7 @@ Room::Room(const Aurora::GFF4Struct &room) {
 
 Room::~Room() {
 	hide();
+	unloadModels();
 	clean();
 }
 
@@ -95,6 +104,8 @@ void Room::load(const GFF4Struct &room) {
 	loadLayout(roomFile);
 	loadLayout(roomFile + "_0");
 	loadLayout(roomFile + "_1");
+
+	createBound();
 }
 
 void Room::loadLayout(const Common::UString &roomFile) {
@@ -123,32 +134,37 @@ void Room::loadLayout(const Common::UString &roomFile) {
 				Common::deg2rad(roomOrient[3]),
 				glm::vec3(roomOrient[0], roomOrient[1], roomOrient[2]));
 
-	status("Loading room \"%s\" (%d)", roomFile.c_str(), _id);
+	status("Loading room layout \"%s\" (%d)", roomFile.c_str(), _id);
 
 	const GFF4List &models = rmlTop.getList(kGFF4EnvRoomModelList);
-	_models.reserve(models.size());
+	_placements.reserve(_placements.size() + models.size());
 
 	for (GFF4List::const_iterator m = models.begin(); m != models.end(); ++m) {
 		if (!*m || ((*m)->getLabel() != kMDLID))
 			continue;
 
-		float scale = (*m)->getFloat(kGFF4EnvModelScale);
+		Placement placement;
+
+		placement.model = (*m)->getString(kGFF4EnvModelFile);
+		placement.scale = (*m)->getFloat(kGFF4EnvModelScale);
 
-		float pos[3] = { 0.0f, 0.0f, 0.0f };
+		float *pos    = placement.position;
+		float *orient = placement.orientation;
+
+		pos[0] = 0.0f;
+		pos[1] = 0.0f;
+		pos[2] = 0.0f;
 		(*m)->getVector3(kGFF4Position, pos[0], pos[1], pos[2]);
 
-		float orient[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		orient[0] = 0.0f;
+		orient[1] = 0.0f;
+		orient[2] = 0.0f;
+		orient[3] = 0.0f;
 		(*m)->getVector4(kGFF4Orientation, orient[0], orient[1], orient[2], orient[3]);
 		orient[3] = Common::rad2deg(acos(orient[3]) * 2.0);
 
 		// TODO: Instances
 
-		Graphics::Aurora::Model *model = loadModelObject((*m)->getString(kGFF4EnvModelFile));
-		if (!model)
-			continue;
-
-		_models.emplace_back(model);
-
 		glm::mat4 modelTransform(roomTransform);
 
 		modelTransform = glm::translate(modelTransform, glm::vec3(pos[0], pos[1], pos[2]));
@@ -169,18 +185,118 @@ void Room::loadLayout(const Common::UString &roomFile) {
 		orient[1] = axis.y;
 		orient[2] = axis.z;
 
-		model->setPosition(pos[0], pos[1], pos[2]);
-		model->setOrientation(orient[0], orient[1], orient[2], orient[3]);
-		model->setScale(scale, scale, scale);
+		_placements.push_back(placement);
 	}
 }
 
+void Room::createBound() {
+	if (_placements.empty())
+		return;
+
+	float min[3] = {  FLT_MAX,  FLT_MAX,  FLT_MAX };
+	float max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+	for (const auto &placement : _placements) {
+		for (int i = 0; i < 3; i++) {
+			min[i] = MIN(min[i], placement.position[i]);
+			max[i] = MAX(max[i], placement.position[i]);
+		}
+	}
+
+	for (int i = 0; i < 3; i++)
+		_center[i] = (min[i] + max[i]) / 2.0f;
+
+	_radius = glm::length(glm::vec3(max[0] - _center[0], max[1] - _center[1], max[2] - _center[2]));
+}
+
+float Room::getDistance(float x, float y, float z) const {
+	const float distance = glm::length(glm::vec3(x - _center[0], y - _center[1], z - _center[2]));
+
+	return MAX(0.0f, distance - _radius);
+}
+
+bool Room::isLoaded() const {
+	return _loaded;
+}
+
+void Room::prefetchModels() {
+	if (_loaded || !_pendingModels.empty())
+		return;
+
+	status("Loading room %d", _id);
+
+	_pendingModels.reserve(_placements.size());
+
+	// Let repeated models wait for the first instance, so they share its meshes
+	std::map<Common::UString, size_t> first;
+
+	for (const auto &placement : _placements) {
+		std::map<Common::UString, size_t>::const_iterator f = first.find(placement.model);
+
+		const PendingModel *after = (f != first.end()) ? &_pendingModels[f->second] : 0;
+		if (!after)
+			first.insert(std::make_pair(placement.model, _pendingModels.size()));
+
+		_pendingModels.push_back(loadModelObjectAsync(placement.model, "", after));
+	}
+}
+
+void Room::loadModels(bool wait) {
+	if (_loaded)
+		return;
+
+	prefetchModels();
+
+	if (!wait)
+		for (const auto &pending : _pendingModels)
+			if (!pending.isReady())
+				return;
+
+	_models.reserve(_pendingModels.size());
+
+	for (size_t i = 0; i < _pendingModels.size(); i++) {
+		Graphics::Aurora::Model *model = _pendingModels[i].take();
+		if (!model)
+			continue;
+
+		_models.emplace_back(model);
+
+		placeModel(*model, _placements[i]);
+		if (_visible)
+			model->show();
+	}
+
+	_pendingModels.clear();
+	_loaded = true;
+}
+
+void Room::unloadModels() {
+	for (auto &model : _models)
+		model->hide();
+
+	_pendingModels.clear();
+	_models.clear();
+
+	_loaded = false;
+}
+
+void Room::placeModel(Graphics::Aurora::Model &model, const Placement &placement) {
+	model.setPosition(placement.position[0], placement.position[1], placement.position[2]);
+	model.setOrientation(placement.orientation[0], placement.orientation[1],
+	                     placement.orientation[2], placement.orientation[3]);
+	model.setScale(placement.scale, placement.scale, placement.scale);
+}
+
 void Room::show() {
+	_visible = true;
+
 	for (auto &model : _models)
 		model->show();
 }
 
 void Room::hide() {
+	_visible = false;
+
 	for (auto &model : _models)
 		model->hide();
 }
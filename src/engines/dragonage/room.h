@@ -35,11 +35,18 @@
 #include "src/graphics/aurora/types.h"
 
 #include "src/engines/aurora/resources.h"
+#include "src/engines/aurora/model.h"
 
 namespace Engines {
 
 namespace DragonAge {
 
+/** A room within a Dragon Age: Origins area.
+ *
+ *  Constructing a room only reads its layout. The models are loaded and
+ *  freed again on demand, so that an area can keep only the rooms close
+ *  to the camera in memory.
+ */
 class Room {
 public:
 	Room(const Aurora::GFF4Struct &room);
@@ -50,18 +57,55 @@ public:
 	void show();
 	void hide();
 
+	/** Return the distance of this point to the room, 0 if it's within the room. */
+	float getDistance(float x, float y, float z) const;
+
+	/** Are all the room's models loaded? */
+	bool isLoaded() const;
+
+	/** Start loading the room's models in the background. */
+	void prefetchModels();
+	/** Take the models that finished loading in the background, and show them if the room is visible.
+	 *
+	 *  If wait is true, wait for the models still loading.
+	 */
+	void loadModels(bool wait);
+	/** Free the room's models. */
+	void unloadModels();
+
 private:
 	typedef std::vector<std::unique_ptr<Graphics::Aurora::Model>> Models;
 
+	/** Where to place one of the room's models. */
+	struct Placement {
+		Common::UString model;
+
+		float position[3];
+		float orientation[4];
+		float scale;
+	};
+
 	int32_t _id;
 
+	bool _visible;
+	bool _loaded;
+
+	std::vector<Placement> _placements;
+
+	std::vector<PendingModel> _pendingModels;
 	Models _models;
 
+	float _center[3]; ///< The center of all model positions.
+	float _radius;    ///< The distance of the model furthest from the center.
+
 	ChangeList _resources;
 
 	void load(const Aurora::GFF4Struct &room);
 	void loadLayout(const Common::UString &roomFile);
 
+	void createBound();
+	void placeModel(Graphics::Aurora::Model &model, const Placement &placement);
+
 	void clean();
 };
 
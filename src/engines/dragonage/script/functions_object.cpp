@@ -24,8 +24,6 @@
 
 #include <memory>
 
-#include <boost/make_shared.hpp>
-
 #include "src/common/util.h"
 
 #include "src/aurora/nwscript/functioncontext.h"
@@ -287,11 +285,11 @@ void Functions::getObjectByTag(Aurora::NWScript::FunctionContext &ctx) {
 
 	int nth = ctx.getParams()[1].getInt();
 
-	std::unique_ptr<Aurora::NWScript::ObjectSearch> search(campaign->findObjectsByTag(tag));
+	Aurora::NWScript::ObjectRange search = campaign->getObjectsByTag(tag);
 	while (nth-- > 0)
-		search->next();
+		search.next();
 
-	ctx.getReturn() = search->get();
+	ctx.getReturn() = search.get();
 }
 
 void Functions::getNearestObject(Aurora::NWScript::FunctionContext &ctx) {
@@ -318,7 +316,7 @@ void Functions::getNearestObject(Aurora::NWScript::FunctionContext &ctx) {
 
 	const bool includeSelf = ctx.getParams()[5].getInt() != 0;
 	if (includeSelf) {
-		result.push_back(boost::make_shared<Aurora::NWScript::Variable>(target));
+		result.push_back(Aurora::NWScript::Variable(target));
 		count--;
 	}
 
@@ -347,7 +345,7 @@ void Functions::getNearestObject(Aurora::NWScript::FunctionContext &ctx) {
 	objects.sort(ObjectDistanceSort(*target));
 
 	for (std::list<Object *>::iterator it = objects.begin(); it != objects.end() && count > 0; ++it, count--)
-		result.push_back(boost::make_shared<Aurora::NWScript::Variable>(*it));
+		result.push_back(Aurora::NWScript::Variable(*it));
 }
 
 void Functions::getNearestObjectByTag(Aurora::NWScript::FunctionContext &ctx) {
@@ -378,18 +376,18 @@ void Functions::getNearestObjectByTag(Aurora::NWScript::FunctionContext &ctx) {
 
 	const bool includeSelf = ctx.getParams()[6].getInt() != 0;
 	if (includeSelf) {
-		result.push_back(boost::make_shared<Aurora::NWScript::Variable>(target));
+		result.push_back(Aurora::NWScript::Variable(target));
 		count--;
 	}
 
 	if (count == 0)
 		return;
 
-	std::unique_ptr<Aurora::NWScript::ObjectSearch> search(campaign->findObjectsByTag(tag));
+	Aurora::NWScript::ObjectRange search = campaign->getObjectsByTag(tag);
 	Aurora::NWScript::Object       *object = 0;
 
 	std::list<Object *> objects;
-	while ((object = search->next())) {
+	while ((object = search.next())) {
 		// Needs to be a valid object and not the target
 		DragonAge::Object *daObject = DragonAge::ObjectContainer::toObject(object);
 		if (!daObject || (daObject == target))
@@ -407,7 +405,7 @@ void Functions::getNearestObjectByTag(Aurora::NWScript::FunctionContext &ctx) {
 	objects.sort(ObjectDistanceSort(*target));
 
 	for (std::list<Object *>::iterator it = objects.begin(); it != objects.end() && count > 0; ++it, count--)
-		result.push_back(boost::make_shared<Aurora::NWScript::Variable>(*it));
+		result.push_back(Aurora::NWScript::Variable(*it));
 }
 
 void Functions::UT_getNearestObjectByTag(Aurora::NWScript::FunctionContext &ctx) {
@@ -431,11 +429,11 @@ void Functions::UT_getNearestObjectByTag(Aurora::NWScript::FunctionContext &ctx)
 		return;
 	}
 
-	std::unique_ptr<Aurora::NWScript::ObjectSearch> search(campaign->findObjectsByTag(tag));
+	Aurora::NWScript::ObjectRange search = campaign->getObjectsByTag(tag);
 	Aurora::NWScript::Object *object = 0;
 
 	std::list<Object *> objects;
-	while ((object = search->next())) {
+	while ((object = search.next())) {
 		// Needs to be a valid object and not the target
 		DragonAge::Object *daObject = DragonAge::ObjectContainer::toObject(object);
 		if (!daObject || (daObject == target))
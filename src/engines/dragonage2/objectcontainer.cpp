@@ -74,7 +74,7 @@ void ObjectContainer::clearObjects() {
 
 	_objects.clear();
 
-	::Aurora::NWScript::ObjectContainer::clearObjects();
+	eraseObjects();
 
 	unlock();
 }
@@ -82,7 +82,7 @@ void ObjectContainer::clearObjects() {
 void ObjectContainer::addObject(DragonAge2::Object &object) {
 	lock();
 
-	::Aurora::NWScript::ObjectContainer::addObject(object);
+	insertObject(object);
 
 	_objects[object.getType()].push_back(&object);
 
@@ -94,7 +94,7 @@ void ObjectContainer::removeObject(DragonAge2::Object &object) {
 
 	_objects[object.getType()].remove(&object);
 
-	::Aurora::NWScript::ObjectContainer::removeObject(object);
+	eraseObject(object);
 
 	unlock();
 }
@@ -24,8 +24,6 @@
 
 #include <memory>
 
-#include <boost/make_shared.hpp>
-
 #include "src/common/util.h"
 #include "src/common/strutil.h"
 
@@ -332,11 +330,11 @@ void Functions::getObjectByTag(Aurora::NWScript::FunctionContext &ctx) {
 
 	int nth = ctx.getParams()[1].getInt();
 
-	std::unique_ptr<Aurora::NWScript::ObjectSearch> search(campaign->findObjectsByTag(tag));
+	Aurora::NWScript::ObjectRange search = campaign->getObjectsByTag(tag);
 	while (nth-- > 0)
-		search->next();
+		search.next();
 
-	ctx.getReturn() = search->get();
+	ctx.getReturn() = search.get();
 }
 
 void Functions::getNearestObject(Aurora::NWScript::FunctionContext &ctx) {
@@ -363,7 +361,7 @@ void Functions::getNearestObject(Aurora::NWScript::FunctionContext &ctx) {
 
 	const bool includeSelf = ctx.getParams()[5].getInt() != 0;
 	if (includeSelf) {
-		result.push_back(boost::make_shared<Aurora::NWScript::Variable>(target));
+		result.push_back(Aurora::NWScript::Variable(target));
 		count--;
 	}
 
@@ -392,7 +390,7 @@ void Functions::getNearestObject(Aurora::NWScript::FunctionContext &ctx) {
 	objects.sort(ObjectDistanceSort(*target));
 
 	for (std::list<Object *>::iterator it = objects.begin(); it != objects.end() && count > 0; ++it, count--)
-		result.push_back(boost::make_shared<Aurora::NWScript::Variable>(*it));
+		result.push_back(Aurora::NWScript::Variable(*it));
 }
 
 void Functions::getNearestObjectByTag(Aurora::NWScript::FunctionContext &ctx) {
@@ -423,18 +421,18 @@ void Functions::getNearestObjectByTag(Aurora::NWScript::FunctionContext &ctx) {
 
 	const bool includeSelf = ctx.getParams()[6].getInt() != 0;
 	if (includeSelf) {
-		result.push_back(boost::make_shared<Aurora::NWScript::Variable>(target));
+		result.push_back(Aurora::NWScript::Variable(target));
 		count--;
 	}
 
 	if (count == 0)
 		return;
 
-	std::unique_ptr<Aurora::NWScript::ObjectSearch> search(campaign->findObjectsByTag(tag));
+	Aurora::NWScript::ObjectRange search = campaign->getObjectsByTag(tag);
 	Aurora::NWScript::Object       *object = 0;
 
 	std::list<Object *> objects;
-	while ((object = search->next())) {
+	while ((object = search.next())) {
 		// Needs to be a valid object and not the target
 		DragonAge2::Object *daObject = DragonAge2::ObjectContainer::toObject(object);
 		if (!daObject || (daObject == target))
@@ -452,7 +450,7 @@ void Functions::getNearestObjectByTag(Aurora::NWScript::FunctionContext &ctx) {
 	objects.sort(ObjectDistanceSort(*target));
 
 	for (std::list<Object *>::iterator it = objects.begin(); it != objects.end() && count > 0; ++it, count--)
-		result.push_back(boost::make_shared<Aurora::NWScript::Variable>(*it));
+		result.push_back(Aurora::NWScript::Variable(*it));
 }
 
 void Functions::UT_getNearestObjectByTag(Aurora::NWScript::FunctionContext &ctx) {
@@ -476,11 +474,11 @@ void Functions::UT_getNearestObjectByTag(Aurora::NWScript::FunctionContext &ctx)
 		return;
 	}
 
-	std::unique_ptr<Aurora::NWScript::ObjectSearch> search(campaign->findObjectsByTag(tag));
+	Aurora::NWScript::ObjectRange search = campaign->getObjectsByTag(tag);
 	Aurora::NWScript::Object *object = 0;
 
 	std::list<Object *> objects;
-	while ((object = search->next())) {
+	while ((object = search.next())) {
 		// Needs to be a valid object and not the target
 		DragonAge2::Object *daObject = DragonAge2::ObjectContainer::toObject(object);
 		if (!daObject || (daObject == target))
@@ -23,9 +23,21 @@
  */
 
 #include <cassert>
+#include <cstdio>
+
+#include <thread>
+#include <chrono>
 
 #include "src/common/util.h"
+#include "src/common/error.h"
 #include "src/common/configman.h"
+#include "src/common/filepath.h"
+#include "src/common/profiler.h"
+#include "src/common/hash.h"
+
+#include "src/aurora/resman.h"
+
+#include "src/graphics/graphics.h"
 
 #include "src/graphics/aurora/fps.h"
 #include "src/graphics/aurora/fontman.h"
@@ -33,10 +45,48 @@
 #include "src/engines/engine.h"
 
 #include "src/engines/aurora/console.h"
+#include "src/engines/aurora/performanceoverlay.h"
+
+#include "src/events/events.h"
 
 namespace Engines {
 
-Engine::Engine() : _game(Aurora::kGameIDUnknown), _platform(Aurora::kPlatformUnknown) {
+/** The phases of the load benchmark, and the profiler zones they're made of.
+ *
+ *  A zone belongs to a phase if its name ends with the phase's zone suffix.
+ *  Zones can nest: the area load includes the models and textures created
+ *  by the area, for example.
+ */
+static const struct {
+	const char *phase;
+	const char *zoneSuffix;
+} kLoadPhases[] = {
+	{ "resources", "Engine::initResources"              },
+	{ "module"   , "Module::loadModule"                 },
+	{ "area"     , "Area::load"                         },
+	{ "models"   , "loadModelObject"                    },
+	{ "textures" , "Texture::create"                    },
+	{ "uploads"  , "GraphicsManager::buildNewTextures"  }
+};
+
+/** Escape a string for use within a JSON string. */
+static Common::UString escapeJSON(const Common::UString &str) {
+	Common::UString escaped;
+
+	for (Common::UString::iterator c = str.begin(); c != str.end(); ++c) {
+		if ((*c == '"') || (*c == '\\'))
+			escaped += '\\';
+
+		if (*c < 0x20)
+			escaped += Common::UString::format("\\u%04X", (unsigned int) *c);
+		else
+			escaped += *c;
+	}
+
+	return escaped;
+}
+
+Engine::Engine() : _game(Aurora::kGameIDUnknown), _platform(Aurora::kPlatformUnknown), _benchmarkStart(0) {
 }
 
 Engine::~Engine() {
@@ -80,14 +130,134 @@ bool Engine::changeLanguage() {
 
 void Engine::start(Aurora::GameID game, const Common::UString &target, Aurora::Platform platform) {
 	showFPS();
+	showPerformance();
+
+	if (ConfigMan.getBool("resindexcache", false))
+		ResMan.setIndexCache(Common::FilePath::getUserDataFile("resindex.cache"));
+
+	ResMan.setMapArchives(ConfigMan.getBool("maparchives", false));
+	ResMan.setPrefetchThreads(MAX(ConfigMan.getInt("prefetchthreads", 2), 0));
+	ResMan.setResourceCacheSize(((size_t) MAX(ConfigMan.getInt("resourcecache", 32), 0)) * 1024 * 1024);
+
+	// Keep the traces of each game installation apart
+	if (ConfigMan.getBool("resourcetrace", false))
+		ResMan.setResourceTraceDirectory(Common::FilePath::getUserDataFile(
+			Common::UString::format("resourcetraces/%08X", Common::hashStringFNV32(target))));
 
 	_game     = game;
 	_platform = platform;
 	_target   = target;
 
+	if (ConfigMan.getBool("prebake", false)) {
+		runPrebake();
+		return;
+	}
+
+	const Common::UString benchmark = ConfigMan.getString("benchmark-load", "");
+	if (!benchmark.empty()) {
+		runLoadBenchmark(benchmark);
+		return;
+	}
+
 	run();
 }
 
+void Engine::benchmarkLoad(const Common::UString &UNUSED(module), const Common::UString &UNUSED(area)) {
+	throw Common::Exception("This engine doesn't support the load benchmark");
+}
+
+void Engine::runLoadBenchmark(const Common::UString &spec) {
+	// "<module>[:<area>]"
+	Common::UString module = spec, area;
+
+	Common::UString::iterator colon = spec.findFirst(':');
+	if (colon != spec.end()) {
+		module = spec.substr(spec.begin(), colon);
+		area   = spec.substr(++colon, spec.end());
+	}
+
+	if (module.empty())
+		throw Common::Exception("No module given for the load benchmark");
+
+	status("Benchmarking the load of module \"%s\"", module.c_str());
+
+	ProfilerMan.clear();
+	ProfilerMan.setEnabled(true);
+
+	_benchmarkStart = Common::Profiler::getTime();
+
+	try {
+		benchmarkLoad(module, area);
+	} catch (...) {
+		// A failed benchmark must not look like a successful one
+		EventMan.raiseFatalError();
+		throw;
+	}
+
+	EventMan.requestQuit();
+}
+
+void Engine::prebake() {
+	throw Common::Exception("This engine doesn't support prebaked archives");
+}
+
+void Engine::runPrebake() {
+	status("Prebaking the resources of target \"%s\"", _target.c_str());
+
+	try {
+		prebake();
+	} catch (...) {
+		EventMan.raiseFatalError();
+		throw;
+	}
+
+	EventMan.requestQuit();
+}
+
+void Engine::finishLoadBenchmark(const Common::UString &module, const Common::UString &area) {
+	/* Textures and meshes are created by the main thread, which won't render
+	 * anything while benchmarking. Wait for it to get through them. */
+	while (GfxMan.hasPendingObjects() && !EventMan.quitRequested())
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	const uint64_t total = Common::Profiler::getTime() - _benchmarkStart;
+
+	const Common::Profiler::Entries entries = ProfilerMan.getEntries();
+
+	Common::UString report;
+	report += Common::UString::format("{\"target\":\"%s\",\"module\":\"%s\",\"area\":\"%s\",\"total_ms\":%.3f",
+	                                  escapeJSON(_target).c_str(), escapeJSON(module).c_str(),
+	                                  escapeJSON(area).c_str(), total / 1000.0);
+
+	report += ",\"phases\":{";
+	for (size_t i = 0; i < ARRAYSIZE(kLoadPhases); i++) {
+		uint64_t calls = 0, time = 0;
+
+		for (Common::Profiler::Entries::const_iterator e = entries.begin(); e != entries.end(); ++e) {
+			if (Common::UString(e->name).endsWith(kLoadPhases[i].zoneSuffix)) {
+				calls += e->calls;
+				time  += e->time;
+			}
+		}
+
+		report += Common::UString::format("%s\"%s\":{\"calls\":%u,\"ms\":%.3f}", (i == 0) ? "" : ",",
+		                                  kLoadPhases[i].phase, (uint) calls, time / 1000.0);
+	}
+	report += "}";
+
+	report += ",\"zones\":[";
+	for (Common::Profiler::Entries::const_iterator e = entries.begin(); e != entries.end(); ++e)
+		report += Common::UString::format("%s{\"name\":\"%s\",\"calls\":%u,\"ms\":%.3f}",
+		                                  (e == entries.begin()) ? "" : ",", escapeJSON(e->name).c_str(),
+		                                  (uint) e->calls, e->time / 1000.0);
+	report += "]}";
+
+	std::printf("%s\n", report.c_str());
+	std::fflush(stdout);
+
+	status("Loading module \"%s\" took %.3fs", module.c_str(), total / 1000000.0);
+}
+
 void Engine::showFPS() {
 	bool show = ConfigMan.getBool("showfps", false);
 
@@ -103,6 +273,21 @@ void Engine::showFPS() {
 	}
 }
 
+void Engine::showPerformance() {
+	bool show = ConfigMan.getBool("showperformance", false);
+
+	if        ( show && !_performanceOverlay) {
+
+		_performanceOverlay = std::make_unique<PerformanceOverlay>();
+		_performanceOverlay->show();
+
+	} else if (!show &&  _performanceOverlay) {
+
+		_performanceOverlay.reset();
+
+	}
+}
+
 static bool hasLanguage(const std::vector<Aurora::Language> &langs, Aurora::Language lang) {
 	return std::find(langs.begin(), langs.end(), lang) != langs.end();
 }
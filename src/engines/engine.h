@@ -44,6 +44,7 @@ namespace Graphics {
 namespace Engines {
 
 class Console;
+class PerformanceOverlay;
 
 /** The base class for an engine within BioWare's Aurora family. */
 class Engine : boost::noncopyable {
@@ -78,6 +79,8 @@ public:
 
 	/** Evaluate the FPS display setting and show/hide the FPS display. */
 	void showFPS();
+	/** Evaluate the performance overlay setting and show/hide the performance overlay. */
+	void showPerformance();
 
 protected:
 	Aurora::GameID   _game;
@@ -87,13 +90,39 @@ protected:
 	std::unique_ptr<Console> _console;
 
 	std::unique_ptr<Graphics::Aurora::FPS> _fps;
+	std::unique_ptr<PerformanceOverlay> _performanceOverlay;
 
 
 	/** Run the game. */
 	virtual void run() = 0;
 
+	/** Initialize the engine and load a module for the load benchmark, without running the game.
+	 *
+	 *  Engines supporting the load benchmark override this to load the module
+	 *  and the area (its entry area, if empty), call finishLoadBenchmark() and
+	 *  deinitialize again. By default, this throws.
+	 */
+	virtual void benchmarkLoad(const Common::UString &module, const Common::UString &area);
+
+	/** Wait for the graphics of the loaded module to be created, then print the load benchmark report. */
+	void finishLoadBenchmark(const Common::UString &module, const Common::UString &area);
+
+	/** Initialize the engine to write the prebaked archive of the game's resources, without running the game.
+	 *
+	 *  Engines supporting prebaked archives call usePrebakedArchive() after
+	 *  indexing their base resources, and override this to initialize and
+	 *  deinitialize again. By default, this throws.
+	 */
+	virtual void prebake();
+
 	bool evaluateLanguage(bool find, Aurora::Language &language) const;
 	bool evaluateLanguage(bool find, Aurora::Language &languageVoice, Aurora::Language &languageText) const;
+
+private:
+	uint64_t _benchmarkStart; ///< When the load benchmark started, in profiler time.
+
+	void runLoadBenchmark(const Common::UString &spec);
+	void runPrebake();
 };
 
 } // End of namespace Engines
@@ -25,6 +25,7 @@
 #include <cassert>
 
 #include <memory>
+#include <vector>
 
 #include "src/common/util.h"
 #include "src/common/error.h"
@@ -34,6 +35,7 @@
 #include "src/common/filepath.h"
 #include "src/common/debugman.h"
 #include "src/common/configman.h"
+#include "src/common/threadpool.h"
 
 #include "src/aurora/types.h"
 #include "src/aurora/util.h"
@@ -142,10 +144,19 @@ bool GameInstanceEngine::probe(const std::list<const EngineProbe *> &probes) {
 bool GameInstanceEngine::probe(const Common::FileList &rootFiles,
                                const std::list<const EngineProbe *> &probes) {
 
-	// Try to find the first engine able to handle the directory's data
-	for (std::list<const EngineProbe *>::const_iterator p = probes.begin(); p != probes.end(); ++p) {
-		if ((*p)->probe(_target, rootFiles)) {
-			_probe = *p;
+	/* Run all probes at once. They only look at the directory, and the contents
+	 * of every directory they look into are cached and shared between them. */
+	const std::vector<const EngineProbe *> probeList(probes.begin(), probes.end());
+	std::vector<char> found(probeList.size(), 0);
+
+	ThreadPoolMan.parallelFor(probeList.size(), [&](size_t i) {
+		found[i] = probeList[i]->probe(_target, rootFiles) ? 1 : 0;
+	});
+
+	// Take the first engine able to handle the directory's data
+	for (size_t i = 0; i < probeList.size(); i++) {
+		if (found[i]) {
+			_probe = probeList[i];
 			return true;
 		}
 	}
@@ -53,7 +53,10 @@ public:
 	/** Return a string of the full game name. */
 	virtual const Common::UString &getGameName() const = 0;
 
-	/** Check for the game in that directory, containing these files. */
+	/** Check for the game in that directory, containing these files.
+	 *
+	 *  All probes are run concurrently, so this must not touch any global state.
+	 */
 	virtual bool probe(const Common::UString &directory, const Common::FileList &rootFiles) const = 0;
 
 	/** Check for the game in that file. */
@@ -27,6 +27,7 @@
 #include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/readstream.h"
+#include "src/common/profiler.h"
 
 #include "src/sound/sound.h"
 #include "src/sound/xactsoundbank.h"
@@ -78,6 +79,8 @@ Area::~Area() {
 }
 
 void Area::load() {
+	PROFILE_ZONE("Area::load");
+
 	Aurora::GFF3File are(_resRef, Aurora::kFileTypeARE, MKTAG('A', 'R', 'E', ' '));
 	loadARE(are.getTopLevel());
 
@@ -24,6 +24,8 @@
 
 #include <cassert>
 
+#include "src/common/error.h"
+
 #include "src/aurora/resman.h"
 #include "src/aurora/2dafile.h"
 #include "src/aurora/2dareg.h"
@@ -83,6 +85,19 @@ void Game::run() {
 	_module.reset();
 }
 
+void Game::benchmarkLoad(const Common::UString &module, Common::UString &area) {
+	if (!ResMan.hasResource(module, Aurora::kFileTypeARE))
+		throw Common::Exception("No such module \"%s\"", module.c_str());
+
+	if (!area.empty() && !area.equalsIgnoreCase(module))
+		throw Common::Exception("Module \"%s\" has no area \"%s\"", module.c_str(), area.c_str());
+
+	_module = std::make_unique<Module>(*_console);
+	_module->load(module);
+
+	area = module;
+}
+
 void Game::runModule() {
 	std::unique_ptr<Creature> fakePC = std::make_unique<Creature>();
 	fakePC->createFakePC();
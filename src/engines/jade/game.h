@@ -60,6 +60,13 @@ public:
 
 	void run();
 
+	/** Load a module for the load benchmark, without running it.
+	 *
+	 *  A module is a single area of the same name. If an area is given, it
+	 *  has to be this one. Either way, the name of the area is returned in area.
+	 */
+	void benchmarkLoad(const Common::UString &module, Common::UString &area);
+
 	/** Return a list of all modules. */
 	static void getModules(std::vector<Common::UString> &modules);
 
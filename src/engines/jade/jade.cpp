@@ -28,6 +28,7 @@
 #include "src/common/filelist.h"
 #include "src/common/filepath.h"
 #include "src/common/configman.h"
+#include "src/common/profiler.h"
 
 #include "src/aurora/util.h"
 #include "src/aurora/resman.h"
@@ -174,6 +175,29 @@ void JadeEngine::run() {
 	deinit();
 }
 
+void JadeEngine::benchmarkLoad(const Common::UString &module, const Common::UString &area) {
+	init();
+	if (EventMan.quitRequested())
+		return;
+
+	_game = std::make_unique<Game>(*this, *_console, _platform);
+
+	Common::UString loadedArea = area;
+	_game->benchmarkLoad(module, loadedArea);
+
+	finishLoadBenchmark(module, loadedArea);
+
+	deinit();
+}
+
+void JadeEngine::prebake() {
+	init();
+	if (EventMan.quitRequested())
+		return;
+
+	deinit();
+}
+
 void JadeEngine::init() {
 	LoadProgress progress(17);
 
@@ -254,6 +278,8 @@ static Common::UString findAndroidVOLanguageDir(const Common::UString &target) {
 }
 
 void JadeEngine::initResources(LoadProgress &progress) {
+	PROFILE_ZONE("JadeEngine::initResources");
+
 	// Some new file types with the same function as old ones re-use the type ID
 	ResMan.addTypeAlias(Aurora::kFileTypeBTC, Aurora::kFileTypeCRE);
 	ResMan.addTypeAlias(Aurora::kFileTypeBTP, Aurora::kFileTypePLA);
@@ -270,14 +296,16 @@ void JadeEngine::initResources(LoadProgress &progress) {
 	indexMandatoryArchive("chitin.key", 10);
 
 	progress.step("Loading global auxiliary resources");
-	indexMandatoryArchive("loadscreens.mod"   , 50);
-	indexMandatoryArchive("players.mod"       , 51);
-	indexMandatoryArchive("global-a.rim"      , 52);
-	indexMandatoryArchive("ingamemenu-a.rim"  , 53);
-	indexMandatoryArchive("globalunload-a.rim", 54);
-	indexMandatoryArchive("minigame-a.rim"    , 55);
-	indexMandatoryArchive("miniglobal-a.rim"  , 56);
-	indexMandatoryArchive("mmenu-a.rim"       , 57);
+	ArchiveBatch batch;
+	batch.addMandatory("loadscreens.mod"   , 50);
+	batch.addMandatory("players.mod"       , 51);
+	batch.addMandatory("global-a.rim"      , 52);
+	batch.addMandatory("ingamemenu-a.rim"  , 53);
+	batch.addMandatory("globalunload-a.rim", 54);
+	batch.addMandatory("minigame-a.rim"    , 55);
+	batch.addMandatory("miniglobal-a.rim"  , 56);
+	batch.addMandatory("mmenu-a.rim"       , 57);
+	batch.index();
 
 	progress.step("Indexing extra font resources");
 	indexMandatoryDirectory("fonts"   , 0, -1, 100);
@@ -322,6 +350,8 @@ void JadeEngine::initResources(LoadProgress &progress) {
 		indexOptionalDirectory(langDir + "/override", 0,  0, 170);
 	}
 
+	usePrebakedArchive(_target);
+
 	if (EventMan.quitRequested())
 		return;
 
@@ -59,6 +59,8 @@ public:
 
 protected:
 	void run();
+	void benchmarkLoad(const Common::UString &module, const Common::UString &area);
+	void prebake();
 
 
 private:
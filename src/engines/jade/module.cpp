@@ -25,6 +25,7 @@
 #include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/ustring.h"
+#include "src/common/profiler.h"
 
 #include "src/graphics/camera.h"
 
@@ -77,6 +78,8 @@ void Module::load(const Common::UString &module) {
 }
 
 void Module::loadModule(const Common::UString &module) {
+	PROFILE_ZONE("Module::loadModule");
+
 	unload(false);
 
 	_module = module;
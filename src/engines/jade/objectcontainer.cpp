@@ -77,7 +77,7 @@ void ObjectContainer::clearObjects() {
 	for (size_t i = 0; i < kObjectTypeMAX; i++)
 		_objects[i].clear();
 
-	::Aurora::NWScript::ObjectContainer::clearObjects();
+	eraseObjects();
 
 	unlock();
 }
@@ -85,7 +85,7 @@ void ObjectContainer::clearObjects() {
 void ObjectContainer::addObject(Jade::Object &object) {
 	lock();
 
-	::Aurora::NWScript::ObjectContainer::addObject(object);
+	insertObject(object);
 
 	ObjectType type = object.getType();
 	if (((uint) type) < kObjectTypeMAX)
@@ -101,7 +101,7 @@ void ObjectContainer::removeObject(Jade::Object &object) {
 	if (((uint) type) < kObjectTypeMAX)
 		_objects[type].remove(&object);
 
-	::Aurora::NWScript::ObjectContainer::removeObject(object);
+	eraseObject(object);
 
 	unlock();
 }
@@ -67,6 +67,9 @@ void Room::load(const Common::UString &resRef, uint32_t id, float x, float y, fl
 		throw Common::Exception("Can't load room model \"%s\"", resRef.c_str());
 
 	_model->setPosition(x, y, z);
+
+	// Room geometry doesn't move, so draw it in as few pieces as possible
+	_model->batchStaticNodes();
 }
 
 void Room::unload() {
@@ -77,6 +77,12 @@ void Game::run() {
 	_module.reset();
 }
 
+void Game::benchmarkLoad(const Common::UString &module, Common::UString &area) {
+	_module = std::make_unique<Module>(*_console);
+
+	loadBenchmarkModule(module, area);
+}
+
 void Game::runModule() {
 	if (EventMan.quitRequested() || !_module->isLoaded()) {
 		_module->clear();
@@ -92,7 +98,7 @@ void Game::runModule() {
 			_module->addEvent(event);
 
 		_module->processEventQueue();
-		EventMan.delay(10);
+		_module->waitForNextTick();
 	}
 
 	EventMan.enableKeyRepeat(false);
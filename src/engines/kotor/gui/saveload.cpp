@@ -133,6 +133,8 @@ void SaveLoadMenu::addSavedGameItems(Odyssey::WidgetListBox *listBox) {
 	dirs.addSubDirectories(savesDir);
 	Common::UString slotTextFormat = TalkMan.getString(1594);
 
+	KotORBase::SavedGameIndex &savedGames = _module->getSavedGameIndex();
+
 	dirs.sort(true);
 	for (Common::FileList::const_iterator it = dirs.begin(); it != dirs.end(); ++it) {
 		Common::UString saveDir = *it;
@@ -150,9 +152,18 @@ void SaveLoadMenu::addSavedGameItems(Odyssey::WidgetListBox *listBox) {
 		if (_type == kSaveLoadMenuTypeSave && !baseName.contains("Game"))
 			continue;
 
+		const KotORBase::SavedGameInfo *save = 0;
+		try {
+			save = &savedGames.get(saveDir);
+		} catch (Common::Exception &e) {
+			e.add("Failed to read saved game \"%s\"", saveDir.c_str());
+
+			printException(e, "WARNING: ");
+			continue;
+		}
+
 		_saveDirs.push_back(saveDir);
-		KotORBase::SavedGame *save = new SavedGame(saveDir);
-		uint32_t timePlayed = save->getTimePlayed();
+		uint32_t timePlayed = save->timePlayed;
 		Common::UString slotText(slotTextFormat);
 
 		slotText.replaceAll("Game <CUSTOM0>", baseName);
@@ -160,9 +171,8 @@ void SaveLoadMenu::addSavedGameItems(Odyssey::WidgetListBox *listBox) {
 		slotText.replaceAll("<CUSTOM2>", Common::composeString(timePlayed % 3600 / 60));
 
 		if (baseName.contains("Game"))
-			slotText += "\r\n" + save->getName();
+			slotText += "\r\n" + save->name;
 
-		delete save;
 		listBox->addItem(slotText);
 	}
 }
@@ -29,8 +29,10 @@
 #include "src/common/filelist.h"
 #include "src/common/filepath.h"
 #include "src/common/configman.h"
+#include "src/common/profiler.h"
 
 #include "src/aurora/resman.h"
+#include "src/aurora/2dareg.h"
 #include "src/aurora/language.h"
 #include "src/aurora/talkman.h"
 #include "src/aurora/talktable_tlk.h"
@@ -55,6 +57,13 @@ namespace Engines {
 
 namespace KotOR {
 
+/** The 2DAs used all over the game, loaded in one go when starting. */
+static const char * const k2DAs[] = {
+	"ambientmusic", "ambientsound", "appearance", "baseitems", "camerastyle", "classes",
+	"creaturespeed", "doortypes", "genericdoors", "heads", "placeableobjsnds", "placeables",
+	"portraits", "surfacemat"
+};
+
 KotOREngine::KotOREngine() : _language(Aurora::kLanguageInvalid), _hasLiveKey(false) {
 
 	_console = std::make_unique<Console>(*this);
@@ -124,8 +133,31 @@ void KotOREngine::run() {
 	deinit();
 }
 
+void KotOREngine::benchmarkLoad(const Common::UString &module, const Common::UString &area) {
+	init();
+	if (EventMan.quitRequested())
+		return;
+
+	_game = std::make_unique<Game>(*this, *_console, *_version);
+
+	Common::UString loadedArea = area;
+	_game->benchmarkLoad(module, loadedArea);
+
+	finishLoadBenchmark(module, loadedArea);
+
+	deinit();
+}
+
+void KotOREngine::prebake() {
+	init();
+	if (EventMan.quitRequested())
+		return;
+
+	deinit();
+}
+
 void KotOREngine::init() {
-	LoadProgress progress(19);
+	LoadProgress progress(20);
 
 	progress.step("Declare languages");
 	declareLanguages();
@@ -155,6 +187,12 @@ void KotOREngine::init() {
 	progress.step("Loading game cursors");
 	initCursors();
 
+	if (EventMan.quitRequested())
+		return;
+
+	progress.step("Loading 2DAs");
+	init2DAs();
+
 	if (EventMan.quitRequested())
 		return;
 
@@ -202,6 +240,8 @@ void KotOREngine::declareLanguages() {
 }
 
 void KotOREngine::initResources(LoadProgress &progress) {
+	PROFILE_ZONE("KotOREngine::initResources");
+
 	// In the Xbox version of KotOR, TXB textures are actually TPCs
 	if (_platform == Aurora::kPlatformXbox)
 		ResMan.addTypeAlias(Aurora::kFileTypeTXB, Aurora::kFileTypeTPC);
@@ -228,16 +268,18 @@ void KotOREngine::initResources(LoadProgress &progress) {
 		_hasLiveKey = true;
 
 	progress.step("Loading global auxiliary resources");
-	indexMandatoryArchive("mainmenu.rim"    , 50);
-	indexMandatoryArchive("mainmenudx.rim"  , 51);
-	indexMandatoryArchive("legal.rim"       , 52);
-	indexMandatoryArchive("legaldx.rim"     , 53);
-	indexMandatoryArchive("global.rim"      , 54);
-	indexMandatoryArchive("subglobaldx.rim" , 55);
-	indexMandatoryArchive("miniglobaldx.rim", 56);
-	indexMandatoryArchive("globaldx.rim"    , 57);
-	indexMandatoryArchive("chargen.rim"     , 58);
-	indexMandatoryArchive("chargendx.rim"   , 59);
+	ArchiveBatch batch;
+	batch.addMandatory("mainmenu.rim"    , 50);
+	batch.addMandatory("mainmenudx.rim"  , 51);
+	batch.addMandatory("legal.rim"       , 52);
+	batch.addMandatory("legaldx.rim"     , 53);
+	batch.addMandatory("global.rim"      , 54);
+	batch.addMandatory("subglobaldx.rim" , 55);
+	batch.addMandatory("miniglobaldx.rim", 56);
+	batch.addMandatory("globaldx.rim"    , 57);
+	batch.addMandatory("chargen.rim"     , 58);
+	batch.addMandatory("chargendx.rim"   , 59);
+	batch.index();
 
 	if (_platform == Aurora::kPlatformXbox) {
 		// The Xbox version has most of its textures in "textures.bif"
@@ -284,6 +326,8 @@ void KotOREngine::initResources(LoadProgress &progress) {
 	indexOptionalArchive("patch.erf", 499);
 	indexOptionalDirectory("override", 0, 0, 500);
 
+	usePrebakedArchive(_target);
+
 	if (EventMan.quitRequested())
 		return;
 
@@ -493,6 +537,10 @@ void KotOREngine::initConfig() {
 	ConfigMan.setBool(Common::kConfigRealmDefault, "flycamallrooms", true);
 }
 
+void KotOREngine::init2DAs() {
+	TwoDAReg.warm2DAs(std::vector<Common::UString>(k2DAs, k2DAs + ARRAYSIZE(k2DAs)));
+}
+
 void KotOREngine::initGameConfig() {
 	ConfigMan.setString(Common::kConfigRealmGameTemp, "KOTOR_moduleDir",
 		Common::FilePath::findSubDirectory(_target, "modules", true));
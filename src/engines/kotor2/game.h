@@ -46,6 +46,7 @@ public:
 	bool hasModule(const Common::UString &module) const override;
 
 	void run() override;
+	void benchmarkLoad(const Common::UString &module, Common::UString &area) override;
 
 private:
 	KotOR2Engine *_engine;
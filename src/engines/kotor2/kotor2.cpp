@@ -29,8 +29,10 @@
 #include "src/common/filelist.h"
 #include "src/common/filepath.h"
 #include "src/common/configman.h"
+#include "src/common/profiler.h"
 
 #include "src/aurora/resman.h"
+#include "src/aurora/2dareg.h"
 #include "src/aurora/language.h"
 #include "src/aurora/talkman.h"
 #include "src/aurora/talktable_tlk.h"
@@ -54,6 +56,13 @@ namespace Engines {
 
 namespace KotOR2 {
 
+/** The 2DAs used all over the game, loaded in one go when starting. */
+static const char * const k2DAs[] = {
+	"ambientmusic", "ambientsound", "appearance", "baseitems", "camerastyle", "classes",
+	"creaturespeed", "doortypes", "genericdoors", "heads", "placeableobjsnds", "placeables",
+	"portraits", "surfacemat"
+};
+
 KotOR2Engine::KotOR2Engine() : _language(Aurora::kLanguageInvalid) {
 	_console = std::make_unique<Console>(*this);
 }
@@ -128,8 +137,31 @@ void KotOR2Engine::run() {
 	deinit();
 }
 
+void KotOR2Engine::benchmarkLoad(const Common::UString &module, const Common::UString &area) {
+	init();
+	if (EventMan.quitRequested())
+		return;
+
+	_game = std::make_unique<Game>(*this, *_console, _platform);
+
+	Common::UString loadedArea = area;
+	_game->benchmarkLoad(module, loadedArea);
+
+	finishLoadBenchmark(module, loadedArea);
+
+	deinit();
+}
+
+void KotOR2Engine::prebake() {
+	init();
+	if (EventMan.quitRequested())
+		return;
+
+	deinit();
+}
+
 void KotOR2Engine::init() {
-	LoadProgress progress(17);
+	LoadProgress progress(18);
 
 	progress.step("Declare languages");
 	declareLanguages();
@@ -156,6 +188,12 @@ void KotOR2Engine::init() {
 	progress.step("Loading game cursors");
 	initCursors();
 
+	if (EventMan.quitRequested())
+		return;
+
+	progress.step("Loading 2DAs");
+	init2DAs();
+
 	if (EventMan.quitRequested())
 		return;
 
@@ -183,6 +221,8 @@ void KotOR2Engine::declareLanguages() {
 }
 
 void KotOR2Engine::initResources(LoadProgress &progress) {
+	PROFILE_ZONE("KotOR2Engine::initResources");
+
 	// In the Xbox version of KotOR2, TXB textures are actually TPCs
 	if (_platform == Aurora::kPlatformXbox)
 		ResMan.addTypeAlias(Aurora::kFileTypeTXB, Aurora::kFileTypeTPC);
@@ -244,6 +284,8 @@ void KotOR2Engine::initResources(LoadProgress &progress) {
 	progress.step("Indexing override files");
 	indexOptionalDirectory("override", 0, 0, 500);
 
+	usePrebakedArchive(_target);
+
 	if (EventMan.quitRequested())
 		return;
 
@@ -400,6 +442,10 @@ void KotOR2Engine::initConfig() {
 	ConfigMan.setBool(Common::kConfigRealmDefault, "flycamallrooms", true);
 }
 
+void KotOR2Engine::init2DAs() {
+	TwoDAReg.warm2DAs(std::vector<Common::UString>(k2DAs, k2DAs + ARRAYSIZE(k2DAs)));
+}
+
 void KotOR2Engine::initGameConfig() {
 	ConfigMan.setString(Common::kConfigRealmGameTemp, "KOTOR2_moduleDir",
 		Common::FilePath::findSubDirectory(ResMan.getDataBase(), "modules", true));
@@ -52,6 +52,8 @@ public:
 
 protected:
 	void run();
+	void benchmarkLoad(const Common::UString &module, const Common::UString &area);
+	void prebake();
 
 
 private:
@@ -65,6 +67,7 @@ private:
 	void initResources(LoadProgress &progress);
 	void initCursorsRemap();
 	void initCursors();
+	void init2DAs();
 	void initGameConfig();
 
 	void deinit();
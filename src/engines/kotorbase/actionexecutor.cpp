@@ -25,6 +25,7 @@
 #include "external/glm/vec3.hpp"
 #include "external/glm/gtc/type_ptr.hpp"
 
+#include "src/common/util.h"
 #include "src/common/maths.h"
 
 #include "src/engines/kotorbase/creature.h"
@@ -41,21 +42,53 @@ namespace Engines {
 namespace KotORBase {
 
 void ActionExecutor::execute(const Action &action, const ExecutionContext &ctx) {
+	Movement movement;
+	planMovement(action, ctx, movement);
+
+	apply(action, movement, ctx);
+}
+
+void ActionExecutor::planMovement(const Action &action, const ExecutionContext &ctx, Movement &movement) {
+	float x, y, _;
+
+	switch (action.type) {
+		case kActionMoveToPoint:
+			planMoveTo(action.location, action.range, ctx, movement);
+			break;
+		case kActionFollowLeader:
+			ctx.area->_module->getPartyLeader()->getPosition(x, y, _);
+			planMoveTo(glm::vec2(x, y), action.range, ctx, movement);
+			break;
+		case kActionOpenLock:
+		case kActionUseObject:
+			action.object->getPosition(x, y, _);
+			planMoveTo(glm::vec2(x, y), action.range, ctx, movement);
+			break;
+		case kActionAttackObject:
+			action.object->getPosition(x, y, _);
+			planMoveTo(glm::vec2(x, y), ctx.creature->getMaxAttackRange(), ctx, movement);
+			break;
+		default:
+			break;
+	}
+}
+
+void ActionExecutor::apply(const Action &action, const Movement &movement, const ExecutionContext &ctx) {
 	switch (action.type) {
 		case kActionMoveToPoint:
-			executeMoveToPoint(action, ctx);
+			executeMoveToPoint(action, movement, ctx);
 			break;
 		case kActionFollowLeader:
-			executeFollowLeader(action, ctx);
+			executeFollowLeader(action, movement, ctx);
 			break;
 		case kActionOpenLock:
-			executeOpenLock(action, ctx);
+			executeOpenLock(action, movement, ctx);
 			break;
 		case kActionUseObject:
-			executeUseObject(action, ctx);
+			executeUseObject(action, movement, ctx);
 			break;
 		case kActionAttackObject:
-			executeAttackObject(action, ctx);
+			executeAttackObject(action, movement, ctx);
 			break;
 		default:
 			warning("TODO: Handle action %u", (uint)action.type);
@@ -63,25 +96,17 @@ void ActionExecutor::execute(const Action &action, const ExecutionContext &ctx)
 	}
 }
 
-void ActionExecutor::executeMoveToPoint(const Action &action, const ExecutionContext &ctx) {
-	if (moveTo(action.location, action.range, ctx))
+void ActionExecutor::executeMoveToPoint(const Action &UNUSED(action), const Movement &movement, const ExecutionContext &ctx) {
+	if (moveTo(movement, ctx))
 		ctx.creature->popAction();
 }
 
-void ActionExecutor::executeFollowLeader(const Action &action, const ExecutionContext &ctx) {
-	Creature *partyLeader = ctx.area->_module->getPartyLeader();
-
-	float x, y, _;
-	partyLeader->getPosition(x, y, _);
-
-	moveTo(glm::vec2(x, y), action.range, ctx);
+void ActionExecutor::executeFollowLeader(const Action &UNUSED(action), const Movement &movement, const ExecutionContext &ctx) {
+	moveTo(movement, ctx);
 }
 
-void ActionExecutor::executeOpenLock(const Action &action, const ExecutionContext &ctx) {
-	float x, y, _;
-	action.object->getPosition(x, y, _);
-
-	if (!moveTo(glm::vec2(x, y), action.range, ctx))
+void ActionExecutor::executeOpenLock(const Action &action, const Movement &movement, const ExecutionContext &ctx) {
+	if (!moveTo(movement, ctx))
 		return;
 
 	ctx.creature->popAction();
@@ -108,11 +133,8 @@ void ActionExecutor::executeOpenLock(const Action &action, const ExecutionContex
 	warning("Cannot unlock an object that is not a door or a placeable");
 }
 
-void ActionExecutor::executeUseObject(const Action &action, const ExecutionContext &ctx) {
-	float x, y, _;
-	action.object->getPosition(x, y, _);
-
-	if (!moveTo(glm::vec2(x, y), action.range, ctx))
+void ActionExecutor::executeUseObject(const Action &action, const Movement &movement, const ExecutionContext &ctx) {
+	if (!moveTo(movement, ctx))
 		return;
 
 	ctx.creature->popAction();
@@ -151,11 +173,8 @@ void ActionExecutor::executeUseObject(const Action &action, const ExecutionConte
 	}
 }
 
-void ActionExecutor::executeAttackObject(const Action &action, const ExecutionContext &ctx) {
-	float x, y, _;
-	action.object->getPosition(x, y, _);
-
-	if (!moveTo(glm::vec2(x, y), ctx.creature->getMaxAttackRange(), ctx))
+void ActionExecutor::executeAttackObject(const Action &action, const Movement &movement, const ExecutionContext &ctx) {
+	if (!moveTo(movement, ctx))
 		return;
 
 	ctx.creature->popAction();
@@ -168,11 +187,13 @@ bool ActionExecutor::isLocationReached(const glm::vec2 &location, float range, c
 	return glm::distance(glm::vec2(x, y), location) <= range;
 }
 
-bool ActionExecutor::moveTo(const glm::vec2 &location, float range, const ExecutionContext &ctx) {
-	if (isLocationReached(location, range, ctx))
-		return true;
+void ActionExecutor::planMoveTo(const glm::vec2 &location, float range, const ExecutionContext &ctx, Movement &movement) {
+	movement.location = location;
+	movement.range = range;
 
-	ctx.creature->makeLookAt(location.x, location.y);
+	movement.reached = isLocationReached(location, range, ctx);
+	if (movement.reached)
+		return;
 
 	float oX, oY, oZ;
 	ctx.creature->getPosition(oX, oY, oZ);
@@ -182,19 +203,37 @@ bool ActionExecutor::moveTo(const glm::vec2 &location, float range, const Execut
 	glm::vec2 dir = glm::normalize(diff);
 
 	float dist = glm::length(diff);
-	bool run = dist > kWalkDistance;
-	float moveRate = run ? ctx.creature->getRunRate() : ctx.creature->getWalkRate();
+	movement.run = dist > kWalkDistance;
+	float moveRate = movement.run ? ctx.creature->getRunRate() : ctx.creature->getWalkRate();
 
 	float x = origin.x + moveRate * dir.x * ctx.frameTime;
 	float y = origin.y + moveRate * dir.y * ctx.frameTime;
 	float z = ctx.area->evaluateElevation(x, y);
 
-	bool haveMovement = (z != FLT_MIN) &&
+	movement.position   = glm::vec3(x, y, z);
+	movement.onWalkmesh = z != FLT_MIN;
+}
+
+bool ActionExecutor::moveTo(const Movement &movement, const ExecutionContext &ctx) {
+	if (movement.reached)
+		return true;
+
+	ctx.creature->makeLookAt(movement.location.x, movement.location.y);
+
+	float oX, oY, oZ;
+	ctx.creature->getPosition(oX, oY, oZ);
+
+	const float x = movement.position.x;
+	const float y = movement.position.y;
+	const float z = movement.position.z;
+
+	// The local walkmesh is a single shared scratch grid, so this can't be planned ahead
+	bool haveMovement = movement.onWalkmesh &&
 	                     ctx.area->walkable(glm::vec3(oX, oY, oZ + 0.1f),
 	                                        glm::vec3(x, y, z + 0.1f));
 
 	if (haveMovement) {
-		ctx.creature->playAnimation(run ? "run" : "walk", false, -1.0f);
+		ctx.creature->playAnimation(movement.run ? "run" : "walk", false, -1.0f);
 		ctx.creature->setPosition(x, y, z);
 
 		if (ctx.creature == ctx.area->_module->getPartyLeader())
@@ -202,10 +241,10 @@ bool ActionExecutor::moveTo(const glm::vec2 &location, float range, const Execut
 		else
 			ctx.area->notifyObjectMoved(*ctx.creature);
 
-		diff = location - glm::vec2(x, y);
-		dist = glm::length(diff);
+		glm::vec2 diff = movement.location - glm::vec2(x, y);
+		float dist = glm::length(diff);
 
-		if (dist <= range) {
+		if (dist <= movement.range) {
 			ctx.creature->playDefaultAnimation();
 			return true;
 		}
@@ -25,6 +25,9 @@
 #ifndef ENGINES_KOTORBASE_ACTIONEXECUTOR_H
 #define ENGINES_KOTORBASE_ACTIONEXECUTOR_H
 
+#include "external/glm/vec2.hpp"
+#include "external/glm/vec3.hpp"
+
 namespace Engines {
 
 namespace KotORBase {
@@ -41,23 +44,46 @@ public:
 		float frameTime { 0.0f };
 	};
 
+	/** A step of a creature towards the location its action needs it to be at. */
+	struct Movement {
+		glm::vec2 location;        ///< The location the creature moves towards.
+		float range { 0.0f };      ///< How close the creature needs to get.
+		bool reached { false };    ///< Is the creature already within range?
+		bool run { false };        ///< Should the creature run instead of walk?
+		glm::vec3 position;        ///< The position after the step.
+		bool onWalkmesh { false }; ///< Is the position on the walkmesh?
+	};
+
+	/** Plan and execute an action in one go. */
 	static void execute(const Action &action, const ExecutionContext &ctx);
 
+	/** Plan the movement the action needs this frame.
+	 *
+	 *  Only reads from the creature and the area, so the movements of many
+	 *  creatures can be planned in parallel.
+	 */
+	static void planMovement(const Action &action, const ExecutionContext &ctx, Movement &movement);
+	/** Execute an action, with a movement previously planned by planMovement(). */
+	static void apply(const Action &action, const Movement &movement, const ExecutionContext &ctx);
+
 private:
 	/** Get if the current creature has reached a specified location. */
 	static bool isLocationReached(const glm::vec2 &location, float range, const ExecutionContext &ctx);
 
-	static void executeMoveToPoint(const Action &action, const ExecutionContext &ctx);
-	static void executeFollowLeader(const Action &action, const ExecutionContext &ctx);
-	static void executeOpenLock(const Action &action, const ExecutionContext &ctx);
-	static void executeUseObject(const Action &action, const ExecutionContext &ctx);
-	static void executeAttackObject(const Action &action, const ExecutionContext &ctx);
+	static void executeMoveToPoint(const Action &action, const Movement &movement, const ExecutionContext &ctx);
+	static void executeFollowLeader(const Action &action, const Movement &movement, const ExecutionContext &ctx);
+	static void executeOpenLock(const Action &action, const Movement &movement, const ExecutionContext &ctx);
+	static void executeUseObject(const Action &action, const Movement &movement, const ExecutionContext &ctx);
+	static void executeAttackObject(const Action &action, const Movement &movement, const ExecutionContext &ctx);
+
+	/** Compute the next step of the current creature towards a specified location. */
+	static void planMoveTo(const glm::vec2 &location, float range, const ExecutionContext &ctx, Movement &movement);
 
 	/**
-	 * Move the current creature towards a specified location. Returns
+	 * Move the current creature along a planned step. Returns
 	 * true if location is within a specified range.
 	 */
-	static bool moveTo(const glm::vec2 &location, float range, const ExecutionContext &ctx);
+	static bool moveTo(const Movement &movement, const ExecutionContext &ctx);
 };
 
 } // End of namespace KotORBase
@@ -22,26 +22,54 @@
  *  Action queue for creatures in KotOR games.
  */
 
+#include "src/common/util.h"
+
 #include "src/engines/kotorbase/actionqueue.h"
 
 namespace Engines {
 
 namespace KotORBase {
 
+/** The number of actions a queue makes room for at first. */
+static const size_t kInitialCapacity = 4;
+
+ActionQueue::ActionQueue() : _head(0), _count(0) {
+}
+
 const Action *ActionQueue::getCurrent() const {
-	return _actions.empty() ? nullptr : &_actions.front();
+	return (_count == 0) ? nullptr : &_actions[_head];
 }
 
 void ActionQueue::clear() {
-	_actions = std::queue<Action>();
+	_head  = 0;
+	_count = 0;
 }
 
 void ActionQueue::add(const Action &action) {
-	_actions.push(action);
+	if (_count == _actions.size())
+		grow();
+
+	_actions[(_head + _count) & (_actions.size() - 1)] = action;
+	_count++;
 }
 
 void ActionQueue::pop() {
-	_actions.pop();
+	if (_count == 0)
+		return;
+
+	_head = (_head + 1) & (_actions.size() - 1);
+	_count--;
+}
+
+void ActionQueue::grow() {
+	std::vector<Action> actions(MAX(_actions.size() * 2, kInitialCapacity));
+
+	// Unwrap the ring, so that the current action is at the start again
+	for (size_t i = 0; i < _count; i++)
+		actions[i] = _actions[(_head + i) & (_actions.size() - 1)];
+
+	_actions.swap(actions);
+	_head = 0;
 }
 
 } // End of namespace KotORBase
@@ -25,7 +25,7 @@
 #ifndef ENGINES_KOTORBASE_ACTIONQUEUE_H
 #define ENGINES_KOTORBASE_ACTIONQUEUE_H
 
-#include <queue>
+#include <vector>
 
 #include "src/engines/kotorbase/action.h"
 
@@ -33,8 +33,16 @@ namespace Engines {
 
 namespace KotORBase {
 
+/** The queue of actions a creature is going to execute, one after the other.
+ *
+ *  The actions are kept in a ring buffer that only ever grows. Once a
+ *  creature queued as many actions as it usually does, adding, popping
+ *  and clearing actions doesn't allocate anymore.
+ */
 class ActionQueue {
 public:
+	ActionQueue();
+
 	const Action *getCurrent() const;
 
 	void clear();
@@ -42,7 +50,12 @@ public:
 	void pop();
 
 private:
-	std::queue<Action> _actions;
+	std::vector<Action> _actions; ///< The ring buffer. Its size is always 0 or a power of 2.
+
+	size_t _head;  ///< The index of the current action.
+	size_t _count; ///< The number of queued actions.
+
+	void grow();
 };
 
 } // End of namespace KotORBase
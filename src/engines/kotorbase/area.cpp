@@ -23,10 +23,13 @@
  */
 
 #include <memory>
+#include <algorithm>
 #include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/readstream.h"
 #include "src/common/maths.h"
+#include "src/common/threadpool.h"
+#include "src/common/profiler.h"
 
 #include "src/aurora/resman.h"
 #include "src/aurora/gff3file.h"
@@ -41,6 +44,7 @@
 #include "src/sound/sound.h"
 
 #include "src/engines/aurora/util.h"
+#include "src/engines/aurora/model.h"
 #include "src/engines/aurora/localpathfinding.h"
 
 #include "src/engines/kotorbase/room.h"
@@ -68,8 +72,11 @@ Area::Area(Module &module, const Common::UString &resRef) :
 		_module(&module),
 		_resRef(resRef),
 		_visible(false),
+		_creatureGrid(Creature::kPerceptionRange),
+		_deferPerception(false),
 		_activeObject(0),
 		_highlightAll(false),
+		_triggerGrid(Creature::kPerceptionRange),
 		_triggersVisible(false),
 		_activeTrigger(0),
 		_walkmeshInvisible(true) {
@@ -104,6 +111,8 @@ Area::~Area() {
 }
 
 void Area::load() {
+	PROFILE_ZONE("Area::load");
+
 	loadLYT(); // Room layout
 	loadVIS(); // Room visibilities
 
@@ -122,9 +131,16 @@ void Area::clear() {
 
 	_objects.clear();
 	_creatures.clear();
+	_creatureGrid.clear();
+	_roomIndices.clear();
+	_roomIndexMap.clear();
+	_roomVisibility.clear();
+	_shownRooms.clear();
 	_rooms.clear();
 	_triggers.clear();
+	_triggerGrid.clear();
 	_situatedObjects.clear();
+	_moduleTransitions.clear();
 	_activeTrigger = 0;
 }
 
@@ -143,6 +159,8 @@ uint32_t Area::getMusicBattleTrack() const {
 void Area::setMusicDayTrack(uint32_t track) {
 	_musicDayTrack = track;
 	_musicDay      = TwoDAReg.get2DA("ambientmusic").getRow(track).getString("Resource");
+
+	_ambientMusic.prefetch(_musicDay);
 }
 
 void Area::setMusicNightTrack(uint32_t track) {
@@ -169,6 +187,9 @@ void Area::setMusicBattleTrack(uint32_t track) {
 		for (int i = 0; i < 3; i++)
 			if (!stinger[i].empty())
 				_musicBattleStinger.push_back(stinger[i]);
+
+		// Have the battle music ready, so that switching to it is instant
+		_ambientMusic.prefetch(_musicBattle);
 	}
 }
 
@@ -178,7 +199,7 @@ void Area::stopSound() {
 }
 
 void Area::stopAmbientMusic() {
-	SoundMan.stopChannel(_ambientMusic);
+	_ambientMusic.stop();
 }
 
 void Area::stopAmbientSound() {
@@ -186,16 +207,12 @@ void Area::stopAmbientSound() {
 }
 
 void Area::playAmbientMusic(Common::UString music) {
-	stopAmbientMusic();
-
 	// TODO: Area::playAmbientMusic(): Day/Night
 	if (music.empty())
 		music = _musicDay;
 
-	if (music.empty())
-		return;
-
-	_ambientMusic = ::Engines::playSound(music, Sound::kSoundTypeMusic, true);
+	// Crossfades from the music currently playing, if any
+	_ambientMusic.play(music);
 }
 
 void Area::playAmbientSound(Common::UString sound) {
@@ -241,13 +258,11 @@ void Area::show() {
 
 	GfxMan.lockFrame();
 
-	std::set<Common::UString> visibleRooms(getRoomsVisibleByPartyLeader());
-
 	// Show rooms
-	for (auto &r : _rooms) {
-		if (visibleRooms.find(r->getResRef()) != visibleRooms.end())
-			r->show();
-	}
+	Aurora::VISFile::RoomSet visibleRooms;
+	getRoomsVisibleByPartyLeader(visibleRooms);
+
+	setShownRooms(visibleRooms);
 
 	// Show objects
 	for (auto &object : _objects) {
@@ -293,6 +308,8 @@ void Area::hide() {
 	for (auto &room : _rooms)
 		room->hide();
 
+	Aurora::VISFile::clearRoomSet(_shownRooms, _roomIndices.size());
+
 	// Hide walkmesh
 	_pathfinding->showWalkmesh(false);
 	_localPathfinding->showWalkmesh(false);
@@ -420,12 +437,34 @@ void Area::loadProperties(const Aurora::GFF3Struct &props) {
 
 void Area::loadRooms() {
 	const Aurora::LYTFile::RoomArray &rooms = _lyt.getRooms();
-	for (Aurora::LYTFile::RoomArray::const_iterator r = rooms.begin(); r != rooms.end(); ++r) {
-		_rooms.emplace_back(std::make_unique<Room>(r->model, r->x, r->y, r->z));
+
+	// Parse all room models at once on the thread pool
+	std::vector<PendingModel> models;
+	models.reserve(rooms.size());
+	for (Aurora::LYTFile::RoomArray::const_iterator r = rooms.begin(); r != rooms.end(); ++r)
+		models.push_back((r->model == "****") ? PendingModel() : loadModelObjectAsync(r->model));
+
+	std::vector<PendingModel>::iterator model = models.begin();
+	for (Aurora::LYTFile::RoomArray::const_iterator r = rooms.begin(); r != rooms.end(); ++r, ++model) {
+		_rooms.emplace_back(std::make_unique<Room>(r->model, std::move(*model), r->x, r->y, r->z));
 		_pathfinding->addRoom(_rooms.back().get());
 	}
 
 	_pathfinding->connectRooms();
+
+	// Look up which rooms are visible from where only once
+	std::vector<Common::UString> roomNames;
+	roomNames.reserve(_rooms.size());
+
+	for (auto &room : _rooms) {
+		_roomIndexMap.insert(std::make_pair(room.get(), _roomIndices.size()));
+		_roomIndices.push_back(room.get());
+
+		roomNames.push_back(room->getResRef());
+	}
+
+	_vis.compileVisibility(roomNames, _roomVisibility);
+	Aurora::VISFile::clearRoomSet(_shownRooms, _roomIndices.size());
 }
 
 void Area::loadObject(std::unique_ptr<Object> &&object) {
@@ -460,8 +499,13 @@ void Area::loadDoors(const Aurora::GFF3List &list) {
 		if (door) {
 			loadObject(std::make_unique<Door>(*_module, *door));
 
-			_situatedObjects.push_back(static_cast<Door *>(_objects.back().get()));
-			_localPathfinding->addStaticObjects(new DoorWalkmesh(static_cast<Door *>(_objects.back().get())));
+			Door *object = static_cast<Door *>(_objects.back().get());
+
+			_situatedObjects.push_back(object);
+			_localPathfinding->addStaticObjects(new DoorWalkmesh(object));
+
+			if (!object->getLinkedToModule().empty())
+				_moduleTransitions.push_back(object);
 		}
 	}
 }
@@ -473,11 +517,21 @@ void Area::loadCreatures(const Aurora::GFF3List &list) {
 }
 
 void Area::loadTriggers(const Aurora::GFF3List &list) {
-	for (auto &trigger : list) {
-		if (trigger) {
-			loadObject(std::make_unique<Trigger>(*trigger));
+	for (auto &gffTrigger : list) {
+		if (gffTrigger) {
+			loadObject(std::make_unique<Trigger>(*gffTrigger));
 
-			_triggers.push_back(static_cast<Trigger *>(_objects.back().get()));
+			Trigger *trigger = static_cast<Trigger *>(_objects.back().get());
+			_triggers.push_back(trigger);
+
+			const Common::BoundingBox &bounds = trigger->getBoundingBox();
+			if (!bounds.empty()) {
+				float minX, minY, minZ, maxX, maxY, maxZ;
+				bounds.getMin(minX, minY, minZ);
+				bounds.getMax(maxX, maxY, maxZ);
+
+				_triggerGrid.update(trigger, minX, minY, maxX, maxY);
+			}
 		}
 	}
 }
@@ -627,15 +681,24 @@ void Area::toggleTriggers() {
 }
 
 void Area::evaluateTriggers(float x, float y) {
-	Trigger *trigger = 0;
+	Common::FrameVector<Trigger *> candidates((Common::FrameAllocator<Trigger *>(_frameArena)));
+	_triggerGrid.visitPoint(x, y, [&](Trigger *t) {
+		if (t->contains(x, y))
+			candidates.push_back(t);
 
-	for (std::vector<Trigger *>::iterator it = _triggers.begin();
-			it != _triggers.end();
-			++it) {
-		Trigger *t = *it;
-		if (t->contains(x, y)) {
-			trigger = t;
-			break;
+		return false;
+	});
+
+	Trigger *trigger = 0;
+	if (candidates.size() == 1) {
+		trigger = candidates.front();
+	} else if (!candidates.empty()) {
+		// Overlapping triggers: the first one in load order wins
+		for (Trigger *t : _triggers) {
+			if (std::find(candidates.begin(), candidates.end(), t) != candidates.end()) {
+				trigger = t;
+				break;
+			}
 		}
 	}
 
@@ -657,6 +720,9 @@ void Area::showAllRooms() {
 			(*r)->show();
 	}
 
+	for (size_t i = 0; i < _roomIndices.size(); i++)
+		Aurora::VISFile::addRoom(_shownRooms, i);
+
 	for (ObjectList::iterator o = _objects.begin();
 			o != _objects.end(); ++o) {
 		if (!(*o)->isVisible())
@@ -671,19 +737,73 @@ void Area::notifyObjectMoved(Object &o) {
 	o.getPosition(x, y, _);
 	o.setRoom(_pathfinding->getRoomAt(x, y));
 
-	if (o.getType() == kObjectTypeCreature)
-		updatePerception((Creature &)o);
+	if (o.getType() == kObjectTypeCreature) {
+		Creature &creature = static_cast<Creature &>(o);
+		if (_creatureGrid.contains(&creature))
+			_creatureGrid.update(&creature, x, y);
+
+		if (_deferPerception)
+			_movedCreatures.push_back(&creature);
+		else
+			updatePerception(creature);
+	}
 }
 
 void Area::updatePerception(Creature &subject) {
-	for (auto &object : _creatures) {
-		if (object == &subject || object->isDead())
+	PerceptionChecks checks((Common::FrameAllocator<PerceptionCheck>(_frameArena)));
+	checkPerception(subject, checks);
+
+	for (const auto &check : checks)
+		check.subject->updatePerception(*check.object, check.inRange);
+}
+
+void Area::checkPerception(Creature &subject, PerceptionChecks &checks) const {
+	float x, y, _;
+	subject.getPosition(x, y, _);
+
+	_creatureGrid.visitRange(x, y, Creature::kPerceptionRange, [&](Creature *object) {
+		if (object != &subject && !object->isDead())
+			checks.push_back({ &subject, object, subject.isInPerceptionRange(*object) });
+
+		return false;
+	});
+
+	/* Creatures that left the range are not found by the grid query above,
+	 * but still need to be told they lost sight of the subject. */
+	Common::FrameVector<Creature *> perceived(checks.get_allocator());
+	for (Object *object : subject.getSeenObjects())
+		if (object->getType() == kObjectTypeCreature)
+			perceived.push_back(static_cast<Creature *>(object));
+	for (Object *object : subject.getHeardObjects())
+		if (object->getType() == kObjectTypeCreature)
+			perceived.push_back(static_cast<Creature *>(object));
+
+	for (Creature *object : perceived) {
+		if (object == &subject || object->isDead() || !_creatureGrid.contains(object))
 			continue;
 
-		subject.updatePerception(*object);
+		checks.push_back({ &subject, object, subject.isInPerceptionRange(*object) });
 	}
 }
 
+const Door *Area::getNearestModuleTransition(float x, float y, float range) const {
+	const Door *nearest = 0;
+	float nearestDistance = range * range;
+
+	for (const Door *door : _moduleTransitions) {
+		float doorX, doorY, doorZ;
+		door->getPosition(doorX, doorY, doorZ);
+
+		const float distance = (doorX - x) * (doorX - x) + (doorY - y) * (doorY - y);
+		if (distance <= nearestDistance) {
+			nearest         = door;
+			nearestDistance = distance;
+		}
+	}
+
+	return nearest;
+}
+
 void Area::notifyPartyLeaderMoved() {
 	Creature *partyLeader = _module->getPartyLeader();
 
@@ -703,35 +823,48 @@ const Aurora::GFF3Struct &Area::getMinigame() {
 	return _are->getTopLevel().getStruct("MiniGame");
 }
 
-std::set<Common::UString> Area::getRoomsVisibleByPartyLeader() const {
+void Area::getRoomsVisibleByPartyLeader(Aurora::VISFile::RoomSet &rooms) const {
 	Creature *partyLeader = _module->getPartyLeader();
-	Common::UString currentRoom = partyLeader->getRoom()->getResRef();
-
-	std::set<Common::UString> rooms { currentRoom };
+	const Room *currentRoom = partyLeader ? partyLeader->getRoom() : 0;
 
-	for (auto &resRef : getRoomsVisibleFrom(currentRoom)) {
-		Common::UString lcResRef(resRef.toLower());
-		if (rooms.find(lcResRef) == rooms.end())
-			rooms.insert(lcResRef);
+	std::map<const Room *, size_t>::const_iterator index = _roomIndexMap.find(currentRoom);
+	if (index == _roomIndexMap.end()) {
+		Aurora::VISFile::clearRoomSet(rooms, _roomIndices.size());
+		return;
 	}
 
-	return rooms;
+	rooms = _roomVisibility[index->second];
 }
 
-void Area::updateRoomsVisiblity() {
-	std::set<Common::UString> visibleRooms(getRoomsVisibleByPartyLeader());
+void Area::setShownRooms(const Aurora::VISFile::RoomSet &rooms) {
+	// Only touch the rooms whose visibility actually changes
+	for (size_t word = 0; word < _shownRooms.size(); word++) {
+		const uint64_t shown   = _shownRooms[word];
+		const uint64_t visible = (word < rooms.size()) ? rooms[word] : 0;
 
-	GfxMan.pauseAnimations();
+		uint64_t changed = shown ^ visible;
+		for (size_t bit = 0; changed != 0; bit++, changed >>= 1) {
+			if (!(changed & 1))
+				continue;
 
-	for (auto &r : _rooms) {
-		bool shouldBeVisible = visibleRooms.find(r->getResRef()) != visibleRooms.end();
-		bool visible = r->isVisible();
+			Room *room = _roomIndices[word * 64 + bit];
+			if (visible & (UINT64_C(1) << bit))
+				room->show();
+			else
+				room->hide();
+		}
 
-		if (visible && !shouldBeVisible)
-			r->hide();
-		else if (shouldBeVisible && !visible)
-			r->show();
+		_shownRooms[word] = visible;
 	}
+}
+
+void Area::updateRoomsVisiblity() {
+	Aurora::VISFile::RoomSet visibleRooms;
+	getRoomsVisibleByPartyLeader(visibleRooms);
+
+	GfxMan.pauseAnimations();
+
+	setShownRooms(visibleRooms);
 
 	for (auto &o : _objects) {
 		const Room *room = o->getRoom();
@@ -777,20 +910,36 @@ Creature *Area::getNearestCreature(const Object *target, int UNUSED(nth), const
 	target->getPosition(x, y, z);
 	glm::vec3 targetPosition(x, y, z);
 
-	for (auto c = _creatures.begin(); c != _creatures.end(); ++c) {
-		if (*c == target || (*c)->isDead())
-			continue;
+	/* Search in growing circles around the target, until we either found a
+	 * creature inside the current circle or looked at every creature. */
+	for (float radius = _creatureGrid.getCellSize(); ; radius *= 2.0f) {
+		size_t visited = 0;
 
-		if (!(*c)->matchSearchCriteria(target, criteria))
-			continue;
+		_creatureGrid.visitRange(targetPosition.x, targetPosition.y, radius, [&](Creature *c) {
+			visited++;
 
-		(*c)->getPosition(x, y, z);
-		float dist = glm::distance(targetPosition, glm::vec3(x, y, z));
+			if (c == target || c->isDead())
+				return false;
 
-		if ((result == 0) || (dist < lowestDistance)) {
-			result = *c;
-			lowestDistance = dist;
-		}
+			if (!c->matchSearchCriteria(target, criteria))
+				return false;
+
+			float cx, cy, cz;
+			c->getPosition(cx, cy, cz);
+			float dist = glm::distance(targetPosition, glm::vec3(cx, cy, cz));
+
+			if ((result == 0) || (dist < lowestDistance)) {
+				result = c;
+				lowestDistance = dist;
+			}
+
+			return false;
+		});
+
+		if ((result && (lowestDistance <= radius)) || (visited >= _creatureGrid.size()))
+			break;
+
+		result = 0;
 	}
 
 	return result;
@@ -801,9 +950,18 @@ const std::vector<Creature *> &Area::getCreatures() const {
 }
 
 void Area::processCreaturesActions(float dt) {
-	ActionExecutor::ExecutionContext ctx;
-	ctx.area = this;
-	ctx.frameTime = dt;
+	struct CreatureUpdate {
+		Creature *creature;
+		Action action;
+		glm::vec3 origin;
+		ActionExecutor::Movement movement;
+	};
+
+	// Nothing allocated during the last frame is still in use
+	_frameArena.reset();
+
+	Common::FrameVector<CreatureUpdate> updates((Common::FrameAllocator<CreatureUpdate>(_frameArena)));
+	updates.reserve(_creatures.size());
 
 	for (auto &c : _creatures) {
 		if (c->isDead())
@@ -813,9 +971,81 @@ void Area::processCreaturesActions(float dt) {
 		if (!action)
 			continue;
 
-		ctx.creature = c;
-		ActionExecutor::execute(*action, ctx);
+		updates.push_back({ c, *action, glm::vec3(), ActionExecutor::Movement() });
+		c->getPosition(updates.back().origin.x, updates.back().origin.y, updates.back().origin.z);
 	}
+
+	// Plan all movements in parallel, while nothing in the area changes
+
+	ThreadPoolMan.parallelFor(updates.size(), [&](size_t i) {
+		ActionExecutor::ExecutionContext ctx;
+		ctx.creature = updates[i].creature;
+		ctx.area = this;
+		ctx.frameTime = dt;
+
+		ActionExecutor::planMovement(updates[i].action, ctx, updates[i].movement);
+	});
+
+	// Apply the actions one after the other, since they change state and run scripts
+
+	ActionExecutor::ExecutionContext ctx;
+	ctx.area = this;
+	ctx.frameTime = dt;
+
+	_deferPerception = true;
+
+	try {
+		for (auto &u : updates) {
+			// Scripts run by earlier actions might have removed or changed the creature
+			if (!_creatureGrid.contains(u.creature) || u.creature->isDead())
+				continue;
+
+			const Action *current = u.creature->getCurrentAction();
+			if (!current)
+				continue;
+
+			/* Executing the action pops it, and scripts it runs might queue new
+			 * actions into the same slot of the creature's action queue. */
+			const Action action = *current;
+
+			ctx.creature = u.creature;
+
+			float x, y, z;
+			u.creature->getPosition(x, y, z);
+
+			const bool unchanged = (action.type == u.action.type) && (action.object == u.action.object) &&
+			                       (action.location == u.action.location) && (action.range == u.action.range) &&
+			                       (glm::vec3(x, y, z) == u.origin);
+
+			if (unchanged)
+				ActionExecutor::apply(action, u.movement, ctx);
+			else
+				ActionExecutor::execute(action, ctx);
+		}
+	} catch (...) {
+		_deferPerception = false;
+		_movedCreatures.clear();
+		throw;
+	}
+
+	_deferPerception = false;
+
+	// Check the perception of all creatures that moved in parallel, then apply it in order
+
+	// Swap the lists instead of moving, so both keep their memory for the next frame
+	std::vector<Creature *> &moved = _checkedCreatures;
+	moved.clear();
+	moved.swap(_movedCreatures);
+
+	Common::FrameAllocator<PerceptionCheck> allocator(_frameArena);
+	Common::FrameVector<PerceptionChecks> checks(moved.size(), PerceptionChecks(allocator), allocator);
+	ThreadPoolMan.parallelFor(moved.size(), [&](size_t i) {
+		checkPerception(*moved[i], checks[i]);
+	});
+
+	for (const auto &creatureChecks : checks)
+		for (const auto &check : creatureChecks)
+			check.subject->updatePerception(*check.object, check.inRange);
 }
 
 void Area::handleCreaturesDeath() {
@@ -828,6 +1058,10 @@ void Area::handleCreaturesDeath() {
 void Area::addCreature(Creature *creature) {
 	loadObject(std::unique_ptr<Creature>(creature));
 	_creatures.push_back(creature);
+
+	float x, y, _;
+	creature->getPosition(x, y, _);
+	_creatureGrid.update(creature, x, y);
 }
 
 void Area::addToObjectMap(Object *object) {
@@ -844,12 +1078,17 @@ void Area::removeObject(Object *object) {
 	}
 
 	std::vector<Creature *>::iterator crit = std::find(_creatures.begin(), _creatures.end(), object);
-	if (crit != _creatures.end())
+	if (crit != _creatures.end()) {
+		_creatureGrid.remove(*crit);
+		_movedCreatures.erase(std::remove(_movedCreatures.begin(), _movedCreatures.end(), *crit), _movedCreatures.end());
 		_creatures.erase(crit);
+	}
 
 	std::vector<Trigger *>::iterator tit = std::find(_triggers.begin(), _triggers.end(), object);
-	if (tit != _triggers.end())
+	if (tit != _triggers.end()) {
+		_triggerGrid.remove(*tit);
 		_triggers.erase(tit);
+	}
 
 	std::list<Situated *>::iterator soit = std::find(_situatedObjects.begin(), _situatedObjects.end(), object);
 	if (soit != _situatedObjects.end())
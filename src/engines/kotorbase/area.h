@@ -32,6 +32,8 @@
 
 #include "src/common/ustring.h"
 #include "src/common/mutex.h"
+#include "src/common/spatialgrid.h"
+#include "src/common/framearena.h"
 #include <memory>
 
 #include "src/aurora/types.h"
@@ -43,6 +45,8 @@
 #include "src/events/types.h"
 #include "src/events/notifyable.h"
 
+#include "src/engines/aurora/areamusic.h"
+
 #include "src/engines/kotorbase/object.h"
 #include "src/engines/kotorbase/trigger.h"
 
@@ -55,6 +59,7 @@ namespace KotORBase {
 class Module;
 class Room;
 class Situated;
+class Door;
 class Creature;
 class Pathfinding;
 struct CreatureSearchCriteria;
@@ -136,6 +141,11 @@ public:
 	void toggleTriggers();
 	void evaluateTriggers(float x, float y);
 
+	// Module transitions
+
+	/** Return the nearest door within range that leads into another module, or 0 if there's none. */
+	const Door *getNearestModuleTransition(float x, float y, float range) const;
+
 	// Object management
 
 	Object *getObjectByTag(const Common::UString &tag);
@@ -160,7 +170,6 @@ public:
 	// Room visiblity
 
 	const std::vector<Common::UString> &getRoomsVisibleFrom(const Common::UString &room) const;
-	std::set<Common::UString> getRoomsVisibleByPartyLeader() const;
 
 	void showAllRooms();
 	void notifyObjectMoved(Object &o);
@@ -216,17 +225,30 @@ private:
 	int _northAxis;
 
 	Sound::ChannelHandle _ambientSound; ///< Sound handle of the currently playing sound.
-	Sound::ChannelHandle _ambientMusic; ///< Sound handle of the currently playing music.
+	AreaMusic _ambientMusic; ///< The currently playing music.
 
 	Aurora::LYTFile _lyt; ///< The area's layout description.
 	Aurora::VISFile _vis; ///< The area's inter-room visibility description.
 
 	RoomList _rooms; ///< All rooms in the area.
 
+	std::vector<Room *> _roomIndices;               ///< All rooms in the area, by room index.
+	std::map<const Room *, size_t> _roomIndexMap;   ///< The room index of each room.
+	std::vector<Aurora::VISFile::RoomSet> _roomVisibility; ///< The rooms visible from each room.
+	Aurora::VISFile::RoomSet _shownRooms;           ///< The rooms currently shown.
+
 	ObjectList _objects;   ///< List of all objects in the area.
 	ObjectMap  _objectMap; ///< Map of all non-static objects in the area.
 
 	std::vector<Creature *> _creatures;
+	Common::SpatialGrid<Creature *> _creatureGrid; ///< Creature positions, for proximity queries.
+
+	bool _deferPerception; ///< Collect moved creatures instead of updating their perception right away?
+	std::vector<Creature *> _movedCreatures; ///< Creatures that moved while perception was deferred.
+	std::vector<Creature *> _checkedCreatures; ///< Creatures whose perception is currently being checked.
+
+	/** Scratch memory for temporaries, reset every time the creatures' actions are processed. */
+	Common::FrameArena _frameArena;
 
 	Object *_activeObject; ///< The currently active (highlighted) object.
 
@@ -239,6 +261,7 @@ private:
 	// Triggers
 
 	std::vector<Trigger *> _triggers;
+	Common::SpatialGrid<Trigger *> _triggerGrid; ///< Trigger bounds, for point queries.
 	bool _triggersVisible;
 	Trigger *_activeTrigger;
 
@@ -246,6 +269,7 @@ private:
 	CameraStyle _cameraStyle;
 	bool _walkmeshInvisible;
 	std::list<Situated *> _situatedObjects;
+	std::vector<Door *> _moduleTransitions; ///< Doors leading into other modules.
 
 	Pathfinding *_pathfinding;
 	Engines::LocalPathfinding *_localPathfinding;
@@ -287,8 +311,24 @@ private:
 	void click(int x, int y);
 
 
+	/** Get the rooms the party leader can see. */
+	void getRoomsVisibleByPartyLeader(Aurora::VISFile::RoomSet &rooms) const;
+	/** Show and hide rooms, so that exactly these rooms are visible. */
+	void setShownRooms(const Aurora::VISFile::RoomSet &rooms);
+
 	void updateRoomsVisiblity();
+	/** A mutual perception check between two creatures. */
+	struct PerceptionCheck {
+		Creature *subject;
+		Creature *object;
+		bool inRange;
+	};
+
+	typedef Common::FrameVector<PerceptionCheck> PerceptionChecks;
+
 	void updatePerception(Creature &subject);
+	/** Find all creatures whose perception of a subject needs updating. Only reads from the area. */
+	void checkPerception(Creature &subject, PerceptionChecks &checks) const;
 
 
 	friend class Console;
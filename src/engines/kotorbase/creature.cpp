@@ -805,14 +805,22 @@ void Creature::getTooltipAnchor(float &x, float &y, float &z) const {
 	_model->getTooltipAnchor(x, y, z);
 }
 
-void Creature::updatePerception(Creature &object) {
-	const float kPerceptionRange = 16.0f;
+const float Creature::kPerceptionRange = 16.0f;
 
+bool Creature::isInPerceptionRange(const Creature &object) const {
 	float distance = glm::distance(
 		glm::make_vec3(_position),
 		glm::make_vec3(object._position));
 
-	if (distance <= kPerceptionRange) {
+	return distance <= kPerceptionRange;
+}
+
+void Creature::updatePerception(Creature &object) {
+	updatePerception(object, isInPerceptionRange(object));
+}
+
+void Creature::updatePerception(Creature &object, bool inRange) {
+	if (inRange) {
 		handleObjectSeen(object);
 		handleObjectHeard(object);
 
@@ -828,6 +836,14 @@ void Creature::updatePerception(Creature &object) {
 	}
 }
 
+const std::set<Object *> &Creature::getSeenObjects() const {
+	return _seenObjects;
+}
+
+const std::set<Object *> &Creature::getHeardObjects() const {
+	return _heardObjects;
+}
+
 bool Creature::isInCombat() const {
 	return _inCombat;
 }
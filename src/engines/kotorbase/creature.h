@@ -188,7 +188,20 @@ public:
 
 	// Perception
 
+	/** The maximum distance at which creatures can see and hear each other. */
+	static const float kPerceptionRange;
+
+	/** Is the creature close enough to see and hear the object? */
+	bool isInPerceptionRange(const Creature &object) const;
+
 	void updatePerception(Creature &object);
+	/** Update mutual perception with an object, whose range has already been checked. */
+	void updatePerception(Creature &object, bool inRange);
+
+	/** Get all objects this creature currently sees. */
+	const std::set<Object *> &getSeenObjects() const;
+	/** Get all objects this creature currently hears. */
+	const std::set<Object *> &getHeardObjects() const;
 
 	// Combat
 
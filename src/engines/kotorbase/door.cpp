@@ -133,6 +133,10 @@ bool Door::isOpen() const {
 	return (_state == kStateOpened1) || (_state == kStateOpened2);
 }
 
+const Common::UString &Door::getLinkedToModule() const {
+	return _linkedToModule;
+}
+
 bool Door::click(Object *triggerer) {
 	_lastUsedBy = triggerer;
 
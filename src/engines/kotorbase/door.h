@@ -67,6 +67,9 @@ public:
 	/** The unlocker object unlocks this door. */
 	bool unlock(Object *unlocker);
 
+	/** Return the module this door leads into, or an empty string if it stays within this module. */
+	const Common::UString &getLinkedToModule() const;
+
 	// Object/cursor interactions
 
 	const Common::UString &getCursor() const;
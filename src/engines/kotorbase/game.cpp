@@ -24,6 +24,8 @@
 
 #include <cassert>
 
+#include "src/common/error.h"
+
 #include "src/sound/sound.h"
 
 #include "src/engines/aurora/util.h"
@@ -73,6 +75,21 @@ void Game::stopMenuMusic() {
 	SoundMan.stopChannel(_menuMusic);
 }
 
+void Game::loadBenchmarkModule(const Common::UString &module, Common::UString &area) {
+	assert(_module);
+
+	if (!hasModule(module))
+		throw Common::Exception("No such module \"%s\"", module.c_str());
+
+	_module->load(module);
+
+	const Common::UString &entryArea = _module->getIFO().getEntryArea();
+	if (!area.empty() && !area.equalsIgnoreCase(entryArea))
+		throw Common::Exception("Module \"%s\" has no area \"%s\"", module.c_str(), area.c_str());
+
+	area = entryArea;
+}
+
 Module &Game::getModule() {
 	assert(_module);
 	return *_module;
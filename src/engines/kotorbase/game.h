@@ -65,6 +65,13 @@ public:
 
 	virtual void run() = 0;
 
+	/** Load a module for the load benchmark, without running it.
+	 *
+	 *  A module only has one area. If an area is given, it has to be this
+	 *  one. Either way, the name of the loaded area is returned in area.
+	 */
+	virtual void benchmarkLoad(const Common::UString &module, Common::UString &area) = 0;
+
 protected:
 	Engines::Console *_console;
 	std::unique_ptr<KotORBase::Module> _module;
@@ -73,6 +80,9 @@ protected:
 
 	virtual const Common::UString &getDefaultMenuMusic() const = 0;
 
+	/** Load a module into the already created module context, for the load benchmark. */
+	void loadBenchmarkModule(const Common::UString &module, Common::UString &area);
+
 private:
 	void stopMenuMusic();
 	void playMenuMusic(Common::UString music = "");
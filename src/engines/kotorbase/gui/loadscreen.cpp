@@ -24,6 +24,8 @@
 
 #include <functional>
 
+#include "src/common/util.h"
+
 #include "src/engines/odyssey/progressbar.h"
 
 #include "src/engines/kotorbase/gui/loadscreen.h"
@@ -40,6 +42,15 @@ void LoadScreen::setLoadingProgress(unsigned int progress) {
 		_progressBar->setCurrentValue(progress);
 }
 
+void LoadScreen::setLoadingSteps(size_t done, size_t total) {
+	if (!_progressBar || (total == 0))
+		return;
+
+	const size_t maxValue = MAX(_progressBar->getMaxValue(), 0);
+
+	_progressBar->setCurrentValue((MIN(done, total) * maxValue) / total);
+}
+
 LoadingProgressFunc LoadScreen::getLoadingProgressFunc() {
 	return std::bind(&LoadScreen::setLoadingProgress, this, std::placeholders::_1);
 }
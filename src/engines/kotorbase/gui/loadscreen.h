@@ -44,6 +44,8 @@ public:
 	LoadScreen(const Common::UString &name, Console *console = 0);
 
 	void setLoadingProgress(unsigned int progress);
+	/** Fill the progress bar to show that done out of total loading steps are finished. */
+	void setLoadingSteps(size_t done, size_t total);
 	LoadingProgressFunc getLoadingProgressFunc();
 
 protected:
@@ -31,6 +31,8 @@
 #include "src/common/filelist.h"
 #include "src/common/configman.h"
 #include "src/common/debug.h"
+#include "src/common/profiler.h"
+#include "src/common/configvalue.h"
 
 #include "src/aurora/types.h"
 #include "src/aurora/rimfile.h"
@@ -38,6 +40,7 @@
 #include "src/aurora/dlgfile.h"
 #include "src/aurora/2dareg.h"
 #include "src/aurora/2dafile.h"
+#include "src/aurora/resman.h"
 
 #include "src/graphics/camera.h"
 
@@ -55,6 +58,7 @@
 
 #include "src/engines/kotorbase/creature.h"
 #include "src/engines/kotorbase/placeable.h"
+#include "src/engines/kotorbase/door.h"
 #include "src/engines/kotorbase/module.h"
 #include "src/engines/kotorbase/area.h"
 
@@ -72,9 +76,16 @@ namespace Engines {
 
 namespace KotORBase {
 
-bool Module::Action::operator<(const Action &s) const {
-	return timestamp < s.timestamp;
-}
+/** The length of one simulation tick, in milliseconds. */
+static const uint32_t kSimulationTickLength = 10;
+
+/** How close, in meters, the party leader has to be to a door into another module to read it ahead. */
+static const Common::ConfigValue<double> kConfigTransitionRange("transitionprefetchrange", 10.0);
+/** How many MB of module archives may be read ahead. */
+static const Common::ConfigValue<int> kConfigTransitionBudget("transitionprefetchbudget", 64);
+
+/** How much farther than the prefetch range the party leader has to walk away to cancel it. */
+static const float kTransitionCancelFactor = 1.5f;
 
 Module::DelayedConversation::DelayedConversation(const Common::UString &_name, Aurora::NWScript::Object *_owner) :
 		name(_name),
@@ -98,6 +109,7 @@ Module::Module(::Engines::Console &console) :
 		_roundController(this),
 		_prevTimestamp(0),
 		_frameTime(0),
+		_timestep(kSimulationTickLength),
 		_inDialog(false),
 		_runScriptVar(-1),
 		_soloMode(false) {
@@ -106,6 +118,8 @@ Module::Module(::Engines::Console &console) :
 }
 
 Module::~Module() {
+	waitSavedGame();
+
 	try {
 		clear();
 	} catch (...) {
@@ -132,6 +146,8 @@ void Module::load(const Common::UString &module, const Common::UString &entryLoc
 
 void Module::loadModule(const Common::UString &module, const Common::UString &entryLocation,
                         ObjectType entryLocationType) {
+	PROFILE_ZONE("Module::loadModule");
+
 	_ingame->hide();
 
 	std::unique_ptr<KotORBase::LoadScreen> loadScreen;
@@ -150,7 +166,7 @@ void Module::loadModule(const Common::UString &module, const Common::UString &en
 
 	try {
 
-		load();
+		load(*loadScreen);
 
 	} catch (Common::Exception &e) {
 		_module.clear();
@@ -173,6 +189,9 @@ void Module::loadModule(const Common::UString &module, const Common::UString &en
 void Module::usePC(const CharacterGenerationInfo &info) {
 	_chargenInfo.reset(createCharGenInfo(info));
 	_pcInfo = CreatureInfo(info);
+
+	_timePlayed      = 0;
+	_timePlayedStart = EventMan.getTimestamp();
 }
 
 Creature *Module::getPC() {
@@ -213,13 +232,39 @@ void Module::showMenu() {
 	// TODO: Module::showMenu()
 }
 
-void Module::load() {
+void Module::load(LoadScreen &loadScreen) {
+	static const size_t kLoadSteps = 6;
+
+	loadScreen.setLoadingSteps(0, kLoadSteps);
+
 	loadTexturePack();
+	loadScreen.setLoadingSteps(1, kLoadSteps);
+
 	loadResources();
-	loadIFO();
-	loadArea();
-	loadPC();
-	loadParty();
+	loadScreen.setLoadingSteps(2, kLoadSteps);
+
+	// Prefetch what the last load of this module needed, and record what this one needs
+	ResMan.beginResourceTrace(_module);
+
+	try {
+		loadIFO();
+		prefetchArea();
+		loadScreen.setLoadingSteps(3, kLoadSteps);
+
+		loadArea();
+		loadScreen.setLoadingSteps(4, kLoadSteps);
+
+		loadPC();
+		loadScreen.setLoadingSteps(5, kLoadSteps);
+
+		loadParty();
+		loadScreen.setLoadingSteps(6, kLoadSteps);
+	} catch (...) {
+		ResMan.endResourceTrace();
+		throw;
+	}
+
+	ResMan.endResourceTrace();
 }
 
 void Module::loadResources() {
@@ -227,28 +272,33 @@ void Module::loadResources() {
 	// Apparently, the original game prefers ERFs over RIMs. This is
 	// exploited by the KotOR2 TSL Restored Content Mod.
 
+	// The archives are all parsed at once, then indexed in this order.
+	ArchiveBatch batch;
+
 	// General module resources
 	_resources.push_back(Common::ChangeID());
-	if (!indexOptionalArchive (_module + ".erf", 1000, &_resources.back()))
-		   indexMandatoryArchive(_module + ".rim", 1000, &_resources.back());
+	if (!batch.addOptional (_module + ".erf", 1000, &_resources.back()))
+		   batch.addMandatory(_module + ".rim", 1000, &_resources.back());
 
 	// Scripts
 	_resources.push_back(Common::ChangeID());
-	if (!indexOptionalArchive (_module + "_s.erf", 1001, &_resources.back()))
-		   indexMandatoryArchive(_module + "_s.rim", 1001, &_resources.back());
+	if (!batch.addOptional (_module + "_s.erf", 1001, &_resources.back()))
+		   batch.addMandatory(_module + "_s.rim", 1001, &_resources.back());
 
 	// Dialogs, KotOR2 only
 	_resources.push_back(Common::ChangeID());
-	if (!indexOptionalArchive(_module + "_dlg.erf", 1002, &_resources.back()))
-		   indexOptionalArchive(_module + "_dlg.rim", 1002, &_resources.back());
+	if (!batch.addOptional(_module + "_dlg.erf", 1002, &_resources.back()))
+		   batch.addOptional(_module + "_dlg.rim", 1002, &_resources.back());
 
 	// Layouts, Xbox only
 	_resources.push_back(Common::ChangeID());
-	indexOptionalArchive(_module + "_a.rim"  , 1003, &_resources.back());
+	batch.addOptional(_module + "_a.rim"  , 1003, &_resources.back());
 
 	// Textures, Xbox only
 	_resources.push_back(Common::ChangeID());
-	indexOptionalArchive(_module + "_adx.rim", 1004, &_resources.back());
+	batch.addOptional(_module + "_adx.rim", 1004, &_resources.back());
+
+	batch.index();
 }
 
 void Module::loadIFO() {
@@ -260,6 +310,15 @@ void Module::loadIFO() {
 	readScripts(*_ifo.getGFF());
 }
 
+void Module::prefetchArea() {
+	const Common::UString &area = _ifo.getEntryArea();
+
+	ResMan.prefetch(area, Aurora::kFileTypeARE);
+	ResMan.prefetch(area, Aurora::kFileTypeGIT);
+	ResMan.prefetch(area, Aurora::kFileTypeLYT);
+	ResMan.prefetch(area, Aurora::kFileTypeVIS);
+}
+
 void Module::loadArea() {
 	_area = std::make_unique<Area>(*this, _ifo.getEntryArea());
 	_cameraController.updateCameraStyle();
@@ -308,9 +367,11 @@ void Module::loadSurfaceTypes() {
 	_walkableSurfaces.clear();
 
 	const Aurora::TwoDAFile &surfacematTwoDA = TwoDAReg.get2DA("surfacemat");
+	const Aurora::TwoDAColumnHandle walk = surfacematTwoDA.getColumnHandle("Walk");
+
 	for (size_t s = 0; s < surfacematTwoDA.getRowCount(); ++s) {
 		const Aurora::TwoDARow &row = surfacematTwoDA.getRow(s);
-		_walkableSurfaces.push_back(static_cast<bool>(row.getInt("Walk")));
+		_walkableSurfaces.push_back(static_cast<bool>(row.getInt(walk)));
 	}
 }
 
@@ -373,6 +434,9 @@ void Module::unload(bool completeUnload) {
 	_newModule.clear();
 	_hasModule = false;
 
+	// If we're leaving through the door we read ahead for, the cached files are needed right now
+	cancelModulePrefetch(false);
+
 	_module.clear();
 
 	_entryLocation.clear();
@@ -458,12 +522,12 @@ bool Module::getObjectLocation(const Common::UString &object, ObjectType locatio
 	if (object.empty())
 		return false;
 
-	std::unique_ptr<Aurora::NWScript::ObjectSearch> search(findObjectsByTag(object));
+	Aurora::NWScript::ObjectRange search = getObjectsByTag(object);
 
 
 	Object *kotorObject = 0;
-	while (!kotorObject && search->get()) {
-		kotorObject = ObjectContainer::toObject(search->next());
+	while (!kotorObject && search.get()) {
+		kotorObject = ObjectContainer::toObject(search.next());
 		if (!kotorObject || !(kotorObject->getType() & location))
 			kotorObject = 0;
 	}
@@ -564,23 +628,33 @@ void Module::processEventQueue() {
 	if (!isRunning())
 		return;
 
-	uint32_t now = SDL_GetTicks();
+	uint32_t now = EventMan.getTimestamp();
 	_frameTime = (now - _prevTimestamp) / 1000.f;
 	_prevTimestamp = now;
 
 	handleEvents();
 	handleActions();
 
-	_roundController.update();
-	_area->handleCreaturesDeath();
+	/* The simulation runs in ticks of a fixed length, however long the frame
+	 * took. Only the camera follows the actual frame time. */
+	const size_t ticks = _timestep.advance();
+	const float tickTime = _timestep.getTickSeconds();
+
+	for (size_t i = 0; i < ticks; i++) {
+		_roundController.update(_timestep.getTickLength());
+		_area->handleCreaturesDeath();
+	}
 
 	GfxMan.lockFrame();
 
-	_area->processCreaturesActions(_frameTime);
 	_cameraController.processRotation(_frameTime);
 
-	if (!_cameraController.isFlyCamera())
-		_partyLeaderController.processMovement(_frameTime);
+	for (size_t i = 0; i < ticks; i++) {
+		_area->processCreaturesActions(tickTime);
+
+		if (!_cameraController.isFlyCamera())
+			_partyLeaderController.processMovement(tickTime);
+	}
 
 	_cameraController.processMovement(_frameTime);
 	updateSoundListener();
@@ -593,6 +667,11 @@ void Module::processEventQueue() {
 
 void Module::updateFrameTimestamp() {
 	_prevTimestamp = EventMan.getTimestamp();
+	_timestep.reset();
+}
+
+void Module::waitForNextTick() const {
+	_timestep.waitForNextTick();
 }
 
 void Module::handleEvents() {
@@ -759,17 +838,19 @@ void Module::notifyCombatRoundEnded(int UNUSED(round)) {
 void Module::handleActions() {
 	uint32_t now = EventMan.getTimestamp();
 
-	while (!_delayedActions.empty()) {
-		ActionQueue::iterator action = _delayedActions.begin();
+	// Actions can schedule new actions that are due immediately, so repeat until none are left
+	std::vector<Action> &actions = _dueActions;
 
-		if (now < action->timestamp)
-			break;
+	// A script that threw last time might have left actions behind
+	actions.clear();
 
-		if (action->type == kActionScript)
-			ScriptContainer::runScript(action->script, action->state,
-			                           action->owner, action->triggerer);
+	for (_delayedActions.advance(now, actions); !actions.empty(); _delayedActions.advance(now, actions)) {
+		for (std::vector<Action>::const_iterator action = actions.begin(); action != actions.end(); ++action)
+			if (action->type == kActionScript)
+				ScriptContainer::runScript(action->script, action->state,
+				                           action->owner, action->triggerer);
 
-		_delayedActions.erase(action);
+		actions.clear();
 	}
 }
 
@@ -805,10 +886,70 @@ void Module::movedPartyLeader() {
 	_area->evaluateTriggers(x, y);
 	_area->notifyPartyLeaderMoved();
 
+	updateTransitionPrefetch(x, y);
+
 	_cameraController.updateTarget();
 	updateMinimap();
 }
 
+void Module::updateTransitionPrefetch(float x, float y) {
+	const float range = kConfigTransitionRange.get();
+	if (!_area || (range <= 0.0f))
+		return;
+
+	const Door *door = _area->getNearestModuleTransition(x, y, range);
+	if (door && (door->getLinkedToModule() != _module)) {
+		prefetchModule(door->getLinkedToModule());
+		return;
+	}
+
+	if (_transitionModule.empty())
+		return;
+
+	// Don't give up right at the edge of the range, or walking along it would read the archives over and over
+	door = _area->getNearestModuleTransition(x, y, range * kTransitionCancelFactor);
+	if (!door || (door->getLinkedToModule() != _transitionModule))
+		cancelModulePrefetch(true);
+}
+
+void Module::prefetchModule(const Common::UString &module) {
+	if (module == _transitionModule)
+		return;
+
+	cancelModulePrefetch(true);
+
+	/* The same archives loadResources() will index, in order of importance.
+	 * Which of the ERF and RIM variants exist doesn't matter here, we just
+	 * read ahead whatever is there. */
+	static const char * const kArchives[] = {
+		".erf", ".rim", "_s.erf", "_s.rim", "_dlg.erf", "_dlg.rim", "_a.rim", "_adx.rim"
+	};
+
+	size_t budget = MAX<int>(kConfigTransitionBudget, 0) * 1024 * 1024;
+
+	for (size_t i = 0; i < ARRAYSIZE(kArchives); i++) {
+		const Common::UString archive = module + kArchives[i];
+
+		const size_t size = ResMan.warmArchive(archive, budget);
+		if (size == 0)
+			continue;
+
+		budget -= size;
+		_transitionArchives.push_back(archive);
+	}
+
+	_transitionModule = module;
+}
+
+void Module::cancelModulePrefetch(bool dropCached) {
+	if (dropCached)
+		for (const Common::UString &archive : _transitionArchives)
+			ResMan.coolArchive(archive);
+
+	_transitionArchives.clear();
+	_transitionModule.clear();
+}
+
 Creature *Module::getPartyLeader() const {
 	return _partyController.getPartyLeader();
 }
@@ -987,7 +1128,7 @@ void Module::delayScript(const Common::UString &script,
 	action.triggerer = triggerer;
 	action.timestamp = EventMan.getTimestamp() + delay;
 
-	_delayedActions.insert(action);
+	_delayedActions.schedule(action.timestamp, action);
 }
 
 void Module::signalUserDefinedEvent(Object *owner, int number) {
@@ -1053,12 +1194,68 @@ void Module::loadSavedGame(SavedGame *save) {
 	try {
 		std::unique_ptr<CharacterGenerationInfo> info(save->createCharGenInfo());
 		usePC(*info.get());
+
+		_timePlayed = save->getTimePlayed();
+
 		load(save->getModuleName());
 	} catch (...) {
 		Common::exceptionDispatcherWarning();
 	}
 }
 
+SavedGameSnapshot Module::createSavedGameSnapshot(const Common::UString &name) const {
+	SavedGameSnapshot snapshot;
+
+	snapshot.name       = name;
+	snapshot.moduleName = _module;
+
+	if (_area)
+		snapshot.areaName = _area->getName();
+
+	snapshot.timePlayed = _timePlayed + (EventMan.getTimestamp() - _timePlayedStart) / 1000;
+
+	if (_pc) {
+		snapshot.pcGender = _pc->getGender();
+		_pc->getPosition(snapshot.pcPosition[0], snapshot.pcPosition[1], snapshot.pcPosition[2]);
+	} else if (_chargenInfo)
+		snapshot.pcGender = _chargenInfo->getGender();
+
+	return snapshot;
+}
+
+void Module::saveGame(const Common::UString &dir, const Common::UString &name) {
+	// Only one saved game is written at a time
+	waitSavedGame();
+
+	std::shared_ptr<const SavedGameSnapshot> snapshot =
+		std::make_shared<const SavedGameSnapshot>(createSavedGameSnapshot(name));
+
+	_savedGameIndex.invalidate(dir);
+
+	_savedGameTask = ThreadPoolMan.submit([snapshot, dir]() {
+		SavedGame::write(*snapshot, dir);
+	});
+}
+
+void Module::waitSavedGame() {
+	if (!_savedGameTask)
+		return;
+
+	try {
+		ThreadPoolMan.wait(_savedGameTask);
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed to write saved game");
+	}
+
+	_savedGameTask.reset();
+}
+
+SavedGameIndex &Module::getSavedGameIndex() {
+	waitSavedGame();
+
+	return _savedGameIndex;
+}
+
 bool Module::isConversationActive() const {
 	return _inDialog;
 }
@@ -26,12 +26,14 @@
 #define ENGINES_KOTORBASE_MODULE_H
 
 #include <list>
-#include <set>
+#include <vector>
 
 #include <memory>
 #include "src/common/ustring.h"
 #include "src/common/changeid.h"
 #include "src/common/configman.h"
+#include "src/common/threadpool.h"
+#include "src/common/fixedtimestep.h"
 
 #include "src/aurora/ifofile.h"
 
@@ -41,6 +43,8 @@
 
 #include "src/events/types.h"
 
+#include "src/common/timerwheel.h"
+
 #include "src/engines/kotorbase/object.h"
 #include "src/engines/kotorbase/objectcontainer.h"
 #include "src/engines/kotorbase/savedgame.h"
@@ -208,11 +212,30 @@ public:
 	void processEventQueue();
 	/** Update timestamp of the previous rendered frame. */
 	void updateFrameTimestamp();
+	/** Sleep until the next simulation tick is due. */
+	void waitForNextTick() const;
 
 	// Saved games
 
 	void loadSavedGame(SavedGame *save);
 
+	/** Capture the current state of the game for a saved game. */
+	SavedGameSnapshot createSavedGameSnapshot(const Common::UString &name) const;
+	/** Save the game into a directory.
+	 *
+	 *  The state is captured right away, but the saved game is written in
+	 *  the background, so the game can go on immediately.
+	 */
+	void saveGame(const Common::UString &dir, const Common::UString &name);
+	/** Wait until the saved game currently written in the background is finished. */
+	void waitSavedGame();
+
+	/** Return the index of saved game information, for listing saved games.
+	 *
+	 *  Waits for the saved game currently being written, if any.
+	 */
+	SavedGameIndex &getSavedGameIndex();
+
 	// Conversation
 
 	bool isConversationActive() const;
@@ -280,12 +303,10 @@ private:
 		Aurora::NWScript::ObjectReference triggerer;
 
 		uint32_t timestamp;
-
-		bool operator<(const Action &s) const;
 	};
 
 	typedef std::list<Events::Event> EventQueue;
-	typedef std::multiset<Action> ActionQueue;
+	typedef Common::TimerWheel<Action> ActionQueue;
 
 	// Global values
 
@@ -340,6 +361,7 @@ private:
 
 	EventQueue  _eventQueue;
 	ActionQueue _delayedActions;
+	std::vector<Action> _dueActions; ///< The delayed actions currently being run.
 
 	PartyLeaderController _partyLeaderController;
 	PartyController _partyController;
@@ -348,11 +370,27 @@ private:
 
 	uint32_t _prevTimestamp;
 	float _frameTime;
+	/** Creature actions, party movement and rounds advance in ticks of this fixed length. */
+	Common::FixedTimestep _timestep;
 	bool _inDialog;
 	int _runScriptVar;
 	bool _soloMode;
 	int _userDefinedEventNumber { 0 };
 
+	// Saved games
+
+	uint32_t _timePlayed { 0 };      ///< The time played before _timePlayedStart, in seconds.
+	uint32_t _timePlayedStart { 0 }; ///< The timestamp the time played was last updated.
+
+	Common::ThreadPool::TaskHandle _savedGameTask; ///< The saved game currently being written.
+
+	SavedGameIndex _savedGameIndex; ///< Information about the saved games on disk.
+
+	// Module transitions
+
+	Common::UString _transitionModule;                ///< The module whose archives are being read ahead.
+	std::vector<Common::UString> _transitionArchives; ///< The archives of _transitionModule being read ahead.
+
 	// Unloading
 
 	/** Unload the whole shebang.
@@ -370,9 +408,11 @@ private:
 
 	// Loading
 
-	void load();
+	void load(LoadScreen &loadScreen);
 	void loadResources();
 	void loadIFO();
+	/** Start reading the files of the entry area in the background. */
+	void prefetchArea();
 	void loadArea();
 	void loadPC();
 	void loadParty();
@@ -390,6 +430,13 @@ private:
 	/** Actually replace the currently running module. */
 	void replaceModule();
 
+	/** Read ahead the archives of the module behind a nearby door, or stop once the party walked away. */
+	void updateTransitionPrefetch(float x, float y);
+	/** Start reading the archives of a module into the file cache in the background. */
+	void prefetchModule(const Common::UString &module);
+	/** Stop reading ahead a module's archives, dropping them from the file cache if requested. */
+	void cancelModulePrefetch(bool dropCached);
+
 	// Party
 
 	void updateCurrentPartyGUI();
@@ -78,7 +78,7 @@ void ObjectContainer::clearObjects() {
 
 	_objects.clear();
 
-	::Aurora::NWScript::ObjectContainer::clearObjects();
+	eraseObjects();
 
 	unlock();
 }
@@ -86,7 +86,7 @@ void ObjectContainer::clearObjects() {
 void ObjectContainer::addObject(Object &object) {
 	lock();
 
-	::Aurora::NWScript::ObjectContainer::addObject(object);
+	insertObject(object);
 
 	_objects[object.getType()].push_back(&object);
 
@@ -98,7 +98,7 @@ void ObjectContainer::removeObject(Object &object) {
 
 	_objects[object.getType()].remove(&object);
 
-	::Aurora::NWScript::ObjectContainer::removeObject(object);
+	eraseObject(object);
 
 	unlock();
 }
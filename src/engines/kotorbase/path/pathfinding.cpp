@@ -26,6 +26,7 @@
 #include "src/common/aabbnode.h"
 
 #include "src/engines/aurora/astar.h"
+#include "src/engines/aurora/navigationcache.h"
 
 #include "src/engines/kotorbase/room.h"
 
@@ -44,20 +45,45 @@ Pathfinding::Pathfinding(const std::vector<bool> &walkableProp) :
 }
 
 void Pathfinding::addRoom(Room *room) {
+	_rooms.push_back(room);
+}
+
+void Pathfinding::loadRoom(const Room &room) {
 	_startFace.push_back(_faces.size() / 3);
 
 	std::map<uint32_t, uint32_t> adjRooms;
-	_walkmeshLoader.load(Aurora::kFileTypeWOK, room->getResRef(), glm::mat4(),
+	_walkmeshLoader.load(Aurora::kFileTypeWOK, room.getResRef(), glm::mat4(),
 	                     _vertices, _faces, _faceProperty, _adjFaces, adjRooms,
 	                     this);
 	_adjRooms.push_back(adjRooms);
 
 	Common::AABBNode *rootNode = _walkmeshLoader.getAABB();
 	_aabbTrees.push_back(rootNode);
-	_rooms.push_back(room);
+}
+
+uint64_t Pathfinding::getCacheKey() const {
+	uint64_t key = NavigationCache::hash(MKTAG('K', 'T', 'O', 'R'));
+
+	key = NavigationCache::hash(key, (uint32_t) _rooms.size());
+	for (std::vector<Room *>::const_iterator r = _rooms.begin(); r != _rooms.end(); ++r) {
+		key = NavigationCache::hash(key, (*r)->getResRef());
+		key = NavigationCache::hash(key, NavigationCache::hashResource((*r)->getResRef(), Aurora::kFileTypeWOK));
+	}
+
+	return key;
 }
 
 void Pathfinding::connectRooms() {
+	const uint64_t cacheKey = NavigationCache::isEnabled() ? getCacheKey() : 0;
+
+	if (NavigationCache::isEnabled() && NavigationCache::load(cacheKey, *this)) {
+		flattenAABBTrees();
+		return;
+	}
+
+	for (std::vector<Room *>::const_iterator r = _rooms.begin(); r != _rooms.end(); ++r)
+		loadRoom(**r);
+
 	_verticesCount = _vertices.size() / 3;
 	_facesCount = _faces.size() / 3;
 
@@ -103,6 +129,10 @@ void Pathfinding::connectRooms() {
 			}
 		}
 	}
+
+	NavigationCache::save(cacheKey, *this);
+
+	flattenAABBTrees();
 }
 
 uint32_t Pathfinding::getFaceFromEdge(uint32_t edge, uint32_t room) const {
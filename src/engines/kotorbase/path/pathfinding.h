@@ -45,6 +45,11 @@ public:
 	Pathfinding(const std::vector<bool> &walkableProp);
 
 	void addRoom(Room *room);
+	/** Load and connect the walkmeshes of all rooms.
+	 *
+	 *  If the navigation cache is enabled, the connected walkmesh is taken
+	 *  from there instead, when the rooms haven't changed.
+	 */
 	void connectRooms();
 
 	Room *getRoomAt(float x, float y) const;
@@ -56,6 +61,11 @@ protected:
 
 private:
 	uint32_t getFaceFromEdge(uint32_t edge, uint32_t room) const;
+	/** Load the walkmesh of a room. */
+	void loadRoom(const Room &room);
+	/** Compute the navigation cache key of the added rooms. */
+	uint64_t getCacheKey() const;
+
 	std::vector<Room *> _rooms;
 };
 
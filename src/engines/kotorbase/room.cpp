@@ -31,18 +31,27 @@ namespace Engines {
 namespace KotORBase {
 
 Room::Room(const Common::UString &resRef, float x, float y, float z) : _resRef(resRef.toLower()) {
-	load(resRef, x, y, z);
+	load(resRef, (resRef == "****") ? 0 : loadModelObject(resRef), x, y, z);
 }
 
-void Room::load(const Common::UString &resRef, float x, float y, float z) {
+Room::Room(const Common::UString &resRef, PendingModel &&model, float x, float y, float z) :
+	_resRef(resRef.toLower()) {
+
+	load(resRef, model.take(), x, y, z);
+}
+
+void Room::load(const Common::UString &resRef, Graphics::Aurora::Model *model, float x, float y, float z) {
 	if (resRef == "****")
 		return;
 
-	_model.reset(loadModelObject(resRef));
+	_model.reset(model);
 	if (!_model)
 		throw Common::Exception("Can't load room model \"%s\"", resRef.c_str());
 
 	_model->setPosition(x, y, z);
+
+	// Room geometry doesn't move, so draw it in as few pieces as possible
+	_model->batchStaticNodes();
 }
 
 Common::UString Room::getResRef() const {
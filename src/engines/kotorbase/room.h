@@ -30,6 +30,8 @@
 
 #include "src/graphics/aurora/model.h"
 
+#include "src/engines/aurora/model.h"
+
 namespace Engines {
 
 namespace KotORBase {
@@ -37,6 +39,8 @@ namespace KotORBase {
 class Room {
 public:
 	Room(const Common::UString &resRef, float x, float y, float z);
+	/** Create a room out of a model that has been started loading beforehand. */
+	Room(const Common::UString &resRef, PendingModel &&model, float x, float y, float z);
 
 	Common::UString getResRef() const;
 
@@ -49,7 +53,7 @@ private:
 	Common::UString _resRef;
 	std::unique_ptr<Graphics::Aurora::Model> _model;
 
-	void load(const Common::UString &resRef, float x, float y, float z);
+	void load(const Common::UString &resRef, Graphics::Aurora::Model *model, float x, float y, float z);
 };
 
 } // End of namespace KotORBase
@@ -24,8 +24,6 @@
 
 #include "src/common/util.h"
 
-#include "src/events/events.h"
-
 #include "src/engines/kotorbase/round.h"
 #include "src/engines/kotorbase/module.h"
 
@@ -38,7 +36,7 @@ const int kRoundLength = 2 * kCombatRoundLength; // ms
 
 RoundController::RoundController(Module *module) :
 		_module(module),
-		_startTimestamp(EventMan.getTimestamp()),
+		_roundTime(0),
 		_combatRound(0) {
 }
 
@@ -46,7 +44,9 @@ int RoundController::getNextCombatRound() const {
 	return _combatRound ? 0 : 1;
 }
 
-void RoundController::update() {
+void RoundController::update(uint32_t elapsed) {
+	_roundTime += elapsed;
+
 	switch (_combatRound) {
 		case 0:
 			if (hasTimePassed(kCombatRoundLength)) {
@@ -58,7 +58,7 @@ void RoundController::update() {
 		case 1:
 			if (hasTimePassed(kRoundLength)) {
 				raiseCombatRoundEnded();
-				_startTimestamp = EventMan.getTimestamp();
+				_roundTime -= kRoundLength;
 				_combatRound = 0;
 				raiseCombatRoundBegan();
 				raiseHeartbeat();
@@ -70,7 +70,7 @@ void RoundController::update() {
 }
 
 inline bool RoundController::hasTimePassed(int ms) {
-	return EventMan.getTimestamp() > _startTimestamp + ms;
+	return _roundTime > (uint32_t)ms;
 }
 
 inline void RoundController::raiseCombatRoundEnded() {
@@ -25,6 +25,8 @@
 #ifndef ENGINES_KOTORBASE_ROUND_H
 #define ENGINES_KOTORBASE_ROUND_H
 
+#include "src/common/types.h"
+
 namespace Engines {
 
 namespace KotORBase {
@@ -37,11 +39,12 @@ public:
 
 	int getNextCombatRound() const;
 
-	void update();
+	/** Advance the round by that many milliseconds of simulated time. */
+	void update(uint32_t elapsed);
 
 private:
 	Module *_module;
-	uint32_t _startTimestamp;
+	uint32_t _roundTime; ///< Simulated time since the round started, in milliseconds.
 	int _combatRound;
 
 	bool hasTimePassed(int ms);
@@ -22,10 +22,23 @@
  *  Creation and loading of saved games for KotOR games.
  */
 
-#include "src/common/error.h"
 #include <memory>
+#include <map>
+#include <vector>
+
+#include "src/common/error.h"
+#include "src/common/mutex.h"
+#include "src/common/md5.h"
 #include "src/common/filepath.h"
+#include "src/common/util.h"
 #include "src/common/readfile.h"
+#include "src/common/writefile.h"
+#include "src/common/memreadstream.h"
+#include "src/common/memwritestream.h"
+#include "src/common/filelist.h"
+
+#include "src/aurora/gff3writer.h"
+#include "src/aurora/erfwriter.h"
 
 #include "src/engines/kotorbase/savedgame.h"
 #include "src/engines/kotorbase/gui/chargeninfo.h"
@@ -46,11 +59,11 @@ SavedGame::~SavedGame() {
 }
 
 void SavedGame::load(const Common::UString &dir, bool loadSav) {
-	Common::UString nfoPath(Common::FilePath::normalize(dir + "/savenfo.res"));
-	Common::ReadFile *nfoFile = new Common::ReadFile(nfoPath);
-	Aurora::GFF3File nfoGff(nfoFile);
+	const SavedGameInfo info = readInfo(dir);
 
-	fillFromNFO(nfoGff);
+	_name       = info.name;
+	_moduleName = info.moduleName;
+	_timePlayed = info.timePlayed;
 
 	if (loadSav) {
 		Common::UString savPath(Common::FilePath::normalize(dir + "/SAVEGAME.sav"));
@@ -60,11 +73,25 @@ void SavedGame::load(const Common::UString &dir, bool loadSav) {
 	}
 }
 
-void SavedGame::fillFromNFO(const Aurora::GFF3File &gff) {
+SavedGameInfo SavedGame::readInfo(const Common::UString &dir) {
+	Common::UString nfoPath(Common::FilePath::normalize(dir + "/savenfo.res"));
+	Common::ReadFile *nfoFile = new Common::ReadFile(nfoPath);
+	Aurora::GFF3File nfoGff(nfoFile);
+
+	SavedGameInfo info;
+	fillFromNFO(nfoGff, info);
+
+	Common::FileList files(dir);
+	info.screenshot = files.findFirst("/screen.tga", true);
+
+	return info;
+}
+
+void SavedGame::fillFromNFO(const Aurora::GFF3File &gff, SavedGameInfo &info) {
 	const Aurora::GFF3Struct &root = gff.getTopLevel();
-	_name = root.getString("SAVEGAMENAME");
-	_moduleName = root.getString("LASTMODULE");
-	_timePlayed = root.getUint("TIMEPLAYED");
+	info.name = root.getString("SAVEGAMENAME");
+	info.moduleName = root.getString("LASTMODULE");
+	info.timePlayed = root.getUint("TIMEPLAYED");
 }
 
 void SavedGame::fillFromSAV(const Aurora::ERFFile &erf, const Common::UString &moduleName) {
@@ -123,6 +150,143 @@ void SavedGame::fillFromModuleIFO(const Aurora::GFF3File &gff) {
 	}
 }
 
+/** Serialize a GFF into memory. */
+static Common::MemoryReadStream *writeGFF(Aurora::GFF3Writer &gff) {
+	Common::MemoryWriteStreamDynamic stream(false);
+	gff.write(stream);
+
+	return new Common::MemoryReadStream(stream.getData(), stream.size(), true);
+}
+
+/** What we know about a file we wrote into a saved game directory. */
+struct WrittenFile {
+	size_t size;
+	uint64_t modificationTime;
+	std::vector<byte> digest;
+};
+
+typedef std::map<Common::UString, WrittenFile> WrittenFiles;
+
+static std::mutex _writtenFilesMutex;
+static WrittenFiles _writtenFiles;
+
+/** Write data into a file, unless the file already holds exactly this data.
+ *
+ *  Only files we wrote ourselves during this run are compared. If the file
+ *  was changed by anybody else in the meantime, its size or modification
+ *  time won't match anymore and it's written again.
+ */
+static void writeIfChanged(const Common::UString &path, Common::MemoryWriteStreamDynamic &data) {
+	WrittenFile file;
+
+	file.size = data.size();
+	Common::hashMD5(data.getData(), data.size(), file.digest);
+
+	{
+		std::lock_guard<std::mutex> lock(_writtenFilesMutex);
+
+		WrittenFiles::const_iterator written = _writtenFiles.find(path);
+		if ((written != _writtenFiles.end()) && (written->second.size == file.size) &&
+		    (written->second.digest == file.digest) &&
+		    (Common::FilePath::getFileSize(path) == file.size) &&
+		    (Common::FilePath::getModificationTime(path) == written->second.modificationTime))
+			return;
+	}
+
+	{
+		Common::WriteFile writeFile(path);
+
+		writeFile.write(data.getData(), data.size());
+		writeFile.flush();
+	}
+
+	file.modificationTime = Common::FilePath::getModificationTime(path);
+
+	std::lock_guard<std::mutex> lock(_writtenFilesMutex);
+	_writtenFiles[path] = file;
+}
+
+void SavedGame::write(const SavedGameSnapshot &snapshot, const Common::UString &dir) {
+	if (!Common::FilePath::createDirectories(dir))
+		throw Common::Exception("Failed to create saved game directory \"%s\"", dir.c_str());
+
+	// The menu information
+
+	Aurora::GFF3Writer nfo(MKTAG('N', 'F', 'O', ' '));
+	nfo.getTopLevel()->addExoString("AREANAME", snapshot.areaName);
+	nfo.getTopLevel()->addExoString("LASTMODULE", snapshot.moduleName);
+	nfo.getTopLevel()->addExoString("SAVEGAMENAME", snapshot.name);
+	nfo.getTopLevel()->addUint32("TIMEPLAYED", snapshot.timePlayed);
+
+	Common::MemoryWriteStreamDynamic nfoData(true);
+	nfo.write(nfoData);
+
+	writeIfChanged(Common::FilePath::normalize(dir + "/savenfo.res"), nfoData);
+
+	// The module state, packed into the module's SAV
+
+	Aurora::GFF3Writer ifo(MKTAG('I', 'F', 'O', ' '));
+
+	Aurora::GFF3WriterStructPtr player = ifo.getTopLevel()->addList("Mod_PlayerList")->addStruct("");
+	player->addByte("Gender", snapshot.pcGender);
+	player->addFloat("XPosition", snapshot.pcPosition[0]);
+	player->addFloat("YPosition", snapshot.pcPosition[1]);
+	player->addFloat("ZPosition", snapshot.pcPosition[2]);
+
+	std::unique_ptr<Common::MemoryReadStream> ifoData(writeGFF(ifo));
+
+	Common::MemoryWriteStreamDynamic moduleSav(true);
+	{
+		Aurora::ERFWriter moduleErf(MKTAG('S', 'A', 'V', ' '), 1, moduleSav);
+		moduleErf.add("Module", Aurora::kFileTypeIFO, *ifoData);
+	}
+
+	Common::MemoryReadStream moduleSavData(moduleSav.getData(), moduleSav.size());
+
+	/* The module state only changes when the party actually did something,
+	 * so repeated saves into the same directory (autosaves, quick saves) can
+	 * usually leave the SAV as it is and only update the menu information. */
+
+	Common::MemoryWriteStreamDynamic savData(true);
+	{
+		Aurora::ERFWriter savErf(MKTAG('S', 'A', 'V', ' '), 1, savData);
+		savErf.add(snapshot.moduleName, Aurora::kFileTypeSAV, moduleSavData);
+	}
+
+	writeIfChanged(Common::FilePath::normalize(dir + "/SAVEGAME.sav"), savData);
+}
+
+const SavedGameInfo &SavedGameIndex::get(const Common::UString &dir) {
+	const Common::UString nfoPath(Common::FilePath::normalize(dir + "/savenfo.res"));
+
+	// Saved games are written into place, so the directory itself doesn't always change
+	const uint64_t modificationTime = MAX(Common::FilePath::getModificationTime(dir),
+	                                      Common::FilePath::getModificationTime(nfoPath));
+
+	Entries::iterator entry = _entries.find(dir);
+	if ((entry != _entries.end()) && (entry->second.modificationTime == modificationTime))
+		return entry->second.info;
+
+	Entry newEntry;
+	newEntry.modificationTime = modificationTime;
+	newEntry.info = SavedGame::readInfo(dir);
+
+	if (entry != _entries.end()) {
+		entry->second = newEntry;
+		return entry->second.info;
+	}
+
+	return _entries.insert(std::make_pair(dir, newEntry)).first->second.info;
+}
+
+void SavedGameIndex::invalidate(const Common::UString &dir) {
+	_entries.erase(dir);
+}
+
+void SavedGameIndex::clear() {
+	_entries.clear();
+}
+
 const Common::UString &SavedGame::getName() const {
 	return _name;
 }
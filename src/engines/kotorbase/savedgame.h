@@ -26,17 +26,75 @@
 #define ENGINES_KOTORBASE_SAVEDGAME_H
 
 #include <memory>
+#include <map>
+
 #include "src/common/ustring.h"
 
 #include "src/aurora/erffile.h"
 #include "src/aurora/gff3file.h"
 
+#include "src/engines/kotorbase/types.h"
+
 namespace Engines {
 
 namespace KotORBase {
 
 class CharacterGenerationInfo;
 
+/** The state of a running game, captured for writing it into a saved game.
+ *
+ *  It only holds copies of the state, so it can be written on another thread
+ *  while the game goes on.
+ */
+struct SavedGameSnapshot {
+	Common::UString name;       ///< The name the player gave the saved game.
+	Common::UString moduleName; ///< The module the party is in.
+	Common::UString areaName;   ///< The name of the area the party is in.
+
+	uint32_t timePlayed { 0 }; ///< The time played, in seconds.
+
+	Gender pcGender { kGenderMale };
+	float pcPosition[3] { 0.0f, 0.0f, 0.0f };
+};
+
+/** The information about a saved game shown in the menus. */
+struct SavedGameInfo {
+	Common::UString name;       ///< The name the player gave the saved game.
+	Common::UString moduleName; ///< The module the party was in.
+
+	uint32_t timePlayed { 0 }; ///< The time played, in seconds.
+
+	/** Path to the screenshot image, if any. Only decoded when it's actually shown. */
+	Common::UString screenshot;
+};
+
+/** An index of the menu information of saved games.
+ *
+ *  Lets the menus list a saves directory without reparsing every saved game
+ *  each time. An entry is only read again when the modification time of its
+ *  directory or its savenfo.res changed.
+ */
+class SavedGameIndex {
+public:
+	/** Return the information of the saved game in this directory. */
+	const SavedGameInfo &get(const Common::UString &dir);
+
+	/** Forget about the saved game in this directory. */
+	void invalidate(const Common::UString &dir);
+	/** Forget about all saved games. */
+	void clear();
+
+private:
+	struct Entry {
+		uint64_t modificationTime;
+		SavedGameInfo info;
+	};
+
+	typedef std::map<Common::UString, Entry> Entries;
+
+	Entries _entries;
+};
+
 class SavedGame {
 public:
 	/** Load saved game from a specified directory.
@@ -54,6 +112,15 @@ public:
 
 	virtual CharacterGenerationInfo *createCharGenInfo() = 0;
 
+	/** Write a snapshot of a game into a saved game directory, creating it if necessary.
+	 *
+	 *  Only touches the snapshot, so it can be called on any thread.
+	 */
+	static void write(const SavedGameSnapshot &snapshot, const Common::UString &dir);
+
+	/** Read only the menu information out of a saved game directory. */
+	static SavedGameInfo readInfo(const Common::UString &dir);
+
 protected:
 	Common::UString _name;
 	Common::UString _moduleName;
@@ -65,7 +132,7 @@ protected:
 private:
 	void load(const Common::UString &dir, bool loadSav);
 
-	void fillFromNFO(const Aurora::GFF3File &gff);
+	static void fillFromNFO(const Aurora::GFF3File &gff, SavedGameInfo &info);
 	void fillFromSAV(const Aurora::ERFFile &erf, const Common::UString &moduleName);
 	void fillFromModuleSAV(const Aurora::ERFFile &erf);
 	void fillFromModuleIFO(const Aurora::GFF3File &gff);
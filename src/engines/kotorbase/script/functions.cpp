@@ -101,6 +101,10 @@ Aurora::NWScript::Object *Functions::getParamObject(const Aurora::NWScript::Func
 
 void Functions::jumpTo(KotORBase::Object *object, float x, float y, float z) {
 	object->setPosition(x, y, z);
+
+	Area *area = _game->getModule().getCurrentArea();
+	if (area)
+		area->notifyObjectMoved(*object);
 }
 
 } // End of namespace KotORBase
@@ -73,12 +73,12 @@ void Functions::getObjectByTag(Aurora::NWScript::FunctionContext &ctx) {
 	Common::UString name = ctx.getParams()[0].getString();
 	int nth = ctx.getParams()[1].getInt();
 
-	std::unique_ptr<Aurora::NWScript::ObjectSearch> search(_game->getModule().findObjectsByTag(name));
+	Aurora::NWScript::ObjectRange search = _game->getModule().getObjectsByTag(name);
 	for (int i = 0; i < nth; ++i) {
-		search->next();
+		search.next();
 	}
 
-	ctx.getReturn() = search->get();
+	ctx.getReturn() = search.get();
 }
 
 void Functions::getMinOneHP(Aurora::NWScript::FunctionContext &ctx) {
@@ -196,7 +196,7 @@ void Functions::jumpToLocation(Aurora::NWScript::FunctionContext &ctx) {
 
 	float x, y, z;
 	moveTo->getPosition(x, y, z);
-	object->setPosition(x, y, z);
+	jumpTo(object, x, y, z);
 }
 
 void Functions::getItemInSlot(Aurora::NWScript::FunctionContext &ctx) {
@@ -25,7 +25,6 @@
 #include "src/common/endianness.h"
 #include "src/common/random.h"
 
-#include "src/aurora/resman.h"
 #include "src/aurora/gff3file.h"
 
 #include "src/sound/sound.h"
@@ -66,9 +65,7 @@ SoundObject::SoundObject(const Aurora::GFF3Struct &sound) {
 	if (_random)
 		soundFile = _soundFiles[RNG.getNext(0, _soundFiles.size())];
 
-	Common::SeekableReadStream *soundStream = ResMan.getResource(Aurora::kResourceSound, soundFile);
-
-	_sound = SoundMan.playSoundFile(soundStream, Sound::kSoundTypeSFX, _looping);
+	_sound = SoundMan.playSoundResource(soundFile, Aurora::kResourceSound, Sound::kSoundTypeSFX, _looping);
 
 	_name = gff.getString("Tag");
 
@@ -27,6 +27,7 @@
 #include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/maths.h"
+#include "src/common/profiler.h"
 
 #include "src/aurora/gff3file.h"
 #include "src/aurora/2dafile.h"
@@ -86,6 +87,8 @@ Area::~Area() {
 }
 
 void Area::load() {
+	PROFILE_ZONE("Area::load");
+
 	Aurora::GFF3File are(_resRef, Aurora::kFileTypeARE, MKTAG('A', 'R', 'E', ' '), true);
 	loadARE(are.getTopLevel());
 
@@ -161,6 +164,8 @@ uint32_t Area::getMusicBattleTrack() const {
 void Area::setMusicDayTrack(uint32_t track) {
 	_musicDayTrack = track;
 	_musicDay      = TwoDAReg.get2DA("ambientmusic").getRow(track).getString("Resource");
+
+	_ambientMusic.prefetch(_musicDay);
 }
 
 void Area::setMusicNightTrack(uint32_t track) {
@@ -187,6 +192,9 @@ void Area::setMusicBattleTrack(uint32_t track) {
 		for (int i = 0; i < 3; i++)
 			if (!stinger[i].empty())
 				_musicBattleStinger.push_back(stinger[i]);
+
+		// Have the battle music ready, so that switching to it is instant
+		_ambientMusic.prefetch(_musicBattle);
 	}
 }
 
@@ -196,7 +204,7 @@ void Area::stopSound() {
 }
 
 void Area::stopAmbientMusic() {
-	SoundMan.stopChannel(_ambientMusic);
+	_ambientMusic.stop();
 }
 
 void Area::stopAmbientSound() {
@@ -204,16 +212,12 @@ void Area::stopAmbientSound() {
 }
 
 void Area::playAmbientMusic(Common::UString music) {
-	stopAmbientMusic();
-
 	// TODO: Area::playAmbientMusic(): Day/Night
 	if (music.empty())
 		music = _musicDay;
 
-	if (music.empty())
-		return;
-
-	_ambientMusic = ::Engines::playSound(music, Sound::kSoundTypeMusic, true);
+	// Crossfades from the music currently playing, if any
+	_ambientMusic.play(music);
 }
 
 void Area::playAmbientSound(Common::UString sound) {
@@ -407,6 +411,10 @@ void Area::loadTile(const Aurora::GFF3Struct &t, Tile &tile) {
 }
 
 void Area::loadModels() {
+	// Let the object models load in the background while we're busy with the tiles
+	for (auto &object : _objects)
+		object->prefetchModel();
+
 	loadTileModels();
 
 	for (auto &object : _objects) {
@@ -459,15 +467,29 @@ void Area::unloadTileset() {
 }
 
 void Area::loadTiles() {
+	/* Parse all tile models at once on the thread pool. The first tile using
+	 * a model loads it as a template. All further tiles with the same model
+	 * wait for it, so that they share its meshes instead of reading them too. */
+	typedef std::map<Common::UString, size_t, Common::UString::iless> TemplateMap;
+
+	TemplateMap templates;
+
+	std::vector<PendingModel> models(_tiles.size());
+	for (size_t n = 0; n < _tiles.size(); n++) {
+		_tiles[n].tile = &_tileset->getTile(_tiles[n].tileID);
+
+		std::pair<TemplateMap::iterator, bool> t = templates.insert(std::make_pair(_tiles[n].tile->model, n));
+
+		models[n] = loadModelObjectAsync(_tiles[n].tile->model, "", t.second ? 0 : &models[t.first->second]);
+	}
+
 	for (uint32_t y = 0; y < _height; y++) {
 		for (uint32_t x = 0; x < _width; x++) {
 			uint32_t n = y * _width + x;
 
 			Tile &t = _tiles[n];
 
-			t.tile = &_tileset->getTile(t.tileID);
-
-			t.model = loadModelObject(t.tile->model);
+			t.model = models[n].take();
 			if (!t.model)
 				throw Common::Exception("Can't load tile model \"%s\"", t.tile->model.c_str());
 
@@ -43,6 +43,8 @@
 #include "src/events/types.h"
 #include "src/events/notifyable.h"
 
+#include "src/engines/aurora/areamusic.h"
+
 #include "src/engines/nwn/tileset.h"
 #include "src/engines/nwn/object.h"
 
@@ -183,7 +185,7 @@ private:
 	bool _visible; ///< Is the area currently visible?
 
 	Sound::ChannelHandle _ambientSound; ///< Sound handle of the currently playing sound.
-	Sound::ChannelHandle _ambientMusic; ///< Sound handle of the currently playing music.
+	AreaMusic _ambientMusic; ///< The currently playing music.
 
 	uint32_t _width;  ///< Width  of the area in tiles, as seen from top-down.
 	uint32_t _height; ///< Height of the area in tiles, as seen from top-down.
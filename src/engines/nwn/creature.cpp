@@ -24,10 +24,13 @@
 
 #include <cassert>
 
+#include <map>
+
 #include "src/common/util.h"
 #include "src/common/maths.h"
 #include "src/common/readfile.h"
 #include "src/common/configman.h"
+#include "src/common/mutex.h"
 
 #include "src/aurora/types.h"
 #include "src/aurora/talkman.h"
@@ -38,7 +41,6 @@
 
 #include "src/graphics/aurora/model.h"
 #include "src/graphics/aurora/modelnode.h"
-#include "src/graphics/aurora/textureman.h"
 #include "src/graphics/aurora/pltfile.h"
 
 #include "src/events/events.h"
@@ -506,7 +508,53 @@ static const char * const kBodyPartNodes[] = {
 	"rhand_g"    , "lhand_g"
 };
 
+/** The resolved resource names of a parts-based creature's body. */
+struct PartAssembly {
+	Common::UString superModel;
+
+	Common::UString models[ARRAYSIZE(kBodyPartNodes)];
+	Common::UString textures[ARRAYSIZE(kBodyPartNodes)];
+};
+
+/** Drop all cached part assemblies when there are more than that. */
+static const size_t kMaxPartAssemblies = 512;
+
+/** Part assemblies already resolved, for creatures built out of the same parts. */
+static std::map<Common::UString, PartAssembly> partAssemblies;
+static uint32_t partAssembliesGeneration = 0;
+static std::mutex partAssembliesMutex;
+
 void Creature::getPartModels() {
+	/* Finding the part model and texture names probes the resources several
+	 * times for each part. Creatures made from the same template, like a
+	 * town's guards, resolve to the same names, so those are cached. */
+
+	Common::UString key = Common::UString::format("%u/%u/%u", (uint) _gender, (uint) _race, (uint) _phenotype);
+	for (size_t i = 0; i < kBodyPartMAX; i++)
+		key += Common::UString::format("/%u", _bodyParts[i].idArmor > 0 ? _bodyParts[i].idArmor : _bodyParts[i].id);
+
+	{
+		std::lock_guard<std::mutex> lock(partAssembliesMutex);
+
+		// A module or its HAKs can override the parts
+		if (partAssembliesGeneration != ResMan.getGeneration()) {
+			partAssemblies.clear();
+			partAssembliesGeneration = ResMan.getGeneration();
+		}
+
+		std::map<Common::UString, PartAssembly>::const_iterator assembly = partAssemblies.find(key);
+		if (assembly != partAssemblies.end()) {
+			_partsSuperModelName = assembly->second.superModel;
+
+			for (size_t i = 0; i < kBodyPartMAX; i++) {
+				_bodyParts[i].modelName   = assembly->second.models[i];
+				_bodyParts[i].textureName = assembly->second.textures[i];
+			}
+
+			return;
+		}
+	}
+
 	const Aurora::TwoDAFile &appearance = TwoDAReg.get2DA("appearance");
 
 	const Aurora::TwoDARow &gender = TwoDAReg.get2DA("gender").getRow((uint) _gender);
@@ -533,6 +581,21 @@ void Creature::getPartModels() {
 		                   _bodyParts[i].idArmor > 0 ? _bodyParts[i].idArmor : _bodyParts[i].id,
 		                   genderChar, raceChar, phenoChar, phenoAltChar,
 		                   _bodyParts[i].modelName, _bodyParts[i].textureName);
+
+	PartAssembly assembly;
+
+	assembly.superModel = _partsSuperModelName;
+	for (size_t i = 0; i < kBodyPartMAX; i++) {
+		assembly.models[i]   = _bodyParts[i].modelName;
+		assembly.textures[i] = _bodyParts[i].textureName;
+	}
+
+	std::lock_guard<std::mutex> lock(partAssembliesMutex);
+
+	if (partAssemblies.size() >= kMaxPartAssemblies)
+		partAssemblies.clear();
+
+	partAssemblies[key] = assembly;
 }
 
 void Creature::getArmorModels() {
@@ -610,32 +673,28 @@ void Creature::loadModel() {
 	if (appearance.getString("MODELTYPE") == "P") {
 		getArmorModels();
 		getPartModels();
+
+		// Load all part models at the same time, while we load the supermodel
+		PendingModel partModels[kBodyPartMAX];
+		for (size_t i = 0; i < kBodyPartMAX; i++)
+			partModels[i] = loadModelObjectAsync(_bodyParts[i].modelName, _bodyParts[i].textureName);
+
 		_model.reset(loadModelObject(_partsSuperModelName));
 
 		for (size_t i = 0; i < kBodyPartMAX; i++) {
-			if (_bodyParts[i].modelName.empty())
+			Graphics::Aurora::Model *partModel = partModels[i].take();
+			if (!partModel)
 				continue;
 
-			TextureMan.startRecordNewTextures();
-
-			// Try to load in the corresponding part model
-			Graphics::Aurora::Model *partModel = loadModelObject(_bodyParts[i].modelName, _bodyParts[i].textureName);
-			if (!partModel)
+			if (!_model) {
+				freeModel(partModel);
 				continue;
+			}
 
 			// Add the loaded model to the appropriate part node
 			_model->attachModel(kBodyPartNodes[i], partModel);
 
-			std::list<Common::UString> newTextures;
-			TextureMan.stopRecordNewTextures(newTextures);
-
-			for (std::list<Common::UString>::const_iterator t = newTextures.begin(); t != newTextures.end(); ++t) {
-				Graphics::Aurora::TextureHandle texture = TextureMan.getIfExist(*t);
-				if (texture.empty())
-					continue;
-
-				_bodyParts[i].textures.push_back(texture);
-			}
+			partModel->getTextures(_bodyParts[i].textures);
 
 			finishPLTs(_bodyParts[i].textures);
 		}
@@ -818,16 +877,7 @@ void Creature::loadProperties(const Aurora::GFF3Struct &gff) {
 	}
 
 	// Feats
-	if (gff.hasField("FeatList")) {
-		_feats.clear();
-
-		const Aurora::GFF3List &feats = gff.getList("FeatList");
-		for (Aurora::GFF3List::const_iterator f = feats.begin(); f != feats.end(); ++f) {
-			const Aurora::GFF3Struct &feat = **f;
-
-			_feats.push_back(feat.getUint("Feat"));
-		}
-	}
+	gff.getListUint("FeatList", "Feat", _feats);
 
 	// Deity
 	_deity = gff.getString("Deity", _deity);
@@ -26,9 +26,11 @@
 
 #include <algorithm>
 
+#include "src/common/error.h"
 #include "src/common/filepath.h"
 #include "src/common/filelist.h"
 #include "src/common/configman.h"
+#include "src/common/fixedtimestep.h"
 
 #include "src/aurora/resman.h"
 
@@ -54,6 +56,9 @@ namespace Engines {
 
 namespace NWN {
 
+/** How many times per second the running module is processed. */
+static const uint32_t kModuleUpdateRate = 100;
+
 Game::Game(NWNEngine &engine, ::Engines::Console &console, const Version &version) :
 	_engine(&engine), _console(&console), _version(&version) {
 
@@ -86,6 +91,17 @@ void Game::run() {
 	_module.reset();
 }
 
+void Game::benchmarkLoad(const Common::UString &module, Common::UString &area) {
+	Common::UString moduleFile = module;
+	if (!hasModule(moduleFile))
+		throw Common::Exception("No such module \"%s\"", module.c_str());
+
+	_module = std::make_unique<Module>(*_console, *_version);
+
+	_module->load(moduleFile);
+	_module->loadBenchmarkArea(area);
+}
+
 void Game::runModule() {
 	if (EventMan.quitRequested() || !_module->isLoaded()) {
 		_module->clear();
@@ -97,13 +113,16 @@ void Game::runModule() {
 	_module->enter();
 	EventMan.enableKeyRepeat(true);
 
+	// Process the module at a steady rate, instead of sleeping a fixed time after each update
+	Common::FramePacer pacer(kModuleUpdateRate);
+
 	while (!EventMan.quitRequested() && _module->isRunning()) {
 		Events::Event event;
 		while (EventMan.pollEvent(event))
 			_module->addEvent(event);
 
 		_module->processEventQueue();
-		EventMan.delay(10);
+		pacer.wait();
 	}
 
 	EventMan.enableKeyRepeat(false);
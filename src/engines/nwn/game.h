@@ -62,6 +62,13 @@ public:
 
 	void run();
 
+	/** Load a module and one of its areas for the load benchmark, without running it.
+	 *
+	 *  If no area is given, the module's entry area is loaded. Either way, the
+	 *  name of the loaded area is returned in area.
+	 */
+	void benchmarkLoad(const Common::UString &module, Common::UString &area);
+
 	/** Return a list of all modules. */
 	static void getModules(std::vector<Common::UString> &modules);
 	/** Return a list of all premium modules. */
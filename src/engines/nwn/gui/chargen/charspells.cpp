@@ -308,41 +308,48 @@ void CharSpells::makeSpellsList() {
 
 	// Add spells to available and known list.
 	const Aurora::TwoDAFile &twodaSpells = TwoDAReg.get2DA("spells");
+
+	const Aurora::TwoDAColumnHandle colName      = twodaSpells.getColumnHandle("Name");
+	const Aurora::TwoDAColumnHandle colCaster    = twodaSpells.getColumnHandle(casterName);
+	const Aurora::TwoDAColumnHandle colSchool    = twodaSpells.getColumnHandle("School");
+	const Aurora::TwoDAColumnHandle colIcon      = twodaSpells.getColumnHandle("IconResRef");
+	const Aurora::TwoDAColumnHandle colSpellDesc = twodaSpells.getColumnHandle("SpellDesc");
+
 	for (size_t sp = 0; sp < twodaSpells.getRowCount(); ++sp) {
 		// TODO: Check if character already own the spell.
 		const Aurora::TwoDARow &spellRow = twodaSpells.getRow(sp);
 
-		if (spellRow.empty("Name"))
+		if (spellRow.empty(colName))
 			continue;
 
-		if (spellRow.empty(casterName))
+		if (spellRow.empty(colCaster))
 			continue;
 
 		// Check spell level.
-		uint32_t spellLevel = static_cast<uint32_t>(spellRow.getInt(casterName));
+		uint32_t spellLevel = static_cast<uint32_t>(spellRow.getInt(colCaster));
 		if (spellLevel > _maxLevel)
 			continue;
 
 		// Check spell school.
-		if (spellRow.getString("School") == oppositeSchool)
+		if (spellRow.getString(colSchool) == oppositeSchool)
 			continue;
 
 		// The wizard knows all the level 0 spells.
 		if (gainTable == "CLS_SPGN_WIZ" && spellLevel == 0) {
 			Spell spell;
 			spell.spellID = sp;
-			spell.name = TalkMan.getString(spellRow.getInt("Name"));
-			spell.icon = spellRow.getString("IconResRef");
-			spell.desc = TalkMan.getString(spellRow.getInt("SpellDesc"));
+			spell.name = TalkMan.getString(spellRow.getInt(colName));
+			spell.icon = spellRow.getString(colIcon);
+			spell.desc = TalkMan.getString(spellRow.getInt(colSpellDesc));
 			_knownSpells[spellLevel].push_back(spell);
 			continue;
 		}
 
 		Spell spell;
 		spell.spellID = sp;
-		spell.name = TalkMan.getString(spellRow.getInt("Name"));
-		spell.icon = spellRow.getString("IconResRef");
-		spell.desc = TalkMan.getString(spellRow.getInt("SpellDesc"));
+		spell.name = TalkMan.getString(spellRow.getInt(colName));
+		spell.icon = spellRow.getString(colIcon);
+		spell.desc = TalkMan.getString(spellRow.getInt(colSpellDesc));
 		_availSpells[spellLevel].push_back(spell);
 	}
 
@@ -29,6 +29,7 @@
 #include "src/common/filepath.h"
 #include "src/common/readfile.h"
 #include "src/common/md5.h"
+#include "src/common/profiler.h"
 
 #include "src/events/events.h"
 
@@ -39,6 +40,8 @@
 #include "src/aurora/erffile.h"
 #include "src/aurora/resman.h"
 
+#include "src/aurora/nwscript/ncsfile.h"
+
 #include "src/graphics/camera.h"
 
 #include "src/graphics/aurora/textureman.h"
@@ -98,14 +101,11 @@ namespace Engines {
 
 namespace NWN {
 
-bool Module::Action::operator<(const Action &s) const {
-	return timestamp < s.timestamp;
-}
-
-
 Module::Module(::Engines::Console &console, const Version &gameVersion) : Object(kObjectTypeModule),
 	_console(&console), _gameVersion(&gameVersion) {
 
+	_scriptBudget = MAX(ConfigMan.getInt("scriptbudget", 0), 0);
+
 	_ingameGUI = std::make_unique<IngameGUI>(*this, _console);
 }
 
@@ -160,6 +160,8 @@ void Module::preparePremiumModule(const Common::UString &module) {
 }
 
 void Module::loadModule(const Common::UString &module) {
+	PROFILE_ZONE("Module::loadModule");
+
 	unload(false);
 
 	if (module.empty())
@@ -340,17 +342,27 @@ void Module::enter() {
 
 	_ingameGUI->updatePartyMember(0, *_pc);
 
+	// Prefetch what the last entry of this module needed, and record what this one needs
+	ResMan.beginResourceTrace(_ifo.getTag());
+
 	try {
 
-		loadTLK();
+		// Read the custom TLK in the background while the HAKs are parsed
+		prefetchTLK();
+
 		loadHAKs();
+		loadTLK();
 		loadAreas();
 
 	} catch (Common::Exception &e) {
+		ResMan.endResourceTrace();
+
 		e.add("Can't initialize module \"%s\"", _ifo.getName().getString().c_str());
 		throw e;
 	}
 
+	ResMan.endResourceTrace();
+
 	float entryX, entryY, entryZ, entryDirX, entryDirY;
 	_ifo.getEntryPosition(entryX, entryY, entryZ);
 	_ifo.getEntryDirection(entryDirX, entryDirY);
@@ -518,20 +530,43 @@ void Module::handleEvents() {
 	_ingameGUI->processEventQueue();
 }
 
-void Module::handleActions() {
+void Module::handleActions(bool complete) {
 	uint32_t now = EventMan.getTimestamp();
 
-	while (!_delayedActions.empty()) {
-		ActionQueue::iterator action = _delayedActions.begin();
+	// Actions can schedule new actions that are due immediately, so repeat until none are left
+	std::vector<Action> actions;
+	for (_delayedActions.advance(now, actions); !actions.empty(); _delayedActions.advance(now, actions)) {
+		for (std::vector<Action>::const_iterator action = actions.begin(); action != actions.end(); ++action)
+			if (action->type == kActionScript)
+				runDelayedScript(*action, complete ? 0 : _scriptBudget);
 
-		if (now < action->timestamp)
-			break;
+		actions.clear();
+	}
+}
 
-		if (action->type == kActionScript)
-			ScriptContainer::runScript(action->script, action->state,
-			                           action->owner, action->triggerer);
+void Module::runDelayedScript(const Action &action, size_t budget) {
+	if (action.script.empty())
+		return;
 
-		_delayedActions.erase(action);
+	try {
+		Aurora::NWScript::NCSFile ncs(action.script);
+
+		ncs.setInstructionBudget(budget);
+		ncs.run(action.state, action.owner, action.triggerer);
+
+		if (!ncs.isSuspended())
+			return;
+
+		// Continue the script in the next frame, after everything else that's due now
+		Action continuation = action;
+
+		continuation.state     = ncs.getContinuation();
+		continuation.timestamp = EventMan.getTimestamp() + 1;
+
+		_delayedActions.schedule(continuation.timestamp, continuation);
+
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed running script \"%s\"", action.script.c_str());
 	}
 }
 
@@ -552,7 +587,7 @@ void Module::unload(bool completeUnload) {
 
 void Module::unloadModule() {
 	runScript(kScriptExit, this, _pc.get());
-	handleActions();
+	handleActions(true);
 
 	_eventQueue.clear();
 	_delayedActions.clear();
@@ -583,6 +618,14 @@ void Module::unloadPC() {
 	_pc.reset();
 }
 
+void Module::prefetchTLK() {
+	if (_ifo.getTLK().empty())
+		return;
+
+	ResMan.prefetch(_ifo.getTLK()      , Aurora::kFileTypeTLK);
+	ResMan.prefetch(_ifo.getTLK() + "f", Aurora::kFileTypeTLK);
+}
+
 void Module::loadTLK() {
 	if (_ifo.getTLK().empty())
 		return;
@@ -597,8 +640,16 @@ void Module::unloadTLK() {
 void Module::loadHAKs() {
 	const std::vector<Common::UString> &haks = _ifo.getHAKs();
 
+	// Parse all HAKs at once, but still index them in priority order
+	ArchiveBatch batch;
 	for (size_t i = 0; i < haks.size(); i++)
-		indexMandatoryArchive(haks[i] + ".hak", 1002 + i, _resHAKs);
+		batch.addMandatory(haks[i] + ".hak", 1002 + i, _resHAKs);
+
+	batch.index();
+
+	// The HAKs might override 2DAs loaded when the engine started
+	if (!haks.empty())
+		TwoDAReg.clear();
 }
 
 void Module::unloadHAKs() {
@@ -623,10 +674,13 @@ void Module::loadTexturePack() {
 	unloadTexturePack();
 
 	status("Loading texture pack %d", level);
-	indexMandatoryArchive(texturePacks[level][0], 400, &_resTP[0]);
-	indexMandatoryArchive(texturePacks[level][1], 401, &_resTP[1]);
-	indexOptionalArchive (texturePacks[level][2], 402, &_resTP[2]);
-	indexOptionalArchive (texturePacks[level][3], 403, &_resTP[3]);
+
+	ArchiveBatch batch;
+	batch.addMandatory(texturePacks[level][0], 400, &_resTP[0]);
+	batch.addMandatory(texturePacks[level][1], 401, &_resTP[1]);
+	batch.addOptional (texturePacks[level][2], 402, &_resTP[2]);
+	batch.addOptional (texturePacks[level][3], 403, &_resTP[3]);
+	batch.index();
 
 	// If we already had a texture pack loaded, reload all textures
 	if (oldTexturePack != -1)
@@ -646,8 +700,17 @@ void Module::loadAreas() {
 	status("Loading areas...");
 
 	const std::vector<Common::UString> &areas = _ifo.getAreas();
+
+	/* Read all area files in the background. While one area creates its
+	 * objects and waits for its models, the next areas' files are already
+	 * on their way. */
+	for (size_t i = 0; i < areas.size(); i++) {
+		ResMan.prefetch(areas[i], Aurora::kFileTypeARE);
+		ResMan.prefetch(areas[i], Aurora::kFileTypeGIT);
+	}
+
 	for (size_t i = 0; i < areas.size(); i++) {
-		status("Loading area \"%s\" (%d / %d)", areas[i].c_str(), (int)i, (int)areas.size() - 1);
+		status("Loading area \"%s\" (%d / %d)", areas[i].c_str(), (int)i + 1, (int)areas.size());
 
 		try {
 			std::pair<AreaMap::iterator, bool> result = _areas.insert(std::make_pair(areas[i], std::make_unique<Area>(*this, areas[i])));
@@ -660,13 +723,52 @@ void Module::loadAreas() {
 	}
 }
 
+void Module::loadBenchmarkArea(Common::UString &area) {
+	if (!_hasModule)
+		throw Common::Exception("Module::loadBenchmarkArea(): Lacking a module?!?");
+
+	if (area.empty())
+		area = _ifo.getEntryArea();
+
+	const std::vector<Common::UString> &areas = _ifo.getAreas();
+
+	std::vector<Common::UString>::const_iterator a = areas.begin();
+	while ((a != areas.end()) && !a->equalsIgnoreCase(area))
+		++a;
+
+	if (a == areas.end())
+		throw Common::Exception("Module \"%s\" has no area \"%s\"", _ifo.getName().getString().c_str(), area.c_str());
+
+	area = *a;
+
+	loadTexturePack();
+
+	try {
+
+		prefetchTLK();
+
+		loadHAKs();
+		loadTLK();
+
+		_currentArea = _areas.insert(std::make_pair(area, std::make_unique<Area>(*this, area))).first->second.get();
+
+	} catch (Common::Exception &e) {
+		e.add("Can't load area \"%s\"", area.c_str());
+		throw e;
+	}
+
+	_currentArea->show();
+}
+
 void Module::loadSurfaceTypes() {
 	_walkableSurfaces.clear();
 
 	const Aurora::TwoDAFile &surfacematTwoDA = TwoDAReg.get2DA("surfacemat");
+	const Aurora::TwoDAColumnHandle walk = surfacematTwoDA.getColumnHandle("Walk");
+
 	for (uint32_t s = 0; s < surfacematTwoDA.getRowCount(); ++s) {
 		const Aurora::TwoDARow &row = surfacematTwoDA.getRow(s);
-		_walkableSurfaces.push_back(static_cast<bool>(row.getInt("Walk")));
+		_walkableSurfaces.push_back(static_cast<bool>(row.getInt(walk)));
 	}
 }
 
@@ -777,7 +879,7 @@ void Module::delayScript(const Common::UString &script,
 	action.triggerer = triggerer;
 	action.timestamp = EventMan.getTimestamp() + delay;
 
-	_delayedActions.insert(action);
+	_delayedActions.schedule(action.timestamp, action);
 }
 
 Common::UString Module::getDescriptionExtra(Common::UString module) {
@@ -27,7 +27,6 @@
 
 #include <list>
 #include <map>
-#include <set>
 #include <memory>
 
 #include "src/common/ustring.h"
@@ -42,6 +41,7 @@
 #include "src/events/types.h"
 
 #include "src/engines/aurora/resources.h"
+#include "src/common/timerwheel.h"
 
 #include "src/engines/nwn/objectcontainer.h"
 #include "src/engines/nwn/object.h"
@@ -82,6 +82,13 @@ public:
 	void usePC(Creature *creature);
 	/** Exit the currently running module. */
 	void exit();
+
+	/** Load the module's resources and only this one area, without a PC and without
+	 *  running any scripts. Used by the load benchmark.
+	 *
+	 *  If no area is given, the module's entry area is loaded.
+	 */
+	void loadBenchmarkArea(Common::UString &area);
 	// '---
 
 	// .--- Information about the current module
@@ -167,14 +174,12 @@ private:
 		Aurora::NWScript::ObjectReference triggerer;
 
 		uint32_t timestamp;
-
-		bool operator<(const Action &s) const;
 	};
 
 	typedef std::map<Common::UString, std::unique_ptr<Area>> AreaMap;
 
 	typedef std::list<Events::Event> EventQueue;
-	typedef std::multiset<Action> ActionQueue;
+	typedef Common::TimerWheel<Action> ActionQueue;
 
 
 	::Engines::Console *_console { nullptr };
@@ -213,6 +218,9 @@ private:
 	EventQueue  _eventQueue;
 	ActionQueue _delayedActions;
 
+	/** Number of instructions a delayed script may run per frame. 0 means unlimited. */
+	size_t _scriptBudget { 0 };
+
 	// Surface types
 	/** A map between surface type and walkability. */
 	std::vector<bool> _walkableSurfaces;
@@ -241,6 +249,7 @@ private:
 	void checkXPs();  ///< Do we have all expansions needed for the module?
 	void checkHAKs(); ///< Do we have all HAKs needed for the module?
 
+	void prefetchTLK();      ///< Start reading the TLK used by the module.
 	void loadTLK();          ///< Load the TLK used by the module.
 	void loadHAKs();         ///< Load the HAKs required by the module.
 	void loadTexturePack();  ///< Load the texture pack.
@@ -265,7 +274,13 @@ private:
 
 	void handleEvents();
 
-	void handleActions();
+	/** Run all delayed actions that are due.
+	 *
+	 *  Unless complete is true, scripts exceeding the script budget are
+	 *  suspended and continued in the next frame.
+	 */
+	void handleActions(bool complete = false);
+	void runDelayedScript(const Action &action, size_t budget);
 };
 
 } // End of namespace NWN
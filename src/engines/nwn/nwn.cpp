@@ -28,9 +28,11 @@
 #include "src/common/filelist.h"
 #include "src/common/filepath.h"
 #include "src/common/configman.h"
+#include "src/common/profiler.h"
 
 #include "src/aurora/util.h"
 #include "src/aurora/resman.h"
+#include "src/aurora/2dareg.h"
 #include "src/aurora/language.h"
 #include "src/aurora/talkman.h"
 #include "src/aurora/talktable_tlk.h"
@@ -57,6 +59,14 @@ namespace Engines {
 
 namespace NWN {
 
+/** The 2DAs used all over the game, loaded in one go when starting. */
+static const char * const k2DAs[] = {
+	"ambientmusic", "ambientsound", "appearance", "classes", "domains", "doortypes", "feat",
+	"gender", "genericdoors", "iprp_abilities", "masterfeats", "packages", "phenotype",
+	"placeableobjsnds", "placeables", "portraits", "racialtypes", "skills", "soundset",
+	"spells", "spellschools", "surfacemat"
+};
+
 NWNEngine::NWNEngine() : _language(Aurora::kLanguageInvalid),
 	_hasXP1(false), _hasXP2(false), _hasXP3(false) {
 
@@ -133,8 +143,31 @@ void NWNEngine::run() {
 	deinit();
 }
 
+void NWNEngine::benchmarkLoad(const Common::UString &module, const Common::UString &area) {
+	init();
+	if (EventMan.quitRequested())
+		return;
+
+	_game = std::make_unique<Game>(*this, *_console, *_version);
+
+	Common::UString loadedArea = area;
+	_game->benchmarkLoad(module, loadedArea);
+
+	finishLoadBenchmark(module, loadedArea);
+
+	deinit();
+}
+
+void NWNEngine::prebake() {
+	init();
+	if (EventMan.quitRequested())
+		return;
+
+	deinit();
+}
+
 void NWNEngine::init() {
-	LoadProgress progress(20);
+	LoadProgress progress(21);
 
 	progress.step("Declare languages");
 	declareLanguages();
@@ -164,6 +197,12 @@ void NWNEngine::init() {
 	progress.step("Loading game cursors");
 	initCursors();
 
+	if (EventMan.quitRequested())
+		return;
+
+	progress.step("Loading 2DAs");
+	init2DAs();
+
 	if (EventMan.quitRequested())
 		return;
 
@@ -211,6 +250,8 @@ void NWNEngine::declareLanguages() {
 }
 
 void NWNEngine::initResources(LoadProgress &progress) {
+	PROFILE_ZONE("NWNEngine::initResources");
+
 	progress.step("Setting base directory");
 	ResMan.registerDataBase(_target);
 
@@ -225,24 +266,26 @@ void NWNEngine::initResources(LoadProgress &progress) {
 	indexMandatoryArchive("chitin.key", 10);
 
 	progress.step("Loading expansions and patch KEYs");
+	ArchiveBatch batch;
 
 	// Base game patch
-	indexOptionalArchive("patch.key", 11);
+	batch.addOptional("patch.key", 11);
 
 	// Expansion 1: Shadows of Undrentide (SoU)
 	_hasXP1 = ResMan.hasArchive("xp1.key");
-	indexOptionalArchive("xp1.key"     , 12);
-	indexOptionalArchive("xp1patch.key", 13);
+	batch.addOptional("xp1.key"     , 12);
+	batch.addOptional("xp1patch.key", 13);
 
 	// Expansion 2: Hordes of the Underdark (HotU)
 	_hasXP2 = ResMan.hasArchive("xp2.key");
-	indexOptionalArchive("xp2.key"     , 14);
-	indexOptionalArchive("xp2patch.key", 15);
+	batch.addOptional("xp2.key"     , 14);
+	batch.addOptional("xp2patch.key", 15);
 
 	// Expansion 3: Kingmaker (resources also included in the final 1.69 patch)
 	_hasXP3 = ResMan.hasArchive("xp3.key");
-	indexOptionalArchive("xp3.key"     , 16);
-	indexOptionalArchive("xp3patch.key", 17);
+	batch.addOptional("xp3.key"     , 16);
+	batch.addOptional("xp3patch.key", 17);
+	batch.index();
 
 	progress.step("Loading GUI textures");
 	indexMandatoryArchive("gui_32bit.erf", 50);
@@ -267,6 +310,8 @@ void NWNEngine::initResources(LoadProgress &progress) {
 	progress.step("Indexing override files");
 	indexOptionalDirectory("override", 0, 0, 500);
 
+	usePrebakedArchive(_target);
+
 	if (EventMan.quitRequested())
 		return;
 
@@ -431,6 +476,10 @@ void NWNEngine::initConfig() {
 	ConfigMan.setBool(Common::kConfigRealmDefault, "mouseoverfeedback", true);
 }
 
+void NWNEngine::init2DAs() {
+	TwoDAReg.warm2DAs(std::vector<Common::UString>(k2DAs, k2DAs + ARRAYSIZE(k2DAs)));
+}
+
 void NWNEngine::initGameConfig() {
 	ConfigMan.setBool(Common::kConfigRealmGameTemp, "NWN_hasXP1", _hasXP1);
 	ConfigMan.setBool(Common::kConfigRealmGameTemp, "NWN_hasXP2", _hasXP2);
@@ -59,6 +59,8 @@ public:
 
 protected:
 	void run();
+	void benchmarkLoad(const Common::UString &module, const Common::UString &area);
+	void prebake();
 
 
 private:
@@ -82,6 +84,7 @@ private:
 	void initResources(LoadProgress &progress);
 	void declareBogusTextures();
 	void initCursors();
+	void init2DAs();
 	void initGameConfig();
 
 	void deinit();
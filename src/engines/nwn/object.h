@@ -66,8 +66,9 @@ public:
 
 	// Basic visuals
 
-	virtual void loadModel();   ///< Load the object's model(s).
-	virtual void unloadModel(); ///< Unload the object's model(s).
+	virtual void prefetchModel(); ///< Start loading the object's model(s) in the background.
+	virtual void loadModel();     ///< Load the object's model(s).
+	virtual void unloadModel();   ///< Unload the object's model(s).
 
 	virtual void show(); ///< Show the object's model(s).
 	virtual void hide(); ///< Hide the object's model(s).
@@ -77,7 +77,7 @@ void ObjectContainer::clearObjects() {
 
 	_objects.clear();
 
-	::Aurora::NWScript::ObjectContainer::clearObjects();
+	eraseObjects();
 
 	unlock();
 }
@@ -85,7 +85,7 @@ void ObjectContainer::clearObjects() {
 void ObjectContainer::addObject(NWN::Object &object) {
 	lock();
 
-	::Aurora::NWScript::ObjectContainer::addObject(object);
+	insertObject(object);
 
 	_objects[object.getType()].push_back(&object);
 
@@ -97,7 +97,7 @@ void ObjectContainer::removeObject(NWN::Object &object) {
 
 	_objects[object.getType()].remove(&object);
 
-	::Aurora::NWScript::ObjectContainer::removeObject(object);
+	eraseObject(object);
 
 	unlock();
 }
@@ -26,6 +26,7 @@
 #include <cassert>
 
 #include <algorithm>
+#include <map>
 
 #include "src/common/ustring.h"
 #include "src/common/streamtokenizer.h"
@@ -35,6 +36,7 @@
 #include "src/aurora/resman.h"
 
 #include "src/engines/aurora/astar.h"
+#include "src/engines/aurora/navigationcache.h"
 #include "src/engines/nwn/walkmeshloader.h"
 #include "src/engines/nwn/pathfinding.h"
 
@@ -60,10 +62,69 @@ Pathfinding::~Pathfinding() {
 }
 
 void Pathfinding::addTile(const Common::UString &wokFile, float *orientation, float *position) {
+	TileSource source;
+	source.wokFile = wokFile;
+	std::copy(orientation, orientation + 4, source.orientation);
+	std::copy(position, position + 3, source.position);
+
+	_tileSources.push_back(source);
+}
+
+void Pathfinding::finalize() {
+	const uint64_t cacheKey = NavigationCache::isEnabled() ? getCacheKey() : 0;
+
+	if (!NavigationCache::isEnabled() || !NavigationCache::load(cacheKey, *this)) {
+		for (std::vector<TileSource>::const_iterator t = _tileSources.begin(); t != _tileSources.end(); ++t)
+			loadTile(*t);
+
+		mergeTiles();
+
+		NavigationCache::save(cacheKey, *this);
+	}
+
+	_tileSources.clear();
+	_tiles.clear();
+
+	flattenAABBTrees();
+	buildPathAbstraction();
+
+	_loaded = true;
+}
+
+uint64_t Pathfinding::getCacheKey() const {
+	uint64_t key = NavigationCache::hash(MKTAG('N', 'W', 'N', ' '));
+
+	// Many tiles share the same walkmesh, so only read each once
+	std::map<Common::UString, uint64_t> wokHashes;
+
+	key = NavigationCache::hash(key, (uint32_t) _tileSources.size());
+	for (std::vector<TileSource>::const_iterator t = _tileSources.begin(); t != _tileSources.end(); ++t) {
+		std::map<Common::UString, uint64_t>::iterator wokHash = wokHashes.find(t->wokFile);
+		if (wokHash == wokHashes.end())
+			wokHash = wokHashes.insert(std::make_pair(t->wokFile,
+				NavigationCache::hashResource(t->wokFile, ::Aurora::kFileTypeWOK))).first;
+
+		key = NavigationCache::hash(key, t->wokFile);
+		key = NavigationCache::hash(key, wokHash->second);
+
+		for (size_t i = 0; i < 4; i++)
+			key = NavigationCache::hash(key, t->orientation[i]);
+		for (size_t i = 0; i < 3; i++)
+			key = NavigationCache::hash(key, t->position[i]);
+	}
+
+	return key;
+}
+
+void Pathfinding::loadTile(const TileSource &source) {
 	Tile tile = Tile();
 	tile.tileId = _tiles.size();
 
-	_walkmeshLoader->load(::Aurora::kFileTypeWOK, wokFile, orientation, position, _vertices,
+	float orientation[4], position[3];
+	std::copy(source.orientation, source.orientation + 4, orientation);
+	std::copy(source.position, source.position + 3, position);
+
+	_walkmeshLoader->load(::Aurora::kFileTypeWOK, source.wokFile, orientation, position, _vertices,
 	                      tile.faces, tile.facesProperty);
 	_facesCount += tile.faces.size() / 3;
 	_verticesCount = _vertices.size() / 3;
@@ -91,7 +152,7 @@ void Pathfinding::addTile(const Common::UString &wokFile, float *orientation, fl
 	}
 }
 
-void Pathfinding::finalize() {
+void Pathfinding::mergeTiles() {
 	// Merge all faces, adjacency and property included.
 	_faces.clear();
 	_adjFaces.clear();
@@ -172,8 +233,6 @@ void Pathfinding::finalize() {
 			}
 		}
 	}
-
-	_loaded = true;
 }
 
 bool Pathfinding::loaded() const {
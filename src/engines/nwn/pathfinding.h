@@ -50,7 +50,11 @@ public:
 
 	/** Add wok tile data. */
 	void addTile(const Common::UString &wokFile, float *orientation, float *position);
-	/** Connect all tiles together. Should be called before any path request. */
+	/** Load and connect all tiles together. Should be called before any path request.
+	 *
+	 *  If the navigation cache is enabled, the connected walkmesh is taken
+	 *  from there instead, when the tiles haven't changed.
+	 */
 	void finalize();
 	/** Is the the walkmesh already loaded and ready to be used? */
 	bool loaded() const;
@@ -77,6 +81,13 @@ private:
 		bool operator<(const Face &face) const;
 	};
 
+	/** Where a tile's walkmesh comes from. */
+	struct TileSource {
+		Common::UString wokFile;
+		float orientation[4];
+		float position[3];
+	};
+
 	/** Structure used to connect the tiles together. */
 	struct Tile {
 		uint32_t tileId;
@@ -91,6 +102,13 @@ private:
 		std::vector<Face> borderTop;
 	};
 
+	/** Load a tile's walkmesh and connect it to the tiles loaded before. */
+	void loadTile(const TileSource &source);
+	/** Merge the faces of all loaded tiles into the walkmesh. */
+	void mergeTiles();
+	/** Compute the navigation cache key of the added tiles. */
+	uint64_t getCacheKey() const;
+
 	/** Find face adjacencies between two tiles and make all border faces match an other face. */
 	void connectTiles(uint32_t tileA, uint32_t tileB, bool yAxis, float axisPosition);
 	/** Find face adjacencies within a tile. */
@@ -110,6 +128,8 @@ private:
 	std::vector<uint32_t> _startVertex; ///< Starting index of the vertex for each tiles.
 	std::vector<Tile> _tiles;           ///< Tiles of the area.
 
+	std::vector<TileSource> _tileSources; ///< Tiles added, but not yet loaded.
+
 	WalkmeshLoader *_walkmeshLoader;  ///< Walkmesh loader.
 };
 
@@ -50,6 +50,13 @@ Situated::Situated(ObjectType type) : Object(type), _appearanceID(Aurora::kField
 Situated::~Situated() {
 }
 
+void Situated::prefetchModel() {
+	if (_model || !_pendingModel.empty())
+		return;
+
+	_pendingModel = loadModelObjectAsync(_modelName);
+}
+
 void Situated::loadModel() {
 	if (_model)
 		return;
@@ -59,7 +66,11 @@ void Situated::loadModel() {
 		return;
 	}
 
-	_model.reset(loadModelObject(_modelName));
+	if (!_pendingModel.empty())
+		_model.reset(_pendingModel.take());
+	else
+		_model.reset(loadModelObject(_modelName));
+
 	if (!_model)
 		throw Common::Exception("Failed to load situated object model \"%s\"",
 		                        _modelName.c_str());
@@ -87,6 +98,7 @@ void Situated::unloadModel() {
 
 	destroyTooltip();
 
+	_pendingModel = PendingModel();
 	_model.reset();
 }
 
@@ -24,7 +24,7 @@
 
 #include "src/common/util.h"
 #include "src/common/error.h"
-#include "src/common/configman.h"
+#include "src/common/configvalue.h"
 
 #include "src/aurora/gff3file.h"
 #include "src/aurora/2dafile.h"
@@ -57,6 +57,8 @@ namespace Engines {
 
 namespace NWN2 {
 
+static const Common::ConfigValue<bool> kConfigTint("tint", true);
+
 Area::Area(Module &module, const Common::UString &resRef) : Object(kObjectTypeArea),
 	_module(&module), _resRef(resRef), _visible(false),
 	_activeObject(0), _highlightAll(false) {
@@ -487,7 +489,7 @@ void Area::loadTileModels() {
 				throw Common::Exception("Can't load tile model \"%s\"", t->modelName.c_str());
 
 		// Tinting
-		if (ConfigMan.getBool("tint")) {
+		if (kConfigTint.get()) {
 			dynamic_cast<Graphics::Aurora::Model_NWN2 &>(*t->model).setTintFloor(t->floorTint);
 			dynamic_cast<Graphics::Aurora::Model_NWN2 &>(*t->model).setTintWalls(t->wallTint);
 		}
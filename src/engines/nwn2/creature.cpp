@@ -130,6 +130,8 @@ void Creature::init() {
 
 	for (size_t i = 0; i < kSkillMAX; i++)
 		_ranks[i] = 0;
+
+	invalidateDerivedStats();
 }
 
 void Creature::show() {
@@ -605,6 +607,10 @@ void Creature::loadProperties(const Aurora::GFF3Struct &gff) {
 	 */
 	loadSkills(gff, _ranks);
 
+	// Feat requirements and derived stats depend on the abilities, levels and skill ranks
+	_feats->clearRequirementsCache();
+	invalidateDerivedStats();
+
 	// Listening patterns
 	loadListenPatterns(gff);
 
@@ -802,7 +808,9 @@ uint8_t Creature::getAbility(Ability ability) const {
 int8_t Creature::getAbilityModifier(Ability ability) const {
 	assert((ability >= 0) && (ability < kAbilityMAX));
 
-	return floor((_abilities[ability] - 10) / 2);
+	updateDerivedStats();
+
+	return _derivedStats.abilityModifiers[ability];
 }
 
 /** Return true if skill is valid and useable */
@@ -842,6 +850,41 @@ int8_t Creature::getSkillRank(uint32_t skill, bool baseOnly) const {
 	if (baseOnly)
 		return _ranks[skill];
 
+	updateDerivedStats();
+
+	int modArea = 0;
+
+	// Add custom feat modifiers
+	switch (skill) {
+		case kSkillSearch:
+			// Nature sense: +2 while in natural area
+			if (_feats->getHasCustomFeat(Feats::kCustomNatureSense))
+				if (getArea()->getIsAreaNatural())
+					modArea += 2;
+
+			// Stonecunning: +2 while in interior area
+			if (_feats->getHasCustomFeat(Feats::kCustomStonecunning))
+				if (getArea()->getIsAreaInterior())
+					modArea += 2;
+			break;
+		case kSkillSpot:
+			// Nature sense: +2 while in natural area
+			if (_feats->getHasCustomFeat(Feats::kCustomNatureSense))
+				if (getArea()->getIsAreaNatural())
+					modArea += 2;
+			break;
+		default:
+			break;
+	}
+
+	return _derivedStats.skillRanks[skill] + modArea;
+}
+
+int Creature::computeSkillRank(uint32_t skill) const {
+	assert(skill < kSkillMAX);
+
+	// Needs the ability modifiers to be up to date
+
 	// Check for skill synergies
 	int modSynergy = 0;
 	switch (skill) {
@@ -874,11 +917,11 @@ int8_t Creature::getSkillRank(uint32_t skill, bool baseOnly) const {
 		case kSkillSleightOfHand:
 		case kSkillTumble:
 			// Dexterity skills
-			modAbility = getAbilityModifier(kAbilityDexterity);
+			modAbility = _derivedStats.abilityModifiers[kAbilityDexterity];
 			break;
 		case kSkillConcentration:
 			// Constitution skills
-			modAbility = getAbilityModifier(kAbilityConstitution);
+			modAbility = _derivedStats.abilityModifiers[kAbilityConstitution];
 			break;
 		case kSkillAppraise:
 		case kSkillCraftAlchemy:
@@ -889,14 +932,14 @@ int8_t Creature::getSkillRank(uint32_t skill, bool baseOnly) const {
 		case kSkillSearch:
 		case kSkillSpellcraft:
 			// Intelligence skills
-			modAbility = getAbilityModifier(kAbilityIntelligence);
+			modAbility = _derivedStats.abilityModifiers[kAbilityIntelligence];
 			break;
 		case kSkillHeal:
 		case kSkillListen:
 		case kSkillSpot:
 		case kSkillSurvival:
 			// Wisdom skills
-			modAbility = getAbilityModifier(kAbilityWisdom);
+			modAbility = _derivedStats.abilityModifiers[kAbilityWisdom];
 			break;
 		case kSkillBluff:
 		case kSkillDiplomacy:
@@ -905,42 +948,36 @@ int8_t Creature::getSkillRank(uint32_t skill, bool baseOnly) const {
 		case kSkillTaunt:
 		case kSkillUseMagicDevice:
 			// Charisma skills
-			modAbility = getAbilityModifier(kAbilityCharisma);
+			modAbility = _derivedStats.abilityModifiers[kAbilityCharisma];
 			break;
 		default:
 			break;
 	}
 
 	// Get the cumulative feats skill modifier
-	int modFeats = _feats->getFeatsSkillBonus(skill);
-
-	// Add custom feat modifiers
-	switch (skill) {
-		case kSkillSearch:
-			// Nature sense: +2 while in natural area
-			if (_feats->getHasCustomFeat(Feats::kCustomNatureSense))
-				if (getArea()->getIsAreaNatural())
-					modFeats += 2;
-
-			// Stonecunning: +2 while in interior area
-			if (_feats->getHasCustomFeat(Feats::kCustomStonecunning))
-				if (getArea()->getIsAreaInterior())
-					modFeats += 2;
-			break;
-		case kSkillSpot:
-			// Nature sense: +2 while in natural area
-			if (_feats->getHasCustomFeat(Feats::kCustomNatureSense))
-				if (getArea()->getIsAreaNatural())
-					modFeats += 2;
-			break;
-		default:
-			break;
-	}
+	int modFeats = _feats ? _feats->getFeatsSkillBonus(skill) : 0;
 
 	// Return the modified ranks
 	return _ranks[skill] + modSynergy + modAbility + modFeats;
 }
 
+void Creature::invalidateDerivedStats() {
+	_derivedStats.valid = false;
+}
+
+void Creature::updateDerivedStats() const {
+	if (_derivedStats.valid)
+		return;
+
+	for (size_t i = 0; i < kAbilityMAX; i++)
+		_derivedStats.abilityModifiers[i] = floor((_abilities[i] - 10) / 2);
+
+	for (size_t i = 0; i < kSkillMAX; i++)
+		_derivedStats.skillRanks[i] = computeSkillRank(i);
+
+	_derivedStats.valid = true;
+}
+
 bool Creature::hasFeat(uint32_t feat) const {
 	return _feats->getHasFeat(feat);
 }
@@ -953,6 +990,9 @@ bool Creature::featAdd(uint32_t feat, bool checkRequirements) {
 
 	// Add feat at the current hit dice
 	_feats->featAdd(feat, getHitDice());
+
+	// Feats modify skill ranks
+	invalidateDerivedStats();
 	return true;
 }
 
@@ -235,6 +235,20 @@ private:
 
 	uint8_t _ranks[kSkillMAX]; ///< Total skill ranks across levels.
 
+	/** Stats derived from the abilities, skill ranks and feats.
+	 *
+	 *  Computed all at once when first needed, and again after any of
+	 *  their sources changed.
+	 */
+	struct DerivedStats {
+		bool valid;
+
+		int8_t abilityModifiers[kAbilityMAX]; ///< Ability modifiers.
+		int8_t skillRanks[kSkillMAX];         ///< Skill ranks, without bonuses that depend on the area.
+	};
+
+	mutable DerivedStats _derivedStats;
+
 	uint8_t _hitDice; ///< The creature's hit dice.
 
 	Common::UString _deity; ///< The creature's deity.
@@ -294,6 +308,16 @@ private:
 	/** Load the listening patterns. */
 	void loadListenPatterns(const Aurora::GFF3Struct &gff);
 
+	// Derived stats
+
+	/** Recompute the derived stats on the next request. */
+	void invalidateDerivedStats();
+	/** Make sure the derived stats are up to date. */
+	void updateDerivedStats() const;
+
+	/** Compute the skill rank, without bonuses that depend on the area. */
+	int computeSkillRank(uint32_t skill) const;
+
 	// Model loaders
 
 	Common::UString getBaseModel(const Common::UString &base);
@@ -47,6 +47,9 @@ Feats::~Feats() {
 /** Clear all feat information and reset the modifiers */
 void Feats::clear() {
 	_feats.clear();
+	_hasFeat.clear();
+
+	clearRequirementsCache();
 	initParameters();
 }
 
@@ -57,6 +60,14 @@ void Feats::featAdd(const uint32_t id, uint16_t level) {
 	feat.level = level;
 
 	_feats.push_back(feat);
+
+	if (id >= _hasFeat.size())
+		_hasFeat.resize(id + 1, false);
+	_hasFeat[id] = true;
+
+	// Feats can be prerequisites of other feats
+	clearRequirementsCache();
+
 	applyFeat(id);
 }
 
@@ -72,6 +83,14 @@ void Feats::featRemove(const uint32_t id, uint16_t maxLevel) {
 			// Found a match, so remove it
 			_feats.erase(it);
 
+			// The same feat might have been added more than once
+			_hasFeat[id] = false;
+			for (std::vector<Feat>::const_iterator f = _feats.begin(); f != _feats.end(); ++f)
+				if (f->id == id)
+					_hasFeat[id] = true;
+
+			clearRequirementsCache();
+
 			// Rebuild the data
 			resetFeats(maxLevel);
 			break;
@@ -85,13 +104,16 @@ void Feats::featRemove(const uint32_t id, uint16_t maxLevel) {
  * zero, ignore the level limit.
  */
 bool Feats::getHasFeat(uint32_t id, uint16_t maxLevel) const {
-	bool ignoreLimit = (maxLevel == 0);
+	if ((id >= _hasFeat.size()) || !_hasFeat[id])
+		return false;
 
-	// Look for a matching feat
+	if (maxLevel == 0)
+		return true;
+
+	// Look for a matching feat within the level limit
 	for (std::vector<Feat>::const_iterator it = _feats.begin(); it != _feats.end(); ++it)
-		if (ignoreLimit || (it->level <= maxLevel))
-			if (it->id == id)
-				return true;
+		if ((it->id == id) && (it->level <= maxLevel))
+			return true;
 
 	return false;
 }
@@ -139,8 +161,35 @@ bool Feats::getHasCustomFeat(Custom feat) const {
 	return _hasCustomFeat[feat];
 }
 
-/** Return true only if the creature satisfies the feat requirements */
+/**
+ * Return true only if the creature satisfies the feat requirements.
+ * The result is remembered until the creature's feats change, or
+ * until clearRequirementsCache() is called.
+ */
 bool Feats::meetsRequirements(const Creature &creature, uint32_t id) const {
+	if ((id < _requirementsChecked.size()) && _requirementsChecked[id])
+		return _requirementsMet[id];
+
+	const bool met = checkRequirements(creature, id);
+
+	if (id >= _requirementsChecked.size()) {
+		_requirementsChecked.resize(id + 1, false);
+		_requirementsMet.resize(id + 1, false);
+	}
+
+	_requirementsChecked[id] = true;
+	_requirementsMet[id]     = met;
+
+	return met;
+}
+
+void Feats::clearRequirementsCache() {
+	_requirementsChecked.clear();
+	_requirementsMet.clear();
+}
+
+/** Evaluate the feat requirements from feat.2da */
+bool Feats::checkRequirements(const Creature &creature, uint32_t id) const {
 	static const Common::UString kFeatMinCols[] = {"MINSTR", "MINDEX", "MINCON", "MININT", "MINWIS", "MINCHA"};
 	static const Common::UString kFeatMaxCols[] = {"MAXSTR", "MAXDEX", "MAXCON", "MAXINT", "MAXWIS", "MAXCHA"};
 	static const Common::UString kFeatOrReq[] = {"OrReqFeat0", "OrReqFeat1", "OrReqFeat2", "OrReqFeat3", "OrReqFeat4", "OrReqFeat5"};
@@ -25,6 +25,10 @@
 #ifndef ENGINES_NWN2_FEATS_H
 #define ENGINES_NWN2_FEATS_H
 
+#include <vector>
+
+#include "src/common/types.h"
+
 namespace Engines {
 
 namespace NWN2 {
@@ -66,15 +70,29 @@ public:
 
 	bool meetsRequirements(const Creature &creature, uint32_t id) const;
 
+	/**
+	 * Forget the remembered results of meetsRequirements().
+	 * Needs to be called whenever the creature's levels,
+	 * abilities or skill ranks change.
+	 */
+	void clearRequirementsCache();
+
 private:
 	struct Feat {
 		uint32_t id;
 		uint16_t level;
 	};
 
-	// List of included feats
+	// List of included feats, with the level they were gained at
 	std::vector<Feat> _feats;
 
+	// Which feats are included, indexed by feat ID
+	std::vector<bool> _hasFeat;
+
+	// Remembered results of meetsRequirements(), indexed by feat ID
+	mutable std::vector<bool> _requirementsChecked;
+	mutable std::vector<bool> _requirementsMet;
+
 	// Passive stackable modifiers
 	int _skillBonus[kSkillMAX];
 	int _saveVsBonus[kSaveMAX];
@@ -91,6 +109,8 @@ private:
 	void initParameters();
 	void resetFeats(uint16_t maxLevel = 0);
 	void applyFeat(const uint32_t id);
+
+	bool checkRequirements(const Creature &creature, uint32_t id) const;
 };
 
 } // End of namespace NWN2
@@ -87,6 +87,9 @@ ItemProperty *Item::getNextItemProperty() {
 }
 
 bool Item::getItemHasItemProperty(ItemPropertyType property) const {
+	if ((property >= 0) && (property < kItemPropertyMAX))
+		return _itemPropertyTypes.test(property);
+
 	auto it = std::find_if(_itemProperties.begin(), _itemProperties.end(), [&](const ItemProperty &x) {
 		return x.getItemPropertyType() == property;
 	});
@@ -284,6 +287,13 @@ void Item::loadItemProperties(const Aurora::GFF3Struct &gff) {
 	_itemProperties.reserve(count);
 	for (const Aurora::GFF3Struct *prop : iprp)
 		_itemProperties.emplace_back(*prop);
+
+	_itemPropertyTypes.reset();
+	for (const ItemProperty &prop : _itemProperties) {
+		const ItemPropertyType type = prop.getItemPropertyType();
+		if ((type >= 0) && (type < kItemPropertyMAX))
+			_itemPropertyTypes.set(type);
+	}
 }
 
 } // End of namespace NWN2
@@ -26,6 +26,7 @@
 #define ENGINES_NWN2_ITEM_H
 
 #include <vector>
+#include <bitset>
 
 #include "src/engines/nwn2/types.h"
 #include "src/engines/nwn2/object.h"
@@ -100,6 +101,9 @@ private:
 
 	ItemProperties _itemProperties; ///< The item's properties.
 
+	/** The types of all the item's properties, for quick lookups. */
+	std::bitset<kItemPropertyMAX> _itemPropertyTypes;
+
 	/* Load from an item instance. */
 	void load(const Aurora::GFF3Struct &item);
 	void load(const Common::UString &blueprint, uint16_t stackSize, const Common::UString &tag);
@@ -221,103 +221,109 @@ void NWN2Engine::initResources(LoadProgress &progress) {
 
 	progress.step("Loading main resource files");
 
-	indexMandatoryArchive("2da.zip"           , 10);
-	indexMandatoryArchive("actors.zip"        , 11);
-	indexMandatoryArchive("animtags.zip"      , 12);
-	indexMandatoryArchive("convo.zip"         , 13);
-	indexMandatoryArchive("ini.zip"           , 14);
-	indexMandatoryArchive("lod-merged.zip"    , 15);
-	indexMandatoryArchive("music.zip"         , 16);
-	indexMandatoryArchive("nwn2_materials.zip", 17);
-	indexMandatoryArchive("nwn2_models.zip"   , 18);
-	indexMandatoryArchive("nwn2_vfx.zip"      , 19);
-	indexMandatoryArchive("prefabs.zip"       , 20);
-	indexMandatoryArchive("scripts.zip"       , 21);
-	indexMandatoryArchive("sounds.zip"        , 22);
-	indexMandatoryArchive("soundsets.zip"     , 23);
-	indexMandatoryArchive("speedtree.zip"     , 24);
-	indexMandatoryArchive("templates.zip"     , 25);
-	indexMandatoryArchive("vo.zip"            , 26);
-	indexMandatoryArchive("walkmesh.zip"      , 27);
+	ArchiveBatch batch;
+
+	batch.addMandatory("2da.zip"           , 10);
+	batch.addMandatory("actors.zip"        , 11);
+	batch.addMandatory("animtags.zip"      , 12);
+	batch.addMandatory("convo.zip"         , 13);
+	batch.addMandatory("ini.zip"           , 14);
+	batch.addMandatory("lod-merged.zip"    , 15);
+	batch.addMandatory("music.zip"         , 16);
+	batch.addMandatory("nwn2_materials.zip", 17);
+	batch.addMandatory("nwn2_models.zip"   , 18);
+	batch.addMandatory("nwn2_vfx.zip"      , 19);
+	batch.addMandatory("prefabs.zip"       , 20);
+	batch.addMandatory("scripts.zip"       , 21);
+	batch.addMandatory("sounds.zip"        , 22);
+	batch.addMandatory("soundsets.zip"     , 23);
+	batch.addMandatory("speedtree.zip"     , 24);
+	batch.addMandatory("templates.zip"     , 25);
+	batch.addMandatory("vo.zip"            , 26);
+	batch.addMandatory("walkmesh.zip"      , 27);
+	batch.index();
 
 	progress.step("Loading expansion 1 resource files");
 
 	// Expansion 1: Mask of the Betrayer (MotB)
 	_hasXP1 = ResMan.hasArchive("2da_x1.zip");
-	indexOptionalArchive("2da_x1.zip"           , 50);
-	indexOptionalArchive("actors_x1.zip"        , 51);
-	indexOptionalArchive("animtags_x1.zip"      , 52);
-	indexOptionalArchive("convo_x1.zip"         , 53);
-	indexOptionalArchive("ini_x1.zip"           , 54);
-	indexOptionalArchive("lod-merged_x1.zip"    , 55);
-	indexOptionalArchive("music_x1.zip"         , 56);
-	indexOptionalArchive("nwn2_materials_x1.zip", 57);
-	indexOptionalArchive("nwn2_models_x1.zip"   , 58);
-	indexOptionalArchive("nwn2_vfx_x1.zip"      , 59);
-	indexOptionalArchive("prefabs_x1.zip"       , 60);
-	indexOptionalArchive("scripts_x1.zip"       , 61);
-	indexOptionalArchive("soundsets_x1.zip"     , 62);
-	indexOptionalArchive("sounds_x1.zip"        , 63);
-	indexOptionalArchive("speedtree_x1.zip"     , 64);
-	indexOptionalArchive("templates_x1.zip"     , 65);
-	indexOptionalArchive("vo_x1.zip"            , 66);
-	indexOptionalArchive("walkmesh_x1.zip"      , 67);
+	batch.addOptional("2da_x1.zip"           , 50);
+	batch.addOptional("actors_x1.zip"        , 51);
+	batch.addOptional("animtags_x1.zip"      , 52);
+	batch.addOptional("convo_x1.zip"         , 53);
+	batch.addOptional("ini_x1.zip"           , 54);
+	batch.addOptional("lod-merged_x1.zip"    , 55);
+	batch.addOptional("music_x1.zip"         , 56);
+	batch.addOptional("nwn2_materials_x1.zip", 57);
+	batch.addOptional("nwn2_models_x1.zip"   , 58);
+	batch.addOptional("nwn2_vfx_x1.zip"      , 59);
+	batch.addOptional("prefabs_x1.zip"       , 60);
+	batch.addOptional("scripts_x1.zip"       , 61);
+	batch.addOptional("soundsets_x1.zip"     , 62);
+	batch.addOptional("sounds_x1.zip"        , 63);
+	batch.addOptional("speedtree_x1.zip"     , 64);
+	batch.addOptional("templates_x1.zip"     , 65);
+	batch.addOptional("vo_x1.zip"            , 66);
+	batch.addOptional("walkmesh_x1.zip"      , 67);
+	batch.index();
 
 	progress.step("Loading expansion 2 resource files");
 
 	// Expansion 2: Storm of Zehir (SoZ)
 	_hasXP2 = ResMan.hasArchive("2da_x2.zip");
-	indexOptionalArchive("2da_x2.zip"           , 100);
-	indexOptionalArchive("actors_x2.zip"        , 101);
-	indexOptionalArchive("animtags_x2.zip"      , 102);
-	indexOptionalArchive("lod-merged_x2.zip"    , 103);
-	indexOptionalArchive("music_x2.zip"         , 104);
-	indexOptionalArchive("nwn2_materials_x2.zip", 105);
-	indexOptionalArchive("nwn2_models_x2.zip"   , 106);
-	indexOptionalArchive("nwn2_vfx_x2.zip"      , 107);
-	indexOptionalArchive("prefabs_x2.zip"       , 108);
-	indexOptionalArchive("scripts_x2.zip"       , 109);
-	indexOptionalArchive("soundsets_x2.zip"     , 110);
-	indexOptionalArchive("sounds_x2.zip"        , 111);
-	indexOptionalArchive("speedtree_x2.zip"     , 112);
-	indexOptionalArchive("templates_x2.zip"     , 113);
-	indexOptionalArchive("vo_x2.zip"            , 114);
+	batch.addOptional("2da_x2.zip"           , 100);
+	batch.addOptional("actors_x2.zip"        , 101);
+	batch.addOptional("animtags_x2.zip"      , 102);
+	batch.addOptional("lod-merged_x2.zip"    , 103);
+	batch.addOptional("music_x2.zip"         , 104);
+	batch.addOptional("nwn2_materials_x2.zip", 105);
+	batch.addOptional("nwn2_models_x2.zip"   , 106);
+	batch.addOptional("nwn2_vfx_x2.zip"      , 107);
+	batch.addOptional("prefabs_x2.zip"       , 108);
+	batch.addOptional("scripts_x2.zip"       , 109);
+	batch.addOptional("soundsets_x2.zip"     , 110);
+	batch.addOptional("sounds_x2.zip"        , 111);
+	batch.addOptional("speedtree_x2.zip"     , 112);
+	batch.addOptional("templates_x2.zip"     , 113);
+	batch.addOptional("vo_x2.zip"            , 114);
+	batch.index();
 
 	// Expansion 3: Mysteries of Westgate
 	_hasXP3 = ResMan.hasArchive("westgate.hak");
 
 	progress.step("Loading patch resource files");
 
-	indexOptionalArchive("actors_v103x1.zip"         , 150);
-	indexOptionalArchive("actors_v106.zip"           , 151);
-	indexOptionalArchive("lod-merged_v101.zip"       , 152);
-	indexOptionalArchive("lod-merged_v107.zip"       , 153);
-	indexOptionalArchive("lod-merged_v121.zip"       , 154);
-	indexOptionalArchive("lod-merged_x1_v121.zip"    , 155);
-	indexOptionalArchive("lod-merged_x2_v121.zip"    , 156);
-	indexOptionalArchive("nwn2_materials_v103x1.zip" , 157);
-	indexOptionalArchive("nwn2_materials_v104.zip"   , 158);
-	indexOptionalArchive("nwn2_materials_v106.zip"   , 159);
-	indexOptionalArchive("nwn2_materials_v107.zip"   , 160);
-	indexOptionalArchive("nwn2_materials_v110.zip"   , 161);
-	indexOptionalArchive("nwn2_materials_v112.zip"   , 162);
-	indexOptionalArchive("nwn2_materials_v121.zip"   , 163);
-	indexOptionalArchive("nwn2_materials_x1_v113.zip", 164);
-	indexOptionalArchive("nwn2_materials_x1_v121.zip", 165);
-	indexOptionalArchive("nwn2_models_v103x1.zip"    , 166);
-	indexOptionalArchive("nwn2_models_v104.zip"      , 167);
-	indexOptionalArchive("nwn2_models_v105.zip"      , 168);
-	indexOptionalArchive("nwn2_models_v106.zip"      , 169);
-	indexOptionalArchive("nwn2_models_v107.zip"      , 160);
-	indexOptionalArchive("nwn2_models_v112.zip"      , 171);
-	indexOptionalArchive("nwn2_models_v121.zip"      , 172);
-	indexOptionalArchive("nwn2_models_x1_v121.zip"   , 173);
-	indexOptionalArchive("nwn2_models_x2_v121.zip"   , 174);
-	indexOptionalArchive("templates_v112.zip"        , 175);
-	indexOptionalArchive("templates_v122.zip"        , 176);
-	indexOptionalArchive("templates_x1_v122.zip"     , 177);
-	indexOptionalArchive("vo_103x1.zip"              , 178);
-	indexOptionalArchive("vo_106.zip"                , 179);
+	batch.addOptional("actors_v103x1.zip"         , 150);
+	batch.addOptional("actors_v106.zip"           , 151);
+	batch.addOptional("lod-merged_v101.zip"       , 152);
+	batch.addOptional("lod-merged_v107.zip"       , 153);
+	batch.addOptional("lod-merged_v121.zip"       , 154);
+	batch.addOptional("lod-merged_x1_v121.zip"    , 155);
+	batch.addOptional("lod-merged_x2_v121.zip"    , 156);
+	batch.addOptional("nwn2_materials_v103x1.zip" , 157);
+	batch.addOptional("nwn2_materials_v104.zip"   , 158);
+	batch.addOptional("nwn2_materials_v106.zip"   , 159);
+	batch.addOptional("nwn2_materials_v107.zip"   , 160);
+	batch.addOptional("nwn2_materials_v110.zip"   , 161);
+	batch.addOptional("nwn2_materials_v112.zip"   , 162);
+	batch.addOptional("nwn2_materials_v121.zip"   , 163);
+	batch.addOptional("nwn2_materials_x1_v113.zip", 164);
+	batch.addOptional("nwn2_materials_x1_v121.zip", 165);
+	batch.addOptional("nwn2_models_v103x1.zip"    , 166);
+	batch.addOptional("nwn2_models_v104.zip"      , 167);
+	batch.addOptional("nwn2_models_v105.zip"      , 168);
+	batch.addOptional("nwn2_models_v106.zip"      , 169);
+	batch.addOptional("nwn2_models_v107.zip"      , 160);
+	batch.addOptional("nwn2_models_v112.zip"      , 171);
+	batch.addOptional("nwn2_models_v121.zip"      , 172);
+	batch.addOptional("nwn2_models_x1_v121.zip"   , 173);
+	batch.addOptional("nwn2_models_x2_v121.zip"   , 174);
+	batch.addOptional("templates_v112.zip"        , 175);
+	batch.addOptional("templates_v122.zip"        , 176);
+	batch.addOptional("templates_x1_v122.zip"     , 177);
+	batch.addOptional("vo_103x1.zip"              , 178);
+	batch.addOptional("vo_106.zip"                , 179);
+	batch.index();
 
 	progress.step("Indexing extra sound resources");
 	indexMandatoryDirectory("ambient"   , 0,  0, 200);
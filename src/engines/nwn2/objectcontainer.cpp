@@ -81,7 +81,7 @@ void ObjectContainer::clearObjects() {
 
 	_objects.clear();
 
-	::Aurora::NWScript::ObjectContainer::clearObjects();
+	eraseObjects();
 
 	unlock();
 }
@@ -89,7 +89,7 @@ void ObjectContainer::clearObjects() {
 void ObjectContainer::addObject(NWN2::Object &object) {
 	lock();
 
-	::Aurora::NWScript::ObjectContainer::addObject(object);
+	insertObject(object);
 
 	_objects[object.getType()].push_back(&object);
 
@@ -101,7 +101,7 @@ void ObjectContainer::removeObject(NWN2::Object &object) {
 
 	_objects[object.getType()].remove(&object);
 
-	::Aurora::NWScript::ObjectContainer::removeObject(object);
+	eraseObject(object);
 
 	unlock();
 }
@@ -25,7 +25,7 @@
 #include "src/common/error.h"
 #include "src/common/maths.h"
 #include "src/common/util.h"
-#include "src/common/configman.h"
+#include "src/common/configvalue.h"
 
 #include "src/aurora/gff3file.h"
 #include "src/aurora/2dafile.h"
@@ -44,6 +44,8 @@ namespace Engines {
 
 namespace NWN2 {
 
+static const Common::ConfigValue<bool> kConfigTint("tint", true);
+
 Situated::Situated(ObjectType type) : Object(type), _appearanceID(Aurora::kFieldIDInvalid),
 	_soundAppType(Aurora::kFieldIDInvalid), _locked(false),
 	_lockable(false), _keyRequired(false), _autoRemove(false),
@@ -74,7 +76,7 @@ void Situated::loadModel() {
 		                        _modelName.c_str());
 
 	// Tinting
-	if (ConfigMan.getBool("tint"))
+	if (kConfigTint.get())
 		dynamic_cast<Graphics::Aurora::Model_NWN2 &>(*_model).setTint(_tint);
 
 	// Positioning
@@ -22,13 +22,19 @@
  *  Loader for Neverwinter Nights 2 baked terrain files (TRX).
  */
 
+#include <cstring>
+#include <cfloat>
 #include <memory>
+#include <vector>
+#include <unordered_map>
 
+#include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/readstream.h"
 #include "src/common/encoding.h"
 #include "src/common/ustring.h"
 #include "src/common/strutil.h"
+#include "src/common/boundingbox.h"
 
 #include "src/aurora/resman.h"
 
@@ -44,6 +50,11 @@ namespace Engines {
 
 namespace NWN2 {
 
+/** Number of coarser levels of detail created for each terrain and water tile. */
+static const size_t kLODCount = 3;
+/** Number of grid cells along a tile's larger side, for the first coarser level of detail. */
+static const float kLODCells = 16.0f;
+
 TRXFile::TRXFile(const Common::UString &resRef) : _visible(false) {
 	try {
 		std::unique_ptr<Common::SeekableReadStream> trx(ResMan.getResource(resRef, Aurora::kFileTypeTRX));
@@ -240,7 +251,7 @@ void TRXFile::loadTRRN(Common::SeekableReadStream &trx, Packet &packet) {
 	 *   - Grass    grass
 	 */
 
-	_terrain.emplace_back(std::make_unique<Graphics::Aurora::GeometryObject>(vBuf, iBuf));
+	_terrain.emplace_back(createTile(vBuf, iBuf));
 }
 
 void TRXFile::loadWATR(Common::SeekableReadStream &trx, Packet &packet) {
@@ -316,12 +327,121 @@ void TRXFile::loadWATR(Common::SeekableReadStream &trx, Packet &packet) {
 	 *   - uint32_t  tileY
 	 */
 
-	_water.emplace_back(std::make_unique<Graphics::Aurora::GeometryObject>(vBuf, iBuf));
+	_water.emplace_back(createTile(vBuf, iBuf));
 }
 
 void TRXFile::loadASWM(Common::SeekableReadStream &UNUSED(trx), Packet &UNUSED(packet)) {
 }
 
+Graphics::Aurora::GeometryObject *TRXFile::createTile(const Graphics::VertexBuffer &vBuf,
+                                                      const Graphics::IndexBuffer &iBuf) {
+
+	std::unique_ptr<Graphics::Aurora::GeometryObject> tile =
+		std::make_unique<Graphics::Aurora::GeometryObject>(vBuf, iBuf);
+
+	Common::BoundingBox bound;
+	if (!tile->getWorldBound(bound))
+		return tile.release();
+
+	const float size = MAX(bound.getWidth(), bound.getHeight());
+	if (size <= 0.0f)
+		return tile.release();
+
+	/* Each level halves the grid resolution, and kicks in at twice the distance
+	 * of the previous one. The first level is used once the camera is at least
+	 * a tile's size away from the tile. */
+	Graphics::IndexBuffer faces = iBuf;
+	for (size_t i = 0; i < kLODCount; i++) {
+		Graphics::IndexBuffer lod;
+		if (!simplifyTile(vBuf, faces, size / (kLODCells / (1 << i)), lod))
+			break;
+
+		tile->addLOD(lod, size * (1 << i));
+		faces = lod;
+	}
+
+	return tile.release();
+}
+
+bool TRXFile::simplifyTile(const Graphics::VertexBuffer &vBuf, const Graphics::IndexBuffer &iBuf,
+                           float cellSize, Graphics::IndexBuffer &lod) {
+
+	const uint32_t vCount = vBuf.getCount();
+	const uint32_t fCount = iBuf.getCount() / 3;
+	if ((vCount == 0) || (fCount == 0) || (cellSize <= 0.0f))
+		return false;
+
+	// The position is the first vertex attribute
+	const byte  *vertices = reinterpret_cast<const byte *>(vBuf.getData());
+	const size_t stride   = vBuf.getSize();
+
+	float minX =  FLT_MAX, minY =  FLT_MAX;
+	float maxX = -FLT_MAX, maxY = -FLT_MAX;
+	for (uint32_t i = 0; i < vCount; i++) {
+		const float *v = reinterpret_cast<const float *>(vertices + i * stride);
+
+		minX = MIN(minX, v[0]);
+		minY = MIN(minY, v[1]);
+		maxX = MAX(maxX, v[0]);
+		maxY = MAX(maxY, v[1]);
+	}
+
+	const float epsilon = cellSize * 0.01f;
+
+	// Map each vertex onto the first vertex found in its grid cell
+	std::vector<uint16_t> remap(vCount);
+	std::unordered_map<uint64_t, uint16_t> cells;
+
+	for (uint32_t i = 0; i < vCount; i++) {
+		const float *v = reinterpret_cast<const float *>(vertices + i * stride);
+
+		remap[i] = i;
+
+		const bool border = (v[0] <= (minX + epsilon)) || (v[0] >= (maxX - epsilon)) ||
+		                    (v[1] <= (minY + epsilon)) || (v[1] >= (maxY - epsilon));
+		if (border)
+			continue;
+
+		const uint32_t cellX = (uint32_t) ((v[0] - minX) / cellSize);
+		const uint32_t cellY = (uint32_t) ((v[1] - minY) / cellSize);
+
+		const uint64_t cell = (((uint64_t) cellX) << 32) | cellY;
+
+		std::unordered_map<uint64_t, uint16_t>::const_iterator c = cells.find(cell);
+		if (c != cells.end())
+			remap[i] = c->second;
+		else
+			cells.insert(std::make_pair(cell, (uint16_t) i));
+	}
+
+	// Keep all faces that didn't collapse
+	std::vector<uint16_t> faces;
+	faces.reserve(fCount * 3);
+
+	const uint16_t *f = reinterpret_cast<const uint16_t *>(iBuf.getData());
+	for (uint32_t i = 0; i < fCount; i++, f += 3) {
+		if ((f[0] >= vCount) || (f[1] >= vCount) || (f[2] >= vCount))
+			continue;
+
+		const uint16_t a = remap[f[0]], b = remap[f[1]], c = remap[f[2]];
+		if ((a == b) || (b == c) || (a == c))
+			continue;
+
+		faces.push_back(a);
+		faces.push_back(b);
+		faces.push_back(c);
+	}
+
+	// Not worth the memory if it doesn't get rid of at least a quarter of the faces
+	if (faces.empty() || ((faces.size() / 3) > ((fCount * 3) / 4)))
+		return false;
+
+	lod.setSize(faces.size(), sizeof(uint16_t), GL_UNSIGNED_SHORT);
+	std::memcpy(lod.getData(), faces.data(), faces.size() * sizeof(uint16_t));
+
+	return true;
+}
+
 } // End of namespace NWN2
 
 } // End of namespace Engines
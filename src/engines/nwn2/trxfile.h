@@ -37,6 +37,9 @@ namespace Common {
 }
 
 namespace Graphics {
+	class VertexBuffer;
+	class IndexBuffer;
+
 	namespace Aurora {
 		class GeometryObject;
 	}
@@ -112,6 +115,21 @@ private:
 	void loadWATR(Common::SeekableReadStream &trx, Packet &packet);
 	/** Load ASWM (walk mesh) packets. */
 	void loadASWM(Common::SeekableReadStream &trx, Packet &packet);
+
+	// Levels of detail
+
+	/** Create a tile's mesh object, together with coarser levels of detail for far away tiles. */
+	static Graphics::Aurora::GeometryObject *createTile(const Graphics::VertexBuffer &vBuf,
+	                                                    const Graphics::IndexBuffer &iBuf);
+	/** Create a coarser version of a tile's faces, by merging vertices within each cell of a grid.
+	 *
+	 *  Vertices on the border of the tile are never moved, so that the tile
+	 *  still fits seamlessly with its neighbours.
+	 *
+	 *  @return false if this doesn't reduce the number of faces notably.
+	 */
+	static bool simplifyTile(const Graphics::VertexBuffer &vBuf, const Graphics::IndexBuffer &iBuf,
+	                         float cellSize, Graphics::IndexBuffer &lod);
 };
 
 } // End of namespace NWN2
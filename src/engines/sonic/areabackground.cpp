@@ -35,6 +35,7 @@
 #include "src/graphics/camera.h"
 
 #include "src/graphics/images/cbgt.h"
+#include "src/graphics/images/texturecache.h"
 
 #include "src/graphics/aurora/textureman.h"
 #include "src/graphics/aurora/texture.h"
@@ -48,14 +49,20 @@ namespace Sonic {
 
 static const float kVertexX1 = kBottomScreenX;
 static const float kVertexY1 = kBottomScreenY;
-static const float kVertexX2 = kVertexX1 + kScreenWidth;
-static const float kVertexY2 = kVertexY1 + kScreenHeight;
+
+/** The size of a background tile, in pixels. A multiple of the CBGT cell size. */
+static const uint32_t kTileSize = 256;
+
+/** How far ahead of the visible part of the image tiles are loaded, in pixels. */
+static const float kTilePreload = 64.0f;
 
 AreaBackground::AreaBackground(const Common::UString &name) :
-	Graphics::GUIElement(Graphics::GUIElement::kGUIElementBack) {
+	Graphics::GUIElement(Graphics::GUIElement::kGUIElementBack),
+	_cacheKey(0), _tilesX(0), _tilesY(0), _x(0.0f), _y(0.0f) {
+
 	_distance = FLT_MAX;
 
-	loadTexture(name);
+	open(name);
 
 	setPosition(0.0f, 0.0f);
 }
@@ -65,11 +72,11 @@ AreaBackground::~AreaBackground() {
 }
 
 uint32_t AreaBackground::getImageWidth() const {
-	return _texture.getTexture().getWidth();
+	return _cells->getWidth();
 }
 
 uint32_t AreaBackground::getImageHeight() const {
-	return _texture.getTexture().getHeight();
+	return _cells->getHeight();
 }
 
 void AreaBackground::calculateDistance() {
@@ -79,21 +86,66 @@ void AreaBackground::render(Graphics::RenderPass pass) {
 	if (pass == Graphics::kRenderPassTransparent)
 		return;
 
-	TextureMan.set(_texture);
-
-	glBegin(GL_QUADS);
-		glTexCoord2f(_textureX1, _textureY1);
-		glVertex2f(kVertexX1, kVertexY1);
-		glTexCoord2f(_textureX2, _textureY1);
-		glVertex2f(kVertexX2, kVertexY1);
-		glTexCoord2f(_textureX2, _textureY2);
-		glVertex2f(kVertexX2, kVertexY2);
-		glTexCoord2f(_textureX1, _textureY2);
-		glVertex2f(kVertexX1, kVertexY2);
-	glEnd();
+	const float width  = _cells->getWidth();
+	const float height = _cells->getHeight();
+
+	const float viewX2 = MIN(_x + kScreenWidth , width);
+	const float viewY2 = MIN(_y + kScreenHeight, height);
+
+	const uint32_t tileX1 = _x / kTileSize;
+	const uint32_t tileY1 = _y / kTileSize;
+	const uint32_t tileX2 = MIN<uint32_t>((viewX2 + kTileSize - 1) / kTileSize, _tilesX);
+	const uint32_t tileY2 = MIN<uint32_t>((viewY2 + kTileSize - 1) / kTileSize, _tilesY);
+
+	for (uint32_t tY = tileY1; tY < tileY2; tY++) {
+		for (uint32_t tX = tileX1; tX < tileX2; tX++) {
+			const Graphics::Aurora::TextureHandle &tile = _tiles[tY * _tilesX + tX];
+			if (tile.empty())
+				continue;
+
+			const float tileWidth  = tile.getTexture().getWidth();
+			const float tileHeight = tile.getTexture().getHeight();
+
+			// The part of the image this tile covers that's visible
+			const float tileX = tX * kTileSize;
+			const float tileY = tY * kTileSize;
+
+			const float x1 = MAX(_x, tileX);
+			const float y1 = MAX(_y, tileY);
+			const float x2 = MIN(viewX2, tileX + tileWidth);
+			const float y2 = MIN(viewY2, tileY + tileHeight);
+
+			if ((x1 >= x2) || (y1 >= y2))
+				continue;
+
+			const float tX1 = (x1 - tileX) / tileWidth;
+			const float tX2 = (x2 - tileX) / tileWidth;
+			const float tY1 = (y1 - tileY) / tileHeight;
+			const float tY2 = (y2 - tileY) / tileHeight;
+
+			// The image's Y axis points down, the screen's up
+			const float vX1 = kVertexX1 + (x1 - _x);
+			const float vX2 = kVertexX1 + (x2 - _x);
+			const float vY1 = kVertexY1 + (_y + kScreenHeight - y2);
+			const float vY2 = kVertexY1 + (_y + kScreenHeight - y1);
+
+			TextureMan.set(tile);
+
+			glBegin(GL_QUADS);
+				glTexCoord2f(tX1, tY2);
+				glVertex2f(vX1, vY1);
+				glTexCoord2f(tX2, tY2);
+				glVertex2f(vX2, vY1);
+				glTexCoord2f(tX2, tY1);
+				glVertex2f(vX2, vY2);
+				glTexCoord2f(tX1, tY1);
+				glVertex2f(vX1, vY2);
+			glEnd();
+		}
+	}
 }
 
-void AreaBackground::loadTexture(const Common::UString &name) {
+void AreaBackground::open(const Common::UString &name) {
 	try {
 		std::unique_ptr<Common::SeekableReadStream> cbgt(ResMan.getResource(name, Aurora::kFileTypeCBGT));
 		if (!cbgt)
@@ -107,10 +159,22 @@ void AreaBackground::loadTexture(const Common::UString &name) {
 		if (!twoda)
 			throw Common::Exception("No such 2DA");
 
-		std::unique_ptr<Graphics::CBGT> image = std::make_unique<Graphics::CBGT>(*cbgt, *pal, *twoda);
+		// The tiles are assembled from many small cells, which is slow, so they go through the texture cache
+		if (Graphics::TextureCache::isEnabled()) {
+			_cacheKey = Graphics::TextureCache::hash((uint32_t) Aurora::kFileTypeCBGT);
+			_cacheKey = Graphics::TextureCache::hash(_cacheKey, *cbgt);
+			_cacheKey = Graphics::TextureCache::hash(_cacheKey, *pal);
+			_cacheKey = Graphics::TextureCache::hash(_cacheKey, *twoda);
+
+			twoda->seek(0);
+		}
 
-		_texture = TextureMan.add(Graphics::Aurora::Texture::create(image.get(), Aurora::kFileTypeCBGT), name);
-		image.release();
+		_cells = std::make_unique<Graphics::CBGTCells>(cbgt.release(), *pal, *twoda);
+
+		_tilesX = (_cells->getWidth()  + kTileSize - 1) / kTileSize;
+		_tilesY = (_cells->getHeight() + kTileSize - 1) / kTileSize;
+
+		_tiles.resize(_tilesX * _tilesY);
 
 	} catch (Common::Exception &e) {
 		e.add("Failed loading area background \"%s\"", name.c_str());
@@ -118,19 +182,50 @@ void AreaBackground::loadTexture(const Common::UString &name) {
 	}
 }
 
+void AreaBackground::loadTiles(float x1, float y1, float x2, float y2) {
+	const uint32_t tileX1 = MAX(x1, 0.0f) / kTileSize;
+	const uint32_t tileY1 = MAX(y1, 0.0f) / kTileSize;
+	const uint32_t tileX2 = MIN<uint32_t>(MAX(x2, 0.0f) / kTileSize + 1, _tilesX);
+	const uint32_t tileY2 = MIN<uint32_t>(MAX(y2, 0.0f) / kTileSize + 1, _tilesY);
+
+	for (uint32_t y = tileY1; y < tileY2; y++)
+		for (uint32_t x = tileX1; x < tileX2; x++)
+			if (_tiles[y * _tilesX + x].empty())
+				loadTile(x, y);
+}
+
+void AreaBackground::loadTile(uint32_t x, uint32_t y) {
+	std::unique_ptr<Graphics::ImageDecoder> image;
+
+	uint64_t cacheKey = 0;
+	if (Graphics::TextureCache::isEnabled()) {
+		cacheKey = Graphics::TextureCache::hash(_cacheKey, x);
+		cacheKey = Graphics::TextureCache::hash(cacheKey , y);
+
+		image.reset(Graphics::TextureCache::load(cacheKey));
+	}
+
+	if (!image) {
+		image.reset(_cells->decodeRegion(x * kTileSize, y * kTileSize, kTileSize, kTileSize));
+
+		Graphics::TextureCache::save(cacheKey, *image);
+	}
+
+	_tiles[y * _tilesX + x] = TextureMan.add(Graphics::Aurora::Texture::create(image.get(), Aurora::kFileTypeCBGT));
+	image.release();
+}
+
 void AreaBackground::setPosition(float x, float y) {
-	const float textureWidth  = _texture.getTexture().getWidth();
-	const float textureHeight = _texture.getTexture().getHeight();
+	const float width  = _cells->getWidth();
+	const float height = _cells->getHeight();
 
 	y = floor(y * sin(Common::deg2rad(kCameraAngle)));
 
-	x = CLIP<float>(x - kScreenWidth  / 2.0f, 0.0f, textureWidth  - kScreenWidth);
-	y = CLIP<float>(y - kScreenHeight / 2.0f, 0.0f, textureHeight - kScreenHeight);
+	_x = CLIP<float>(x - kScreenWidth  / 2.0f, 0.0f, width  - kScreenWidth);
+	_y = CLIP<float>(y - kScreenHeight / 2.0f, 0.0f, height - kScreenHeight);
 
-	_textureX1 =  x                  / textureWidth;
-	_textureY1 = (y + kScreenHeight) / textureHeight;
-	_textureX2 = (x + kScreenWidth ) / textureWidth;
-	_textureY2 =  y                  / textureHeight;
+	loadTiles(_x - kTilePreload, _y - kTilePreload,
+	          _x + kScreenWidth + kTilePreload, _y + kScreenHeight + kTilePreload);
 }
 
 void AreaBackground::notifyCameraMoved() {
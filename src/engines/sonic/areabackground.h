@@ -25,6 +25,9 @@
 #ifndef ENGINES_SONIC_AREABACKGROUND_H
 #define ENGINES_SONIC_AREABACKGROUND_H
 
+#include <vector>
+#include <memory>
+
 #include "src/graphics/guielement.h"
 
 #include "src/graphics/aurora/texturehandle.h"
@@ -35,10 +38,20 @@ namespace Common {
 	class UString;
 }
 
+namespace Graphics {
+	class CBGTCells;
+}
+
 namespace Engines {
 
 namespace Sonic {
 
+/** The background image of an area.
+ *
+ *  The image is split into square tiles, each its own texture. A tile is
+ *  only decoded and uploaded once it first scrolls into view, and then
+ *  kept around for as long as the area exists.
+ */
 class AreaBackground : public Graphics::GUIElement, public Events::Notifyable {
 public:
 	AreaBackground(const Common::UString &name);
@@ -52,14 +65,27 @@ public:
 	void render(Graphics::RenderPass pass);
 
 private:
-	Graphics::Aurora::TextureHandle _texture;
+	/** The cells of the image, decoded tile by tile. */
+	std::unique_ptr<Graphics::CBGTCells> _cells;
+
+	/** Texture cache key of the whole image, the base for the tiles' keys. */
+	uint64_t _cacheKey;
+
+	uint32_t _tilesX; ///< Number of tiles in X direction.
+	uint32_t _tilesY; ///< Number of tiles in Y direction.
+
+	/** All tiles, row by row. Empty until the tile was first visible. */
+	std::vector<Graphics::Aurora::TextureHandle> _tiles;
+
+	float _x; ///< Left edge of the visible part of the image, in pixels.
+	float _y; ///< Top edge of the visible part of the image, in pixels.
+
+	void open(const Common::UString &name);
 
-	float _textureX1;
-	float _textureY1;
-	float _textureX2;
-	float _textureY2;
+	/** Make sure all tiles within this range of the image, in pixels, are loaded. */
+	void loadTiles(float x1, float y1, float x2, float y2);
+	void loadTile(uint32_t x, uint32_t y);
 
-	void loadTexture(const Common::UString &name);
 	void setPosition(float x, float y);
 
 	void notifyCameraMoved();
@@ -34,6 +34,7 @@
 #include "src/aurora/resman.h"
 
 #include "src/graphics/images/ncgr.h"
+#include "src/graphics/images/texturecache.h"
 
 #include "src/graphics/aurora/textureman.h"
 #include "src/graphics/aurora/texture.h"
@@ -86,7 +87,27 @@ Graphics::Aurora::TextureHandle loadNCGR(const Common::UString &name, const Comm
 
 	va_end(va);
 
-	std::unique_ptr<Graphics::NCGR> image = std::make_unique<Graphics::NCGR>(getRawPointers(ncgrs), width, height, *nclrStream);
+	// Assembling the tiles is slow, so try the texture cache first
+	std::unique_ptr<Graphics::ImageDecoder> image;
+
+	uint64_t cacheKey = 0;
+	if (Graphics::TextureCache::isEnabled()) {
+		cacheKey = Graphics::TextureCache::hash((uint32_t) ::Aurora::kFileTypeNCGR);
+		cacheKey = Graphics::TextureCache::hash(cacheKey, width);
+		cacheKey = Graphics::TextureCache::hash(cacheKey, height);
+		cacheKey = Graphics::TextureCache::hash(cacheKey, *nclrStream);
+
+		for (auto &ncgr : ncgrs)
+			cacheKey = ncgr ? Graphics::TextureCache::hash(cacheKey, *ncgr) : Graphics::TextureCache::hash(cacheKey, 0);
+
+		image.reset(Graphics::TextureCache::load(cacheKey));
+	}
+
+	if (!image) {
+		image = std::make_unique<Graphics::NCGR>(getRawPointers(ncgrs), width, height, *nclrStream);
+
+		Graphics::TextureCache::save(cacheKey, *image);
+	}
 
 	Graphics::Aurora::Texture *texture = Graphics::Aurora::Texture::create(image.get());
 	image.release();
@@ -257,7 +257,15 @@ void Area::loadProperties(const Aurora::GFF3Struct &props) {
 }
 
 void Area::loadModels() {
-	loadAreaModel();
+	/* All models are independent of each other, so let them all load
+	 * on the thread pool at once. Only their GL containers are then
+	 * still created here, when taking them. */
+	PendingModel areaModel = loadModelObjectAsync(_modelName);
+
+	for (auto &object : _objects)
+		object->prefetchModel();
+
+	loadAreaModel(&areaModel);
 
 	for (auto &object : _objects) {
 		object->loadModel();
@@ -277,11 +285,14 @@ void Area::unloadModels() {
 	unloadAreaModel();
 }
 
-void Area::loadAreaModel() {
+void Area::loadAreaModel(PendingModel *pending) {
 	if (_modelName.empty())
 		return;
 
-	_model.reset(loadModelObject(_modelName));
+	if (pending && !pending->empty())
+		_model.reset(pending->take());
+	else
+		_model.reset(loadModelObject(_modelName));
 	if (!_model)
 		throw Common::Exception("Can't load area geometry model \"%s\"", _modelName.c_str());
 
@@ -43,6 +43,8 @@
 #include "src/events/types.h"
 #include "src/events/notifyable.h"
 
+#include "src/engines/aurora/model.h"
+
 #include "src/engines/witcher/object.h"
 
 namespace Engines {
@@ -170,7 +172,8 @@ private:
 	void loadModels();
 	void unloadModels();
 
-	void loadAreaModel();
+	/** Load the area geometry model, optionally from one already loading in the background. */
+	void loadAreaModel(PendingModel *pending = 0);
 	void unloadAreaModel();
 
 	// Highlight / active helpers
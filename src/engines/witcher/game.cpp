@@ -26,8 +26,10 @@
 
 #include <algorithm>
 
+#include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/configman.h"
+#include "src/common/configvalue.h"
 #include "src/common/filepath.h"
 #include "src/common/filelist.h"
 
@@ -50,6 +52,9 @@ namespace Engines {
 
 namespace Witcher {
 
+/** The time, in milliseconds, Lua's garbage collection may take per frame. */
+static const Common::ConfigValue<int> kConfigLuaGCBudget("luagcbudget", 2);
+
 Game::Game(WitcherEngine &engine, ::Engines::Console &console) : _engine(&engine), _console(&console) {
 	_functions = std::make_unique<Functions>(*this);
 	_bindings = std::make_unique<LuaBindings>();
@@ -112,6 +117,9 @@ void Game::runCampaign() {
 			_campaign->addEvent(event);
 
 		_campaign->processEventQueue();
+
+		LuaScriptMan.collectGarbage(MAX<int>(kConfigLuaGCBudget, 0));
+
 		EventMan.delay(10);
 	}
 
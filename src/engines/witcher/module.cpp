@@ -215,11 +215,11 @@ bool Module::getObjectLocation(const Common::UString &object, Common::UString &a
 	if (object.empty())
 		return false;
 
-	std::unique_ptr<Aurora::NWScript::ObjectSearch> search(findObjectsByTag(object));
+	Aurora::NWScript::ObjectRange search = getObjectsByTag(object);
 
 	Witcher::Object *witcherObject = nullptr;
-	while (!witcherObject && search->get()) {
-		witcherObject = Witcher::ObjectContainer::toObject(search->next());
+	while (!witcherObject && search.get()) {
+		witcherObject = Witcher::ObjectContainer::toObject(search.next());
 		if (!witcherObject || (witcherObject->getType() != kObjectTypeWaypoint))
 			witcherObject = nullptr;
 	}
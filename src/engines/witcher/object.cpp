@@ -62,6 +62,9 @@ ObjectType Object::getType() const {
 	return _type;
 }
 
+void Object::prefetchModel() {
+}
+
 void Object::loadModel() {
 }
 
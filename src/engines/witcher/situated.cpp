@@ -51,6 +51,13 @@ Situated::Situated(ObjectType type) : Object(type),
 Situated::~Situated() {
 }
 
+void Situated::prefetchModel() {
+	if (_model || !_pendingModel.empty())
+		return;
+
+	_pendingModel = loadModelObjectAsync(_modelName);
+}
+
 void Situated::loadModel() {
 	if (_model)
 		return;
@@ -60,7 +67,11 @@ void Situated::loadModel() {
 		return;
 	}
 
-	_model.reset(loadModelObject(_modelName));
+	if (!_pendingModel.empty())
+		_model.reset(_pendingModel.take());
+	else
+		_model.reset(loadModelObject(_modelName));
+
 	if (!_model)
 		throw Common::Exception("Failed to load situated object model \"%s\"",
 		                        _modelName.c_str());
@@ -86,6 +97,7 @@ void Situated::loadModel() {
 void Situated::unloadModel() {
 	hide();
 
+	_pendingModel = PendingModel();
 	_model.reset();
 }
 
@@ -31,6 +31,8 @@
 
 #include "src/graphics/aurora/types.h"
 
+#include "src/engines/aurora/model.h"
+
 #include "src/engines/witcher/object.h"
 
 namespace Engines {
@@ -44,8 +46,9 @@ public:
 
 	// Basic visuals
 
-	void loadModel();   ///< Load the situated object's model.
-	void unloadModel(); ///< Unload the situated object's model.
+	void prefetchModel(); ///< Start loading the situated object's model in the background.
+	void loadModel();     ///< Load the situated object's model.
+	void unloadModel();   ///< Unload the situated object's model.
 
 	void show(); ///< Show the situated object's model.
 	void hide(); ///< Hide the situated object's model.
@@ -90,6 +93,7 @@ protected:
 	Object *_lastUsedBy;   ///< The object that last used this situated object.
 
 	std::unique_ptr<Graphics::Aurora::Model> _model; ///< The situated object's model.
+	PendingModel _pendingModel; ///< The model, while it's still loading in the background.
 
 
 	Situated(ObjectType type);
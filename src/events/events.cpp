@@ -37,6 +37,7 @@ STOP_IGNORE_IMPLICIT_FALLTHROUGH
 #include "src/common/error.h"
 #include "src/common/threads.h"
 #include "src/common/configman.h"
+#include "src/common/debugman.h"
 
 #include "src/events/events.h"
 #include "src/events/requests.h"
@@ -64,7 +65,7 @@ const EventsManager::RequestHandler EventsManager::_requestHandler[kITCEventMAX]
 
 EventsManager::EventsManager() : _ready(false), _quitRequested(false), _doQuit(false),
 	_fatalError(false), _queueSize(0), _fullQueue(false), _repeat(false), _repeatCounter(0),
-	_textInputCounter(0) {
+	_textInputCounter(0), _windowRestored(false) {
 
 }
 
@@ -98,6 +99,8 @@ void EventsManager::init() {
 
 	_repeatCounter = 0;
 
+	_framePacer.setRate(MAX(ConfigMan.getInt("fpslimit", 0), 0));
+
 	ImGuiIO &io = ImGui::GetIO();
 	io.WantCaptureKeyboard = true;
 	io.WantCaptureMouse = true;
@@ -109,6 +112,7 @@ void EventsManager::deinit() {
 
 	deinitJoysticks();
 
+	TimerMan.deinit();
 	RequestMan.deinit();
 
 	_ready = false;
@@ -118,8 +122,6 @@ void EventsManager::reset() {
 	if (!_ready)
 		return;
 
-	std::lock_guard<std::recursive_mutex> lock(_eventQueueMutex);
-
 	// Clear the SDL event queue
 	while (SDL_PollEvent(0));
 
@@ -187,9 +189,9 @@ bool EventsManager::parseEventGraphics(const Event &event) {
 	}
 
 	if (event.type == kEventWindow) {
-		// If the window was restored, reassert the window size
+		// If the window was restored, reassert the window size, once all events are processed
 		if (event.window.event == kEventWindowRestored)
-			WindowMan.setWindowSize(WindowMan.getWindowWidth(), WindowMan.getWindowHeight());
+			_windowRestored = true;
 
 		return true;
 	}
@@ -197,34 +199,29 @@ bool EventsManager::parseEventGraphics(const Event &event) {
 	return false;
 }
 
-bool EventsManager::parseITC(const Event &event) {
-	if (event.type != kEventITC)
-		return false;
-
-	// Get the specific ITC type
-	ITCEvent itcEvent = (ITCEvent) event.user.code;
-
-	Request &request = *static_cast<Request *>(event.user.data1);
-
-	if (request._type != itcEvent)
-		throw Common::Exception("Request type does not match the ITC type");
+void EventsManager::handleRequest(Request &request) {
+	Common::enforceMainThread();
 
 	// Call its request handler
-	if ((itcEvent >= 0) && (itcEvent < kITCEventMAX)) {
-		RequestHandler handler = _requestHandler[itcEvent];
+	if ((request._type >= 0) && (request._type < kITCEventMAX)) {
+		RequestHandler handler = _requestHandler[request._type];
 
 		if (handler)
 			(this->*handler)(request);
 	}
-
-	request.signalReply();
-	return true;
 }
 
 void EventsManager::processEvents() {
 	Common::enforceMainThread();
 
-	std::lock_guard<std::recursive_mutex> lock(_eventQueueMutex);
+	/* Mouse motion events are merged, so that a high polling rate mouse doesn't
+	 * flood the game thread with motion events that are outdated anyway. Only
+	 * consecutive motions with the same button state are merged, and a pending
+	 * motion is always queued before any other event, to keep their order. */
+	Event motion;
+	bool hasMotion = false;
+
+	_windowRestored = false;
 
 	Event event;
 	while (SDL_PollEvent(&event)) {
@@ -244,34 +241,46 @@ void EventsManager::processEvents() {
 		if (parseEventGraphics(event))
 			continue;
 
-		if (parseITC(event))
+		if (event.type == kEventMouseMove) {
+			if (hasMotion && (motion.motion.state == event.motion.state)) {
+				event.motion.xrel += motion.motion.xrel;
+				event.motion.yrel += motion.motion.yrel;
+			} else if (hasMotion)
+				_eventQueue.push(motion);
+
+			motion    = event;
+			hasMotion = true;
 			continue;
+		}
+
+		if (hasMotion) {
+			_eventQueue.push(motion);
+			hasMotion = false;
+		}
 
-		// Push the event to the back of the list
-		_eventQueue.push_back(event);
+		// Push the event to the back of the queue. If the game thread hasn't
+		// polled any events in a long while, it's busy loading, and will flush
+		// the queue once it's done anyway, so dropping new ones is harmless
+		_eventQueue.push(event);
 	}
 
+	if (hasMotion)
+		_eventQueue.push(motion);
+
+	if (_windowRestored)
+		WindowMan.setWindowSize(WindowMan.getWindowWidth(), WindowMan.getWindowHeight());
+
 	_queueSize = 0;
 	_fullQueue = false;
 }
 
 void EventsManager::flushEvents() {
-	std::lock_guard<std::recursive_mutex> lock(_eventQueueMutex);
-
 	_eventQueue.clear();
 }
 
 bool EventsManager::pollEvent(Event &event) {
-	std::lock_guard<std::recursive_mutex> lock(_eventQueueMutex);
-
-	if (_eventQueue.empty())
-		return false;
-
-	// Return an event from the front of the list
-	event = _eventQueue.front();
-	_eventQueue.pop_front();
-
-	return true;
+	// Return an event from the front of the queue
+	return _eventQueue.pop(event);
 }
 
 bool EventsManager::pushEvent(Event &event) {
@@ -280,8 +289,6 @@ bool EventsManager::pushEvent(Event &event) {
 		_queueProcessed.wait_for(lock, std::chrono::duration<int, std::milli>(100));
 	}
 
-	std::lock_guard<std::recursive_mutex> lock(_eventQueueMutex);
-
 	int result = SDL_PushEvent(&event);
 	_queueSize++;
 
@@ -363,8 +370,17 @@ void EventsManager::runMainLoop() {
 
 		_queueProcessed.notify_one();
 
+		// Execute what the other threads queued for us since the last frame
+		RequestMan.executeCommands();
+
 		// Render a frame
 		GfxMan.renderScene();
+
+		// Write the metrics to the log file, if it's time
+		DebugMan.updateMetrics();
+
+		// Sleep until the next frame is due, if the frame rate is limited
+		_framePacer.wait();
 	}
 }
 
@@ -25,13 +25,15 @@
 #ifndef EVENTS_EVENTS_H
 #define EVENTS_EVENTS_H
 
-#include <list>
 #include <vector>
 #include <memory>
+#include <atomic>
 
 #include "src/common/types.h"
 #include "src/common/singleton.h"
 #include "src/common/mutex.h"
+#include "src/common/mpscqueue.h"
+#include "src/common/fixedtimestep.h"
 
 #include "src/events/types.h"
 #include "src/events/joystick.h"
@@ -153,7 +155,10 @@ public:
 private:
 	typedef std::vector<std::unique_ptr<Joystick>> Joysticks;
 
-	typedef std::list<Event> EventQueue;
+	typedef Common::MPSCQueue<Event> EventQueue;
+
+	/** Maximum number of events waiting for the game thread. */
+	static const size_t kEventQueueSize = 4096;
 	typedef void (EventsManager::*RequestHandler)(Request &);
 
 	/** Pointer to the request handler. */
@@ -168,10 +173,10 @@ private:
 
 	Joysticks _joysticks;
 
-	EventQueue _eventQueue;
-	std::recursive_mutex _eventQueueMutex;
+	/** Events from the main thread, waiting to be polled by the game thread. */
+	EventQueue _eventQueue { kEventQueueSize };
 
-	size_t _queueSize;
+	std::atomic<size_t> _queueSize;
 
 	bool _fullQueue;
 	std::condition_variable_any _queueProcessed;
@@ -182,6 +187,12 @@ private:
 
 	uint _textInputCounter;
 
+	/** Was the window restored during the current processEvents() call? */
+	bool _windowRestored;
+
+	/** Limits the frames rendered by the main loop, if the user configured "fpslimit". */
+	Common::FramePacer _framePacer;
+
 
 	/** Initialize the available joysticks/gamepads. */
 	void initJoysticks();
@@ -192,8 +203,8 @@ private:
 	bool parseEventQuit(const Event &event);
 	/** Look for graphics events. */
 	bool parseEventGraphics(const Event &event);
-	/** Look for inter-thread communication. */
-	bool parseITC(const Event &event);
+	/** Execute a request queued by the RequestManager. */
+	void handleRequest(Request &request);
 
 	// Request handler
 	void requestCallInMainThread(Request &request);
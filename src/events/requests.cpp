@@ -22,6 +22,8 @@
  *  Inter-thread request events.
  */
 
+#include <chrono>
+
 #include "src/common/error.h"
 #include "src/common/util.h"
 #include "src/common/threads.h"
@@ -35,19 +37,25 @@ DECLARE_SINGLETON(Events::RequestManager)
 
 namespace Events {
 
+/** How long the main thread executes queued commands per frame, in microseconds.
+ *  Commands that don't fit are left for the next frame. */
+static const int kCommandSliceLength = 4000;
+
+RequestManager::RequestManager() : _nextCommand(0), _lastFence(0), _doneFence(0) {
+}
+
 RequestManager::~RequestManager() {
 	clearList();
 }
 
 void RequestManager::init() {
 	clearList();
-
-	if (!createThread("RequestManager"))
-		throw Common::Exception("Failed to create requests thread: %s", SDL_GetError());
 }
 
 void RequestManager::deinit() {
-	destroyThread();
+	// Let everything still queued finish
+	if (Common::isMainThread())
+		executeCommands(false);
 
 	clearList();
 }
@@ -62,13 +70,9 @@ void RequestManager::dispatch(RequestID request) {
 	// Set state
 	(*request)->_dispatched = true;
 
-	// And send the event
-	if (!EventMan.pushEvent((*request)->_event))
-		throw Common::Exception("Failed dispatching request");
-
-	if (Common::isMainThread())
-		// If we're currently in the main thread, to avoid a dead-lock, process events now
-		EventMan.processEvents();
+	// And queue the request
+	Request *r = request->get();
+	r->_fence = enqueue([r]() { EventMan.handleRequest(*r); });
 }
 
 void RequestManager::waitReply(RequestID request) {
@@ -82,11 +86,13 @@ void RequestManager::waitReply(RequestID request) {
 		return;
 	}
 
+	const RequestFence fence = (*request)->_fence;
+
 	// We don't need our use mutex now
 	_mutexUse.unlock();
 
 	// Wait for a reply
-	(*request)->_hasReply.lock();
+	waitFence(fence);
 
 	// Got a reply
 
@@ -120,9 +126,99 @@ void RequestManager::dispatchAndForget(RequestID request) {
 }
 
 void RequestManager::sync() {
-	RequestID syncID = newRequest(kITCEventSync);
+	RequestFence fence;
+
+	{
+		std::lock_guard<std::mutex> lock(_commandMutex);
+		fence = _lastFence;
+	}
+
+	waitFence(fence);
+}
+
+RequestFence RequestManager::enqueue(const MainThreadCallerFunctor &func) {
+	std::lock_guard<std::mutex> lock(_commandMutex);
+
+	_commands.push_back(func);
+
+	return ++_lastFence;
+}
+
+bool RequestManager::isFenceReached(RequestFence fence) const {
+	return _doneFence.load(std::memory_order_acquire) >= fence;
+}
+
+void RequestManager::waitFence(RequestFence fence) {
+	if (isFenceReached(fence))
+		return;
+
+	if (Common::isMainThread()) {
+		// We are the ones executing the commands, so do it right now
+		while (!isFenceReached(fence))
+			executeCommands(false);
+
+		return;
+	}
 
-	dispatchAndWait(syncID);
+	std::unique_lock<std::mutex> lock(_commandMutex);
+	while (!isFenceReached(fence))
+		_fenceReached.wait(lock);
+}
+
+void RequestManager::executeCommands() {
+	Common::enforceMainThread();
+
+	executeCommands(true);
+
+	collectGarbage();
+}
+
+void RequestManager::executeCommands(bool limited) {
+	typedef std::chrono::steady_clock Clock;
+
+	const Clock::time_point sliceEnd = Clock::now() + std::chrono::microseconds(kCommandSliceLength);
+
+	bool executed = false;
+
+	while (true) {
+		if (_nextCommand >= _executing.size()) {
+			// Take the next batch
+			std::lock_guard<std::mutex> lock(_commandMutex);
+
+			_executing.clear();
+			_executing.swap(_commands);
+			_nextCommand = 0;
+
+			if (_executing.empty())
+				break;
+		}
+
+		// The command might queue more commands or wait for fences itself, so take it out first
+		MainThreadCallerFunctor command = std::move(_executing[_nextCommand++]);
+
+		try {
+			command();
+		} catch (...) {
+			_doneFence.fetch_add(1, std::memory_order_acq_rel);
+			_fenceReached.notify_all();
+			throw;
+		}
+
+		_doneFence.fetch_add(1, std::memory_order_acq_rel);
+		executed = true;
+
+		if (limited && (Clock::now() >= sliceEnd))
+			break;
+	}
+
+	if (executed) {
+		// Make sure no waiter is between checking its fence and starting to wait
+		{
+			std::lock_guard<std::mutex> lock(_commandMutex);
+		}
+
+		_fenceReached.notify_all();
+	}
 }
 
 RequestID RequestManager::rebuild(Graphics::GLContainer &glContainer) {
@@ -150,11 +246,7 @@ RequestID RequestManager::newRequest(ITCEvent type) {
 }
 
 void RequestManager::callInMainThread(const MainThreadCallerFunctor &caller) {
-	RequestID rID = newRequest(kITCEventCallInMainThread);
-
-	(*rID)->_callInMainThread.caller = &caller;
-
-	dispatchAndWait(rID);
+	waitFence(enqueue(caller));
 }
 
 void RequestManager::clearList() {
@@ -173,13 +265,6 @@ void RequestManager::collectGarbage() {
 	_requests.remove_if(requestIsGarbage);
 }
 
-void RequestManager::threadMethod() {
-	while (!_killThread.load(std::memory_order_relaxed)) {
-		collectGarbage();
-		EventMan.delay(100);
-	}
-}
-
 void RequestManager::destroy() {
 	Common::Singleton<RequestManager>::destroy();
 }
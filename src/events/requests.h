@@ -26,12 +26,14 @@
 #define EVENTS_REQUESTS_H
 
 #include <list>
+#include <vector>
 #include <memory>
+#include <atomic>
 #include <functional>
 
 #include "src/common/types.h"
 #include "src/common/singleton.h"
-#include "src/common/thread.h"
+#include "src/common/mutex.h"
 
 #include "src/graphics/types.h"
 
@@ -58,11 +60,17 @@ typedef RequestList::iterator RequestID;
  *  asynchronously, without it unnecessarily blocking further execution of the
  *  game thread.
  *
+ *  All requests, and all functions to be called in the main thread, go into
+ *  one command buffer. Any thread can queue commands without waiting. The
+ *  main thread executes the queued commands in one batch per frame. Callers
+ *  that need the result of a command wait for its fence.
+ *
  *  @note As soon as waitReply(), forget(), dispatchAndWait() or
  *         dispatchAndForget() was called, the RequestID expires.
  */
-class RequestManager : public Common::Singleton<RequestManager>, public Common::Thread {
+class RequestManager : public Common::Singleton<RequestManager> {
 public:
+	RequestManager();
 	~RequestManager();
 
 	void init();
@@ -95,6 +103,20 @@ public:
 		return f.getReturnValue();
 	}
 
+	/** Queue a function to be called in the main thread, without waiting for it.
+	 *
+	 *  @return The fence to wait for, should the caller need the function's effects.
+	 */
+	RequestFence enqueue(const MainThreadCallerFunctor &func);
+
+	/** Wait until the main thread executed all commands up to and including this fence. */
+	void waitFence(RequestFence fence);
+	/** Has the main thread executed all commands up to and including this fence? */
+	bool isFenceReached(RequestFence fence) const;
+
+	/** Execute the queued commands. Only called by the main thread, once per frame. */
+	void executeCommands();
+
 	/** Request that a GL container shall be rebuilt. */
 	RequestID rebuild(Graphics::GLContainer &glContainer);
 	/** Request that a GL container shall be destroyed. */
@@ -104,10 +126,22 @@ public:
 	static void destroy();
 
 private:
+	typedef std::vector<MainThreadCallerFunctor> CommandList;
+
 	std::recursive_mutex _mutexUse; ///< The mutex locking the use of the manager.
 
 	RequestList _requests; ///< All currently active requests.
 
+	std::mutex _commandMutex;              ///< The mutex protecting the queued commands.
+	std::condition_variable _fenceReached; ///< Signalled when the main thread finished a batch.
+
+	CommandList _commands;  ///< Commands queued since the last batch.
+	CommandList _executing; ///< The current batch of commands.
+	size_t _nextCommand;    ///< The next command of the current batch to execute.
+
+	RequestFence _lastFence;                ///< The fence of the last queued command.
+	std::atomic<RequestFence> _doneFence;   ///< The fence of the last executed command.
+
 	/** Create a new, empty request of that type. */
 	RequestID newRequest(ITCEvent type);
 
@@ -115,7 +149,8 @@ private:
 
 	void collectGarbage();
 
-	void threadMethod();
+	/** Execute queued commands, optionally only as many as fit into one frame's time slice. */
+	void executeCommands(bool limited);
 
 	void callInMainThread(const MainThreadCallerFunctor &caller);
 };
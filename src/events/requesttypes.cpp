@@ -26,14 +26,11 @@
 #include "src/common/util.h"
 
 #include "src/events/requesttypes.h"
-#include "src/events/events.h"
+#include "src/events/requests.h"
 
 namespace Events {
 
-Request::Request(ITCEvent type) : _type(type), _dispatched(false), _garbage(false),
-	_hasReply(0) {
-
-	create();
+Request::Request(ITCEvent type) : _type(type), _dispatched(false), _garbage(false), _fence(0) {
 }
 
 Request::~Request() {
@@ -41,23 +38,13 @@ Request::~Request() {
 
 bool Request::isGarbage() const {
 	// Only "really" garbage if it hasn't got a pending answer
-	return _garbage && !_dispatched;
+	return _garbage && (!_dispatched || RequestMan.isFenceReached(_fence));
 }
 
 void Request::setGarbage() {
 	_garbage = true;
 }
 
-void Request::create() {
-	_event.type       = kEventITC;
-	_event.user.code  = (int) _type;
-	_event.user.data1 = static_cast<void *>(this);
-}
-
-void Request::signalReply() {
-	_hasReply.unlock();
-}
-
 void Request::copyToReply() {
 }
 
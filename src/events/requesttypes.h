@@ -26,8 +26,6 @@
 #define EVENTS_REQUESTTYPES_H
 
 #include "src/common/types.h"
-#include "src/common/mutex.h"
-#include "src/common/semaphore.h"
 
 #include "src/events/types.h"
 
@@ -39,6 +37,13 @@ namespace Graphics {
 
 namespace Events {
 
+/** A position in the main thread's command buffer.
+ *
+ *  A fence is reached once all commands queued up to and including it
+ *  have been executed.
+ */
+typedef uint64_t RequestFence;
+
 // Data structures for specific requests
 
 struct RequestCallInMainThread {
@@ -63,9 +68,7 @@ private:
 	bool _dispatched; ///< Was the request dispatched?
 	bool _garbage;
 
-	Common::Semaphore _hasReply; ///< Do we have a reply?
-
-	Event _event; ///< The actual event.
+	RequestFence _fence; ///< The fence of the dispatched request.
 
 	/** Request data. */
 	union {
@@ -73,15 +76,9 @@ private:
 		RequestDataGLContainer  _glContainer;
 	};
 
-	/** Create the empty request frame. */
-	void create();
-
 	/** Copy reply data to the reply address. */
 	void copyToReply();
 
-	/** Signal that the request was answered. */
-	void signalReply();
-
 	void setGarbage();
 
 	friend class EventsManager;
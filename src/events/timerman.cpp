@@ -22,7 +22,7 @@
  *  The global timer manager.
  */
 
-#include "src/common/error.h"
+#include "src/common/util.h"
 
 #include "src/events/timerman.h"
 
@@ -30,7 +30,7 @@ DECLARE_SINGLETON(Events::TimerManager)
 
 namespace Events {
 
-TimerHandle::TimerHandle() : _empty(true) {
+TimerHandle::TimerHandle() : _timer(kInvalid) {
 }
 
 TimerHandle::~TimerHandle() {
@@ -38,77 +38,162 @@ TimerHandle::~TimerHandle() {
 }
 
 
-TimerManager::TimerManager() {
+TimerManager::TimerManager() : _start(Clock::now()), _nextWakeUp(0), _waitingForever(false) {
 }
 
 TimerManager::~TimerManager() {
-	for (std::list<TimerID>::iterator t = _timers.begin(); t != _timers.end(); ++t)
-		removeTimer(*t);
+	deinit();
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (uint32_t i = 0; i < _timers.size(); i++)
+		if (_timers[i].handle)
+			freeTimer(i);
 }
 
 void TimerManager::init() {
+	if (!createThread("TimerManager"))
+		warning("TimerManager::init(): Failed to create the timer thread");
 }
 
-void TimerManager::addTimer(uint32_t interval, TimerHandle &handle, const TimerFunc &func) {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+void TimerManager::deinit() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_killThread.store(true, std::memory_order_seq_cst);
+	}
 
-	removeTimer(handle);
+	_wakeUp.notify_all();
 
-	_timers.push_back(TimerID());
+	destroyThread();
 
-	std::list<TimerID>::iterator id = --_timers.end();
+	_killThread.store(false, std::memory_order_seq_cst);
+}
 
-	handle._iterator = id;
-	handle._empty    = false;
+uint32_t TimerManager::getTime() const {
+	return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - _start).count();
+}
 
-	id->_func = func;
-	id->_id   = SDL_AddTimer(interval, &TimerManager::timerCallback, static_cast<void *>(&handle));
-	if (id->_id)
-		return;
+void TimerManager::addTimer(uint32_t interval, TimerHandle &handle, const TimerFunc &func) {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (handle._timer != TimerHandle::kInvalid)
+		freeTimer(handle._timer);
+
+	uint32_t index;
+	if (_freeTimers.empty()) {
+		_timers.push_back(Timer());
+		index = _timers.size() - 1;
+	} else {
+		index = _freeTimers.back();
+		_freeTimers.pop_back();
+	}
+
+	Timer &timer = _timers[index];
 
-	handle._iterator = _timers.end();
-	handle._empty    = true;
+	timer.func     = std::make_shared<const TimerFunc>(func);
+	timer.interval = interval;
+	timer.due      = getTime() + interval;
+	timer.handle   = &handle;
 
-	_timers.erase(id);
+	timer.wheelHandle = _wheel.schedule(timer.due, TimerRef(index, timer.generation));
 
-	throw Common::Exception("Failed to add timer");
+	handle._timer = index;
+
+	// Only wake up the timer thread if it would otherwise sleep past the new timer
+	if (_waitingForever || (static_cast<int32_t>(_nextWakeUp - timer.due) > 0))
+		_wakeUp.notify_one();
 }
 
 void TimerManager::removeTimer(TimerHandle &handle) {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	std::lock_guard<std::mutex> lock(_mutex);
 
-	if (handle._empty)
+	if (handle._timer == TimerHandle::kInvalid)
 		return;
 
-	removeTimer(*handle._iterator);
-
-	_timers.erase(handle._iterator);
+	freeTimer(handle._timer);
+}
 
-	handle._iterator = _timers.end();
-	handle._empty    = true;
+bool TimerManager::isValid(const TimerRef &ref) const {
+	return (ref.index < _timers.size()) && _timers[ref.index].handle &&
+	       (_timers[ref.index].generation == ref.generation);
 }
 
-void TimerManager::removeTimer(TimerID &id) {
-	if (id._id == 0)
-		return;
+void TimerManager::freeTimer(uint32_t index) {
+	Timer &timer = _timers[index];
+
+	_wheel.cancel(timer.wheelHandle);
+
+	timer.handle->_timer = TimerHandle::kInvalid;
 
-	SDL_RemoveTimer(id._id);
+	timer.func.reset();
+	timer.handle      = 0;
+	timer.wheelHandle = Wheel::Handle();
+	timer.generation++;
+
+	_freeTimers.push_back(index);
 }
 
-uint32_t TimerManager::timerCallback(uint32_t interval, void *data) {
-	TimerHandle &handle = *static_cast<TimerHandle *>(data);
+void TimerManager::threadMethod() {
+	std::vector<TimerRef> due;
 
-	if (handle._empty)
-		return 0;
+	std::unique_lock<std::mutex> lock(_mutex);
 
-	uint32_t newInterval = handle._iterator->_func(interval);
-	if (newInterval == 0) {
-		handle._iterator->_id = 0;
-		TimerMan.removeTimer(handle);
-		return 0;
-	}
+	while (!_killThread.load(std::memory_order_relaxed)) {
+		const uint32_t now = getTime();
+
+		due.clear();
+		_wheel.advance(now, due);
+
+		for (std::vector<TimerRef>::const_iterator d = due.begin(); d != due.end(); ++d) {
+			if (!isValid(*d))
+				continue;
+
+			std::shared_ptr<const TimerFunc> func = _timers[d->index].func;
+			const uint32_t interval = _timers[d->index].interval;
+
+			_timers[d->index].wheelHandle = Wheel::Handle();
+
+			// Call the timer without holding the lock, so that it can add and remove timers itself
+			lock.unlock();
+			const uint32_t newInterval = (*func)(interval);
+			lock.lock();
+
+			// The timer was removed or replaced while we were calling it
+			if (!isValid(*d))
+				continue;
 
-	return newInterval;
+			if (newInterval == 0) {
+				freeTimer(d->index);
+				continue;
+			}
+
+			Timer &timer = _timers[d->index];
+
+			/* Keep the timer in step with its original schedule. But if we fell
+			 * behind more than an interval, don't call it repeatedly to catch up. */
+			timer.interval = newInterval;
+			timer.due     += newInterval;
+			if (static_cast<int32_t>(now - timer.due) > 0)
+				timer.due = now + newInterval;
+
+			timer.wheelHandle = _wheel.schedule(timer.due, *d);
+		}
+
+		if (_killThread.load(std::memory_order_relaxed))
+			break;
+
+		if (_wheel.empty()) {
+			_waitingForever = true;
+			_wakeUp.wait(lock);
+			_waitingForever = false;
+			continue;
+		}
+
+		// Sleep until the timer wheel has something for us. All timers due by then are called together
+		_nextWakeUp = _wheel.getNextTimestamp();
+		if (static_cast<int32_t>(_nextWakeUp - getTime()) > 0)
+			_wakeUp.wait_until(lock, _start + std::chrono::milliseconds(_nextWakeUp));
+	}
 }
 
 } // End of namespace Events
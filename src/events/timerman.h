@@ -25,17 +25,16 @@
 #ifndef EVENTS_TIMERMAN_H
 #define EVENTS_TIMERMAN_H
 
-#include "src/common/fallthrough.h"
-START_IGNORE_IMPLICIT_FALLTHROUGH
-#include <SDL_timer.h>
-STOP_IGNORE_IMPLICIT_FALLTHROUGH
-
-#include <list>
+#include <vector>
+#include <memory>
+#include <chrono>
 #include <functional>
 
 #include "src/common/types.h"
 #include "src/common/singleton.h"
 #include "src/common/mutex.h"
+#include "src/common/thread.h"
+#include "src/common/timerwheel.h"
 
 #include "src/events/types.h"
 
@@ -48,24 +47,29 @@ namespace Events {
  */
 typedef std::function<uint32_t (uint32_t)> TimerFunc;
 
-class TimerID;
 class TimerHandle;
 
 /** The global timer manager.
  *
  *  Allows registering functions to be called at specific intervals.
+ *
+ *  All timers are kept in one timer wheel, serviced by a single thread.
+ *  That thread only wakes up when the next timer is due, and calls all
+ *  timers that are due by then in one go.
  */
-class TimerManager : public Common::Singleton<TimerManager> {
+class TimerManager : public Common::Singleton<TimerManager>, public Common::Thread {
 public:
 	TimerManager();
 	~TimerManager();
 
+	/** Start the timer thread. */
 	void init();
+	/** Stop the timer thread. Timers still registered won't be called anymore. */
+	void deinit();
 
 	/** Add a function to be called regularly.
 	 *
-	 *  @param interval The interval in ms. The granularity is
-	 *                  platform-dependent. The most common number is 10ms.
+	 *  @param interval The interval in ms.
 	 *  @param handle The timer handle to use.
 	 *  @param func The function to call.
 	 */
@@ -75,21 +79,58 @@ public:
 	void removeTimer(TimerHandle &handle);
 
 private:
-	std::recursive_mutex _mutex;
+	typedef std::chrono::steady_clock Clock;
 
-	std::list<TimerID> _timers;
+	/** A reference to a timer that stays valid while the timer is being called. */
+	struct TimerRef {
+		uint32_t index;
+		uint32_t generation;
 
-	void removeTimer(TimerID &id);
+		TimerRef(uint32_t i = 0, uint32_t g = 0) : index(i), generation(g) { }
+	};
 
-	static uint32_t timerCallback(uint32_t interval, void *data);
-};
+	typedef Common::TimerWheel<TimerRef> Wheel;
 
-class TimerID {
-private:
-	SDL_TimerID _id;
-	TimerFunc _func;
+	struct Timer {
+		std::shared_ptr<const TimerFunc> func;
 
-	friend class TimerManager;
+		uint32_t interval;
+		uint32_t due; ///< When the timer is due next, in ms since the timer manager started.
+
+		TimerHandle *handle; ///< The handle owning this timer, or 0 if the timer is unused.
+
+		/** Increased on every reuse of the timer, to detect stale references. */
+		uint32_t generation;
+
+		Wheel::Handle wheelHandle;
+
+		Timer() : interval(0), due(0), handle(0), generation(0) { }
+	};
+
+	std::mutex _mutex;
+	std::condition_variable _wakeUp;
+
+	Clock::time_point _start; ///< When the timer manager was created.
+
+	std::vector<Timer> _timers;
+	std::vector<uint32_t> _freeTimers;
+
+	Wheel _wheel;
+
+	/** When the timer thread will wake up next, in ms since the timer manager started. */
+	uint32_t _nextWakeUp;
+	/** Is the timer thread waiting without a time limit? */
+	bool _waitingForever;
+
+	/** Return the time since the timer manager was created, in ms. */
+	uint32_t getTime() const;
+
+	bool isValid(const TimerRef &ref) const;
+
+	/** Free a timer and detach it from its handle. */
+	void freeTimer(uint32_t index);
+
+	void threadMethod();
 };
 
 class TimerHandle {
@@ -98,9 +139,10 @@ public:
 	~TimerHandle();
 
 private:
-	bool _empty;
+	static const uint32_t kInvalid = 0xFFFFFFFF;
 
-	std::list<TimerID>::iterator _iterator;
+	/** The index of the timer in the timer manager, or kInvalid if there is none. */
+	uint32_t _timer;
 
 	friend class TimerManager;
 };
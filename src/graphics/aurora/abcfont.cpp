@@ -127,6 +127,31 @@ void ABCFont::renderUnbind() const {
 	glUseProgram(0);
 }
 
+bool ABCFont::getQuad(uint32_t c, Quad &quad) const {
+	const Char &cC = findChar(c);
+
+	for (int i = 0; i < 4; i++) {
+		quad.tX[i] = cC.tX[i];
+		quad.tY[i] = cC.tY[i];
+		quad.vX[i] = cC.vX[i] + cC.spaceL;
+		quad.vY[i] = cC.vY[i];
+	}
+
+	quad.advance = cC.spaceL + cC.width + cC.spaceR;
+	quad.page    = 0;
+	quad.empty   = false;
+
+	return true;
+}
+
+void ABCFont::bindPage(size_t UNUSED(page)) const {
+	TextureMan.set(_texture);
+}
+
+void ABCFont::renderQuads(const float *vertices, uint32_t count) const {
+	_mesh->renderQuads(vertices, count);
+}
+
 void ABCFont::load(const Common::UString &name) {
 	std::unique_ptr<Common::SeekableReadStream> abc(ResMan.getResource(name, ::Aurora::kFileTypeABC));
 	if (!abc)
@@ -66,6 +66,10 @@ public:
 	virtual void render(uint32_t c, float &x, float &y, float *rgba) const;
 	virtual void renderUnbind() const;
 
+	bool getQuad(uint32_t c, Quad &quad) const;
+	void bindPage(size_t page) const;
+	void renderQuads(const float *vertices, uint32_t count) const;
+
 private:
 	/** A font character. */
 	struct Char {
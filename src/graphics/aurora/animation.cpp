@@ -22,9 +22,12 @@
  *  An animation to be applied to a model.
  */
 
+#include <algorithm>
+
 #include "external/glm/gtc/type_ptr.hpp"
 #include "external/glm/gtc/matrix_transform.hpp"
 
+#include "src/common/maths.h"
 #include "src/common/readstream.h"
 #include "src/common/debug.h"
 
@@ -42,6 +45,82 @@ namespace Graphics {
 
 namespace Aurora {
 
+/** How many keyframes a cursor steps forward before resorting to a binary search. */
+static const size_t kMaxCursorSteps = 4;
+
+/** The number of steps a quantized position component can take. */
+static const float kPositionSteps = 65535.0f;
+
+size_t AnimationPose::size() const {
+	return nodes.size();
+}
+
+void AnimationPose::resize(size_t count) {
+	nodes.resize(count);
+	channels.resize(count);
+
+	for (size_t c = 0; c < 3; c++)
+		position[c].resize(count, 0.0f);
+	for (size_t c = 0; c < 4; c++)
+		orientation[c].resize(count, 0.0f);
+}
+
+void AnimationPose::blend(const AnimationPose &from, float weight) {
+	const size_t count = size();
+	if (from.size() != count)
+		return;
+
+	/* Values of channels an entry doesn't set are blended as well, and then
+	 * just ignored. That keeps the loops free of branches on the channels. */
+
+	const float fromWeight = 1.0f - weight;
+
+	for (size_t c = 0; c < 3; c++) {
+		float       *to  = position[c].data();
+		const float *src = from.position[c].data();
+
+		for (size_t i = 0; i < count; i++)
+			to[i] = fromWeight * src[i] + weight * to[i];
+	}
+
+	float *x = orientation[0].data();
+	float *y = orientation[1].data();
+	float *z = orientation[2].data();
+	float *w = orientation[3].data();
+
+	const float *fx = from.orientation[0].data();
+	const float *fy = from.orientation[1].data();
+	const float *fz = from.orientation[2].data();
+	const float *fw = from.orientation[3].data();
+
+	// Normalized linear interpolation, along the shorter way around
+	for (size_t i = 0; i < count; i++) {
+		const float dot = fx[i] * x[i] + fy[i] * y[i] + fz[i] * z[i] + fw[i] * w[i];
+		const float toWeight = (dot < 0.0f) ? -weight : weight;
+
+		const float bx = fromWeight * fx[i] + toWeight * x[i];
+		const float by = fromWeight * fy[i] + toWeight * y[i];
+		const float bz = fromWeight * fz[i] + toWeight * z[i];
+		const float bw = fromWeight * fw[i] + toWeight * w[i];
+
+		const float length = sqrtf(bx * bx + by * by + bz * bz + bw * bw);
+		const float scale  = (length > 0.0f) ? (1.0f / length) : 0.0f;
+
+		x[i] = bx * scale;
+		y[i] = by * scale;
+		z[i] = bz * scale;
+		w[i] = bw * scale;
+	}
+}
+
+
+AnimationTrack::AnimationTrack() {
+	for (size_t i = 0; i < 3; i++) {
+		positionMin  [i] = 0.0f;
+		positionScale[i] = 0.0f;
+	}
+}
+
 Animation::Animation() : _length(0.0f), _transtime(0.0f) {
 
 }
@@ -67,49 +146,205 @@ float Animation::getLength() const {
 	return _length;
 }
 
+float Animation::getTransTime() const {
+	return _transtime;
+}
+
 void Animation::setTransTime(float transtime) {
 	_transtime = transtime;
 }
 
-void Animation::update(Model *model,
-                       float UNUSED(lastFrame),
-                       float nextFrame,
-                       const std::vector<ModelNode *> &modelNodeMap) {
+void Animation::sample(Model *model, float time, const std::vector<ModelNode *> &modelNodeMap,
+                       KeyFrameCursors &cursors, AnimationPose &pose) {
+
 	// TODO: Also need to fire off associated events
 	//       for event in _events event->fire()
 
+	// Nodes added since the last compression still need their tracks
+	if (_tracks.size() != nodeList.size())
+		compress();
+
+	if (cursors.size() != nodeList.size())
+		cursors.assign(nodeList.size(), KeyFrameCursor());
 
-	float scale = model->getAnimationScale(_name);
-	for (NodeList::iterator n = nodeList.begin(); n != nodeList.end(); ++n) {
+	pose.resize(nodeList.size());
+
+	KeyFrameCursors::iterator cursor = cursors.begin();
+	std::vector<AnimationTrack>::const_iterator track = _tracks.begin();
+
+	const float scale = model->getAnimationScale(_name);
+	const bool relative = model->arePositionFramesRelative();
+
+	size_t i = 0;
+	for (NodeList::iterator n = nodeList.begin(); n != nodeList.end(); ++n, ++cursor, ++track, ++i) {
 		ModelNode *animNode = (*n)->_nodedata;
 		ModelNode *target = modelNodeMap[animNode->_nodeNumber];
+
+		pose.nodes[i]    = target;
+		pose.channels[i] = 0;
+
 		if (!target)
 			continue;
 
 		// Update position and orientation based on time
-		if (!animNode->_positionFrames.empty()) {
-			glm::vec3 pos(interpolatePosition(animNode, nextFrame));
+		if (!track->positionTimes.empty()) {
+			glm::vec3 pos(interpolatePosition(*track, time, cursor->position));
 
-			if (model->arePositionFramesRelative())
+			if (relative)
 				pos += target->getBasePosition();
 
 			pos *= scale;
 
-			target->setBufferedPosition(pos.x, pos.y, pos.z);
+			pose.position[0][i] = pos.x;
+			pose.position[1][i] = pos.y;
+			pose.position[2][i] = pos.z;
+
+			pose.channels[i] |= AnimationPose::kChannelPosition;
 		}
 
-		if (!animNode->_orientationFrames.empty()) {
-			glm::quat ori(interpolateOrientation(animNode, nextFrame));
-			target->setBufferedOrientation(ori.x, ori.y, ori.z, Common::rad2deg(acosf(ori.w) * 2.0f));
+		if (!track->orientationTimes.empty()) {
+			const glm::quat ori(interpolateOrientation(*track, time, cursor->orientation));
+
+			pose.orientation[0][i] = ori.x;
+			pose.orientation[1][i] = ori.y;
+			pose.orientation[2][i] = ori.z;
+			pose.orientation[3][i] = ori.w;
+
+			pose.channels[i] |= AnimationPose::kChannelOrientation;
 		}
 	}
 }
 
+void Animation::apply(Model *UNUSED(model), const AnimationPose &pose, float UNUSED(time)) {
+	const size_t count = pose.size();
+	for (size_t i = 0; i < count; i++) {
+		ModelNode *target = pose.nodes[i];
+		if (!target)
+			continue;
+
+		if (pose.channels[i] & AnimationPose::kChannelPosition)
+			target->setBufferedPosition(pose.position[0][i], pose.position[1][i], pose.position[2][i]);
+
+		if (pose.channels[i] & AnimationPose::kChannelOrientation) {
+			const float w = CLIP(pose.orientation[3][i], -1.0f, 1.0f);
+
+			target->setBufferedOrientation(pose.orientation[0][i], pose.orientation[1][i],
+			                               pose.orientation[2][i], Common::rad2deg(acosf(w) * 2.0f));
+		}
+	}
+}
+
+void Animation::capturePose(const std::vector<ModelNode *> &modelNodeMap, AnimationPose &pose) {
+	pose.resize(nodeList.size());
+
+	size_t i = 0;
+	for (NodeList::iterator n = nodeList.begin(); n != nodeList.end(); ++n, ++i) {
+		ModelNode *target = modelNodeMap[(*n)->_nodedata->_nodeNumber];
+
+		pose.nodes[i]    = target;
+		pose.channels[i] = 0;
+
+		if (!target)
+			continue;
+
+		// The buffers always hold the latest pose, whether it has been flushed or not
+		for (size_t c = 0; c < 3; c++)
+			pose.position[c][i] = target->_positionBuffer[c];
+
+		// Axis and angle back into a quaternion
+		const glm::vec3 axis(target->_orientationBuffer[0], target->_orientationBuffer[1],
+		                     target->_orientationBuffer[2]);
+		const float angle = Common::deg2rad(target->_orientationBuffer[3]) * 0.5f;
+		const float length = glm::length(axis);
+
+		const glm::vec3 v = (length > 0.0f) ? (axis * (sinf(angle) / length)) : glm::vec3(0.0f);
+
+		pose.orientation[0][i] = v.x;
+		pose.orientation[1][i] = v.y;
+		pose.orientation[2][i] = v.z;
+		pose.orientation[3][i] = (length > 0.0f) ? cosf(angle) : 1.0f;
+
+		pose.channels[i] = AnimationPose::kChannelPosition | AnimationPose::kChannelOrientation;
+	}
+}
+
 void Animation::addAnimNode(AnimNode *node) {
 	nodeList.push_back(node);
 	nodeMap.insert(std::make_pair(node->getName(), node));
 }
 
+void Animation::compress() {
+	// Only nodes added since the last call still have all their keyframes
+	const size_t compressed = _tracks.size();
+
+	NodeList::iterator n = nodeList.begin();
+	std::advance(n, compressed);
+
+	_tracks.resize(nodeList.size());
+
+	for (std::vector<AnimationTrack>::iterator track = _tracks.begin() + compressed;
+	     track != _tracks.end(); ++track, ++n) {
+
+		ModelNode &animNode = *(*n)->_nodedata;
+
+		std::vector<PositionKeyFrame> &positions = animNode._positionFrames;
+		if (!positions.empty()) {
+			float posMax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+			for (size_t i = 0; i < 3; i++)
+				track->positionMin[i] = FLT_MAX;
+
+			for (std::vector<PositionKeyFrame>::const_iterator p = positions.begin(); p != positions.end(); ++p) {
+				const float pos[3] = { p->x, p->y, p->z };
+
+				for (size_t i = 0; i < 3; i++) {
+					track->positionMin[i] = MIN(track->positionMin[i], pos[i]);
+					posMax[i]             = MAX(posMax[i]            , pos[i]);
+				}
+			}
+
+			for (size_t i = 0; i < 3; i++)
+				track->positionScale[i] = (posMax[i] - track->positionMin[i]) / kPositionSteps;
+
+			track->positionTimes.reserve(positions.size());
+			track->positions.reserve(3 * positions.size());
+
+			for (std::vector<PositionKeyFrame>::const_iterator p = positions.begin(); p != positions.end(); ++p) {
+				const float pos[3] = { p->x, p->y, p->z };
+
+				track->positionTimes.push_back(p->time);
+
+				for (size_t i = 0; i < 3; i++) {
+					const float step = (track->positionScale[i] > 0.0f) ?
+						((pos[i] - track->positionMin[i]) / track->positionScale[i]) : 0.0f;
+
+					track->positions.push_back((uint16_t) roundf(CLIP(step, 0.0f, kPositionSteps)));
+				}
+			}
+
+			positions.resize(1);
+			positions.shrink_to_fit();
+		}
+
+		std::vector<QuaternionKeyFrame> &orientations = animNode._orientationFrames;
+		if (!orientations.empty()) {
+			track->orientationTimes.reserve(orientations.size());
+			track->orientations.resize(3 * orientations.size());
+
+			uint16_t *packed = track->orientations.data();
+			for (std::vector<QuaternionKeyFrame>::const_iterator o = orientations.begin();
+			     o != orientations.end(); ++o, packed += 3) {
+
+				track->orientationTimes.push_back(o->time);
+
+				Common::packQuaternion(o->x, o->y, o->z, o->q, packed);
+			}
+
+			orientations.resize(1);
+			orientations.shrink_to_fit();
+		}
+	}
+}
+
 bool Animation::hasNode(const Common::UString &node) const {
 	return (nodeMap.find(node) != nodeMap.end());
 }
@@ -153,70 +388,98 @@ static void normQuaternion(float  xIn , float  yIn , float  zIn , float  qIn,
 	qOut = qIn / magnitude;
 }
 
-glm::vec3 Animation::interpolatePosition(ModelNode *animNode, float time) const {
-	// If only one keyframe, don't interpolate, just set the only position
-	if (animNode->_positionFrames.size() == 1) {
-		const PositionKeyFrame &pos = animNode->_positionFrames[0];
-		return glm::vec3(pos.x, pos.y, pos.z);
-	}
+/** Find the last keyframe before the given time, or the first keyframe if there is none.
+ *
+ *  The search starts at the cursor, which is then moved to the found keyframe.
+ *  Playing an animation normally only moves the cursor forward by a frame or
+ *  two. Only jumps, like a restarted loop, need a binary search.
+ */
+static size_t findKeyFrame(const std::vector<float> &times, float time, size_t &cursor) {
+	size_t frame = MIN<size_t>(cursor, times.size() - 1);
+
+	if ((frame == 0) || (times[frame] < time)) {
+		for (size_t steps = 0; (frame + 1 < times.size()) && (times[frame + 1] < time); ++steps, ++frame) {
+			if (steps == kMaxCursorSteps) {
+				frame = times.size();
+				break;
+			}
+		}
+	} else
+		frame = times.size();
 
-	size_t lastFrame = 0;
-	for (size_t i = 0; i < animNode->_positionFrames.size(); i++) {
-		const PositionKeyFrame &pos = animNode->_positionFrames[i];
-		if (pos.time >= time)
-			break;
+	if (frame == times.size()) {
+		std::vector<float>::const_iterator next = std::lower_bound(times.begin(), times.end(), time);
 
-		lastFrame = i;
+		frame = (next == times.begin()) ? 0 : ((next - times.begin()) - 1);
 	}
 
-	const PositionKeyFrame &last = animNode->_positionFrames[lastFrame];
-	if (lastFrame + 1 >= animNode->_positionFrames.size() || last.time >= time)
-		return glm::vec3(last.x, last.y, last.z);
+	cursor = frame;
+	return frame;
+}
+
+static glm::vec3 getPosition(const AnimationTrack &track, size_t frame) {
+	const uint16_t *pos = &track.positions[3 * frame];
 
-	const PositionKeyFrame &next = animNode->_positionFrames[lastFrame + 1];
+	return glm::vec3(track.positionMin[0] + pos[0] * track.positionScale[0],
+	                 track.positionMin[1] + pos[1] * track.positionScale[1],
+	                 track.positionMin[2] + pos[2] * track.positionScale[2]);
+}
 
-	const float f = (time - last.time) / (next.time - last.time);
-	const float x = f * next.x + (1.0f - f) * last.x;
-	const float y = f * next.y + (1.0f - f) * last.y;
-	const float z = f * next.z + (1.0f - f) * last.z;
+static glm::quat getOrientation(const AnimationTrack &track, size_t frame) {
+	float x, y, z, q;
+	Common::unpackQuaternion(&track.orientations[3 * frame], x, y, z, q);
 
-	return glm::vec3(x, y, z);
+	return glm::quat(q, x, y, z);
 }
 
-glm::quat Animation::interpolateOrientation(ModelNode *animNode, float time) const {
+glm::vec3 Animation::interpolatePosition(const AnimationTrack &track, float time, size_t &cursor) const {
+	// If only one keyframe, don't interpolate, just set the only position
+	if (track.positionTimes.size() == 1)
+		return getPosition(track, 0);
+
+	const size_t lastFrame = findKeyFrame(track.positionTimes, time, cursor);
+
+	const glm::vec3 last = getPosition(track, lastFrame);
+	if (lastFrame + 1 >= track.positionTimes.size() || track.positionTimes[lastFrame] >= time)
+		return last;
+
+	const glm::vec3 next = getPosition(track, lastFrame + 1);
+
+	const float lastTime = track.positionTimes[lastFrame];
+	const float nextTime = track.positionTimes[lastFrame + 1];
+
+	const float f = (time - lastTime) / (nextTime - lastTime);
+
+	return f * next + (1.0f - f) * last;
+}
+
+glm::quat Animation::interpolateOrientation(const AnimationTrack &track, float time, size_t &cursor) const {
 	// If only one keyframe, don't interpolate just set the only orientation
-	if (animNode->_orientationFrames.size() == 1) {
-		const QuaternionKeyFrame &ori = animNode->_orientationFrames[0];
-		return glm::quat(ori.q, ori.x, ori.y, ori.z);
-	}
+	if (track.orientationTimes.size() == 1)
+		return getOrientation(track, 0);
 
-	size_t lastFrame = 0;
-	for (size_t i = 0; i < animNode->_orientationFrames.size(); i++) {
-		const QuaternionKeyFrame &ori = animNode->_orientationFrames[i];
-		if (ori.time >= time)
-			break;
+	const size_t lastFrame = findKeyFrame(track.orientationTimes, time, cursor);
 
-		lastFrame = i;
-	}
+	const glm::quat last = getOrientation(track, lastFrame);
+	if (lastFrame + 1 >= track.orientationTimes.size() || track.orientationTimes[lastFrame] >= time)
+		return last;
 
-	const QuaternionKeyFrame &last = animNode->_orientationFrames[lastFrame];
-	if (lastFrame + 1 >= animNode->_orientationFrames.size() || last.time >= time) {
-		return glm::quat(last.q, last.x, last.y, last.z);
-	}
+	const glm::quat next = getOrientation(track, lastFrame + 1);
 
-	const QuaternionKeyFrame &next = animNode->_orientationFrames[lastFrame + 1];
+	const float lastTime = track.orientationTimes[lastFrame];
+	const float nextTime = track.orientationTimes[lastFrame + 1];
 
-	const float f = (time - last.time) / (next.time - last.time);
+	const float f = (time - lastTime) / (nextTime - lastTime);
 
 	/* If the angle is > 90°, we need to flip the direction of one quaternion to
 	   get a smooth transition instead of wild jumps. */
-	const float angle = acos(dotQuaternion(last.x, last.y, last.z, last.q, next.x, next.y, next.z, next.q));
+	const float angle = acos(dotQuaternion(last.x, last.y, last.z, last.w, next.x, next.y, next.z, next.w));
 	const float dir   = (angle >= (M_PI / 2)) ? -1.0f : 1.0f;
 
 	float x = f * dir * next.x + (1.0f - f) * last.x;
 	float y = f * dir * next.y + (1.0f - f) * last.y;
 	float z = f * dir * next.z + (1.0f - f) * last.z;
-	float q = f * dir * next.q + (1.0f - f) * last.q;
+	float q = f * dir * next.w + (1.0f - f) * last.w;
 
 	// Normalize the result for slightly better results
 	normQuaternion(x, y, z, q, x, y, z, q);
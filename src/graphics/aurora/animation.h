@@ -27,6 +27,7 @@
 
 #include <list>
 #include <map>
+#include <vector>
 
 #include "external/glm/ext/quaternion_float.hpp"
 
@@ -49,6 +50,69 @@ namespace Aurora {
 
 class AnimNode;
 
+/** Where an animation was last evaluated, for one of its nodes.
+ *
+ *  Every AnimationChannel keeps one cursor per node of its current
+ *  animation, so that following keyframes are found by stepping forward
+ *  from the last ones instead of scanning from the start.
+ */
+struct KeyFrameCursor {
+	size_t position;    ///< Index of the last used position keyframe.
+	size_t orientation; ///< Index of the last used orientation keyframe.
+
+	KeyFrameCursor() : position(0), orientation(0) { }
+};
+
+typedef std::vector<KeyFrameCursor> KeyFrameCursors;
+
+/** The pose an animation puts the nodes of a model in.
+ *
+ *  There's one entry per node of the animation, in the animation's node
+ *  order. The values are stored as separate arrays per component, so that
+ *  two poses can be blended with straight loops over the arrays.
+ */
+struct AnimationPose {
+	enum Channel {
+		kChannelPosition    = 1 << 0,
+		kChannelOrientation = 1 << 1
+	};
+
+	std::vector<ModelNode *> nodes;    ///< The model node each entry moves, or 0.
+	std::vector<uint8_t>     channels; ///< Which values each entry sets.
+
+	std::vector<float> position[3];    ///< The positions, already scaled.
+	std::vector<float> orientation[4]; ///< The orientations, as x, y, z, w of a quaternion.
+
+	size_t size() const;
+	void resize(size_t count);
+
+	/** Blend from another pose of the same animation to this one.
+	 *
+	 *  @param from   The pose to blend from.
+	 *  @param weight The weight of this pose, from 0.0f (only from) to 1.0f (only this).
+	 */
+	void blend(const AnimationPose &from, float weight);
+};
+
+/** The keyframes of one animation node, stored quantized.
+ *
+ *  Positions are stored as 16-bit steps within the range the track's
+ *  positions span, orientations as packed quaternions (see
+ *  Common::packQuaternion()). The times stay floats, since keyframes
+ *  are searched by them.
+ */
+struct AnimationTrack {
+	std::vector<float>    positionTimes;
+	std::vector<uint16_t> positions;        ///< 3 values per keyframe.
+	float                 positionMin[3];   ///< The smallest position.
+	float                 positionScale[3]; ///< The size of one quantization step.
+
+	std::vector<float>    orientationTimes;
+	std::vector<uint16_t> orientations; ///< 3 values per keyframe.
+
+	AnimationTrack();
+};
+
 class Animation {
 public:
 	Animation();
@@ -62,15 +126,36 @@ public:
 	float getLength() const;
 	void setLength(float length);
 
+	/** Get the time, in seconds, to blend into this animation from the previous one. */
+	float getTransTime() const;
 	void setTransTime(float transtime);
 
-	/** Update the model position and orientation */
-	virtual void update(Model *model, float lastFrame, float nextFrame, const std::vector<ModelNode *> &modelNodeMap);
+	/** Evaluate the animation at a point in time.
+	 *
+	 *  @param cursors The keyframe cursors of the calling animation channel.
+	 *                 They are resized to fit this animation if necessary.
+	 *  @param pose    Receives the pose. It is resized to fit this animation.
+	 */
+	void sample(Model *model, float time, const std::vector<ModelNode *> &modelNodeMap,
+	            KeyFrameCursors &cursors, AnimationPose &pose);
+
+	/** Move the nodes of the model into a pose evaluated by sample(). */
+	virtual void apply(Model *model, const AnimationPose &pose, float time);
+
+	/** Set up a pose with the current positions and orientations of the nodes this animation moves. */
+	void capturePose(const std::vector<ModelNode *> &modelNodeMap, AnimationPose &pose);
 
 	// Nodes
 
 	void addAnimNode(AnimNode *node);
 
+	/** Move the keyframes of all nodes into quantized tracks.
+	 *
+	 *  Only the first keyframe, the node's base position and orientation,
+	 *  stays in the nodes themselves.
+	 */
+	void compress();
+
 	/** Does the specified node exist? */
 	bool hasNode(const Common::UString &node) const;
 
@@ -90,12 +175,14 @@ protected:
 
 	NodeList rootNodes; ///< The nodes in the state without a parent.
 
+	std::vector<AnimationTrack> _tracks; ///< The keyframes of each node, in nodeList order.
+
 	Common::UString _name; ///< The model's name.
 	float _length;
 	float _transtime;
 
-	glm::vec3 interpolatePosition(ModelNode *animNode, float time) const;
-	glm::quat interpolateOrientation(ModelNode *animNode, float time) const;
+	glm::vec3 interpolatePosition(const AnimationTrack &track, float time, size_t &cursor) const;
+	glm::quat interpolateOrientation(const AnimationTrack &track, float time, size_t &cursor) const;
 };
 
 } // End of namespace Aurora
@@ -27,7 +27,6 @@
 
 #include "src/graphics/aurora/animation.h"
 #include "src/graphics/aurora/animationchannel.h"
-#include "src/graphics/aurora/animnode.h"
 #include "src/graphics/aurora/model.h"
 
 namespace Graphics {
@@ -42,7 +41,9 @@ AnimationChannel::AnimationChannel(Model *model) :
 		_animationLength(1.0f),
 		_animationTime(0.0f),
 		_animationLoopLength(1.0f),
-		_animationLoopTime(0.0f) {
+		_animationLoopTime(0.0f),
+		_transitionTime(0.0f),
+		_transitionLength(0.0f) {
 }
 
 void AnimationChannel::playAnimation(const Common::UString &anim, bool restart, float length, float speed) {
@@ -104,12 +105,14 @@ void AnimationChannel::playDefaultAnimation() {
 	_manageMutex.unlock();
 }
 
-void AnimationChannel::manageAnimations(float dt) {
+void AnimationChannel::manageAnimations(float dt, bool evaluate) {
 	_manageMutex.lock();
 
 	float lastFrame = _animationLoopTime;
 	float nextFrame = _animationLoopTime + _animationSpeed * dt;
 
+	_transitionTime += dt;
+
 	// No animation and no new one scheduled? Select a default one
 	if (!_currentAnimation && !_nextAnimation)
 		playDefaultAnimationInternal();
@@ -131,7 +134,8 @@ void AnimationChannel::manageAnimations(float dt) {
 
 	// The loop of the animation ended: make sure to play the last frame
 	if (lastFrame < _animationLoopLength && nextFrame >= _animationLoopLength) {
-		_currentAnimation->update(_model, lastFrame, _animationLoopLength, _modelNodeMap);
+		if (evaluate)
+			evaluateAnimation(_animationLoopLength);
 
 		_animationTime += dt;
 		_animationLoopTime = _animationLoopLength;
@@ -145,31 +149,36 @@ void AnimationChannel::manageAnimations(float dt) {
 		setCurrentAnimation(_nextAnimation);
 		_nextAnimation = 0;
 
-		if (_currentAnimation)
-			_currentAnimation->update(_model, 0.0f, 0.0f, _modelNodeMap);
+		if (evaluate) {
+			if (_currentAnimation)
+				evaluateAnimation(0.0f);
+
+			_model->createBound();
+		}
 
-		_model->createBound();
 		_manageMutex.unlock();
 		return;
 	}
 
 	// Start the next loop of the animation
 	if (lastFrame >= _animationLoopLength) {
-		_currentAnimation->update(_model, 0.0f, 0.0f, _modelNodeMap);
+		if (evaluate) {
+			evaluateAnimation(0.0f);
+			_model->createBound();
+		}
 
 		lastFrame = 0.0f;
 		nextFrame = _animationSpeed * dt;
-
-		_model->createBound();
 	}
 
 	// Update the animation
-	_currentAnimation->update(_model, lastFrame, nextFrame, _modelNodeMap);
+	if (evaluate)
+		evaluateAnimation(nextFrame);
 
 	_animationTime += dt;
 	_animationLoopTime = nextFrame;
 
-	if (nextFrame == 0.0f)
+	if (evaluate && (nextFrame == 0.0f))
 		_model->createBound();
 
 	_manageMutex.unlock();
@@ -210,62 +219,36 @@ void AnimationChannel::setCurrentAnimation(Animation *anim) {
 	if (!_model->_currentState)
 		return;
 
+	Animation *previous = _currentAnimation;
+
 	_currentAnimation = anim;
 	_animationLoopTime = 0.0f;
 
-	if (_currentAnimation)
-		makeModelNodeMap();
-}
-
-void AnimationChannel::makeModelNodeMap() {
-	const std::list<AnimNode *> &animNodes = _currentAnimation->getNodes();
-	int maxNodeNumber = -1;
-
-	for (std::list<AnimNode *>::const_iterator n = animNodes.begin();
-			n != animNodes.end(); ++n) {
-		int nodeNumber = (*n)->getNodeData()->getNodeNumber();
-		if (nodeNumber > maxNodeNumber)
-			maxNodeNumber = nodeNumber;
-	}
+	_keyFrameCursors.clear();
 
-	_modelNodeMap.clear();
+	_transitionTime   = 0.0f;
+	_transitionLength = 0.0f;
 
-	if (maxNodeNumber == -1)
+	if (!_currentAnimation)
 		return;
 
-	_modelNodeMap.resize(maxNodeNumber + 1, 0);
+	_model->getAnimationNodeMap(*_currentAnimation, _modelNodeMap);
 
-	for (std::list<AnimNode *>::const_iterator an = animNodes.begin();
-			an != animNodes.end(); ++an) {
-		ModelNode *animNode = (*an)->getNodeData();
-		int nodeNumber = animNode->getNodeNumber();
-		const Common::UString &animNodeName = animNode->getName();
+	// Blend from wherever the previous animation left the nodes
+	if (previous && (_currentAnimation->getTransTime() > 0.0f)) {
+		_currentAnimation->capturePose(_modelNodeMap, _transitionPose);
 
-		// Search for the corresponding node in this model
-		Model::NodeMap::iterator n = _model->_currentState->nodeMap.find(animNodeName);
-		if (n != _model->_currentState->nodeMap.end()) {
-			_modelNodeMap[nodeNumber] = n->second;
-			continue;
-		}
+		_transitionLength = _currentAnimation->getTransTime();
+	}
+}
 
-		// Search for the corresponding node in this model's attached models
-		for (std::map<Common::UString, Model *>::iterator m = _model->_attachedModels.begin();
-				m != _model->_attachedModels.end(); ++m) {
-			Model::State *state = m->second->_currentState;
-			if (!state)
-				continue;
-
-			n = state->nodeMap.find(animNodeName);
-			if (n != state->nodeMap.end()) {
-				_modelNodeMap[nodeNumber] = n->second;
-				break;
-			}
-		}
+void AnimationChannel::evaluateAnimation(float time) {
+	_currentAnimation->sample(_model, time, _modelNodeMap, _keyFrameCursors, _pose);
 
-		// Search for the corresponding node in this model's super model
-		if (_model->_superModel && !_modelNodeMap[nodeNumber])
-			_modelNodeMap[nodeNumber] = _model->_superModel->getNode(animNodeName);
-	}
+	if (_transitionTime < _transitionLength)
+		_pose.blend(_transitionPose, _transitionTime / _transitionLength);
+
+	_currentAnimation->apply(_model, _pose, time);
 }
 
 } // End of namespace Aurora
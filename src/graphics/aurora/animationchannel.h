@@ -30,6 +30,8 @@
 
 #include "src/common/mutex.h"
 
+#include "src/graphics/aurora/animation.h"
+
 namespace Graphics {
 
 namespace Aurora {
@@ -73,7 +75,12 @@ public:
 
 	// '---
 
-	void manageAnimations(float dt);
+	/** Advance the current animation by dt seconds.
+	 *
+	 *  If evaluate is false, only the animation clock is advanced and
+	 *  no node is touched. The next evaluated update catches up.
+	 */
+	void manageAnimations(float dt, bool evaluate = true);
 private:
 	struct DefaultAnimation {
 		Animation *animation;
@@ -92,12 +99,20 @@ private:
 	float _animationLoopTime; ///< The time the current loop of the current animation has played.
 	DefaultAnimations _defaultAnimations;
 	std::vector<ModelNode *> _modelNodeMap;
+	KeyFrameCursors _keyFrameCursors; ///< Keyframe positions within the current animation.
 	std::recursive_mutex _manageMutex;
 
+	AnimationPose _pose;           ///< The pose of the current animation.
+	AnimationPose _transitionPose; ///< The pose the current animation blends in from.
+	float _transitionTime;         ///< The time the transition into the current animation has run.
+	float _transitionLength;       ///< The length of the transition into the current animation.
+
 	void playDefaultAnimationInternal();
 	Animation *selectDefaultAnimation();
 	void setCurrentAnimation(Animation *anim);
-	void makeModelNodeMap();
+
+	/** Move the nodes into the pose of the current animation, blending in from the previous one. */
+	void evaluateAnimation(float time);
 };
 
 } // End of namespace Aurora
@@ -24,8 +24,13 @@
 
 #include "external/glm/gtc/type_ptr.hpp"
 
+#include "src/common/util.h"
+#include "src/common/profiler.h"
+#include "src/common/threadpool.h"
+
 #include "src/events/events.h"
 
+#include "src/graphics/graphics.h"
 #include "src/graphics/camera.h"
 
 #include "src/graphics/aurora/animationthread.h"
@@ -38,6 +43,11 @@ namespace Aurora {
 const int kPauseDuration = 10;
 const int kYieldDuration = 1;
 
+/** Models smaller than this many pixels on screen don't have their poses updated. */
+const float kFrozenPixelSize = 4.0f;
+/** Number of loop iterations to skip for models whose pose isn't updated. */
+const uint8_t kFrozenIterationsToSkip = 16;
+
 AnimationThread::PoolModel::PoolModel(Model *m) : model(m) {
 }
 
@@ -56,17 +66,27 @@ void AnimationThread::resume() {
 void AnimationThread::registerModel(Model *model) {
 	if (_pause.load(std::memory_order_seq_cst) == kPausePaused) {
 		registerModelInternal(model);
-	} else {
-		std::lock_guard<std::recursive_mutex> lock(_registerMutex);
-		_registerQueue.push(model);
+		return;
 	}
+
+	if (_registerQueue.push(model))
+		return;
+
+	// The queue is full. Register the model directly, like unregisterModel() does
+	std::lock_guard<std::recursive_mutex> lock(_modelsMutex);
+
+	registerQueuedModels();
+	registerModelInternal(model);
 }
 
 void AnimationThread::unregisterModel(Model *model) {
+	// Make sure a still queued registration can't add the model back afterwards
 	if (_pause.load(std::memory_order_seq_cst) == kPausePaused) {
+		registerQueuedModels();
 		unregisterModelInternal(model);
 	} else {
 		std::lock_guard<std::recursive_mutex> lock(_modelsMutex);
+		registerQueuedModels();
 		unregisterModelInternal(model);
 	}
 }
@@ -83,13 +103,15 @@ void AnimationThread::flush() {
 	}
 
 	for (auto &m : _models) {
-		m.second.model->flushNodeBuffers();
+		m.model->flushNodeBuffers();
 	}
 
 	_flush.store(kFlushReady, std::memory_order_seq_cst);
 }
 
 void AnimationThread::threadMethod() {
+	createWorkRanges();
+
 	while (!_killThread.load(std::memory_order_relaxed)) {
 		if (EventMan.quitRequested())
 			break;
@@ -108,62 +130,153 @@ void AnimationThread::threadMethod() {
 			continue;
 		}
 
-		for (auto &m : _models) {
-			if (EventMan.quitRequested() || (_pause.load(std::memory_order_seq_cst) == kPausePaused))
-				break;
+		updateModels();
+	}
+}
+
+void AnimationThread::createWorkRanges() {
+	_rangeCount = ThreadPoolMan.getThreadCount();
+	_ranges.reset(new WorkRange[_rangeCount]);
+}
 
-			if (m.second.skippedCount < getNumIterationsToSkip(m.second.model)) {
-				++m.second.skippedCount;
-				continue;
-			} else {
-				m.second.skippedCount = 0;
-			}
+void AnimationThread::updateModels() {
+	PROFILE_ZONE("AnimationThread::updateModels");
 
-			handleFlush();
+	// Give every worker an equal, contiguous slice of the models
+	const size_t count = _models.size();
+	for (size_t i = 0; i < _rangeCount; i++) {
+		_ranges[i].next.store((count * i) / _rangeCount, std::memory_order_relaxed);
+		_ranges[i].end = (count * (i + 1)) / _rangeCount;
+	}
 
-			uint32_t now = EventMan.getTimestamp();
-			float dt = 0;
-			if (m.second.lastChanged > 0) {
-				dt = (now - m.second.lastChanged) / 1000.0f;
-			}
-			m.second.lastChanged = now;
+	do {
+		ThreadPoolMan.parallelFor(_rangeCount, [this](size_t index) {
+			processModels(index);
+		});
 
-			m.second.model->manageAnimations(dt);
-		}
+		// Nobody is working on the models now, so the renderer can safely flush
+		handleFlush();
+
+	} while (!EventMan.quitRequested() && (_pause.load(std::memory_order_seq_cst) != kPausePaused) &&
+	         hasUnclaimedModels());
+}
+
+void AnimationThread::processModels(size_t index) {
+	size_t model;
+	while (!shouldInterruptWork() && claimModel(index, model))
+		updateModel(_models[model]);
+}
+
+bool AnimationThread::claimModel(size_t index, size_t &model) {
+	// Take the next model from our own slice first, then steal from the others
+	for (size_t i = 0; i < _rangeCount; i++) {
+		WorkRange &range = _ranges[(index + i) % _rangeCount];
+
+		if (range.next.load(std::memory_order_relaxed) >= range.end)
+			continue;
+
+		model = range.next.fetch_add(1, std::memory_order_relaxed);
+		if (model < range.end)
+			return true;
 	}
+
+	return false;
 }
 
-void AnimationThread::registerQueuedModels() {
-	std::unique_lock<std::recursive_mutex> lock(_registerMutex, std::try_to_lock);
-	if (!lock.owns_lock())
+bool AnimationThread::hasUnclaimedModels() const {
+	for (size_t i = 0; i < _rangeCount; i++)
+		if (_ranges[i].next.load(std::memory_order_relaxed) < _ranges[i].end)
+			return true;
+
+	return false;
+}
+
+bool AnimationThread::shouldInterruptWork() const {
+	return (_flush.load(std::memory_order_seq_cst) == kFlushRequested) ||
+	       (_pause.load(std::memory_order_seq_cst) == kPausePaused) ||
+	       EventMan.quitRequested();
+}
+
+void AnimationThread::updateModel(PoolModel &model) {
+	float x, y, z;
+	model.model->getPosition(x, y, z);
+
+	const float distance = glm::distance(glm::make_vec3(CameraMan.getPosition()), glm::vec3(x, y, z));
+	const AnimationLOD lod = getAnimationLOD(model.model, distance);
+	const bool evaluate = lod == kAnimationLODFull;
+
+	// A model that just became visible gets its pose updated right away
+	const bool catchUp = evaluate && !model.evaluated;
+
+	if (!catchUp && (model.skippedCount < getNumIterationsToSkip(lod, distance))) {
+		++model.skippedCount;
 		return;
+	}
+
+	model.skippedCount = 0;
 
-	while (!_registerQueue.empty()) {
-		registerModelInternal(_registerQueue.front());
-		_registerQueue.pop();
+	uint32_t now = EventMan.getTimestamp();
+	float dt = 0;
+	if (model.lastChanged > 0) {
+		dt = (now - model.lastChanged) / 1000.0f;
 	}
+	model.lastChanged = now;
+
+	model.evaluated = evaluate;
+	model.model->manageAnimations(dt, evaluate);
+}
+
+void AnimationThread::registerQueuedModels() {
+	// Only ever called with _modelsMutex held, or while paused, so this is the single consumer
+	Model *model;
+	while (_registerQueue.pop(model))
+		registerModelInternal(model);
 }
 
 void AnimationThread::registerModelInternal(Model *model) {
-	ModelMap::iterator it = _models.find(model->getID());
-	if (it != _models.end())
+	if (_modelIndices.find(model->getID()) != _modelIndices.end())
 		return;
 
-	_models.insert(std::make_pair(model->getID(), PoolModel(model)));
+	_modelIndices.insert(std::make_pair(model->getID(), _models.size()));
+	_models.push_back(PoolModel(model));
 }
 
 void AnimationThread::unregisterModelInternal(Model *model) {
-	_models.erase(model->getID());
+	ModelIndexMap::iterator it = _modelIndices.find(model->getID());
+	if (it == _modelIndices.end())
+		return;
+
+	// Keep the array contiguous by moving the last model into the gap
+	const size_t index = it->second;
+	_modelIndices.erase(it);
+
+	if (index != _models.size() - 1) {
+		_models[index] = _models.back();
+		_modelIndices[_models[index].model->getID()] = index;
+	}
+
+	_models.pop_back();
 }
 
-uint8_t AnimationThread::getNumIterationsToSkip(Model *model) const {
-	const float *campos = CameraMan.getPosition();
+AnimationThread::AnimationLOD AnimationThread::getAnimationLOD(Model *model, float distance) const {
+	if (!model->wasRenderedLastFrame())
+		return kAnimationLODHidden;
 
-	float x, y, z;
-	model->getPosition(x, y, z);
+	// GUI models aren't seen through the perspective projection
+	if (model->getType() == kModelTypeObject) {
+		const float size = MAX(MAX(model->getWidth(), model->getHeight()), model->getDepth());
+		if (GfxMan.getProjectedSize(size, distance) < kFrozenPixelSize)
+			return kAnimationLODFrozen;
+	}
+
+	return kAnimationLODFull;
+}
+
+uint8_t AnimationThread::getNumIterationsToSkip(AnimationLOD lod, float distance) const {
+	if (lod != kAnimationLODFull)
+		return kFrozenIterationsToSkip;
 
-	float dist = glm::distance(glm::make_vec3(campos), glm::vec3(x, y, z));
-	return roundf(dist) / 8.0f;
+	return MIN(roundf(distance) / 8.0f, 255.0f);
 }
 
 bool AnimationThread::handlePause() {
@@ -25,15 +25,17 @@
 #ifndef GRAPHICS_AURORA_ANIMATIONTHREAD_H
 #define GRAPHICS_AURORA_ANIMATIONTHREAD_H
 
-#include <map>
-#include <queue>
+#include <vector>
+#include <memory>
 #include <atomic>
+#include <unordered_map>
 
 #include "external/glm/vec3.hpp"
 #include "external/glm/vec4.hpp"
 
 #include "src/common/thread.h"
 #include "src/common/mutex.h"
+#include "src/common/mpscqueue.h"
 
 namespace Graphics {
 
@@ -41,6 +43,21 @@ namespace Aurora {
 
 class Model;
 
+/** The dedicated animation thread.
+ *
+ *  Models are updated on the shared thread pool, with the animation thread
+ *  itself helping out. Each pool thread starts on its own slice of the model
+ *  array and steals single models from the other slices once its own slice
+ *  is done.
+ *
+ *  Whenever the renderer requests a flush, all workers stop at the next
+ *  model, so that flush() always sees a consistent state.
+ *
+ *  How much work a model gets depends on its level of detail: models far
+ *  from the camera are updated less often, and models that weren't rendered
+ *  in the last frame, or that are only a few pixels tall, only have their
+ *  animation clocks advanced, without evaluating or skinning any nodes.
+ */
 class AnimationThread : public Common::Thread {
 public:
 	void pause();
@@ -69,25 +86,45 @@ private:
 		kFlushInProgress
 	};
 
+	/** Level of detail of a model's animations. */
+	enum AnimationLOD {
+		kAnimationLODFull,   ///< Evaluate the animations, at a distance-based rate.
+		kAnimationLODFrozen, ///< Too small on screen. Keep the current pose.
+		kAnimationLODHidden  ///< Not rendered in the last frame. Keep the current pose.
+	};
+
 	struct PoolModel {
 		Model *model;
 		uint32_t lastChanged { 0 };
 		uint8_t skippedCount { 0 }; ///< Number of skipped loop iterations.
+		bool evaluated { false };   ///< Was the pose evaluated in the last update?
 
 		PoolModel(Model *m);
 	};
 
-	typedef std::map<uint32_t, PoolModel> ModelMap;
-	typedef std::queue<Model *> ModelQueue;
+	/** A slice of the model array, claimed by the workers one model at a time. */
+	struct WorkRange {
+		std::atomic<size_t> next { 0 };
+		size_t end { 0 };
+	};
 
-	ModelMap _models;
-	ModelQueue _registerQueue;
+	typedef std::vector<PoolModel> ModelArray;
+	typedef std::unordered_map<uint32_t, size_t> ModelIndexMap;
+	typedef Common::MPSCQueue<Model *> ModelQueue;
+
+	ModelArray _models;          ///< All models in the processing pool.
+	ModelIndexMap _modelIndices; ///< Index into _models, by model ID.
+	ModelQueue _registerQueue { 1024 }; ///< Models waiting to be added to the processing pool.
 
 	std::atomic<PauseStatus> _pause { kPauseResumed };
 	std::atomic<FlushStatus> _flush { kFlushReady };
 
-	std::recursive_mutex _modelsMutex;   ///< Mutex protecting access to the model map.
-	std::recursive_mutex _registerMutex; ///< Mutex protecting access to the registration queue.
+	std::recursive_mutex _modelsMutex; ///< Mutex protecting access to the model map.
+
+	// Work distribution
+
+	std::unique_ptr<WorkRange[]> _ranges; ///< One slice per pool thread, including the animation thread.
+	size_t _rangeCount { 0 };
 
 	// Model registration
 
@@ -97,7 +134,20 @@ private:
 
 
 	void threadMethod();
-	uint8_t getNumIterationsToSkip(Model *model) const;
+
+	void createWorkRanges();
+
+	/** Update all models, on the thread pool. */
+	void updateModels();
+	/** Update models until none are left, or until the workers need to stop. */
+	void processModels(size_t index);
+	bool claimModel(size_t index, size_t &model);
+	bool hasUnclaimedModels() const;
+	bool shouldInterruptWork() const;
+	void updateModel(PoolModel &model);
+
+	AnimationLOD getAnimationLOD(Model *model, float distance) const;
+	uint8_t getNumIterationsToSkip(AnimationLOD lod, float distance) const;
 	bool handlePause();
 	void handleFlush();
 };
@@ -0,0 +1,253 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  An on-disk cache of parsed NWN ASCII models.
+ */
+
+#include <cstring>
+
+#include "src/common/error.h"
+#include "src/common/util.h"
+#include "src/common/hash.h"
+#include "src/common/encoding.h"
+#include "src/common/readstream.h"
+#include "src/common/writefile.h"
+#include "src/common/mappedfile.h"
+#include "src/common/filepath.h"
+#include "src/common/configvalue.h"
+
+#include "src/graphics/aurora/asciimodelcache.h"
+
+static const uint32_t kCacheID      = MKTAG('X', 'M', 'D', 'C');
+static const uint32_t kCacheVersion = 1;
+
+static const Common::ConfigValue<bool> kConfigEnabled("modelcache", false);
+
+namespace Graphics {
+
+namespace Aurora {
+
+static void readString(Common::SeekableReadStream &cache, Common::UString &string) {
+	const uint32_t length = cache.readUint32LE();
+	if (length > (cache.size() - cache.pos()))
+		throw Common::Exception("Model cache file truncated");
+
+	string = Common::readStringFixed(cache, Common::kEncodingUTF8, length);
+}
+
+static void readArray(Common::SeekableReadStream &cache, std::vector<uint32_t> &data) {
+	const uint32_t count = cache.readUint32LE();
+	if (count > ((cache.size() - cache.pos()) / 4))
+		throw Common::Exception("Model cache file truncated");
+
+	data.resize(count);
+	for (std::vector<uint32_t>::iterator d = data.begin(); d != data.end(); ++d)
+		*d = cache.readUint32LE();
+}
+
+static void readArray(Common::SeekableReadStream &cache, std::vector<float> &data) {
+	const uint32_t count = cache.readUint32LE();
+	if (count > ((cache.size() - cache.pos()) / 4))
+		throw Common::Exception("Model cache file truncated");
+
+	data.resize(count);
+	for (std::vector<float>::iterator d = data.begin(); d != data.end(); ++d)
+		*d = cache.readIEEEFloatLE();
+}
+
+static void writeString(Common::WriteStream &cache, const Common::UString &string) {
+	const size_t length = std::strlen(string.c_str());
+
+	cache.writeUint32LE(length);
+	cache.write(string.c_str(), length);
+}
+
+static void writeArray(Common::WriteStream &cache, const std::vector<uint32_t> &data) {
+	cache.writeUint32LE(data.size());
+	for (std::vector<uint32_t>::const_iterator d = data.begin(); d != data.end(); ++d)
+		cache.writeUint32LE(*d);
+}
+
+static void writeArray(Common::WriteStream &cache, const std::vector<float> &data) {
+	cache.writeUint32LE(data.size());
+	for (std::vector<float>::const_iterator d = data.begin(); d != data.end(); ++d)
+		cache.writeIEEEFloatLE(*d);
+}
+
+
+ASCIIModel::Node::Node() : hasMesh(false), dangly(false), render(true), transparencyHint(false),
+	vertexCount(0) {
+
+	position[0] = 0.0f; position[1] = 0.0f; position[2] = 0.0f;
+
+	orientation[0] = 0.0f;
+	orientation[1] = 0.0f;
+	orientation[2] = 0.0f;
+	orientation[3] = 0.0f;
+}
+
+ASCIIModel::ASCIIModel() : animationScale(1.0f) {
+}
+
+
+bool ASCIIModelCache::isEnabled() {
+	return kConfigEnabled.get();
+}
+
+uint64_t ASCIIModelCache::hash(Common::SeekableReadStream &mdl) {
+	return Common::hashStreamFNV64(mdl);
+}
+
+Common::UString ASCIIModelCache::getDirectory() {
+	return Common::FilePath::getUserDataDirectory() + "/modelcache";
+}
+
+Common::UString ASCIIModelCache::getFileName(uint64_t key) {
+	return getDirectory() + "/" + Common::formatHash(key) + ".xmc";
+}
+
+bool ASCIIModelCache::load(uint64_t key, ASCIIModel &model) {
+	if (!isEnabled())
+		return false;
+
+	const Common::UString fileName = getFileName(key);
+	if (!Common::FilePath::isRegularFile(fileName))
+		return false;
+
+	try {
+		Common::MappedReadStream cache(fileName);
+
+		if ((cache.readUint32BE() != kCacheID) || (cache.readUint32LE() != kCacheVersion))
+			throw Common::Exception("Not a model cache file");
+
+		if (cache.readUint64LE() != key)
+			throw Common::Exception("Model cache key mismatch");
+
+		ASCIIModel cached;
+
+		readString(cache, cached.name);
+		readString(cache, cached.superModelName);
+
+		cached.animationScale = cache.readIEEEFloatLE();
+
+		const uint32_t nodeCount = cache.readUint32LE();
+		if (nodeCount > (cache.size() - cache.pos()))
+			throw Common::Exception("Model cache file truncated");
+
+		cached.nodes.resize(nodeCount);
+		for (std::vector<ASCIIModel::Node>::iterator n = cached.nodes.begin(); n != cached.nodes.end(); ++n) {
+			readString(cache, n->name);
+			readString(cache, n->parent);
+
+			const byte flags = cache.readByte();
+
+			n->hasMesh          = (flags & 0x01) != 0;
+			n->dangly           = (flags & 0x02) != 0;
+			n->render           = (flags & 0x04) != 0;
+			n->transparencyHint = (flags & 0x08) != 0;
+
+			for (size_t i = 0; i < 3; i++)
+				n->position[i] = cache.readIEEEFloatLE();
+			for (size_t i = 0; i < 4; i++)
+				n->orientation[i] = cache.readIEEEFloatLE();
+
+			const uint32_t textureCount = cache.readUint32LE();
+			if (textureCount > (cache.size() - cache.pos()))
+				throw Common::Exception("Model cache file truncated");
+
+			n->textures.resize(textureCount);
+			for (std::vector<Common::UString>::iterator t = n->textures.begin(); t != n->textures.end(); ++t)
+				readString(cache, *t);
+
+			n->vertexCount = cache.readUint32LE();
+
+			readArray(cache, n->vertices);
+			readArray(cache, n->indices);
+
+			if (n->vertices.size() != (n->vertexCount * (6 + 2 * n->textures.size())))
+				throw Common::Exception("Invalid model cache layout");
+
+			for (std::vector<uint32_t>::const_iterator i = n->indices.begin(); i != n->indices.end(); ++i)
+				if (*i >= n->vertexCount)
+					throw Common::Exception("Invalid model cache layout");
+		}
+
+		model = std::move(cached);
+		return true;
+
+	} catch (...) {
+		// We'll parse the model again and overwrite the broken file
+		Common::exceptionDispatcherWarning("Failed reading model cache file \"%s\"", fileName.c_str());
+	}
+
+	return false;
+}
+
+void ASCIIModelCache::save(uint64_t key, const ASCIIModel &model) {
+	if (!isEnabled())
+		return;
+
+	const Common::UString fileName = getFileName(key);
+
+	try {
+		Common::writeFileAtomically(fileName, [&model, key](Common::WriteStream &cache) {
+			cache.writeUint32BE(kCacheID);
+			cache.writeUint32LE(kCacheVersion);
+			cache.writeUint64LE(key);
+
+			writeString(cache, model.name);
+			writeString(cache, model.superModelName);
+
+			cache.writeIEEEFloatLE(model.animationScale);
+
+			cache.writeUint32LE(model.nodes.size());
+			for (std::vector<ASCIIModel::Node>::const_iterator n = model.nodes.begin(); n != model.nodes.end(); ++n) {
+				writeString(cache, n->name);
+				writeString(cache, n->parent);
+
+				cache.writeByte((n->hasMesh          ? 0x01 : 0x00) |
+				                (n->dangly           ? 0x02 : 0x00) |
+				                (n->render           ? 0x04 : 0x00) |
+				                (n->transparencyHint ? 0x08 : 0x00));
+
+				for (size_t i = 0; i < 3; i++)
+					cache.writeIEEEFloatLE(n->position[i]);
+				for (size_t i = 0; i < 4; i++)
+					cache.writeIEEEFloatLE(n->orientation[i]);
+
+				cache.writeUint32LE(n->textures.size());
+				for (std::vector<Common::UString>::const_iterator t = n->textures.begin(); t != n->textures.end(); ++t)
+					writeString(cache, *t);
+
+				cache.writeUint32LE(n->vertexCount);
+
+				writeArray(cache, n->vertices);
+				writeArray(cache, n->indices);
+			}
+		});
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed writing model cache file \"%s\"", fileName.c_str());
+	}
+}
+
+} // End of namespace Aurora
+
+} // End of namespace Graphics
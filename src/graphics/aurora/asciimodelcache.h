@@ -0,0 +1,109 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  An on-disk cache of parsed NWN ASCII models.
+ */
+
+#ifndef GRAPHICS_AURORA_ASCIIMODELCACHE_H
+#define GRAPHICS_AURORA_ASCIIMODELCACHE_H
+
+#include <vector>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+
+namespace Common {
+	class SeekableReadStream;
+}
+
+namespace Graphics {
+
+namespace Aurora {
+
+/** The parsed contents of an NWN ASCII model, ready to be turned into model nodes. */
+struct ASCIIModel {
+	/** A node, with its mesh already converted into vertex and index buffer contents. */
+	struct Node {
+		Common::UString name;
+		Common::UString parent; ///< Name of the parent node. Empty if none was given.
+
+		bool hasMesh;          ///< Is this a trimesh, danglymesh or skin node?
+		bool dangly;           ///< Is this a danglymesh node?
+		bool render;           ///< Render the mesh?
+		bool transparencyHint; ///< Does the mesh need to be rendered as transparent?
+
+		float position   [3];
+		float orientation[4]; ///< Rotation axis and angle in degrees.
+
+		std::vector<Common::UString> textures;
+
+		uint32_t vertexCount;
+		std::vector<float>    vertices; ///< Position, normal and a texture coordinate pair per texture.
+		std::vector<uint32_t> indices;
+
+		Node();
+	};
+
+	Common::UString name;
+	Common::UString superModelName;
+
+	float animationScale;
+
+	std::vector<Node> nodes;
+
+	ASCIIModel();
+};
+
+/** An on-disk cache of parsed NWN ASCII models.
+ *
+ *  Many community modules and hakpaks come with models in the ASCII
+ *  variant of the MDL format, which is slow to tokenize and needs its
+ *  vertices deduplicated. When enabled with the "modelcache" config option,
+ *  the finished vertex and index data of every node is stored in the user
+ *  data directory, keyed by a hash of the MDL, and read back out of a
+ *  memory-mapped file the next time the model is loaded.
+ */
+class ASCIIModelCache {
+public:
+	/** Is the model cache enabled? */
+	static bool isEnabled();
+
+	/** Create a cache key out of the contents of an MDL. The stream position is kept. */
+	static uint64_t hash(Common::SeekableReadStream &mdl);
+
+	/** Load the model with this key out of the cache.
+	 *
+	 *  @return true if the model was found in the cache, false otherwise.
+	 */
+	static bool load(uint64_t key, ASCIIModel &model);
+	/** Store this freshly parsed model in the cache. */
+	static void save(uint64_t key, const ASCIIModel &model);
+
+private:
+	static Common::UString getDirectory();
+	static Common::UString getFileName(uint64_t key);
+};
+
+} // End of namespace Aurora
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_AURORA_ASCIIMODELCACHE_H
@@ -26,8 +26,11 @@
 #include <cassert>
 #include <cfloat>
 
+#include "src/graphics/graphics.h"
+
 #include "src/graphics/aurora/textureman.h"
 #include "src/graphics/aurora/borderquad.h"
+#include "src/graphics/aurora/guiquadbatch.h"
 
 namespace Graphics {
 
@@ -71,10 +74,14 @@ BorderQuad::BorderQuad(const Common::UString &edge, const Common::UString &corne
 }
 
 void BorderQuad::setColor(float r, float g, float b, float a) {
+	lockFrameIfVisible();
+
 	_r = r;
 	_g = g;
 	_b = b;
 	_a = a;
+
+	unlockFrameIfVisible();
 }
 
 void BorderQuad::setPosition(float x, float y, float z) {
@@ -95,6 +102,8 @@ void BorderQuad::getPosition(float &x, float &y, float &z) {
 }
 
 void BorderQuad::setSize(float w, float h) {
+	lockFrameIfVisible();
+
 	_w = std::floor(w);
 	_h = std::floor(h);
 
@@ -103,6 +112,8 @@ void BorderQuad::setSize(float w, float h) {
 	} else {
 		_verticalCut = false;
 	}
+
+	unlockFrameIfVisible();
 }
 
 void BorderQuad::getSize(float &w, float &h) const {
@@ -113,6 +124,49 @@ void BorderQuad::getSize(float &w, float &h) const {
 void BorderQuad::calculateDistance() {
 }
 
+RenderBatch *BorderQuad::getRenderBatch() {
+	// The vertical cut needs a scissor test
+	if (_verticalCut)
+		return 0;
+
+	return &GUIQuadBatcher;
+}
+
+bool BorderQuad::isRetainable() const {
+	return true;
+}
+
+void BorderQuad::getQuads(float positions[8][8], float texCoords[8][8]) const {
+	const float x1 = _x, x2 = _x + _cornerWidth, x3 = _x + _w - _cornerWidth, x4 = _x + _w;
+	const float y1 = _y, y2 = _y + _cornerHeight, y3 = _y + _h - _cornerHeight, y4 = _y + _h;
+
+	const float quads[8][16] = {
+		// Upper left corner
+		{ x1, y3, x2, y3, x2, y4, x1, y4,   0, 0, 1, 0, 1, 1, 0, 1 },
+		// Upper right corner
+		{ x3, y3, x4, y3, x4, y4, x3, y4,   1, 0, 1, 1, 0, 1, 0, 0 },
+		// Lower left corner
+		{ x1, y1, x2, y1, x2, y2, x1, y2,   0, 1, 1, 1, 1, 0, 0, 0 },
+		// Lower right corner
+		{ x3, y1, x4, y1, x4, y2, x3, y2,   0, 0, 0, 1, 1, 1, 1, 0 },
+		// Lower edge
+		{ x2, y1, x3, y1, x3, _y + _edgeHeight, x2, _y + _edgeHeight,   0, 1, 1, 1, 1, 0, 0, 0 },
+		// Left edge
+		{ _x + _w - _edgeWidth, y2, x4, y2, x4, y3, _x + _w - _edgeWidth, y3,   0, 0, 0, 1, 1, 1, 1, 0 },
+		// Right edge
+		{ x1, y2, x2, y2, x2, y3, x1, y3,   0, 1, 0, 0, 1, 0, 1, 1 },
+		// Upper Edge
+		{ x2, _y + _h - _edgeHeight, x3, _y + _h - _edgeHeight, x3, y4, x2, y4,   1, 0, 0, 0, 0, 1, 1, 1 }
+	};
+
+	for (size_t i = 0; i < 8; i++) {
+		for (size_t j = 0; j < 8; j++) {
+			positions[i][j] = quads[i][j];
+			texCoords[i][j] = quads[i][8 + j];
+		}
+	}
+}
+
 void BorderQuad::render(RenderPass pass) {
 	bool isTransparent = (!_corner.empty() && _corner.getTexture().hasAlpha()) ||
 	                     (!_edge.empty() && _edge.getTexture().hasAlpha());
@@ -120,121 +174,51 @@ void BorderQuad::render(RenderPass pass) {
 			((pass == kRenderPassTransparent) && !isTransparent))
 		return;
 
-	TextureMan.set(_corner);
+	float positions[8][8], texCoords[8][8];
+	getQuads(positions, texCoords);
 
-	glColor4f(_r, _g, _b, _a);
+	// The first 4 quads are the corners, the last 4 the edges
+	const bool batched = GfxMan.getRenderBatch() == &GUIQuadBatcher;
 
-	// Upper left corner
-	glBegin(GL_QUADS);
-	glTexCoord2f(0, 0);
-	glVertex2f(_x, _y + _h - _cornerHeight);
-	glTexCoord2f(1, 0);
-	glVertex2f(_x + _cornerWidth, _y + _h - _cornerHeight);
-	glTexCoord2f(1, 1);
-	glVertex2f(_x + _cornerWidth, _y + _h);
-	glTexCoord2f(0, 1);
-	glVertex2f(_x, _y + _h);
-	glEnd();
-
-	// Upper right corner
-	glBegin(GL_QUADS);
-	glTexCoord2f(1, 0);
-	glVertex2f(_x + _w - _cornerWidth, _y + _h - _cornerHeight);
-	glTexCoord2f(1, 1);
-	glVertex2f(_x + _w, _y + _h - _cornerHeight);
-	glTexCoord2f(0, 1);
-	glVertex2f(_x + _w, _y + _h);
-	glTexCoord2f(0, 0);
-	glVertex2f(_x + _w - _cornerWidth, _y + _h);
-	glEnd();
-
-	if (_verticalCut) {
-		glEnable(GL_SCISSOR_TEST);
-		GLint viewport[4];
-		glGetIntegerv(GL_VIEWPORT, viewport);
-		glScissor(
-				viewport[2]/2 + _x, viewport[3]/2 + _y,
-				_w, _h - _edgeHeight
-		);
-	}
+	size_t quad = 0;
+	if (batched) {
+		for (; quad < 8; quad++)
+			if (!GUIQuadBatcher.add((quad < 4) ? _corner : _edge, positions[quad], texCoords[quad], _r, _g, _b, _a))
+				break;
 
-	// Lower left corner
-	glBegin(GL_QUADS);
-	glTexCoord2f(0, 1);
-	glVertex2f(_x, _y);
-	glTexCoord2f(1, 1);
-	glVertex2f(_x + _cornerWidth, _y);
-	glTexCoord2f(1, 0);
-	glVertex2f(_x + _cornerWidth, _y + _cornerHeight);
-	glTexCoord2f(0, 0);
-	glVertex2f(_x, _y + _cornerHeight);
-	glEnd();
-
-	// Lower right corner
-	glBegin(GL_QUADS);
-	glTexCoord2f(0, 0);
-	glVertex2f(_x + _w - _cornerWidth, _y);
-	glTexCoord2f(0, 1);
-	glVertex2f(_x + _w, _y);
-	glTexCoord2f(1, 1);
-	glVertex2f(_x + _w, _y + _cornerHeight);
-	glTexCoord2f(1, 0);
-	glVertex2f(_x + _w - _cornerWidth, _y + _cornerHeight);
-	glEnd();
-
-	TextureMan.set(_edge);
-
-	// Lower edge
-	glBegin(GL_QUADS);
-	glTexCoord2f(0, 1);
-	glVertex2f(_x + _cornerWidth, _y);
-	glTexCoord2f(1, 1);
-	glVertex2f(_x + _w - _cornerWidth, _y);
-	glTexCoord2f(1, 0);
-	glVertex2f(_x + _w - _cornerWidth, _y + _edgeHeight);
-	glTexCoord2f(0, 0);
-	glVertex2f(_x + _cornerWidth, _y + _edgeHeight);
-	glEnd();
-
-	if (_verticalCut) {
-		glDisable(GL_SCISSOR_TEST);
+		if (quad == 8)
+			return;
 	}
 
-	// Left edge
-	glBegin(GL_QUADS);
-	glTexCoord2f(0, 0);
-	glVertex2f(_x + _w - _edgeWidth, _y + _cornerHeight);
-	glTexCoord2f(0, 1);
-	glVertex2f(_x + _w, _y + _cornerHeight);
-	glTexCoord2f(1, 1);
-	glVertex2f(_x + _w, _y + _h - _cornerHeight);
-	glTexCoord2f(1, 0);
-	glVertex2f(_x + _w - _edgeWidth, _y + _h - _cornerHeight);
-	glEnd();
-
-	// Right edge
-	glBegin(GL_QUADS);
-	glTexCoord2f(0, 1);
-	glVertex2f(_x, _y + _cornerHeight);
-	glTexCoord2f(0, 0);
-	glVertex2f(_x + _cornerWidth, _y + _cornerHeight);
-	glTexCoord2f(1, 0);
-	glVertex2f(_x + _cornerWidth, _y + _h - _cornerHeight);
-	glTexCoord2f(1, 1);
-	glVertex2f(_x, _y + _h - _cornerHeight);
-	glEnd();
-
-	// Upper Edge
-	glBegin(GL_QUADS);
-	glTexCoord2f(1, 0);
-	glVertex2f(_x + _cornerWidth, _y + _h - _edgeHeight);
-	glTexCoord2f(0, 0);
-	glVertex2f(_x + _w - _cornerWidth, _y + _h - _edgeHeight);
-	glTexCoord2f(0, 1);
-	glVertex2f(_x + _w - _cornerWidth, _y + _h);
-	glTexCoord2f(1, 1);
-	glVertex2f(_x + _cornerWidth, _y + _h);
-	glEnd();
+	TextureMan.set((quad < 4) ? _corner : _edge);
+
+	glColor4f(_r, _g, _b, _a);
+
+	for (; quad < 8; quad++) {
+		if ((quad == 2) && _verticalCut) {
+			glEnable(GL_SCISSOR_TEST);
+			GLint viewport[4];
+			glGetIntegerv(GL_VIEWPORT, viewport);
+			glScissor(
+					viewport[2]/2 + _x, viewport[3]/2 + _y,
+					_w, _h - _edgeHeight
+			);
+		}
+
+		if (quad == 4)
+			TextureMan.set(_edge);
+
+		if ((quad == 5) && _verticalCut) {
+			glDisable(GL_SCISSOR_TEST);
+		}
+
+		glBegin(GL_QUADS);
+		for (size_t i = 0; i < 4; i++) {
+			glTexCoord2f(texCoords[quad][i * 2 + 0], texCoords[quad][i * 2 + 1]);
+			glVertex2f(positions[quad][i * 2 + 0], positions[quad][i * 2 + 1]);
+		}
+		glEnd();
+	}
 
 	glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
 }
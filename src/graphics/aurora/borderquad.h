@@ -51,6 +51,8 @@ public:
 	virtual void calculateDistance();
 
 	void render(RenderPass pass);
+	RenderBatch *getRenderBatch();
+	bool isRetainable() const;
 
 private:
 	TextureHandle _edge, _corner;
@@ -69,6 +71,9 @@ private:
 	float _y;
 	float _w;
 	float _h;
+
+	/** Calculate the positions and texture coordinates of the 4 corner and 4 edge quads. */
+	void getQuads(float positions[8][8], float texCoords[8][8]) const;
 };
 
 } // End of namespace Aurora
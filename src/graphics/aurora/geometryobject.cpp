@@ -22,7 +22,21 @@
  *  A simple 3D object.
  */
 
+#include "external/glm/gtc/matrix_transform.hpp"
+
 #include "src/common/util.h"
+#include "src/common/maths.h"
+#include "src/common/frustum.h"
+
+#include "src/graphics/graphics.h"
+#include "src/graphics/camera.h"
+
+#include "src/graphics/shader/shader.h"
+#include "src/graphics/shader/shaderbuilder.h"
+#include "src/graphics/shader/materialman.h"
+#include "src/graphics/shader/surfaceman.h"
+
+#include "src/graphics/render/renderman.h"
 
 #include "src/graphics/aurora/geometryobject.h"
 #include "src/graphics/aurora/textureman.h"
@@ -40,6 +54,9 @@ GeometryObject::GeometryObject(const VertexBuffer &vBuf, const IndexBuffer &iBuf
 	_rotation[0] = 0.0f;
 	_rotation[1] = 0.0f;
 	_rotation[2] = 0.0f;
+
+	createBound();
+	updateBound();
 }
 
 GeometryObject::~GeometryObject() {
@@ -64,9 +81,8 @@ void GeometryObject::setPosition(float x, float y, float z) {
 	_position[1] = y;
 	_position[2] = z;
 
-	calculateDistance();
-
-	resort();
+	updateBound();
+	invalidateDistance();
 
 	unlockFrameIfVisible();
 }
@@ -78,9 +94,8 @@ void GeometryObject::setRotation(float x, float y, float z) {
 	_rotation[1] = y;
 	_rotation[2] = z;
 
-	calculateDistance();
-
-	resort();
+	updateBound();
+	invalidateDistance();
 
 	unlockFrameIfVisible();
 }
@@ -93,8 +108,91 @@ void GeometryObject::rotate(float x, float y, float z) {
 	setRotation(_rotation[0] + x, _rotation[1] + y, _rotation[2] + z);
 }
 
+void GeometryObject::addLOD(const IndexBuffer &iBuf, float distance) {
+	lockFrameIfVisible();
+
+	_lods.push_back(LOD());
+
+	_lods.back().distance    = distance;
+	_lods.back().indexBuffer = iBuf;
+
+	unlockFrameIfVisible();
+}
+
+void GeometryObject::createBound() {
+	_boundBox.clear();
+
+	const VertexDecl &decl = _vertexBuffer.getVertexDecl();
+	for (VertexDecl::const_iterator a = decl.begin(); a != decl.end(); ++a) {
+		if ((a->index != VPOSITION) || (a->type != GL_FLOAT) || (a->size < 3))
+			continue;
+
+		const size_t stride = (a->stride != 0) ? a->stride : (a->size * sizeof(float));
+		const byte *data = reinterpret_cast<const byte *>(a->pointer);
+
+		for (uint32_t i = 0; i < _vertexBuffer.getCount(); i++, data += stride) {
+			const float *v = reinterpret_cast<const float *>(data);
+
+			_boundBox.add(v[0], v[1], v[2]);
+		}
+
+		break;
+	}
+}
+
+void GeometryObject::updateBound() {
+	_absoluteBoundBox = _boundBox;
+
+	_absoluteBoundBox.translate(_position[0], _position[1], _position[2]);
+
+	_absoluteBoundBox.rotate(_rotation[0], 1.0f, 0.0f, 0.0f);
+	_absoluteBoundBox.rotate(_rotation[1], 0.0f, 1.0f, 0.0f);
+	_absoluteBoundBox.rotate(_rotation[2], 0.0f, 0.0f, 1.0f);
+
+	_absoluteBoundBox.absolutize();
+}
+
+bool GeometryObject::isInFrustum(const Common::Frustum &frustum) const {
+	return frustum.isIn(_absoluteBoundBox);
+}
+
+bool GeometryObject::getWorldBound(Common::BoundingBox &bound) const {
+	if (_absoluteBoundBox.empty())
+		return false;
+
+	bound = _absoluteBoundBox;
+	return true;
+}
+
 void GeometryObject::calculateDistance() {
-	_distance = 0;
+	if (_absoluteBoundBox.empty()) {
+		_distance = 0;
+		return;
+	}
+
+	float minX, minY, minZ, maxX, maxY, maxZ;
+	_absoluteBoundBox.getMin(minX, minY, minZ);
+	_absoluteBoundBox.getMax(maxX, maxY, maxZ);
+
+	const float cameraX = -CameraMan.getPosition()[0];
+	const float cameraY = -CameraMan.getPosition()[1];
+	const float cameraZ = -CameraMan.getPosition()[2];
+
+	// Distance to the closest point of the bounding box, so that large objects don't drop detail too early
+	const float x = MAX(0.0f, MAX(minX - cameraX, cameraX - maxX));
+	const float y = MAX(0.0f, MAX(minY - cameraY, cameraY - maxY));
+	const float z = MAX(0.0f, MAX(minZ - cameraZ, cameraZ - maxZ));
+
+	_distance = x + y + z;
+}
+
+size_t GeometryObject::getLOD() const {
+	size_t lod = 0;
+
+	while ((lod < _lods.size()) && (_distance >= _lods[lod].distance))
+		lod++;
+
+	return lod;
 }
 
 void GeometryObject::render(RenderPass pass) {
@@ -109,7 +207,105 @@ void GeometryObject::render(RenderPass pass) {
 
 	TextureMan.reset();
 
-	_vertexBuffer.draw(GL_TRIANGLES, _indexBuffer);
+	const size_t lod = getLOD();
+
+	_vertexBuffer.draw(GL_TRIANGLES, (lod == 0) ? _indexBuffer : _lods[lod - 1].indexBuffer);
+}
+
+void GeometryObject::queueRender(const glm::mat4 &parentTransform) {
+	if (_renderables.size() != (_lods.size() + 1))
+		buildMaterial();
+
+	if (_renderables.empty())
+		return;
+
+	_renderTransform = glm::translate(parentTransform, glm::vec3(_position[0], _position[1], _position[2]));
+
+	_renderTransform = glm::rotate(_renderTransform, Common::deg2rad(_rotation[0]), glm::vec3(1.0f, 0.0f, 0.0f));
+	_renderTransform = glm::rotate(_renderTransform, Common::deg2rad(_rotation[1]), glm::vec3(0.0f, 1.0f, 0.0f));
+	_renderTransform = glm::rotate(_renderTransform, Common::deg2rad(_rotation[2]), glm::vec3(0.0f, 0.0f, 1.0f));
+
+	RenderMan.queueRenderable(&_renderables[getLOD()], &_renderTransform, 1.0f);
+}
+
+bool GeometryObject::canQueueRenderParallel() const {
+	// Building the material creates shaders
+	return _renderables.size() == (_lods.size() + 1);
+}
+
+Mesh::Mesh *GeometryObject::createMesh(const IndexBuffer &iBuf) const {
+	Mesh::Mesh *mesh = new Mesh::Mesh();
+
+	*mesh->getVertexBuffer() = _vertexBuffer;
+	*mesh->getIndexBuffer()  = iBuf;
+
+	mesh->init();
+
+	return mesh;
+}
+
+void GeometryObject::buildMaterial() {
+	_renderables.clear();
+	_meshes.clear();
+
+	bool hasColour = false;
+
+	const VertexDecl &decl = _vertexBuffer.getVertexDecl();
+	for (VertexDecl::const_iterator a = decl.begin(); a != decl.end(); ++a)
+		if (a->index == VCOLOR)
+			hasColour = true;
+
+	// We only know how to draw vertex colours for now
+	if (!hasColour || (_vertexBuffer.getCount() == 0))
+		return;
+
+	/* All objects with the same vertex layout share one surface and material.
+	 * The render queue sorts by those, so all terrain and water tiles are
+	 * drawn in one run, without switching the shader program in between. */
+
+	Shader::ShaderDescriptor cripter;
+
+	cripter.declareInput(Shader::ShaderDescriptor::INPUT_POSITION0);
+	cripter.declareInput(Shader::ShaderDescriptor::INPUT_COLOUR);
+
+	cripter.addPass(Shader::ShaderDescriptor::X_COLOUR, Shader::ShaderDescriptor::BLEND_ONE);
+	cripter.addPass(Shader::ShaderDescriptor::FORCE_OPAQUE, Shader::ShaderDescriptor::BLEND_IGNORED);
+
+	Common::UString shaderName;
+	cripter.genName(shaderName);
+
+	const Common::UString materialName = "xoreos.geometry." + shaderName;
+
+	Shader::ShaderMaterial *material = MaterialMan.getMaterial(materialName);
+	Shader::ShaderSurface  *surface  = SurfaceMan.getSurface(materialName);
+
+	if (!material || !surface) {
+		Shader::ShaderObject *vertexObject   = ShaderMan.getShaderObject(shaderName + ".vert", Shader::SHADER_VERTEX);
+		Shader::ShaderObject *fragmentObject = ShaderMan.getShaderObject(shaderName + ".frag", Shader::SHADER_FRAGMENT);
+
+		if (!vertexObject || !fragmentObject) {
+			Common::UString vertexString, fragmentString;
+			cripter.build(GfxMan.isGL3(), vertexString, fragmentString);
+
+			vertexObject   = ShaderMan.getShaderObject(shaderName + ".vert", vertexString, Shader::SHADER_VERTEX);
+			fragmentObject = ShaderMan.getShaderObject(shaderName + ".frag", fragmentString, Shader::SHADER_FRAGMENT);
+		}
+
+		surface  = new Shader::ShaderSurface(vertexObject, materialName);
+		material = new Shader::ShaderMaterial(fragmentObject, materialName);
+
+		material->setFlags(Shader::ShaderMaterial::MATERIAL_OPAQUE);
+
+		MaterialMan.addMaterial(material);
+		SurfaceMan.addSurface(surface);
+	}
+
+	_meshes.emplace_back(createMesh(_indexBuffer));
+	for (std::vector<LOD>::const_iterator l = _lods.begin(); l != _lods.end(); ++l)
+		_meshes.emplace_back(createMesh(l->indexBuffer));
+
+	for (std::vector<std::unique_ptr<Mesh::Mesh>>::iterator m = _meshes.begin(); m != _meshes.end(); ++m)
+		_renderables.push_back(Shader::ShaderRenderable(surface, material, m->get()));
 }
 
 } // End of namespace Aurora
@@ -25,10 +25,19 @@
 #ifndef GRAPHICS_AURORA_GEOMETRYOBJECT_H
 #define GRAPHICS_AURORA_GEOMETRYOBJECT_H
 
+#include <vector>
+#include <memory>
+
+#include "external/glm/mat4x4.hpp"
+
+#include "src/common/boundingbox.h"
+
 #include "src/graphics/renderable.h"
 #include "src/graphics/indexbuffer.h"
 #include "src/graphics/vertexbuffer.h"
 
+#include "src/graphics/shader/shaderrenderable.h"
+
 namespace Graphics {
 
 namespace Aurora {
@@ -55,16 +64,57 @@ public:
 	/** Rotate the model, relative to its current rotation. */
 	void rotate(float x, float y, float z);
 
+	/** Add a coarser level of detail.
+	 *
+	 *  Once the object is at least distance away from the camera, the faces in
+	 *  iBuf are drawn instead of the full mesh. Levels of detail have to be added
+	 *  in order of increasing distance.
+	 */
+	void addLOD(const IndexBuffer &iBuf, float distance);
+
 	// Renderable
 	void calculateDistance();
 	void render(RenderPass pass);
+	void queueRender(const glm::mat4 &parentTransform);
+	bool canQueueRenderParallel() const;
+
+	bool isInFrustum(const Common::Frustum &frustum) const;
+	bool getWorldBound(Common::BoundingBox &bound) const;
 
 private:
+	/** A coarser level of detail. */
+	struct LOD {
+		float distance;          ///< Minimum distance to the camera.
+		IndexBuffer indexBuffer; ///< The faces to draw instead.
+	};
+
 	VertexBuffer _vertexBuffer;
 	IndexBuffer  _indexBuffer;
 
+	std::vector<LOD> _lods;
+
+	/** Meshes for the shader renderer, one for each level of detail. */
+	std::vector<std::unique_ptr<Mesh::Mesh>> _meshes;
+	/** Renderables for the shader renderer, one for each level of detail. */
+	std::vector<Shader::ShaderRenderable> _renderables;
+
+	glm::mat4 _renderTransform;
+
 	float _position[3];
 	float _rotation[3];
+
+	Common::BoundingBox _boundBox;         ///< Bounding box of the vertices.
+	Common::BoundingBox _absoluteBoundBox; ///< Bounding box, positioned in the world.
+
+	void createBound();
+	void updateBound();
+
+	/** Return the level of detail to draw at the current distance. 0 is the full mesh. */
+	size_t getLOD() const;
+
+	/** Create the meshes and renderables for the shader renderer. */
+	void buildMaterial();
+	Mesh::Mesh *createMesh(const IndexBuffer &iBuf) const;
 };
 
 } // End of namespace Aurora
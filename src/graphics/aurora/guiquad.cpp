@@ -25,8 +25,11 @@
 #include "src/common/util.h"
 #include "src/common/ustring.h"
 
+#include "src/graphics/graphics.h"
+
 #include "src/graphics/images/txi.h"
 #include "src/graphics/aurora/guiquad.h"
+#include "src/graphics/aurora/guiquadbatch.h"
 #include "src/graphics/aurora/textureman.h"
 #include "src/graphics/aurora/texture.h"
 
@@ -149,7 +152,11 @@ void GUIQuad::setPosition(float x, float y, float z) {
 }
 
 void GUIQuad::setRotation(float angle) {
+	lockFrameIfVisible();
+
 	_angle = angle;
+
+	unlockFrameIfVisible();
 }
 
 void GUIQuad::getColor(float& r, float& g, float& b, float& a) const {
@@ -201,22 +208,38 @@ void GUIQuad::setTexture(TextureHandle texture) {
 }
 
 void GUIQuad::setBlendMode(GUIQuad::BlendMode mode) {
+	lockFrameIfVisible();
+
 	_blendMode = mode;
+
+	unlockFrameIfVisible();
 }
 
 void GUIQuad::setScaleX(float xscale) {
+	lockFrameIfVisible();
+
 	_xscale = xscale;
+
+	unlockFrameIfVisible();
 }
 
 void GUIQuad::setScaleY(float yscale) {
+	lockFrameIfVisible();
+
 	_yscale = yscale;
+
+	unlockFrameIfVisible();
 }
 
 void GUIQuad::setScissor(int x, int y, int width, int height) {
+	lockFrameIfVisible();
+
 	_scissorX = x;
 	_scissorY = y;
 	_scissorWidth = width;
 	_scissorHeight = height;
+
+	unlockFrameIfVisible();
 }
 
 float GUIQuad::getWidth() const {
@@ -271,12 +294,35 @@ bool GUIQuad::isIn(float x, float y) const {
 void GUIQuad::calculateDistance() {
 }
 
+RenderBatch *GUIQuad::getRenderBatch() {
+	// Only plain quads can be drawn together
+	if ((_blendMode != kBlendDefault) || _xor || _scissor || (_angle != 0.0f))
+		return 0;
+
+	return &GUIQuadBatcher;
+}
+
+bool GUIQuad::isRetainable() const {
+	return true;
+}
+
 void GUIQuad::render(RenderPass pass) {
 	bool isTransparent = (_a < 1.0f) || (!_texture.empty() && _texture.getTexture().hasAlpha());
 	if (((pass == kRenderPassOpaque)      &&  isTransparent) ||
 			((pass == kRenderPassTransparent) && !isTransparent))
 		return;
 
+	if (GfxMan.getRenderBatch() == &GUIQuadBatcher) {
+		const float positions[8] = {
+			_x1 * _xscale, _y1 * _yscale, _x2 * _xscale, _y1 * _yscale,
+			_x2 * _xscale, _y2 * _yscale, _x1 * _xscale, _y2 * _yscale
+		};
+		const float texCoords[8] = { _tX1, _tY1, _tX2, _tY1, _tX2, _tY2, _tX1, _tY2 };
+
+		if (GUIQuadBatcher.add(_texture, positions, texCoords, _r, _g, _b, _a))
+			return;
+	}
+
 	TextureMan.set(_texture);
 
 	glColor4f(_r, _g, _b, _a);
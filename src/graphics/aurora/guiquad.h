@@ -106,6 +106,8 @@ public:
 	// Renderable
 	void calculateDistance();
 	void render(RenderPass pass);
+	RenderBatch *getRenderBatch();
+	bool isRetainable() const;
 
 	void renderImmediate(const glm::mat4 &parentTransform);
 private:
@@ -0,0 +1,135 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Batching of textured GUI quads.
+ */
+
+#include "src/graphics/graphics.h"
+
+#include "src/graphics/aurora/guiquadbatch.h"
+#include "src/graphics/aurora/textureman.h"
+#include "src/graphics/aurora/texture.h"
+
+#include "src/graphics/images/decoder.h"
+
+DECLARE_SINGLETON(Graphics::Aurora::GUIQuadBatch)
+
+namespace Graphics {
+
+namespace Aurora {
+
+GUIQuadBatch::GUIQuadBatch() : _texture(0) {
+}
+
+GUIQuadBatch::~GUIQuadBatch() {
+}
+
+bool GUIQuadBatch::add(const TextureHandle &texture, const float positions[8], const float texCoords[8],
+                       float r, float g, float b, float a) {
+
+	TextureID id = 0;
+	float u1 = 0.0f, v1 = 0.0f, u2 = 1.0f, v2 = 1.0f;
+
+	if (!texture.empty()) {
+		if (texture.getTexture().getImage().isCubeMap()) {
+			flush();
+			return false;
+		}
+
+		// Texture coordinates outside the texture would need wrapping, which the atlas can't do
+		bool inside = true;
+		for (size_t i = 0; i < 8; i++)
+			inside = inside && (texCoords[i] >= 0.0f) && (texCoords[i] <= 1.0f);
+
+		TextureAtlas::Region region;
+		if (inside && TextureMan.getAtlasRegion(texture, region)) {
+			id = region.page;
+
+			u1 = region.u1;
+			v1 = region.v1;
+			u2 = region.u2;
+			v2 = region.v2;
+
+		} else {
+			TextureMan.request(texture);
+
+			id = texture.getTexture().getID();
+		}
+	}
+
+	if (!_vertices.empty() && (id != _texture))
+		flush();
+
+	_texture = id;
+
+	for (size_t i = 0; i < 4; i++) {
+		Vertex vertex;
+
+		vertex.x = positions[i * 2 + 0];
+		vertex.y = positions[i * 2 + 1];
+		vertex.u = u1 + texCoords[i * 2 + 0] * (u2 - u1);
+		vertex.v = v1 + texCoords[i * 2 + 1] * (v2 - v1);
+		vertex.r = r;
+		vertex.g = g;
+		vertex.b = b;
+		vertex.a = a;
+
+		_vertices.push_back(vertex);
+	}
+
+	return true;
+}
+
+void GUIQuadBatch::flush() {
+	if (_vertices.empty())
+		return;
+
+	TextureMan.set();
+	glBindTexture(GL_TEXTURE_2D, _texture);
+	TextureMan.invalidateState();
+
+	glClientActiveTextureARB(GL_TEXTURE0);
+
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+
+	glVertexPointer  (2, GL_FLOAT, sizeof(Vertex), &_vertices[0].x);
+	glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), &_vertices[0].u);
+	glColorPointer   (4, GL_FLOAT, sizeof(Vertex), &_vertices[0].r);
+
+	GfxMan.countDrawCall(GL_QUADS, _vertices.size());
+	glDrawArrays(GL_QUADS, 0, _vertices.size());
+
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+
+	glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+	TextureMan.set();
+
+	_vertices.clear();
+	_texture = 0;
+}
+
+} // End of namespace Aurora
+
+} // End of namespace Graphics
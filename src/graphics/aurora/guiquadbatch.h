@@ -0,0 +1,86 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Batching of textured GUI quads.
+ */
+
+#ifndef GRAPHICS_AURORA_GUIQUADBATCH_H
+#define GRAPHICS_AURORA_GUIQUADBATCH_H
+
+#include <vector>
+
+#include "src/common/types.h"
+#include "src/common/singleton.h"
+
+#include "src/graphics/types.h"
+#include "src/graphics/renderbatch.h"
+
+namespace Graphics {
+
+namespace Aurora {
+
+class TextureHandle;
+
+/** Collects consecutive textured GUI quads, to draw them in as few calls as possible.
+ *
+ *  Small textures are looked up in the GUI texture atlas, so quads using
+ *  different ones still share a draw call. Everything else breaks the
+ *  batch whenever the texture changes.
+ */
+class GUIQuadBatch : public Common::Singleton<GUIQuadBatch>, public RenderBatch {
+public:
+	GUIQuadBatch();
+	~GUIQuadBatch();
+
+	/** Add a quad to the batch.
+	 *
+	 *  The positions and texture coordinates are given as 4 x/y pairs,
+	 *  counter-clockwise, the way GL_QUADS wants them.
+	 *
+	 *  If the quad can't be batched, everything collected so far is
+	 *  drawn and false is returned. The caller has to draw the quad itself.
+	 */
+	bool add(const TextureHandle &texture, const float positions[8], const float texCoords[8],
+	         float r, float g, float b, float a);
+
+	void flush();
+
+private:
+	/** A vertex, with all attributes interleaved. */
+	struct Vertex {
+		float x, y;
+		float u, v;
+		float r, g, b, a;
+	};
+
+	TextureID _texture; ///< The texture all collected quads use.
+
+	std::vector<Vertex> _vertices;
+};
+
+} // End of namespace Aurora
+
+} // End of namespace Graphics
+
+/** Shortcut for accessing the GUI quad batch. */
+#define GUIQuadBatcher Graphics::Aurora::GUIQuadBatch::instance()
+
+#endif // GRAPHICS_AURORA_GUIQUADBATCH_H
@@ -19,6 +19,9 @@
  */
 
 #include "src/events/events.h"
+
+#include "src/graphics/graphics.h"
+
 #include "src/graphics/aurora/highlightable.h"
 
 namespace Graphics {
@@ -42,6 +45,10 @@ bool Highlightable::isHighlightable() const {
 }
 
 void Highlightable::setHighlightable(bool highlightable) {
+	// Pulsing objects can't be recorded into the retained GUI drawing
+	if (_highlightable != highlightable)
+		GfxMan.invalidateGUI();
+
 	_highlightable = highlightable;
 }
 
@@ -50,6 +57,9 @@ bool Highlightable::isHightlighted() const {
 }
 
 void Highlightable::setHighlighted(bool hightlighted) {
+	if (_isHighlighted != hightlighted)
+		GfxMan.invalidateGUI();
+
 	_isHighlighted = hightlighted;
 }
 
@@ -43,6 +43,11 @@ void HighlightableGUIQuad::render(RenderPass pass) {
 	Graphics::Aurora::GUIQuad::render(pass);
 }
 
+bool HighlightableGUIQuad::isRetainable() const {
+	// While highlighted, the color changes every frame
+	return !(isHighlightable() && isHightlighted());
+}
+
 } // End of namespace Aurora
 
 } // End of namespace Graphics
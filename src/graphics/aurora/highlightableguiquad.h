@@ -37,6 +37,7 @@ public:
 	~HighlightableGUIQuad();
 
 	void render (RenderPass pass);
+	bool isRetainable() const;
 };
 
 } // End of namespace Aurora
@@ -45,6 +45,11 @@ void HighlightableText::render(RenderPass pass) {
 	Graphics::Aurora::Text::render(pass);
 }
 
+bool HighlightableText::isRetainable() const {
+	// While highlighted, the color changes every frame
+	return !(isHighlightable() && isHightlighted());
+}
+
 } // End of namespace Aurora
 
 } // End of namespace Graphics
@@ -37,6 +37,7 @@ class HighlightableText: public Text, public Highlightable {
 	~HighlightableText();
 
 	void render(RenderPass pass);
+	bool isRetainable() const;
 
 };
 
@@ -24,6 +24,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 
 #include "src/common/fallthrough.h"
 START_IGNORE_IMPLICIT_FALLTHROUGH
@@ -33,14 +34,22 @@ STOP_IGNORE_IMPLICIT_FALLTHROUGH
 #include "external/glm/gtc/type_ptr.hpp"
 #include "external/glm/gtc/matrix_transform.hpp"
 #include "external/glm/gtx/matrix_interpolation.hpp"
+#include "external/glm/matrix.hpp"
+#include "external/glm/geometric.hpp"
 
 #include "src/common/readstream.h"
 #include "src/common/debug.h"
+#include "src/common/frustum.h"
 
+#include "src/graphics/graphics.h"
 #include "src/graphics/camera.h"
+#include "src/graphics/windowman.h"
+
+#include "src/graphics/images/txi.h"
 
 #include "src/graphics/aurora/model.h"
 #include "src/graphics/aurora/textureman.h"
+#include "src/graphics/aurora/texture.h"
 #include "src/graphics/aurora/animation.h"
 #include "src/graphics/aurora/modelnode.h"
 #include "src/graphics/aurora/animnode.h"
@@ -67,7 +76,8 @@ Model::Model(ModelType type) :
 		_positionRelative(false),
 		_drawBound(false),
 		_drawSkeleton(false),
-		_drawSkeletonInvisible(false) {
+		_drawSkeletonInvisible(false),
+		_lastRenderedFrame(0) {
 
 	_scale   [0] = 1.0f; _scale   [1] = 1.0f; _scale   [2] = 1.0f;
 	_position[0] = 0.0f; _position[1] = 0.0f; _position[2] = 0.0f;
@@ -91,6 +101,7 @@ Model::Model(ModelType type) :
 
 Model::~Model() {
 	hide();
+	waitForFrameSnapshot();
 
 	for (AnimationChannelMap::iterator c = _animationChannels.begin();
 			c != _animationChannels.end(); ++c) {
@@ -159,6 +170,41 @@ bool Model::isIn(float x1, float y1, float z1, float x2, float y2, float z2) con
 	return _absoluteBoundBox.isIn(x1, y1, z1, x2, y2, z2);
 }
 
+bool Model::getPickBox(glm::vec3 &min, glm::vec3 &max) const {
+	if ((_type == kModelTypeGUIFront) || _absoluteBoundBox.empty())
+		return false;
+
+	_absoluteBoundBox.getMin(min.x, min.y, min.z);
+	_absoluteBoundBox.getMax(max.x, max.y, max.z);
+
+	return true;
+}
+
+bool Model::isInFrustum(const Common::Frustum &frustum) const {
+	return frustum.isIn(_renderBoundBox);
+}
+
+bool Model::getWorldBound(Common::BoundingBox &bound) const {
+	if (_renderBoundBox.empty())
+		return false;
+
+	bound = _renderBoundBox;
+	return true;
+}
+
+void Model::snapshot() {
+	{
+		std::lock_guard<std::mutex> lock(_transformMutex);
+
+		_renderPosition = _absolutePosition;
+		_renderBoundBox = _absoluteBoundBox;
+	}
+
+	for (std::map<Common::UString, Model *>::iterator m = _attachedModels.begin();
+	     m != _attachedModels.end(); ++m)
+		m->second->snapshot();
+}
+
 float Model::getWidth() const {
 	return _boundBox.getWidth() * _scale[0];
 }
@@ -217,49 +263,46 @@ void Model::getAbsolutePosition(float &x, float &y, float &z) const {
 }
 
 void Model::setScale(float x, float y, float z) {
-	lockFrameIfVisible();
-
-	_scale[0] = x;
-	_scale[1] = y;
-	_scale[2] = z;
+	{
+		std::lock_guard<std::mutex> lock(_transformMutex);
 
-	createAbsolutePosition();
-	calculateDistance();
+		_scale[0] = x;
+		_scale[1] = y;
+		_scale[2] = z;
 
-	resort();
+		createAbsolutePosition();
+	}
 
-	unlockFrameIfVisible();
+	invalidateDistance();
 }
 
 void Model::setOrientation(float x, float y, float z, float angle) {
-	lockFrameIfVisible();
+	{
+		std::lock_guard<std::mutex> lock(_transformMutex);
 
-	_orientation[0] = x;
-	_orientation[1] = y;
-	_orientation[2] = z;
-	_orientation[3] = angle;
-
-	createAbsolutePosition();
-	calculateDistance();
+		_orientation[0] = x;
+		_orientation[1] = y;
+		_orientation[2] = z;
+		_orientation[3] = angle;
 
-	resort();
+		createAbsolutePosition();
+	}
 
-	unlockFrameIfVisible();
+	invalidateDistance();
 }
 
 void Model::setPosition(float x, float y, float z) {
-	lockFrameIfVisible();
+	{
+		std::lock_guard<std::mutex> lock(_transformMutex);
 
-	_position[0] = x;
-	_position[1] = y;
-	_position[2] = z;
+		_position[0] = x;
+		_position[1] = y;
+		_position[2] = z;
 
-	createAbsolutePosition();
-	calculateDistance();
-
-	resort();
+		createAbsolutePosition();
+	}
 
-	unlockFrameIfVisible();
+	invalidateDistance();
 }
 
 void Model::scale(float x, float y, float z) {
@@ -476,6 +519,32 @@ const std::vector<ModelNode *> &Model::getNodes() {
 	return _currentState->nodeList;
 }
 
+void Model::getTextures(std::list<TextureHandle> &textures) const {
+	if (!_currentState)
+		return;
+
+	for (std::vector<ModelNode *>::const_iterator n = _currentState->nodeList.begin();
+	     n != _currentState->nodeList.end(); ++n) {
+
+		if (!(*n)->_mesh || !(*n)->_mesh->data)
+			continue;
+
+		const std::vector<TextureHandle> &nodeTextures = (*n)->_mesh->data->textures;
+		for (std::vector<TextureHandle>::const_iterator t = nodeTextures.begin(); t != nodeTextures.end(); ++t) {
+			if (t->empty())
+				continue;
+
+			bool known = false;
+			for (std::list<TextureHandle>::const_iterator k = textures.begin(); k != textures.end(); ++k)
+				if (&k->getTexture() == &t->getTexture())
+					known = true;
+
+			if (!known)
+				textures.push_back(*t);
+		}
+	}
+}
+
 void Model::attachModel(const Common::UString &nodeName, Model *model) {
 	ModelNode *node = getNode(nodeName);
 	if (!node)
@@ -493,9 +562,81 @@ void Model::attachModel(const Common::UString &nodeName, Model *model) {
 	if (model)
 		_attachedModels.insert(std::pair<Common::UString, Model *>(nodeName, model));
 
+	// Animations might move nodes of the attached model
+	{
+		std::lock_guard<std::mutex> lock(_animationNodeMapMutex);
+		_animationNodeMaps.clear();
+	}
+
 	createBound();
 }
 
+void Model::getAnimationNodeMap(const Animation &animation, std::vector<ModelNode *> &modelNodeMap) {
+	std::lock_guard<std::mutex> lock(_animationNodeMapMutex);
+
+	const AnimationNodeMapKey key(_currentState, &animation);
+
+	AnimationNodeMaps::iterator m = _animationNodeMaps.find(key);
+	if (m == _animationNodeMaps.end()) {
+		m = _animationNodeMaps.insert(std::make_pair(key, std::vector<ModelNode *>())).first;
+
+		createAnimationNodeMap(animation, m->second);
+	}
+
+	modelNodeMap = m->second;
+}
+
+void Model::createAnimationNodeMap(const Animation &animation, std::vector<ModelNode *> &modelNodeMap) {
+	const std::list<AnimNode *> &animNodes = animation.getNodes();
+	int maxNodeNumber = -1;
+
+	for (std::list<AnimNode *>::const_iterator n = animNodes.begin();
+			n != animNodes.end(); ++n) {
+		int nodeNumber = (*n)->getNodeData()->getNodeNumber();
+		if (nodeNumber > maxNodeNumber)
+			maxNodeNumber = nodeNumber;
+	}
+
+	modelNodeMap.clear();
+
+	if (maxNodeNumber == -1)
+		return;
+
+	modelNodeMap.resize(maxNodeNumber + 1, 0);
+
+	for (std::list<AnimNode *>::const_iterator an = animNodes.begin();
+			an != animNodes.end(); ++an) {
+		ModelNode *animNode = (*an)->getNodeData();
+		int nodeNumber = animNode->getNodeNumber();
+		const Common::UString &animNodeName = animNode->getName();
+
+		// Search for the corresponding node in this model
+		NodeMap::iterator n = _currentState->nodeMap.find(animNodeName);
+		if (n != _currentState->nodeMap.end()) {
+			modelNodeMap[nodeNumber] = n->second;
+			continue;
+		}
+
+		// Search for the corresponding node in this model's attached models
+		for (std::map<Common::UString, Model *>::iterator m = _attachedModels.begin();
+				m != _attachedModels.end(); ++m) {
+			State *state = m->second->_currentState;
+			if (!state)
+				continue;
+
+			n = state->nodeMap.find(animNodeName);
+			if (n != state->nodeMap.end()) {
+				modelNodeMap[nodeNumber] = n->second;
+				break;
+			}
+		}
+
+		// Search for the corresponding node in this model's super model
+		if (_superModel && !modelNodeMap[nodeNumber])
+			modelNodeMap[nodeNumber] = _superModel->getNode(animNodeName);
+	}
+}
+
 Animation *Model::getAnimation(const Common::UString &anim) {
 
 	AnimationMap::iterator n = _animationMap.find(anim);
@@ -570,8 +711,81 @@ void Model::playAnimation(const Common::UString &anim, bool restart, float lengt
 }
 
 void Model::computeNodeTransforms() {
-	for (const auto &n : _currentState->rootNodes) {
-		n->computeTransforms();
+	NodeHierarchy &hierarchy = _currentState->hierarchy;
+
+	const size_t count = hierarchy.nodes.size();
+	for (size_t i = 0; i < count; i++) {
+		ModelNode &node = *hierarchy.nodes[i];
+
+		node.computeLocalBaseTransform();
+		node.computeLocalTransform();
+
+		hierarchy.localBase[i] = node._localBaseTransform;
+		hierarchy.local[i]     = node._localTransform;
+	}
+
+	// Parents come before their children, so their absolute transforms are already known
+	for (size_t i = 0; i < count; i++) {
+		const int32_t parent = hierarchy.parents[i];
+		if (parent < 0) {
+			hierarchy.absoluteBase[i] = hierarchy.localBase[i];
+			hierarchy.absolute[i]     = hierarchy.local[i];
+		} else {
+			hierarchy.absoluteBase[i] = hierarchy.absoluteBase[parent] * hierarchy.localBase[i];
+			hierarchy.absolute[i]     = hierarchy.absolute[parent]     * hierarchy.local[i];
+		}
+	}
+
+	for (size_t i = 0; i < count; i++)
+		hierarchy.nodes[i]->setAbsoluteTransforms(hierarchy.absoluteBase[i], hierarchy.absolute[i]);
+}
+
+void Model::computeRenderTransforms(const glm::mat4 &transform) {
+	NodeHierarchy &hierarchy = _currentState->hierarchy;
+
+	const size_t count = hierarchy.nodes.size();
+	for (size_t i = 0; i < count; i++)
+		hierarchy.nodes[i]->calcLocalRenderTransform(hierarchy.renderLocal[i]);
+
+	for (size_t i = 0; i < count; i++) {
+		const int32_t parent = hierarchy.parents[i];
+
+		hierarchy.render[i] = ((parent < 0) ? transform : hierarchy.render[parent]) * hierarchy.renderLocal[i];
+	}
+
+	for (size_t i = 0; i < count; i++)
+		hierarchy.nodes[i]->_renderTransform = hierarchy.render[i];
+}
+
+void Model::flattenNode(NodeHierarchy &hierarchy, ModelNode *node, int32_t parent) {
+	const int32_t index = hierarchy.nodes.size();
+
+	hierarchy.nodes.push_back(node);
+	hierarchy.parents.push_back(parent);
+
+	for (std::list<ModelNode *>::iterator c = node->getChildren().begin(); c != node->getChildren().end(); ++c)
+		flattenNode(hierarchy, *c, index);
+}
+
+void Model::flattenNodeHierarchies() {
+	for (StateList::iterator s = _stateList.begin(); s != _stateList.end(); ++s) {
+		NodeHierarchy &hierarchy = (*s)->hierarchy;
+
+		hierarchy.nodes.clear();
+		hierarchy.parents.clear();
+
+		for (NodeList::iterator n = (*s)->rootNodes.begin(); n != (*s)->rootNodes.end(); ++n)
+			flattenNode(hierarchy, *n, -1);
+
+		const size_t count = hierarchy.nodes.size();
+
+		hierarchy.localBase.resize(count);
+		hierarchy.absoluteBase.resize(count);
+		hierarchy.local.resize(count);
+		hierarchy.absolute.resize(count);
+
+		hierarchy.renderLocal.resize(count);
+		hierarchy.render.resize(count);
 	}
 }
 
@@ -582,7 +796,11 @@ void Model::calculateDistance() {
 	}
 
 
-	glm::mat4 center = _absolutePosition;
+	glm::mat4 center;
+	{
+		std::lock_guard<std::mutex> lock(_transformMutex);
+		center = _absolutePosition;
+	}
 
 	center = glm::translate(center, glm::vec3(_center[0], _center[1], _center[2]));
 
@@ -621,6 +839,249 @@ void Model::flushNodeBuffers() {
 	}
 }
 
+bool Model::isBatchable(const ModelNode &node) const {
+	const ModelNode::Mesh *mesh = node._mesh;
+	if (!node._render || node._attachedModel || !ModelNode::renderableMesh(node._mesh))
+		return false;
+
+	// Anything that needs more than simply drawing the mesh with its textures
+	if (mesh->isTransparent || (mesh->alpha < 1.0f) || mesh->dangly || mesh->skin ||
+	    mesh->data->textures.empty() || !mesh->data->envMap.empty())
+		return false;
+
+	for (std::vector<TextureHandle>::const_iterator t = mesh->data->textures.begin();
+	     t != mesh->data->textures.end(); ++t) {
+
+		if (t->empty())
+			continue;
+
+		const Texture &texture = t->getTexture();
+		if (!texture.hasAlpha() && (texture.getTXI().getFeatures().blending == TXI::kBlendingAdditive))
+			return false;
+	}
+
+	Graphics::Mesh::Mesh *rawMesh = mesh->data->rawMesh;
+	if ((rawMesh->getType() != GL_TRIANGLES) || (rawMesh->getVertexBuffer()->getCount() == 0))
+		return false;
+
+	const GLenum indexType = rawMesh->getIndexBuffer()->getType();
+	if ((indexType != GL_UNSIGNED_SHORT) && (indexType != GL_UNSIGNED_INT))
+		return false;
+
+	// We need to read and transform the vertices, so only plain floats
+	const VertexDecl &decl = rawMesh->getVertexBuffer()->getVertexDecl();
+	for (VertexDecl::const_iterator a = decl.begin(); a != decl.end(); ++a)
+		if (a->type != GL_FLOAT)
+			return false;
+
+	return true;
+}
+
+/** Do these two meshes have the same vertex layout? */
+static bool isSameVertexDecl(const VertexDecl &a, const VertexDecl &b) {
+	if (a.size() != b.size())
+		return false;
+
+	for (size_t i = 0; i < a.size(); i++)
+		if ((a[i].index != b[i].index) || (a[i].size != b[i].size) || (a[i].type != b[i].type))
+			return false;
+
+	return true;
+}
+
+void Model::batchStaticNodes() {
+	// Models with several states swap nodes around
+	if (!_currentState || (_stateList.size() != 1) || GfxMan.isRendererExperimental())
+		return;
+
+	lockFrameIfVisible();
+
+	NodeHierarchy &hierarchy = _currentState->hierarchy;
+	const size_t count = hierarchy.nodes.size();
+
+	// The transformations of all nodes, relative to the model
+	std::vector<glm::mat4> transforms(count);
+	std::vector<bool> isStatic(count, false);
+
+	for (size_t i = 0; i < count; i++) {
+		const int32_t parent = hierarchy.parents[i];
+
+		glm::mat4 local;
+		hierarchy.nodes[i]->calcLocalRenderTransform(local);
+
+		transforms[i] = (parent < 0) ? local : (transforms[parent] * local);
+
+		// A node only stays in place if all its parents do, too
+		bool animated = false;
+		for (const Model *model = this; model && !animated; model = model->_superModel)
+			for (AnimationMap::const_iterator a = model->_animationMap.begin(); a != model->_animationMap.end(); ++a)
+				if (a->second->hasNode(hierarchy.nodes[i]->getName()))
+					animated = true;
+
+		isStatic[i] = !animated && ((parent < 0) || isStatic[parent]);
+	}
+
+	// Group the static nodes by their textures and vertex layout
+	std::vector<std::vector<size_t>> groups;
+
+	for (size_t i = 0; i < count; i++) {
+		if (!isStatic[i] || !isBatchable(*hierarchy.nodes[i]))
+			continue;
+
+		const ModelNode::MeshData &data = *hierarchy.nodes[i]->_mesh->data;
+
+		std::vector<std::vector<size_t>>::iterator g;
+		for (g = groups.begin(); g != groups.end(); ++g) {
+			const ModelNode::MeshData &groupData = *hierarchy.nodes[g->front()]->_mesh->data;
+
+			if (groupData.textures.size() != data.textures.size())
+				continue;
+
+			bool sameTextures = true;
+			for (size_t t = 0; t < data.textures.size(); t++)
+				if (groupData.textures[t].getName() != data.textures[t].getName())
+					sameTextures = false;
+
+			if (sameTextures && isSameVertexDecl(groupData.rawMesh->getVertexBuffer()->getVertexDecl(),
+			                                     data.rawMesh->getVertexBuffer()->getVertexDecl()))
+				break;
+		}
+
+		if (g == groups.end()) {
+			groups.push_back(std::vector<size_t>());
+			g = groups.end() - 1;
+		}
+
+		g->push_back(i);
+	}
+
+	// Only worth it if it actually saves draw calls
+	for (std::vector<std::vector<size_t>>::const_iterator g = groups.begin(); g != groups.end(); ++g)
+		if (g->size() > 1)
+			createStaticBatch(*g, transforms);
+
+	unlockFrameIfVisible();
+}
+
+void Model::createStaticBatch(const std::vector<size_t> &nodes, const std::vector<glm::mat4> &transforms) {
+	NodeHierarchy &hierarchy = _currentState->hierarchy;
+
+	uint32_t vertexCount = 0, indexCount = 0;
+	for (std::vector<size_t>::const_iterator n = nodes.begin(); n != nodes.end(); ++n) {
+		Graphics::Mesh::Mesh *rawMesh = hierarchy.nodes[*n]->_mesh->data->rawMesh;
+
+		vertexCount += rawMesh->getVertexBuffer()->getCount();
+		indexCount  += rawMesh->getIndexBuffer()->getCount();
+	}
+
+	StaticBatch batch;
+
+	batch.textures = hierarchy.nodes[nodes.front()]->_mesh->data->textures;
+	batch.mesh = std::make_unique<Graphics::Mesh::Mesh>();
+
+	VertexDecl decl = hierarchy.nodes[nodes.front()]->_mesh->data->rawMesh->getVertexBuffer()->getVertexDecl();
+
+	VertexBuffer &vBuf = *batch.mesh->getVertexBuffer();
+	IndexBuffer  &iBuf = *batch.mesh->getIndexBuffer();
+
+	vBuf.setVertexDeclInterleave(vertexCount, decl);
+
+	const bool shortIndices = vertexCount <= 0xFFFF;
+	if (shortIndices)
+		iBuf.setSize(indexCount, sizeof(uint16_t), GL_UNSIGNED_SHORT);
+	else
+		iBuf.setSize(indexCount, sizeof(uint32_t), GL_UNSIGNED_INT);
+
+	uint32_t vertexOffset = 0, indexOffset = 0;
+	for (std::vector<size_t>::const_iterator n = nodes.begin(); n != nodes.end(); ++n) {
+		Graphics::Mesh::Mesh *rawMesh = hierarchy.nodes[*n]->_mesh->data->rawMesh;
+
+		const VertexBuffer &srcVBuf = *rawMesh->getVertexBuffer();
+		const IndexBuffer  &srcIBuf = *rawMesh->getIndexBuffer();
+
+		const glm::mat4 &transform = transforms[*n];
+		const glm::mat3 normalTransform = glm::transpose(glm::inverse(glm::mat3(transform)));
+
+		// Copy the vertices, moving positions and normals into the model's space
+		const VertexDecl &srcDecl = srcVBuf.getVertexDecl();
+		for (size_t a = 0; a < srcDecl.size(); a++) {
+			const VertexAttrib &src = srcDecl[a];
+			const VertexAttrib &dst = vBuf.getVertexDecl()[a];
+
+			const size_t srcStride = src.stride ? src.stride : (src.size * sizeof(float));
+			const size_t dstStride = dst.stride ? dst.stride : (dst.size * sizeof(float));
+
+			const byte *srcData = reinterpret_cast<const byte *>(src.pointer);
+			byte       *dstData = reinterpret_cast<byte *>(const_cast<GLvoid *>(dst.pointer)) + vertexOffset * dstStride;
+
+			for (uint32_t v = 0; v < srcVBuf.getCount(); v++, srcData += srcStride, dstData += dstStride) {
+				const float *in  = reinterpret_cast<const float *>(srcData);
+				float       *out = reinterpret_cast<float *>(dstData);
+
+				std::memcpy(out, in, src.size * sizeof(float));
+
+				if ((src.index == VPOSITION) && (src.size >= 3)) {
+					const glm::vec4 p = transform * glm::vec4(in[0], in[1], in[2], 1.0f);
+
+					out[0] = p[0];
+					out[1] = p[1];
+					out[2] = p[2];
+
+				} else if ((src.index == VNORMAL) && (src.size >= 3)) {
+					glm::vec3 normal = normalTransform * glm::vec3(in[0], in[1], in[2]);
+					if (glm::length(normal) > 0.0f)
+						normal = glm::normalize(normal);
+
+					out[0] = normal[0];
+					out[1] = normal[1];
+					out[2] = normal[2];
+				}
+			}
+		}
+
+		// Copy the indices, pointing them at where the vertices ended up
+		for (uint32_t i = 0; i < srcIBuf.getCount(); i++, indexOffset++) {
+			uint32_t index;
+			if (srcIBuf.getType() == GL_UNSIGNED_SHORT)
+				index = reinterpret_cast<const uint16_t *>(srcIBuf.getData())[i];
+			else
+				index = reinterpret_cast<const uint32_t *>(srcIBuf.getData())[i];
+
+			index += vertexOffset;
+
+			if (shortIndices)
+				reinterpret_cast<uint16_t *>(iBuf.getData())[indexOffset] = index;
+			else
+				reinterpret_cast<uint32_t *>(iBuf.getData())[indexOffset] = index;
+		}
+
+		vertexOffset += srcVBuf.getCount();
+
+		hierarchy.nodes[*n]->_batched = true;
+	}
+
+	batch.mesh->setName(_name + ".batch");
+	batch.mesh->init();
+
+	_staticBatches.push_back(std::move(batch));
+}
+
+void Model::renderStaticBatches() {
+	for (std::vector<StaticBatch>::iterator b = _staticBatches.begin(); b != _staticBatches.end(); ++b) {
+		for (size_t t = 0; t < b->textures.size(); t++) {
+			TextureMan.activeTexture(t);
+			TextureMan.set(b->textures[t]);
+		}
+
+		b->mesh->renderImmediate();
+
+		for (size_t t = 0; t < b->textures.size(); t++) {
+			TextureMan.activeTexture(t);
+			TextureMan.set();
+		}
+	}
+}
+
 std::map<Common::UString, Model *> &Model::getAttachedModels() {
 	return _attachedModels;
 }
@@ -638,15 +1099,15 @@ void Model::notifyHasSkinNodes() {
 	_hasSkinNodes = true;
 }
 
-void Model::manageAnimations(float dt) {
+void Model::manageAnimations(float dt, bool evaluate) {
 	for (AnimationChannelMap::iterator c = _animationChannels.begin();
 			c != _animationChannels.end(); ++c) {
-		c->second->manageAnimations(dt);
+		c->second->manageAnimations(dt, evaluate);
 	}
 
 	for (std::map<Common::UString, Model *>::iterator m = _attachedModels.begin();
 			m != _attachedModels.end(); ++m) {
-		m->second->manageAnimations(dt);
+		m->second->manageAnimations(dt, evaluate);
 	}
 }
 
@@ -660,27 +1121,69 @@ void Model::render(RenderPass pass) {
 		return;
 	}
 
+	markRendered();
+
+	// Fetch the current view once, all node matrices are computed from it
+	glm::mat4 modelview;
+	glGetFloatv(GL_MODELVIEW_MATRIX, glm::value_ptr(modelview));
+
+	// Streamed textures only need as much detail as we take up on screen
+	TextureMan.setScreenSize(getScreenSize(modelview));
+
+	renderNodes(pass, modelview);
+
+	TextureMan.setScreenSize(0.0f);
+}
+
+float Model::getScreenSize(const glm::mat4 &modelview) const {
+	if ((_type != kModelTypeObject) || _renderBoundBox.empty())
+		return 0.0f;
+
+	glm::vec3 min, max;
+	_renderBoundBox.getMin(min[0], min[1], min[2]);
+	_renderBoundBox.getMax(max[0], max[1], max[2]);
+
+	const float radius = glm::length(max - min) * 0.5f;
+
+	const glm::vec4 center = modelview * glm::vec4((min + max) * 0.5f, 1.0f);
+	const float distance = -center[2];
+
+	// The camera is within the model
+	if (distance <= radius)
+		return 0.0f;
+
+	const float pixelScale = GfxMan.getProjectionMatrix()[1][1] * WindowMan.getWindowHeight() * 0.5f;
+
+	return (2.0f * radius * pixelScale) / distance;
+}
+
+void Model::renderNodes(RenderPass pass, const glm::mat4 &parentTransform) {
 	// Apply our global model transformation
-	glTranslatef(_position[0], _position[1], _position[2]);
-	glRotatef(_orientation[3], _orientation[0], _orientation[1], _orientation[2]);
-	glScalef(_scale[0], _scale[1], _scale[2]);
+	const glm::mat4 transform = parentTransform * _renderPosition;
+
+	glLoadMatrixf(glm::value_ptr(transform));
 
 	// Draw the bounding box, if requested
 	doDrawBound();
 
 	// Draw the nodes
-	for (NodeList::iterator n = _currentState->rootNodes.begin();
-	     n != _currentState->rootNodes.end(); ++n) {
+	computeRenderTransforms(transform);
 
-		glPushMatrix();
+	const NodeList &nodes = _currentState->hierarchy.nodes;
+	for (NodeList::const_iterator n = nodes.begin(); n != nodes.end(); ++n)
 		(*n)->render(pass);
-		glPopMatrix();
+
+	// Static batches are never transparent
+	if ((pass == kRenderPassOpaque) && !_staticBatches.empty()) {
+		glLoadMatrixf(glm::value_ptr(transform));
+		renderStaticBatches();
 	}
 
 	// Reset the first texture units
 	TextureMan.reset();
 
 	// Draw the skeleton, if requested
+	glLoadMatrixf(glm::value_ptr(transform));
 	doDrawSkeleton();
 }
 
@@ -689,14 +1192,17 @@ void Model::renderImmediate(const glm::mat4 &parentTransform) {
 		return;
 	}
 
-	glm::mat4 transform = parentTransform * _absolutePosition;
+	markRendered();
+
+	glm::mat4 transform = parentTransform * _renderPosition;
 	queueDrawBound();
 
 	// Queue the nodes
-	for (NodeList::iterator n = _currentState->rootNodes.begin();
-	     n != _currentState->rootNodes.end(); ++n) {
-		(*n)->renderImmediate(transform);
-	}
+	computeRenderTransforms(transform);
+
+	const NodeList &nodes = _currentState->hierarchy.nodes;
+	for (NodeList::const_iterator n = nodes.begin(); n != nodes.end(); ++n)
+		(*n)->renderImmediate();
 }
 
 void Model::queueRender(const glm::mat4 &parentTransform) {
@@ -704,14 +1210,47 @@ void Model::queueRender(const glm::mat4 &parentTransform) {
 		return;
 	}
 
-	glm::mat4 transform = parentTransform * _absolutePosition;
+	markRendered();
+
+	glm::mat4 transform = parentTransform * _renderPosition;
 	queueDrawBound();
 
 	// Queue the nodes
-	for (NodeList::iterator n = _currentState->rootNodes.begin();
-	     n != _currentState->rootNodes.end(); ++n) {
-		(*n)->queueRender(transform);
+	computeRenderTransforms(transform);
+
+	const NodeList &nodes = _currentState->hierarchy.nodes;
+	for (NodeList::const_iterator n = nodes.begin(); n != nodes.end(); ++n)
+		(*n)->queueRender();
+}
+
+bool Model::canQueueRenderParallel() const {
+	if (!_currentState)
+		return true;
+
+	// Drawing the bounding box sets GL state right away
+	if (_drawBound)
+		return false;
+
+	// Nodes with outdated rendering information build their materials, creating shaders
+	const NodeList &nodes = _currentState->hierarchy.nodes;
+	for (NodeList::const_iterator n = nodes.begin(); n != nodes.end(); ++n) {
+		if ((*n)->_dirtyRender)
+			return false;
+
+		if ((*n)->_attachedModel && !(*n)->_attachedModel->canQueueRenderParallel())
+			return false;
 	}
+
+	return true;
+}
+
+void Model::markRendered() {
+	_lastRenderedFrame.store(GfxMan.getFrameCount(), std::memory_order_relaxed);
+}
+
+bool Model::wasRenderedLastFrame() const {
+	// The frame count is only increased after a frame has been completely rendered
+	return (_lastRenderedFrame.load(std::memory_order_relaxed) + 1) >= GfxMan.getFrameCount();
 }
 
 void Model::queueDrawBound() {
@@ -727,7 +1266,7 @@ void Model::queueDrawBound() {
 	object.getMin(minX, minY, minZ);
 	object.getMax(maxX, maxY, maxZ);
 
-	_boundTransform = _absolutePosition;
+	_boundTransform = _renderPosition;
 	_boundTransform *= glm::translate(glm::mat4(), glm::vec3((maxX + minX) * 0.5f, (maxY + minY) * 0.5f, (maxZ + minZ) * 0.5f));
 	_boundTransform *= glm::scale(glm::mat4(), glm::vec3((maxX - minX) * 0.5f, (maxY - minY) * 0.5f, (maxZ - minZ) * 0.5f));
 
@@ -791,7 +1330,7 @@ void Model::doDrawBound() {
 	glEnd();
 	*/
 
-	glm::mat4 tform = _absolutePosition;
+	glm::mat4 tform = _renderPosition;
 	tform = glm::translate(tform, glm::vec3((maxX + minX) * 0.5f, (maxY + minY) * 0.5f, (maxZ + minZ) * 0.5f));
 	tform = glm::scale(tform, glm::vec3((maxX - minX) * 0.5f, (maxY - minY) * 0.5f, (maxZ - minZ) * 0.5f));
 	_boundRenderable.renderImmediate(tform);
@@ -838,6 +1377,12 @@ void Model::finalize() {
 		for (NodeList::iterator n = (*s)->rootNodes.begin(); n != (*s)->rootNodes.end(); ++n)
 			(*n)->orderChildren();
 
+	flattenNodeHierarchies();
+
+	// Models using us as their supermodel share these, so keep them small
+	for (AnimationMap::iterator a = _animationMap.begin(); a != _animationMap.end(); ++a)
+		a->second->compress();
+
 	AnimationChannelMap::iterator c = _animationChannels.begin();
 	c->second->playDefaultAnimation();
 
@@ -891,6 +1436,8 @@ void Model::createBound() {
 	_center[2] = minZ + ((maxZ - minZ) / 2.0f);
 
 
+	std::lock_guard<std::mutex> lock(_transformMutex);
+
 	_absoluteBoundBox = _boundBox;
 	_absoluteBoundBox.transform(_absolutePosition);
 	_absoluteBoundBox.absolutize();
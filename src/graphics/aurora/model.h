@@ -28,11 +28,14 @@
 #include <vector>
 #include <list>
 #include <map>
+#include <memory>
+#include <atomic>
 
 #include "external/glm/mat4x4.hpp"
 
 #include "src/common/ustring.h"
 #include "src/common/boundingbox.h"
+#include "src/common/mutex.h"
 
 #include "src/graphics/types.h"
 #include "src/graphics/glcontainer.h"
@@ -92,6 +95,16 @@ public:
 	bool isIn(float x, float y, float z) const;
 	/** Does the line from x1.y1.z1 to x2.y2.z2 intersect with model's bounding box? */
 	bool isIn(float x1, float y1, float z1, float x2, float y2, float z2) const;
+	/** Get the model's bounding box in world space, as a box to pick the model with. */
+	bool getPickBox(glm::vec3 &min, glm::vec3 &max) const;
+
+	/** Is any part of the model's bounding box within the view frustum? */
+	bool isInFrustum(const Common::Frustum &frustum) const;
+	/** Get the model's bounding box in world space. */
+	bool getWorldBound(Common::BoundingBox &bound) const;
+
+	/** Copy the model's placement for rendering. */
+	void snapshot();
 
 	// Positioning
 
@@ -151,6 +164,9 @@ public:
 	/** Get all nodes in the current state. */
 	const std::vector<ModelNode *> &getNodes();
 
+	/** Add all textures the nodes in the current state use to the list, each only once. */
+	void getTextures(std::list<TextureHandle> &textures) const;
+
 	// Animation
 
 	/** Determine what animation scaling applies. */
@@ -187,6 +203,7 @@ public:
 	void render(RenderPass pass);
 	void renderImmediate(const glm::mat4 &parentTransform);
 	void queueRender(const glm::mat4 &parentTransform);
+	bool canQueueRenderParallel() const;
 	void advanceTime(float dt);
 
 	// Attached models
@@ -208,12 +225,44 @@ public:
 	/** Apply buffered changes to position and geometry of the model nodes. */
 	void flushNodeBuffers();
 
+	/** Merge the geometry of all static nodes into a few large meshes, one for each set of textures.
+	 *
+	 *  Nodes that can move, because an animation moves them or one of their
+	 *  parents, and nodes that need special treatment (transparency,
+	 *  environment maps, skinning, ...) stay separate. Only the fixed-function
+	 *  renderer draws the merged meshes.
+	 *
+	 *  Call this once the model is set up. Later changes to the merged nodes
+	 *  won't be visible anymore.
+	 */
+	void batchStaticNodes();
+
 protected:
 	typedef std::vector<ModelNode *> NodeList;
 	typedef std::map<Common::UString, ModelNode *, Common::UString::iless> NodeMap;
 	typedef std::map<Common::UString, Animation *, Common::UString::iless> AnimationMap;
 	typedef std::map<AnimationChannelName, AnimationChannel *> AnimationChannelMap;
 
+	/** A state's node hierarchy, flattened for transform propagation.
+	 *
+	 *  The nodes are in depth-first order, so every node comes after its parent
+	 *  and the nodes are visited in the same order as walking the children.
+	 *  The transforms are kept in arrays of their own, so that propagating them
+	 *  down the hierarchy is a single linear pass.
+	 */
+	struct NodeHierarchy {
+		NodeList nodes;               ///< The nodes, in depth-first order.
+		std::vector<int32_t> parents; ///< Index of each node's parent, or -1 for root nodes.
+
+		std::vector<glm::mat4> localBase;    ///< Local base transforms, for skeletal animation.
+		std::vector<glm::mat4> absoluteBase; ///< Absolute base transforms, for skeletal animation.
+		std::vector<glm::mat4> local;        ///< Local transforms, for skeletal animation.
+		std::vector<glm::mat4> absolute;     ///< Absolute transforms, for skeletal animation.
+
+		std::vector<glm::mat4> renderLocal; ///< Local transforms, for rendering.
+		std::vector<glm::mat4> render;      ///< Transforms relative to the view, for rendering.
+	};
+
 	/** A model state. */
 	struct State {
 		Common::UString name; ///< The state's name.
@@ -222,6 +271,8 @@ protected:
 		NodeMap  nodeMap;  ///< The nodes within the state, indexed by name.
 
 		NodeList rootNodes; ///< The nodes in the state without a parent.
+
+		NodeHierarchy hierarchy; ///< The flattened node hierarchy.
 	};
 
 	typedef std::list<State *> StateList;
@@ -262,9 +313,23 @@ protected:
 	/** The model's box after translate/rotate. */
 	Common::BoundingBox _absoluteBoundBox;
 
+	/** Protects the placement against concurrent snapshots. */
+	mutable std::mutex _transformMutex;
+
+	glm::mat4 _renderPosition;            ///< _absolutePosition, as of the current frame.
+	Common::BoundingBox _renderBoundBox;  ///< _absoluteBoundBox, as of the current frame.
+
 	bool _hasSkinNodes;
 	bool _positionRelative;
 
+	/** The merged geometry of static nodes that use the same textures. */
+	struct StaticBatch {
+		std::vector<TextureHandle> textures;
+		std::unique_ptr<Graphics::Mesh::Mesh> mesh;
+	};
+
+	std::vector<StaticBatch> _staticBatches;
+
 
 	// Rendering
 	void queueDrawBound();
@@ -280,6 +345,12 @@ protected:
 	/** Finalize the loading procedure. */
 	void finalize();
 
+	/** Flatten the node hierarchy of every state.
+	 *
+	 *  Must be called again whenever nodes are reparented or reordered.
+	 */
+	void flattenNodeHierarchies();
+
 
 	// GLContainer
 	void doRebuild();
@@ -294,8 +365,17 @@ private:
 	bool _drawSkeleton;
 	bool _drawSkeletonInvisible;
 
+	std::atomic<uint32_t> _lastRenderedFrame; ///< The frame this model was last rendered in.
+
 	std::map<Common::UString, Model *> _attachedModels;
 
+	typedef std::pair<const State *, const Animation *> AnimationNodeMapKey;
+	typedef std::map<AnimationNodeMapKey, std::vector<ModelNode *> > AnimationNodeMaps;
+
+	/** The model nodes moved by each animation, per state. */
+	AnimationNodeMaps _animationNodeMaps;
+	std::mutex _animationNodeMapMutex;
+
 	/** Create the list of all state names. */
 	void createStateNamesList(std::list<Common::UString> *stateNames = 0);
 	/** Create the model's bounding box. */
@@ -303,7 +383,44 @@ private:
 
 	void createAbsolutePosition();
 
-	void manageAnimations(float dt);
+	/** Append a node and all its children to the flattened hierarchy. */
+	static void flattenNode(NodeHierarchy &hierarchy, ModelNode *node, int32_t parent);
+
+	/** Compute the render transforms of all nodes in the current state. */
+	void computeRenderTransforms(const glm::mat4 &transform);
+
+	/** Return the size, in pixels, of the model on screen. 0 if unknown. */
+	float getScreenSize(const glm::mat4 &modelview) const;
+
+	/** Render the nodes of this model with the fixed-function pipeline,
+	 *  relative to the given modelview matrix. */
+	void renderNodes(RenderPass pass, const glm::mat4 &parentTransform);
+	void renderStaticBatches();
+
+	/** Can this node's geometry be merged into a static batch? */
+	bool isBatchable(const ModelNode &node) const;
+	/** Create a static batch out of these nodes, which share the same textures and vertex layout. */
+	void createStaticBatch(const std::vector<size_t> &nodes, const std::vector<glm::mat4> &transforms);
+
+	/** Advance the animations of this model and all attached models.
+	 *
+	 *  If evaluate is false, only the animation clocks are advanced,
+	 *  and the nodes keep their current pose.
+	 */
+	void manageAnimations(float dt, bool evaluate = true);
+
+	/** Get the nodes of the current state an animation moves, indexed by node number in the animation.
+	 *
+	 *  The nodes are looked up by name, in this model, its attached models and
+	 *  its super model, once per state and animation.
+	 */
+	void getAnimationNodeMap(const Animation &animation, std::vector<ModelNode *> &modelNodeMap);
+	void createAnimationNodeMap(const Animation &animation, std::vector<ModelNode *> &modelNodeMap);
+
+	/** Remember that this model is being rendered in the current frame. */
+	void markRendered();
+	/** Was this model rendered in the last completed frame? */
+	bool wasRenderedLastFrame() const;
 
 public:
 	// General loading helpers
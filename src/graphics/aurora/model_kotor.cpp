@@ -29,8 +29,10 @@
 #include "external/glm/gtc/type_ptr.hpp"
 
 #include "src/common/error.h"
+#include "src/common/mutex.h"
 #include "src/common/maths.h"
 #include "src/common/readstream.h"
+#include "src/common/memreader.h"
 #include "src/common/encoding.h"
 #include "src/common/strutil.h"
 
@@ -66,6 +68,9 @@ static const int kNodeFlagHasDangly    = 0x0100;
 static const int kNodeFlagHasAABB      = 0x0200;
 static const int kNodeFlagHasSaber     = 0x0800;
 
+/** Nodes with any of these flags need a mesh of their own in every model instance. */
+static const int kNodeFlagsUniqueMesh = kNodeFlagHasSkin | kNodeFlagHasDangly | kNodeFlagHasSaber;
+
 static const uint32_t kControllerTypePosition             = 8;
 static const uint32_t kControllerTypeOrientation          = 20;
 static const uint32_t kControllerTypeScale                = 36;
@@ -122,7 +127,7 @@ namespace Aurora {
 
 Model_KotOR::ParserContext::ParserContext(const Common::UString &name,
                                           const Common::UString &t, bool k2, bool x) :
-	mdl(0), mdx(0), state(0), texture(t), kotor2(k2), xbox(x), mdxStructSize(0), vertexCount(0),
+	mdl(0), mdx(0), mdxReader(0), state(0), texture(t), kotor2(k2), xbox(x), mdxStructSize(0), vertexCount(0),
 	offNodeData(0) {
 
 	try {
@@ -132,8 +137,12 @@ Model_KotOR::ParserContext::ParserContext(const Common::UString &name,
 		if (!(mdx = ResMan.getResource(name, ::Aurora::kFileTypeMDX)))
 			throw Common::Exception("No such MDX \"%s\"", name.c_str());
 
+		// The vertex data is read in many small pieces, so read it without going through the stream
+		mdxReader = new Common::MemoryReader(*mdx);
+
 	} catch (...) {
 		delete mdl;
+		delete mdxReader;
 		delete mdx;
 		throw;
 	}
@@ -141,6 +150,7 @@ Model_KotOR::ParserContext::ParserContext(const Common::UString &name,
 
 Model_KotOR::ParserContext::~ParserContext() {
 	delete mdl;
+	delete mdxReader;
 	delete mdx;
 
 	clear();
@@ -169,6 +179,7 @@ Model_KotOR::Model_KotOR(const Common::UString &name, bool kotor2, bool xbox, Mo
 
 	if (_hasSkinNodes) {
 		fillBoneNodeMap();
+		flattenNodeHierarchies();
 		computeNodeTransforms();
 		reparentHeadNodes();
 	}
@@ -329,8 +340,13 @@ bool Model_KotOR::readAnim(ParserContext &ctx, uint32_t offset) {
 	return true;
 }
 
+/** Guards the supermodel cache, since models can be loaded on several threads at once. */
+static std::recursive_mutex kSuperModelMutex;
+
 void Model_KotOR::loadSuperModel(ModelCache *modelCache, bool kotor2, bool xbox) {
 	if (!_superModelName.empty() && _superModelName != "NULL") {
+		std::lock_guard<std::recursive_mutex> lock(kSuperModelMutex);
+
 		bool foundInCache = false;
 
 		if (modelCache) {
@@ -543,6 +559,9 @@ void ModelNode_KotOR::load(Model_KotOR::ParserContext &ctx) {
 		readSaber(ctx);
 	}
 
+	// The children overwrite the flags in the context
+	const bool uniqueMesh = (ctx.flags & kNodeFlagsUniqueMesh) != 0;
+
 	for (std::vector<uint32_t>::const_iterator child = children.begin(); child != children.end(); ++child) {
 		ModelNode_KotOR *childNode = new ModelNode_KotOR(*_model);
 		ctx.nodes.push_back(childNode);
@@ -553,7 +572,12 @@ void ModelNode_KotOR::load(Model_KotOR::ParserContext &ctx) {
 		childNode->load(ctx);
 	}
 
-	if (_mesh && _mesh->data) {
+	if (_mesh && _mesh->data && !uniqueMesh) {
+		// Shared mesh, already set up in readMesh()
+		if (GfxMan.isRendererExperimental())
+			buildMaterial();
+
+	} else if (_mesh && _mesh->data) {
 		Common::UString meshName = ctx.mdlName;
 		meshName += ".";
 		if (ctx.state->name.size() != 0) {
@@ -648,7 +672,6 @@ void ModelNode_KotOR::declareShaderInputs(MaterialConfiguration &config, Shader:
 
 	if (_mesh->skin && _mesh->skin->boneMappingCount) {
 		config.materialName += ".skinned";
-		cripter.declareUniform(Shader::ShaderDescriptor::UNIFORM_V_BIND_POSE);
 		cripter.declareUniform(Shader::ShaderDescriptor::UNIFORM_V_BONE_TRANSFORMS, _mesh->skin->boneMappingCount);
 		cripter.declareInput(Shader::ShaderDescriptor::INPUT_BONE_INDICES);
 		cripter.declareInput(Shader::ShaderDescriptor::INPUT_BONE_WEIGHTS);
@@ -844,8 +867,6 @@ void ModelNode_KotOR::readMesh(Model_KotOR::ParserContext &ctx) {
 	_render = _mesh->render;
 	_mesh->data = new MeshData();
 	_mesh->data->envMapMode = kModeEnvironmentBlendedOver;
-	_mesh->data->rawMesh = new Graphics::Mesh::Mesh();
-	_mesh->data->rawMesh->setBindPosePtr(&_absoluteBaseTransform);
 
 	uint32_t endPos = ctx.mdl->pos();
 
@@ -860,58 +881,122 @@ void ModelNode_KotOR::readMesh(Model_KotOR::ParserContext &ctx) {
 	ctx.textures.resize(ctx.textureCount);
 	loadTextures(ctx.textures);
 
+	/* Meshes that are never modified after loading are shared between all
+	 * instances of the model. If another instance already read this one,
+	 * we don't need to read the vertices and faces at all. */
+	Common::UString sharedName;
+	if (!(ctx.flags & kNodeFlagsUniqueMesh)) {
+		// The offset disambiguates nodes of the same name, as found in some KotOR2 tiles
+		sharedName = Common::UString::format("%s.%s.%s@%u", ctx.mdlName.c_str(),
+				ctx.state->name.empty() ? "xoreos.default" : ctx.state->name.c_str(),
+				_name.c_str(), static_cast<uint>(P));
+
+		_mesh->data->rawMesh = MeshMan.acquireMesh(sharedName);
+		if (_mesh->data->rawMesh) {
+			_mesh->data->sharedMesh = true;
+
+			createBound();
+
+			ctx.mdl->seek(endPos);
+			return;
+		}
+	}
+
+	_mesh->data->rawMesh = new Graphics::Mesh::Mesh();
+	if (sharedName.empty())
+		_mesh->data->rawMesh->setBindPosePtr(&_absoluteBaseTransform);
+
 
 	// Read vertices (interleaved)
 
+	const bool packed = usePackedVertices();
+
 	VertexDecl vertexDecl;
 
 	vertexDecl.push_back(VertexAttrib(VPOSITION, 3, GL_FLOAT));
-	vertexDecl.push_back(VertexAttrib(VNORMAL  , 3, GL_FLOAT));
 
-	if (ctx.flags & kNodeFlagHasSkin) {
+	if (packed)
+		vertexDecl.push_back(VertexAttrib(VNORMAL, 4, GL_INT_2_10_10_10_REV, GL_TRUE));
+	else
+		vertexDecl.push_back(VertexAttrib(VNORMAL, 3, GL_FLOAT));
+
+	if ((ctx.flags & kNodeFlagHasSkin) && packed) {
+		vertexDecl.push_back(VertexAttrib(VBONEWEIGHTS, 4, GL_UNSIGNED_BYTE, GL_TRUE));
+		vertexDecl.push_back(VertexAttrib(VBONEINDICES, 4, GL_UNSIGNED_BYTE));
+	} else if (ctx.flags & kNodeFlagHasSkin) {
 		vertexDecl.push_back(VertexAttrib(VBONEWEIGHTS, 4, GL_FLOAT));
 		vertexDecl.push_back(VertexAttrib(VBONEINDICES, 4, GL_FLOAT));
 	}
 
 	for (uint t = 0; t < ctx.textureCount; t++)
-		vertexDecl.push_back(VertexAttrib(VTCOORD + t, 2, GL_FLOAT));
-
-	_mesh->data->rawMesh->getVertexBuffer()->setVertexDeclInterleave(ctx.vertexCount, vertexDecl);
-	_mesh->data->initialVertexCoords.resize(3 * ctx.vertexCount);
-
-	float *v = reinterpret_cast<float *>(_mesh->data->rawMesh->getVertexBuffer()->getData());
-	float *iv = _mesh->data->initialVertexCoords.data();
-
-	for (uint32_t i = 0; i < ctx.vertexCount; i++) {
-		// Position
-		ctx.mdx->seek(ctx.offNodeData + i * ctx.mdxStructSize);
-		iv[0] = ctx.mdx->readIEEEFloatLE();
-		iv[1] = ctx.mdx->readIEEEFloatLE();
-		iv[2] = ctx.mdx->readIEEEFloatLE();
-		*v++ = iv[0];
-		*v++ = iv[1];
-		*v++ = iv[2];
-		iv += 3;
-
-		// Normal
-		//ctx.mdx->seek(offNodeData + i * mdxStructSize + offNormals);
-		*v++ = ctx.mdx->readIEEEFloatLE();
-		*v++ = ctx.mdx->readIEEEFloatLE();
-		*v++ = ctx.mdx->readIEEEFloatLE();
+		vertexDecl.push_back(VertexAttrib(VTCOORD + t, 2, packed ? GL_HALF_FLOAT : GL_FLOAT));
+
+	VertexBuffer &vertexBuffer = *_mesh->data->rawMesh->getVertexBuffer();
+	vertexBuffer.setVertexDeclInterleave(ctx.vertexCount, vertexDecl);
+
+	/* Only meshes skinned on the CPU need a copy of the initial vertex positions,
+	 * as the base for skinning. The shader renderer skins on the GPU. */
+	float *iv = 0;
+	if ((ctx.flags & kNodeFlagHasSkin) && !GfxMan.isRendererExperimental()) {
+		_mesh->data->initialVertexCoords.resize(3 * ctx.vertexCount);
+		iv = _mesh->data->initialVertexCoords.data();
+	}
+
+	byte *vertexData = reinterpret_cast<byte *>(vertexBuffer.getData());
+
+	const uint32_t normalSize = packed ? 4 : (3 * 4);
+	const uint32_t skinSize   = (ctx.flags & kNodeFlagHasSkin) ? (packed ? (2 * 4) : (8 * 4)) : 0;
+
+	Common::MemoryReader &mdx = *ctx.mdxReader;
+
+	for (uint32_t i = 0; i < ctx.vertexCount; i++, vertexData += vertexBuffer.getSize()) {
+		// Position and normal
+		mdx.seek(ctx.offNodeData + i * ctx.mdxStructSize);
+		Common::MemoryReader::Block vertex = mdx.readBlock(6 * 4);
+
+		float *v = reinterpret_cast<float *>(vertexData);
+
+		v[0] = vertex.readIEEEFloatLE();
+		v[1] = vertex.readIEEEFloatLE();
+		v[2] = vertex.readIEEEFloatLE();
+		if (iv) {
+			std::memcpy(iv, v, 3 * sizeof(float));
+			iv += 3;
+		}
+
+		float normal[3];
+		normal[0] = vertex.readIEEEFloatLE();
+		normal[1] = vertex.readIEEEFloatLE();
+		normal[2] = vertex.readIEEEFloatLE();
+
+		if (packed) {
+			const uint32_t packedNormal = packNormal(normal[0], normal[1], normal[2]);
+			std::memcpy(vertexData + 3 * 4, &packedNormal, 4);
+		} else
+			std::memcpy(vertexData + 3 * 4, normal, 3 * 4);
 
 		// Bone indices and bone weights are loaded later on
-		if (ctx.flags & kNodeFlagHasSkin)
-			v += 8;
 
 		// TexCoords
+		byte *uvData = vertexData + 3 * 4 + normalSize + skinSize;
 		for (uint16_t t = 0; t < ctx.textureCount; t++) {
+			float uv[2] = { 0.0f, 0.0f };
+
 			if (offUV[t] != 0xFFFFFFFF) {
-				ctx.mdx->seek(ctx.offNodeData + i * ctx.mdxStructSize + offUV[t]);
-				*v++ = ctx.mdx->readIEEEFloatLE();
-				*v++ = ctx.mdx->readIEEEFloatLE();
+				mdx.seek(ctx.offNodeData + i * ctx.mdxStructSize + offUV[t]);
+				Common::MemoryReader::Block uvBlock = mdx.readBlock(2 * 4);
+
+				uv[0] = uvBlock.readIEEEFloatLE();
+				uv[1] = uvBlock.readIEEEFloatLE();
+			}
+
+			if (packed) {
+				const uint16_t packedUV[2] = { writeIEEEFloat16(uv[0]), writeIEEEFloat16(uv[1]) };
+				std::memcpy(uvData, packedUV, 2 * 2);
+				uvData += 2 * 2;
 			} else {
-				*v++ = 0.0f;
-				*v++ = 0.0f;
+				std::memcpy(uvData, uv, 2 * 4);
+				uvData += 2 * 4;
 			}
 		}
 	}
@@ -932,6 +1017,13 @@ void ModelNode_KotOR::readMesh(Model_KotOR::ParserContext &ctx) {
 
 	createBound();
 
+	if (!sharedName.empty()) {
+		// Rooms of different modules often contain the same geometry
+		_mesh->data->rawMesh->setName(sharedName);
+		_mesh->data->rawMesh = MeshMan.addSharedMesh(_mesh->data->rawMesh);
+		_mesh->data->sharedMesh = true;
+	}
+
 	ctx.mdl->seek(endPos);
 }
 
@@ -959,46 +1051,78 @@ void ModelNode_KotOR::readSkin(Model_KotOR::ParserContext &ctx) {
 
 	ctx.mdl->seek(pos);
 
+	// The CPU copies are only needed when skinning on the CPU
+	const bool keepCopies = !GfxMan.isRendererExperimental();
+
 	std::vector<float> &boneWeights = _mesh->skin->boneWeights;
 	std::vector<float> &boneMappingId = _mesh->skin->boneMappingId;
 
+	if (keepCopies) {
+		boneWeights.reserve(4 * ctx.vertexCount);
+		boneMappingId.reserve(4 * ctx.vertexCount);
+	}
+
 	VertexBuffer *vertexBuffer = _mesh->data->rawMesh->getVertexBuffer();
-	float *vertexData = static_cast<float *>(vertexBuffer->getData());
 
-	for (int i = 0; i < ctx.vertexCount; i++) {
-		// Skip position and normal attributes
-		vertexData += 6;
+	// Find the bone attributes readMesh() made room for
+	const VertexAttrib *weightsAttrib = 0, *indicesAttrib = 0;
 
-		// Bone weights
-		ctx.mdx->seek(ctx.offNodeData + i * ctx.mdxStructSize + mdxOffsetBoneWeights);
-		vertexData[0] = ctx.mdx->readIEEEFloatLE();
-		vertexData[1] = ctx.mdx->readIEEEFloatLE();
-		vertexData[2] = ctx.mdx->readIEEEFloatLE();
-		vertexData[3] = ctx.mdx->readIEEEFloatLE();
+	const VertexDecl &vertexDecl = vertexBuffer->getVertexDecl();
+	for (VertexDecl::const_iterator a = vertexDecl.begin(); a != vertexDecl.end(); ++a) {
+		if (a->index == VBONEWEIGHTS)
+			weightsAttrib = &*a;
+		else if (a->index == VBONEINDICES)
+			indicesAttrib = &*a;
+	}
+
+	if (!weightsAttrib || !indicesAttrib)
+		throw Common::Exception("Skin node without bone attributes");
+
+	const bool packed = weightsAttrib->type == GL_UNSIGNED_BYTE;
 
-		boneWeights.push_back(vertexData[0]);
-		boneWeights.push_back(vertexData[1]);
-		boneWeights.push_back(vertexData[2]);
-		boneWeights.push_back(vertexData[3]);
+	byte *vertexData  = reinterpret_cast<byte *>(vertexBuffer->getData());
+	byte *weightsData = vertexData + (reinterpret_cast<const byte *>(weightsAttrib->pointer) - vertexData);
+	byte *indicesData = vertexData + (reinterpret_cast<const byte *>(indicesAttrib->pointer) - vertexData);
+
+	Common::MemoryReader &mdx = *ctx.mdxReader;
+
+	for (int i = 0; i < ctx.vertexCount; i++) {
+		// Bone weights
+		mdx.seek(ctx.offNodeData + i * ctx.mdxStructSize + mdxOffsetBoneWeights);
+		Common::MemoryReader::Block weightsBlock = mdx.readBlock(4 * 4);
 
-		vertexData += 4;
+		float weights[4];
+		for (int j = 0; j < 4; j++)
+			weights[j] = weightsBlock.readIEEEFloatLE();
 
 		// Bone mapping identifiers
-		ctx.mdx->seek(ctx.offNodeData + i * ctx.mdxStructSize + mdxOffsetBoneMappingId);
-		vertexData[0] = ctx.xbox ? static_cast<float>(ctx.mdx->readSint16LE()) : ctx.mdx->readIEEEFloatLE();
-		vertexData[1] = ctx.xbox ? static_cast<float>(ctx.mdx->readSint16LE()) : ctx.mdx->readIEEEFloatLE();
-		vertexData[2] = ctx.xbox ? static_cast<float>(ctx.mdx->readSint16LE()) : ctx.mdx->readIEEEFloatLE();
-		vertexData[3] = ctx.xbox ? static_cast<float>(ctx.mdx->readSint16LE()) : ctx.mdx->readIEEEFloatLE();
+		mdx.seek(ctx.offNodeData + i * ctx.mdxStructSize + mdxOffsetBoneMappingId);
+		Common::MemoryReader::Block ids = mdx.readBlock(4 * (ctx.xbox ? 2 : 4));
+
+		float indices[4];
+		for (int j = 0; j < 4; j++)
+			indices[j] = ctx.xbox ? static_cast<float>(ids.readSint16LE()) : ids.readIEEEFloatLE();
+
+		if (keepCopies) {
+			boneWeights.insert(boneWeights.end(), weights, weights + 4);
+			boneMappingId.insert(boneMappingId.end(), indices, indices + 4);
+		}
 
-		boneMappingId.push_back(vertexData[0]);
-		boneMappingId.push_back(vertexData[1]);
-		boneMappingId.push_back(vertexData[2]);
-		boneMappingId.push_back(vertexData[3]);
+		if (packed) {
+			// Unused bones (index -1) get bone 0 with a weight of 0, which has no effect
+			for (int j = 0; j < 4; j++) {
+				const bool used = indices[j] >= 0.0f;
 
-		vertexData += 4;
+				weightsData[j] = used ? packUnorm8(weights[j]) : 0;
+				indicesData[j] = used ? static_cast<uint8_t>(MIN(indices[j], 255.0f)) : 0;
+			}
+		} else {
+			std::memcpy(weightsData, weights, 4 * 4);
+			std::memcpy(indicesData, indices, 4 * 4);
+		}
 
-		// Skip textures coordinates
-		vertexData += 2 * _mesh->data->textures.size();
+		weightsData += vertexBuffer->getSize();
+		indicesData += vertexBuffer->getSize();
 	}
 }
 
@@ -30,6 +30,7 @@
 
 namespace Common {
 	class SeekableReadStream;
+	class MemoryReader;
 }
 
 namespace Graphics {
@@ -50,6 +51,8 @@ private:
 		Common::SeekableReadStream *mdl;
 		Common::SeekableReadStream *mdx;
 
+		Common::MemoryReader *mdxReader; ///< Fast reader over the whole MDX.
+
 		Common::UString mdlName;
 
 		State *state;
@@ -29,6 +29,7 @@
  */
 
 #include <cassert>
+#include <cstring>
 
 #include <boost/unordered_set.hpp>
 
@@ -36,6 +37,7 @@
 
 #include "src/common/system.h"
 #include "src/common/error.h"
+#include "src/common/mutex.h"
 #include "src/common/maths.h"
 #include "src/common/debug.h"
 #include "src/common/readstream.h"
@@ -285,10 +287,44 @@ void Model_NWN::loadBinary(ParserContext &ctx) {
 }
 
 void Model_NWN::loadASCII(ParserContext &ctx) {
-	ctx.mdl->seek(0);
+	ASCIIModel model;
+
+	const bool useCache = ASCIIModelCache::isEnabled();
+	const uint64_t cacheKey = useCache ? ASCIIModelCache::hash(*ctx.mdl) : 0;
+
+	if (!useCache || !ASCIIModelCache::load(cacheKey, model)) {
+		parseASCII(ctx, model);
+
+		if (useCache)
+			ASCIIModelCache::save(cacheKey, model);
+	}
+
+	_name           = model.name;
+	_superModelName = model.superModelName;
+	_animationScale = model.animationScale;
+
+	debugC(kDebugGraphics, 4, "Loading NWN ASCII model \"%s\": \"%s\"", _fileName.c_str(),
+	       _name.c_str());
 
 	newState(ctx);
 
+	ctx.mdlName = _name;
+
+	for (std::vector<ASCIIModel::Node>::const_iterator n = model.nodes.begin(); n != model.nodes.end(); ++n) {
+		ModelNode_NWN_ASCII *newNode = new ModelNode_NWN_ASCII(*this);
+		ctx.nodes.push_back(newNode);
+
+		newNode->load(ctx, *n);
+	}
+
+	addState(ctx);
+}
+
+void Model_NWN::parseASCII(ParserContext &ctx, ASCIIModel &model) {
+	ctx.mdl->seek(0);
+
+	model.animationScale = _animationScale;
+
 	while (!ctx.mdl->eos()) {
 		std::vector<Common::UString> line;
 
@@ -303,34 +339,29 @@ void Model_NWN::loadASCII(ParserContext &ctx) {
 		line[0].makeLower();
 
 		if        (line[0] == "newmodel") {
-			if (!_name.empty())
+			if (!model.name.empty())
 				warning("Model_NWN_ASCII::load(): More than one model definition");
 
-			debugC(kDebugGraphics, 4, "Loading NWN ASCII model \"%s\": \"%s\"", _fileName.c_str(),
-			       _name.c_str());
-
-			_name = line[1];
-			ctx.mdlName = _name;
+			model.name = line[1];
 		} else if (line[0] == "setsupermodel") {
-			if (line[1] != _name)
+			if (line[1] != model.name)
 				warning("Model_NWN_ASCII::load(): setsupermodel: \"%s\" != \"%s\"",
-				        line[1].c_str(), _name.c_str());
+				        line[1].c_str(), model.name.c_str());
 
 			if (!line[2].empty() && (line[2] != "NULL"))
-				_superModelName = line[2];
+				model.superModelName = line[2];
 
 		} else if (line[0] == "beginmodelgeom") {
-			if (line[1] != _name)
+			if (line[1] != model.name)
 				warning("Model_NWN_ASCII::load(): beginmodelgeom: \"%s\" != \"%s\"",
-				        line[1].c_str(), _name.c_str());
+				        line[1].c_str(), model.name.c_str());
 		} else if (line[0] == "setanimationscale") {
-			Common::parseString(line[1], _animationScale);
+			Common::parseString(line[1], model.animationScale);
 		} else if (line[0] == "node") {
 
-			ModelNode_NWN_ASCII *newNode = new ModelNode_NWN_ASCII(*this);
-			ctx.nodes.push_back(newNode);
+			model.nodes.push_back(ASCIIModel::Node());
 
-			newNode->load(ctx, line[1], line[2]);
+			ModelNode_NWN_ASCII::parse(ctx, line[1], line[2], model.nodes.back());
 
 		} else if (line[0] == "newanim") {
 			ctx.anims.push_back(ctx.mdl->pos());
@@ -342,13 +373,12 @@ void Model_NWN::loadASCII(ParserContext &ctx) {
 		}
 	}
 
-	addState(ctx);
-
 	for (std::vector<uint32_t>::iterator a = ctx.anims.begin(); a != ctx.anims.end(); ++a) {
 		ctx.mdl->seek(*a);
 		readAnimASCII(ctx);
 	}
 }
+
 void Model_NWN::newState(ParserContext &ctx) {
 	ctx.clear();
 
@@ -477,8 +507,13 @@ void Model_NWN::readAnimBinary(ParserContext &ctx, uint32_t offset) {
 
 }
 
+/** Guards the supermodel cache, since models can be loaded on several threads at once. */
+static std::recursive_mutex kSuperModelMutex;
+
 void Model_NWN::loadSuperModel(ModelCache *modelCache) {
 	if (!_superModelName.empty() && _superModelName != "NULL") {
+		std::lock_guard<std::recursive_mutex> lock(kSuperModelMutex);
+
 		bool foundInCache = false;
 
 		if (modelCache) {
@@ -808,13 +843,40 @@ void ModelNode_NWN_Binary::readMesh(Model_NWN::ParserContext &ctx) {
 
 	_render = _mesh->render;
 	_mesh->data = new MeshData();
-	_mesh->data->rawMesh = new Graphics::Mesh::Mesh();
 
 	textures.resize(textureCount);
 	loadTextures(textures);
 
 	size_t endPos = ctx.mdl->pos();
 
+	Common::UString meshName = ctx.mdlName;
+	meshName += ".";
+	if (ctx.state->name.size() != 0) {
+		meshName += ctx.state->name;
+	} else {
+		meshName += "xoreos.default";
+	}
+	meshName += ".";
+	meshName += _name;
+
+	/* Meshes are shared between all instances of the model. If another
+	 * instance already read this one, skip reading the vertices and faces. */
+	_mesh->data->rawMesh = MeshMan.acquireMesh(meshName);
+	if (_mesh->data->rawMesh) {
+		_mesh->data->sharedMesh = true;
+
+		createBound();
+
+		ctx.mdl->seek(endPos);
+
+		if (GfxMan.isRendererExperimental())
+			buildMaterial();
+
+		return;
+	}
+
+	_mesh->data->rawMesh = new Graphics::Mesh::Mesh();
+
 
 	// Read vertices
 
@@ -945,25 +1007,11 @@ void ModelNode_NWN_Binary::readMesh(Model_NWN::ParserContext &ctx) {
 
 	ctx.mdl->seek(endPos);
 
-	Common::UString meshName = ctx.mdlName;
-	meshName += ".";
-	if (ctx.state->name.size() != 0) {
-		meshName += ctx.state->name;
-	} else {
-		meshName += "xoreos.default";
-	}
-	meshName += ".";
-	meshName += _name;
-
-	Graphics::Mesh::Mesh *checkMesh = MeshMan.getMesh(meshName);
-	if (checkMesh) {
-		delete _mesh->data->rawMesh;
-		_mesh->data->rawMesh = checkMesh;
-	} else {
-		_mesh->data->rawMesh->setName(meshName);
-		_mesh->data->rawMesh->init();
-		MeshMan.addMesh(_mesh->data->rawMesh);
-	}
+	/* Different models, like the pieces of a tileset, often contain the same
+	 * geometry. Let the mesh manager hand out only one copy of it. */
+	_mesh->data->rawMesh->setName(meshName);
+	_mesh->data->rawMesh = MeshMan.addSharedMesh(_mesh->data->rawMesh);
+	_mesh->data->sharedMesh = true;
 
 	if (GfxMan.isRendererExperimental())
 		buildMaterial();
@@ -1085,24 +1133,18 @@ ModelNode_NWN_ASCII::ModelNode_NWN_ASCII(Model &model) : ModelNode(model) {
 ModelNode_NWN_ASCII::~ModelNode_NWN_ASCII() {
 }
 
-void ModelNode_NWN_ASCII::load(Model_NWN::ParserContext &ctx,
-                               const Common::UString &type, const Common::UString &name) {
+void ModelNode_NWN_ASCII::parse(Model_NWN::ParserContext &ctx, const Common::UString &type,
+                                const Common::UString &name, ASCIIModel::Node &node) {
 
 	bool end      = false;
 	bool skipNode = false;
 
-	_name = name;
+	node.name = name;
 
-	debugC(kDebugGraphics, 5, "Node \"%s\" in state \"%s\"", _name.c_str(),
-	       ctx.state->name.c_str());
+	debugC(kDebugGraphics, 5, "Node \"%s\"", node.name.c_str());
 
-	if ((type == "trimesh") || (type == "danglymesh") || (type == "skin")) {
-		_mesh = new ModelNode::Mesh();
-		_mesh->hasTransparencyHint = true;
-		_mesh->render = true;
-		if (type == "danglymesh")
-			_mesh->dangly = new Dangly();
-	}
+	node.hasMesh = (type == "trimesh") || (type == "danglymesh") || (type == "skin");
+	node.dangly  = (type == "danglymesh");
 
 	if ((type == "emitter") || (type == "reference") || (type == "aabb")) {
 		// warning("TODO: Node type %s", type.c_str());
@@ -1130,24 +1172,17 @@ void ModelNode_NWN_ASCII::load(Model_NWN::ParserContext &ctx,
 		} else if (skipNode) {
 			continue;
 		} else if (line[0] == "parent") {
-			ModelNode *parent = 0;
-
-			if (!ctx.findNode(line[1], parent))
-				warning("ModelNode_NWN_ASCII::load(): Non-existent parent node \"%s\"",
-				        line[1].c_str());
-
-			setParent(parent);
-
+			node.parent = line[1];
 		} else if (line[0] == "position") {
-			readFloats(line, _position, 3, 1);
+			readFloats(line, node.position, 3, 1);
 		} else if (line[0] == "orientation") {
-			readFloats(line, _orientation, 4, 1);
+			readFloats(line, node.orientation, 4, 1);
 
-			_orientation[3] = Common::rad2deg(_orientation[3]);
+			node.orientation[3] = Common::rad2deg(node.orientation[3]);
 		} else if (line[0] == "render") {
-			Common::parseString(line[1], _mesh->render);
+			Common::parseString(line[1], node.render);
 		} else if (line[0] == "transparencyhint") {
-			Common::parseString(line[1], _mesh->transparencyHint);
+			Common::parseString(line[1], node.transparencyHint);
 		} else if (line[0] == "danglymesh") {
 		} else if (line[0] == "constraints") {
 			uint32_t n;
@@ -1160,7 +1195,7 @@ void ModelNode_NWN_ASCII::load(Model_NWN::ParserContext &ctx,
 			Common::parseString(line[1], n);
 			readWeights(ctx, n);
 		} else if (line[0] == "bitmap") {
-			mesh.textures.push_back(line[1]);
+			node.textures.push_back(line[1]);
 		} else if (line[0] == "verts") {
 			Common::parseString(line[1], mesh.vCount);
 
@@ -1184,10 +1219,70 @@ void ModelNode_NWN_ASCII::load(Model_NWN::ParserContext &ctx,
 	if (!end)
 		throw Common::Exception("ModelNode_NWN_ASCII::load(): node without endnode");
 
-	if (!mesh.textures.empty() && !ctx.texture.empty())
-		mesh.textures[0] = ctx.texture;
+	if (node.hasMesh)
+		processMesh(mesh, node);
+}
+
+void ModelNode_NWN_ASCII::load(Model_NWN::ParserContext &ctx, const ASCIIModel::Node &node) {
+	_name = node.name;
+
+	debugC(kDebugGraphics, 5, "Node \"%s\" in state \"%s\"", _name.c_str(),
+	       ctx.state->name.c_str());
+
+	if (!node.parent.empty()) {
+		ModelNode *parent = 0;
+
+		if (!ctx.findNode(node.parent, parent))
+			warning("ModelNode_NWN_ASCII::load(): Non-existent parent node \"%s\"",
+			        node.parent.c_str());
+
+		setParent(parent);
+	}
+
+	for (size_t i = 0; i < 3; i++)
+		_position[i] = node.position[i];
+	for (size_t i = 0; i < 4; i++)
+		_orientation[i] = node.orientation[i];
+
+	if (!node.hasMesh)
+		return;
 
-	processMesh(mesh);
+	_mesh = new ModelNode::Mesh();
+	_mesh->hasTransparencyHint = true;
+	_mesh->render              = node.render;
+	_mesh->transparencyHint    = node.transparencyHint;
+	if (node.dangly)
+		_mesh->dangly = new Dangly();
+
+	if (node.vertexCount == 0)
+		return;
+
+	std::vector<Common::UString> textures = node.textures;
+	if (!textures.empty() && !ctx.texture.empty())
+		textures[0] = ctx.texture;
+
+	_render = _mesh->render;
+	_mesh->data = new MeshData();
+	_mesh->data->rawMesh = new Graphics::Mesh::Mesh();
+
+	loadTextures(textures);
+
+	VertexDecl vertexDecl;
+
+	vertexDecl.push_back(VertexAttrib(VPOSITION, 3, GL_FLOAT));
+	vertexDecl.push_back(VertexAttrib(VNORMAL  , 3, GL_FLOAT));
+	for (uint t = 0; t < node.textures.size(); t++)
+		vertexDecl.push_back(VertexAttrib(VTCOORD + t, 2, GL_FLOAT));
+
+	VertexBuffer &vertexBuffer = *_mesh->data->rawMesh->getVertexBuffer();
+	vertexBuffer.setVertexDeclInterleave(node.vertexCount, vertexDecl);
+	std::memcpy(vertexBuffer.getData(), &node.vertices[0], node.vertices.size() * sizeof(float));
+
+	IndexBuffer &indexBuffer = *_mesh->data->rawMesh->getIndexBuffer();
+	indexBuffer.setSize(node.indices.size(), sizeof(uint32_t), GL_UNSIGNED_INT);
+	std::memcpy(indexBuffer.getData(), &node.indices[0], node.indices.size() * sizeof(uint32_t));
+
+	createBound();
 
 	Common::UString meshName = ctx.mdlName;
 	meshName += ".";
@@ -1199,24 +1294,15 @@ void ModelNode_NWN_ASCII::load(Model_NWN::ParserContext &ctx,
 	meshName += ".";
 	meshName += _name;
 
-	if (!_mesh) {
-		return;
-	}
-
-	if (!_mesh->data) {
-		return;
-	}
-
-	if (!_mesh->data->rawMesh) {
-		return;
-	}
+	Graphics::Mesh::Mesh *namedMesh = MeshMan.getMesh(meshName);
 
 	_mesh->data->rawMesh->setName(meshName);
-	_mesh->data->rawMesh->init();
-	if (MeshMan.getMesh(meshName)) {
+	_mesh->data->rawMesh = MeshMan.addSharedMesh(_mesh->data->rawMesh);
+	_mesh->data->sharedMesh = true;
+
+	if (namedMesh && (namedMesh != _mesh->data->rawMesh)) {
 		warning("Warning: probable mesh duplication of: %s", meshName.c_str());
 	}
-	MeshMan.addMesh(_mesh->data->rawMesh);
 
 	if (GfxMan.isRendererExperimental())
 		buildMaterial();
@@ -1371,17 +1457,11 @@ std::size_t hash_value(const FaceVert &b) {
 	return seed;
 }
 
-void ModelNode_NWN_ASCII::processMesh(ModelNode_NWN_ASCII::Mesh &mesh) {
+void ModelNode_NWN_ASCII::processMesh(const Mesh &mesh, ASCIIModel::Node &node) {
 	if ((mesh.vCount == 0) || (mesh.tCount == 0) || (mesh.faceCount == 0))
 		return;
 
-	_render = _mesh->render;
-	_mesh->data = new MeshData();
-	_mesh->data->rawMesh = new Graphics::Mesh::Mesh();
-
-	loadTextures(mesh.textures);
-
-	const size_t textureCount = mesh.textures.size();
+	const size_t textureCount = node.textures.size();
 	if (textureCount > 1)
 		warning("ModelNode_NWN_ASCII::processMesh(): textureCount == %u", (uint)textureCount);
 
@@ -1389,13 +1469,13 @@ void ModelNode_NWN_ASCII::processMesh(ModelNode_NWN_ASCII::Mesh &mesh) {
 	// Read faces
 
 	uint32_t facesCount = mesh.faceCount;
-	_mesh->data->rawMesh->getIndexBuffer()->setSize(facesCount * 3, sizeof(uint32_t), GL_UNSIGNED_INT);
+	node.indices.resize(facesCount * 3);
 
 	boost::unordered_set<FaceVert> verts;
 	typedef boost::unordered_set<FaceVert>::iterator verts_set_it;
 
 	uint32_t vertexCount = 0;
-	uint32_t *f = reinterpret_cast<uint32_t *>(_mesh->data->rawMesh->getIndexBuffer()->getData());
+	uint32_t *f = &node.indices[0];
 	for (uint32_t i = 0; i < facesCount; i++) {
 		const uint32_t v[3] = {mesh.vIA[i], mesh.vIB[i], mesh.vIC[i]};
 		const uint32_t t[3] = {mesh.tIA[i], mesh.tIB[i], mesh.tIC[i]};
@@ -1424,18 +1504,13 @@ void ModelNode_NWN_ASCII::processMesh(ModelNode_NWN_ASCII::Mesh &mesh) {
 
 	// Read vertices (interleaved)
 
-	VertexDecl vertexDecl;
+	const size_t stride = 6 + 2 * textureCount;
 
-	vertexDecl.push_back(VertexAttrib(VPOSITION, 3, GL_FLOAT));
-	vertexDecl.push_back(VertexAttrib(VNORMAL  , 3, GL_FLOAT));
-	for (uint t = 0; t < textureCount; t++)
-		vertexDecl.push_back(VertexAttrib(VTCOORD + t, 2, GL_FLOAT));
-
-	_mesh->data->rawMesh->getVertexBuffer()->setVertexDeclInterleave(vertexCount, vertexDecl);
+	node.vertexCount = vertexCount;
+	node.vertices.resize(vertexCount * stride);
 
 	for (verts_set_it i = verts.begin(); i != verts.end(); ++i) {
-		byte  *vData = reinterpret_cast<byte  *>(_mesh->data->rawMesh->getVertexBuffer()->getData()) + i->i * _mesh->data->rawMesh->getVertexBuffer()->getSize();
-		float *v     = reinterpret_cast<float *>(vData);
+		float *v = &node.vertices[i->i * stride];
 
 		// Position
 		*v++ = mesh.vX[i->p];
@@ -1448,20 +1523,16 @@ void ModelNode_NWN_ASCII::processMesh(ModelNode_NWN_ASCII::Mesh &mesh) {
 		*v++ = i->n[2];
 
 		// TexCoord
-		if (i->t < mesh.tCount) {
-			*v++ = mesh.tX[i->t];
-			*v++ = mesh.tY[i->t];
-		} else {
-			*v++ = 0.0f;
-			*v++ = 0.0f;
-		}
-		for (uint16_t t = 1; t < textureCount; t++) {
-			*v++ = 0.0f;
-			*v++ = 0.0f;
+		for (size_t t = 0; t < textureCount; t++) {
+			if ((t == 0) && (i->t < mesh.tCount)) {
+				*v++ = mesh.tX[i->t];
+				*v++ = mesh.tY[i->t];
+			} else {
+				*v++ = 0.0f;
+				*v++ = 0.0f;
+			}
 		}
 	}
-
-	createBound();
 }
 
 } // End of namespace Aurora
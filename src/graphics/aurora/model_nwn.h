@@ -27,6 +27,7 @@
 
 #include "src/graphics/aurora/model.h"
 #include "src/graphics/aurora/modelnode.h"
+#include "src/graphics/aurora/asciimodelcache.h"
 
 namespace Common {
 	class SeekableReadStream;
@@ -86,6 +87,7 @@ private:
 	void readAnimBinary(ParserContext &ctx, uint32_t offset);
 
 	void loadASCII(ParserContext &ctx);
+	void parseASCII(ParserContext &ctx, ASCIIModel &model);
 	void readAnimASCII(ParserContext &ctx);
 	void skipAnimASCII(ParserContext &ctx);
 
@@ -121,8 +123,12 @@ public:
 	ModelNode_NWN_ASCII(Model &model);
 	~ModelNode_NWN_ASCII();
 
-	void load(Model_NWN::ParserContext &ctx,
-	          const Common::UString &type, const Common::UString &name);
+	/** Build the node out of its parsed (or cached) description. */
+	void load(Model_NWN::ParserContext &ctx, const ASCIIModel::Node &node);
+
+	/** Parse a node out of the ASCII MDL, without creating anything. */
+	static void parse(Model_NWN::ParserContext &ctx, const Common::UString &type,
+	                  const Common::UString &name, ASCIIModel::Node &node);
 
 private:
 	struct Mesh {
@@ -130,8 +136,6 @@ private:
 		uint32_t tCount;
 		uint32_t faceCount;
 
-		std::vector<Common::UString> textures;
-
 		std::vector<float> vX, vY, vZ;
 		std::vector<float> tX, tY;
 
@@ -143,18 +147,19 @@ private:
 		Mesh();
 	};
 
-	void readConstraints(Model_NWN::ParserContext &ctx, uint32_t n);
-	void readWeights(Model_NWN::ParserContext &ctx, uint32_t n);
+	static void readConstraints(Model_NWN::ParserContext &ctx, uint32_t n);
+	static void readWeights(Model_NWN::ParserContext &ctx, uint32_t n);
 
-	void readFloats(const std::vector<Common::UString> &strings,
-	                float *floats, uint32_t n, uint32_t start);
+	static void readFloats(const std::vector<Common::UString> &strings,
+	                       float *floats, uint32_t n, uint32_t start);
 
-	void readVCoords(Model_NWN::ParserContext &ctx, Mesh &mesh);
-	void readTCoords(Model_NWN::ParserContext &ctx, Mesh &mesh);
+	static void readVCoords(Model_NWN::ParserContext &ctx, Mesh &mesh);
+	static void readTCoords(Model_NWN::ParserContext &ctx, Mesh &mesh);
 
-	void readFaces(Model_NWN::ParserContext &ctx, Mesh &mesh);
+	static void readFaces(Model_NWN::ParserContext &ctx, Mesh &mesh);
 
-	void processMesh(ModelNode_NWN_ASCII::Mesh &mesh);
+	/** Turn the parsed mesh into interleaved vertices and indices. */
+	static void processMesh(const Mesh &mesh, ASCIIModel::Node &node);
 };
 
 } // End of namespace Aurora
@@ -1093,6 +1093,8 @@ void Model_Sonic::createBound() {
 	_center[1] = minY + ((maxY - minY) / 2.0f);
 	_center[2] = minZ + ((maxZ - minZ) / 2.0f);
 
+	std::lock_guard<std::mutex> lock(_transformMutex);
+
 	_absoluteBoundBox = _boundBox;
 	_absoluteBoundBox.transform(_absolutePosition);
 	_absoluteBoundBox.absolutize();
@@ -1350,9 +1352,7 @@ void Model_Sonic::render(RenderPass pass) {
 	}
 
 	// Apply our global model transformation
-	glTranslatef(_position[0], _position[1], _position[2]);
-	glRotatef(_orientation[3], _orientation[0], _orientation[1], _orientation[2]);
-	glScalef(_scale[0], _scale[1], _scale[2]);
+	glMultMatrixf(glm::value_ptr(_renderPosition));
 
 	// Draw the bounding box, if requested
 	doDrawBound();
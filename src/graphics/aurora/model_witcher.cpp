@@ -30,6 +30,7 @@
 
 #include <cassert>
 
+#include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/maths.h"
 #include "src/common/readstream.h"
@@ -357,6 +358,37 @@ void ModelNode_Witcher::load(Model_Witcher::ParserContext &ctx) {
 	}
 }
 
+/** Read count normals into a linear vertex attribute, optionally packed into 10/10/10/2 bits. */
+static void readNormals(Common::SeekableReadStream &mdb, uint32_t count, bool packed, void *data) {
+	for (uint32_t i = 0; i < count; i++) {
+		const float x = mdb.readIEEEFloatLE();
+		const float y = mdb.readIEEEFloatLE();
+		const float z = mdb.readIEEEFloatLE();
+
+		if (packed) {
+			reinterpret_cast<uint32_t *>(data)[i] = packNormal(x, y, z);
+		} else {
+			float *n = reinterpret_cast<float *>(data) + 3 * i;
+
+			n[0] = x;
+			n[1] = y;
+			n[2] = z;
+		}
+	}
+}
+
+/** Read count texture coordinates into a linear vertex attribute, optionally as half floats. */
+static void readTexCoords(Common::SeekableReadStream &mdb, uint32_t count, bool packed, void *data) {
+	for (uint32_t i = 0; i < (2 * count); i++) {
+		const float value = mdb.readIEEEFloatLE();
+
+		if (packed)
+			reinterpret_cast<uint16_t *>(data)[i] = writeIEEEFloat16(value);
+		else
+			reinterpret_cast<float *>(data)[i] = value;
+	}
+}
+
 void ModelNode_Witcher::readMesh(Model_Witcher::ParserContext &ctx) {
 	ctx.mdb->skip(4); // Function pointer
 	ctx.mdb->skip(4); // Unknown
@@ -528,12 +560,19 @@ void ModelNode_Witcher::readMesh(Model_Witcher::ParserContext &ctx) {
 
 	// Read vertices
 
+	const bool packed = usePackedVertices();
+
 	VertexDecl vertexDecl;
 
 	vertexDecl.push_back(VertexAttrib(VPOSITION, 3, GL_FLOAT));
-	vertexDecl.push_back(VertexAttrib(VNORMAL  , 3, GL_FLOAT));
+
+	if (packed)
+		vertexDecl.push_back(VertexAttrib(VNORMAL, 4, GL_INT_2_10_10_10_REV, GL_TRUE));
+	else
+		vertexDecl.push_back(VertexAttrib(VNORMAL, 3, GL_FLOAT));
+
 	for (uint t = 0; t < texCount; t++)
-		vertexDecl.push_back(VertexAttrib(VTCOORD + t, 2, GL_FLOAT));
+		vertexDecl.push_back(VertexAttrib(VTCOORD + t, 2, packed ? GL_HALF_FLOAT : GL_FLOAT));
 
 	_mesh->data->rawMesh->getVertexBuffer()->setVertexDeclLinear(vertexCount, vertexDecl);
 
@@ -549,27 +588,13 @@ void ModelNode_Witcher::readMesh(Model_Witcher::ParserContext &ctx) {
 	// Read vertex normals
 	assert(normalsCount == vertexCount);
 	ctx.mdb->seek(ctx.offRawData + normalsOffset);
-	v = reinterpret_cast<float *>(_mesh->data->rawMesh->getVertexBuffer()->getData(1));
-	for (uint32_t i = 0; i < normalsCount; i++) {
-		*v++ = ctx.mdb->readIEEEFloatLE();
-		*v++ = ctx.mdb->readIEEEFloatLE();
-		*v++ = ctx.mdb->readIEEEFloatLE();
-	}
+	readNormals(*ctx.mdb, normalsCount, packed, _mesh->data->rawMesh->getVertexBuffer()->getData(1));
 
 	// Read texture coordinates
 	for (uint t = 0; t < texCount; t++) {
 
 		ctx.mdb->seek(ctx.offRawData + tVertsOffset[t]);
-		v = reinterpret_cast<float *>(_mesh->data->rawMesh->getVertexBuffer()->getData(2 + t));
-		for (uint32_t i = 0; i < tVertsCount[t]; i++) {
-			if (i < tVertsCount[t]) {
-				*v++ = ctx.mdb->readIEEEFloatLE();
-				*v++ = ctx.mdb->readIEEEFloatLE();
-			} else {
-				*v++ = 0.0f;
-				*v++ = 0.0f;
-			}
-		}
+		readTexCoords(*ctx.mdb, MIN(tVertsCount[t], vertexCount), packed, _mesh->data->rawMesh->getVertexBuffer()->getData(2 + t));
 	}
 
 
@@ -759,12 +784,19 @@ void ModelNode_Witcher::readTexturePaint(Model_Witcher::ParserContext &ctx) {
 
 	// Read vertices
 
+	const bool packed = usePackedVertices();
+
 	VertexDecl vertexDecl;
 
 	vertexDecl.push_back(VertexAttrib(VPOSITION, 3, GL_FLOAT));
-	vertexDecl.push_back(VertexAttrib(VNORMAL  , 3, GL_FLOAT));
+
+	if (packed)
+		vertexDecl.push_back(VertexAttrib(VNORMAL, 4, GL_INT_2_10_10_10_REV, GL_TRUE));
+	else
+		vertexDecl.push_back(VertexAttrib(VNORMAL, 3, GL_FLOAT));
+
 	for (uint t = 0; t < texCount; t++)
-		vertexDecl.push_back(VertexAttrib(VTCOORD + t, 2, GL_FLOAT));
+		vertexDecl.push_back(VertexAttrib(VTCOORD + t, 2, packed ? GL_HALF_FLOAT : GL_FLOAT));
 
 	_mesh->data->rawMesh->getVertexBuffer()->setVertexDeclLinear(vertexCount, vertexDecl);
 
@@ -780,27 +812,13 @@ void ModelNode_Witcher::readTexturePaint(Model_Witcher::ParserContext &ctx) {
 	// Read vertex normals
 	assert(normalsCount == vertexCount);
 	ctx.mdb->seek(ctx.offRawData + normalsOffset);
-	v = reinterpret_cast<float *>(_mesh->data->rawMesh->getVertexBuffer()->getData(1));
-	for (uint32_t i = 0; i < normalsCount; i++) {
-		*v++ = ctx.mdb->readIEEEFloatLE();
-		*v++ = ctx.mdb->readIEEEFloatLE();
-		*v++ = ctx.mdb->readIEEEFloatLE();
-	}
+	readNormals(*ctx.mdb, normalsCount, packed, _mesh->data->rawMesh->getVertexBuffer()->getData(1));
 
 	// Read texture coordinates
 	for (uint t = 0; t < texCount; t++) {
 
 		ctx.mdb->seek(ctx.offRawData + tVertsOffset[t]);
-		v = reinterpret_cast<float *>(_mesh->data->rawMesh->getVertexBuffer()->getData(2 + t));
-		for (uint32_t i = 0; i < tVertsCount[t]; i++) {
-			if (i < tVertsCount[t]) {
-				*v++ = ctx.mdb->readIEEEFloatLE();
-				*v++ = ctx.mdb->readIEEEFloatLE();
-			} else {
-				*v++ = 0.0f;
-				*v++ = 0.0f;
-			}
-		}
+		readTexCoords(*ctx.mdb, MIN(tVertsCount[t], vertexCount), packed, _mesh->data->rawMesh->getVertexBuffer()->getData(2 + t));
 	}
 
 
@@ -32,6 +32,7 @@
 #include "src/common/util.h"
 #include "src/common/maths.h"
 #include "src/common/error.h"
+#include "src/common/configvalue.h"
 
 #include "src/graphics/camera.h"
 
@@ -42,6 +43,8 @@
 #include "src/graphics/aurora/texture.h"
 #include "src/graphics/aurora/model.h"
 
+#include "src/graphics/mesh/meshman.h"
+
 #include "src/graphics/shader/materialman.h"
 #include "src/graphics/shader/surfaceman.h"
 
@@ -53,6 +56,8 @@ namespace Graphics {
 
 namespace Aurora {
 
+static const Common::ConfigValue<bool> kConfigPackedVertices("packedvertices", false);
+
 static bool nodeComp(ModelNode *a, ModelNode *b) {
 	return a->isInFrontOf(*b);
 }
@@ -64,7 +69,7 @@ ModelNode::Dangly::Dangly() : period(1.0f), tightness(1.0f), displacement(1.0f),
 	data(0) {
 }
 
-ModelNode::MeshData::MeshData() : rawMesh(0), envMapMode(kModeEnvironmentBlendedUnder) {
+ModelNode::MeshData::MeshData() : rawMesh(0), sharedMesh(false), envMapMode(kModeEnvironmentBlendedUnder) {
 }
 
 ModelNode::Mesh::Mesh() : shininess(1.0f), alpha(1.0f), tilefade(0), render(false),
@@ -91,6 +96,7 @@ ModelNode::ModelNode(Model &model) :
 		_alpha(1.0f),
 		_render(false),
 		_dirtyRender(true),
+		_batched(false),
 		_mesh(0),
 		_rootStateNode(0),
 		_nodeNumber(0),
@@ -121,6 +127,9 @@ ModelNode::ModelNode(Model &model) :
 }
 
 ModelNode::~ModelNode() {
+	// The renderables hold on to the mesh as well, so let go of them first
+	_renderableArray.clear();
+
 	if (_mesh) {
 		if (_mesh->dangly) {
 			delete _mesh->dangly->data;
@@ -130,6 +139,9 @@ ModelNode::~ModelNode() {
 			delete _mesh->skin;
 		}
 		if (_mesh->data) {
+			if (_mesh->data->sharedMesh)
+				MeshMan.releaseMesh(_mesh->data->rawMesh);
+
 			delete _mesh->data;
 		}
 	}
@@ -191,6 +203,8 @@ void ModelNode::reparentTo(ModelNode *parent) {
 
 	_level = parent->_level + 1;
 	_parent = parent;
+
+	_model->flattenNodeHierarchies();
 }
 
 std::list<ModelNode *> &ModelNode::getChildren() {
@@ -265,8 +279,10 @@ void ModelNode::setPosition(float x, float y, float z) {
 	_position[1] = y / _model->_scale[1];
 	_position[2] = z / _model->_scale[2];
 
-	if (_parent)
+	if (_parent) {
 		_parent->orderChildren();
+		_model->flattenNodeHierarchies();
+	}
 
 	unlockFrameIfVisible();
 }
@@ -512,6 +528,10 @@ void ModelNode::loadTextures(const std::vector<Common::UString> &textures) {
 		_render = false;
 }
 
+bool ModelNode::usePackedVertices() {
+	return GfxMan.isGL3() && GfxMan.isRendererExperimental() && kConfigPackedVertices.get();
+}
+
 void ModelNode::createBound() {
 	_boundBox.clear();
 
@@ -777,17 +797,6 @@ bool ModelNode::renderableMesh(Mesh *mesh) {
 }
 
 void ModelNode::render(RenderPass pass) {
-	// Apply the node's transformation
-
-	glTranslatef(_position[0], _position[1], _position[2]);
-	glRotatef(_orientation[3], _orientation[0], _orientation[1], _orientation[2]);
-
-	glRotatef(_rotation[0], 1.0f, 0.0f, 0.0f);
-	glRotatef(_rotation[1], 0.0f, 1.0f, 0.0f);
-	glRotatef(_rotation[2], 0.0f, 0.0f, 1.0f);
-
-	glScalef(_scale[0], _scale[1], _scale[2]);
-
 	Mesh *mesh = _mesh;
 	bool doRender = _render;
 	if (!_model->getState().empty() && !renderableMesh(mesh)) {
@@ -801,47 +810,36 @@ void ModelNode::render(RenderPass pass) {
 	// Render the node's geometry
 
 	bool isTransparent = mesh && mesh->isTransparent;
-	bool shouldRender = doRender && renderableMesh(mesh);
+	bool shouldRender = doRender && renderableMesh(mesh) && !_batched;
 	if (((pass == kRenderPassOpaque)      &&  isTransparent) ||
 	    ((pass == kRenderPassTransparent) && !isTransparent))
 		shouldRender = false;
 
-	if (shouldRender)
+	if (shouldRender) {
+		glLoadMatrixf(glm::value_ptr(_renderTransform));
 		renderGeometry(*mesh);
-
-	if (_attachedModel) {
-		glPushMatrix();
-		_attachedModel->render(pass);
-		glPopMatrix();
 	}
 
-	// Render the node's children
-	for (std::list<ModelNode *>::iterator c = _children.begin(); c != _children.end(); ++c) {
-		glPushMatrix();
-		(*c)->render(pass);
-		glPopMatrix();
-	}
+	if (_attachedModel)
+		_attachedModel->renderNodes(pass, _renderTransform);
 }
 
-void ModelNode::calcRenderTransform(const glm::mat4 &parentTransform) {
-	// Apply the node's transformation
-	_renderTransform = parentTransform;
-	_renderTransform = glm::translate(_renderTransform, glm::vec3(_position[0], _position[1], _position[2]));
+void ModelNode::calcLocalRenderTransform(glm::mat4 &transform) const {
+	transform = glm::translate(glm::mat4(), glm::vec3(_position[0], _position[1], _position[2]));
 	if (_orientation[0] != 0.0f ||
 	    _orientation[1] != 0.0f ||
 	    _orientation[2] != 0.0f) {
-		_renderTransform = glm::rotate(_renderTransform,
-		                               Common::deg2rad(_orientation[3]),
-		                               glm::vec3(_orientation[0], _orientation[1], _orientation[2]));
+		transform = glm::rotate(transform,
+		                        Common::deg2rad(_orientation[3]),
+		                        glm::vec3(_orientation[0], _orientation[1], _orientation[2]));
 	}
-	_renderTransform = glm::rotate(_renderTransform, Common::deg2rad(_rotation[0]), glm::vec3(1.0f, 0.0f, 0.0f));
-	_renderTransform = glm::rotate(_renderTransform, Common::deg2rad(_rotation[1]), glm::vec3(0.0f, 1.0f, 0.0f));
-	_renderTransform = glm::rotate(_renderTransform, Common::deg2rad(_rotation[2]), glm::vec3(0.0f, 0.0f, 1.0f));
-	_renderTransform = glm::scale(_renderTransform, glm::vec3(_scale[0], _scale[1], _scale[2]));
+	transform = glm::rotate(transform, Common::deg2rad(_rotation[0]), glm::vec3(1.0f, 0.0f, 0.0f));
+	transform = glm::rotate(transform, Common::deg2rad(_rotation[1]), glm::vec3(0.0f, 1.0f, 0.0f));
+	transform = glm::rotate(transform, Common::deg2rad(_rotation[2]), glm::vec3(0.0f, 0.0f, 1.0f));
+	transform = glm::scale(transform, glm::vec3(_scale[0], _scale[1], _scale[2]));
 }
 
-void ModelNode::renderImmediate(const glm::mat4 &parentTransform) {
-	calcRenderTransform(parentTransform);
+void ModelNode::renderImmediate() {
 	/**
 	 * Ignoring _render for now because it's being falsely set to false.
 	 */
@@ -875,14 +873,9 @@ void ModelNode::renderImmediate(const glm::mat4 &parentTransform) {
 	if (_attachedModel) {
 		_attachedModel->renderImmediate(_renderTransform);
 	}
-	// Render the node's children
-	for (std::list<ModelNode *>::iterator c = _children.begin(); c != _children.end(); ++c) {
-		(*c)->renderImmediate(_renderTransform);
-	}
 }
 
-void ModelNode::queueRender(const glm::mat4 &parentTransform) {
-	calcRenderTransform(parentTransform);
+void ModelNode::queueRender() {
 	/**
 	 * Ignoring _render for now because it's being falsely set to false.
 	 */
@@ -916,10 +909,6 @@ void ModelNode::queueRender(const glm::mat4 &parentTransform) {
 	if (_attachedModel) {
 		_attachedModel->queueRender(_renderTransform);
 	}
-	// Render the node's children
-	for (std::list<ModelNode *>::iterator c = _children.begin(); c != _children.end(); ++c) {
-		(*c)->queueRender(_renderTransform);
-	}
 }
 
 void ModelNode::drawSkeleton(const glm::mat4 &parent, bool showInvisible) {
@@ -1038,25 +1027,13 @@ bool ModelNode::hasSkinNode() const {
 	return _mesh && _mesh->skin;
 }
 
-void ModelNode::computeTransforms() {
-	computeLocalBaseTransform();
-	computeLocalTransform();
-
-	if (_parent) {
-		_absoluteBaseTransform = _parent->_absoluteBaseTransform * _localBaseTransform;
-		_absoluteTransform = _parent->_absoluteTransform * _localTransform;
-	} else {
-		_absoluteBaseTransform = _localBaseTransform;
-		_absoluteTransform = _localTransform;
-	}
+void ModelNode::setAbsoluteTransforms(const glm::mat4 &absoluteBase, const glm::mat4 &absolute) {
+	_absoluteBaseTransform = absoluteBase;
+	_absoluteTransform = absolute;
 
 	_boneTransform = _absoluteTransform * _absoluteBaseTransformInv;
 	_absoluteBaseTransformInv = glm::inverse(_absoluteBaseTransform);
 	_absoluteTransformInv = glm::inverse(_absoluteTransform);
-
-	for (const auto &n : _children) {
-		n->computeTransforms();
-	}
 }
 
 void ModelNode::computeLocalBaseTransform() {
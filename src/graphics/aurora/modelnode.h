@@ -140,8 +140,6 @@ public:
 	const glm::mat4 &getBoneTransform() const { return _boneTransform; }
 	const glm::mat4 &getAbsoluteBaseTransformInverse() const { return _absoluteBaseTransformInv; }
 
-	void computeTransforms();
-
 	// Scale
 
 	float getScaleX() { return _scale[0]; }
@@ -195,6 +193,7 @@ public:
 
 	struct MeshData {
 		Graphics::Mesh::Mesh *rawMesh; ///< Node raw mesh data.
+		bool sharedMesh; ///< Was rawMesh acquired from the mesh manager, to be released again?
 
 		std::vector<float> initialVertexCoords; ///< Initial node vertex coordinates.
 
@@ -285,6 +284,7 @@ protected:
 
 	bool _render; ///< Render the node?
 	bool _dirtyRender; ///< Rendering information needs updating.
+	bool _batched; ///< Is the geometry drawn as part of a static batch of the model instead?
 
 	Mesh *_mesh;
 	ModelNode *_rootStateNode;
@@ -321,6 +321,14 @@ protected:
 	Shader::ShaderRenderable *_shaderRenderable;
 
 	// Loading helpers
+
+	/** Should meshes be loaded with packed normals, texture coordinates and bone data?
+	 *
+	 *  Only the shader renderer can read those. Positions always stay 32-bit floats,
+	 *  since picking, bounds and CPU skinning read them back.
+	 */
+	static bool usePackedVertices();
+
 	void loadTextures(const std::vector<Common::UString> &textures);
 	void createBound();
 	void createCenter();
@@ -328,13 +336,17 @@ protected:
 	void createAbsoluteBound();
 	void createAbsoluteBound(Common::BoundingBox parentPosition);
 
+	/** Render the node and its attached model with the fixed-function pipeline.
+	 *
+	 *  The render transform has to be computed already; the children are not rendered.
+	 */
 	void render(RenderPass pass);
 	void drawSkeleton(const glm::mat4 &parent, bool showInvisible);
 
-	/** Calculate the transform used for rendering. */
-	void calcRenderTransform(const glm::mat4 &parentTransform);
-	void renderImmediate(const glm::mat4 &parentTransform);
-	void queueRender(const glm::mat4 &parentTransform);
+	/** Calculate the transform used for rendering, relative to the parent node. */
+	void calcLocalRenderTransform(glm::mat4 &transform) const;
+	void renderImmediate();
+	void queueRender();
 
 	void lockFrame();
 	void unlockFrame();
@@ -373,6 +385,8 @@ private:
 
 	void computeLocalBaseTransform();
 	void computeLocalTransform();
+	/** Take over the absolute transforms, and update the bone transform and the inverses. */
+	void setAbsoluteTransforms(const glm::mat4 &absoluteBase, const glm::mat4 &absolute);
 
 	std::vector<const ModelNode *> getPath(const ModelNode *from, const ModelNode *to) const;
 
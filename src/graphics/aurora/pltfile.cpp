@@ -51,9 +51,15 @@
 #include <cassert>
 #include <cstring>
 
+#include <memory>
+#include <vector>
+
 #include "src/common/error.h"
 #include "src/common/readstream.h"
 #include "src/common/strutil.h"
+#include "src/common/mutex.h"
+
+#include "src/aurora/resman.h"
 
 #include "src/graphics/images/decoder.h"
 #include "src/graphics/images/surface.h"
@@ -68,10 +74,10 @@ namespace Graphics {
 namespace Aurora {
 
 PLTFile::PLTFile(const Common::UString &name, Common::SeekableReadStream &plt) :
-	_name(name), _surface(0) {
+	_name(name), _surface(0), _built(false) {
 
 	for (size_t i = 0; i < kLayerMAX; i++)
-		_colors[i] = 0;
+		_colors[i] = _builtColors[i] = 0;
 
 	load(plt);
 }
@@ -95,6 +101,10 @@ void PLTFile::setLayerColor(Layer layer, uint8_t color) {
 }
 
 void PLTFile::rebuild() {
+	// Creatures set all their colors again whenever a body part changes, mostly to the same values
+	if (_built && (std::memcmp(_colors, _builtColors, sizeof(_colors)) == 0))
+		return;
+
 	build();
 	refresh();
 }
@@ -124,14 +134,14 @@ void PLTFile::load(Common::SeekableReadStream &plt) {
 
 	size_t size = width * height;
 
-	_dataImage  = std::make_unique<uint8_t[]>(size);
-	_dataLayers = std::make_unique<uint8_t[]>(size);
+	_dataIndices = std::make_unique<uint16_t[]>(size);
 
-	uint8_t *image = _dataImage.get();
-	uint8_t *layer = _dataLayers.get();
+	uint16_t *index = _dataIndices.get();
 	while (size-- > 0) {
-		*image++ = plt.readByte();
-		*layer++ = MIN<uint8_t>(plt.readByte(), kLayerMAX - 1);
+		const uint8_t intensity = plt.readByte();
+		const uint8_t layer     = MIN<uint8_t>(plt.readByte(), kLayerMAX - 1);
+
+		*index++ = (layer * 256) + intensity;
 	}
 
 	// --- Create the actual texture surface ---
@@ -148,18 +158,20 @@ void PLTFile::build() {
 	/* For all layers, copy one whole row of pixels into the row buffer.
 	 * The row picked for each layer corresponds to the color index we want.
 	 * We don't care about the other rows, as they belong to other color indices. */
-	byte rows[4 * 256 * kLayerMAX];
+	uint32_t rows[256 * kLayerMAX];
 	getColorRows(rows, _colors);
 
 	const size_t pixels = _width * _height;
-	const uint8_t *image  = _dataImage.get();
-	const uint8_t *layer  = _dataLayers.get();
-	      byte  *dst    = _surface->getData();
+	const uint16_t *index = _dataIndices.get();
+	      byte     *dst   = _surface->getData();
 
 	/* Now iterate over all pixels, each time copying the correct BGRA values
-	 * for the pixel's intensity into the final image. */
-	for (size_t i = 0; i < pixels; i++, image++, layer++, dst += 4)
-		memcpy(dst, rows + (*layer * 4 * 256) + (*image * 4), 4);
+	 * for the pixel's layer and intensity into the final image. */
+	for (size_t i = 0; i < pixels; i++, index++, dst += 4)
+		std::memcpy(dst, rows + *index, 4);
+
+	std::memcpy(_builtColors, _colors, sizeof(_colors));
+	_built = true;
 }
 
 /** The palette image resource names for all layers. */
@@ -176,11 +188,30 @@ static const char * const kPalettes[PLTFile::kLayerMAX] = {
 	"pal_tattoo01"
 };
 
+/** The color rows of all layer palettes, decoded once and shared by all PLTs.
+ *
+ *  A table is never changed after it has been built, so it can be read
+ *  without holding a lock. A new table replaces it when different
+ *  resources are loaded.
+ */
+struct PaletteTable {
+	/** For each layer, where its color rows start. Layers sharing a palette image share rows. */
+	size_t offset[PLTFile::kLayerMAX];
+	/** For each layer, the number of colors. 0 if its palette failed to load. */
+	size_t height[PLTFile::kLayerMAX];
+
+	/** All color rows, 256 BGRA values each, with the row for color 0 first. */
+	std::vector<uint32_t> rows;
+};
+
+static std::mutex paletteMutex;
+static uint32_t paletteGeneration = 0;
+static std::shared_ptr<const PaletteTable> paletteTable;
+
 /** Load a specific layer palette image and perform some sanity checks. */
-ImageDecoder *PLTFile::getLayerPalette(uint32_t layer, uint8_t row) {
+ImageDecoder *PLTFile::getLayerPalette(uint32_t layer) {
 	assert(layer < kLayerMAX);
 
-	// TODO: We may want to cache these somehow...
 	std::unique_ptr<ImageDecoder> palette(loadImage(kPalettes[layer]));
 
 	if (palette->getFormat() != kPixelFormatBGRA)
@@ -194,35 +225,75 @@ ImageDecoder *PLTFile::getLayerPalette(uint32_t layer, uint8_t row) {
 	if (mipMap.width != 256)
 		throw Common::Exception("Invalid width (%d)", mipMap.width);
 
-	if (row >= mipMap.height)
-		throw Common::Exception("Invalid height (%d >= %d)", row, mipMap.height);
-
 	return palette.release();
 }
 
-void PLTFile::getColorRows(byte rows[4 * 256 * kLayerMAX], const uint8_t colors[kLayerMAX]) {
-	for (size_t i = 0; i < kLayerMAX; i++, rows += 4 * 256) {
+std::shared_ptr<const PaletteTable> PLTFile::getPaletteTable() {
+	std::lock_guard<std::mutex> lock(paletteMutex);
+
+	// Different resources might be loaded now, like a module's override palettes
+	const uint32_t generation = ResMan.getGeneration();
+	if (paletteTable && (paletteGeneration == generation))
+		return paletteTable;
+
+	std::shared_ptr<PaletteTable> table = std::make_shared<PaletteTable>();
+
+	for (size_t i = 0; i < kLayerMAX; i++) {
+		size_t first = 0;
+		while (std::strcmp(kPalettes[first], kPalettes[i]) != 0)
+			first++;
+
+		if (first < i) {
+			table->offset[i] = table->offset[first];
+			table->height[i] = table->height[first];
+			continue;
+		}
+
+		table->offset[i] = table->rows.size();
+		table->height[i] = 0;
+
 		try {
-			std::unique_ptr<ImageDecoder> palette(getLayerPalette(i, colors[i]));
+			std::unique_ptr<ImageDecoder> palette(getLayerPalette(i));
 
-			// The images have their origin at the bottom left, so we flip the color row
-			const uint8_t row = palette->getMipMap(0).height - 1 - colors[i];
+			const ImageDecoder::MipMap &mipMap = palette->getMipMap(0);
 
-			// Copy the whole row into the buffer
-			memcpy(rows, palette->getMipMap(0).data.get() + (row * 4 * 256), 4 * 256);
+			table->height[i] = mipMap.height;
+			table->rows.resize(table->offset[i] + 256 * mipMap.height);
 
-		} catch (...) {
-			// On error set to pink (while honoring intensity), for high debug visibility
-			for (size_t p = 0; p < 256; p++) {
-				rows[p * 4 + 0] = p;
-				rows[p * 4 + 1] = 0x00;
-				rows[p * 4 + 2] = p;
-				rows[p * 4 + 3] = 0xFF;
-			}
+			// The images have their origin at the bottom left, so we flip the color rows
+			for (int y = 0; y < mipMap.height; y++)
+				std::memcpy(&table->rows[table->offset[i] + 256 * y],
+				            mipMap.data.get() + ((mipMap.height - 1 - y) * 4 * 256), 4 * 256);
 
+		} catch (...) {
 			Common::exceptionDispatcherWarning("Failed to load palette \"%s\"", kPalettes[i]);
 		}
 	}
+
+	paletteTable      = table;
+	paletteGeneration = generation;
+
+	return paletteTable;
+}
+
+void PLTFile::getColorRows(uint32_t rows[256 * kLayerMAX], const uint8_t colors[kLayerMAX]) {
+	std::shared_ptr<const PaletteTable> table = getPaletteTable();
+
+	for (size_t i = 0; i < kLayerMAX; i++, rows += 256) {
+		if (colors[i] < table->height[i]) {
+			std::memcpy(rows, &table->rows[table->offset[i] + 256 * colors[i]], 4 * 256);
+			continue;
+		}
+
+		if (table->height[i] > 0)
+			warning("Invalid color %u for palette \"%s\" (%u rows)", colors[i], kPalettes[i], (uint)table->height[i]);
+
+		// On error set to pink (while honoring intensity), for high debug visibility
+		for (size_t p = 0; p < 256; p++) {
+			const byte pink[4] = { (byte) p, 0x00, (byte) p, 0xFF };
+			std::memcpy(rows + p, pink, 4);
+		}
+	}
 }
 
 } // End of namespace Aurora
@@ -37,6 +37,8 @@ class Surface;
 
 namespace Aurora {
 
+struct PaletteTable;
+
 class PLTFile : public ::Aurora::AuroraFile, public Texture {
 public:
 	enum Layer {
@@ -69,10 +71,13 @@ private:
 
 	Surface *_surface;
 
-	std::unique_ptr<uint8_t[]> _dataImage;
-	std::unique_ptr<uint8_t[]> _dataLayers;
+	/** For each pixel, its index into the color rows: layer * 256 + intensity. */
+	std::unique_ptr<uint16_t[]> _dataIndices;
 
 	uint8_t _colors[kLayerMAX];
+	uint8_t _builtColors[kLayerMAX]; ///< The colors the texture image was last built with.
+
+	bool _built; ///< Has the texture image been built at all?
 
 
 	PLTFile(const Common::UString &name, Common::SeekableReadStream &plt);
@@ -80,8 +85,10 @@ private:
 	void load(Common::SeekableReadStream &plt);
 	void build();
 
-	static ImageDecoder *getLayerPalette(uint32_t layer, uint8_t row);
-	static void getColorRows(byte rows[4 * 256 * kLayerMAX], const uint8_t colors[kLayerMAX]);
+	static ImageDecoder *getLayerPalette(uint32_t layer);
+	/** Get the color rows of all layer palettes, loading them if necessary. */
+	static std::shared_ptr<const PaletteTable> getPaletteTable();
+	static void getColorRows(uint32_t rows[256 * kLayerMAX], const uint8_t colors[kLayerMAX]);
 
 	friend class Texture;
 };
@@ -23,6 +23,7 @@ src_graphics_libgraphics_la_SOURCES += \
     src/graphics/aurora/types.h \
     src/graphics/aurora/texture.h \
     src/graphics/aurora/texturehandle.h \
+    src/graphics/aurora/textureatlas.h \
     src/graphics/aurora/textureman.h \
     src/graphics/aurora/pltfile.h \
     src/graphics/aurora/cursor.h \
@@ -39,6 +40,7 @@ src_graphics_libgraphics_la_SOURCES += \
     src/graphics/aurora/fps.h \
     src/graphics/aurora/cube.h \
     src/graphics/aurora/guiquad.h \
+    src/graphics/aurora/guiquadbatch.h \
     src/graphics/aurora/highlightableguiquad.h \
     src/graphics/aurora/geometryobject.h \
     src/graphics/aurora/modelnode.h \
@@ -48,6 +50,7 @@ src_graphics_libgraphics_la_SOURCES += \
     src/graphics/aurora/fadequad.h \
     src/graphics/aurora/borderquad.h \
     src/graphics/aurora/subscenequad.h \
+    src/graphics/aurora/asciimodelcache.h \
     src/graphics/aurora/model_nwn.h \
     src/graphics/aurora/model_nwn2.h \
     src/graphics/aurora/model_kotor.h \
@@ -66,6 +69,7 @@ src_graphics_libgraphics_la_SOURCES += \
 src_graphics_libgraphics_la_SOURCES += \
     src/graphics/aurora/texture.cpp \
     src/graphics/aurora/texturehandle.cpp \
+    src/graphics/aurora/textureatlas.cpp \
     src/graphics/aurora/textureman.cpp \
     src/graphics/aurora/pltfile.cpp \
     src/graphics/aurora/cursor.cpp \
@@ -83,6 +87,7 @@ src_graphics_libgraphics_la_SOURCES += \
     src/graphics/aurora/cube.cpp \
     src/graphics/aurora/highlightableguiquad.cpp \
     src/graphics/aurora/guiquad.cpp \
+    src/graphics/aurora/guiquadbatch.cpp \
     src/graphics/aurora/geometryobject.cpp \
     src/graphics/aurora/modelnode.cpp \
     src/graphics/aurora/model.cpp \
@@ -91,6 +96,7 @@ src_graphics_libgraphics_la_SOURCES += \
     src/graphics/aurora/fadequad.cpp \
     src/graphics/aurora/borderquad.cpp \
     src/graphics/aurora/subscenequad.cpp \
+    src/graphics/aurora/asciimodelcache.cpp \
     src/graphics/aurora/model_nwn.cpp \
     src/graphics/aurora/model_nwn2.cpp \
     src/graphics/aurora/model_kotor.cpp \
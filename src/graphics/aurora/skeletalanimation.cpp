@@ -22,9 +22,19 @@
  *  Skeletal animation helper class.
  */
 
+#include <cstring>
+
+#if defined(__SSE__)
+	#include <xmmintrin.h>
+#elif defined(__ARM_NEON)
+	#include <arm_neon.h>
+#endif
+
 #include "external/glm/gtc/type_ptr.hpp"
 #include "external/glm/gtc/matrix_transform.hpp"
 
+#include "src/common/util.h"
+
 #include "src/graphics/aurora/skeletalanimation.h"
 #include "src/graphics/aurora/model.h"
 #include "src/graphics/aurora/animnode.h"
@@ -38,27 +48,25 @@ SkeletalAnimation::SkeletalAnimation(int bonesPerVertex) :
 		_bonesPerVertex(bonesPerVertex) {
 }
 
-void SkeletalAnimation::update(Model *model,
-                               float lastFrame,
-                               float nextFrame,
-                               const std::vector<ModelNode *> &modelNodeMap) {
-
-	Animation::update(model, lastFrame, nextFrame, modelNodeMap);
-	updateModel(model, lastFrame);
+void SkeletalAnimation::apply(Model *model, const AnimationPose &pose, float time) {
+	Animation::apply(model, pose, time);
+	updateModel(model, time);
 }
 
 void SkeletalAnimation::updateModel(Model *model, float time) {
 	if (!model->hasSkinNodes())
 		return;
 
+	model->computeNodeTransforms();
+
+	std::vector<glm::mat4> palette;
+
 	for (const auto &n : model->getNodes()) {
 		if (!n->hasSkinNode())
 			continue;
 
-		model->computeNodeTransforms();
-
 		if (GfxMan.isRendererExperimental()) {
-			fillBoneTransforms(n);
+			fillBoneTransforms(n, palette);
 			continue;
 		}
 
@@ -67,7 +75,8 @@ void SkeletalAnimation::updateModel(Model *model, float time) {
 		const std::vector<float> &boneWeights = n->getBoneWeights();
 		VertexBuffer *vertexBuffer = n->getMesh()->data->rawMesh->getVertexBuffer();
 
-		transform(n, vertsIn, boneIndices, boneWeights, vertexBuffer);
+		fillBonePalette(n, palette);
+		transform(palette, vertsIn, boneIndices, boneWeights, vertexBuffer);
 
 		n->notifyVertexCoordsBuffered();
 	}
@@ -77,23 +86,126 @@ void SkeletalAnimation::updateModel(Model *model, float time) {
 	}
 }
 
-void SkeletalAnimation::fillBoneTransforms(ModelNode *node) {
-	ModelNode::Mesh *mesh = node->getMesh();
-	std::vector<float> &boneTransforms = mesh->data->rawMesh->getBoneTransforms();
-	ModelNode::Skin *skin = mesh->skin;
+void SkeletalAnimation::fillBoneTransforms(ModelNode *node, std::vector<glm::mat4> &palette) {
+	fillBonePalette(node, palette);
+
+	std::vector<float> &boneTransforms = node->getMesh()->data->rawMesh->getBoneTransforms();
+	const std::vector<ModelNode *> &boneNodes = node->getMesh()->skin->boneNodeMap;
+
+	const size_t boneCount = MIN(boneNodes.size(), boneTransforms.size() / 16);
+	for (size_t i = 0; i < boneCount; ++i) {
+		if (!boneNodes[i])
+			continue;
+
+		std::memcpy(boneTransforms.data() + 16 * i, glm::value_ptr(palette[i]), 16 * sizeof(float));
+	}
+}
+
+void SkeletalAnimation::fillBonePalette(ModelNode *node, std::vector<glm::mat4> &palette) {
+	const std::vector<ModelNode *> &boneNodes = node->getMesh()->skin->boneNodeMap;
 
-	for (int i = 0; i < static_cast<int>(skin->boneMappingCount); ++i) {
-		int boneIndex = static_cast<int>(mesh->skin->boneMapping[i]);
+	const glm::mat4 &base        = node->getAbsoluteBaseTransform();
+	const glm::mat4 &baseInverse = node->getAbsoluteBaseTransformInverse();
+
+	palette.resize(boneNodes.size());
+	for (size_t i = 0; i < boneNodes.size(); ++i) {
+		if (!boneNodes[i])
+			continue;
+
+		palette[i] = baseInverse * boneNodes[i]->getBoneTransform() * base;
+	}
+}
+
+/* All bone transforms are affine, so the weighted sum of the transformed
+ * vertices equals the vertex transformed by the weighted sum of the bone
+ * matrices. We blend the matrix columns first, then transform once.
+ */
+
+#if defined(__SSE__)
+
+static inline void skinVertex(const float *v, const float *indices, const float *weights, int bones,
+                              const std::vector<glm::mat4> &palette, float *out) {
+
+	__m128 c0 = _mm_setzero_ps(), c1 = _mm_setzero_ps(), c2 = _mm_setzero_ps(), c3 = _mm_setzero_ps();
+
+	for (int j = 0; j < bones; ++j) {
+		const int boneIndex = static_cast<int>(indices[j]);
 		if (boneIndex == -1)
 			continue;
 
-		float *boneTransformsData = boneTransforms.data() + 16 * boneIndex;
-		ModelNode *boneNode = skin->boneNodeMap[boneIndex];
-		std::memcpy(boneTransformsData, glm::value_ptr(boneNode->getBoneTransform()), 16 * sizeof(float));
+		const float *m = glm::value_ptr(palette[boneIndex]);
+		const __m128 w = _mm_set1_ps(weights[j]);
+
+		c0 = _mm_add_ps(c0, _mm_mul_ps(w, _mm_loadu_ps(m +  0)));
+		c1 = _mm_add_ps(c1, _mm_mul_ps(w, _mm_loadu_ps(m +  4)));
+		c2 = _mm_add_ps(c2, _mm_mul_ps(w, _mm_loadu_ps(m +  8)));
+		c3 = _mm_add_ps(c3, _mm_mul_ps(w, _mm_loadu_ps(m + 12)));
 	}
+
+	__m128 r = c3;
+	r = _mm_add_ps(r, _mm_mul_ps(c0, _mm_set1_ps(v[0])));
+	r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(v[1])));
+	r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(v[2])));
+
+	// Only write x, y and z. The next float already belongs to another vertex attribute
+	_mm_storel_pi(reinterpret_cast<__m64 *>(out), r);
+	_mm_store_ss(out + 2, _mm_movehl_ps(r, r));
 }
 
-void SkeletalAnimation::transform(ModelNode *node,
+#elif defined(__ARM_NEON)
+
+static inline void skinVertex(const float *v, const float *indices, const float *weights, int bones,
+                              const std::vector<glm::mat4> &palette, float *out) {
+
+	float32x4_t c0 = vdupq_n_f32(0.0f), c1 = vdupq_n_f32(0.0f), c2 = vdupq_n_f32(0.0f), c3 = vdupq_n_f32(0.0f);
+
+	for (int j = 0; j < bones; ++j) {
+		const int boneIndex = static_cast<int>(indices[j]);
+		if (boneIndex == -1)
+			continue;
+
+		const float *m = glm::value_ptr(palette[boneIndex]);
+		const float w = weights[j];
+
+		c0 = vmlaq_n_f32(c0, vld1q_f32(m +  0), w);
+		c1 = vmlaq_n_f32(c1, vld1q_f32(m +  4), w);
+		c2 = vmlaq_n_f32(c2, vld1q_f32(m +  8), w);
+		c3 = vmlaq_n_f32(c3, vld1q_f32(m + 12), w);
+	}
+
+	float32x4_t r = c3;
+	r = vmlaq_n_f32(r, c0, v[0]);
+	r = vmlaq_n_f32(r, c1, v[1]);
+	r = vmlaq_n_f32(r, c2, v[2]);
+
+	// Only write x, y and z. The next float already belongs to another vertex attribute
+	vst1_f32(out, vget_low_f32(r));
+	vst1q_lane_f32(out + 2, r, 2);
+}
+
+#else
+
+static inline void skinVertex(const float *v, const float *indices, const float *weights, int bones,
+                              const std::vector<glm::mat4> &palette, float *out) {
+
+	glm::mat4 m(0.0f);
+
+	for (int j = 0; j < bones; ++j) {
+		const int boneIndex = static_cast<int>(indices[j]);
+		if (boneIndex == -1)
+			continue;
+
+		m += palette[boneIndex] * weights[j];
+	}
+
+	out[0] = v[0] * m[0][0] + v[1] * m[1][0] + v[2] * m[2][0] + m[3][0];
+	out[1] = v[0] * m[0][1] + v[1] * m[1][1] + v[2] * m[2][1] + m[3][1];
+	out[2] = v[0] * m[0][2] + v[1] * m[1][2] + v[2] * m[2][2] + m[3][2];
+}
+
+#endif
+
+void SkeletalAnimation::transform(const std::vector<glm::mat4> &palette,
                                   const std::vector<float> &vertsIn,
                                   const std::vector<float> &boneIndices,
                                   const std::vector<float> &boneWeights,
@@ -110,27 +222,7 @@ void SkeletalAnimation::transform(ModelNode *node,
 	const int bufferStride = static_cast<int>(vertexBuffer->getVertexDecl()[0].stride) / sizeof(float);
 
 	for (int i = 0; i < vertexCount; ++i) {
-		bufferData[0] = 0.0f;
-		bufferData[1] = 0.0f;
-		bufferData[2] = 0.0f;
-
-		for (int j = 0; j < _bonesPerVertex; ++j) {
-			const int boneIndex = static_cast<int>(boneIndicesData[j]);
-			if (boneIndex == -1)
-				continue;
-
-			const glm::mat4 &boneTransform = node->getBoneNode(boneIndex)->getBoneTransform();
-			const float boneWeight = boneWeightsData[j];
-			float v0[3], v1[3];
-
-			multiply(vertsInData, node->getAbsoluteBaseTransform(), v0);
-			multiply(v0, boneTransform, v1);
-			multiply(v1, node->getAbsoluteBaseTransformInverse(), v0);
-
-			bufferData[0] += v0[0] * boneWeight;
-			bufferData[1] += v0[1] * boneWeight;
-			bufferData[2] += v0[2] * boneWeight;
-		}
+		skinVertex(vertsInData, boneIndicesData, boneWeightsData, _bonesPerVertex, palette, bufferData);
 
 		vertsInData += 3;
 		boneIndicesData += boneStride;
@@ -139,17 +231,6 @@ void SkeletalAnimation::transform(ModelNode *node,
 	}
 }
 
-void SkeletalAnimation::multiply(const float *v, const glm::mat4 &m, float *vOut) {
-	float x = v[0] * m[0][0] + v[1] * m[1][0] + v[2] * m[2][0] + m[3][0];
-	float y = v[0] * m[0][1] + v[1] * m[1][1] + v[2] * m[2][1] + m[3][1];
-	float z = v[0] * m[0][2] + v[1] * m[1][2] + v[2] * m[2][2] + m[3][2];
-	float w = v[0] * m[0][3] + v[1] * m[1][3] + v[2] * m[2][3] + m[3][3];
-
-	vOut[0] = x / w;
-	vOut[1] = y / w;
-	vOut[2] = z / w;
-}
-
 } // End of namespace Aurora
 
 } // End of namespace Graphics
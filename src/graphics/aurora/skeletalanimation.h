@@ -44,33 +44,35 @@ class SkeletalAnimation : public Animation {
 public:
 	SkeletalAnimation(int bonesPerVertex);
 
-	void update(Model *model,
-	            float lastFrame,
-	            float nextFrame,
-	            const std::vector<ModelNode *> &modelNodeMap);
+	void apply(Model *model, const AnimationPose &pose, float time);
 
 private:
 	int _bonesPerVertex;
 
 	void updateModel(Model *model, float time);
-	void fillBoneTransforms(ModelNode *node);
+	void fillBoneTransforms(ModelNode *node, std::vector<glm::mat4> &palette);
 
-	/** Transform vertex coordinates.
+	/** Precompose the bone palette of a model node for the current frame.
 	 *
-	 *  @param node         Model node whose vertices are being transformed.
+	 *  The palette holds one matrix per bone, taking a vertex from the base
+	 *  pose straight into the animated pose. Animations are shared between
+	 *  models, which are updated in parallel, so the caller owns the palette.
+	 */
+	static void fillBonePalette(ModelNode *node, std::vector<glm::mat4> &palette);
+
+	/** Transform vertex coordinates, using a bone palette.
+	 *
+	 *  @param palette      The bone palette of the node.
 	 *  @param vertsIn      Input array of vertex coordinates.
 	 *  @param boneIndices  Array of bone indices.
 	 *  @param boneWeights  Array of bone weights.
 	 *  @param vertexBuffer Vertex buffer to receive transformed vertex coordinates.
 	 */
-	void transform(ModelNode *node,
+	void transform(const std::vector<glm::mat4> &palette,
 	               const std::vector<float> &vertsIn,
 	               const std::vector<float> &boneIndices,
 	               const std::vector<float> &boneWeights,
 	               VertexBuffer *vertexBuffer);
-
-	/** Multiply a specified vector by a specified matrix. */
-	static void multiply(const float *v, const glm::mat4 &m, float *vOut);
 };
 
 } // End of namespace Aurora
@@ -85,6 +85,7 @@ void SubSceneQuad::render(RenderPass pass) {
 
 	for (size_t i = 0; i < _renderables.size(); ++i) {
 		_renderables[i]->advanceTime(elapsedTime);
+		_renderables[i]->snapshot();
 		_renderables[i]->render(pass);
 	}
 
@@ -22,8 +22,13 @@
  *  A text object.
  */
 
+#include <algorithm>
+
+#include "external/glm/gtc/matrix_transform.hpp"
+
 #include "src/events/requests.h"
 
+#include "src/graphics/graphics.h"
 #include "src/graphics/font.h"
 
 #include "src/graphics/aurora/fontman.h"
@@ -37,7 +42,7 @@ Text::Text(const FontHandle &font, const Common::UString &str,
 		float r, float g, float b, float a, float halign, float valign) :
 	Graphics::GUIElement(Graphics::GUIElement::kGUIElementFront),
 	_r(r), _g(g), _b(b), _a(a), _font(font), _x(0.0f), _y(0.0f), _halign(halign),_valign(valign),
-	_disableColorTokens(false) {
+	_disableColorTokens(false), _needLayout(true), _batched(false) {
 
 	set(str);
 
@@ -48,7 +53,7 @@ Text::Text(const FontHandle &font, float w, float h, const Common::UString &str,
 		float r, float g, float b, float a, float halign, float valign) :
 	Graphics::GUIElement(Graphics::GUIElement::kGUIElementFront), _r(r), _g(g), _b(b), _a(a),
 	_font(font), _x(0.0f), _y(0.0f), _halign(halign),_valign(valign),
-	_disableColorTokens(false) {
+	_disableColorTokens(false), _needLayout(true), _batched(false) {
 
 	_width = roundf(w);
 	_height = roundf(h);
@@ -62,7 +67,7 @@ Text::Text(Graphics::GUIElement::GUIElementType type, const FontHandle &font, fl
 		float r, float g, float b, float a, float halign, float valign) :
 	Graphics::GUIElement(type), _r(r), _g(g), _b(b), _a(a),
 	_font(font), _x(0.0f), _y(0.0f), _halign(halign),_valign(valign),
-	_disableColorTokens(false) {
+	_disableColorTokens(false), _needLayout(true), _batched(false) {
 
 	_width = roundf(w);
 	_height = roundf(h);
@@ -97,6 +102,8 @@ void Text::set(const Common::UString &str, float maxWidth, float maxHeight) {
 	_height = font.getHeight(_str, maxWidth, maxHeight);
 	_width  = font.getWidth (_str, maxWidth);
 
+	_needLayout = true;
+
 	unlockFrameIfVisible();
 }
 
@@ -114,6 +121,8 @@ void Text::setText(const Common::UString &str) {
 
 	_lineCount = font.getLineCount(_str, _width, _height);
 
+	_needLayout = true;
+
 	unlockFrameIfVisible();
 }
 
@@ -132,6 +141,8 @@ void Text::setColor(float r, float g, float b, float a) {
 	_b = b;
 	_a = a;
 
+	_needLayout = true;
+
 	unlockFrameIfVisible();
 }
 
@@ -144,7 +155,13 @@ float Text::getHorizontalAlign() const {
 }
 
 void Text::setHorizontalAlign(float halign) {
+	lockFrameIfVisible();
+
 	_halign = halign;
+
+	_needLayout = true;
+
+	unlockFrameIfVisible();
 }
 
 float Text::getVerticalAlign() const {
@@ -152,7 +169,13 @@ float Text::getVerticalAlign() const {
 }
 
 void Text::setVerticalAlign(float valign) {
+	lockFrameIfVisible();
+
 	_valign = valign;
+
+	_needLayout = true;
+
+	unlockFrameIfVisible();
 }
 
 const Common::UString &Text::get() const {
@@ -189,6 +212,8 @@ void Text::setSize(float width, float height) {
 
 	_lineCount = _font.getFont().getLineCount(_str, _width, _height);
 
+	_needLayout = true;
+
 	unlockFrameIfVisible();
 }
 
@@ -215,11 +240,55 @@ float Text::getHeight() const {
 void Text::calculateDistance() {
 }
 
+bool Text::isRetainable() const {
+	return true;
+}
+
 void Text::render(RenderPass pass) {
 	// Text objects should always be transparent
 	if (pass == kRenderPassOpaque)
 		return;
 
+	if (_needLayout)
+		layout();
+
+	if (!_batched) {
+		renderLines();
+		return;
+	}
+
+	if (_vertices.empty())
+		return;
+
+	Font &font = _font.getFont();
+
+	glTranslatef(roundf(_x), roundf(_y), 0.0f);
+
+	const GLsizei stride = 9 * sizeof(float);
+
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+
+	glVertexPointer  (3, GL_FLOAT, stride, &_vertices[0]);
+	glTexCoordPointer(2, GL_FLOAT, stride, &_vertices[3]);
+	glColorPointer   (4, GL_FLOAT, stride, &_vertices[5]);
+
+	for (std::vector<QuadRun>::const_iterator r = _quadRuns.begin(); r != _quadRuns.end(); ++r) {
+		font.bindPage(r->page);
+
+		GfxMan.countDrawCall(GL_QUADS, r->count);
+		glDrawArrays(GL_QUADS, r->first, r->count);
+	}
+
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+
+	glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+}
+
+void Text::renderLines() {
 	Font &font = _font.getFont();
 	float lineHeight = font.getHeight() + font.getLineSpacing();
 
@@ -269,8 +338,31 @@ bool Text::isIn(float x, float y) const {
 	return true;
 }
 
-void Text::renderImmediate(const glm::mat4 &parentTransform)
-{
+void Text::renderImmediate(const glm::mat4 &parentTransform) {
+	if (_needLayout)
+		layout();
+
+	if (!_batched) {
+		renderLinesImmediate(parentTransform);
+		return;
+	}
+
+	if (_vertices.empty())
+		return;
+
+	Font &font = _font.getFont();
+
+	font.renderBind(glm::translate(parentTransform, glm::vec3(roundf(_x), roundf(_y), 0.0f)));
+
+	for (std::vector<QuadRun>::const_iterator r = _quadRuns.begin(); r != _quadRuns.end(); ++r) {
+		font.bindPage(r->page);
+		font.renderQuads(&_vertices[r->first * 9], r->count);
+	}
+
+	font.renderUnbind();
+}
+
+void Text::renderLinesImmediate(const glm::mat4 &parentTransform) {
 	Font &font = _font.getFont();
 	float lineHeight = font.getHeight() + font.getLineSpacing();
 
@@ -300,6 +392,107 @@ void Text::renderImmediate(const glm::mat4 &parentTransform)
 	_font.getFont().renderUnbind();
 }
 
+void Text::layout() {
+	_needLayout = false;
+
+	_vertices.clear();
+	_quadRuns.clear();
+
+	Font &font = _font.getFont();
+	float lineHeight = font.getHeight() + font.getLineSpacing();
+
+	std::vector<Common::UString> lines;
+	font.split(_str, lines, _width, _height, false);
+
+	float blockSize = lines.size() * lineHeight;
+
+	// Start at the top
+	float y = roundf(((_height - blockSize) * _valign) + blockSize - lineHeight);
+
+	size_t position = 0;
+
+	ColorPositions::const_iterator color = _colors.begin();
+	float rgba[] = { _r, _g, _b, _a };
+
+	// The vertices of all quads in text order, and the quads sorted by page
+	std::vector<float> vertices;
+	std::vector<std::pair<size_t, size_t>> quads;
+
+	for (std::vector<Common::UString>::iterator l = lines.begin(); l != lines.end(); ++l) {
+		// Horizontal Align
+		float x = roundf((_width - font.getLineWidth(*l)) * _halign);
+
+		for (Common::UString::iterator s = l->begin(); s != l->end(); ++s, position++) {
+			// If we have color changes, apply them
+			while ((color != _colors.end()) && (color->position <= position)) {
+				if (color->defaultColor) {
+					rgba[0] = _r;
+					rgba[1] = _g;
+					rgba[2] = _b;
+					rgba[3] = _a;
+				} else {
+					rgba[0] = color->r;
+					rgba[1] = color->g;
+					rgba[2] = color->b;
+					rgba[3] = color->a;
+				}
+
+				++color;
+			}
+
+			Font::Quad quad;
+			if (!font.getQuad(*s, quad)) {
+				_batched = false;
+				return;
+			}
+
+			if (!quad.empty) {
+				quads.push_back(std::make_pair(quad.page, quads.size()));
+
+				for (int i = 0; i < 4; i++) {
+					vertices.push_back(x + quad.vX[i]);
+					vertices.push_back(y + quad.vY[i]);
+					vertices.push_back(0.0f);
+					vertices.push_back(quad.tX[i]);
+					vertices.push_back(quad.tY[i]);
+					vertices.insert(vertices.end(), rgba, rgba + 4);
+				}
+			}
+
+			x += quad.advance;
+		}
+
+		// Move to the next line
+		y -= lineHeight;
+
+		// \n character
+		position++;
+	}
+
+	_batched = true;
+
+	// Group the quads by font page, so that each page only needs one draw call
+	std::sort(quads.begin(), quads.end());
+
+	_vertices.reserve(vertices.size());
+	for (std::vector<std::pair<size_t, size_t>>::const_iterator q = quads.begin(); q != quads.end(); ++q) {
+		if (_quadRuns.empty() || (_quadRuns.back().page != q->first)) {
+			QuadRun run;
+
+			run.page  = q->first;
+			run.first = _vertices.size() / 9;
+			run.count = 0;
+
+			_quadRuns.push_back(run);
+		}
+
+		const float *quad = &vertices[q->second * 4 * 9];
+		_vertices.insert(_vertices.end(), quad, quad + 4 * 9);
+
+		_quadRuns.back().count += 4;
+	}
+}
+
 void Text::parseColors(const Common::UString &str, Common::UString &parsed,
                        ColorPositions &colors) {
 
@@ -385,7 +578,13 @@ void Text::parseColors(const Common::UString &str, Common::UString &parsed,
 }
 
 void Text::setFont(const Common::UString &fnt) {
+	lockFrameIfVisible();
+
 	_font = FontMan.get(fnt);
+
+	_needLayout = true;
+
+	unlockFrameIfVisible();
 }
 
 void Text::drawLine(const Common::UString &line,
@@ -25,6 +25,8 @@
 #ifndef GRAPHICS_AURORA_TEXT_H
 #define GRAPHICS_AURORA_TEXT_H
 
+#include <vector>
+
 #include "src/common/ustring.h"
 #include "src/common/maths.h"
 
@@ -87,11 +89,19 @@ public:
 	// Renderable
 	void calculateDistance();
 	void render(RenderPass pass);
+	bool isRetainable() const;
 	bool isIn(float x, float y) const;
 
 	void renderImmediate(const glm::mat4 &parentTransform);
 
 private:
+	/** A run of laid-out character quads that are all found on the same font page. */
+	struct QuadRun {
+		size_t   page;  ///< The font page.
+		uint32_t first; ///< Index of the first vertex of the run.
+		uint32_t count; ///< Number of vertices in the run.
+	};
+
 	float _r, _g, _b, _a;
 	FontHandle _font;
 
@@ -111,6 +121,20 @@ private:
 
 	bool _disableColorTokens;
 
+	bool _needLayout; ///< Do the cached quads need to be laid out anew?
+	bool _batched;    ///< Were the quads laid out, or can't the font batch them?
+
+	std::vector<float>   _vertices; ///< The laid-out quads, as { x, y, z, u, v, r, g, b, a } vertices.
+	std::vector<QuadRun> _quadRuns; ///< The vertices, split by font page.
+
+	/** Lay out the quads of all characters, relative to the text position. */
+	void layout();
+
+	/** Draw the text character by character, for fonts that can't batch. */
+	void renderLines();
+	/** Draw the text character by character, for fonts that can't batch. */
+	void renderLinesImmediate(const glm::mat4 &parentTransform);
+
 	void parseColors(const Common::UString &str, Common::UString &parsed,
 	                 ColorPositions &colors);
 
@@ -23,18 +23,24 @@
  */
 
 #include <cassert>
+#include <cstring>
 
 #include "src/common/types.h"
 #include "src/common/util.h"
 #include "src/common/strutil.h"
 #include "src/common/error.h"
 #include "src/common/readstream.h"
+#include "src/common/profiler.h"
+#include "src/common/debugman.h"
+#include "src/common/configvalue.h"
 
 #include "src/graphics/aurora/texture.h"
+#include "src/graphics/aurora/textureman.h"
 #include "src/graphics/aurora/pltfile.h"
 
 #include "src/graphics/types.h"
 #include "src/graphics/graphics.h"
+#include "src/graphics/pixeluploadbuffer.h"
 #include "src/graphics/images/txi.h"
 #include "src/graphics/images/decoder.h"
 #include "src/graphics/images/cubemapcombiner.h"
@@ -44,6 +50,7 @@
 #include "src/graphics/images/txb.h"
 #include "src/graphics/images/sbm.h"
 #include "src/graphics/images/xoreositex.h"
+#include "src/graphics/images/texturecache.h"
 
 #include "src/events/requests.h"
 
@@ -55,12 +62,26 @@ namespace Graphics {
 
 namespace Aurora {
 
-Texture::Texture() : _type(::Aurora::kFileTypeNone), _width(0), _height(0), _deswizzle(false) {
+/** Streamed textures always keep the mip maps up to this size uploaded. */
+static const int kStreamingMipMapSize = 64;
+/** Upload mip maps up to this many times larger than the texture appears on screen. */
+static const float kStreamingDetailBias = 2.0f;
+
+/** Only compress uncompressed textures with at least that many pixels. */
+static const uint32_t kMinCompressedPixels = 256 * 256;
+/** Added to the texture cache key of images that were compressed after loading. */
+static const uint32_t kCompressedCacheTag = 0x44585443; // DXTC
+
+static const Common::ConfigValue<bool> kConfigCompression("texturecompression", false);
+
+Texture::Texture() : _type(::Aurora::kFileTypeNone), _width(0), _height(0), _deswizzle(false),
+	_streamed(false), _baseMipMap(0), _wantedMipMap(0), _requestFrame(0) {
 }
 
 Texture::Texture(const Common::UString &name, ImageDecoder *image,
                  ::Aurora::FileType type, TXI *txi, bool deswizzle) :
-	_name(name), _type(type), _width(0), _height(0), _deswizzle(deswizzle) {
+	_name(name), _type(type), _width(0), _height(0), _deswizzle(deswizzle),
+	_streamed(false), _baseMipMap(0), _wantedMipMap(0), _requestFrame(0) {
 
 	set(name, image, type, txi, deswizzle);
 	addToQueues();
@@ -69,6 +90,8 @@ Texture::Texture(const Common::UString &name, ImageDecoder *image,
 Texture::~Texture() {
 	removeFromQueues();
 
+	TextureMan.removeFromAtlas(*this);
+
 	if (_textureID != 0)
 		GfxMan.abandon(&_textureID, 1);
 }
@@ -120,7 +143,7 @@ bool Texture::reload() {
 	try {
 
 		txi   = loadTXI  (_name);
-		image = loadImage(_name, type, txi, _deswizzle);
+		image = loadImage(_name, type, txi, _deswizzle, canCompress(txi));
 
 	} catch (Common::Exception &e) {
 		delete txi;
@@ -140,7 +163,188 @@ bool Texture::dumpTGA(const Common::UString &fileName) const {
 	if (!_image)
 		return false;
 
-	return _image->dumpTGA(fileName);
+	if (_image->hasData())
+		return _image->dumpTGA(fileName);
+
+	// The pixel data only lives on the GPU now, so load it again for dumping
+	::Aurora::FileType type = ::Aurora::kFileTypeNone;
+	std::unique_ptr<ImageDecoder> image(loadImage(_name, type, _txi.get(), _deswizzle));
+
+	return image->dumpTGA(fileName);
+}
+
+bool Texture::canReleaseData() const {
+	// We need to be able to load the image again by name
+	if (_name.empty() || isDynamic())
+		return false;
+
+	// Cube maps combined out of several image files can't be loaded by name
+	const TXI::Features &features = getTXI().getFeatures();
+	if (features.cube && (features.fileRange == 6))
+		return false;
+
+	return true;
+}
+
+bool Texture::canStream() const {
+	if (TextureMan.getStreamingBudget() == 0)
+		return false;
+
+	// Only 2D textures with their own mip maps, which can be loaded again by name
+	if (!_image || _image->isCubeMap() || (_image->getMipMapCount() < 2) || !canReleaseData())
+		return false;
+
+	return getStreamingMipMap() > 0;
+}
+
+bool Texture::isStreamed() const {
+	return _streamed;
+}
+
+size_t Texture::getStreamingMipMap() const {
+	if (!_image)
+		return 0;
+
+	size_t mipMap = 0;
+	while ((mipMap + 1) < _image->getMipMapCount()) {
+		const ImageDecoder::MipMap &m = _image->getMipMap(mipMap);
+		if (MAX(m.width, m.height) <= kStreamingMipMapSize)
+			break;
+
+		mipMap++;
+	}
+
+	return mipMap;
+}
+
+size_t Texture::getMipMapForScreenSize(float screenSize) const {
+	// Unknown screen size, play it safe
+	if (!_image || (screenSize <= 0.0f))
+		return 0;
+
+	const float wantedSize = screenSize * kStreamingDetailBias;
+
+	size_t mipMap = 0;
+	while ((mipMap + 1) < _image->getMipMapCount()) {
+		const ImageDecoder::MipMap &m = _image->getMipMap(mipMap + 1);
+		if (MAX(m.width, m.height) < wantedSize)
+			break;
+
+		mipMap++;
+	}
+
+	return mipMap;
+}
+
+void Texture::requestMipMap(size_t mipMap, uint32_t frame) {
+	if (_requestFrame != frame) {
+		_requestFrame = frame;
+		_wantedMipMap = mipMap;
+		return;
+	}
+
+	_wantedMipMap = MIN(_wantedMipMap, mipMap);
+}
+
+size_t Texture::getResidentMipMap() const {
+	return _baseMipMap;
+}
+
+size_t Texture::getWantedMipMap() const {
+	return _wantedMipMap;
+}
+
+uint32_t Texture::getRequestFrame() const {
+	return _requestFrame;
+}
+
+size_t Texture::getMipMapsSize(size_t first, size_t last) const {
+	if (!_image)
+		return 0;
+
+	last = MIN(last, _image->getMipMapCount());
+
+	size_t size = 0;
+	for (size_t i = 0; i < _image->getLayerCount(); i++)
+		for (size_t j = first; j < last; j++)
+			size += _image->getMipMap(j, i).size;
+
+	return size;
+}
+
+size_t Texture::getResidentSize() const {
+	if (!_image || (_textureID == 0))
+		return 0;
+
+	return getMipMapsSize(_baseMipMap, _image->getMipMapCount());
+}
+
+size_t Texture::getCPUSize() const {
+	if (!_image || !_image->hasData())
+		return 0;
+
+	return getMipMapsSize(0, _image->getMipMapCount());
+}
+
+bool Texture::streamMipMaps(size_t mipMap) {
+	if (!_streamed || (_textureID == 0))
+		return false;
+
+	mipMap = MIN(mipMap, getStreamingMipMap());
+	if (mipMap == _baseMipMap)
+		return true;
+
+	if ((mipMap < _baseMipMap) && !_image->hasData() && !restoreData())
+		return false;
+
+	glBindTexture(GL_TEXTURE_2D, _textureID);
+
+	if (mipMap < _baseMipMap) {
+		PROFILE_NOTE("upload", Common::UString::format("Texture \"%s\", mip maps %u-%u",
+		             _name.c_str(), (uint)mipMap, (uint)(_baseMipMap - 1)));
+
+		setAlign();
+
+		for (size_t i = mipMap; i < _baseMipMap; i++)
+			setMipMapData(GL_TEXTURE_2D, 0, i, _image->getMipMap(i).data.get());
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, mipMap);
+
+	} else {
+		// Stop sampling from the finer mip maps first, then free them
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, mipMap);
+
+		for (size_t i = _baseMipMap; i < mipMap; i++)
+			glTexImage2D(GL_TEXTURE_2D, i, GL_RGBA, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+	}
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+	TextureMan.invalidateState();
+
+	_baseMipMap = mipMap;
+
+	// Fully uploaded, so the pixel data can go until detail is dropped again
+	if (_baseMipMap == 0)
+		_image->releaseData();
+
+	return true;
+}
+
+bool Texture::restoreData() {
+	try {
+		::Aurora::FileType type = ::Aurora::kFileTypeNone;
+		std::unique_ptr<ImageDecoder> image(loadImage(_name, type, _txi.get(), _deswizzle,
+		                                              canCompress(_txi.get())));
+
+		if (!_image->takeData(*image))
+			throw Common::Exception("Image layout changed");
+
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed restoring texture \"%s\"", _name.c_str());
+		return false;
+	}
+
+	return true;
 }
 
 void Texture::doDestroy() {
@@ -148,25 +352,53 @@ void Texture::doDestroy() {
 		return;
 
 	glDeleteTextures(1, &_textureID);
+	TextureMan.invalidateState();
 
 	_textureID = 0;
 }
 
+size_t Texture::getUploadSize() const {
+	if (!_image)
+		return 0;
+
+	return getMipMapsSize(_streamed ? getStreamingMipMap() : 0, _image->getMipMapCount());
+}
+
 void Texture::doRebuild() {
 	if (!_image)
 		// No image
 		return;
 
+	// The pixel data was freed after the last upload, e.g. before a context change
+	if (!_image->hasData() && !restoreData())
+		return;
+
 	// Generate the texture ID
 	if (_textureID == 0)
 		glGenTextures(1, &_textureID);
 
-	if (_image->isCubeMap()) {
+	// Streamed textures start out with only their coarse mip maps
+	_baseMipMap   = _streamed ? getStreamingMipMap() : 0;
+	_wantedMipMap = _baseMipMap;
+
+	if (_image->isCubeMap())
 		createCubeMapTexture();
-		return;
-	}
+	else
+		create2DTexture();
 
-	create2DTexture();
+	// Creating the texture bound it behind the TextureManager's back
+	TextureMan.invalidateState();
+
+	Common::DebugManager::addMetric(Common::kMetricTexturesUploaded);
+	PROFILE_NOTE("upload", "Texture \"" + _name + "\"");
+
+	// Any copy in the GUI texture atlas is out of date now
+	TextureMan.removeFromAtlas(*this);
+
+	/* Don't keep a second copy of the texture around in RAM, if we can get it back.
+	 * Streamed textures keep theirs until all mip maps are uploaded. */
+	if (canReleaseData() && (_baseMipMap == 0))
+		_image->releaseData();
 }
 
 void Texture::setWrap(GLenum target, GLint wrapModeX, GLint wrapModeY) {
@@ -241,18 +473,65 @@ void Texture::setMipMaps(GLenum target) {
 	}
 }
 
-void Texture::setMipMapData(GLenum target, size_t layer, size_t mipMap) {
+void Texture::setMipMapData(GLenum target, size_t layer, size_t mipMap, const void *data) {
 	const ImageDecoder::MipMap &m = _image->getMipMap(mipMap, layer);
 
 	if (_image->isCompressed()) {
 		glCompressedTexImage2D(target, mipMap, _image->getFormatRaw(),
-		                       m.width, m.height, 0, m.size, m.data.get());
+		                       m.width, m.height, 0, m.size, data);
 	} else {
 		glTexImage2D(target, mipMap, _image->getFormatRaw(),
-		             m.width, m.height, 0, _image->getFormat(), _image->getDataType(), m.data.get());
+		             m.width, m.height, 0, _image->getFormat(), _image->getDataType(), data);
 	}
 }
 
+bool Texture::stageImageData(std::vector<const void *> &data, size_t firstMipMap) const {
+	const size_t layers  = _image->getLayerCount();
+	const size_t mipMaps = _image->getMipMapCount();
+
+	data.resize(layers * mipMaps);
+	for (size_t i = 0; i < layers; i++)
+		for (size_t j = 0; j < mipMaps; j++)
+			data[i * mipMaps + j] = _image->getMipMap(j, i).data.get();
+
+	PixelUploadBuffer *buffer = GfxMan.getPixelUploadBuffer();
+	if (!buffer)
+		return false;
+
+	// Keep every mip map 16-byte aligned within the buffer, whatever the unpack alignment
+	size_t size = 0;
+	for (size_t i = 0; i < layers; i++)
+		for (size_t j = firstMipMap; j < mipMaps; j++)
+			size += (_image->getMipMap(j, i).size + 15) & ~((size_t) 15);
+
+	byte *staging = buffer->map(size);
+	if (!staging)
+		return false;
+
+	std::vector<const void *> offsets(data.size());
+
+	size_t offset = 0;
+	for (size_t i = 0; i < layers; i++) {
+		for (size_t j = firstMipMap; j < mipMaps; j++) {
+			const ImageDecoder::MipMap &m = _image->getMipMap(j, i);
+
+			std::memcpy(staging + offset, m.data.get(), m.size);
+			offsets[i * mipMaps + j] = reinterpret_cast<const void *>(offset);
+
+			offset += (m.size + 15) & ~((size_t) 15);
+		}
+	}
+
+	// If the buffer contents got lost, upload straight from the image instead
+	if (!buffer->unmap()) {
+		buffer->unbind();
+		return false;
+	}
+
+	data.swap(offsets);
+	return true;
+}
+
 void Texture::create2DTexture() {
 	// Bind the texture
 	glBindTexture(GL_TEXTURE_2D, _textureID);
@@ -268,10 +547,18 @@ void Texture::create2DTexture() {
 
 	// Mip map parameters
 	setMipMaps(GL_TEXTURE_2D);
+	if (_baseMipMap > 0)
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, _baseMipMap);
 
 	// Texture image data
-	for (size_t i = 0; i < _image->getMipMapCount(); i++)
-		setMipMapData(GL_TEXTURE_2D, 0, i);
+	std::vector<const void *> data;
+	const bool staged = stageImageData(data, _baseMipMap);
+
+	for (size_t i = _baseMipMap; i < _image->getMipMapCount(); i++)
+		setMipMapData(GL_TEXTURE_2D, 0, i, data[i]);
+
+	if (staged)
+		GfxMan.getPixelUploadBuffer()->unbind();
 }
 
 void Texture::createCubeMapTexture() {
@@ -302,9 +589,15 @@ void Texture::createCubeMapTexture() {
 	};
 
 	// Texture image data
+	std::vector<const void *> data;
+	const bool staged = stageImageData(data);
+
 	for (size_t i = 0; i < _image->getLayerCount(); i++)
 		for (size_t j = 0; j < _image->getMipMapCount(); j++)
-			setMipMapData(faceTarget[i], i, j);
+			setMipMapData(faceTarget[i], i, j, data[i * _image->getMipMapCount() + j]);
+
+	if (staged)
+		GfxMan.getPixelUploadBuffer()->unbind();
 }
 
 Texture *Texture::createPLT(const Common::UString &name, Common::SeekableReadStream *imageStream) {
@@ -321,6 +614,8 @@ Texture *Texture::createPLT(const Common::UString &name, Common::SeekableReadStr
 }
 
 Texture *Texture::create(const Common::UString &name, bool deswizzle) {
+	PROFILE_ZONE("Texture::create");
+
 	::Aurora::FileType type = ::Aurora::kFileTypeNone;
 	ImageDecoder *image = 0;
 	ImageDecoder *layers[6] = { 0, 0, 0, 0, 0, 0 };
@@ -356,7 +651,7 @@ Texture *Texture::create(const Common::UString &name, bool deswizzle) {
 				return createPLT(name, imageStream);
 			}
 
-			image = loadImage(imageStream, type, txi, deswizzle);
+			image = loadImage(imageStream, type, txi, deswizzle, canCompress(txi));
 		}
 
 	} catch (Common::Exception &e) {
@@ -396,6 +691,8 @@ void Texture::set(const Common::UString &name, ImageDecoder *image, ::Aurora::Fi
 	_height = _image->getMipMap(0).height;
 
 	_deswizzle = deswizzle;
+
+	_streamed = canStream();
 }
 
 ImageDecoder *Texture::loadImage(const Common::UString &name, bool deswizzle) {
@@ -424,7 +721,7 @@ ImageDecoder *Texture::loadImage(const Common::UString &name, ::Aurora::FileType
 }
 
 ImageDecoder *Texture::loadImage(const Common::UString &name, ::Aurora::FileType &type,
-                                 TXI *txi, bool deswizzle) {
+                                 TXI *txi, bool deswizzle, bool compress) {
 
 	const bool isFileCubeMap = txi && txi->getFeatures().cube && (txi->getFeatures().fileRange == 6);
 	if (!isFileCubeMap) {
@@ -432,7 +729,7 @@ ImageDecoder *Texture::loadImage(const Common::UString &name, ::Aurora::FileType
 		if (!imageStream)
 			throw Common::Exception("No such image resource \"%s\"", name.c_str());
 
-		return loadImage(imageStream, type, txi, deswizzle);
+		return loadImage(imageStream, type, txi, deswizzle, compress);
 	}
 
 	ImageDecoder *layers[6] = { 0, 0, 0, 0, 0, 0 };
@@ -458,31 +755,59 @@ ImageDecoder *Texture::loadImage(const Common::UString &name, ::Aurora::FileType
 }
 
 ImageDecoder *Texture::loadImage(Common::SeekableReadStream *imageStream, ::Aurora::FileType type,
-                                 TXI *txi, bool deswizzle) {
+                                 TXI *txi, bool deswizzle, bool compress) {
 
 	// Check for a cube map, but only those that don't use a file for each side
 	const bool isCubeMap = txi && txi->getFeatures().cube && (txi->getFeatures().fileRange == 0);
 
+	/* Formats that need deswizzling or other conversions go through the texture cache,
+	 * as do images we compress ourselves. The others are either as fast to load directly
+	 * or can't be cached anyway. */
+	const bool cached = ((type == ::Aurora::kFileTypeTPC) || (type == ::Aurora::kFileTypeTXB) ||
+	                     (type == ::Aurora::kFileTypeSBM) || compress) && TextureCache::isEnabled();
+
 	ImageDecoder *image = 0;
 	try {
-		// Loading the different image formats
-		if      (type == ::Aurora::kFileTypeTGA)
-			image = new TGA(*imageStream, isCubeMap);
-		else if (type == ::Aurora::kFileTypeDDS)
-			image = new DDS(*imageStream);
-		else if (type == ::Aurora::kFileTypeTPC)
-			image = new TPC(*imageStream);
-		else if (type == ::Aurora::kFileTypeTXB)
-			image = new TXB(*imageStream);
-		else if (type == ::Aurora::kFileTypeSBM)
-			image = new SBM(*imageStream, deswizzle);
-		else if (type == ::Aurora::kFileTypeXEOSITEX)
-			image = new XEOSITEX(*imageStream);
-		else
-			throw Common::Exception("Unsupported image resource type %d", (int) type);
-
-		if (image->getMipMapCount() < 1)
-			throw Common::Exception("Texture has no images");
+		uint64_t cacheKey = 0;
+		if (cached) {
+			cacheKey = TextureCache::hash(TextureCache::hash((uint32_t) type), deswizzle ? 1 : 0);
+			if (compress)
+				cacheKey = TextureCache::hash(cacheKey, kCompressedCacheTag);
+
+			cacheKey = TextureCache::hash(cacheKey, *imageStream);
+
+			image = TextureCache::load(cacheKey);
+		}
+
+		if (!image) {
+			// Loading the different image formats
+			if      (type == ::Aurora::kFileTypeTGA)
+				image = new TGA(*imageStream, isCubeMap);
+			else if (type == ::Aurora::kFileTypeDDS)
+				image = new DDS(*imageStream);
+			else if (type == ::Aurora::kFileTypeTPC)
+				image = new TPC(*imageStream);
+			else if (type == ::Aurora::kFileTypeTXB)
+				image = new TXB(*imageStream);
+			else if (type == ::Aurora::kFileTypeSBM)
+				image = new SBM(*imageStream, deswizzle);
+			else if (type == ::Aurora::kFileTypeXEOSITEX)
+				image = new XEOSITEX(*imageStream);
+			else
+				throw Common::Exception("Unsupported image resource type %d", (int) type);
+
+			if (image->getMipMapCount() < 1)
+				throw Common::Exception("Texture has no images");
+
+			// Compress large uncompressed 2D images, to save video memory and bandwidth
+			const ImageDecoder::MipMap &base = image->getMipMap(0);
+			if (compress && !image->isCubeMap() && ((uint32_t)(base.width * base.height) >= kMinCompressedPixels))
+				image->compress();
+
+			// Cache the image before it's decompressed, since that depends on the GPU
+			if (cached)
+				TextureCache::save(cacheKey, *image);
+		}
 
 		// Decompress
 		if (GfxMan.needManualDeS3TC())
@@ -499,6 +824,17 @@ ImageDecoder *Texture::loadImage(Common::SeekableReadStream *imageStream, ::Auro
 	return image;
 }
 
+bool Texture::canCompress(const TXI *txi) {
+	if (!kConfigCompression.get() || GfxMan.needManualDeS3TC())
+		return false;
+
+	// Only diffuse textures: font glyphs and bump maps would suffer too much
+	if (txi && ((txi->getFeatures().numChars > 0) || txi->getFeatures().isBumpMap))
+		return false;
+
+	return true;
+}
+
 TXI *Texture::loadTXI(const Common::UString &name) {
 	Common::SeekableReadStream *txiStream = ResMan.getResource(name, ::Aurora::kFileTypeTXI);
 	if (!txiStream)
@@ -25,6 +25,7 @@
 #ifndef GRAPHICS_AURORA_TEXTURE_H
 #define GRAPHICS_AURORA_TEXTURE_H
 
+#include <vector>
 #include <memory>
 
 #include "src/common/ustring.h"
@@ -69,6 +70,35 @@ public:
 	/** Dump the texture into a TGA. */
 	bool dumpTGA(const Common::UString &fileName) const;
 
+	// .--- Mip map streaming
+	/** Are the finer mip maps of this texture only uploaded when they're needed? */
+	bool isStreamed() const;
+
+	/** Return the finest mip map needed to draw this texture over that many pixels on screen. */
+	size_t getMipMapForScreenSize(float screenSize) const;
+	/** Request this mip map for drawing the texture in this frame. */
+	void requestMipMap(size_t mipMap, uint32_t frame);
+
+	/** Return the finest mip map currently uploaded. */
+	size_t getResidentMipMap() const;
+	/** Return the finest mip map requested in the last frame the texture was drawn in. */
+	size_t getWantedMipMap() const;
+	/** Return the last frame the texture was drawn in. */
+	uint32_t getRequestFrame() const;
+	/** Return the finest mip map a streamed texture always keeps uploaded. */
+	size_t getStreamingMipMap() const;
+
+	/** Return the number of bytes the mip maps [first, last) take up. */
+	size_t getMipMapsSize(size_t first, size_t last) const;
+	/** Return the number of bytes the texture currently takes up on the GPU. */
+	size_t getResidentSize() const;
+	/** Return the number of bytes the texture's pixel data currently takes up in system memory. */
+	size_t getCPUSize() const;
+
+	/** Upload or drop mip maps, so that this one becomes the finest one uploaded. */
+	bool streamMipMaps(size_t mipMap);
+	// '---
+
 
 	/** Load an image in any of the common texture formats. */
 	static ImageDecoder *loadImage(const Common::UString &name, bool deswizzle = false);
@@ -95,6 +125,11 @@ protected:
 
 	bool _deswizzle;
 
+	bool     _streamed;     ///< Are the finer mip maps uploaded on demand?
+	size_t   _baseMipMap;   ///< The finest mip map currently uploaded.
+	size_t   _wantedMipMap; ///< The finest mip map requested in _requestFrame.
+	uint32_t _requestFrame; ///< The last frame the texture was drawn in.
+
 
 	Texture();
 	Texture(const Common::UString &name, ImageDecoder *image, ::Aurora::FileType type, TXI *txi = 0,
@@ -111,23 +146,41 @@ protected:
 	// GLContainer
 	void doRebuild();
 	void doDestroy();
+	size_t getUploadSize() const;
 
 
 	void create2DTexture();
 	void createCubeMapTexture();
 
+	/** Can the image's pixel data be freed after uploading, and loaded again when needed? */
+	bool canReleaseData() const;
+	/** Load the image's freed pixel data again. */
+	bool restoreData();
+
+	/** Can the finer mip maps of this texture be streamed in on demand? */
+	bool canStream() const;
+
 	void setWrap(GLenum target, GLint wrapModeX, GLint wrapModeY);
 	void setAlign();
 	void setFilter(GLenum target);
 	void setMipMaps(GLenum target);
-	void setMipMapData(GLenum target, size_t layer, size_t mipMap);
+	void setMipMapData(GLenum target, size_t layer, size_t mipMap, const void *data);
+
+	/** Collect the data pointers of all mip maps from firstMipMap on, staging them in the pixel upload buffer if possible.
+	 *
+	 *  Returns true if the data was staged. The buffer then needs to be unbound after uploading.
+	 */
+	bool stageImageData(std::vector<const void *> &data, size_t firstMipMap = 0) const;
+
+	/** Should images loaded for a texture with this TXI be compressed, if they're uncompressed? */
+	static bool canCompress(const TXI *txi);
 
 	static TXI *loadTXI(const Common::UString &name);
 	static ImageDecoder *loadImage(Common::SeekableReadStream *imageStream, ::Aurora::FileType type,
-	                               TXI *txi = 0, bool deswizzle = false);
+	                               TXI *txi = 0, bool deswizzle = false, bool compress = false);
 
 	static ImageDecoder *loadImage(const Common::UString &name, ::Aurora::FileType &type, TXI *txi,
-	                               bool deswizzle = false);
+	                               bool deswizzle = false, bool compress = false);
 
 	static Texture *createPLT(const Common::UString &name, Common::SeekableReadStream *imageStream);
 };
@@ -0,0 +1,247 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Shared textures small GUI textures are packed into.
+ */
+
+#include <cstring>
+
+#include "src/common/util.h"
+
+#include "src/graphics/graphics.h"
+
+#include "src/graphics/aurora/textureatlas.h"
+#include "src/graphics/aurora/texture.h"
+#include "src/graphics/aurora/textureman.h"
+
+#include "src/graphics/images/txi.h"
+#include "src/graphics/images/decoder.h"
+
+namespace Graphics {
+
+namespace Aurora {
+
+/** The largest textures we pack into the atlas. */
+static const uint32_t kMaxPackedSize = 256;
+/** The size of an atlas page. */
+static const uint32_t kPageSize = 1024;
+/** The maximum number of atlas pages. */
+static const size_t kMaxPages = 4;
+/** Each packed texture is surrounded by a border of its edge pixels, so filtering doesn't bleed. */
+static const uint32_t kBorder = 1;
+
+TextureAtlas::TextureAtlas() : _pageSize(0) {
+}
+
+TextureAtlas::~TextureAtlas() {
+	destroy();
+}
+
+bool TextureAtlas::get(const Texture &texture, Region &region) {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	std::unordered_map<const Texture *, Region>::const_iterator r = _regions.find(&texture);
+	if (r != _regions.end()) {
+		region = r->second;
+		return true;
+	}
+
+	if (_rejected.find(&texture) != _rejected.end())
+		return false;
+
+	if (!canPack(texture) || !pack(texture, region)) {
+		// Not built yet, so maybe next time
+		if (texture.getID() != 0)
+			_rejected.insert(std::make_pair(&texture, true));
+
+		return false;
+	}
+
+	_regions.insert(std::make_pair(&texture, region));
+	return true;
+}
+
+void TextureAtlas::remove(const Texture &texture) {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	// The space stays allocated, but a new texture in its place can't be mistaken for this one
+	_regions.erase(&texture);
+	_rejected.erase(&texture);
+}
+
+bool TextureAtlas::canPack(const Texture &texture) const {
+	if ((texture.getID() == 0) || texture.isDynamic() || texture.isStreamed())
+		return false;
+
+	if ((texture.getWidth() > kMaxPackedSize) || (texture.getHeight() > kMaxPackedSize))
+		return false;
+
+	if ((texture.getWidth() == 0) || (texture.getHeight() == 0))
+		return false;
+
+	// The atlas pages are always filtered linearly
+	if (texture.getImage().isCubeMap() || !texture.getTXI().getFeatures().filter)
+		return false;
+
+	return true;
+}
+
+bool TextureAtlas::pack(const Texture &texture, Region &region) {
+	const uint32_t width  = texture.getWidth();
+	const uint32_t height = texture.getHeight();
+
+	size_t page;
+	uint32_t x, y;
+	if (!allocate(width + 2 * kBorder, height + 2 * kBorder, page, x, y))
+		return false;
+
+	// Read the texture back, whatever its format on the GPU
+	std::vector<byte> pixels(width * height * 4);
+
+	glBindTexture(GL_TEXTURE_2D, texture.getID());
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+	// Add the border, repeating the edge pixels
+	const uint32_t paddedWidth  = width  + 2 * kBorder;
+	const uint32_t paddedHeight = height + 2 * kBorder;
+
+	std::vector<byte> padded(paddedWidth * paddedHeight * 4);
+	for (uint32_t py = 0; py < paddedHeight; py++) {
+		const uint32_t sy = MIN<uint32_t>(py - MIN(py, kBorder), height - 1);
+
+		for (uint32_t px = 0; px < paddedWidth; px++) {
+			const uint32_t sx = MIN<uint32_t>(px - MIN(px, kBorder), width - 1);
+
+			std::memcpy(&padded[(py * paddedWidth + px) * 4], &pixels[(sy * width + sx) * 4], 4);
+		}
+	}
+
+	glBindTexture(GL_TEXTURE_2D, _pages[page].id);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, paddedWidth, paddedHeight, GL_RGBA, GL_UNSIGNED_BYTE, padded.data());
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+	TextureMan.invalidateState();
+
+	region.page = _pages[page].id;
+	region.u1   = (float)(x + kBorder)          / _pageSize;
+	region.v1   = (float)(y + kBorder)          / _pageSize;
+	region.u2   = (float)(x + kBorder + width)  / _pageSize;
+	region.v2   = (float)(y + kBorder + height) / _pageSize;
+
+	return true;
+}
+
+bool TextureAtlas::allocate(uint32_t width, uint32_t height, size_t &page, uint32_t &x, uint32_t &y) {
+	if (_pageSize == 0) {
+		GLint maxSize = 0;
+		glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+
+		_pageSize = MIN<uint32_t>(kPageSize, MAX<GLint>(maxSize, 0));
+	}
+
+	if ((width > _pageSize) || (height > _pageSize))
+		return false;
+
+	for (page = 0; page <= _pages.size(); page++) {
+		if (page == _pages.size()) {
+			if (_pages.size() >= kMaxPages)
+				return false;
+
+			createPage();
+		}
+
+		Page &p = _pages[page];
+
+		// Start a new shelf if the texture doesn't fit onto the current one
+		if ((p.shelfX + width) > _pageSize) {
+			p.shelfX      = 0;
+			p.shelfY     += p.shelfHeight;
+			p.shelfHeight = 0;
+		}
+
+		if ((p.shelfY + height) > _pageSize)
+			continue;
+
+		x = p.shelfX;
+		y = p.shelfY;
+
+		p.shelfX     += width;
+		p.shelfHeight = MAX(p.shelfHeight, height);
+
+		return true;
+	}
+
+	return false;
+}
+
+void TextureAtlas::createPage() {
+	Page page;
+
+	page.shelfX      = 0;
+	page.shelfY      = 0;
+	page.shelfHeight = 0;
+
+	glGenTextures(1, &page.id);
+	glBindTexture(GL_TEXTURE_2D, page.id);
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_FALSE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, _pageSize, _pageSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+	TextureMan.invalidateState();
+
+	_pages.push_back(page);
+}
+
+void TextureAtlas::doRebuild() {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	// The pages are gone with the old context. Everything will be packed again when needed
+	_pages.clear();
+	_regions.clear();
+	_rejected.clear();
+}
+
+void TextureAtlas::doDestroy() {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (std::vector<Page>::iterator p = _pages.begin(); p != _pages.end(); ++p)
+		glDeleteTextures(1, &p->id);
+
+	TextureMan.invalidateState();
+
+	_pages.clear();
+	_regions.clear();
+	_rejected.clear();
+}
+
+} // End of namespace Aurora
+
+} // End of namespace Graphics
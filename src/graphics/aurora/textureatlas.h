@@ -0,0 +1,102 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Shared textures small GUI textures are packed into.
+ */
+
+#ifndef GRAPHICS_AURORA_TEXTUREATLAS_H
+#define GRAPHICS_AURORA_TEXTUREATLAS_H
+
+#include <vector>
+#include <unordered_map>
+
+#include "src/common/types.h"
+#include "src/common/mutex.h"
+
+#include "src/graphics/types.h"
+#include "src/graphics/glcontainer.h"
+
+namespace Graphics {
+
+namespace Aurora {
+
+class Texture;
+
+/** A set of large textures small GUI textures are packed into.
+ *
+ *  Quads using textures from the same atlas page can be drawn in a
+ *  single call, without rebinding textures in between. Textures are
+ *  packed on demand, copying their pixels out of the GPU, and stay in
+ *  the atlas until they're reloaded or destroyed.
+ */
+class TextureAtlas : public GLContainer {
+public:
+	/** Where a texture lies within the atlas. */
+	struct Region {
+		TextureID page; ///< The atlas page holding the texture.
+
+		float u1, v1;   ///< The page texture coordinates of the texture's (0, 0).
+		float u2, v2;   ///< The page texture coordinates of the texture's (1, 1).
+	};
+
+	TextureAtlas();
+	~TextureAtlas();
+
+	/** Find the texture in the atlas, packing it in if possible. */
+	bool get(const Texture &texture, Region &region);
+	/** Forget about this texture. */
+	void remove(const Texture &texture);
+
+protected:
+	void doRebuild();
+	void doDestroy();
+
+private:
+	/** An atlas page, filled shelf by shelf, from the bottom up. */
+	struct Page {
+		TextureID id;
+
+		uint32_t shelfX;      ///< The x coordinate of the next texture on the current shelf.
+		uint32_t shelfY;      ///< The y coordinate of the current shelf.
+		uint32_t shelfHeight; ///< The height of the current shelf.
+	};
+
+	uint32_t _pageSize;
+	std::vector<Page> _pages;
+
+	std::unordered_map<const Texture *, Region> _regions;
+	std::unordered_map<const Texture *, bool> _rejected; ///< Textures that can't be packed.
+
+	std::mutex _mutex;
+
+	bool canPack(const Texture &texture) const;
+	bool pack(const Texture &texture, Region &region);
+
+	/** Find a free spot of that size, creating a new page if necessary. */
+	bool allocate(uint32_t width, uint32_t height, size_t &page, uint32_t &x, uint32_t &y);
+	void createPage();
+};
+
+} // End of namespace Aurora
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_AURORA_TEXTUREATLAS_H
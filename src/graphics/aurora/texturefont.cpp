@@ -185,6 +185,34 @@ void TextureFont::renderUnbind() const {
 	glUseProgram(0);
 }
 
+bool TextureFont::getQuad(uint32_t c, Quad &quad) const {
+	std::map<uint32_t, Char>::const_iterator cC = _chars.find(c);
+
+	quad.advance = getWidth(c);
+	quad.page    = 0;
+	quad.empty   = cC == _chars.end();
+
+	if (quad.empty)
+		return true;
+
+	for (int i = 0; i < 4; i++) {
+		quad.tX[i] = cC->second.tX[i];
+		quad.tY[i] = cC->second.tY[i];
+		quad.vX[i] = cC->second.vX[i];
+		quad.vY[i] = cC->second.vY[i];
+	}
+
+	return true;
+}
+
+void TextureFont::bindPage(size_t UNUSED(page)) const {
+	TextureMan.set(_texture);
+}
+
+void TextureFont::renderQuads(const float *vertices, uint32_t count) const {
+	_mesh->renderQuads(vertices, count);
+}
+
 void TextureFont::load() {
 	const Texture &texture = _texture.getTexture();
 	const TXI::Features &txiFeatures = texture.getTXI().getFeatures();
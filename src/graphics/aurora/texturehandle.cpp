@@ -40,14 +40,14 @@ ManagedTexture::~ManagedTexture() {
 }
 
 
-TextureHandle::TextureHandle() : _empty(true) {
+TextureHandle::TextureHandle() : _empty(true), _entry(0) {
 }
 
-TextureHandle::TextureHandle(TextureMap::iterator &i) : _empty(false), _it(i) {
-	_it->second->referenceCount++;
+TextureHandle::TextureHandle(TextureMap::value_type &entry) : _empty(false), _entry(&entry) {
+	_entry->second->referenceCount++;
 }
 
-TextureHandle::TextureHandle(const TextureHandle &right) : _empty(true) {
+TextureHandle::TextureHandle(const TextureHandle &right) : _empty(true), _entry(0) {
 	*this = right;
 }
 
@@ -75,7 +75,7 @@ const Common::UString &TextureHandle::getName() const {
 	if (_empty)
 		return kEmptyString;
 
-	return _it->first;
+	return _entry->first.getString();
 }
 
 void TextureHandle::clear() {
@@ -85,7 +85,7 @@ void TextureHandle::clear() {
 Texture &TextureHandle::getTexture() const {
 	assert(!_empty);
 
-	return *_it->second->texture;
+	return *_entry->second->texture;
 }
 
 } // End of namespace Aurora
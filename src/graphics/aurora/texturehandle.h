@@ -25,10 +25,11 @@
 #ifndef GRAPHICS_AURORA_TEXTUREHANDLE_H
 #define GRAPHICS_AURORA_TEXTUREHANDLE_H
 
-#include <map>
+#include <atomic>
 
 #include "src/common/types.h"
 #include "src/common/ustring.h"
+#include "src/common/istringkey.h"
 
 namespace Graphics {
 
@@ -39,13 +40,13 @@ class Texture;
 /** A managed texture, storing how often it's referenced. */
 struct ManagedTexture {
 	Texture *texture;
-	uint32_t referenceCount;
+	std::atomic<uint32_t> referenceCount;
 
 	ManagedTexture(Texture *t);
 	~ManagedTexture();
 };
 
-typedef std::map<Common::UString, ManagedTexture *> TextureMap;
+typedef Common::IStringKeyMap<ManagedTexture *> TextureMap;
 
 /** A handle to a texture. */
 class TextureHandle {
@@ -65,9 +66,9 @@ public:
 
 private:
 	bool _empty;
-	TextureMap::iterator _it;
+	TextureMap::value_type *_entry; ///< The texture's map entry. Unlike iterators, stays valid on rehashing.
 
-	TextureHandle(TextureMap::iterator &i);
+	TextureHandle(TextureMap::value_type &entry);
 
 	friend class TextureManager;
 };
@@ -23,16 +23,24 @@
  */
 
 #include <memory>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <algorithm>
 
 #include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/uuid.h"
+#include "src/common/configman.h"
+#include "src/common/debugman.h"
 
 #include "src/graphics/aurora/textureman.h"
 #include "src/graphics/aurora/texture.h"
 
 #include "src/graphics/images/decoder.h"
 
+#include "src/aurora/resman.h"
+
 #include "src/graphics/graphics.h"
 
 #include "src/events/requests.h"
@@ -80,8 +88,30 @@ static GLenum kTextureUnit[] = {
 
 static const size_t kTextureUnitCount = ARRAYSIZE(kTextureUnit);
 
+/** Cached texture state we don't know. */
+static const TextureID kTextureUnknown = 0xFFFFFFFF;
+static const GLenum    kTargetUnknown  = 0xFFFFFFFF;
+static const size_t    kUnitUnknown    = SIZE_MAX;
+
+/** The texture coordinate generation modes we use. */
+enum TexGen {
+	kTexGenUnknown = -1,
+	kTexGenNone,
+	kTexGenSphereMap,
+	kTexGenReflectionMap
+};
+
+/** Streamed textures not drawn for that many frames only need their coarse mip maps. */
+static const uint32_t kStreamingIdleFrames = 300;
+/** Upload at most that many bytes of streamed mip maps per frame. */
+static const size_t kStreamingUploadBudget = 8 * 1024 * 1024;
 
-TextureManager::TextureManager() : _deswizzleSBM(false), _recordNewTextures(false) {
+
+TextureManager::TextureManager() : _deswizzleSBM(false), _missingGeneration(0), _recordNewTextures(false),
+	_streamingBudget(MAX(ConfigMan.getInt("texturebudget", 0), 0) * (size_t) 1024 * 1024),
+	_streamingFrame(1), _screenSize(0.0f), _activeUnit(kUnitUnknown), _units(kTextureUnitCount) {
+
+	invalidateState();
 }
 
 TextureManager::~TextureManager() {
@@ -89,9 +119,17 @@ TextureManager::~TextureManager() {
 }
 
 void TextureManager::clear() {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	{
+		// Textures remove themselves from the atlas, so it needs to go first
+		std::lock_guard<std::mutex> atlasLock(_atlasMutex);
+
+		_atlas.reset();
+	}
+
+	std::lock_guard<std::shared_timed_mutex> lock(_mutex);
 
 	_bogusTextures.clear();
+	_missingTextures.clear();
 
 	for (TextureMap::iterator t = _textures.begin(); t != _textures.end(); ++t)
 		delete t->second;
@@ -99,12 +137,14 @@ void TextureManager::clear() {
 
 	_deswizzleSBM = false;
 
+	std::lock_guard<std::mutex> recordLock(_recordMutex);
+
 	_recordNewTextures = false;
 	_newTextureNames.clear();
 }
 
 void TextureManager::addBogusTexture(const Common::UString &name) {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	std::lock_guard<std::shared_timed_mutex> lock(_mutex);
 
 	_bogusTextures.insert(name);
 }
@@ -114,18 +154,20 @@ void TextureManager::setDeswizzleSBM(bool deswizzle) {
 }
 
 bool TextureManager::hasTexture(const Common::UString &name) {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	const Common::IStringKey key(name);
 
-	if (_bogusTextures.find(name) != _bogusTextures.end())
+	std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+
+	if (_bogusTextures.find(key) != _bogusTextures.end())
 		return true;
-	if (_textures.find(name) != _textures.end())
+	if (_textures.find(key) != _textures.end())
 		return true;
 
 	return false;
 }
 
 TextureHandle TextureManager::add(Texture *texture, Common::UString name) {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	std::lock_guard<std::shared_timed_mutex> lock(_mutex);
 
 	if (_bogusTextures.find(name) != _bogusTextures.end()) {
 		delete texture;
@@ -142,62 +184,106 @@ TextureHandle TextureManager::add(Texture *texture, Common::UString name) {
 		throw Common::Exception("Texture \"%s\" already exists", name.c_str());
 
 	managedTexture.release();
-	TextureMap::iterator textureIterator = result.first;
 
-	if (_recordNewTextures)
-		_newTextureNames.push_back(name);
+	recordNewTexture(name);
 
-	return TextureHandle(textureIterator);
+	return TextureHandle(*result.first);
 }
 
 TextureHandle TextureManager::get(Common::UString name) {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	// Hash the name only once, for all the lookups
+	Common::IStringKey key(name);
 
-	if (_bogusTextures.find(name) != _bogusTextures.end())
-		return TextureHandle();
+	{
+		std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+
+		if (_bogusTextures.find(key) != _bogusTextures.end())
+			return TextureHandle();
 
-	TextureMap::iterator texture = _textures.find(name);
-	if (texture == _textures.end()) {
-		std::pair<TextureMap::iterator, bool> result;
+		TextureMap::iterator texture = _textures.find(key);
+		if (texture != _textures.end()) {
+			recordNewTexture(name);
+
+			return TextureHandle(*texture);
+		}
 
-		ManagedTexture *managedTexture = new ManagedTexture(Texture::create(name, _deswizzleSBM));
+		// Don't go looking through the resources again for a texture that's not there
+		if (isMissing(key))
+			throw Common::Exception("Texture \"%s\" failed to load before", name.c_str());
+	}
 
-		if (managedTexture->texture->isDynamic())
-			name = name + "#" + Common::generateIDRandomString();
+	// Load the texture without holding the lock, so that other lookups can go on meanwhile
 
-		result = _textures.insert(std::make_pair(name, managedTexture));
+	const uint32_t generation = ResMan.getGeneration();
 
-		texture = result.first;
+	std::unique_ptr<ManagedTexture> managedTexture;
+	try {
+		managedTexture = std::make_unique<ManagedTexture>(Texture::create(name, _deswizzleSBM));
+	} catch (...) {
+		addMissing(key, generation);
+		throw;
 	}
 
-	if (_recordNewTextures)
-		_newTextureNames.push_back(name);
+	std::lock_guard<std::shared_timed_mutex> lock(_mutex);
+
+	if (managedTexture->texture->isDynamic()) {
+		name = name + "#" + Common::generateIDRandomString();
+		key  = Common::IStringKey(name);
+	}
 
-	return TextureHandle(texture);
+	// If another thread loaded the same texture in the meantime, use that one instead
+	std::pair<TextureMap::iterator, bool> result = _textures.insert(std::make_pair(key, managedTexture.get()));
+	if (result.second)
+		managedTexture.release();
+
+	recordNewTexture(name);
+
+	return TextureHandle(*result.first);
 }
 
 TextureHandle TextureManager::getIfExist(const Common::UString &name) {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	const Common::IStringKey key(name);
+
+	std::shared_lock<std::shared_timed_mutex> lock(_mutex);
 
-	if (_bogusTextures.find(name) != _bogusTextures.end())
+	if (_bogusTextures.find(key) != _bogusTextures.end())
 		return TextureHandle();
 
-	TextureMap::iterator texture = _textures.find(name);
+	TextureMap::iterator texture = _textures.find(key);
 	if (texture != _textures.end())
-		return TextureHandle(texture);
+		return TextureHandle(*texture);
 
 	return TextureHandle();
 }
 
+bool TextureManager::isMissing(const Common::IStringKey &name) const {
+	if (_missingGeneration != ResMan.getGeneration())
+		return false;
+
+	return _missingTextures.find(name) != _missingTextures.end();
+}
+
+void TextureManager::addMissing(const Common::IStringKey &name, uint32_t generation) {
+	std::lock_guard<std::shared_timed_mutex> lock(_mutex);
+
+	// The resources changed, so all the textures might be there now
+	if (_missingGeneration != generation) {
+		_missingTextures.clear();
+		_missingGeneration = generation;
+	}
+
+	_missingTextures.insert(name);
+}
+
 void TextureManager::startRecordNewTextures() {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	std::lock_guard<std::mutex> lock(_recordMutex);
 
 	_newTextureNames.clear();
 	_recordNewTextures = true;
 }
 
 void TextureManager::stopRecordNewTextures(std::list<Common::UString> &newTextures) {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	std::lock_guard<std::mutex> lock(_recordMutex);
 
 	_newTextureNames.swap(newTextures);
 
@@ -205,43 +291,86 @@ void TextureManager::stopRecordNewTextures(std::list<Common::UString> &newTextur
 	_recordNewTextures = false;
 }
 
-void TextureManager::assign(TextureHandle &texture, const TextureHandle &from) {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+void TextureManager::recordNewTexture(const Common::UString &name) {
+	std::lock_guard<std::mutex> lock(_recordMutex);
+
+	if (_recordNewTextures)
+		_newTextureNames.push_back(name);
+}
 
+void TextureManager::assign(TextureHandle &texture, const TextureHandle &from) {
+	// The other handle holds a reference, so the texture can't vanish here
 	texture._empty = from._empty;
-	texture._it    = from._it;
+	texture._entry = from._entry;
 
 	if (!texture._empty)
-		texture._it->second->referenceCount++;
+		texture._entry->second->referenceCount++;
 }
 
 void TextureManager::release(TextureHandle &texture) {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	if (!texture._empty) {
+		std::atomic<uint32_t> &referenceCount = texture._entry->second->referenceCount;
+
+		/* Dropping a reference that isn't the last one doesn't need the lock.
+		 * The last one might get revived by a concurrent lookup, though, so
+		 * check again while holding the lock. */
+
+		uint32_t count = referenceCount.load();
+		while ((count > 1) && !referenceCount.compare_exchange_weak(count, count - 1))
+			;
+
+		if (count <= 1) {
+			std::lock_guard<std::shared_timed_mutex> lock(_mutex);
+
+			if (--referenceCount == 0) {
+				TextureMap::iterator entry = _textures.find(texture._entry->first);
 
-	if (!texture._empty && (texture._it != _textures.end())) {
-		if (--texture._it->second->referenceCount == 0) {
-			delete texture._it->second;
-			_textures.erase(texture._it);
+				delete texture._entry->second;
+				_textures.erase(entry);
+			}
 		}
 	}
 
 	texture._empty = true;
-	texture._it    = _textures.end();
+	texture._entry = 0;
 }
 
 void TextureManager::reloadAll() {
-	std::lock_guard<std::recursive_mutex> lock(_mutex);
+	std::lock_guard<std::shared_timed_mutex> lock(_mutex);
 
 	GfxMan.lockFrame();
 
-	for (TextureMap::iterator texture = _textures.begin(); texture != _textures.end(); ++texture) {
-		try {
-			texture->second->texture->reload();
-		} catch (...) {
-			Common::exceptionDispatcherWarning("Failed reloading texture \"%s\"", texture->first.c_str());
+	std::vector<TextureMap::iterator> textures;
+	textures.reserve(_textures.size());
+
+	for (TextureMap::iterator texture = _textures.begin(); texture != _textures.end(); ++texture)
+		textures.push_back(texture);
+
+	// Decoding the textures is independent, so spread it over all cores
+	std::atomic<size_t> next(0);
+
+	auto reloader = [&textures, &next]() {
+		for (size_t i = next++; i < textures.size(); i = next++) {
+			try {
+				textures[i]->second->texture->reload();
+			} catch (...) {
+				Common::exceptionDispatcherWarning("Failed reloading texture \"%s\"", textures[i]->first.getString().c_str());
+			}
 		}
-	}
+	};
 
+	const size_t threadCount = MIN<size_t>(MAX<size_t>(std::thread::hardware_concurrency(), 1), textures.size());
+
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < threadCount; i++)
+		threads.emplace_back(reloader);
+
+	reloader();
+
+	for (std::vector<std::thread>::iterator t = threads.begin(); t != threads.end(); ++t)
+		t->join();
+
+	// The uploads are spread over the next frames by the graphics manager
 	RequestMan.sync();
 	GfxMan.unlockFrame();
 }
@@ -250,28 +379,26 @@ void TextureManager::reset() {
 	for (size_t i = 0; i < kTextureUnitCount; i++) {
 		activeTexture(i);
 
-		glDisable(GL_TEXTURE_2D);
-		glDisable(GL_TEXTURE_CUBE_MAP);
+		UnitState &unit = getUnitState();
 
-		glDisable(GL_TEXTURE_GEN_S);
-		glDisable(GL_TEXTURE_GEN_T);
-		glDisable(GL_TEXTURE_GEN_R);
+		enableTarget(unit, 0);
+		setTexGen(unit, kTexGenNone);
 	}
 
 	activeTexture(0);
-	glEnable(GL_TEXTURE_2D);
-	glBindTexture(GL_TEXTURE_2D, 0);
+
+	UnitState &unit = getUnitState();
+
+	enableTarget(unit, GL_TEXTURE_2D);
+	bindTexture(unit, GL_TEXTURE_2D, 0);
 }
 
 void TextureManager::set() {
-	glBindTexture(GL_TEXTURE_2D, 0);
+	UnitState &unit = getUnitState();
 
-	glEnable(GL_TEXTURE_2D);
-	glDisable(GL_TEXTURE_CUBE_MAP);
-
-	glDisable(GL_TEXTURE_GEN_S);
-	glDisable(GL_TEXTURE_GEN_T);
-	glDisable(GL_TEXTURE_GEN_R);
+	bindTexture(unit, GL_TEXTURE_2D, 0);
+	enableTarget(unit, GL_TEXTURE_2D);
+	setTexGen(unit, kTexGenNone);
 }
 
 void TextureManager::set(const TextureHandle &handle, TextureMode mode) {
@@ -280,56 +407,267 @@ void TextureManager::set(const TextureHandle &handle, TextureMode mode) {
 		return;
 	}
 
-	TextureID id = handle._it->second->texture->getID();
+	request(handle);
+
+	TextureID id = handle._entry->second->texture->getID();
 	if (id == 0)
-		warning("Empty texture ID for texture \"%s\"", handle._it->first.c_str());
+		warning("Empty texture ID for texture \"%s\"", handle._entry->first.getString().c_str());
+
+	const bool isCubeMap = handle._entry->second->texture->getImage().isCubeMap();
+	const GLenum target = isCubeMap ? GL_TEXTURE_CUBE_MAP : GL_TEXTURE_2D;
+
+	UnitState &unit = getUnitState();
+
+	bindTexture(unit, target, id);
+	enableTarget(unit, target);
+
+	switch (mode) {
+		case kModeEnvironmentMapReflective:
+			setTexGen(unit, isCubeMap ? kTexGenReflectionMap : kTexGenSphereMap);
+			break;
 
-	if (handle._it->second->texture->getImage().isCubeMap()) {
-		glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+		case kModeDiffuse:
+		default:
+			setTexGen(unit, kTexGenNone);
+			break;
+	}
+}
+
+void TextureManager::activeTexture(size_t n) {
+	if ((n >= GfxMan.getMultipleTextureCount()) || (n >= ARRAYSIZE(kTextureUnit)))
+		return;
+
+	if (n == _activeUnit)
+		return;
+
+	glActiveTextureARB(kTextureUnit[n]);
+
+	_activeUnit = n;
+}
+
+void TextureManager::invalidateState() {
+	_activeUnit = kUnitUnknown;
+
+	_unknownUnit.texture2D   = kTextureUnknown;
+	_unknownUnit.textureCube = kTextureUnknown;
+	_unknownUnit.target      = kTargetUnknown;
+	_unknownUnit.texGen      = kTexGenUnknown;
+
+	std::fill(_units.begin(), _units.end(), _unknownUnit);
+}
 
+TextureManager::UnitState &TextureManager::getUnitState() {
+	if (_activeUnit < _units.size())
+		return _units[_activeUnit];
+
+	// We don't know which unit is active, so we don't know anything about it either
+	_unknownUnit.texture2D   = kTextureUnknown;
+	_unknownUnit.textureCube = kTextureUnknown;
+	_unknownUnit.target      = kTargetUnknown;
+	_unknownUnit.texGen      = kTexGenUnknown;
+
+	return _unknownUnit;
+}
+
+void TextureManager::bindTexture(UnitState &unit, GLenum target, TextureID texture) {
+	TextureID &bound = (target == GL_TEXTURE_CUBE_MAP) ? unit.textureCube : unit.texture2D;
+	if (bound == texture)
+		return;
+
+	glBindTexture(target, texture);
+	bound = texture;
+
+	Common::DebugManager::addMetric(Common::kMetricTextureBinds);
+}
+
+void TextureManager::enableTarget(UnitState &unit, GLenum target) {
+	if (unit.target == target)
+		return;
+
+	if (target == GL_TEXTURE_2D) {
+		glDisable(GL_TEXTURE_CUBE_MAP);
+		glEnable(GL_TEXTURE_2D);
+	} else if (target == GL_TEXTURE_CUBE_MAP) {
 		glDisable(GL_TEXTURE_2D);
 		glEnable(GL_TEXTURE_CUBE_MAP);
 	} else {
-		glBindTexture(GL_TEXTURE_2D, id);
-
+		glDisable(GL_TEXTURE_2D);
 		glDisable(GL_TEXTURE_CUBE_MAP);
-		glEnable(GL_TEXTURE_2D);
 	}
 
-	switch (mode) {
-		case kModeEnvironmentMapReflective:
-			if (handle._it->second->texture->getImage().isCubeMap()) {
-				glTexGeni(GL_S, GL_TEXTURE_GEN_MODE, GL_REFLECTION_MAP);
-				glTexGeni(GL_T, GL_TEXTURE_GEN_MODE, GL_REFLECTION_MAP);
-				glTexGeni(GL_R, GL_TEXTURE_GEN_MODE, GL_REFLECTION_MAP);
-
-				glEnable(GL_TEXTURE_GEN_S);
-				glEnable(GL_TEXTURE_GEN_T);
-				glEnable(GL_TEXTURE_GEN_R);
-			} else {
-				glTexGeni(GL_S, GL_TEXTURE_GEN_MODE, GL_SPHERE_MAP);
-				glTexGeni(GL_T, GL_TEXTURE_GEN_MODE, GL_SPHERE_MAP);
-
-				glEnable(GL_TEXTURE_GEN_S);
-				glEnable(GL_TEXTURE_GEN_T);
-			}
+	unit.target = target;
+}
+
+void TextureManager::setTexGen(UnitState &unit, int texGen) {
+	if (unit.texGen == texGen)
+		return;
+
+	switch (texGen) {
+		case kTexGenReflectionMap:
+			glTexGeni(GL_S, GL_TEXTURE_GEN_MODE, GL_REFLECTION_MAP);
+			glTexGeni(GL_T, GL_TEXTURE_GEN_MODE, GL_REFLECTION_MAP);
+			glTexGeni(GL_R, GL_TEXTURE_GEN_MODE, GL_REFLECTION_MAP);
 
+			glEnable(GL_TEXTURE_GEN_S);
+			glEnable(GL_TEXTURE_GEN_T);
+			glEnable(GL_TEXTURE_GEN_R);
+			break;
+
+		case kTexGenSphereMap:
+			glTexGeni(GL_S, GL_TEXTURE_GEN_MODE, GL_SPHERE_MAP);
+			glTexGeni(GL_T, GL_TEXTURE_GEN_MODE, GL_SPHERE_MAP);
+
+			glEnable(GL_TEXTURE_GEN_S);
+			glEnable(GL_TEXTURE_GEN_T);
+			glDisable(GL_TEXTURE_GEN_R);
 			break;
 
-		case kModeDiffuse:
 		default:
 			glDisable(GL_TEXTURE_GEN_S);
 			glDisable(GL_TEXTURE_GEN_T);
 			glDisable(GL_TEXTURE_GEN_R);
 			break;
 	}
+
+	unit.texGen = texGen;
 }
 
-void TextureManager::activeTexture(size_t n) {
-	if ((n >= GfxMan.getMultipleTextureCount()) || (n >= ARRAYSIZE(kTextureUnit)))
+size_t TextureManager::getStreamingBudget() const {
+	return _streamingBudget;
+}
+
+void TextureManager::setScreenSize(float screenSize) {
+	_screenSize = screenSize;
+}
+
+void TextureManager::request(const TextureHandle &handle) {
+	if (handle.empty())
 		return;
 
-	glActiveTextureARB(kTextureUnit[n]);
+	Texture &texture = *handle._entry->second->texture;
+	if (texture.isStreamed())
+		texture.requestMipMap(texture.getMipMapForScreenSize(_screenSize), _streamingFrame);
+}
+
+/** The mip map a streamed texture should have uploaded, going by its requests. */
+static size_t getStreamingTarget(const Texture &texture, uint32_t frame) {
+	if ((frame - texture.getRequestFrame()) > kStreamingIdleFrames)
+		return texture.getStreamingMipMap();
+
+	return texture.getWantedMipMap();
+}
+
+void TextureManager::getResidency(size_t &count, size_t &residentSize) {
+	std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+
+	count        = _textures.size();
+	residentSize = 0;
+
+	for (TextureMap::const_iterator t = _textures.begin(); t != _textures.end(); ++t)
+		residentSize += t->second->texture->getResidentSize();
+}
+
+void TextureManager::getMemoryUsage(Common::MemoryUsageList &cpu, Common::MemoryUsageList &gpu) {
+	std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+
+	for (TextureMap::const_iterator t = _textures.begin(); t != _textures.end(); ++t) {
+		const Texture &texture = *t->second->texture;
+
+		const size_t cpuSize = texture.getCPUSize();
+		const size_t gpuSize = texture.getResidentSize();
+
+		if (cpuSize > 0)
+			cpu.add(t->first.getString(), cpuSize);
+		if (gpuSize > 0)
+			gpu.add(t->first.getString(), gpuSize);
+	}
+}
+
+void TextureManager::updateStreaming() {
+	if (_streamingBudget == 0)
+		return;
+
+	std::shared_lock<std::shared_timed_mutex> lock(_mutex);
+
+	// The requests of the frame that was just drawn
+	const uint32_t frame = _streamingFrame++;
+
+	size_t resident = 0;
+	std::vector<Texture *> wanting, dropping;
+
+	for (TextureMap::iterator t = _textures.begin(); t != _textures.end(); ++t) {
+		Texture &texture = *t->second->texture;
+
+		resident += texture.getResidentSize();
+		if (!texture.isStreamed() || (texture.getID() == 0))
+			continue;
+
+		const size_t target = getStreamingTarget(texture, frame);
+		if      (target < texture.getResidentMipMap())
+			wanting.push_back(&texture);
+		else if (target > texture.getResidentMipMap())
+			dropping.push_back(&texture);
+	}
+
+	if (wanting.empty())
+		return;
+
+	// Serve the most recently drawn textures first, and drop the detail of the longest unused ones first
+	std::sort(wanting.begin(), wanting.end(), [](const Texture *a, const Texture *b) {
+		return a->getRequestFrame() > b->getRequestFrame();
+	});
+	std::sort(dropping.begin(), dropping.end(), [](const Texture *a, const Texture *b) {
+		return a->getRequestFrame() < b->getRequestFrame();
+	});
+
+	size_t uploaded = 0;
+	std::vector<Texture *>::iterator drop = dropping.begin();
+
+	for (std::vector<Texture *>::iterator t = wanting.begin(); t != wanting.end(); ++t) {
+		const size_t target = getStreamingTarget(**t, frame);
+		const size_t size   = (*t)->getMipMapsSize(target, (*t)->getResidentMipMap());
+
+		if ((uploaded > 0) && ((uploaded + size) > kStreamingUploadBudget))
+			break;
+
+		// Make room by dropping mip maps nobody needs at the moment
+		for (; ((resident + size) > _streamingBudget) && (drop != dropping.end()); ++drop) {
+			const size_t before = (*drop)->getResidentSize();
+
+			(*drop)->streamMipMaps(getStreamingTarget(**drop, frame));
+			resident -= before - (*drop)->getResidentSize();
+		}
+
+		if ((resident + size) > _streamingBudget)
+			break;
+
+		if (!(*t)->streamMipMaps(target))
+			continue;
+
+		resident += size;
+		uploaded += size;
+	}
+}
+
+bool TextureManager::getAtlasRegion(const TextureHandle &handle, TextureAtlas::Region &region) {
+	if (handle.empty())
+		return false;
+
+	std::lock_guard<std::mutex> lock(_atlasMutex);
+
+	if (!_atlas) {
+		_atlas = std::make_unique<TextureAtlas>();
+		_atlas->rebuild();
+	}
+
+	return _atlas->get(handle.getTexture(), region);
+}
+
+void TextureManager::removeFromAtlas(const Texture &texture) {
+	std::lock_guard<std::mutex> lock(_atlasMutex);
+
+	if (_atlas)
+		_atlas->remove(texture);
 }
 
 } // End of namespace Aurora
@@ -25,15 +25,20 @@
 #ifndef GRAPHICS_AURORA_TEXTUREMAN_H
 #define GRAPHICS_AURORA_TEXTUREMAN_H
 
-#include <set>
 #include <list>
+#include <vector>
+#include <memory>
 
 #include "src/common/types.h"
 #include "src/common/singleton.h"
 #include "src/common/ustring.h"
 #include "src/common/mutex.h"
+#include "src/common/memoryusage.h"
+
+#include "src/graphics/types.h"
 
 #include "src/graphics/aurora/texturehandle.h"
+#include "src/graphics/aurora/textureatlas.h"
 
 namespace Graphics {
 
@@ -100,22 +105,98 @@ public:
 
 	/** Set this texture unit as the current one. */
 	void activeTexture(size_t n);
+
+	/** Forget the cached texture state.
+	 *
+	 *  set() and activeTexture() skip GL calls that wouldn't change the
+	 *  current state. Code that binds or deletes textures, or switches the
+	 *  active texture unit, without going through the TextureManager needs
+	 *  to call this afterwards, on the render thread.
+	 */
+	void invalidateState();
+	// '---
+
+	// .--- Texture streaming
+	/** Return the GPU memory budget for textures, in bytes. 0 means textures aren't streamed. */
+	size_t getStreamingBudget() const;
+
+	/** Set the size, in pixels, of the object whose textures are set next. 0 means unknown. */
+	void setScreenSize(float screenSize);
+	/** Note that this texture is drawn in this frame, at the current screen size. */
+	void request(const TextureHandle &handle);
+
+	/** Upload and drop streamed mip maps, according to what was drawn in the last frame. */
+	void updateStreaming();
+
+	/** Return the number of managed textures, and the GPU memory they take up in bytes. */
+	void getResidency(size_t &count, size_t &residentSize);
+
+	/** Collect how much system and GPU memory each managed texture takes up. */
+	void getMemoryUsage(Common::MemoryUsageList &cpu, Common::MemoryUsageList &gpu);
+	// '---
+
+	// .--- Texture atlas
+	/** Find where this texture lies in the GUI texture atlas, packing it in if possible. */
+	bool getAtlasRegion(const TextureHandle &handle, TextureAtlas::Region &region);
+	/** Drop this texture from the GUI texture atlas, because it changed or is going away. */
+	void removeFromAtlas(const Texture &texture);
 	// '---
 
 private:
+	typedef Common::IStringKeySet NameSet;
+
 	bool _deswizzleSBM;
 	TextureMap _textures;
 
-	std::set<Common::UString> _bogusTextures;
+	NameSet _bogusTextures;
+
+	NameSet  _missingTextures;   ///< Textures that failed to load.
+	uint32_t _missingGeneration; ///< The resource generation _missingTextures is valid for.
 
-	std::recursive_mutex _mutex;
+	/** Guards the texture registry. Lookups only need a shared lock. */
+	std::shared_timed_mutex _mutex;
 
+	std::mutex _recordMutex;
 	bool _recordNewTextures;
 	std::list<Common::UString> _newTextureNames;
 
+	size_t   _streamingBudget; ///< GPU memory budget for textures, in bytes.
+	uint32_t _streamingFrame;  ///< The current frame, for mip map requests.
+	float    _screenSize;      ///< The screen size of the object currently drawn.
+
+	/** The cached state of a texture unit. */
+	struct UnitState {
+		TextureID texture2D;   ///< The texture bound to GL_TEXTURE_2D.
+		TextureID textureCube; ///< The texture bound to GL_TEXTURE_CUBE_MAP.
+		GLenum    target;      ///< The texture target enabled, 0 for none.
+		int       texGen;      ///< The texture coordinate generation in use.
+	};
+
+	size_t _activeUnit;             ///< The active texture unit.
+	std::vector<UnitState> _units;  ///< The cached state of all texture units.
+	UnitState _unknownUnit;         ///< Stand-in state while the active texture unit is unknown.
+
+	/** Guards the atlas, independently of the registry. */
+	std::mutex _atlasMutex;
+	std::unique_ptr<TextureAtlas> _atlas;
+
 	void assign(TextureHandle &texture, const TextureHandle &from);
 	void release(TextureHandle &texture);
 
+	void recordNewTexture(const Common::UString &name);
+
+	/** Return the cached state of the active texture unit. */
+	UnitState &getUnitState();
+
+	void bindTexture(UnitState &unit, GLenum target, TextureID texture);
+	void enableTarget(UnitState &unit, GLenum target);
+	void setTexGen(UnitState &unit, int texGen);
+
+	/** Did this texture fail to load with the current resources? Needs the lock held. */
+	bool isMissing(const Common::IStringKey &name) const;
+	/** Remember that this texture failed to load with the resources of that generation. */
+	void addMissing(const Common::IStringKey &name, uint32_t generation);
+
 	friend class TextureHandle;
 };
 
@@ -23,6 +23,7 @@
  */
 
 #include <cassert>
+#include <algorithm>
 
 #include "src/common/util.h"
 #include "src/common/error.h"
@@ -93,27 +94,29 @@ void TTFFont::load(Common::SeekableReadStream *ttf, int height) {
 	if (_height > kPageHeight)
 		throw Common::Exception("Font height too big (%d)", _height);
 
+	std::fill(_flatChars, _flatChars + kFlatCharCount, static_cast<const Char *>(0));
+
 	// Add all ASCII characters
 	for (uint32_t i = 0; i < 128; i++)
 		addChar(i);
 
 	// Add the Unicode "replacement character" character
 	addChar(0xFFFD);
-	_missingChar = _chars.find(0xFFFD);
+	_missingChar = findChar(0xFFFD);
 
 	// Find an appropriate width for a "missing character" character
-	if (_missingChar == _chars.end()) {
+	if (!_missingChar) {
 		// This font doesn't have the Unicode "replacement character"
 
 		// Try to find the width of an m. Alternatively, take half of a line's height.
-		std::map<uint32_t, Char>::const_iterator m = _chars.find('m');
-		if (m != _chars.end())
-			_missingWidth = m->second.width;
+		const Char *m = findChar('m');
+		if (m)
+			_missingWidth = m->width;
 		else
 			_missingWidth = MAX<float>(2.0f, _height / 2);
 
 	} else
-		_missingWidth = _missingChar->second.width;
+		_missingWidth = _missingChar->width;
 
 	rebuildPages();
 
@@ -129,11 +132,11 @@ void TTFFont::load(Common::SeekableReadStream *ttf, int height) {
 }
 
 float TTFFont::getWidth(uint32_t c) const {
-	std::map<uint32_t, Char>::const_iterator cC = _chars.find(c);
-	if (cC == _chars.end())
+	const Char *cC = findChar(c);
+	if (!cC)
 		return _missingWidth;
 
-	return cC->second.width;
+	return cC->width;
 }
 
 float TTFFont::getHeight() const {
@@ -156,29 +159,29 @@ void TTFFont::drawMissing() const {
 }
 
 void TTFFont::draw(uint32_t c) const {
-	std::map<uint32_t, Char>::const_iterator cC = _chars.find(c);
-	if (cC == _chars.end()) {
+	const Char *cC = findChar(c);
+	if (!cC) {
 		cC = _missingChar;
 
-		if (cC == _chars.end()) {
+		if (!cC) {
 			drawMissing();
 			return;
 		}
 	}
 
-	size_t page = cC->second.page;
+	size_t page = cC->page;
 	assert(page < _pages.size());
 
 	TextureMan.set(_pages[page]->texture);
 
 	glBegin(GL_QUADS);
 	for (int i = 0; i < 4; i++) {
-		glTexCoord2f(cC->second.tX[i], cC->second.tY[i]);
-		glVertex2f  (cC->second.vX[i], cC->second.vY[i]);
+		glTexCoord2f(cC->tX[i], cC->tY[i]);
+		glVertex2f  (cC->vX[i], cC->vY[i]);
 	}
 	glEnd();
 
-	glTranslatef(cC->second.width, 0.0f, 0.0f);
+	glTranslatef(cC->width, 0.0f, 0.0f);
 }
 
 void TTFFont::buildChars(const Common::UString &str) {
@@ -205,9 +208,9 @@ void TTFFont::renderBind(const glm::mat4 &transform) const {
 }
 
 void TTFFont::render(uint32_t c, float &x, float &y, float *rgba) const {
-	std::map<uint32_t, Char>::const_iterator cC = _chars.find(c);
+	const Char *cC = findChar(c);
 
-	if (cC == _chars.end()) {
+	if (!cC) {
 		// Nothing is rendered for missing characters. Maybe one day use a placeholder instead.
 		x += _missingWidth - 1.0f;
 		return;
@@ -218,7 +221,7 @@ void TTFFont::render(uint32_t c, float &x, float &y, float *rgba) const {
 	float v_uv[8];
 	float v_rgba[4*4];
 
-	size_t page = cC->second.page;
+	size_t page = cC->page;
 	assert(page < _pages.size());
 
 	/* The assumption here is that the material will have been bound, and either only
@@ -233,10 +236,10 @@ void TTFFont::render(uint32_t c, float &x, float &y, float *rgba) const {
 	TextureMan.set(_pages[page]->texture);
 
 	for (int i = 0; i < 4; ++i) {
-		v_uv[i*2] = cC->second.tX[i];
-		v_uv[i*2 +1] = cC->second.tY[i];
-		v_pos[i*3] = x + cC->second.vX[i];
-		v_pos[i*3 +1] = y + cC->second.vY[i];
+		v_uv[i*2] = cC->tX[i];
+		v_uv[i*2 +1] = cC->tY[i];
+		v_pos[i*3] = x + cC->vX[i];
+		v_pos[i*3 +1] = y + cC->vY[i];
 		v_pos[i*3 +2] = 0.0f;
 		v_rgba[i*4] = rgba[0];
 		v_rgba[i*4 +1] = rgba[1];
@@ -244,7 +247,7 @@ void TTFFont::render(uint32_t c, float &x, float &y, float *rgba) const {
 		v_rgba[i*4 +3] = rgba[3];
 	}
 	_mesh->render(v_pos, v_uv, v_rgba);
-	x += cC->second.width;
+	x += cC->width;
 }
 
 void TTFFont::renderUnbind() const {
@@ -255,11 +258,59 @@ void TTFFont::renderUnbind() const {
 	glUseProgram(0);
 }
 
+bool TTFFont::getQuad(uint32_t c, Quad &quad) const {
+	const Char *cC = findChar(c);
+	if (!cC)
+		cC = _missingChar;
+
+	if (!cC) {
+		quad.advance = _missingWidth;
+		quad.page    = 0;
+		quad.empty   = true;
+		return true;
+	}
+
+	assert(cC->page < _pages.size());
+
+	for (int i = 0; i < 4; i++) {
+		quad.tX[i] = cC->tX[i];
+		quad.tY[i] = cC->tY[i];
+		quad.vX[i] = cC->vX[i];
+		quad.vY[i] = cC->vY[i];
+	}
+
+	quad.advance = cC->width;
+	quad.page    = cC->page;
+	quad.empty   = false;
+	return true;
+}
+
+void TTFFont::bindPage(size_t page) const {
+	assert(page < _pages.size());
+
+	TextureMan.set(_pages[page]->texture);
+}
+
+void TTFFont::renderQuads(const float *vertices, uint32_t count) const {
+	_mesh->renderQuads(vertices, count);
+}
+
 void TTFFont::rebuildPages() {
 	for (auto &page : _pages)
 		page->rebuild();
 }
 
+const TTFFont::Char *TTFFont::findChar(uint32_t c) const {
+	if (c < kFlatCharCount)
+		return _flatChars[c];
+
+	std::map<uint32_t, Char>::const_iterator cC = _chars.find(c);
+	if (cC == _chars.end())
+		return 0;
+
+	return &cC->second;
+}
+
 void TTFFont::addChar(uint32_t c) {
 	std::map<uint32_t, Char>::iterator cC = _chars.find(c);
 	if (cC != _chars.end())
@@ -333,6 +384,9 @@ void TTFFont::addChar(uint32_t c) {
 		_pages.back()->curX       += cWidth;
 		_pages.back()->needRebuild = true;
 
+		if (c < kFlatCharCount)
+			_flatChars[c] = &ch;
+
 	} catch (...) {
 		if (cC != _chars.end())
 			_chars.erase(cC);
@@ -72,7 +72,14 @@ public:
 	virtual void render(uint32_t c, float &x, float &y, float *rgba) const;
 	virtual void renderUnbind() const;
 
+	bool getQuad(uint32_t c, Quad &quad) const;
+	void bindPage(size_t page) const;
+	void renderQuads(const float *vertices, uint32_t count) const;
+
 private:
+	/** Characters below this codepoint (Basic Latin to Latin Extended-B) are looked up directly. */
+	static const uint32_t kFlatCharCount = 0x0250;
+
 	/** A texture page filled with characters. */
 	struct Page {
 		Surface *surface;
@@ -106,8 +113,9 @@ private:
 
 	std::vector<std::unique_ptr<Page>> _pages;
 	std::map<uint32_t, Char> _chars;
+	const Char *_flatChars[kFlatCharCount]; ///< Direct pointers into _chars for the common characters.
 
-	std::map<uint32_t, Char>::const_iterator _missingChar;
+	const Char *_missingChar;
 	float _missingWidth;
 
 	uint32_t _height;
@@ -122,6 +130,9 @@ private:
 	void rebuildPages();
 	void addChar(uint32_t c);
 	void drawMissing() const;
+
+	/** Find a character, returning 0 if the font doesn't have it. */
+	const Char *findChar(uint32_t c) const;
 };
 
 } // End of namespace Aurora
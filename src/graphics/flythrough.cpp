@@ -0,0 +1,398 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Recording and replaying camera flythroughs, for render performance measurements.
+ */
+
+#include <cstdio>
+#include <algorithm>
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/strutil.h"
+#include "src/common/encoding.h"
+#include "src/common/readfile.h"
+#include "src/common/writefile.h"
+
+#include "src/graphics/flythrough.h"
+#include "src/graphics/graphics.h"
+#include "src/graphics/camera.h"
+
+namespace Graphics {
+
+/** Sample the camera every this many milliseconds while recording. */
+static const uint32_t kSampleInterval = 16;
+/** The number of timer queries in flight at the same time. */
+static const size_t kTimerQueryCount = 4;
+
+static const char * const kPathHeader = "XOREOS FLYTHROUGH V1";
+
+/** A summary of one measurement over all frames. */
+struct Summary {
+	double mean;
+	uint64_t p50, p90, p99, max;
+};
+
+/** Return the value below which the given percentage of the sorted values lie. */
+static uint64_t getPercentile(const std::vector<uint64_t> &sorted, uint32_t percent) {
+	if (sorted.empty())
+		return 0;
+
+	// Nearest rank
+	const size_t rank = (sorted.size() * percent + 99) / 100;
+
+	return sorted[MAX<size_t>(rank, 1) - 1];
+}
+
+static Summary summarize(std::vector<uint64_t> values) {
+	Summary summary = { 0.0, 0, 0, 0, 0 };
+	if (values.empty())
+		return summary;
+
+	std::sort(values.begin(), values.end());
+
+	uint64_t total = 0;
+	for (std::vector<uint64_t>::const_iterator v = values.begin(); v != values.end(); ++v)
+		total += *v;
+
+	summary.mean = (double)total / values.size();
+	summary.p50  = getPercentile(values, 50);
+	summary.p90  = getPercentile(values, 90);
+	summary.p99  = getPercentile(values, 99);
+	summary.max  = values.back();
+
+	return summary;
+}
+
+static void writeSummary(Common::WriteFile &file, const char *name, const Summary &summary, bool last) {
+	file.writeString(Common::UString::format("    \"%s\": {\"mean\": %.1f, \"p50\": %s, \"p90\": %s, "
+	                                         "\"p99\": %s, \"max\": %s}%s\n", name, summary.mean,
+	                                         Common::composeString(summary.p50).c_str(),
+	                                         Common::composeString(summary.p90).c_str(),
+	                                         Common::composeString(summary.p99).c_str(),
+	                                         Common::composeString(summary.max).c_str(),
+	                                         last ? "" : ","));
+}
+
+
+Flythrough::Flythrough() : _state(kStateIdle), _timestep(kSampleInterval, 1000), _nextPose(0),
+	_inFrame(false), _hasTimerQueries(false), _nextQuery(0) {
+
+}
+
+Flythrough::~Flythrough() {
+	destroy();
+}
+
+bool Flythrough::isRecording() const {
+	return _state == kStateRecording;
+}
+
+bool Flythrough::isReplaying() const {
+	return _state == kStateReplaying;
+}
+
+void Flythrough::startRecording() {
+	if (_state == kStateReplaying)
+		stopReplay();
+
+	_state = kStateRecording;
+
+	_path.clear();
+	_timestep.reset();
+
+	// Always start with the current camera
+	Pose pose;
+	std::copy(CameraMan.getPosition()   , CameraMan.getPosition()    + 3, pose.position);
+	std::copy(CameraMan.getOrientation(), CameraMan.getOrientation() + 3, pose.orientation);
+	_path.push_back(pose);
+}
+
+void Flythrough::stopRecording(const Common::UString &pathFile) {
+	if (_state != kStateRecording)
+		throw Common::Exception("Not recording a flythrough");
+
+	_state = kStateIdle;
+
+	writePath(pathFile);
+}
+
+void Flythrough::startReplay(const Common::UString &pathFile, const Common::UString &reportFile) {
+	if (_state == kStateRecording)
+		throw Common::Exception("Still recording a flythrough");
+
+	stopReplay();
+
+	readPath(pathFile);
+
+	_pathFile   = pathFile;
+	_reportFile = reportFile;
+
+	_frames.clear();
+	_frames.reserve(_path.size());
+
+	_nextPose = 0;
+	_state    = kStateReplaying;
+
+	// Animations don't follow the frames, so they'd make every replay different
+	GfxMan.pauseAnimations();
+}
+
+void Flythrough::stopReplay() {
+	if (_state != kStateReplaying)
+		return;
+
+	if (_inFrame && _hasTimerQueries)
+		glEndQuery(GL_TIME_ELAPSED);
+
+	for (std::vector<TimerQuery>::iterator q = _queries.begin(); q != _queries.end(); ++q)
+		collect(*q, true);
+
+	_inFrame = false;
+	_state   = kStateIdle;
+
+	GfxMan.resumeAnimations();
+}
+
+void Flythrough::beginFrame() {
+	if (_state == kStateRecording) {
+		const size_t ticks = _timestep.advance();
+
+		Pose pose;
+		std::copy(CameraMan.getPosition()   , CameraMan.getPosition()    + 3, pose.position);
+		std::copy(CameraMan.getOrientation(), CameraMan.getOrientation() + 3, pose.orientation);
+
+		_path.insert(_path.end(), ticks, pose);
+		return;
+	}
+
+	if ((_state != kStateReplaying) || (_nextPose >= _path.size()))
+		return;
+
+	const Pose &pose = _path[_nextPose++];
+
+	CameraMan.setPosition   (pose.position   [0], pose.position   [1], pose.position   [2]);
+	CameraMan.setOrientation(pose.orientation[0], pose.orientation[1], pose.orientation[2]);
+	CameraMan.update();
+
+	if (_hasTimerQueries) {
+		for (std::vector<TimerQuery>::iterator q = _queries.begin(); q != _queries.end(); ++q)
+			collect(*q, false);
+
+		// Only wait for the GPU if it's more than kTimerQueryCount frames behind
+		TimerQuery &query = _queries[_nextQuery];
+		_nextQuery = (_nextQuery + 1) % _queries.size();
+
+		collect(query, true);
+
+		query.frame   = _frames.size();
+		query.pending = true;
+
+		glBeginQuery(GL_TIME_ELAPSED, query.query);
+	}
+
+	_frameStart = Clock::now();
+	_inFrame    = true;
+}
+
+void Flythrough::endFrame(uint32_t drawCalls, uint32_t triangles) {
+	if ((_state != kStateReplaying) || !_inFrame)
+		return;
+
+	Frame frame;
+
+	frame.cpuTime    = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - _frameStart).count();
+	frame.gpuTime    = 0;
+	frame.drawCalls  = drawCalls;
+	frame.triangles  = triangles;
+	frame.hasGPUTime = false;
+
+	_frames.push_back(frame);
+
+	if (_hasTimerQueries)
+		glEndQuery(GL_TIME_ELAPSED);
+
+	_inFrame = false;
+
+	if (_nextPose >= _path.size())
+		finishReplay();
+}
+
+void Flythrough::collect(TimerQuery &query, bool wait) {
+	if (!query.pending)
+		return;
+
+	if (!wait) {
+		GLuint available = 0;
+		glGetQueryObjectuiv(query.query, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			return;
+	}
+
+	GLuint64 time = 0;
+	glGetQueryObjectui64v(query.query, GL_QUERY_RESULT, &time);
+
+	query.pending = false;
+
+	if (query.frame >= _frames.size())
+		return;
+
+	_frames[query.frame].gpuTime    = time / 1000;
+	_frames[query.frame].hasGPUTime = true;
+}
+
+void Flythrough::finishReplay() {
+	stopReplay();
+
+	try {
+		writeReport(_reportFile);
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed to write the flythrough report \"%s\"", _reportFile.c_str());
+	}
+}
+
+void Flythrough::readPath(const Common::UString &pathFile) {
+	Common::ReadFile file;
+	if (!file.open(pathFile))
+		throw Common::Exception(Common::kOpenError);
+
+	if (Common::readStringLine(file, Common::kEncodingASCII) != kPathHeader)
+		throw Common::Exception("\"%s\" is not a flythrough path", pathFile.c_str());
+
+	std::vector<Pose> path;
+	while (!file.eos()) {
+		const Common::UString line = Common::readStringLine(file, Common::kEncodingASCII);
+		if (line.empty())
+			continue;
+
+		Pose pose;
+		if (std::sscanf(line.c_str(), "%f %f %f %f %f %f",
+		                &pose.position   [0], &pose.position   [1], &pose.position   [2],
+		                &pose.orientation[0], &pose.orientation[1], &pose.orientation[2]) != 6)
+			throw Common::Exception("Broken flythrough pose \"%s\"", line.c_str());
+
+		path.push_back(pose);
+	}
+
+	if (path.empty())
+		throw Common::Exception("Flythrough path \"%s\" is empty", pathFile.c_str());
+
+	_path.swap(path);
+}
+
+void Flythrough::writePath(const Common::UString &pathFile) const {
+	Common::WriteFile file;
+	if (!file.open(pathFile))
+		throw Common::Exception(Common::kOpenError);
+
+	file.writeString(kPathHeader);
+	file.writeString("\n");
+
+	for (std::vector<Pose>::const_iterator p = _path.begin(); p != _path.end(); ++p)
+		file.writeString(Common::UString::format("%.6f %.6f %.6f %.6f %.6f %.6f\n",
+		                 p->position   [0], p->position   [1], p->position   [2],
+		                 p->orientation[0], p->orientation[1], p->orientation[2]));
+
+	file.flush();
+	file.close();
+}
+
+void Flythrough::writeReport(const Common::UString &reportFile) const {
+	std::vector<uint64_t> cpuTimes, gpuTimes, drawCalls, triangles;
+
+	for (std::vector<Frame>::const_iterator f = _frames.begin(); f != _frames.end(); ++f) {
+		cpuTimes.push_back(f->cpuTime);
+		drawCalls.push_back(f->drawCalls);
+		triangles.push_back(f->triangles);
+
+		if (f->hasGPUTime)
+			gpuTimes.push_back(f->gpuTime);
+	}
+
+	const Summary cpuSummary      = summarize(cpuTimes);
+	const Summary gpuSummary      = summarize(gpuTimes);
+	const Summary drawCallSummary = summarize(drawCalls);
+	const Summary triangleSummary = summarize(triangles);
+
+	Common::WriteFile file;
+	if (!file.open(reportFile))
+		throw Common::Exception(Common::kOpenError);
+
+	file.writeString("{\n");
+	file.writeString(Common::UString::format("  \"frames\": %s,\n", Common::composeString(_frames.size()).c_str()));
+	file.writeString(Common::UString::format("  \"gpu_timing\": %s,\n", _hasTimerQueries ? "true" : "false"));
+
+	file.writeString("  \"summary\": {\n");
+	writeSummary(file, "cpu_us"    , cpuSummary     , false);
+	writeSummary(file, "gpu_us"    , gpuSummary     , false);
+	writeSummary(file, "draw_calls", drawCallSummary, false);
+	writeSummary(file, "triangles" , triangleSummary, true);
+	file.writeString("  },\n");
+
+	file.writeString("  \"per_frame\": [\n");
+	for (size_t i = 0; i < _frames.size(); i++) {
+		const Frame &f = _frames[i];
+
+		file.writeString(Common::UString::format("    {\"cpu_us\": %s, \"gpu_us\": %s, \"draw_calls\": %u, \"triangles\": %u}%s\n",
+		                 Common::composeString(f.cpuTime).c_str(),
+		                 f.hasGPUTime ? Common::composeString(f.gpuTime).c_str() : "null",
+		                 (uint)f.drawCalls, (uint)f.triangles, ((i + 1) < _frames.size()) ? "," : ""));
+	}
+	file.writeString("  ]\n");
+	file.writeString("}\n");
+
+	file.flush();
+	file.close();
+
+	status("Flythrough of %u frames: CPU p50 %s us, p99 %s us; GPU p50 %s us, p99 %s us; "
+	       "%.0f draw calls and %.0f triangles per frame",
+	       (uint)_frames.size(),
+	       Common::composeString(cpuSummary.p50).c_str(), Common::composeString(cpuSummary.p99).c_str(),
+	       Common::composeString(gpuSummary.p50).c_str(), Common::composeString(gpuSummary.p99).c_str(),
+	       drawCallSummary.mean, triangleSummary.mean);
+}
+
+void Flythrough::doRebuild() {
+	// Timer queries are core since OpenGL 3.3
+	_hasTimerQueries = GLEW_VERSION_3_3 || GLEW_ARB_timer_query;
+	if (!_hasTimerQueries)
+		return;
+
+	_queries.resize(kTimerQueryCount);
+	_nextQuery = 0;
+
+	for (std::vector<TimerQuery>::iterator q = _queries.begin(); q != _queries.end(); ++q) {
+		glGenQueries(1, &q->query);
+
+		q->frame   = 0;
+		q->pending = false;
+	}
+}
+
+void Flythrough::doDestroy() {
+	for (std::vector<TimerQuery>::iterator q = _queries.begin(); q != _queries.end(); ++q)
+		glDeleteQueries(1, &q->query);
+
+	_queries.clear();
+	_hasTimerQueries = false;
+}
+
+} // End of namespace Graphics
@@ -0,0 +1,151 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Recording and replaying camera flythroughs, for render performance measurements.
+ */
+
+#ifndef GRAPHICS_FLYTHROUGH_H
+#define GRAPHICS_FLYTHROUGH_H
+
+#include <vector>
+#include <chrono>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+#include "src/common/fixedtimestep.h"
+
+#include "src/graphics/types.h"
+#include "src/graphics/glcontainer.h"
+
+namespace Graphics {
+
+/** Records a camera path and replays it while measuring each rendered frame.
+ *
+ *  While recording, the camera position and orientation are sampled with a
+ *  fixed timestep, independent of the frame rate. While replaying, exactly
+ *  one sample is applied per rendered frame and animations are paused, so
+ *  that every replay of the same path renders the same frames.
+ *
+ *  For every replayed frame, the CPU time spent rendering (excluding the
+ *  buffer swap), the GPU time (if timer queries are supported), the number
+ *  of draw calls and the number of triangles are measured. Once the path
+ *  has been replayed, a JSON report with all frames and a percentile
+ *  summary is written.
+ *
+ *  All methods have to be called from the main thread, or with the frame
+ *  locked.
+ */
+class Flythrough : public GLContainer {
+public:
+	Flythrough();
+	~Flythrough();
+
+	bool isRecording() const;
+	bool isReplaying() const;
+
+	/** Start sampling the camera. */
+	void startRecording();
+	/** Stop sampling the camera and write the recorded path into a file. */
+	void stopRecording(const Common::UString &pathFile);
+
+	/** Read a path from a file and start replaying it.
+	 *
+	 *  Once the path is finished, the report is written into reportFile.
+	 */
+	void startReplay(const Common::UString &pathFile, const Common::UString &reportFile);
+	/** Stop replaying, without writing a report. */
+	void stopReplay();
+
+	/** A new frame is about to be rendered. Called before the object distances are updated. */
+	void beginFrame();
+	/** The frame has been rendered. Called before the buffers are swapped. */
+	void endFrame(uint32_t drawCalls, uint32_t triangles);
+
+protected:
+	void doRebuild();
+	void doDestroy();
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	/** The camera at one point in the path. */
+	struct Pose {
+		float position[3];
+		float orientation[3];
+	};
+
+	/** The measurements of one replayed frame. */
+	struct Frame {
+		uint64_t cpuTime; ///< CPU time spent rendering, in microseconds.
+		uint64_t gpuTime; ///< GPU time spent rendering, in microseconds.
+		uint32_t drawCalls;
+		uint32_t triangles;
+
+		bool hasGPUTime; ///< Has the GPU time been collected?
+	};
+
+	/** A timer query, and the frame it measures. */
+	struct TimerQuery {
+		GLuint query;
+		size_t frame;
+		bool pending;
+	};
+
+	enum State {
+		kStateIdle,
+		kStateRecording,
+		kStateReplaying
+	};
+
+	State _state;
+
+	Common::FixedTimestep _timestep; ///< Sampling the camera while recording.
+
+	std::vector<Pose> _path; ///< The recorded or replayed path.
+	size_t _nextPose;        ///< The pose to apply in the next replayed frame.
+
+	std::vector<Frame> _frames; ///< All measured frames of the current replay.
+
+	Common::UString _pathFile;
+	Common::UString _reportFile;
+
+	Clock::time_point _frameStart; ///< When rendering the current frame started.
+	bool _inFrame;                 ///< Are we measuring a frame right now?
+
+	bool _hasTimerQueries; ///< Does the GL support timer queries?
+
+	/** Timer queries, reused round-robin, so that we never have to wait on the GPU. */
+	std::vector<TimerQuery> _queries;
+	size_t _nextQuery;
+
+	/** Collect the result of a finished timer query, optionally waiting for it. */
+	void collect(TimerQuery &query, bool wait);
+
+	void finishReplay();
+
+	void readPath(const Common::UString &pathFile);
+	void writePath(const Common::UString &pathFile) const;
+	void writeReport(const Common::UString &reportFile) const;
+};
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_FLYTHROUGH_H
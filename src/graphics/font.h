@@ -38,6 +38,16 @@ namespace Graphics {
 /** An abstract font. */
 class Font {
 public:
+	/** The textured quad of a single character, for drawing many characters at once. */
+	struct Quad {
+		float tX[4], tY[4]; ///< Texture coordinates.
+		float vX[4], vY[4]; ///< Vertex coordinates, relative to the current pen position.
+
+		float  advance; ///< How far to move the pen after this character.
+		size_t page;    ///< The texture page the character is found on.
+		bool   empty;   ///< Is there nothing to draw, only the pen to move?
+	};
+
 	Font();
 	virtual ~Font();
 
@@ -69,6 +79,17 @@ public:
 	virtual void render(uint32_t UNUSED(c), float &UNUSED(x), float &UNUSED(y), float *UNUSED(rgba)) const {}
 	virtual void renderUnbind() const {}
 
+	/** Get the quad of a character. Returns false if this font can't draw batched quads. */
+	virtual bool getQuad(uint32_t c, Quad &quad) const;
+	/** Bind the texture of a page, so that the quads found on it can be drawn. */
+	virtual void bindPage(size_t UNUSED(page)) const {}
+	/** Draw a batch of quads, between renderBind() and renderUnbind().
+	 *
+	 *  Each of the count vertices is { x, y, z, u, v, r, g, b, a }, and
+	 *  each four consecutive vertices make up a quad.
+	 */
+	virtual void renderQuads(const float *UNUSED(vertices), uint32_t UNUSED(count)) const {}
+
 	float split(const Common::UString &line, std::vector<Common::UString> &lines,
 	            float maxWidth = 0.0f, float maxHeight = 0.0f, bool trim = true) const;
 	float split(Common::UString &line, float maxWidth, float maxHeight = 0.0f, bool trim = true) const;
@@ -50,6 +50,10 @@ void GLContainer::rebuild() {
 	_built = true;
 }
 
+size_t GLContainer::getUploadSize() const {
+	return 0;
+}
+
 void GLContainer::destroy() {
 	if (!_built)
 		return;
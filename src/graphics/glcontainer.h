@@ -25,6 +25,8 @@
 #ifndef GRAPHICS_GLCONTAINER_H
 #define GRAPHICS_GLCONTAINER_H
 
+#include <cstddef>
+
 #include <boost/noncopyable.hpp>
 
 #include "src/graphics/queueable.h"
@@ -40,6 +42,13 @@ public:
 	void rebuild();
 	void destroy();
 
+	/** Return the number of bytes rebuilding uploads to the GPU.
+	 *
+	 *  Used to spread the building of new containers over several
+	 *  frames. Containers returning 0 are always built right away.
+	 */
+	virtual size_t getUploadSize() const;
+
 protected:
 	virtual void doRebuild() = 0;
 	virtual void doDestroy() = 0;
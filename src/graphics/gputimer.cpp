@@ -0,0 +1,194 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Measuring the GPU time of the render passes.
+ */
+
+#include <cassert>
+#include <cstring>
+
+#include "src/common/util.h"
+#include "src/common/profiler.h"
+
+#include "src/graphics/gputimer.h"
+
+namespace Graphics {
+
+static const char * const kStageNames[kGPUStageMAX] = {
+	"GPU::frame",
+	"GPU::beginScene",
+	"GPU::video",
+	"GPU::guiBack",
+	"GPU::world",
+	"GPU::worldOpaque",
+	"GPU::worldTransparent",
+	"GPU::guiFront",
+	"GPU::console",
+	"GPU::imgui",
+	"GPU::cursor",
+	"GPU::endScene"
+};
+
+const size_t GPUTimer::kFrameCount;
+
+GPUTimer::GPUTimer() : _supported(false), _currentFrame(0), _frame(0) {
+	std::memset(_frames, 0, sizeof(_frames));
+	std::memset(_times , 0, sizeof(_times));
+}
+
+GPUTimer::~GPUTimer() {
+	destroy();
+}
+
+const char *GPUTimer::getStageName(GPUStage stage) {
+	assert((stage >= 0) && (stage < kGPUStageMAX));
+
+	return kStageNames[stage];
+}
+
+void GPUTimer::beginFrame() {
+	_frame = 0;
+
+	if (!_supported)
+		return;
+
+	for (size_t i = 0; i < kFrameCount; i++)
+		collect(_frames[i]);
+
+	Frame &frame = _frames[_currentFrame];
+	if (frame.pending)
+		return; // The GPU is too far behind, skip measuring this frame
+
+	_currentFrame = (_currentFrame + 1) % kFrameCount;
+
+	_frame = &frame;
+
+	std::memset(frame.issued, 0, sizeof(frame.issued));
+
+	frame.cpuBase = Common::Profiler::getTime();
+	glGetInteger64v(GL_TIMESTAMP, &frame.gpuBase);
+}
+
+void GPUTimer::begin(GPUStage stage) {
+	if (!_frame)
+		return;
+
+	assert((stage >= 0) && (stage < kGPUStageMAX));
+
+	glQueryCounter(_frame->queries[2 * stage + 0], GL_TIMESTAMP);
+}
+
+void GPUTimer::end(GPUStage stage) {
+	if (!_frame)
+		return;
+
+	assert((stage >= 0) && (stage < kGPUStageMAX));
+
+	glQueryCounter(_frame->queries[2 * stage + 1], GL_TIMESTAMP);
+
+	_frame->issued[stage] = true;
+
+	// The whole frame is always the last stage to end
+	if (stage == kGPUStageFrame) {
+		_frame->pending = true;
+		_frame = 0;
+	}
+}
+
+float GPUTimer::getTime(GPUStage stage) const {
+	assert((stage >= 0) && (stage < kGPUStageMAX));
+
+	return _times[stage];
+}
+
+bool GPUTimer::collect(Frame &frame) {
+	if (!frame.pending)
+		return false;
+
+	// Queries finish in order, so once the last one is available, all of them are
+	GLuint available = 0;
+	glGetQueryObjectuiv(frame.queries[2 * kGPUStageFrame + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+	if (!available)
+		return false;
+
+	frame.pending = false;
+
+	const bool profile = ProfilerMan.isEnabled();
+
+	for (size_t i = 0; i < kGPUStageMAX; i++) {
+		_times[i] = 0.0f;
+
+		if (!frame.issued[i])
+			continue;
+
+		GLuint64 start = 0, end = 0;
+		glGetQueryObjectui64v(frame.queries[2 * i + 0], GL_QUERY_RESULT, &start);
+		glGetQueryObjectui64v(frame.queries[2 * i + 1], GL_QUERY_RESULT, &end);
+
+		if (end < start)
+			continue;
+
+		_times[i] = (end - start) / 1000000.0f;
+
+		if (!profile)
+			continue;
+
+		// Line the GPU times up with the CPU times of the same frame
+		const int64_t  offset = ((int64_t) start - frame.gpuBase) / 1000;
+		const uint64_t zoneStart = frame.cpuBase + MAX<int64_t>(offset, 0);
+
+		ProfilerMan.addTrackZone("GPU", kStageNames[i], zoneStart, zoneStart + (end - start) / 1000);
+	}
+
+	return true;
+}
+
+void GPUTimer::doRebuild() {
+	// Timestamp queries are core since OpenGL 3.3
+	_supported = GLEW_VERSION_3_3 || GLEW_ARB_timer_query;
+	if (!_supported)
+		return;
+
+	for (size_t i = 0; i < kFrameCount; i++) {
+		glGenQueries(ARRAYSIZE(_frames[i].queries), _frames[i].queries);
+
+		_frames[i].pending = false;
+	}
+
+	_currentFrame = 0;
+	_frame        = 0;
+}
+
+void GPUTimer::doDestroy() {
+	if (!_supported)
+		return;
+
+	for (size_t i = 0; i < kFrameCount; i++) {
+		glDeleteQueries(ARRAYSIZE(_frames[i].queries), _frames[i].queries);
+
+		_frames[i].pending = false;
+	}
+
+	_supported = false;
+	_frame     = 0;
+}
+
+} // End of namespace Graphics
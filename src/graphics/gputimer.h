@@ -0,0 +1,101 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Measuring the GPU time of the render passes.
+ */
+
+#ifndef GRAPHICS_GPUTIMER_H
+#define GRAPHICS_GPUTIMER_H
+
+#include "src/common/types.h"
+
+#include "src/graphics/types.h"
+#include "src/graphics/glcontainer.h"
+
+namespace Graphics {
+
+/** Measures how long the GPU takes for each stage of a frame.
+ *
+ *  Every stage is bracketed by two GL_TIMESTAMP queries. The queries of a
+ *  frame are only read once the GPU has finished them, a few frames later,
+ *  so measuring never stalls the pipeline. Frames for which no set of
+ *  queries is free are simply not measured.
+ *
+ *  The times of the last measured frame can be read, and each measured
+ *  stage is recorded into the CPU profiler, on a separate "GPU" track.
+ *
+ *  All methods have to be called from the main thread.
+ */
+class GPUTimer : public GLContainer {
+public:
+	GPUTimer();
+	~GPUTimer();
+
+	/** Return the name of a stage, as used in the profiler. */
+	static const char *getStageName(GPUStage stage);
+
+	/** Start measuring a new frame. */
+	void beginFrame();
+
+	void begin(GPUStage stage);
+	void end(GPUStage stage);
+
+	/** Return the GPU time of a stage in the last measured frame, in milliseconds.
+	 *
+	 *  Stages that weren't rendered in that frame return 0.0f.
+	 */
+	float getTime(GPUStage stage) const;
+
+protected:
+	void doRebuild();
+	void doDestroy();
+
+private:
+	/** The number of frames whose queries can be in flight at the same time. */
+	static const size_t kFrameCount = 2;
+
+	/** The queries of one frame. */
+	struct Frame {
+		GLuint queries[2 * kGPUStageMAX]; ///< Begin and end timestamp of each stage.
+		bool issued[kGPUStageMAX];        ///< Was the stage measured in this frame?
+
+		bool pending; ///< Were queries issued whose results we haven't read yet?
+
+		uint64_t cpuBase; ///< CPU time when the frame started, in microseconds.
+		GLint64  gpuBase; ///< GPU time when the frame started, in nanoseconds.
+	};
+
+	bool _supported; ///< Does the GL support timestamp queries?
+
+	Frame _frames[kFrameCount];
+	size_t _currentFrame;
+
+	Frame *_frame; ///< The frame being measured right now, if any.
+
+	float _times[kGPUStageMAX]; ///< The stage times of the last measured frame.
+
+	/** Read the results of a frame, if the GPU has finished it. */
+	bool collect(Frame &frame);
+};
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_GPUTIMER_H
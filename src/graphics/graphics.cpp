@@ -43,6 +43,9 @@
 #include "src/common/configman.h"
 #include "src/common/debugman.h"
 #include "src/common/threads.h"
+#include "src/common/frustum.h"
+#include "src/common/geometry.h"
+#include "src/common/profiler.h"
 
 #include "src/events/requests.h"
 #include "src/events/events.h"
@@ -56,6 +59,12 @@
 #include "src/graphics/glcontainer.h"
 #include "src/graphics/renderable.h"
 #include "src/graphics/camera.h"
+#include "src/graphics/occlusionculler.h"
+#include "src/graphics/pixeluploadbuffer.h"
+#include "src/graphics/flythrough.h"
+#include "src/graphics/gputimer.h"
+#include "src/graphics/hitchdetector.h"
+#include "src/graphics/renderbatch.h"
 
 #include "src/graphics/images/decoder.h"
 #include "src/graphics/images/screenshot.h"
@@ -67,6 +76,8 @@
 
 #include "src/graphics/render/renderman.h"
 
+#include "src/graphics/aurora/textureman.h"
+
 DECLARE_SINGLETON(Graphics::GraphicsManager)
 
 static glm::mat4 inverse(const glm::mat4 &m);
@@ -74,6 +85,10 @@ static glm::mat4 inverse(const glm::mat4 &m);
 namespace Graphics {
 
 PFNGLCOMPRESSEDTEXIMAGE2DPROC glCompressedTexImage2D;
+PFNGLVERTEXATTRIBDIVISORPROC glVertexAttribDivisor;
+
+/** The number of bytes of new textures uploaded per frame. */
+static const size_t kTextureUploadBudget = 16 * 1024 * 1024;
 
 GraphicsManager::GraphicsManager() : Events::Notifyable() {
 	_ready = false;
@@ -82,9 +97,13 @@ GraphicsManager::GraphicsManager() : Events::Notifyable() {
 
 	_rendererExperimental = false;
 
+	_headless = false;
+
 	_needManualDeS3TC        = false;
 	_supportMultipleTextures = false;
 	_multipleTextureCount    = 0;
+	_supportInstancing       = false;
+	_supportVAO              = false;
 
 	// Default to an OpenGL 3.2 compatibility context. GL3.x will be available on most modern systems.
 	_renderType = WindowManager::kOpenGL32Compat;
@@ -103,9 +122,28 @@ GraphicsManager::GraphicsManager() : Events::Notifyable() {
 	_guiWidth = 800;
 	_guiHeight = 600;
 
+	_pickTreeValid    = false;
+	_pickTreeFrame    = 0;
+	_pickTreeRevision = 0;
+
 	_fpsCounter = std::make_unique<FPSCounter>(3);
 
 	_frameLock.store(0);
+	_guiRevision.store(0);
+	_frameCount.store(0);
+	_resortQueues.store(0);
+	_cameraMoved.store(false);
+	_drawnObjectCount.store(0);
+	_culledObjectCount.store(0);
+	_occludedObjectCount.store(0);
+	_projectedSizeScale.store(0.0f);
+
+	_frameDrawCalls = 0;
+	_frameTriangles = 0;
+	_drawCallCount.store(0);
+	_triangleCount.store(0);
+
+	_renderBatch = 0;
 
 	_cursor = 0;
 
@@ -118,6 +156,7 @@ GraphicsManager::GraphicsManager() : Events::Notifyable() {
 	_lastSampled = 0;
 
 	glCompressedTexImage2D = 0;
+	glVertexAttribDivisor  = 0;
 }
 
 GraphicsManager::~GraphicsManager() {
@@ -136,6 +175,8 @@ void GraphicsManager::init() {
 
 	_rendererExperimental = ConfigMan.getBool("rendernew", false);
 
+	_headless = ConfigMan.getBool("headless", false);
+
 	IMGUI_CHECKVERSION();
 	ImGui::CreateContext();
 	ImGui::StyleColorsDark();
@@ -179,6 +220,32 @@ void GraphicsManager::init() {
 	SurfaceMan.init();
 	MaterialMan.init();
 	MeshMan.init();
+	RenderMan.init();
+
+	// Occlusion queries are core since OpenGL 1.5
+	if (GLEW_VERSION_1_5) {
+		_occlusionCuller = std::make_unique<OcclusionCuller>();
+		_occlusionCuller->rebuild();
+	}
+
+	// Pixel buffer objects are core since OpenGL 2.1
+	if (GLEW_VERSION_2_1 || GLEW_ARB_pixel_buffer_object) {
+		_pixelUploadBuffer = std::make_unique<PixelUploadBuffer>();
+		_pixelUploadBuffer->rebuild();
+	}
+
+	_flythrough = std::make_unique<Flythrough>();
+	_flythrough->rebuild();
+
+	_gpuTimer = std::make_unique<GPUTimer>();
+	_gpuTimer->rebuild();
+
+	_hitchDetector = std::make_unique<HitchDetector>();
+	_hitchDetector->setThreshold(MAX(ConfigMan.getInt("hitchthreshold", 0), 0));
+
+	// The hitch captures come out of the profiler
+	if (_hitchDetector->getThreshold() > 0)
+		ProfilerMan.setEnabled(true);
 
 	if (!_animationThread.createThread("Animations"))
 		throw Common::Exception("Failed to create the animation thread");
@@ -204,9 +271,18 @@ void GraphicsManager::deinit() {
 
 	QueueMan.clearAllQueues();
 
+	discardAllGUI();
+
 	_animationThread.pause();
 	_animationThread.destroyThread();
 
+	_occlusionCuller.reset();
+	_pixelUploadBuffer.reset();
+	_flythrough.reset();
+	_gpuTimer.reset();
+	_hitchDetector.reset();
+
+	RenderMan.deinit();
 	MeshMan.deinit();
 	ShaderMan.deinit();
 	WindowMan.deinit();
@@ -216,6 +292,8 @@ void GraphicsManager::deinit() {
 	_needManualDeS3TC        = false;
 	_supportMultipleTextures = false;
 	_multipleTextureCount    = 0;
+	_supportInstancing       = false;
+	_supportVAO              = false;
 }
 
 bool GraphicsManager::ready() const {
@@ -230,6 +308,119 @@ bool GraphicsManager::supportMultipleTextures() const {
 	return _supportMultipleTextures;
 }
 
+bool GraphicsManager::supportInstancing() const {
+	return _supportInstancing;
+}
+
+bool GraphicsManager::supportVertexArrayObjects() const {
+	return _supportVAO;
+}
+
+PixelUploadBuffer *GraphicsManager::getPixelUploadBuffer() const {
+	return _pixelUploadBuffer.get();
+}
+
+RenderBatch *GraphicsManager::getRenderBatch() const {
+	return _renderBatch;
+}
+
+void GraphicsManager::flushRenderBatch() {
+	if (_renderBatch)
+		_renderBatch->flush();
+
+	_renderBatch = 0;
+}
+
+void GraphicsManager::renderGUIObject(Renderable &renderable) {
+	renderable.snapshot();
+
+	// Consecutive objects sharing a batch are drawn together
+	RenderBatch *batch = renderable.getRenderBatch();
+	if (batch != _renderBatch)
+		flushRenderBatch();
+
+	_renderBatch = batch;
+
+	glPushMatrix();
+	renderable.render(kRenderPassAll);
+	glPopMatrix();
+}
+
+void GraphicsManager::recordGUI(RetainedGUI &retained, const std::list<Queueable *> &gui) {
+	discardGUI(retained);
+
+	ListID list = 0;
+	for (std::list<Queueable *>::const_reverse_iterator g = gui.rbegin(); g != gui.rend(); ++g) {
+		Renderable &renderable = *static_cast<Renderable *>(*g);
+
+		if (renderable.isRetainable()) {
+			// Collect a run of retainable objects into one list
+			if (list == 0) {
+				flushRenderBatch();
+
+				list = glGenLists(1);
+				if (list == 0)
+					break;
+
+				glNewList(list, GL_COMPILE);
+			}
+
+			renderGUIObject(renderable);
+			continue;
+		}
+
+		if (list != 0) {
+			flushRenderBatch();
+			glEndList();
+
+			retained.steps.push_back({ list, 0 });
+			list = 0;
+		}
+
+		retained.steps.push_back({ 0, &renderable });
+	}
+
+	if (list != 0) {
+		flushRenderBatch();
+		glEndList();
+
+		retained.steps.push_back({ list, 0 });
+	}
+
+	retained.recorded = true;
+}
+
+void GraphicsManager::replayGUI(RetainedGUI &retained) {
+	for (std::vector<RetainedGUIStep>::const_iterator s = retained.steps.begin(); s != retained.steps.end(); ++s) {
+		if (s->list != 0) {
+			flushRenderBatch();
+
+			glCallList(s->list);
+			continue;
+		}
+
+		renderGUIObject(*s->renderable);
+	}
+
+	flushRenderBatch();
+}
+
+void GraphicsManager::discardGUI(RetainedGUI &retained) {
+	for (std::vector<RetainedGUIStep>::const_iterator s = retained.steps.begin(); s != retained.steps.end(); ++s)
+		if (s->list != 0)
+			glDeleteLists(s->list, 1);
+
+	retained.steps.clear();
+	retained.recorded = false;
+}
+
+void GraphicsManager::discardAllGUI() {
+	for (std::map<QueueType, RetainedGUI>::iterator r = _retainedGUI.begin(); r != _retainedGUI.end(); ++r)
+		discardGUI(r->second);
+
+	_retainedGUI.clear();
+}
+
 size_t GraphicsManager::getMultipleTextureCount() const {
 	return _multipleTextureCount;
 }
@@ -242,6 +433,10 @@ uint32_t GraphicsManager::getFPS() const {
 	return _fpsCounter->getFPS();
 }
 
+uint32_t GraphicsManager::getFrameCount() const {
+	return _frameCount.load(std::memory_order_acquire);
+}
+
 bool GraphicsManager::setFSAA(int level) {
 	// Force calling it from the main thread
 	if (!Common::isMainThread()) {
@@ -391,6 +586,17 @@ void GraphicsManager::checkGLExtensions() {
 		warning("xoreos will only use one texture. Certain surfaces may look weird");
 	}
 
+	// Instanced drawing is only used by the shader renderer
+	glVertexAttribDivisor = GLEW_GET_FUN(__glewVertexAttribDivisor) ?
+		(PFNGLVERTEXATTRIBDIVISORPROC)GLEW_GET_FUN(__glewVertexAttribDivisor) :
+		(PFNGLVERTEXATTRIBDIVISORPROC)GLEW_GET_FUN(__glewVertexAttribDivisorARB);
+
+	_supportInstancing = isGL3() && glVertexAttribDivisor && GLEW_GET_FUN(__glewDrawElementsInstanced) &&
+	                     GLEW_GET_FUN(__glewDrawArraysInstanced);
+
+	// The fixed-function renderer can keep its client array state in VAOs, too
+	_supportVAO = isGL3() || GLEW_ARB_vertex_array_object;
+
 	if (_debugGL && GLEW_ARB_debug_output) {
 		warning("Enabled OpenGL debug output");
 
@@ -497,6 +703,8 @@ void GraphicsManager::setGUISize(int guiWidth, int guiHeight) {
 	 * again to compensate.
 	 */
 	setupViewMatrices();
+
+	invalidateGUI();
 }
 
 void GraphicsManager::setPerspective(float viewAngle, float clipNear, float clipFar) {
@@ -550,6 +758,8 @@ void GraphicsManager::perspective(float fovy, float aspect, float zNear, float z
 
 	_perspectiveInv = glm::inverse(_perspective);
 
+	_projectedSizeScale.store(f * WindowMan.getWindowHeight() / 2.0f, std::memory_order_release);
+
 	int windowWidth = WindowMan.getWindowWidth();
 	int windowHeight = WindowMan.getWindowHeight();
 	int rasterWidth  = (_scalingType == kScalingWindowSize || _guiWidth  > windowWidth)  ? _guiWidth  : windowWidth;
@@ -671,6 +881,13 @@ bool GraphicsManager::project(float x, float y, float z, float &sX, float &sY, f
 	return true;
 }
 
+float GraphicsManager::getProjectedSize(float size, float distance) const {
+	if (distance <= _clipNear)
+		return size * _projectedSizeScale.load(std::memory_order_acquire) / _clipNear;
+
+	return size * _projectedSizeScale.load(std::memory_order_acquire) / distance;
+}
+
 bool GraphicsManager::unproject(float x, float y,
                                 float &x1, float &y1, float &z1,
                                 float &x2, float &y2, float &z2) const {
@@ -812,36 +1029,57 @@ void GraphicsManager::unlockFrame() {
 	assert(lock != 0);
 }
 
+bool GraphicsManager::hasPendingObjects() {
+	return !QueueMan.isQueueEmpty(kQueueNewTexture) || !QueueMan.isQueueEmpty(kQueueNewShader);
+}
+
+void GraphicsManager::invalidateGUI() {
+	_guiRevision.fetch_add(1, std::memory_order_release);
+}
+
 void GraphicsManager::recalculateObjectDistances() {
-	// World objects
-	QueueMan.lockQueue(kQueueVisibleWorldObject);
+	_cameraMoved.store(true, std::memory_order_release);
 
-	const std::list<Queueable *> &objects = QueueMan.getQueue(kQueueVisibleWorldObject);
-	for (std::list<Queueable *>::const_iterator o = objects.begin(); o != objects.end(); ++o)
-		static_cast<Renderable *>(*o)->calculateDistance();
+	requestResort(kQueueVisibleWorldObject);
+	requestResort(kQueueVisibleGUIFrontObject);
+	requestResort(kQueueVisibleGUIBackObject);
+}
 
-	QueueMan.sortQueue(kQueueVisibleWorldObject);
-	QueueMan.unlockQueue(kQueueVisibleWorldObject);
+void GraphicsManager::requestResort(QueueType queue) {
+	_resortQueues.fetch_or(1u << queue, std::memory_order_acq_rel);
+}
 
-	// GUI front objects
-	QueueMan.lockQueue(kQueueVisibleGUIFrontObject);
+void GraphicsManager::updateObjectDistances() {
+	/* Distances are only recalculated for objects that moved, unless the
+	 * camera moved. Since the order changes little from frame to frame,
+	 * resorting is then usually a single linear pass over the queue. */
 
-	const std::list<Queueable *> &guiFront = QueueMan.getQueue(kQueueVisibleGUIFrontObject);
-	for (std::list<Queueable *>::const_iterator g = guiFront.begin(); g != guiFront.end(); ++g)
-		static_cast<Renderable *>(*g)->calculateDistance();
+	const uint32_t queues = _resortQueues.exchange(0, std::memory_order_acq_rel);
+	if (queues == 0)
+		return;
 
-	QueueMan.sortQueue(kQueueVisibleGUIFrontObject);
-	QueueMan.unlockQueue(kQueueVisibleGUIFrontObject);
+	const bool cameraMoved = _cameraMoved.exchange(false, std::memory_order_acq_rel);
+
+	for (int i = 0; i < kQueueMAX; i++) {
+		if (!(queues & (1u << i)))
+			continue;
+
+		const QueueType queue = (QueueType) i;
 
-	// GUI back objects
-	QueueMan.lockQueue(kQueueVisibleGUIBackObject);
+		QueueMan.lockQueue(queue);
 
-	const std::list<Queueable *> &guiBack = QueueMan.getQueue(kQueueVisibleGUIBackObject);
-	for (std::list<Queueable *>::const_iterator g = guiBack.begin(); g != guiBack.end(); ++g)
-		static_cast<Renderable *>(*g)->calculateDistance();
+		const std::list<Queueable *> &objects = QueueMan.getQueue(queue);
+		for (std::list<Queueable *>::const_iterator o = objects.begin(); o != objects.end(); ++o) {
+			Renderable &r = static_cast<Renderable &>(**o);
 
-	QueueMan.sortQueue(kQueueVisibleGUIBackObject);
-	QueueMan.unlockQueue(kQueueVisibleGUIBackObject);
+			const bool dirty = r._distanceDirty.exchange(false, std::memory_order_acq_rel);
+			if (dirty || cameraMoved)
+				r.calculateDistance();
+		}
+
+		QueueMan.sortQueue(queue);
+		QueueMan.unlockQueue(queue);
+	}
 }
 
 uint32_t GraphicsManager::createRenderableID() {
@@ -891,10 +1129,108 @@ void GraphicsManager::takeScreenshot() {
 	unlockFrame();
 }
 
+void GraphicsManager::startFlythroughRecording() {
+	if (!_flythrough)
+		throw Common::Exception("Graphics not initialized");
+
+	lockFrame();
+
+	try {
+		_flythrough->startRecording();
+	} catch (...) {
+		unlockFrame();
+		throw;
+	}
+
+	unlockFrame();
+}
+
+void GraphicsManager::stopFlythroughRecording(const Common::UString &pathFile) {
+	if (!_flythrough)
+		throw Common::Exception("Graphics not initialized");
+
+	lockFrame();
+
+	try {
+		_flythrough->stopRecording(pathFile);
+	} catch (...) {
+		unlockFrame();
+		throw;
+	}
+
+	unlockFrame();
+}
+
+void GraphicsManager::startFlythroughReplay(const Common::UString &pathFile, const Common::UString &reportFile) {
+	if (!_flythrough)
+		throw Common::Exception("Graphics not initialized");
+
+	lockFrame();
+
+	try {
+		_flythrough->startReplay(pathFile, reportFile);
+	} catch (...) {
+		unlockFrame();
+		throw;
+	}
+
+	unlockFrame();
+}
+
+void GraphicsManager::stopFlythroughReplay() {
+	if (!_flythrough)
+		return;
+
+	lockFrame();
+
+	_flythrough->stopReplay();
+
+	unlockFrame();
+}
+
+bool GraphicsManager::isRecordingFlythrough() {
+	if (!_flythrough)
+		return false;
+
+	lockFrame();
+
+	const bool recording = _flythrough->isRecording();
+
+	unlockFrame();
+
+	return recording;
+}
+
+bool GraphicsManager::isReplayingFlythrough() {
+	if (!_flythrough)
+		return false;
+
+	lockFrame();
+
+	const bool replaying = _flythrough->isReplaying();
+
+	unlockFrame();
+
+	return replaying;
+}
+
 Renderable *GraphicsManager::getGUIObjectAt(float x, float y) const {
 	if (QueueMan.isQueueEmpty(kQueueVisibleGUIFrontObject))
 		return 0;
 
+	std::lock_guard<std::mutex> lock(_pickMutex);
+
+	/* Until another frame is drawn or a GUI object changes, the same
+	 * screen position will find the same object as last time. */
+	const uint32_t frame    = _frameCount.load(std::memory_order_acquire);
+	const uint32_t revision = QueueMan.getRevision(kQueueVisibleGUIFrontObject) +
+	                          _guiRevision.load(std::memory_order_acquire);
+
+	if (_lastGUIPick.matches(frame, revision, x, y))
+		return _lastGUIPick.object;
+
+	const float screenX = x, screenY = y;
+
 	// Map the screen coordinates to our OpenGL GUI screen coordinates
 	if (_scalingType == kScalingNone) {
 		x = x - (WindowMan.getWindowWidth() / 2.0f);
@@ -925,22 +1261,34 @@ Renderable *GraphicsManager::getGUIObjectAt(float x, float y) const {
 	}
 
 	QueueMan.unlockQueue(kQueueVisibleGUIFrontObject);
+
+	_lastGUIPick.valid    = true;
+	_lastGUIPick.frame    = frame;
+	_lastGUIPick.revision = revision;
+	_lastGUIPick.x        = screenX;
+	_lastGUIPick.y        = screenY;
+	_lastGUIPick.object   = object;
+
 	return object;
 }
 
-Renderable *GraphicsManager::getWorldObjectAt(float x, float y) const {
-	if (QueueMan.isQueueEmpty(kQueueVisibleWorldObject))
-		return 0;
+void GraphicsManager::updatePickTree() const {
+	/* The objects and the camera only visibly change when a new frame is
+	 * drawn, so the tree stays good for all picks until then. Objects
+	 * coming and going without a frame in between still force a rebuild,
+	 * so that the tree never holds stale objects. */
+	const uint32_t frame    = _frameCount.load(std::memory_order_acquire);
+	const uint32_t revision = QueueMan.getRevision(kQueueVisibleWorldObject);
 
-	float x1, y1, z1, x2, y2, z2;
-	if (!unproject(x, y, x1, y1, z1, x2, y2, z2))
-		return 0;
+	if (_pickTreeValid && (_pickTreeFrame == frame) && (_pickTreeRevision == revision))
+		return;
 
-	Renderable *object = 0;
+	_pickCandidates.clear();
+	_pickBoxCandidates.clear();
 
-	QueueMan.lockQueue(kQueueVisibleWorldObject);
-	const std::list<Queueable *> &objects = QueueMan.getQueue(kQueueVisibleWorldObject);
+	std::vector<glm::vec3> boxMin, boxMax;
 
+	const std::list<Queueable *> &objects = QueueMan.getQueue(kQueueVisibleWorldObject);
 	for (std::list<Queueable *>::const_iterator o = objects.begin(); o != objects.end(); ++o) {
 		Renderable &r = static_cast<Renderable &>(**o);
 
@@ -948,13 +1296,77 @@ Renderable *GraphicsManager::getWorldObjectAt(float x, float y) const {
 			// Object isn't clickable, don't check
 			continue;
 
-		// If the line intersects with the object, return it
-		if (r.isIn(x1, y1, z1, x2, y2, z2)) {
-			object = &r;
-			break;
+		PickCandidate candidate;
+		candidate.renderable = &r;
+		candidate.hasPickBox = false;
+
+		glm::vec3 min, max;
+		if (r.getPickBox(min, max)) {
+			candidate.hasPickBox = true;
+
+			_pickBoxCandidates.push_back(_pickCandidates.size());
+			boxMin.push_back(min);
+			boxMax.push_back(max);
 		}
+
+		_pickCandidates.push_back(candidate);
 	}
 
+	_pickTree.build(boxMin.data(), boxMax.data(), boxMin.size());
+
+	_pickTreeValid    = true;
+	_pickTreeFrame    = frame;
+	_pickTreeRevision = revision;
+}
+
+Renderable *GraphicsManager::getWorldObjectAt(float x, float y) const {
+	if (QueueMan.isQueueEmpty(kQueueVisibleWorldObject))
+		return 0;
+
+	std::lock_guard<std::mutex> lock(_pickMutex);
+
+	QueueMan.lockQueue(kQueueVisibleWorldObject);
+
+	updatePickTree();
+
+	// Nothing moved since the last pick at this position
+	if (_lastWorldPick.matches(_pickTreeFrame, _pickTreeRevision, x, y)) {
+		QueueMan.unlockQueue(kQueueVisibleWorldObject);
+		return _lastWorldPick.object;
+	}
+
+	Renderable *object = 0;
+
+	float x1, y1, z1, x2, y2, z2;
+	if (unproject(x, y, x1, y1, z1, x2, y2, z2)) {
+		// Find the pick box hit by the line that comes first in queue order
+		size_t first = _pickCandidates.size();
+		_pickTree.visitSegment(glm::vec3(x1, y1, z1), glm::vec3(x2, y2, z2), [this, &first](int32_t box) {
+			first = MIN<size_t>(first, _pickBoxCandidates[box]);
+			return false;
+		});
+
+		// Objects without a pick box are tested precisely, if they come before that hit
+		for (size_t i = 0; i < first; i++) {
+			const PickCandidate &candidate = _pickCandidates[i];
+
+			if (!candidate.hasPickBox && candidate.renderable->isIn(x1, y1, z1, x2, y2, z2)) {
+				first = i;
+				break;
+			}
+		}
+
+		if (first < _pickCandidates.size())
+			object = _pickCandidates[first].renderable;
+	}
+
+	_lastWorldPick.valid    = true;
+	_lastWorldPick.frame    = _pickTreeFrame;
+	_lastWorldPick.revision = _pickTreeRevision;
+	_lastWorldPick.x        = x;
+	_lastWorldPick.y        = y;
+	_lastWorldPick.object   = object;
+
 	QueueMan.unlockQueue(kQueueVisibleWorldObject);
 	return object;
 }
@@ -972,6 +1384,8 @@ Renderable *GraphicsManager::getObjectAt(float x, float y) {
 }
 
 void GraphicsManager::buildNewTextures() {
+	PROFILE_ZONE("GraphicsManager::buildNewTextures");
+
 	QueueMan.lockQueue(kQueueNewShader);
 	const std::list<Queueable *> &shadq = QueueMan.getQueue(kQueueNewShader);
 	if (shadq.empty()) {
@@ -984,21 +1398,33 @@ void GraphicsManager::buildNewTextures() {
 		QueueMan.unlockQueue(kQueueNewShader);
 	}
 
-	QueueMan.lockQueue(kQueueNewTexture);
-	const std::list<Queueable *> &text = QueueMan.getQueue(kQueueNewTexture);
-	if (text.empty()) {
-		QueueMan.unlockQueue(kQueueNewTexture);
-		return;
-	}
+	/* Build as many new textures as fit into this frame's upload budget, and
+	 * leave the rest for the next frames. Until then, they're simply unbound.
+	 * At least one is always built, so huge textures can't get stuck. */
 
-	for (std::list<Queueable *>::const_iterator t = text.begin(); t != text.end(); ++t)
-		static_cast<GLContainer *>(*t)->rebuild();
+	size_t uploaded = 0;
 
-	QueueMan.clearQueue(kQueueNewTexture);
-	QueueMan.unlockQueue(kQueueNewTexture);
+	QueueMan.kickOut(kQueueNewTexture, [&uploaded](Queueable &q) {
+		GLContainer &container = static_cast<GLContainer &>(q);
+
+		const size_t size = container.getUploadSize();
+		if ((size > 0) && (uploaded > 0) && ((uploaded + size) > kTextureUploadBudget))
+			return false;
+
+		container.rebuild();
+		uploaded += size;
+
+		return true;
+	});
+
+	// Stream in the mip maps needed for the last frame
+	TextureMan.updateStreaming();
 }
 
 void GraphicsManager::beginScene() {
+	// Whatever touched the texture state since the last frame, start out fresh
+	TextureMan.invalidateState();
+
 	switch (_renderType) {
 		case WindowManager::kOpenGL21:
 		case WindowManager::kOpenGL21Core:
@@ -1019,6 +1445,12 @@ void GraphicsManager::beginScene() {
 	// Clear
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
+	// Shaders read an additional object transformation from a per-instance vertex
+	// attribute. It has to be the identity for everything not drawn instanced.
+	if (isGL3())
+		for (GLuint i = 0; i < 4; i++)
+			glVertexAttrib4f(Shader::VERTEX_INSTANCE_TRANSFORM + i, i == 0, i == 1, i == 2, i == 3);
+
 	glEnable(GL_TEXTURE_2D);
 }
 
@@ -1080,35 +1512,140 @@ bool GraphicsManager::renderWorld() {
 	_modelview = glm::rotate(_modelview, Common::deg2rad(-cOrient[2]), glm::vec3(0.0f, 0.0f, 1.0f));
 	_modelview = glm::translate(_modelview, glm::vec3(-cPos[0], -cPos[1], -cPos[2]));
 
-	QueueMan.lockQueue(kQueueVisibleWorldObject);
-	const std::list<Queueable *> &objects = QueueMan.getQueue(kQueueVisibleWorldObject);
+	takeWorldSnapshot();
 
 	buildNewTextures();
 
 	_animationThread.flush();
 
+	cullWorldObjects();
+
 	// Draw opaque objects
-	for (std::list<Queueable *>::const_reverse_iterator o = objects.rbegin();
-	     o != objects.rend(); ++o) {
+	beginGPUStage(kGPUStageWorldOpaque);
+	for (std::vector<Renderable *>::const_iterator o = _visibleWorldObjects.begin();
+	     o != _visibleWorldObjects.end(); ++o) {
 
 		glPushMatrix();
-		static_cast<Renderable *>(*o)->render(kRenderPassOpaque);
+		(*o)->render(kRenderPassOpaque);
 		glPopMatrix();
 	}
+	endGPUStage(kGPUStageWorldOpaque);
+
+	queryWorldOcclusion();
 
 	// Draw transparent objects
-	for (std::list<Queueable *>::const_reverse_iterator o = objects.rbegin();
-	     o != objects.rend(); ++o) {
+	beginGPUStage(kGPUStageWorldTransparent);
+	for (std::vector<Renderable *>::const_iterator o = _visibleWorldObjects.begin();
+	     o != _visibleWorldObjects.end(); ++o) {
 
 		glPushMatrix();
-		static_cast<Renderable *>(*o)->render(kRenderPassTransparent);
+		(*o)->render(kRenderPassTransparent);
 		glPopMatrix();
 	}
+	endGPUStage(kGPUStageWorldTransparent);
 
-	QueueMan.unlockQueue(kQueueVisibleWorldObject);
+	releaseWorldSnapshot();
 	return true;
 }
 
+void GraphicsManager::takeWorldSnapshot() {
+	_worldSnapshotMutex.lock();
+
+	QueueMan.lockQueue(kQueueVisibleWorldObject);
+	const std::list<Queueable *> &objects = QueueMan.getQueue(kQueueVisibleWorldObject);
+
+	// The world objects are drawn back to front
+	_worldSnapshot.clear();
+	for (std::list<Queueable *>::const_reverse_iterator o = objects.rbegin();
+	     o != objects.rend(); ++o) {
+
+		Renderable *object = static_cast<Renderable *>(*o);
+
+		object->snapshot();
+		object->_inWorldSnapshot.store(true, std::memory_order_release);
+
+		_worldSnapshot.push_back(object);
+	}
+
+	QueueMan.unlockQueue(kQueueVisibleWorldObject);
+}
+
+void GraphicsManager::releaseWorldSnapshot() {
+	for (std::vector<Renderable *>::const_iterator o = _worldSnapshot.begin(); o != _worldSnapshot.end(); ++o)
+		(*o)->_inWorldSnapshot.store(false, std::memory_order_release);
+
+	_worldSnapshot.clear();
+
+	_worldSnapshotMutex.unlock();
+}
+
+void GraphicsManager::waitForWorldSnapshot() {
+	std::lock_guard<std::mutex> lock(_worldSnapshotMutex);
+}
+
+void GraphicsManager::cullWorldObjects() {
+	Common::Frustum frustum;
+	frustum.set(_perspective * _modelview);
+
+	_frustumWorldObjects.clear();
+	for (std::vector<Renderable *>::const_iterator o = _worldSnapshot.begin(); o != _worldSnapshot.end(); ++o)
+		if ((*o)->isInFrustum(frustum))
+			_frustumWorldObjects.push_back(*o);
+
+	_visibleWorldObjects = _frustumWorldObjects;
+	if (_occlusionCuller)
+		_occlusionCuller->cull(_visibleWorldObjects, glm::make_vec3(CameraMan.getPosition()), _frameCount.load());
+
+	_drawnObjectCount.store(_visibleWorldObjects.size(), std::memory_order_relaxed);
+	_culledObjectCount.store(_worldSnapshot.size() - _visibleWorldObjects.size(), std::memory_order_relaxed);
+	_occludedObjectCount.store(_frustumWorldObjects.size() - _visibleWorldObjects.size(), std::memory_order_relaxed);
+}
+
+void GraphicsManager::queryWorldOcclusion() {
+	if (!_occlusionCuller)
+		return;
+
+	_occlusionCuller->query(_frustumWorldObjects, glm::make_vec3(CameraMan.getPosition()),
+	                        _perspective, _modelview, _frameCount.load());
+}
+
+uint32_t GraphicsManager::getDrawnObjectCount() const {
+	return _drawnObjectCount.load(std::memory_order_relaxed);
+}
+
+uint32_t GraphicsManager::getCulledObjectCount() const {
+	return _culledObjectCount.load(std::memory_order_relaxed);
+}
+
+uint32_t GraphicsManager::getOccludedObjectCount() const {
+	return _occludedObjectCount.load(std::memory_order_relaxed);
+}
+
+float GraphicsManager::getGPUTime(GPUStage stage) const {
+	if (!_gpuTimer)
+		return 0.0f;
+
+	return _gpuTimer->getTime(stage);
+}
+
+void GraphicsManager::beginGPUStage(GPUStage stage) {
+	if (_gpuTimer)
+		_gpuTimer->begin(stage);
+}
+
+void GraphicsManager::endGPUStage(GPUStage stage) {
+	if (_gpuTimer)
+		_gpuTimer->end(stage);
+}
+
+uint32_t GraphicsManager::getDrawCallCount() const {
+	return _drawCallCount.load(std::memory_order_relaxed);
+}
+
+uint32_t GraphicsManager::getTriangleCount() const {
+	return _triangleCount.load(std::memory_order_relaxed);
+}
+
 bool GraphicsManager::renderGUIFront() {
 	return renderGUI(_scalingType, kQueueVisibleGUIFrontObject, false);
 }
@@ -1149,12 +1686,36 @@ bool GraphicsManager::renderGUI(ScalingType scalingType, QueueType guiQueue, boo
 
 	buildNewTextures();
 
-	for (std::list<Queueable *>::const_reverse_iterator g = gui.rbegin();
-	     g != gui.rend(); ++g) {
+	/* Most GUIs don't change between input events. Once a queue has been drawn
+	 * twice in the same state, record its drawing into display lists and replay
+	 * those until an object in it changes, or objects come and go. */
 
-		glPushMatrix();
-		static_cast<Renderable *>(*g)->render(kRenderPassAll);
-		glPopMatrix();
+	const uint32_t guiRevision      = _guiRevision.load(std::memory_order_acquire);
+	const uint32_t queueRevision    = QueueMan.getRevision(guiQueue);
+	const uint32_t resourceRevision = QueueMan.getRevision(kQueueNewTexture) +
+	                                  QueueMan.getRevision(kQueueNewShader);
+
+	RetainedGUI &retained = _retainedGUI[guiQueue];
+	if ((retained.guiRevision      == guiRevision)   &&
+	    (retained.queueRevision    == queueRevision) &&
+	    (retained.resourceRevision == resourceRevision)) {
+
+		if (!retained.recorded)
+			recordGUI(retained, gui);
+
+		replayGUI(retained);
+
+	} else {
+		discardGUI(retained);
+
+		retained.guiRevision      = guiRevision;
+		retained.queueRevision    = queueRevision;
+		retained.resourceRevision = resourceRevision;
+
+		for (std::list<Queueable *>::const_reverse_iterator g = gui.rbegin(); g != gui.rend(); ++g)
+			renderGUIObject(*static_cast<Renderable *>(*g));
+
+		flushRenderBatch();
 	}
 
 	QueueMan.unlockQueue(guiQueue);
@@ -1224,23 +1785,46 @@ bool GraphicsManager::renderWorldShader() {
 	_modelview = glm::rotate(_modelview, Common::deg2rad(-cOrient[2]), glm::vec3(0.0f, 0.0f, 1.0f));
 	_modelview = glm::translate(_modelview, glm::vec3(-cPos[0], -cPos[1], -cPos[2]));
 
-	QueueMan.lockQueue(kQueueVisibleWorldObject);
-	const std::list<Queueable *> &objects = QueueMan.getQueue(kQueueVisibleWorldObject);
+	takeWorldSnapshot();
 
 	buildNewTextures();
 
 	_animationThread.flush();
 
+	cullWorldObjects();
+
 	glm::mat4 ident;
 	RenderMan.clear();
-	for (std::list<Queueable *>::const_reverse_iterator o = objects.rbegin();
-	     o != objects.rend(); ++o) {
-		static_cast<Renderable *>(*o)->queueRender(ident);
+
+	/* Objects that need to set up GL resources while being queued are queued
+	 * here on the main thread, and everything else on the thread pool. */
+	_parallelWorldObjects.clear();
+	for (std::vector<Renderable *>::const_iterator o = _visibleWorldObjects.begin();
+	     o != _visibleWorldObjects.end(); ++o) {
+
+		if ((*o)->canQueueRenderParallel())
+			_parallelWorldObjects.push_back(*o);
+		else
+			(*o)->queueRender(ident);
 	}
+
+	RenderMan.queueParallel(_parallelWorldObjects.size(), [this, &ident](size_t i) {
+		_parallelWorldObjects[i]->queueRender(ident);
+	});
+
 	RenderMan.sort();
-	RenderMan.render();
 
-	QueueMan.unlockQueue(kQueueVisibleWorldObject);
+	beginGPUStage(kGPUStageWorldOpaque);
+	RenderMan.renderOpaque();
+	endGPUStage(kGPUStageWorldOpaque);
+
+	beginGPUStage(kGPUStageWorldTransparent);
+	RenderMan.renderTransparent();
+	endGPUStage(kGPUStageWorldTransparent);
+
+	queryWorldOcclusion();
+
+	releaseWorldSnapshot();
 	return true;
 }
 
@@ -1276,6 +1860,7 @@ bool GraphicsManager::renderGUIShader(ScalingType UNUSED(scalingType), QueueType
 	glm::mat4 ident;
 	for (std::list<Queueable *>::const_reverse_iterator g = gui.rbegin();
 	     g != gui.rend(); ++g) {
+		static_cast<Renderable *>(*g)->snapshot();
 		static_cast<Renderable *>(*g)->renderImmediate(ident);
 	}
 
@@ -1320,6 +1905,11 @@ void GraphicsManager::endScene() {
 
 	_fpsCounter->finishedFrame();
 
+	_drawCallCount.store(_frameDrawCalls, std::memory_order_relaxed);
+	_triangleCount.store(_frameTriangles, std::memory_order_relaxed);
+	_frameDrawCalls = 0;
+	_frameTriangles = 0;
+
 	if (_fsaa > 0)
 		glDisable(GL_MULTISAMPLE_ARB);
 }
@@ -1327,6 +1917,11 @@ void GraphicsManager::endScene() {
 void GraphicsManager::renderScene() {
 	Common::enforceMainThread();
 
+	if (_hitchDetector)
+		_hitchDetector->beginFrame();
+
+	PROFILE_ZONE("GraphicsManager::renderScene");
+
 	cleanupAbandoned();
 
 	if (EventMan.quitRequested() || (_frameLock.load(std::memory_order_acquire) > 0)) {
@@ -1335,33 +1930,103 @@ void GraphicsManager::renderScene() {
 		return;
 	}
 
+	if (_headless) {
+		// Create what the other threads queued, but don't render or present anything
+		buildNewTextures();
+
+		_frameCount.fetch_add(1, std::memory_order_acq_rel);
+		_frameEndSignal.store(true, std::memory_order_release);
+		return;
+	}
+
+	// Move the camera along a replayed flythrough before anything is sorted
+	if (_flythrough)
+		_flythrough->beginFrame();
+
+	updateObjectDistances();
+
+	if (_gpuTimer)
+		_gpuTimer->beginFrame();
+
+	beginGPUStage(kGPUStageFrame);
+
+	beginGPUStage(kGPUStageBeginScene);
 	beginScene();
+	endGPUStage(kGPUStageBeginScene);
 
-	if (playVideo()) {
+	beginGPUStage(kGPUStageVideo);
+	const bool video = playVideo();
+	endGPUStage(kGPUStageVideo);
+
+	if (video) {
+		beginGPUStage(kGPUStageConsole);
 		renderGUIConsole();
+		endGPUStage(kGPUStageConsole);
+
+		beginGPUStage(kGPUStageImGui);
 		renderImGui();
+		endGPUStage(kGPUStageImGui);
+
+		if (_flythrough)
+			_flythrough->endFrame(_frameDrawCalls, _frameTriangles);
+
+		beginGPUStage(kGPUStageEndScene);
 		endScene();
+		endGPUStage(kGPUStageEndScene);
+
+		endGPUStage(kGPUStageFrame);
 		return;
 	}
 
-	if (_rendererExperimental) {
+	beginGPUStage(kGPUStageGUIBack);
+	if (_rendererExperimental)
 		renderGUIBackShader();
-		renderWorldShader();
-		renderGUIFrontShader();
-		renderGUIConsoleShader();
-		renderImGui();
-		renderCursorShader();
-	} else {
+	else
 		renderGUIBack();
+	endGPUStage(kGPUStageGUIBack);
+
+	beginGPUStage(kGPUStageWorld);
+	if (_rendererExperimental)
+		renderWorldShader();
+	else
 		renderWorld();
+	endGPUStage(kGPUStageWorld);
+
+	beginGPUStage(kGPUStageGUIFront);
+	if (_rendererExperimental)
+		renderGUIFrontShader();
+	else
 		renderGUIFront();
+	endGPUStage(kGPUStageGUIFront);
+
+	beginGPUStage(kGPUStageConsole);
+	if (_rendererExperimental)
+		renderGUIConsoleShader();
+	else
 		renderGUIConsole();
-		renderImGui();
+	endGPUStage(kGPUStageConsole);
+
+	beginGPUStage(kGPUStageImGui);
+	renderImGui();
+	endGPUStage(kGPUStageImGui);
+
+	beginGPUStage(kGPUStageCursor);
+	if (_rendererExperimental)
+		renderCursorShader();
+	else
 		renderCursor();
-	}
+	endGPUStage(kGPUStageCursor);
+
+	if (_flythrough)
+		_flythrough->endFrame(_frameDrawCalls, _frameTriangles);
 
+	beginGPUStage(kGPUStageEndScene);
 	endScene();
+	endGPUStage(kGPUStageEndScene);
+
+	endGPUStage(kGPUStageFrame);
 
+	_frameCount.fetch_add(1, std::memory_order_acq_rel);
 	_frameEndSignal.store(true, std::memory_order_release);
 }
 
@@ -1433,6 +2098,9 @@ void GraphicsManager::destroyContext() {
 	// Destroying all GL containers, since we need to
 	// reload/rebuild them anyway when the context is recreated
 	destroyGLContainers();
+
+	// The recorded GUI drawing goes away with the context
+	discardAllGUI();
 }
 
 void GraphicsManager::rebuildContext() {
@@ -1457,8 +2125,10 @@ void GraphicsManager::cleanupAbandoned() {
 
 	std::lock_guard<std::recursive_mutex> lock(_abandonMutex);
 
-	if (!_abandonTextures.empty())
+	if (!_abandonTextures.empty()) {
 		glDeleteTextures(_abandonTextures.size(), &_abandonTextures[0]);
+		TextureMan.invalidateState();
+	}
 
 	for (std::list<ListID>::iterator l = _abandonLists.begin(); l != _abandonLists.end(); ++l)
 		glDeleteLists(*l, 1);
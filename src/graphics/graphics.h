@@ -27,6 +27,7 @@
 
 #include <vector>
 #include <list>
+#include <map>
 #include <atomic>
 #include <memory>
 
@@ -36,6 +37,7 @@
 #include "src/common/singleton.h"
 #include "src/common/ustring.h"
 #include "src/common/mutex.h"
+#include "src/common/aabbtree.h"
 
 #include "src/graphics/types.h"
 #include "src/graphics/windowman.h"
@@ -51,8 +53,15 @@ namespace Aurora {
 }
 
 class FPSCounter;
+class OcclusionCuller;
+class PixelUploadBuffer;
+class Flythrough;
+class GPUTimer;
+class HitchDetector;
+class RenderBatch;
 class Cursor;
 class Renderable;
+class Queueable;
 
 /** The graphics manager. */
 class GraphicsManager : public Common::Singleton<GraphicsManager>, public Events::Notifyable {
@@ -79,6 +88,16 @@ public:
 	bool supportMultipleTextures() const;
 	/** Return the number of texture units for multiple textures. */
 	size_t getMultipleTextureCount() const;
+	/** Can we draw several instances of a mesh in one call? */
+	bool supportInstancing() const;
+	/** Can we store vertex array state in Vertex Array Objects? */
+	bool supportVertexArrayObjects() const;
+
+	/** Return the buffer to stage texture uploads in, or 0 if pixel buffer objects are unsupported. */
+	PixelUploadBuffer *getPixelUploadBuffer() const;
+
+	/** Return the batch the renderable currently drawn may add itself to, or 0 if it has to draw right away. */
+	RenderBatch *getRenderBatch() const;
 
 	/** Are we currently running an OpenGL 3.x context? */
 	bool isGL3() const;
@@ -93,6 +112,38 @@ public:
 
 	/** How many frames per second to we render at the moments? */
 	uint32_t getFPS() const;
+	/** Return the number of frames rendered so far. */
+	uint32_t getFrameCount() const;
+
+	/** Return the number of world objects drawn in the last frame. */
+	uint32_t getDrawnObjectCount() const;
+	/** Return the number of world objects culled from the last frame, for being outside the view. */
+	uint32_t getCulledObjectCount() const;
+	/** Return the number of world objects culled from the last frame, for being hidden behind others. */
+	uint32_t getOccludedObjectCount() const;
+
+	/** Return how long the GPU took for this stage of the last measured frame, in milliseconds.
+	 *
+	 *  Only call from the main thread. Returns 0.0f if the GPU times can't be measured.
+	 */
+	float getGPUTime(GPUStage stage) const;
+
+	/** Count a draw call of that many vertices into the frame statistics. Only call from the main thread. */
+	void countDrawCall(GLenum mode, uint32_t vertexCount, uint32_t instanceCount = 1) {
+		_frameDrawCalls++;
+
+		if      (mode == GL_TRIANGLES)
+			_frameTriangles += (vertexCount / 3) * instanceCount;
+		else if (((mode == GL_TRIANGLE_STRIP) || (mode == GL_TRIANGLE_FAN)) && (vertexCount >= 3))
+			_frameTriangles += (vertexCount - 2) * instanceCount;
+		else if (mode == GL_QUADS)
+			_frameTriangles += (vertexCount / 2) * instanceCount;
+	}
+
+	/** Return the number of draw calls issued in the last frame. */
+	uint32_t getDrawCallCount() const;
+	/** Return the number of triangles drawn in the last frame. */
+	uint32_t getTriangleCount() const;
 
 	/** Enable/Disable face culling. */
 	void setCullFace(bool enabled, GLenum mode = GL_BACK);
@@ -113,9 +164,26 @@ public:
 	/** Take a screenshot. */
 	void takeScreenshot();
 
+	/** Start recording the camera's flythrough. */
+	void startFlythroughRecording();
+	/** Stop recording the camera's flythrough and write it into a file. */
+	void stopFlythroughRecording(const Common::UString &pathFile);
+	/** Replay a recorded flythrough and write a frame timing report once it's finished. */
+	void startFlythroughReplay(const Common::UString &pathFile, const Common::UString &reportFile);
+	/** Stop replaying a flythrough early, without writing a report. */
+	void stopFlythroughReplay();
+	/** Is a flythrough being recorded? */
+	bool isRecordingFlythrough();
+	/** Is a flythrough being replayed? */
+	bool isReplayingFlythrough();
+
 	/** Map the given world coordinates onto screen coordinates. */
 	bool project(float x, float y, float z, float &sX, float &sY, float &sZ);
 
+	/** Return the approximate height, in pixels, an object of this size
+	 *  has on screen when seen from this distance in the 3D world. */
+	float getProjectedSize(float size, float distance) const;
+
 	/** Map the given screen coordinates onto a line in world space. */
 	bool unproject(float x, float y,
 	               float &x1, float &y1, float &z1,
@@ -124,8 +192,10 @@ public:
 	/** Get the object at this screen position. */
 	Renderable *getObjectAt(float x, float y);
 
-	/** Recalculate all object distances to the camera and resort the objects. */
+	/** The camera moved, so recalculate all object distances and resort the objects before the next frame. */
 	void recalculateObjectDistances();
+	/** Resort a queue of visible objects before the next frame. */
+	void requestResort(QueueType queue);
 
 	/** Increase the frame lock counter, disabling all frame rendering.
 	 *
@@ -147,6 +217,19 @@ public:
 	 */
 	void unlockFrame();
 
+	/** Are there new textures or meshes still waiting for the main thread to create them? */
+	bool hasPendingObjects();
+
+	/** Mark all recorded GUI drawing as out of date, because a visible GUI object changed. */
+	void invalidateGUI();
+
+	/** Wait until the renderer has finished with the current frame's world snapshot.
+	 *
+	 *  Used by world objects that are about to be destroyed, since the
+	 *  renderer does not hold the world queue lock while drawing them.
+	 */
+	void waitForWorldSnapshot();
+
 	/** Create a new unique renderable ID. */
 	uint32_t createRenderableID();
 
@@ -194,10 +277,14 @@ private:
 
 	bool _rendererExperimental; ///< Should we use the experimental shader based renderer?
 
+	bool _headless; ///< Only create GL objects, never render or present a frame?
+
 	// Extensions
 	bool   _needManualDeS3TC;        ///< Do we need to do manual S3TC DXTn decompression?
 	bool   _supportMultipleTextures; ///< Do we have support for multiple textures?
 	size_t _multipleTextureCount;    ///< The number of texture units for multiple textures.
+	bool   _supportInstancing;       ///< Can we draw several instances of a mesh in one call?
+	bool   _supportVAO;              ///< Can we use Vertex Array Objects?
 
 	WindowManager::RenderType _renderType;
 
@@ -231,6 +318,111 @@ private:
 
 	std::atomic<uint32_t> _frameLock;
 	std::atomic<bool>   _frameEndSignal;
+	std::atomic<uint32_t> _frameCount; ///< Number of frames rendered so far.
+
+	std::atomic<uint32_t> _resortQueues; ///< Bit field of the visible queues that need to be resorted.
+	std::atomic<bool>     _cameraMoved;  ///< Do all object distances need to be recalculated?
+
+	uint32_t _frameDrawCalls; ///< Number of draw calls issued in the current frame.
+	uint32_t _frameTriangles; ///< Number of triangles drawn in the current frame.
+
+	std::atomic<uint32_t> _drawCallCount; ///< Number of draw calls issued in the last frame.
+	std::atomic<uint32_t> _triangleCount; ///< Number of triangles drawn in the last frame.
+
+	/** Pixels per world unit at a distance of 1, under the perspective projection. */
+	std::atomic<float> _projectedSizeScale;
+
+	/** All visible world objects at the start of the current frame, in drawing order. */
+	std::vector<Renderable *> _worldSnapshot;
+	/** Held while a frame is rendered from _worldSnapshot. */
+	std::mutex _worldSnapshotMutex;
+
+	/** The world objects within the view frustum, in drawing order. */
+	std::vector<Renderable *> _frustumWorldObjects;
+	/** The world objects within the view frustum and not occluded, in drawing order. */
+	std::vector<Renderable *> _visibleWorldObjects;
+	/** The visible world objects that can be queued for rendering on the thread pool. */
+	std::vector<Renderable *> _parallelWorldObjects;
+
+	std::unique_ptr<OcclusionCuller> _occlusionCuller; ///< Hardware occlusion culling, if supported.
+
+	std::unique_ptr<PixelUploadBuffer> _pixelUploadBuffer; ///< Staging buffer for texture uploads, if supported.
+
+	std::unique_ptr<Flythrough> _flythrough; ///< Recording and replaying camera flythroughs.
+
+	std::unique_ptr<GPUTimer> _gpuTimer; ///< GPU times of the render passes.
+
+	std::unique_ptr<HitchDetector> _hitchDetector; ///< Capturing frames that took too long.
+
+	RenderBatch *_renderBatch; ///< The batch GUI objects are currently collected in.
+
+	/** One step of replaying a GUI queue. */
+	struct RetainedGUIStep {
+		ListID list;            ///< The display list to call, or 0 for a live object.
+		Renderable *renderable; ///< The live object to draw, if list is 0.
+	};
+
+	/** The recorded drawing of a GUI queue, replayed as long as nothing changes. */
+	struct RetainedGUI {
+		uint32_t guiRevision;      ///< _guiRevision when last drawn.
+		uint32_t queueRevision;    ///< The queue's revision when last drawn.
+		uint32_t resourceRevision; ///< The new texture and shader queues' revisions when last drawn.
+
+		bool recorded; ///< Have the steps been recorded for these revisions?
+
+		std::vector<RetainedGUIStep> steps;
+
+		RetainedGUI() : guiRevision(0), queueRevision(0), resourceRevision(0), recorded(false) { }
+	};
+
+	std::atomic<uint32_t> _guiRevision; ///< Changes whenever a visible GUI object changes.
+
+	std::map<QueueType, RetainedGUI> _retainedGUI; ///< Recorded drawing of each GUI queue.
+
+	std::atomic<uint32_t> _drawnObjectCount;    ///< Number of world objects drawn in the last frame.
+	std::atomic<uint32_t> _culledObjectCount;   ///< Number of world objects culled in the last frame.
+	std::atomic<uint32_t> _occludedObjectCount; ///< Number of world objects occluded in the last frame.
+
+	/** A clickable world object, as seen by the pick tree. */
+	struct PickCandidate {
+		Renderable *renderable; ///< The object.
+		bool hasPickBox;        ///< Is the object in the pick tree, or does it need a precise test?
+	};
+
+	/** The last object found under a screen position. */
+	struct PickResult {
+		bool valid;
+
+		uint32_t frame;    ///< _frameCount when the result was found.
+		uint32_t revision; ///< The queue's revision when the result was found.
+
+		float x, y;
+
+		Renderable *object;
+
+		PickResult() : valid(false), frame(0), revision(0), x(0.0f), y(0.0f), object(0) { }
+
+		bool matches(uint32_t f, uint32_t r, float pX, float pY) const {
+			return valid && (frame == f) && (revision == r) && (x == pX) && (y == pY);
+		}
+	};
+
+	/** Protects the pick tree and the pick results. */
+	mutable std::mutex _pickMutex;
+
+	/** The clickable world objects of the last rendered frame, in queue order. */
+	mutable std::vector<PickCandidate> _pickCandidates;
+	/** For each leaf of the pick tree, the index of its object in _pickCandidates. */
+	mutable std::vector<uint32_t> _pickBoxCandidates;
+	/** The pick boxes of the world objects of the last rendered frame. */
+	mutable Common::AABBTree _pickTree;
+
+	mutable bool     _pickTreeValid;    ///< Is the pick tree built at all?
+	mutable uint32_t _pickTreeFrame;    ///< _frameCount when the pick tree was built.
+	mutable uint32_t _pickTreeRevision; ///< The world queue's revision when the pick tree was built.
+
+	mutable PickResult _lastWorldPick; ///< The last world object found under the cursor.
+	mutable PickResult _lastGUIPick;   ///< The last GUI object found under the cursor.
 
 	Cursor     *_cursor;       ///< The current cursor.
 
@@ -271,15 +463,49 @@ private:
 	Renderable *getGUIObjectAt(float x, float y) const;
 	Renderable *getWorldObjectAt(float x, float y) const;
 
+	/** Rebuild the pick tree over the clickable world objects, if they might have changed. */
+	void updatePickTree() const;
+
 	void buildNewTextures();
 
+	/** Recalculate the out-of-date object distances and resort the queues that need it. */
+	void updateObjectDistances();
+
 	void beginScene();
+
+	/** Start measuring the GPU time of a render stage. */
+	void beginGPUStage(GPUStage stage);
+	/** Stop measuring the GPU time of a render stage. */
+	void endGPUStage(GPUStage stage);
+
 	bool playVideo();
 	bool renderWorld();
+
+	/** Copy the visible world objects and their state, for rendering without holding the queue lock. */
+	void takeWorldSnapshot();
+	/** Let go of the world snapshot after the frame has been rendered. */
+	void releaseWorldSnapshot();
+
+	/** Collect all visible world objects within the view frustum into _visibleWorldObjects. */
+	void cullWorldObjects();
+	/** Test the world objects within the view frustum for occlusion, against the current depth buffer. */
+	void queryWorldOcclusion();
 	bool renderGUIFront();
 	bool renderGUIBack();
 	bool renderGUIConsole();
 	bool renderGUI(ScalingType scalingType, QueueType guiQueue, bool disableDepthMask);
+	/** Draw the GUI objects collected in the current render batch. */
+	void flushRenderBatch();
+	/** Draw a GUI object right away, handling its render batch. */
+	void renderGUIObject(Renderable &renderable);
+	/** Record a GUI queue's retainable objects into display lists. */
+	void recordGUI(RetainedGUI &retained, const std::list<Queueable *> &gui);
+	/** Replay a GUI queue's recorded display lists, drawing the other objects live. */
+	void replayGUI(RetainedGUI &retained);
+	/** Delete a GUI queue's recorded display lists. */
+	void discardGUI(RetainedGUI &retained);
+	/** Delete the recorded display lists of all GUI queues. */
+	void discardAllGUI();
 	bool renderImGui();
 	bool renderCursor();
 
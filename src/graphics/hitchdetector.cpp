@@ -0,0 +1,124 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Detecting frames that took too long, and capturing what happened in them.
+ */
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/strutil.h"
+#include "src/common/filepath.h"
+#include "src/common/datetime.h"
+#include "src/common/profiler.h"
+
+#include "src/graphics/hitchdetector.h"
+
+namespace Graphics {
+
+const size_t   HitchDetector::kFrameCount;
+const uint64_t HitchDetector::kCaptureInterval;
+
+HitchDetector::HitchDetector() : _threshold(0), _frameCount(0), _lastCapture(0) {
+	for (size_t i = 0; i < kFrameCount; i++)
+		_frameStarts[i] = 0;
+
+	for (size_t i = 0; i < Common::kMetricCount; i++)
+		_metrics[i] = 0;
+}
+
+HitchDetector::~HitchDetector() {
+}
+
+uint32_t HitchDetector::getThreshold() const {
+	return _threshold;
+}
+
+void HitchDetector::setThreshold(uint32_t threshold) {
+	_threshold  = threshold;
+	_frameCount = 0;
+}
+
+void HitchDetector::beginFrame() {
+	if ((_threshold == 0) || !ProfilerMan.isEnabled()) {
+		_frameCount = 0;
+		return;
+	}
+
+	const uint64_t now = Common::Profiler::getTime();
+
+	if (_frameCount > 0) {
+		const uint64_t start = _frameStarts[(_frameCount - 1) % kFrameCount];
+
+		// Mark the frames in the profile, so that the capture shows where each begins
+		ProfilerMan.addTrackZone("Frames", "Frame", start, now);
+
+		const bool canCapture = (_lastCapture == 0) || ((now - _lastCapture) >= kCaptureInterval);
+		if (((now - start) > (_threshold * 1000ULL)) && canCapture)
+			capture(start, now);
+	}
+
+	_frameStarts[_frameCount % kFrameCount] = now;
+	_frameCount++;
+
+	for (size_t i = 0; i < Common::kMetricCount; i++)
+		_metrics[i] = Common::DebugManager::getMetric((Common::DebugMetric) i);
+}
+
+void HitchDetector::capture(uint64_t start, uint64_t end) {
+	_lastCapture = end;
+
+	const double frameTime = (end - start) / 1000.0;
+
+	PROFILE_NOTE("hitch", Common::UString::format("Frame took %.1f ms", frameTime));
+
+	// What the counters did during the slow frame
+	for (size_t i = 0; i < Common::kMetricCount; i++) {
+		const Common::DebugMetric metric = (Common::DebugMetric) i;
+
+		const uint64_t value = Common::DebugManager::getMetric(metric);
+		if (Common::DebugManager::isMetricGauge(metric))
+			PROFILE_NOTE("hitch", Common::UString::format("%s: %s", Common::DebugManager::getMetricName(metric),
+			                                              Common::composeString(value).c_str()));
+		else if (value > _metrics[i])
+			PROFILE_NOTE("hitch", Common::UString::format("%s: +%s", Common::DebugManager::getMetricName(metric),
+			                                              Common::composeString(value - _metrics[i]).c_str()));
+	}
+
+	// The oldest frame still in the ring buffer
+	const uint64_t since = _frameStarts[(_frameCount >= kFrameCount) ? (_frameCount % kFrameCount) : 0];
+
+	const Common::UString file = Common::FilePath::getUserDataDirectory() + "/hitches/hitch-" +
+		Common::DateTime(Common::DateTime::kUTC).formatDateTimeISO('T') + ".json";
+
+	try {
+		Common::FilePath::createDirectories(Common::FilePath::getDirectory(file));
+
+		ProfilerMan.dumpChromeTrace(file, since);
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed to write the frame hitch capture \"%s\"", file.c_str());
+		return;
+	}
+
+	warning("Frame took %.1f ms, captured the last %u frames into \"%s\"", frameTime,
+	        (uint)MIN<size_t>(_frameCount, kFrameCount), file.c_str());
+}
+
+} // End of namespace Graphics
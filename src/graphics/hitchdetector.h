@@ -0,0 +1,84 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Detecting frames that took too long, and capturing what happened in them.
+ */
+
+#ifndef GRAPHICS_HITCHDETECTOR_H
+#define GRAPHICS_HITCHDETECTOR_H
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+#include "src/common/debugman.h"
+
+namespace Graphics {
+
+/** Watches the frame times, capturing the frames around a hitch.
+ *
+ *  When a frame takes longer than the threshold, the profiler zones and
+ *  notes of the last few frames are written into a timestamped Chrome
+ *  trace event file in the "hitches" directory of the user data directory.
+ *  The notes show which resources were loaded, which scripts ran and what
+ *  was uploaded to the GPU. The metrics that changed during the slow frame
+ *  are added as notes, too.
+ *
+ *  Since the capture comes out of the profiler's ring buffers, the profiler
+ *  has to be enabled for the detector to do anything.
+ *
+ *  All methods have to be called from the main thread.
+ */
+class HitchDetector : boost::noncopyable {
+public:
+	/** The number of frames written into a capture, including the slow one. */
+	static const size_t kFrameCount = 8;
+
+	HitchDetector();
+	~HitchDetector();
+
+	/** Return the frame time, in milliseconds, above which a frame is captured. 0 means disabled. */
+	uint32_t getThreshold() const;
+	/** Set the frame time, in milliseconds, above which a frame is captured. 0 disables the detector. */
+	void setThreshold(uint32_t threshold);
+
+	/** A new frame starts. If the last one took too long, capture it. */
+	void beginFrame();
+
+private:
+	/** Minimum time between two captures, so that a slow stretch doesn't flood the disk, in microseconds. */
+	static const uint64_t kCaptureInterval = 5000000;
+
+	uint32_t _threshold; ///< In milliseconds.
+
+	uint64_t _frameStarts[kFrameCount]; ///< Ring buffer of the start times of the last frames, in microseconds.
+	size_t   _frameCount;               ///< The number of frames ever started.
+
+	uint64_t _metrics[Common::kMetricCount]; ///< The metrics at the start of the last frame.
+
+	uint64_t _lastCapture; ///< When the last capture was written, in microseconds.
+
+	void capture(uint64_t start, uint64_t end);
+};
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_HITCHDETECTOR_H
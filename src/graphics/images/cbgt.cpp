@@ -22,6 +22,7 @@
  *  Compressed BackGround Tiles, a BioWare image format found in Sonic.
  */
 
+#include <cassert>
 #include <cstdio>
 #include <cstring>
 
@@ -36,57 +37,48 @@
 
 namespace Graphics {
 
-CBGT::ReadContext::ReadContext(Common::SeekableReadStream &c,
-                               Common::SeekableReadStream &p,
-                               Common::SeekableReadStream &t) :
-	cbgt(&c), pal(&p), twoda(&t) {
-}
+CBGTCells::CBGTCells(Common::SeekableReadStream *cbgt, Common::SeekableReadStream &pal,
+                     Common::SeekableReadStream &twoda) : _cbgt(cbgt), _width(0), _height(0),
+	_maxPaletteIndex(0) {
 
+	assert(_cbgt);
 
-CBGT::CBGT(Common::SeekableReadStream &cbgt, Common::SeekableReadStream &pal,
-           Common::SeekableReadStream &twoda) {
+	readPalettes(pal);
+	readPaletteIndices(twoda);
+	readCells();
 
-	ReadContext ctx(cbgt, pal, twoda);
-
-	try {
-		load(ctx);
-	} catch (Common::Exception &e) {
-		e.add("Failed reading CBGT file");
-		throw;
-	}
+	checkConsistency();
 }
 
-CBGT::~CBGT() {
+CBGTCells::~CBGTCells() {
 }
 
-void CBGT::load(ReadContext &ctx) {
-	readPalettes(ctx);
-	readPaletteIndices(ctx);
-	readCells(ctx);
-
-	checkConsistency(ctx);
+uint32_t CBGTCells::getWidth() const {
+	return _width;
+}
 
-	drawImage(ctx);
+uint32_t CBGTCells::getHeight() const {
+	return _height;
 }
 
-void CBGT::readPalettes(ReadContext &ctx) {
+void CBGTCells::readPalettes(Common::SeekableReadStream &pal) {
 	/* Read the palette data, several plain palettes of 256 BGR555 entries. */
 
 	try {
-		ctx.pal->seek(0);
+		pal.seek(0);
 
-		size_t size = ctx.pal->size();
-		ctx.palettes.reserve((size + 1) / 512);
+		size_t size = pal.size();
+		_palettes.reserve((size + 1) / 512);
 
 		while (size > 0) {
 			const uint32_t paletteSize = MIN<size_t>(512, size);
 
-			ctx.palettes.emplace_back(std::make_unique<byte[]>(768));
-			byte *palette = ctx.palettes.back().get();
+			_palettes.emplace_back(std::make_unique<byte[]>(768));
+			byte *palette = _palettes.back().get();
 
 			const uint32_t colorCount = (paletteSize / 2) * 3;
 			for (uint32_t i = 0; i < colorCount; i += 3) {
-				const uint16_t color = ctx.pal->readUint16LE();
+				const uint16_t color = pal.readUint16LE();
 
 				palette[i + 0] = ((color >> 10) & 0x1F) << 3;
 				palette[i + 1] = ((color >>  5) & 0x1F) << 3;
@@ -96,7 +88,7 @@ void CBGT::readPalettes(ReadContext &ctx) {
 			size -= paletteSize;
 		}
 
-		if (ctx.palettes.empty())
+		if (_palettes.empty())
 			throw Common::Exception("No palettes");
 
 	} catch (Common::Exception &e) {
@@ -105,7 +97,7 @@ void CBGT::readPalettes(ReadContext &ctx) {
 	}
 }
 
-void CBGT::readPaletteIndices(ReadContext &ctx) {
+void CBGTCells::readPaletteIndices(Common::SeekableReadStream &twoda) {
 	/* Read the 2DA file providing the palette index mapping, as well as the width
 	 * and height of the final image (by way of number of cells in X and Y direction).
 	 *
@@ -126,17 +118,17 @@ void CBGT::readPaletteIndices(ReadContext &ctx) {
 	 */
 
 	try {
-		Aurora::TwoDAFile twoDA(*ctx.twoda);
+		Aurora::TwoDAFile twoDA(twoda);
 
-		ctx.width  = twoDA.getColumnCount() * 64;
-		ctx.height = twoDA.getRowCount()    * 64;
+		_width  = twoDA.getColumnCount() * 64;
+		_height = twoDA.getRowCount()    * 64;
 
-		if ((ctx.width == 0) || (ctx.width >= 0x8000) || (ctx.height == 0) || (ctx.height >= 0x8000))
-			throw Common::Exception("Dimensions of %ux%u", ctx.width, ctx.height);
+		if ((_width == 0) || (_width >= 0x8000) || (_height == 0) || (_height >= 0x8000))
+			throw Common::Exception("Dimensions of %ux%u", _width, _height);
 
-		ctx.maxPaletteIndex = 0;
+		_maxPaletteIndex = 0;
 
-		ctx.paletteIndices.reserve(twoDA.getColumnCount() * twoDA.getRowCount());
+		_paletteIndices.reserve(twoDA.getColumnCount() * twoDA.getRowCount());
 		for (uint32_t i = 0; i < twoDA.getRowCount(); i++) {
 			const Aurora::TwoDARow &row = twoDA.getRow(i);
 
@@ -149,9 +141,9 @@ void CBGT::readPaletteIndices(ReadContext &ctx) {
 				if ((n != 1) || (index < 0))
 					throw Common::Exception("Failed to parse \"%s\" into a palette index", palette.c_str());
 
-				ctx.paletteIndices.push_back((size_t)index);
+				_paletteIndices.push_back((size_t)index);
 
-				ctx.maxPaletteIndex = MAX<size_t>(ctx.maxPaletteIndex, index);
+				_maxPaletteIndex = MAX<size_t>(_maxPaletteIndex, index);
 			}
 		}
 
@@ -161,38 +153,33 @@ void CBGT::readPaletteIndices(ReadContext &ctx) {
 	}
 }
 
-void CBGT::readCells(ReadContext &ctx) {
-	/* Read the cell data, each containing 64x64 pixels. Of course, since this
-	 * is a *compressed* format, the data is compressed using the LZSS algorithm
-	 * also used for .small files. */
+void CBGTCells::readCells() {
+	/* Read the offsets and sizes of the cells, each containing 64x64 pixels.
+	 * Of course, since this is a *compressed* format, the data is compressed
+	 * using the LZSS algorithm also used for .small files. We only decompress
+	 * a cell once it's drawn. */
 
-	ctx.cells.reserve(4096);
+	_cells.reserve(4096);
 
 	try {
-		// Read the cell offset and sizes
-		for (size_t i = 0; i < 4096; i++) {
-			const uint32_t size   = ctx.cbgt->readUint16LE();
-			const uint32_t offset = ctx.cbgt->readUint16LE() * 512;
-
-			if (offset < 0x4000)
-				break;
+		_cbgt->seek(0);
 
-			ctx.cells.emplace_back(nullptr);
-			if (size == 0)
-				continue;
+		for (size_t i = 0; i < 4096; i++) {
+			Cell cell;
 
-			size_t pos = ctx.cbgt->pos();
+			cell.size   = _cbgt->readUint16LE();
+			cell.offset = _cbgt->readUint16LE() * 512;
 
-			Common::SeekableSubReadStream cellData(ctx.cbgt, offset, offset + size);
-			ctx.cells.back().reset(Aurora::Small::decompress(cellData));
+			if (cell.offset < 0x4000)
+				break;
 
-			if (ctx.cells.back()->size() != 4096)
-				throw Common::Exception("Invalid size for cell %u: %u", (uint)i, (uint)ctx.cells.back()->size());
+			if ((cell.size > 0) && ((cell.offset + cell.size) > _cbgt->size()))
+				throw Common::Exception("Cell %u out of range", (uint)i);
 
-			ctx.cbgt->seek(pos);
+			_cells.push_back(cell);
 		}
 
-		if (ctx.cells.empty())
+		if (_cells.empty())
 			throw Common::Exception("No cells");
 
 	} catch (Common::Exception &e) {
@@ -201,32 +188,31 @@ void CBGT::readCells(ReadContext &ctx) {
 	}
 }
 
-void CBGT::checkConsistency(ReadContext &ctx) {
-	if (ctx.cells.size() != ctx.paletteIndices.size())
+void CBGTCells::checkConsistency() {
+	if (_cells.size() != _paletteIndices.size())
 		throw Common::Exception("%u palette indices for %u cells",
-		                        (uint)ctx.cells.size(), (uint)ctx.paletteIndices.size());
+		                        (uint)_cells.size(), (uint)_paletteIndices.size());
 
-	if (ctx.maxPaletteIndex >= ctx.palettes.size())
+	if (_maxPaletteIndex >= _palettes.size())
 		throw Common::Exception("Palette index %u out of range (%u)",
-		                        (uint)ctx.maxPaletteIndex, (uint)ctx.palettes.size());
+		                        (uint)_maxPaletteIndex, (uint)_palettes.size());
 }
 
-void CBGT::createImage(uint32_t width, uint32_t height) {
-	_format    = kPixelFormatBGRA;
-	_formatRaw = kPixelFormatRGBA8;
-	_dataType  = kPixelDataType8;
+ImageDecoder *CBGTCells::decodeRegion(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+	if (((x % 64) != 0) || ((y % 64) != 0) || ((width % 64) != 0) || ((height % 64) != 0))
+		throw Common::Exception("CBGT region %u+%u, %u+%u not aligned to cells", x, width, y, height);
 
-	_mipMaps.emplace_back(std::make_unique<MipMap>(this));
-	_mipMaps.back()->width  = width;
-	_mipMaps.back()->height = height;
-	_mipMaps.back()->size   = width * height * 4;
+	if ((x >= _width) || (y >= _height))
+		throw Common::Exception("CBGT region %u, %u outside of the image (%ux%u)", x, y, _width, _height);
 
-	_mipMaps.back()->data = std::make_unique<byte[]>(_mipMaps.back()->size);
-	std::memset(_mipMaps.back()->data.get(), 0, _mipMaps.back()->size);
+	width  = MIN(width , _width  - x);
+	height = MIN(height, _height - y);
+
+	return new CBGT(*this, x, y, width, height);
 }
 
-void CBGT::drawImage(ReadContext &ctx) {
-	/* Draw the actual image data.
+void CBGTCells::drawCell(size_t index, byte *data, uint32_t width, uint32_t height, uint32_t x, uint32_t y) {
+	/* Draw the image data of one cell.
 	 *
 	 * The image is made up of 64x64 pixel cells, each consisting of 64 8x8 pixel tiles.
 	 * This would be 2x1 cells, each with 64 tiles, and each of those would be 8x8 pixel wide:
@@ -242,62 +228,118 @@ void CBGT::drawImage(ReadContext &ctx) {
 	 *
 	 * This unswizzling of the data makes it...a bit complex. */
 
-	createImage(ctx.width, ctx.height);
+	static const uint32_t kCellSize = 64;
+	static const uint32_t kTileSize = 8;
+	static const uint32_t kTiles    = kCellSize / kTileSize;
 
+	const Cell &cell = _cells[index];
+	if (cell.size == 0)
+		return;
 
-	const uint32_t cellWidth  = 64;
-	const uint32_t cellHeight = 64;
-	const uint32_t cellsX     = ctx.width  / cellWidth;
+	Common::SeekableSubReadStream cellData(_cbgt.get(), cell.offset, cell.offset + cell.size);
+	std::unique_ptr<Common::SeekableReadStream> pixels(Aurora::Small::decompress(cellData));
 
-	const uint32_t tileWidth  = 8;
-	const uint32_t tileHeight = 8;
-	const uint32_t tilesX     = cellWidth  / tileWidth;
-	const uint32_t tilesY     = cellHeight / tileHeight;
+	if (pixels->size() != (kCellSize * kCellSize))
+		throw Common::Exception("Invalid size for cell %u: %u", (uint)index, (uint)pixels->size());
 
-	byte *data = _mipMaps.back()->data.get();
-	for (size_t i = 0; i < ctx.cells.size(); i++) {
-		Common::SeekableReadStream *cell = ctx.cells[i].get();
-		if (!cell)
-			continue;
+	const byte *palette = _palettes[_paletteIndices[index]].get();
+	const bool is0Transp = (palette[0] == 0xF8) && (palette[1] == 0x00) && (palette[2] == 0xF8);
 
-		const uint32_t xC = i % cellsX;
-		const uint32_t yC = i / cellsX;
+	// Go over all tiles
+	for (uint32_t yT = 0; yT < kTiles; yT++) {
+		for (uint32_t xT = 0; xT < kTiles; xT++) {
 
-		const byte *palette = ctx.palettes[ctx.paletteIndices[i]].get();
-		const bool is0Transp = (palette[0] == 0xF8) && (palette[1] == 0x00) && (palette[2] == 0xF8);
+			// Go over all pixels in the tile
+			for (uint32_t yP = 0; yP < kTileSize; yP++) {
+				for (uint32_t xP = 0; xP < kTileSize; xP++) {
 
-		// Pixel position of this cell within the big image
-		const uint32_t imagePos = yC * cellHeight * ctx.width + xC * cellWidth;
+					// Position of the pixel within the image
+					const uint32_t pX = x + xT * kTileSize + xP;
+					const uint32_t pY = y + yT * kTileSize + yP;
 
-		// Go over all tiles
-		for (uint32_t yT = 0; yT < tilesY; yT++) {
-			for (uint32_t xT = 0; xT < tilesX; xT++) {
+					const uint8_t pixel = pixels->readByte();
 
-				// Position of the tile within the cell
-				const uint32_t tilePos = xT * tileWidth + yT * tileHeight * ctx.width;
+					if ((pX >= width) || (pY >= height))
+						continue;
 
-				// Go over all pixels in the tile
-				for (uint32_t y = 0; y < tileHeight; y++) {
-					for (uint32_t x = 0; x < tileWidth; x++) {
+					byte *dst = data + (pY * width + pX) * 4;
 
-						// Position of the pixel within the tile
-						const uint32_t pos   = imagePos + tilePos + x + y * ctx.width;
-						const uint8_t  pixel = cell->readByte();
+					dst[0] = palette[pixel * 3 + 0];
+					dst[1] = palette[pixel * 3 + 1];
+					dst[2] = palette[pixel * 3 + 2];
+					dst[3] = ((pixel == 0) && is0Transp) ? 0x00 : 0xFF;
+				}
+			}
 
-						if (pos > (ctx.width * ctx.height))
-							continue;
+		}
+	}
+}
 
-						data[pos * 4 + 0] = palette[pixel * 3 + 0];
-						data[pos * 4 + 1] = palette[pixel * 3 + 1];
-						data[pos * 4 + 2] = palette[pixel * 3 + 2];
-						data[pos * 4 + 3] = ((pixel == 0) && is0Transp) ? 0x00 : 0xFF;
 
-					}
-				}
+CBGT::CBGT(Common::SeekableReadStream &cbgt, Common::SeekableReadStream &pal,
+           Common::SeekableReadStream &twoda) {
 
-			}
-		}
+	try {
+		CBGTCells cells(new Common::SeekableSubReadStream(&cbgt, 0, cbgt.size()), pal, twoda);
 
+		createImage(cells.getWidth(), cells.getHeight());
+		drawImage(cells, 0, 0);
+
+	} catch (Common::Exception &e) {
+		e.add("Failed reading CBGT file");
+		throw;
+	}
+}
+
+CBGT::CBGT(CBGTCells &cells, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+	try {
+		createImage(width, height);
+		drawImage(cells, x, y);
+
+	} catch (Common::Exception &e) {
+		e.add("Failed reading CBGT file");
+		throw;
+	}
+}
+
+CBGT::~CBGT() {
+}
+
+void CBGT::createImage(uint32_t width, uint32_t height) {
+	_format    = kPixelFormatBGRA;
+	_formatRaw = kPixelFormatRGBA8;
+	_dataType  = kPixelDataType8;
+
+	_mipMaps.emplace_back(std::make_unique<MipMap>(this));
+	_mipMaps.back()->width  = width;
+	_mipMaps.back()->height = height;
+	_mipMaps.back()->size   = width * height * 4;
+
+	_mipMaps.back()->data = std::make_unique<byte[]>(_mipMaps.back()->size);
+	std::memset(_mipMaps.back()->data.get(), 0, _mipMaps.back()->size);
+}
+
+void CBGT::drawImage(CBGTCells &cells, uint32_t x, uint32_t y) {
+	/* Draw all cells overlapping the region of the image starting at x, y. */
+
+	MipMap &mipMap = *_mipMaps.back();
+
+	const uint32_t cellsX = cells.getWidth() / 64;
+
+	const uint32_t cellX1 = x / 64;
+	const uint32_t cellY1 = y / 64;
+	const uint32_t cellX2 = (x + mipMap.width  + 63) / 64;
+	const uint32_t cellY2 = (y + mipMap.height + 63) / 64;
+
+	for (uint32_t yC = cellY1; yC < cellY2; yC++) {
+		for (uint32_t xC = cellX1; xC < cellX2; xC++) {
+			const size_t index = yC * cellsX + xC;
+			if (index >= cells._cells.size())
+				continue;
+
+			cells.drawCell(index, mipMap.data.get(), mipMap.width, mipMap.height,
+			               xC * 64 - x, yC * 64 - y);
+		}
 	}
 }
 
@@ -28,6 +28,8 @@
 #include <vector>
 #include <memory>
 
+#include <boost/noncopyable.hpp>
+
 #include "src/graphics/images/decoder.h"
 
 namespace Common {
@@ -36,6 +38,65 @@ namespace Common {
 
 namespace Graphics {
 
+/** Random access to the cells of a CBGT image.
+ *
+ *  Opening only reads the palettes, the palette mapping and the cell
+ *  offsets. A cell is decompressed only when a region of the image
+ *  containing it is decoded. Big backgrounds can thus be turned into
+ *  textures piece by piece, when they're needed.
+ */
+class CBGTCells : boost::noncopyable {
+public:
+	/** Take over the CBGT stream and read the layout of its cells. */
+	CBGTCells(Common::SeekableReadStream *cbgt, Common::SeekableReadStream &pal,
+	          Common::SeekableReadStream &twoda);
+	~CBGTCells();
+
+	/** Return the width of the whole image, in pixels. */
+	uint32_t getWidth() const;
+	/** Return the height of the whole image, in pixels. */
+	uint32_t getHeight() const;
+
+	/** Decode a region of the image.
+	 *
+	 *  All coordinates are in pixels and need to be multiples of the cell
+	 *  size of 64 pixels. The region is clipped to the image.
+	 */
+	ImageDecoder *decodeRegion(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+private:
+	typedef std::vector<std::unique_ptr<byte[]>> Palettes;
+	typedef std::vector<size_t> PaletteIndices;
+
+	/** Where a cell's compressed data is found within the CBGT. */
+	struct Cell {
+		uint32_t offset;
+		uint32_t size;   ///< 0 for an empty cell.
+	};
+
+	std::unique_ptr<Common::SeekableReadStream> _cbgt;
+
+	Palettes _palettes;
+	PaletteIndices _paletteIndices;
+	std::vector<Cell> _cells;
+
+	uint32_t _width;
+	uint32_t _height;
+
+	size_t _maxPaletteIndex;
+
+	void readPalettes(Common::SeekableReadStream &pal);
+	void readPaletteIndices(Common::SeekableReadStream &twoda);
+	void readCells();
+
+	void checkConsistency();
+
+	/** Decompress a cell and draw it into an image of this width, at this pixel position. */
+	void drawCell(size_t index, byte *data, uint32_t width, uint32_t height, uint32_t x, uint32_t y);
+
+	friend class CBGT;
+};
+
 /** Loader for CBGT, BioWare's Compressed BackGround Tiles, an image
  *  format found in Sonic, used as area background images.
  *
@@ -52,6 +113,8 @@ namespace Graphics {
  *  in a two-dimensional array of those dimensions. Therefore, multi-
  *  plying the number of columns and rows in said 2DA by 64 yields
  *  the width and height, respectively, of the final image.
+ *
+ *  To only decode parts of a big image, see CBGTCells.
  */
 class CBGT : public ImageDecoder {
 public:
@@ -60,39 +123,13 @@ public:
 	~CBGT();
 
 private:
-	typedef std::vector<std::unique_ptr<byte[]>> Palettes;
-	typedef std::vector<size_t> PaletteIndices;
-	typedef std::vector<std::unique_ptr<Common::SeekableReadStream>> Cells;
-
-	struct ReadContext {
-		Common::SeekableReadStream *cbgt;
-		Common::SeekableReadStream *pal;
-		Common::SeekableReadStream *twoda;
-
-		Palettes palettes;
-		PaletteIndices paletteIndices;
-		Cells cells;
-
-		uint32_t width;
-		uint32_t height;
-
-		size_t maxPaletteIndex;
-
-		ReadContext(Common::SeekableReadStream &c,
-		            Common::SeekableReadStream &p,
-		            Common::SeekableReadStream &t);
-	};
-
-	void load(ReadContext &ctx);
-
-	void readPalettes(ReadContext &ctx);
-	void readPaletteIndices(ReadContext &ctx);
-	void readCells(ReadContext &ctx);
-
-	void checkConsistency(ReadContext &ctx);
+	/** Decode a region of the image, in pixels. */
+	CBGT(CBGTCells &cells, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
 
 	void createImage(uint32_t width, uint32_t height);
-	void drawImage(ReadContext &ctx);
+	void drawImage(CBGTCells &cells, uint32_t x, uint32_t y);
+
+	friend class CBGTCells;
 };
 
 } // End of namespace Graphics
@@ -28,7 +28,7 @@
 
 #include "src/common/util.h"
 #include "src/common/error.h"
-#include "src/common/memreadstream.h"
+#include "src/common/threadpool.h"
 
 #include "src/graphics/graphics.h"
 
@@ -45,6 +45,9 @@ ImageDecoder::MipMap::MipMap(const ImageDecoder *i) : image(i) {
 ImageDecoder::MipMap::MipMap(const MipMap &mipMap, const ImageDecoder *i) :
 	width(mipMap.width), height(mipMap.height), size(mipMap.size), image(i) {
 
+	if (!mipMap.data)
+		return;
+
 	data = std::make_unique<byte[]>(size);
 
 	std::memcpy(data.get(), mipMap.data.get(), size);
@@ -171,6 +174,33 @@ bool ImageDecoder::hasAlpha() const {
 	return _hasAlpha;
 }
 
+bool ImageDecoder::hasData() const {
+	for (MipMaps::const_iterator m = _mipMaps.begin(); m != _mipMaps.end(); ++m)
+		if (!(*m)->data)
+			return false;
+
+	return true;
+}
+
+void ImageDecoder::releaseData() {
+	for (MipMaps::iterator m = _mipMaps.begin(); m != _mipMaps.end(); ++m)
+		(*m)->data.reset();
+}
+
+bool ImageDecoder::takeData(ImageDecoder &image) {
+	if ((image._mipMaps.size() != _mipMaps.size()) || (image._formatRaw != _formatRaw))
+		return false;
+
+	for (size_t i = 0; i < _mipMaps.size(); i++)
+		if ((image._mipMaps[i]->size != _mipMaps[i]->size) || !image._mipMaps[i]->data)
+			return false;
+
+	for (size_t i = 0; i < _mipMaps.size(); i++)
+		_mipMaps[i]->data.swap(image._mipMaps[i]->data);
+
+	return true;
+}
+
 PixelFormat ImageDecoder::getFormat() const {
 	return _format;
 }
@@ -227,27 +257,26 @@ void ImageDecoder::decompress(MipMap &out, const MipMap &in, PixelFormatRaw form
 
 	out.data = std::make_unique<byte[]>(out.size);
 
-	std::unique_ptr<Common::MemoryReadStream> stream = std::make_unique<Common::MemoryReadStream>(in.data.get(), in.size);
-
 	if      (format == kPixelFormatDXT1)
-		decompressDXT1(out.data.get(), *stream, out.width, out.height, out.width * 4);
+		decompressDXT1(out.data.get(), in.data.get(), in.size, out.width, out.height, out.width * 4);
 	else if (format == kPixelFormatDXT3)
-		decompressDXT3(out.data.get(), *stream, out.width, out.height, out.width * 4);
+		decompressDXT3(out.data.get(), in.data.get(), in.size, out.width, out.height, out.width * 4);
 	else if (format == kPixelFormatDXT5)
-		decompressDXT5(out.data.get(), *stream, out.width, out.height, out.width * 4);
+		decompressDXT5(out.data.get(), in.data.get(), in.size, out.width, out.height, out.width * 4);
 }
 
 void ImageDecoder::decompress() {
 	if (!_compressed)
 		return;
 
-	for (MipMaps::iterator m = _mipMaps.begin(); m != _mipMaps.end(); ++m) {
+	// All mip maps of all layers are independent
+	ThreadPoolMan.parallelFor(_mipMaps.size(), [this](size_t i) {
 		MipMap decompressed(this);
 
-		decompress(decompressed, **m, _formatRaw);
+		decompress(decompressed, *_mipMaps[i], _formatRaw);
 
-		decompressed.swap(**m);
-	}
+		decompressed.swap(*_mipMaps[i]);
+	});
 
 	_format     = kPixelFormatRGBA;
 	_formatRaw  = kPixelFormatRGBA8;
@@ -255,6 +284,120 @@ void ImageDecoder::decompress() {
 	_compressed = false;
 }
 
+bool ImageDecoder::canCompress() const {
+	if (_compressed || (_dataType != kPixelDataType8) || (_layerCount != 1) || _mipMaps.empty() || !hasData())
+		return false;
+
+	if ((_formatRaw != kPixelFormatRGBA8) && (_formatRaw != kPixelFormatRGB8))
+		return false;
+
+	// The base image needs to be made of whole blocks
+	return ((_mipMaps[0]->width % 4) == 0) && ((_mipMaps[0]->height % 4) == 0);
+}
+
+/** Convert a mip map of 8-bit RGB, BGR, RGBA or BGRA pixels into RGBA8. */
+static void convertToRGBA8(ImageDecoder::MipMap &mipMap, PixelFormat format, PixelFormatRaw formatRaw) {
+	const size_t pixels = (size_t)mipMap.width * mipMap.height;
+	const size_t bpp    = (formatRaw == kPixelFormatRGB8) ? 3 : 4;
+
+	if (mipMap.size < (pixels * bpp))
+		throw Common::Exception("Not enough pixel data for %dx%d pixels", mipMap.width, mipMap.height);
+
+	if ((format == kPixelFormatRGBA) && (bpp == 4))
+		return;
+
+	const bool bgr = (format == kPixelFormatBGR) || (format == kPixelFormatBGRA);
+
+	std::unique_ptr<byte[]> converted = std::make_unique<byte[]>(pixels * 4);
+
+	const byte *src  = mipMap.data.get();
+	      byte *dest = converted.get();
+	for (size_t i = 0; i < pixels; i++, src += bpp, dest += 4) {
+		dest[0] = src[bgr ? 2 : 0];
+		dest[1] = src[1];
+		dest[2] = src[bgr ? 0 : 2];
+		dest[3] = (bpp == 4) ? src[3] : 0xFF;
+	}
+
+	mipMap.data.swap(converted);
+	mipMap.size = pixels * 4;
+}
+
+/** Create the next smaller RGBA8 mip map, averaging each 2x2 pixel square. */
+static void halveRGBA8(ImageDecoder::MipMap &out, const ImageDecoder::MipMap &in) {
+	out.width  = MAX(in.width  / 2, 1);
+	out.height = MAX(in.height / 2, 1);
+	out.size   = out.width * out.height * 4;
+
+	out.data = std::make_unique<byte[]>(out.size);
+
+	for (int y = 0; y < out.height; y++) {
+		const byte *row0 = in.data.get() + MIN(y * 2    , in.height - 1) * in.width * 4;
+		const byte *row1 = in.data.get() + MIN(y * 2 + 1, in.height - 1) * in.width * 4;
+
+		byte *dest = out.data.get() + y * out.width * 4;
+
+		for (int x = 0; x < out.width; x++, dest += 4) {
+			const int x0 = MIN(x * 2    , in.width - 1) * 4;
+			const int x1 = MIN(x * 2 + 1, in.width - 1) * 4;
+
+			for (int c = 0; c < 4; c++)
+				dest[c] = (row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) / 4;
+		}
+	}
+}
+
+void ImageDecoder::compress(MipMap &out, const MipMap &in, PixelFormatRaw format) {
+	out.width  = in.width;
+	out.height = in.height;
+	out.size   = getDataSize(format, out.width, out.height);
+
+	out.data = std::make_unique<byte[]>(out.size);
+
+	if (format == kPixelFormatDXT1)
+		compressDXT1(out.data.get(), in.data.get(), out.width, out.height, out.width * 4);
+	else
+		compressDXT5(out.data.get(), in.data.get(), out.width, out.height, out.width * 4);
+}
+
+void ImageDecoder::compress() {
+	if (!canCompress())
+		return;
+
+	// The encoder wants RGBA8 pixels
+	ThreadPoolMan.parallelFor(_mipMaps.size(), [this](size_t i) {
+		convertToRGBA8(*_mipMaps[i], _format, _formatRaw);
+	});
+
+	_format    = kPixelFormatRGBA;
+	_formatRaw = kPixelFormatRGBA8;
+
+	// The GPU can't reliably generate mip maps for compressed textures, so we have to do it here
+	if (_mipMaps.size() == 1) {
+		while ((_mipMaps.back()->width > 1) || (_mipMaps.back()->height > 1)) {
+			std::unique_ptr<MipMap> mipMap = std::make_unique<MipMap>(this);
+
+			halveRGBA8(*mipMap, *_mipMaps.back());
+			_mipMaps.push_back(std::move(mipMap));
+		}
+	}
+
+	const PixelFormatRaw format = _hasAlpha ? kPixelFormatDXT5 : kPixelFormatDXT1;
+
+	ThreadPoolMan.parallelFor(_mipMaps.size(), [this, format](size_t i) {
+		MipMap compressed(this);
+
+		compress(compressed, *_mipMaps[i], format);
+
+		compressed.swap(*_mipMaps[i]);
+	});
+
+	_format     = _hasAlpha ? kPixelFormatRGBA : kPixelFormatRGB;
+	_formatRaw  = format;
+	_dataType   = kPixelDataType8;
+	_compressed = true;
+}
+
 bool ImageDecoder::dumpTGA(const Common::UString &fileName) const {
 	if (_mipMaps.size() < 1)
 		return false;
@@ -107,6 +107,21 @@ public:
 	/** Manually decompress the texture image data. */
 	void decompress();
 
+	/** Can the texture image data be compressed? */
+	bool canCompress() const;
+	/** Compress uncompressed texture image data into DXT1, or DXT5 if it has alpha.
+	 *
+	 *  An image without mip maps gets a full chain of them generated first.
+	 */
+	void compress();
+
+	/** Is the pixel data of the mip maps available? */
+	bool hasData() const;
+	/** Free the pixel data of all mip maps, keeping everything else. */
+	void releaseData();
+	/** Take over the pixel data of an image with the same layout. Returns false if they don't match. */
+	bool takeData(ImageDecoder &image);
+
 	/** Return the texture information TXI, which may be embedded in the image. */
 	const TXI &getTXI() const;
 
@@ -133,6 +148,7 @@ protected:
 	TXI _txi;
 
 	static void decompress(MipMap &out, const MipMap &in, PixelFormatRaw format);
+	static void compress(MipMap &out, const MipMap &in, PixelFormatRaw format);
 };
 
 } // End of namespace Graphics
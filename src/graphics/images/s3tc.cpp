@@ -19,201 +19,526 @@
  */
 
 /** @file
- *  Manual S3TC DXTn decompression methods.
+ *  Manual S3TC DXTn compression and decompression methods.
  */
 
+/* The blocks are decoded straight out of memory. Each block is first turned
+ * into a palette of four colors, the 2-bit palette indices and, for DXT3/5,
+ * the alpha values of its 16 pixels. The pixels are then put together four
+ * at a time, one block row per vector, by selecting the palette entries with
+ * compare masks. Large images are split into horizontal strips of blocks,
+ * which are decoded in parallel.
+ *
+ * The encoder is a fast one, meant for compressing textures at load time.
+ * The color endpoints are the corners of the bounding box of the block's
+ * colors, inset slightly and flipped onto the diagonal that follows the
+ * colors' spread. Each pixel then gets the palette entry closest to it.
+ * DXT5 alpha is encoded the same way, using the block's alpha range.
+ */
+
+#include <cstring>
+
+#include <algorithm>
+
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+	#include <arm_neon.h>
+#endif
+
 #include "src/common/util.h"
-#include "src/common/readstream.h"
+#include "src/common/endianness.h"
+#include "src/common/error.h"
+#include "src/common/threadpool.h"
 
 #include "src/graphics/images/s3tc.h"
 
 namespace Graphics {
 
-static inline uint32_t convert565To8888(uint16_t color) {
-	return ((color & 0x1F) << 11) | ((color & 0x7E0) << 13) | ((color & 0xF800) << 16) | 0xFF;
-}
-
-static inline uint32_t interpolate32(double weight, uint32_t color_0, uint32_t color_1) {
-	byte r[3], g[3], b[3], a[3];
-	r[0] = color_0 >> 24;
-	r[1] = color_1 >> 24;
-	r[2] = (byte)((1.0f - weight) * (double)r[0] + weight * (double)r[1]);
-	g[0] = (color_0 >> 16) & 0xFF;
-	g[1] = (color_1 >> 16) & 0xFF;
-	g[2] = (byte)((1.0f - weight) * (double)g[0] + weight * (double)g[1]);
-	b[0] = (color_0 >> 8) & 0xFF;
-	b[1] = (color_1 >> 8) & 0xFF;
-	b[2] = (byte)((1.0f - weight) * (double)b[0] + weight * (double)b[1]);
-	a[0] = color_0 & 0xFF;
-	a[1] = color_1 & 0xFF;
-	a[2] = (byte)((1.0f - weight) * (double)a[0] + weight * (double)a[1]);
-	return r[2] << 24 | g[2] << 16 | b[2] << 8 | a[2];
-}
-
-struct DXT1Texel {
-	uint16_t color_0;
-	uint16_t color_1;
-	uint32_t pixels;
+/** Only split the (de)compression over several threads if each gets at least that many blocks. */
+static const size_t kMinBlocksPerThread = 4096;
+
+#if defined(XOREOS_BIG_ENDIAN)
+static const int kAlphaShift = 0;
+#else
+static const int kAlphaShift = 24;
+#endif
+
+/** Masks for the 2-bit palette indices of the four pixels in a block row. */
+static const uint32_t kIndexMask[4] = { 0x03, 0x0C, 0x30, 0xC0 };
+/** Masked palette indices that select the second palette entry. */
+static const uint32_t kIndexOne [4] = { 0x01, 0x04, 0x10, 0x40 };
+/** Masked palette indices that select the third palette entry. */
+static const uint32_t kIndexTwo [4] = { 0x02, 0x08, 0x20, 0x80 };
+
+/** A decoded 4x4 pixel block. */
+struct DecodedBlock {
+	uint32_t palette[4]; ///< The four colors of the block, as RGBA8 pixels.
+	uint32_t indices;    ///< The 2-bit palette indices, 8 bits per row, first row in the lowest byte.
+
+	bool hasAlpha;       ///< Are the alpha values separate from the palette?
+	byte alpha[16];      ///< The alpha values, row by row.
 };
 
-#define READ_DXT1_TEXEL(x) \
-	x.color_0 = src.readUint16LE(); \
-	x.color_1 = src.readUint16LE(); \
-	x.pixels = src.readUint32BE()
-
-void decompressDXT1(byte *dest, Common::SeekableReadStream &src, uint32_t width, uint32_t height, uint32_t pitch) {
-	for (int32_t ty = height; ty > 0; ty -= 4) {
-		for (uint32_t tx = 0; tx < width; tx += 4) {
-			DXT1Texel tex;
-			READ_DXT1_TEXEL(tex);
-			uint32_t blended[4];
-
-			blended[0] = convert565To8888(tex.color_0);
-			blended[1] = convert565To8888(tex.color_1);
-
-			if (tex.color_0 > tex.color_1) {
-				blended[2] = interpolate32(0.333333f, blended[0], blended[1]);
-				blended[3] = interpolate32(0.666666f, blended[0], blended[1]);
-			} else {
-				blended[2] = interpolate32(0.5f, blended[0], blended[1]);
-				blended[3] = 0;
-			}
+typedef void (*BlockDecoder)(DecodedBlock &block, const byte *src);
+
+/** Pack a pixel so that its components lie in R, G, B, A order in memory. */
+static inline uint32_t packPixel(uint32_t r, uint32_t g, uint32_t b, uint32_t a) {
+#if defined(XOREOS_BIG_ENDIAN)
+	return (r << 24) | (g << 16) | (b << 8) | a;
+#else
+	return r | (g << 8) | (b << 16) | (a << 24);
+#endif
+}
 
-			uint32_t cpx = tex.pixels;
-			uint32_t blockWidth = MIN<uint32_t>(width, 4);
-			uint32_t blockHeight = MIN<uint32_t>(height, 4);
+static inline void expand565(uint16_t color, uint32_t &r, uint32_t &g, uint32_t &b) {
+	r = (color >> 11) & 0x1F;
+	g = (color >>  5) & 0x3F;
+	b =  color        & 0x1F;
 
-			for (byte y = 0; y < blockHeight; ++y) {
-				for (byte x = 0; x < blockWidth; ++x) {
-					const uint32_t destX = tx + x;
-					const uint32_t destY = height - 1 - (ty - blockHeight + y);
+	r = (r << 3) | (r >> 2);
+	g = (g << 2) | (g >> 4);
+	b = (b << 3) | (b >> 2);
+}
 
-					const uint32_t pixel =  blended[cpx & 3];
+/** Decode the color half of a block.
+ *
+ *  DXT1 blocks can switch to a three color mode with one transparent
+ *  entry. DXT3/5 blocks always use four colors, with their alpha
+ *  coming from the other half of the block.
+ */
+static inline void decodeColors(DecodedBlock &block, const byte *src, bool dxt1) {
+	const uint16_t color0 = READ_LE_UINT16(src + 0);
+	const uint16_t color1 = READ_LE_UINT16(src + 2);
+
+	uint32_t r[4], g[4], b[4];
+	expand565(color0, r[0], g[0], b[0]);
+	expand565(color1, r[1], g[1], b[1]);
+
+	const uint32_t a = dxt1 ? 0xFF : 0x00;
+
+	block.palette[0] = packPixel(r[0], g[0], b[0], a);
+	block.palette[1] = packPixel(r[1], g[1], b[1], a);
+
+	if (!dxt1 || (color0 > color1)) {
+		r[2] = (2 * r[0] + r[1]) / 3;
+		g[2] = (2 * g[0] + g[1]) / 3;
+		b[2] = (2 * b[0] + b[1]) / 3;
+		r[3] = (r[0] + 2 * r[1]) / 3;
+		g[3] = (g[0] + 2 * g[1]) / 3;
+		b[3] = (b[0] + 2 * b[1]) / 3;
+
+		block.palette[2] = packPixel(r[2], g[2], b[2], a);
+		block.palette[3] = packPixel(r[3], g[3], b[3], a);
+	} else {
+		r[2] = (r[0] + r[1]) / 2;
+		g[2] = (g[0] + g[1]) / 2;
+		b[2] = (b[0] + b[1]) / 2;
+
+		block.palette[2] = packPixel(r[2], g[2], b[2], a);
+		block.palette[3] = 0;
+	}
 
-					cpx >>= 2;
+	block.indices = READ_LE_UINT32(src + 4);
+}
 
-					if ((destX < width) && (destY < height))
-						WRITE_BE_UINT32(dest + destY * pitch + destX * 4, pixel);
-				}
-			}
+static void decodeDXT1Block(DecodedBlock &block, const byte *src) {
+	block.hasAlpha = false;
+
+	decodeColors(block, src, true);
+}
+
+static void decodeDXT3Block(DecodedBlock &block, const byte *src) {
+	block.hasAlpha = true;
+
+	// Explicit 4-bit alpha values
+	for (size_t y = 0; y < 4; y++) {
+		const uint16_t row = READ_LE_UINT16(src + y * 2);
+
+		for (size_t x = 0; x < 4; x++)
+			block.alpha[y * 4 + x] = ((row >> (x * 4)) & 0xF) * 0x11;
+	}
+
+	decodeColors(block, src + 8, false);
+}
+
+static void decodeDXT5Block(DecodedBlock &block, const byte *src) {
+	block.hasAlpha = true;
+
+	// Interpolated alpha values, with 3-bit indices
+	uint32_t alphab[8];
+	alphab[0] = src[0];
+	alphab[1] = src[1];
+
+	if (alphab[0] > alphab[1]) {
+		for (uint32_t i = 1; i < 7; i++)
+			alphab[i + 1] = ((7 - i) * alphab[0] + i * alphab[1] + 3) / 7;
+	} else {
+		for (uint32_t i = 1; i < 5; i++)
+			alphab[i + 1] = ((5 - i) * alphab[0] + i * alphab[1] + 2) / 5;
+
+		alphab[6] = 0;
+		alphab[7] = 255;
+	}
+
+	const uint64_t indices = READ_LE_UINT32(src + 2) | ((uint64_t)READ_LE_UINT16(src + 6) << 32);
+	for (size_t i = 0; i < 16; i++)
+		block.alpha[i] = alphab[(indices >> (3 * i)) & 7];
+
+	decodeColors(block, src + 8, false);
+}
+
+/** Write the first width x height pixels of a decoded block. */
+static inline void writeBlock(byte *dest, uint32_t pitch, const DecodedBlock &block, uint32_t width, uint32_t height) {
+#if defined(__SSE2__)
+
+	const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i *>(kIndexMask));
+	const __m128i one  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(kIndexOne));
+	const __m128i two  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(kIndexTwo));
+
+	const __m128i color0 = _mm_set1_epi32(block.palette[0]);
+	const __m128i color1 = _mm_set1_epi32(block.palette[1]);
+	const __m128i color2 = _mm_set1_epi32(block.palette[2]);
+	const __m128i color3 = _mm_set1_epi32(block.palette[3]);
+
+	for (uint32_t y = 0; y < height; y++, dest += pitch) {
+		const __m128i bits = _mm_and_si128(_mm_set1_epi32((block.indices >> (y * 8)) & 0xFF), mask);
+
+		const __m128i is1 = _mm_cmpeq_epi32(bits, one);
+		const __m128i is2 = _mm_cmpeq_epi32(bits, two);
+		const __m128i is3 = _mm_cmpeq_epi32(bits, mask);
+
+		__m128i pixels = _mm_andnot_si128(_mm_or_si128(_mm_or_si128(is1, is2), is3), color0);
+		pixels = _mm_or_si128(pixels, _mm_and_si128(is1, color1));
+		pixels = _mm_or_si128(pixels, _mm_and_si128(is2, color2));
+		pixels = _mm_or_si128(pixels, _mm_and_si128(is3, color3));
+
+		if (block.hasAlpha) {
+			int32_t alpha;
+			std::memcpy(&alpha, block.alpha + y * 4, 4);
+
+			__m128i a = _mm_cvtsi32_si128(alpha);
+			a = _mm_unpacklo_epi8 (a, _mm_setzero_si128());
+			a = _mm_unpacklo_epi16(a, _mm_setzero_si128());
+
+			pixels = _mm_or_si128(pixels, _mm_slli_epi32(a, kAlphaShift));
+		}
+
+		if (width == 4) {
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dest), pixels);
+		} else {
+			uint32_t row[4];
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(row), pixels);
+			std::memcpy(dest, row, width * 4);
+		}
+	}
+
+#elif defined(__ARM_NEON)
+
+	const uint32x4_t mask = vld1q_u32(kIndexMask);
+	const uint32x4_t one  = vld1q_u32(kIndexOne);
+	const uint32x4_t two  = vld1q_u32(kIndexTwo);
+
+	const uint32x4_t color0 = vdupq_n_u32(block.palette[0]);
+	const uint32x4_t color1 = vdupq_n_u32(block.palette[1]);
+	const uint32x4_t color2 = vdupq_n_u32(block.palette[2]);
+	const uint32x4_t color3 = vdupq_n_u32(block.palette[3]);
+
+	for (uint32_t y = 0; y < height; y++, dest += pitch) {
+		const uint32x4_t bits = vandq_u32(vdupq_n_u32((block.indices >> (y * 8)) & 0xFF), mask);
+
+		uint32x4_t pixels = color0;
+		pixels = vbslq_u32(vceqq_u32(bits, one ), color1, pixels);
+		pixels = vbslq_u32(vceqq_u32(bits, two ), color2, pixels);
+		pixels = vbslq_u32(vceqq_u32(bits, mask), color3, pixels);
+
+		if (block.hasAlpha) {
+			const uint32x4_t a = {
+				block.alpha[y * 4 + 0], block.alpha[y * 4 + 1], block.alpha[y * 4 + 2], block.alpha[y * 4 + 3]
+			};
+
+			pixels = vorrq_u32(pixels, vshlq_n_u32(a, kAlphaShift));
+		}
+
+		uint32_t row[4];
+		vst1q_u32(row, pixels);
+		std::memcpy(dest, row, width * 4);
+	}
+
+#else
+
+	for (uint32_t y = 0; y < height; y++, dest += pitch) {
+		for (uint32_t x = 0; x < width; x++) {
+			uint32_t pixel = block.palette[(block.indices >> (y * 8 + x * 2)) & 3];
+			if (block.hasAlpha)
+				pixel |= packPixel(0, 0, 0, block.alpha[y * 4 + x]);
+
+			std::memcpy(dest + x * 4, &pixel, 4);
 		}
 	}
+
+#endif
 }
 
-struct DXT23Texel : public DXT1Texel {
-	uint16_t alpha[4];
-};
+/** Decompress the block rows [firstRow, lastRow) of an image. */
+static void decompressBlockRows(byte *dest, const byte *src, uint32_t width, uint32_t height, uint32_t pitch,
+                                size_t blockSize, BlockDecoder decodeBlock, uint32_t firstRow, uint32_t lastRow) {
 
-#define READ_DXT3_TEXEL(x) \
-	x.alpha[0] = src.readUint16LE(); \
-	x.alpha[1] = src.readUint16LE(); \
-	x.alpha[2] = src.readUint16LE(); \
-	x.alpha[3] = src.readUint16LE(); \
-	READ_DXT1_TEXEL(x)
-
-void decompressDXT3(byte *dest, Common::SeekableReadStream &src, uint32_t width, uint32_t height, uint32_t pitch) {
-	for (int32_t ty = height; ty > 0; ty -= 4) {
-		for (uint32_t tx = 0; tx < width; tx += 4) {
-			DXT23Texel tex;
-			uint32_t blended[4];
-			READ_DXT3_TEXEL(tex);
-
-			blended[0] = convert565To8888(tex.color_0) & 0xFFFFFF00;
-			blended[1] = convert565To8888(tex.color_1) & 0xFFFFFF00;
-			blended[2] = interpolate32(0.333333f, blended[0], blended[1]);
-			blended[3] = interpolate32(0.666666f, blended[0], blended[1]);
-
-			uint32_t cpx = tex.pixels;
-			uint32_t blockWidth = MIN<uint32_t>(width, 4);
-			uint32_t blockHeight = MIN<uint32_t>(height, 4);
-
-			for (byte y = 0; y < blockHeight; ++y) {
-				for (byte x = 0; x < blockWidth; ++x) {
-					const uint32_t destX = tx + x;
-					const uint32_t destY = height - 1 - (ty - blockHeight + y);
-
-					const uint32_t alpha = (tex.alpha[y] >> (x * 4)) & 0xF;
-					const uint32_t pixel = blended[cpx & 3] | alpha << 4;
-
-					cpx >>= 2;
-
-					if ((destX < width) && (destY < height))
-						WRITE_BE_UINT32(dest + destY * pitch + destX * 4, pixel);
-				}
-			}
+	const uint32_t blocksX = (width + 3) / 4;
+
+	src += (size_t)firstRow * blocksX * blockSize;
+
+	for (uint32_t by = firstRow; by < lastRow; by++) {
+		const uint32_t blockHeight = MIN<uint32_t>(height - by * 4, 4);
+
+		byte *row = dest + (size_t)by * 4 * pitch;
+
+		for (uint32_t bx = 0; bx < blocksX; bx++, src += blockSize) {
+			DecodedBlock block;
+			decodeBlock(block, src);
+
+			writeBlock(row + bx * 16, pitch, block, MIN<uint32_t>(width - bx * 4, 4), blockHeight);
 		}
 	}
 }
 
-struct DXT45Texel : public DXT1Texel {
-	byte alpha_0;
-	byte alpha_1;
-	uint64_t alphabl;
-};
+static void decompress(byte *dest, const byte *src, size_t srcSize, uint32_t width, uint32_t height, uint32_t pitch,
+                       size_t blockSize, BlockDecoder decodeBlock) {
+
+	const uint32_t blocksX = (width  + 3) / 4;
+	const uint32_t blocksY = (height + 3) / 4;
+
+	const size_t blockCount = (size_t)blocksX * blocksY;
+	if (srcSize < (blockCount * blockSize))
+		throw Common::Exception("Not enough S3TC data for %ux%u pixels (%u < %u)", width, height,
+		                        (unsigned int)srcSize, (unsigned int)(blockCount * blockSize));
+
+	const size_t stripCount = MIN<size_t>(MIN<size_t>(ThreadPoolMan.getThreadCount(),
+	                                                  MAX<size_t>(blockCount / kMinBlocksPerThread, 1)), blocksY);
+
+	// Give each thread a horizontal strip of blocks
+	ThreadPoolMan.parallelFor(stripCount, [=](size_t i) {
+		const uint32_t firstRow = (blocksY *  i     ) / stripCount;
+		const uint32_t lastRow  = (blocksY * (i + 1)) / stripCount;
 
-static uint64_t readUint48LE(Common::SeekableReadStream &src) {
-	uint64_t output = src.readUint32LE();
-	return output | ((uint64_t)src.readUint16LE() << 32);
-}
-
-#define READ_DXT5_TEXEL(x) \
-	x.alpha_0 = src.readByte(); \
-	x.alpha_1 = src.readByte(); \
-	x.alphabl = readUint48LE(src); \
-	READ_DXT1_TEXEL(x)
-
-void decompressDXT5(byte *dest, Common::SeekableReadStream &src, uint32_t width, uint32_t height, uint32_t pitch) {
-	for (int32_t ty = height; ty > 0; ty -= 4) {
-		for (uint32_t tx = 0; tx < width; tx += 4) {
-			uint32_t blended[4];
-			byte alphab[8];
-			DXT45Texel tex;
-			READ_DXT5_TEXEL(tex);
-
-			alphab[0] = tex.alpha_0;
-			alphab[1] = tex.alpha_1;
-
-			if (tex.alpha_0 > tex.alpha_1) {
-				alphab[2] = (byte)((6.0f * (double)alphab[0] + 1.0f * (double)alphab[1] + 3.0f) / 7.0f);
-				alphab[3] = (byte)((5.0f * (double)alphab[0] + 2.0f * (double)alphab[1] + 3.0f) / 7.0f);
-				alphab[4] = (byte)((4.0f * (double)alphab[0] + 3.0f * (double)alphab[1] + 3.0f) / 7.0f);
-				alphab[5] = (byte)((3.0f * (double)alphab[0] + 4.0f * (double)alphab[1] + 3.0f) / 7.0f);
-				alphab[6] = (byte)((2.0f * (double)alphab[0] + 5.0f * (double)alphab[1] + 3.0f) / 7.0f);
-				alphab[7] = (byte)((1.0f * (double)alphab[0] + 6.0f * (double)alphab[1] + 3.0f) / 7.0f);
-			} else {
-				alphab[2] = (byte)((4.0f * (double)alphab[0] + 1.0f * (double)alphab[1] + 2.0f) / 5.0f);
-				alphab[3] = (byte)((3.0f * (double)alphab[0] + 2.0f * (double)alphab[1] + 2.0f) / 5.0f);
-				alphab[4] = (byte)((2.0f * (double)alphab[0] + 3.0f * (double)alphab[1] + 2.0f) / 5.0f);
-				alphab[5] = (byte)((1.0f * (double)alphab[0] + 4.0f * (double)alphab[1] + 2.0f) / 5.0f);
-				alphab[6] = 0;
-				alphab[7] = 255;
+		decompressBlockRows(dest, src, width, height, pitch, blockSize, decodeBlock, firstRow, lastRow);
+	});
+}
+
+void decompressDXT1(byte *dest, const byte *src, size_t srcSize, uint32_t width, uint32_t height, uint32_t pitch) {
+	decompress(dest, src, srcSize, width, height, pitch, 8, &decodeDXT1Block);
+}
+
+void decompressDXT3(byte *dest, const byte *src, size_t srcSize, uint32_t width, uint32_t height, uint32_t pitch) {
+	decompress(dest, src, srcSize, width, height, pitch, 16, &decodeDXT3Block);
+}
+
+void decompressDXT5(byte *dest, const byte *src, size_t srcSize, uint32_t width, uint32_t height, uint32_t pitch) {
+	decompress(dest, src, srcSize, width, height, pitch, 16, &decodeDXT5Block);
+}
+
+/** A 4x4 pixel block of RGBA8 pixels, row by row. */
+typedef byte SourceBlock[16][4];
+
+typedef void (*BlockEncoder)(byte *dest, const SourceBlock &block);
+
+/** Read a 4x4 pixel block, repeating the edge pixels of blocks that reach past the image. */
+static inline void readBlock(SourceBlock &block, const byte *src, uint32_t pitch, uint32_t width, uint32_t height) {
+	for (uint32_t y = 0; y < 4; y++) {
+		const byte *row = src + MIN<uint32_t>(y, height - 1) * pitch;
+
+		for (uint32_t x = 0; x < 4; x++)
+			std::memcpy(block[y * 4 + x], row + MIN<uint32_t>(x, width - 1) * 4, 4);
+	}
+}
+
+static inline uint16_t pack565(uint32_t r, uint32_t g, uint32_t b) {
+	r = (r * 31 + 127) / 255;
+	g = (g * 63 + 127) / 255;
+	b = (b * 31 + 127) / 255;
+
+	return (r << 11) | (g << 5) | b;
+}
+
+static inline uint32_t colorDistance(const uint32_t *a, const byte *b) {
+	const int32_t dr = (int32_t)a[0] - b[0];
+	const int32_t dg = (int32_t)a[1] - b[1];
+	const int32_t db = (int32_t)a[2] - b[2];
+
+	return dr * dr + dg * dg + db * db;
+}
+
+/** Encode the color half of a block, always using the four color mode. */
+static void encodeColors(byte *dest, const SourceBlock &block) {
+	uint32_t minColor[3] = { 255, 255, 255 }, maxColor[3] = { 0, 0, 0 };
+	uint32_t sum[3] = { 0, 0, 0 };
+
+	for (size_t i = 0; i < 16; i++) {
+		for (size_t c = 0; c < 3; c++) {
+			minColor[c] = MIN<uint32_t>(minColor[c], block[i][c]);
+			maxColor[c] = MAX<uint32_t>(maxColor[c], block[i][c]);
+
+			sum[c] += block[i][c];
+		}
+	}
+
+	// Flip red and blue onto the diagonal of the bounding box the colors actually spread along
+	int32_t covRG = 0, covBG = 0;
+	for (size_t i = 0; i < 16; i++) {
+		const int32_t r = (int32_t)block[i][0] * 16 - (int32_t)sum[0];
+		const int32_t g = (int32_t)block[i][1] * 16 - (int32_t)sum[1];
+		const int32_t b = (int32_t)block[i][2] * 16 - (int32_t)sum[2];
+
+		covRG += r * g;
+		covBG += b * g;
+	}
+
+	if (covRG < 0)
+		std::swap(minColor[0], maxColor[0]);
+	if (covBG < 0)
+		std::swap(minColor[2], maxColor[2]);
+
+	// Inset the endpoints a bit, so that the interpolated colors cover the range better
+	for (size_t c = 0; c < 3; c++) {
+		const int32_t inset = ((int32_t)maxColor[c] - (int32_t)minColor[c]) / 16;
+
+		minColor[c] = (uint32_t)((int32_t)minColor[c] + inset);
+		maxColor[c] = (uint32_t)((int32_t)maxColor[c] - inset);
+	}
+
+	uint16_t color0 = pack565(maxColor[0], maxColor[1], maxColor[2]);
+	uint16_t color1 = pack565(minColor[0], minColor[1], minColor[2]);
+
+	// Keep the four color mode, which DXT1 only uses if the first color is the larger one
+	if (color0 < color1)
+		std::swap(color0, color1);
+
+	uint32_t indices = 0;
+	if (color0 != color1) {
+		uint32_t palette[4][3];
+		expand565(color0, palette[0][0], palette[0][1], palette[0][2]);
+		expand565(color1, palette[1][0], palette[1][1], palette[1][2]);
+
+		for (size_t c = 0; c < 3; c++) {
+			palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+			palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+		}
+
+		for (size_t i = 0; i < 16; i++) {
+			uint32_t best = 0, bestDistance = colorDistance(palette[0], block[i]);
+
+			for (uint32_t j = 1; j < 4; j++) {
+				const uint32_t distance = colorDistance(palette[j], block[i]);
+				if (distance < bestDistance) {
+					best         = j;
+					bestDistance = distance;
+				}
 			}
 
-			blended[0] = convert565To8888(tex.color_0) & 0xFFFFFF00;
-			blended[1] = convert565To8888(tex.color_1) & 0xFFFFFF00;
-			blended[2] = interpolate32(0.333333f, blended[0], blended[1]);
-			blended[3] = interpolate32(0.666666f, blended[0], blended[1]);
+			indices |= best << (i * 2);
+		}
+	}
+
+	WRITE_LE_UINT16(dest + 0, color0);
+	WRITE_LE_UINT16(dest + 2, color1);
+	WRITE_LE_UINT32(dest + 4, indices);
+}
+
+static void encodeDXT1Block(byte *dest, const SourceBlock &block) {
+	encodeColors(dest, block);
+}
 
-			uint32_t cpx = tex.pixels;
-			uint32_t blockWidth = MIN<uint32_t>(width, 4);
-			uint32_t blockHeight = MIN<uint32_t>(height, 4);
+static void encodeDXT5Block(byte *dest, const SourceBlock &block) {
+	uint32_t minAlpha = 255, maxAlpha = 0;
+	for (size_t i = 0; i < 16; i++) {
+		minAlpha = MIN<uint32_t>(minAlpha, block[i][3]);
+		maxAlpha = MAX<uint32_t>(maxAlpha, block[i][3]);
+	}
 
-			for (byte y = 0; y < blockHeight; ++y) {
-				for (byte x = 0; x < blockWidth; ++x) {
-					const uint32_t destX = tx + x;
-					const uint32_t destY = height - 1 - (ty - blockHeight + y);
+	uint64_t indices = 0;
+	if (minAlpha != maxAlpha) {
+		// Eight interpolated alpha values, the mode used when the first value is the larger one
+		uint32_t alphab[8];
+		alphab[0] = maxAlpha;
+		alphab[1] = minAlpha;
 
-					const uint32_t alpha = alphab[(tex.alphabl >> (3 * (4 * (3 - y) + x))) & 7];
-					const uint32_t pixel = blended[cpx & 3] | alpha;
+		for (uint32_t i = 1; i < 7; i++)
+			alphab[i + 1] = ((7 - i) * alphab[0] + i * alphab[1] + 3) / 7;
 
-					cpx >>= 2;
+		for (size_t i = 0; i < 16; i++) {
+			uint32_t best = 0, bestDistance = 256;
 
-					if ((destX < width) && (destY < height))
-						WRITE_BE_UINT32(dest + destY * pitch + destX * 4, pixel);
+			for (uint32_t j = 0; j < 8; j++) {
+				const uint32_t distance = ABS<int32_t>((int32_t)alphab[j] - block[i][3]);
+				if (distance < bestDistance) {
+					best         = j;
+					bestDistance = distance;
 				}
 			}
+
+			indices |= (uint64_t)best << (3 * i);
+		}
+	}
+
+	dest[0] = maxAlpha;
+	dest[1] = minAlpha;
+
+	WRITE_LE_UINT32(dest + 2, (uint32_t) indices);
+	WRITE_LE_UINT16(dest + 6, (uint16_t)(indices >> 32));
+
+	encodeColors(dest + 8, block);
+}
+
+/** Compress the block rows [firstRow, lastRow) of an image. */
+static void compressBlockRows(byte *dest, const byte *src, uint32_t width, uint32_t height, uint32_t pitch,
+                              size_t blockSize, BlockEncoder encodeBlock, uint32_t firstRow, uint32_t lastRow) {
+
+	const uint32_t blocksX = (width + 3) / 4;
+
+	dest += (size_t)firstRow * blocksX * blockSize;
+
+	for (uint32_t by = firstRow; by < lastRow; by++) {
+		const uint32_t blockHeight = MIN<uint32_t>(height - by * 4, 4);
+
+		const byte *row = src + (size_t)by * 4 * pitch;
+
+		for (uint32_t bx = 0; bx < blocksX; bx++, dest += blockSize) {
+			SourceBlock block;
+			readBlock(block, row + bx * 16, pitch, MIN<uint32_t>(width - bx * 4, 4), blockHeight);
+
+			encodeBlock(dest, block);
 		}
 	}
 }
 
+static void compress(byte *dest, const byte *src, uint32_t width, uint32_t height, uint32_t pitch,
+                     size_t blockSize, BlockEncoder encodeBlock) {
+
+	if ((width == 0) || (height == 0))
+		return;
+
+	const uint32_t blocksX = (width  + 3) / 4;
+	const uint32_t blocksY = (height + 3) / 4;
+
+	const size_t blockCount = (size_t)blocksX * blocksY;
+
+	const size_t stripCount = MIN<size_t>(MIN<size_t>(ThreadPoolMan.getThreadCount(),
+	                                                  MAX<size_t>(blockCount / kMinBlocksPerThread, 1)), blocksY);
+
+	ThreadPoolMan.parallelFor(stripCount, [=](size_t i) {
+		const uint32_t firstRow = (blocksY *  i     ) / stripCount;
+		const uint32_t lastRow  = (blocksY * (i + 1)) / stripCount;
+
+		compressBlockRows(dest, src, width, height, pitch, blockSize, encodeBlock, firstRow, lastRow);
+	});
+}
+
+void compressDXT1(byte *dest, const byte *src, uint32_t width, uint32_t height, uint32_t pitch) {
+	compress(dest, src, width, height, pitch, 8, &encodeDXT1Block);
+}
+
+void compressDXT5(byte *dest, const byte *src, uint32_t width, uint32_t height, uint32_t pitch) {
+	compress(dest, src, width, height, pitch, 16, &encodeDXT5Block);
+}
+
 } // End of namespace Graphics
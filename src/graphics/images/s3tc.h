@@ -19,23 +19,37 @@
  */
 
 /** @file
- *  Manual S3TC DXTn decompression methods.
+ *  Manual S3TC DXTn compression and decompression methods.
  */
 
 #ifndef GRAPHICS_IMAGES_S3TC_H
 #define GRAPHICS_IMAGES_S3TC_H
 
-#include "src/common/types.h"
+#include <cstddef>
 
-namespace Common {
-	class SeekableReadStream;
-}
+#include "src/common/types.h"
 
 namespace Graphics {
 
-void decompressDXT1(byte *dest, Common::SeekableReadStream &src, uint32_t width, uint32_t height, uint32_t pitch);
-void decompressDXT3(byte *dest, Common::SeekableReadStream &src, uint32_t width, uint32_t height, uint32_t pitch);
-void decompressDXT5(byte *dest, Common::SeekableReadStream &src, uint32_t width, uint32_t height, uint32_t pitch);
+/** Decompress DXT1 data into RGBA8.
+ *
+ *  The source has to contain all 8-byte blocks of the image. Large images
+ *  are decompressed in several threads.
+ */
+void decompressDXT1(byte *dest, const byte *src, size_t srcSize, uint32_t width, uint32_t height, uint32_t pitch);
+/** Decompress DXT3 data into RGBA8. */
+void decompressDXT3(byte *dest, const byte *src, size_t srcSize, uint32_t width, uint32_t height, uint32_t pitch);
+/** Decompress DXT5 data into RGBA8. */
+void decompressDXT5(byte *dest, const byte *src, size_t srcSize, uint32_t width, uint32_t height, uint32_t pitch);
+
+/** Compress RGBA8 data into DXT1, ignoring the alpha.
+ *
+ *  The destination has to have room for all 8-byte blocks of the image.
+ *  Large images are compressed in several threads.
+ */
+void compressDXT1(byte *dest, const byte *src, uint32_t width, uint32_t height, uint32_t pitch);
+/** Compress RGBA8 data into DXT5. */
+void compressDXT5(byte *dest, const byte *src, uint32_t width, uint32_t height, uint32_t pitch);
 
 } // End of namespace Graphics
 
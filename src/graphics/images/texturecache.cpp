@@ -0,0 +1,199 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  An on-disk cache of decoded images.
+ */
+
+#include <memory>
+
+#include "src/common/error.h"
+#include "src/common/ustring.h"
+#include "src/common/hash.h"
+#include "src/common/endianness.h"
+#include "src/common/readstream.h"
+#include "src/common/writefile.h"
+#include "src/common/mappedfile.h"
+#include "src/common/filepath.h"
+#include "src/common/configvalue.h"
+
+#include "src/graphics/images/texturecache.h"
+#include "src/graphics/images/decoder.h"
+
+static const uint32_t kCacheID      = MKTAG('X', 'T', 'C', 'H');
+static const uint32_t kCacheVersion = 1;
+
+static const Common::ConfigValue<bool> kConfigEnabled("texturecache", false);
+
+namespace Graphics {
+
+/** An image read back out of the texture cache. */
+class CachedImage : public ImageDecoder {
+public:
+	CachedImage(Common::SeekableReadStream &cache, uint64_t key);
+	~CachedImage() {}
+
+private:
+	void load(Common::SeekableReadStream &cache, uint64_t key);
+};
+
+CachedImage::CachedImage(Common::SeekableReadStream &cache, uint64_t key) {
+	load(cache, key);
+}
+
+void CachedImage::load(Common::SeekableReadStream &cache, uint64_t key) {
+	if ((cache.readUint32BE() != kCacheID) || (cache.readUint32LE() != kCacheVersion))
+		throw Common::Exception("Not a texture cache file");
+
+	if (cache.readUint64LE() != key)
+		throw Common::Exception("Texture cache key mismatch");
+
+	_format    = (PixelFormat)    cache.readUint32LE();
+	_formatRaw = (PixelFormatRaw) cache.readUint32LE();
+	_dataType  = (PixelDataType)  cache.readUint32LE();
+
+	_compressed = cache.readByte() != 0;
+	_hasAlpha   = cache.readByte() != 0;
+	_isCubeMap  = cache.readByte() != 0;
+	cache.skip(1);
+
+	_layerCount = cache.readUint32LE();
+
+	const uint32_t mipMapCount = cache.readUint32LE();
+	if ((_layerCount == 0) || (mipMapCount == 0) || ((mipMapCount % _layerCount) != 0) ||
+	    (_isCubeMap && (_layerCount != 6)))
+		throw Common::Exception("Invalid texture cache layout");
+
+	_mipMaps.reserve(mipMapCount);
+	for (uint32_t i = 0; i < mipMapCount; i++) {
+		_mipMaps.emplace_back(std::make_unique<MipMap>(this));
+
+		_mipMaps.back()->width  = cache.readSint32LE();
+		_mipMaps.back()->height = cache.readSint32LE();
+		_mipMaps.back()->size   = cache.readUint32LE();
+	}
+
+	for (MipMaps::iterator m = _mipMaps.begin(); m != _mipMaps.end(); ++m) {
+		if ((*m)->size > (cache.size() - cache.pos()))
+			throw Common::Exception("Texture cache file truncated");
+
+		(*m)->data = std::make_unique<byte[]>((*m)->size);
+		cache.read((*m)->data.get(), (*m)->size);
+	}
+}
+
+
+bool TextureCache::isEnabled() {
+	return kConfigEnabled.get();
+}
+
+uint64_t TextureCache::hash(uint32_t value) {
+	return Common::hashFNV64Value(Common::kFNV64OffsetBasis, value);
+}
+
+uint64_t TextureCache::hash(uint64_t key, uint32_t value) {
+	return Common::hashFNV64Value(key, value);
+}
+
+uint64_t TextureCache::hash(uint64_t key, Common::SeekableReadStream &stream) {
+	return Common::hashStreamFNV64(stream, key);
+}
+
+Common::UString TextureCache::getDirectory() {
+	return Common::FilePath::getUserDataDirectory() + "/texturecache";
+}
+
+Common::UString TextureCache::getFileName(uint64_t key) {
+	return getDirectory() + "/" + Common::formatHash(key) + ".xtc";
+}
+
+ImageDecoder *TextureCache::load(uint64_t key) {
+	if (!isEnabled())
+		return 0;
+
+	const Common::UString fileName = getFileName(key);
+	if (!Common::FilePath::isRegularFile(fileName))
+		return 0;
+
+	try {
+		Common::MappedReadStream cache(fileName);
+
+		return new CachedImage(cache, key);
+
+	} catch (...) {
+		// We'll decode the image again and overwrite the broken file
+		Common::exceptionDispatcherWarning("Failed reading texture cache file \"%s\"", fileName.c_str());
+	}
+
+	return 0;
+}
+
+void TextureCache::save(uint64_t key, const ImageDecoder &image) {
+	if (!isEnabled() || !image.hasData() || !image.getTXI().empty())
+		return;
+
+	const Common::UString fileName = getFileName(key);
+
+	try {
+		Common::writeFileAtomically(fileName, [&image, key](Common::WriteStream &cache) {
+			const size_t mipMapCount = image.getMipMapCount();
+			const size_t layerCount  = image.getLayerCount();
+
+			cache.writeUint32BE(kCacheID);
+			cache.writeUint32LE(kCacheVersion);
+			cache.writeUint64LE(key);
+
+			cache.writeUint32LE((uint32_t) image.getFormat());
+			cache.writeUint32LE((uint32_t) image.getFormatRaw());
+			cache.writeUint32LE((uint32_t) image.getDataType());
+
+			cache.writeByte(image.isCompressed() ? 1 : 0);
+			cache.writeByte(image.hasAlpha()     ? 1 : 0);
+			cache.writeByte(image.isCubeMap()    ? 1 : 0);
+			cache.writeByte(0);
+
+			cache.writeUint32LE(layerCount);
+			cache.writeUint32LE(layerCount * mipMapCount);
+
+			for (size_t l = 0; l < layerCount; l++) {
+				for (size_t m = 0; m < mipMapCount; m++) {
+					const ImageDecoder::MipMap &mipMap = image.getMipMap(m, l);
+
+					cache.writeSint32LE(mipMap.width);
+					cache.writeSint32LE(mipMap.height);
+					cache.writeUint32LE(mipMap.size);
+				}
+			}
+
+			for (size_t l = 0; l < layerCount; l++) {
+				for (size_t m = 0; m < mipMapCount; m++) {
+					const ImageDecoder::MipMap &mipMap = image.getMipMap(m, l);
+
+					if (cache.write(mipMap.data.get(), mipMap.size) != mipMap.size)
+						throw Common::Exception(Common::kWriteError);
+				}
+			}
+		});
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed writing texture cache file \"%s\"", fileName.c_str());
+	}
+}
+
+} // End of namespace Graphics
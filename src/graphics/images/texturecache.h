@@ -0,0 +1,73 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  An on-disk cache of decoded images.
+ */
+
+#ifndef GRAPHICS_IMAGES_TEXTURECACHE_H
+#define GRAPHICS_IMAGES_TEXTURECACHE_H
+
+#include "src/common/types.h"
+
+namespace Common {
+	class SeekableReadStream;
+	class UString;
+}
+
+namespace Graphics {
+
+class ImageDecoder;
+
+/** An on-disk cache of decoded images.
+ *
+ *  Some image formats need expensive transformations before they can be
+ *  uploaded: deswizzling, palette expansion, tile assembly. When enabled
+ *  with the "texturecache" config option, the final mip maps of those
+ *  images are stored in the user data directory, keyed by a hash of the
+ *  source data, and read back out of a memory-mapped file the next time.
+ *
+ *  Images with an embedded TXI aren't cached, since we can't restore it.
+ */
+class TextureCache {
+public:
+	/** Is the texture cache enabled? */
+	static bool isEnabled();
+
+	/** Start a cache key, for images produced by this kind of decoder. */
+	static uint64_t hash(uint32_t value);
+	/** Add a value to a cache key, like decoder options. */
+	static uint64_t hash(uint64_t key, uint32_t value);
+	/** Add the contents of this stream to a cache key. The stream position is kept. */
+	static uint64_t hash(uint64_t key, Common::SeekableReadStream &stream);
+
+	/** Load the image with this key out of the cache. Returns 0 if it isn't cached. */
+	static ImageDecoder *load(uint64_t key);
+	/** Store this freshly decoded image in the cache. */
+	static void save(uint64_t key, const ImageDecoder &image);
+
+private:
+	static Common::UString getDirectory();
+	static Common::UString getFileName(uint64_t key);
+};
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_IMAGES_TEXTURECACHE_H
@@ -52,6 +52,7 @@
 #include "src/common/util.h"
 #include "src/common/readstream.h"
 #include "src/common/error.h"
+#include "src/common/threadpool.h"
 
 #include "src/graphics/images/tga.h"
 #include "src/graphics/images/util.h"
@@ -228,10 +229,13 @@ void TGA::readData(Common::SeekableReadStream &tga, ImageType imageType, byte pi
 			}
 
 		}
+	}
 
-		// Bit 5 of imageDesc set means the origin in upper-left corner
-		if (imageDesc & 0x20)
+	// Bit 5 of imageDesc set means the origin in upper-left corner
+	if (imageDesc & 0x20) {
+		ThreadPoolMan.parallelFor(_layerCount, [this, pixelDepth](size_t i) {
 			flipVertically(_mipMaps[i]->data.get(), _mipMaps[i]->width, _mipMaps[i]->height, pixelDepth / 8);
+		});
 	}
 }
 
@@ -30,6 +30,7 @@
 #include "src/common/util.h"
 #include "src/common/maths.h"
 #include "src/common/error.h"
+#include "src/common/threadpool.h"
 #include "src/common/memreadstream.h"
 
 #include "src/graphics/images/tpc.h"
@@ -466,18 +467,16 @@ void TPC::fixupCubeMap() {
 		return;
 
 	// Rotate the cube sides so that they're all oriented correctly
-	for (size_t i = 0; i < getLayerCount(); i++) {
-		for (size_t j = 0; j < getMipMapCount(); j++) {
-			const size_t index = i * getMipMapCount() + j;
-			assert(index < _mipMaps.size());
+	ThreadPoolMan.parallelFor(_mipMaps.size(), [this, bpp](size_t index) {
+		const size_t layer = index / getMipMapCount();
+		assert(layer < getLayerCount());
 
-			MipMap &mipMap = *_mipMaps[index];
+		MipMap &mipMap = *_mipMaps[index];
 
-			static const int rotation[6] = { 1, 3, 0, 2, 2, 0 };
+		static const int rotation[6] = { 1, 3, 0, 2, 2, 0 };
 
-			rotate90(mipMap.data.get(), mipMap.width, mipMap.height, bpp, rotation[i]);
-		}
-	}
+		rotate90(mipMap.data.get(), mipMap.width, mipMap.height, bpp, rotation[layer]);
+	});
 
 }
 
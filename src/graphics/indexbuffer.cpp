@@ -25,6 +25,8 @@
 #include <cstdlib>
 #include <cstring>
 
+#include "src/common/profiler.h"
+
 #include "src/graphics/indexbuffer.h"
 
 namespace Graphics {
@@ -87,6 +89,10 @@ uint32_t IndexBuffer::getCount() const {
 	return _count;
 }
 
+uint32_t IndexBuffer::getSize() const {
+	return _size;
+}
+
 GLenum IndexBuffer::getType() const {
 	return _type;
 }
@@ -98,6 +104,8 @@ void IndexBuffer::initGL(GLuint hint) {
 
 	_hint = hint;
 	if (_count) {
+		PROFILE_NOTE("upload", Common::UString::format("Index buffer, %u bytes", _count * _size));
+
 		glGenBuffers(1, &_ibo);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ibo);
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER, _count * _size, _data, _hint);
@@ -52,6 +52,9 @@ public:
 	/** Get element count. */
 	uint32_t getCount() const;
 
+	/** Get element size in bytes. */
+	uint32_t getSize() const;
+
 	/** Get element type. */
 	GLenum getType() const;
 
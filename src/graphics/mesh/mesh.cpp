@@ -22,6 +22,8 @@
  *  Generic mesh handling class.
  */
 
+#include <cassert>
+
 #include "src/graphics/mesh/mesh.h"
 
 namespace Graphics {
@@ -127,7 +129,7 @@ void Mesh::initGL() {
 			glVertexAttribPointer(decl[i].index,
 			                      decl[i].size,
 			                      decl[i].type,
-			                      GL_FALSE,
+			                      decl[i].normalized,
 			                      decl[i].stride,
 			                      reinterpret_cast<void *>(offset));
 			glEnableVertexAttribArray(decl[i].index);
@@ -144,6 +146,25 @@ void Mesh::initGL() {
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
+	} else if (GfxMan.supportVertexArrayObjects()) {
+		// The fixed-function client arrays are VAO state too, so capture them once
+		glGenVertexArrays(1, &_vao);
+		glBindVertexArray(_vao);
+
+		enableLegacyArrays();
+
+		if (_indexBuffer.getCount()) {
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBuffer.getIBO());
+		}
+
+		glBindVertexArray(0);
+
+		// The client active texture unit is not part of the VAO
+		glClientActiveTextureARB(GL_TEXTURE0);
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
 	} else {
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
@@ -161,7 +182,7 @@ void Mesh::destroyGL() {
 	_vertexBuffer.destroyGL();
 	_indexBuffer.destroyGL();
 
-	// Should only be non-zero on GL3.x contexts anyway.
+	// Only non-zero if Vertex Array Objects are supported.
 	if (_vao) {
 		glDeleteVertexArrays(1, &_vao);
 		_vao = 0;
@@ -177,41 +198,17 @@ void Mesh::renderImmediate() {
 void Mesh::renderBind() {
 	if (GfxMan.isGL3()) {
 		glBindVertexArray(_vao);
+	} else if (_vao) {
+		glBindVertexArray(_vao);
 	} else {
-		const VertexDecl &decl = _vertexBuffer.getVertexDecl();
-		glBindBuffer(GL_ARRAY_BUFFER, _vertexBuffer.getVBO());
-		for (size_t i = 0; i < decl.size(); ++i) {
-			intptr_t offset = (intptr_t) (decl[i].pointer);
-			offset -= (intptr_t) (_vertexBuffer.getData());
-			switch (decl[i].index) {
-				case VPOSITION:
-					glEnableClientState(GL_VERTEX_ARRAY);
-					glVertexPointer(decl[i].size, decl[i].type, decl[i].stride, (GLvoid *)(offset));
-					break;
-				case VNORMAL:
-					glEnableClientState(GL_NORMAL_ARRAY);
-					glNormalPointer(decl[i].type, decl[i].stride, (GLvoid *)(offset));
-					break;
-				case VCOLOR:
-					glEnableClientState(GL_COLOR_ARRAY);
-					glColorPointer(decl[i].size, decl[i].type, decl[i].stride, (GLvoid *)(offset));
-					break;
-				// Unused (experimental renderer only)
-				case VBONEINDICES:
-				case VBONEWEIGHTS:
-					break;
-				default: // VTCOORD
-					glClientActiveTextureARB(GL_TEXTURE0 + decl[i].index - VTCOORD);
-					glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-					glTexCoordPointer(decl[i].size, decl[i].type, decl[i].stride, (GLvoid *)(offset));
-					break;
-			}
-		}
+		enableLegacyArrays();
 	}
 }
 
 void Mesh::render() {
-	if (GfxMan.isGL3()) {
+	GfxMan.countDrawCall(_type, _indexBuffer.getCount() ? _indexBuffer.getCount() : _vertexBuffer.getCount());
+
+	if (GfxMan.isGL3() || _vao) {
 		if (_indexBuffer.getCount()) {
 			glDrawElements(_type, _indexBuffer.getCount(), _indexBuffer.getType(), 0);
 		} else {
@@ -228,37 +225,87 @@ void Mesh::render() {
 	}
 }
 
+void Mesh::renderInstanced(uint32_t count) {
+	assert(GfxMan.isGL3());
+
+	GfxMan.countDrawCall(_type, _indexBuffer.getCount() ? _indexBuffer.getCount() : _vertexBuffer.getCount(), count);
+
+	if (_indexBuffer.getCount()) {
+		glDrawElementsInstanced(_type, _indexBuffer.getCount(), _indexBuffer.getType(), 0, count);
+	} else {
+		glDrawArraysInstanced(_type, 0, _vertexBuffer.getCount(), count);
+	}
+}
+
 void Mesh::renderUnbind() {
 	if (GfxMan.isGL3()) {
 		// So long as each mesh rebinds what it needs, there's actually no need to bind 0 here.
 		glBindVertexArray(0);
+	} else if (_vao) {
+		glBindVertexArray(0);
 	} else {
-		const VertexDecl &decl = _vertexBuffer.getVertexDecl();
-		for (size_t i = 0; i < decl.size(); ++i) {
-			switch (decl[i].index) {
-				case VPOSITION:
-					glDisableClientState(GL_VERTEX_ARRAY);
-					break;
-				case VNORMAL:
-					glDisableClientState(GL_NORMAL_ARRAY);
-					break;
-				case VCOLOR:
-					glDisableClientState(GL_COLOR_ARRAY);
-					break;
-				// Unused (experimental renderer only)
-				case VBONEINDICES:
-				case VBONEWEIGHTS:
-					break;
-				default: // VTCOORD
-					glClientActiveTextureARB(GL_TEXTURE0 + decl[i].index - VTCOORD);
-					glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-					break;
-			}
-		}
+		disableLegacyArrays();
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 }
 
+void Mesh::enableLegacyArrays() {
+	const VertexDecl &decl = _vertexBuffer.getVertexDecl();
+	glBindBuffer(GL_ARRAY_BUFFER, _vertexBuffer.getVBO());
+	for (size_t i = 0; i < decl.size(); ++i) {
+		intptr_t offset = (intptr_t) (decl[i].pointer);
+		offset -= (intptr_t) (_vertexBuffer.getData());
+		switch (decl[i].index) {
+			case VPOSITION:
+				glEnableClientState(GL_VERTEX_ARRAY);
+				glVertexPointer(decl[i].size, decl[i].type, decl[i].stride, (GLvoid *)(offset));
+				break;
+			case VNORMAL:
+				glEnableClientState(GL_NORMAL_ARRAY);
+				glNormalPointer(decl[i].type, decl[i].stride, (GLvoid *)(offset));
+				break;
+			case VCOLOR:
+				glEnableClientState(GL_COLOR_ARRAY);
+				glColorPointer(decl[i].size, decl[i].type, decl[i].stride, (GLvoid *)(offset));
+				break;
+			// Unused (experimental renderer only)
+			case VBONEINDICES:
+			case VBONEWEIGHTS:
+				break;
+			default: // VTCOORD
+				glClientActiveTextureARB(GL_TEXTURE0 + decl[i].index - VTCOORD);
+				glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+				glTexCoordPointer(decl[i].size, decl[i].type, decl[i].stride, (GLvoid *)(offset));
+				break;
+		}
+	}
+}
+
+void Mesh::disableLegacyArrays() {
+	const VertexDecl &decl = _vertexBuffer.getVertexDecl();
+	for (size_t i = 0; i < decl.size(); ++i) {
+		switch (decl[i].index) {
+			case VPOSITION:
+				glDisableClientState(GL_VERTEX_ARRAY);
+				break;
+			case VNORMAL:
+				glDisableClientState(GL_NORMAL_ARRAY);
+				break;
+			case VCOLOR:
+				glDisableClientState(GL_COLOR_ARRAY);
+				break;
+			// Unused (experimental renderer only)
+			case VBONEINDICES:
+			case VBONEWEIGHTS:
+				break;
+			default: // VTCOORD
+				glClientActiveTextureARB(GL_TEXTURE0 + decl[i].index - VTCOORD);
+				glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+				break;
+		}
+	}
+}
+
 void Mesh::useIncrement() {
 	++_usageCount;
 }
@@ -69,6 +69,9 @@ public:
 	void render();
 	void renderUnbind();
 
+	/** Render count instances of the mesh in one call, between renderBind() and renderUnbind(). GL3.x only. */
+	void renderInstanced(uint32_t count);
+
 	void useIncrement();
 	void useDecrement();
 	uint32_t useCount() const;
@@ -101,7 +104,12 @@ private:
 	Common::UString _name;
 	uint32_t _usageCount;
 
-	GLuint _vao;  ///< Vertex Array Object handle. GL3.x only.
+	GLuint _vao;  ///< Vertex Array Object handle, if supported.
+
+	/** Set up and enable the fixed-function client arrays. */
+	void enableLegacyArrays();
+	/** Disable the fixed-function client arrays. */
+	void disableLegacyArrays();
 
 	glm::vec3 _centre;
 	glm::vec3 _max;
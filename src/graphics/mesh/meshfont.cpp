@@ -22,6 +22,10 @@
  *  Generic mesh handling class.
  */
 
+#include <cstring>
+
+#include "src/common/util.h"
+
 #include "src/graphics/mesh/meshfont.h"
 
 namespace Graphics {
@@ -29,68 +33,33 @@ namespace Graphics {
 namespace Mesh {
 
 MeshFont::MeshFont() : Mesh(GL_QUADS, GL_DYNAMIC_DRAW) {
-	// Each vertex is { x, y, z, u, v, r, g, b, a }
-	_vertexBuffer.setSize(4, 9 * sizeof(float));
-
+	/* Each vertex is { x, y, z, u, v, r, g, b, a }. The vertices are interleaved,
+	 * so that the attribute offsets don't depend on how many vertices are drawn. */
 	VertexDecl vertexDecl;
 	vertexDecl.push_back(VertexAttrib(VPOSITION, 3, GL_FLOAT));
 	vertexDecl.push_back(VertexAttrib(VTCOORD, 2, GL_FLOAT));
 	vertexDecl.push_back(VertexAttrib(VCOLOR, 4, GL_FLOAT));
-	_vertexBuffer.setVertexDeclLinear(4, vertexDecl);
+	_vertexBuffer.setVertexDeclInterleave(4 * kBatchQuads, vertexDecl);
 
 	// Fill in some valid data so that mesh init doesn't go beserk.
-	float *verts = static_cast<float *>(_vertexBuffer.getData());
-
-	// Position Data.
-	*verts++ = -1.0f;
-	*verts++ = 0.0f;
-	*verts++ = 0.0f;
-
-	*verts++ = 0.0f;
-	*verts++ = 1.0f;
-	*verts++ = 0.0f;
-
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
-	*verts++ = 0.0f;
-
-	*verts++ = 1.0f;
-	*verts++ = 0.0f;
-	*verts++ = 0.0f;
-
-	// UV coordinates.
-	*verts++ = 0.0f;
-	*verts++ = 0.0f;
-
-	*verts++ = 0.0f;
-	*verts++ = 1.0f;
-
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
+	std::memset(_vertexBuffer.getData(), 0, _vertexBuffer.getCount() * _vertexBuffer.getSize());
 
-	*verts++ = 1.0f;
-	*verts++ = 0.0f;
+	static const float kQuad[4][5] = {
+		{ -1.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+		{  0.0f, 1.0f, 0.0f, 0.0f, 1.0f },
+		{  1.0f, 1.0f, 0.0f, 1.0f, 1.0f },
+		{  1.0f, 0.0f, 0.0f, 1.0f, 0.0f }
+	};
 
-	// Colour information.
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
-
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
-
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
+	float *verts = static_cast<float *>(_vertexBuffer.getData());
+	for (uint32_t i = 0; i < 4; i++, verts += 9) {
+		for (uint32_t j = 0; j < 5; j++)
+			verts[j] = kQuad[i][j];
 
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
-	*verts++ = 1.0f;
+		// Colour information.
+		for (uint32_t j = 5; j < 9; j++)
+			verts[j] = 1.0f;
+	}
 }
 
 void MeshFont::render(float *pos, float *uv, float *rgba) {
@@ -105,25 +74,43 @@ void MeshFont::render(float *pos, float *uv, float *rgba) {
 	 * Also note that this is really a most inefficient way of updating the vertex buffer.
 	 * Basically creating all vertices on the stack, passing them in here to be copied
 	 * into an internal vertex buffer, and then updating that internal buffer to server
-	 * side resources. It could happily be updated directly from stack values.
-	 *
-	 * Alternatively, sub-allocating from a very large pool of vertices and then using
-	 * an offset (index value start) for the actual draw call is an even better way of
-	 * doing things. Most text doesn't change per-frame.
+	 * side resources. Use renderQuads() to draw many characters at once instead.
 	 */
 
 	float *verts = static_cast<float *>(_vertexBuffer.getData());
-	for (uint32_t i = 0; i < 12; ++i) {
-		verts[i] = pos[i];
-	}
-	for (uint32_t i = 0; i < 8; ++i) {
-		verts[i+12] = uv[i];
+	for (uint32_t i = 0; i < 4; ++i, verts += 9) {
+		verts[0] = pos[i*3];
+		verts[1] = pos[i*3 + 1];
+		verts[2] = pos[i*3 + 2];
+		verts[3] = uv[i*2];
+		verts[4] = uv[i*2 + 1];
+		verts[5] = rgba[i*4];
+		verts[6] = rgba[i*4 + 1];
+		verts[7] = rgba[i*4 + 2];
+		verts[8] = rgba[i*4 + 3];
 	}
-	for (uint32_t i = 0; i < 16; ++i) {
-		verts[i+20] = rgba[i];
+	_vertexBuffer.updateGLBound(4);
+	GfxMan.countDrawCall(_type, 4);
+	glDrawArrays(_type, 0, 4);
+}
+
+void MeshFont::renderQuads(const float *vertices, uint32_t count) {
+	glBindBuffer(GL_ARRAY_BUFFER, _vertexBuffer.getVBO());
+
+	// Upload and draw as many whole quads as fit into the vertex buffer at once
+	const uint32_t batchSize = _vertexBuffer.getCount();
+	while (count > 0) {
+		const uint32_t n = MIN(count, batchSize);
+
+		std::memcpy(_vertexBuffer.getData(), vertices, n * _vertexBuffer.getSize());
+		_vertexBuffer.updateGLBound(n);
+
+		GfxMan.countDrawCall(_type, n);
+		glDrawArrays(_type, 0, n);
+
+		vertices += n * 9;
+		count    -= n;
 	}
-	_vertexBuffer.updateGLBound();
-	glDrawArrays(_type, 0, _vertexBuffer.getCount());
 }
 
 } // End of namespace Mesh
@@ -37,6 +37,13 @@ public:
 
 	/** Dynamic data prior to render call. */
 	void render(float *pos, float *uv, float *rgba);
+
+	/** Draw a batch of quads, with count interleaved { x, y, z, u, v, r, g, b, a } vertices. */
+	void renderQuads(const float *vertices, uint32_t count);
+
+private:
+	/** The number of quads the vertex buffer can hold at once. */
+	static const uint32_t kBatchQuads = 256;
 };
 
 } // End of namespace Mesh
@@ -22,9 +22,14 @@
  *  The global mesh manager.
  */
 
+#include <cstring>
+
+#include <set>
+#include <vector>
 
 #include "src/common/util.h"
 #include "src/common/uuid.h"
+#include "src/common/hash.h"
 
 #include "src/graphics/mesh/meshman.h"
 #include "src/graphics/mesh/meshwirebox.h"
@@ -45,6 +50,8 @@ MeshManager::~MeshManager() {
 }
 
 void MeshManager::init() {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
 	status("Initialising default mesh containers...");
 
 	MeshWireBox *wirebox = new MeshWireBox();
@@ -64,33 +71,40 @@ void MeshManager::init() {
 }
 
 void MeshManager::deinit() {
-	for (std::map<Common::UString, Mesh *>::iterator iter = _resourceMap.begin(); iter != _resourceMap.end(); ++iter) {
-		delete iter->second;
-	}
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	// Shared meshes can be found under several names
+	std::set<Mesh *> meshes;
+	for (ResourceMap::iterator iter = _resourceMap.begin(); iter != _resourceMap.end(); ++iter)
+		meshes.insert(iter->second);
+
+	for (std::set<Mesh *>::iterator m = meshes.begin(); m != meshes.end(); ++m)
+		delete *m;
+
 	_resourceMap.clear();
+	_contentMap.clear();
 }
 
 void MeshManager::cleanup() {
-	std::map<Common::UString, Mesh *>::iterator iter = _resourceMap.begin();
-	while (iter != _resourceMap.end()) {
-		Mesh *mesh = iter->second;
-		if (mesh->useCount() == 0) {
-			iter = delResource(iter);
-		} else {
-			iter++;
-		}
-	}
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	std::set<Mesh *> unused;
+	for (ResourceMap::iterator iter = _resourceMap.begin(); iter != _resourceMap.end(); ++iter)
+		if (iter->second->useCount() == 0)
+			unused.insert(iter->second);
+
+	for (std::set<Mesh *>::iterator m = unused.begin(); m != unused.end(); ++m)
+		delResource(*m);
 }
 
 void MeshManager::addMesh(Mesh *mesh, bool forceAddMesh) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
 	if (!mesh) {
 		return;
 	}
 
-	std::map<Common::UString, Mesh *>::iterator iter = _resourceMap.find(mesh->getName());
-	if (iter == _resourceMap.end()) {
-		_resourceMap[mesh->getName()] = mesh;
-	} else if (forceAddMesh) {
+	if (!_resourceMap.insert(std::make_pair(mesh->getName(), mesh)).second && forceAddMesh) {
 		Common::UString name = mesh->getName() + "#" + Common::generateIDRandomString();
 		mesh->setName(name);
 		this->addMesh(mesh);  // Recursive call, but it'll add the mesh eventually with a unique name.
@@ -98,18 +112,22 @@ void MeshManager::addMesh(Mesh *mesh, bool forceAddMesh) {
 }
 
 void MeshManager::delMesh(Mesh *mesh) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
 	if (!mesh) {
 		return;
 	}
 
-	std::map<Common::UString, Mesh *>::iterator iter = _resourceMap.find(mesh->getName());
+	ResourceMap::iterator iter = _resourceMap.find(mesh->getName());
 	if (iter != _resourceMap.end()) {
-		delResource(iter);
+		delResource(iter->second);
 	}
 }
 
 Mesh *MeshManager::getMesh(const Common::UString &name) {
-	std::map<Common::UString, Mesh *>::iterator iter = _resourceMap.find(name);
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	ResourceMap::iterator iter = _resourceMap.find(name);
 	if (iter != _resourceMap.end()) {
 		return iter->second;
 	} else {
@@ -117,13 +135,190 @@ Mesh *MeshManager::getMesh(const Common::UString &name) {
 	}
 }
 
-std::map<Common::UString, Mesh *>::iterator MeshManager::delResource(std::map<Common::UString, Mesh *>::iterator iter) {
-	std::map<Common::UString, Mesh *>::iterator inext = iter;
-	inext++;
-	delete iter->second;
-	_resourceMap.erase(iter);
+Mesh *MeshManager::addSharedMesh(Mesh *mesh) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	if (!mesh) {
+		return 0;
+	}
+
+	const uint64_t hash = hashGeometry(*mesh);
+
+	std::pair<ContentMap::iterator, ContentMap::iterator> range = _contentMap.equal_range(hash);
+	for (ContentMap::iterator iter = range.first; iter != range.second; ++iter) {
+		Mesh *shared = iter->second;
+		if (!isSameGeometry(*mesh, *shared))
+			continue;
+
+		/* Keep the name of the duplicate around, so that later lookups by
+		 * that name find the shared mesh without reading the geometry again. */
+		if (!mesh->getName().empty())
+			_resourceMap.insert(std::make_pair(mesh->getName(), shared));
+
+		delete mesh;
+
+		shared->useIncrement();
+		return shared;
+	}
+
+	mesh->init();
+	addMesh(mesh);
+
+	_contentMap.insert(std::make_pair(hash, mesh));
+
+	mesh->useIncrement();
+	return mesh;
+}
+
+Mesh *MeshManager::acquireMesh(const Common::UString &name) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	Mesh *mesh = getMesh(name);
+	if (mesh)
+		mesh->useIncrement();
+
+	return mesh;
+}
+
+void MeshManager::releaseMesh(Mesh *mesh) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	if (!mesh) {
+		return;
+	}
+
+	mesh->useDecrement();
+	if (mesh->useCount() > 0)
+		return;
+
+	std::pair<ContentMap::iterator, ContentMap::iterator> range = _contentMap.equal_range(hashGeometry(*mesh));
+	for (ContentMap::iterator iter = range.first; iter != range.second; ++iter) {
+		if (iter->second == mesh) {
+			delResource(mesh);
+			return;
+		}
+	}
+}
+
+void MeshManager::getMemoryUsage(Common::MemoryUsageList &usage) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	// Shared meshes can be reachable by several names, but only count once
+	std::set<Mesh *> counted;
+
+	for (ResourceMap::const_iterator m = _resourceMap.begin(); m != _resourceMap.end(); ++m) {
+		if (!counted.insert(m->second).second)
+			continue;
+
+		const VertexBuffer &vertexBuffer = *m->second->getVertexBuffer();
+		const IndexBuffer  &indexBuffer  = *m->second->getIndexBuffer();
+
+		usage.add(m->first.getString(), vertexBuffer.getCount() * vertexBuffer.getSize() +
+		                                indexBuffer.getCount()  * indexBuffer.getSize());
+	}
+}
+
+void MeshManager::delResource(Mesh *mesh) {
+	for (ResourceMap::iterator iter = _resourceMap.begin(); iter != _resourceMap.end(); ) {
+		if (iter->second == mesh)
+			iter = _resourceMap.erase(iter);
+		else
+			++iter;
+	}
+
+	for (ContentMap::iterator iter = _contentMap.begin(); iter != _contentMap.end(); ) {
+		if (iter->second == mesh)
+			iter = _contentMap.erase(iter);
+		else
+			++iter;
+	}
+
+	delete mesh;
+}
+
+static uint64_t hashBytes(uint64_t hash, const GLvoid *data, size_t size) {
+	const byte *bytes = static_cast<const byte *>(data);
+	for (size_t i = 0; i < size; i++)
+		hash = Common::hashFNV64(hash, bytes[i]);
+
+	return hash;
+}
+
+static size_t getAttribOffset(const VertexBuffer &vertexBuffer, const VertexAttrib &attrib) {
+	return static_cast<const byte *>(attrib.pointer) - static_cast<const byte *>(vertexBuffer.getData());
+}
+
+uint64_t MeshManager::hashGeometry(Mesh &mesh) {
+	const VertexBuffer &vertexBuffer = *mesh.getVertexBuffer();
+	const IndexBuffer  &indexBuffer  = *mesh.getIndexBuffer();
+
+	uint64_t hash = Common::kFNV64OffsetBasis;
+
+	hash = Common::hashFNV64(hash, mesh.getType());
+	hash = Common::hashFNV64(hash, vertexBuffer.getCount());
+	hash = Common::hashFNV64(hash, indexBuffer.getCount());
+	hash = Common::hashFNV64(hash, indexBuffer.getType());
+
+	const VertexDecl &vertexDecl = vertexBuffer.getVertexDecl();
+	for (VertexDecl::const_iterator a = vertexDecl.begin(); a != vertexDecl.end(); ++a) {
+		hash = Common::hashFNV64(hash, a->index);
+		hash = Common::hashFNV64(hash, a->size);
+		hash = Common::hashFNV64(hash, a->type);
+		hash = Common::hashFNV64(hash, a->stride);
+		hash = Common::hashFNV64(hash, a->normalized);
+		hash = Common::hashFNV64(hash, getAttribOffset(vertexBuffer, *a));
+	}
+
+	hash = hashBytes(hash, vertexBuffer.getData(), vertexBuffer.getCount() * vertexBuffer.getSize());
+	hash = hashBytes(hash, indexBuffer.getData(), indexBuffer.getCount() * indexBuffer.getSize());
+
+	return hash;
+}
+
+bool MeshManager::isSameGeometry(Mesh &mesh1, Mesh &mesh2) {
+	if ((mesh1.getType() != mesh2.getType()) || (mesh1.getHint() != mesh2.getHint()))
+		return false;
+
+	const VertexBuffer &vertexBuffer1 = *mesh1.getVertexBuffer();
+	const VertexBuffer &vertexBuffer2 = *mesh2.getVertexBuffer();
+
+	if ((vertexBuffer1.getCount() != vertexBuffer2.getCount()) ||
+	    (vertexBuffer1.getSize()  != vertexBuffer2.getSize()))
+		return false;
+
+	const VertexDecl &vertexDecl1 = vertexBuffer1.getVertexDecl();
+	const VertexDecl &vertexDecl2 = vertexBuffer2.getVertexDecl();
+
+	if (vertexDecl1.size() != vertexDecl2.size())
+		return false;
+
+	for (size_t i = 0; i < vertexDecl1.size(); i++) {
+		const VertexAttrib &a1 = vertexDecl1[i];
+		const VertexAttrib &a2 = vertexDecl2[i];
+
+		if ((a1.index != a2.index) || (a1.size != a2.size) || (a1.type != a2.type) ||
+		    (a1.stride != a2.stride) || (a1.normalized != a2.normalized) ||
+		    (getAttribOffset(vertexBuffer1, a1) != getAttribOffset(vertexBuffer2, a2)))
+			return false;
+	}
+
+	const IndexBuffer &indexBuffer1 = *mesh1.getIndexBuffer();
+	const IndexBuffer &indexBuffer2 = *mesh2.getIndexBuffer();
+
+	if ((indexBuffer1.getCount() != indexBuffer2.getCount()) ||
+	    (indexBuffer1.getSize()  != indexBuffer2.getSize())  ||
+	    (indexBuffer1.getType()  != indexBuffer2.getType()))
+		return false;
+
+	const size_t vertexSize = vertexBuffer1.getCount() * vertexBuffer1.getSize();
+	if (vertexSize && std::memcmp(vertexBuffer1.getData(), vertexBuffer2.getData(), vertexSize))
+		return false;
+
+	const size_t indexSize = indexBuffer1.getCount() * indexBuffer1.getSize();
+	if (indexSize && std::memcmp(indexBuffer1.getData(), indexBuffer2.getData(), indexSize))
+		return false;
 
-	return inext;
+	return true;
 }
 
 } // End of namespace Mesh
@@ -25,10 +25,13 @@
 #ifndef GRAPHICS_MESH_MESHMAN_H
 #define GRAPHICS_MESH_MESHMAN_H
 
-#include <map>
+#include <unordered_map>
 
 #include "src/common/ustring.h"
+#include "src/common/istringkey.h"
 #include "src/common/singleton.h"
+#include "src/common/mutex.h"
+#include "src/common/memoryusage.h"
 
 #include "src/graphics/mesh/mesh.h"
 
@@ -59,10 +62,41 @@ public:
 	/** Returns a mesh with the given name, or zero if it does not exist. */
 	Mesh *getMesh(const Common::UString &name);
 
+	/** Add a mesh whose geometry never changes after loading, sharing it if possible.
+	 *
+	 *  If a mesh with identical vertex and index data is already shared, the given
+	 *  mesh is deleted and the existing one returned instead, now also reachable by
+	 *  the name of the given mesh. Otherwise, the given mesh is initialised and added.
+	 *
+	 *  Either way, the usage count of the returned mesh is incremented. Give it back
+	 *  with releaseMesh() once it is not needed anymore.
+	 */
+	Mesh *addSharedMesh(Mesh *mesh);
+
+	/** Returns a mesh with the given name and increments its usage count, or zero if it does not exist. */
+	Mesh *acquireMesh(const Common::UString &name);
+
+	/** Decrement the usage count of a mesh, deleting it if it is shared and not used anymore. */
+	void releaseMesh(Mesh *mesh);
+
+	/** Collect how much memory the geometry of each managed mesh takes up. */
+	void getMemoryUsage(Common::MemoryUsageList &usage);
+
 private:
-	std::map<Common::UString, Mesh *> _resourceMap;
+	typedef Common::IStringKeyMap<Mesh *> ResourceMap;
+	typedef std::unordered_multimap<uint64_t, Mesh *> ContentMap;
+
+	ResourceMap _resourceMap;
+	ContentMap  _contentMap; ///< Shared meshes, by hash of their geometry.
+
+	/** Guards the resource map, since models can be loaded on several threads at once. */
+	std::recursive_mutex _mutex;
+
+	/** Remove all names of the mesh from the maps, and delete it. */
+	void delResource(Mesh *mesh);
 
-	std::map<Common::UString, Mesh *>::iterator delResource(std::map<Common::UString, Mesh *>::iterator iter);
+	static uint64_t hashGeometry(Mesh &mesh);
+	static bool isSameGeometry(Mesh &mesh1, Mesh &mesh2);
 };
 
 } // End of namespace Mesh
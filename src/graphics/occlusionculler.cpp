@@ -0,0 +1,233 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Hardware occlusion culling of world objects.
+ */
+
+#include "external/glm/gtc/type_ptr.hpp"
+
+#include "src/common/util.h"
+#include "src/common/boundingbox.h"
+
+#include "src/graphics/occlusionculler.h"
+#include "src/graphics/renderable.h"
+#include "src/graphics/graphics.h"
+
+namespace Graphics {
+
+/** Retest objects found visible only every this many frames. */
+static const uint32_t kVisibleQueryInterval = 4;
+/** Forget objects that haven't been culling candidates for this many frames. */
+static const uint32_t kMaxStateAge = 120;
+/** Grow the tested bounding boxes by this fraction of their size. */
+static const float kBoundMargin = 0.05f;
+
+/** The 12 triangles of a box, with corner i at ((i & 1) ? max.x : min.x, (i & 2) ..., (i & 4) ...). */
+static const GLubyte kBoxIndices[36] = {
+	0, 2, 6,  0, 6, 4, // -X
+	1, 5, 7,  1, 7, 3, // +X
+	0, 4, 5,  0, 5, 1, // -Y
+	2, 3, 7,  2, 7, 6, // +Y
+	0, 1, 3,  0, 3, 2, // -Z
+	4, 6, 7,  4, 7, 5  // +Z
+};
+
+static bool getQueryBound(const Renderable &object, glm::vec3 &min, glm::vec3 &max) {
+	Common::BoundingBox bound;
+	if (!object.getWorldBound(bound))
+		return false;
+
+	bound.getMin(min.x, min.y, min.z);
+	bound.getMax(max.x, max.y, max.z);
+
+	// Animated objects may move slightly outside of their bounding box
+	const glm::vec3 margin = (max - min) * kBoundMargin + glm::vec3(0.01f);
+
+	min -= margin;
+	max += margin;
+
+	return true;
+}
+
+static bool contains(const glm::vec3 &min, const glm::vec3 &max, const glm::vec3 &point) {
+	return (point.x >= min.x) && (point.x <= max.x) &&
+	       (point.y >= min.y) && (point.y <= max.y) &&
+	       (point.z >= min.z) && (point.z <= max.z);
+}
+
+
+OcclusionCuller::OcclusionCuller() {
+}
+
+OcclusionCuller::~OcclusionCuller() {
+	destroy();
+}
+
+void OcclusionCuller::cull(std::vector<Renderable *> &objects, const glm::vec3 &viewer, uint32_t frame) {
+	std::vector<Renderable *>::iterator visible = objects.begin();
+
+	for (std::vector<Renderable *>::iterator o = objects.begin(); o != objects.end(); ++o) {
+		ObjectStates::iterator state = _states.find((*o)->getID());
+		if (state != _states.end()) {
+			collect(state->second);
+
+			glm::vec3 min, max;
+			if (!state->second.visible && getQueryBound(**o, min, max) && !contains(min, max, viewer))
+				continue;
+		}
+
+		*visible++ = *o;
+	}
+
+	objects.erase(visible, objects.end());
+
+	if ((frame % kMaxStateAge) == 0)
+		prune(frame);
+}
+
+void OcclusionCuller::query(const std::vector<Renderable *> &objects, const glm::vec3 &viewer,
+                            const glm::mat4 &projection, const glm::mat4 &modelview, uint32_t frame) {
+
+	glMatrixMode(GL_PROJECTION);
+	glPushMatrix();
+	glLoadMatrixf(glm::value_ptr(projection));
+
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+	glLoadMatrixf(glm::value_ptr(modelview));
+
+	glPushAttrib(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_ENABLE_BIT);
+	glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+
+	// Only test the boxes against the depth buffer, without changing anything
+	glUseProgram(0);
+	glDisable(GL_TEXTURE_2D);
+	glDisable(GL_LIGHTING);
+	glDisable(GL_ALPHA_TEST);
+	glDisable(GL_BLEND);
+	glDisable(GL_CULL_FACE);
+	glEnable(GL_DEPTH_TEST);
+	glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+	glDepthMask(GL_FALSE);
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+	float vertices[8 * 3];
+
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glVertexPointer(3, GL_FLOAT, 0, vertices);
+
+	for (std::vector<Renderable *>::const_iterator o = objects.begin(); o != objects.end(); ++o) {
+		glm::vec3 min, max;
+		if (!getQueryBound(**o, min, max))
+			continue;
+
+		const uint32_t id = (*o)->getID();
+
+		ObjectState &state = _states[id];
+		state.lastSeen = frame;
+
+		// Close enough for the box to be clipped by the near plane
+		if (contains(min, max, viewer)) {
+			state.visible = true;
+			continue;
+		}
+
+		// Still waiting for the GPU
+		if (state.pending)
+			continue;
+
+		// Spread the retests of visible objects over several frames
+		if (state.visible && (((frame + id) % kVisibleQueryInterval) != 0))
+			continue;
+
+		if (state.query == 0)
+			glGenQueries(1, &state.query);
+
+		for (int i = 0; i < 8; i++) {
+			vertices[i * 3 + 0] = (i & 1) ? max.x : min.x;
+			vertices[i * 3 + 1] = (i & 2) ? max.y : min.y;
+			vertices[i * 3 + 2] = (i & 4) ? max.z : min.z;
+		}
+
+		glBeginQuery(GL_SAMPLES_PASSED, state.query);
+		GfxMan.countDrawCall(GL_TRIANGLES, ARRAYSIZE(kBoxIndices));
+		glDrawElements(GL_TRIANGLES, ARRAYSIZE(kBoxIndices), GL_UNSIGNED_BYTE, kBoxIndices);
+		glEndQuery(GL_SAMPLES_PASSED);
+
+		state.pending = true;
+	}
+
+	glPopClientAttrib();
+	glPopAttrib();
+
+	glMatrixMode(GL_PROJECTION);
+	glPopMatrix();
+
+	glMatrixMode(GL_MODELVIEW);
+	glPopMatrix();
+}
+
+void OcclusionCuller::collect(ObjectState &state) {
+	if (!state.pending)
+		return;
+
+	GLuint available = 0;
+	glGetQueryObjectuiv(state.query, GL_QUERY_RESULT_AVAILABLE, &available);
+	if (!available)
+		return;
+
+	GLuint samples = 0;
+	glGetQueryObjectuiv(state.query, GL_QUERY_RESULT, &samples);
+
+	state.visible = samples > 0;
+	state.pending = false;
+}
+
+void OcclusionCuller::prune(uint32_t frame) {
+	for (ObjectStates::iterator s = _states.begin(); s != _states.end(); ) {
+		if ((frame - s->second.lastSeen) <= kMaxStateAge) {
+			++s;
+			continue;
+		}
+
+		if (s->second.query != 0)
+			glDeleteQueries(1, &s->second.query);
+
+		s = _states.erase(s);
+	}
+}
+
+void OcclusionCuller::doRebuild() {
+	// Queries don't survive the context they were created in
+	_states.clear();
+}
+
+void OcclusionCuller::doDestroy() {
+	for (ObjectStates::iterator s = _states.begin(); s != _states.end(); ++s)
+		if (s->second.query != 0)
+			glDeleteQueries(1, &s->second.query);
+
+	_states.clear();
+}
+
+} // End of namespace Graphics
@@ -0,0 +1,95 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Hardware occlusion culling of world objects.
+ */
+
+#ifndef GRAPHICS_OCCLUSIONCULLER_H
+#define GRAPHICS_OCCLUSIONCULLER_H
+
+#include <vector>
+#include <unordered_map>
+
+#include "external/glm/vec3.hpp"
+#include "external/glm/mat4x4.hpp"
+
+#include "src/common/types.h"
+
+#include "src/graphics/types.h"
+#include "src/graphics/glcontainer.h"
+
+namespace Graphics {
+
+class Renderable;
+
+/** Culls world objects hidden behind other geometry, using GPU occlusion queries.
+ *
+ *  Every frame, the bounding boxes of the objects within the view frustum
+ *  are tested against the finished depth buffer. The results are only
+ *  collected in a later frame, once the GPU has them ready, so reading
+ *  them never stalls the pipeline. Objects whose last result is not known
+ *  yet keep the visibility they had before.
+ *
+ *  Objects found visible are only retested every few frames, objects found
+ *  hidden are retested every frame, so that they reappear quickly.
+ */
+class OcclusionCuller : public GLContainer {
+public:
+	OcclusionCuller();
+	~OcclusionCuller();
+
+	/** Remove all objects last found to be occluded from the list. */
+	void cull(std::vector<Renderable *> &objects, const glm::vec3 &viewer, uint32_t frame);
+
+	/** Issue occlusion queries for these objects, against the current depth buffer. */
+	void query(const std::vector<Renderable *> &objects, const glm::vec3 &viewer,
+	           const glm::mat4 &projection, const glm::mat4 &modelview, uint32_t frame);
+
+protected:
+	void doRebuild();
+	void doDestroy();
+
+private:
+	struct ObjectState {
+		GLuint query;
+
+		bool pending; ///< Was a query issued whose result we haven't read yet?
+		bool visible; ///< The result of the last finished query.
+
+		uint32_t lastSeen; ///< The last frame the object was a culling candidate.
+
+		ObjectState() : query(0), pending(false), visible(true), lastSeen(0) { }
+	};
+
+	typedef std::unordered_map<uint32_t, ObjectState> ObjectStates;
+
+	ObjectStates _states;
+
+	/** Collect the result of a finished query, if it is available. */
+	static void collect(ObjectState &state);
+
+	/** Delete the states of objects that haven't been candidates in a while. */
+	void prune(uint32_t frame);
+};
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_OCCLUSIONCULLER_H
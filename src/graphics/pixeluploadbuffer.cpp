@@ -0,0 +1,69 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A staging buffer for streaming pixel data to the GPU.
+ */
+
+#include "src/graphics/pixeluploadbuffer.h"
+
+namespace Graphics {
+
+PixelUploadBuffer::PixelUploadBuffer() : _pbo(0) {
+}
+
+PixelUploadBuffer::~PixelUploadBuffer() {
+	destroy();
+}
+
+byte *PixelUploadBuffer::map(size_t size) {
+	// Created on demand, since textures might be rebuilt before us after a context change
+	if (_pbo == 0)
+		glGenBuffers(1, &_pbo);
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _pbo);
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, size, 0, GL_STREAM_DRAW);
+
+	byte *data = static_cast<byte *>(glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY));
+	if (!data)
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	return data;
+}
+
+bool PixelUploadBuffer::unmap() {
+	return glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+}
+
+void PixelUploadBuffer::unbind() {
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+void PixelUploadBuffer::doRebuild() {
+}
+
+void PixelUploadBuffer::doDestroy() {
+	if (_pbo != 0)
+		glDeleteBuffers(1, &_pbo);
+
+	_pbo = 0;
+}
+
+} // End of namespace Graphics
@@ -0,0 +1,68 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A staging buffer for streaming pixel data to the GPU.
+ */
+
+#ifndef GRAPHICS_PIXELUPLOADBUFFER_H
+#define GRAPHICS_PIXELUPLOADBUFFER_H
+
+#include "src/common/types.h"
+
+#include "src/graphics/types.h"
+#include "src/graphics/glcontainer.h"
+
+namespace Graphics {
+
+/** A pixel unpack buffer object texture data is copied into before uploading.
+ *
+ *  While the buffer is bound, the data pointers given to glTexImage2D() and
+ *  glCompressedTexImage2D() are offsets into the buffer, and the driver can
+ *  transfer the data to the texture asynchronously, instead of copying it
+ *  out of client memory right away.
+ */
+class PixelUploadBuffer : public GLContainer {
+public:
+	PixelUploadBuffer();
+	~PixelUploadBuffer();
+
+	/** Bind the buffer and map size bytes of it for writing.
+	 *
+	 *  The previous contents are orphaned, so this never waits for
+	 *  uploads still in flight. Returns 0 if the buffer can't be mapped.
+	 */
+	byte *map(size_t size);
+	/** Unmap the buffer, keeping it bound for the uploads. Returns false if the contents were lost. */
+	bool unmap();
+	/** Unbind the buffer, making pixel data pointers refer to client memory again. */
+	void unbind();
+
+protected:
+	void doRebuild();
+	void doDestroy();
+
+private:
+	GLuint _pbo;
+};
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_PIXELUPLOADBUFFER_H
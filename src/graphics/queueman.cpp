@@ -22,6 +22,9 @@
  *  The graphics queue manager.
  */
 
+#include <algorithm>
+#include <iterator>
+
 #include "src/graphics/queueman.h"
 #include "src/graphics/queueable.h"
 
@@ -29,12 +32,16 @@ DECLARE_SINGLETON(Graphics::QueueManager)
 
 namespace Graphics {
 
+/** The queue is sorted by insertion, in linear time, if at most this many objects are out of place. */
+static const size_t kMaxInsertionSorted = 16;
+
 static bool queueComp(Queueable *a, Queueable *b) {
 	return *a < *b;
 }
 
 
 QueueManager::QueueManager() {
+	std::fill(_revision, _revision + kQueueMAX, 0);
 }
 
 QueueManager::~QueueManager() {
@@ -62,7 +69,48 @@ const std::list<Queueable *> &QueueManager::getQueue(QueueType queue) const {
 void QueueManager::sortQueue(QueueType queue) {
 	lockQueue(queue);
 
-	_queue[queue].sort(queueComp);
+	std::list<Queueable *> &objects = _queue[queue];
+
+	/* The order rarely changes much between two sorts, so count the objects
+	 * that are out of place first. A few of them are moved into place one by
+	 * one, in linear time, and only a badly shuffled queue is sorted anew. */
+	size_t unsorted = 0;
+	for (std::list<Queueable *>::iterator prev = objects.begin(), o = prev; o != objects.end(); prev = o++)
+		if (queueComp(*o, *prev))
+			unsorted++;
+
+	if (unsorted == 0) {
+		// Sorting an already sorted queue doesn't change it
+		unlockQueue(queue);
+		return;
+	}
+
+	if (unsorted > (kMaxInsertionSorted + objects.size() / 16)) {
+		objects.sort(queueComp);
+
+	} else {
+		std::list<Queueable *>::iterator o = objects.begin();
+		for (++o; o != objects.end(); ) {
+			std::list<Queueable *>::iterator prev = o, next = o;
+			--prev;
+			++next;
+
+			if (!queueComp(*o, *prev)) {
+				o = next;
+				continue;
+			}
+
+			// Walk back to the first object that doesn't go after this one, keeping the sort stable
+			std::list<Queueable *>::iterator pos = prev;
+			while ((pos != objects.begin()) && queueComp(*o, *std::prev(pos)))
+				--pos;
+
+			objects.splice(pos, objects, o);
+			o = next;
+		}
+	}
+
+	_revision[queue]++;
 
 	unlockQueue(queue);
 }
@@ -72,6 +120,7 @@ std::list<Queueable *>::iterator QueueManager::addToQueue(QueueType queue, Queue
 
 	_queue[queue].push_back(&q);
 	std::list<Queueable *>::iterator ref = --_queue[queue].end();
+	_revision[queue]++;
 
 	unlockQueue(queue);
 
@@ -84,6 +133,7 @@ void QueueManager::removeFromQueue(QueueType queue,
 	lockQueue(queue);
 
 	_queue[queue].erase(ref);
+	_revision[queue]++;
 
 	unlockQueue(queue);
 }
@@ -96,10 +146,34 @@ void QueueManager::clearQueue(QueueType queue) {
 		(*q)->kickedOut(queue);
 
 	_queue[queue].clear();
+	_revision[queue]++;
+
+	unlockQueue(queue);
+}
+
+void QueueManager::kickOut(QueueType queue, const std::function<bool (Queueable &)> &predicate) {
+	lockQueue(queue);
+
+	for (std::list<Queueable *>::iterator q = _queue[queue].begin(); q != _queue[queue].end(); ) {
+		if (!predicate(**q)) {
+			++q;
+			continue;
+		}
+
+		(*q)->kickedOut(queue);
+		q = _queue[queue].erase(q);
+		_revision[queue]++;
+	}
 
 	unlockQueue(queue);
 }
 
+uint32_t QueueManager::getRevision(QueueType queue) {
+	std::lock_guard<std::recursive_mutex> lock(_queueMutex[queue]);
+
+	return _revision[queue];
+}
+
 void QueueManager::clearAllQueues() {
 	for (int i = 0; i < kQueueMAX; i++)
 		clearQueue((QueueType) i);
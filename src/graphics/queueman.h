@@ -26,6 +26,7 @@
 #define GRAPHICS_QUEUEMAN_H
 
 #include <list>
+#include <functional>
 
 #include "src/common/types.h"
 #include "src/common/singleton.h"
@@ -50,15 +51,24 @@ public:
 
 	const std::list<Queueable *> &getQueue(QueueType queue) const;
 
+	/** Sort the queue, expecting it to be almost sorted already. */
 	void sortQueue(QueueType queue);
 	void clearQueue(QueueType queue);
 
+	/** Kick all objects out of the queue for which the predicate returns true. */
+	void kickOut(QueueType queue, const std::function<bool (Queueable &)> &predicate);
+
 	void clearAllQueues();
 
+	/** Return the queue's revision, which changes whenever its contents or their order change. */
+	uint32_t getRevision(QueueType queue);
+
 private:
 	std::recursive_mutex _queueMutex[kQueueMAX];
 	std::list<Queueable *> _queue[kQueueMAX];
 
+	uint32_t _revision[kQueueMAX];
+
 	std::list<Queueable *>::iterator addToQueue(QueueType queue, Queueable &q);
 	void removeFromQueue(QueueType queue, const std::list<Queueable *>::iterator &ref);
 
@@ -0,0 +1,97 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A buffer of per-instance transformations, for instanced drawing.
+ */
+
+#include "src/common/util.h"
+
+#include "src/graphics/graphics.h"
+
+#include "src/graphics/shader/shader.h"
+
+#include "src/graphics/render/instancebuffer.h"
+
+namespace Graphics {
+
+namespace Render {
+
+static const size_t kMinCapacity = 64;
+
+InstanceBuffer::InstanceBuffer() : _vbo(0), _capacity(0) {
+}
+
+InstanceBuffer::~InstanceBuffer() {
+	destroy();
+}
+
+void InstanceBuffer::bind(const std::vector<glm::mat4> &transforms) {
+	glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+
+	if (transforms.size() > _capacity)
+		_capacity = MAX(NEXTPOWER2((uint32_t) transforms.size()), (uint32_t) kMinCapacity);
+
+	// Orphan the old contents, so we don't need to wait for draws still using them
+	glBufferData(GL_ARRAY_BUFFER, _capacity * sizeof(glm::mat4), 0, GL_STREAM_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, transforms.size() * sizeof(glm::mat4), &transforms[0]);
+
+	for (GLuint i = 0; i < 4; i++) {
+		const GLuint location = Shader::VERTEX_INSTANCE_TRANSFORM + i;
+
+		glEnableVertexAttribArray(location);
+		glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+		                      reinterpret_cast<void *>(i * sizeof(glm::vec4)));
+		glVertexAttribDivisor(location, 1);
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void InstanceBuffer::unbind() {
+	for (GLuint i = 0; i < 4; i++) {
+		const GLuint location = Shader::VERTEX_INSTANCE_TRANSFORM + i;
+
+		glVertexAttribDivisor(location, 0);
+		glDisableVertexAttribArray(location);
+
+		// Back to the identity for the non-instanced draws
+		glVertexAttrib4f(location, i == 0, i == 1, i == 2, i == 3);
+	}
+}
+
+void InstanceBuffer::doRebuild() {
+	if (_vbo == 0)
+		glGenBuffers(1, &_vbo);
+
+	_capacity = 0;
+}
+
+void InstanceBuffer::doDestroy() {
+	if (_vbo != 0)
+		glDeleteBuffers(1, &_vbo);
+
+	_vbo      = 0;
+	_capacity = 0;
+}
+
+} // End of namespace Render
+
+} // End of namespace Graphics
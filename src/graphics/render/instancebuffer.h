@@ -0,0 +1,65 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A buffer of per-instance transformations, for instanced drawing.
+ */
+
+#ifndef GRAPHICS_RENDER_INSTANCEBUFFER_H
+#define GRAPHICS_RENDER_INSTANCEBUFFER_H
+
+#include <vector>
+
+#include "external/glm/mat4x4.hpp"
+
+#include "src/graphics/types.h"
+#include "src/graphics/glcontainer.h"
+
+namespace Graphics {
+
+namespace Render {
+
+/** A dynamic vertex buffer, feeding one object transformation per instance
+ *  to the instance transform attribute of the shaders.
+ */
+class InstanceBuffer : public GLContainer {
+public:
+	InstanceBuffer();
+	~InstanceBuffer();
+
+	/** Upload the transformations and attach them to the currently bound vertex array object. */
+	void bind(const std::vector<glm::mat4> &transforms);
+	/** Detach from the currently bound vertex array object. */
+	void unbind();
+
+protected:
+	void doRebuild();
+	void doDestroy();
+
+private:
+	GLuint _vbo;
+	size_t _capacity; ///< Number of transformations the buffer currently has space for.
+};
+
+} // End of namespace Render
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_RENDER_INSTANCEBUFFER_H
@@ -24,6 +24,9 @@
 
 #include "external/glm/gtc/type_ptr.hpp"
 
+#include "src/common/util.h"
+#include "src/common/threadpool.h"
+
 #include "src/graphics/render/renderman.h"
 
 DECLARE_SINGLETON(Graphics::Render::RenderManager)
@@ -32,79 +35,177 @@ namespace Graphics {
 
 namespace Render {
 
-RenderManager::RenderManager() : _sortingHints(SORT_HINT_NORMAL) {
+/** Don't bother spreading fewer than this many objects per thread over the pool. */
+static const size_t kMinParallelQueueCount = 8;
+
+thread_local RenderManager::QueueSet *RenderManager::_threadQueues = 0;
+
+RenderManager::RenderManager() : _cameraReference(0.0f, 0.0f, 0.0f), _sortingHints(SORT_HINT_NORMAL) {
 }
 
 RenderManager::~RenderManager() {
 }
 
+void RenderManager::init() {
+	if (!GfxMan.supportInstancing())
+		return;
+
+	_instanceBuffer = std::make_unique<InstanceBuffer>();
+	_instanceBuffer->rebuild();
+}
+
+void RenderManager::deinit() {
+	_instanceBuffer.reset();
+}
+
 void RenderManager::setSortingHint(SortingHints hint) {
 	_sortingHints = hint;
 }
 
 void RenderManager::setCameraReference(const glm::vec3 &reference) {
-	_queueColorSolidPrimary.setCameraReference(reference);
-	_queueColorSolidSecondary.setCameraReference(reference);
-	_queueColorSolidDecal.setCameraReference(reference);
-	_queueColorTransparentPrimary.setCameraReference(reference);
-	_queueColorTransparentSecondary.setCameraReference(reference);
+	_cameraReference = reference;
+
+	_queues.setCameraReference(reference);
 }
 
 void RenderManager::queueRenderable(Shader::ShaderRenderable *renderable, const glm::mat4 *transform, float alpha) {
-	uint32_t flags = renderable->getMaterial()->getFlags();
-	if (flags & Shader::ShaderMaterial::MATERIAL_DECAL) {
-		_queueColorSolidDecal.queueItem(renderable, transform, alpha);
-	} else if (flags & Shader::ShaderMaterial::MATERIAL_TRANSPARENT) {
-		if (flags & Shader::ShaderMaterial::MATERIAL_TRANSPARENT_B) {
-			_queueColorTransparentSecondary.queueItem(renderable, transform, alpha);
-		} else {
-			_queueColorTransparentPrimary.queueItem(renderable, transform, alpha);
-		}
-	} else {
-		if (renderable->getMaterial()->getFlags() & Shader::ShaderMaterial::MATERIAL_OPAQUE) {
-			_queueColorSolidPrimary.queueItem(renderable, transform, alpha);
-		} else if (renderable->getMesh()->getVertexBuffer()->getCount() > 6) {
-			_queueColorSolidSecondary.queueItem(renderable, transform, alpha);
-		} else {
-			_queueColorSolidDecal.queueItem(renderable, transform, alpha);
+	QueueSet *queues = _threadQueues ? _threadQueues : &_queues;
+
+	queues->queueRenderable(renderable, transform, alpha);
+}
+
+void RenderManager::queueParallel(size_t count, const std::function<void(size_t)> &queue) {
+	const size_t chunkCount = MIN(ThreadPoolMan.getThreadCount(), count / kMinParallelQueueCount);
+	if (chunkCount <= 1) {
+		for (size_t i = 0; i < count; i++)
+			queue(i);
+
+		return;
+	}
+
+	while (_chunkQueues.size() < chunkCount)
+		_chunkQueues.push_back(std::make_unique<QueueSet>());
+
+	ThreadPoolMan.parallelFor(chunkCount, [&](size_t chunk) {
+		QueueSet &queues = *_chunkQueues[chunk];
+
+		queues.clear();
+		queues.setCameraReference(_cameraReference);
+
+		const size_t start = (count *  chunk     ) / chunkCount;
+		const size_t end   = (count * (chunk + 1)) / chunkCount;
+
+		// The pool might run this chunk while the thread is in the middle of another one
+		QueueSet *previousQueues = _threadQueues;
+		_threadQueues = &queues;
+
+		try {
+			for (size_t i = start; i < end; i++)
+				queue(i);
+		} catch (...) {
+			_threadQueues = previousQueues;
+			throw;
 		}
+
+		_threadQueues = previousQueues;
+	});
+
+	for (size_t i = 0; i < chunkCount; i++) {
+		_queues.append(*_chunkQueues[i]);
+		_chunkQueues[i]->clear();
 	}
 }
 
 void RenderManager::sort() {
 	switch (_sortingHints) {
 	case SORT_HINT_NORMAL:
-		_queueColorSolidPrimary.sortShader();
-		_queueColorSolidSecondary.sortShader();
-		_queueColorSolidDecal.sortShader();
-		_queueColorTransparentPrimary.sortDepth();
-		_queueColorTransparentSecondary.sortDepth();
+		_queues.colorSolidPrimary.sortShader();
+		_queues.colorSolidSecondary.sortShader();
+		_queues.colorSolidDecal.sortShader();
+		_queues.colorTransparentPrimary.sortDepth();
+		_queues.colorTransparentSecondary.sortDepth();
 		break;
 	case SORT_HINT_ALLDEPTH:
-		_queueColorSolidPrimary.sortDepth();
-		_queueColorSolidSecondary.sortDepth();
-		_queueColorSolidDecal.sortDepth();
-		_queueColorTransparentPrimary.sortDepth();
-		_queueColorTransparentSecondary.sortDepth();
+		_queues.colorSolidPrimary.sortDepth();
+		_queues.colorSolidSecondary.sortDepth();
+		_queues.colorSolidDecal.sortDepth();
+		_queues.colorTransparentPrimary.sortDepth();
+		_queues.colorTransparentSecondary.sortDepth();
 		break;
 	default: break;
 	}
 }
 
 void RenderManager::render() {
-	_queueColorSolidPrimary.render();
-	_queueColorSolidSecondary.render();
-	_queueColorSolidDecal.render();
-	_queueColorTransparentPrimary.render();
-	_queueColorTransparentSecondary.render();
+	renderOpaque();
+	renderTransparent();
+}
+
+void RenderManager::renderOpaque() {
+	InstanceBuffer *instances = _instanceBuffer.get();
+
+	_queues.colorSolidPrimary.render(instances);
+	_queues.colorSolidSecondary.render(instances);
+	_queues.colorSolidDecal.render(instances);
+}
+
+void RenderManager::renderTransparent() {
+	InstanceBuffer *instances = _instanceBuffer.get();
+
+	_queues.colorTransparentPrimary.render(instances);
+	_queues.colorTransparentSecondary.render(instances);
 }
 
 void RenderManager::clear() {
-	_queueColorSolidPrimary.clear();
-	_queueColorSolidSecondary.clear();
-	_queueColorSolidDecal.clear();
-	_queueColorTransparentPrimary.clear();
-	_queueColorTransparentSecondary.clear();
+	_queues.clear();
+}
+
+
+void RenderManager::QueueSet::setCameraReference(const glm::vec3 &reference) {
+	colorSolidPrimary.setCameraReference(reference);
+	colorSolidSecondary.setCameraReference(reference);
+	colorSolidDecal.setCameraReference(reference);
+	colorTransparentPrimary.setCameraReference(reference);
+	colorTransparentSecondary.setCameraReference(reference);
+}
+
+void RenderManager::QueueSet::queueRenderable(Shader::ShaderRenderable *renderable,
+                                              const glm::mat4 *transform, float alpha) {
+
+	uint32_t flags = renderable->getMaterial()->getFlags();
+	if (flags & Shader::ShaderMaterial::MATERIAL_DECAL) {
+		colorSolidDecal.queueItem(renderable, transform, alpha);
+	} else if (flags & Shader::ShaderMaterial::MATERIAL_TRANSPARENT) {
+		if (flags & Shader::ShaderMaterial::MATERIAL_TRANSPARENT_B) {
+			colorTransparentSecondary.queueItem(renderable, transform, alpha);
+		} else {
+			colorTransparentPrimary.queueItem(renderable, transform, alpha);
+		}
+	} else {
+		if (renderable->getMaterial()->getFlags() & Shader::ShaderMaterial::MATERIAL_OPAQUE) {
+			colorSolidPrimary.queueItem(renderable, transform, alpha);
+		} else if (renderable->getMesh()->getVertexBuffer()->getCount() > 6) {
+			colorSolidSecondary.queueItem(renderable, transform, alpha);
+		} else {
+			colorSolidDecal.queueItem(renderable, transform, alpha);
+		}
+	}
+}
+
+void RenderManager::QueueSet::append(const QueueSet &set) {
+	colorSolidPrimary.append(set.colorSolidPrimary);
+	colorSolidSecondary.append(set.colorSolidSecondary);
+	colorSolidDecal.append(set.colorSolidDecal);
+	colorTransparentPrimary.append(set.colorTransparentPrimary);
+	colorTransparentSecondary.append(set.colorTransparentSecondary);
+}
+
+void RenderManager::QueueSet::clear() {
+	colorSolidPrimary.clear();
+	colorSolidSecondary.clear();
+	colorSolidDecal.clear();
+	colorTransparentPrimary.clear();
+	colorTransparentSecondary.clear();
 }
 
 } // namespace Render
@@ -25,10 +25,15 @@
 #ifndef GRAPHICS_RENDER_RENDERMANAGER_H
 #define GRAPHICS_RENDER_RENDERMANAGER_H
 
+#include <memory>
+#include <vector>
+#include <functional>
+
 #include "external/glm/vec3.hpp"
 #include "external/glm/mat4x4.hpp"
 
 #include "src/graphics/render/renderqueue.h"
+#include "src/graphics/render/instancebuffer.h"
 
 #include "src/common/singleton.h"
 
@@ -53,26 +58,68 @@ public:
 
 	void queueRenderable(Shader::ShaderRenderable *renderable, const glm::mat4 *transform, float alpha);
 
+	/** Call queue(i) for all i in [0, count), spread over the thread pool.
+	 *
+	 *  queue() may call queueRenderable(), but must not touch the GL. Every
+	 *  pool thread records into queues of its own, which are then appended
+	 *  to the main queues in order, so that the result doesn't depend on
+	 *  which thread did what.
+	 */
+	void queueParallel(size_t count, const std::function<void(size_t)> &queue);
+
 	void sort();
 
 	void render();
 
+	/** Render only the solid queues. */
+	void renderOpaque();
+	/** Render only the transparent queues. */
+	void renderTransparent();
+
 	void clear();
 
-	void init() {}
-	void deinit() {}
+	/** Create the GL resources shared by all queues. */
+	void init();
+	/** Free the GL resources shared by all queues. */
+	void deinit();
 	void cleanup() {}
 
 private:
-	RenderQueue _queueColorSolidPrimary;
-	RenderQueue _queueColorSolidSecondary;
-	RenderQueue _queueColorSolidDecal;
-	RenderQueue _queueColorTransparentPrimary;
-	RenderQueue _queueColorTransparentSecondary;
-	RenderQueue _queueLast;
+	/** All queues renderables are sorted into.
+	 *
+	 *  Recording into the queues doesn't touch the GL, only rendering
+	 *  them does, so any thread can fill a set of its own.
+	 */
+	struct QueueSet {
+		RenderQueue colorSolidPrimary;
+		RenderQueue colorSolidSecondary;
+		RenderQueue colorSolidDecal;
+		RenderQueue colorTransparentPrimary;
+		RenderQueue colorTransparentSecondary;
+
+		void setCameraReference(const glm::vec3 &reference);
+
+		void queueRenderable(Shader::ShaderRenderable *renderable, const glm::mat4 *transform, float alpha);
+
+		void append(const QueueSet &set);
+		void clear();
+	};
+
+	QueueSet _queues;
+
+	/** Queues for each chunk of a queueParallel(). */
+	std::vector<std::unique_ptr<QueueSet>> _chunkQueues;
+
+	/** The queues the current thread records into during a queueParallel(), if any. */
+	static thread_local QueueSet *_threadQueues;
+
+	glm::vec3 _cameraReference;
 
 	SortingHints _sortingHints;
 
+	/** Per-instance transformations for instanced drawing, if supported. */
+	std::unique_ptr<InstanceBuffer> _instanceBuffer;
+
 	//std::vector<GLContainer *> _queueColorImmediate; // For anything special outside the normal render path.
 };
 
@@ -27,6 +27,9 @@
 #include "external/glm/gtc/type_ptr.hpp"
 
 #include "src/graphics/render/renderqueue.h"
+#include "src/graphics/render/instancebuffer.h"
+
+#include "src/graphics/aurora/textureman.h"
 #include "src/common/util.h"
 
 #include <algorithm>
@@ -35,24 +38,32 @@ namespace Graphics {
 
 namespace Render {
 
-bool compareShader(const RenderQueue::RenderQueueNode &a, const RenderQueue::RenderQueueNode &b)
-{
-	if (a.program < b.program)
-		return false;
-	else if (a.program > b.program)
-		return true;
-	if (a.material < b.material)  // node_program values are equal.
-		return false;
-	else if (a.material > b.material)
-		return true;
-	else  // node material values are equal, compare mesh values next.
-		return (a.mesh <= b.mesh ? false : true);
-	// No, surfaces are not compared here.
+/** Runs of at least this many identical nodes are drawn instanced. */
+static const uint32_t kMinInstanceCount = 4;
+
+/** Fold a pointer into a 16-bit value, for grouping in a sort key. */
+static inline uint64_t sortID(const void *ptr) {
+	uint64_t id = (uint64_t) (uintptr_t) ptr;
+
+	// Heap objects are aligned, so the lowest bits don't carry much information
+	id >>= 4;
+
+	return (id ^ (id >> 16) ^ (id >> 32) ^ (id >> 48)) & 0xFFFF;
 }
 
-bool compareDepth(const RenderQueue::RenderQueueNode &a, const RenderQueue::RenderQueueNode &b) {
-	return (a.reference <= b.reference);
-	//return (a.reference.lengthSquared() <= b.reference.lengthSquared());
+/** The bits of a non-negative float, which compare in the same order as the float values. */
+static inline uint32_t depthBits(float depth) {
+	union {
+		float f;
+		uint32_t u;
+	} bits;
+
+	bits.f = MAX(depth, 0.0f);
+	return bits.u;
+}
+
+static bool compareKey(const RenderQueue::RenderQueueNode &a, const RenderQueue::RenderQueueNode &b) {
+	return a.key < b.key;
 }
 
 RenderQueue::RenderQueue(uint32_t precache) : _nodeArray(precache), _cameraReference(0.0f, 0.0f, 0.0f) {
@@ -90,18 +101,35 @@ void RenderQueue::queueItem(Shader::ShaderRenderable *renderable, const glm::mat
 }
 
 void RenderQueue::sortShader() {
-	if (_nodeArray.size() > 1) {
-		std::sort(_nodeArray.begin(), _nodeArray.end(), compareShader);
+	if (_nodeArray.size() <= 1)
+		return;
+
+	// Program, material, mesh, then the coarse depth, 16 bits each
+	for (std::vector<RenderQueueNode>::iterator n = _nodeArray.begin(); n != _nodeArray.end(); ++n) {
+		n->key = ((uint64_t) (n->program->glid & 0xFFFF) << 48) |
+		         (sortID(n->material) << 32) |
+		         (sortID(n->mesh)     << 16) |
+		         (depthBits(n->reference) >> 16);
 	}
+
+	std::sort(_nodeArray.begin(), _nodeArray.end(), compareKey);
 }
 
 void RenderQueue::sortDepth() {
-	if (_nodeArray.size() > 1) {
-		std::sort(_nodeArray.begin(), _nodeArray.end(), compareDepth);
+	if (_nodeArray.size() <= 1)
+		return;
+
+	// Depth first, with equally deep nodes grouped by state
+	for (std::vector<RenderQueueNode>::iterator n = _nodeArray.begin(); n != _nodeArray.end(); ++n) {
+		n->key = ((uint64_t) depthBits(n->reference) << 32) |
+		         ((uint64_t) (n->program->glid & 0xFFFF) << 16) |
+		         sortID(n->mesh);
 	}
+
+	std::sort(_nodeArray.begin(), _nodeArray.end(), compareKey);
 }
 
-void RenderQueue::render() {
+void RenderQueue::render(InstanceBuffer *instances) {
 	if (_nodeArray.size() == 0) {
 		return;
 	}
@@ -150,7 +178,6 @@ void RenderQueue::render() {
 			currentSurface->bindGLState();
 		}
 
-		currentSurface = _nodeArray[i].surface;
 		currentMesh = _nodeArray[i].mesh;
 		currentMesh->renderBind();  // Binds VAO ready for rendering.
 
@@ -160,21 +187,41 @@ void RenderQueue::render() {
 		assert(currentMaterial);
 
 		currentSurface->bindProgram(currentProgram, _nodeArray[i].transform);
-		//currentSurface->bindObjectModelview(currentProgram, _nodeArray[i].transform);
 		bindBoneUniforms(currentProgram, currentSurface, currentMesh);
-		currentMaterial->bindFade(currentProgram, _nodeArray[i].alpha);
-		currentMesh->render();
-
-		++i;  // Move to next object.
-		while ((i < limit) && (_nodeArray[i].mesh == currentMesh) && (_nodeArray[i].material == currentMaterial) && (_nodeArray[i].surface == currentSurface)) {
-			// Next object is basically the same, but will have a different object modelview transform. So rebind that, and render again.
-			assert(_nodeArray[i].transform);
-			currentSurface->bindObjectModelview(currentProgram, _nodeArray[i].transform);
-			bindBoneUniforms(currentProgram, currentSurface, currentMesh);
+
+		// Find all following objects that are basically the same, only with a different object modelview transform.
+		uint32_t end = i + 1;
+		while ((end < limit) && (_nodeArray[end].mesh == currentMesh) && (_nodeArray[end].material == currentMaterial) && (_nodeArray[end].surface == currentSurface)) {
+			++end;
+		}
+
+		const bool instancing = instances && currentProgram->instanced;
+
+		while (i < end) {
+			// Objects with the same alpha can be drawn in one instanced call.
+			uint32_t runEnd = i + 1;
+			if (instancing) {
+				while ((runEnd < end) && (_nodeArray[runEnd].alpha == _nodeArray[i].alpha)) {
+					++runEnd;
+				}
+			}
+
 			currentMaterial->bindFade(currentProgram, _nodeArray[i].alpha);
-			currentMesh->render();
-			++i;
+
+			if ((runEnd - i) >= kMinInstanceCount) {
+				renderInstanced(*instances, i, runEnd);
+				i = runEnd;
+				continue;
+			}
+
+			for (; i < runEnd; ++i) {
+				assert(_nodeArray[i].transform);
+				currentSurface->bindObjectModelview(currentProgram, _nodeArray[i].transform);
+				currentMaterial->bindFade(currentProgram, _nodeArray[i].alpha);
+				currentMesh->render();
+			}
 		}
+
 		// Done rendering, unbind the mesh, and onwards into the queue.
 		currentMesh->renderUnbind();
 	}
@@ -187,12 +234,34 @@ void RenderQueue::render() {
 
 	glUseProgram(0);
 	glActiveTexture(GL_TEXTURE0);
+	TextureMan.invalidateState();
+}
+
+void RenderQueue::renderInstanced(InstanceBuffer &instances, uint32_t start, uint32_t end) {
+	static const glm::mat4 kIdentity(1.0f);
+
+	_instanceTransforms.clear();
+	for (uint32_t i = start; i < end; ++i) {
+		assert(_nodeArray[i].transform);
+		_instanceTransforms.push_back(*_nodeArray[i].transform);
+	}
+
+	// The object transformations now come from the instance buffer
+	_nodeArray[start].surface->bindObjectModelview(_nodeArray[start].program, &kIdentity);
+
+	instances.bind(_instanceTransforms);
+	_nodeArray[start].mesh->renderInstanced(end - start);
+	instances.unbind();
 }
 
 void RenderQueue::clear() {
 	_nodeArray.clear();
 }
 
+void RenderQueue::append(const RenderQueue &queue) {
+	_nodeArray.insert(_nodeArray.end(), queue._nodeArray.begin(), queue._nodeArray.end());
+}
+
 void RenderQueue::bindBoneUniforms(Shader::ShaderProgram *program, Shader::ShaderSurface *surface, Mesh::Mesh *mesh) {
 	surface->bindBindPose(program, mesh->getBindPosePtr());
 
@@ -37,6 +37,8 @@ namespace Graphics {
 
 namespace Render {
 
+class InstanceBuffer;
+
 class RenderQueue {
 public:
 	struct RenderQueueNode {
@@ -47,12 +49,13 @@ public:
 		const glm::mat4 *transform;
 		float reference;  ///< Reference point to the camera location, primarily used for depth sorting.
 		float alpha;      ///< Custom alpha value applied per-object.
+		uint64_t key;     ///< Sort key, built from the fields above when sorting.
 
-		RenderQueueNode() : program(0), surface(0), material(0), mesh(0), transform(0), reference(0.0f), alpha(1.0f) {}
-		RenderQueueNode(const RenderQueueNode &src) : program(src.program), surface(src.surface), material(src.material), mesh(src.mesh), transform(src.transform), reference(src.reference), alpha(src.alpha) {}
-		RenderQueueNode(Shader::ShaderProgram *prog, Shader::ShaderSurface *sur, Shader::ShaderMaterial *mat, Mesh::Mesh *mes, const glm::mat4 *t, float a = 1.0f, float ref = 0.0f) : program(prog), surface(sur), material(mat), mesh(mes), transform(t), reference(ref), alpha(a) {}
+		RenderQueueNode() : program(0), surface(0), material(0), mesh(0), transform(0), reference(0.0f), alpha(1.0f), key(0) {}
+		RenderQueueNode(const RenderQueueNode &src) : program(src.program), surface(src.surface), material(src.material), mesh(src.mesh), transform(src.transform), reference(src.reference), alpha(src.alpha), key(src.key) {}
+		RenderQueueNode(Shader::ShaderProgram *prog, Shader::ShaderSurface *sur, Shader::ShaderMaterial *mat, Mesh::Mesh *mes, const glm::mat4 *t, float a = 1.0f, float ref = 0.0f) : program(prog), surface(sur), material(mat), mesh(mes), transform(t), reference(ref), alpha(a), key(0) {}
 
-		inline const RenderQueueNode &operator=(const RenderQueueNode &src) { program = src.program; material = src.material; surface = src.surface; mesh = src.mesh; transform = src.transform; reference = src.reference; alpha = src.alpha; return *this; }
+		inline const RenderQueueNode &operator=(const RenderQueueNode &src) { program = src.program; material = src.material; surface = src.surface; mesh = src.mesh; transform = src.transform; reference = src.reference; alpha = src.alpha; key = src.key; return *this; }
 	};
 
 	RenderQueue(uint32_t precache = 1000);
@@ -63,19 +66,32 @@ public:
 	void queueItem(Shader::ShaderProgram *program, Shader::ShaderSurface *surface, Shader::ShaderMaterial *material, Mesh::Mesh *mesh, const glm::mat4 *transform, float alpha);
 	void queueItem(Shader::ShaderRenderable *renderable, const glm::mat4 *transform, float alpha);
 
-	void sortShader(); ///< Sort queue elements by shader program.
+	void sortShader(); ///< Sort queue elements by shader program, material, mesh and then depth.
 	void sortDepth();  ///< Sort queue elements by depth.
 
-	void render();  ///< Render all queued items.
+	/** Render all queued items.
+	 *
+	 *  If an instance buffer is given, runs of items that only differ in their
+	 *  transformation are drawn with one instanced draw call.
+	 */
+	void render(InstanceBuffer *instances = 0);
 
 	void clear();  ///< Clear the queue of all items.
 
+	/** Add all items of another queue to the end of this one. */
+	void append(const RenderQueue &queue);
+
 private:
 
 	std::vector<RenderQueueNode>_nodeArray;
 	glm::vec3 _cameraReference;
 
+	std::vector<glm::mat4> _instanceTransforms; ///< Transformations of the current instanced run.
+
 	void bindBoneUniforms(Shader::ShaderProgram *program, Shader::ShaderSurface *surface, Mesh::Mesh *mesh);
+
+	/** Draw the nodes [start, end) with a single instanced draw call. */
+	void renderInstanced(InstanceBuffer &instances, uint32_t start, uint32_t end);
 };
 
 } // namespace Render
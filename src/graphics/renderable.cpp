@@ -30,7 +30,7 @@
 
 namespace Graphics {
 
-Renderable::Renderable(RenderableType type) : _clickable(false), _distance(0.0f) {
+Renderable::Renderable(RenderableType type) : _clickable(false), _distance(0.0f), _inWorldSnapshot(false), _distanceDirty(false) {
 	switch (type) {
 		case kRenderableTypeVideo:
 			_queueExists  = kQueueVideo;
@@ -68,6 +68,7 @@ Renderable::Renderable(RenderableType type) : _clickable(false), _distance(0.0f)
 
 Renderable::~Renderable() {
 	hide();
+	waitForFrameSnapshot();
 
 	removeFromQueue(_queueExists);
 }
@@ -108,10 +109,20 @@ bool Renderable::isVisible() const {
 }
 
 void Renderable::resort() {
-	sortQueue(_queueVisible);
+	GfxMan.requestResort(_queueVisible);
+}
+
+void Renderable::invalidateDistance() {
+	_distanceDirty.store(true, std::memory_order_release);
+
+	GfxMan.requestResort(_queueVisible);
 }
 
 void Renderable::show() {
+	// Put the object in the right place right away
+	if (_distanceDirty.exchange(false, std::memory_order_acq_rel))
+		calculateDistance();
+
 	lockQueue(_queueVisible);
 
 	addToQueue(_queueVisible);
@@ -138,6 +149,10 @@ bool Renderable::isIn(float UNUSED(x1), float UNUSED(y1), float UNUSED(z1),
 	return false;
 }
 
+bool Renderable::getPickBox(glm::vec3 &UNUSED(min), glm::vec3 &UNUSED(max)) const {
+	return false;
+}
+
 void Renderable::lockFrame() {
 	GfxMan.lockFrame();
 }
@@ -152,8 +167,19 @@ void Renderable::lockFrameIfVisible() {
 }
 
 void Renderable::unlockFrameIfVisible() {
-	if (isVisible())
-		GfxMan.unlockFrame();
+	if (!isVisible())
+		return;
+
+	// A visible object changed, so recorded GUI drawing is out of date
+	if (isRetainable())
+		GfxMan.invalidateGUI();
+
+	GfxMan.unlockFrame();
+}
+
+void Renderable::waitForFrameSnapshot() {
+	if (_inWorldSnapshot.load(std::memory_order_acquire))
+		GfxMan.waitForWorldSnapshot();
 }
 
 } // End of namespace Graphics
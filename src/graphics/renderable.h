@@ -25,19 +25,26 @@
 #ifndef GRAPHICS_RENDERABLE_H
 #define GRAPHICS_RENDERABLE_H
 
+#include <atomic>
+
 #include <boost/noncopyable.hpp>
 
 #include "external/glm/mat4x4.hpp"
 
 #include "src/common/ustring.h"
 
-#include "src/common/ustring.h"
-
 #include "src/graphics/types.h"
 #include "src/graphics/queueable.h"
 
+namespace Common {
+	class Frustum;
+	class BoundingBox;
+}
+
 namespace Graphics {
 
+class RenderBatch;
+
 /** An object that can be displayed by the graphics manager. */
 class Renderable : boost::noncopyable, public Queueable {
 public:
@@ -61,6 +68,37 @@ public:
 	/** Queue the object for later rendering. */
 	virtual void queueRender(const glm::mat4 &UNUSED(parentTransform)) {}
 
+	/** Can queueRender() be called on a thread other than the main thread right now?
+	 *
+	 *  Only objects that don't need to create or change any GL resources
+	 *  when queued, and that don't share state with other queued objects,
+	 *  may return true.
+	 */
+	virtual bool canQueueRenderParallel() const { return false; }
+
+	/** Is any part of the object within the view frustum? */
+	virtual bool isInFrustum(const Common::Frustum &UNUSED(frustum)) const { return true; }
+
+	/** Get the object's bounding box in world space. Returns false if it has none. */
+	virtual bool getWorldBound(Common::BoundingBox &UNUSED(bound)) const { return false; }
+
+	/** Copy the state read by the renderer, at the start of the frame.
+	 *
+	 *  Renderables whose state can change while a frame is being rendered
+	 *  render from this copy instead of their live state.
+	 */
+	virtual void snapshot() {}
+
+	/** Return the batch the object adds itself to when rendered, or 0 if it draws right away. */
+	virtual RenderBatch *getRenderBatch() { return 0; }
+
+	/** Can the object's GUI drawing be recorded once and replayed until it changes?
+	 *
+	 *  Only objects that draw the same every frame unless one of their setters
+	 *  was called, and that lock the frame in those setters, may return true.
+	 */
+	virtual bool isRetainable() const { return false; }
+
 	/** Get the distance of the object from the viewer. */
 	double getDistance() const;
 
@@ -89,6 +127,12 @@ public:
 	/** Does the line from x1.y1.z1 to x2.y2.z2 intersect with the object? */
 	virtual bool isIn(float x1, float y1, float z1, float x2, float y2, float z2) const;
 
+	/** Get the box a line has to intersect for isIn() to be true.
+	 *
+	 *  Returns false if the object has no such box, and isIn() has to be called instead.
+	 */
+	virtual bool getPickBox(glm::vec3 &min, glm::vec3 &max) const;
+
 protected:
 	QueueType _queueExists;
 	QueueType _queueVisible;
@@ -100,13 +144,27 @@ protected:
 
 	double _distance; ///< The distance of the object from the viewer.
 
+	/** Resort the queue of visible objects before the next frame is rendered. */
 	void resort();
+	/** The object moved, so recalculate its distance and resort it before the next frame is rendered. */
+	void invalidateDistance();
 
 	void lockFrame();
 	void unlockFrame();
 
 	void lockFrameIfVisible();
 	void unlockFrameIfVisible();
+
+	/** Wait until the renderer has finished with a frame this object is part of. */
+	void waitForFrameSnapshot();
+
+private:
+	/** Is the object part of the world snapshot of the frame currently rendered? */
+	std::atomic<bool> _inWorldSnapshot;
+	/** Does the object's distance need to be recalculated? */
+	std::atomic<bool> _distanceDirty;
+
+	friend class GraphicsManager;
 };
 
 } // End of namespace Graphics
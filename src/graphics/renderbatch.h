@@ -0,0 +1,47 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A batch of draw calls collected from several renderables.
+ */
+
+#ifndef GRAPHICS_RENDERBATCH_H
+#define GRAPHICS_RENDERBATCH_H
+
+namespace Graphics {
+
+/** A batch of draw calls collected from several renderables.
+ *
+ *  Renderables that return a batch from getRenderBatch() add their
+ *  geometry to it when rendered, instead of drawing it right away.
+ *  The graphics manager flushes the batch as soon as a renderable
+ *  with a different batch, or none at all, comes up.
+ */
+class RenderBatch {
+public:
+	virtual ~RenderBatch() {}
+
+	/** Draw everything collected so far, and start over. */
+	virtual void flush() = 0;
+};
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_RENDERBATCH_H
@@ -36,6 +36,12 @@ src_graphics_libgraphics_la_SOURCES += \
     src/graphics/font.h \
     src/graphics/camera.h \
     src/graphics/renderable.h \
+    src/graphics/occlusionculler.h \
+    src/graphics/pixeluploadbuffer.h \
+    src/graphics/flythrough.h \
+    src/graphics/gputimer.h \
+    src/graphics/hitchdetector.h \
+    src/graphics/renderbatch.h \
     src/graphics/resolution.h \
     src/graphics/object.h \
     src/graphics/guielement.h \
@@ -60,6 +66,11 @@ src_graphics_libgraphics_la_SOURCES += \
     src/graphics/font.cpp \
     src/graphics/camera.cpp \
     src/graphics/renderable.cpp \
+    src/graphics/occlusionculler.cpp \
+    src/graphics/pixeluploadbuffer.cpp \
+    src/graphics/flythrough.cpp \
+    src/graphics/gputimer.cpp \
+    src/graphics/hitchdetector.cpp \
     src/graphics/yuv_to_rgb.cpp \
     src/graphics/ttf.cpp \
     src/graphics/indexbuffer.cpp \
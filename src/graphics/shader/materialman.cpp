@@ -40,6 +40,8 @@ MaterialManager::~MaterialManager() {
 }
 
 void MaterialManager::init() {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
 	status("Initialising default materials...");
 
 	ShaderMaterial *material = new ShaderMaterial(ShaderMan.getShaderObject("default/colour.frag", SHADER_FRAGMENT), "defaultWhite");
@@ -95,14 +97,18 @@ void MaterialManager::init() {
 }
 
 void MaterialManager::deinit() {
-	for (std::map<Common::UString, ShaderMaterial *>::iterator iter = _resourceMap.begin(); iter != _resourceMap.end(); ++iter) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	for (ResourceMap::iterator iter = _resourceMap.begin(); iter != _resourceMap.end(); ++iter) {
 		delete iter->second;
 	}
 	_resourceMap.clear();
 }
 
 void MaterialManager::cleanup() {
-	std::map<Common::UString, ShaderMaterial *>::iterator iter = _resourceMap.begin();
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	ResourceMap::iterator iter = _resourceMap.begin();
 	while (iter != _resourceMap.end()) {
 		ShaderMaterial *material = iter->second;
 		if (material->useCount() == 0) {
@@ -114,29 +120,32 @@ void MaterialManager::cleanup() {
 }
 
 void MaterialManager::addMaterial(ShaderMaterial *material) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
 	if (!material) {
 		return;
 	}
 
-	std::map<Common::UString, ShaderMaterial *>::iterator iter = _resourceMap.find(material->getName());
-	if (iter == _resourceMap.end()) {
-		_resourceMap[material->getName()] = material;
-	}
+	_resourceMap.insert(std::make_pair(material->getName(), material));
 }
 
 void MaterialManager::delMaterial(ShaderMaterial *material) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
 	if (!material) {
 		return;
 	}
 
-	std::map<Common::UString, ShaderMaterial *>::iterator iter = _resourceMap.find(material->getName());
+	ResourceMap::iterator iter = _resourceMap.find(material->getName());
 	if (iter != _resourceMap.end()) {
 		delResource(iter);
 	}
 }
 
 ShaderMaterial *MaterialManager::getMaterial(const Common::UString &name) {
-	std::map<Common::UString, ShaderMaterial *>::iterator iter = _resourceMap.find(name);
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	ResourceMap::iterator iter = _resourceMap.find(name);
 	if (iter != _resourceMap.end()) {
 		return iter->second;
 	} else {
@@ -144,8 +153,8 @@ ShaderMaterial *MaterialManager::getMaterial(const Common::UString &name) {
 	}
 }
 
-std::map<Common::UString, ShaderMaterial *>::iterator MaterialManager::delResource(std::map<Common::UString, ShaderMaterial *>::iterator iter) {
-	std::map<Common::UString, ShaderMaterial *>::iterator inext = iter;
+MaterialManager::ResourceMap::iterator MaterialManager::delResource(ResourceMap::iterator iter) {
+	ResourceMap::iterator inext = iter;
 	inext++;
 	delete iter->second;
 	_resourceMap.erase(iter);
@@ -25,10 +25,10 @@
 #ifndef GRAPHICS_SHADER_MATERIALMAN_H
 #define GRAPHICS_SHADER_MATERIALMAN_H
 
-#include <map>
-
 #include "src/common/ustring.h"
+#include "src/common/istringkey.h"
 #include "src/common/singleton.h"
+#include "src/common/mutex.h"
 
 #include "src/graphics/shader/shadermaterial.h"
 
@@ -60,9 +60,14 @@ public:
 	ShaderMaterial *getMaterial(const Common::UString &name);
 
 private:
-	std::map<Common::UString, ShaderMaterial *> _resourceMap;
+	typedef Common::IStringKeyMap<ShaderMaterial *> ResourceMap;
+
+	ResourceMap _resourceMap;
+
+	/** Guards the resource map, since models can be loaded on several threads at once. */
+	std::recursive_mutex _mutex;
 
-	std::map<Common::UString, ShaderMaterial *>::iterator delResource(std::map<Common::UString, ShaderMaterial *>::iterator iter);
+	ResourceMap::iterator delResource(ResourceMap::iterator iter);
 };
 
 } // End of namespace Shader
@@ -0,0 +1,194 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  An on-disk cache of linked shader programs.
+ */
+
+#include <vector>
+
+#include "src/common/error.h"
+#include "src/common/ustring.h"
+#include "src/common/hash.h"
+#include "src/common/endianness.h"
+#include "src/common/readstream.h"
+#include "src/common/writefile.h"
+#include "src/common/mappedfile.h"
+#include "src/common/filepath.h"
+#include "src/common/configman.h"
+
+#include "src/graphics/shader/programcache.h"
+#include "src/graphics/shader/shader.h"
+
+static const uint32_t kCacheID      = MKTAG('X', 'S', 'P', 'C');
+static const uint32_t kCacheVersion = 1;
+
+namespace Graphics {
+
+namespace Shader {
+
+bool ProgramCache::_enabled = false;
+uint64_t ProgramCache::_driverKey = 0;
+
+static uint64_t hashString(uint64_t key, const char *string) {
+	if (!string)
+		return Common::hashFNV64(key, 0);
+
+	for (; *string; string++)
+		key = Common::hashFNV64(key, (byte) *string);
+
+	// Separate the strings, so that moving text from one to the next changes the key
+	return Common::hashFNV64(key, 0);
+}
+
+static uint64_t hashShaderObject(uint64_t key, const ShaderObject &object) {
+	key = hashString(key, object.shaderString.c_str());
+
+	for (std::vector<ShaderObject *>::const_iterator s = object.subObjects.begin(); s != object.subObjects.end(); ++s)
+		key = hashShaderObject(key, **s);
+
+	return key;
+}
+
+void ProgramCache::init() {
+	_enabled = false;
+
+	if (!ConfigMan.getBool("shadercache", false))
+		return;
+
+	if (!GLEW_VERSION_4_1 && !GLEW_ARB_get_program_binary)
+		return;
+
+	GLint formatCount = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+	if (formatCount <= 0)
+		return;
+
+	_driverKey = Common::kFNV64OffsetBasis;
+	_driverKey = hashString(_driverKey, (const char *) glGetString(GL_VENDOR));
+	_driverKey = hashString(_driverKey, (const char *) glGetString(GL_RENDERER));
+	_driverKey = hashString(_driverKey, (const char *) glGetString(GL_VERSION));
+
+	Common::FilePath::createDirectories(getDirectory());
+
+	_enabled = true;
+}
+
+bool ProgramCache::isEnabled() {
+	return _enabled;
+}
+
+uint64_t ProgramCache::getKey(const ShaderObject &vertexObject, const ShaderObject &fragmentObject) {
+	return hashShaderObject(hashShaderObject(_driverKey, vertexObject), fragmentObject);
+}
+
+Common::UString ProgramCache::getDirectory() {
+	return Common::FilePath::getUserDataDirectory() + "/shadercache";
+}
+
+Common::UString ProgramCache::getFileName(uint64_t key) {
+	return getDirectory() + "/" + Common::formatHash(key) + ".xsc";
+}
+
+void ProgramCache::prepare(GLuint program) {
+	if (_enabled)
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+}
+
+bool ProgramCache::load(uint64_t key, GLuint program) {
+	if (!_enabled)
+		return false;
+
+	const Common::UString fileName = getFileName(key);
+	if (!Common::FilePath::isRegularFile(fileName))
+		return false;
+
+	try {
+		Common::MappedReadStream cache(fileName);
+
+		if ((cache.readUint32BE() != kCacheID) || (cache.readUint32LE() != kCacheVersion))
+			throw Common::Exception("Not a shader cache file");
+
+		if (cache.readUint64LE() != key)
+			throw Common::Exception("Shader cache key mismatch");
+
+		const GLenum   format = cache.readUint32LE();
+		const uint32_t size   = cache.readUint32LE();
+
+		if (size > (cache.size() - cache.pos()))
+			throw Common::Exception("Shader cache file truncated");
+
+		std::vector<byte> binary(size);
+		cache.read(binary.data(), size);
+
+		glProgramBinary(program, format, binary.data(), size);
+
+		GLint linkStatus = GL_FALSE;
+		glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+
+		// A driver can reject a binary it wrote itself. We'll link the program again and overwrite it
+		return linkStatus == GL_TRUE;
+
+	} catch (...) {
+		// We'll link the program again and overwrite the broken file
+		Common::exceptionDispatcherWarning("Failed reading shader cache file \"%s\"", fileName.c_str());
+	}
+
+	return false;
+}
+
+void ProgramCache::save(uint64_t key, GLuint program) {
+	if (!_enabled)
+		return;
+
+	GLint size = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+	if (size <= 0)
+		return;
+
+	std::vector<byte> binary(size);
+
+	GLenum format = 0;
+	glGetProgramBinary(program, size, &size, &format, binary.data());
+	if (size <= 0)
+		return;
+
+	const Common::UString fileName = getFileName(key);
+
+	try {
+		Common::writeFileAtomically(fileName, [&binary, key, format, size](Common::WriteStream &cache) {
+			cache.writeUint32BE(kCacheID);
+			cache.writeUint32LE(kCacheVersion);
+			cache.writeUint64LE(key);
+
+			cache.writeUint32LE(format);
+			cache.writeUint32LE(size);
+
+			if (cache.write(binary.data(), size) != (size_t) size)
+				throw Common::Exception(Common::kWriteError);
+		});
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed writing shader cache file \"%s\"", fileName.c_str());
+	}
+}
+
+} // End of namespace Shader
+
+} // End of namespace Graphics
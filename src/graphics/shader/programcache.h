@@ -0,0 +1,86 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  An on-disk cache of linked shader programs.
+ */
+
+#ifndef GRAPHICS_SHADER_PROGRAMCACHE_H
+#define GRAPHICS_SHADER_PROGRAMCACHE_H
+
+#include "src/common/types.h"
+
+#include "src/graphics/types.h"
+
+namespace Common {
+	class UString;
+}
+
+namespace Graphics {
+
+namespace Shader {
+
+class ShaderObject;
+
+/** An on-disk cache of linked shader programs.
+ *
+ *  Compiling and linking all the generated shaders takes a noticeable
+ *  time on every start. When enabled with the "shadercache" config
+ *  option, and the driver supports GL_ARB_get_program_binary, the binary
+ *  of each linked program is stored in the user data directory and
+ *  loaded directly the next time, without compiling anything.
+ *
+ *  The cache key covers the sources of all shader objects in the program
+ *  and the OpenGL vendor, renderer and version strings, so a driver update
+ *  never loads a stale binary. Drivers can reject a binary anyway, in
+ *  which case the program is just built from source again.
+ */
+class ProgramCache {
+public:
+	/** Check the driver's support and the config. Needs a current OpenGL context. */
+	static void init();
+
+	/** Is the program cache enabled and supported? */
+	static bool isEnabled();
+
+	/** Calculate the cache key of a program linked from these shader objects. */
+	static uint64_t getKey(const ShaderObject &vertexObject, const ShaderObject &fragmentObject);
+
+	/** Load the program binary with this key into a freshly created program. */
+	static bool load(uint64_t key, GLuint program);
+	/** Store the binary of this freshly linked program in the cache. */
+	static void save(uint64_t key, GLuint program);
+
+	/** Ask the driver to keep a program's binary around, before linking it. */
+	static void prepare(GLuint program);
+
+private:
+	static bool _enabled;
+	static uint64_t _driverKey; ///< Hash of the OpenGL driver identification.
+
+	static Common::UString getDirectory();
+	static Common::UString getFileName(uint64_t key);
+};
+
+} // End of namespace Shader
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_SHADER_PROGRAMCACHE_H
@@ -31,6 +31,7 @@ src_graphics_shader_libshader_la_SOURCES += \
     src/graphics/shader/shadersurface.h \
     src/graphics/shader/materialman.h \
     src/graphics/shader/surfaceman.h \
+    src/graphics/shader/programcache.h \
     $(EMPTY)
 
 src_graphics_shader_libshader_la_SOURCES += \
@@ -42,4 +43,5 @@ src_graphics_shader_libshader_la_SOURCES += \
     src/graphics/shader/shadersurface.cpp \
     src/graphics/shader/materialman.cpp \
     src/graphics/shader/surfaceman.cpp \
+    src/graphics/shader/programcache.cpp \
     $(EMPTY)
@@ -33,8 +33,10 @@
 
 #include "src/graphics/shader/shader.h"
 #include "src/graphics/shader/shaderbuilder.h"
+#include "src/graphics/shader/programcache.h"
 
 #include "src/graphics/aurora/texture.h"
+#include "src/graphics/aurora/textureman.h"
 
 /*--------------------------------------------------------------------*/
 
@@ -87,6 +89,8 @@ void ShaderManager::init() {
 	//_isGL3 = isGL3;  // pull this from GfxMan
 	status("Initialising shaders...");
 
+	ProgramCache::init();
+
 	ShaderObject *vObj;
 	ShaderObject *fObj;
 
@@ -255,6 +259,7 @@ void ShaderManager::bindShaderVariable(ShaderObject::ShaderObjectVariable &var,
 		case SHADER_SAMPLER2D:
 			glUniform1i(loc, static_cast<const ShaderSampler *>(data)->unit);
 			glActiveTexture(GL_TEXTURE0 + static_cast<const ShaderSampler *>(data)->unit);
+			TextureMan.request(static_cast<const ShaderSampler *>(data)->handle);
 			glBindTexture(GL_TEXTURE_2D, static_cast<const ShaderSampler *>(data)->handle.getTexture().getID());
 			break;
 		case SHADER_SAMPLER3D:
@@ -275,6 +280,7 @@ void ShaderManager::bindShaderVariable(ShaderObject::ShaderObjectVariable &var,
 		case SHADER_SAMPLER2DSHADOW:
 			glUniform1i(loc, static_cast<const ShaderSampler *>(data)->unit);
 			glActiveTexture(GL_TEXTURE0 + static_cast<const ShaderSampler *>(data)->unit);
+			TextureMan.request(static_cast<const ShaderSampler *>(data)->handle);
 			glBindTexture(GL_TEXTURE_2D, static_cast<const ShaderSampler *>(data)->handle.getTexture().getID());
 			break;
 		case SHADER_SAMPLER1DARRAY:
@@ -319,6 +325,10 @@ void ShaderManager::bindShaderVariable(ShaderObject::ShaderObjectVariable &var,
 			break;
 		default: break;
 	}
+
+	// Samplers bind textures behind the TextureManager's back
+	if ((var.type >= SHADER_SAMPLER1D) && (var.type <= SHADER_SAMPLERBUFFER))
+		TextureMan.invalidateState();
 }
 
 void ShaderManager::bindShaderInstance(ShaderProgram *prog, const void **vertexVariables, const void **fragmentVariables) {
@@ -561,15 +571,7 @@ void ShaderManager::genGLShader(ShaderObject *object) {
 	}
 }
 
-void ShaderManager::genGLProgram(ShaderProgram *program) {
-	if (program->glid != 0) {
-		return;
-	}
-
-	GLuint glid = glCreateProgram();
-	ShaderObject *vertexObject = program->vertexObject;
-	ShaderObject *fragmentObject = program->fragmentObject;
-
+bool ShaderManager::linkGLProgram(GLuint glid, ShaderObject *vertexObject, ShaderObject *fragmentObject) {
 	// These functions will do nothing if the object has already been initialised.
 	genGLShader(vertexObject);
 	genGLShader(fragmentObject);
@@ -586,11 +588,14 @@ void ShaderManager::genGLProgram(ShaderProgram *program) {
 		glBindAttribLocation(glid, (GLuint)(VERTEX_NORMAL), "inputNormal0");
 		glBindAttribLocation(glid, (GLuint)(VERTEX_TEXCOORD1), "inputUV1");
 		glBindAttribLocation(glid, (GLuint)(VERTEX_COLOR), "inputColour");
+		glBindAttribLocation(glid, (GLuint)(VERTEX_INSTANCE_TRANSFORM), "inputInstanceTransform");
 	}
 
 	glBindAttribLocation(glid, (GLuint)(VERTEX_BONEINDICES), "inputBoneIndices");
 	glBindAttribLocation(glid, (GLuint)(VERTEX_BONEWEIGHTS), "inputBoneWeights");
 
+	ProgramCache::prepare(glid);
+
 	glLinkProgram(glid);
 
 	GLint linkStatus;
@@ -601,12 +606,38 @@ void ShaderManager::genGLProgram(ShaderProgram *program) {
 		glGetProgramInfoLog(glid, 4095, &logolength, logorama);
 		error("Shader link failure! Driver output: %s", logorama);
 
-		glDeleteProgram(glid);
+		return false;
+	}
+
+	return true;
+}
 
+void ShaderManager::genGLProgram(ShaderProgram *program) {
+	if (program->glid != 0) {
 		return;
 	}
 
+	GLuint glid = glCreateProgram();
+	ShaderObject *vertexObject = program->vertexObject;
+	ShaderObject *fragmentObject = program->fragmentObject;
+
+	// With a cached binary, neither the shader objects nor the program need to be compiled
+	const uint64_t cacheKey = ProgramCache::isEnabled() ? ProgramCache::getKey(*vertexObject, *fragmentObject) : 0;
+	if (!ProgramCache::load(cacheKey, glid)) {
+		if (!linkGLProgram(glid, vertexObject, fragmentObject)) {
+			glDeleteProgram(glid);
+			return;
+		}
+
+		ProgramCache::save(cacheKey, glid);
+	}
+
 	program->glid = glid;
+	program->instanced = GfxMan.isGL3() && (glGetAttribLocation(glid, "inputInstanceTransform") == VERTEX_INSTANCE_TRANSFORM);
+
+	// Look up all uniform locations once, so that binding never needs to search by name
+	program->vertexVariableLocations.clear();
+	program->fragmentVariableLocations.clear();
 
 	for (uint32_t i = 0; i < vertexObject->variablesCombined.size(); ++i) {
 		GLint location;
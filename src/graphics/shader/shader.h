@@ -150,7 +150,8 @@ enum ShaderVertexAttrib {
 	VERTEX_BONEINDICES = 3,
 	VERTEX_BONEWEIGHTS = 4,
 	VERTEX_TEXCOORD0   = 5,
-	VERTEX_TEXCOORD1   = 6
+	VERTEX_TEXCOORD1   = 6,
+	VERTEX_INSTANCE_TRANSFORM = 7  ///< A mat4, taking up locations 7 to 10.
 };
 
 enum ShaderUBOIndex {
@@ -224,6 +225,7 @@ public:
 	uint64_t id { 0 };  // Set to (vertex.id << 32) | fragment.id
 	GLuint glid { 0 };
 	uint32_t usageCount { 0 };
+	bool instanced { false };  // Does the vertex shader read the per-instance transformation?
 
 	void bindAttribute(ShaderVertexAttrib attrib, const Common::UString &name) {
 		glBindAttribLocation(glid, (GLuint)(attrib), name.c_str());
@@ -277,6 +279,12 @@ public:
 	/** Generate GL id for, and link, a shader program. */
 	void genGLProgram(ShaderProgram *program);
 
+private:
+	/** Compile the shader objects and link them into a program. */
+	bool linkGLProgram(GLuint glid, ShaderObject *vertexObject, ShaderObject *fragmentObject);
+
+public:
+
 private:
 	uint32_t _counterVID;
 	uint32_t _counterFID;
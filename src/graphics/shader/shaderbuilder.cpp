@@ -89,10 +89,11 @@ void ShaderDescriptor::build(bool isGL3, Common::UString &v_string, Common::UStr
 		v_header = "#version 150\n\n"
 		           "uniform mat4 _objectModelviewMatrix;\n"
 		           "uniform mat4 _projectionMatrix;\n"
-		           "uniform mat4 _modelviewMatrix;\n";
+		           "uniform mat4 _modelviewMatrix;\n"
+		           "in mat4 inputInstanceTransform;\n";
 
 		v_body =   "void main(void) {\n"
-		           "	mat4 mo = (_modelviewMatrix * _objectModelviewMatrix);\n";
+		           "	mat4 mo = (_modelviewMatrix * _objectModelviewMatrix * inputInstanceTransform);\n";
 
 
 		f_header = "#version 150\n\n"
@@ -185,24 +186,13 @@ void ShaderDescriptor::build(bool isGL3, Common::UString &v_string, Common::UStr
 				f_desc_string = "varying vec3 position0;\n";
 			}
 			if (boneCount > 0) {
-				body_desc_string = "vec4 iv = vec4(inputPosition0.xyz, 1.0f);\n"
-				                   "vec4 _vertex = vec4(0.0f, 0.0f, 0.0f, 1.0f);\n"
-				                   "mat4 invBindPose = inverse(_bindPose);\n"
-				                   "for (int i = 0; i < 4; ++i) {\n"
-				                   "	int boneIndex = -1;\n"
-				                   "	float boneWeight = 0.0f;\n"
-				                   "	if      (i == 0) { boneIndex = int(inputBoneIndices.x); boneWeight = inputBoneWeights.x; }\n"
-				                   "	else if (i == 1) { boneIndex = int(inputBoneIndices.y); boneWeight = inputBoneWeights.y; }\n"
-				                   "	else if (i == 2) { boneIndex = int(inputBoneIndices.z); boneWeight = inputBoneWeights.z; }\n"
-				                   "	else if (i == 3) { boneIndex = int(inputBoneIndices.w); boneWeight = inputBoneWeights.w; }\n"
-				                   "	if (boneIndex != -1) {\n"
-				                   "		vec4 tmp = (invBindPose * _boneTransforms[boneIndex] * _bindPose) * iv;\n"
-				                   "		_vertex.x += boneWeight * tmp.x;\n"
-				                   "		_vertex.y += boneWeight * tmp.y;\n"
-				                   "		_vertex.z += boneWeight * tmp.z;\n"
-				                   "	}\n"
-				                   "}\n"
-				                   "_vertex = mo * _vertex;"
+				// The bone transforms are precomposed with the bind pose, so blending them is enough
+				body_desc_string = "mat4 skin = mat4(0.0);\n"
+				                   "if (inputBoneIndices.x >= 0.0) skin += inputBoneWeights.x * _boneTransforms[int(inputBoneIndices.x)];\n"
+				                   "if (inputBoneIndices.y >= 0.0) skin += inputBoneWeights.y * _boneTransforms[int(inputBoneIndices.y)];\n"
+				                   "if (inputBoneIndices.z >= 0.0) skin += inputBoneWeights.z * _boneTransforms[int(inputBoneIndices.z)];\n"
+				                   "if (inputBoneIndices.w >= 0.0) skin += inputBoneWeights.w * _boneTransforms[int(inputBoneIndices.w)];\n"
+				                   "vec4 _vertex = mo * vec4((skin * vec4(inputPosition0.xyz, 1.0)).xyz, 1.0);\n"
 				                   "gl_Position = _projectionMatrix * _vertex;\n"
 				                   "position0 = vec3(_vertex);\n";
 			} else {
@@ -52,14 +52,18 @@ void SurfaceManager::init() {
 }
 
 void SurfaceManager::deinit() {
-	for (std::map<Common::UString, ShaderSurface *>::iterator iter = _resourceMap.begin(); iter != _resourceMap.end(); ++iter) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	for (ResourceMap::iterator iter = _resourceMap.begin(); iter != _resourceMap.end(); ++iter) {
 		delete iter->second;
 	}
 	_resourceMap.clear();
 }
 
 void SurfaceManager::cleanup() {
-	std::map<Common::UString, ShaderSurface *>::iterator iter = _resourceMap.begin();
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	ResourceMap::iterator iter = _resourceMap.begin();
 	while (iter != _resourceMap.end()) {
 		ShaderSurface *surface = iter->second;
 		iter++;
@@ -72,29 +76,32 @@ void SurfaceManager::cleanup() {
 }
 
 void SurfaceManager::addSurface(ShaderSurface *surface) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
 	if (!surface) {
 		return;
 	}
 
-	std::map<Common::UString, ShaderSurface *>::iterator iter = _resourceMap.find(surface->getName());
-	if (iter == _resourceMap.end()) {
-		_resourceMap[surface->getName()] = surface;
-	}
+	_resourceMap.insert(std::make_pair(surface->getName(), surface));
 }
 
 void SurfaceManager::delSurface(ShaderSurface *surface) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
 	if (!surface) {
 		return;
 	}
 
-	std::map<Common::UString, ShaderSurface *>::iterator iter = _resourceMap.find(surface->getName());
+	ResourceMap::iterator iter = _resourceMap.find(surface->getName());
 	if (iter != _resourceMap.end()) {
 		delResource(iter);
 	}
 }
 
 ShaderSurface *SurfaceManager::getSurface(const Common::UString &name) {
-	std::map<Common::UString, ShaderSurface *>::iterator iter = _resourceMap.find(name);
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	ResourceMap::iterator iter = _resourceMap.find(name);
 	if (iter != _resourceMap.end()) {
 		return iter->second;
 	} else {
@@ -102,8 +109,8 @@ ShaderSurface *SurfaceManager::getSurface(const Common::UString &name) {
 	}
 }
 
-std::map<Common::UString, ShaderSurface *>::iterator SurfaceManager::delResource(std::map<Common::UString, ShaderSurface *>::iterator iter) {
-	std::map<Common::UString, ShaderSurface *>::iterator inext = iter;
+SurfaceManager::ResourceMap::iterator SurfaceManager::delResource(ResourceMap::iterator iter) {
+	ResourceMap::iterator inext = iter;
 	inext++;
 	delete iter->second;
 	_resourceMap.erase(iter);
@@ -25,10 +25,10 @@
 #ifndef GRAPHICS_SHADER_SURFACEMAN_H
 #define GRAPHICS_SHADER_SURFACEMAN_H
 
-#include <map>
-
 #include "src/common/ustring.h"
+#include "src/common/istringkey.h"
 #include "src/common/singleton.h"
+#include "src/common/mutex.h"
 
 #include "src/graphics/shader/shadersurface.h"
 
@@ -60,9 +60,14 @@ public:
 	ShaderSurface *getSurface(const Common::UString &name);
 
 private:
-	std::map<Common::UString, ShaderSurface *> _resourceMap;
+	typedef Common::IStringKeyMap<ShaderSurface *> ResourceMap;
+
+	ResourceMap _resourceMap;
+
+	/** Guards the resource map, since models can be loaded on several threads at once. */
+	std::recursive_mutex _mutex;
 
-	std::map<Common::UString, ShaderSurface *>::iterator delResource(std::map<Common::UString, ShaderSurface *>::iterator iter);
+	ResourceMap::iterator delResource(ResourceMap::iterator iter);
 };
 
 } // End of namespace Shader
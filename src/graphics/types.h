@@ -104,6 +104,23 @@ enum RenderPass {
 	kRenderPassAll         = 2  ///< Render all parts.
 };
 
+/** The measured stages of rendering a frame. */
+enum GPUStage {
+	kGPUStageFrame            = 0, ///< The whole frame.
+	kGPUStageBeginScene          , ///< Clearing the buffers.
+	kGPUStageVideo               , ///< Playing a video.
+	kGPUStageGUIBack             , ///< The GUI behind the world.
+	kGPUStageWorld               , ///< All world objects.
+	kGPUStageWorldOpaque         , ///< The opaque parts of the world objects.
+	kGPUStageWorldTransparent    , ///< The transparent parts of the world objects.
+	kGPUStageGUIFront            , ///< The GUI in front of the world.
+	kGPUStageConsole             , ///< The console.
+	kGPUStageImGui               , ///< ImGui windows.
+	kGPUStageCursor              , ///< The mouse cursor.
+	kGPUStageEndScene            , ///< Finishing and presenting the frame.
+	kGPUStageMAX
+};
+
 struct ColorPosition {
 	size_t position;
 
@@ -121,6 +138,10 @@ typedef std::vector<ColorPosition> ColorPositions;
 // Aliased to either glCompressedTexImage2D or glCompressedTexImage2DARB, whichever is available
 extern PFNGLCOMPRESSEDTEXIMAGE2DPROC glCompressedTexImage2D;
 
+#undef glVertexAttribDivisor
+// Aliased to either glVertexAttribDivisor or glVertexAttribDivisorARB, whichever is available
+extern PFNGLVERTEXATTRIBDIVISORPROC glVertexAttribDivisor;
+
 } // End of namespace Graphics
 
 #endif // GRAPHICS_TYPES_H
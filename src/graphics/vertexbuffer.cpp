@@ -25,12 +25,35 @@
 #include <cstdlib>
 #include <cstring>
 #include <cassert>
+#include <cmath>
+
+#include "src/common/util.h"
+#include "src/common/profiler.h"
 
 #include "src/graphics/vertexbuffer.h"
 #include "src/graphics/indexbuffer.h"
+#include "src/graphics/graphics.h"
 
 namespace Graphics {
 
+uint32_t packNormal(float x, float y, float z) {
+	const float n[3] = { x, y, z };
+
+	uint32_t packed = 0;
+	for (int i = 0; i < 3; i++) {
+		const int32_t v = (int32_t) roundf(CLIP(n[i], -1.0f, 1.0f) * 511.0f);
+
+		packed |= (((uint32_t) v) & 0x3FF) << (10 * i);
+	}
+
+	return packed;
+}
+
+uint8_t packUnorm8(float value) {
+	return (uint8_t) roundf(CLIP(value, 0.0f, 1.0f) * 255.0f);
+}
+
+
 GLvoid *VertexAttrib::getData() {
 	return const_cast<GLvoid *>(pointer);
 }
@@ -166,10 +189,12 @@ void VertexBuffer::setVertexDecl(const VertexDecl &decl) {
 
 uint32_t VertexBuffer::getTypeSize(GLenum type) {
 	switch (type) {
+		case GL_BYTE:
 		case GL_UNSIGNED_BYTE:
 			return 1;
 		case GL_SHORT:
 		case GL_UNSIGNED_SHORT:
+		case GL_HALF_FLOAT:
 		case GL_2_BYTES:
 			return 2;
 		case GL_3_BYTES:
@@ -188,11 +213,19 @@ uint32_t VertexBuffer::getTypeSize(GLenum type) {
 	return 0;
 }
 
+uint32_t VertexBuffer::getAttribSize(const VertexAttrib &attrib) {
+	// Packed formats hold all four components in one 32-bit value
+	if ((attrib.type == GL_INT_2_10_10_10_REV) || (attrib.type == GL_UNSIGNED_INT_2_10_10_10_REV))
+		return 4;
+
+	return attrib.size * getTypeSize(attrib.type);
+}
+
 void VertexBuffer::setVertexDeclLinear(uint32_t vertCount, VertexDecl &decl) {
 	uint32_t vertSize = 0;
 	_decl.clear();
 	for (VertexDecl::iterator a = decl.begin(); a != decl.end(); ++a)
-		vertSize += a->size * getTypeSize(a->type);
+		vertSize += getAttribSize(*a);
 
 	setSize(vertCount, vertSize);
 
@@ -201,7 +234,7 @@ void VertexBuffer::setVertexDeclLinear(uint32_t vertCount, VertexDecl &decl) {
 		a->stride  = 0;
 		a->pointer = data;
 
-		data += vertCount * a->size * getTypeSize(a->type);
+		data += vertCount * getAttribSize(*a);
 		_decl.push_back(*a);
 	}
 }
@@ -210,7 +243,7 @@ void VertexBuffer::setVertexDeclInterleave(uint32_t vertCount, VertexDecl &decl)
 	uint32_t vertSize = 0;
 	_decl.clear();
 	for (VertexDecl::iterator a = decl.begin(); a != decl.end(); ++a)
-		vertSize += a->size * getTypeSize(a->type);
+		vertSize += getAttribSize(*a);
 
 	setSize(vertCount, vertSize);
 
@@ -219,7 +252,7 @@ void VertexBuffer::setVertexDeclInterleave(uint32_t vertCount, VertexDecl &decl)
 		a->stride  = vertSize;
 		a->pointer = _data + offset;
 
-		offset += a->size * getTypeSize(a->type);
+		offset += getAttribSize(*a);
 		_decl.push_back(*a);
 	}
 }
@@ -263,6 +296,8 @@ void VertexBuffer::initGL(GLuint hint) {
 
 	_hint = hint;
 	if (_count) {
+		PROFILE_NOTE("upload", Common::UString::format("Vertex buffer, %u bytes", _count * _size));
+
 		glGenBuffers(1, &_vbo);
 		glBindBuffer(GL_ARRAY_BUFFER, _vbo);
 		glBufferData(GL_ARRAY_BUFFER, _count * _size, _data, _hint);
@@ -282,6 +317,10 @@ void VertexBuffer::updateGLBound() const {
 	glBufferSubData(GL_ARRAY_BUFFER, 0, _count * _size, _data);
 }
 
+void VertexBuffer::updateGLBound(uint32_t count) const {
+	glBufferSubData(GL_ARRAY_BUFFER, 0, MIN(count, _count) * _size, _data);
+}
+
 void VertexBuffer::destroyGL() {
 	if (_vbo != 0) {
 		glDeleteBuffers(1, &_vbo);
@@ -300,6 +339,7 @@ void VertexBuffer::draw(GLenum mode, const IndexBuffer &indexBuffer) const {
 	for (VertexDecl::const_iterator d = _decl.begin(); d != _decl.end(); ++d)
 		d->enable();
 
+	GfxMan.countDrawCall(mode, indexBuffer.getCount());
 	glDrawElements(mode, indexBuffer.getCount(), indexBuffer.getType(), indexBuffer.getData());
 
 	for (VertexDecl::const_iterator d = _decl.begin(); d != _decl.end(); ++d)
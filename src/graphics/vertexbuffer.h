@@ -48,10 +48,11 @@ struct VertexAttrib {
 	GLenum type;           ///< Data type of each attribute component in the array.
 	GLsizei stride;        ///< Byte offset between consecutive vertex attributes.
 	const GLvoid *pointer; ///< Offset of the first component of the first generic vertex attribute.
+	GLboolean normalized;  ///< Are integer components mapped to [0, 1] or [-1, 1]? Shader attributes only.
 
 	VertexAttrib() { }
-	VertexAttrib(GLuint i, GLint s, GLenum t, GLsizei st = 0, const GLvoid *p = 0) :
-		index(i), size(s), type(t), stride(st), pointer(p) { }
+	VertexAttrib(GLuint i, GLint s, GLenum t, GLboolean n = GL_FALSE) :
+		index(i), size(s), type(t), stride(0), pointer(0), normalized(n) { }
 
 	GLvoid *getData();
 	const GLvoid *getData() const;
@@ -64,6 +65,11 @@ struct VertexAttrib {
 /** Vertex data layout. */
 typedef std::vector<VertexAttrib> VertexDecl;
 
+/** Pack a unit normal into a signed normalized GL_INT_2_10_10_10_REV attribute. */
+uint32_t packNormal(float x, float y, float z);
+/** Pack a value within [0, 1] into an unsigned normalized GL_UNSIGNED_BYTE attribute component. */
+uint8_t packUnorm8(float value);
+
 class IndexBuffer;
 
 /** Buffer containing vertex data. */
@@ -125,6 +131,8 @@ public:
 
 	/** Update an existing GL buffer object, assuming it is already bound. */
 	void updateGLBound() const;
+	/** Update the first count vertices of an existing GL buffer object, assuming it is already bound. */
+	void updateGLBound(uint32_t count) const;
 
 	/** Clear (destroy) GL resources associated with the buffer. */
 	void destroyGL();
@@ -146,6 +154,8 @@ private:
 	GLuint _hint;      ///< GL hint for static or dynamic data.
 
 	static uint32_t getTypeSize(GLenum type);
+	/** Return the number of bytes one vertex attribute takes up. */
+	static uint32_t getAttribSize(const VertexAttrib &attrib);
 };
 
 } // End of namespace Graphics
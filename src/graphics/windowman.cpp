@@ -48,6 +48,7 @@ namespace Graphics {
 
 WindowManager::WindowManager() {
 	_fullScreen = false;
+	_hidden     = false;
 
 	_fsaaMax = 0;
 
@@ -76,7 +77,8 @@ void WindowManager::init() {
 
 	_width      = ConfigMan.getInt ("width"     , _width);
 	_height     = ConfigMan.getInt ("height"    , _height);
-	_fullScreen = ConfigMan.getBool("fullscreen", false);
+	_hidden     = ConfigMan.getBool("headless"  , false);
+	_fullScreen = ConfigMan.getBool("fullscreen", false) && !_hidden;
 
 	probeFSAA();
 
@@ -280,6 +282,8 @@ uint32_t WindowManager::windowFlags() {
 	uint32_t flags = SDL_WINDOW_OPENGL;
 	if (_fullScreen)
 		flags |= SDL_WINDOW_FULLSCREEN;
+	if (_hidden)
+		flags |= SDL_WINDOW_HIDDEN;
 	return flags;
 }
 
@@ -106,6 +106,7 @@ private:
 	};
 
 	bool _fullScreen; ///< Are we currently in fullscreen mode?
+	bool _hidden;     ///< Is the window hidden, because nothing is ever presented?
 
 	int _fsaaMax; ///< Max supported FSAA level.
 
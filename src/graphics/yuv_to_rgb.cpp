@@ -22,12 +22,12 @@
  *  Efficient YUV to RGB conversion.
  */
 
-// The YUV to RGB conversion code is derived from ScummVM's YUV conversion code,
-// which is derived from SDL's YUV overlay code, which in turn appears to be
-// derived from mpeg_play. The following copyright notices have been included
-// in accordance with the original license. Please note that the term "software"
-// in this context only applies to the YUVToRGBLookup constructor, YUVToRGBManager
-// constructor and convert420() functions below.
+// The original YUV to RGB conversion code was derived from ScummVM's YUV
+// conversion code, which is derived from SDL's YUV overlay code, which in turn
+// appears to be derived from mpeg_play. The conversion below has since been
+// rewritten to use fixed-point arithmetic instead of lookup tables, but the
+// following copyright notices have been kept in accordance with the original
+// license.
 
 // Copyright (c) 1995 The Regents of the University of California.
 // All rights reserved.
@@ -86,189 +86,348 @@
 // BASIS, AND BROWN UNIVERSITY HAS NO OBLIGATION TO PROVIDE MAINTENANCE,
 // SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 
-#include "src/common/error.h"
-#include "src/common/singleton.h"
+#include <cmath>
+
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+	#include <arm_neon.h>
+#endif
+
 #include "src/common/util.h"
+#include "src/common/threadpool.h"
 
 #include "src/graphics/yuv_to_rgb.h"
 
 DECLARE_SINGLETON(Graphics::YUVToRGBManager)
 
+/** Fractional bits of the fixed-point conversion coefficients. */
+static const int kCoefficientBits = 13;
+
+/** Only split the conversion over several threads if each gets at least that many pixels. */
+static const size_t kMinPixelsPerThread = 128 * 1024;
+
 namespace Graphics {
 
-class YUVToRGBLookup {
-public:
-	YUVToRGBLookup(YUVToRGBManager::LuminanceScale scale);
+/** The fixed-point coefficients converting one YUV pixel to RGB. */
+struct YUVCoefficients {
+	int16_t yOffset; ///< Black level, subtracted from the luminance.
 
-	YUVToRGBManager::LuminanceScale getScale() const { return _scale; }
-	const byte *getRGBToPix() const { return _rgbToPix; }
+	int16_t y;  ///< Luminance scale.
+	int16_t rV; ///< Red from V.
+	int16_t gU; ///< Green from U.
+	int16_t gV; ///< Green from V.
+	int16_t bU; ///< Blue from U.
+};
 
-private:
-	YUVToRGBManager::LuminanceScale _scale;
-	byte _rgbToPix[3 * 768];
+/** A pair of destination and source rows. */
+struct YUVRows {
+	byte *dst[2];
+
+	const byte *y[2];
+	const byte *a[2];
+
+	const byte *u;
+	const byte *v;
 };
 
-YUVToRGBLookup::YUVToRGBLookup(YUVToRGBManager::LuminanceScale scale) {
-	_scale = scale;
+static inline byte clip(int32_t x) {
+	return (x < 0) ? 0 : ((x > 255) ? 255 : x);
+}
 
-	byte *r_2_pix_alloc = &_rgbToPix[0 * 768];
-	byte *g_2_pix_alloc = &_rgbToPix[1 * 768];
-	byte *b_2_pix_alloc = &_rgbToPix[2 * 768];
+/** The factors converting one YUV pixel to RGB: y, rV, gU, gV, bU. */
+static void getFactors(double factors[5], YUVToRGBManager::LuminanceScale scale,
+                       YUVToRGBManager::ColorMatrix matrix) {
 
-	if (scale == YUVToRGBManager::kScaleFull) {
-		// Set up entries 0-255 in rgb-to-pixel value tables.
-		for (int i = 0; i < 256; i++) {
-			r_2_pix_alloc[i + 256] = i;
-			g_2_pix_alloc[i + 256] = i;
-			b_2_pix_alloc[i + 256] = i;
-		}
+	// Luma weights of red and blue
+	const double kR = (matrix == YUVToRGBManager::kMatrixBT709) ? 0.2126 : 0.299;
+	const double kB = (matrix == YUVToRGBManager::kMatrixBT709) ? 0.0722 : 0.114;
+	const double kG = 1.0 - kR - kB;
+
+	// Studio range luminance covers [16, 235], chrominance [16, 240]
+	const double yScale = (scale == YUVToRGBManager::kScaleITU) ? (255.0 / 219.0) : 1.0;
+	const double cScale = (scale == YUVToRGBManager::kScaleITU) ? (255.0 / 224.0) : 1.0;
+
+	factors[0] = yScale;
+	factors[1] =  2.0 * (1.0 - kR)           * cScale;
+	factors[2] = -2.0 * (1.0 - kB) * kB / kG * cScale;
+	factors[3] = -2.0 * (1.0 - kR) * kR / kG * cScale;
+	factors[4] =  2.0 * (1.0 - kB)           * cScale;
+}
+
+static void getCoefficients(YUVCoefficients &coeffs, YUVToRGBManager::LuminanceScale scale,
+                            YUVToRGBManager::ColorMatrix matrix) {
+
+	double factors[5];
+	getFactors(factors, scale, matrix);
+
+	const double one = 1 << kCoefficientBits;
+
+	coeffs.yOffset = (scale == YUVToRGBManager::kScaleITU) ? 16 : 0;
+
+	coeffs.y  = (int16_t) std::round(factors[0] * one);
+	coeffs.rV = (int16_t) std::round(factors[1] * one);
+	coeffs.gU = (int16_t) std::round(factors[2] * one);
+	coeffs.gV = (int16_t) std::round(factors[3] * one);
+	coeffs.bU = (int16_t) std::round(factors[4] * one);
+}
 
-		// Spread out the values we have to the rest of the array so that we do
-		// not need to check for overflow.
-		for (int i = 0; i < 256; i++) {
-			r_2_pix_alloc[i] = r_2_pix_alloc[256];
-			r_2_pix_alloc[i + 512] = r_2_pix_alloc[511];
-			g_2_pix_alloc[i] = g_2_pix_alloc[256];
-			g_2_pix_alloc[i + 512] = g_2_pix_alloc[511];
-			b_2_pix_alloc[i] = b_2_pix_alloc[256];
-			b_2_pix_alloc[i + 512] = b_2_pix_alloc[511];
+/** Convert pixels [start, end) of a row pair, without any vector instructions. */
+static void convertRowsScalar(const YUVRows &rows, const YUVCoefficients &coeffs,
+                              int start, int end) {
+
+	const int32_t rounding = 1 << (kCoefficientBits - 1);
+
+	for (int x = start; x < end; x += 2) {
+		const int32_t u = rows.u[x >> 1] - 128;
+		const int32_t v = rows.v[x >> 1] - 128;
+
+		const int32_t r =                 coeffs.rV * v + rounding;
+		const int32_t g = coeffs.gU * u + coeffs.gV * v + rounding;
+		const int32_t b = coeffs.bU * u                 + rounding;
+
+		for (int i = 0; i < 2; i++) {
+			for (int j = 0; j < 2; j++) {
+				const int32_t y = (rows.y[i][x + j] - coeffs.yOffset) * coeffs.y;
+
+				byte *dst = rows.dst[i] + (x + j) * 4;
+
+				dst[0] = clip((y + b) >> kCoefficientBits);
+				dst[1] = clip((y + g) >> kCoefficientBits);
+				dst[2] = clip((y + r) >> kCoefficientBits);
+				dst[3] = rows.a[i] ? rows.a[i][x + j] : 0xFF;
+			}
 		}
-	} else {
-		// Set up entries 0-255 in rgb-to-pixel value tables.
-		for (int i = 16; i < 236; i++) {
-			int scaledValue = (i - 16) * 255 / 219;
-			r_2_pix_alloc[i + 256] = scaledValue;
-			g_2_pix_alloc[i + 256] = scaledValue;
-			b_2_pix_alloc[i + 256] = scaledValue;
+	}
+}
+
+#if defined(__SSE2__)
+
+/** Add the luminance to the chrominance terms of 16 pixels, and saturate the results to bytes. */
+static inline __m128i addSSE2(const __m128i yTerm[4], const __m128i cTerm[4]) {
+	__m128i sum[4];
+	for (int j = 0; j < 4; j++)
+		sum[j] = _mm_srai_epi32(_mm_add_epi32(yTerm[j], cTerm[j]), kCoefficientBits);
+
+	return _mm_packus_epi16(_mm_packs_epi32(sum[0], sum[1]), _mm_packs_epi32(sum[2], sum[3]));
+}
+
+/** Convert 16 pixels at a time, returning the number of pixels converted. */
+static int convertRowsSSE2(const YUVRows &rows, const YUVCoefficients &coeffs, int width) {
+	// Coefficient pairs for _mm_madd_epi16(), for U (or luminance) in the low and V in the high half
+	const __m128i yCoeff = _mm_set_epi16(0        , coeffs.y , 0        , coeffs.y , 0        , coeffs.y , 0        , coeffs.y );
+	const __m128i rCoeff = _mm_set_epi16(coeffs.rV, 0        , coeffs.rV, 0        , coeffs.rV, 0        , coeffs.rV, 0        );
+	const __m128i gCoeff = _mm_set_epi16(coeffs.gV, coeffs.gU, coeffs.gV, coeffs.gU, coeffs.gV, coeffs.gU, coeffs.gV, coeffs.gU);
+	const __m128i bCoeff = _mm_set_epi16(0        , coeffs.bU, 0        , coeffs.bU, 0        , coeffs.bU, 0        , coeffs.bU);
+
+	const __m128i rounding = _mm_set1_epi32(1 << (kCoefficientBits - 1));
+
+	const __m128i zero    = _mm_setzero_si128();
+	const __m128i yOffset = _mm_set1_epi16(coeffs.yOffset);
+	const __m128i cOffset = _mm_set1_epi16(128);
+	const __m128i opaque  = _mm_set1_epi8((char) 0xFF);
+
+	int x = 0;
+	for (; (x + 16) <= width; x += 16) {
+		// 8 U and V values, as U/V pairs, each doubled for two horizontal pixels
+		const __m128i u = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (rows.u + (x >> 1))), zero), cOffset);
+		const __m128i v = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (rows.v + (x >> 1))), zero), cOffset);
+
+		const __m128i uvLo = _mm_unpacklo_epi16(u, v);
+		const __m128i uvHi = _mm_unpackhi_epi16(u, v);
+
+		const __m128i uv[4] = {
+			_mm_unpacklo_epi32(uvLo, uvLo), _mm_unpackhi_epi32(uvLo, uvLo),
+			_mm_unpacklo_epi32(uvHi, uvHi), _mm_unpackhi_epi32(uvHi, uvHi)
+		};
+
+		// The chrominance terms are shared by both rows
+		__m128i r[4], g[4], b[4];
+		for (int j = 0; j < 4; j++) {
+			r[j] = _mm_add_epi32(_mm_madd_epi16(uv[j], rCoeff), rounding);
+			g[j] = _mm_add_epi32(_mm_madd_epi16(uv[j], gCoeff), rounding);
+			b[j] = _mm_add_epi32(_mm_madd_epi16(uv[j], bCoeff), rounding);
 		}
 
-		// Spread out the values we have to the rest of the array so that we do
-		// not need to check for overflow. We have to do it here in two steps.
-		for (int i = 0; i < 256 + 16; i++) {
-			r_2_pix_alloc[i] = r_2_pix_alloc[256 + 16];
-			g_2_pix_alloc[i] = g_2_pix_alloc[256 + 16];
-			b_2_pix_alloc[i] = b_2_pix_alloc[256 + 16];
+		for (int i = 0; i < 2; i++) {
+			const __m128i y8 = _mm_loadu_si128((const __m128i *) (rows.y[i] + x));
+
+			const __m128i yLo = _mm_sub_epi16(_mm_unpacklo_epi8(y8, zero), yOffset);
+			const __m128i yHi = _mm_sub_epi16(_mm_unpackhi_epi8(y8, zero), yOffset);
+
+			// The high halves are 0, so that _mm_madd_epi16() just scales the luminance
+			const __m128i y[4] = {
+				_mm_madd_epi16(_mm_unpacklo_epi16(yLo, zero), yCoeff), _mm_madd_epi16(_mm_unpackhi_epi16(yLo, zero), yCoeff),
+				_mm_madd_epi16(_mm_unpacklo_epi16(yHi, zero), yCoeff), _mm_madd_epi16(_mm_unpackhi_epi16(yHi, zero), yCoeff)
+			};
+
+			const __m128i r8 = addSSE2(y, r);
+			const __m128i g8 = addSSE2(y, g);
+			const __m128i b8 = addSSE2(y, b);
+			const __m128i a8 = rows.a[i] ? _mm_loadu_si128((const __m128i *) (rows.a[i] + x)) : opaque;
+
+			const __m128i bgLo = _mm_unpacklo_epi8(b8, g8);
+			const __m128i bgHi = _mm_unpackhi_epi8(b8, g8);
+			const __m128i raLo = _mm_unpacklo_epi8(r8, a8);
+			const __m128i raHi = _mm_unpackhi_epi8(r8, a8);
+
+			__m128i *dst = (__m128i *) (rows.dst[i] + x * 4);
+
+			_mm_storeu_si128(dst + 0, _mm_unpacklo_epi16(bgLo, raLo));
+			_mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(bgLo, raLo));
+			_mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(bgHi, raHi));
+			_mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(bgHi, raHi));
 		}
+	}
+
+	return x;
+}
+
+#elif defined(__ARM_NEON)
+
+/** Convert 8 pixels to BGR, with 16-bit luminance and chrominance values. */
+static inline void convertNEON(uint8x8_t &b, uint8x8_t &g, uint8x8_t &r, int16x8_t y, int16x8_t u, int16x8_t v,
+                               const YUVCoefficients &coeffs) {
+
+	const int32x4_t round = vdupq_n_s32(1 << (kCoefficientBits - 1));
+
+	const int32x4_t yLo = vmlal_n_s16(round, vget_low_s16 (y), coeffs.y);
+	const int32x4_t yHi = vmlal_n_s16(round, vget_high_s16(y), coeffs.y);
 
-		for (int i = 256 + 236; i < 768; i++) {
-			r_2_pix_alloc[i] = r_2_pix_alloc[256 + 236 - 1];
-			g_2_pix_alloc[i] = g_2_pix_alloc[256 + 236 - 1];
-			b_2_pix_alloc[i] = b_2_pix_alloc[256 + 236 - 1];
+	int32x4_t rLo = vmlal_n_s16(yLo, vget_low_s16 (v), coeffs.rV);
+	int32x4_t rHi = vmlal_n_s16(yHi, vget_high_s16(v), coeffs.rV);
+
+	int32x4_t gLo = vmlal_n_s16(vmlal_n_s16(yLo, vget_low_s16 (u), coeffs.gU), vget_low_s16 (v), coeffs.gV);
+	int32x4_t gHi = vmlal_n_s16(vmlal_n_s16(yHi, vget_high_s16(u), coeffs.gU), vget_high_s16(v), coeffs.gV);
+
+	int32x4_t bLo = vmlal_n_s16(yLo, vget_low_s16 (u), coeffs.bU);
+	int32x4_t bHi = vmlal_n_s16(yHi, vget_high_s16(u), coeffs.bU);
+
+	r = vqmovun_s16(vcombine_s16(vqshrn_n_s32(rLo, kCoefficientBits), vqshrn_n_s32(rHi, kCoefficientBits)));
+	g = vqmovun_s16(vcombine_s16(vqshrn_n_s32(gLo, kCoefficientBits), vqshrn_n_s32(gHi, kCoefficientBits)));
+	b = vqmovun_s16(vcombine_s16(vqshrn_n_s32(bLo, kCoefficientBits), vqshrn_n_s32(bHi, kCoefficientBits)));
+}
+
+/** Convert 16 pixels at a time, returning the number of pixels converted. */
+static int convertRowsNEON(const YUVRows &rows, const YUVCoefficients &coeffs,
+                           int width) {
+
+	const int16x8_t yOffset = vdupq_n_s16(coeffs.yOffset);
+	const int16x8_t cOffset = vdupq_n_s16(128);
+
+	int x = 0;
+	for (; (x + 16) <= width; x += 16) {
+		// 8 U and V values, each doubled for two horizontal pixels
+		const uint8x8x2_t u8 = vzip_u8(vld1_u8(rows.u + (x >> 1)), vld1_u8(rows.u + (x >> 1)));
+		const uint8x8x2_t v8 = vzip_u8(vld1_u8(rows.v + (x >> 1)), vld1_u8(rows.v + (x >> 1)));
+
+		const int16x8_t u[2] = {
+			vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(u8.val[0])), cOffset),
+			vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(u8.val[1])), cOffset)
+		};
+		const int16x8_t v[2] = {
+			vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(v8.val[0])), cOffset),
+			vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(v8.val[1])), cOffset)
+		};
+
+		for (int i = 0; i < 2; i++) {
+			const uint8x16_t y8 = vld1q_u8(rows.y[i] + x);
+			const uint8x16_t a8 = rows.a[i] ? vld1q_u8(rows.a[i] + x) : vdupq_n_u8(0xFF);
+
+			for (int j = 0; j < 2; j++) {
+				const uint8x8_t yHalf = j ? vget_high_u8(y8) : vget_low_u8(y8);
+				const int16x8_t y = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(yHalf)), yOffset);
+
+				uint8x8x4_t bgra;
+				convertNEON(bgra.val[0], bgra.val[1], bgra.val[2], y, u[j], v[j], coeffs);
+				bgra.val[3] = j ? vget_high_u8(a8) : vget_low_u8(a8);
+
+				vst4_u8(rows.dst[i] + (x + j * 8) * 4, bgra);
+			}
 		}
 	}
+
+	return x;
+}
+
+#endif
+
+static void convertRows(const YUVRows &rows, const YUVCoefficients &coeffs, int width) {
+	int x = 0;
+
+#if defined(__SSE2__)
+	x = convertRowsSSE2(rows, coeffs, width);
+#elif defined(__ARM_NEON)
+	x = convertRowsNEON(rows, coeffs, width);
+#endif
+
+	convertRowsScalar(rows, coeffs, x, width);
 }
 
 YUVToRGBManager::YUVToRGBManager() {
-	int16_t *Cr_r_tab = &_colorTab[0 * 256];
-	int16_t *Cr_g_tab = &_colorTab[1 * 256];
-	int16_t *Cb_g_tab = &_colorTab[2 * 256];
-	int16_t *Cb_b_tab = &_colorTab[3 * 256];
-
-	// Generate the tables for the display surface
-
-	for (int i = 0; i < 256; i++) {
-		// Gamma correction (luminescence table) and chroma correction
-		// would be done here. See the Berkeley mpeg_play sources.
-
-		int16_t CR = (i - 128), CB = CR;
-		Cr_r_tab[i] = (int16_t) ( (0.419 / 0.299) * CR) + 0 * 768 + 256;
-		Cr_g_tab[i] = (int16_t) (-(0.299 / 0.419) * CR) + 1 * 768 + 256;
-		Cb_g_tab[i] = (int16_t) (-(0.114 / 0.331) * CB);
-		Cb_b_tab[i] = (int16_t) ( (0.587 / 0.331) * CB) + 2 * 768 + 256;
-	}
 }
 
 YUVToRGBManager::~YUVToRGBManager() {
 }
 
-const YUVToRGBLookup *YUVToRGBManager::getLookup(LuminanceScale scale) {
-	if (_lookup && _lookup->getScale() == scale)
-		return _lookup.get();
+void YUVToRGBManager::getMatrix(LuminanceScale scale, ColorMatrix matrix, float rgbMatrix[9], float offset[3]) {
+	double factors[5];
+	getFactors(factors, scale, matrix);
 
-	_lookup = std::make_unique<YUVToRGBLookup>(scale);
-	return _lookup.get();
+	// Column-major: the Y, U and V columns
+	rgbMatrix[0] = factors[0]; rgbMatrix[1] = factors[0]; rgbMatrix[2] = factors[0];
+	rgbMatrix[3] = 0.0f      ; rgbMatrix[4] = factors[2]; rgbMatrix[5] = factors[4];
+	rgbMatrix[6] = factors[1]; rgbMatrix[7] = factors[3]; rgbMatrix[8] = 0.0f;
+
+	offset[0] = ((scale == kScaleITU) ? 16.0f : 0.0f) / 255.0f;
+	offset[1] = 128.0f / 255.0f;
+	offset[2] = 128.0f / 255.0f;
 }
 
-#define PUT_PIXEL(s, a, d) \
-	L = &rgbToPix[(s)]; \
-	*((d)) = L[cb_b]; \
-	*((d) + 1) = L[crb_g]; \
-	*((d) + 2) = L[cr_r]; \
-	*((d) + 3) = (a)
-
-void YUVToRGBManager::convert420(LuminanceScale scale, byte *dst, int dstPitch, const byte *ySrc, const byte *uSrc, const byte *vSrc, const byte *aSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
-	const YUVToRGBLookup *lookup = YUVToRGBMan.getLookup(scale);
-	const byte *rgbToPix = lookup->getRGBToPix();
-
-	int halfHeight = yHeight >> 1;
-	int halfWidth = yWidth >> 1;
-
-	dst += dstPitch * (yHeight - 2);
-
-	for (int h = 0; h < halfHeight; h++) {
-		for (int w = 0; w < halfWidth; w++) {
-			const byte *L;
-
-			int16_t cr_r  = _colorTab[*vSrc + 0 * 256];
-			int16_t crb_g = _colorTab[*vSrc + 1 * 256] + _colorTab[*uSrc + 2 * 256];
-			int16_t cb_b  = _colorTab[*uSrc + 3 * 256];
-			uSrc++;
-			vSrc++;
-
-			PUT_PIXEL(*ySrc, *aSrc, dst + dstPitch);
-			PUT_PIXEL(*(ySrc + yPitch), *(aSrc + yPitch), dst);
-			ySrc++;
-			aSrc++;
-			dst += 4;
-			PUT_PIXEL(*ySrc, *aSrc, dst + dstPitch);
-			PUT_PIXEL(*(ySrc + yPitch), *(aSrc + yPitch), dst);
-			ySrc++;
-			aSrc++;
-			dst += 4;
-		}
+void YUVToRGBManager::convert420(LuminanceScale scale, byte *dst, int dstPitch, const byte *ySrc, const byte *uSrc, const byte *vSrc, const byte *aSrc, int yWidth, int yHeight, int yPitch, int uvPitch, ColorMatrix matrix) {
+	YUVCoefficients coeffs;
+	getCoefficients(coeffs, scale, matrix);
 
-		dst -= yWidth * 4 + dstPitch * 2;
-		ySrc += (yPitch << 1) - yWidth;
-		aSrc += (yPitch << 1) - yWidth;
-		uSrc += uvPitch - halfWidth;
-		vSrc += uvPitch - halfWidth;
-	}
-}
+	const int halfHeight = yHeight >> 1;
+	const int width      = yWidth & ~1;
+
+	if ((halfHeight <= 0) || (width <= 0))
+		return;
+
+	// The destination surface is upside down
+	auto convertRowPairs = [&](int start, int end) {
+		for (int h = start; h < end; h++) {
+			YUVRows rows;
 
-void YUVToRGBManager::convert420(LuminanceScale scale, byte *dst, int dstPitch, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
-	const YUVToRGBLookup *lookup = YUVToRGBMan.getLookup(scale);
-	const byte *rgbToPix = lookup->getRGBToPix();
-
-	int halfHeight = yHeight >> 1;
-	int halfWidth = yWidth >> 1;
-
-	dst += dstPitch * (yHeight - 2);
-
-	for (int h = 0; h < halfHeight; h++) {
-		for (int w = 0; w < halfWidth; w++) {
-			const byte *L;
-
-			int16_t cr_r  = _colorTab[*vSrc + 0 * 256];
-			int16_t crb_g = _colorTab[*vSrc + 1 * 256] + _colorTab[*uSrc + 2 * 256];
-			int16_t cb_b  = _colorTab[*uSrc + 3 * 256];
-			uSrc++;
-			vSrc++;
-
-			PUT_PIXEL(*ySrc, 0xFF, dst + dstPitch);
-			PUT_PIXEL(*(ySrc + yPitch), 0xFF, dst);
-			ySrc++;
-			dst += 4;
-			PUT_PIXEL(*ySrc, 0xFF, dst + dstPitch);
-			PUT_PIXEL(*(ySrc + yPitch), 0xFF, dst);
-			ySrc++;
-			dst += 4;
+			rows.dst[0] = dst + dstPitch * (yHeight - 1 - 2 * h);
+			rows.dst[1] = dst + dstPitch * (yHeight - 2 - 2 * h);
+
+			rows.y[0] = ySrc + yPitch * (2 * h);
+			rows.y[1] = ySrc + yPitch * (2 * h + 1);
+
+			rows.a[0] = aSrc ? (aSrc + yPitch * (2 * h))     : 0;
+			rows.a[1] = aSrc ? (aSrc + yPitch * (2 * h + 1)) : 0;
+
+			rows.u = uSrc + uvPitch * h;
+			rows.v = vSrc + uvPitch * h;
+
+			convertRows(rows, coeffs, width);
 		}
+	};
 
-		dst -= yWidth * 4 + dstPitch * 2;
-		ySrc += (yPitch << 1) - yWidth;
-		uSrc += uvPitch - halfWidth;
-		vSrc += uvPitch - halfWidth;
-	}
+	const size_t pixelCount = (size_t) width * yHeight;
+	const size_t sliceCount = MIN<size_t>(MIN<size_t>(ThreadPoolMan.getThreadCount(),
+	                                                  MAX<size_t>(pixelCount / kMinPixelsPerThread, 1)), halfHeight);
+
+	// Give each thread a horizontal slice of the frame
+	ThreadPoolMan.parallelFor(sliceCount, [&](size_t i) {
+		convertRowPairs((halfHeight *  i     ) / sliceCount,
+		                (halfHeight * (i + 1)) / sliceCount);
+	});
+}
+
+void YUVToRGBManager::convert420(LuminanceScale scale, byte *dst, int dstPitch, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch, ColorMatrix matrix) {
+	convert420(scale, dst, dstPitch, ySrc, uSrc, vSrc, 0, yWidth, yHeight, yPitch, uvPitch, matrix);
 }
 
 } // End of namespace Graphics
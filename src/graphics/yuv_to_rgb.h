@@ -25,16 +25,17 @@
 #ifndef GRAPHICS_YUV_TO_RGB_H
 #define GRAPHICS_YUV_TO_RGB_H
 
-#include <memory>
-
 #include "src/common/singleton.h"
 
 #include "src/graphics/types.h"
 
 namespace Graphics {
 
-class YUVToRGBLookup;
-
+/** Converts YUV images to RGB.
+ *
+ *  The conversion uses fixed-point arithmetic, vectorized with SSE2 or NEON
+ *  where available, and large frames are split across the thread pool.
+ */
 class YUVToRGBManager : public Common::Singleton<YUVToRGBManager> {
 public:
 	/** The scale of the luminance values */
@@ -43,6 +44,12 @@ public:
 		kScaleITU   /** Luminance values range from [16, 235], the range from ITU-R BT.601 */
 	};
 
+	/** The matrix converting between YUV and RGB. */
+	enum ColorMatrix {
+		kMatrixBT601, /** ITU-R BT.601, for standard definition video */
+		kMatrixBT709  /** ITU-R BT.709, for high definition video */
+	};
+
 	/**
 	 * Convert a YUV420 image to an RGBA surface
 	 *
@@ -56,8 +63,9 @@ public:
 	 * @param yHeight  the height of the y surface (must be divisible by 2)
 	 * @param yPitch   the pitch of the y surface
 	 * @param uvPitch  the pitch of the u and v surfaces
+	 * @param matrix   the color matrix of the source
 	 */
-	void convert420(LuminanceScale scale, byte *dst, int dstPitch, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch);
+	void convert420(LuminanceScale scale, byte *dst, int dstPitch, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch, ColorMatrix matrix = kMatrixBT601);
 
 	/**
 	 * Convert a YUV420 image to an RGBA surface
@@ -73,18 +81,26 @@ public:
 	 * @param yHeight  the height of the y surface (must be divisible by 2)
 	 * @param yPitch   the pitch of the y and a surfaces
 	 * @param uvPitch  the pitch of the u and v surfaces
+	 * @param matrix   the color matrix of the source
 	 */
-	void convert420(LuminanceScale scale, byte *dst, int dstPitch, const byte *ySrc, const byte *uSrc, const byte *vSrc, const byte *aSrc, int yWidth, int yHeight, int yPitch, int uvPitch);
+	void convert420(LuminanceScale scale, byte *dst, int dstPitch, const byte *ySrc, const byte *uSrc, const byte *vSrc, const byte *aSrc, int yWidth, int yHeight, int yPitch, int uvPitch, ColorMatrix matrix = kMatrixBT601);
+
+	/**
+	 * Get the conversion as a matrix, for doing it in a shader
+	 *
+	 * RGB = rgbMatrix * (YUV - offset), with all components in [0, 1].
+	 *
+	 * @param scale     the scale of the luminance values
+	 * @param matrix    the color matrix of the source
+	 * @param rgbMatrix the 3x3 conversion matrix, in column-major order
+	 * @param offset    the offset to subtract from the YUV values first
+	 */
+	static void getMatrix(LuminanceScale scale, ColorMatrix matrix, float rgbMatrix[9], float offset[3]);
 
 private:
 	friend class Common::Singleton<SingletonBaseType>;
 	YUVToRGBManager();
 	~YUVToRGBManager();
-
-	const YUVToRGBLookup *getLookup(LuminanceScale scale);
-
-	std::unique_ptr<YUVToRGBLookup> _lookup;
-	int16_t _colorTab[4 * 256]; // 2048 bytes
 };
 
 } // End of namespace Graphics
@@ -0,0 +1,230 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Decoding audio streams ahead of playback, on worker threads.
+ */
+
+#include <cassert>
+#include <cstring>
+
+#include <algorithm>
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/thread.h"
+
+#include "src/sound/decodeahead.h"
+
+/** The most samples decoded in one go. */
+static const size_t kDecodeChunkSize = 4096;
+
+namespace Sound {
+
+DecodeAheadPool::DecodeAheadPool(size_t threadCount) : _quit(false) {
+	for (size_t i = 0; i < MAX<size_t>(threadCount, 1); i++)
+		_threads.emplace_back(&DecodeAheadPool::work, this);
+}
+
+DecodeAheadPool::~DecodeAheadPool() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		assert(_queue.empty());
+
+		_quit = true;
+	}
+
+	_wake.notify_all();
+
+	for (std::vector<std::thread>::iterator t = _threads.begin(); t != _threads.end(); ++t)
+		t->join();
+}
+
+void DecodeAheadPool::schedule(DecodeAheadStream &stream) {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		if (stream._scheduled.load(std::memory_order_relaxed) || stream._cancelled)
+			return;
+
+		stream._scheduled.store(true, std::memory_order_relaxed);
+		_queue.push_back(&stream);
+	}
+
+	_wake.notify_one();
+}
+
+void DecodeAheadPool::cancel(DecodeAheadStream &stream) {
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	stream._cancelled = true;
+
+	_idle.wait(lock, [&stream]() { return !stream._decoding; });
+
+	std::deque<DecodeAheadStream *>::iterator queued = std::find(_queue.begin(), _queue.end(), &stream);
+	if (queued != _queue.end())
+		_queue.erase(queued);
+}
+
+void DecodeAheadPool::work() {
+	Common::Thread::setCurrentThreadName("SoundDecoder");
+
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	while (true) {
+		_wake.wait(lock, [this]() { return _quit || !_queue.empty(); });
+		if (_quit)
+			return;
+
+		DecodeAheadStream &stream = *_queue.front();
+		_queue.pop_front();
+
+		stream._decoding = true;
+
+		lock.unlock();
+		const bool more = stream.decode();
+		lock.lock();
+
+		stream._decoding = false;
+
+		// Go to the back of the queue, so that every stream gets its turn
+		if (more && !stream._cancelled)
+			_queue.push_back(&stream);
+		else
+			stream._scheduled.store(false, std::memory_order_relaxed);
+
+		_idle.notify_all();
+	}
+}
+
+
+DecodeAheadStream::DecodeAheadStream(AudioStream *stream, bool disposeAfterUse,
+                                     DecodeAheadPool &pool, size_t bufferSize) :
+	_stream(stream, disposeAfterUse), _pool(&pool), _channels(0), _rate(0),
+	_bufferSize(bufferSize), _readPos(0), _writePos(0), _finished(false), _error(false),
+	_scheduled(false), _decoding(false), _cancelled(false) {
+
+	assert(_stream);
+	assert((_bufferSize > 0) && ((_bufferSize & (_bufferSize - 1)) == 0));
+
+	_channels = _stream->getChannels();
+	_rate     = _stream->getRate();
+
+	_buffer = std::make_unique<int16_t[]>(_bufferSize);
+
+	_finished.store(_stream->endOfData(), std::memory_order_relaxed);
+	if (!_finished.load(std::memory_order_relaxed))
+		_pool->schedule(*this);
+}
+
+DecodeAheadStream::~DecodeAheadStream() {
+	_pool->cancel(*this);
+}
+
+int DecodeAheadStream::getChannels() const {
+	return _channels;
+}
+
+int DecodeAheadStream::getRate() const {
+	return _rate;
+}
+
+bool DecodeAheadStream::endOfData() const {
+	// Check for the end first, so that the last decoded samples are visible
+	if (!_finished.load(std::memory_order_acquire))
+		return false;
+
+	return _readPos.load(std::memory_order_relaxed) == _writePos.load(std::memory_order_acquire);
+}
+
+size_t DecodeAheadStream::readBuffer(int16_t *buffer, const size_t numSamples) {
+	const bool finished = _finished.load(std::memory_order_acquire);
+
+	const size_t readPos  = _readPos.load(std::memory_order_relaxed);
+	const size_t writePos = _writePos.load(std::memory_order_acquire);
+
+	const size_t available = writePos - readPos;
+	if ((available == 0) && finished && _error.load(std::memory_order_relaxed))
+		return kSizeInvalid;
+
+	const size_t count = MIN(numSamples, available);
+
+	const size_t start = readPos & (_bufferSize - 1);
+	const size_t first = MIN(count, _bufferSize - start);
+
+	std::memcpy(buffer        , _buffer.get() + start, first           * sizeof(int16_t));
+	std::memcpy(buffer + first, _buffer.get()        , (count - first) * sizeof(int16_t));
+
+	_readPos.store(readPos + count, std::memory_order_release);
+
+	// Wake up a decoder once half of the buffer is free again
+	if (!finished && !_scheduled.load(std::memory_order_relaxed) && ((available - count) <= (_bufferSize / 2)))
+		_pool->schedule(*this);
+
+	return count;
+}
+
+bool DecodeAheadStream::decode() {
+	if (_finished.load(std::memory_order_relaxed))
+		return false;
+
+	size_t writePos = _writePos.load(std::memory_order_relaxed);
+
+	// Decode at most half the buffer in one go, to give other streams a turn
+	size_t toDecode = _bufferSize / 2;
+
+	try {
+		while (toDecode > 0) {
+			const size_t space = _bufferSize - (writePos - _readPos.load(std::memory_order_acquire));
+			if (space == 0)
+				break;
+
+			const size_t start = writePos & (_bufferSize - 1);
+			const size_t count = MIN(MIN(space, toDecode), MIN(_bufferSize - start, kDecodeChunkSize));
+
+			const size_t decoded = _stream->readBuffer(_buffer.get() + start, count);
+			if (decoded == kSizeInvalid)
+				throw Common::Exception("Failed reading from stream");
+
+			writePos += decoded;
+			toDecode -= decoded;
+
+			_writePos.store(writePos, std::memory_order_release);
+
+			// A stream that gives us nothing without having ended would only make us spin
+			if ((decoded == 0) || _stream->endOfData()) {
+				_finished.store(true, std::memory_order_release);
+				return false;
+			}
+		}
+
+	} catch (...) {
+		Common::exceptionDispatcherWarning("Failed decoding audio stream ahead");
+
+		_error.store(true, std::memory_order_relaxed);
+		_finished.store(true, std::memory_order_release);
+		return false;
+	}
+
+	return (_bufferSize - (writePos - _readPos.load(std::memory_order_acquire))) > 0;
+}
+
+} // End of namespace Sound
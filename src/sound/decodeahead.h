@@ -0,0 +1,139 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Decoding audio streams ahead of playback, on worker threads.
+ */
+
+#ifndef SOUND_DECODEAHEAD_H
+#define SOUND_DECODEAHEAD_H
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#if defined(__MINGW32__ ) && !defined(_GLIBCXX_HAS_GTHREADS)
+	#include "external/mingw-std-threads/mingw.thread.h"
+#else
+	#include <thread>
+#endif
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/mutex.h"
+
+#include "src/sound/audiostream.h"
+
+namespace Sound {
+
+class DecodeAheadStream;
+
+/** A few worker threads decoding audio streams ahead of their playback. */
+class DecodeAheadPool : boost::noncopyable {
+public:
+	DecodeAheadPool(size_t threadCount);
+	~DecodeAheadPool();
+
+private:
+	std::vector<std::thread> _threads;
+
+	std::mutex _mutex;
+	std::condition_variable _wake; ///< Signalled when a stream needs decoding or the pool shuts down.
+	std::condition_variable _idle; ///< Signalled when a worker finished decoding a part of a stream.
+
+	std::deque<DecodeAheadStream *> _queue; ///< Streams waiting to be decoded further.
+
+	bool _quit;
+
+	/** Queue the stream to be decoded further, if it isn't already. */
+	void schedule(DecodeAheadStream &stream);
+	/** Remove the stream from the pool, waiting for a worker still decoding it. */
+	void cancel(DecodeAheadStream &stream);
+
+	void work();
+
+	friend class DecodeAheadStream;
+};
+
+/** An audio stream that is decoded ahead of time by a DecodeAheadPool.
+ *
+ *  The decoded samples are passed through a lock-free single-producer,
+ *  single-consumer ring buffer: the pool's workers write into it, and
+ *  readBuffer() only copies samples out of it. A slow decoder can't
+ *  hold up the reader, it only runs out of samples.
+ *
+ *  The wrapped stream must not be read from anybody else, and it has
+ *  to signal its end with endOfData(), not only with endOfStream().
+ */
+class DecodeAheadStream : public AudioStream {
+public:
+	/**
+	 * Decode a stream ahead of time.
+	 *
+	 * @param stream          The stream to decode.
+	 * @param disposeAfterUse Should the stream be deleted together with this one?
+	 * @param pool            The pool that does the decoding.
+	 * @param bufferSize      The number of samples to decode ahead. Must be a power of 2.
+	 */
+	DecodeAheadStream(AudioStream *stream, bool disposeAfterUse, DecodeAheadPool &pool, size_t bufferSize);
+	~DecodeAheadStream();
+
+	size_t readBuffer(int16_t *buffer, const size_t numSamples);
+
+	int getChannels() const;
+	int getRate() const;
+
+	bool endOfData() const;
+
+private:
+	Common::DisposablePtr<AudioStream> _stream;
+
+	DecodeAheadPool *_pool;
+
+	int _channels;
+	int _rate;
+
+	std::unique_ptr<int16_t[]> _buffer;
+	size_t _bufferSize;
+
+	std::atomic<size_t> _readPos;  ///< Total number of samples read. Only written by the reader.
+	std::atomic<size_t> _writePos; ///< Total number of samples decoded. Only written by the decoder.
+
+	std::atomic<bool> _finished; ///< Has the decoder reached the end of the wrapped stream?
+	std::atomic<bool> _error;    ///< Has the decoder failed?
+
+	std::atomic<bool> _scheduled; ///< Is the stream queued or being decoded? Written under the pool's mutex.
+	bool _decoding;  ///< Is a worker decoding this stream right now? Guarded by the pool's mutex.
+	bool _cancelled; ///< Was the stream removed from the pool? Guarded by the pool's mutex.
+
+	/** Decode a part of the wrapped stream into the buffer.
+	 *
+	 *  @return true if there's still room in the buffer to decode more.
+	 */
+	bool decode();
+
+	friend class DecodeAheadPool;
+};
+
+} // End of namespace Sound
+
+#endif // SOUND_DECODEAHEAD_H
@@ -31,6 +31,7 @@
 
 #include "src/common/ustring.h"
 #include "src/common/readstream.h"
+#include "src/common/sharedreadstream.h"
 
 namespace Sound {
 
@@ -96,13 +97,16 @@ private:
 	};
 
 
-	std::unique_ptr<Common::SeekableReadStream> _fsb;
+	/** The bank, shared with the streams of the samples within. */
+	std::shared_ptr<Common::SharedReadStream> _fsb;
 
 	std::vector<Sample> _samples;
 
 	std::map<Common::UString, const Sample *> _sampleMap;
 
 
+	/** Read the bank's index, then keep the stream around to share it. */
+	void open(Common::SeekableReadStream *fsb);
 	void load(Common::SeekableReadStream &fsb);
 
 	RewindableAudioStream *getSample(const Sample &sample) const;
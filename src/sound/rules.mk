@@ -36,6 +36,8 @@ src_sound_libsound_la_SOURCES += \
     src/sound/fmodsamplebank.h \
     src/sound/wwisesoundbank.h \
     src/sound/fmodeventfile.h \
+    src/sound/samplecache.h \
+    src/sound/decodeahead.h \
     $(EMPTY)
 
 src_sound_libsound_la_SOURCES += \
@@ -51,6 +53,8 @@ src_sound_libsound_la_SOURCES += \
     src/sound/fmodsamplebank.cpp \
     src/sound/wwisesoundbank.cpp \
     src/sound/fmodeventfile.cpp \
+    src/sound/samplecache.cpp \
+    src/sound/decodeahead.cpp \
     $(EMPTY)
 
 src_sound_libsound_la_LIBADD = \
@@ -0,0 +1,218 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A cache of short sounds, fully decoded.
+ */
+
+#include <cstring>
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+
+#include "src/sound/samplecache.h"
+#include "src/sound/audiostream.h"
+
+namespace Sound {
+
+/** A stream over shared cached samples. */
+class SampleCache::SampleStream : public RewindableAudioStream {
+public:
+	SampleStream(const std::shared_ptr<const Samples> &samples) : _samples(samples), _pos(0) {
+	}
+
+	size_t readBuffer(int16_t *buffer, const size_t numSamples) {
+		const size_t count = MIN(numSamples, _samples->data.size() - _pos);
+
+		std::memcpy(buffer, _samples->data.data() + _pos, count * sizeof(int16_t));
+		_pos += count;
+
+		return count;
+	}
+
+	int getChannels() const {
+		return _samples->channels;
+	}
+
+	int getRate() const {
+		return _samples->rate;
+	}
+
+	bool endOfData() const {
+		return _pos >= _samples->data.size();
+	}
+
+	bool rewind() {
+		_pos = 0;
+		return true;
+	}
+
+	uint64_t getLength() const {
+		return _samples->data.size() / _samples->channels;
+	}
+
+private:
+	std::shared_ptr<const Samples> _samples;
+
+	size_t _pos;
+};
+
+
+SampleCache::SampleCache(size_t maxSize, size_t maxSampleSize) :
+	_maxSize(maxSize), _maxSampleSize(MIN(maxSize, maxSampleSize)), _size(0) {
+
+}
+
+SampleCache::~SampleCache() {
+}
+
+RewindableAudioStream *SampleCache::find(const Common::UString &name, uint32_t generation) {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	Entry *entry = _entries.find(name);
+	if (!entry)
+		return 0;
+
+	if (entry->generation != generation) {
+		// The resource might have changed since
+		remove(name);
+		return 0;
+	}
+
+	// Move to the front of the LRU list
+	_lru.splice(_lru.begin(), _lru, entry->lru);
+
+	return new SampleStream(entry->samples);
+}
+
+AudioStream *SampleCache::add(const Common::UString &name, uint32_t generation, AudioStream *stream) {
+	std::unique_ptr<AudioStream> original(stream);
+
+	RewindableAudioStream *rewindable = dynamic_cast<RewindableAudioStream *>(stream);
+	if (!rewindable || (rewindable->getChannels() <= 0))
+		return original.release();
+
+	// Only decode sounds known to be short enough
+	const uint64_t length = rewindable->getLength();
+	if ((length == RewindableAudioStream::kInvalidLength) ||
+	    ((length * rewindable->getChannels() * sizeof(int16_t)) > _maxSampleSize))
+		return original.release();
+
+	std::shared_ptr<const Samples> samples = decode(*rewindable);
+	if (!samples) {
+		// Let the normal playback deal with it
+		if (!rewindable->rewind())
+			throw Common::Exception("Failed to rewind sound \"%s\"", name.c_str());
+
+		return original.release();
+	}
+
+	const size_t size = samples->data.size() * sizeof(int16_t);
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	remove(name);
+	makeRoom(size);
+
+	_lru.push_front(name);
+
+	Entry &entry = _entries[name];
+
+	entry.generation = generation;
+	entry.samples    = samples;
+	entry.lru        = _lru.begin();
+
+	_size += size;
+
+	return new SampleStream(samples);
+}
+
+void SampleCache::clear() {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_entries.clear();
+	_lru.clear();
+
+	_size = 0;
+}
+
+void SampleCache::getMemoryUsage(Common::MemoryUsageList &usage) {
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (EntryMap::const_iterator e = _entries.begin(); e != _entries.end(); ++e)
+		usage.add(e->key, e->value.samples->data.size() * sizeof(int16_t));
+}
+
+std::shared_ptr<const SampleCache::Samples> SampleCache::decode(RewindableAudioStream &stream) const {
+	std::shared_ptr<Samples> samples = std::make_shared<Samples>();
+
+	samples->channels = stream.getChannels();
+	samples->rate     = stream.getRate();
+
+	const size_t maxSamples = _maxSampleSize / sizeof(int16_t);
+
+	// The length is only an estimate, so read until the stream really ends
+	samples->data.resize(MIN<size_t>(stream.getLength() * samples->channels + 1, maxSamples + 1));
+
+	size_t count = 0;
+	while (!stream.endOfData()) {
+		if (count == samples->data.size()) {
+			if (count > maxSamples)
+				return std::shared_ptr<const Samples>();
+
+			samples->data.resize(MIN(count * 2, maxSamples + 1));
+		}
+
+		const size_t read = stream.readBuffer(samples->data.data() + count, samples->data.size() - count);
+		if ((read == AudioStream::kSizeInvalid) || (read == 0))
+			break;
+
+		count += read;
+	}
+
+	if ((count == 0) || (count > maxSamples) || !stream.endOfData())
+		return std::shared_ptr<const Samples>();
+
+	samples->data.resize(count);
+	samples->data.shrink_to_fit();
+
+	return samples;
+}
+
+void SampleCache::makeRoom(size_t size) {
+	while (!_lru.empty() && ((_size + size) > _maxSize))
+		remove(_lru.back());
+}
+
+void SampleCache::remove(const Common::UString &name) {
+	Entry *entry = _entries.find(name);
+	if (!entry)
+		return;
+
+	_size -= entry->samples->data.size() * sizeof(int16_t);
+
+	// The name might be the one in the LRU list, so drop the map entry first
+	const std::list<Common::UString>::iterator lru = entry->lru;
+
+	_entries.erase(name);
+	_lru.erase(lru);
+}
+
+} // End of namespace Sound
@@ -0,0 +1,135 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A cache of short sounds, fully decoded.
+ */
+
+#ifndef SOUND_SAMPLECACHE_H
+#define SOUND_SAMPLECACHE_H
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+#include "src/common/ustring.h"
+#include "src/common/flathashmap.h"
+#include "src/common/memoryusage.h"
+
+namespace Sound {
+
+class AudioStream;
+class RewindableAudioStream;
+
+/** A size-bounded cache of short sounds, fully decoded into PCM samples.
+ *
+ *  Sounds that are played over and over again, like footsteps or clicks,
+ *  are only decoded once. Every play then gets its own stream over the
+ *  same, shared samples. When the cache is full, the sounds not played
+ *  for the longest time are dropped.
+ */
+class SampleCache : boost::noncopyable {
+public:
+	/**
+	 * Create a sample cache.
+	 *
+	 * @param maxSize       The maximum number of bytes of samples to keep in total.
+	 * @param maxSampleSize The maximum number of bytes of samples of a single sound.
+	 */
+	SampleCache(size_t maxSize, size_t maxSampleSize);
+	~SampleCache();
+
+	/**
+	 * Return a new stream over the cached samples of this sound.
+	 *
+	 * @param  name       The name of the sound.
+	 * @param  generation The current generation of the resources.
+	 * @return A new stream, or 0 if the sound is not cached or outdated.
+	 */
+	RewindableAudioStream *find(const Common::UString &name, uint32_t generation);
+
+	/**
+	 * Decode a sound fully and cache it, if it's short enough.
+	 *
+	 * The stream is always taken over.
+	 *
+	 * @param  name       The name of the sound.
+	 * @param  generation The current generation of the resources.
+	 * @param  stream     The stream of the sound, not yet read from.
+	 * @return A stream over the cached samples, or the original stream
+	 *         if the sound can't be cached.
+	 */
+	AudioStream *add(const Common::UString &name, uint32_t generation, AudioStream *stream);
+
+	/** Drop all cached sounds. */
+	void clear();
+
+	/** Collect how much memory the samples of each cached sound take up. */
+	void getMemoryUsage(Common::MemoryUsageList &usage);
+
+private:
+	/** The decoded samples of a sound. */
+	struct Samples {
+		std::vector<int16_t> data; ///< The interleaved samples.
+
+		int channels; ///< The number of channels.
+		int rate;     ///< The sample rate.
+	};
+
+	class SampleStream;
+
+	struct Entry {
+		uint32_t generation;
+		std::shared_ptr<const Samples> samples;
+
+		std::list<Common::UString>::iterator lru; ///< Position in the LRU list.
+	};
+
+	typedef Common::FlatHashMap<Common::UString, Entry,
+	                            Common::hashUStringCaseInsensitive, Common::equalsUStringInsensitive> EntryMap;
+
+	size_t _maxSize;
+	size_t _maxSampleSize;
+
+	size_t _size; ///< The number of bytes of samples currently cached.
+
+	EntryMap _entries;
+
+	/** The names of all cached sounds, the most recently played first. */
+	std::list<Common::UString> _lru;
+
+	std::mutex _mutex;
+
+	/** Decode a whole stream, returning 0 if it's too long or fails to decode. */
+	std::shared_ptr<const Samples> decode(RewindableAudioStream &stream) const;
+
+	/** Drop the least recently played sounds until this many more bytes fit. */
+	void makeRoom(size_t size);
+	/** Drop a cached sound. */
+	void remove(const Common::UString &name);
+};
+
+} // End of namespace Sound
+
+#endif // SOUND_SAMPLECACHE_H
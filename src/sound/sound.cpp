@@ -35,7 +35,10 @@
 #endif
 
 #include <cassert>
-#include <cstring>
+#include <cfloat>
+#include <cmath>
+
+#include <algorithm>
 
 #include <boost/scope_exit.hpp>
 
@@ -45,9 +48,13 @@
 #include "src/common/error.h"
 #include "src/common/configman.h"
 #include "src/common/debug.h"
+#include "src/common/profiler.h"
+
+#include "src/aurora/resman.h"
 
 #include "src/sound/sound.h"
 #include "src/sound/audiostream.h"
+#include "src/sound/decodeahead.h"
 #include "src/sound/decoders/asf.h"
 #ifdef ENABLE_MAD
 #include "src/sound/decoders/mp3.h"
@@ -74,17 +81,51 @@ static const size_t kOpenALBufferCount = 5;
  */
 static const size_t kOpenALBufferSize = 32768;
 
+/** Number of bytes of decoded samples of short sounds to keep around. */
+static const size_t kSampleCacheSize = 16 * 1024 * 1024;
+
+/** Maximum number of bytes of decoded samples of a single sound to cache.
+ *
+ *  @note That's about 3 seconds of 16-bit stereo at 44.1kHz.
+ */
+static const size_t kMaxCachedSampleSize = 512 * 1024;
+
+/** Number of worker threads decoding streams ahead of their playback. */
+static const size_t kDecodeThreadCount = 2;
+
+/** Number of samples to decode a stream ahead, the worth of 4 OpenAL buffers. */
+static const size_t kDecodeAheadSize = kOpenALBufferSize * 2;
+
+/** Maximum number of channels that hold an OpenAL source at the same time.
+ *
+ *  When more channels are audible, the ones farthest away are played virtually.
+ */
+static const size_t kMaxRealChannels = 64;
+
+/** How far beyond its max distance a channel has to move before it's made virtual.
+ *
+ *  Keeps a channel right at the edge of its range from constantly switching.
+ */
+static const float kVirtualDistanceFactor = 1.1f;
+
 namespace Sound {
 
 SoundManager::Channel::Channel(uint32_t i, size_t idx, SoundType t,
                                const TypeList::iterator &ti, AudioStream *s, bool d) :
-	id(i), index(idx), state(AL_PAUSED), stream(s, d), source(0),
-	type(t), typeIt(ti), finishedBuffers(0), gain(1.0f) {
-
+	id(i), index(idx), activeIndex(0), state(AL_PAUSED), stream(s, d), source(0),
+	type(t), typeIt(ti), finishedBuffers(0), gain(1.0f), relative(true), pitch(1.0f),
+	minDistance(1.0f), maxDistance(FLT_MAX), length(RewindableAudioStream::kInvalidLength),
+	loopLength(RewindableAudioStream::kInvalidLength), canVirtualize(false), isVirtual(false),
+	virtualSamples(0.0), virtualAhead(0), isFading(false), fadeStop(false), fadeFromGain(1.0f),
+	fadeToGain(1.0f), fadeDuration(0.0) {
+
+	position[0] = position[1] = position[2] = 0.0f;
 }
 
 
-SoundManager::SoundManager() : _ready(false), _hasSound(false), _hasMultiChannel(false), _format51(0) {
+SoundManager::SoundManager() : _ready(false), _hasSound(false), _hasMultiChannel(false), _format51(0),
+	_unusedChannel(0), _sampleBuffer(std::make_unique<int16_t[]>(kOpenALBufferSize / 2)),
+	_sampleCache(kSampleCacheSize, kMaxCachedSampleSize), _fadingChannels(0) {
 }
 
 SoundManager::~SoundManager() {
@@ -96,6 +137,14 @@ void SoundManager::init() {
 
 	_curID = 1;
 
+	_activeChannels.clear();
+	_freeChannels.clear();
+	_unusedChannel = 0;
+
+	_listenerPosition[0] = _listenerPosition[1] = _listenerPosition[2] = 0.0f;
+
+	_lastUpdate = std::chrono::steady_clock::now();
+
 	_ctx = 0;
 
 	_hasSound = false;
@@ -121,6 +170,8 @@ void SoundManager::init() {
 		_hasMultiChannel = alIsExtensionPresent("AL_EXT_MCFORMATS") != 0;
 		_format51        = alGetEnumValue("AL_FORMAT_51CHN16");
 
+		_decodePool = std::make_unique<DecodeAheadPool>(kDecodeThreadCount);
+
 		if (!createThread("SoundManager"))
 			throw Common::Exception("Failed to create sound thread: %s", SDL_GetError());
 
@@ -151,8 +202,10 @@ void SoundManager::deinit() {
 
 	destroyThread();
 
-	for (size_t i = 0; i < kChannelCount; i++)
-		freeChannel(i);
+	while (!_activeChannels.empty())
+		freeChannel(_activeChannels.back());
+
+	_decodePool.reset();
 
 	if (_hasSound) {
 		alcMakeContextCurrent(0);
@@ -195,6 +248,28 @@ bool SoundManager::isPlaying(const ChannelHandle &handle) {
 	return isPlaying(handle.channel);
 }
 
+size_t SoundManager::getActiveChannelCount() {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	return _activeChannels.size();
+}
+
+void SoundManager::getMemoryUsage(Common::MemoryUsageList &usage) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	for (std::vector<size_t>::const_iterator c = _activeChannels.begin(); c != _activeChannels.end(); ++c) {
+		const Channel &channel = *_channels[*c];
+
+		size_t size = 0;
+		for (std::map<ALuint, ALsizei>::const_iterator b = channel.bufferSize.begin(); b != channel.bufferSize.end(); ++b)
+			size += b->second;
+
+		usage.add(Common::UString::format("<channel %u>", (uint)*c), size);
+	}
+
+	_sampleCache.getMemoryUsage(usage);
+}
+
 bool SoundManager::isPlaying(size_t channel) const {
 	if ((channel >= kChannelCount) || !_channels[channel])
 		return false;
@@ -206,6 +281,17 @@ bool SoundManager::isPlaying(size_t channel) const {
 	if (!_hasSound)
 		return true;
 
+	const Channel &c = *_channels[channel];
+	if (c.isVirtual) {
+		// Without a source, we only know the sound has ended if we know how long it is
+		if (c.length == RewindableAudioStream::kInvalidLength)
+			return true;
+
+		const uint64_t samplesPlayed = c.finishedBuffers / (c.stream->getChannels() * 2) + (uint64_t) c.virtualSamples;
+
+		return samplesPlayed < c.length;
+	}
+
 	ALenum error = AL_NO_ERROR;
 
 	ALint val;
@@ -349,7 +435,7 @@ ChannelHandle SoundManager::playAudioStream(AudioStream *audStream, SoundType ty
 
 	std::lock_guard<std::recursive_mutex> lock(_mutex);
 
-	ChannelHandle handle = newChannel();
+	ChannelHandle handle = newChannel(type, audStream, disposeAfterUse);
 
 	bool success = false;
 	BOOST_SCOPE_EXIT ( (&success) (&handle) (this_) ) {
@@ -357,48 +443,45 @@ ChannelHandle SoundManager::playAudioStream(AudioStream *audStream, SoundType ty
 			this_->freeChannel(handle);
 	} BOOST_SCOPE_EXIT_END
 
-	const TypeList::iterator typeEndIt = _types[type].list.end();
-
-	_channels[handle.channel] = std::make_unique<Channel>(handle.id, handle.channel, type, typeEndIt, audStream, disposeAfterUse);
 	Channel &channel = *_channels[handle.channel];
 
 	if (!channel.stream)
 		throw Common::Exception("Could not detect stream type");
 
-	ALenum error = AL_NO_ERROR;
+	// Find out how long the sound is, so we know when it ends even without an OpenAL source
+	LoopingAudioStream    *looping    = dynamic_cast<LoopingAudioStream *>(channel.stream.get());
+	RewindableAudioStream *rewindable = dynamic_cast<RewindableAudioStream *>(channel.stream.get());
 
-	if (_hasSound) {
-		// Create the source
-		alGenSources(1, &channel.source);
-		if ((error = alGetError()) != AL_NO_ERROR)
-			throw Common::Exception("OpenAL error while generating sources: 0x%X", error);
-
-		// Create all needed buffers
-		for (size_t i = 0; i < kOpenALBufferCount; i++) {
-			ALuint buffer;
-
-			alGenBuffers(1, &buffer);
-			if ((error = alGetError()) != AL_NO_ERROR)
-				throw Common::Exception("OpenAL error while generating buffers: 0x%X", error);
-
-			if (fillBuffer(channel, buffer, channel.stream.get(), channel.bufferSize[buffer])) {
-				// If we could fill the buffer with data, queue it
+	if (looping) {
+		if (looping->getLength() == RewindableAudioStream::kInvalidLength)
+			channel.loopLength = looping->getLengthOnce();
+		else
+			channel.length = looping->getLength();
 
-				alSourceQueueBuffers(channel.source, 1, &buffer);
-				if ((error = alGetError()) != AL_NO_ERROR)
-					throw Common::Exception("OpenAL error while queueing buffers: 0x%X", error);
+	} else if (rewindable)
+		channel.length = rewindable->getLength();
 
-			} else
-				// If not, put it into our free list
-				channel.freeBuffers.push_back(buffer);
+	/* Only streams we own can be fast-forwarded once a virtual channel becomes
+	 * audible again. And we need to know when the sound would have ended. */
+	channel.canVirtualize = disposeAfterUse &&
+		((channel.length != RewindableAudioStream::kInvalidLength) ||
+		 ((channel.loopLength != RewindableAudioStream::kInvalidLength) && (channel.loopLength > 0)));
 
-			channel.buffers.push_back(buffer);
+	if (_hasSound) {
+		createSource(channel);
+
+		/* If the sound is longer than what we could buffer now, decode the rest
+		 * ahead of time on the worker threads. Streams we don't own might still
+		 * be fed or read by somebody else, so those are left alone. Prefetched
+		 * streams are already decoded ahead. */
+		if (disposeAfterUse && !channel.stream->endOfData() &&
+		    !dynamic_cast<DecodeAheadStream *>(channel.stream.get())) {
+			AudioStream *stream = channel.stream.get();
+
+			channel.stream.setDisposable(false);
+			channel.stream.reset(new DecodeAheadStream(stream, true, *_decodePool, kDecodeAheadSize));
+			channel.stream.setDisposable(true);
 		}
-
-		// Set the gain to the current sound type gain
-		alSourcef(channel.source, AL_GAIN, _types[channel.type].gain);
-		// Set the sound per default as relative.
-		alSourcei(channel.source, AL_SOURCE_RELATIVE, AL_TRUE);
 	}
 
 	// Add the channel to the correct type list
@@ -422,10 +505,68 @@ ChannelHandle SoundManager::playSoundFile(Common::SeekableReadStream *wavStream,
 	if (!audioStream)
 		throw Common::Exception("No audio stream");
 
+	return playSound(audioStream, type, loop);
+}
+
+ChannelHandle SoundManager::playSoundResource(const Common::UString &name, Aurora::ResourceType resType,
+                                              SoundType type, bool loop) {
+	checkReady();
+
+	// Sounds are cached under their name and resource type. Music is never short enough
+	const bool cache = type != kSoundTypeMusic;
+
+	const Common::UString cacheName = name + "#" + Common::composeString((int) resType);
+	const uint32_t generation = ResMan.getGeneration();
+
+	AudioStream *audioStream = cache ? _sampleCache.find(cacheName, generation) : 0;
+	if (!audioStream) {
+		Common::SeekableReadStream *soundStream = ResMan.getResource(resType, name);
+		if (!soundStream)
+			return ChannelHandle();
+
+		audioStream = makeAudioStream(soundStream);
+		if (!audioStream)
+			throw Common::Exception("No audio stream");
+
+		if (cache)
+			audioStream = _sampleCache.add(cacheName, generation, audioStream);
+	}
+
+	return playSound(audioStream, type, loop);
+}
+
+AudioStream *SoundManager::prefetchSoundResource(const Common::UString &name, Aurora::ResourceType resType,
+                                                bool loop) {
+	checkReady();
+
+	Common::SeekableReadStream *soundStream = ResMan.getResource(resType, name);
+	if (!soundStream)
+		return 0;
+
+	AudioStream *audioStream = makeAudioStream(soundStream);
+	if (!audioStream)
+		throw Common::Exception("No audio stream");
+
+	if (loop) {
+		RewindableAudioStream *reAudStream = dynamic_cast<RewindableAudioStream *>(audioStream);
+		if (!reAudStream)
+			warning("SoundManager::prefetchSoundResource(): The input stream cannot be rewound, this will not loop.");
+		else
+			audioStream = makeLoopingAudioStream(reAudStream, 0);
+	}
+
+	// Without sound output, there's nobody to decode ahead
+	if (!_hasSound || audioStream->endOfData())
+		return audioStream;
+
+	return new DecodeAheadStream(audioStream, true, *_decodePool, kDecodeAheadSize);
+}
+
+ChannelHandle SoundManager::playSound(AudioStream *audioStream, SoundType type, bool loop) {
 	if (loop) {
 		RewindableAudioStream *reAudStream = dynamic_cast<RewindableAudioStream *>(audioStream);
 		if (!reAudStream)
-			warning("SoundManager::playSoundFile(): The input stream cannot be rewound, this will not loop.");
+			warning("SoundManager::playSound(): The input stream cannot be rewound, this will not loop.");
 		else
 			audioStream = makeLoopingAudioStream(reAudStream, 0);
 	}
@@ -508,15 +649,15 @@ void SoundManager::stopChannel(ChannelHandle &handle) {
 void SoundManager::pauseAll(bool pause) {
 	std::lock_guard<std::recursive_mutex> lock(_mutex);
 
-	for (size_t i = 0; i < kChannelCount; i++)
-		pauseChannel(_channels[i].get(), pause);
+	for (std::vector<size_t>::const_iterator c = _activeChannels.begin(); c != _activeChannels.end(); ++c)
+		pauseChannel(_channels[*c].get(), pause);
 }
 
 void SoundManager::stopAll() {
 	std::lock_guard<std::recursive_mutex> lock(_mutex);
 
-	for (size_t i = 0; i < kChannelCount; i++)
-		freeChannel(i);
+	while (!_activeChannels.empty())
+		freeChannel(_activeChannels.back());
 }
 
 void SoundManager::setListenerGain(float gain) {
@@ -533,6 +674,10 @@ void SoundManager::setListenerPosition(float x, float y, float z) {
 
 	std::lock_guard<std::recursive_mutex> lock(_mutex);
 
+	_listenerPosition[0] = x;
+	_listenerPosition[1] = y;
+	_listenerPosition[2] = z;
+
 	alListener3f(AL_POSITION, x, y, z);
 }
 
@@ -556,7 +701,11 @@ void SoundManager::setChannelPosition(const ChannelHandle &handle, float x, floa
 		throw Common::Exception("Cannot set position of a non-mono sound in %s",
 		                        formatChannel(handle).c_str());
 
-	if (_hasSound)
+	channel->position[0] = x;
+	channel->position[1] = y;
+	channel->position[2] = z;
+
+	if (_hasSound && !channel->isVirtual)
 		alSource3f(channel->source, AL_POSITION, x, y, z);
 }
 
@@ -571,8 +720,9 @@ void SoundManager::getChannelPosition(const ChannelHandle &handle, float &x, flo
 		throw Common::Exception("Cannot get position of a non-mono sound in %s",
 		                        formatChannel(handle).c_str());
 
-	if (_hasSound)
-		alGetSource3f(channel->source, AL_POSITION, &x, &y, &z);
+	x = channel->position[0];
+	y = channel->position[1];
+	z = channel->position[2];
 }
 
 void SoundManager::setChannelGain(const ChannelHandle &handle, float gain) {
@@ -582,10 +732,55 @@ void SoundManager::setChannelGain(const ChannelHandle &handle, float gain) {
 	if (!channel || !channel->stream)
 		throw Common::Exception("Invalid channel");
 
-	channel->gain = gain;
+	// Setting the gain directly ends a fade
+	channel->isFading = false;
 
-	if (_hasSound)
-		alSourcef(channel->source, AL_GAIN, _types[channel->type].gain * gain);
+	setChannelGain(*channel, gain);
+}
+
+void SoundManager::setChannelGain(Channel &channel, float gain) {
+	channel.gain = gain;
+
+	if (_hasSound && !channel.isVirtual)
+		alSourcef(channel.source, AL_GAIN, _types[channel.type].gain * gain);
+}
+
+void SoundManager::fadeChannel(const ChannelHandle &handle, float gain, uint32_t duration, bool stop) {
+	std::lock_guard<std::recursive_mutex> lock(_mutex);
+
+	Channel *channel = getChannel(handle);
+	if (!channel || !channel->stream)
+		throw Common::Exception("Invalid channel");
+
+	channel->isFading     = true;
+	channel->fadeStop     = stop;
+	channel->fadeFromGain = channel->gain;
+	channel->fadeToGain   = gain;
+	channel->fadeDuration = duration / 1000.0;
+	channel->fadeStart    = std::chrono::steady_clock::now();
+
+	triggerUpdate();
+}
+
+bool SoundManager::updateFade(Channel &channel, const std::chrono::steady_clock::time_point &now) {
+	if (!channel.isFading)
+		return true;
+
+	const double elapsed = std::chrono::duration<double>(now - channel.fadeStart).count();
+	if ((elapsed >= channel.fadeDuration) || (channel.fadeDuration <= 0.0)) {
+		channel.isFading = false;
+
+		setChannelGain(channel, channel.fadeToGain);
+
+		return !channel.fadeStop;
+	}
+
+	const float t = elapsed / channel.fadeDuration;
+
+	setChannelGain(channel, channel.fadeFromGain + (channel.fadeToGain - channel.fadeFromGain) * t);
+
+	_fadingChannels++;
+	return true;
 }
 
 void SoundManager::setChannelPitch(const ChannelHandle &handle, float pitch) {
@@ -595,7 +790,9 @@ void SoundManager::setChannelPitch(const ChannelHandle &handle, float pitch) {
 	if (!channel || !channel->stream)
 		throw Common::Exception("Invalid channel");
 
-	if (_hasSound)
+	channel->pitch = pitch;
+
+	if (_hasSound && !channel->isVirtual)
 		alSourcef(channel->source, AL_PITCH, pitch);
 }
 
@@ -606,7 +803,9 @@ void SoundManager::setChannelRelative(const ChannelHandle &handle, bool relative
 	if (!channel || !channel->stream)
 		throw Common::Exception("Invalid channel");
 
-	if (_hasSound)
+	channel->relative = relative;
+
+	if (_hasSound && !channel->isVirtual)
 		alSourcei(channel->source, AL_SOURCE_RELATIVE, relative ? AL_TRUE : AL_FALSE);
 }
 
@@ -617,7 +816,10 @@ void SoundManager::setChannelDistance(const ChannelHandle &handle, float minDist
 	if (!channel || !channel->stream)
 		throw Common::Exception("Invalid channel");
 
-	if (_hasSound) {
+	channel->minDistance = minDistance;
+	channel->maxDistance = maxDistance;
+
+	if (_hasSound && !channel->isVirtual) {
 		alSourcef(channel->source, AL_REFERENCE_DISTANCE, minDistance);
 		alSourcef(channel->source, AL_MAX_DISTANCE, maxDistance);
 	}
@@ -630,6 +832,9 @@ uint64_t SoundManager::getChannelSamplesPlayed(const ChannelHandle &handle) {
 	if (!channel || !channel->stream)
 		return 0;
 
+	if (channel->isVirtual)
+		return channel->finishedBuffers / channel->stream->getChannels() / 2 + (uint64_t) channel->virtualSamples;
+
 	// Update the queued/unqueued buffers to make sure the channel is up-to-date
 	bufferData(*channel);
 
@@ -666,13 +871,13 @@ void SoundManager::setTypeGain(SoundType type, float gain) {
 	for (TypeList::iterator t = _types[type].list.begin(); t != _types[type].list.end(); ++t) {
 		assert(*t);
 
-		if (_hasSound)
+		if (_hasSound && !(*t)->isVirtual)
 			alSourcef((*t)->source, AL_GAIN, (*t)->gain * gain);
 	}
 }
 
 bool SoundManager::fillBuffer(const Channel &channel, ALuint alBuffer,
-                              AudioStream *stream, ALsizei &bufferedSize) const {
+                              AudioStream *stream, ALsizei &bufferedSize) {
 
 	bufferedSize = 0;
 
@@ -707,20 +912,22 @@ bool SoundManager::fillBuffer(const Channel &channel, ALuint alBuffer,
 		return false;
 	}
 
-	// Read in the required amount of samples
+	// Read in the required amount of samples, straight into our staging buffer.
+	// Only the samples actually read are handed to OpenAL, so no need to clear it
 	size_t numSamples = kOpenALBufferSize / 2;
 
-	std::unique_ptr<byte[]> buffer = std::make_unique<byte[]>(kOpenALBufferSize);
-	std::memset(buffer.get(), 0, kOpenALBufferSize);
-
-	numSamples = stream->readBuffer(reinterpret_cast<int16_t *>(buffer.get()), numSamples);
+	numSamples = stream->readBuffer(_sampleBuffer.get(), numSamples);
 	if (numSamples == AudioStream::kSizeInvalid) {
 		warning("Failed reading from stream while filling buffer in %s", formatChannel(&channel).c_str());
 		return false;
 	}
 
+	// Nothing decoded yet
+	if (numSamples == 0)
+		return false;
+
 	bufferedSize = numSamples * 2;
-	alBufferData(alBuffer, format, buffer.get(), bufferedSize, stream->getRate());
+	alBufferData(alBuffer, format, _sampleBuffer.get(), bufferedSize, stream->getRate());
 
 	ALenum error = alGetError();
 	if (error != AL_NO_ERROR) {
@@ -728,6 +935,8 @@ bool SoundManager::fillBuffer(const Channel &channel, ALuint alBuffer,
 		return false;
 	}
 
+	Common::DebugManager::addMetric(Common::kMetricSoundBuffersRefilled);
+
 	return true;
 }
 
@@ -742,9 +951,29 @@ void SoundManager::bufferData(Channel &channel) {
 	if (!channel.stream)
 		return;
 
-	if (!_hasSound)
+	if (!_hasSound || channel.isVirtual)
 		return;
 
+	unqueueBuffers(channel);
+
+	ALenum error = AL_NO_ERROR;
+
+	// Buffer as long as we still have data and free buffers
+	std::list<ALuint>::iterator buffer = channel.freeBuffers.begin();
+	while (buffer != channel.freeBuffers.end()) {
+		if (!fillBuffer(channel, *buffer, channel.stream.get(), channel.bufferSize[*buffer]))
+			break;
+
+		alSourceQueueBuffers(channel.source, 1, &*buffer);
+		if ((error = alGetError()) != AL_NO_ERROR)
+			throw Common::Exception("OpenAL error while queueing buffers in %s: 0x%X",
+			                        formatChannel(&channel).c_str(), error);
+
+		buffer = channel.freeBuffers.erase(buffer);
+	}
+}
+
+void SoundManager::unqueueBuffers(Channel &channel) {
 	ALenum error = AL_NO_ERROR;
 
 	// Get the number of buffers that have been processed
@@ -773,20 +1002,204 @@ void SoundManager::bufferData(Channel &channel) {
 
 		channel.finishedBuffers += channel.bufferSize[freeBuffers[i]];
 	}
+}
 
-	// Buffer as long as we still have data and free buffers
-	std::list<ALuint>::iterator buffer = channel.freeBuffers.begin();
-	while (buffer != channel.freeBuffers.end()) {
-		if (!fillBuffer(channel, *buffer, channel.stream.get(), channel.bufferSize[*buffer]))
-			break;
+void SoundManager::createSource(Channel &channel) {
+	ALenum error = AL_NO_ERROR;
 
-		alSourceQueueBuffers(channel.source, 1, &*buffer);
+	// Create the source
+	alGenSources(1, &channel.source);
+	if ((error = alGetError()) != AL_NO_ERROR)
+		throw Common::Exception("OpenAL error while generating sources: 0x%X", error);
+
+	// Create all needed buffers
+	for (size_t i = 0; i < kOpenALBufferCount; i++) {
+		ALuint buffer;
+
+		alGenBuffers(1, &buffer);
 		if ((error = alGetError()) != AL_NO_ERROR)
-			throw Common::Exception("OpenAL error while queueing buffers in %s: 0x%X",
-			                        formatChannel(&channel).c_str(), error);
+			throw Common::Exception("OpenAL error while generating buffers: 0x%X", error);
 
-		buffer = channel.freeBuffers.erase(buffer);
+		if (fillBuffer(channel, buffer, channel.stream.get(), channel.bufferSize[buffer])) {
+			// If we could fill the buffer with data, queue it
+
+			alSourceQueueBuffers(channel.source, 1, &buffer);
+			if ((error = alGetError()) != AL_NO_ERROR)
+				throw Common::Exception("OpenAL error while queueing buffers: 0x%X", error);
+
+		} else
+			// If not, put it into our free list
+			channel.freeBuffers.push_back(buffer);
+
+		channel.buffers.push_back(buffer);
+	}
+
+	// Apply all the channel's properties
+	alSourcef (channel.source, AL_GAIN, _types[channel.type].gain * channel.gain);
+	alSourcef (channel.source, AL_PITCH, channel.pitch);
+	alSourcei (channel.source, AL_SOURCE_RELATIVE, channel.relative ? AL_TRUE : AL_FALSE);
+	alSource3f(channel.source, AL_POSITION, channel.position[0], channel.position[1], channel.position[2]);
+	alSourcef (channel.source, AL_REFERENCE_DISTANCE, channel.minDistance);
+	alSourcef (channel.source, AL_MAX_DISTANCE, channel.maxDistance);
+}
+
+void SoundManager::deleteSource(Channel &channel) {
+	// Delete the channel's OpenAL source
+	if (channel.source)
+		alDeleteSources(1, &channel.source);
+
+	// Delete the OpenAL buffers
+	for (std::list<ALuint>::iterator buffer = channel.buffers.begin(); buffer != channel.buffers.end(); ++buffer)
+		alDeleteBuffers(1, &*buffer);
+
+	channel.source = 0;
+
+	channel.buffers.clear();
+	channel.freeBuffers.clear();
+	channel.bufferSize.clear();
+}
+
+void SoundManager::virtualizeChannel(Channel &channel) {
+	if (!_hasSound || channel.isVirtual || !channel.canVirtualize || !channel.stream)
+		return;
+
+	unqueueBuffers(channel);
+
+	// The position within the buffers still queued
+	ALint currentPosition = 0;
+	alGetSourcei(channel.source, AL_BYTE_OFFSET, &currentPosition);
+
+	uint64_t queuedSize = 0;
+	for (std::list<ALuint>::const_iterator b = channel.buffers.begin(); b != channel.buffers.end(); ++b)
+		queuedSize += channel.bufferSize[*b];
+	for (std::list<ALuint>::const_iterator b = channel.freeBuffers.begin(); b != channel.freeBuffers.end(); ++b)
+		queuedSize -= channel.bufferSize[*b];
+
+	const uint64_t bytesPerSample = channel.stream->getChannels() * 2;
+	const uint64_t played = MIN<uint64_t>(MAX<ALint>(currentPosition, 0), queuedSize);
+
+	/* Everything still queued has already been read from the stream, but not
+	 * played yet. It will be skipped over when the channel comes back. */
+	channel.finishedBuffers += played;
+	channel.virtualAhead     = (queuedSize - played) / bytesPerSample;
+	channel.virtualSamples   = 0.0;
+
+	deleteSource(channel);
+
+	channel.isVirtual = true;
+
+	debugC(Common::kDebugSound, 2, "Virtualized sound channel %s", formatChannel(&channel).c_str());
+}
+
+void SoundManager::devirtualizeChannel(Channel &channel) {
+	if (!channel.isVirtual)
+		return;
+
+	const uint64_t played = (uint64_t) channel.virtualSamples;
+
+	// Fast-forward the stream to where the playback would be now, minus what it was ahead already
+	uint64_t skip = (played > channel.virtualAhead) ? (played - channel.virtualAhead) : 0;
+	if ((channel.loopLength != RewindableAudioStream::kInvalidLength) && (channel.loopLength > 0))
+		skip %= channel.loopLength;
+
+	const int channels = channel.stream->getChannels();
+
+	uint64_t skipSamples = skip * channels;
+	while (skipSamples > 0) {
+		const size_t toRead = MIN<uint64_t>(skipSamples, (kOpenALBufferSize / 2 / channels) * channels);
+
+		const size_t samplesRead = channel.stream->readBuffer(_sampleBuffer.get(), toRead);
+		if ((samplesRead == AudioStream::kSizeInvalid) || (samplesRead == 0))
+			break;
+
+		skipSamples -= samplesRead;
+	}
+
+	channel.finishedBuffers += played * channels * 2;
+
+	channel.isVirtual      = false;
+	channel.virtualSamples = 0.0;
+	channel.virtualAhead   = 0;
+
+	// If the channel is playing, isPlaying() will start the new source
+	createSource(channel);
+
+	debugC(Common::kDebugSound, 2, "Devirtualized sound channel %s", formatChannel(&channel).c_str());
+}
+
+float SoundManager::getListenerDistance(const Channel &channel) const {
+	float x = channel.position[0];
+	float y = channel.position[1];
+	float z = channel.position[2];
+
+	if (!channel.relative) {
+		x -= _listenerPosition[0];
+		y -= _listenerPosition[1];
+		z -= _listenerPosition[2];
+	}
+
+	return sqrtf(x * x + y * y + z * z);
+}
+
+void SoundManager::updateVirtualChannels() {
+	if (!_hasSound)
+		return;
+
+	_audibleChannels.clear();
+
+	// Channels that can't go virtual always hold on to their source
+	size_t fixedChannels = 0;
+
+	for (std::vector<size_t>::const_iterator c = _activeChannels.begin(); c != _activeChannels.end(); ++c) {
+		Channel &channel = *_channels[*c];
+
+		if (!channel.canVirtualize) {
+			fixedChannels++;
+			continue;
+		}
+
+		bool audible = (_types[channel.type].gain * channel.gain) > 0.0f;
+
+		// Only mono sounds are positioned. The farther away, the less important
+		float priority = 0.0f;
+		if (audible && (channel.stream->getChannels() == 1) && (channel.maxDistance < FLT_MAX)) {
+			const float distance = getListenerDistance(channel);
+
+			// With the linear clamped distance model, nothing is audible beyond the max distance
+			const float maxDistance = channel.isVirtual ?
+				channel.maxDistance : (channel.maxDistance * kVirtualDistanceFactor);
+
+			audible  = distance <= maxDistance;
+			priority = distance / MAX(channel.maxDistance, 0.001f);
+		}
+
+		if (!audible) {
+			virtualizeChannel(channel);
+			continue;
+		}
+
+		_audibleChannels.push_back(std::make_pair(priority, *c));
+	}
+
+	std::sort(_audibleChannels.begin(), _audibleChannels.end());
+
+	// Give the most important audible channels a source, as long as we're within budget
+	const size_t budget = kMaxRealChannels - MIN(fixedChannels, kMaxRealChannels);
+	for (size_t i = 0; i < _audibleChannels.size(); i++) {
+		Channel &channel = *_channels[_audibleChannels[i].second];
+
+		if (i < budget)
+			devirtualizeChannel(channel);
+		else
+			virtualizeChannel(channel);
 	}
+
+	size_t virtualChannels = 0;
+	for (std::vector<size_t>::const_iterator c = _activeChannels.begin(); c != _activeChannels.end(); ++c)
+		if (_channels[*c]->isVirtual)
+			virtualChannels++;
+
+	Common::DebugManager::setMetric(Common::kMetricSoundVirtualChannels, virtualChannels);
 }
 
 void SoundManager::checkReady() {
@@ -795,34 +1208,53 @@ void SoundManager::checkReady() {
 }
 
 void SoundManager::update() {
+	PROFILE_ZONE("SoundManager::update");
+
 	std::lock_guard<std::recursive_mutex> lock(_mutex);
 
-	size_t channelCount = 0;
-	for (size_t i = 0; i < kChannelCount; i++) {
-		if (!_channels[i])
-			continue;
+	const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	const double elapsed = std::chrono::duration<double>(now - _lastUpdate).count();
+
+	_lastUpdate = now;
+
+	_fadingChannels = 0;
 
-		channelCount++;
+	const size_t channelCount = _activeChannels.size();
 
-		// Free the channel if it is no longer playing
-		if (!isPlaying(i)) {
-			freeChannel(i);
+	/* Go backwards, so that freeing a channel only moves an already
+	 * updated one into its place in the active channel list. */
+	for (size_t i = channelCount; i-- > 0; ) {
+		const size_t channel = _activeChannels[i];
+
+		// Virtual channels only keep track of where their playback would be by now
+		Channel &c = *_channels[channel];
+		if (c.isVirtual && (c.state == AL_PLAYING))
+			c.virtualSamples += elapsed * c.stream->getRate() * c.pitch;
+
+		// Free the channel if it is no longer playing, or faded out to be stopped
+		if (!updateFade(c, now) || !isPlaying(channel)) {
+			freeChannel(channel);
 			continue;
 		}
 
 		// Try to buffer some more data
-		bufferData(i);
+		bufferData(channel);
 	}
 
+	updateVirtualChannels();
+
+	Common::DebugManager::setMetric(Common::kMetricSoundChannels, _activeChannels.size());
+
 	debugC(Common::kDebugSound, 9, "Active sound channel: %s", Common::composeString(channelCount).c_str());
 }
 
-ChannelHandle SoundManager::newChannel() {
+ChannelHandle SoundManager::newChannel(SoundType type, AudioStream *stream, bool disposeAfterUse) {
 	size_t foundChannel = kChannelInvalid;
 
-	for (size_t i = 0; (i < kChannelCount) && (foundChannel == kChannelInvalid); i++)
-		if (!_channels[i])
-			foundChannel = i;
+	if (!_freeChannels.empty())
+		foundChannel = _freeChannels.back();
+	else if (_unusedChannel < kChannelCount)
+		foundChannel = _unusedChannel;
 
 	if (foundChannel == kChannelInvalid)
 		throw Common::Exception("All sound channels occupied");
@@ -830,7 +1262,23 @@ ChannelHandle SoundManager::newChannel() {
 	ChannelHandle handle;
 
 	handle.channel = foundChannel;
-	handle.id      = _curID++;
+	handle.id      = _curID;
+
+	_activeChannels.reserve(_activeChannels.size() + 1);
+
+	_channels[foundChannel] = std::make_unique<Channel>(handle.id, handle.channel, type,
+	                                                    _types[type].list.end(), stream, disposeAfterUse);
+
+	// Only take the place once the channel exists
+	if (!_freeChannels.empty())
+		_freeChannels.pop_back();
+	else
+		_unusedChannel++;
+
+	_channels[foundChannel]->activeIndex = _activeChannels.size();
+	_activeChannels.push_back(foundChannel);
+
+	_curID++;
 
 	// ID 0 is reserved for "invalid ID"
 	if (_curID == 0)
@@ -845,7 +1293,7 @@ void SoundManager::pauseChannel(Channel *channel, bool pause) {
 
 	ALenum error = AL_NO_ERROR;
 	if (pause) {
-		if (_hasSound) {
+		if (_hasSound && !channel->isVirtual) {
 			alSourcePause(channel->source);
 			if ((error = alGetError()) != AL_NO_ERROR)
 				warning("OpenAL error while attempting to pause channel %s: 0x%X",
@@ -892,20 +1340,22 @@ void SoundManager::freeChannel(size_t channel) {
 	// Discard the stream
 	c->stream.reset();
 
-	if (_hasSound) {
-		// Delete the channel's OpenAL source
-		if (c->source)
-			alDeleteSources(1, &c->source);
-
-		// Delete the OpenAL buffers
-		for (std::list<ALuint>::iterator buffer = c->buffers.begin(); buffer != c->buffers.end(); ++buffer)
-			alDeleteBuffers(1, &*buffer);
-	}
+	if (_hasSound)
+		deleteSource(*c);
 
 	// Remove the channel from the type list
 	if (c->typeIt != _types[c->type].list.end())
 		_types[c->type].list.erase(c->typeIt);
 
+	// Remove the channel from the active list, moving the last one into its place
+	const size_t activeIndex = c->activeIndex;
+
+	_activeChannels[activeIndex] = _activeChannels.back();
+	_channels[_activeChannels[activeIndex]]->activeIndex = activeIndex;
+	_activeChannels.pop_back();
+
+	_freeChannels.push_back(channel);
+
 	// And finally delete the channel itself
 	_channels[channel].reset();
 }
@@ -913,8 +1363,12 @@ void SoundManager::freeChannel(size_t channel) {
 void SoundManager::threadMethod() {
 	while (!_killThread.load(std::memory_order_relaxed)) {
 		update();
+
+		// Update more often while channels are fading, for a smooth fade
+		const int wait = (_fadingChannels > 0) ? 20 : 100;
+
 		std::unique_lock<std::recursive_mutex> lock(_needUpdateMutex);
-		_needUpdate.wait_for(lock, std::chrono::duration<int, std::milli>(100));
+		_needUpdate.wait_for(lock, std::chrono::duration<int, std::milli>(wait));
 	}
 }
 
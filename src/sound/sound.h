@@ -38,6 +38,8 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <vector>
+#include <chrono>
 
 #include "src/common/types.h"
 #include "src/common/disposableptr.h"
@@ -45,8 +47,12 @@
 #include "src/common/thread.h"
 #include "src/common/ustring.h"
 #include "src/common/mutex.h"
+#include "src/common/memoryusage.h"
+
+#include "src/aurora/types.h"
 
 #include "src/sound/types.h"
+#include "src/sound/samplecache.h"
 
 namespace Common {
 	class SeekableReadStream;
@@ -55,6 +61,7 @@ namespace Common {
 namespace Sound {
 
 class AudioStream;
+class DecodeAheadPool;
 
 /** The sound manager. */
 class SoundManager : public Common::Singleton<SoundManager>, public Common::Thread {
@@ -88,6 +95,12 @@ public:
 	uint64_t getChannelSamplesPlayed(const ChannelHandle &handle);
 	/** Return the time this channel has already played in milliseconds. */
 	uint64_t getChannelDurationPlayed(const ChannelHandle &handle);
+
+	/** Return the number of channels currently in use. */
+	size_t getActiveChannelCount();
+
+	/** Collect how much memory the buffers of each active channel and each cached sound take up. */
+	void getMemoryUsage(Common::MemoryUsageList &usage);
 	// '---
 
 	// .--- Playing sounds
@@ -116,6 +129,37 @@ public:
 	 */
 	ChannelHandle playAudioStream(AudioStream *audStream,
 	                              SoundType type, bool disposeAfterUse = true);
+
+	/** Play a sound resource.
+	 *
+	 *  Short sounds are fully decoded once, and then kept in a cache. Playing
+	 *  the same sound again doesn't touch the resource or decode it again.
+	 *
+	 *  This only allocate a channel for the sound, to actually start playing it,
+	 *  call startChannel().
+	 *
+	 *  @param  name The name of the sound resource.
+	 *  @param  resType The resource type of the sound.
+	 *  @param  type The type of the sound.
+	 *  @param  loop Should the sound loop?
+	 *  @return The channel the sound has been assigned to, or an invalid
+	 *          channel if there is no such resource.
+	 */
+	ChannelHandle playSoundResource(const Common::UString &name, Aurora::ResourceType resType,
+	                                SoundType type, bool loop = false);
+
+	/** Open a sound resource and start decoding it ahead of time.
+	 *
+	 *  The returned stream can be played later with playAudioStream(). By then,
+	 *  its first samples are already decoded, so starting it causes no gap.
+	 *
+	 *  @param  name The name of the sound resource.
+	 *  @param  resType The resource type of the sound.
+	 *  @param  loop Should the sound loop?
+	 *  @return The stream, or 0 if there is no such resource.
+	 */
+	AudioStream *prefetchSoundResource(const Common::UString &name, Aurora::ResourceType resType,
+	                                   bool loop = false);
 	// '---
 
 	// .--- Starting/Pausing/Stopping channels
@@ -159,6 +203,15 @@ public:
 	/** Set the gain/volume of the channel. */
 	void setChannelGain(const ChannelHandle &handle, float gain);
 
+	/** Fade the gain/volume of the channel to a new value.
+	 *
+	 *  @param handle The channel to fade.
+	 *  @param gain The gain at the end of the fade.
+	 *  @param duration The length of the fade in milliseconds.
+	 *  @param stop Stop and free the channel once the fade is done?
+	 */
+	void fadeChannel(const ChannelHandle &handle, float gain, uint32_t duration, bool stop = false);
+
 	/** Set the pitch of the channel. */
 	void setChannelPitch(const ChannelHandle &handle, float pitch);
 
@@ -200,8 +253,9 @@ private:
 
 	/** A sound channel. */
 	struct Channel {
-		uint32_t id;    ///< The channel's ID.
-		size_t   index; ///< The channel's index.
+		uint32_t id;          ///< The channel's ID.
+		size_t   index;       ///< The channel's index.
+		size_t   activeIndex; ///< The channel's position in the active channel list.
 
 		ALint state; ///< The sound's state.
 
@@ -222,6 +276,35 @@ private:
 
 		float gain; ///< The channel's gain.
 
+		float position[3];  ///< The channel's position.
+		bool  relative;     ///< Is the position relative to the listener?
+		float pitch;        ///< The channel's pitch.
+		float minDistance;  ///< The distance at which the channel starts to fade.
+		float maxDistance;  ///< The distance beyond which the channel is inaudible.
+
+		/** Length of the sound in samples per channel, or kInvalidLength if unknown or looping. */
+		uint64_t length;
+		/** Length of one loop in samples per channel, or kInvalidLength if not looping. */
+		uint64_t loopLength;
+
+		/** Can this channel give up its OpenAL source while it's inaudible? */
+		bool canVirtualize;
+		/** Is this channel currently without an OpenAL source? */
+		bool isVirtual;
+
+		/** Number of samples per channel played since the channel went virtual. */
+		double virtualSamples;
+		/** Number of samples per channel the stream was ahead of the playback when it went virtual. */
+		uint64_t virtualAhead;
+
+		bool  isFading;      ///< Is the gain of this channel currently fading?
+		bool  fadeStop;      ///< Stop the channel once the fade is done?
+		float fadeFromGain;  ///< The gain at the start of the fade.
+		float fadeToGain;    ///< The gain at the end of the fade.
+		double fadeDuration; ///< The length of the fade in seconds.
+
+		std::chrono::steady_clock::time_point fadeStart; ///< When the fade started.
+
 		Channel(uint32_t i, size_t idx, SoundType t, const TypeList::iterator &ti, AudioStream *s, bool d);
 	};
 
@@ -233,8 +316,35 @@ private:
 	ALenum _format51; ///< The value for the 5.1 multi-channel format.
 
 	std::unique_ptr<Channel> _channels[kChannelCount]; ///< The sound channels.
+
+	std::vector<size_t> _activeChannels; ///< Indices of all channels currently in use.
+	std::vector<size_t> _freeChannels;   ///< Indices of channels freed again.
+	size_t _unusedChannel; ///< The first index of channels never used so far.
+
+	/** The samples read from a stream before they're handed to OpenAL.
+	 *
+	 *  Reused for all channels, since all buffer filling happens with _mutex held.
+	 */
+	std::unique_ptr<int16_t[]> _sampleBuffer;
+
+	SampleCache _sampleCache; ///< Decoded samples of short sounds.
+
+	/** Workers decoding longer sounds ahead of time, so that a slow decoder doesn't hold up this thread. */
+	std::unique_ptr<DecodeAheadPool> _decodePool;
+
 	Type _types[kSoundTypeMAX]; ///< The sound types.
 
+	float _listenerPosition[3]; ///< The position of the listener.
+
+	/** When the channels were last updated. */
+	std::chrono::steady_clock::time_point _lastUpdate;
+
+	/** Number of channels fading during the last update. Only used by the sound thread. */
+	size_t _fadingChannels;
+
+	/** Audible virtualizable channels, sorted by priority. Reused by every update. */
+	std::vector<std::pair<float, size_t> > _audibleChannels;
+
 	uint32_t _curID; ///< The ID the next sound will get.
 
 	std::recursive_mutex _mutex;
@@ -252,8 +362,34 @@ private:
 	/** Update the sound information. Called regularly from within the thread method. */
 	void update();
 
-	/** Look for a free place in the channel vector. */
-	ChannelHandle newChannel();
+	/** Play an audio stream, looping it if requested. */
+	ChannelHandle playSound(AudioStream *audioStream, SoundType type, bool loop);
+
+	/** Create a new channel in a free place of the channel array. */
+	ChannelHandle newChannel(SoundType type, AudioStream *stream, bool disposeAfterUse);
+
+	/** Set the gain of the channel, and of its source. */
+	void setChannelGain(Channel &channel, float gain);
+	/** Advance the fade of a channel. Returns false if the channel should be stopped. */
+	bool updateFade(Channel &channel, const std::chrono::steady_clock::time_point &now);
+
+	/** Create the OpenAL source and buffers for a channel, and fill them. */
+	void createSource(Channel &channel);
+	/** Delete the OpenAL source and buffers of a channel. */
+	void deleteSource(Channel &channel);
+
+	/** Give up the OpenAL source of an inaudible channel, keeping track of its playback position. */
+	void virtualizeChannel(Channel &channel);
+	/** Give a virtual channel an OpenAL source again, continuing where its playback would be now. */
+	void devirtualizeChannel(Channel &channel);
+	/** Decide which channels are audible and should get an OpenAL source. */
+	void updateVirtualChannels();
+
+	/** Return the distance of a channel from the listener. */
+	float getListenerDistance(const Channel &channel) const;
+
+	/** Take the buffers OpenAL has finished playing off the channel's source. */
+	void unqueueBuffers(Channel &channel);
 
 	/** Buffer more sound from the channel to the OpenAL buffers. */
 	void bufferData(Channel &channel);
@@ -282,7 +418,7 @@ private:
 
 	/** Fill the buffer with data from the audio stream. */
 	bool fillBuffer(const Channel &channel, ALuint alBuffer,
-	                AudioStream *stream, ALsizei &bufferedSize) const;
+	                AudioStream *stream, ALsizei &bufferedSize);
 
 	/** Return a string representing this channel. */
 	Common::UString formatChannel(const Channel *channel) const;
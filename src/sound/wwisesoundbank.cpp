@@ -43,28 +43,33 @@
 
 namespace Sound {
 
-WwiseSoundBank::WwiseSoundBank(Common::SeekableReadStream *bnk) : _bnk(bnk), _bankID(0),
-		_dataOffset(SIZE_MAX) {
+WwiseSoundBank::WwiseSoundBank(Common::SeekableReadStream *bnk) : _bankID(0), _dataOffset(SIZE_MAX) {
+	assert(bnk);
 
-	assert(_bnk);
-
-	load(*_bnk);
+	open(bnk);
 }
 
 WwiseSoundBank::WwiseSoundBank(const Common::UString &name) : _bankID(0), _dataOffset(SIZE_MAX) {
-	_bnk.reset(ResMan.getResource(name, Aurora::kFileTypeBNK));
-	if (!_bnk)
+	Common::SeekableReadStream *bnk = ResMan.getResource(name, Aurora::kFileTypeBNK);
+	if (!bnk)
 		throw Common::Exception("No such BNK resource \"%s\"", name.c_str());
 
-	load(*_bnk);
+	open(bnk);
 }
 
 WwiseSoundBank::WwiseSoundBank(uint64_t hash) : _bankID(0), _dataOffset(SIZE_MAX) {
-	_bnk.reset(ResMan.getResource(hash));
-	if (!_bnk)
+	Common::SeekableReadStream *bnk = ResMan.getResource(hash);
+	if (!bnk)
 		throw Common::Exception("No such BNK resource \"%s\"", Common::formatHash(hash).c_str());
 
-	load(*_bnk);
+	open(bnk);
+}
+
+void WwiseSoundBank::open(Common::SeekableReadStream *bnk) {
+	std::unique_ptr<Common::SeekableReadStream> stream(bnk);
+	load(*stream);
+
+	_bnk = Common::SharedReadStream::create(stream.release());
 }
 
 size_t WwiseSoundBank::getFileCount() const {
@@ -153,9 +158,7 @@ Common::SeekableReadStream *WwiseSoundBank::getFileData(size_t index) const {
 	if (_dataOffset == SIZE_MAX)
 		throw Common::Exception("WwiseSoundBank::getFileData(): No data offset");
 
-	_bnk->seek(_dataOffset + file.offset);
-
-	return _bnk->readStream(file.size);
+	return _bnk->createSubStream(_dataOffset + file.offset, file.size);
 }
 
 Common::SeekableReadStream *WwiseSoundBank::getSoundData(size_t index) const {
@@ -177,9 +180,7 @@ Common::SeekableReadStream *WwiseSoundBank::getSoundData(size_t index) const {
 	if (sound.fileSource == _bankID) {
 		// Sound file is embedded in this bank
 
-		_bnk->seek(sound.fileOffset);
-
-		return _bnk->readStream(sound.fileSize);
+		return _bnk->createSubStream(sound.fileOffset, sound.fileSize);
 	}
 
 	// Sound file is embedded in another bank
@@ -190,15 +191,14 @@ Common::SeekableReadStream *WwiseSoundBank::getSoundData(size_t index) const {
 		                        "without a bank name", Common::composeString(index).c_str(),
 		                        sound.id, sound.fileID, sound.fileSource);
 
-	std::unique_ptr<Common::SeekableReadStream> bank(ResMan.getResource(bankName->second, Aurora::kFileTypeBNK));
+	Common::SeekableReadStream *bank = ResMan.getResource(bankName->second, Aurora::kFileTypeBNK);
 	if (!bank)
 		throw Common::Exception("WwiseSoundBank::getSoundData(): Bank \"%s\" for externally embedded file "
 		                        "(%s, %u, %u) does not exist", bankName->second.c_str(),
 		                        Common::composeString(index).c_str(), sound.id, sound.fileID);
 
-	bank->seek(sound.fileOffset);
-
-	return bank->readStream(sound.fileSize);
+	// The stream of the sound keeps the other bank open, for as long as it's needed
+	return Common::SharedReadStream::create(bank)->createSubStream(sound.fileOffset, sound.fileSize);
 }
 
 static constexpr uint32_t kSectionBankHeader  = MKTAG('B', 'K', 'H', 'D');
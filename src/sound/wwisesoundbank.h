@@ -30,6 +30,7 @@
 #include <map>
 
 #include "src/common/ustring.h"
+#include "src/common/sharedreadstream.h"
 #include "src/common/readstream.h"
 
 namespace Sound {
@@ -101,7 +102,8 @@ private:
 		size_t fileSize;
 	};
 
-	std::unique_ptr<Common::SeekableReadStream> _bnk;
+	/** The bank, shared with the streams of the files within. */
+	std::shared_ptr<Common::SharedReadStream> _bnk;
 
 	uint32_t _bankID;
 	size_t _dataOffset;
@@ -115,6 +117,8 @@ private:
 	std::map<uint32_t, size_t> _soundIDs;
 
 
+	/** Read the bank's index, then keep the stream around to share it. */
+	void open(Common::SeekableReadStream *bnk);
 	void load(Common::SeekableReadStream &bnk);
 
 	const File &getFileStruct(size_t index) const;
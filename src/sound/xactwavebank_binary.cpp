@@ -76,10 +76,13 @@ static constexpr uint32_t kWaveFlagsLoopCache      = 0x00000002; ///< Audio file
 static constexpr uint32_t kWaveFlagsRemoveLoopTail = 0x00000004; ///< Ignore the data after the looping section.
 static constexpr uint32_t kWaveFlagsIgnoreLoop     = 0x00000008; ///< Don't loop this sound.
 
-XACTWaveBank_Binary::XACTWaveBank_Binary(Common::SeekableReadStream *xwb) : _xwb(xwb) {
-	assert(_xwb);
+XACTWaveBank_Binary::XACTWaveBank_Binary(Common::SeekableReadStream *xwb) {
+	assert(xwb);
 
-	load(*_xwb);
+	std::unique_ptr<Common::SeekableReadStream> stream(xwb);
+	load(*stream);
+
+	_xwb = Common::SharedReadStream::create(stream.release());
 }
 
 bool XACTWaveBank_Binary::isStreaming() const {
@@ -98,8 +101,8 @@ RewindableAudioStream *XACTWaveBank_Binary::getWave(size_t index) const {
 
 	const Wave &wave = _waves[index];
 
-	_xwb->seek(wave.offset);
-	std::unique_ptr<Common::SeekableReadStream> dataStream(_xwb->readStream(wave.size));
+	// Only read the wave's data, when it's played
+	std::unique_ptr<Common::SeekableReadStream> dataStream(_xwb->createSubStream(wave.offset, wave.size));
 
 	switch (wave.codec) {
 		case Codec::PCM:
@@ -108,7 +111,7 @@ RewindableAudioStream *XACTWaveBank_Binary::getWave(size_t index) const {
 			                     wave.channels);
 
 		case Codec::ADPCM:
-			return makeADPCMStream(dataStream.release(), true, dataStream->size(),
+			return makeADPCMStream(dataStream.release(), true, wave.size,
 			                       kADPCMXbox, wave.samplingRate,  wave.channels);
 
 		case Codec::WMA:
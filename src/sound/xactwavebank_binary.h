@@ -30,6 +30,7 @@
 
 #include "src/common/ustring.h"
 #include "src/common/readstream.h"
+#include "src/common/sharedreadstream.h"
 
 #include "src/sound/xactwavebank.h"
 
@@ -101,7 +102,8 @@ private:
 	using Waves = std::vector<Wave>;
 
 
-	std::unique_ptr<Common::SeekableReadStream> _xwb;
+	/** The bank, shared with the streams of the waves within. */
+	std::shared_ptr<Common::SharedReadStream> _xwb;
 
 	Common::UString _name; ///< The internal name of this wavebank. */
 	uint32_t _flags;
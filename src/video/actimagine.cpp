@@ -39,6 +39,7 @@ ActimagineDecoder::ActimagineDecoder(Common::SeekableReadStream *vx) : _vx(vx) {
 }
 
 ActimagineDecoder::~ActimagineDecoder() {
+	deinit();
 }
 
 void ActimagineDecoder::decodeNextTrackFrame(VideoTrack &UNUSED(track)) {
@@ -72,6 +72,8 @@
 #include <cmath>
 #include <cstring>
 
+#include <boost/scope_exit.hpp>
+
 #include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/maths.h"
@@ -85,12 +87,11 @@
 
 #include "src/graphics/yuv_to_rgb.h"
 
-#include "src/graphics/images/surface.h"
-
 #include "src/sound/audiostream.h"
 #include "src/sound/decoders/pcm.h"
 #include "src/sound/decoders/util.h"
 
+#include "src/video/yuvframe.h"
 #include "src/video/bink.h"
 #include "src/video/binkdata.h"
 
@@ -158,6 +159,7 @@ Bink::Bink(Common::SeekableReadStream *bink) : _bink(bink), _audioTrack(0) {
 }
 
 Bink::~Bink() {
+	deinit();
 }
 
 void Bink::decodeNextTrackFrame(VideoTrack &track) {
@@ -180,18 +182,15 @@ void Bink::decodeNextTrackFrame(VideoTrack &track) {
 		frameSize -= audioPacketLength;
 	}
 
-	size_t videoPacketStart = _bink->pos();
-	size_t videoPacketEnd   = _bink->pos() + frameSize;
-
-	frame.bits =
-		new Common::BitStream32LELSB(new Common::SeekableSubReadStream(_bink.get(),
-		    videoPacketStart, videoPacketEnd), true);
+	frame.bits = new Common::MemoryBitStream32LELSB(_bink->readStream(frameSize), true);
 
-	assert(_surface);
-	videoTrack.decodePacket(*_surface, frame);
+	BOOST_SCOPE_EXIT( (&frame) ) {
+		delete frame.bits;
+		frame.bits = 0;
+	} BOOST_SCOPE_EXIT_END
 
-	delete frame.bits;
-	frame.bits = 0;
+	assert(_frame);
+	videoTrack.decodePacket(*_frame, frame);
 
 	_needCopy = true;
 }
@@ -200,7 +199,7 @@ void Bink::checkAudioBuffer(AudioTrack &track, const Common::Timestamp &endTime)
 	static_cast<BinkAudioTrack &>(track).decodeAudio(*_bink, _frames, _audioTracks, endTime);
 }
 
-void Bink::BinkVideoTrack::decodePacket(Graphics::Surface &surface, VideoFrame &video) {
+void Bink::BinkVideoTrack::decodePacket(YUVFrame &frame, VideoFrame &video) {
 	assert(video.bits);
 
 	if (_hasAlpha) {
@@ -222,10 +221,9 @@ void Bink::BinkVideoTrack::decodePacket(Graphics::Surface &surface, VideoFrame &
 			break;
 	}
 
-	// Convert the YUVA data we have to BGRA
+	// Hand out the YUVA data we have
 	assert(_curPlanes[0] && _curPlanes[1] && _curPlanes[2] && _curPlanes[3]);
-	YUVToRGBMan.convert420(Graphics::YUVToRGBManager::kScaleITU,
-			surface.getData(), surface.getWidth() * 4,
+	frame.set420(Graphics::YUVToRGBManager::kScaleITU,
 			_curPlanes[0].get(), _curPlanes[1].get(), _curPlanes[2].get(), _curPlanes[3].get(),
 			_width, _height, _width, _width >> 1);
 
@@ -510,7 +508,7 @@ void Bink::load() {
 
 	_frames[frameCount - 1].size = _bink->size() - _frames[frameCount - 1].offset;
 
-	initVideo();
+	initVideo(true);
 
 	if (_audioTrack < _audioTracks.size())
 		addTrack(new BinkAudioTrack(_audioTrack, _audioTracks[_audioTrack]));
@@ -1363,7 +1361,7 @@ void Bink::BinkAudioTrack::decodeAudio(Common::SeekableReadStream& bink, const s
 		uint32_t sampleCount = bink.readUint32LE() / (2 * _info.channels);
 
 		// Create a substream for these bits
-		Common::BitStream32LELSB bits(new Common::SeekableSubReadStream(&bink, bink.pos(), bink.pos() + audioPacketLength - 4), true);
+		Common::MemoryBitStream32LELSB bits(new Common::SeekableSubReadStream(&bink, bink.pos(), bink.pos() + audioPacketLength - 4), true);
 
 		int outSize = _info.frameLen * _info.channels;
 
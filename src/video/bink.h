@@ -184,7 +184,7 @@ private:
 		int getFrameCount() const { return _frameCount; }
 
 		/** Decode a video packet. */
-		void decodePacket(Graphics::Surface &surface, VideoFrame &frame);
+		void decodePacket(YUVFrame &frame, VideoFrame &video);
 
 	protected:
 		Common::Rational getFrameRate() const { return _frameRate; }
@@ -31,18 +31,16 @@ namespace Common {
 	class SeekableReadStream;
 }
 
-namespace Graphics {
-	class Surface;
-}
-
 namespace Video {
 
+class YUVFrame;
+
 class Codec : boost::noncopyable {
 public:
 	Codec();
 	virtual ~Codec();
 
-	virtual void decodeFrame(Graphics::Surface &surface, Common::SeekableReadStream &data) = 0;
+	virtual void decodeFrame(YUVFrame &frame, Common::SeekableReadStream &data) = 0;
 };
 
 } // End of namespace Video
@@ -34,7 +34,7 @@
 
 #include "src/graphics/yuv_to_rgb.h"
 
-#include "src/graphics/images/surface.h"
+#include "src/video/yuvframe.h"
 
 #include "src/video/codecs/codec.h"
 #include "src/video/codecs/h263.h"
@@ -48,7 +48,7 @@ public:
 	H263Codec(uint32_t width, uint32_t height, Common::SeekableReadStream &extraData);
 	~H263Codec();
 
-	void decodeFrame(Graphics::Surface &surface, Common::SeekableReadStream &dataStream);
+	void decodeFrame(YUVFrame &frame, Common::SeekableReadStream &dataStream);
 
 private:
 	uint32_t _width;
@@ -59,7 +59,7 @@ private:
 	/**
 	 * Internal decode function
 	 */
-	void decodeInternal(Common::SeekableReadStream &dataStream, Graphics::Surface *surface = 0);
+	void decodeInternal(Common::SeekableReadStream &dataStream, YUVFrame *frame = 0);
 };
 
 H263Codec::H263Codec(uint32_t width, uint32_t height, Common::SeekableReadStream &extraData) : _width(width), _height(height) {
@@ -82,7 +82,7 @@ H263Codec::H263Codec(uint32_t width, uint32_t height, Common::SeekableReadStream
 	_decHandle = xvid_dec_create.handle;
 
 	// Run the first extra data through the frame decoder, but don't bother
-	// decoding to a surface.
+	// decoding to a frame.
 	extraData.seek(0);
 	decodeInternal(extraData);
 }
@@ -91,7 +91,7 @@ H263Codec::~H263Codec() {
 	xvid_decore(_decHandle, XVID_DEC_DESTROY, 0, 0);
 }
 
-void H263Codec::decodeInternal(Common::SeekableReadStream &dataStream, Graphics::Surface *surface) {
+void H263Codec::decodeInternal(Common::SeekableReadStream &dataStream, YUVFrame *frame) {
 	// NOTE: When asking libxvidcore to decode the video into BGRA, it fills the alpha
 	//       values with 0x00, rendering the output invisible (!).
 	//       Since we, surprise, actually want to see the video, we would have to pass
@@ -118,20 +118,19 @@ void H263Codec::decodeInternal(Common::SeekableReadStream &dataStream, Graphics:
 	if (result < 0)
 		throw Common::Exception("H263Codec::decodeFrame(): Failed to decode frame: %d", result);
 
-	if (surface &&
+	if (frame &&
 	    xvid_dec_frame.output.plane[0] &&
 	    xvid_dec_frame.output.plane[1] &&
 	    xvid_dec_frame.output.plane[2])
-		YUVToRGBMan.convert420(Graphics::YUVToRGBManager::kScaleFull,
-				surface->getData(), surface->getWidth() * 4,
+		frame->set420(Graphics::YUVToRGBManager::kScaleFull,
 				static_cast<const byte *>(xvid_dec_frame.output.plane[0]),
 				static_cast<const byte *>(xvid_dec_frame.output.plane[1]),
-				static_cast<const byte *>(xvid_dec_frame.output.plane[2]), _width, _height,
+				static_cast<const byte *>(xvid_dec_frame.output.plane[2]), 0, _width, _height,
 				xvid_dec_frame.output.stride[0], xvid_dec_frame.output.stride[1]);
 }
 
-void H263Codec::decodeFrame(Graphics::Surface &surface, Common::SeekableReadStream &dataStream) {
-	decodeInternal(dataStream, &surface);
+void H263Codec::decodeFrame(YUVFrame &frame, Common::SeekableReadStream &dataStream) {
+	decodeInternal(dataStream, &frame);
 }
 
 } // End of anonymous namespace
@@ -33,7 +33,7 @@
 
 #include "src/common/readstream.h"
 #include "src/graphics/yuv_to_rgb.h"
-#include "src/graphics/images/surface.h"
+#include "src/video/yuvframe.h"
 #include "src/video/codecs/codec.h"
 #include "src/video/codecs/vpx.h"
 
@@ -46,7 +46,7 @@ public:
 
 	bool init(vpx_codec_iface_t *iface);
 
-	void decodeFrame(Graphics::Surface &surface, Common::SeekableReadStream &dataStream);
+	void decodeFrame(YUVFrame &frame, Common::SeekableReadStream &dataStream);
 
 private:
 	bool _initialized;
@@ -84,7 +84,7 @@ bool VPXDecoder::init(vpx_codec_iface_t *iface) {
 	return true;
 }
 
-void VPXDecoder::decodeFrame(Graphics::Surface &surface, Common::SeekableReadStream &dataStream) {
+void VPXDecoder::decodeFrame(YUVFrame &frame, Common::SeekableReadStream &dataStream) {
 	if (!_initialized)
 		return;
 
@@ -116,10 +116,14 @@ void VPXDecoder::decodeFrame(Graphics::Surface &surface, Common::SeekableReadStr
 		return;
 	}
 
+	// Figure out the color matrix
+	const Graphics::YUVToRGBManager::ColorMatrix matrix = (image->cs == VPX_CS_BT_709) ?
+		Graphics::YUVToRGBManager::kMatrixBT709 : Graphics::YUVToRGBManager::kMatrixBT601;
+
 	// Do the conversion based on the color space
 	switch (image->fmt) {
 	case VPX_IMG_FMT_I420:
-		YUVToRGBMan.convert420(scale, surface.getData(), surface.getPitch(), image->planes[0], image->planes[1], image->planes[2], std::min<int64_t>(surface.getWidth(), image->d_w), std::min<int64_t>(surface.getHeight(), image->d_h), image->stride[0], image->stride[1]);
+		frame.set420(scale, image->planes[0], image->planes[1], image->planes[2], 0, image->d_w, image->d_h, image->stride[0], image->stride[1], matrix);
 		break;
 	default:
 		return;
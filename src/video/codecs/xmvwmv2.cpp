@@ -50,6 +50,15 @@
 #include <cassert>
 #include <cstring>
 
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+	#if defined(__SSE4_1__)
+		#include <smmintrin.h>
+	#endif
+#elif defined(__ARM_NEON)
+	#include <arm_neon.h>
+#endif
+
 #include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/readstream.h"
@@ -58,7 +67,7 @@
 
 #include "src/graphics/yuv_to_rgb.h"
 
-#include "src/graphics/images/surface.h"
+#include "src/video/yuvframe.h"
 
 #include "src/video/codecs/wmv2data.h"
 #include "src/video/codecs/xmvwmv2.h"
@@ -306,11 +315,11 @@ void XMVWMV2Codec::init() {
 	}
 }
 
-void XMVWMV2Codec::decodeFrame(Graphics::Surface &surface,
+void XMVWMV2Codec::decodeFrame(YUVFrame &frame,
                                Common::SeekableReadStream &dataStream) {
 
-	Common::BitStream32LEMSB bits(dataStream);
-	DecodeContext            ctx(bits);
+	Common::MemoryBitStream32LEMSB bits(dataStream);
+	DecodeContext                  ctx(bits);
 
 	initDecodeContext(ctx);
 
@@ -339,10 +348,9 @@ void XMVWMV2Codec::decodeFrame(Graphics::Surface &surface,
 	else
 		decodePFrame(ctx);
 
-	// Convert the YUV data we have to BGRA
-	YUVToRGBMan.convert420(Graphics::YUVToRGBManager::kScaleITU,
-			surface.getData(), surface.getWidth() * 4,
-			_curPlanes[0].get(), _curPlanes[1].get(), _curPlanes[2].get(),
+	// Hand out the YUV data we have
+	frame.set420(Graphics::YUVToRGBManager::kScaleITU,
+			_curPlanes[0].get(), _curPlanes[1].get(), _curPlanes[2].get(), 0,
 			_lumaWidth, _lumaHeight, _lumaWidth, _chromaWidth);
 
 	// And swap the planes with the reference planes
@@ -724,12 +732,20 @@ void XMVWMV2Codec::decodeIBlock(DecodeContext &ctx, BlockContext &block) {
 	IDCTPut(block.curPlane, acReconCoeffs, block.planePitch);
 }
 
+#if defined(__SSE2__) || defined(__ARM_NEON)
+static void IDCTPutSIMD(byte *dest, const int32_t *block, uint32_t pitch);
+#endif
+
 void XMVWMV2Codec::IDCTPut(byte *dest, int32_t *block, uint32_t pitch) {
+#if defined(__SSE2__) || defined(__ARM_NEON)
+	IDCTPutSIMD(dest, block, pitch);
+#else
 	IDCT(block);
 
 	for (uint32_t i = 0; i < 8; i++, dest += pitch, block += 8)
 		for (uint32_t j = 0; j < 8; j++)
 			dest[j] = CLIP(block[j], 0, 255);
+#endif
 }
 
 void XMVWMV2Codec::IDCT(int32_t *block) {
@@ -802,6 +818,189 @@ void XMVWMV2Codec::IDCTCol(int32_t *b) {
 	b[8 * 7] = (a0 + a2 - a1 - a5 + (1 << 13)) >> 14;
 }
 
+#if defined(__SSE2__) || defined(__ARM_NEON)
+
+/* Vectorized IDCT, four rows or columns at a time.
+ *
+ * This does exactly the same integer operations as IDCTRow() and IDCTCol()
+ * in 32-bit lanes, so the output is bit-identical to the scalar version,
+ * which is still used on other architectures.
+ */
+
+#if defined(__SSE2__)
+
+typedef __m128i IDCTVec;
+
+static inline IDCTVec idctSet(int32_t x) { return _mm_set1_epi32(x); }
+static inline IDCTVec idctAdd(IDCTVec a, IDCTVec b) { return _mm_add_epi32(a, b); }
+static inline IDCTVec idctSub(IDCTVec a, IDCTVec b) { return _mm_sub_epi32(a, b); }
+
+static inline IDCTVec idctMul(IDCTVec a, int32_t c) {
+#if defined(__SSE4_1__)
+	return _mm_mullo_epi32(a, _mm_set1_epi32(c));
+#else
+	// SSE2 has no 32-bit multiply with a 32-bit result. Multiply the even
+	// and odd lanes separately; the low halves are the same for signed values.
+	const __m128i k    = _mm_set1_epi32(c);
+	const __m128i even = _mm_mul_epu32(a, k);
+	const __m128i odd  = _mm_mul_epu32(_mm_srli_epi64(a, 32), k);
+
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+	                          _mm_shuffle_epi32(odd , _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+}
+
+#define idctShl(a, n) _mm_slli_epi32(a, n)
+#define idctSar(a, n) _mm_srai_epi32(a, n)
+
+static inline IDCTVec idctLoad(const int32_t *p) { return _mm_loadu_si128((const __m128i *) p); }
+
+static inline void idctTranspose(IDCTVec &a, IDCTVec &b, IDCTVec &c, IDCTVec &d) {
+	const __m128i t0 = _mm_unpacklo_epi32(a, b);
+	const __m128i t1 = _mm_unpacklo_epi32(c, d);
+	const __m128i t2 = _mm_unpackhi_epi32(a, b);
+	const __m128i t3 = _mm_unpackhi_epi32(c, d);
+
+	a = _mm_unpacklo_epi64(t0, t1);
+	b = _mm_unpackhi_epi64(t0, t1);
+	c = _mm_unpacklo_epi64(t2, t3);
+	d = _mm_unpackhi_epi64(t2, t3);
+}
+
+/** Clip 8 values to 0..255 and write them out. */
+static inline void idctPutRow(byte *dest, IDCTVec lo, IDCTVec hi) {
+	const __m128i w = _mm_packs_epi32(lo, hi);
+
+	_mm_storel_epi64((__m128i *) dest, _mm_packus_epi16(w, w));
+}
+
+#elif defined(__ARM_NEON)
+
+typedef int32x4_t IDCTVec;
+
+static inline IDCTVec idctSet(int32_t x) { return vdupq_n_s32(x); }
+static inline IDCTVec idctAdd(IDCTVec a, IDCTVec b) { return vaddq_s32(a, b); }
+static inline IDCTVec idctSub(IDCTVec a, IDCTVec b) { return vsubq_s32(a, b); }
+static inline IDCTVec idctMul(IDCTVec a, int32_t c) { return vmulq_n_s32(a, c); }
+
+#define idctShl(a, n) vshlq_n_s32(a, n)
+#define idctSar(a, n) vshrq_n_s32(a, n)
+
+static inline IDCTVec idctLoad(const int32_t *p) { return vld1q_s32(p); }
+
+static inline void idctTranspose(IDCTVec &a, IDCTVec &b, IDCTVec &c, IDCTVec &d) {
+	const int32x4x2_t t0 = vtrnq_s32(a, b);
+	const int32x4x2_t t1 = vtrnq_s32(c, d);
+
+	a = vcombine_s32(vget_low_s32 (t0.val[0]), vget_low_s32 (t1.val[0]));
+	b = vcombine_s32(vget_low_s32 (t0.val[1]), vget_low_s32 (t1.val[1]));
+	c = vcombine_s32(vget_high_s32(t0.val[0]), vget_high_s32(t1.val[0]));
+	d = vcombine_s32(vget_high_s32(t0.val[1]), vget_high_s32(t1.val[1]));
+}
+
+/** Clip 8 values to 0..255 and write them out. */
+static inline void idctPutRow(byte *dest, IDCTVec lo, IDCTVec hi) {
+	vst1_u8(dest, vqmovun_s16(vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi))));
+}
+
+#endif
+
+/** Run IDCTRow() (row == true) or IDCTCol() (row == false) over four lanes. */
+template<bool row>
+static inline void IDCT8SIMD(IDCTVec *v) {
+	// Step 1
+	IDCTVec a1 = idctAdd(idctMul(v[1], W1), idctMul(v[7], W7));
+	IDCTVec a7 = idctSub(idctMul(v[1], W7), idctMul(v[7], W1));
+	IDCTVec a5 = idctAdd(idctMul(v[5], W5), idctMul(v[3], W3));
+	IDCTVec a3 = idctSub(idctMul(v[5], W3), idctMul(v[3], W5));
+	IDCTVec a2 = idctAdd(idctMul(v[2], W2), idctMul(v[6], W6));
+	IDCTVec a6 = idctSub(idctMul(v[2], W6), idctMul(v[6], W2));
+	IDCTVec a0 = idctShl(idctAdd(v[0], v[4]), 11); // W0 == 1 << 11
+	IDCTVec a4 = idctShl(idctSub(v[0], v[4]), 11);
+
+	if (!row) {
+		// Extended precision for the columns
+		const IDCTVec r = idctSet(4);
+
+		a1 = idctSar(idctAdd(a1, r), 3);
+		a7 = idctSar(idctAdd(a7, r), 3);
+		a5 = idctSar(idctAdd(a5, r), 3);
+		a3 = idctSar(idctAdd(a3, r), 3);
+		a2 = idctSar(idctAdd(a2, r), 3);
+		a6 = idctSar(idctAdd(a6, r), 3);
+		a0 = idctSar(a0, 3);
+		a4 = idctSar(a4, 3);
+	}
+
+	// Step 2
+	const IDCTVec c128 = idctSet(128);
+
+	const IDCTVec s1 = idctSar(idctAdd(idctMul(idctSub(idctAdd(idctSub(a1, a5), a7), a3), 181), c128), 8);
+	const IDCTVec s2 = idctSar(idctAdd(idctMul(idctAdd(idctSub(idctSub(a1, a5), a7), a3), 181), c128), 8);
+
+	// Step 3
+	const IDCTVec rnd = idctSet(row ? (1 << 7) : (1 << 13));
+
+	const IDCTVec p02 = idctAdd(idctAdd(a0, a2), rnd);
+	const IDCTVec m02 = idctAdd(idctSub(a0, a2), rnd);
+	const IDCTVec p46 = idctAdd(idctAdd(a4, a6), rnd);
+	const IDCTVec m46 = idctAdd(idctSub(a4, a6), rnd);
+	const IDCTVec a15 = idctAdd(a1, a5);
+	const IDCTVec a73 = idctAdd(a7, a3);
+
+	v[0] = row ? idctSar(idctAdd(p02, a15), 8) : idctSar(idctAdd(p02, a15), 14);
+	v[1] = row ? idctSar(idctAdd(p46, s1 ), 8) : idctSar(idctAdd(p46, s1 ), 14);
+	v[2] = row ? idctSar(idctAdd(m46, s2 ), 8) : idctSar(idctAdd(m46, s2 ), 14);
+	v[3] = row ? idctSar(idctAdd(m02, a73), 8) : idctSar(idctAdd(m02, a73), 14);
+	v[4] = row ? idctSar(idctSub(m02, a73), 8) : idctSar(idctSub(m02, a73), 14);
+	v[5] = row ? idctSar(idctSub(m46, s2 ), 8) : idctSar(idctSub(m46, s2 ), 14);
+	v[6] = row ? idctSar(idctSub(p46, s1 ), 8) : idctSar(idctSub(p46, s1 ), 14);
+	v[7] = row ? idctSar(idctSub(p02, a15), 8) : idctSar(idctSub(p02, a15), 14);
+}
+
+static void IDCTPutSIMD(byte *dest, const int32_t *block, uint32_t pitch) {
+	/* Load the block transposed, in two halves of four rows each:
+	 * rows[g][i] holds column i of rows 4g to 4g+3. */
+	IDCTVec rows[2][8];
+	for (int g = 0; g < 2; g++) {
+		for (int h = 0; h < 2; h++) {
+			IDCTVec *v = rows[g] + 4 * h;
+
+			for (int i = 0; i < 4; i++)
+				v[i] = idctLoad(block + (4 * g + i) * 8 + 4 * h);
+
+			idctTranspose(v[0], v[1], v[2], v[3]);
+		}
+	}
+
+	IDCT8SIMD<true>(rows[0]);
+	IDCT8SIMD<true>(rows[1]);
+
+	// Transpose back: cols[h][i] holds row i of columns 4h to 4h+3
+	IDCTVec cols[2][8];
+	for (int g = 0; g < 2; g++) {
+		for (int h = 0; h < 2; h++) {
+			IDCTVec *v = cols[h] + 4 * g;
+
+			for (int i = 0; i < 4; i++)
+				v[i] = rows[g][4 * h + i];
+
+			idctTranspose(v[0], v[1], v[2], v[3]);
+		}
+	}
+
+	IDCT8SIMD<false>(cols[0]);
+	IDCT8SIMD<false>(cols[1]);
+
+	for (int i = 0; i < 8; i++, dest += pitch)
+		idctPutRow(dest, cols[0][i], cols[1][i]);
+}
+
+#undef idctShl
+#undef idctSar
+
+#endif // defined(__SSE2__) || defined(__ARM_NEON)
+
 uint8_t XMVWMV2Codec::getTrit(Common::BitStream &bits) {
 	// 0 -> 0;  10 -> 1;  11 -> 2
 
@@ -71,7 +71,7 @@ public:
 	XMVWMV2Codec(uint32_t width, uint32_t height, Common::SeekableReadStream &extraData);
 	~XMVWMV2Codec();
 
-	void decodeFrame(Graphics::Surface &surface, Common::SeekableReadStream &dataStream);
+	void decodeFrame(YUVFrame &frame, Common::SeekableReadStream &dataStream);
 
 private:
 	static const uint32_t kMacroBlockSize = 16; ///< Size of a macro block.
@@ -30,6 +30,7 @@
 #include "src/common/memreadstream.h"
 #include "src/common/threads.h"
 #include "src/common/debug.h"
+#include "src/common/configman.h"
 
 #include "src/events/events.h"
 
@@ -37,6 +38,10 @@
 
 #include "src/graphics/images/surface.h"
 
+#include "src/graphics/shader/shader.h"
+
+#include "src/graphics/aurora/textureman.h"
+
 #include "src/video/decoder.h"
 
 #include "src/sound/sound.h"
@@ -45,20 +50,76 @@
 
 namespace Video {
 
+/** A frame shown later than this (in milliseconds) after its time is late. */
+static const uint32_t kLateFrameThreshold = 20;
+/** The most frames we drop in a row, so that the picture doesn't freeze. */
+static const uint32_t kMaxDroppedFrames = 8;
+
+static const char * const kPlaneVertexShader =
+	"#version 150\n"
+	"\n"
+	"in vec3 inputPosition0;\n"
+	"in vec2 inputUV0;\n"
+	"\n"
+	"out vec2 uv0;\n"
+	"\n"
+	"void main(void) {\n"
+	"\tgl_Position = vec4(inputPosition0, 1.0);\n"
+	"\tuv0 = inputUV0;\n"
+	"}\n";
+
+static const char * const kPlaneFragmentShader =
+	"#version 150\n"
+	"\n"
+	"uniform sampler2D planeY;\n"
+	"uniform sampler2D planeU;\n"
+	"uniform sampler2D planeV;\n"
+	"uniform sampler2D planeA;\n"
+	"\n"
+	"uniform mat3 yuvMatrix;\n"
+	"uniform vec3 yuvOffset;\n"
+	"\n"
+	"in vec2 uv0;\n"
+	"\n"
+	"out vec4 outColor;\n"
+	"\n"
+	"void main(void) {\n"
+	"\tvec3 yuv = vec3(texture(planeY, uv0).r, texture(planeU, uv0).r, texture(planeV, uv0).r);\n"
+	"\n"
+	"\toutColor = vec4(clamp(yuvMatrix * (yuv - yuvOffset), 0.0, 1.0), texture(planeA, uv0).r);\n"
+	"}\n";
+
+/** The sampler uniforms of the planes, in the order of YUVFrame::Plane. */
+static const char * const kPlaneSamplers[YUVFrame::kPlaneMAX] = {
+	"planeY", "planeU", "planeV", "planeA"
+};
+
 VideoDecoder::VideoDecoder() : Renderable(Graphics::kRenderableTypeVideo),
 	_needCopy(false),
-	_texture(0),
+	_texture(0), _yuvProgram(0),
 	_textureWidth(0.0f), _textureHeight(0.0f), _scale(kScaleNone),
-	_startTime(0), _pauseLevel(0), _pauseStartTime(0) {
+	_startTime(0), _pauseLevel(0), _pauseStartTime(0), _decodeAheadTime(0), _droppedInRow(0) {
+
+	for (size_t i = 0; i < YUVFrame::kPlaneMAX; i++)
+		_planeTextures[i] = 0;
 
+	Graphics::YUVToRGBManager::getMatrix(Graphics::YUVToRGBManager::kScaleITU,
+	                                     Graphics::YUVToRGBManager::kMatrixBT601, _yuvMatrix, _yuvOffset);
 }
 
 VideoDecoder::~VideoDecoder() {
 	deinit();
 
+	if (_frameStats.shown > 0)
+		debugC(Common::kDebugVideo, 1, "Video frames: %u shown, %u late, %u dropped, %u skipped",
+		       _frameStats.shown, _frameStats.late, _frameStats.dropped, _frameStats.skipped);
+
 	if (_texture != 0)
 		GfxMan.abandon(&_texture, 1);
 
+	if (_planeTextures[0] != 0)
+		GfxMan.abandon(_planeTextures, YUVFrame::kPlaneMAX);
+
 	stopAudio();
 }
 
@@ -66,12 +127,29 @@ void VideoDecoder::deinit() {
 	hide();
 
 	GLContainer::removeFromQueue(Graphics::kQueueGLContainer);
+
+	if (_decodeAhead.valid())
+		_decodeAhead.wait();
 }
 
-void VideoDecoder::initVideo() {
+void VideoDecoder::initVideo(bool yuv) {
 	uint32_t width = getWidth();
 	uint32_t height = getHeight();
 
+	/* With the shader renderer, YUV images don't need to be converted on
+	 * the CPU at all. We upload the planes as they are, which is also
+	 * less than half the data of a BGRA image, and convert in a shader. */
+	if (yuv && GfxMan.isGL3()) {
+		_surface.reset();
+		_frame = std::make_unique<YUVFrame>(width, height);
+
+		_textureWidth  = 1.0f;
+		_textureHeight = 1.0f;
+
+		rebuild();
+		return;
+	}
+
 	// The real texture dimensions. Have to be a power of 2
 	int realWidth  = NEXTPOWER2(width);
 	int realHeight = NEXTPOWER2(height);
@@ -84,6 +162,11 @@ void VideoDecoder::initVideo() {
 
 	_surface->fill(0, 0, 0, 0);
 
+	if (yuv)
+		_frame = std::make_unique<YUVFrame>(*_surface);
+	else
+		_frame.reset();
+
 	rebuild();
 }
 
@@ -104,6 +187,10 @@ uint32_t VideoDecoder::getHeight() const {
 }
 
 bool VideoDecoder::endOfVideo() const {
+	// We only decode ahead while there's a video frame left
+	if (_decodeAhead.valid())
+		return false;
+
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		if (!(*it)->endOfTrack())
 			return false;
@@ -112,6 +199,9 @@ bool VideoDecoder::endOfVideo() const {
 }
 
 bool VideoDecoder::endOfVideoTracks() const {
+	if (_decodeAhead.valid())
+		return false;
+
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		if ((*it)->getTrackType() == Track::kTrackTypeVideo && !(*it)->endOfTrack())
 			return false;
@@ -136,6 +226,10 @@ void VideoDecoder::pauseVideo(bool pause) {
 		return;
 	}
 
+	// The tracks belong to the decode ahead while it's running
+	if (_decodeAhead.valid())
+		_decodeAhead.wait();
+
 	if (_pauseLevel == 1 && pause) {
 		_pauseStartTime = EventMan.getTimestamp(); // Store the starting time from pausing to keep it for later
 
@@ -241,6 +335,12 @@ bool VideoDecoder::hasAudio() const {
 }
 
 void VideoDecoder::doRebuild() {
+	if (_frame && _frame->isPlanar()) {
+		buildPlanes();
+		TextureMan.invalidateState();
+		return;
+	}
+
 	if (!_surface)
 		return;
 
@@ -259,9 +359,20 @@ void VideoDecoder::doRebuild() {
 
 	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, _surface->getWidth(), _surface->getHeight(),
 	             0, GL_BGRA, GL_UNSIGNED_BYTE, _surface->getData());
+
+	TextureMan.invalidateState();
 }
 
 void VideoDecoder::doDestroy() {
+	if (_planeTextures[0] != 0) {
+		glDeleteTextures(YUVFrame::kPlaneMAX, _planeTextures);
+
+		for (size_t i = 0; i < YUVFrame::kPlaneMAX; i++)
+			_planeTextures[i] = 0;
+	}
+
+	TextureMan.invalidateState();
+
 	if (_texture == 0)
 		return;
 
@@ -270,10 +381,112 @@ void VideoDecoder::doDestroy() {
 	_texture = 0;
 }
 
+void VideoDecoder::buildPlanes() {
+	glGenTextures(YUVFrame::kPlaneMAX, _planeTextures);
+
+	// The planes are rarely a multiple of 4 wide
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	for (size_t i = 0; i < YUVFrame::kPlaneMAX; i++) {
+		const YUVFrame::Plane plane = (YUVFrame::Plane) i;
+
+		glBindTexture(GL_TEXTURE_2D, _planeTextures[i]);
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+
+		// Allocate the storage once, every frame then only overwrites it
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, _frame->getWidth(plane), _frame->getHeight(plane),
+		             0, GL_RED, GL_UNSIGNED_BYTE, _frame->getPlane(plane));
+	}
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+	if (!_yuvProgram) {
+		Graphics::Shader::ShaderObject *vertexObject =
+			ShaderMan.getShaderObject("video/planes.vert", kPlaneVertexShader, Graphics::Shader::SHADER_VERTEX);
+		Graphics::Shader::ShaderObject *fragmentObject =
+			ShaderMan.getShaderObject("video/planes.frag", kPlaneFragmentShader, Graphics::Shader::SHADER_FRAGMENT);
+
+		_yuvProgram = ShaderMan.registerShaderProgram(vertexObject, fragmentObject);
+	}
+
+	if (_yuvProgram)
+		ShaderMan.genGLProgram(_yuvProgram);
+}
+
+void VideoDecoder::copyPlanes() {
+	if (_planeTextures[0] == 0)
+		throw Common::Exception("No textures while trying to copy");
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	// Without an alpha plane, the alpha texture keeps its initial opaque values
+	const size_t planeCount = _frame->hasAlpha() ? YUVFrame::kPlaneMAX : YUVFrame::kPlaneA;
+
+	for (size_t i = 0; i < planeCount; i++) {
+		const YUVFrame::Plane plane = (YUVFrame::Plane) i;
+
+		glBindTexture(GL_TEXTURE_2D, _planeTextures[i]);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, _frame->getWidth(plane), _frame->getHeight(plane),
+		                GL_RED, GL_UNSIGNED_BYTE, _frame->getPlane(plane));
+	}
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+	// Only look at the frame here, the next one might already be decoded into it when rendering
+	Graphics::YUVToRGBManager::getMatrix(_frame->getScale(), _frame->getMatrix(), _yuvMatrix, _yuvOffset);
+}
+
+void VideoDecoder::renderPlanes(float hWidth, float hHeight) {
+	if (!_yuvProgram || (_yuvProgram->glid == 0))
+		return;
+
+	glUseProgram(_yuvProgram->glid);
+
+	for (size_t i = 0; i < YUVFrame::kPlaneMAX; i++) {
+		glActiveTexture(GL_TEXTURE0 + i);
+		glBindTexture(GL_TEXTURE_2D, _planeTextures[i]);
+
+		glUniform1i(glGetUniformLocation(_yuvProgram->glid, kPlaneSamplers[i]), i);
+	}
+
+	glUniformMatrix3fv(glGetUniformLocation(_yuvProgram->glid, "yuvMatrix"), 1, GL_FALSE, _yuvMatrix);
+	glUniform3fv(glGetUniformLocation(_yuvProgram->glid, "yuvOffset"), 1, _yuvOffset);
+
+	// The shader takes normalized device coordinates
+	const float x = (2.0f * hWidth ) / WindowMan.getWindowWidth();
+	const float y = (2.0f * hHeight) / WindowMan.getWindowHeight();
+
+	// The planes are stored top to bottom
+	glBegin(GL_QUADS);
+		glVertexAttrib2f(Graphics::Shader::VERTEX_TEXCOORD0, 0.0f, 1.0f);
+		glVertexAttrib3f(Graphics::Shader::VERTEX_LOCATION , -x, -y, 0.0f);
+		glVertexAttrib2f(Graphics::Shader::VERTEX_TEXCOORD0, 1.0f, 1.0f);
+		glVertexAttrib3f(Graphics::Shader::VERTEX_LOCATION ,  x, -y, 0.0f);
+		glVertexAttrib2f(Graphics::Shader::VERTEX_TEXCOORD0, 1.0f, 0.0f);
+		glVertexAttrib3f(Graphics::Shader::VERTEX_LOCATION ,  x,  y, 0.0f);
+		glVertexAttrib2f(Graphics::Shader::VERTEX_TEXCOORD0, 0.0f, 0.0f);
+		glVertexAttrib3f(Graphics::Shader::VERTEX_LOCATION , -x,  y, 0.0f);
+	glEnd();
+
+	glActiveTexture(GL_TEXTURE0);
+	glUseProgram(0);
+}
+
 void VideoDecoder::copyData() {
 	if (!_needCopy)
 		return;
 
+	if (_frame && _frame->isPlanar()) {
+		copyPlanes();
+
+		_needCopy = false;
+		return;
+	}
+
 	if (!_surface)
 		throw Common::Exception("No video data while trying to copy");
 	if (_texture == 0)
@@ -290,10 +503,25 @@ void VideoDecoder::setScale(Scale scale) {
 	_scale = scale;
 }
 
+void VideoDecoder::setCatchUpPolicy(const CatchUpPolicy &policy) {
+	_catchUp = policy;
+}
+
+const VideoDecoder::CatchUpPolicy &VideoDecoder::getCatchUpPolicy() const {
+	return _catchUp;
+}
+
+const VideoDecoder::FrameStats &VideoDecoder::getFrameStats() const {
+	return _frameStats;
+}
+
 bool VideoDecoder::isPlaying() const {
 	if (_startTime == 0)
 		return false;
 
+	if (_decodeAhead.valid())
+		return true;
+
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		if (!(*it)->endOfTrack())
 			return true;
@@ -302,17 +530,94 @@ bool VideoDecoder::isPlaying() const {
 }
 
 void VideoDecoder::update() {
-	if (!needsUpdate() || !_nextVideoTrack)
+	uint32_t frameTime = 0;
+	bool decoded = false;
+
+	if (_decodeAhead.valid()) {
+		// The next frame is already being decoded. Wait for it, once it's due
+		if (getTimeToNextFrame() > 0)
+			return;
+
+		debugC(Common::kDebugVideo, 9, "New video frame");
+
+		frameTime = _decodeAheadTime;
+
+		// Rethrows anything that went wrong while decoding
+		std::future<bool> decodeAhead = std::move(_decodeAhead);
+		decoded = decodeAhead.get();
+
+	} else {
+		if (!needsUpdate() || !_nextVideoTrack)
+			return;
+
+		debugC(Common::kDebugVideo, 9, "New video frame");
+
+		frameTime = _nextVideoTrack->getNextFrameStartTime().msecs();
+		decoded   = decodeFrame(false);
+	}
+
+	if (decoded)
+		showFrame(frameTime);
+	else
+		_frameStats.skipped++;
+
+	/* Now that the frame is in the texture, start decoding the next one
+	 * into the same frame. The render thread then only has to show it. */
+	if (!_nextVideoTrack || endOfVideoTracks())
 		return;
 
-	debugC(Common::kDebugVideo, 9, "New video frame");
+	_decodeAheadTime = _nextVideoTrack->getNextFrameStartTime().msecs();
+
+	// If that one is already late, don't even decode it, if we can help it
+	const bool skip = _catchUp.skipFrames && (getTime() > _decodeAheadTime + kLateFrameThreshold);
+
+	_decodeAhead = std::async(std::launch::async, [this, skip]() {
+		return decodeFrame(skip);
+	});
+}
+
+void VideoDecoder::showFrame(uint32_t frameTime) {
+	const uint32_t time = getTime();
+
+	if (time > frameTime + kLateFrameThreshold) {
+		_frameStats.late++;
+
+		/* We're more than a whole frame behind. Instead of spending time on
+		 * showing this one, get on with the next one, as long as there is one. */
+		const bool nextDue = _nextVideoTrack && !endOfVideoTracks() &&
+		                     (_nextVideoTrack->getNextFrameStartTime().msecs() <= time);
 
-	// Actually decode the frame for the track
-	decodeNextTrackFrame(*_nextVideoTrack);
+		if (_catchUp.dropLate && nextDue && (_droppedInRow < kMaxDroppedFrames)) {
+			debugC(Common::kDebugVideo, 5, "Dropping video frame at %u ms, %u ms late", frameTime, time - frameTime);
+
+			_frameStats.dropped++;
+			_droppedInRow++;
+
+			Common::DebugManager::addMetric(Common::kMetricVideoFramesDropped);
+			return;
+		}
+
+		debugC(Common::kDebugVideo, 5, "Video frame at %u ms is %u ms late", frameTime, time - frameTime);
+	}
 
 	// Copy the data to the screen
 	copyData();
 
+	_frameStats.shown++;
+	_droppedInRow = 0;
+}
+
+bool VideoDecoder::decodeFrame(bool skip) {
+	bool decoded = true;
+
+	// Actually decode the frame for the track, unless we can and want to skip it
+	if (skip && skipNextTrackFrame(*_nextVideoTrack)) {
+		debugC(Common::kDebugVideo, 5, "Skipped decoding a late video frame");
+
+		decoded = false;
+	} else
+		decodeNextTrackFrame(*_nextVideoTrack);
+
 	// Look for the next video track here for the next decode.
 	findNextVideoTrack();
 
@@ -327,6 +632,8 @@ void VideoDecoder::update() {
 	for (TrackList::iterator it = _internalTracks.begin(); it != _internalTracks.end(); it++)
 		if ((*it)->getTrackType() == Track::kTrackTypeAudio && boost::static_pointer_cast<AudioTrack>(*it)->canBufferData())
 			checkAudioBuffer(static_cast<AudioTrack&>(**it), audioNeeded);
+
+	return decoded;
 }
 
 void VideoDecoder::getQuadDimensions(float &width, float &height) const {
@@ -366,7 +673,9 @@ void VideoDecoder::render(Graphics::RenderPass pass) {
 	if (pass == Graphics::kRenderPassTransparent)
 		return;
 
-	if (!isPlaying() || _texture == 0)
+	const bool planar = _frame && _frame->isPlanar();
+
+	if (!isPlaying() || (!planar && (_texture == 0)))
 		return;
 
 	// Process and copy the next frame data, if necessary
@@ -381,6 +690,12 @@ void VideoDecoder::render(Graphics::RenderPass pass) {
 	float hWidth  = width  / 2.0f;
 	float hHeight = height / 2.0f;
 
+	if (planar) {
+		renderPlanes(hWidth, hHeight);
+		TextureMan.invalidateState();
+		return;
+	}
+
 	glBindTexture(GL_TEXTURE_2D, _texture);
 	glBegin(GL_QUADS);
 		glTexCoord2f(0.0f, 0.0f);
@@ -392,6 +707,8 @@ void VideoDecoder::render(Graphics::RenderPass pass) {
 		glTexCoord2f(0.0f, _textureHeight);
 		glVertex3f(-hWidth,  hHeight, -1.0f);
 	glEnd();
+
+	TextureMan.invalidateState();
 }
 
 void VideoDecoder::start() {
@@ -415,17 +732,33 @@ uint32_t VideoDecoder::getTime() const {
 	if (isPaused())
 		return _pauseStartTime - _startTime;
 
-	// TODO: Use the sound time if possible
+	/* Follow the audio while it's playing. If we fall behind, the frames
+	 * become late and we catch up, instead of drifting away from it. */
+	if (_catchUp.syncAudio) {
+		for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++) {
+			if ((*it)->getTrackType() != Track::kTrackTypeAudio)
+				continue;
+
+			const uint32_t audioTime = boost::static_pointer_cast<const AudioTrack>(*it)->getRunningTime();
+			if (audioTime > 0)
+				return audioTime;
+		}
+	}
 
 	return EventMan.getTimestamp() - _startTime;
 }
 
 uint32_t VideoDecoder::getTimeToNextFrame() const {
-	if (!_nextVideoTrack || endOfVideo())
-		return 0;
+	uint32_t nextFrameStartTime = _decodeAheadTime;
+
+	if (!_decodeAhead.valid()) {
+		if (!_nextVideoTrack || endOfVideo())
+			return 0;
+
+		nextFrameStartTime = _nextVideoTrack->getNextFrameStartTime().msecs();
+	}
 
 	uint32_t currentTime = getTime();
-	uint32_t nextFrameStartTime = _nextVideoTrack->getNextFrameStartTime().msecs();
 
 	if (nextFrameStartTime <= currentTime)
 		return 0;
@@ -436,6 +769,10 @@ uint32_t VideoDecoder::getTimeToNextFrame() const {
 void VideoDecoder::checkAudioBuffer(AudioTrack &UNUSED(track), const Common::Timestamp &UNUSED(endTime)) {
 }
 
+bool VideoDecoder::skipNextTrackFrame(VideoTrack &UNUSED(track)) {
+	return false;
+}
+
 Common::Timestamp VideoDecoder::getDuration() const {
 	// New API only
 	Common::Timestamp maxDuration(0, 1000);
@@ -450,6 +787,15 @@ Common::Timestamp VideoDecoder::getDuration() const {
 	return maxDuration;
 }
 
+VideoDecoder::CatchUpPolicy::CatchUpPolicy() :
+	skipFrames(ConfigMan.getBool("videoskipframes", true)),
+	dropLate  (ConfigMan.getBool("videodroplate"  , true)),
+	syncAudio (ConfigMan.getBool("videoaudiosync" , true)) {
+}
+
+VideoDecoder::FrameStats::FrameStats() : shown(0), late(0), dropped(0), skipped(0) {
+}
+
 VideoDecoder::Track::Track() {
 	_paused = false;
 }
@@ -27,6 +27,7 @@
 
 #include <vector>
 #include <memory>
+#include <future>
 
 #include <boost/shared_ptr.hpp>
 
@@ -40,8 +41,14 @@
 
 #include "src/sound/types.h"
 
+#include "src/video/yuvframe.h"
+
 namespace Graphics {
 	class Surface;
+
+	namespace Shader {
+		class ShaderProgram;
+	}
 }
 
 namespace Sound {
@@ -61,11 +68,41 @@ public:
 		kScaleUpDown ///< Scale the video up and down, if necessary.
 	};
 
+	/** How to catch up when decoding falls behind the video's timing. */
+	struct CatchUpPolicy {
+		bool skipFrames; ///< Don't decode late frames no other frame depends on.
+		bool dropLate;   ///< Don't show frames that are late, when the next one is due already.
+		bool syncAudio;  ///< Time the video by its audio, if it has any playing.
+
+		CatchUpPolicy();
+	};
+
+	/** How well the playback kept up with the video. */
+	struct FrameStats {
+		uint32_t shown;   ///< Frames decoded and shown.
+		uint32_t late;    ///< Frames that weren't ready on time.
+		uint32_t dropped; ///< Frames decoded, but never shown because they were late.
+		uint32_t skipped; ///< Frames not decoded at all because they were late.
+
+		FrameStats();
+	};
+
 	VideoDecoder();
 	~VideoDecoder();
 
 	void setScale(Scale scale);
 
+	/** Set how to catch up when decoding falls behind.
+	 *
+	 *  By default, this is taken from the "videoskipframes", "videodroplate"
+	 *  and "videoaudiosync" config options.
+	 */
+	void setCatchUpPolicy(const CatchUpPolicy &policy);
+	const CatchUpPolicy &getCatchUpPolicy() const;
+
+	/** Return how well the playback kept up so far. */
+	const FrameStats &getFrameStats() const;
+
 	/** Is the video currently playing? */
 	bool isPlaying() const;
 
@@ -392,6 +429,13 @@ protected:
 
 	std::unique_ptr<Graphics::Surface> _surface; ///< The video's surface.
 
+	/** The frame YUV decoders put their images into.
+	 *
+	 *  With the shader renderer, it keeps the YUV planes, which are then
+	 *  converted on the GPU. Otherwise, it converts straight into _surface.
+	 */
+	std::unique_ptr<YUVFrame> _frame;
+
 	/**
 	 * Create a surface for video of these dimensions.
 	 *
@@ -401,9 +445,16 @@ protected:
 	 * The surface's width and height is taken from getWidth() and getHeight().
 	 *
 	 * The surface's pixel format is always BGRA8888.
+	 *
+	 * @param yuv Does the decoder put its images into _frame instead of _surface?
 	 */
-	void initVideo();
+	void initVideo(bool yuv = false);
 
+	/** Stop rendering the video and wait for a frame still being decoded.
+	 *
+	 *  Decoders need to call this in their destructor, before any of the
+	 *  state their decodeNextTrackFrame() uses goes away.
+	 */
 	void deinit();
 
 	// GLContainer
@@ -415,12 +466,31 @@ protected:
 	 *
 	 * Currently, audio may be buffered here at the same time. This is deprecated
 	 * in favor of using checkAudioBuffer().
+	 *
+	 * After the first frame, this is called on a separate thread, while the
+	 * previous frame is shown. It's never called concurrently with itself or
+	 * with checkAudioBuffer(), and _frame and _surface aren't used by anybody
+	 * else in the meantime.
 	 */
 	virtual void decodeNextTrackFrame(VideoTrack &track) = 0;
 
+	/**
+	 * Skip the next frame of the track without decoding it, because it's late.
+	 *
+	 * Only frames no other frame depends on may be skipped. Like
+	 * decodeNextTrackFrame(), this is called on the decoding thread.
+	 *
+	 * The default implementation skips nothing.
+	 *
+	 * @return true if the frame was skipped, false if it needs to be decoded.
+	 */
+	virtual bool skipNextTrackFrame(VideoTrack &track);
+
 	/**
 	 * Ensure that there is enough audio buffered in the given track
 	 * to reach the given timestamp.
+	 *
+	 * Like decodeNextTrackFrame(), this is called on the decoding thread.
 	 */
 	virtual void checkAudioBuffer(AudioTrack &track, const Common::Timestamp &endTime);
 
@@ -478,6 +548,13 @@ private:
 
 	Graphics::TextureID _texture;
 
+	/** Textures holding the planes of a planar _frame. */
+	Graphics::TextureID _planeTextures[YUVFrame::kPlaneMAX];
+	/** The shader converting the planes to RGB. */
+	Graphics::Shader::ShaderProgram *_yuvProgram;
+	/** The shader's YUV to RGB matrix and offset, for the planes in the textures. */
+	float _yuvMatrix[9], _yuvOffset[3];
+
 	float _textureWidth;
 	float _textureHeight;
 
@@ -493,12 +570,44 @@ private:
 	/** The time when the track was first paused. */
 	uint32_t _pauseStartTime;
 
+	/** The decode of the next frame, running while the current one is shown.
+	 *
+	 *  While it's running, the tracks are off limits. The state they had when
+	 *  it was started is what we report in the meantime.
+	 */
+	std::future<bool> _decodeAhead;
+	/** The time the frame being decoded ahead is due, in milliseconds. */
+	uint32_t _decodeAheadTime;
+
+	CatchUpPolicy _catchUp;
+	FrameStats _frameStats;
+
+	/** The number of frames dropped since the last one that was shown. */
+	uint32_t _droppedInRow;
+
 	/** Update the video, if necessary. */
 	void update();
 
+	/** Decode the next frame and buffer the audio needed until the frame after it.
+	 *
+	 *  @param  skip Try to skip the frame instead of decoding it.
+	 *  @return true if the frame was decoded, false if it was skipped.
+	 */
+	bool decodeFrame(bool skip);
+
+	/** Show the frame that was just decoded, unless it's too late for that. */
+	void showFrame(uint32_t frameTime);
+
 	/** Copy the video image data to the texture. */
 	void copyData();
 
+	/** Create the textures and the shader for a planar _frame. */
+	void buildPlanes();
+	/** Copy the planes of a planar _frame into their textures. */
+	void copyPlanes();
+	/** Draw the planes of a planar _frame, converting them in the shader. */
+	void renderPlanes(float hWidth, float hHeight);
+
 	/** Get the dimensions of the quad to draw the texture on. */
 	void getQuadDimensions(float &width, float &height) const;
 };
@@ -45,6 +45,12 @@ void Fader::decodeNextTrackFrame(VideoTrack &track) {
 	_needCopy = true;
 }
 
+bool Fader::skipNextTrackFrame(VideoTrack &track) {
+	// Every frame is drawn from scratch
+	static_cast<FaderVideoTrack &>(track).skipFrame();
+	return true;
+}
+
 Fader::FaderVideoTrack::FaderVideoTrack(uint32_t width, uint32_t height, int n) : _width(width), _height(height), _curFrame(-1), _c(0), _n(n) {
 }
 
@@ -78,6 +84,10 @@ void Fader::FaderVideoTrack::drawFrame(Graphics::Surface &surface) {
 		dPos += surface.getWidth() * 4;
 	}
 
+	skipFrame();
+}
+
+void Fader::FaderVideoTrack::skipFrame() {
 	_c += 2;
 	_curFrame++;
 }
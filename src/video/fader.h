@@ -38,6 +38,7 @@ public:
 
 protected:
 	void decodeNextTrackFrame(VideoTrack &track);
+	bool skipNextTrackFrame(VideoTrack &track);
 
 private:
 	class FaderVideoTrack : public FixedRateVideoTrack {
@@ -50,6 +51,7 @@ private:
 		int getFrameCount() const { return _n * 128; }
 
 		void drawFrame(Graphics::Surface &surface);
+		void skipFrame();
 
 	protected:
 		Common::Rational getFrameRate() const { return 50; }
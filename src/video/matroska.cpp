@@ -580,6 +580,10 @@ Matroska::Matroska(Common::SeekableReadStream *fd) : _fd(fd) {
 	load();
 }
 
+Matroska::~Matroska() {
+	deinit();
+}
+
 void Matroska::load() {
 	// Read the header in
 	EBMLHeader header;
@@ -660,7 +664,7 @@ void Matroska::load() {
 	}
 
 	// Initialize video
-	initVideo();
+	initVideo(true);
 }
 
 
@@ -678,7 +682,7 @@ void Matroska::decodeNextTrackFrame(VideoTrack &track) {
 	}
 
 	// Decode the frame
-	videoTrack.decodeFrame(*_surface, *packet, nextTimestamp);
+	videoTrack.decodeFrame(*_frame, *packet, nextTimestamp);
 	_needCopy = true;
 }
 
@@ -812,8 +816,8 @@ void Matroska::findNextPacket(uint64_t trackNumber, TrackStatus& status) {
 Matroska::MatroskaVideoTrack::MatroskaVideoTrack(uint64_t trackNumber, uint32_t width, uint32_t height, uint64_t defaultDuration) : _trackNumber(trackNumber), _width(width), _height(height), _defaultDuration(defaultDuration), _curFrame(-1), _finished(false), _timestamp(0) {
 }
 
-void Matroska::MatroskaVideoTrack::decodeFrame(Graphics::Surface &surface, Common::SeekableReadStream &frameData, uint64_t timestamp) {
-	_videoCodec->decodeFrame(surface, frameData);
+void Matroska::MatroskaVideoTrack::decodeFrame(YUVFrame &frame, Common::SeekableReadStream &frameData, uint64_t timestamp) {
+	_videoCodec->decodeFrame(frame, frameData);
 	_curFrame++;
 
 	if (timestamp == std::numeric_limits<uint64_t>::max())
@@ -46,6 +46,7 @@ class Codec;
 class Matroska : public VideoDecoder {
 public:
 	Matroska(Common::SeekableReadStream *fd);
+	~Matroska();
 
 protected:
 	void decodeNextTrackFrame(VideoTrack &track);
@@ -88,7 +89,7 @@ private:
 		int getCurFrame() const { return _curFrame; }
 		Common::Timestamp getNextFrameStartTime() const;
 
-		void decodeFrame(Graphics::Surface &surface, Common::SeekableReadStream &frameData, uint64_t timestamp);
+		void decodeFrame(YUVFrame &frame, Common::SeekableReadStream &frameData, uint64_t timestamp);
 		void initCodec(const std::string &codec, Common::SeekableReadStream *extraData);
 		void finish() { _finished = true; }
 
@@ -105,6 +105,7 @@ QuickTimeDecoder::QuickTimeDecoder(Common::SeekableReadStream *stream) : _fd(str
 }
 
 QuickTimeDecoder::~QuickTimeDecoder() {
+	deinit();
 }
 
 void QuickTimeDecoder::load() {
@@ -151,7 +152,7 @@ void QuickTimeDecoder::load() {
 		}
 	}
 
-	initVideo();
+	initVideo(true);
 }
 
 QuickTimeDecoder::SampleDesc *QuickTimeDecoder::readSampleDesc(QuickTimeTrack *track, uint32_t format) {
@@ -251,7 +252,7 @@ Codec *QuickTimeDecoder::findDefaultVideoCodec() const {
 }
 
 void QuickTimeDecoder::decodeNextTrackFrame(VideoTrack &track) {
-	_needCopy = static_cast<VideoTrackHandler &>(track).decodeNextFrame(*_surface);
+	_needCopy = static_cast<VideoTrackHandler &>(track).decodeNextFrame(*_frame);
 }
 
 void QuickTimeDecoder::initParseTable() {
@@ -992,7 +993,7 @@ Common::Timestamp QuickTimeDecoder::VideoTrackHandler::getNextFrameStartTime() c
 	return Common::Timestamp(0, _nextFrameStartTime, _parent->timeScale);
 }
 
-bool QuickTimeDecoder::VideoTrackHandler::decodeNextFrame(Graphics::Surface &surface) {
+bool QuickTimeDecoder::VideoTrackHandler::decodeNextFrame(YUVFrame &frame) {
 	_curFrame++;
 	_nextFrameStartTime += getFrameDuration();
 
@@ -1008,7 +1009,7 @@ bool QuickTimeDecoder::VideoTrackHandler::decodeNextFrame(Graphics::Surface &sur
 	if (!entry._videoCodec)
 		return false;
 
-	entry._videoCodec->decodeFrame(surface, *frameData);
+	entry._videoCodec->decodeFrame(frame, *frameData);
 	return true;
 }
 
@@ -69,10 +69,6 @@ namespace Common {
 	class SeekableReadStream;
 }
 
-namespace Graphics {
-	class Surface;
-}
-
 namespace Video {
 
 class Codec;
@@ -238,7 +234,7 @@ private:
 		int getFrameCount() const;
 		Common::Timestamp getNextFrameStartTime() const;
 
-		bool decodeNextFrame(Graphics::Surface &surface);
+		bool decodeNextFrame(YUVFrame &frame);
 
 	private:
 		QuickTimeDecoder *_decoder;
@@ -31,6 +31,7 @@ src_video_libvideo_la_SOURCES += \
     src/video/xmv.h \
     src/video/actimagine.h \
     src/video/matroska.h \
+    src/video/yuvframe.h \
     $(EMPTY)
 
 src_video_libvideo_la_SOURCES += \
@@ -41,6 +42,7 @@ src_video_libvideo_la_SOURCES += \
     src/video/xmv.cpp \
     src/video/actimagine.cpp \
     src/video/matroska.cpp \
+    src/video/yuvframe.cpp \
     $(EMPTY)
 
 src_video_libvideo_la_LIBADD = \
@@ -58,6 +58,7 @@ XboxMediaVideo::XboxMediaVideo(Common::SeekableReadStream *xmv) :
 }
 
 XboxMediaVideo::~XboxMediaVideo() {
+	deinit();
 }
 
 void XboxMediaVideo::queueNewAudio(PacketAudio &audioPacket) {
@@ -104,7 +105,7 @@ void XboxMediaVideo::processNextFrame(PacketVideo &videoPacket) {
 
 	if (videoPacket.currentFrameSize > 0) {
 		Common::SeekableSubReadStream frameData(_xmv.get(), _xmv->pos(), _xmv->pos() + videoPacket.currentFrameSize);
-		_needCopy = _videoTrack->decodeFrame(*_surface, frameData);
+		_needCopy = _videoTrack->decodeFrame(*_frame, frameData);
 
 		if (!_needCopy)
 			warning("XboxMediaVideo::processNextFrame(): Video frame without a decoder");
@@ -228,7 +229,7 @@ void XboxMediaVideo::load() {
 	queueNewAudio(_curPacket);
 
 	// Initialize video
-	initVideo();
+	initVideo(true);
 }
 
 void XboxMediaVideo::fetchNextPacket(Packet &packet) {
@@ -346,13 +347,13 @@ void XboxMediaVideo::decodeNextTrackFrame(VideoTrack &track) {
 XboxMediaVideo::XMVVideoTrack::XMVVideoTrack(uint32_t width, uint32_t height, uint32_t &timestamp) : _width(width), _height(height), _timestamp(timestamp), _curFrame(-1), _finished(false) {
 }
 
-bool XboxMediaVideo::XMVVideoTrack::decodeFrame(Graphics::Surface &surface, Common::SeekableReadStream &frameData) {
+bool XboxMediaVideo::XMVVideoTrack::decodeFrame(YUVFrame &frame, Common::SeekableReadStream &frameData) {
 	_curFrame++;
 
 	if (!_videoCodec)
 		return false;
 
-	_videoCodec->decodeFrame(surface, frameData);
+	_videoCodec->decodeFrame(frame, frameData);
 	return true;
 }
 
@@ -73,7 +73,7 @@ private:
 		int getCurFrame() const { return _curFrame; }
 		Common::Timestamp getNextFrameStartTime() const;
 
-		bool decodeFrame(Graphics::Surface &surface, Common::SeekableReadStream &frameData);
+		bool decodeFrame(YUVFrame &frame, Common::SeekableReadStream &frameData);
 		void initCodec(Common::SeekableReadStream &extraData);
 		void finish() { _finished = true; }
 
@@ -0,0 +1,128 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A decoded video frame in planar YUV 4:2:0.
+ */
+
+#include <cstring>
+
+#include "src/common/util.h"
+
+#include "src/graphics/images/surface.h"
+
+#include "src/video/yuvframe.h"
+
+namespace Video {
+
+YUVFrame::YUVFrame(Graphics::Surface &surface) : _surface(&surface),
+	_width(surface.getWidth()), _height(surface.getHeight()), _hasAlpha(false),
+	_scale(Graphics::YUVToRGBManager::kScaleFull), _matrix(Graphics::YUVToRGBManager::kMatrixBT601) {
+
+}
+
+YUVFrame::YUVFrame(uint32_t width, uint32_t height) : _surface(0),
+	_width(width), _height(height), _hasAlpha(false),
+	_scale(Graphics::YUVToRGBManager::kScaleFull), _matrix(Graphics::YUVToRGBManager::kMatrixBT601) {
+
+	for (size_t i = 0; i < kPlaneMAX; i++) {
+		const size_t size = getWidth((Plane) i) * getHeight((Plane) i);
+
+		_planes[i] = std::make_unique<byte[]>(size);
+
+		// Start out black and opaque
+		std::memset(_planes[i].get(), ((i == kPlaneU) || (i == kPlaneV)) ? 128 : ((i == kPlaneA) ? 255 : 0), size);
+	}
+}
+
+YUVFrame::~YUVFrame() {
+}
+
+bool YUVFrame::isPlanar() const {
+	return _surface == 0;
+}
+
+bool YUVFrame::hasAlpha() const {
+	return _hasAlpha;
+}
+
+uint32_t YUVFrame::getWidth(Plane plane) const {
+	if ((plane == kPlaneU) || (plane == kPlaneV))
+		return (_width + 1) / 2;
+
+	return _width;
+}
+
+uint32_t YUVFrame::getHeight(Plane plane) const {
+	if ((plane == kPlaneU) || (plane == kPlaneV))
+		return (_height + 1) / 2;
+
+	return _height;
+}
+
+const byte *YUVFrame::getPlane(Plane plane) const {
+	if ((plane < 0) || (plane >= kPlaneMAX))
+		return 0;
+
+	return _planes[plane].get();
+}
+
+Graphics::YUVToRGBManager::LuminanceScale YUVFrame::getScale() const {
+	return _scale;
+}
+
+Graphics::YUVToRGBManager::ColorMatrix YUVFrame::getMatrix() const {
+	return _matrix;
+}
+
+void YUVFrame::set420(Graphics::YUVToRGBManager::LuminanceScale scale,
+                      const byte *ySrc, const byte *uSrc, const byte *vSrc, const byte *aSrc,
+                      int yWidth, int yHeight, int yPitch, int uvPitch,
+                      Graphics::YUVToRGBManager::ColorMatrix matrix) {
+
+	_scale    = scale;
+	_matrix   = matrix;
+	_hasAlpha = aSrc != 0;
+
+	if (_surface) {
+		YUVToRGBMan.convert420(scale, _surface->getData(), _surface->getPitch(), ySrc, uSrc, vSrc, aSrc,
+		                       MIN<int>(yWidth, _width), MIN<int>(yHeight, _height), yPitch, uvPitch, matrix);
+		return;
+	}
+
+	copyPlane(kPlaneY, ySrc, yWidth, yHeight, yPitch);
+	copyPlane(kPlaneU, uSrc, (yWidth + 1) / 2, (yHeight + 1) / 2, uvPitch);
+	copyPlane(kPlaneV, vSrc, (yWidth + 1) / 2, (yHeight + 1) / 2, uvPitch);
+
+	if (aSrc)
+		copyPlane(kPlaneA, aSrc, yWidth, yHeight, yPitch);
+}
+
+void YUVFrame::copyPlane(Plane plane, const byte *src, int srcWidth, int srcHeight, int srcPitch) {
+	const uint32_t width  = MIN<uint32_t>(srcWidth , getWidth (plane));
+	const uint32_t height = MIN<uint32_t>(srcHeight, getHeight(plane));
+
+	byte *dst = _planes[plane].get();
+
+	for (uint32_t y = 0; y < height; y++, src += srcPitch, dst += getWidth(plane))
+		std::memcpy(dst, src, width);
+}
+
+} // End of namespace Video
@@ -0,0 +1,121 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  A decoded video frame in planar YUV 4:2:0.
+ */
+
+#ifndef VIDEO_YUVFRAME_H
+#define VIDEO_YUVFRAME_H
+
+#include <memory>
+
+#include <boost/noncopyable.hpp>
+
+#include "src/common/types.h"
+
+#include "src/graphics/yuv_to_rgb.h"
+
+namespace Graphics {
+	class Surface;
+}
+
+namespace Video {
+
+/** Where a codec puts a decoded YUV 4:2:0 frame.
+ *
+ *  A frame either converts the image straight into a BGRA surface on the
+ *  CPU, or it keeps copies of the planes, so that the renderer can upload
+ *  them as they are and convert them in a shader.
+ */
+class YUVFrame : boost::noncopyable {
+public:
+	enum Plane {
+		kPlaneY = 0,
+		kPlaneU    ,
+		kPlaneV    ,
+		kPlaneA    ,
+		kPlaneMAX
+	};
+
+	/** Create a frame that converts into this BGRA surface. */
+	YUVFrame(Graphics::Surface &surface);
+	/** Create a frame that keeps the planes of an image of these dimensions. */
+	YUVFrame(uint32_t width, uint32_t height);
+	~YUVFrame();
+
+	/** Does this frame keep the planes, instead of converting them? */
+	bool isPlanar() const;
+
+	/** Was an alpha plane given with the last image? */
+	bool hasAlpha() const;
+
+	/** Return the width of a plane. */
+	uint32_t getWidth(Plane plane = kPlaneY) const;
+	/** Return the height of a plane. */
+	uint32_t getHeight(Plane plane = kPlaneY) const;
+
+	/** Return the data of a plane, top to bottom. */
+	const byte *getPlane(Plane plane) const;
+
+	/** Return the scale of the luminance values in the last image. */
+	Graphics::YUVToRGBManager::LuminanceScale getScale() const;
+	/** Return the color matrix of the last image. */
+	Graphics::YUVToRGBManager::ColorMatrix getMatrix() const;
+
+	/**
+	 * Set the frame to this YUV420 image
+	 *
+	 * @param scale    the scale of the luminance values
+	 * @param ySrc     the source of the y component
+	 * @param uSrc     the source of the u component
+	 * @param vSrc     the source of the v component
+	 * @param aSrc     the source of the a component, or 0 for none
+	 * @param yWidth   the width of the y surface
+	 * @param yHeight  the height of the y surface
+	 * @param yPitch   the pitch of the y and a surfaces
+	 * @param uvPitch  the pitch of the u and v surfaces
+	 * @param matrix   the color matrix of the source
+	 */
+	void set420(Graphics::YUVToRGBManager::LuminanceScale scale,
+	            const byte *ySrc, const byte *uSrc, const byte *vSrc, const byte *aSrc,
+	            int yWidth, int yHeight, int yPitch, int uvPitch,
+	            Graphics::YUVToRGBManager::ColorMatrix matrix = Graphics::YUVToRGBManager::kMatrixBT601);
+
+private:
+	Graphics::Surface *_surface; ///< The surface to convert into, if not planar.
+
+	uint32_t _width;
+	uint32_t _height;
+
+	std::unique_ptr<byte[]> _planes[kPlaneMAX];
+
+	bool _hasAlpha;
+
+	Graphics::YUVToRGBManager::LuminanceScale _scale;
+	Graphics::YUVToRGBManager::ColorMatrix _matrix;
+
+	/** Copy one source plane into our own, cutting it to our dimensions. */
+	void copyPlane(Plane plane, const byte *src, int srcWidth, int srcHeight, int srcPitch);
+};
+
+} // End of namespace Video
+
+#endif // VIDEO_YUVFRAME_H
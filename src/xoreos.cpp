@@ -39,6 +39,8 @@
 #include "src/common/platform.h"
 #include "src/common/filepath.h"
 #include "src/common/threads.h"
+#include "src/common/threadpool.h"
+#include "src/common/profiler.h"
 #include "src/common/debugman.h"
 #include "src/common/configman.h"
 #include "src/common/random.h"
@@ -64,6 +66,7 @@
 #include "src/graphics/aurora/textureman.h"
 #include "src/graphics/aurora/cursorman.h"
 #include "src/graphics/aurora/fontman.h"
+#include "src/graphics/aurora/guiquadbatch.h"
 
 #include "src/graphics/mesh/meshman.h"
 
@@ -114,6 +117,10 @@ int main(int argc, char **argv) {
 		return 1;
 	}
 
+	// The load benchmark and prebaking run without ever presenting a frame
+	if (!ConfigMan.getString("benchmark-load", "").empty() || ConfigMan.getBool("prebake", false))
+		ConfigMan.setCommandlineKey("headless", "true");
+
 	// Check the requested target
 	if (target.empty() || !ConfigMan.hasGame(target)) {
 		Common::UString path = ConfigMan.getString("path", "");
@@ -220,6 +227,15 @@ int main(int argc, char **argv) {
 
 	destroyEngineProbes(probes);
 
+	const Common::UString profileTrace = ConfigMan.getString("profiletrace", "");
+	if (!profileTrace.empty()) {
+		try {
+			ProfilerMan.dumpChromeTrace(profileTrace);
+		} catch (...) {
+			Common::exceptionDispatcherWarning("Failed to write the profile trace to \"%s\"", profileTrace.c_str());
+		}
+	}
+
 	try {
 		// Sync changed debug channel settings
 		DebugMan.setConfigToVerbosityLevels();
@@ -273,8 +289,13 @@ static void initConfig() {
 	ConfigMan.setDouble(Common::kConfigRealmDefault, "volume_video", 1.0);
 
 	ConfigMan.setBool(Common::kConfigRealmDefault, "showfps", false);
+	ConfigMan.setBool(Common::kConfigRealmDefault, "showperformance", false);
+	ConfigMan.setBool(Common::kConfigRealmDefault, "profile", false);
 
 	ConfigMan.setBool(Common::kConfigRealmDefault, "skipvideos", false);
+	ConfigMan.setBool(Common::kConfigRealmDefault, "videoskipframes", true);
+	ConfigMan.setBool(Common::kConfigRealmDefault, "videodroplate"  , true);
+	ConfigMan.setBool(Common::kConfigRealmDefault, "videoaudiosync" , true);
 
 	ConfigMan.setBool(Common::kConfigRealmDefault, "saveconf", true);
 
@@ -305,6 +326,16 @@ static void init() {
 	// Init threading system
 	Common::initThreads();
 
+	// Start the worker threads, before anybody can ask for them from another thread
+	Common::ThreadPool::instance();
+
+	// Likewise for the profiler, which is used from all threads
+	ProfilerMan.setEnabled(ConfigMan.getBool("profile", false));
+
+	// And for the metrics, which are updated from all threads as well
+	DebugMan.setMetricsEnabled(ConfigMan.getBool("metrics", false));
+	DebugMan.setMetricsLogInterval(MAX(ConfigMan.getInt("metricsinterval", 0), 0));
+
 #ifdef ENABLE_XML
 	// Init libxml2
 	Common::initXML();
@@ -338,6 +369,7 @@ static void deinit() {
 	// Destroy global singletons
 	Graphics::Aurora::FontManager::destroy();
 	Graphics::Aurora::CursorManager::destroy();
+	Graphics::Aurora::GUIQuadBatch::destroy();
 	Graphics::Aurora::TextureManager::destroy();
 
 	Aurora::LanguageManager::destroy();
@@ -376,4 +408,6 @@ static void deinit() {
 	Common::DebugManager::destroy();
 	Common::ConfigManager::destroy();
 	Common::Random::destroy();
+	Common::ThreadPool::destroy();
+	Common::Profiler::destroy();
 }
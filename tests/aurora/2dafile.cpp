@@ -23,6 +23,7 @@
  */
 
 #include <vector>
+#include <memory>
 
 #include "gtest/gtest.h"
 
@@ -137,6 +138,35 @@ GTEST_TEST(TwoDAFileASCII, headerToColumn) {
 	EXPECT_EQ(twoda.headerToColumn("Nope"), Aurora::kFieldIDInvalid);
 }
 
+GTEST_TEST(TwoDAFileASCII, getColumnHandle) {
+	Common::MemoryReadStream stream(k2DAASCII);
+	const Aurora::TwoDAFile twoda(stream);
+
+	for (size_t i = 0; i < ARRAYSIZE(kHeaders); i++) {
+		const Aurora::TwoDAColumnHandle column = twoda.getColumnHandle(kHeaders[i]);
+
+		EXPECT_TRUE(column.isValid());
+		EXPECT_EQ(column.getColumn(), i);
+
+		for (size_t j = 0; j < ARRAYSIZE(kDataString[i]); j++) {
+			EXPECT_EQ(twoda.getRow(j).getInt(column), kDataInt[i][j]) << "At index " << j << "." << i;
+			EXPECT_FLOAT_EQ(twoda.getRow(j).getFloat(column), kDataFloat[i][j]) << "At index " << j << "." << i;
+			EXPECT_EQ(twoda.getRow(j).empty(column), kDataEmpty[i][j]) << "At index " << j << "." << i;
+
+			if (!kDataEmpty[i][j]) {
+				EXPECT_STREQ(twoda.getRow(j).getString(column).c_str(), kDataString[i][j]) << "At index " << j << "." << i;
+			}
+		}
+	}
+
+	EXPECT_EQ(twoda.getColumnHandle("stringvalue").getColumn(), 2);
+
+	const Aurora::TwoDAColumnHandle nope = twoda.getColumnHandle("Nope");
+	EXPECT_FALSE(nope.isValid());
+	EXPECT_TRUE(twoda.getRow(0).empty(nope));
+	EXPECT_EQ(twoda.getRow(0).getInt(nope), 0);
+}
+
 GTEST_TEST(TwoDAFileASCII, getRow) {
 	Common::MemoryReadStream stream(k2DAASCII);
 	const Aurora::TwoDAFile twoda(stream);
@@ -155,6 +185,19 @@ GTEST_TEST(TwoDAFileASCII, getRow) {
 	EXPECT_EQ(&twoda.getRow("ID"  , "Nope"), &twoda.getRow(Aurora::kFieldIDInvalid));
 }
 
+GTEST_TEST(TwoDAFileASCII, getMemorySize) {
+	Common::MemoryReadStream stream(k2DAASCII);
+	const Aurora::TwoDAFile twoda(stream);
+
+	// At least the cells themselves, as indices into the string pool
+	const size_t size = twoda.getMemorySize();
+	EXPECT_GE(size, sizeof(Aurora::TwoDAFile) + ARRAYSIZE(kHeaders) * ARRAYSIZE(kDataString[0]) * sizeof(uint32_t));
+
+	// Parsing a column as ints keeps the values around
+	twoda.getRow(0).getInt(0);
+	EXPECT_GE(twoda.getMemorySize(), size + ARRAYSIZE(kDataString[0]) * sizeof(int32_t));
+}
+
 GTEST_TEST(TwoDAFileASCII, writeBinary) {
 	Common::MemoryReadStream stream(k2DAASCII);
 	const Aurora::TwoDAFile twoda(stream);
@@ -168,6 +211,72 @@ GTEST_TEST(TwoDAFileASCII, writeBinary) {
 		EXPECT_EQ(writeStream.getData()[i], k2DABinary[i]) << "At index " << i;
 }
 
+GTEST_TEST(TwoDAFileASCII, writeSnapshot) {
+	Common::MemoryReadStream stream(k2DAASCII);
+	const Aurora::TwoDAFile twoda(stream);
+
+	Common::MemoryWriteStreamDynamic writeStream(true);
+	twoda.writeSnapshot(writeStream);
+
+	Common::MemoryReadStream snapshotStream(writeStream.getData(), writeStream.size());
+	const std::unique_ptr<Aurora::TwoDAFile> snapshotFile = Aurora::TwoDAFile::loadSnapshot(snapshotStream);
+	ASSERT_TRUE(snapshotFile);
+
+	const Aurora::TwoDAFile &snapshot = *snapshotFile;
+
+	ASSERT_EQ(snapshot.getRowCount(), ARRAYSIZE(kDataString[0]));
+	ASSERT_EQ(snapshot.getColumnCount(), ARRAYSIZE(kHeaders));
+
+	for (size_t i = 0; i < ARRAYSIZE(kHeaders); i++)
+		EXPECT_STREQ(snapshot.getHeaders()[i].c_str(), kHeaders[i]) << "At index " << i;
+
+	for (size_t i = 0; i < ARRAYSIZE(kDataString); i++) {
+		for (size_t j = 0; j < ARRAYSIZE(kDataString[i]); j++) {
+			EXPECT_EQ(snapshot.getRow(j).getInt(kHeaders[i]), kDataInt[i][j]) << "At index " << j << "." << i;
+			EXPECT_FLOAT_EQ(snapshot.getRow(j).getFloat(kHeaders[i]), kDataFloat[i][j]) << "At index " << j << "." << i;
+			EXPECT_EQ(snapshot.getRow(j).empty(kHeaders[i]), kDataEmpty[i][j]) << "At index " << j << "." << i;
+
+			if (!kDataEmpty[i][j]) {
+				EXPECT_STREQ(snapshot.getRow(j).getString(kHeaders[i]).c_str(), kDataString[i][j]) << "At index " << j << "." << i;
+			}
+		}
+	}
+
+	// And writing it again produces the same 2DA
+	Common::MemoryWriteStreamDynamic binaryStream(true);
+	snapshot.writeBinary(binaryStream);
+
+	ASSERT_EQ(binaryStream.size(), sizeof(k2DABinary));
+	for (size_t i = 0; i < sizeof(k2DABinary); i++)
+		EXPECT_EQ(binaryStream.getData()[i], k2DABinary[i]) << "At index " << i;
+}
+
+GTEST_TEST(TwoDAFileASCII, writeSnapshotTruncated) {
+	Common::MemoryReadStream stream(k2DAASCII);
+	const Aurora::TwoDAFile twoda(stream);
+
+	Common::MemoryWriteStreamDynamic writeStream(true);
+	twoda.writeSnapshot(writeStream);
+
+	Common::MemoryReadStream snapshotStream(writeStream.getData(), writeStream.size() - 4);
+	EXPECT_THROW(Aurora::TwoDAFile::loadSnapshot(snapshotStream), Common::Exception);
+}
+
+GTEST_TEST(TwoDAFileASCII, writeSnapshotNotA2DA) {
+	Common::MemoryReadStream stream(k2DAASCII);
+	const Aurora::TwoDAFile twoda(stream);
+
+	Common::MemoryWriteStreamDynamic writeStream(true);
+	twoda.writeSnapshot(writeStream);
+
+	// A snapshot is not a 2DA resource, and a 2DA resource is not a snapshot
+	Common::MemoryReadStream snapshotStream(writeStream.getData(), writeStream.size());
+	EXPECT_THROW(Aurora::TwoDAFile snapshot(snapshotStream), Common::Exception);
+
+	Common::MemoryReadStream asciiStream(k2DAASCII);
+	EXPECT_THROW(Aurora::TwoDAFile::loadSnapshot(asciiStream), Common::Exception);
+}
+
 // --- 2DA Binary ---
 
 GTEST_TEST(TwoDAFileBinary, getRowCount) {
@@ -345,6 +454,29 @@ GTEST_TEST(TwoDARowASCII, getFloatStr) {
 	EXPECT_FLOAT_EQ(twoda.getRow(0).getFloat("Nope"), 0.0f);
 }
 
+GTEST_TEST(TwoDARowASCII, getDefault) {
+	static const char *k2DADefault =
+	  "2DA V2.0\n"
+	  "DEFAULT: 7\n"
+	  "   Int  String\n"
+	  " 0 23   ****  \n"
+	  " 1 **** Foo   \n";
+
+	Common::MemoryReadStream stream(k2DADefault);
+	const Aurora::TwoDAFile twoda(stream);
+
+	EXPECT_EQ(twoda.getRow(0).getInt(0), 23);
+	EXPECT_EQ(twoda.getRow(1).getInt(0), 7);
+	EXPECT_EQ(twoda.getRow(0).getInt(1), 7);
+	EXPECT_EQ(twoda.getRow(1).getInt(1), 0);
+
+	EXPECT_FLOAT_EQ(twoda.getRow(0).getFloat(0), 23.0f);
+	EXPECT_FLOAT_EQ(twoda.getRow(1).getFloat(0), 7.0f);
+
+	EXPECT_STREQ(twoda.getRow(0).getString(1).c_str(), "7");
+	EXPECT_STREQ(twoda.getRow(1).getString(1).c_str(), "Foo");
+}
+
 // --- 2DA row Binary ---
 
 GTEST_TEST(TwoDARowBinary, emptyN) {
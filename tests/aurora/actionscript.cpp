@@ -592,3 +592,32 @@ GTEST_TEST(ActionScript, CascadingInheritance) {
 	delete streamc;
 	delete streamd;
 }
+
+/*
+ *  var i = 0;
+ *  while (i < 5)
+ *      i++;
+ */
+static const byte kTestLoop[] = {
+	0x96, 0x08, 0x00, 0x00, 0x69, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x1d,
+	0x96, 0x03, 0x00, 0x00, 0x69, 0x00, 0x1c, 0x96, 0x05, 0x00, 0x07, 0x05,
+	0x00, 0x00, 0x00, 0x48, 0x12, 0x9d, 0x02, 0x00, 0x14, 0x00, 0x96, 0x03,
+	0x00, 0x00, 0x69, 0x00, 0x96, 0x03, 0x00, 0x00, 0x69, 0x00, 0x1c, 0x50,
+	0x1d, 0x99, 0x02, 0x00, 0xd6, 0xff, 0x00
+};
+
+GTEST_TEST(ActionScript, Loop) {
+	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kTestLoop);
+	Aurora::ActionScript::ASBuffer asBuffer(stream);
+
+	Aurora::ActionScript::AVM avm;
+
+	asBuffer.run(avm);
+	EXPECT_EQ(avm.getVariable("i").asNumber(), 5);
+
+	// The second run executes the already decoded instructions
+	asBuffer.run(avm);
+	EXPECT_EQ(avm.getVariable("i").asNumber(), 5);
+
+	delete stream;
+}
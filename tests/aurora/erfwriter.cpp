@@ -22,6 +22,8 @@
  *  Unit tests for our ERF file archive writer class.
  */
 
+#include <cstring>
+
 #include "gtest/gtest.h"
 
 #include "src/common/memwritestream.h"
@@ -819,6 +821,46 @@ GTEST_TEST(ERFWriter, WriteMultipleFilesV22BiowareZlib) {
 	delete readStream3;
 }
 
+GTEST_TEST(ERFWriter, WriteMultipleFilesV22BiowareZlibAsync) {
+	const size_t kFileDataSize = Common::MemoryReadStream(kFileData, true).size();
+	const size_t kLogoDataSize = sizeof(kLogoData);
+
+	static const size_t kFileCount = 16;
+
+	Common::MemoryWriteStreamDynamic writeStream;
+	Aurora::ERFWriter erfWriter(MKTAG('E', 'R', 'F', ' '), kFileCount, writeStream, Aurora::ERFWriter::kERFVersion22, Aurora::ERFWriter::kCompressionBiowareZlib);
+
+	for (size_t i = 0; i < kFileCount; i += 2) {
+		erfWriter.addAsync(Common::UString::format("ozymandias_%u", (uint)i), Aurora::kFileTypeTXT,
+		                   new Common::MemoryReadStream(kFileData, true));
+		erfWriter.addAsync(Common::UString::format("logo_%u", (uint)i + 1), Aurora::kFileTypeBMP,
+		                   new Common::MemoryReadStream(kLogoData, kLogoDataSize));
+	}
+
+	const Aurora::ERFFile erf(new Common::MemoryReadStream(writeStream.getData(), writeStream.size(), true));
+
+	EXPECT_EQ(erf.getID(), MKTAG('E', 'R', 'F', ' '));
+	ASSERT_EQ(erf.getResources().size(), kFileCount);
+
+	for (size_t i = 0; i < kFileCount; i += 2) {
+		EXPECT_EQ(erf.findResource(Common::UString::format("ozymandias_%u", (uint)i), Aurora::kFileTypeTXT), i);
+		EXPECT_EQ(erf.findResource(Common::UString::format("logo_%u", (uint)i + 1), Aurora::kFileTypeBMP), i + 1);
+
+		std::unique_ptr<Common::SeekableReadStream> readStream1(erf.getResource(i));
+		ASSERT_EQ(readStream1->size(), kFileDataSize);
+		std::unique_ptr<Common::SeekableReadStream> readStream2(erf.getResource(i + 1));
+		ASSERT_EQ(readStream2->size(), kLogoDataSize);
+
+		std::unique_ptr<byte[]> fileData1 = std::make_unique<byte[]>(readStream1->size());
+		readStream1->read(fileData1.get(), readStream1->size());
+		std::unique_ptr<byte[]> fileData2 = std::make_unique<byte[]>(readStream2->size());
+		readStream2->read(fileData2.get(), readStream2->size());
+
+		EXPECT_EQ(memcmp(fileData1.get(), kFileData, kFileDataSize), 0);
+		EXPECT_EQ(memcmp(fileData2.get(), kLogoData, kLogoDataSize), 0);
+	}
+}
+
 GTEST_TEST(ERFWriter, WriteFileV22HeaderlessZlib) {
 	Common::MemoryReadStream dataStream(kFileData, true);
 	const size_t kFileDataSize = dataStream.size();
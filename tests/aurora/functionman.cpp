@@ -0,0 +1,106 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our FunctionManager class.
+ */
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "src/common/error.h"
+
+#include "src/aurora/nwscript/functionman.h"
+#include "src/aurora/nwscript/functioncontext.h"
+
+static void addInts(Aurora::NWScript::FunctionContext &ctx) {
+	ctx.getReturn() = ctx.getParams()[0].getInt() + ctx.getParams()[1].getInt();
+}
+
+static void registerAddInts() {
+	FunctionMan.clear();
+
+	Aurora::NWScript::Signature signature;
+	signature.push_back(Aurora::NWScript::kTypeInt);
+	signature.push_back(Aurora::NWScript::kTypeInt);
+	signature.push_back(Aurora::NWScript::kTypeInt);
+
+	Aurora::NWScript::Parameters defaults;
+	defaults.push_back(Aurora::NWScript::Variable(5));
+
+	FunctionMan.registerFunction("AddInts", 3, &addInts, signature, defaults);
+}
+
+GTEST_TEST(FunctionManager, call) {
+	registerAddInts();
+
+	Aurora::NWScript::FunctionContext ctx = FunctionMan.createContext(3);
+	EXPECT_STREQ(ctx.getName().c_str(), "AddInts");
+	EXPECT_EQ(ctx.getParamMin(), 1U);
+	EXPECT_EQ(ctx.getParamMax(), 2U);
+
+	ctx.getParams()[0] = 2;
+	FunctionMan.call(3, ctx);
+	EXPECT_EQ(ctx.getReturn().getInt(), 7);
+
+	ctx.getParams()[0] = 3;
+	FunctionMan.call("AddInts", ctx);
+	EXPECT_EQ(ctx.getReturn().getInt(), 8);
+
+	EXPECT_THROW(FunctionMan.createContext(2), Common::Exception);
+	EXPECT_THROW(FunctionMan.createContext(4), Common::Exception);
+	EXPECT_THROW(FunctionMan.createContext("Foobar"), Common::Exception);
+
+	FunctionMan.clear();
+}
+
+GTEST_TEST(FunctionManager, acquireContext) {
+	registerAddInts();
+
+	std::unique_ptr<Aurora::NWScript::FunctionContext> ctx = FunctionMan.acquireContext(3);
+	ASSERT_TRUE(ctx);
+
+	ctx->getParams()[0] = 2;
+	ctx->getParams()[1] = 23;
+	FunctionMan.call(3, *ctx);
+	EXPECT_EQ(ctx->getReturn().getInt(), 25);
+
+	const Aurora::NWScript::FunctionContext *used = ctx.get();
+	FunctionMan.releaseContext(3, std::move(ctx));
+
+	// The used context comes back, reset to the defaults
+	ctx = FunctionMan.acquireContext(3);
+	EXPECT_EQ(ctx.get(), used);
+
+	ASSERT_EQ(ctx->getParams().size(), 2U);
+	EXPECT_EQ(ctx->getParams()[0].getInt(), 0);
+	EXPECT_EQ(ctx->getParams()[1].getInt(), 5);
+	EXPECT_EQ(ctx->getReturn().getInt(), 0);
+
+	// Nested calls get their own context
+	std::unique_ptr<Aurora::NWScript::FunctionContext> ctx2 = FunctionMan.acquireContext(3);
+	EXPECT_NE(ctx2.get(), ctx.get());
+
+	FunctionMan.releaseContext(3, std::move(ctx2));
+	FunctionMan.releaseContext(3, std::move(ctx));
+
+	FunctionMan.clear();
+}
@@ -228,6 +228,31 @@ GTEST_TEST(GDAFile, getIntHash) {
 	EXPECT_THROW(gda.getInt(0, hash1), Common::Exception);
 }
 
+GTEST_TEST(GDAFile, getIntHandle) {
+	const Aurora::GDAFile gda(new Common::MemoryReadStream(kGDAFile));
+
+	const Aurora::GDAFile::ColumnHandle column0 = gda.getColumnHandle(kHeaders[0]);
+	const Aurora::GDAFile::ColumnHandle column2 = gda.getColumnHandle(kHeaders[2]);
+	const Aurora::GDAFile::ColumnHandle column4 =
+		gda.getColumnHandle(Common::hashStringCRC32(kHeadersLow[4], Common::kEncodingUTF16LE));
+
+	const Aurora::GDAFile::ColumnHandle columnNope = gda.getColumnHandle("NOPE");
+
+	EXPECT_TRUE(column0.isValid());
+	EXPECT_FALSE(columnNope.isValid());
+	EXPECT_FALSE(Aurora::GDAFile::ColumnHandle().isValid());
+
+	for (size_t i = 0; i < kRowCount; i++) {
+		EXPECT_EQ(gda.getInt(i, column0), kDataID[i]);
+		EXPECT_EQ(gda.getInt(i, column2), kDataInt[i]);
+		EXPECT_EQ(gda.getInt(i, column4), kDataBool[i]);
+	}
+
+	EXPECT_EQ(gda.getInt(9999, column0), 0);
+	EXPECT_EQ(gda.getInt(   0, columnNope), 0);
+	EXPECT_EQ(gda.getInt(   0, columnNope, 9999), 9999);
+}
+
 GTEST_TEST(GDAFile, getFloatName) {
 	const Aurora::GDAFile gda(new Common::MemoryReadStream(kGDAFile));
 
@@ -29,6 +29,7 @@
 #include "src/common/util.h"
 #include "src/common/error.h"
 #include "src/common/memreadstream.h"
+#include "src/common/readstream.h"
 
 #include "src/aurora/locstring.h"
 #include "src/aurora/language.h"
@@ -123,6 +124,24 @@ GTEST_TEST(GFF3File, enforceType) {
 	EXPECT_THROW(Aurora::GFF3File gffNope(new Common::MemoryReadStream(kGFF3SingleStruct), MKTAG('N', 'O', 'P', 'E')), Common::Exception);
 }
 
+GTEST_TEST(GFF3File, nonMemoryStream) {
+	/* A stream that isn't a MemoryReadStream: The GFF3 has to read itself
+	 * into memory, but then it has to behave exactly the same. */
+
+	Common::MemoryReadStream *memStream = new Common::MemoryReadStream(kGFF3SingleStruct);
+	Aurora::GFF3File gff3(new Common::SeekableSubReadStream(memStream, 0, memStream->size(), true));
+
+	const Aurora::GFF3Struct &strct = gff3.getTopLevel();
+
+	EXPECT_EQ(strct.getID(), 23);
+	EXPECT_EQ(strct.getFieldCount(), ARRAYSIZE(kFieldNamesSingle));
+
+	for (size_t i = 0; i < ARRAYSIZE(kFieldNamesSingle); i++)
+		EXPECT_TRUE(strct.hasField(kFieldNamesSingle[i])) << "At index " << i;
+
+	EXPECT_EQ(strct.getUint("FieldUint32"), 25);
+}
+
 GTEST_TEST(GFF3Struct, getID) {
 	Aurora::GFF3File gff3(new Common::MemoryReadStream(kGFF3SingleStruct));
 	const Aurora::GFF3Struct &strct = gff3.getTopLevel();
@@ -22,6 +22,8 @@
  *  Unit tests for our GFF3 file writer class.
  */
 
+#include <cstring>
+#include <memory>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -348,3 +350,39 @@ GTEST_TEST(GFF3Writer, WriteEquivalentValues) {
 
 	delete writeStream;
 }
+
+GTEST_TEST(GFF3Writer, WriteSharedFieldData) {
+	static const byte vData[8] = { '!', '[', 'D', 'A', 'T', 'A', ']', '!' };
+
+	Aurora::GFF3Writer writer(MKTAG('G', 'F', 'F', ' '));
+	Aurora::GFF3WriterStructPtr strct = writer.getTopLevel();
+
+	strct->addVoid("FieldVoid_1", new Common::MemoryReadStream(vData));
+	strct->addVoid("FieldVoid_2", new Common::MemoryReadStream(vData));
+	strct->addExoString("FieldExoString_1", "Hello World :)");
+	strct->addExoString("FieldExoString_2", "Hello World :)");
+
+	Common::MemoryWriteStreamDynamic writeStream1(true);
+	writer.write(writeStream1);
+
+	Common::MemoryWriteStreamDynamic writeStream2(true);
+	writer.write(writeStream2);
+
+	// Writing again produces the very same GFF
+	ASSERT_EQ(writeStream1.size(), writeStream2.size());
+	EXPECT_EQ(memcmp(writeStream1.getData(), writeStream2.getData(), writeStream1.size()), 0);
+
+	// The field data only holds each distinct value once
+	Common::MemoryReadStream stream(writeStream1.getData(), writeStream1.size());
+	stream.seek(36);
+	EXPECT_EQ(stream.readUint32LE(), (4 + 8) + (4 + 14));
+
+	Aurora::GFF3File gff(new Common::MemoryReadStream(writeStream1.getData(), writeStream1.size()));
+
+	EXPECT_EQ(gff.getTopLevel().getString("FieldExoString_1"), "Hello World :)");
+	EXPECT_EQ(gff.getTopLevel().getString("FieldExoString_2"), "Hello World :)");
+
+	std::unique_ptr<Common::SeekableReadStream> data(gff.getTopLevel().getData("FieldVoid_2"));
+	ASSERT_TRUE(data);
+	EXPECT_EQ(data->size(), 8);
+}
@@ -41,6 +41,7 @@
 #include "src/common/error.h"
 #include "src/common/encoding.h"
 #include "src/common/memreadstream.h"
+#include "src/common/readstream.h"
 
 #include "src/aurora/gff4file.h"
 
@@ -130,6 +131,17 @@ GTEST_TEST(GFF4File, getPlatform) {
 	EXPECT_EQ(gff4.getPlatform(), MKTAG('P', 'C', ' ', ' '));
 }
 
+GTEST_TEST(GFF4File, readNonMemoryStream) {
+	// A GFF4 not already in memory is read into memory first
+	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kGFF4SingleValues);
+	Aurora::GFF4File gff4(new Common::SeekableSubReadStream(stream, 0, stream->size(), true));
+
+	const Aurora::GFF4Struct &strct = gff4.getTopLevel();
+
+	EXPECT_EQ(strct.getUint(256), 23);
+	EXPECT_EQ(strct.getSint(263), -26);
+}
+
 GTEST_TEST(GFF4Struct, getRefCount) {
 	Aurora::GFF4File gff4(new Common::MemoryReadStream(kGFF4SingleValues));
 	const Aurora::GFF4Struct &strct = gff4.getTopLevel();
@@ -1872,6 +1884,62 @@ GTEST_TEST(GFF4StructList, getVectorMatrixFloat) {
 	EXPECT_THROW(strct.getVectorMatrix(1024, v), Common::Exception);
 }
 
+GTEST_TEST(GFF4StructList, getUint32) {
+	Aurora::GFF4File gff4(new Common::MemoryReadStream(kGFF4ListValues));
+	const Aurora::GFF4Struct &strct = gff4.getTopLevel();
+
+	std::vector<uint32_t> list;
+
+	EXPECT_TRUE(strct.getUint(256, list));
+	ASSERT_EQ(list.size(), 3);
+	EXPECT_EQ(list[0], 23);
+	EXPECT_EQ(list[1], 24);
+	EXPECT_EQ(list[2], 25);
+
+	EXPECT_TRUE(strct.getUint(257, list));
+	ASSERT_EQ(list.size(), 3);
+	EXPECT_EQ(list[0], (uint32_t)((int32_t) -23));
+	EXPECT_EQ(list[1], (uint32_t)((int32_t) -24));
+	EXPECT_EQ(list[2], (uint32_t)((int32_t) -25));
+
+	EXPECT_FALSE(strct.getUint(9999, list));
+
+	EXPECT_THROW(strct.getUint(1024, list), Common::Exception);
+}
+
+GTEST_TEST(GFF4StructList, getVectorMatrixFlat) {
+	Aurora::GFF4File gff4(new Common::MemoryReadStream(kGFF4ListValues));
+	const Aurora::GFF4Struct &strct = gff4.getTopLevel();
+
+	std::vector<float> v;
+	uint32_t length = 0;
+
+	EXPECT_TRUE(strct.getVectorMatrix(768, v, length));
+	ASSERT_EQ(length, 3);
+	ASSERT_EQ(v.size(), 9);
+	EXPECT_FLOAT_EQ(v[0], 81.1f);
+	EXPECT_FLOAT_EQ(v[1], 81.2f);
+	EXPECT_FLOAT_EQ(v[2], 81.3f);
+	EXPECT_FLOAT_EQ(v[3], 82.1f);
+	EXPECT_FLOAT_EQ(v[4], 82.2f);
+	EXPECT_FLOAT_EQ(v[5], 82.3f);
+	EXPECT_FLOAT_EQ(v[6], 83.1f);
+	EXPECT_FLOAT_EQ(v[7], 83.2f);
+	EXPECT_FLOAT_EQ(v[8], 83.3f);
+
+	EXPECT_TRUE(strct.getVectorMatrix(769, v, length));
+	ASSERT_EQ(length, 4);
+	ASSERT_EQ(v.size(), 12);
+	EXPECT_FLOAT_EQ(v[ 0], 91.1f);
+	EXPECT_FLOAT_EQ(v[ 3], 91.4f);
+	EXPECT_FLOAT_EQ(v[ 4], 92.1f);
+	EXPECT_FLOAT_EQ(v[11], 93.4f);
+
+	EXPECT_FALSE(strct.getVectorMatrix(9999, v, length));
+
+	EXPECT_THROW(strct.getVectorMatrix(1024, v, length), Common::Exception);
+}
+
 GTEST_TEST(GFF4StructList, getData) {
 	Aurora::GFF4File gff4(new Common::MemoryReadStream(kGFF4ListValues));
 	const Aurora::GFF4Struct &strct = gff4.getTopLevel();
@@ -0,0 +1,110 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our NCSFile class.
+ */
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "src/common/memreadstream.h"
+
+#include "src/aurora/nwscript/ncsfile.h"
+#include "src/aurora/nwscript/variable.h"
+#include "src/aurora/nwscript/profiler.h"
+
+// int i = 50; while (i) i--; return i;
+static const byte kNCSFile[] = {
+	'N', 'C', 'S', ' ', 'V', '1', '.', '0', 0x42, 0x00, 0x00, 0x00, 0x3D,
+	0x02, 0x03,                                           // RSADDI
+	0x04, 0x03, 0x00, 0x00, 0x00, 0x32,                   // CONSTI 50
+	0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x04,       // CPDOWNSP -8, 4
+	0x1B, 0x00, 0xFF, 0xFF, 0xFF, 0xFC,                   // MOVSP -4
+	0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x04,       // CPTOPSP -4, 4
+	0x1F, 0x00, 0x00, 0x00, 0x00, 0x12,                   // JZ +18
+	0x23, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,                   // DECISP -4
+	0x1D, 0x00, 0xFF, 0xFF, 0xFF, 0xEC                    // JMP -20
+};
+
+static Aurora::NWScript::NCSFile *createNCS() {
+	return new Aurora::NWScript::NCSFile(new Common::MemoryReadStream(kNCSFile));
+}
+
+GTEST_TEST(NCSFile, run) {
+	std::unique_ptr<Aurora::NWScript::NCSFile> ncs(createNCS());
+
+	const Aurora::NWScript::Variable &retVal = ncs->run((Aurora::NWScript::Object *) 0);
+	EXPECT_FALSE(ncs->isSuspended());
+
+	ASSERT_EQ(retVal.getType(), Aurora::NWScript::kTypeInt);
+	EXPECT_EQ(retVal.getInt(), 0);
+}
+
+GTEST_TEST(NCSFile, instructionBudget) {
+	std::unique_ptr<Aurora::NWScript::NCSFile> ncs(createNCS());
+
+	ncs->setInstructionBudget(20);
+
+	Aurora::NWScript::Variable retVal = ncs->run((Aurora::NWScript::Object *) 0);
+
+	size_t slices = 1;
+	while (ncs->isSuspended()) {
+		ASSERT_LT(slices, 100U);
+		EXPECT_EQ(retVal.getType(), Aurora::NWScript::kTypeVoid);
+
+		const Aurora::NWScript::ScriptState state = ncs->getContinuation();
+		ASSERT_EQ(state.locals.size(), 1U);
+
+		retVal = ncs->run(state, (Aurora::NWScript::Object *) 0);
+		slices++;
+	}
+
+	EXPECT_GT(slices, 1U);
+
+	ASSERT_EQ(retVal.getType(), Aurora::NWScript::kTypeInt);
+	EXPECT_EQ(retVal.getInt(), 0);
+}
+
+GTEST_TEST(NCSFile, profile) {
+	std::unique_ptr<Aurora::NWScript::NCSFile> ncs(createNCS());
+
+	ScriptProfiler.clear();
+	ScriptProfiler.setEnabled(true);
+
+	ncs->run((Aurora::NWScript::Object *) 0);
+	ncs->run((Aurora::NWScript::Object *) 0);
+
+	ScriptProfiler.setEnabled(false);
+
+	ncs->run((Aurora::NWScript::Object *) 0);
+
+	const Aurora::NWScript::Profiler::Entries scripts = ScriptProfiler.getScripts();
+	ASSERT_EQ(scripts.size(), 1U);
+
+	// 4 instructions of setup, 4 per iteration and 2 for the final check
+	EXPECT_EQ(scripts[0].calls, 2U);
+	EXPECT_EQ(scripts[0].instructions, 2U * (4 + 50 * 4 + 2));
+
+	EXPECT_TRUE(ScriptProfiler.getFunctions().empty());
+
+	ScriptProfiler.clear();
+}
@@ -0,0 +1,117 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our NWScript ObjectContainer class.
+ */
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "src/common/uuid.h"
+
+#include "src/aurora/nwscript/object.h"
+#include "src/aurora/nwscript/objectcontainer.h"
+
+class TestObject : public Aurora::NWScript::Object {
+public:
+	TestObject(const Common::UString &tag) {
+		_id  = Common::generateIDNumber();
+		_tag = tag;
+	}
+};
+
+static Aurora::NWScript::Object *kNoObject = 0;
+
+GTEST_TEST(ObjectContainer, getObjectByID) {
+	TestObject object1("Foo"), object2("Bar");
+
+	Aurora::NWScript::ObjectContainer container;
+	container.addObject(object1);
+	container.addObject(object2);
+
+	EXPECT_EQ(container.getObjectByID(object1.getID()), &object1);
+	EXPECT_EQ(container.getObjectByID(object2.getID()), &object2);
+	EXPECT_EQ(container.getObjectByID(Aurora::kObjectIDInvalid), kNoObject);
+
+	container.removeObject(object1);
+
+	EXPECT_EQ(container.getObjectByID(object1.getID()), kNoObject);
+	EXPECT_EQ(container.getObjectByID(object2.getID()), &object2);
+
+	container.clearObjects();
+
+	EXPECT_EQ(container.getObjectByID(object2.getID()), kNoObject);
+	EXPECT_EQ(container.getFirstObject(), kNoObject);
+}
+
+GTEST_TEST(ObjectContainer, getObjectsByTag) {
+	TestObject object1("Foo"), object2("Bar"), object3("Foo"), object4("foo");
+
+	Aurora::NWScript::ObjectContainer container;
+	container.addObject(object1);
+	container.addObject(object2);
+	container.addObject(object3);
+	container.addObject(object4);
+
+	EXPECT_EQ(container.getFirstObjectByTag("Foo"), &object1);
+	EXPECT_EQ(container.getFirstObjectByTag("foo"), &object4);
+	EXPECT_EQ(container.getFirstObjectByTag("Quux"), kNoObject);
+
+	// Objects with the same tag are found in the order they were added
+	Aurora::NWScript::ObjectRange range = container.getObjectsByTag("Foo");
+	EXPECT_EQ(range.next(), &object1);
+	EXPECT_EQ(range.get(), &object3);
+	EXPECT_EQ(range.next(), &object3);
+	EXPECT_TRUE(range.empty());
+	EXPECT_EQ(range.next(), kNoObject);
+
+	EXPECT_TRUE(container.getObjectsByTag("Quux").empty());
+
+	container.removeObject(object1);
+
+	EXPECT_EQ(container.getFirstObjectByTag("Foo"), &object3);
+
+	container.removeObject(object3);
+
+	EXPECT_EQ(container.getFirstObjectByTag("Foo"), kNoObject);
+	EXPECT_EQ(container.getFirstObjectByTag("foo"), &object4);
+}
+
+GTEST_TEST(ObjectContainer, findObjectsByTag) {
+	TestObject object1("Foo"), object2("Bar"), object3("Foo");
+
+	Aurora::NWScript::ObjectContainer container;
+	container.addObject(object1);
+	container.addObject(object2);
+	container.addObject(object3);
+
+	std::unique_ptr<Aurora::NWScript::ObjectSearch> search(container.findObjectsByTag("Foo"));
+	EXPECT_EQ(search->next(), &object1);
+	EXPECT_EQ(search->next(), &object3);
+	EXPECT_EQ(search->next(), kNoObject);
+
+	std::unique_ptr<Aurora::NWScript::ObjectSearch> all(container.findObjects());
+	EXPECT_EQ(all->next(), &object1);
+	EXPECT_EQ(all->next(), &object2);
+	EXPECT_EQ(all->next(), &object3);
+	EXPECT_EQ(all->next(), kNoObject);
+}
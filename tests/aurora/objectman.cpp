@@ -0,0 +1,85 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our NWScript ObjectManager class.
+ */
+
+#include "gtest/gtest.h"
+
+#include "src/common/uuid.h"
+
+#include "src/aurora/nwscript/object.h"
+#include "src/aurora/nwscript/objectref.h"
+#include "src/aurora/nwscript/objectman.h"
+
+class TestObject : public Aurora::NWScript::Object {
+public:
+	TestObject() {
+		_id = Common::generateIDNumber();
+		ObjectMan.registerObject(this);
+	}
+
+	~TestObject() {
+		ObjectMan.unregisterObject(this);
+	}
+};
+
+GTEST_TEST(ObjectManager, findObject) {
+	TestObject object1, object2;
+
+	EXPECT_EQ(ObjectMan.findObject(object1.getID()), &object1);
+	EXPECT_EQ(ObjectMan.findObject(object2.getID()), &object2);
+	EXPECT_EQ(ObjectMan.findObject(Aurora::kObjectIDInvalid), static_cast<Aurora::NWScript::Object *>(0));
+}
+
+GTEST_TEST(ObjectManager, reference) {
+	Aurora::NWScript::ObjectReference ref;
+	EXPECT_EQ(*ref, static_cast<Aurora::NWScript::Object *>(0));
+
+	uint32_t id = Aurora::kObjectIDInvalid;
+
+	{
+		TestObject object;
+		id = object.getID();
+
+		ref = &object;
+		EXPECT_EQ(*ref, &object);
+		EXPECT_EQ(ref.getId(), id);
+	}
+
+	// The object is gone, and the reference needs to notice
+	EXPECT_EQ(*ref, static_cast<Aurora::NWScript::Object *>(0));
+	EXPECT_EQ(ObjectMan.findObject(id), static_cast<Aurora::NWScript::Object *>(0));
+
+	// Even if its slot is reused by a new object
+	TestObject object;
+	EXPECT_EQ(*ref, static_cast<Aurora::NWScript::Object *>(0));
+
+	Aurora::NWScript::ObjectReference ref2(&object);
+	EXPECT_EQ(*ref2, &object);
+}
+
+GTEST_TEST(ObjectManager, unregistered) {
+	Aurora::NWScript::Object object;
+
+	Aurora::NWScript::ObjectReference ref(&object);
+	EXPECT_EQ(*ref, static_cast<Aurora::NWScript::Object *>(0));
+}
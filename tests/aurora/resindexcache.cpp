@@ -0,0 +1,147 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our resource index cache.
+ */
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/platform.h"
+#include "src/common/memreadstream.h"
+#include "src/common/memwritestream.h"
+
+#include "src/aurora/resindexcache.h"
+
+static const byte kBrokenCache[] = { 'X', 'R', 'I', 'C', 'V', '1', '.', '0', 0x05, 0x00, 0x00, 0x00 };
+
+class ResourceIndexCache : public ::testing::Test {
+protected:
+	boost::filesystem::path _path;
+
+	void SetUp() {
+		Common::Platform::init();
+
+		_path = boost::filesystem::temp_directory_path() /
+		        boost::filesystem::unique_path("%%%%_%%%%_%%%%_%%%%.xoreos");
+
+		writeFile("foobar");
+	}
+
+	void TearDown() {
+		boost::filesystem::remove(_path);
+	}
+
+	void writeFile(const char *data) {
+		boost::filesystem::ofstream file(_path);
+		file << data;
+	}
+
+	void createEntry(Aurora::ResourceIndexCache::Entry &entry) {
+		entry.archive.name     = "foo.erf";
+		entry.archive.path     = _path.generic_string();
+		entry.archive.type     = Aurora::kArchiveERF;
+		entry.archive.hashAlgo = Common::kHashNone;
+
+		entry.archive.resources.resize(2);
+
+		entry.archive.resources.front().name  = "foo";
+		entry.archive.resources.front().type  = Aurora::kFileTypeTXT;
+		entry.archive.resources.front().index = 0;
+
+		entry.archive.resources.back().name  = "bar";
+		entry.archive.resources.back().type  = Aurora::kFileTypeBMP;
+		entry.archive.resources.back().index = 1;
+
+		ASSERT_TRUE(Aurora::ResourceIndexCache::stat(entry.archive));
+	}
+
+	void saveCache(Aurora::ResourceIndexCache &cache, Common::MemoryWriteStreamDynamic &stream) {
+		Aurora::ResourceIndexCache::Entry entry;
+		createEntry(entry);
+
+		cache.add(entry);
+		ASSERT_TRUE(cache.isDirty());
+
+		cache.write(stream);
+		ASSERT_FALSE(cache.isDirty());
+	}
+};
+
+GTEST_TEST_F(ResourceIndexCache, roundtrip) {
+	Aurora::ResourceIndexCache cache1;
+	Common::MemoryWriteStreamDynamic stream(true);
+	saveCache(cache1, stream);
+
+	Common::MemoryReadStream readStream(stream.getData(), stream.size());
+
+	Aurora::ResourceIndexCache cache2;
+	ASSERT_TRUE(cache2.read(readStream));
+	EXPECT_FALSE(cache2.isDirty());
+
+	EXPECT_EQ(cache2.find(_path.generic_string(), Aurora::kArchiveRIM), static_cast<const void *>(0));
+
+	const Aurora::ResourceIndexCache::Entry *entry = cache2.find(_path.generic_string(), Aurora::kArchiveERF);
+	ASSERT_NE(entry, static_cast<const void *>(0));
+
+	EXPECT_STREQ(entry->archive.name.c_str(), "foo.erf");
+	EXPECT_STREQ(entry->archive.path.c_str(), _path.generic_string().c_str());
+	EXPECT_EQ(entry->archive.size, 6);
+	EXPECT_TRUE(entry->dataFiles.empty());
+
+	ASSERT_EQ(entry->archive.resources.size(), 2);
+
+	EXPECT_STREQ(entry->archive.resources.front().name.c_str(), "foo");
+	EXPECT_EQ(entry->archive.resources.front().type, Aurora::kFileTypeTXT);
+	EXPECT_EQ(entry->archive.resources.front().index, 0);
+
+	EXPECT_STREQ(entry->archive.resources.back().name.c_str(), "bar");
+	EXPECT_EQ(entry->archive.resources.back().type, Aurora::kFileTypeBMP);
+	EXPECT_EQ(entry->archive.resources.back().index, 1);
+}
+
+GTEST_TEST_F(ResourceIndexCache, stale) {
+	Aurora::ResourceIndexCache cache1;
+	Common::MemoryWriteStreamDynamic stream(true);
+	saveCache(cache1, stream);
+
+	writeFile("foobarbaz");
+
+	Common::MemoryReadStream readStream(stream.getData(), stream.size());
+
+	Aurora::ResourceIndexCache cache2;
+	ASSERT_TRUE(cache2.read(readStream));
+
+	EXPECT_EQ(cache2.find(_path.generic_string(), Aurora::kArchiveERF), static_cast<const void *>(0));
+	EXPECT_TRUE(cache2.isDirty());
+}
+
+GTEST_TEST_F(ResourceIndexCache, broken) {
+	Common::MemoryReadStream stream(kBrokenCache);
+
+	Aurora::ResourceIndexCache cache;
+	EXPECT_FALSE(cache.read(stream));
+
+	EXPECT_EQ(cache.find(_path.generic_string(), Aurora::kArchiveERF), static_cast<const void *>(0));
+}
@@ -0,0 +1,151 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our decompressed resource cache.
+ */
+
+#include <cstring>
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/memreadstream.h"
+
+#include "src/aurora/archive.h"
+#include "src/aurora/resourcecache.h"
+
+class TestArchive : public Aurora::Archive {
+public:
+	const ResourceList &getResources() const {
+		return _resources;
+	}
+
+	Common::SeekableReadStream *getResource(uint32_t UNUSED(index), bool UNUSED(tryNoCopy)) const {
+		return 0;
+	}
+
+private:
+	ResourceList _resources;
+};
+
+static Common::SeekableReadStream *createStream(size_t size, byte value) {
+	byte *data = new byte[size];
+	std::memset(data, value, size);
+
+	return new Common::MemoryReadStream(data, size, true);
+}
+
+static void checkStream(Common::SeekableReadStream *stream, size_t size, byte value) {
+	std::unique_ptr<Common::SeekableReadStream> s(stream);
+	ASSERT_TRUE(s);
+
+	ASSERT_EQ(s->size(), size);
+	for (size_t i = 0; i < size; i++)
+		EXPECT_EQ(s->readByte(), value) << "At index " << i;
+}
+
+GTEST_TEST(ResourceCache, hit) {
+	TestArchive archive;
+	Aurora::ResourceCache cache(64);
+
+	EXPECT_EQ(cache.get(archive, 0), static_cast<Common::SeekableReadStream *>(0));
+	EXPECT_EQ(cache.getMisses(), 1);
+
+	checkStream(cache.add(archive, 0, createStream(16, 0x23)), 16, 0x23);
+	EXPECT_EQ(cache.getSize(), 16);
+
+	checkStream(cache.get(archive, 0), 16, 0x23);
+	EXPECT_EQ(cache.getHits(), 1);
+
+	EXPECT_EQ(cache.get(archive, 1), static_cast<Common::SeekableReadStream *>(0));
+	EXPECT_EQ(cache.getMisses(), 2);
+}
+
+GTEST_TEST(ResourceCache, evict) {
+	TestArchive archive;
+	Aurora::ResourceCache cache(64);
+
+	delete cache.add(archive, 0, createStream(32, 0x00));
+	delete cache.add(archive, 1, createStream(32, 0x01));
+
+	// Make resource 0 the most recently used one
+	delete cache.get(archive, 0);
+
+	delete cache.add(archive, 2, createStream(32, 0x02));
+	EXPECT_EQ(cache.getSize(), 64);
+
+	checkStream(cache.get(archive, 0), 32, 0x00);
+	EXPECT_EQ(cache.get(archive, 1), static_cast<Common::SeekableReadStream *>(0));
+	checkStream(cache.get(archive, 2), 32, 0x02);
+}
+
+GTEST_TEST(ResourceCache, tooBig) {
+	TestArchive archive;
+	Aurora::ResourceCache cache(64);
+
+	checkStream(cache.add(archive, 0, createStream(65, 0x42)), 65, 0x42);
+	EXPECT_EQ(cache.getSize(), 0);
+
+	EXPECT_EQ(cache.get(archive, 0), static_cast<Common::SeekableReadStream *>(0));
+}
+
+GTEST_TEST(ResourceCache, shared) {
+	TestArchive archive;
+	Aurora::ResourceCache cache(64);
+
+	std::unique_ptr<Common::SeekableReadStream> stream(cache.add(archive, 0, createStream(16, 0x23)));
+
+	cache.clear();
+	EXPECT_EQ(cache.getSize(), 0);
+
+	// The stream still holds on to its data
+	checkStream(stream.release(), 16, 0x23);
+}
+
+GTEST_TEST(ResourceCache, removeArchive) {
+	TestArchive archive1, archive2;
+	Aurora::ResourceCache cache(64);
+
+	delete cache.add(archive1, 0, createStream(16, 0x01));
+	delete cache.add(archive2, 0, createStream(16, 0x02));
+
+	cache.removeArchive(archive1);
+	EXPECT_EQ(cache.getSize(), 16);
+
+	EXPECT_EQ(cache.get(archive1, 0), static_cast<Common::SeekableReadStream *>(0));
+	checkStream(cache.get(archive2, 0), 16, 0x02);
+}
+
+GTEST_TEST(ResourceCache, maxSize) {
+	TestArchive archive;
+	Aurora::ResourceCache cache(64);
+
+	delete cache.add(archive, 0, createStream(32, 0x00));
+	delete cache.add(archive, 1, createStream(32, 0x01));
+
+	cache.setMaxSize(32);
+	EXPECT_EQ(cache.getSize(), 32);
+
+	EXPECT_EQ(cache.get(archive, 0), static_cast<Common::SeekableReadStream *>(0));
+	checkStream(cache.get(archive, 1), 32, 0x01);
+}
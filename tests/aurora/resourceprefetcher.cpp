@@ -0,0 +1,144 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our background resource loader.
+ */
+
+#include <memory>
+#include <atomic>
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/memreadstream.h"
+
+#include "src/aurora/resourceprefetcher.h"
+
+static const char *kKey1 = "foo";
+static const char *kKey2 = "bar";
+
+static Common::SeekableReadStream *loadFoo() {
+	return new Common::MemoryReadStream("foo");
+}
+
+static Common::SeekableReadStream *loadFail() {
+	throw Common::Exception("Failed");
+}
+
+GTEST_TEST(ResourcePrefetcher, take) {
+	Aurora::ResourcePrefetcher prefetcher;
+	prefetcher.start(2);
+
+	ASSERT_EQ(prefetcher.getThreadCount(), 2);
+
+	prefetcher.add(kKey1, &loadFoo);
+
+	Common::SeekableReadStream *stream = 0;
+	ASSERT_TRUE(prefetcher.take(kKey1, stream));
+
+	std::unique_ptr<Common::SeekableReadStream> s(stream);
+	ASSERT_TRUE(s);
+	EXPECT_EQ(s->size(), 3);
+
+	// Taking a job removes it
+	EXPECT_FALSE(prefetcher.take(kKey1, stream));
+	EXPECT_FALSE(prefetcher.take(kKey2, stream));
+}
+
+GTEST_TEST(ResourcePrefetcher, takeOnce) {
+	Aurora::ResourcePrefetcher prefetcher;
+	prefetcher.start(1);
+
+	std::atomic<int> count(0);
+	Aurora::ResourcePrefetcher::Loader loader = [&count]() {
+		count++;
+		return loadFoo();
+	};
+
+	prefetcher.add(kKey1, loader);
+	prefetcher.add(kKey1, loader);
+
+	Common::SeekableReadStream *stream = 0;
+	ASSERT_TRUE(prefetcher.take(kKey1, stream));
+	delete stream;
+
+	EXPECT_EQ(count.load(), 1);
+}
+
+GTEST_TEST(ResourcePrefetcher, noThreads) {
+	Aurora::ResourcePrefetcher prefetcher;
+
+	prefetcher.add(kKey1, &loadFoo);
+
+	Common::SeekableReadStream *stream = 0;
+	EXPECT_FALSE(prefetcher.take(kKey1, stream));
+
+	std::future<Common::SeekableReadStream *> future = prefetcher.takeFuture(kKey1, &loadFoo);
+	ASSERT_TRUE(future.valid());
+
+	std::unique_ptr<Common::SeekableReadStream> s(future.get());
+	ASSERT_TRUE(s);
+	EXPECT_EQ(s->size(), 3);
+}
+
+GTEST_TEST(ResourcePrefetcher, future) {
+	Aurora::ResourcePrefetcher prefetcher;
+	prefetcher.start(2);
+
+	prefetcher.add(kKey1, &loadFoo);
+
+	std::future<Common::SeekableReadStream *> future1 = prefetcher.takeFuture(kKey1, &loadFoo);
+	std::future<Common::SeekableReadStream *> future2 = prefetcher.takeFuture(kKey2, &loadFoo);
+
+	std::unique_ptr<Common::SeekableReadStream> s1(future1.get());
+	std::unique_ptr<Common::SeekableReadStream> s2(future2.get());
+
+	ASSERT_TRUE(s1);
+	ASSERT_TRUE(s2);
+
+	EXPECT_EQ(s1->size(), 3);
+	EXPECT_EQ(s2->size(), 3);
+}
+
+GTEST_TEST(ResourcePrefetcher, exception) {
+	Aurora::ResourcePrefetcher prefetcher;
+	prefetcher.start(1);
+
+	prefetcher.add(kKey1, &loadFail);
+
+	Common::SeekableReadStream *stream = 0;
+	EXPECT_THROW(prefetcher.take(kKey1, stream), Common::Exception);
+}
+
+GTEST_TEST(ResourcePrefetcher, cancel) {
+	Aurora::ResourcePrefetcher prefetcher;
+	prefetcher.start(1);
+
+	prefetcher.add(kKey1, &loadFoo);
+	prefetcher.add(kKey2, &loadFoo);
+
+	prefetcher.cancel();
+
+	Common::SeekableReadStream *stream = 0;
+	EXPECT_FALSE(prefetcher.take(kKey1, stream));
+	EXPECT_FALSE(prefetcher.take(kKey2, stream));
+}
@@ -0,0 +1,139 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our resource access traces.
+ */
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/memreadstream.h"
+#include "src/common/memwritestream.h"
+
+#include "src/aurora/resourcetrace.h"
+
+static const byte kBrokenTrace[] = { 'X', 'R', 'T', 'R', 'V', '1', '.', '0', 0x05, 0x00, 0x00, 0x00 };
+
+static void addEntry(Aurora::ResourceTrace &trace, const char *name, Aurora::FileType type,
+                     uint32_t size, uint32_t time, const char *archive) {
+
+	Aurora::ResourceTrace::Entry entry;
+
+	entry.name    = name;
+	entry.type    = type;
+	entry.size    = size;
+	entry.time    = time;
+	entry.archive = archive;
+
+	trace.add(entry);
+}
+
+GTEST_TEST(ResourceTrace, add) {
+	Aurora::ResourceTrace trace;
+
+	addEntry(trace, "foo", Aurora::kFileTypeARE, 10, 100, "a.erf");
+	addEntry(trace, "bar", Aurora::kFileTypeGIT, 20, 200, "b.erf");
+	addEntry(trace, "foo", Aurora::kFileTypeARE, 30, 300, "c.erf");
+	addEntry(trace, "foo", Aurora::kFileTypeGIT, 40, 400, "a.erf");
+
+	const Aurora::ResourceTrace::Entries entries = trace.getEntries();
+	ASSERT_EQ(entries.size(), 3);
+
+	// Only the first request of a resource counts, in order
+	EXPECT_STREQ(entries[0].name.c_str(), "foo");
+	EXPECT_EQ(entries[0].type, Aurora::kFileTypeARE);
+	EXPECT_EQ(entries[0].size, 10);
+
+	EXPECT_STREQ(entries[1].name.c_str(), "bar");
+	EXPECT_EQ(entries[1].type, Aurora::kFileTypeGIT);
+
+	EXPECT_STREQ(entries[2].name.c_str(), "foo");
+	EXPECT_EQ(entries[2].type, Aurora::kFileTypeGIT);
+
+	trace.clear();
+	EXPECT_TRUE(trace.getEntries().empty());
+}
+
+GTEST_TEST(ResourceTrace, statistics) {
+	Aurora::ResourceTrace trace;
+
+	addEntry(trace, "foo", Aurora::kFileTypeARE, 10, 100, "a.erf");
+	addEntry(trace, "bar", Aurora::kFileTypeGIT, 20, 200, "b.erf");
+	addEntry(trace, "baz", Aurora::kFileTypeGIT, 40, 400, "a.erf");
+
+	const Aurora::ResourceTrace::Statistics statistics = trace.getStatistics();
+	ASSERT_EQ(statistics.size(), 2);
+
+	// Sorted by time spent
+	EXPECT_STREQ(statistics[0].archive.c_str(), "a.erf");
+	EXPECT_EQ(statistics[0].resources, 2);
+	EXPECT_EQ(statistics[0].size, 50);
+	EXPECT_EQ(statistics[0].time, 500);
+
+	EXPECT_STREQ(statistics[1].archive.c_str(), "b.erf");
+	EXPECT_EQ(statistics[1].resources, 1);
+	EXPECT_EQ(statistics[1].size, 20);
+	EXPECT_EQ(statistics[1].time, 200);
+}
+
+GTEST_TEST(ResourceTrace, roundtrip) {
+	Aurora::ResourceTrace trace1;
+
+	addEntry(trace1, "foo", Aurora::kFileTypeARE, 10, 100, "a.erf");
+	addEntry(trace1, "bar", Aurora::kFileTypeGIT, 20, 200, "b.erf");
+
+	Common::MemoryWriteStreamDynamic stream(true);
+	trace1.write(stream);
+
+	Common::MemoryReadStream readStream(stream.getData(), stream.size());
+
+	Aurora::ResourceTrace trace2;
+	ASSERT_TRUE(trace2.read(readStream));
+
+	const Aurora::ResourceTrace::Entries entries = trace2.getEntries();
+	ASSERT_EQ(entries.size(), 2);
+
+	EXPECT_STREQ(entries[0].name.c_str(), "foo");
+	EXPECT_EQ(entries[0].type, Aurora::kFileTypeARE);
+	EXPECT_EQ(entries[0].size, 10);
+	EXPECT_EQ(entries[0].time, 100);
+	EXPECT_STREQ(entries[0].archive.c_str(), "a.erf");
+
+	EXPECT_STREQ(entries[1].name.c_str(), "bar");
+	EXPECT_EQ(entries[1].type, Aurora::kFileTypeGIT);
+	EXPECT_EQ(entries[1].size, 20);
+	EXPECT_EQ(entries[1].time, 200);
+	EXPECT_STREQ(entries[1].archive.c_str(), "b.erf");
+
+	// Resources read from a trace still only count once
+	addEntry(trace2, "foo", Aurora::kFileTypeARE, 30, 300, "c.erf");
+	EXPECT_EQ(trace2.getEntries().size(), 2);
+}
+
+GTEST_TEST(ResourceTrace, readBroken) {
+	Aurora::ResourceTrace trace;
+	addEntry(trace, "foo", Aurora::kFileTypeARE, 10, 100, "a.erf");
+
+	Common::MemoryReadStream stream(kBrokenTrace);
+
+	EXPECT_FALSE(trace.read(stream));
+	EXPECT_TRUE(trace.getEntries().empty());
+}
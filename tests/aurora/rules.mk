@@ -148,6 +148,26 @@ tests_aurora_test_nfofile_SOURCES  = tests/aurora/nfofile.cpp
 tests_aurora_test_nfofile_LDADD    = $(aurora_LIBS)
 tests_aurora_test_nfofile_CXXFLAGS = $(test_CXXFLAGS)
 
+check_PROGRAMS                        += tests/aurora/test_functionman
+tests_aurora_test_functionman_SOURCES  = tests/aurora/functionman.cpp
+tests_aurora_test_functionman_LDADD    = $(aurora_LIBS)
+tests_aurora_test_functionman_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                      += tests/aurora/test_objectman
+tests_aurora_test_objectman_SOURCES  = tests/aurora/objectman.cpp
+tests_aurora_test_objectman_LDADD    = $(aurora_LIBS)
+tests_aurora_test_objectman_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                           += tests/aurora/test_objectcontainer
+tests_aurora_test_objectcontainer_SOURCES  = tests/aurora/objectcontainer.cpp
+tests_aurora_test_objectcontainer_LDADD    = $(aurora_LIBS)
+tests_aurora_test_objectcontainer_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                    += tests/aurora/test_ncsfile
+tests_aurora_test_ncsfile_SOURCES  = tests/aurora/ncsfile.cpp
+tests_aurora_test_ncsfile_LDADD    = $(aurora_LIBS)
+tests_aurora_test_ncsfile_CXXFLAGS = $(test_CXXFLAGS)
+
 check_PROGRAMS                    += tests/aurora/test_ltrfile
 tests_aurora_test_ltrfile_SOURCES  = tests/aurora/ltrfile.cpp
 tests_aurora_test_ltrfile_LDADD    = $(aurora_LIBS)
@@ -189,3 +209,23 @@ check_PROGRAMS                     += tests/aurora/test_xmlfixer
 tests_aurora_test_xmlfixer_SOURCES  = tests/aurora/xmlfixer.cpp
 tests_aurora_test_xmlfixer_LDADD    = $(aurora_LIBS)
 tests_aurora_test_xmlfixer_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                          += tests/aurora/test_resindexcache
+tests_aurora_test_resindexcache_SOURCES  = tests/aurora/resindexcache.cpp
+tests_aurora_test_resindexcache_LDADD    = $(aurora_LIBS)
+tests_aurora_test_resindexcache_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                          += tests/aurora/test_resourcecache
+tests_aurora_test_resourcecache_SOURCES  = tests/aurora/resourcecache.cpp
+tests_aurora_test_resourcecache_LDADD    = $(aurora_LIBS)
+tests_aurora_test_resourcecache_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                               += tests/aurora/test_resourceprefetcher
+tests_aurora_test_resourceprefetcher_SOURCES  = tests/aurora/resourceprefetcher.cpp
+tests_aurora_test_resourceprefetcher_LDADD    = $(aurora_LIBS)
+tests_aurora_test_resourceprefetcher_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                          += tests/aurora/test_resourcetrace
+tests_aurora_test_resourcetrace_SOURCES  = tests/aurora/resourcetrace.cpp
+tests_aurora_test_resourcetrace_LDADD    = $(aurora_LIBS)
+tests_aurora_test_resourcetrace_CXXFLAGS = $(test_CXXFLAGS)
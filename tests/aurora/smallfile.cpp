@@ -22,8 +22,12 @@
  *  Unit tests for our Nintendo DS compression.
  */
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
+#include "src/common/error.h"
+
 #include "src/common/memreadstream.h"
 #include "src/common/memwritestream.h"
 
@@ -234,6 +238,51 @@ GTEST_TEST(Small0x10, decompressIntoReadStreamTakeOverSeek) {
 	delete uncompressed;
 }
 
+GTEST_TEST(Small0x10, decompressSubStream) {
+	// Compressed data inside a larger stream, followed by more data
+	std::vector<byte> data(kDataCompressed10, kDataCompressed10 + sizeof(kDataCompressed10));
+	data.push_back('x');
+
+	Common::MemoryReadStream parent(data.data(), data.size());
+	Common::SeekableSubReadStream compressed(&parent, 0, data.size());
+
+	Common::MemoryWriteStreamDynamic uncompressed(true);
+
+	Aurora::Small::decompress(compressed, uncompressed);
+	ASSERT_EQ(uncompressed.size(), strlen(kDataUncompressed));
+
+	compareData(uncompressed.getData(), kDataUncompressed);
+
+	// Only the compressed data has been consumed
+	EXPECT_EQ(compressed.pos(), sizeof(kDataCompressed10));
+	EXPECT_EQ(compressed.readByte(), 'x');
+}
+
+GTEST_TEST(Small0x10, decompressRun) {
+	// One literal 'a', then a copy of 15 bytes from 1 byte back
+	static const byte kDataRun[] = { 0x10, 0x10, 0x00, 0x00, 0x40, 'a', 0xC0, 0x00 };
+
+	Common::MemoryReadStream compressed(kDataRun);
+
+	Common::SeekableReadStream *uncompressed = Aurora::Small::decompress(compressed);
+	ASSERT_EQ(uncompressed->size(), 16);
+
+	compareData(*uncompressed, "aaaaaaaaaaaaaaaa");
+	delete uncompressed;
+}
+
+GTEST_TEST(Small0x10, decompressBroken) {
+	// Truncated data
+	Common::MemoryReadStream truncated(kDataCompressed10, sizeof(kDataCompressed10) - 1);
+	EXPECT_THROW(delete Aurora::Small::decompress(truncated), Common::Exception);
+
+	// Copy from before the start of the data
+	static const byte kDataBefore[] = { 0x10, 0x10, 0x00, 0x00, 0x40, 'a', 0xC0, 0x01 };
+
+	Common::MemoryReadStream before(kDataBefore);
+	EXPECT_THROW(delete Aurora::Small::decompress(before), Common::Exception);
+}
+
 // --- Compress 0x10 ---
 
 GTEST_TEST(Small0x10, compress) {
@@ -22,6 +22,10 @@
  *  Unit tests for our TalkTable_TLK class.
  */
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "src/common/util.h"
@@ -83,6 +87,28 @@ GTEST_TEST(TalkTable_TLK30, getString) {
 	EXPECT_STREQ(tlk.getString(5000).c_str(), "");
 }
 
+GTEST_TEST(TalkTable_TLK30, getStringConcurrent) {
+	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kTLKV30);
+	Aurora::TalkTable_TLK tlk(stream, Common::kEncodingUTF8);
+
+	std::atomic<size_t> mismatches(0);
+
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i < 4; i++) {
+		threads.emplace_back([&tlk, &mismatches]() {
+			for (size_t j = 0; j < 100; j++) {
+				if ((tlk.getString(0) != "Foobar") || (tlk.getString(2) != "Barfoo") || !tlk.getString(1).empty())
+					mismatches++;
+			}
+		});
+	}
+
+	for (std::vector<std::thread>::iterator t = threads.begin(); t != threads.end(); ++t)
+		t->join();
+
+	EXPECT_EQ(mismatches.load(), 0);
+}
+
 GTEST_TEST(TalkTable_TLK30, getSoundResRef) {
 	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kTLKV30);
 	Aurora::TalkTable_TLK tlk(stream, Common::kEncodingUTF8);
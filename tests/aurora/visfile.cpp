@@ -129,3 +129,58 @@ GTEST_TEST(VISFile, brokenCounts) {
 	EXPECT_STREQ(room3[1].c_str(), "Room03");
 	EXPECT_STREQ(room3[2].c_str(), "Room04");
 }
+
+GTEST_TEST(VISFile, compileVisibility) {
+	Common::MemoryReadStream stream(kVISFile);
+	Aurora::VISFile vis;
+	vis.load(stream);
+
+	std::vector<Common::UString> rooms;
+	rooms.push_back("room01");
+	rooms.push_back("ROOM02");
+	rooms.push_back("Room03");
+	rooms.push_back("Room09");
+
+	std::vector<Aurora::VISFile::RoomSet> visibility;
+	vis.compileVisibility(rooms, visibility);
+
+	ASSERT_EQ(visibility.size(), 4);
+
+	// Room01 sees itself, Room02 and Room03. Room04 isn't in the list
+	EXPECT_TRUE (Aurora::VISFile::hasRoom(visibility[0], 0));
+	EXPECT_TRUE (Aurora::VISFile::hasRoom(visibility[0], 1));
+	EXPECT_TRUE (Aurora::VISFile::hasRoom(visibility[0], 2));
+	EXPECT_FALSE(Aurora::VISFile::hasRoom(visibility[0], 3));
+
+	EXPECT_TRUE (Aurora::VISFile::hasRoom(visibility[1], 0));
+	EXPECT_TRUE (Aurora::VISFile::hasRoom(visibility[1], 1));
+	EXPECT_TRUE (Aurora::VISFile::hasRoom(visibility[1], 2));
+	EXPECT_FALSE(Aurora::VISFile::hasRoom(visibility[1], 3));
+
+	// Room03 has no visibility list, Room09 an empty one
+	EXPECT_FALSE(Aurora::VISFile::hasRoom(visibility[2], 0));
+	EXPECT_TRUE (Aurora::VISFile::hasRoom(visibility[2], 2));
+
+	EXPECT_FALSE(Aurora::VISFile::hasRoom(visibility[3], 0));
+	EXPECT_TRUE (Aurora::VISFile::hasRoom(visibility[3], 3));
+}
+
+GTEST_TEST(VISFile, roomSet) {
+	Aurora::VISFile::RoomSet set;
+	Aurora::VISFile::clearRoomSet(set, 100);
+
+	EXPECT_EQ(set.size(), 2);
+
+	Aurora::VISFile::addRoom(set, 0);
+	Aurora::VISFile::addRoom(set, 63);
+	Aurora::VISFile::addRoom(set, 64);
+	Aurora::VISFile::addRoom(set, 200);
+
+	EXPECT_TRUE (Aurora::VISFile::hasRoom(set, 0));
+	EXPECT_FALSE(Aurora::VISFile::hasRoom(set, 1));
+	EXPECT_TRUE (Aurora::VISFile::hasRoom(set, 63));
+	EXPECT_TRUE (Aurora::VISFile::hasRoom(set, 64));
+	EXPECT_FALSE(Aurora::VISFile::hasRoom(set, 65));
+	EXPECT_TRUE (Aurora::VISFile::hasRoom(set, 200));
+	EXPECT_FALSE(Aurora::VISFile::hasRoom(set, 1000));
+}
@@ -116,6 +116,14 @@ GTEST_TEST(ZIPFile, getResourceSize) {
 	EXPECT_THROW(zip.getResourceSize(1), Common::Exception);
 }
 
+GTEST_TEST(ZIPFile, isResourceCompressed) {
+	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kZIPFile);
+	const Aurora::ZIPFile zip(stream);
+
+	EXPECT_TRUE(zip.isResourceCompressed(0));
+	EXPECT_FALSE(zip.isThreadSafe());
+}
+
 GTEST_TEST(ZIPFile, findResourceHash) {
 	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kZIPFile);
 	const Aurora::ZIPFile zip(stream);
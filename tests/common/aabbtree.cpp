@@ -0,0 +1,206 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for the flattened AABB tree.
+ */
+
+#include <vector>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+#include "src/common/aabbnode.h"
+#include "src/common/aabbtree.h"
+
+/** Build a tree of 2^depth unit boxes along the X axis, with the box index as property. */
+static Common::AABBNode *createTree(int start, int depth) {
+	if (depth == 0) {
+		float min[] = {(float) start       , 0.f, 0.f};
+		float max[] = {(float) start + 1.f, 1.f, 1.f};
+
+		return new Common::AABBNode(min, max, start);
+	}
+
+	const int half = 1 << (depth - 1);
+
+	float min[] = {(float) start               , 0.f, 0.f};
+	float max[] = {(float) (start + 2 * half), 1.f, 1.f};
+
+	Common::AABBNode *node = new Common::AABBNode(min, max);
+	node->setChildren(createTree(start, depth - 1), createTree(start + half, depth - 1));
+
+	return node;
+}
+
+static std::vector<int32_t> getProperties(const std::vector<Common::AABBNode *> &nodes) {
+	std::vector<int32_t> properties;
+	for (std::vector<Common::AABBNode *>::const_iterator n = nodes.begin(); n != nodes.end(); ++n)
+		properties.push_back((*n)->getProperty());
+
+	return properties;
+}
+
+GTEST_TEST(AABBTree, empty) {
+	Common::AABBTree tree;
+
+	EXPECT_TRUE(tree.empty());
+	EXPECT_EQ(tree.size(), 0);
+
+	EXPECT_FALSE(tree.visitLeaves([](int32_t) { return true; }));
+}
+
+GTEST_TEST(AABBTree, build) {
+	Common::AABBNode *root = createTree(0, 3);
+	Common::AABBTree tree(*root);
+
+	EXPECT_FALSE(tree.empty());
+	EXPECT_EQ(tree.size(), 15);
+
+	std::vector<int32_t> leaves;
+	tree.visitLeaves([&leaves](int32_t property) { leaves.push_back(property); return false; });
+
+	ASSERT_EQ(leaves.size(), 8);
+	for (size_t i = 0; i < leaves.size(); i++)
+		EXPECT_EQ(leaves[i], (int32_t) i) << "At index " << i;
+
+	delete root;
+}
+
+GTEST_TEST(AABBTree, visitPoint) {
+	Common::AABBNode *root = createTree(0, 4);
+	Common::AABBTree tree(*root);
+
+	for (float x = -0.75f; x < 17.f; x += 0.5f) {
+		std::vector<Common::AABBNode *> nodes;
+		root->getNodes(x, 0.5f, nodes);
+
+		std::vector<int32_t> leaves;
+		tree.visitPoint(x, 0.5f, [&leaves](int32_t property) { leaves.push_back(property); return false; });
+
+		EXPECT_EQ(leaves, getProperties(nodes)) << "At x " << x;
+	}
+
+	delete root;
+}
+
+GTEST_TEST(AABBTree, visitAABox) {
+	Common::AABBNode *root = createTree(0, 4);
+	Common::AABBTree tree(*root);
+
+	const glm::vec3 min(2.5f, 0.25f, 0.25f), max(6.5f, 0.75f, 0.75f);
+
+	std::vector<Common::AABBNode *> nodes;
+	root->getNodesInAABox(min, max, nodes);
+
+	std::vector<int32_t> leaves;
+	tree.visitAABox(min, max, [&leaves](int32_t property) { leaves.push_back(property); return false; });
+
+	EXPECT_EQ(leaves, getProperties(nodes));
+	EXPECT_EQ(leaves.size(), 5);
+
+	std::vector<int32_t> leaves2D;
+	tree.visitAABox(glm::vec2(min), glm::vec2(max), [&leaves2D](int32_t property) {
+		leaves2D.push_back(property);
+		return false;
+	});
+
+	EXPECT_EQ(leaves2D, leaves);
+
+	delete root;
+}
+
+GTEST_TEST(AABBTree, visitSegment) {
+	Common::AABBNode *root = createTree(0, 4);
+	Common::AABBTree tree(*root);
+
+	const glm::vec3 start(3.5f, 0.5f, 2.f), end(3.5f, 0.5f, -2.f);
+
+	std::vector<int32_t> leaves;
+	tree.visitSegment(start, end, [&leaves](int32_t property) { leaves.push_back(property); return false; });
+
+	ASSERT_EQ(leaves.size(), 1);
+	EXPECT_EQ(leaves[0], 3);
+
+	std::vector<Common::AABBNode *> nodes;
+	root->getNodesInSegment(glm::vec3(1.5f, 0.5f, 0.f), glm::vec3(4.5f, 0.5f, 0.f), nodes);
+
+	leaves.clear();
+	tree.visitSegment2D(glm::vec3(1.5f, 0.5f, 0.f), glm::vec3(4.5f, 0.5f, 0.f), [&leaves](int32_t property) {
+		leaves.push_back(property);
+		return false;
+	});
+
+	EXPECT_EQ(leaves, getProperties(nodes));
+
+	delete root;
+}
+
+GTEST_TEST(AABBTree, stop) {
+	Common::AABBNode *root = createTree(0, 4);
+	Common::AABBTree tree(*root);
+
+	size_t count = 0;
+	EXPECT_TRUE(tree.visitLeaves([&count](int32_t property) { count++; return property == 5; }));
+	EXPECT_EQ(count, 6);
+
+	EXPECT_FALSE(tree.visitPoint(20.f, 0.5f, [](int32_t) { return true; }));
+
+	delete root;
+}
+
+GTEST_TEST(AABBTree, buildBoxes) {
+	// A scattered grid of unit boxes, in no particular order
+	std::vector<glm::vec3> min, max;
+	for (int i = 0; i < 37; i++) {
+		const int j = (i * 17) % 37;
+
+		min.push_back(glm::vec3((float) (j % 6) * 2.f, (float) (j / 6) * 2.f, 0.f));
+		max.push_back(min.back() + glm::vec3(1.f, 1.f, 1.f));
+	}
+
+	Common::AABBTree tree;
+	tree.build(min.data(), max.data(), min.size());
+
+	EXPECT_EQ(tree.size(), 2 * min.size() - 1);
+
+	std::vector<int32_t> leaves;
+	tree.visitLeaves([&leaves](int32_t property) { leaves.push_back(property); return false; });
+
+	std::sort(leaves.begin(), leaves.end());
+	ASSERT_EQ(leaves.size(), min.size());
+	for (size_t i = 0; i < leaves.size(); i++)
+		EXPECT_EQ(leaves[i], (int32_t) i) << "At index " << i;
+
+	// Only the boxes a segment actually passes through are visited
+	for (size_t i = 0; i < min.size(); i++) {
+		const glm::vec3 center = (min[i] + max[i]) * 0.5f;
+
+		leaves.clear();
+		tree.visitSegment(center + glm::vec3(0.f, 0.f, 5.f), center - glm::vec3(0.f, 0.f, 5.f),
+		                  [&leaves](int32_t property) { leaves.push_back(property); return false; });
+
+		ASSERT_EQ(leaves.size(), 1) << "At index " << i;
+		EXPECT_EQ(leaves[0], (int32_t) i) << "At index " << i;
+	}
+
+	tree.build(min.data(), max.data(), 0);
+	EXPECT_TRUE(tree.empty());
+}
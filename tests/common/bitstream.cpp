@@ -25,6 +25,7 @@
 #include "gtest/gtest.h"
 
 #include "src/common/util.h"
+#include "src/common/error.h"
 #include "src/common/memreadstream.h"
 #include "src/common/bitstream.h"
 
@@ -192,3 +193,195 @@ GTEST_TEST(BitStream, BitStream64BELSB) {
 
 	testBitStream(bitStream, compValues);
 }
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream8MSB) {
+	static const byte compValues[11] = { 0, 0, 0, 1, 0, 0, 1, 0, 0x03, 0x04, 0x02 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream8MSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream8LSB) {
+	static const byte compValues[11] = { 0, 1, 0, 0, 1, 0, 0, 0, 0x04, 0x03, 0x01 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream8LSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream16LEMSB) {
+	static const byte compValues[11] = { 0, 0, 1, 1, 0, 1, 0, 0, 0x01, 0x02, 0x02 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream16LEMSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream16LELSB) {
+	static const byte compValues[11] = { 0, 1, 0, 0, 1, 0, 0, 0, 0x04, 0x03, 0x01 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream16LELSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream16BEMSB) {
+	static const byte compValues[11] = { 0, 0, 0, 1, 0, 0, 1, 0, 0x03, 0x04, 0x02 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream16BEMSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream16BELSB) {
+	static const byte compValues[11] = { 0, 0, 1, 0, 1, 1, 0, 0, 0x02, 0x01, 0x01 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream16BELSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream32LEMSB) {
+	static const byte compValues[11] = { 0, 1, 1, 1, 1, 0, 0, 0, 0x05, 0x06, 0x02 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream32LEMSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream32LELSB) {
+	static const byte compValues[11] = { 0, 1, 0, 0, 1, 0, 0, 0, 0x04, 0x03, 0x01 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream32LELSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream32BEMSB) {
+	static const byte compValues[11] = { 0, 0, 0, 1, 0, 0, 1, 0, 0x03, 0x04, 0x02 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream32BEMSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream32BELSB) {
+	static const byte compValues[11] = { 0, 0, 0, 1, 1, 1, 1, 0, 0x06, 0x05, 0x01 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream32BELSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream64LEMSB) {
+	static const byte compValues[11] = { 1, 1, 1, 0, 1, 1, 1, 1, 0x0C, 0x0D, 0x03 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream64LEMSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream64LELSB) {
+	static const byte compValues[11] = { 0, 1, 0, 0, 1, 0, 0, 0, 0x04, 0x03, 0x01 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream64LELSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream64BEMSB) {
+	static const byte compValues[11] = { 0, 0, 0, 1, 0, 0, 1, 0, 0x03, 0x04, 0x02 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream64BEMSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, MemoryBitStream64BELSB) {
+	static const byte compValues[11] = { 1, 1, 1, 1, 0, 1, 1, 1, 0x0D, 0x0C, 0x03 };
+	static const byte data[8] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+	Common::MemoryBitStream64BELSB bitStream(data, sizeof(data));
+
+	testBitStream(bitStream, compValues);
+}
+
+GTEST_TEST(MemoryBitStream, skip) {
+	static const byte data[4] = { 0 };
+	Common::MemoryBitStream8MSB bitStream(data, sizeof(data));
+
+	EXPECT_EQ(bitStream.pos(), 0);
+	EXPECT_EQ(bitStream.size(), 8 * ARRAYSIZE(data));
+
+	bitStream.skip(1);
+	bitStream.skip(2);
+	bitStream.skip(3);
+
+	EXPECT_EQ(bitStream.pos(), 6);
+
+	bitStream.skip(26);
+	EXPECT_TRUE(bitStream.eos());
+	EXPECT_THROW(bitStream.skip(1), Common::Exception);
+
+	bitStream.rewind();
+	EXPECT_EQ(bitStream.pos(), 0);
+}
+
+GTEST_TEST(MemoryBitStream, eos) {
+	static const byte data[3] = { 0xFF, 0xFF, 0xFF };
+	Common::MemoryBitStream8MSB bitStream(data, sizeof(data));
+
+	EXPECT_EQ(bitStream.getBits(20), 0xFFFFF);
+
+	// Peeking past the end reads zeros
+	EXPECT_EQ(bitStream.peekBits(8), 0xF0);
+	EXPECT_EQ(bitStream.pos(), 20);
+
+	EXPECT_THROW(bitStream.getBits(5), Common::Exception);
+}
+
+/** Read the same data through a BitStreamImpl and a MemoryBitStreamImpl of the same layout. */
+template<typename Impl, typename MemoryImpl>
+static void compareBitStreams() {
+	byte data[64];
+	for (size_t i = 0; i < ARRAYSIZE(data); i++)
+		data[i] = (i * 151 + 17) & 0xFF;
+
+	Common::MemoryReadStream stream(data);
+
+	Impl       bitStream(stream);
+	MemoryImpl memoryBitStream(data, sizeof(data));
+
+	for (size_t i = 0; !bitStream.eos(); i++) {
+		const size_t n = MIN<size_t>((i * 7) % 33, bitStream.size() - bitStream.pos());
+
+		if ((i % 5) == 4) {
+			bitStream.skip(n);
+			memoryBitStream.skip(n);
+		} else {
+			EXPECT_EQ(memoryBitStream.peekBits(n), bitStream.peekBits(n)) << "At read " << i;
+			EXPECT_EQ(memoryBitStream.getBits(n), bitStream.getBits(n)) << "At read " << i;
+		}
+
+		EXPECT_EQ(memoryBitStream.pos(), bitStream.pos()) << "At read " << i;
+	}
+
+	EXPECT_TRUE(memoryBitStream.eos());
+}
+
+GTEST_TEST(MemoryBitStream, compare) {
+	compareBitStreams<Common::BitStream8MSB   , Common::MemoryBitStream8MSB   >();
+	compareBitStreams<Common::BitStream8LSB   , Common::MemoryBitStream8LSB   >();
+	compareBitStreams<Common::BitStream16LEMSB, Common::MemoryBitStream16LEMSB>();
+	compareBitStreams<Common::BitStream16LELSB, Common::MemoryBitStream16LELSB>();
+	compareBitStreams<Common::BitStream16BEMSB, Common::MemoryBitStream16BEMSB>();
+	compareBitStreams<Common::BitStream16BELSB, Common::MemoryBitStream16BELSB>();
+	compareBitStreams<Common::BitStream32LEMSB, Common::MemoryBitStream32LEMSB>();
+	compareBitStreams<Common::BitStream32LELSB, Common::MemoryBitStream32LELSB>();
+	compareBitStreams<Common::BitStream32BEMSB, Common::MemoryBitStream32BEMSB>();
+	compareBitStreams<Common::BitStream32BELSB, Common::MemoryBitStream32BELSB>();
+	compareBitStreams<Common::BitStream64LEMSB, Common::MemoryBitStream64LEMSB>();
+	compareBitStreams<Common::BitStream64LELSB, Common::MemoryBitStream64LELSB>();
+	compareBitStreams<Common::BitStream64BEMSB, Common::MemoryBitStream64BEMSB>();
+	compareBitStreams<Common::BitStream64BELSB, Common::MemoryBitStream64BELSB>();
+}
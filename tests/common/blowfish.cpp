@@ -22,6 +22,8 @@
  *  Unit tests for our Blowfish implementation.
  */
 
+#include <cstring>
+
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -81,3 +83,54 @@ GTEST_TEST(Blowfish, misalign) {
 
 	EXPECT_THROW(Common::decryptBlowfishEBC(cipherText, key), Common::Exception);
 }
+
+GTEST_TEST(Blowfish, ecbBuffer) {
+	std::vector<byte> key;
+	createKey(key);
+
+	const Common::Blowfish blowfish(key);
+
+	byte data[ARRAYSIZE(kCypherText)] = { 0 };
+	std::memcpy(data, kClearText, ARRAYSIZE(kClearText));
+
+	// In place
+	blowfish.encryptECB(data, data, sizeof(data));
+
+	for (size_t i = 0; i < ARRAYSIZE(kCypherText); i++)
+		EXPECT_EQ(data[i], kCypherText[i]) << "At index " << i;
+
+	blowfish.decryptECB(data, data, sizeof(data));
+
+	for (size_t i = 0; i < ARRAYSIZE(kClearText); i++)
+		EXPECT_EQ(data[i], kClearText[i]) << "At index " << i;
+
+	EXPECT_THROW(blowfish.decryptECB(data, data, 7), Common::Exception);
+}
+
+GTEST_TEST(Blowfish, cbcRoundTrip) {
+	std::vector<byte> key;
+	createKey(key);
+
+	const Common::Blowfish blowfish(key);
+
+	static const byte kIV[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+	// Two identical blocks
+	byte clearText[16] = { 'F', 'o', 'o', 'b', 'a', 'r', '!', '!', 'F', 'o', 'o', 'b', 'a', 'r', '!', '!' };
+	byte cipherText[16], decrypted[16];
+
+	byte iv[8];
+	std::memcpy(iv, kIV, sizeof(iv));
+	blowfish.encryptCBC(clearText, cipherText, sizeof(clearText), iv);
+
+	// The chaining makes the encrypted blocks differ
+	EXPECT_NE(std::memcmp(cipherText, cipherText + 8, 8), 0);
+
+	// Decrypting in two parts continues the chain
+	std::memcpy(iv, kIV, sizeof(iv));
+	blowfish.decryptCBC(cipherText    , decrypted    , 8, iv);
+	blowfish.decryptCBC(cipherText + 8, decrypted + 8, 8, iv);
+
+	for (size_t i = 0; i < sizeof(clearText); i++)
+		EXPECT_EQ(decrypted[i], clearText[i]) << "At index " << i;
+}
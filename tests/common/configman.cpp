@@ -29,6 +29,7 @@
 #include "src/common/memreadstream.h"
 #include "src/common/memwritestream.h"
 #include "src/common/configman.h"
+#include "src/common/configvalue.h"
 
 static const char *kConfigFile = "[xoreos]\n"
                                  "width=640\n"
@@ -199,3 +200,58 @@ GTEST_TEST_F(ConfigManager, newSave) {
 
 	compareStream(writeStream, kConfigFile);
 }
+
+GTEST_TEST_F(ConfigManager, generation) {
+	loadConfigMan();
+
+	uint32_t generation = ConfigMan.getGeneration();
+
+	// Reading doesn't change anything
+	EXPECT_EQ(ConfigMan.getInt("width"), 640);
+	EXPECT_EQ(ConfigMan.getGeneration(), generation);
+
+	ConfigMan.setInt("width", 1024);
+	EXPECT_NE(ConfigMan.getGeneration(), generation);
+	generation = ConfigMan.getGeneration();
+
+	ConfigMan.setGame("game1");
+	EXPECT_NE(ConfigMan.getGeneration(), generation);
+	generation = ConfigMan.getGeneration();
+
+	ConfigMan.setInt(Common::kConfigRealmGameTemp, "width", 320);
+	EXPECT_NE(ConfigMan.getGeneration(), generation);
+}
+
+GTEST_TEST_F(ConfigManager, configValue) {
+	loadConfigMan();
+
+	const Common::ConfigValue<int>     width("width", 0);
+	const Common::ConfigValue<bool>    fullscreen("fullscreen", false);
+	const Common::ConfigValue<double>  gamma("gamma", 1.5);
+	const Common::ConfigValue<Common::UString> path("path", "nope");
+
+	EXPECT_EQ(width.get(), 640);
+	EXPECT_FALSE(fullscreen.get());
+	EXPECT_DOUBLE_EQ(gamma.get(), 1.5);
+	EXPECT_STREQ(path.get().c_str(), "nope");
+
+	ConfigMan.setGame("game1");
+
+	EXPECT_EQ(width.get(), 800);
+	EXPECT_TRUE(fullscreen.get());
+	EXPECT_STREQ(path.get().c_str(), "/path/to/game1/");
+
+	ConfigMan.setInt("width", 1024);
+	EXPECT_EQ(width.get(), 1024);
+
+	ConfigMan.setCommandlineKey("width", "2048");
+	EXPECT_EQ(width.get(), 2048);
+
+	ConfigMan.setDouble(Common::kConfigRealmDefault, "gamma", 2.0);
+	EXPECT_DOUBLE_EQ(gamma.get(), 2.0);
+
+	ConfigMan.setGame();
+
+	EXPECT_EQ(width.get(), 2048);
+	EXPECT_FALSE(fullscreen.get());
+}
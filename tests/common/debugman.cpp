@@ -0,0 +1,97 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for the metrics of our debug manager.
+ */
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "src/common/debugman.h"
+
+class DebugMetrics : public ::testing::Test {
+protected:
+	void SetUp() {
+		DebugMan.setMetricsEnabled(true);
+		DebugMan.clearMetrics();
+	}
+
+	void TearDown() {
+		DebugMan.setMetricsEnabled(false);
+		DebugMan.clearMetrics();
+	}
+};
+
+GTEST_TEST_F(DebugMetrics, counter) {
+	EXPECT_EQ(Common::DebugManager::getMetric(Common::kMetricScriptsExecuted), 0);
+
+	Common::DebugManager::addMetric(Common::kMetricScriptsExecuted);
+	Common::DebugManager::addMetric(Common::kMetricScriptsExecuted, 4);
+
+	EXPECT_EQ(Common::DebugManager::getMetric(Common::kMetricScriptsExecuted), 5);
+
+	// Other metrics are untouched
+	EXPECT_EQ(Common::DebugManager::getMetric(Common::kMetricResourcesFetched), 0);
+}
+
+GTEST_TEST_F(DebugMetrics, gauge) {
+	Common::DebugManager::setMetric(Common::kMetricSoundChannels, 12);
+	EXPECT_EQ(Common::DebugManager::getMetric(Common::kMetricSoundChannels), 12);
+
+	Common::DebugManager::setMetric(Common::kMetricSoundChannels, 3);
+	EXPECT_EQ(Common::DebugManager::getMetric(Common::kMetricSoundChannels), 3);
+}
+
+GTEST_TEST_F(DebugMetrics, disabled) {
+	Common::DebugManager::addMetric(Common::kMetricTexturesUploaded, 2);
+
+	DebugMan.setMetricsEnabled(false);
+	EXPECT_FALSE(DebugMan.isMetricsEnabled());
+
+	// Updates are ignored, but the values stay readable
+	Common::DebugManager::addMetric(Common::kMetricTexturesUploaded, 7);
+	Common::DebugManager::setMetric(Common::kMetricSoundChannels, 5);
+
+	EXPECT_EQ(Common::DebugManager::getMetric(Common::kMetricTexturesUploaded), 2);
+	EXPECT_EQ(Common::DebugManager::getMetric(Common::kMetricSoundChannels), 0);
+}
+
+GTEST_TEST_F(DebugMetrics, clear) {
+	Common::DebugManager::addMetric(Common::kMetricPathNodesExpanded, 100);
+	Common::DebugManager::setMetric(Common::kMetricResourceCacheSize, 1024);
+
+	DebugMan.clearMetrics();
+
+	EXPECT_EQ(Common::DebugManager::getMetric(Common::kMetricPathNodesExpanded), 0);
+	EXPECT_EQ(Common::DebugManager::getMetric(Common::kMetricResourceCacheSize), 0);
+}
+
+GTEST_TEST_F(DebugMetrics, names) {
+	for (size_t i = 0; i < Common::kMetricCount; i++)
+		EXPECT_GT(std::strlen(Common::DebugManager::getMetricName((Common::DebugMetric) i)), 0) << "At index " << i;
+
+	EXPECT_STREQ(Common::DebugManager::getMetricName(Common::kMetricScriptsExecuted), "ScriptsExecuted");
+
+	EXPECT_FALSE(Common::DebugManager::isMetricGauge(Common::kMetricVideoFramesDropped));
+	EXPECT_TRUE (Common::DebugManager::isMetricGauge(Common::kMetricSoundChannels));
+	EXPECT_TRUE (Common::DebugManager::isMetricGauge(Common::kMetricResourceCacheSize));
+}
@@ -0,0 +1,153 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our cached directory listings.
+ */
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/platform.h"
+#include "src/common/filepath.h"
+#include "src/common/dirsnapshot.h"
+
+boost::filesystem::path kDirectoryPath;
+
+class DirectorySnapshot : public ::testing::Test {
+protected:
+	static void SetUpTestCase() {
+		Common::Platform::init();
+
+		boost::filesystem::path tmpPath    = boost::filesystem::temp_directory_path();
+		boost::filesystem::path uniquePath = boost::filesystem::unique_path("%%%%_%%%%_%%%%_%%%%.xoreos");
+
+		kDirectoryPath = tmpPath / uniquePath;
+
+		boost::filesystem::create_directories(kDirectoryPath / "SubDir");
+
+		boost::filesystem::ofstream testFile(kDirectoryPath / "File.txt", std::ofstream::binary);
+		ASSERT_FALSE(testFile.fail());
+
+		testFile.close();
+	}
+
+	static void TearDownTestCase() {
+		if (!kDirectoryPath.empty())
+			boost::filesystem::remove_all(kDirectoryPath);
+	}
+
+	void SetUp() {
+		Common::DirectorySnapshot::clearCache();
+	}
+};
+
+GTEST_TEST_F(DirectorySnapshot, get) {
+	std::shared_ptr<const Common::DirectorySnapshot> snapshot =
+		Common::DirectorySnapshot::get(kDirectoryPath.generic_string());
+	ASSERT_TRUE(snapshot);
+
+	EXPECT_EQ(snapshot->getEntries().size(), 2);
+	EXPECT_STREQ(snapshot->getPath().c_str(),
+	             Common::FilePath::canonicalize(kDirectoryPath.generic_string(), false).c_str());
+
+	EXPECT_FALSE(Common::DirectorySnapshot::get((kDirectoryPath / "File.txt").generic_string()));
+	EXPECT_FALSE(Common::DirectorySnapshot::get((kDirectoryPath / "Nope").generic_string()));
+}
+
+GTEST_TEST_F(DirectorySnapshot, find) {
+	std::shared_ptr<const Common::DirectorySnapshot> snapshot =
+		Common::DirectorySnapshot::get(kDirectoryPath.generic_string());
+	ASSERT_TRUE(snapshot);
+
+	const Common::DirectorySnapshot::Entry *entry = snapshot->find("file.TXT", true);
+	ASSERT_NE(entry, static_cast<const Common::DirectorySnapshot::Entry *>(0));
+
+	EXPECT_STREQ(entry->name.c_str(), "File.txt");
+	EXPECT_STREQ(entry->path.c_str(), (snapshot->getPath() + "/File.txt").c_str());
+	EXPECT_FALSE(entry->isDirectory);
+
+	EXPECT_EQ(snapshot->find("file.TXT", false), static_cast<const Common::DirectorySnapshot::Entry *>(0));
+	EXPECT_EQ(snapshot->find("File.txt", false), entry);
+	EXPECT_EQ(snapshot->find("Nope", true), static_cast<const Common::DirectorySnapshot::Entry *>(0));
+}
+
+GTEST_TEST_F(DirectorySnapshot, findDirectory) {
+	std::shared_ptr<const Common::DirectorySnapshot> snapshot =
+		Common::DirectorySnapshot::get(kDirectoryPath.generic_string());
+	ASSERT_TRUE(snapshot);
+
+	const Common::DirectorySnapshot::Entry *entry = snapshot->findDirectory("subdir", true);
+	ASSERT_NE(entry, static_cast<const Common::DirectorySnapshot::Entry *>(0));
+
+	EXPECT_STREQ(entry->name.c_str(), "SubDir");
+	EXPECT_TRUE(entry->isDirectory);
+
+	EXPECT_EQ(snapshot->findDirectory("file.txt", true), static_cast<const Common::DirectorySnapshot::Entry *>(0));
+}
+
+GTEST_TEST_F(DirectorySnapshot, changed) {
+	std::shared_ptr<const Common::DirectorySnapshot> snapshot1 =
+		Common::DirectorySnapshot::get(kDirectoryPath.generic_string());
+	ASSERT_TRUE(snapshot1);
+
+	boost::filesystem::ofstream testFile(kDirectoryPath / "New.txt", std::ofstream::binary);
+	ASSERT_FALSE(testFile.fail());
+	testFile.close();
+
+	// The directory changed, so we need to see the new file
+	std::shared_ptr<const Common::DirectorySnapshot> snapshot2 =
+		Common::DirectorySnapshot::get(kDirectoryPath.generic_string());
+	ASSERT_TRUE(snapshot2);
+
+	EXPECT_NE(snapshot2->find("new.txt", true), static_cast<const Common::DirectorySnapshot::Entry *>(0));
+
+	boost::filesystem::remove(kDirectoryPath / "New.txt");
+
+	std::shared_ptr<const Common::DirectorySnapshot> snapshot3 =
+		Common::DirectorySnapshot::get(kDirectoryPath.generic_string());
+	ASSERT_TRUE(snapshot3);
+
+	EXPECT_EQ(snapshot3->find("new.txt", true), static_cast<const Common::DirectorySnapshot::Entry *>(0));
+}
+
+GTEST_TEST_F(DirectorySnapshot, cached) {
+	// Backdate the directory, so that its snapshot can be trusted
+	boost::filesystem::last_write_time(kDirectoryPath, std::time(0) - 10);
+
+	std::shared_ptr<const Common::DirectorySnapshot> snapshot1 =
+		Common::DirectorySnapshot::get(kDirectoryPath.generic_string());
+	std::shared_ptr<const Common::DirectorySnapshot> snapshot2 =
+		Common::DirectorySnapshot::get(kDirectoryPath.generic_string() + "/.");
+
+	ASSERT_TRUE(snapshot1);
+	EXPECT_EQ(snapshot1, snapshot2);
+
+	Common::DirectorySnapshot::clearCache();
+
+	std::shared_ptr<const Common::DirectorySnapshot> snapshot3 =
+		Common::DirectorySnapshot::get(kDirectoryPath.generic_string());
+
+	ASSERT_TRUE(snapshot3);
+	EXPECT_NE(snapshot1, snapshot3);
+}
@@ -50,6 +50,30 @@ GTEST_TEST(XOREOS_ENCODINGNAME, isValidCodePoint) {
 	EXPECT_FALSE(Common::isValidCodepoint(kEncoding, 0x81));
 }
 
+GTEST_TEST(XOREOS_ENCODINGNAME, ascii) {
+	testSupport(kEncoding);
+
+	static const char data[] = "A long pure ASCII string, spanning several words";
+
+	EXPECT_STREQ(Common::readString(reinterpret_cast<const byte *>(data), sizeof(data) - 1, kEncoding).c_str(), data);
+
+	// Everything after an embedded 0 is cut off
+	static const byte data0[] = { 'F', 'o', 'o', '\0', 'b', 'a', 'r', 0x80 };
+
+	EXPECT_STREQ(Common::readString(data0, sizeof(data0), kEncoding).c_str(), "Foo");
+}
+
+GTEST_TEST(XOREOS_ENCODINGNAME, invalid) {
+	testSupport(kEncoding);
+
+	// 0x80 is the Euro sign, 0x81 is unmapped
+	static const byte valid  [] = { 'a', 0x80 };
+	static const byte invalid[] = { 'a', 0x81 };
+
+	EXPECT_STREQ(Common::readString(valid  , sizeof(valid  ), kEncoding).c_str(), "a\xe2\x82\xac");
+	EXPECT_STREQ(Common::readString(invalid, sizeof(invalid), kEncoding).c_str(), "[!?!]");
+}
+
 // -- Generalized encoding function tests --
 
 // Example string with terminating 0
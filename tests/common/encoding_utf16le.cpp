@@ -49,6 +49,29 @@ GTEST_TEST(XOREOS_ENCODINGNAME, isValidCodePoint) {
 	EXPECT_TRUE(Common::isValidCodepoint(kEncoding, 0x20));
 }
 
+GTEST_TEST(XOREOS_ENCODINGNAME, surrogates) {
+	testSupport(kEncoding);
+
+	// U+1F600, as a surrogate pair
+	static const byte data[] = { 0x3D, 0xD8, 0x00, 0xDE };
+	const Common::UString str = Common::UString("\xf0\x9f\x98\x80");
+
+	EXPECT_STREQ(Common::readString(data, sizeof(data), kEncoding).c_str(), str.c_str());
+
+	Common::MemoryReadStream *stream = Common::convertString(str, kEncoding, false);
+	ASSERT_NE(stream, static_cast<Common::MemoryReadStream *>(0));
+
+	ASSERT_EQ(stream->size(), sizeof(data));
+	for (size_t i = 0; i < sizeof(data); i++)
+		EXPECT_EQ(stream->readByte(), data[i]) << "At index " << i;
+
+	delete stream;
+
+	// An unpaired surrogate is invalid
+	static const byte unpaired[] = { 'a', 0x00, 0x3D, 0xD8, 'b', 0x00 };
+	EXPECT_STREQ(Common::readString(unpaired, sizeof(unpaired), kEncoding).c_str(), "[!?!]");
+}
+
 // -- Generalized encoding function tests --
 
 // Example string with terminating 0
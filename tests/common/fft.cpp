@@ -0,0 +1,75 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our (Inverse) Fast Fourier Transform.
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "src/common/maths.h"
+#include "src/common/fft.h"
+
+/** Compare the FFT of a fixed input against a plain DFT. */
+static void testFFT(int bits, bool inverse) {
+	const int n = 1 << bits;
+
+	std::vector<Common::Complex> data(n), input(n);
+	for (int i = 0; i < n; i++) {
+		input[i].re = std::sin(i * 0.37f) + 0.25f * ((i * 7) % 5);
+		input[i].im = std::cos(i * 0.11f) - 0.5f  * ((i * 3) % 4);
+	}
+
+	data = input;
+
+	Common::FFT fft(bits, inverse);
+
+	fft.permute(data.data());
+	fft.calc(data.data());
+
+	const double sign = inverse ? 1.0 : -1.0;
+
+	for (int k = 0; k < n; k++) {
+		double re = 0.0, im = 0.0;
+
+		for (int j = 0; j < n; j++) {
+			const double angle = sign * 2.0 * M_PI * ((j * k) % n) / n;
+
+			re += input[j].re * std::cos(angle) - input[j].im * std::sin(angle);
+			im += input[j].re * std::sin(angle) + input[j].im * std::cos(angle);
+		}
+
+		EXPECT_NEAR(data[k].re, re, 1e-3 * n) << "At bits " << bits << ", index " << k;
+		EXPECT_NEAR(data[k].im, im, 1e-3 * n) << "At bits " << bits << ", index " << k;
+	}
+}
+
+GTEST_TEST(FFT, forward) {
+	for (int bits = 2; bits <= 10; bits++)
+		testFFT(bits, false);
+}
+
+GTEST_TEST(FFT, inverse) {
+	for (int bits = 2; bits <= 10; bits++)
+		testFFT(bits, true);
+}
@@ -184,3 +184,15 @@ GTEST_TEST_F(FileList, getSubListGlob) {
 	EXPECT_TRUE(subList2.empty());
 	EXPECT_EQ(subList2.size(), 0);
 }
+
+GTEST_TEST_F(FileList, containsGlobSuffix) {
+	const Common::FileList list(kDirectoryPath.generic_string());
+
+	EXPECT_TRUE (list.containsGlob(".*\\.xoreos", false));
+	EXPECT_TRUE (list.containsGlob(".*\\.XOREOS", true));
+	EXPECT_FALSE(list.containsGlob(".*\\.XOREOS", false));
+	EXPECT_TRUE (list.containsGlob(".*\\.(foo|xoreos)", false));
+	EXPECT_TRUE (list.containsGlob(".*\\.foo|.*\\.xoreos", false));
+	EXPECT_TRUE (list.containsGlob(".*\\.xoreo[s]", false));
+	EXPECT_FALSE(list.containsGlob(".*\\.xoreos\\.", false));
+}
@@ -114,6 +114,12 @@ GTEST_TEST_F(FilePath, getFileSize) {
 	EXPECT_EQ(Common::FilePath::getFileSize(kDirectoryPath.generic_string()), Common::kFileInvalid);
 }
 
+GTEST_TEST_F(FilePath, getModificationTime) {
+	EXPECT_EQ(Common::FilePath::getModificationTime(kFilePath.generic_string()),
+	          (uint64_t) boost::filesystem::last_write_time(kFilePath));
+	EXPECT_EQ(Common::FilePath::getModificationTime(kFilePathFake.generic_string()), 0);
+}
+
 GTEST_TEST_F(FilePath, getFile) {
 	EXPECT_STREQ(Common::FilePath::getFile("/path/to/file.ext").c_str(), "file.ext");
 	EXPECT_STREQ(Common::FilePath::getFile("path/to/file.ext" ).c_str(), "file.ext");
@@ -0,0 +1,102 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our fixed-rate simulation ticks and frame pacing.
+ */
+
+#include <thread>
+#include <chrono>
+
+#include "gtest/gtest.h"
+
+#include "src/common/fixedtimestep.h"
+
+typedef std::chrono::steady_clock Clock;
+
+GTEST_TEST(FixedTimestep, tickLength) {
+	Common::FixedTimestep timestep(20);
+
+	EXPECT_EQ(timestep.getTickLength(), 20);
+	EXPECT_FLOAT_EQ(timestep.getTickSeconds(), 0.02f);
+}
+
+GTEST_TEST(FixedTimestep, advance) {
+	Common::FixedTimestep timestep(10, 100);
+
+	const Clock::time_point start = Clock::now();
+
+	// No tick is due right after starting
+	EXPECT_EQ(timestep.advance(), 0);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(35));
+
+	const size_t ticks = timestep.advance();
+	const size_t maxTicks = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count() / 10;
+
+	EXPECT_GE(ticks, 3);
+	EXPECT_LE(ticks, maxTicks);
+
+	// The due ticks have been consumed
+	EXPECT_LT(timestep.advance(), 2);
+}
+
+GTEST_TEST(FixedTimestep, maxTicks) {
+	Common::FixedTimestep timestep(1, 5);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+	// The backlog is dropped
+	EXPECT_EQ(timestep.advance(), 5);
+	EXPECT_LT(timestep.advance(), 2);
+}
+
+GTEST_TEST(FixedTimestep, waitForNextTick) {
+	Common::FixedTimestep timestep(10);
+
+	timestep.waitForNextTick();
+	EXPECT_EQ(timestep.advance(), 1);
+
+	const float interpolation = timestep.getInterpolation();
+	EXPECT_GE(interpolation, 0.0f);
+	EXPECT_LE(interpolation, 1.0f);
+}
+
+GTEST_TEST(FramePacer, wait) {
+	Common::FramePacer pacer(100);
+
+	const Clock::time_point start = Clock::now();
+
+	for (int i = 0; i < 5; i++)
+		pacer.wait();
+
+	EXPECT_GE(Clock::now() - start, std::chrono::milliseconds(50));
+}
+
+GTEST_TEST(FramePacer, unlimited) {
+	Common::FramePacer pacer;
+
+	const Clock::time_point start = Clock::now();
+
+	for (int i = 0; i < 100; i++)
+		pacer.wait();
+
+	EXPECT_LT(Clock::now() - start, std::chrono::milliseconds(50));
+}
@@ -0,0 +1,169 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our flat hash map.
+ */
+
+#include <map>
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/flathashmap.h"
+
+typedef Common::FlatHashMap<uint64_t, int> IntMap;
+
+GTEST_TEST(FlatHashMap, empty) {
+	IntMap map;
+
+	EXPECT_TRUE(map.empty());
+	EXPECT_EQ(map.size(), 0);
+
+	EXPECT_EQ(map.find(23), static_cast<int *>(0));
+	EXPECT_FALSE(map.contains(23));
+	EXPECT_FALSE(map.erase(23));
+
+	EXPECT_TRUE(map.begin() == map.end());
+}
+
+GTEST_TEST(FlatHashMap, insert) {
+	IntMap map;
+
+	map[23] = 42;
+	map[5]  = 7;
+
+	EXPECT_FALSE(map.empty());
+	EXPECT_EQ(map.size(), 2);
+
+	ASSERT_NE(map.find(23), static_cast<int *>(0));
+	EXPECT_EQ(*map.find(23), 42);
+
+	ASSERT_NE(map.find(5), static_cast<int *>(0));
+	EXPECT_EQ(*map.find(5), 7);
+
+	EXPECT_EQ(map.find(6), static_cast<int *>(0));
+
+	map[23] = 43;
+
+	EXPECT_EQ(map.size(), 2);
+	EXPECT_EQ(*map.find(23), 43);
+}
+
+GTEST_TEST(FlatHashMap, erase) {
+	IntMap map;
+
+	map[23] = 42;
+	map[5]  = 7;
+
+	EXPECT_TRUE(map.erase(23));
+	EXPECT_FALSE(map.erase(23));
+
+	EXPECT_EQ(map.size(), 1);
+	EXPECT_FALSE(map.contains(23));
+	EXPECT_TRUE(map.contains(5));
+
+	map.clear();
+
+	EXPECT_TRUE(map.empty());
+	EXPECT_FALSE(map.contains(5));
+}
+
+GTEST_TEST(FlatHashMap, reserve) {
+	IntMap map;
+
+	map.reserve(1000);
+
+	const size_t capacity = map.capacity();
+	EXPECT_GE(capacity, 1000);
+
+	for (uint64_t i = 0; i < 1000; i++)
+		map[i] = i;
+
+	EXPECT_EQ(map.capacity(), capacity);
+	EXPECT_EQ(map.size(), 1000);
+}
+
+GTEST_TEST(FlatHashMap, iterate) {
+	IntMap map;
+
+	for (uint64_t i = 0; i < 100; i++)
+		map[i * 3] = i;
+
+	size_t count = 0;
+	for (IntMap::const_iterator it = map.begin(); it != map.end(); ++it) {
+		EXPECT_EQ(it->key, static_cast<uint64_t>(it->value) * 3);
+		count++;
+	}
+
+	EXPECT_EQ(count, 100);
+}
+
+GTEST_TEST(FlatHashMap, collisions) {
+	/* Colliding keys that all share the same home slot, to make sure that
+	 * removing one in the middle of a probe sequence keeps the others
+	 * reachable. */
+	struct ZeroHash {
+		size_t operator()(uint64_t) const { return 0; }
+	};
+
+	Common::FlatHashMap<uint64_t, int, ZeroHash> map;
+
+	for (uint64_t i = 0; i < 10; i++)
+		map[i] = i;
+
+	EXPECT_TRUE(map.erase(4));
+	EXPECT_TRUE(map.erase(0));
+
+	for (uint64_t i = 0; i < 10; i++) {
+		if ((i == 0) || (i == 4)) {
+			EXPECT_FALSE(map.contains(i)) << i;
+			continue;
+		}
+
+		ASSERT_NE(map.find(i), static_cast<int *>(0)) << i;
+		EXPECT_EQ(*map.find(i), i) << i;
+	}
+}
+
+GTEST_TEST(FlatHashMap, random) {
+	/* Compare against std::map while randomly inserting and erasing. */
+	IntMap map;
+	std::map<uint64_t, int> reference;
+
+	uint64_t state = 1;
+	for (int i = 0; i < 20000; i++) {
+		state = state * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+
+		const uint64_t key = (state >> 33) % 2048;
+		if ((state >> 20) & 1) {
+			map[key] = i;
+			reference[key] = i;
+		} else
+			EXPECT_EQ(map.erase(key), reference.erase(key) == 1);
+	}
+
+	EXPECT_EQ(map.size(), reference.size());
+
+	for (std::map<uint64_t, int>::const_iterator r = reference.begin(); r != reference.end(); ++r) {
+		ASSERT_NE(map.find(r->first), static_cast<int *>(0)) << r->first;
+		EXPECT_EQ(*map.find(r->first), r->second) << r->first;
+	}
+}
@@ -0,0 +1,121 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our frame arena.
+ */
+
+#include <cstring>
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "src/common/framearena.h"
+#include "src/common/threadpool.h"
+
+GTEST_TEST(FrameArena, allocate) {
+	Common::FrameArena arena(1024);
+
+	EXPECT_EQ(arena.getCapacity(), 0);
+
+	byte *a = static_cast<byte *>(arena.allocate(10, 1));
+	byte *b = static_cast<byte *>(arena.allocate(10, 1));
+
+	EXPECT_EQ(b, a + 10);
+	EXPECT_EQ(arena.getCapacity(), 1024);
+}
+
+GTEST_TEST(FrameArena, alignment) {
+	Common::FrameArena arena(1024);
+
+	arena.allocate(3, 1);
+
+	for (size_t alignment = 1; alignment <= 256; alignment *= 2) {
+		void *data = arena.allocate(1, alignment);
+
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % alignment, 0) << "Alignment " << alignment;
+	}
+}
+
+GTEST_TEST(FrameArena, grow) {
+	Common::FrameArena arena(1024);
+
+	arena.allocate(1000, 1);
+	arena.allocate(1000, 1);
+	arena.allocate(5000, 1);
+
+	const size_t capacity = arena.getCapacity();
+	EXPECT_GE(capacity, 7000);
+
+	// After a reset, it all fits into one block
+	arena.reset();
+	EXPECT_EQ(arena.getCapacity(), capacity);
+
+	byte *a = static_cast<byte *>(arena.allocate(1000, 1));
+	byte *b = static_cast<byte *>(arena.allocate(1000, 1));
+	byte *c = static_cast<byte *>(arena.allocate(5000, 1));
+
+	EXPECT_EQ(b, a + 1000);
+	EXPECT_EQ(c, b + 1000);
+	EXPECT_EQ(arena.getCapacity(), capacity);
+}
+
+GTEST_TEST(FrameArena, reset) {
+	Common::FrameArena arena(1024);
+
+	void *a = arena.allocate(100, 1);
+	arena.reset();
+	void *b = arena.allocate(100, 1);
+
+	EXPECT_EQ(a, b);
+}
+
+GTEST_TEST(FrameArena, vector) {
+	Common::FrameArena arena(64);
+
+	Common::FrameVector<int> v((Common::FrameAllocator<int>(arena)));
+	for (int i = 0; i < 1000; i++)
+		v.push_back(i);
+
+	for (int i = 0; i < 1000; i++)
+		EXPECT_EQ(v[i], i) << "At index " << i;
+
+	Common::FrameVector<Common::FrameVector<int>> nested((Common::FrameAllocator<int>(arena)));
+	nested.resize(10, Common::FrameVector<int>(Common::FrameAllocator<int>(arena)));
+	nested[5].push_back(23);
+
+	EXPECT_EQ(nested[5].front(), 23);
+}
+
+GTEST_TEST(FrameArena, threads) {
+	Common::FrameArena arena(256);
+
+	std::vector<byte *> data(1000);
+	ThreadPoolMan.parallelFor(data.size(), [&arena, &data](size_t i) {
+		data[i] = static_cast<byte *>(arena.allocate(16, 1));
+
+		std::memset(data[i], (byte) i, 16);
+	});
+
+	for (size_t i = 0; i < data.size(); i++)
+		for (size_t j = 0; j < 16; j++)
+			EXPECT_EQ(data[i][j], (byte) i) << "At index " << i << "." << j;
+}
@@ -0,0 +1,106 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for the Frustum class.
+ */
+
+#include "external/glm/gtc/matrix_transform.hpp"
+
+#include "gtest/gtest.h"
+
+#include "src/common/frustum.h"
+#include "src/common/boundingbox.h"
+
+// A camera at the origin, looking down the negative z axis
+static Common::Frustum createFrustum() {
+	const glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 1.0f, 100.0f);
+
+	Common::Frustum frustum;
+	frustum.set(projection);
+
+	return frustum;
+}
+
+GTEST_TEST(Frustum, everything) {
+	const Common::Frustum frustum;
+
+	EXPECT_TRUE(frustum.isIn(glm::vec3(-1.0f, -1.0f, -1.0f), glm::vec3(1.0f, 1.0f, 1.0f)));
+	EXPECT_TRUE(frustum.isIn(glm::vec3(1000.0f, 1000.0f, 1000.0f), glm::vec3(1001.0f, 1001.0f, 1001.0f)));
+}
+
+GTEST_TEST(Frustum, inside) {
+	const Common::Frustum frustum = createFrustum();
+
+	EXPECT_TRUE(frustum.isIn(glm::vec3(-1.0f, -1.0f, -11.0f), glm::vec3(1.0f, 1.0f, -9.0f)));
+}
+
+GTEST_TEST(Frustum, intersecting) {
+	const Common::Frustum frustum = createFrustum();
+
+	// Straddling the left plane
+	EXPECT_TRUE(frustum.isIn(glm::vec3(-12.0f, -1.0f, -11.0f), glm::vec3(-9.0f, 1.0f, -9.0f)));
+	// Straddling the far plane
+	EXPECT_TRUE(frustum.isIn(glm::vec3(-1.0f, -1.0f, -101.0f), glm::vec3(1.0f, 1.0f, -99.0f)));
+	// Containing the whole frustum
+	EXPECT_TRUE(frustum.isIn(glm::vec3(-500.0f, -500.0f, -500.0f), glm::vec3(500.0f, 500.0f, 500.0f)));
+}
+
+GTEST_TEST(Frustum, outside) {
+	const Common::Frustum frustum = createFrustum();
+
+	// Behind the camera
+	EXPECT_FALSE(frustum.isIn(glm::vec3(-1.0f, -1.0f, 9.0f), glm::vec3(1.0f, 1.0f, 11.0f)));
+	// Left of the camera
+	EXPECT_FALSE(frustum.isIn(glm::vec3(-22.0f, -1.0f, -11.0f), glm::vec3(-20.0f, 1.0f, -9.0f)));
+	// Above the camera
+	EXPECT_FALSE(frustum.isIn(glm::vec3(-1.0f, 20.0f, -11.0f), glm::vec3(1.0f, 22.0f, -9.0f)));
+	// Beyond the far plane
+	EXPECT_FALSE(frustum.isIn(glm::vec3(-1.0f, -1.0f, -201.0f), glm::vec3(1.0f, 1.0f, -199.0f)));
+}
+
+GTEST_TEST(Frustum, camera) {
+	// A camera at (0, 0, 50), looking down the negative z axis
+	const glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 1.0f, 100.0f);
+	const glm::mat4 view       = glm::translate(glm::mat4(), glm::vec3(0.0f, 0.0f, -50.0f));
+
+	Common::Frustum frustum;
+	frustum.set(projection * view);
+
+	EXPECT_TRUE (frustum.isIn(glm::vec3(-1.0f, -1.0f, 39.0f), glm::vec3(1.0f, 1.0f, 41.0f)));
+	EXPECT_FALSE(frustum.isIn(glm::vec3(-1.0f, -1.0f, 59.0f), glm::vec3(1.0f, 1.0f, 61.0f)));
+}
+
+GTEST_TEST(Frustum, boundingBox) {
+	const Common::Frustum frustum = createFrustum();
+
+	Common::BoundingBox empty;
+	EXPECT_TRUE(frustum.isIn(empty));
+
+	Common::BoundingBox visible;
+	visible.add(-1.0f, -1.0f, -11.0f);
+	visible.add( 1.0f,  1.0f,  -9.0f);
+	EXPECT_TRUE(frustum.isIn(visible));
+
+	Common::BoundingBox behind;
+	behind.add(-1.0f, -1.0f,  9.0f);
+	behind.add( 1.0f,  1.0f, 11.0f);
+	EXPECT_FALSE(frustum.isIn(behind));
+}
@@ -125,3 +125,84 @@ GTEST_TEST(Geometry, intersectTriangleSegment2D) {
 	ASSERT_TRUE(Common::intersectTriangleSegment2D(pI, pJ, pD, pF, pF));
 	ASSERT_FALSE(Common::intersectTriangleSegment2D(pA, pC, pJ, pI, pD));
 }
+
+GTEST_TEST(Geometry, intersectRayTriangle) {
+	const glm::vec3 vA(0.f, 0.f, 0.f), vB(1.f, 0.f, 0.f), vC(0.f, 1.f, 0.f);
+
+	float distance = 0.f;
+	ASSERT_TRUE(Common::intersectRayTriangle(glm::vec3(0.25f, 0.25f, 1.f), glm::vec3(0.f, 0.f, -1.f),
+	                                         vA, vB, vC, distance));
+	EXPECT_FLOAT_EQ(distance, 1.f);
+
+	// Both sides, and anywhere along the line.
+	ASSERT_TRUE(Common::intersectRayTriangle(glm::vec3(0.25f, 0.25f, 2.f), glm::vec3(0.f, 0.f, 1.f),
+	                                         vA, vB, vC, distance));
+	EXPECT_FLOAT_EQ(distance, -2.f);
+
+	ASSERT_FALSE(Common::intersectRayTriangle(glm::vec3(0.75f, 0.75f, 1.f), glm::vec3(0.f, 0.f, -1.f),
+	                                          vA, vB, vC, distance));
+	// Parallel to the triangle.
+	ASSERT_FALSE(Common::intersectRayTriangle(glm::vec3(0.25f, 0.25f, 0.f), glm::vec3(1.f, 0.f, 0.f),
+	                                          vA, vB, vC, distance));
+}
+
+GTEST_TEST(Geometry, intersectRayTriangles) {
+	const glm::vec3 vA[] = { glm::vec3(0.f, 0.f, 0.f), glm::vec3(2.f, 0.f, 3.f), glm::vec3(0.f, 0.f, 0.f), glm::vec3(0.f, 0.f, 5.f) };
+	const glm::vec3 vB[] = { glm::vec3(1.f, 0.f, 0.f), glm::vec3(3.f, 0.f, 3.f), glm::vec3(1.f, 0.f, 0.f), glm::vec3(1.f, 0.f, 5.f) };
+	const glm::vec3 vC[] = { glm::vec3(0.f, 1.f, 0.f), glm::vec3(2.f, 1.f, 3.f), glm::vec3(1.f, 0.f, 1.f), glm::vec3(0.f, 1.f, 5.f) };
+
+	const glm::vec3 origin(0.25f, 0.25f, 1.f);
+	const glm::vec3 direction(0.f, 0.f, -1.f);
+
+	float distances[Common::kIntersectBatchSize];
+	ASSERT_EQ(Common::intersectRayTriangles(origin, direction, vA, vB, vC, 4, distances), 0x9);
+	EXPECT_FLOAT_EQ(distances[0],  1.f);
+	EXPECT_FLOAT_EQ(distances[3], -4.f);
+
+	// Lanes past the count are never hit.
+	ASSERT_EQ(Common::intersectRayTriangles(origin, direction, vA, vB, vC, 3, distances), 0x1);
+
+	// The same as testing each triangle on its own.
+	for (size_t i = 0; i < 4; i++) {
+		float distance;
+		const bool hit = Common::intersectRayTriangle(origin, direction, vA[i], vB[i], vC[i], distance);
+		ASSERT_EQ(hit, ((Common::intersectRayTriangles(origin, direction, vA, vB, vC, 4, distances) >> i) & 1) != 0);
+	}
+}
+
+GTEST_TEST(Geometry, intersectSegmentBoxes) {
+	const glm::vec3 min[] = { glm::vec3(0.f, 0.f, 0.f), glm::vec3(5.f, 5.f, 5.f), glm::vec3(0.4f, 0.2f, -1.f) };
+	const glm::vec3 max[] = { glm::vec3(1.f, 1.f, 1.f), glm::vec3(6.f, 6.f, 6.f), glm::vec3(0.6f, 0.3f,  1.f) };
+
+	// Diagonal through the first box, stopping short of the second.
+	ASSERT_EQ(Common::intersectSegmentBoxes(glm::vec3(-1.f, -1.f, -1.f), glm::vec3(2.f, 2.f, 2.f), min, max, 3), 0x1);
+	// Reaching the second box.
+	ASSERT_EQ(Common::intersectSegmentBoxes(glm::vec3(-1.f, -1.f, -1.f), glm::vec3(5.5f, 5.5f, 5.5f), min, max, 3), 0x3);
+	// Along an axis, through the first and the third box.
+	ASSERT_EQ(Common::intersectSegmentBoxes(glm::vec3(0.5f, 0.25f, 5.f), glm::vec3(0.5f, 0.25f, -5.f), min, max, 3), 0x5);
+	// Starting inside the second box.
+	ASSERT_EQ(Common::intersectSegmentBoxes(glm::vec3(5.5f, 5.5f, 5.5f), glm::vec3(5.6f, 5.5f, 5.5f), min, max, 3), 0x2);
+	// Missing everything.
+	ASSERT_EQ(Common::intersectSegmentBoxes(glm::vec3(2.f, 0.f, 0.f), glm::vec3(4.f, 0.f, 0.f), min, max, 3), 0x0);
+}
+
+GTEST_TEST(Geometry, intersectSegmentTriangles2D) {
+	const glm::vec2 vA[] = { pD, pI, pA, pA };
+	const glm::vec2 vB[] = { pJ, pJ, pC, pI };
+	const glm::vec2 vC[] = { pI, pD, pJ, pJ };
+
+	const glm::vec2 start[] = { pA, pF, pI };
+	const glm::vec2 end  [] = { pF, pF, pD };
+
+	for (size_t s = 0; s < 3; s++) {
+		uint32_t expected = 0;
+		for (size_t i = 0; i < 4; i++)
+			if (Common::intersectTriangleSegment2D(vA[i], vB[i], vC[i], start[s], end[s]))
+				expected |= 1u << i;
+
+		ASSERT_EQ(Common::intersectSegmentTriangles2D(start[s], end[s], vA, vB, vC, 4), expected);
+	}
+
+	// A segment past the corner of a triangle's bounding box, but not the triangle.
+	ASSERT_EQ(Common::intersectSegmentTriangles2D(glm::vec2(0.6f, 1.2f), glm::vec2(1.2f, 0.6f), vA + 3, vB + 3, vC + 3, 1), 0x0);
+}
@@ -63,3 +63,29 @@ GTEST_TEST(Hash, CRC32Encoding) {
 GTEST_TEST(Hash, formatHash) {
 	EXPECT_STREQ(Common::formatHash(UINT64_C(0x1234567890ABCDEF)).c_str(), "0x1234567890ABCDEF");
 }
+
+GTEST_TEST(Hash, FNV64Value) {
+	uint64_t bytes = Common::kFNV64OffsetBasis;
+	for (uint32_t i = 1; i <= 8; i++)
+		bytes = Common::hashFNV64(bytes, i);
+
+	const uint64_t low  = Common::hashFNV64Value(Common::kFNV64OffsetBasis, (uint32_t) 0x04030201);
+	const uint64_t both = Common::hashFNV64Value(low, (uint32_t) 0x08070605);
+
+	EXPECT_EQ(both, bytes);
+	EXPECT_EQ(Common::hashFNV64Value(Common::kFNV64OffsetBasis, UINT64_C(0x0807060504030201)), bytes);
+}
+
+GTEST_TEST(Hash, FNV64Stream) {
+	static const byte kData[] = { 'F', 'o', 'o', 'b', 'a', 'r' };
+
+	Common::MemoryReadStream stream(kData);
+	stream.skip(2);
+
+	uint64_t hash = Common::hashFNV64Value(Common::kFNV64OffsetBasis, (uint32_t) sizeof(kData));
+	for (size_t i = 0; i < sizeof(kData); i++)
+		hash = Common::hashFNV64(hash, kData[i]);
+
+	EXPECT_EQ(Common::hashStreamFNV64(stream), hash);
+	EXPECT_EQ(stream.pos(), 2);
+}
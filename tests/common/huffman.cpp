@@ -22,6 +22,8 @@
  *  Unit tests for our Huffman decoder.
  */
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "src/common/huffman.h"
@@ -120,3 +122,83 @@ GTEST_TEST(Huffman, invalidSymbol) {
 
 	EXPECT_THROW(huffman.getSymbol(bitStream), Common::Exception);
 }
+
+/** Canonical codes of the lengths 1 to 12, with two codes of length 12. */
+static const size_t kLongCodeCount = 13;
+
+static void createLongCodes(uint32_t (&codes)[kLongCodeCount], uint8_t (&lengths)[kLongCodeCount], bool reverse) {
+	for (size_t i = 0; i < kLongCodeCount; i++) {
+		lengths[i] = MIN<size_t>(i + 1, 12);
+		codes  [i] = (i < 12) ? ((1 << lengths[i]) - 2) : 0xFFF;
+
+		if (reverse) {
+			uint32_t reversed = 0;
+			for (size_t j = 0; j < lengths[i]; j++)
+				reversed |= ((codes[i] >> j) & 1) << (lengths[i] - 1 - j);
+
+			codes[i] = reversed;
+		}
+	}
+}
+
+/** Encode a few of the long codes into bytes, with bits read MSB to LSB or LSB to MSB. */
+static std::vector<byte> encodeLongCodes(const std::vector<uint32_t> &symbols, bool msbFirst) {
+	uint32_t codes[kLongCodeCount];
+	uint8_t  lengths[kLongCodeCount];
+	createLongCodes(codes, lengths, false);
+
+	std::vector<byte> data;
+
+	size_t bitCount = 0;
+	for (std::vector<uint32_t>::const_iterator s = symbols.begin(); s != symbols.end(); ++s) {
+		for (size_t i = 0; i < lengths[*s]; i++, bitCount++) {
+			if ((bitCount % 8) == 0)
+				data.push_back(0);
+
+			const byte bit = (codes[*s] >> (lengths[*s] - 1 - i)) & 1;
+			data.back() |= msbFirst ? (bit << (7 - (bitCount % 8))) : (bit << (bitCount % 8));
+		}
+	}
+
+	return data;
+}
+
+static void testLongCodes(Common::BitStream &bitStream, const Common::Huffman &huffman,
+                          const std::vector<uint32_t> &symbols) {
+
+	for (size_t i = 0; i < symbols.size(); i++)
+		EXPECT_EQ(huffman.getSymbol(bitStream), symbols[i]) << "At index " << i;
+}
+
+GTEST_TEST(Huffman, longCodes) {
+	std::vector<uint32_t> symbols;
+	for (size_t i = 0; i < 100; i++)
+		symbols.push_back((i * 7) % kLongCodeCount);
+
+	uint32_t codes[kLongCodeCount];
+	uint8_t  lengths[kLongCodeCount];
+
+	createLongCodes(codes, lengths, false);
+	const Common::Huffman huffmanMSB(0, kLongCodeCount, codes, lengths);
+
+	createLongCodes(codes, lengths, true);
+	const Common::Huffman huffmanLSB(0, kLongCodeCount, codes, lengths);
+
+	const std::vector<byte> dataMSB = encodeLongCodes(symbols, true);
+	const std::vector<byte> dataLSB = encodeLongCodes(symbols, false);
+
+	Common::MemoryReadStream streamMSB(dataMSB.data(), dataMSB.size());
+	Common::MemoryReadStream streamLSB(dataLSB.data(), dataLSB.size());
+
+	Common::BitStream8MSB bitStreamMSB(streamMSB);
+	testLongCodes(bitStreamMSB, huffmanMSB, symbols);
+
+	Common::BitStream8LSB bitStreamLSB(streamLSB);
+	testLongCodes(bitStreamLSB, huffmanLSB, symbols);
+
+	Common::MemoryBitStream8MSB memoryBitStreamMSB(dataMSB.data(), dataMSB.size());
+	testLongCodes(memoryBitStreamMSB, huffmanMSB, symbols);
+
+	Common::MemoryBitStream8LSB memoryBitStreamLSB(dataLSB.data(), dataLSB.size());
+	testLongCodes(memoryBitStreamLSB, huffmanLSB, symbols);
+}
@@ -0,0 +1,84 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for the case-insensitive string key.
+ */
+
+#include "gtest/gtest.h"
+
+#include "src/common/istringkey.h"
+#include "src/common/flathashmap.h"
+
+GTEST_TEST(IStringKey, equals) {
+	const Common::IStringKey key1("Foobar");
+	const Common::IStringKey key2("fOOBAR");
+	const Common::IStringKey key3("Barfoo");
+
+	EXPECT_TRUE(key1 == key2);
+	EXPECT_FALSE(key1 == key3);
+	EXPECT_TRUE(key1 != key3);
+
+	EXPECT_EQ(key1.getHash(), key2.getHash());
+}
+
+GTEST_TEST(IStringKey, keepCase) {
+	const Common::IStringKey key(Common::UString("FooBar"));
+
+	EXPECT_STREQ(key.getString().c_str(), "FooBar");
+}
+
+GTEST_TEST(IStringKey, map) {
+	Common::IStringKeyMap<int> map;
+
+	map.insert(std::make_pair(Common::UString("Foo"), 1));
+	map.insert(std::make_pair(Common::UString("Bar"), 2));
+
+	EXPECT_FALSE(map.insert(std::make_pair(Common::UString("FOO"), 3)).second);
+
+	ASSERT_NE(map.find("fOo"), map.end());
+	EXPECT_EQ(map.find("fOo")->second, 1);
+	EXPECT_STREQ(map.find("fOo")->first.getString().c_str(), "Foo");
+
+	ASSERT_NE(map.find("bar"), map.end());
+	EXPECT_EQ(map.find("bar")->second, 2);
+
+	EXPECT_EQ(map.find("Foobar"), map.end());
+}
+
+GTEST_TEST(IStringKey, set) {
+	Common::IStringKeySet set;
+
+	set.insert("Foo");
+
+	EXPECT_EQ(set.count("FOO"), 1);
+	EXPECT_EQ(set.count("Bar"), 0);
+}
+
+GTEST_TEST(IStringKey, flatHashMap) {
+	Common::FlatHashMap<Common::IStringKey, size_t, Common::IStringKey::Hash> map;
+
+	map["Foo"] = 1;
+
+	ASSERT_NE(map.find("fOO"), nullptr);
+	EXPECT_EQ(*map.find("fOO"), 1);
+	EXPECT_TRUE(map.contains("FOO"));
+	EXPECT_FALSE(map.contains("Bar"));
+}
@@ -0,0 +1,166 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our background log file writer.
+ */
+
+#include <string>
+#include <vector>
+#include <thread>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/platform.h"
+#include "src/common/ustring.h"
+#include "src/common/thread.h"
+#include "src/common/logwriter.h"
+
+boost::filesystem::path kFilePath;
+
+class LogWriter : public ::testing::Test {
+protected:
+	static void SetUpTestCase() {
+		Common::Platform::init();
+
+		boost::filesystem::path tmpPath    = boost::filesystem::temp_directory_path();
+		boost::filesystem::path uniquePath = boost::filesystem::unique_path("%%%%_%%%%_%%%%_%%%%.xoreos");
+
+		kFilePath = tmpPath / uniquePath;
+	}
+
+	static void TearDownTestCase() {
+		if (!kFilePath.empty())
+			boost::filesystem::remove(kFilePath);
+	}
+
+	void SetUp() {
+		if (!kFilePath.empty())
+			boost::filesystem::remove(kFilePath);
+	}
+};
+
+static void readLines(std::vector<std::string> &lines) {
+	boost::filesystem::ifstream file(kFilePath);
+
+	std::string line;
+	while (std::getline(file, line))
+		lines.push_back(line);
+}
+
+GTEST_TEST_F(LogWriter, write) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	Common::LogWriter log;
+	EXPECT_FALSE(log.isOpen());
+
+	ASSERT_TRUE(log.open(kFilePath.generic_string()));
+	EXPECT_TRUE(log.isOpen());
+
+	log.write("Foo\n");
+	log.write("Bar\n");
+
+	log.close();
+	EXPECT_FALSE(log.isOpen());
+
+	std::vector<std::string> lines;
+	readLines(lines);
+
+	ASSERT_EQ(lines.size(), 2);
+
+	// "[seconds.microseconds] text"
+	ASSERT_EQ(lines[0].size(), 19);
+	EXPECT_EQ(lines[0][0], '[');
+	EXPECT_EQ(lines[0][7], '.');
+	EXPECT_EQ(lines[0].substr(14), "] Foo");
+
+	ASSERT_EQ(lines[1].size(), 19);
+	EXPECT_EQ(lines[1].substr(14), "] Bar");
+
+	// The timestamps are monotonic
+	EXPECT_LE(lines[0].substr(0, 14), lines[1].substr(0, 14));
+}
+
+GTEST_TEST_F(LogWriter, writeClosed) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	Common::LogWriter log;
+
+	ASSERT_TRUE(log.open(kFilePath.generic_string()));
+	log.close();
+
+	// Lines written after closing the log don't show up
+	log.write("Foo\n");
+
+	std::vector<std::string> lines;
+	readLines(lines);
+
+	EXPECT_TRUE(lines.empty());
+}
+
+GTEST_TEST_F(LogWriter, threadNames) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	static const size_t kThreadCount = 4;
+	static const size_t kLineCount   = 1000;
+
+	Common::LogWriter log;
+	ASSERT_TRUE(log.open(kFilePath.generic_string()));
+
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i < kThreadCount; i++) {
+		threads.emplace_back([&log, i]() {
+			Common::Thread::setCurrentThreadName(Common::UString::format("Thread%u", (uint)i));
+
+			for (size_t j = 0; j < kLineCount; j++)
+				log.write(Common::UString::format("%u\n", (uint)j));
+		});
+	}
+
+	for (std::vector<std::thread>::iterator t = threads.begin(); t != threads.end(); ++t)
+		t->join();
+
+	log.close();
+
+	std::vector<std::string> lines;
+	readLines(lines);
+
+	ASSERT_EQ(lines.size(), kThreadCount * kLineCount);
+
+	// Each thread's lines are complete and in the order it wrote them
+	std::vector<size_t> next(kThreadCount, 0);
+	for (size_t i = 0; i < lines.size(); i++) {
+		const std::string::size_type nameStart = lines[i].find("] [Thread");
+		ASSERT_NE(nameStart, std::string::npos) << "At index " << i;
+
+		const size_t thread = lines[i][nameStart + 9] - '0';
+		ASSERT_LT(thread, kThreadCount) << "At index " << i;
+
+		EXPECT_EQ(lines[i].substr(nameStart + 12), std::to_string(next[thread])) << "At index " << i;
+		next[thread]++;
+	}
+
+	for (size_t i = 0; i < kThreadCount; i++)
+		EXPECT_EQ(next[i], kLineCount) << "At thread " << i;
+}
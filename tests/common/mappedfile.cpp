@@ -0,0 +1,136 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our memory-mapped file stream.
+ */
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/platform.h"
+#include "src/common/memreadstream.h"
+#include "src/common/readfile.h"
+#include "src/common/mappedfile.h"
+
+boost::filesystem::path kFilePath;
+
+static const byte kData[] = { 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+
+class MappedFile : public ::testing::Test {
+protected:
+	static void SetUpTestCase() {
+		Common::Platform::init();
+
+		boost::filesystem::path tmpPath    = boost::filesystem::temp_directory_path();
+		boost::filesystem::path uniquePath = boost::filesystem::unique_path("%%%%_%%%%_%%%%_%%%%.xoreos");
+
+		kFilePath = tmpPath / uniquePath;
+
+		boost::filesystem::ofstream file(kFilePath, std::ios::binary);
+		file.write(reinterpret_cast<const char *>(kData), sizeof(kData));
+	}
+
+	static void TearDownTestCase() {
+		if (!kFilePath.empty())
+			boost::filesystem::remove(kFilePath);
+	}
+};
+
+GTEST_TEST_F(MappedFile, read) {
+	Common::MappedReadStream stream(kFilePath.generic_string());
+
+	ASSERT_EQ(stream.size(), sizeof(kData));
+
+	for (size_t i = 0; i < sizeof(kData); i++)
+		EXPECT_EQ(stream.readByte(), kData[i]) << "At index " << i;
+
+	EXPECT_THROW(stream.readByte(), Common::Exception);
+	EXPECT_TRUE(stream.eos());
+}
+
+GTEST_TEST_F(MappedFile, view) {
+	Common::MappedReadStream *view = 0;
+
+	{
+		Common::MappedReadStream stream(kFilePath.generic_string());
+
+		view = stream.viewStream(2, 4);
+	}
+
+	// The view keeps the mapping alive
+	std::unique_ptr<Common::MappedReadStream> viewStream(view);
+	ASSERT_EQ(viewStream->size(), 4);
+
+	for (size_t i = 0; i < 4; i++)
+		EXPECT_EQ(viewStream->readByte(), kData[2 + i]) << "At index " << i;
+
+	EXPECT_EQ(viewStream->getData()[0], kData[2]);
+}
+
+GTEST_TEST_F(MappedFile, viewRange) {
+	Common::MappedReadStream stream(kFilePath.generic_string());
+
+	EXPECT_THROW(stream.viewStream(0, 9), Common::Exception);
+	EXPECT_THROW(stream.viewStream(9, 0), Common::Exception);
+
+	std::unique_ptr<Common::MappedReadStream> empty(stream.viewStream(8, 0));
+	EXPECT_EQ(empty->size(), 0);
+}
+
+GTEST_TEST_F(MappedFile, viewStatic) {
+	Common::MappedReadStream mapped(kFilePath.generic_string());
+
+	std::unique_ptr<Common::MappedReadStream> view(Common::MappedReadStream::viewStream(mapped, 1, 2));
+	ASSERT_TRUE(view);
+	EXPECT_EQ(view->readByte(), kData[1]);
+
+	Common::MemoryReadStream memory(kData);
+	EXPECT_EQ(Common::MappedReadStream::viewStream(memory, 1, 2), static_cast<Common::MappedReadStream *>(0));
+
+	Common::ReadFile file(kFilePath.generic_string());
+	EXPECT_EQ(Common::MappedReadStream::viewStream(file, 1, 2), static_cast<Common::MappedReadStream *>(0));
+}
+
+GTEST_TEST_F(MappedFile, readView) {
+	Common::MappedReadStream mapped(kFilePath.generic_string());
+
+	std::unique_ptr<Common::MemoryReadStream> view(Common::MappedReadStream::readView(mapped, 1, 2));
+	ASSERT_EQ(view->size(), 2);
+	EXPECT_EQ(view->getData(), mapped.getData() + 1);
+
+	// Streams that aren't mapped are copied from
+	Common::MemoryReadStream memory(kData);
+
+	std::unique_ptr<Common::MemoryReadStream> copy(Common::MappedReadStream::readView(memory, 3, 2));
+	ASSERT_EQ(copy->size(), 2);
+	EXPECT_EQ(copy->readByte(), kData[3]);
+	EXPECT_EQ(copy->readByte(), kData[4]);
+
+	EXPECT_THROW(Common::MappedReadStream::readView(memory, 7, 2), Common::Exception);
+}
+
+GTEST_TEST_F(MappedFile, missing) {
+	EXPECT_THROW(Common::MappedReadStream((kFilePath / "nope").generic_string()), Common::Exception);
+}
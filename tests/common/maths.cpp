@@ -63,3 +63,48 @@ GTEST_TEST(Maths, rad2deg) {
 	EXPECT_FLOAT_EQ(Common::rad2deg( M_PI * 2.0f),  360.0f);
 	EXPECT_FLOAT_EQ(Common::rad2deg(-M_PI * 2.0f), -360.0f);
 }
+
+static void testPackQuaternion(float x, float y, float z, float w) {
+	const float magnitude = sqrtf(x * x + y * y + z * z + w * w);
+	x /= magnitude;
+	y /= magnitude;
+	z /= magnitude;
+	w /= magnitude;
+
+	uint16_t packed[3];
+	Common::packQuaternion(x, y, z, w, packed);
+
+	float uX, uY, uZ, uW;
+	Common::unpackQuaternion(packed, uX, uY, uZ, uW);
+
+	// q and -q are the same rotation
+	const float sign = ((x * uX + y * uY + z * uZ + w * uW) < 0.0f) ? -1.0f : 1.0f;
+
+	EXPECT_NEAR(sign * uX, x, 1e-4f);
+	EXPECT_NEAR(sign * uY, y, 1e-4f);
+	EXPECT_NEAR(sign * uZ, z, 1e-4f);
+	EXPECT_NEAR(sign * uW, w, 1e-4f);
+}
+
+GTEST_TEST(Maths, packQuaternion) {
+	testPackQuaternion( 0.0f,  0.0f,  0.0f,  1.0f);
+	testPackQuaternion( 1.0f,  0.0f,  0.0f,  0.0f);
+	testPackQuaternion( 0.0f, -1.0f,  0.0f,  0.0f);
+	testPackQuaternion( 0.0f,  0.0f,  1.0f,  1.0f);
+	testPackQuaternion( 0.5f, -0.5f,  0.5f, -0.5f);
+	testPackQuaternion( 0.1f,  0.2f, -0.9f,  0.3f);
+	testPackQuaternion(-0.7f,  0.1f,  0.1f,  0.7f);
+}
+
+GTEST_TEST(Maths, packQuaternionUnnormalized) {
+	uint16_t packed[3];
+	Common::packQuaternion(0.0f, 0.0f, 0.0f, 2.0f, packed);
+
+	float x, y, z, w;
+	Common::unpackQuaternion(packed, x, y, z, w);
+
+	EXPECT_NEAR(x, 0.0f, 1e-4f);
+	EXPECT_NEAR(y, 0.0f, 1e-4f);
+	EXPECT_NEAR(z, 0.0f, 1e-4f);
+	EXPECT_NEAR(w, 1.0f, 1e-4f);
+}
@@ -77,6 +77,33 @@ GTEST_TEST(MD5, hashStream) {
 	Common::MemoryReadStream stream(kData);
 	Common::hashMD5(stream, digest);
 
+	compareData(digest, kDigestData);
+	EXPECT_TRUE(stream.eos());
+}
+
+GTEST_TEST(MD5, hashStreamPartial) {
+	std::vector<byte> digest;
+
+	// Only the rest of the stream is hashed
+	static const byte kPrefixedData[] = { 'x', 0x12, 0x34, 0x56, 0x78, 0x90, 0xAB, 0xCD, 0xEF };
+
+	Common::MemoryReadStream stream(kPrefixedData);
+	stream.skip(1);
+
+	Common::hashMD5(stream, digest);
+
+	compareData(digest, kDigestData);
+}
+
+GTEST_TEST(MD5, hashSubStream) {
+	std::vector<byte> digest;
+
+	// Not a memory stream, so it's read in chunks
+	Common::MemoryReadStream parent(kData);
+	Common::SeekableSubReadStream stream(&parent, 0, sizeof(kData));
+
+	Common::hashMD5(stream, digest);
+
 	compareData(digest, kDigestData);
 }
 
@@ -0,0 +1,127 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our non-virtual memory reader.
+ */
+
+#include "gtest/gtest.h"
+
+#include "src/common/memreader.h"
+#include "src/common/memreadstream.h"
+#include "src/common/error.h"
+
+static const byte kData[] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+	0x00, 0x00, 0x80, 0x3F, 0x3F, 0x80, 0x00, 0x00
+};
+
+GTEST_TEST(MemoryReader, readLE) {
+	Common::MemoryReader reader(kData, sizeof(kData));
+
+	EXPECT_EQ(reader.readByte(), 0x01);
+	EXPECT_EQ(reader.readUint16LE(), 0x0302);
+	EXPECT_EQ(reader.pos(), 3);
+
+	reader.seek(0);
+	EXPECT_EQ(reader.readUint32LE(), 0x04030201);
+	EXPECT_EQ(reader.readUint32LE(), 0x08070605);
+
+	reader.seek(0);
+	EXPECT_EQ(reader.readUint64LE(), UINT64_C(0x0807060504030201));
+
+	EXPECT_FLOAT_EQ(reader.readIEEEFloatLE(), 1.0f);
+	EXPECT_FALSE(reader.eos());
+}
+
+GTEST_TEST(MemoryReader, readBE) {
+	Common::MemoryReader reader(kData, sizeof(kData));
+
+	EXPECT_EQ(reader.readUint16BE(), 0x0102);
+
+	reader.seek(0);
+	EXPECT_EQ(reader.readUint32BE(), 0x01020304);
+
+	reader.seek(0);
+	EXPECT_EQ(reader.readUint64BE(), UINT64_C(0x0102030405060708));
+
+	reader.skip(4);
+	EXPECT_FLOAT_EQ(reader.readIEEEFloatBE(), 1.0f);
+	EXPECT_TRUE(reader.eos());
+}
+
+GTEST_TEST(MemoryReader, readBlock) {
+	Common::MemoryReader reader(kData, sizeof(kData));
+
+	Common::MemoryReader::Block block = reader.readBlock(8);
+	EXPECT_EQ(reader.pos(), 8);
+
+	EXPECT_EQ(block.size(), 8);
+	EXPECT_EQ(block.readUint16LE(), 0x0201);
+	EXPECT_EQ(block.readUint16BE(), 0x0304);
+	EXPECT_EQ(block.size(), 4);
+	EXPECT_EQ(block.readUint32LE(), 0x08070605);
+	EXPECT_EQ(block.size(), 0);
+}
+
+GTEST_TEST(MemoryReader, bounds) {
+	Common::MemoryReader reader(kData, sizeof(kData));
+
+	reader.seek(14);
+	EXPECT_THROW(reader.readUint32LE(), Common::Exception);
+	EXPECT_EQ(reader.pos(), 14);
+	EXPECT_EQ(reader.readUint16LE(), 0x0000);
+
+	EXPECT_THROW(reader.readByte(), Common::Exception);
+	EXPECT_THROW(reader.readBlock(1), Common::Exception);
+	EXPECT_THROW(reader.seek(sizeof(kData) + 1), Common::Exception);
+	EXPECT_THROW(reader.skip(1), Common::Exception);
+}
+
+GTEST_TEST(MemoryReader, memoryStream) {
+	Common::MemoryReadStream stream(kData);
+	stream.seek(4);
+
+	Common::MemoryReader reader(stream);
+
+	// Reads the stream's data directly
+	EXPECT_EQ(reader.getData(), kData);
+	EXPECT_EQ(reader.size(), sizeof(kData));
+	EXPECT_EQ(reader.pos(), 4);
+
+	EXPECT_EQ(reader.readUint32LE(), 0x08070605);
+	EXPECT_EQ(stream.pos(), 4);
+}
+
+GTEST_TEST(MemoryReader, otherStream) {
+	Common::MemoryReadStream parent(kData);
+	Common::SeekableSubReadStream stream(&parent, 4, 12);
+	stream.seek(4);
+
+	Common::MemoryReader reader(stream);
+
+	// Reads a copy of the stream's data
+	EXPECT_NE(reader.getData(), kData + 4);
+	EXPECT_EQ(reader.size(), 8);
+	EXPECT_EQ(reader.pos(), 4);
+
+	EXPECT_FLOAT_EQ(reader.readIEEEFloatLE(), 1.0f);
+	EXPECT_EQ(stream.pos(), 4);
+}
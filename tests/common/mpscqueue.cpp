@@ -0,0 +1,147 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our lock-free multi-producer, single-consumer queue.
+ */
+
+#include <vector>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "src/common/mpscqueue.h"
+
+GTEST_TEST(MPSCQueue, capacity) {
+	Common::MPSCQueue<int> queue1(1);
+	Common::MPSCQueue<int> queue8(8);
+	Common::MPSCQueue<int> queue9(9);
+
+	EXPECT_EQ(queue1.getCapacity(), 2);
+	EXPECT_EQ(queue8.getCapacity(), 8);
+	EXPECT_EQ(queue9.getCapacity(), 16);
+}
+
+GTEST_TEST(MPSCQueue, order) {
+	Common::MPSCQueue<int> queue(8);
+
+	EXPECT_TRUE(queue.isEmpty());
+
+	for (int i = 0; i < 5; i++)
+		EXPECT_TRUE(queue.push(i));
+
+	EXPECT_FALSE(queue.isEmpty());
+
+	int item = -1;
+	for (int i = 0; i < 5; i++) {
+		EXPECT_TRUE(queue.pop(item));
+		EXPECT_EQ(item, i);
+	}
+
+	EXPECT_FALSE(queue.pop(item));
+	EXPECT_TRUE(queue.isEmpty());
+}
+
+GTEST_TEST(MPSCQueue, full) {
+	Common::MPSCQueue<int> queue(4);
+
+	for (int i = 0; i < 4; i++)
+		EXPECT_TRUE(queue.push(i));
+
+	EXPECT_FALSE(queue.push(4));
+
+	int item = -1;
+	EXPECT_TRUE(queue.pop(item));
+	EXPECT_EQ(item, 0);
+
+	EXPECT_TRUE(queue.push(4));
+	EXPECT_FALSE(queue.push(5));
+}
+
+GTEST_TEST(MPSCQueue, wrapAround) {
+	Common::MPSCQueue<int> queue(4);
+
+	int item = -1;
+	for (int i = 0; i < 100; i++) {
+		EXPECT_TRUE(queue.push(i));
+		EXPECT_TRUE(queue.push(i + 1000));
+
+		EXPECT_TRUE(queue.pop(item));
+		EXPECT_EQ(item, i);
+		EXPECT_TRUE(queue.pop(item));
+		EXPECT_EQ(item, i + 1000);
+	}
+
+	EXPECT_TRUE(queue.isEmpty());
+}
+
+GTEST_TEST(MPSCQueue, clear) {
+	Common::MPSCQueue<int> queue(4);
+
+	queue.push(1);
+	queue.push(2);
+	queue.clear();
+
+	EXPECT_TRUE(queue.isEmpty());
+
+	EXPECT_TRUE(queue.push(3));
+
+	int item = -1;
+	EXPECT_TRUE(queue.pop(item));
+	EXPECT_EQ(item, 3);
+}
+
+GTEST_TEST(MPSCQueue, producers) {
+	static const int kProducerCount = 4;
+	static const int kItemCount     = 10000;
+
+	Common::MPSCQueue<int> queue(64);
+
+	std::vector<std::thread> producers;
+	for (int p = 0; p < kProducerCount; p++) {
+		producers.emplace_back([&queue, p]() {
+			for (int i = 0; i < kItemCount; i++)
+				while (!queue.push(p * kItemCount + i))
+					std::this_thread::yield();
+		});
+	}
+
+	// Items of each producer need to arrive in the order they were pushed
+	std::vector<int> next(kProducerCount, 0);
+
+	for (int received = 0; received < (kProducerCount * kItemCount); ) {
+		int item;
+		if (!queue.pop(item)) {
+			std::this_thread::yield();
+			continue;
+		}
+
+		const int producer = item / kItemCount;
+		ASSERT_EQ(item % kItemCount, next[producer]);
+
+		next[producer]++;
+		received++;
+	}
+
+	for (std::thread &producer : producers)
+		producer.join();
+
+	EXPECT_TRUE(queue.isEmpty());
+}
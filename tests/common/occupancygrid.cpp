@@ -0,0 +1,146 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for the persistent occupancy grid.
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "src/common/occupancygrid.h"
+
+struct Triangle {
+	glm::vec3 a, b, c;
+	bool allHeights;
+};
+
+/** A grid of 1x1 cells in 4x4 tiles, with 2 units high layers, over a list of triangles. */
+class TestGrid {
+public:
+	std::vector<Triangle> triangles;
+	size_t fills;
+
+	TestGrid() : fills(0), _grid(1.0f, 4, 2.0f, [this](const glm::vec2 &, const glm::vec2 &) {
+		fills++;
+
+		for (std::vector<Triangle>::const_iterator t = triangles.begin(); t != triangles.end(); ++t)
+			_grid.addTriangle(t->a, t->b, t->c, t->allHeights);
+	}) {
+	}
+
+	Common::OccupancyGrid &grid() { return _grid; }
+
+private:
+	Common::OccupancyGrid _grid;
+};
+
+GTEST_TEST(OccupancyGrid, empty) {
+	TestGrid test;
+
+	EXPECT_FALSE(test.grid().isBlocked(glm::vec2(-10.0f, -10.0f), glm::vec2(10.0f, 10.0f), -100.0f, 100.0f));
+	EXPECT_EQ(test.fills, 36);
+}
+
+GTEST_TEST(OccupancyGrid, triangle) {
+	TestGrid test;
+
+	test.triangles.push_back({ glm::vec3(0.5f, 0.5f, 0.0f), glm::vec3(2.5f, 0.5f, 0.0f), glm::vec3(0.5f, 2.5f, 0.0f), false });
+
+	EXPECT_TRUE (test.grid().isBlocked(glm::vec2(0.2f, 0.2f), glm::vec2(0.8f, 0.8f), -1.0f, 1.0f));
+	EXPECT_TRUE (test.grid().isBlocked(glm::vec2(1.2f, 1.2f), glm::vec2(1.8f, 1.8f), -1.0f, 1.0f));
+	EXPECT_FALSE(test.grid().isBlocked(glm::vec2(2.2f, 2.2f), glm::vec2(2.8f, 2.8f), -1.0f, 1.0f));
+	EXPECT_FALSE(test.grid().isBlocked(glm::vec2(3.2f, 0.2f), glm::vec2(3.8f, 3.8f), -1.0f, 1.0f));
+
+	// The rectangle spans a blocked cell
+	EXPECT_TRUE (test.grid().isBlocked(glm::vec2(2.2f, 0.2f), glm::vec2(5.0f, 0.8f), -1.0f, 1.0f));
+
+	// The tile is only filled once
+	EXPECT_EQ(test.fills, 1);
+}
+
+GTEST_TEST(OccupancyGrid, negative) {
+	TestGrid test;
+
+	test.triangles.push_back({ glm::vec3(-4.5f, -4.5f, 0.0f), glm::vec3(-3.5f, -4.5f, 0.0f), glm::vec3(-4.5f, -3.5f, 0.0f), false });
+
+	EXPECT_TRUE (test.grid().isBlocked(glm::vec2(-4.9f, -4.9f), glm::vec2(-4.1f, -4.1f), -1.0f, 1.0f));
+	EXPECT_FALSE(test.grid().isBlocked(glm::vec2(-2.9f, -2.9f), glm::vec2(-0.1f, -0.1f), -1.0f, 1.0f));
+}
+
+GTEST_TEST(OccupancyGrid, degenerate) {
+	TestGrid test;
+
+	// A vertical wall, which has no area in the XY plane
+	test.triangles.push_back({ glm::vec3(1.5f, 0.5f, 0.0f), glm::vec3(1.5f, 3.5f, 0.0f), glm::vec3(1.5f, 3.5f, 1.0f), false });
+
+	EXPECT_TRUE (test.grid().isBlocked(glm::vec2(1.2f, 2.2f), glm::vec2(1.8f, 2.8f), -1.0f, 1.0f));
+	EXPECT_FALSE(test.grid().isBlocked(glm::vec2(0.2f, 2.2f), glm::vec2(0.8f, 2.8f), -1.0f, 1.0f));
+}
+
+GTEST_TEST(OccupancyGrid, layers) {
+	TestGrid test;
+
+	test.triangles.push_back({ glm::vec3(0.5f, 0.5f, 5.0f), glm::vec3(2.5f, 0.5f, 5.0f), glm::vec3(0.5f, 2.5f, 5.0f), false });
+	test.triangles.push_back({ glm::vec3(8.5f, 0.5f, 5.0f), glm::vec3(9.5f, 0.5f, 5.0f), glm::vec3(8.5f, 1.5f, 5.0f), true  });
+
+	const glm::vec2 min(0.2f, 0.2f), max(0.8f, 0.8f);
+
+	EXPECT_FALSE(test.grid().isBlocked(min, max, -1.0f,  1.0f));
+	EXPECT_TRUE (test.grid().isBlocked(min, max,  4.5f,  4.6f));
+	EXPECT_FALSE(test.grid().isBlocked(min, max,  6.5f, 10.0f));
+
+	// Obstacles for all heights are always seen
+	EXPECT_TRUE (test.grid().isBlocked(glm::vec2(8.6f, 0.6f), glm::vec2(8.7f, 0.7f), -1.0f, 1.0f));
+}
+
+GTEST_TEST(OccupancyGrid, invalidate) {
+	TestGrid test;
+
+	const glm::vec2 min(5.2f, 5.2f), max(5.8f, 5.8f);
+
+	EXPECT_FALSE(test.grid().isBlocked(min, max, -1.0f, 1.0f));
+	EXPECT_EQ(test.fills, 1);
+
+	// Without invalidating, the new triangle isn't seen
+	test.triangles.push_back({ glm::vec3(4.5f, 4.5f, 0.0f), glm::vec3(6.5f, 4.5f, 0.0f), glm::vec3(4.5f, 6.5f, 0.0f), false });
+
+	EXPECT_FALSE(test.grid().isBlocked(min, max, -1.0f, 1.0f));
+	EXPECT_EQ(test.fills, 1);
+
+	// Invalidating a different tile doesn't change anything
+	test.grid().invalidate(glm::vec2(-3.0f, -3.0f), glm::vec2(-1.0f, -1.0f));
+
+	EXPECT_FALSE(test.grid().isBlocked(min, max, -1.0f, 1.0f));
+	EXPECT_EQ(test.fills, 1);
+
+	test.grid().invalidate(glm::vec2(5.0f, 5.0f), glm::vec2(5.0f, 5.0f));
+
+	EXPECT_TRUE(test.grid().isBlocked(min, max, -1.0f, 1.0f));
+	EXPECT_EQ(test.fills, 2);
+
+	// A huge rectangle invalidates everything
+	test.triangles.clear();
+	test.grid().invalidate(glm::vec2(-1.0e6f, -1.0e6f), glm::vec2(1.0e6f, 1.0e6f));
+
+	EXPECT_FALSE(test.grid().isBlocked(min, max, -1.0f, 1.0f));
+	EXPECT_EQ(test.fills, 3);
+}
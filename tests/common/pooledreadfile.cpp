@@ -0,0 +1,180 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our pooled file read stream.
+ */
+
+#include <string>
+#include <vector>
+#include <thread>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/platform.h"
+#include "src/common/error.h"
+#include "src/common/pooledreadfile.h"
+
+static const size_t kFileCount = 4;
+static const size_t kFileSize  = 20000;
+
+static boost::filesystem::path kFilePaths[kFileCount];
+
+static byte getPattern(size_t file, size_t i) {
+	return (byte) (i * 7 + (i >> 8) + file * 31);
+}
+
+class PooledReadFile : public ::testing::Test {
+protected:
+	static void SetUpTestCase() {
+		Common::Platform::init();
+
+		boost::filesystem::path tmpPath = boost::filesystem::temp_directory_path();
+
+		for (size_t f = 0; f < kFileCount; f++) {
+			kFilePaths[f] = tmpPath / boost::filesystem::unique_path("%%%%_%%%%_%%%%_%%%%.xoreos");
+
+			boost::filesystem::ofstream testFile(kFilePaths[f], std::ofstream::binary);
+
+			for (size_t i = 0; i < kFileSize; i++)
+				testFile.put((char) getPattern(f, i));
+
+			testFile.close();
+		}
+	}
+
+	static void TearDownTestCase() {
+		Common::PooledReadFile::clearPool();
+		Common::PooledReadFile::setPoolSize(64);
+
+		for (size_t f = 0; f < kFileCount; f++)
+			if (!kFilePaths[f].empty())
+				boost::filesystem::remove(kFilePaths[f]);
+	}
+};
+
+GTEST_TEST_F(PooledReadFile, read) {
+	Common::PooledReadFile file(kFilePaths[0].generic_string());
+	EXPECT_EQ(file.size(), kFileSize);
+	EXPECT_EQ(file.pos(), 0);
+
+	std::vector<byte> data(kFileSize);
+
+	EXPECT_EQ(file.read(data.data(), 10), 10);
+	EXPECT_EQ(file.read(data.data() + 10, kFileSize), kFileSize - 10);
+	EXPECT_TRUE(file.eos());
+
+	for (size_t i = 0; i < kFileSize; i++)
+		ASSERT_EQ(data[i], getPattern(0, i)) << "At index " << i;
+
+	file.seek(-100, Common::SeekableReadStream::kOriginEnd);
+	EXPECT_FALSE(file.eos());
+	EXPECT_EQ(file.readByte(), getPattern(0, kFileSize - 100));
+
+	EXPECT_THROW(file.seek(kFileSize + 1), Common::Exception);
+}
+
+GTEST_TEST_F(PooledReadFile, missing) {
+	EXPECT_THROW(Common::PooledReadFile file("/this/file/does/not/exist.xoreos"), Common::Exception);
+}
+
+GTEST_TEST_F(PooledReadFile, eviction) {
+	Common::PooledReadFile::clearPool();
+	Common::PooledReadFile::setPoolSize(2);
+
+	std::vector<std::unique_ptr<Common::PooledReadFile> > files;
+	for (size_t f = 0; f < kFileCount; f++)
+		files.emplace_back(new Common::PooledReadFile(kFilePaths[f].generic_string()));
+
+	EXPECT_EQ(Common::PooledReadFile::getOpenCount(), 2);
+
+	// Interleaved reads out of more files than the pool holds
+	for (size_t i = 0; i < 200; i++) {
+		for (size_t f = 0; f < kFileCount; f++) {
+			const size_t offset = (i * 4099 + f * 17) % kFileSize;
+
+			files[f]->seek(offset);
+			ASSERT_EQ(files[f]->readByte(), getPattern(f, offset)) << "At " << i << ", " << f;
+		}
+
+		EXPECT_LE(Common::PooledReadFile::getOpenCount(), 2);
+	}
+
+	Common::PooledReadFile::clearPool();
+	EXPECT_EQ(Common::PooledReadFile::getOpenCount(), 0);
+
+	// Files get reopened after clearing the pool
+	byte data[16];
+	EXPECT_EQ(files[1]->readAt(100, data, sizeof(data)), sizeof(data));
+	EXPECT_EQ(data[0], getPattern(1, 100));
+	EXPECT_EQ(Common::PooledReadFile::getOpenCount(), 1);
+
+	Common::PooledReadFile::setPoolSize(64);
+}
+
+GTEST_TEST_F(PooledReadFile, threads) {
+	Common::PooledReadFile::clearPool();
+	Common::PooledReadFile::setPoolSize(2);
+
+	static const size_t kThreadCount = 4;
+
+	std::vector<std::thread> threads;
+	std::vector<size_t> errors(kThreadCount, 0);
+
+	for (size_t t = 0; t < kThreadCount; t++) {
+		threads.emplace_back([&errors, t]() {
+			// Every thread reads all files through its own streams
+			std::vector<std::unique_ptr<Common::PooledReadFile> > files;
+			for (size_t f = 0; f < kFileCount; f++)
+				files.emplace_back(new Common::PooledReadFile(kFilePaths[f].generic_string()));
+
+			for (size_t i = 0; i < 500; i++) {
+				const size_t f      = (i + t) % kFileCount;
+				const size_t offset = ((i + t * 500) * 4099) % (kFileSize - 64);
+
+				byte data[64];
+
+				files[f]->seek(offset);
+				if (files[f]->read(data, sizeof(data)) != sizeof(data)) {
+					errors[t]++;
+					continue;
+				}
+
+				for (size_t j = 0; j < sizeof(data); j++)
+					if (data[j] != getPattern(f, offset + j))
+						errors[t]++;
+			}
+		});
+	}
+
+	for (std::vector<std::thread>::iterator t = threads.begin(); t != threads.end(); ++t)
+		t->join();
+
+	for (size_t t = 0; t < kThreadCount; t++)
+		EXPECT_EQ(errors[t], 0) << "At thread " << t;
+
+	EXPECT_LE(Common::PooledReadFile::getOpenCount(), 2);
+
+	Common::PooledReadFile::setPoolSize(64);
+}
@@ -0,0 +1,202 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our CPU profiler.
+ */
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "src/common/profiler.h"
+#include "src/common/memwritestream.h"
+#include "src/common/threadpool.h"
+
+static void zoneInner() {
+	PROFILE_ZONE("inner");
+}
+
+static void zoneOuter() {
+	PROFILE_ZONE("outer");
+
+	zoneInner();
+	zoneInner();
+}
+
+GTEST_TEST(Profiler, disabled) {
+	ProfilerMan.clear();
+	ProfilerMan.setEnabled(false);
+
+	zoneOuter();
+
+	EXPECT_TRUE(ProfilerMan.getEntries().empty());
+}
+
+GTEST_TEST(Profiler, entries) {
+	ProfilerMan.clear();
+	ProfilerMan.setEnabled(true);
+
+	zoneOuter();
+	zoneOuter();
+
+	ProfilerMan.setEnabled(false);
+
+	const Common::Profiler::Entries entries = ProfilerMan.getEntries();
+	ASSERT_EQ(entries.size(), 2);
+
+	for (const auto &entry : entries) {
+		if (std::string(entry.name) == "outer")
+			EXPECT_EQ(entry.calls, 2);
+		else if (std::string(entry.name) == "inner")
+			EXPECT_EQ(entry.calls, 4);
+		else
+			ADD_FAILURE() << "Unexpected zone " << entry.name;
+	}
+
+	// Times are inclusive
+	EXPECT_STREQ(entries[0].name, "outer");
+}
+
+GTEST_TEST(Profiler, ringBuffer) {
+	ProfilerMan.clear();
+	ProfilerMan.setEnabled(true);
+
+	for (size_t i = 0; i < Common::Profiler::kBufferSize + 10; i++)
+		zoneInner();
+
+	ProfilerMan.setEnabled(false);
+
+	const Common::Profiler::Entries entries = ProfilerMan.getEntries();
+	ASSERT_EQ(entries.size(), 1);
+
+	// Zones pushed out of the ring buffer still count
+	EXPECT_EQ(entries[0].calls, Common::Profiler::kBufferSize + 10);
+
+	Common::MemoryWriteStreamDynamic stream(true);
+	ProfilerMan.writeChromeTrace(stream);
+
+	const std::string trace(reinterpret_cast<const char *>(stream.getData()), stream.size());
+
+	// But only the most recent zones are traced
+	size_t traced = 0;
+	for (size_t pos = trace.find("\"ph\":\"X\""); pos != std::string::npos; pos = trace.find("\"ph\":\"X\"", pos + 1))
+		traced++;
+
+	EXPECT_EQ(traced, Common::Profiler::kBufferSize);
+}
+
+GTEST_TEST(Profiler, threads) {
+	ProfilerMan.clear();
+	ProfilerMan.setEnabled(true);
+
+	ThreadPoolMan.parallelFor(100, [](size_t) { zoneInner(); });
+
+	ProfilerMan.setEnabled(false);
+
+	const Common::Profiler::Entries entries = ProfilerMan.getEntries();
+	ASSERT_EQ(entries.size(), 1);
+	EXPECT_EQ(entries[0].calls, 100);
+}
+
+GTEST_TEST(Profiler, chromeTrace) {
+	ProfilerMan.clear();
+	ProfilerMan.setEnabled(true);
+
+	zoneOuter();
+
+	ProfilerMan.setEnabled(false);
+
+	Common::MemoryWriteStreamDynamic stream(true);
+	ProfilerMan.writeChromeTrace(stream);
+
+	const std::string trace(reinterpret_cast<const char *>(stream.getData()), stream.size());
+
+	EXPECT_EQ(trace.compare(0, 15, "{\"traceEvents\":"), 0);
+	EXPECT_NE(trace.find("\"ph\":\"M\""), std::string::npos);
+	EXPECT_NE(trace.find("{\"name\":\"outer\",\"ph\":\"X\""), std::string::npos);
+	EXPECT_NE(trace.find("{\"name\":\"inner\",\"ph\":\"X\""), std::string::npos);
+	EXPECT_EQ(trace.compare(trace.size() - 2, 2, "}\n"), 0);
+}
+
+GTEST_TEST(Profiler, notes) {
+	ProfilerMan.clear();
+	ProfilerMan.setEnabled(true);
+
+	PROFILE_NOTE("resource", "foo.2da");
+	ProfilerMan.setEnabled(false);
+
+	// Not recorded while disabled
+	PROFILE_NOTE("resource", "bar.2da");
+
+	Common::MemoryWriteStreamDynamic stream(true);
+	ProfilerMan.writeChromeTrace(stream);
+
+	const std::string trace(reinterpret_cast<const char *>(stream.getData()), stream.size());
+
+	EXPECT_NE(trace.find("{\"name\":\"foo.2da\",\"cat\":\"resource\",\"ph\":\"i\""), std::string::npos);
+	EXPECT_EQ(trace.find("bar.2da"), std::string::npos);
+}
+
+GTEST_TEST(Profiler, chromeTraceSince) {
+	ProfilerMan.clear();
+	ProfilerMan.setEnabled(true);
+
+	ProfilerMan.addZone("old", 100, 200);
+	ProfilerMan.addZone("new", 300, 400);
+	ProfilerMan.addZone("overlapping", 150, 350);
+
+	ProfilerMan.setEnabled(false);
+
+	Common::MemoryWriteStreamDynamic stream(true);
+	ProfilerMan.writeChromeTrace(stream, 250);
+
+	const std::string trace(reinterpret_cast<const char *>(stream.getData()), stream.size());
+
+	EXPECT_EQ(trace.find("\"old\""), std::string::npos);
+	EXPECT_NE(trace.find("\"new\""), std::string::npos);
+	EXPECT_NE(trace.find("\"overlapping\""), std::string::npos);
+}
+
+GTEST_TEST(Profiler, tracks) {
+	ProfilerMan.clear();
+	ProfilerMan.setEnabled(true);
+
+	const uint64_t start = Common::Profiler::getTime();
+
+	ProfilerMan.addTrackZone("GPU", "world", start, start + 100);
+	ProfilerMan.addTrackZone("GPU", "world", start + 200, start + 250);
+
+	ProfilerMan.setEnabled(false);
+
+	const Common::Profiler::Entries entries = ProfilerMan.getEntries();
+	ASSERT_EQ(entries.size(), 1);
+	EXPECT_STREQ(entries[0].name, "world");
+	EXPECT_EQ(entries[0].calls, 2);
+	EXPECT_EQ(entries[0].time, 150);
+
+	Common::MemoryWriteStreamDynamic stream(true);
+	ProfilerMan.writeChromeTrace(stream);
+
+	const std::string trace(reinterpret_cast<const char *>(stream.getData()), stream.size());
+
+	// The track shows up like a thread of its own
+	EXPECT_NE(trace.find("\"args\":{\"name\":\"GPU\"}"), std::string::npos);
+}
@@ -23,6 +23,8 @@
  */
 
 #include <string>
+#include <vector>
+#include <thread>
 #include <iostream>
 
 #include <boost/filesystem.hpp>
@@ -32,6 +34,7 @@
 
 #include "src/common/util.h"
 #include "src/common/platform.h"
+#include "src/common/error.h"
 #include "src/common/readfile.h"
 
 boost::filesystem::path kFilePath;
@@ -87,3 +90,140 @@ GTEST_TEST_F(ReadFile, write) {
 	for (size_t i = 0; i < ARRAYSIZE(data); i++)
 		EXPECT_EQ(readData[i], data[i]) << "At index " << i;
 }
+
+static void writePatternFile(size_t size) {
+	boost::filesystem::ofstream testFile(kFilePath, std::ofstream::binary);
+
+	for (size_t i = 0; i < size; i++)
+		testFile.put((char) (i * 7 + (i >> 8)));
+
+	testFile.close();
+}
+
+static byte getPattern(size_t i) {
+	return (byte) (i * 7 + (i >> 8));
+}
+
+GTEST_TEST_F(ReadFile, readAhead) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	static const size_t kFileSize = 100000;
+	writePatternFile(kFileSize);
+
+	static const size_t kReadAheads[] = { 0, 16, 4096, 32768, 1024 * 1024 };
+
+	for (size_t r = 0; r < ARRAYSIZE(kReadAheads); r++) {
+		Common::ReadFile file(kFilePath.generic_string());
+		ASSERT_EQ(file.size(), kFileSize);
+
+		file.setReadAhead(kReadAheads[r]);
+
+		// Small reads and seeks, all over the place
+		size_t position = 0;
+		for (size_t i = 0; i < 2000; i++) {
+			const size_t offset = (i * 7919) % kFileSize;
+			const size_t length = (i % 37) + 1;
+
+			if ((i % 3) != 0) {
+				file.seek(offset);
+				position = offset;
+			}
+
+			byte data[37];
+			const size_t expected = MIN(length, kFileSize - position);
+
+			ASSERT_EQ(file.read(data, length), expected) << "At " << r << ", " << i;
+			for (size_t j = 0; j < expected; j++)
+				ASSERT_EQ(data[j], getPattern(position + j)) << "At " << r << ", " << i << ", " << j;
+
+			position += expected;
+			ASSERT_EQ(file.pos(), position);
+		}
+
+		// One big read over the whole file
+		std::vector<byte> data(kFileSize);
+
+		file.seek(10);
+		ASSERT_EQ(file.read(data.data(), 100), 100);
+		ASSERT_EQ(file.read(data.data() + 100, kFileSize), kFileSize - 110);
+		EXPECT_TRUE(file.eos());
+
+		for (size_t i = 0; i < kFileSize - 10; i++)
+			ASSERT_EQ(data[i], getPattern(i + 10)) << "At " << r << ", " << i;
+	}
+}
+
+GTEST_TEST_F(ReadFile, eos) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	writePatternFile(100);
+
+	Common::ReadFile file(kFilePath.generic_string());
+
+	byte data[100];
+	EXPECT_EQ(file.read(data, 100), 100);
+	EXPECT_FALSE(file.eos());
+
+	EXPECT_EQ(file.read(data, 1), 0);
+	EXPECT_TRUE(file.eos());
+
+	file.seek(-10, Common::SeekableReadStream::kOriginEnd);
+	EXPECT_FALSE(file.eos());
+	EXPECT_EQ(file.pos(), 90);
+
+	EXPECT_EQ(file.read(data, 20), 10);
+	EXPECT_TRUE(file.eos());
+
+	EXPECT_THROW(file.seek(101), Common::Exception);
+	EXPECT_THROW(file.seek(-1), Common::Exception);
+}
+
+GTEST_TEST_F(ReadFile, readAt) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	static const size_t kFileSize = 65536;
+	writePatternFile(kFileSize);
+
+	Common::ReadFile file(kFilePath.generic_string());
+	file.setAccessHint(Common::kFileAccessRandom);
+
+	file.seek(1000);
+
+	static const size_t kThreadCount = 4;
+
+	std::vector<std::thread> threads;
+	std::vector<size_t> errors(kThreadCount, 0);
+
+	for (size_t t = 0; t < kThreadCount; t++) {
+		threads.emplace_back([&file, &errors, t]() {
+			for (size_t i = 0; i < 1000; i++) {
+				const size_t offset = ((i + t * 1000) * 4099) % kFileSize;
+
+				byte data[64];
+				const size_t count = file.readAt(offset, data, sizeof(data));
+				if (count != MIN<size_t>(sizeof(data), kFileSize - offset)) {
+					errors[t]++;
+					continue;
+				}
+
+				for (size_t j = 0; j < count; j++)
+					if (data[j] != getPattern(offset + j))
+						errors[t]++;
+			}
+		});
+	}
+
+	for (std::vector<std::thread>::iterator t = threads.begin(); t != threads.end(); ++t)
+		t->join();
+
+	for (size_t t = 0; t < kThreadCount; t++)
+		EXPECT_EQ(errors[t], 0) << "At thread " << t;
+
+	// Positional reads don't move the stream
+	EXPECT_EQ(file.pos(), 1000);
+	EXPECT_EQ(file.readByte(), getPattern(1000));
+
+	byte data[16];
+	EXPECT_EQ(file.readAt(kFileSize - 4, data, sizeof(data)), 4);
+	EXPECT_EQ(file.readAt(kFileSize, data, sizeof(data)), 0);
+}
@@ -60,6 +60,11 @@ tests_common_test_memreadstream_SOURCES  = tests/common/memreadstream.cpp
 tests_common_test_memreadstream_LDADD    = $(common_LIBS)
 tests_common_test_memreadstream_CXXFLAGS = $(test_CXXFLAGS)
 
+check_PROGRAMS                       += tests/common/test_memreader
+tests_common_test_memreader_SOURCES  = tests/common/memreader.cpp
+tests_common_test_memreader_LDADD    = $(common_LIBS)
+tests_common_test_memreader_CXXFLAGS = $(test_CXXFLAGS)
+
 check_PROGRAMS                           += tests/common/test_memwritestream
 tests_common_test_memwritestream_SOURCES  = tests/common/memwritestream.cpp
 tests_common_test_memwritestream_LDADD    = $(common_LIBS)
@@ -70,11 +75,31 @@ tests_common_test_readfile_SOURCES  = tests/common/readfile.cpp
 tests_common_test_readfile_LDADD    = $(common_LIBS)
 tests_common_test_readfile_CXXFLAGS = $(test_CXXFLAGS)
 
+check_PROGRAMS                            += tests/common/test_pooledreadfile
+tests_common_test_pooledreadfile_SOURCES  = tests/common/pooledreadfile.cpp
+tests_common_test_pooledreadfile_LDADD    = $(common_LIBS)
+tests_common_test_pooledreadfile_CXXFLAGS = $(test_CXXFLAGS)
+
 check_PROGRAMS                      += tests/common/test_writefile
 tests_common_test_writefile_SOURCES  = tests/common/writefile.cpp
 tests_common_test_writefile_LDADD    = $(common_LIBS)
 tests_common_test_writefile_CXXFLAGS = $(test_CXXFLAGS)
 
+check_PROGRAMS                      += tests/common/test_logwriter
+tests_common_test_logwriter_SOURCES  = tests/common/logwriter.cpp
+tests_common_test_logwriter_LDADD    = $(common_LIBS)
+tests_common_test_logwriter_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                          += tests/common/test_fixedtimestep
+tests_common_test_fixedtimestep_SOURCES  = tests/common/fixedtimestep.cpp
+tests_common_test_fixedtimestep_LDADD    = $(common_LIBS)
+tests_common_test_fixedtimestep_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                        += tests/common/test_timerwheel
+tests_common_test_timerwheel_SOURCES  = tests/common/timerwheel.cpp
+tests_common_test_timerwheel_LDADD    = $(common_LIBS)
+tests_common_test_timerwheel_CXXFLAGS = $(test_CXXFLAGS)
+
 check_PROGRAMS                      += tests/common/test_bitstream
 tests_common_test_bitstream_SOURCES  = tests/common/bitstream.cpp
 tests_common_test_bitstream_LDADD    = $(common_LIBS)
@@ -177,6 +202,11 @@ tests_common_test_filelist_SOURCES  = tests/common/filelist.cpp
 tests_common_test_filelist_LDADD    = $(common_LIBS)
 tests_common_test_filelist_CXXFLAGS = $(test_CXXFLAGS)
 
+check_PROGRAMS                        += tests/common/test_dirsnapshot
+tests_common_test_dirsnapshot_SOURCES  = tests/common/dirsnapshot.cpp
+tests_common_test_dirsnapshot_LDADD    = $(common_LIBS)
+tests_common_test_dirsnapshot_CXXFLAGS = $(test_CXXFLAGS)
+
 check_PROGRAMS                 += tests/common/test_hash
 tests_common_test_hash_SOURCES  = tests/common/hash.cpp
 tests_common_test_hash_LDADD    = $(common_LIBS)
@@ -226,6 +256,11 @@ tests_common_test_boundingbox_SOURCES  = tests/common/boundingbox.cpp
 tests_common_test_boundingbox_LDADD    = $(common_LIBS)
 tests_common_test_boundingbox_CXXFLAGS = $(test_CXXFLAGS)
 
+check_PROGRAMS                     += tests/common/test_frustum
+tests_common_test_frustum_SOURCES  = tests/common/frustum.cpp
+tests_common_test_frustum_LDADD    = $(common_LIBS)
+tests_common_test_frustum_CXXFLAGS = $(test_CXXFLAGS)
+
 check_PROGRAMS                 += tests/common/test_rect
 tests_common_test_rect_SOURCES  = tests/common/rect.cpp
 tests_common_test_rect_LDADD    = $(common_LIBS)
@@ -241,7 +276,72 @@ tests_common_test_aabbnode_SOURCES  = tests/common/aabbnode.cpp
 tests_common_test_aabbnode_LDADD    = $(common_LIBS)
 tests_common_test_aabbnode_CXXFLAGS = $(test_CXXFLAGS)
 
+check_PROGRAMS                     += tests/common/test_aabbtree
+tests_common_test_aabbtree_SOURCES  = tests/common/aabbtree.cpp
+tests_common_test_aabbtree_LDADD    = $(common_LIBS)
+tests_common_test_aabbtree_CXXFLAGS = $(test_CXXFLAGS)
+
 check_PROGRAMS                                += tests/common/test_serializationstream
 tests_common_test_serializationstream_SOURCES  = tests/common/serializationstream.cpp
 tests_common_test_serializationstream_LDADD    = $(common_LIBS)
 tests_common_test_serializationstream_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                        += tests/common/test_flathashmap
+tests_common_test_flathashmap_SOURCES  = tests/common/flathashmap.cpp
+tests_common_test_flathashmap_LDADD    = $(common_LIBS)
+tests_common_test_flathashmap_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                        += tests/common/test_spatialgrid
+tests_common_test_spatialgrid_SOURCES  = tests/common/spatialgrid.cpp
+tests_common_test_spatialgrid_LDADD    = $(common_LIBS)
+tests_common_test_spatialgrid_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                          += tests/common/test_occupancygrid
+tests_common_test_occupancygrid_SOURCES  = tests/common/occupancygrid.cpp
+tests_common_test_occupancygrid_LDADD    = $(common_LIBS)
+tests_common_test_occupancygrid_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                        += tests/common/test_istringkey
+tests_common_test_istringkey_SOURCES  = tests/common/istringkey.cpp
+tests_common_test_istringkey_LDADD    = $(common_LIBS)
+tests_common_test_istringkey_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                       += tests/common/test_mappedfile
+tests_common_test_mappedfile_SOURCES  = tests/common/mappedfile.cpp
+tests_common_test_mappedfile_LDADD    = $(common_LIBS)
+tests_common_test_mappedfile_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                             += tests/common/test_sharedreadstream
+tests_common_test_sharedreadstream_SOURCES  = tests/common/sharedreadstream.cpp
+tests_common_test_sharedreadstream_LDADD    = $(common_LIBS)
+tests_common_test_sharedreadstream_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                       += tests/common/test_threadpool
+tests_common_test_threadpool_SOURCES  = tests/common/threadpool.cpp
+tests_common_test_threadpool_LDADD    = $(common_LIBS)
+tests_common_test_threadpool_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                       += tests/common/test_framearena
+tests_common_test_framearena_SOURCES  = tests/common/framearena.cpp
+tests_common_test_framearena_LDADD    = $(common_LIBS)
+tests_common_test_framearena_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                      += tests/common/test_mpscqueue
+tests_common_test_mpscqueue_SOURCES  = tests/common/mpscqueue.cpp
+tests_common_test_mpscqueue_LDADD    = $(common_LIBS)
+tests_common_test_mpscqueue_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                     += tests/common/test_profiler
+tests_common_test_profiler_SOURCES  = tests/common/profiler.cpp
+tests_common_test_profiler_LDADD    = $(common_LIBS)
+tests_common_test_profiler_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                 += tests/common/test_fft
+tests_common_test_fft_SOURCES  = tests/common/fft.cpp
+tests_common_test_fft_LDADD    = $(common_LIBS)
+tests_common_test_fft_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                     += tests/common/test_debugman
+tests_common_test_debugman_SOURCES  = tests/common/debugman.cpp
+tests_common_test_debugman_LDADD    = $(common_LIBS)
+tests_common_test_debugman_CXXFLAGS = $(test_CXXFLAGS)
@@ -0,0 +1,142 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our shared read stream.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/error.h"
+#include "src/common/readstream.h"
+#include "src/common/memreadstream.h"
+#include "src/common/sharedreadstream.h"
+
+/** Data larger than the buffer of a sub-stream, each byte different from its neighbours. */
+static std::vector<byte> makeData(size_t size) {
+	std::vector<byte> data(size);
+
+	for (size_t i = 0; i < size; i++)
+		data[i] = (byte) ((i * 7) ^ (i >> 8));
+
+	return data;
+}
+
+static std::shared_ptr<Common::SharedReadStream> makeShared(const std::vector<byte> &data) {
+	return Common::SharedReadStream::create(new Common::MemoryReadStream(data.data(), data.size()));
+}
+
+GTEST_TEST(SharedReadStream, size) {
+	const std::vector<byte> data = makeData(100);
+	std::shared_ptr<Common::SharedReadStream> shared = makeShared(data);
+
+	EXPECT_EQ(shared->size(), 100);
+
+	std::unique_ptr<Common::SeekableReadStream> sub(shared->createSubStream(10, 20));
+	EXPECT_EQ(sub->size(), 20);
+	EXPECT_EQ(sub->pos(), 0);
+}
+
+GTEST_TEST(SharedReadStream, outOfRange) {
+	const std::vector<byte> data = makeData(100);
+	std::shared_ptr<Common::SharedReadStream> shared = makeShared(data);
+
+	EXPECT_THROW(shared->createSubStream(101,  0), Common::Exception);
+	EXPECT_THROW(shared->createSubStream( 50, 51), Common::Exception);
+
+	std::unique_ptr<Common::SeekableReadStream> sub(shared->createSubStream(50, 50));
+	EXPECT_EQ(sub->size(), 50);
+}
+
+GTEST_TEST(SharedReadStream, read) {
+	const std::vector<byte> data = makeData(20000);
+	std::shared_ptr<Common::SharedReadStream> shared = makeShared(data);
+
+	std::unique_ptr<Common::SeekableReadStream> sub(shared->createSubStream(1000, 15000));
+
+	// Small reads, crossing the buffer boundaries
+	for (size_t i = 0; i < 5000; i++)
+		ASSERT_EQ(sub->readByte(), data[1000 + i]) << "At index " << i;
+
+	// A large read, past the buffer
+	std::vector<byte> readData(8000);
+	EXPECT_EQ(sub->read(readData.data(), readData.size()), readData.size());
+
+	for (size_t i = 0; i < readData.size(); i++)
+		ASSERT_EQ(readData[i], data[6000 + i]) << "At index " << i;
+
+	EXPECT_EQ(sub->pos(), 13000);
+	EXPECT_FALSE(sub->eos());
+
+	// Reading over the end of the sub-stream stops there
+	EXPECT_EQ(sub->read(readData.data(), readData.size()), 2000);
+	EXPECT_TRUE(sub->eos());
+
+	for (size_t i = 0; i < 2000; i++)
+		ASSERT_EQ(readData[i], data[14000 + i]) << "At index " << i;
+}
+
+GTEST_TEST(SharedReadStream, seek) {
+	const std::vector<byte> data = makeData(10000);
+	std::shared_ptr<Common::SharedReadStream> shared = makeShared(data);
+
+	std::unique_ptr<Common::SeekableReadStream> sub(shared->createSubStream(100, 9000));
+
+	sub->seek(8000);
+	EXPECT_EQ(sub->readByte(), data[8100]);
+
+	sub->seek(5);
+	EXPECT_EQ(sub->readByte(), data[105]);
+
+	sub->seek(-1, Common::SeekableReadStream::kOriginEnd);
+	EXPECT_EQ(sub->readByte(), data[9099]);
+
+	EXPECT_THROW(sub->seek(9001), Common::Exception);
+}
+
+GTEST_TEST(SharedReadStream, independent) {
+	const std::vector<byte> data = makeData(10000);
+	std::shared_ptr<Common::SharedReadStream> shared = makeShared(data);
+
+	std::unique_ptr<Common::SeekableReadStream> sub1(shared->createSubStream(   0, 5000));
+	std::unique_ptr<Common::SeekableReadStream> sub2(shared->createSubStream(5000, 5000));
+
+	// Interleaved reads don't disturb each other
+	for (size_t i = 0; i < 5000; i++) {
+		ASSERT_EQ(sub1->readByte(), data[       i]) << "At index " << i;
+		ASSERT_EQ(sub2->readByte(), data[5000 + i]) << "At index " << i;
+	}
+}
+
+GTEST_TEST(SharedReadStream, lifetime) {
+	const std::vector<byte> data = makeData(100);
+	std::shared_ptr<Common::SharedReadStream> shared = makeShared(data);
+
+	std::unique_ptr<Common::SeekableReadStream> sub(shared->createSubStream(10, 10));
+
+	// The sub-stream keeps the shared stream alive
+	shared.reset();
+
+	EXPECT_EQ(sub->readByte(), data[10]);
+}
@@ -0,0 +1,138 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for the uniform spatial grid.
+ */
+
+#include <vector>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+#include "src/common/spatialgrid.h"
+
+static std::vector<int> visitRange(const Common::SpatialGrid<int> &grid, float x, float y, float radius) {
+	std::vector<int> items;
+	grid.visitRange(x, y, radius, [&items](int item) { items.push_back(item); return false; });
+
+	std::sort(items.begin(), items.end());
+	return items;
+}
+
+GTEST_TEST(SpatialGrid, empty) {
+	Common::SpatialGrid<int> grid(10.0f);
+
+	EXPECT_TRUE(grid.empty());
+	EXPECT_EQ(grid.size(), 0);
+
+	EXPECT_FALSE(grid.contains(1));
+	EXPECT_FALSE(grid.remove(1));
+
+	EXPECT_TRUE(visitRange(grid, 0.0f, 0.0f, 100.0f).empty());
+}
+
+GTEST_TEST(SpatialGrid, update) {
+	Common::SpatialGrid<int> grid(10.0f);
+
+	grid.update(1,   5.0f,   5.0f);
+	grid.update(2,  15.0f,   5.0f);
+	grid.update(3, -15.0f, -25.0f);
+
+	EXPECT_EQ(grid.size(), 3);
+	EXPECT_TRUE(grid.contains(2));
+
+	EXPECT_EQ(visitRange(grid, 5.0f, 5.0f, 1.0f), std::vector<int>({ 1 }));
+	EXPECT_EQ(visitRange(grid, 9.0f, 5.0f, 2.0f), std::vector<int>({ 1, 2 }));
+	EXPECT_EQ(visitRange(grid, -15.0f, -25.0f, 1.0f), std::vector<int>({ 3 }));
+
+	// Moving around within a cell and into another one
+	grid.update(1,   6.0f,   6.0f);
+	grid.update(2, -12.0f, -22.0f);
+
+	EXPECT_EQ(grid.size(), 3);
+
+	EXPECT_EQ(visitRange(grid, 9.0f, 5.0f, 2.0f), std::vector<int>({ 1 }));
+	EXPECT_EQ(visitRange(grid, -15.0f, -25.0f, 1.0f), std::vector<int>({ 2, 3 }));
+}
+
+GTEST_TEST(SpatialGrid, remove) {
+	Common::SpatialGrid<int> grid(10.0f);
+
+	grid.update(1, 5.0f, 5.0f);
+	grid.update(2, 6.0f, 6.0f);
+
+	EXPECT_TRUE(grid.remove(1));
+	EXPECT_FALSE(grid.remove(1));
+
+	EXPECT_EQ(grid.size(), 1);
+	EXPECT_EQ(visitRange(grid, 5.0f, 5.0f, 1.0f), std::vector<int>({ 2 }));
+
+	grid.clear();
+
+	EXPECT_TRUE(grid.empty());
+	EXPECT_TRUE(visitRange(grid, 5.0f, 5.0f, 1.0f).empty());
+}
+
+GTEST_TEST(SpatialGrid, rectangles) {
+	Common::SpatialGrid<int> grid(10.0f);
+
+	grid.update(1, 0.0f, 0.0f, 25.0f, 5.0f);
+
+	for (float x = 1.0f; x < 30.0f; x += 10.0f) {
+		std::vector<int> items;
+		grid.visitPoint(x, 1.0f, [&items](int item) { items.push_back(item); return false; });
+
+		EXPECT_EQ(items, std::vector<int>({ 1 })) << "At x " << x;
+	}
+
+	grid.update(1, 40.0f, 0.0f, 45.0f, 5.0f);
+
+	std::vector<int> items;
+	grid.visitPoint(1.0f, 1.0f, [&items](int item) { items.push_back(item); return false; });
+	EXPECT_TRUE(items.empty());
+
+	grid.visitPoint(41.0f, 1.0f, [&items](int item) { items.push_back(item); return false; });
+	EXPECT_EQ(items, std::vector<int>({ 1 }));
+}
+
+GTEST_TEST(SpatialGrid, hugeRange) {
+	Common::SpatialGrid<int> grid(1.0f);
+
+	for (int i = 0; i < 100; i++)
+		grid.update(i, i * 50.0f, -i * 50.0f);
+
+	// Spans way more cells than there are items
+	EXPECT_EQ(visitRange(grid, 0.0f, 0.0f, 1000.0f).size(), 21);
+	EXPECT_EQ(visitRange(grid, 0.0f, 0.0f, 1.0e6f).size(), 100);
+}
+
+GTEST_TEST(SpatialGrid, stop) {
+	Common::SpatialGrid<int> grid(10.0f);
+
+	for (int i = 0; i < 10; i++)
+		grid.update(i, 1.0f, 1.0f);
+
+	size_t count = 0;
+	EXPECT_TRUE(grid.visitRange(1.0f, 1.0f, 1.0f, [&count](int) { return ++count == 3; }));
+	EXPECT_EQ(count, 3);
+
+	EXPECT_FALSE(grid.visitRange(100.0f, 100.0f, 1.0f, [](int) { return true; }));
+}
@@ -0,0 +1,157 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our thread pool.
+ */
+
+#include <vector>
+#include <atomic>
+
+#include "gtest/gtest.h"
+
+#include "src/common/error.h"
+#include "src/common/threadpool.h"
+
+GTEST_TEST(ThreadPool, parallelFor) {
+	std::vector<std::atomic<int>> calls(1000);
+	for (auto &c : calls)
+		c = 0;
+
+	ThreadPoolMan.parallelFor(calls.size(), [&calls](size_t i) { calls[i]++; });
+
+	for (size_t i = 0; i < calls.size(); i++)
+		EXPECT_EQ(calls[i], 1) << "At index " << i;
+
+	ThreadPoolMan.parallelFor(0, [&calls](size_t i) { calls[i]++; });
+	EXPECT_EQ(calls[0], 1);
+}
+
+GTEST_TEST(ThreadPool, nested) {
+	std::atomic<size_t> sum(0);
+
+	ThreadPoolMan.parallelFor(16, [&sum](size_t i) {
+		ThreadPoolMan.parallelFor(16, [&sum, i](size_t j) { sum += i * 16 + j; });
+	});
+
+	EXPECT_EQ(sum, (256 * 255) / 2);
+}
+
+GTEST_TEST(ThreadPool, exception) {
+	std::atomic<size_t> calls(0);
+
+	EXPECT_THROW(ThreadPoolMan.parallelFor(100, [&calls](size_t i) {
+		calls++;
+
+		if (i == 50)
+			throw Common::Exception("Oops");
+	}), Common::Exception);
+
+	EXPECT_EQ(calls, 100);
+}
+
+GTEST_TEST(ThreadPool, threadCount) {
+	EXPECT_GE(ThreadPoolMan.getThreadCount(), 1);
+}
+
+GTEST_TEST(ThreadPool, submit) {
+	std::vector<std::atomic<int>> calls(100);
+	for (auto &c : calls)
+		c = 0;
+
+	std::vector<Common::ThreadPool::TaskHandle> tasks;
+	for (size_t i = 0; i < calls.size(); i++)
+		tasks.push_back(ThreadPoolMan.submit([&calls, i]() { calls[i]++; }));
+
+	ThreadPoolMan.wait(tasks);
+
+	for (size_t i = 0; i < calls.size(); i++) {
+		EXPECT_TRUE(ThreadPoolMan.isDone(tasks[i])) << "At index " << i;
+		EXPECT_EQ(calls[i], 1) << "At index " << i;
+	}
+}
+
+GTEST_TEST(ThreadPool, dependencies) {
+	std::atomic<size_t> stage(0);
+	std::atomic<bool> inOrder(true);
+
+	std::vector<Common::ThreadPool::TaskHandle> first;
+	for (size_t i = 0; i < 10; i++)
+		first.push_back(ThreadPoolMan.submit([&stage]() { stage++; }));
+
+	Common::ThreadPool::TaskHandle second = ThreadPoolMan.submit([&stage, &inOrder]() {
+		if (stage != 10)
+			inOrder = false;
+
+		stage += 10;
+	}, first);
+
+	Common::ThreadPool::TaskHandle third = ThreadPoolMan.submit([&stage, &inOrder]() {
+		if (stage != 20)
+			inOrder = false;
+	}, { second });
+
+	ThreadPoolMan.wait(third);
+
+	EXPECT_TRUE(inOrder);
+	EXPECT_TRUE(ThreadPoolMan.isDone(second));
+	EXPECT_EQ(stage, 20);
+}
+
+GTEST_TEST(ThreadPool, nestedTasks) {
+	std::atomic<size_t> sum(0);
+
+	Common::ThreadPool::TaskHandle outer = ThreadPoolMan.submit([&sum]() {
+		std::vector<Common::ThreadPool::TaskHandle> inner;
+		for (size_t i = 0; i < 16; i++)
+			inner.push_back(ThreadPoolMan.submit([&sum, i]() { sum += i; }));
+
+		ThreadPoolMan.wait(inner);
+	});
+
+	ThreadPoolMan.wait(outer);
+
+	EXPECT_EQ(sum, (16 * 15) / 2);
+}
+
+GTEST_TEST(ThreadPool, taskException) {
+	std::atomic<bool> called(false);
+
+	Common::ThreadPool::TaskHandle failing = ThreadPoolMan.submit([]() { throw Common::Exception("Oops"); });
+	Common::ThreadPool::TaskHandle dependent = ThreadPoolMan.submit([&called]() { called = true; }, { failing });
+
+	EXPECT_THROW(ThreadPoolMan.wait(failing), Common::Exception);
+	EXPECT_THROW(ThreadPoolMan.wait(dependent), Common::Exception);
+	EXPECT_FALSE(called);
+}
+
+GTEST_TEST(ThreadPool, noWorkers) {
+	Common::ThreadPool pool(0);
+	EXPECT_EQ(pool.getThreadCount(), 1);
+
+	bool called = false;
+
+	Common::ThreadPool::TaskHandle first  = pool.submit([&called]() { called = true; });
+	Common::ThreadPool::TaskHandle second = pool.submit([]() { }, { first });
+
+	EXPECT_TRUE(called);
+	EXPECT_TRUE(pool.isDone(first));
+	EXPECT_TRUE(pool.isDone(second));
+}
@@ -0,0 +1,205 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for the Common::TimerWheel class.
+ */
+
+#include <cstdlib>
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "src/common/timerwheel.h"
+
+GTEST_TEST(TimerWheel, advance) {
+	Common::TimerWheel<int> wheel;
+	std::vector<int> due;
+
+	wheel.advance(1000, due);
+	EXPECT_TRUE(due.empty());
+
+	wheel.schedule(1010, 2);
+	wheel.schedule(1005, 1);
+	wheel.schedule(1010, 3);
+	wheel.schedule( 900, 0);
+	EXPECT_EQ(wheel.size(), 4U);
+
+	// Values already in the past are due immediately
+	wheel.advance(1000, due);
+	ASSERT_EQ(due.size(), 1U);
+	EXPECT_EQ(due[0], 0);
+
+	due.clear();
+	wheel.advance(1009, due);
+	ASSERT_EQ(due.size(), 1U);
+	EXPECT_EQ(due[0], 1);
+
+	due.clear();
+	wheel.advance(1010, due);
+	ASSERT_EQ(due.size(), 2U);
+	EXPECT_EQ(due[0], 2);
+	EXPECT_EQ(due[1], 3);
+
+	EXPECT_TRUE(wheel.empty());
+}
+
+GTEST_TEST(TimerWheel, cancel) {
+	Common::TimerWheel<int> wheel;
+	std::vector<int> due;
+
+	Common::TimerWheel<int>::Handle handle1 = wheel.schedule(100, 1);
+	Common::TimerWheel<int>::Handle handle2 = wheel.schedule(100000, 2);
+	wheel.schedule(200, 3);
+
+	EXPECT_TRUE(wheel.cancel(handle1));
+	EXPECT_FALSE(wheel.cancel(handle1));
+	EXPECT_TRUE(wheel.cancel(handle2));
+
+	// A stale handle must not cancel the value now occupying its node
+	Common::TimerWheel<int>::Handle handle4 = wheel.schedule(300, 4);
+	EXPECT_FALSE(wheel.cancel(handle1));
+
+	wheel.advance(1000, due);
+	ASSERT_EQ(due.size(), 2U);
+	EXPECT_EQ(due[0], 3);
+	EXPECT_EQ(due[1], 4);
+
+	EXPECT_FALSE(wheel.cancel(handle4));
+	EXPECT_TRUE(wheel.empty());
+}
+
+GTEST_TEST(TimerWheel, longDelays) {
+	Common::TimerWheel<int> wheel;
+	std::vector<int> due;
+
+	wheel.advance(12345, due);
+
+	// Spread over all levels of the wheel
+	wheel.schedule(12345 + 0x1000000 + 17, 4);
+	wheel.schedule(12345 + 0x10000 + 3, 3);
+	wheel.schedule(12345 + 0x100 + 1, 2);
+	wheel.schedule(12345 + 1, 1);
+
+	const uint32_t expected[] = { 12345 + 1, 12345 + 0x100 + 1, 12345 + 0x10000 + 3, 12345 + 0x1000000 + 17 };
+	for (int i = 0; i < 4; i++) {
+		due.clear();
+
+		wheel.advance(expected[i] - 1, due);
+		EXPECT_TRUE(due.empty()) << i;
+
+		wheel.advance(expected[i], due);
+		ASSERT_EQ(due.size(), 1U) << i;
+		EXPECT_EQ(due[0], i + 1);
+	}
+
+	EXPECT_TRUE(wheel.empty());
+}
+
+GTEST_TEST(TimerWheel, getNextTimestamp) {
+	Common::TimerWheel<int> wheel;
+	std::vector<int> due;
+
+	wheel.advance(1000, due);
+
+	std::multiset<int> timestamps;
+
+	std::srand(23);
+	for (int i = 0; i < 200; i++) {
+		const int timestamp = 1001 + (std::rand() % 200000);
+
+		wheel.schedule(timestamp, timestamp);
+		timestamps.insert(timestamp);
+	}
+
+	// Waking up at the next timestamp never misses a value
+	while (!wheel.empty()) {
+		const uint32_t next = wheel.getNextTimestamp();
+		ASSERT_LE(next, (uint32_t)*timestamps.begin());
+
+		due.clear();
+		wheel.advance(next, due);
+
+		for (std::vector<int>::const_iterator d = due.begin(); d != due.end(); ++d) {
+			EXPECT_EQ((uint32_t)*d, next);
+			timestamps.erase(timestamps.find(*d));
+		}
+	}
+
+	EXPECT_TRUE(timestamps.empty());
+}
+
+GTEST_TEST(TimerWheel, random) {
+	Common::TimerWheel<int> wheel;
+	std::multimap<uint32_t, int> reference;
+	std::map<int, uint32_t> timestamps;
+
+	std::srand(0);
+
+	uint32_t now = 500;
+	for (int i = 0; i < 2000; i++) {
+		const int kind = std::rand() % 50;
+
+		uint32_t delay = std::rand() % 500;
+		if      (kind == 0)
+			delay = std::rand() % 0x2000000;
+		else if (kind < 12)
+			delay = std::rand() % 200000;
+
+		wheel.schedule(now + delay, i);
+		reference.insert(std::make_pair(now + delay, i));
+		timestamps[i] = now + delay;
+
+		if ((i % 10) != 0)
+			continue;
+
+		now += std::rand() % 3000;
+
+		std::vector<int> due;
+		wheel.advance(now, due);
+
+		std::vector<int> expected;
+		while (!reference.empty() && (reference.begin()->first <= now)) {
+			expected.push_back(reference.begin()->second);
+			reference.erase(reference.begin());
+		}
+
+		ASSERT_EQ(due.size(), expected.size()) << now;
+
+		for (size_t j = 1; j < due.size(); j++)
+			EXPECT_LE(timestamps[due[j - 1]], timestamps[due[j]]);
+
+		// Values due at the same time may be collected in a different order
+		std::multiset<int> dueSet(due.begin(), due.end()), expectedSet(expected.begin(), expected.end());
+		EXPECT_EQ(dueSet, expectedSet);
+	}
+
+	EXPECT_EQ(wheel.size(), reference.size());
+
+	// Jumping far ahead collects everything
+	std::vector<int> due;
+	wheel.advance(now + 0x3000000, due);
+
+	EXPECT_EQ(due.size(), reference.size());
+	EXPECT_TRUE(wheel.empty());
+}
@@ -22,6 +22,8 @@
  *  Unit tests for our UString class.
  */
 
+#include <utility>
+
 #include "gtest/gtest.h"
 
 #include "src/common/util.h"
@@ -78,6 +80,28 @@ GTEST_TEST(UString, constructorCopy) {
 	EXPECT_STREQ(str1.c_str(), str3.c_str());
 }
 
+GTEST_TEST(UString, constructorMove) {
+	const Common::UString str(kTestString1);
+
+	Common::UString str1(str);
+	Common::UString str2(std::move(str1));
+
+	EXPECT_EQ(str2, str);
+	EXPECT_EQ(str2.size(), str.size());
+
+	EXPECT_TRUE(str1.empty());
+	EXPECT_EQ(str1.size(), 0);
+
+	Common::UString str3;
+	str3 = std::move(str2);
+
+	EXPECT_EQ(str3, str);
+	EXPECT_EQ(str3.size(), str.size());
+
+	EXPECT_TRUE(str2.empty());
+	EXPECT_EQ(str2.size(), 0);
+}
+
 GTEST_TEST(UString, constructorCopyLength) {
 	const Common::UString str(kTestString1, ARRAYSIZE(kTestStringSub1) - 1);
 
@@ -145,6 +169,29 @@ GTEST_TEST(UString, caseInsensitiveUTF8) {
 	EXPECT_FALSE(str1.equalsIgnoreCase(str2));
 }
 
+GTEST_TEST(UString, compareUTF8) {
+	const Common::UString str1(reinterpret_cast<const char *>(kTestStringUTF8));
+	const Common::UString str2("Foobar");
+	const Common::UString str3("FOOBAR");
+
+	// Characters past ASCII sort after all ASCII characters
+	EXPECT_GT(str1.strcmp(str2), 0);
+	EXPECT_LT(str2.strcmp(str1), 0);
+	EXPECT_GT(str1.stricmp(str3), 0);
+	EXPECT_LT(str3.stricmp(str1), 0);
+
+	EXPECT_EQ(str2.stricmp(str3), 0);
+	EXPECT_LT(Common::UString("Foo").stricmp(str3), 0);
+	EXPECT_GT(str3.stricmp("Foo"), 0);
+}
+
+GTEST_TEST(UString, hashCaseInsensitive) {
+	const Common::hashUStringCaseInsensitive hash;
+
+	EXPECT_EQ(hash(Common::UString(kTestString1)), hash(Common::UString(kTestStringLower1)));
+	EXPECT_EQ(hash(Common::UString(kTestString1)), hash(Common::UString(kTestStringUpper1)));
+}
+
 GTEST_TEST(UString, clear) {
 	Common::UString str(kTestString1);
 
@@ -552,6 +599,27 @@ GTEST_TEST(UString, fromUTF16) {
 	EXPECT_EQ(Common::UString::fromUTF16(0x00F6), 0xF6);
 }
 
+GTEST_TEST(UString, sizeUTF8) {
+	Common::UString str(reinterpret_cast<const char *>(kTestStringUTF8));
+
+	EXPECT_EQ(str.size(), 6);
+
+	str += Common::UString(reinterpret_cast<const char *>(kTestStringUTF8));
+	EXPECT_EQ(str.size(), 12);
+
+	str += 0xF6;
+	EXPECT_EQ(str.size(), 13);
+
+	str += "bar";
+	EXPECT_EQ(str.size(), 16);
+
+	str.makeUpper();
+	EXPECT_EQ(str.size(), 16);
+
+	str.replaceAll(Common::UString(reinterpret_cast<const char *>(kTestStringUTF8) + 1, 4), "o");
+	EXPECT_EQ(str.size(), 14);
+}
+
 GTEST_TEST(UString, append) {
 	Common::UString str("Foobar");
 
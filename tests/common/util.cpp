@@ -161,6 +161,24 @@ GTEST_TEST(Util, readIEEEFloat16) {
 	EXPECT_NEAR(readIEEEFloat16(0x453B), 5.23f, 0.0005);
 }
 
+GTEST_TEST(Util, writeIEEEFloat16) {
+	EXPECT_EQ(writeIEEEFloat16(  0.00f), 0x0000);
+	EXPECT_EQ(writeIEEEFloat16(- 0.00f), 0x8000);
+	EXPECT_EQ(writeIEEEFloat16(  1.00f), 0x3C00);
+	EXPECT_EQ(writeIEEEFloat16(- 1.00f), 0xBC00);
+	EXPECT_EQ(writeIEEEFloat16( 23.50f), 0x4DE0);
+	EXPECT_EQ(writeIEEEFloat16(  5.23f), 0x453B);
+
+	// Too large, too small and denormalized
+	EXPECT_EQ(writeIEEEFloat16(100000.0f), 0x7C00);
+	EXPECT_EQ(writeIEEEFloat16(1.0e-10f), 0x0000);
+	EXPECT_EQ(writeIEEEFloat16(readIEEEFloat16(0x0001)), 0x0001);
+	EXPECT_EQ(writeIEEEFloat16(readIEEEFloat16(0x03FF)), 0x03FF);
+
+	for (uint32_t i = 0; i < 0x7C00; i++)
+		EXPECT_EQ(writeIEEEFloat16(readIEEEFloat16(i)), i);
+}
+
 GTEST_TEST(Util, readNintendoFixedPoint) {
 	EXPECT_DOUBLE_EQ(readNintendoFixedPoint(0x00000000,  true, 15, 16),      0.00);
 	EXPECT_DOUBLE_EQ(readNintendoFixedPoint(0x00010000,  true, 15, 16),      1.00);
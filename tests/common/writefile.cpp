@@ -31,6 +31,7 @@
 #include "gtest/gtest.h"
 
 #include "src/common/util.h"
+#include "src/common/error.h"
 #include "src/common/platform.h"
 #include "src/common/writefile.h"
 
@@ -169,3 +170,55 @@ GTEST_TEST_F(WriteFile, size) {
 	EXPECT_EQ(data[12], 0xCD);
 	EXPECT_EQ(data[13], 0xEF);
 }
+
+GTEST_TEST_F(WriteFile, writeFileAtomically) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	{
+		Common::WriteFile file(kFilePath.generic_string());
+		file.writeString("Old");
+	}
+
+	Common::writeFileAtomically(kFilePath.generic_string(), [](Common::WriteStream &file) {
+		file.writeString("Foobar");
+	});
+
+	boost::filesystem::ifstream testFile(kFilePath, std::ofstream::binary);
+	byte data[6];
+	testFile.read(reinterpret_cast<char *>(data), 6);
+	ASSERT_FALSE(testFile.fail());
+
+	EXPECT_EQ(data[0], 'F');
+	EXPECT_EQ(data[1], 'o');
+	EXPECT_EQ(data[2], 'o');
+	EXPECT_EQ(data[3], 'b');
+	EXPECT_EQ(data[4], 'a');
+	EXPECT_EQ(data[5], 'r');
+
+	EXPECT_EQ(boost::filesystem::file_size(kFilePath), 6);
+}
+
+GTEST_TEST_F(WriteFile, writeFileAtomicallyFailed) {
+	ASSERT_FALSE(kFilePath.empty());
+
+	{
+		Common::WriteFile file(kFilePath.generic_string());
+		file.writeString("Old");
+	}
+
+	EXPECT_THROW(Common::writeFileAtomically(kFilePath.generic_string(), [](Common::WriteStream &file) {
+		file.writeString("Foo");
+		throw Common::Exception("Oops");
+	}), Common::Exception);
+
+	// The old file is still there, and the temporary file is gone
+	EXPECT_EQ(boost::filesystem::file_size(kFilePath), 3);
+
+	size_t fileCount = 0;
+	for (boost::filesystem::directory_iterator f(kFilePath.parent_path()); f != boost::filesystem::directory_iterator(); ++f)
+		if (f->path().filename().generic_string().compare(0, kFilePath.filename().generic_string().size(),
+		                                                  kFilePath.filename().generic_string()) == 0)
+			fileCount++;
+
+	EXPECT_EQ(fileCount, 1);
+}
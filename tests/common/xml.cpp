@@ -22,6 +22,8 @@
  *  Unit tests for our XML parser.
  */
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "src/common/xml.h"
@@ -247,3 +249,126 @@ GTEST_TEST_F(XML, getContentEntities) {
 
 	EXPECT_STREQ(ct->getContent().c_str(), "foobar's barfoo");
 }
+
+GTEST_TEST_F(XML, readerWalk) {
+	Common::MemoryReadStream stream(kXML);
+	Common::XMLReader xml(stream);
+
+	static const Common::XMLReader::NodeType kTypes[] = {
+		Common::XMLReader::kNodeElementStart, Common::XMLReader::kNodeElementStart,
+		Common::XMLReader::kNodeElementEnd  , Common::XMLReader::kNodeElementStart,
+		Common::XMLReader::kNodeElementEnd  , Common::XMLReader::kNodeElementStart,
+		Common::XMLReader::kNodeElementEnd  , Common::XMLReader::kNodeElementStart,
+		Common::XMLReader::kNodeText        , Common::XMLReader::kNodeElementEnd  ,
+		Common::XMLReader::kNodeElementStart, Common::XMLReader::kNodeElementStart,
+		Common::XMLReader::kNodeElementEnd  , Common::XMLReader::kNodeElementEnd  ,
+		Common::XMLReader::kNodeElementStart, Common::XMLReader::kNodeElementEnd  ,
+		Common::XMLReader::kNodeElementStart, Common::XMLReader::kNodeText        ,
+		Common::XMLReader::kNodeElementEnd  , Common::XMLReader::kNodeElementEnd
+	};
+
+	static const char * const kNames[] = {
+		"foo"  , "node1", "node1", "node2", "node2", "node3", "node3", "node4", 0, "node4",
+		"node5", "node6", "node6", "node5", "NoDE7", "NoDE7", "node8", 0, "node8", "foo"
+	};
+
+	static const size_t kDepths[] = {
+		0, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 2, 1, 1, 1, 1, 2, 1, 0
+	};
+
+	EXPECT_EQ(xml.getType(), Common::XMLReader::kNodeNone);
+
+	for (size_t i = 0; i < ARRAYSIZE(kTypes); i++) {
+		ASSERT_TRUE(xml.next()) << "At index " << i;
+
+		EXPECT_EQ(xml.getType(), kTypes[i]) << "At index " << i;
+		EXPECT_EQ(xml.getDepth(), kDepths[i]) << "At index " << i;
+
+		if (kNames[i]) {
+			EXPECT_STREQ(xml.getName().c_str(), kNames[i]) << "At index " << i;
+		}
+	}
+
+	EXPECT_FALSE(xml.next());
+	EXPECT_EQ(xml.getType(), Common::XMLReader::kNodeNone);
+}
+
+GTEST_TEST_F(XML, readerContent) {
+	Common::MemoryReadStream stream(kXML);
+	Common::XMLReader xml(stream);
+
+	std::vector<Common::UString> texts;
+	while (xml.next())
+		if (xml.getType() == Common::XMLReader::kNodeText)
+			texts.push_back(xml.getContent());
+
+	ASSERT_EQ(texts.size(), 2);
+	EXPECT_STREQ(texts[0].c_str(), "blubb");
+	EXPECT_STREQ(texts[1].c_str(), "foobar's barfoo");
+}
+
+GTEST_TEST_F(XML, readerProperties) {
+	Common::MemoryReadStream stream(kXML);
+	Common::XMLReader xml(stream, true);
+
+	bool foundNode3 = false;
+	bool foundNode7 = false;
+	while (xml.next()) {
+		if (xml.getType() != Common::XMLReader::kNodeElementStart)
+			continue;
+
+		if (xml.getName().equalsIgnoreCase("NoDE7")) {
+			foundNode7 = true;
+
+			EXPECT_TRUE(xml.getProperties().empty());
+		}
+
+		if (xml.getName() != "node3")
+			continue;
+
+		foundNode3 = true;
+
+		EXPECT_EQ(xml.getProperties().size(), 2);
+		EXPECT_STREQ(xml.getProperty("prop1").c_str(), "foo");
+		EXPECT_STREQ(xml.getProperty("prop2").c_str(), "bar");
+		EXPECT_STREQ(xml.getProperty("nope", "def").c_str(), "def");
+
+		// Looking at the properties doesn't lose our place in the document
+		ASSERT_TRUE(xml.next());
+		EXPECT_EQ(xml.getType(), Common::XMLReader::kNodeElementEnd);
+		EXPECT_STREQ(xml.getName().c_str(), "node3");
+		EXPECT_TRUE(xml.getProperties().empty());
+	}
+
+	EXPECT_TRUE(foundNode3);
+	EXPECT_TRUE(foundNode7);
+}
+
+GTEST_TEST_F(XML, readerSkip) {
+	Common::MemoryReadStream stream(kXML);
+	Common::XMLReader xml(stream);
+
+	std::vector<Common::UString> starts;
+	while (xml.next()) {
+		if (xml.getType() != Common::XMLReader::kNodeElementStart)
+			continue;
+
+		starts.push_back(xml.getName());
+
+		if ((xml.getName() == "node4") || (xml.getName() == "node5") || (xml.getName() == "node2"))
+			xml.skip();
+	}
+
+	static const char * const kStarts[] = { "foo", "node1", "node2", "node3", "node4", "node5", "NoDE7", "node8" };
+
+	ASSERT_EQ(starts.size(), ARRAYSIZE(kStarts));
+	for (size_t i = 0; i < ARRAYSIZE(kStarts); i++)
+		EXPECT_STREQ(starts[i].c_str(), kStarts[i]) << "At index " << i;
+}
+
+GTEST_TEST_F(XML, readerBroken) {
+	Common::MemoryReadStream stream(kXMLBroken);
+	Common::XMLReader xml(stream);
+
+	EXPECT_THROW(while (xml.next()) {}, Common::Exception);
+}
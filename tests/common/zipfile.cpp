@@ -22,10 +22,15 @@
  *  Unit tests for our ZIP file reader.
  */
 
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
 #include "gtest/gtest.h"
 
 #include "src/common/zipfile.h"
 #include "src/common/memreadstream.h"
+#include "src/common/mappedfile.h"
+#include "src/common/platform.h"
 #include "src/common/error.h"
 
 // Percy Bysshe Shelley's "Ozymandias"
@@ -119,6 +124,41 @@ GTEST_TEST(ZIPFile, getFile) {
 	delete file;
 }
 
+GTEST_TEST(ZIPFile, isFileCompressed) {
+	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kDataCompressed);
+	const Common::ZipFile zip(stream);
+
+	EXPECT_TRUE(zip.isFileCompressed(0));
+	EXPECT_FALSE(zip.isMapped());
+
+	EXPECT_THROW(zip.isFileCompressed(1), Common::Exception);
+}
+
+GTEST_TEST(ZIPFile, getFileMapped) {
+	Common::Platform::init();
+
+	const boost::filesystem::path path = boost::filesystem::temp_directory_path() /
+		boost::filesystem::unique_path("%%%%_%%%%_%%%%_%%%%.xoreos");
+
+	{
+		boost::filesystem::ofstream file(path, std::ios::binary);
+		file.write(reinterpret_cast<const char *>(kDataCompressed), sizeof(kDataCompressed));
+	}
+
+	{
+		const Common::ZipFile zip(new Common::MappedReadStream(path.generic_string()));
+		EXPECT_TRUE(zip.isMapped());
+
+		std::unique_ptr<Common::SeekableReadStream> file(zip.getFile(0));
+		ASSERT_EQ(file->size(), strlen(kDataUncompressed));
+
+		for (size_t i = 0; i < strlen(kDataUncompressed); i++)
+			EXPECT_EQ(file->readByte(), kDataUncompressed[i]) << "At index " << i;
+	}
+
+	boost::filesystem::remove(path);
+}
+
 GTEST_TEST(ZIPFile, brokenZIP) {
 	Common::MemoryReadStream *stream = new Common::MemoryReadStream(kDataCompressed, sizeof(kDataCompressed) / 2);
 
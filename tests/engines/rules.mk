@@ -34,3 +34,8 @@ check_PROGRAMS                     += tests/engines/test_trigger
 tests_engines_test_trigger_SOURCES  = tests/engines/trigger.cpp
 tests_engines_test_trigger_LDADD    = $(engines_LIBS)
 tests_engines_test_trigger_CXXFLAGS = $(test_CXXFLAGS)
+
+check_PROGRAMS                      += tests/engines/test_tokenman
+tests_engines_test_tokenman_SOURCES  = tests/engines/tokenman.cpp
+tests_engines_test_tokenman_LDADD    = $(engines_LIBS)
+tests_engines_test_tokenman_CXXFLAGS = $(test_CXXFLAGS)
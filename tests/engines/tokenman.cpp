@@ -0,0 +1,93 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for the Engines::TokenManager class.
+ */
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+#include "src/common/ustring.h"
+
+#include "src/engines/aurora/tokenman.h"
+
+class TokenManager : public ::testing::Test {
+protected:
+	void SetUp() {
+		TokenMan.clear();
+
+		TokenMan.set("<FirstName>", "Aribeth");
+		TokenMan.set("<CUSTOM0>"  , "Neverwinter");
+		TokenMan.set("<Empty>"    , "");
+	}
+
+	void TearDown() {
+		TokenMan.clear();
+	}
+};
+
+GTEST_TEST_F(TokenManager, plain) {
+	EXPECT_STREQ(TokenMan.parse("Foobar").c_str(), "Foobar");
+	EXPECT_STREQ(TokenMan.parse("").c_str(), "");
+	EXPECT_STREQ(TokenMan.parse("Foo > bar").c_str(), "Foo > bar");
+}
+
+GTEST_TEST_F(TokenManager, tokens) {
+	EXPECT_STREQ(TokenMan.parse("<FirstName>").c_str(), "Aribeth");
+	EXPECT_STREQ(TokenMan.parse("Hello, <FirstName> of <CUSTOM0>!").c_str(), "Hello, Aribeth of Neverwinter!");
+	EXPECT_STREQ(TokenMan.parse("<FirstName><FirstName>").c_str(), "AribethAribeth");
+	EXPECT_STREQ(TokenMan.parse("a<Empty>b").c_str(), "ab");
+}
+
+GTEST_TEST_F(TokenManager, unknownTokens) {
+	EXPECT_STREQ(TokenMan.parse("<LastName>").c_str(), "<LastName>");
+	EXPECT_STREQ(TokenMan.parse("<firstname>").c_str(), "<firstname>");
+	EXPECT_STREQ(TokenMan.parse("<LastName> <FirstName>").c_str(), "<LastName> Aribeth");
+}
+
+GTEST_TEST_F(TokenManager, brokenTokens) {
+	EXPECT_STREQ(TokenMan.parse("<FirstName").c_str(), "<FirstName");
+	EXPECT_STREQ(TokenMan.parse("<FirstName>, <CUSTOM0").c_str(), "Aribeth, <CUSTOM0");
+	EXPECT_STREQ(TokenMan.parse("<Foo <FirstName>").c_str(), "<Foo Aribeth");
+	EXPECT_STREQ(TokenMan.parse("<<FirstName>>").c_str(), "<Aribeth>");
+}
+
+GTEST_TEST_F(TokenManager, utf8) {
+	TokenMan.set("<Stra\xC3\x9F" "e>", "Weg");
+
+	EXPECT_STREQ(TokenMan.parse("\xC3\xA4<FirstName>\xC3\xB6").c_str(), "\xC3\xA4" "Aribeth\xC3\xB6");
+	EXPECT_STREQ(TokenMan.parse("<Stra\xC3\x9F" "e>").c_str(), "Weg");
+}
+
+GTEST_TEST_F(TokenManager, remove) {
+	TokenMan.remove("<FirstName>");
+	TokenMan.remove("<Nope>");
+
+	EXPECT_STREQ(TokenMan.parse("<FirstName> of <CUSTOM0>").c_str(), "<FirstName> of Neverwinter");
+}
+
+GTEST_TEST_F(TokenManager, parseInPlace) {
+	Common::UString str = "Hello, <FirstName>";
+	TokenMan.parse(str);
+
+	EXPECT_STREQ(str.c_str(), "Hello, Aribeth");
+	EXPECT_EQ(str.size(), 14);
+}
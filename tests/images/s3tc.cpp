@@ -0,0 +1,144 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ *  Unit tests for our S3TC DXTn compression and decompression.
+ */
+
+#include <cstring>
+#include <cstdlib>
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "src/common/util.h"
+
+#include "src/graphics/images/s3tc.h"
+
+/** Create an RGBA8 image with smooth gradients, and alpha if wanted. */
+static std::vector<byte> createGradient(uint32_t width, uint32_t height, bool alpha) {
+	std::vector<byte> image(width * height * 4);
+
+	for (uint32_t y = 0; y < height; y++) {
+		for (uint32_t x = 0; x < width; x++) {
+			byte *pixel = &image[(y * width + x) * 4];
+
+			pixel[0] = (x * 255) / MAX<uint32_t>(width  - 1, 1);
+			pixel[1] = (y * 255) / MAX<uint32_t>(height - 1, 1);
+			pixel[2] = 255 - pixel[0];
+			pixel[3] = alpha ? pixel[1] : 0xFF;
+		}
+	}
+
+	return image;
+}
+
+/** Return the largest difference of any pixel component of two RGBA8 images. */
+static int getMaxError(const std::vector<byte> &a, const std::vector<byte> &b, bool alpha) {
+	int maxError = 0;
+	for (size_t i = 0; i < a.size(); i++) {
+		if (!alpha && ((i % 4) == 3))
+			continue;
+
+		maxError = MAX(maxError, std::abs((int)a[i] - (int)b[i]));
+	}
+
+	return maxError;
+}
+
+GTEST_TEST(S3TC, compressDXT1Solid) {
+	std::vector<byte> image(8 * 8 * 4);
+	for (size_t i = 0; i < image.size(); i += 4) {
+		image[i + 0] = 0xFF;
+		image[i + 1] = 0x82;
+		image[i + 2] = 0x08;
+		image[i + 3] = 0xFF;
+	}
+
+	std::vector<byte> compressed(4 * 8);
+	Graphics::compressDXT1(compressed.data(), image.data(), 8, 8, 8 * 4);
+
+	std::vector<byte> decompressed(image.size());
+	Graphics::decompressDXT1(decompressed.data(), compressed.data(), compressed.size(), 8, 8, 8 * 4);
+
+	// A color exactly representable in 5:6:5 comes out unchanged
+	EXPECT_EQ(getMaxError(image, decompressed, true), 0);
+}
+
+GTEST_TEST(S3TC, compressDXT1Gradient) {
+	const std::vector<byte> image = createGradient(64, 32, false);
+
+	std::vector<byte> compressed(16 * 8 * 8);
+	Graphics::compressDXT1(compressed.data(), image.data(), 64, 32, 64 * 4);
+
+	std::vector<byte> decompressed(image.size());
+	Graphics::decompressDXT1(decompressed.data(), compressed.data(), compressed.size(), 64, 32, 64 * 4);
+
+	EXPECT_LE(getMaxError(image, decompressed, false), 16);
+
+	// Stays fully opaque
+	for (size_t i = 3; i < decompressed.size(); i += 4)
+		EXPECT_EQ(decompressed[i], 0xFF) << "At index " << i;
+}
+
+GTEST_TEST(S3TC, compressDXT5Gradient) {
+	const std::vector<byte> image = createGradient(64, 64, true);
+
+	std::vector<byte> compressed(16 * 16 * 16);
+	Graphics::compressDXT5(compressed.data(), image.data(), 64, 64, 64 * 4);
+
+	std::vector<byte> decompressed(image.size());
+	Graphics::decompressDXT5(decompressed.data(), compressed.data(), compressed.size(), 64, 64, 64 * 4);
+
+	EXPECT_LE(getMaxError(image, decompressed, true), 16);
+}
+
+GTEST_TEST(S3TC, compressDXT5AlphaEdges) {
+	// A block with only fully transparent and fully opaque pixels keeps them exactly
+	std::vector<byte> image(4 * 4 * 4, 0x40);
+	for (size_t i = 0; i < 16; i++)
+		image[i * 4 + 3] = (i % 3) ? 0xFF : 0x00;
+
+	byte compressed[16];
+	Graphics::compressDXT5(compressed, image.data(), 4, 4, 4 * 4);
+
+	std::vector<byte> decompressed(image.size());
+	Graphics::decompressDXT5(decompressed.data(), compressed, sizeof(compressed), 4, 4, 4 * 4);
+
+	for (size_t i = 0; i < 16; i++)
+		EXPECT_EQ(decompressed[i * 4 + 3], image[i * 4 + 3]) << "At pixel " << i;
+}
+
+GTEST_TEST(S3TC, compressPartialBlocks) {
+	// Images smaller than a block are padded with their edge pixels
+	const std::vector<byte> image = createGradient(2, 3, true);
+
+	std::vector<byte> padded(4 * 4 * 4);
+	for (uint32_t y = 0; y < 4; y++)
+		for (uint32_t x = 0; x < 4; x++)
+			std::memcpy(&padded[(y * 4 + x) * 4], &image[(MIN<uint32_t>(y, 2) * 2 + MIN<uint32_t>(x, 1)) * 4], 4);
+
+	byte compressed[16], compressedPadded[16];
+	Graphics::compressDXT5(compressed      , image .data(), 2, 3, 2 * 4);
+	Graphics::compressDXT5(compressedPadded, padded.data(), 4, 4, 4 * 4);
+
+	EXPECT_EQ(std::memcmp(compressed, compressedPadded, sizeof(compressed)), 0);
+}